@@ -97,6 +97,15 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_SSE42 "Build with SSE4.2 if compiler has support" ON)
 
+  define_option_string(ARROW_RUNTIME_SIMD_LEVEL
+                       "Max instruction set of the kernels selected at runtime"
+                       "MAX"
+                       "NONE"
+                       "SSE4_2"
+                       "AVX2"
+                       "AVX512"
+                       "MAX")
+
   define_option(ARROW_ALTIVEC "Build with Altivec if compiler has support" ON)
 
   define_option(ARROW_RPATH_ORIGIN "Build Arrow libraries with RATH set to \$ORIGIN" OFF)
@@ -253,6 +262,9 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_WITH_BACKTRACE "Build with backtrace support" ON)
 
+  define_option(ARROW_WITH_TRACING
+                "Build with spans traced through arrow/util/tracing.h" OFF)
+
   define_option(ARROW_USE_GLOG "Build libraries with glog support for pluggable logging"
                 OFF)
 
@@ -20,6 +20,15 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+if(MSVC)
+  set(ARROW_AVX2_FLAG "/arch:AVX2")
+  set(ARROW_AVX512_FLAG "/arch:AVX512")
+else()
+  set(ARROW_AVX2_FLAG "-mavx2")
+  set(ARROW_AVX512_FLAG "-mavx512f -mavx512cd -mavx512vl -mavx512dq -mavx512bw -mbmi2")
+endif()
+check_cxx_compiler_flag(${ARROW_AVX2_FLAG} CXX_SUPPORTS_AVX2)
+check_cxx_compiler_flag(${ARROW_AVX512_FLAG} CXX_SUPPORTS_AVX512)
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
@@ -278,6 +287,19 @@ if(ARROW_USE_SIMD)
   add_definitions(-DARROW_USE_SIMD)
 endif()
 
+# Some kernels are also built for instruction sets above the baseline, and
+# selected at runtime (see arrow/util/dispatch.h)
+if(ARROW_USE_SIMD AND CXX_SUPPORTS_AVX2
+   AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX2|AVX512|MAX)$")
+  set(ARROW_HAVE_RUNTIME_AVX2 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+endif()
+if(ARROW_USE_SIMD AND CXX_SUPPORTS_AVX512
+   AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX512|MAX)$")
+  set(ARROW_HAVE_RUNTIME_AVX512 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+endif()
+
 # ----------------------------------------------------------------------
 # Setup Gold linker, if available. Code originally from Apache Kudu
 
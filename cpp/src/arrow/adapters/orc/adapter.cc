@@ -20,8 +20,12 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -29,9 +33,11 @@
 
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -39,10 +45,14 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/string_view.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -77,10 +87,72 @@ namespace orc {
   ORC_ASSIGN_OR_THROW_IMPL(ARROW_ASSIGN_OR_RAISE_NAME(_error_or_value, __COUNTER__), \
                            lhs, rexpr);
 
+// The coalesced reads of stripes of a file, started ahead of their decoding
+class StripeReadCache {
+ public:
+  explicit StripeReadCache(std::shared_ptr<io::RandomAccessFile> file)
+      : file_(std::move(file)) {}
+
+  // Start reading ranges of the stripe at [stripe_offset, stripe_end) in the
+  // background, unless they are already
+  Status Cache(uint64_t stripe_offset, uint64_t stripe_end,
+               std::vector<io::ReadRange> ranges, const io::CacheOptions& options) {
+    auto cache = std::make_shared<io::internal::ReadRangeCache>(file_, options);
+    RETURN_NOT_OK(cache->Cache(std::move(ranges)));
+    std::lock_guard<std::mutex> lock(mutex_);
+    stripes_.emplace(stripe_offset, std::make_pair(stripe_end, std::move(cache)));
+    return Status::OK();
+  }
+
+  bool Contains(uint64_t stripe_offset) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stripes_.find(stripe_offset) != stripes_.end();
+  }
+
+  // Drop the ranges of a stripe, whose reads may no longer be served by the
+  // cache
+  void Evict(uint64_t stripe_offset) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stripes_.erase(stripe_offset);
+  }
+
+  // Read a range of a cached stripe, or return null if it isn't cached
+  Result<std::shared_ptr<Buffer>> Read(uint64_t offset, uint64_t length) {
+    std::shared_ptr<io::internal::ReadRangeCache> cache;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = stripes_.upper_bound(offset);
+      if (it == stripes_.begin()) {
+        return nullptr;
+      }
+      --it;
+      if (offset + length > it->second.first) {
+        return nullptr;
+      }
+      cache = it->second.second;
+    }
+    auto result =
+        cache->Read({static_cast<int64_t>(offset), static_cast<int64_t>(length)});
+    // Ranges of unselected columns aren't cached
+    if (result.status().IsInvalid()) {
+      return nullptr;
+    }
+    return result;
+  }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> file_;
+  std::mutex mutex_;
+  // The end and the cached ranges of the stripes, by offset
+  std::map<uint64_t, std::pair<uint64_t, std::shared_ptr<io::internal::ReadRangeCache>>>
+      stripes_;
+};
+
 class ArrowInputFile : public liborc::InputStream {
  public:
-  explicit ArrowInputFile(const std::shared_ptr<io::RandomAccessFile>& file)
-      : file_(file) {}
+  explicit ArrowInputFile(const std::shared_ptr<io::RandomAccessFile>& file,
+                          std::shared_ptr<StripeReadCache> read_cache = nullptr)
+      : file_(file), read_cache_(std::move(read_cache)) {}
 
   uint64_t getLength() const override {
     ORC_ASSIGN_OR_THROW(int64_t size, file_->GetSize());
@@ -90,6 +162,14 @@ class ArrowInputFile : public liborc::InputStream {
   uint64_t getNaturalReadSize() const override { return 128 * 1024; }
 
   void read(void* buf, uint64_t length, uint64_t offset) override {
+    if (read_cache_ != nullptr) {
+      ORC_ASSIGN_OR_THROW(auto buffer, read_cache_->Read(offset, length));
+      if (buffer != nullptr) {
+        std::memcpy(buf, buffer->data(), static_cast<size_t>(length));
+        return;
+      }
+    }
+
     ORC_ASSIGN_OR_THROW(int64_t bytes_read, file_->ReadAt(offset, length, buf));
 
     if (static_cast<uint64_t>(bytes_read) != length) {
@@ -104,6 +184,7 @@ class ArrowInputFile : public liborc::InputStream {
 
  private:
   std::shared_ptr<io::RandomAccessFile> file_;
+  std::shared_ptr<StripeReadCache> read_cache_;
 };
 
 struct StripeInformation {
@@ -116,6 +197,137 @@ struct StripeInformation {
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
+template <typename CType>
+static Status IntegerBounds(const liborc::IntegerColumnStatistics& statistics,
+                            StripeColumnStatistics* out) {
+  out->min = MakeScalar(static_cast<CType>(statistics.getMinimum()));
+  out->max = MakeScalar(static_cast<CType>(statistics.getMaximum()));
+  return Status::OK();
+}
+
+// Convert the bounds of column statistics to scalars of the column's type, if
+// they are known
+static Status GetColumnStatistics(const liborc::ColumnStatistics& statistics,
+                                  const DataType& type, StripeColumnStatistics* out) {
+  out->num_values = static_cast<int64_t>(statistics.getNumberOfValues());
+  out->has_null = statistics.hasNull();
+
+  if (auto integer = dynamic_cast<const liborc::IntegerColumnStatistics*>(&statistics)) {
+    if (!integer->hasMinimum() || !integer->hasMaximum()) {
+      return Status::OK();
+    }
+    switch (type.id()) {
+      case Type::INT8:
+        return IntegerBounds<int8_t>(*integer, out);
+      case Type::INT16:
+        return IntegerBounds<int16_t>(*integer, out);
+      case Type::INT32:
+        return IntegerBounds<int32_t>(*integer, out);
+      case Type::INT64:
+        return IntegerBounds<int64_t>(*integer, out);
+      default:
+        return Status::OK();
+    }
+  }
+
+  if (auto floating = dynamic_cast<const liborc::DoubleColumnStatistics*>(&statistics)) {
+    if (!floating->hasMinimum() || !floating->hasMaximum()) {
+      return Status::OK();
+    }
+    if (type.id() == Type::FLOAT) {
+      out->min = MakeScalar(static_cast<float>(floating->getMinimum()));
+      out->max = MakeScalar(static_cast<float>(floating->getMaximum()));
+    } else if (type.id() == Type::DOUBLE) {
+      out->min = MakeScalar(floating->getMinimum());
+      out->max = MakeScalar(floating->getMaximum());
+    }
+    return Status::OK();
+  }
+
+  if (auto string = dynamic_cast<const liborc::StringColumnStatistics*>(&statistics)) {
+    if (string->hasMinimum() && string->hasMaximum() && type.id() == Type::STRING) {
+      out->min = MakeScalar(string->getMinimum());
+      out->max = MakeScalar(string->getMaximum());
+    }
+    return Status::OK();
+  }
+
+  if (auto date = dynamic_cast<const liborc::DateColumnStatistics*>(&statistics)) {
+    if (date->hasMinimum() && date->hasMaximum() && type.id() == Type::DATE32) {
+      out->min = std::make_shared<Date32Scalar>(date->getMinimum());
+      out->max = std::make_shared<Date32Scalar>(date->getMaximum());
+    }
+    return Status::OK();
+  }
+
+  return Status::OK();
+}
+
+template <typename ArrowType>
+static int CompareValues(const Scalar& left, const Scalar& right) {
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  const auto& left_value = checked_cast<const ScalarType&>(left).value;
+  const auto& right_value = checked_cast<const ScalarType&>(right).value;
+  return left_value < right_value ? -1 : (right_value < left_value ? 1 : 0);
+}
+
+// Compare scalars of a type of which GetColumnStatistics reads bounds
+static int CompareBounds(const Scalar& left, const Scalar& right) {
+  switch (left.type->id()) {
+    case Type::INT8:
+      return CompareValues<Int8Type>(left, right);
+    case Type::INT16:
+      return CompareValues<Int16Type>(left, right);
+    case Type::INT32:
+      return CompareValues<Int32Type>(left, right);
+    case Type::INT64:
+      return CompareValues<Int64Type>(left, right);
+    case Type::FLOAT:
+      return CompareValues<FloatType>(left, right);
+    case Type::DOUBLE:
+      return CompareValues<DoubleType>(left, right);
+    case Type::DATE32:
+      return CompareValues<Date32Type>(left, right);
+    default: {
+      auto left_value = util::string_view(*checked_cast<const StringScalar&>(left).value);
+      auto right_value =
+          util::string_view(*checked_cast<const StringScalar&>(right).value);
+      return left_value.compare(right_value);
+    }
+  }
+}
+
+// Whether a predicate may hold for some row of a column, given its statistics
+static bool PredicateMayHold(const ColumnPredicate& predicate,
+                             const StripeColumnStatistics& statistics) {
+  if (predicate.op == ColumnPredicate::IS_NULL) {
+    return statistics.has_null;
+  }
+  // Comparisons with nulls don't hold
+  if (statistics.num_values == 0) {
+    return false;
+  }
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return true;
+  }
+  const int min_cmp = CompareBounds(*statistics.min, *predicate.value);
+  const int max_cmp = CompareBounds(*statistics.max, *predicate.value);
+  switch (predicate.op) {
+    case ColumnPredicate::EQUAL:
+      return min_cmp <= 0 && max_cmp >= 0;
+    case ColumnPredicate::LESS:
+      return min_cmp < 0;
+    case ColumnPredicate::LESS_EQUAL:
+      return min_cmp <= 0;
+    case ColumnPredicate::GREATER:
+      return max_cmp > 0;
+    case ColumnPredicate::GREATER_EQUAL:
+      return max_cmp >= 0;
+    default:
+      return true;
+  }
+}
+
 class OrcStripeReader : public RecordBatchReader {
  public:
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
@@ -163,13 +375,31 @@ class OrcStripeReader : public RecordBatchReader {
   int64_t batch_size_;
 };
 
+// Read the batches of a stripe which are decoded ahead in the background
+class ReadaheadStripeReader : public RecordBatchReader {
+ public:
+  ReadaheadStripeReader(std::shared_ptr<Schema> schema, RecordBatchIterator batches)
+      : schema_(std::move(schema)), batches_(std::move(batches)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    return batches_.Next().Value(out);
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchIterator batches_;
+};
+
 class ORCFileReader::Impl {
  public:
   Impl() {}
   ~Impl() {}
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool) {
-    std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file));
+    read_cache_ = std::make_shared<StripeReadCache>(file);
+    std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file, read_cache_));
     liborc::ReaderOptions options;
     std::unique_ptr<liborc::Reader> liborc_reader;
     try {
@@ -177,6 +407,7 @@ class ORCFileReader::Impl {
     } catch (const liborc::ParseError& e) {
       return Status::IOError(e.what());
     }
+    file_ = file;
     pool_ = pool;
     reader_ = std::move(liborc_reader);
     current_row_ = 0;
@@ -184,6 +415,20 @@ class ORCFileReader::Impl {
     return Init();
   }
 
+  // Open another liborc reader of the file, for use by another thread, from
+  // the already parsed file tail
+  Status OpenReader(std::unique_ptr<liborc::Reader>* out) {
+    std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file_, read_cache_));
+    liborc::ReaderOptions options;
+    try {
+      options.setSerializedFileTail(reader_->getSerializedFileTail());
+      *out = createReader(std::move(io_wrapper), options);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
   Status Init() {
     int64_t nstripes = reader_->getNumberOfStripes();
     stripes_.resize(nstripes);
@@ -200,8 +445,134 @@ class ORCFileReader::Impl {
 
   int64_t NumberOfStripes() { return stripes_.size(); }
 
+  Status ReadStripeStatistics(int64_t stripe, std::vector<StripeColumnStatistics>* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    out->clear();
+
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(&schema));
+    const liborc::Type& type = reader_->getType();
+    try {
+      if (static_cast<uint64_t>(stripe) >= reader_->getNumberOfStripeStatistics()) {
+        return Status::OK();
+      }
+      auto statistics = reader_->getStripeStatistics(static_cast<uint64_t>(stripe));
+      for (int i = 0; i < schema->num_fields(); ++i) {
+        StripeColumnStatistics column;
+        const auto column_id = type.getSubtype(i)->getColumnId();
+        if (column_id < statistics->getNumberOfColumns()) {
+          RETURN_NOT_OK(GetColumnStatistics(
+              *statistics->getColumnStatistics(static_cast<uint32_t>(column_id)),
+              *schema->field(i)->type(), &column));
+        }
+        out->push_back(std::move(column));
+      }
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
 
+  Status SetPredicates(std::vector<ColumnPredicate> predicates) {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(&schema));
+    for (const auto& predicate : predicates) {
+      auto field = schema->GetFieldByName(predicate.column);
+      if (field == nullptr) {
+        return Status::Invalid("No column named ", predicate.column);
+      }
+      if (predicate.op != ColumnPredicate::IS_NULL &&
+          (predicate.value == nullptr || !predicate.value->is_valid ||
+           !predicate.value->type->Equals(*field->type()))) {
+        return Status::TypeError("Predicate on the ", field->type()->ToString(),
+                                 " column ", predicate.column,
+                                 " must compare with a valid scalar of its type");
+      }
+    }
+    predicates_ = std::move(predicates);
+    return Status::OK();
+  }
+
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
+  void set_batch_readahead(int32_t batch_readahead) {
+    batch_readahead_ = batch_readahead;
+  }
+
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  void set_cache_options(io::CacheOptions options) { cache_options_ = options; }
+
+  // Start reading the streams of the columns selected by the options in a
+  // stripe, coalesced, if pre-buffering is enabled. The stripe footer is read
+  // to locate the streams.
+  Status PreBufferStripe(liborc::Reader* reader, const liborc::RowReaderOptions& opts,
+                         int64_t stripe) {
+    const auto& info = stripes_[stripe];
+    if (!pre_buffer_ || read_cache_->Contains(info.offset)) {
+      return Status::OK();
+    }
+    std::vector<io::ReadRange> ranges;
+    try {
+      // The columns of the selected top-level fields and their descendants
+      const liborc::Type& type = reader->getType();
+      std::vector<bool> selected(type.getMaximumColumnId() + 1, !opts.getIndexesSet());
+      selected[type.getColumnId()] = true;
+      if (opts.getIndexesSet()) {
+        for (uint64_t index : opts.getInclude()) {
+          if (index < type.getSubtypeCount()) {
+            const liborc::Type* field = type.getSubtype(index);
+            std::fill(selected.begin() + field->getColumnId(),
+                      selected.begin() + field->getMaximumColumnId() + 1, true);
+          }
+        }
+      }
+
+      auto stripe_info = reader->getStripe(static_cast<uint64_t>(stripe));
+      for (uint64_t i = 0; i < stripe_info->getNumberOfStreams(); ++i) {
+        auto stream = stripe_info->getStreamInformation(i);
+        if (stream->getColumnId() < selected.size() && selected[stream->getColumnId()]) {
+          ranges.push_back({static_cast<int64_t>(stream->getOffset()),
+                            static_cast<int64_t>(stream->getLength())});
+        }
+      }
+      ranges.push_back({static_cast<int64_t>(stripe_info->getOffset() +
+                                             stripe_info->getIndexLength() +
+                                             stripe_info->getDataLength()),
+                        static_cast<int64_t>(stripe_info->getFooterLength())});
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return read_cache_->Cache(info.offset, info.offset + info.length, std::move(ranges),
+                              cache_options_);
+  }
+
+  void EvictStripe(int64_t stripe) { read_cache_->Evict(stripes_[stripe].offset); }
+
+  // Whether the predicates may hold for some row of a stripe. Errors reading
+  // statistics are ignored, the stripe being read.
+  bool StripeMayMatch(int64_t stripe) {
+    if (predicates_.empty()) {
+      return true;
+    }
+    std::shared_ptr<Schema> schema;
+    std::vector<StripeColumnStatistics> statistics;
+    if (!ReadSchema(&schema).ok() || !ReadStripeStatistics(stripe, &statistics).ok() ||
+        statistics.empty()) {
+      return true;
+    }
+    for (const auto& predicate : predicates_) {
+      const int i = schema->GetFieldIndex(predicate.column);
+      if (!PredicateMayHold(predicate, statistics[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   Status ReadSchema(std::shared_ptr<Schema>* out) {
     const liborc::Type& type = reader_->getType();
     return GetArrowSchema(type, out);
@@ -277,7 +648,10 @@ class ORCFileReader::Impl {
     RETURN_NOT_OK(SelectStripe(&opts, stripe));
     std::shared_ptr<Schema> schema;
     RETURN_NOT_OK(ReadSchema(opts, &schema));
-    return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
+    RETURN_NOT_OK(PreBufferStripe(reader_.get(), opts, stripe));
+    auto status = ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
+    EvictStripe(stripe);
+    return status;
   }
 
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
@@ -287,7 +661,10 @@ class ORCFileReader::Impl {
     RETURN_NOT_OK(SelectStripe(&opts, stripe));
     std::shared_ptr<Schema> schema;
     RETURN_NOT_OK(ReadSchema(opts, &schema));
-    return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
+    RETURN_NOT_OK(PreBufferStripe(reader_.get(), opts, stripe));
+    auto status = ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
+    EvictStripe(stripe);
+    return status;
   }
 
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
@@ -322,28 +699,59 @@ class ORCFileReader::Impl {
       ARROW_RETURN_IF(*it < 0, Status::Invalid("Negative field index"));
       include_indices_list.push_back(*it);
     }
-    opts->includeTypes(include_indices_list);
+    // Select top-level fields by index, type ids also count their children
+    opts->include(include_indices_list);
     return Status::OK();
   }
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
-    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
+    std::vector<size_t> stripes;
     for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
-      opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
+      if (StripeMayMatch(stripe)) {
+        stripes.push_back(stripe);
+      }
     }
+
+    // liborc readers are not meant to be shared between threads, every
+    // parallel read opens its own
+    std::vector<std::shared_ptr<RecordBatch>> batches(stripes.size());
+    auto read_stripe = [&](int i) -> Status {
+      std::unique_ptr<liborc::Reader> thread_reader;
+      if (use_threads_) {
+        RETURN_NOT_OK(OpenReader(&thread_reader));
+      }
+      liborc::Reader* reader = use_threads_ ? thread_reader.get() : reader_.get();
+      // When reading serially, prefetch the next stripe while decoding this one
+      RETURN_NOT_OK(PreBufferStripe(reader, row_opts, stripes[i]));
+      if (!use_threads_ && static_cast<size_t>(i) + 1 < stripes.size()) {
+        RETURN_NOT_OK(PreBufferStripe(reader, row_opts, stripes[i + 1]));
+      }
+      const auto& stripe = stripes_[stripes[i]];
+      liborc::RowReaderOptions opts(row_opts);
+      opts.range(stripe.offset, stripe.length);
+      auto status = ReadBatch(reader, opts, schema, stripe.num_rows, &batches[i]);
+      EvictStripe(stripes[i]);
+      return status;
+    };
+    RETURN_NOT_OK(internal::OptionalParallelFor(
+        use_threads_, static_cast<int>(stripes.size()), read_stripe));
     return Table::FromRecordBatches(schema, batches, out);
   }
 
   Status ReadBatch(const liborc::RowReaderOptions& opts,
                    const std::shared_ptr<Schema>& schema, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
+    return ReadBatch(reader_.get(), opts, schema, nrows, out);
+  }
+
+  Status ReadBatch(liborc::Reader* reader, const liborc::RowReaderOptions& opts,
+                   const std::shared_ptr<Schema>& schema, int64_t nrows,
+                   std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::RowReader> row_reader;
     std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
-      row_reader = reader_->createRowReader(opts);
+      row_reader = reader->createRowReader(opts);
       batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
@@ -375,6 +783,18 @@ class ORCFileReader::Impl {
 
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out) {
+    // Skip the stripes which the predicates exclude
+    for (size_t stripe = 0; stripe < stripes_.size(); ++stripe) {
+      const auto& info = stripes_[stripe];
+      const int64_t end_row = info.first_row_of_stripe + info.num_rows;
+      if (current_row_ >= end_row) {
+        continue;
+      }
+      if (StripeMayMatch(stripe)) {
+        break;
+      }
+      current_row_ = end_row;
+    }
     if (current_row_ >= NumberOfRows()) {
       out->reset();
       return Status::OK();
@@ -388,6 +808,23 @@ class ORCFileReader::Impl {
     RETURN_NOT_OK(SelectStripeWithRowNumber(&opts, current_row_, &stripe_info));
     std::shared_ptr<Schema> schema;
     RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    // Drop the reads of the previous stripes, and prefetch the next stripe to
+    // be read while this one is decoded
+    if (pre_buffer_) {
+      int64_t stripe = 0;
+      while (stripes_[stripe].offset != stripe_info.offset) {
+        EvictStripe(stripe++);
+      }
+      RETURN_NOT_OK(PreBufferStripe(reader_.get(), opts, stripe));
+      for (++stripe; stripe < NumberOfStripes(); ++stripe) {
+        if (StripeMayMatch(stripe)) {
+          RETURN_NOT_OK(PreBufferStripe(reader_.get(), opts, stripe));
+          break;
+        }
+      }
+    }
+
     std::unique_ptr<liborc::RowReader> row_reader;
     try {
       row_reader = reader_->createRowReader(opts);
@@ -397,8 +834,23 @@ class ORCFileReader::Impl {
       return Status::Invalid(e.what());
     }
 
-    *out = std::shared_ptr<RecordBatchReader>(
+    std::shared_ptr<RecordBatchReader> stripe_reader(
         new OrcStripeReader(std::move(row_reader), schema, batch_size, pool_));
+    if (batch_readahead_ == 0) {
+      *out = std::move(stripe_reader);
+      return Status::OK();
+    }
+    // Decode the next batches of the stripe in the background while the
+    // current one is consumed
+    auto batches =
+        MakeFunctionIterator([stripe_reader]() -> Result<std::shared_ptr<RecordBatch>> {
+          std::shared_ptr<RecordBatch> batch;
+          RETURN_NOT_OK(stripe_reader->ReadNext(&batch));
+          return batch;
+        });
+    ARROW_ASSIGN_OR_RAISE(auto readahead,
+                          MakeReadaheadIterator(std::move(batches), batch_readahead_));
+    *out = std::make_shared<ReadaheadStripeReader>(schema, std::move(readahead));
     return Status::OK();
   }
 
@@ -407,10 +859,17 @@ class ORCFileReader::Impl {
   }
 
  private:
+  std::shared_ptr<io::RandomAccessFile> file_;
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+  std::vector<ColumnPredicate> predicates_;
+  bool use_threads_ = false;
+  int32_t batch_readahead_ = 0;
+  bool pre_buffer_ = false;
+  io::CacheOptions cache_options_ = io::CacheOptions::Defaults();
+  std::shared_ptr<StripeReadCache> read_cache_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -469,10 +928,203 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::SetPredicates(std::vector<ColumnPredicate> predicates) {
+  return impl_->SetPredicates(std::move(predicates));
+}
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
+void ORCFileReader::set_batch_readahead(int32_t batch_readahead) {
+  impl_->set_batch_readahead(batch_readahead);
+}
+
+void ORCFileReader::set_pre_buffer(bool pre_buffer) { impl_->set_pre_buffer(pre_buffer); }
+
+void ORCFileReader::set_cache_options(io::CacheOptions options) {
+  impl_->set_cache_options(options);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+Status ORCFileReader::ReadStripeStatistics(int64_t stripe,
+                                           std::vector<StripeColumnStatistics>* out) {
+  return impl_->ReadStripeStatistics(stripe, out);
+}
+
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(const std::shared_ptr<io::OutputStream>& output_stream)
+      : output_stream_(output_stream), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_stream_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<uint64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string name("ArrowOutputStream");
+    return name;
+  }
+
+  // The output stream is owned by the caller, so it's only flushed
+  void close() override { ORC_THROW_NOT_OK(output_stream_->Flush()); }
+
+ private:
+  std::shared_ptr<io::OutputStream> output_stream_;
+  uint64_t length_;
+};
+
+static Status GetOrcCompression(Compression::type compression,
+                                liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::Invalid("ORC files can't be compressed with ",
+                             util::Codec::GetCodecAsString(compression));
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema,
+              const std::shared_ptr<io::OutputStream>& output_stream,
+              const ORCWriterOptions& options) {
+    if (options.batch_size <= 0) {
+      return Status::Invalid("ORC batch size must be positive, got ",
+                             options.batch_size);
+    }
+    schema_ = schema;
+    batch_size_ = options.batch_size;
+    RETURN_NOT_OK(GetOrcType(*struct_(schema->fields()), &type_));
+
+    liborc::WriterOptions orc_options;
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetOrcCompression(options.compression, &compression));
+    orc_options.setCompression(compression);
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+    orc_options.setMemoryPool(liborc::getDefaultPool());
+
+    std::set<uint64_t> bloom_filter_columns;
+    for (const auto& name : options.bloom_filter_columns) {
+      const int i = schema->GetFieldIndex(name);
+      if (i == -1) {
+        return Status::Invalid("No column named ", name, " for a bloom filter");
+      }
+      bloom_filter_columns.insert(type_->getSubtype(i)->getColumnId());
+    }
+    orc_options.setColumnsUseBloomFilter(bloom_filter_columns);
+    orc_options.setBloomFilterFPP(options.bloom_filter_fpp);
+
+    output_stream_.reset(new ArrowOutputStream(output_stream));
+    try {
+      writer_ = liborc::createWriter(*type_, output_stream_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(batch_size_));
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Cannot write a record batch of schema ",
+                             batch.schema()->ToString(), " to an ORC file of schema ",
+                             schema_->ToString());
+    }
+    auto root = checked_cast<liborc::StructVectorBatch*>(batch_.get());
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += batch_size_) {
+      const int64_t length = std::min(batch_size_, batch.num_rows() - offset);
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        RETURN_NOT_OK(WriteBatch(*batch.column(i), offset, length, root->fields[i]));
+      }
+      root->numElements = static_cast<uint64_t>(length);
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    TableBatchReader reader(table);
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    while (batch != nullptr) {
+      RETURN_NOT_OK(Write(*batch));
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  ORC_UNIQUE_PTR<liborc::Type> type_;
+  std::unique_ptr<ArrowOutputStream> output_stream_;
+  ORC_UNIQUE_PTR<liborc::Writer> writer_;
+  ORC_UNIQUE_PTR<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           const std::shared_ptr<io::OutputStream>& output_stream,
+                           const ORCWriterOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, output_stream, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
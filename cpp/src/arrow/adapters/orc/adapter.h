@@ -20,13 +20,16 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,6 +38,28 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Statistics of a top-level column of a stripe
+struct ARROW_EXPORT StripeColumnStatistics {
+  /// The number of non-null values
+  int64_t num_values = 0;
+  /// Whether the column has nulls
+  bool has_null = true;
+  /// The bounds of the non-null values, null if unknown
+  std::shared_ptr<Scalar> min, max;
+};
+
+/// \brief A comparison of a top-level column with a literal, by which stripes
+/// are skipped
+struct ARROW_EXPORT ColumnPredicate {
+  enum Operator { EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, IS_NULL };
+
+  /// The name of the column
+  std::string column;
+  Operator op;
+  /// The literal, of the type of the column, unused by IS_NULL
+  std::shared_ptr<Scalar> value;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -131,6 +156,46 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Read the statistics of the top-level columns of a stripe
+  ///
+  /// Bounds are read for integer, floating point, string and date columns.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics of each field of the schema, empty if the
+  ///             file has no statistics for the stripe
+  Status ReadStripeStatistics(int64_t stripe, std::vector<StripeColumnStatistics>* out);
+
+  /// \brief Skip the stripes where a conjunction of predicates can't hold
+  ///
+  /// Read and NextStripeReader skip the stripes whose column statistics
+  /// exclude any of the predicates. The rows of the other stripes are read
+  /// whole, so the predicates must still be applied to them.
+  ///
+  /// \param[in] predicates the predicates, none to read every stripe
+  /// \return Status
+  Status SetPredicates(std::vector<ColumnPredicate> predicates);
+
+  /// \brief Set whether Read decodes stripes in parallel on the CPU thread pool
+  ///
+  /// By default only one thread is used.
+  void set_use_threads(bool use_threads);
+
+  /// \brief Set the number of record batches the readers of NextStripeReader
+  /// decode ahead in the background, 0 (the default) to decode on demand
+  void set_batch_readahead(int32_t batch_readahead);
+
+  /// \brief Enable read coalescing
+  ///
+  /// When enabled, the streams of the selected columns of each stripe are
+  /// read with few large reads, combined according to the cache options, in
+  /// the background. While a stripe is decoded by Read() or the readers of
+  /// NextStripeReader(), the next one is prefetched. This is intended to
+  /// improve performance on high-latency filesystems (e.g. Amazon S3).
+  void set_pre_buffer(bool pre_buffer);
+
+  /// \brief Set options for read coalescing
+  void set_cache_options(io::CacheOptions options);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -143,6 +208,70 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options of an ORCFileWriter
+struct ARROW_EXPORT ORCWriterOptions {
+  /// The number of rows converted into each ORC vector batch
+  int64_t batch_size = 1024;
+  /// The size of the stripes in bytes, before compression
+  int64_t stripe_size = 64 * 1024 * 1024;
+  /// The codec compressing the streams, of UNCOMPRESSED, GZIP (ORC's ZLIB),
+  /// SNAPPY, LZO, LZ4 and ZSTD
+  Compression::type compression = Compression::GZIP;
+  /// The size in bytes of the compressed blocks
+  int64_t compression_block_size = 64 * 1024;
+  /// The number of rows between the entries of the row index, 0 for no index
+  int64_t row_index_stride = 10000;
+  /// The names of the top-level columns for which bloom filters are written
+  std::vector<std::string> bloom_filter_columns;
+  /// The false positive probability of the bloom filters
+  double bloom_filter_fpp = 0.05;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow Tables and RecordBatches to an ORC file.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] schema the schema of the record batches to write
+  /// \param[in] output_stream the stream the file is written to, which must
+  /// remain valid until Close() and which Close() doesn't close
+  /// \param[in] options the options of the file
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     const std::shared_ptr<io::OutputStream>& output_stream,
+                     const ORCWriterOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a record batch of the schema of the file
+  ///
+  /// The values are converted to ORC vector batches of options.batch_size
+  /// rows column by column. Binary values are not copied.
+  ///
+  /// \param[in] batch the record batch
+  /// \return Status
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a table of the schema of the file
+  ///
+  /// \param[in] table the table
+  /// \return Status
+  Status Write(const Table& table);
+
+  /// \brief Write the last stripe and the footer of the file
+  ///
+  /// \return Status
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+#include <orc/OrcFile.hh>
+
+namespace liborc = orc;
+
+namespace arrow {
+
+class BufferOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t size) override {
+    const char* bytes = reinterpret_cast<const char*>(buf);
+    data_.insert(data_.end(), bytes, bytes + size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  std::shared_ptr<Buffer> buffer() const {
+    return Buffer::FromString(std::string(data_.begin(), data_.end()));
+  }
+
+ private:
+  std::vector<char> data_;
+  std::string name_ = "BufferOutputStream";
+};
+
+constexpr uint64_t kNumRows = 1 << 20;
+constexpr uint64_t kBatchRows = 1 << 14;
+
+// An ORC file of a column of the type, of which a proportion of the values are
+// null
+static std::shared_ptr<Buffer> MakeOrcFile(const std::string& type_name,
+                                           double null_probability) {
+  ORC_UNIQUE_PTR<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col:" + type_name + ">"));
+  BufferOutputStream stream;
+  liborc::WriterOptions options;
+  options.setMemoryPool(liborc::getDefaultPool());
+  auto writer = liborc::createWriter(*type, &stream, options);
+  auto batch = writer->createRowBatch(kBatchRows);
+  auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+  auto column = struct_batch->fields[0];
+
+  std::default_random_engine engine(42);
+  std::bernoulli_distribution is_null(null_probability);
+  std::uniform_int_distribution<int64_t> values(0, 1 << 30);
+  std::vector<std::string> strings(kBatchRows);
+
+  for (uint64_t row = 0; row < kNumRows; row += kBatchRows) {
+    column->hasNulls = null_probability > 0;
+    for (uint64_t i = 0; i < kBatchRows; ++i) {
+      column->notNull[i] = !is_null(engine);
+      const int64_t value = values(engine);
+      if (auto longs = dynamic_cast<liborc::LongVectorBatch*>(column)) {
+        longs->data[i] = value;
+      } else if (auto doubles = dynamic_cast<liborc::DoubleVectorBatch*>(column)) {
+        doubles->data[i] = static_cast<double>(value) / 7;
+      } else {
+        auto binaries = dynamic_cast<liborc::StringVectorBatch*>(column);
+        strings[i] = std::to_string(value);
+        binaries->data[i] = &strings[i][0];
+        binaries->length[i] = static_cast<int64_t>(strings[i].size());
+      }
+    }
+    struct_batch->numElements = kBatchRows;
+    column->numElements = kBatchRows;
+    writer->add(*batch);
+  }
+  writer->close();
+  return stream.buffer();
+}
+
+static void BenchmarkReadOrc(benchmark::State& state,  // NOLINT non-const reference
+                             const std::string& type_name) {
+  const double null_probability = static_cast<double>(state.range(0)) / 100;
+  auto file = MakeOrcFile(type_name, null_probability);
+
+  for (auto _ : state) {
+    std::unique_ptr<adapters::orc::ORCFileReader> reader;
+    ABORT_NOT_OK(adapters::orc::ORCFileReader::Open(
+        std::make_shared<io::BufferReader>(file), default_memory_pool(), &reader));
+    std::shared_ptr<Table> table;
+    ABORT_NOT_OK(reader->Read(&table));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void ReadOrcInt64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadOrc(state, "bigint");
+}
+
+static void ReadOrcInt32(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadOrc(state, "int");
+}
+
+static void ReadOrcDouble(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadOrc(state, "double");
+}
+
+static void ReadOrcString(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadOrc(state, "string");
+}
+
+// The argument is the percentage of nulls
+BENCHMARK(ReadOrcInt64)->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(ReadOrcInt32)->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(ReadOrcDouble)->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(ReadOrcString)->Arg(0)->Arg(10)->Arg(50);
+
+}  // namespace arrow
@@ -15,11 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <string>
 
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
 #include "arrow/io/api.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -157,4 +162,298 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+// Write stripes of ascending int and string values, the stripe `j` holding the
+// values from j * stripe_row_count
+std::shared_ptr<io::RandomAccessFile> WriteAscendingStripes(
+    MemoryOutputStream* mem_stream, uint64_t stripe_count, uint64_t stripe_row_count) {
+  ORC_UNIQUE_PTR<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col1:int,col2:string>"));
+  auto writer = CreateWriter(/*stripe_size=*/1024, *type, mem_stream);
+  auto batch = writer->createRowBatch(stripe_row_count);
+  auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+  auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  auto str_batch = dynamic_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+
+  std::vector<std::string> strings(stripe_row_count);
+  int64_t accumulated = 0;
+  for (uint64_t j = 0; j < stripe_count; ++j) {
+    for (uint64_t i = 0; i < stripe_row_count; ++i) {
+      strings[i] = std::to_string(accumulated);
+      long_batch->data[i] = accumulated;
+      str_batch->data[i] = &strings[i][0];
+      str_batch->length[i] = static_cast<int64_t>(strings[i].size());
+      accumulated++;
+    }
+    struct_batch->numElements = stripe_row_count;
+    long_batch->numElements = stripe_row_count;
+    str_batch->numElements = stripe_row_count;
+    writer->add(*batch);
+  }
+  writer->close();
+
+  return std::make_shared<io::BufferReader>(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream->getData()),
+                               static_cast<int64_t>(mem_stream->getLength())));
+}
+
+TEST(TestAdapter, ReadStripesInParallel) {
+  constexpr uint64_t stripe_count = 8;
+  constexpr uint64_t stripe_row_count = 65535;
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  auto in_stream = WriteAscendingStripes(&mem_stream, stripe_count, stripe_row_count);
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader));
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+
+  std::shared_ptr<Table> serial, parallel;
+  ASSERT_OK(reader->Read(&serial));
+  reader->set_use_threads(true);
+  ASSERT_OK(reader->Read(&parallel));
+  ASSERT_EQ(stripe_count * stripe_row_count, parallel->num_rows());
+  AssertTablesEqual(*serial, *parallel);
+}
+
+TEST(TestAdapter, SkipStripesByPredicates) {
+  constexpr uint64_t stripe_count = 4;
+  constexpr uint64_t stripe_row_count = 65535;
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  auto in_stream = WriteAscendingStripes(&mem_stream, stripe_count, stripe_row_count);
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader));
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+
+  using adapters::orc::ColumnPredicate;
+  ASSERT_RAISES(Invalid, reader->SetPredicates({{"col3", ColumnPredicate::EQUAL,
+                                                 MakeScalar(int32_t(0))}}));
+  ASSERT_RAISES(TypeError, reader->SetPredicates({{"col1", ColumnPredicate::EQUAL,
+                                                   MakeScalar(int64_t(0))}}));
+
+  // Only the second and third stripes may hold values in [65535 * 1.5, 65535 * 2]
+  const auto low = static_cast<int32_t>(stripe_row_count + stripe_row_count / 2);
+  const auto high = static_cast<int32_t>(2 * stripe_row_count);
+  ASSERT_OK(reader->SetPredicates(
+      {{"col1", ColumnPredicate::GREATER_EQUAL, MakeScalar(low)},
+       {"col1", ColumnPredicate::LESS_EQUAL, MakeScalar(high)}}));
+
+  std::shared_ptr<Table> table;
+  reader->set_use_threads(true);
+  ASSERT_OK(reader->Read(&table));
+  ASSERT_EQ(2 * stripe_row_count, table->num_rows());
+
+  // The stripe readers also skip the stripes, reading ahead
+  reader->set_batch_readahead(4);
+  int64_t expected = stripe_row_count;
+  std::shared_ptr<RecordBatchReader> stripe_reader;
+  ASSERT_OK(reader->NextStripeReader(/*batch_size=*/1024, &stripe_reader));
+  while (stripe_reader) {
+    std::shared_ptr<RecordBatch> record_batch;
+    ASSERT_OK(stripe_reader->ReadNext(&record_batch));
+    while (record_batch) {
+      auto values = std::dynamic_pointer_cast<Int32Array>(record_batch->column(0));
+      for (int64_t i = 0; i < values->length(); ++i) {
+        ASSERT_EQ(expected++, values->Value(i));
+      }
+      ASSERT_OK(stripe_reader->ReadNext(&record_batch));
+    }
+    ASSERT_OK(reader->NextStripeReader(/*batch_size=*/1024, &stripe_reader));
+  }
+  ASSERT_EQ(3 * stripe_row_count, expected);
+
+  // Predicates excluding every stripe
+  ASSERT_OK(reader->SetPredicates({{"col2", ColumnPredicate::IS_NULL, nullptr}}));
+  ASSERT_OK(reader->Read(&table));
+  ASSERT_EQ(0, table->num_rows());
+  ASSERT_OK(reader->Seek(0));
+  ASSERT_OK(reader->NextStripeReader(/*batch_size=*/1024, &stripe_reader));
+  ASSERT_EQ(nullptr, stripe_reader);
+}
+// A file counting the reads of another
+class CountingFile : public io::RandomAccessFile {
+ public:
+  explicit CountingFile(std::shared_ptr<io::RandomAccessFile> file)
+      : file_(std::move(file)) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ++num_reads_;
+    return file_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ++num_reads_;
+    return file_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ++num_reads_;
+    return file_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ++num_reads_;
+    return file_->ReadAt(position, nbytes);
+  }
+
+  int64_t num_reads() const { return num_reads_; }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> file_;
+  std::atomic<int64_t> num_reads_{0};
+};
+
+TEST(TestAdapter, PreBufferStripes) {
+  constexpr uint64_t stripe_count = 4;
+  constexpr uint64_t stripe_row_count = 65535;
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  auto in_stream = WriteAscendingStripes(&mem_stream, stripe_count, stripe_row_count);
+
+  auto read = [&](bool pre_buffer, bool use_threads, const std::vector<int>& indices,
+                  std::shared_ptr<Table>* out) {
+    auto file = std::make_shared<CountingFile>(in_stream);
+    std::unique_ptr<adapters::orc::ORCFileReader> reader;
+    ABORT_NOT_OK(
+        adapters::orc::ORCFileReader::Open(file, default_memory_pool(), &reader));
+    reader->set_pre_buffer(pre_buffer);
+    reader->set_use_threads(use_threads);
+    ABORT_NOT_OK(reader->Read(indices, out));
+    return file->num_reads();
+  };
+
+  for (const std::vector<int> indices : {std::vector<int>{0, 1}, std::vector<int>{1}}) {
+    std::shared_ptr<Table> expected, actual;
+    const int64_t num_reads = read(false, false, indices, &expected);
+    ASSERT_LT(read(true, false, indices, &actual), num_reads);
+    AssertTablesEqual(*expected, *actual);
+    read(true, true, indices, &actual);
+    AssertTablesEqual(*expected, *actual);
+  }
+
+  // Stripe readers
+  auto file = std::make_shared<CountingFile>(in_stream);
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(adapters::orc::ORCFileReader::Open(file, default_memory_pool(), &reader));
+  reader->set_pre_buffer(true);
+  int64_t expected_value = 0;
+  std::shared_ptr<RecordBatchReader> stripe_reader;
+  ASSERT_OK(reader->NextStripeReader(/*batch_size=*/4096, &stripe_reader));
+  while (stripe_reader) {
+    std::shared_ptr<RecordBatch> record_batch;
+    ASSERT_OK(stripe_reader->ReadNext(&record_batch));
+    while (record_batch) {
+      auto values = std::dynamic_pointer_cast<Int32Array>(record_batch->column(0));
+      for (int64_t i = 0; i < values->length(); ++i) {
+        ASSERT_EQ(expected_value++, values->Value(i));
+      }
+      ASSERT_OK(stripe_reader->ReadNext(&record_batch));
+    }
+    ASSERT_OK(reader->NextStripeReader(/*batch_size=*/4096, &stripe_reader));
+  }
+  ASSERT_EQ(static_cast<int64_t>(stripe_count * stripe_row_count), expected_value);
+}
+
+std::shared_ptr<Table> WriteAndReadOrc(const Table& table,
+                                       const adapters::orc::ORCWriterOptions& options) {
+  auto output = *io::BufferOutputStream::Create(1024);
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ABORT_NOT_OK(
+      adapters::orc::ORCFileWriter::Open(table.schema(), output, options, &writer));
+  ABORT_NOT_OK(writer->Write(table));
+  ABORT_NOT_OK(writer->Close());
+  auto buffer = *output->Finish();
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ABORT_NOT_OK(adapters::orc::ORCFileReader::Open(
+      std::make_shared<io::BufferReader>(buffer), default_memory_pool(), &reader));
+  std::shared_ptr<Table> out;
+  ABORT_NOT_OK(reader->Read(&out));
+  return out;
+}
+
+TEST(TestAdapterWrite, RoundTrip) {
+  auto schema = ::arrow::schema(
+      {field("bool", boolean()), field("int8", int8()), field("int16", int16()),
+       field("int32", int32()), field("int64", int64()), field("float", float32()),
+       field("double", float64()), field("str", utf8()), field("bin", binary()),
+       field("fixed", fixed_size_binary(3)), field("date", date32()),
+       field("ts", timestamp(TimeUnit::NANO)), field("dec", decimal(10, 2)),
+       field("wide_dec", decimal(25, 3)), field("list", list(int32())),
+       field("struct", struct_({field("a", int64()), field("b", utf8())}))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [true, 1, 1000, -7, 1234567890123, 1.5, -2.25, "a", "xy", "abc", 18000,
+     1577836800123456789, "12.34", "1234567890123456789012.345", [1, null, 3],
+     {"a": 1, "b": "x"}],
+    [null, null, null, null, null, null, null, null, null, null, null, null,
+     null, null, null, null],
+    [false, -128, -32768, 2147483647, -9223372036854775808, -0.0, 1e300, "",
+     "", "def", -1, -1500000000, "-0.01", "-0.001", [], {"a": null, "b": null}],
+    [true, 127, 32767, 0, 0, 3.25, 0.5, "héllo", "z", "ghi", 0, 0, "0.00",
+     "0.000", null, null]
+  ])");
+
+  adapters::orc::ORCWriterOptions options;
+  options.batch_size = 3;
+  options.compression = Compression::SNAPPY;
+  options.bloom_filter_columns = {"int64", "str"};
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+  auto read = WriteAndReadOrc(*table, options);
+  ASSERT_OK(read->ValidateFull());
+  AssertTablesEqual(*table, *read, /*same_chunk_layout=*/false);
+
+  // A slice of a batch
+  ASSERT_OK(Table::FromRecordBatches({batch->Slice(1, 2)}, &table));
+  read = WriteAndReadOrc(*table, adapters::orc::ORCWriterOptions());
+  AssertTablesEqual(*table, *read, /*same_chunk_layout=*/false);
+}
+
+TEST(TestAdapterWrite, Conversions) {
+  // Other timestamp units are read back as nanoseconds, maps as lists of
+  // key-value structs
+  auto map_type = map(utf8(), int32());
+  auto batch = RecordBatchFromJSON(
+      ::arrow::schema({field("ts", timestamp(TimeUnit::MILLI)), field("map", map_type)}),
+      R"([[-1500, [["a", 1], ["b", null]]], [null, null], [1, []]])");
+  auto entries_type = struct_({field("key", utf8()), field("value", int32())});
+  auto expected = RecordBatchFromJSON(
+      ::arrow::schema({field("ts", timestamp(TimeUnit::NANO)),
+                       field("map", list(entries_type))}),
+      R"([[-1500000000, [{"key": "a", "value": 1}, {"key": "b", "value": null}]],
+          [null, null], [1000000, []]])");
+
+  std::shared_ptr<Table> table, expected_table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+  ASSERT_OK(Table::FromRecordBatches({expected}, &expected_table));
+  AssertTablesEqual(*expected_table,
+                    *WriteAndReadOrc(*table, adapters::orc::ORCWriterOptions()),
+                    /*same_chunk_layout=*/false);
+}
+
+TEST(TestAdapterWrite, Errors) {
+  using adapters::orc::ORCFileWriter;
+  using adapters::orc::ORCWriterOptions;
+  auto output = *io::BufferOutputStream::Create(1024);
+  auto int32_schema = ::arrow::schema({field("i", int32())});
+  std::unique_ptr<ORCFileWriter> writer;
+
+  ORCWriterOptions options;
+  ASSERT_RAISES(NotImplemented,
+                ORCFileWriter::Open(::arrow::schema({field("u", uint32())}), output,
+                                    options, &writer));
+  options.compression = Compression::BROTLI;
+  ASSERT_RAISES(Invalid, ORCFileWriter::Open(int32_schema, output, options, &writer));
+  options = ORCWriterOptions();
+  options.bloom_filter_columns = {"j"};
+  ASSERT_RAISES(Invalid, ORCFileWriter::Open(int32_schema, output, options, &writer));
+
+  ASSERT_OK(ORCFileWriter::Open(int32_schema, output, ORCWriterOptions(), &writer));
+  auto batch = RecordBatchFromJSON(::arrow::schema({field("i", int64())}), "[[1]]");
+  ASSERT_RAISES(Invalid, writer->Write(*batch));
+}
 }  // namespace arrow
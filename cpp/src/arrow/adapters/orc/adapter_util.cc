@@ -15,13 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+#include "arrow/array.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/range.h"
@@ -208,13 +212,32 @@ Status AppendBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto builder = checked_cast<builder_type*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
+  if (length == 0) {
+    return Status::OK();
+  }
+
+  // Reserve the offsets and the data of all values up front, which also checks
+  // they fit in 32-bit offsets, then append without checking capacity
   const bool has_nulls = batch->hasNulls;
+  const int64_t* lengths = batch->length.data();
+  int64_t data_length = 0;
+  if (has_nulls) {
+    for (int64_t i = offset; i < length + offset; i++) {
+      data_length += batch->notNull[i] ? lengths[i] : 0;
+    }
+  } else {
+    for (int64_t i = offset; i < length + offset; i++) {
+      data_length += lengths[i];
+    }
+  }
+  RETURN_NOT_OK(builder->Reserve(length));
+  RETURN_NOT_OK(builder->ReserveData(data_length));
+
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(
-          builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+      builder->UnsafeAppend(batch->data[i], static_cast<int32_t>(lengths[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -225,12 +248,13 @@ Status AppendFixedBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto builder = checked_cast<FixedSizeBinaryBuilder*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
+  RETURN_NOT_OK(builder->Reserve(length));
   const bool has_nulls = batch->hasNulls;
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(builder->Append(batch->data[i]));
+      builder->UnsafeAppend(reinterpret_cast<const uint8_t*>(batch->data[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -423,6 +447,295 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+Status GetOrcType(const DataType& type, ORC_UNIQUE_PTR<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::FIXED_SIZE_BINARY: {
+      const auto byte_width = checked_cast<const FixedSizeBinaryType&>(type).byte_width();
+      *out = liborc::createCharType(liborc::CHAR, static_cast<uint64_t>(byte_width));
+      break;
+    }
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::LIST: {
+      ORC_UNIQUE_PTR<liborc::Type> value_type;
+      RETURN_NOT_OK(
+          GetOrcType(*checked_cast<const ListType&>(type).value_type(), &value_type));
+      *out = liborc::createListType(std::move(value_type));
+      break;
+    }
+    case Type::MAP: {
+      const auto& map_type = checked_cast<const MapType&>(type);
+      ORC_UNIQUE_PTR<liborc::Type> key_type, item_type;
+      RETURN_NOT_OK(GetOrcType(*map_type.key_type(), &key_type));
+      RETURN_NOT_OK(GetOrcType(*map_type.item_type(), &item_type));
+      *out = liborc::createMapType(std::move(key_type), std::move(item_type));
+      break;
+    }
+    case Type::STRUCT: {
+      *out = liborc::createStructType();
+      for (const auto& field : type.children()) {
+        ORC_UNIQUE_PTR<liborc::Type> field_type;
+        RETURN_NOT_OK(GetOrcType(*field->type(), &field_type));
+        (*out)->addStructField(field->name(), std::move(field_type));
+      }
+      break;
+    }
+    default:
+      return Status::NotImplemented("Writing ", type.ToString(), " to ORC");
+  }
+  return Status::OK();
+}
+
+// Fill the validity of an ORC vector batch from a range of an array
+static void WriteValidity(const Array& array, int64_t offset, int64_t length,
+                          liborc::ColumnVectorBatch* batch) {
+  batch->numElements = static_cast<uint64_t>(length);
+  batch->hasNulls = array.null_count() > 0;
+  if (!batch->hasNulls) {
+    return;
+  }
+  char* not_null = batch->notNull.data();
+  auto visit = [&](bool is_valid) { *not_null++ = is_valid; };
+  internal::VisitBitsUnrolled(array.null_bitmap_data(), array.offset() + offset, length,
+                              visit);
+}
+
+// Fill the values of an ORC vector batch, with a cast for each value
+template <class ArrayType, class batch_type>
+static Status WriteCastBatch(const Array& array, int64_t offset, int64_t length,
+                             liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<batch_type*>(cbatch);
+  const auto& values = checked_cast<const ArrayType&>(array);
+  using target_type = typename std::remove_reference<decltype(batch->data[0])>::type;
+  for (int64_t i = 0; i < length; i++) {
+    batch->data[i] = static_cast<target_type>(values.Value(offset + i));
+  }
+  return Status::OK();
+}
+
+// Fill the values of an ORC vector batch of the same width as the array's
+template <class ArrayType, class batch_type>
+static Status WriteCopyBatch(const Array& array, int64_t offset, int64_t length,
+                             liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<batch_type*>(cbatch);
+  const auto& values = checked_cast<const ArrayType&>(array);
+  std::memcpy(batch->data.data(), values.raw_values() + offset,
+              static_cast<size_t>(length) * sizeof(batch->data[0]));
+  return Status::OK();
+}
+
+static Status WriteBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                               liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  const auto& values = checked_cast<const BinaryArray&>(array);
+  for (int64_t i = 0; i < length; i++) {
+    const auto value = values.GetView(offset + i);
+    batch->data[i] = const_cast<char*>(value.data());
+    batch->length[i] = static_cast<int64_t>(value.size());
+  }
+  return Status::OK();
+}
+
+static Status WriteFixedBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                                    liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  const auto& values = checked_cast<const FixedSizeBinaryArray&>(array);
+  const int32_t byte_width = values.byte_width();
+  const char* data = reinterpret_cast<const char*>(values.GetValue(offset));
+  for (int64_t i = 0; i < length; i++) {
+    batch->data[i] = const_cast<char*>(data + i * byte_width);
+    batch->length[i] = byte_width;
+  }
+  return Status::OK();
+}
+
+static Status WriteTimestampBatch(const Array& array, int64_t offset, int64_t length,
+                                  liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+  const auto& values = checked_cast<const TimestampArray&>(array);
+  const auto unit = checked_cast<const TimestampType&>(*array.type()).unit();
+  int64_t units_per_second = 1;
+  switch (unit) {
+    case TimeUnit::SECOND:
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+  const int64_t* raw_values = values.raw_values() + offset;
+  for (int64_t i = 0; i < length; i++) {
+    // ORC nanoseconds are positive, so round the seconds down
+    int64_t seconds = raw_values[i] / units_per_second;
+    int64_t units = raw_values[i] % units_per_second;
+    if (units < 0) {
+      seconds -= 1;
+      units += units_per_second;
+    }
+    batch->data[i] = seconds;
+    batch->nanoseconds[i] = units * nanos_per_unit;
+  }
+  return Status::OK();
+}
+
+static Status WriteDecimalBatch(const Array& array, int64_t offset, int64_t length,
+                                liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const Decimal128Array&>(array);
+  if (auto batch = dynamic_cast<liborc::Decimal64VectorBatch*>(cbatch)) {
+    for (int64_t i = 0; i < length; i++) {
+      const Decimal128 value(values.GetValue(offset + i));
+      batch->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+    return Status::OK();
+  }
+  auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; i++) {
+    const Decimal128 value(values.GetValue(offset + i));
+    batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+  }
+  return Status::OK();
+}
+
+// Reserve room for a number of values in an ORC vector batch
+static void ReserveBatch(int64_t length, liborc::ColumnVectorBatch* batch) {
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    batch->resize(static_cast<uint64_t>(length));
+  }
+}
+
+static Status WriteListBatch(const Array& array, int64_t offset, int64_t length,
+                             liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+  const auto& lists = checked_cast<const ListArray&>(array);
+  const int32_t* value_offsets = lists.raw_value_offsets() + offset;
+  for (int64_t i = 0; i <= length; i++) {
+    batch->offsets[i] = value_offsets[i] - value_offsets[0];
+  }
+  const int64_t num_values = value_offsets[length] - value_offsets[0];
+  ReserveBatch(num_values, batch->elements.get());
+  return WriteBatch(*lists.values(), value_offsets[0], num_values,
+                    batch->elements.get());
+}
+
+static Status WriteMapBatch(const Array& array, int64_t offset, int64_t length,
+                            liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::MapVectorBatch*>(cbatch);
+  const auto& maps = checked_cast<const MapArray&>(array);
+  const auto& entries = checked_cast<const StructArray&>(*maps.values());
+  const int32_t* value_offsets = maps.raw_value_offsets() + offset;
+  for (int64_t i = 0; i <= length; i++) {
+    batch->offsets[i] = value_offsets[i] - value_offsets[0];
+  }
+  const int64_t num_values = value_offsets[length] - value_offsets[0];
+  ReserveBatch(num_values, batch->keys.get());
+  ReserveBatch(num_values, batch->elements.get());
+  RETURN_NOT_OK(
+      WriteBatch(*entries.field(0), value_offsets[0], num_values, batch->keys.get()));
+  return WriteBatch(*entries.field(1), value_offsets[0], num_values,
+                    batch->elements.get());
+}
+
+static Status WriteStructBatch(const Array& array, int64_t offset, int64_t length,
+                               liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+  const auto& fields = checked_cast<const StructArray&>(array);
+  for (int i = 0; i < fields.num_fields(); i++) {
+    RETURN_NOT_OK(WriteBatch(*fields.field(i), offset, length, batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch) {
+  WriteValidity(array, offset, length, batch);
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return WriteCastBatch<BooleanArray, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::INT8:
+      return WriteCastBatch<Int8Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                batch);
+    case Type::INT16:
+      return WriteCastBatch<Int16Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                 batch);
+    case Type::INT32:
+      return WriteCastBatch<Int32Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                 batch);
+    case Type::INT64:
+      return WriteCopyBatch<Int64Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                 batch);
+    case Type::FLOAT:
+      return WriteCastBatch<FloatArray, liborc::DoubleVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::DOUBLE:
+      return WriteCopyBatch<DoubleArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                    length, batch);
+    case Type::STRING:
+    case Type::BINARY:
+      return WriteBinaryBatch(array, offset, length, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return WriteFixedBinaryBatch(array, offset, length, batch);
+    case Type::DATE32:
+      return WriteCastBatch<Date32Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                  batch);
+    case Type::TIMESTAMP:
+      return WriteTimestampBatch(array, offset, length, batch);
+    case Type::DECIMAL:
+      return WriteDecimalBatch(array, offset, length, batch);
+    case Type::LIST:
+      return WriteListBatch(array, offset, length, batch);
+    case Type::MAP:
+      return WriteMapBatch(array, offset, length, batch);
+    case Type::STRUCT:
+      return WriteStructBatch(array, offset, length, batch);
+    default:
+      return Status::NotImplemented("Writing ", array.type()->ToString(), " to ORC");
+  }
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -36,6 +36,16 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+Status GetOrcType(const DataType& type, ORC_UNIQUE_PTR<liborc::Type>* out);
+
+/// \brief Fill an ORC vector batch of the type given by GetOrcType with a
+/// range of the values of an array
+///
+/// Binary values aren't copied, the batch pointing into the array's data.
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch);
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
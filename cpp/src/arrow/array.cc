@@ -758,52 +758,84 @@ std::shared_ptr<Array> StructArray::GetFieldByName(const std::string& name) cons
 }
 
 Status StructArray::Flatten(MemoryPool* pool, ArrayVector* out) const {
-  ArrayVector flattened;
-  flattened.reserve(data_->child_data.size());
-  std::shared_ptr<Buffer> null_bitmap = data_->buffers[0];
+  const int num_fields = static_cast<int>(data_->child_data.size());
+  ArrayVector flattened(num_fields);
 
-  for (auto& child_data : data_->child_data) {
-    std::shared_ptr<Buffer> flattened_null_bitmap;
-    int64_t flattened_null_count = kUnknownNullCount;
+  // Without struct nulls, the fields are flattened as they are
+  if (null_bitmap_data_ == NULLPTR || null_count() == 0) {
+    for (int i = 0; i < num_fields; ++i) {
+      flattened[i] = field(i);
+    }
+    *out = std::move(flattened);
+    return Status::OK();
+  }
 
-    // Need to adjust for parent offset
-    if (data_->offset != 0 || data_->length != child_data->length) {
-      *child_data = child_data->Slice(data_->offset, data_->length);
+  // The validity of a flattened datum is the logical AND of the struct
+  // element's validity and the individual field element's validity. Fields
+  // without nulls share the struct bitmap when their offsets allow it,
+  // the others get their bitmap in one allocation shared by all fields.
+  const std::shared_ptr<Buffer>& null_bitmap = data_->buffers[0];
+  std::vector<std::shared_ptr<ArrayData>> fields_data(num_fields);
+  std::vector<int64_t> bitmap_positions(num_fields, -1);
+  int64_t bitmaps_size = 0;
+  for (int i = 0; i < num_fields; ++i) {
+    if (data_->child_data[i]->type->id() == Type::NA) {
+      flattened[i] = field(i);
+      continue;
     }
-    std::shared_ptr<Buffer> child_null_bitmap = child_data->buffers[0];
-    const int64_t child_offset = child_data->offset;
-
-    // The validity of a flattened datum is the logical AND of the struct
-    // element's validity and the individual field element's validity.
-    if (null_bitmap && child_null_bitmap) {
-      ARROW_ASSIGN_OR_RAISE(
-          flattened_null_bitmap,
-          BitmapAnd(pool, child_null_bitmap->data(), child_offset, null_bitmap_data_,
-                    data_->offset, data_->length, child_offset));
-    } else if (child_null_bitmap) {
-      flattened_null_bitmap = child_null_bitmap;
-      flattened_null_count = child_data->null_count;
-    } else if (null_bitmap) {
-      if (child_offset == data_->offset) {
-        flattened_null_bitmap = null_bitmap;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(
-            flattened_null_bitmap,
-            CopyBitmap(pool, null_bitmap_data_, data_->offset, data_->length));
+    auto field_data = std::make_shared<ArrayData>(*field(i)->data());
+    const int64_t shift = data_->offset - field_data->offset;
+    if (field_data->GetNullCount() == 0) {
+      field_data->null_count = data_->null_count;
+      if (shift >= 0 && shift % 8 == 0) {
+        field_data->buffers[0] =
+            shift == 0 ? null_bitmap : SliceBuffer(null_bitmap, shift / 8);
+        fields_data[i] = std::move(field_data);
+        continue;
       }
-      flattened_null_count = data_->null_count;
+      field_data->buffers[0] = NULLPTR;
     } else {
-      flattened_null_count = 0;
+      field_data->null_count = kUnknownNullCount;
     }
+    bitmap_positions[i] = bitmaps_size;
+    bitmaps_size += BitUtil::RoundUpToMultipleOf64(
+        BitUtil::BytesForBits(field_data->offset + data_->length));
+    fields_data[i] = std::move(field_data);
+  }
 
-    auto flattened_data = child_data->Copy();
-    flattened_data->buffers[0] = flattened_null_bitmap;
-    flattened_data->null_count = flattened_null_count;
-
-    flattened.push_back(MakeArray(flattened_data));
+  if (bitmaps_size > 0) {
+    std::shared_ptr<Buffer> bitmaps;
+    RETURN_NOT_OK(AllocateBuffer(pool, bitmaps_size, &bitmaps));
+    for (int i = 0; i < num_fields; ++i) {
+      if (bitmap_positions[i] < 0) {
+        continue;
+      }
+      ArrayData* field_data = fields_data[i].get();
+      const int64_t field_offset = field_data->offset;
+      uint8_t* bitmap = bitmaps->mutable_data() + bitmap_positions[i];
+      // Only the bytes holding the field's bits are written
+      const int64_t first_byte = field_offset / 8;
+      memset(bitmap + first_byte, 0,
+             BitUtil::BytesForBits(field_offset + data_->length) - first_byte);
+      if (field_data->buffers[0] != NULLPTR) {
+        BitmapAnd(field_data->buffers[0]->data(), field_offset, null_bitmap_data_,
+                  data_->offset, data_->length, field_offset, bitmap);
+      } else {
+        CopyBitmap(null_bitmap_data_, data_->offset, data_->length, bitmap,
+                   field_offset);
+      }
+      field_data->buffers[0] =
+          SliceBuffer(bitmaps, bitmap_positions[i],
+                      BitUtil::BytesForBits(field_offset + data_->length));
+    }
   }
 
-  *out = flattened;
+  for (int i = 0; i < num_fields; ++i) {
+    if (fields_data[i] != NULLPTR) {
+      flattened[i] = MakeArray(fields_data[i]);
+    }
+  }
+  *out = std::move(flattened);
   return Status::OK();
 }
 
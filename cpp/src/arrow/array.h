@@ -1037,6 +1037,11 @@ class ARROW_EXPORT StructArray : public Array {
 
   /// \brief Flatten this array as a vector of arrays, one for each field
   ///
+  /// The nulls of the struct are combined into the nulls of each field. The
+  /// fields are returned as is when the struct has no nulls, and fields
+  /// without nulls share the struct's null bitmap when their offsets allow
+  /// it. The other null bitmaps are computed into a single allocation.
+  ///
   /// \param[in] pool The pool to allocate null bitmaps from, if necessary
   /// \param[out] out The resulting vector of arrays
   Status Flatten(MemoryPool* pool, ArrayVector* out) const;
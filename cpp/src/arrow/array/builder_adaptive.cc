@@ -133,55 +133,42 @@ Status AdaptiveIntBuilder::CommitPendingData() {
   return Status::OK();
 }
 
-static constexpr int64_t kAdaptiveIntChunkSize = 8192;
-
 Status AdaptiveIntBuilder::AppendValuesInternal(const int64_t* values, int64_t length,
                                                 const uint8_t* valid_bytes) {
-  while (length > 0) {
-    // In case `length` is very large, we don't want to trash the cache by
-    // scanning it twice (first to detect int width, second to copy the data).
-    // Instead, process data in L2-cacheable chunks.
-    const int64_t chunk_size = std::min(length, kAdaptiveIntChunkSize);
-
-    uint8_t new_int_size;
-    new_int_size = internal::DetectIntWidth(values, valid_bytes, chunk_size, int_size_);
-
-    DCHECK_GE(new_int_size, int_size_);
-    if (new_int_size > int_size_) {
-      // This updates int_size_
-      RETURN_NOT_OK(ExpandIntSize(new_int_size));
-    }
-
-    switch (int_size_) {
-      case 1:
-        internal::DowncastInts(values, reinterpret_cast<int8_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      case 2:
-        internal::DowncastInts(values, reinterpret_cast<int16_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      case 4:
-        internal::DowncastInts(values, reinterpret_cast<int32_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      case 8:
-        internal::DowncastInts(values, reinterpret_cast<int64_t*>(raw_data_) + length_,
-                               chunk_size);
-        break;
-      default:
-        DCHECK(false);
-    }
-
-    // This updates length_
-    ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, chunk_size);
-    values += chunk_size;
-    if (valid_bytes != nullptr) {
-      valid_bytes += chunk_size;
-    }
-    length -= chunk_size;
+  // Detect the width of the whole block up front, so that the data already
+  // appended is widened at most once, then narrow the values in a single pass.
+  const uint8_t new_int_size =
+      internal::DetectIntWidth(values, valid_bytes, length, int_size_);
+
+  DCHECK_GE(new_int_size, int_size_);
+  if (new_int_size > int_size_) {
+    // This updates int_size_
+    RETURN_NOT_OK(ExpandIntSize(new_int_size));
+  }
+
+  switch (int_size_) {
+    case 1:
+      internal::DowncastInts(values, reinterpret_cast<int8_t*>(raw_data_) + length_,
+                             length);
+      break;
+    case 2:
+      internal::DowncastInts(values, reinterpret_cast<int16_t*>(raw_data_) + length_,
+                             length);
+      break;
+    case 4:
+      internal::DowncastInts(values, reinterpret_cast<int32_t*>(raw_data_) + length_,
+                             length);
+      break;
+    case 8:
+      internal::DowncastInts(values, reinterpret_cast<int64_t*>(raw_data_) + length_,
+                             length);
+      break;
+    default:
+      DCHECK(false);
   }
 
+  // This updates length_
+  ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
   return Status::OK();
 }
 
@@ -279,54 +266,45 @@ Status AdaptiveUIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
 
 Status AdaptiveUIntBuilder::AppendValuesInternal(const uint64_t* values, int64_t length,
                                                  const uint8_t* valid_bytes) {
-  while (length > 0) {
-    // See AdaptiveIntBuilder::AppendValuesInternal
-    const int64_t chunk_size = std::min(length, kAdaptiveIntChunkSize);
-
-    uint8_t new_int_size;
-    new_int_size = internal::DetectUIntWidth(values, valid_bytes, chunk_size, int_size_);
-
-    DCHECK_GE(new_int_size, int_size_);
-    if (new_int_size > int_size_) {
-      // This updates int_size_
-      RETURN_NOT_OK(ExpandIntSize(new_int_size));
-    }
-
-    switch (int_size_) {
-      case 1:
-        internal::DowncastUInts(values, reinterpret_cast<uint8_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      case 2:
-        internal::DowncastUInts(values, reinterpret_cast<uint16_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      case 4:
-        internal::DowncastUInts(values, reinterpret_cast<uint32_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      case 8:
-        internal::DowncastUInts(values, reinterpret_cast<uint64_t*>(raw_data_) + length_,
-                                chunk_size);
-        break;
-      default:
-        DCHECK(false);
-    }
-
-    // This updates length_
-    ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, chunk_size);
-    values += chunk_size;
-    if (valid_bytes != nullptr) {
-      valid_bytes += chunk_size;
-    }
-    length -= chunk_size;
+  // See AdaptiveIntBuilder::AppendValuesInternal
+  const uint8_t new_int_size =
+      internal::DetectUIntWidth(values, valid_bytes, length, int_size_);
+
+  DCHECK_GE(new_int_size, int_size_);
+  if (new_int_size > int_size_) {
+    // This updates int_size_
+    RETURN_NOT_OK(ExpandIntSize(new_int_size));
   }
 
+  switch (int_size_) {
+    case 1:
+      internal::DowncastUInts(values, reinterpret_cast<uint8_t*>(raw_data_) + length_,
+                              length);
+      break;
+    case 2:
+      internal::DowncastUInts(values, reinterpret_cast<uint16_t*>(raw_data_) + length_,
+                              length);
+      break;
+    case 4:
+      internal::DowncastUInts(values, reinterpret_cast<uint32_t*>(raw_data_) + length_,
+                              length);
+      break;
+    case 8:
+      internal::DowncastUInts(values, reinterpret_cast<uint64_t*>(raw_data_) + length_,
+                              length);
+      break;
+    default:
+      DCHECK(false);
+  }
+
+  // This updates length_
+  ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
   return Status::OK();
 }
 
 Status AdaptiveUIntBuilder::AppendValues(const uint64_t* values, int64_t length,
                                          const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(CommitPendingData());
   RETURN_NOT_OK(Reserve(length));
 
   return AppendValuesInternal(values, length, valid_bytes);
@@ -222,6 +222,37 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of values given as offsets into a data buffer,
+  /// in the layout of a binary array.
+  ///
+  /// Value i spans bytes [offsets[i], offsets[i + 1]) of data; offsets
+  /// need not start at zero.
+  ///
+  /// \param[in] offsets a contiguous C array of length + 1 offsets
+  /// \param[in] data the value data the offsets point into
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap an optional packed validity bitmap where a set bit
+  /// indicates a valid (non-null) value
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const offset_type* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* bitmap = NULLPTR, int64_t bitmap_offset = 0) {
+    const int64_t num_bytes = static_cast<int64_t>(offsets[length]) - offsets[0];
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(num_bytes));
+    // Rebase the offsets onto the end of the current value data
+    const int64_t base = value_data_builder_.length() - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + base));
+    }
+    // Safety check for UBSAN.
+    if (ARROW_PREDICT_TRUE(num_bytes > 0)) {
+      value_data_builder_.UnsafeAppend(data + offsets[0], num_bytes);
+    }
+    UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    return Status::OK();
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -91,6 +91,54 @@ class internal::DictionaryMemoTable::DictionaryMemoTableImpl {
     }
   };
 
+  struct ArrayValuesMemoizer {
+    DictionaryMemoTableImpl* impl_;
+    const Array& values_;
+    int32_t* out_indices_;
+
+    template <typename T>
+    Status Visit(const T& type) {
+      using ArrayType = typename TypeTraits<T>::ArrayType;
+      return GetOrInsertValues(type, checked_cast<const ArrayType&>(values_));
+    }
+
+   private:
+    template <typename DType, typename ArrayType>
+    enable_if_no_memoize<DType, Status> GetOrInsertValues(const DType& type,
+                                                          const ArrayType&) {
+      return Status::NotImplemented("Inserting array values of ", type,
+                                    " is not implemented");
+    }
+
+    template <typename DType, typename ArrayType>
+    enable_if_memoize<DType, Status> GetOrInsertValues(const DType&,
+                                                       const ArrayType& array) {
+      using ConcreteMemoTable = typename internal::DictionaryTraits<DType>::MemoTableType;
+      auto memo_table = static_cast<ConcreteMemoTable*>(impl_->memo_table_.get());
+
+      // The values are hashed all at once ahead of their lookups
+      HashedInserter<ConcreteMemoTable> inserter{memo_table, out_indices_};
+      return internal::VisitHashedValues<DType>(*array.data(), *memo_table, &inserter);
+    }
+
+    template <typename ConcreteMemoTable>
+    struct HashedInserter {
+      Status VisitNull() {
+        *out++ = 0;
+        return Status::OK();
+      }
+
+      template <typename Value>
+      Status VisitValue(const Value& value, hash_t h) {
+        *out++ = memo_table->GetOrInsertHashed(value, h);
+        return Status::OK();
+      }
+
+      ConcreteMemoTable* memo_table;
+      int32_t* out;
+    };
+  };
+
   struct ArrayDataGetter {
     std::shared_ptr<DataType> value_type_;
     MemoTable* memo_table_;
@@ -129,6 +177,15 @@ class internal::DictionaryMemoTable::DictionaryMemoTableImpl {
     return VisitTypeInline(*array.type(), &visitor);
   }
 
+  Status GetOrInsertValues(const Array& array, int32_t* out_indices) {
+    if (!array.type()->Equals(*type_)) {
+      return Status::Invalid("Array value type does not match memo type: ",
+                             array.type()->ToString());
+    }
+    ArrayValuesMemoizer visitor{this, array, out_indices};
+    return VisitTypeInline(*type_, &visitor);
+  }
+
   template <typename T>
   int32_t GetOrInsert(const T& value) {
     using ConcreteMemoTable = typename internal::DictionaryTraits<
@@ -148,6 +205,8 @@ class internal::DictionaryMemoTable::DictionaryMemoTableImpl {
 
   int32_t size() const { return memo_table_->size(); }
 
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
  private:
   std::shared_ptr<DataType> type_;
   std::unique_ptr<MemoTable> memo_table_;
@@ -221,6 +280,15 @@ Status internal::DictionaryMemoTable::InsertValues(const Array& array) {
   return impl_->InsertValues(array);
 }
 
+Status internal::DictionaryMemoTable::GetOrInsertValues(const Array& array,
+                                                       int32_t* out_indices) {
+  return impl_->GetOrInsertValues(array, out_indices);
+}
+
 int32_t internal::DictionaryMemoTable::size() const { return impl_->size(); }
 
+const std::shared_ptr<DataType>& internal::DictionaryMemoTable::type() const {
+  return impl_->type();
+}
+
 }  // namespace arrow
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/array/builder_adaptive.h"   // IWYU pragma: export
 #include "arrow/array/builder_base.h"       // IWYU pragma: export
@@ -78,8 +80,17 @@ class ARROW_EXPORT DictionaryMemoTable {
   /// \brief Insert new memo values
   Status InsertValues(const Array& values);
 
+  /// \brief Get or insert the values of an array in bulk
+  ///
+  /// The memo index of values[i] is written to out_indices[i], or 0 if
+  /// values[i] is null.
+  Status GetOrInsertValues(const Array& values, int32_t* out_indices);
+
   int32_t size() const;
 
+  /// \brief The type of the memo values
+  const std::shared_ptr<DataType>& type() const;
+
  private:
   class DictionaryMemoTableImpl;
   std::unique_ptr<DictionaryMemoTableImpl> impl_;
@@ -134,11 +145,34 @@ class DictionaryBuilderBase : public ArrayBuilder {
         indices_builder_(pool),
         value_type_(dictionary->type()) {}
 
+  /// \brief Create a builder which shares the memo table of another builder
+  ///
+  /// The indices of both builders refer to the same dictionary, and
+  /// FinishDelta() on the new builder only returns the values inserted in the
+  /// memo table after its creation. The builders must not be used
+  /// concurrently.
+  explicit DictionaryBuilderBase(std::shared_ptr<DictionaryMemoTable> memo_table,
+                                 MemoryPool* pool = default_memory_pool())
+      : ArrayBuilder(pool),
+        memo_table_(std::move(memo_table)),
+        delta_offset_(memo_table_->size()),
+        byte_width_(
+            is_fixed_size_binary_type<T>::value
+                ? static_cast<const FixedSizeBinaryType&>(*memo_table_->type())
+                      .byte_width()
+                : -1),
+        indices_builder_(pool),
+        value_type_(memo_table_->type()) {}
+
   ~DictionaryBuilderBase() override = default;
 
   /// \brief The current number of entries in the dictionary
   int64_t dictionary_length() const { return memo_table_->size(); }
 
+  /// \brief The memo table of the dictionary values, to share with another
+  /// builder
+  const std::shared_ptr<DictionaryMemoTable>& memo_table() const { return memo_table_; }
+
   /// \brief Append a scalar value
   Status Append(const Scalar& value) {
     ARROW_RETURN_NOT_OK(Reserve(1));
@@ -190,17 +224,7 @@ class DictionaryBuilderBase : public ArrayBuilder {
   template <typename T1 = T>
   enable_if_t<!is_fixed_size_binary_type<T1>::value, Status> AppendArray(
       const Array& array) {
-    using ArrayType = typename TypeTraits<T>::ArrayType;
-
-    const auto& concrete_array = static_cast<const ArrayType&>(array);
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (array.IsNull(i)) {
-        ARROW_RETURN_NOT_OK(AppendNull());
-      } else {
-        ARROW_RETURN_NOT_OK(Append(concrete_array.GetView(i)));
-      }
-    }
-    return Status::OK();
+    return AppendArrayValues(array);
   }
 
   template <typename T1 = T>
@@ -209,16 +233,7 @@ class DictionaryBuilderBase : public ArrayBuilder {
       return Status::Invalid(
           "Cannot append FixedSizeBinary array with non-matching type");
     }
-
-    const auto& concrete_array = static_cast<const FixedSizeBinaryArray&>(array);
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (array.IsNull(i)) {
-        ARROW_RETURN_NOT_OK(AppendNull());
-      } else {
-        ARROW_RETURN_NOT_OK(Append(concrete_array.GetValue(i)));
-      }
-    }
-    return Status::OK();
+    return AppendArrayValues(array);
   }
 
   void Reset() override {
@@ -274,6 +289,24 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return Status::OK();
   }
 
+  Status AppendArrayValues(const Array& array) {
+    // Hash the values in bulk, then append their indices
+    std::vector<int32_t> memo_indices(array.length());
+    ARROW_RETURN_NOT_OK(memo_table_->GetOrInsertValues(array, memo_indices.data()));
+
+    ARROW_RETURN_NOT_OK(Reserve(array.length()));
+    for (int64_t i = 0; i < array.length(); i++) {
+      if (array.IsNull(i)) {
+        ARROW_RETURN_NOT_OK(indices_builder_.AppendNull());
+      } else {
+        ARROW_RETURN_NOT_OK(indices_builder_.Append(memo_indices[i]));
+      }
+    }
+    length_ += array.length();
+    null_count_ += array.null_count();
+    return Status::OK();
+  }
+
   Status FinishWithDictOffset(int64_t dict_offset,
                               std::shared_ptr<ArrayData>* out_indices,
                               std::shared_ptr<Array>* out_dictionary) {
@@ -292,7 +325,7 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return Status::OK();
   }
 
-  std::unique_ptr<DictionaryMemoTable> memo_table_;
+  std::shared_ptr<DictionaryMemoTable> memo_table_;
 
   // The size of the dictionary memo at last invocation of Finish, to use in
   // FinishDelta for computing dictionary deltas
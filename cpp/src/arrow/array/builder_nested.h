@@ -79,6 +79,39 @@ class BaseListBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append lists delimited by the offsets of a separate values array,
+  /// e.g. those of an existing list array
+  ///
+  /// offsets has length + 1 entries, which are rebased onto the values already
+  /// in the value builder. The offsets[length] - offsets[0] values must then be
+  /// appended to the value builder, which is reserved space for them. If
+  /// passed, valid_bytes is of equal length to the number of lists, and any
+  /// zero byte will be considered as a null for that slot.
+  Status AppendOffsets(const offset_type* offsets, int64_t length,
+                       const uint8_t* valid_bytes = NULLPTR) {
+    const int64_t num_values = value_builder_->length();
+    const int64_t new_values = static_cast<int64_t>(offsets[length]) - offsets[0];
+    if (ARROW_PREDICT_FALSE(num_values + new_values > maximum_elements())) {
+      return Status::CapacityError("List array cannot contain more than ",
+                                   maximum_elements(), " child elements,", " have ",
+                                   num_values + new_values);
+    }
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(value_builder_->Reserve(new_values));
+    UnsafeAppendToBitmap(valid_bytes, length);
+    const int64_t delta = num_values - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + delta));
+    }
+    return Status::OK();
+  }
+
+  /// \brief Ensure that the value builder can take the indicated number of
+  /// additional child values without reallocating, e.g. from a size hint
+  Status ReserveValues(int64_t additional_values) {
+    return value_builder_->Reserve(additional_values);
+  }
+
   /// \brief Start a new variable-length list slot
   ///
   /// This function should be called before beginning to append elements to the
@@ -128,6 +128,20 @@ class NumericBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a contiguous C array of values
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap an optional packed validity bitmap where a set bit
+  /// indicates a valid (non-null) value
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const value_type* values, int64_t length, const uint8_t* bitmap,
+                      int64_t bitmap_offset) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    UnsafeAppendValues(values, length, bitmap, bitmap_offset);
+    return Status::OK();
+  }
+
   /// \brief Append a sequence of elements in one shot
   /// \param[in] values a contiguous C array of values
   /// \param[in] length the number of values to append
@@ -231,6 +245,18 @@ class NumericBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of elements, with an optional packed validity
+  /// bitmap, under the assumption that the underlying Buffers are large enough.
+  ///
+  /// This method does not capacity-check; make sure to call Reserve
+  /// beforehand.
+  void UnsafeAppendValues(const value_type* values, int64_t length,
+                          const uint8_t* bitmap = NULLPTR, int64_t bitmap_offset = 0) {
+    data_builder_.UnsafeAppend(values, length);
+    // length_ is update by these
+    ArrayBuilder::UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+  }
+
   /// Append a single scalar under the assumption that the underlying Buffer is
   /// large enough.
   ///
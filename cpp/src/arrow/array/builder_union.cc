@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -90,6 +91,12 @@ int8_t BasicUnionBuilder::AppendChild(const std::shared_ptr<ArrayBuilder>& new_c
   return new_type_id;
 }
 
+Status BasicUnionBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
+  RETURN_NOT_OK(types_builder_.Resize(capacity, false /* shrink_to_fit */));
+  return ArrayBuilder::Resize(capacity);
+}
+
 std::shared_ptr<DataType> BasicUnionBuilder::type() const {
   std::vector<std::shared_ptr<Field>> child_fields(child_fields_.size());
   for (size_t i = 0; i < child_fields.size(); ++i) {
@@ -118,4 +125,48 @@ int8_t BasicUnionBuilder::NextTypeId() {
   return dense_type_id_++;
 }
 
+Status DenseUnionBuilder::AppendValues(const int8_t* type_ids, int64_t length) {
+  // Lengths of the children before and after appending, for the type ids used
+  std::vector<int64_t> child_offsets(type_id_to_children_.size(), -1);
+  std::vector<int64_t> child_lengths(type_id_to_children_.size(), -1);
+  for (int64_t i = 0; i < length; ++i) {
+    const int8_t type_id = type_ids[i];
+    DCHECK_LT(static_cast<size_t>(type_id), type_id_to_children_.size());
+    if (child_lengths[type_id] < 0) {
+      child_offsets[type_id] = child_lengths[type_id] =
+          type_id_to_children_[type_id]->length();
+    }
+    if (ARROW_PREDICT_FALSE(child_lengths[type_id]++ == kListMaximumElements)) {
+      return Status::CapacityError(
+          "a dense UnionArray cannot contain more than 2^31 - 1 elements from a single "
+          "child");
+    }
+  }
+
+  RETURN_NOT_OK(Reserve(length));
+  for (size_t type_id = 0; type_id < child_lengths.size(); ++type_id) {
+    if (child_lengths[type_id] >= 0) {
+      RETURN_NOT_OK(type_id_to_children_[type_id]->Reserve(child_lengths[type_id] -
+                                                           child_offsets[type_id]));
+    }
+  }
+  types_builder_.UnsafeAppend(type_ids, length);
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(static_cast<int32_t>(child_offsets[type_ids[i]]++));
+  }
+  UnsafeAppendToBitmap(length, true);
+  return Status::OK();
+}
+
+Status SparseUnionBuilder::AppendValues(const int8_t* type_ids, int64_t length,
+                                        const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(length));
+  types_builder_.UnsafeAppend(type_ids, length);
+  UnsafeAppendToBitmap(valid_bytes, length);
+  for (const auto& child : children_) {
+    RETURN_NOT_OK(child->Reserve(length));
+  }
+  return Status::OK();
+}
+
 }  // namespace arrow
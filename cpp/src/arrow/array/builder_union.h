@@ -51,6 +51,8 @@ class ARROW_EXPORT BasicUnionBuilder : public ArrayBuilder {
 
   std::shared_ptr<DataType> type() const override;
 
+  Status Resize(int64_t capacity) override;
+
  protected:
   /// Use this constructor to initialize the UnionBuilder with no child builders,
   /// allowing type to be inferred. You will need to call AppendChild for each of the
@@ -95,9 +97,11 @@ class ARROW_EXPORT DenseUnionBuilder : public BasicUnionBuilder {
         offsets_builder_(pool) {}
 
   Status AppendNull() final {
-    ARROW_RETURN_NOT_OK(types_builder_.Append(0));
-    ARROW_RETURN_NOT_OK(offsets_builder_.Append(0));
-    return AppendToBitmap(false);
+    ARROW_RETURN_NOT_OK(Reserve(1));
+    types_builder_.UnsafeAppend(0);
+    offsets_builder_.UnsafeAppend(0);
+    UnsafeAppendToBitmap(false);
+    return Status::OK();
   }
 
   Status AppendNulls(int64_t length) final {
@@ -114,15 +118,30 @@ class ARROW_EXPORT DenseUnionBuilder : public BasicUnionBuilder {
   /// The corresponding child builder must be appended to independently after this method
   /// is called.
   Status Append(int8_t next_type) {
-    ARROW_RETURN_NOT_OK(types_builder_.Append(next_type));
     if (type_id_to_children_[next_type]->length() == kListMaximumElements) {
       return Status::CapacityError(
           "a dense UnionArray cannot contain more than 2^31 - 1 elements from a single "
           "child");
     }
-    auto offset = static_cast<int32_t>(type_id_to_children_[next_type]->length());
-    ARROW_RETURN_NOT_OK(offsets_builder_.Append(offset));
-    return AppendToBitmap(true);
+    ARROW_RETURN_NOT_OK(Reserve(1));
+    types_builder_.UnsafeAppend(next_type);
+    offsets_builder_.UnsafeAppend(
+        static_cast<int32_t>(type_id_to_children_[next_type]->length()));
+    UnsafeAppendToBitmap(true);
+    return Status::OK();
+  }
+
+  /// \brief Append many valid elements to the UnionArray, given their type ids
+  ///
+  /// The offsets are computed from the current lengths of the child builders,
+  /// to which the values of each type must then be appended, in order. Each
+  /// child builder is reserved space for its values.
+  Status AppendValues(const int8_t* type_ids, int64_t length);
+
+  Status Resize(int64_t capacity) override {
+    ARROW_RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
+    ARROW_RETURN_NOT_OK(offsets_builder_.Resize(capacity, false /* shrink_to_fit */));
+    return BasicUnionBuilder::Resize(capacity);
   }
 
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
@@ -153,8 +172,10 @@ class ARROW_EXPORT SparseUnionBuilder : public BasicUnionBuilder {
       : BasicUnionBuilder(pool, UnionMode::SPARSE, children, type) {}
 
   Status AppendNull() final {
-    ARROW_RETURN_NOT_OK(types_builder_.Append(0));
-    return AppendToBitmap(false);
+    ARROW_RETURN_NOT_OK(Reserve(1));
+    types_builder_.UnsafeAppend(0);
+    UnsafeAppendToBitmap(false);
+    return Status::OK();
   }
 
   Status AppendNulls(int64_t length) final {
@@ -170,9 +191,19 @@ class ARROW_EXPORT SparseUnionBuilder : public BasicUnionBuilder {
   /// The corresponding child builder must be appended to independently after this method
   /// is called, and all other child builders must have null appended
   Status Append(int8_t next_type) {
-    ARROW_RETURN_NOT_OK(types_builder_.Append(next_type));
-    return AppendToBitmap(true);
+    ARROW_RETURN_NOT_OK(Reserve(1));
+    types_builder_.UnsafeAppend(next_type);
+    UnsafeAppendToBitmap(true);
+    return Status::OK();
   }
+
+  /// \brief Append many elements to the UnionArray, given their type ids
+  ///
+  /// If passed, valid_bytes is of equal length to type_ids, and any zero byte
+  /// will be considered as a null for that slot. Every child builder must then
+  /// have length values appended, and is reserved space for them.
+  Status AppendValues(const int8_t* type_ids, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
 };
 
 }  // namespace arrow
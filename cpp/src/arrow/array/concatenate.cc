@@ -18,15 +18,19 @@
 #include "arrow/array/concatenate.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/extension_type.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 #include "arrow/visitor_inline.h"
 
@@ -82,70 +86,125 @@ static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool*
   return Status::OK();
 }
 
-// Write offsets in src into dst, adjusting them such that first_offset
-// will be the first offset written.
-template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range);
+// Below this many bytes (or offsets) per task, copies are not worth
+// dispatching to the thread pool.
+static constexpr int64_t kMinParallelCopyLength = 1 << 20;
+
+// Consider the concatenation of consecutive pieces of the given lengths,
+// starting at the given positions in the output (positions has one more
+// entry, the total length). Call func(i, begin, end) for the part [begin, end)
+// of each piece i, relative to the start of that piece. When use_threads is
+// true and the total is large, the output is split into about equal parts
+// which are processed on the CPU thread pool.
+template <typename Func>
+static Status ForEachPieceRange(const std::vector<int64_t>& positions, bool use_threads,
+                                Func&& func) {
+  const auto num_pieces = static_cast<int64_t>(positions.size()) - 1;
+  const int64_t total = positions.back();
+  int64_t num_tasks = 1;
+  if (use_threads) {
+    num_tasks = std::min<int64_t>(GetCpuThreadPoolCapacity(),
+                                  total / kMinParallelCopyLength);
+  }
+  if (num_tasks <= 1) {
+    for (int64_t i = 0; i < num_pieces; ++i) {
+      RETURN_NOT_OK(func(i, 0, positions[i + 1] - positions[i]));
+    }
+    return Status::OK();
+  }
+  return internal::ParallelFor(static_cast<int>(num_tasks), [&](int task) -> Status {
+    const int64_t task_begin = total * task / num_tasks;
+    const int64_t task_end = total * (task + 1) / num_tasks;
+    // the last piece starting at or before task_begin
+    int64_t i = std::upper_bound(positions.begin(), positions.end(), task_begin) -
+                positions.begin() - 1;
+    for (; i < num_pieces && positions[i] < task_end; ++i) {
+      const int64_t begin = std::max(task_begin, positions[i]) - positions[i];
+      const int64_t end = std::min(task_end, positions[i + 1]) - positions[i];
+      if (begin < end) {
+        RETURN_NOT_OK(func(i, begin, end));
+      }
+    }
+    return Status::OK();
+  });
+}
+
+// Allocate a buffer and concatenate buffers into it.
+static Status ConcatenateBuffers(const BufferVector& buffers, MemoryPool* pool,
+                                 bool use_threads, std::shared_ptr<Buffer>* out) {
+  std::vector<int64_t> positions(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    positions[i + 1] = positions[i] + buffers[i]->size();
+  }
+  RETURN_NOT_OK(AllocateBuffer(pool, positions.back(), out));
+  uint8_t* dst = (*out)->mutable_data();
+  return ForEachPieceRange(positions, use_threads,
+                           [&](int64_t i, int64_t begin, int64_t end) {
+                             std::memcpy(dst + positions[i] + begin,
+                                         buffers[i]->data() + begin, end - begin);
+                             return Status::OK();
+                           });
+}
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
 template <typename Offset>
 static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
-                                 std::shared_ptr<Buffer>* out,
+                                 bool use_threads, std::shared_ptr<Buffer>* out,
                                  std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
-  int64_t out_length = 0;
+  // Compute the range of values spanned by each buffer of offsets, and the
+  // adjustment bringing its first offset to values_length (the cumulative
+  // length of values spanned by offsets in previous buffers)
+  std::vector<int64_t> positions(buffers.size() + 1, 0);
+  std::vector<Offset> adjustments(buffers.size());
+  Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
-    out_length += buffers[i]->size() / sizeof(Offset);
+    auto src_begin = reinterpret_cast<const Offset*>(buffers[i]->data());
+    auto num_offsets = static_cast<int64_t>(buffers[i]->size() / sizeof(Offset));
+    Range* values_range = &values_ranges->at(i);
+    values_range->offset = src_begin[0];
+    values_range->length = src_begin[num_offsets] - values_range->offset;
+    if (values_length > std::numeric_limits<Offset>::max() - values_range->length) {
+      return Status::Invalid("offset overflow while concatenating arrays");
+    }
+    adjustments[i] = values_length - src_begin[0];
+    values_length += static_cast<Offset>(values_range->length);
+    positions[i + 1] = positions[i] + num_offsets;
   }
+
+  // allocate output buffer
+  const int64_t out_length = positions.back();
   RETURN_NOT_OK(AllocateBuffer(pool, (out_length + 1) * sizeof(Offset), out));
   auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
 
-  int64_t elements_length = 0;
-  Offset values_length = 0;
-  for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>(values_ranges->at(i).length);
-  }
+  // Write the adjusted offsets; offsets which need no adjustment (e.g. those
+  // of the first buffer or of empty arrays) are copied as they are
+  RETURN_NOT_OK(ForEachPieceRange(
+      positions, use_threads, [&](int64_t i, int64_t begin, int64_t end) {
+        auto src = reinterpret_cast<const Offset*>(buffers[i]->data());
+        Offset* out_offsets = dst + positions[i];
+        const Offset adjustment = adjustments[i];
+        if (adjustment == 0) {
+          std::memcpy(out_offsets + begin, src + begin, (end - begin) * sizeof(Offset));
+        } else {
+          for (int64_t j = begin; j < end; ++j) {
+            out_offsets[j] = src[j] + adjustment;
+          }
+        }
+        return Status::OK();
+      }));
 
   // the final element in dst is the length of all values spanned by the offsets
   dst[out_length] = values_length;
   return Status::OK();
 }
 
-template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range) {
-  // Get the range of offsets to transfer from src
-  auto src_begin = reinterpret_cast<const Offset*>(src->data());
-  auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
-
-  // Compute the range of values which is spanned by this range of offsets
-  values_range->offset = src_begin[0];
-  values_range->length = *src_end - values_range->offset;
-  if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
-    return Status::Invalid("offset overflow while concatenating arrays");
-  }
-
-  // Write offsets into dst, ensuring that the first offset written is
-  // first_offset
-  auto adjustment = first_offset - src_begin[0];
-  std::transform(src_begin, src_end, dst,
-                 [adjustment](Offset offset) { return offset + adjustment; });
-  return Status::OK();
-}
-
 class ConcatenateImpl {
  public:
-  ConcatenateImpl(const std::vector<ArrayData>& in, MemoryPool* pool)
-      : in_(in), pool_(pool) {
+  ConcatenateImpl(const std::vector<ArrayData>& in, MemoryPool* pool, bool use_threads)
+      : in_(in), pool_(pool), use_threads_(use_threads) {
     out_.type = in[0].type;
     for (size_t i = 0; i < in_.size(); ++i) {
       out_.length += in[i].length;
@@ -163,7 +222,8 @@ class ConcatenateImpl {
   }
 
   Status Concatenate(ArrayData* out) && {
-    if (out_.null_count != 0) {
+    // The validity bitmap of extension arrays is concatenated with their storage
+    if (out_.null_count != 0 && out_.type->id() != Type::EXTENSION) {
       RETURN_NOT_OK(ConcatenateBitmaps(Bitmaps(0), pool_, &out_.buffers[0]));
     }
     RETURN_NOT_OK(VisitTypeInline(*out_.type, this));
@@ -179,49 +239,61 @@ class ConcatenateImpl {
 
   Status Visit(const FixedWidthType& fixed) {
     // handles numbers, decimal128, fixed_size_binary
-    return ConcatenateBuffers(Buffers(1, fixed), pool_, &out_.buffers[1]);
+    return ConcatenateBuffers(Buffers(1, fixed), pool_, use_threads_, &out_.buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
     std::vector<Range> value_ranges;
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
+                                              use_threads_, &out_.buffers[1],
+                                              &value_ranges));
+    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, use_threads_,
+                              &out_.buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
     std::vector<Range> value_ranges;
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
+                                              use_threads_, &out_.buffers[1],
+                                              &value_ranges));
+    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, use_threads_,
+                              &out_.buffers[2]);
   }
 
   Status Visit(const ListType&) {
     std::vector<Range> value_ranges;
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateImpl(ChildData(0, value_ranges), pool_)
+                                              use_threads_, &out_.buffers[1],
+                                              &value_ranges));
+    return ConcatenateImpl(ChildData(0, value_ranges), pool_, use_threads_)
         .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const LargeListType&) {
     std::vector<Range> value_ranges;
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
-                                              &out_.buffers[1], &value_ranges));
-    return ConcatenateImpl(ChildData(0, value_ranges), pool_)
+                                              use_threads_, &out_.buffers[1],
+                                              &value_ranges));
+    return ConcatenateImpl(ChildData(0, value_ranges), pool_, use_threads_)
         .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const FixedSizeListType&) {
-    return ConcatenateImpl(ChildData(0), pool_).Concatenate(out_.child_data[0].get());
+    return ConcatenateImpl(ChildData(0), pool_, use_threads_)
+        .Concatenate(out_.child_data[0].get());
   }
 
   Status Visit(const StructType& s) {
-    for (int i = 0; i < s.num_children(); ++i) {
-      RETURN_NOT_OK(
-          ConcatenateImpl(ChildData(i), pool_).Concatenate(out_.child_data[i].get()));
+    if (s.num_children() == 1) {
+      return ConcatenateImpl(ChildData(0), pool_, use_threads_)
+          .Concatenate(out_.child_data[0].get());
     }
-    return Status::OK();
+    // Concatenate the children in parallel, each of them serially as waiting
+    // for nested tasks could exhaust the thread pool
+    return internal::OptionalParallelFor(use_threads_, s.num_children(), [&](int i) {
+      return ConcatenateImpl(ChildData(i), pool_, /*use_threads=*/false)
+          .Concatenate(out_.child_data[i].get());
+    });
   }
 
   Status Visit(const DictionaryType& d) {
@@ -240,7 +312,8 @@ class ConcatenateImpl {
 
     if (dictionaries_same) {
       out_.dictionary = in_[0].dictionary;
-      return ConcatenateBuffers(Buffers(1, *fixed), pool_, &out_.buffers[1]);
+      return ConcatenateBuffers(Buffers(1, *fixed), pool_, use_threads_,
+                                &out_.buffers[1]);
     } else {
       return Status::NotImplemented("Concat with dictionary unification NYI");
     }
@@ -251,8 +324,16 @@ class ConcatenateImpl {
   }
 
   Status Visit(const ExtensionType& e) {
-    // XXX can we just concatenate their storage?
-    return Status::NotImplemented("concatenation of ", e);
+    std::vector<ArrayData> storage(in_);
+    for (auto& data : storage) {
+      data.type = e.storage_type();
+    }
+    ArrayData out_storage;
+    RETURN_NOT_OK(
+        ConcatenateImpl(storage, pool_, use_threads_).Concatenate(&out_storage));
+    out_storage.type = std::move(out_.type);
+    out_ = std::move(out_storage);
+    return Status::OK();
   }
 
  private:
@@ -353,11 +434,17 @@ class ConcatenateImpl {
 
   const std::vector<ArrayData>& in_;
   MemoryPool* pool_;
+  bool use_threads_;
   ArrayData out_;
 };
 
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out) {
+  return Concatenate(arrays, pool, /*use_threads=*/false, out);
+}
+
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool, bool use_threads,
+                   std::shared_ptr<Array>* out) {
   if (arrays.size() == 0) {
     return Status::Invalid("Must pass at least one array");
   }
@@ -374,7 +461,7 @@ Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
   }
 
   ArrayData out_data;
-  RETURN_NOT_OK(ConcatenateImpl(data, pool).Concatenate(&out_data));
+  RETURN_NOT_OK(ConcatenateImpl(data, pool, use_threads).Concatenate(&out_data));
   *out = MakeArray(std::make_shared<ArrayData>(std::move(out_data)));
   return Status::OK();
 }
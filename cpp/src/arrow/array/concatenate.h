@@ -36,4 +36,18 @@ ARROW_EXPORT
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out);
 
+/// \brief Concatenate arrays, optionally copying on the CPU thread pool
+///
+/// With use_threads, large buffers are copied in parallel parts and the
+/// children of struct arrays are concatenated in parallel.
+///
+/// \param[in] arrays a vector of arrays to be concatenated
+/// \param[in] pool memory to store the result will be allocated from this memory pool
+/// \param[in] use_threads whether to use the CPU thread pool
+/// \param[out] out the resulting concatenated array
+/// \return Status
+ARROW_EXPORT
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool, bool use_threads,
+                   std::shared_ptr<Array>* out);
+
 }  // namespace arrow
@@ -35,6 +35,7 @@
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
+#include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
@@ -211,6 +212,27 @@ TEST_F(ConcatenateTest, DictionaryType) {
   });
 }
 
+TEST_F(ConcatenateTest, ExtensionType) {
+  Check([this](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
+    auto storage = this->GeneratePrimitive<Int16Type>(size, null_probability);
+    *out = WrapExtensionArray(smallint(), storage);
+  });
+}
+
+TEST_F(ConcatenateTest, ListOfExtensionType) {
+  Check([this](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
+    auto values_size = size * 4;
+    auto storage = this->GeneratePrimitive<Int16Type>(values_size, null_probability);
+    auto values = WrapExtensionArray(smallint(), storage);
+    auto offsets_vector = this->Offsets<int32_t>(values_size, size);
+    offsets_vector.front() = 0;
+    offsets_vector.back() = static_cast<int32_t>(values_size);
+    std::shared_ptr<Array> offsets;
+    ArrayFromVector<Int32Type>(offsets_vector, &offsets);
+    ASSERT_OK(ListArray::FromArrays(*offsets, *values, default_memory_pool(), out));
+  });
+}
+
 TEST_F(ConcatenateTest, DISABLED_UnionType) {
   // sparse mode
   Check([this](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
@@ -231,6 +253,26 @@ TEST_F(ConcatenateTest, DISABLED_UnionType) {
   });
 }
 
+TEST_F(ConcatenateTest, UseThreads) {
+  // Large enough for the buffers to be copied in parallel parts, and cut into
+  // many slices so that parts span several slices
+  const int32_t size = 1 << 20;
+  auto offsets = this->Offsets<int32_t>(size, 1000);
+  auto int64s = rng_.Int64(size, 0, 1000, 0.1);
+  auto strings = rng_.String(size, /*min_length =*/0, /*max_length =*/8, 0.1);
+  auto structs = std::make_shared<StructArray>(
+      struct_({field("foo", int64()), field("bar", utf8())}), size,
+      ArrayVector{int64s, strings});
+  for (const auto& array : ArrayVector{int64s, strings, structs}) {
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(Concatenate(this->Slices(array, offsets), default_memory_pool(),
+                          /*use_threads=*/true, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
@@ -17,8 +17,14 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
 #include "arrow/array.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -299,6 +305,11 @@ Status ValidateArray(const Array& array) {
 
 namespace {
 
+// The values are checked in blocks without branching, so that the compiler
+// can vectorize the loops; a failing block is then scanned value by value
+// to report the first invalid one.
+static constexpr int64_t kValidateBlockSize = 256;
+
 struct BoundsCheckVisitor {
   int64_t min_value_;
   int64_t max_value_;
@@ -309,13 +320,41 @@ struct BoundsCheckVisitor {
   }
 
   template <typename T>
-  Status Visit(const NumericArray<T>& array) {
-    for (int64_t i = 0; i < array.length(); ++i) {
-      if (!array.IsNull(i)) {
-        const auto v = static_cast<int64_t>(array.Value(i));
-        if (v < min_value_ || v > max_value_) {
-          return Status::Invalid("Value at position ", i, " out of bounds: ", v,
-                                 " (should be in [", min_value_, ", ", max_value_, "])");
+  enable_if_integer<T, Status> Visit(const NumericArray<T>& array) {
+    using c_type = typename T::c_type;
+    using limits = std::numeric_limits<c_type>;
+    // The values are compared without widening them, in bounds clamped to
+    // the value type (if the bounds don't overlap it, all blocks fail)
+    const auto type_min = static_cast<int64_t>(limits::min());
+    const auto type_max = static_cast<int64_t>(std::min(
+        static_cast<uint64_t>(limits::max()),
+        static_cast<uint64_t>(std::numeric_limits<int64_t>::max())));
+    const bool overlaps = max_value_ >= type_min && min_value_ <= type_max;
+    const auto min_value = static_cast<c_type>(std::max(min_value_, type_min));
+    const auto max_value = static_cast<c_type>(std::min(max_value_, type_max));
+
+    const c_type* values = array.raw_values();
+    for (int64_t block_start = 0; block_start < array.length();
+         block_start += kValidateBlockSize) {
+      const int64_t block_end =
+          std::min(array.length(), block_start + kValidateBlockSize);
+      // Null slots are checked too: their values are usually zeros
+      uint8_t in_bounds = overlaps;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        in_bounds &=
+            static_cast<uint8_t>((values[i] >= min_value) & (values[i] <= max_value));
+      }
+      if (ARROW_PREDICT_TRUE(in_bounds)) {
+        continue;
+      }
+      for (int64_t i = block_start; i < block_end; ++i) {
+        if (!array.IsNull(i)) {
+          const auto v = static_cast<int64_t>(values[i]);
+          if (v < min_value_ || v > max_value_) {
+            return Status::Invalid("Value at position ", i, " out of bounds: ", v,
+                                   " (should be in [", min_value_, ", ", max_value_,
+                                   "])");
+          }
         }
       }
     }
@@ -327,11 +366,11 @@ struct ValidateArrayDataVisitor {
   // Fallback
   Status Visit(const Array& array) { return Status::OK(); }
 
-  Status Visit(const StringArray& array) { return ValidateBinaryArray(array); }
+  Status Visit(const StringArray& array) { return ValidateStringArray(array); }
 
   Status Visit(const BinaryArray& array) { return ValidateBinaryArray(array); }
 
-  Status Visit(const LargeStringArray& array) { return ValidateBinaryArray(array); }
+  Status Visit(const LargeStringArray& array) { return ValidateStringArray(array); }
 
   Status Visit(const LargeBinaryArray& array) { return ValidateBinaryArray(array); }
 
@@ -409,6 +448,27 @@ struct ValidateArrayDataVisitor {
     return ValidateOffsets(array, array.value_data()->size());
   }
 
+  template <typename StringArrayType>
+  Status ValidateStringArray(const StringArrayType& array) {
+    RETURN_NOT_OK(ValidateBinaryArray(array));
+    if (array.length() == 0) {
+      return Status::OK();
+    }
+    util::InitializeUTF8();
+    // Validate all values at once, then one by one if that fails, as the
+    // bytes of null slots needn't be valid UTF8
+    if (ARROW_PREDICT_TRUE(util::ValidateUTF8Values(
+            array.value_data()->data(), array.raw_value_offsets(), array.length()))) {
+      return Status::OK();
+    }
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (!array.IsNull(i) && !util::ValidateUTF8(array.GetView(i))) {
+        return Status::Invalid("Invalid UTF8 sequence at string index ", i);
+      }
+    }
+    return Status::OK();
+  }
+
   template <typename ListArrayType>
   Status ValidateListArray(const ListArrayType& array) {
     const auto& child_array = array.values();
@@ -428,24 +488,39 @@ struct ValidateArrayDataVisitor {
       return Status::OK();
     }
 
-    auto prev_offset = array.value_offset(0);
-    if (prev_offset < 0) {
+    using offset_type = typename ArrayType::offset_type;
+    const offset_type* offsets = array.raw_value_offsets();
+    if (offsets[0] < 0) {
       return Status::Invalid(
           "Offset invariant failure: array starts at negative "
           "offset ",
-          prev_offset);
-    }
-    for (int64_t i = 1; i <= array.length(); ++i) {
-      auto current_offset = array.value_offset(i);
-      if (current_offset < prev_offset) {
-        return Status::Invalid("Offset invariant failure: non-monotonic offset at slot ",
-                               i, ": ", current_offset, " < ", prev_offset);
+          offsets[0]);
+    }
+    const auto limit = static_cast<offset_type>(
+        std::min<int64_t>(offset_limit, std::numeric_limits<offset_type>::max()));
+    for (int64_t block_start = 0; block_start < array.length();
+         block_start += kValidateBlockSize) {
+      const int64_t block_end =
+          std::min(array.length(), block_start + kValidateBlockSize);
+      uint8_t valid = 1;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        valid &= static_cast<uint8_t>((offsets[i + 1] >= offsets[i]) &
+                                      (offsets[i + 1] <= limit));
       }
-      if (current_offset > offset_limit) {
-        return Status::Invalid("Offset invariant failure: offset for slot ", i,
-                               " out of bounds: ", current_offset, " > ", offset_limit);
+      if (ARROW_PREDICT_TRUE(valid)) {
+        continue;
+      }
+      for (int64_t i = block_start + 1; i <= block_end; ++i) {
+        if (offsets[i] < offsets[i - 1]) {
+          return Status::Invalid(
+              "Offset invariant failure: non-monotonic offset at slot ", i, ": ",
+              offsets[i], " < ", offsets[i - 1]);
+        }
+        if (offsets[i] > offset_limit) {
+          return Status::Invalid("Offset invariant failure: offset for slot ", i,
+                                 " out of bounds: ", offsets[i], " > ", offset_limit);
+        }
       }
-      prev_offset = current_offset;
     }
     return Status::OK();
   }
@@ -464,5 +539,35 @@ Status ValidateArrayData(const Array& array) {
   return VisitArrayInline(array, &visitor);
 }
 
+ARROW_EXPORT
+Status ValidateArraysData(const std::vector<const Array*>& arrays, bool use_threads,
+                          int64_t* invalid_index) {
+  *invalid_index = -1;
+  std::vector<Status> statuses(arrays.size());
+  // The arrays after an invalid one are skipped, but not those before it so
+  // that the error reported doesn't depend on the scheduling
+  std::atomic<int64_t> first_invalid(static_cast<int64_t>(arrays.size()));
+  RETURN_NOT_OK(OptionalParallelFor(
+      use_threads, static_cast<int>(arrays.size()), [&](int i) {
+        if (i > first_invalid.load()) {
+          return Status::OK();
+        }
+        statuses[i] = ValidateArrayData(*arrays[i]);
+        if (!statuses[i].ok()) {
+          int64_t expected = first_invalid.load();
+          while (i < expected && !first_invalid.compare_exchange_weak(expected, i)) {
+          }
+        }
+        return Status::OK();
+      }));
+  for (size_t i = 0; i < statuses.size(); ++i) {
+    if (!statuses[i].ok()) {
+      *invalid_index = static_cast<int64_t>(i);
+      return statuses[i];
+    }
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace arrow
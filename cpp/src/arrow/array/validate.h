@@ -35,5 +35,12 @@ Status ValidateArray(const Array& array);
 ARROW_EXPORT
 Status ValidateArrayData(const Array& array);
 
+// Run ValidateArrayData on several arrays, on the CPU thread pool if use_threads
+// is true.  Returns the error of the first invalid array in order, with its
+// index in *invalid_index (-1 if the arrays couldn't be validated at all).
+ARROW_EXPORT
+Status ValidateArraysData(const std::vector<const Array*>& arrays, bool use_threads,
+                          int64_t* invalid_index);
+
 }  // namespace internal
 }  // namespace arrow
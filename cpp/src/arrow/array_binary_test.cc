@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -254,6 +255,56 @@ class TestStringArray : public ::testing::Test {
     ASSERT_RAISES(Invalid, ValidateOffsets(1, {0, -1, -1}, "data", 1));
     // Offsets non-monotonic
     ASSERT_RAISES(Invalid, ValidateOffsets(2, {0, 5, 4}, "some data"));
+
+    // Offsets checked in blocks
+    const std::string data(1000, 'x');
+    std::vector<offset_type> long_offsets(1001);
+    std::iota(long_offsets.begin(), long_offsets.end(), 0);
+    ASSERT_OK(ValidateOffsets(1000, long_offsets, data));
+    ASSERT_OK(ValidateOffsets(990, long_offsets, data, 7));
+    long_offsets[700] = 698;
+    ASSERT_RAISES(Invalid, ValidateOffsets(1000, long_offsets, data));
+    ASSERT_OK(ValidateOffsets(500, long_offsets, data));
+    long_offsets[700] = 700;
+    long_offsets[1000] = 1001;
+    ASSERT_RAISES(Invalid, ValidateOffsets(1000, long_offsets, data));
+  }
+
+  Status ValidateUTF8(std::vector<offset_type> offsets, util::string_view data,
+                      const std::vector<uint8_t>& valid_bytes) {
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, BitUtil::BytesToBits(valid_bytes));
+    ArrayType arr(static_cast<int64_t>(valid_bytes.size()), Buffer::Wrap(offsets),
+                  std::make_shared<Buffer>(data), null_bitmap,
+                  CountNulls(valid_bytes));
+    return arr.ValidateFull();
+  }
+
+  void TestValidateUTF8() {
+    // Only string arrays must hold valid UTF8
+    const bool is_utf8 =
+        T::type_id == Type::STRING || T::type_id == Type::LARGE_STRING;
+    auto check_invalid = [&](const Status& st) {
+      if (is_utf8) {
+        ASSERT_RAISES(Invalid, st);
+      } else {
+        ASSERT_OK(st);
+      }
+    };
+
+    ASSERT_OK(ValidateUTF8({0, 2, 5}, "\xc3\xa9\xe2\x82\xac", {1, 1}));
+    check_invalid(ValidateUTF8({0, 2, 3}, "\xc3\xa9\xff", {1, 1}));
+    // A null slot may hold invalid bytes
+    ASSERT_OK(ValidateUTF8({0, 2, 3}, "\xc3\xa9\xff", {1, 0}));
+    // A character mustn't straddle two values
+    check_invalid(ValidateUTF8({0, 1, 2}, "\xc3\xa9", {1, 1}));
+
+    // Long values are validated with SIMD instructions, if available
+    std::string data(200, 'x');
+    std::vector<offset_type> offsets = {0, 100, 200};
+    ASSERT_OK(ValidateUTF8(offsets, data, {1, 1}));
+    data[150] = '\x80';
+    check_invalid(ValidateUTF8(offsets, data, {1, 1}));
+    ASSERT_OK(ValidateUTF8(offsets, data, {1, 0}));
   }
 
  protected:
@@ -295,6 +346,8 @@ TYPED_TEST(TestStringArray, TestSliceGetString) { this->TestSliceGetString(); }
 
 TYPED_TEST(TestStringArray, TestValidateOffsets) { this->TestValidateOffsets(); }
 
+TYPED_TEST(TestStringArray, TestValidateUTF8) { this->TestValidateUTF8(); }
+
 // ----------------------------------------------------------------------
 // String builder tests
 
@@ -434,6 +487,25 @@ class TestStringBuilder : public TestBuilder {
     CheckStringArray(*result_, {"", "bb", "a", "", "ccc"}, {1, 1, 1, 0, 1}, reps);
   }
 
+  void TestAppendOffsetsAndData() {
+    // Offsets into a buffer which don't start at zero
+    const std::string data = "xxabbcccdddd";
+    std::vector<offset_type> offsets = {2, 3, 5, 5, 8, 12};
+    // Validity bits 1, 1, 0, 1, 1 starting at bit 2
+    std::vector<uint8_t> bitmap = {0x6C};
+    const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+    ASSERT_OK(builder_->Append("z"));
+    ASSERT_OK(builder_->AppendValues(offsets.data(), raw_data, 5, bitmap.data(), 2));
+    ASSERT_OK(builder_->AppendValues(offsets.data() + 3, raw_data, 2));
+    Done();
+
+    ASSERT_EQ(8, result_->length());
+    ASSERT_EQ(1, result_->null_count());
+    CheckStringArray(*result_, {"z", "a", "bb", "", "ccc", "dddd", "ccc", "dddd"},
+                     {1, 1, 1, 0, 1, 1, 1, 1});
+  }
+
   void TestCapacityReserve() {
     std::vector<std::string> strings = {"aaaaa", "bbbbbbbbbb", "ccccccccccccccc",
                                         "dddddddddd"};
@@ -503,6 +575,10 @@ TYPED_TEST(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
   this->TestAppendCStringsWithoutValidBytes();
 }
 
+TYPED_TEST(TestStringBuilder, TestAppendOffsetsAndData) {
+  this->TestAppendOffsetsAndData();
+}
+
 TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve(); }
 
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
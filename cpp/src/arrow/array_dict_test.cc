@@ -223,6 +223,35 @@ TYPED_TEST(TestDictionaryBuilder, DeltaDictionary) {
   AssertArraysEqual(*ArrayFromJSON(type, "[3]"), *result_delta);
 }
 
+TYPED_TEST(TestDictionaryBuilder, SharedMemoTable) {
+  auto type = std::make_shared<TypeParam>();
+
+  DictionaryBuilder<TypeParam> builder;
+  ASSERT_OK(builder.AppendArray(*ArrayFromJSON(type, "[1, 2, null, 1]")));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+
+  DictionaryArray expected(dictionary(int8(), type),
+                           ArrayFromJSON(int8(), "[0, 1, null, 0]"),
+                           ArrayFromJSON(type, "[1, 2]"));
+  ASSERT_TRUE(expected.Equals(result));
+
+  // A second builder continues the same dictionary
+  DictionaryBuilder<TypeParam> other(builder.memo_table());
+  ASSERT_EQ(other.dictionary_length(), 2);
+  ASSERT_OK(other.AppendArray(*ArrayFromJSON(type, "[3, 2, 3, null]")));
+  std::shared_ptr<Array> result_indices, result_delta;
+  ASSERT_OK(other.FinishDelta(&result_indices, &result_delta));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[2, 1, 2, null]"), *result_indices);
+  AssertArraysEqual(*ArrayFromJSON(type, "[3]"), *result_delta);
+
+  ASSERT_EQ(builder.dictionary_length(), 3);
+  ASSERT_OK(builder.Append(static_cast<typename TypeParam::c_type>(3)));
+  ASSERT_OK(builder.FinishDelta(&result_indices, &result_delta));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[2]"), *result_indices);
+  AssertArraysEqual(*ArrayFromJSON(type, "[3]"), *result_delta);
+}
+
 TYPED_TEST(TestDictionaryBuilder, DoubleDeltaDictionary) {
   using c_type = typename TypeParam::c_type;
   auto type = std::make_shared<TypeParam>();
@@ -555,6 +584,30 @@ TEST(TestStringDictionaryBuilder, DeltaDictionary) {
   AssertArraysEqual(*ArrayFromJSON(utf8(), "[\"test3\"]"), *result_delta);
 }
 
+TEST(TestStringDictionaryBuilder, AppendArray) {
+  StringDictionaryBuilder builder;
+  // More values than the memo table hashes in one batch
+  std::string json = "[";
+  for (int i = 0; i < 200; ++i) {
+    json += (i % 7 == 0) ? "null, " : "\"" + std::to_string(i % 5) + "\", ";
+  }
+  json += "\"test\"]";
+  ASSERT_OK(builder.AppendArray(*ArrayFromJSON(utf8(), json)));
+  ASSERT_RAISES(Invalid, builder.AppendArray(*ArrayFromJSON(binary(), "[\"a\"]")));
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+  const auto& dict_array = checked_cast<const DictionaryArray&>(*result);
+  ASSERT_EQ(dict_array.null_count(), 29);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["1", "2", "3", "4", "0", "test"])"),
+                    *dict_array.dictionary());
+  const auto& indices = checked_cast<const Int8Array&>(*dict_array.indices());
+  ASSERT_EQ(indices.Value(1), 0);
+  ASSERT_EQ(indices.Value(5), 4);
+  ASSERT_EQ(indices.Value(200), 5);
+}
+
 TEST(TestStringDictionaryBuilder, BigDeltaDictionary) {
   constexpr int16_t kTestLength = 2048;
   // Build the dictionary Array
@@ -988,6 +1041,37 @@ TEST(TestDictionary, Validate) {
       "");
 }
 
+TEST(TestDictionary, ValidateLongIndices) {
+  // Indices are checked in blocks, rescanned if out of bounds
+  auto dict = ArrayFromJSON(utf8(), "[\"foo\", \"bar\", \"baz\"]");
+  auto dict_type = dictionary(int32(), utf8());
+  std::vector<bool> is_valid(1000, true);
+  std::vector<int32_t> values(1000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int32_t>(i % 3);
+  }
+  auto check = [&](bool expect_valid) {
+    std::shared_ptr<Array> indices;
+    ArrayFromVector<Int32Type, int32_t>(is_valid, values, &indices);
+    auto arr = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+    if (expect_valid) {
+      ASSERT_OK(arr->ValidateFull());
+    } else {
+      ASSERT_RAISES(Invalid, arr->ValidateFull());
+    }
+  };
+  check(true);
+
+  // Invalid index masked by null
+  values[600] = -1;
+  is_valid[600] = false;
+  check(true);
+  values[999] = 3;
+  check(false);
+  is_valid[999] = false;
+  check(true);
+}
+
 TEST(TestDictionary, FromArray) {
   auto dict = ArrayFromJSON(utf8(), "[\"foo\", \"bar\", \"baz\"]");
   auto dict_type = dictionary(int16(), utf8());
@@ -324,6 +324,30 @@ class TestListArray : public TestBuilder {
     ASSERT_RAISES(Invalid, result_->ValidateFull());
   }
 
+  void TestAppendOffsets() {
+    std::vector<int16_t> values = {0, 1, 2, 3, 4, 5, 6};
+    std::vector<uint8_t> is_valid = {1, 0, 1};
+    // Offsets of slices of other list arrays
+    std::vector<offset_type> offsets1 = {10, 13, 13};
+    std::vector<offset_type> offsets2 = {5, 9};
+
+    Int16Builder* vb = checked_cast<Int16Builder*>(builder_->value_builder());
+    ASSERT_OK(builder_->AppendOffsets(offsets1.data(), 2, is_valid.data()));
+    ASSERT_GE(vb->capacity(), 3);
+    for (int16_t value : {0, 1, 2}) {
+      ASSERT_OK(vb->Append(value));
+    }
+    ASSERT_OK(builder_->AppendOffsets(offsets2.data(), 1, is_valid.data() + 2));
+    ASSERT_GE(vb->capacity(), 7);
+    for (int16_t value : {3, 4, 5, 6}) {
+      ASSERT_OK(vb->Append(value));
+    }
+    ASSERT_OK(builder_->ReserveValues(100));
+    ASSERT_GE(vb->capacity(), 107);
+    Done();
+    ValidateBasicListArray(result_.get(), values, is_valid);
+  }
+
   void TestZeroLength() {
     // All buffers are null
     Done();
@@ -459,6 +483,8 @@ TYPED_TEST(TestListArray, BulkAppend) { this->TestBulkAppend(); }
 
 TYPED_TEST(TestListArray, BulkAppendInvalid) { this->TestBulkAppendInvalid(); }
 
+TYPED_TEST(TestListArray, AppendOffsets) { this->TestAppendOffsets(); }
+
 TYPED_TEST(TestListArray, ZeroLength) { this->TestZeroLength(); }
 
 TYPED_TEST(TestListArray, BuilderPreserveFieldName) {
@@ -170,6 +170,64 @@ TEST(StructArray, FromFields) {
   ASSERT_RAISES(Invalid, res);
 }
 
+TEST(StructArray, Flatten) {
+  auto a = ArrayFromJSON(int32(), "[1, 2, null, 4, 5, 6, 7, 8, 9, 10]");
+  auto b = ArrayFromJSON(int64(), "[10, 11, 12, 13, 14, 15, 16, 17, 18, 19]");
+  std::shared_ptr<Array> n = std::make_shared<NullArray>(10);
+  auto type = struct_({field("a", int32()), field("b", int64()), field("n", null())});
+  ArrayVector flattened;
+
+  // Without struct nulls, the fields are returned as is
+  std::shared_ptr<Array> array;
+  ASSERT_OK(StructArray::Make({a, b, n}, {"a", "b", "n"}).Value(&array));
+  const auto& struct_array = checked_cast<const StructArray&>(*array);
+  ASSERT_OK(struct_array.Flatten(default_memory_pool(), &flattened));
+  ASSERT_EQ(3, flattened.size());
+  ASSERT_EQ(a->data(), flattened[0]->data());
+  ASSERT_EQ(b->data(), flattened[1]->data());
+
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(GetBitmapFromVector(
+      std::vector<bool>{true, false, true, true, false, true, true, true, true, false},
+      &null_bitmap));
+  auto with_nulls =
+      std::make_shared<StructArray>(type, 10, ArrayVector{a, b, n}, null_bitmap, 3);
+  ASSERT_OK(with_nulls->ValidateFull());
+
+  auto check = [&](const std::shared_ptr<Array>& array, const std::string& a_json,
+                   const std::string& b_json) {
+    // Twice, to check that the struct is left untouched
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_OK(checked_cast<const StructArray&>(*array).Flatten(default_memory_pool(),
+                                                                  &flattened));
+      ASSERT_EQ(3, flattened.size());
+      for (const auto& field : flattened) {
+        ASSERT_OK(field->ValidateFull());
+      }
+      AssertArraysEqual(*ArrayFromJSON(int32(), a_json), *flattened[0]);
+      AssertArraysEqual(*ArrayFromJSON(int64(), b_json), *flattened[1]);
+      ASSERT_EQ(array->length(), flattened[2]->null_count());
+    }
+  };
+  check(with_nulls, "[1, null, null, 4, null, 6, 7, 8, 9, null]",
+        "[10, null, 12, 13, null, 15, 16, 17, 18, null]");
+  // Fields without nulls share the struct's null bitmap
+  ASSERT_EQ(null_bitmap, flattened[1]->null_bitmap());
+
+  // Sliced struct
+  check(with_nulls->Slice(3), "[4, null, 6, 7, 8, 9, null]",
+        "[13, null, 15, 16, 17, 18, null]");
+  check(with_nulls->Slice(1, 2), "[null, null]", "[null, 12]");
+
+  // Sliced fields, at an offset which doesn't allow sharing the bitmap
+  auto sliced_fields = std::make_shared<StructArray>(
+      type, 8, ArrayVector{a->Slice(1, 8), b->Slice(2, 8), n->Slice(1, 8)}, null_bitmap,
+      kUnknownNullCount);
+  ASSERT_OK(sliced_fields->ValidateFull());
+  check(sliced_fields, "[2, null, 4, 5, null, 7, 8, 9]",
+        "[12, null, 14, 15, null, 17, 18, 19]");
+}
+
 // ----------------------------------------------------------------------------------
 // Struct test
 class TestStructBuilder : public TestBuilder {
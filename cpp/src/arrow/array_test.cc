@@ -1055,6 +1055,26 @@ TYPED_TEST(TestPrimitiveBuilder, TestReserve) {
   ASSERT_RAISES(Invalid, this->builder_->Resize(1));
 }
 
+TEST(TestNumericBuilder, AppendValuesBitmap) {
+  Int32Builder builder;
+  std::vector<int32_t> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  // Bits 3 to 6 are 1, 0, 1, 1 and bits 9 to 12 are 1, 1, 0, 1
+  std::vector<uint8_t> bitmap = {0xE8, 0xB6};
+
+  ASSERT_OK(builder.AppendValues(values.data(), 4, bitmap.data(), 3));
+  ASSERT_OK(builder.Reserve(6));
+  builder.UnsafeAppendValues(values.data() + 4, 2);
+  builder.UnsafeAppendValues(values.data() + 6, 4, bitmap.data(), 9);
+  ASSERT_EQ(10, builder.length());
+  ASSERT_EQ(2, builder.null_count());
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, null, 3, 4, 5, 6, 7, 8, null, 10]"),
+                    *result);
+}
+
 TEST(TestBooleanBuilder, AppendNullsAdvanceBuilder) {
   BooleanBuilder builder;
 
@@ -1248,6 +1268,65 @@ void CheckFloatingNanEquality() {
   ASSERT_TRUE(b->RangeEquals(a, 0, 1, 0));
 }
 
+// Long enough for the comparisons to proceed by blocks, whether runs of
+// valid values or blocks mixing nulls
+template <typename TYPE>
+void CheckLongEquality() {
+  using T = typename TYPE::c_type;
+
+  const int64_t kSize = 1000;
+  const int64_t kDifference = 777;
+
+  std::vector<bool> is_valid;
+  random_is_valid(kSize, 0.1, &is_valid);
+  is_valid[kDifference] = true;
+
+  // The values of nulls differ, which must be ignored
+  std::vector<T> values1(kSize), values2(kSize);
+  for (int64_t i = 0; i < kSize; ++i) {
+    values1[i] = static_cast<T>(i % 97);
+    values2[i] = is_valid[i] ? values1[i] : static_cast<T>(1);
+  }
+
+  std::shared_ptr<Array> a, b, c, dense_a, dense_c;
+  ArrayFromVector<TYPE, T>(is_valid, values1, &a);
+  ArrayFromVector<TYPE, T>(is_valid, values2, &b);
+  ASSERT_TRUE(a->Equals(b));
+  ASSERT_TRUE(a->ApproxEquals(b));
+  // Slices not aligned on bytes
+  ASSERT_TRUE(a->Slice(3, 990)->Equals(b->Slice(3, 990)));
+  ASSERT_TRUE(a->Slice(3, 990)->ApproxEquals(b->Slice(3, 990)));
+
+  values2[kDifference] = static_cast<T>(0);
+  ArrayFromVector<TYPE, T>(is_valid, values2, &c);
+  ASSERT_FALSE(a->Equals(c));
+  ASSERT_FALSE(a->ApproxEquals(c));
+  ASSERT_FALSE(a->Equals(c, EqualOptions().nans_equal(true)));
+  ASSERT_FALSE(a->Slice(3, 990)->Equals(c->Slice(3, 990)));
+  ASSERT_FALSE(a->Slice(3, 990)->ApproxEquals(c->Slice(3, 990)));
+  ASSERT_TRUE(a->Slice(5, kDifference - 5)->Equals(c->Slice(5, kDifference - 5)));
+
+  // Without nulls
+  ArrayFromVector<TYPE, T>(values1, &dense_a);
+  ASSERT_TRUE(dense_a->Slice(3, 990)->Equals(dense_a->Slice(3, 990)));
+  for (int64_t i = 0; i < kSize; ++i) {
+    values2[i] = static_cast<T>(i % 97);
+  }
+  values2[kDifference] = static_cast<T>(0);
+  ArrayFromVector<TYPE, T>(values2, &dense_c);
+  ASSERT_FALSE(dense_a->Equals(dense_c));
+  ASSERT_FALSE(dense_a->ApproxEquals(dense_c));
+  ASSERT_FALSE(dense_a->Slice(3, 990)->Equals(dense_c->Slice(3, 990)));
+}
+
+TEST(TestPrimitiveAdHoc, LongEquality) {
+  CheckLongEquality<BooleanType>();
+  CheckLongEquality<Int32Type>();
+  CheckLongEquality<Int64Type>();
+  CheckLongEquality<FloatType>();
+  CheckLongEquality<DoubleType>();
+}
+
 TEST(TestPrimitiveAdHoc, FloatingApproxEquals) {
   CheckApproxEquals<FloatType>();
   CheckApproxEquals<DoubleType>();
@@ -1704,6 +1783,32 @@ TEST_F(TestAdaptiveIntBuilder, TestAppendValues) {
   }
 }
 
+TEST_F(TestAdaptiveIntBuilder, TestAppendValuesPromoteOnce) {
+  // A large block whose values only need a wider type near its end
+  std::vector<int64_t> values(20000);
+  std::iota(values.begin(), values.end(), -10000);
+  std::vector<uint8_t> valid_bytes(values.size(), 1);
+  // A null slot's value doesn't widen the type
+  values[5] = std::numeric_limits<int64_t>::max();
+  valid_bytes[5] = 0;
+
+  ASSERT_OK(builder_->Append(1));
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size(), valid_bytes.data()));
+  ASSERT_OK(builder_->Append(2));
+  Done();
+
+  std::vector<int16_t> expected_values = {1};
+  std::vector<bool> expected_valid(values.size() + 2, true);
+  for (int64_t value : values) {
+    expected_values.push_back(static_cast<int16_t>(value));
+  }
+  expected_values[6] = 0;
+  expected_valid[6] = false;
+  expected_values.push_back(2);
+  ArrayFromVector<Int16Type, int16_t>(expected_valid, expected_values, &expected_);
+  AssertArraysEqual(*expected_, *result_);
+}
+
 TEST_F(TestAdaptiveIntBuilder, TestAssertZeroPadded) {
   std::vector<int64_t> values(
       {0, static_cast<int64_t>(std::numeric_limits<int32_t>::max()) + 1});
@@ -1858,6 +1963,18 @@ TEST_F(TestAdaptiveUIntBuilder, TestAppendValues) {
   ASSERT_TRUE(expected_->Equals(result_));
 }
 
+TEST_F(TestAdaptiveUIntBuilder, TestAppendValuesAfterAppend) {
+  std::vector<uint64_t> values = {3, 4, 1000};
+  ASSERT_OK(builder_->Append(1));
+  ASSERT_OK(builder_->Append(2));
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size()));
+  ASSERT_OK(builder_->Append(5));
+  Done();
+
+  ArrayFromVector<UInt16Type, uint16_t>({1, 2, 3, 4, 1000, 5}, &expected_);
+  AssertArraysEqual(*expected_, *result_);
+}
+
 TEST_F(TestAdaptiveUIntBuilder, TestAssertZeroPadded) {
   std::vector<uint64_t> values(
       {0, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1});
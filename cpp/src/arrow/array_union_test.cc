@@ -376,6 +376,40 @@ TEST_F(DenseUnionBuilderTest, Basics) {
   ASSERT_ARRAYS_EQUAL(*expected, *actual);
 }
 
+TEST_F(DenseUnionBuilderTest, AppendValues) {
+  union_builder.reset(new DenseUnionBuilder(
+      default_memory_pool(), {i8_builder, str_builder, dbl_builder},
+      union_({field("i8", int8()), field("str", utf8()), field("dbl", float64())},
+             {I8, STR, DBL}, UnionMode::DENSE)));
+  AppendInt(33);
+  std::vector<int8_t> type_ids = {STR, DBL, DBL, STR, I8, STR, I8, DBL};
+  ASSERT_OK(union_builder->AppendValues(type_ids.data(), type_ids.size()));
+  ASSERT_GE(i8_builder->capacity(), 3);
+  ASSERT_GE(str_builder->capacity(), 3);
+  ASSERT_GE(dbl_builder->capacity(), 3);
+  expected_types_vector.insert(expected_types_vector.end(), type_ids.begin(),
+                               type_ids.end());
+  ASSERT_OK(i8_builder->AppendValues({10, -10}));
+  ASSERT_OK(str_builder->AppendValues({"abc", "", "def"}));
+  ASSERT_OK(dbl_builder->AppendValues({1.0, -1.0, 0.5}));
+  ASSERT_OK(union_builder->Finish(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  ArrayFromVector<Int8Type, uint8_t>(expected_types_vector, &expected_types);
+
+  auto expected_i8 = ArrayFromJSON(int8(), "[33, 10, -10]");
+  auto expected_str = ArrayFromJSON(utf8(), R"(["abc", "", "def"])");
+  auto expected_dbl = ArrayFromJSON(float64(), "[1.0, -1.0, 0.5]");
+
+  auto expected_offsets = ArrayFromJSON(int32(), "[0, 0, 0, 1, 1, 1, 2, 2, 2]");
+
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(UnionArray::MakeDense(*expected_types, *expected_offsets,
+                                  {expected_i8, expected_str, expected_dbl},
+                                  {"i8", "str", "dbl"}, {I8, STR, DBL}, &expected));
+
+  ASSERT_ARRAYS_EQUAL(*expected, *actual);
+}
+
 TEST_F(DenseUnionBuilderTest, InferredType) {
   AppendInferred();
 
@@ -428,6 +462,42 @@ TEST_F(SparseUnionBuilderTest, Basics) {
   ASSERT_ARRAYS_EQUAL(*expected, *actual);
 }
 
+TEST_F(SparseUnionBuilderTest, AppendValues) {
+  union_builder.reset(new SparseUnionBuilder(
+      default_memory_pool(), {i8_builder, str_builder, dbl_builder},
+      union_({field("i8", int8()), field("str", utf8()), field("dbl", float64())},
+             {I8, STR, DBL}, UnionMode::SPARSE)));
+
+  std::vector<int8_t> type_ids = {I8, STR, DBL, I8};
+  std::vector<uint8_t> is_valid = {1, 1, 0, 1};
+  ASSERT_OK(union_builder->AppendValues(type_ids.data(), type_ids.size(),
+                                        is_valid.data()));
+  ASSERT_GE(i8_builder->capacity(), 4);
+  ASSERT_GE(str_builder->capacity(), 4);
+  ASSERT_GE(dbl_builder->capacity(), 4);
+  ASSERT_OK(i8_builder->AppendValues({33, 0, 0, -10}, {true, false, false, true}));
+  std::vector<uint8_t> str_is_valid = {0, 1, 0, 0};
+  ASSERT_OK(str_builder->AppendValues({"", "abc", "", ""}, str_is_valid.data()));
+  ASSERT_OK(dbl_builder->AppendNulls(4));
+  ASSERT_OK(union_builder->Finish(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  expected_types_vector.assign(type_ids.begin(), type_ids.end());
+  ArrayFromVector<Int8Type, uint8_t>(expected_types_vector, &expected_types);
+
+  auto expected_i8 = ArrayFromJSON(int8(), "[33, null, null, -10]");
+  auto expected_str = ArrayFromJSON(utf8(), R"([null, "abc", null, null])");
+  auto expected_dbl = ArrayFromJSON(float64(), "[null, null, null, null]");
+
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(UnionArray::MakeSparse(*expected_types,
+                                   {expected_i8, expected_str, expected_dbl},
+                                   {"i8", "str", "dbl"}, {I8, STR, DBL}, &expected));
+  ASSERT_EQ(1, actual->null_count());
+  ASSERT_TRUE(actual->IsNull(2));
+  AssertArraysEqual(*expected->Slice(0, 2), *actual->Slice(0, 2));
+  AssertArraysEqual(*expected->Slice(3), *actual->Slice(3));
+}
+
 TEST_F(SparseUnionBuilderTest, InferredType) {
   AppendInferred();
 
@@ -237,6 +237,12 @@ class TypedBufferBuilder<
     return bytes_builder_.Advance(length * sizeof(T));
   }
 
+  /// \brief Advance over elements written directly through mutable_data(),
+  /// which must have been reserved
+  void UnsafeAdvance(const int64_t length) {
+    bytes_builder_.UnsafeAdvance(length * sizeof(T));
+  }
+
   Status Finish(std::shared_ptr<Buffer>* out, bool shrink_to_fit = true) {
     return bytes_builder_.Finish(out, shrink_to_fit);
   }
@@ -277,6 +283,12 @@ class TypedBufferBuilder<bool> {
     return Status::OK();
   }
 
+  Status Append(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    ARROW_RETURN_NOT_OK(Reserve(num_elements));
+    UnsafeAppend(bitmap, offset, num_elements);
+    return Status::OK();
+  }
+
   void UnsafeAppend(bool value) {
     BitUtil::SetBitTo(mutable_data(), bit_length_, value);
     if (!value) {
@@ -287,12 +299,16 @@ class TypedBufferBuilder<bool> {
 
   void UnsafeAppend(const uint8_t* bytes, int64_t num_elements) {
     if (num_elements == 0) return;
-    int64_t i = 0;
-    internal::GenerateBitsUnrolled(mutable_data(), bit_length_, num_elements, [&] {
-      bool value = bytes[i++];
-      false_count_ += !value;
-      return value;
-    });
+    false_count_ +=
+        internal::PackBytesToBitmap(bytes, num_elements, mutable_data(), bit_length_);
+    bit_length_ += num_elements;
+  }
+
+  /// \brief Append 'num_elements' bits of a packed bitmap, starting at bit 'offset'
+  void UnsafeAppend(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    if (num_elements == 0) return;
+    internal::CopyBitmap(bitmap, offset, num_elements, mutable_data(), bit_length_);
+    false_count_ += num_elements - internal::CountSetBits(bitmap, offset, num_elements);
     bit_length_ += num_elements;
   }
 
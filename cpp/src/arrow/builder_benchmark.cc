@@ -71,6 +71,26 @@ static void BuildIntArrayNoNulls(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
 }
 
+static void BuildIntArrayWithNullsBitmap(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // Every eighth value is null
+  std::vector<uint8_t> bitmap(BitUtil::BytesForBits(kNumberOfElements), 0x7F);
+
+  for (auto _ : state) {
+    Int64Builder builder;
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(
+          builder.AppendValues(kData.data(), kData.size(), bitmap.data(), /*offset=*/0));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+}
+
 static void BuildAdaptiveIntNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
   for (auto _ : state) {
@@ -140,6 +160,32 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
 }
 
+static void BuildBinaryArrayFromOffsets(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t value_length = static_cast<int32_t>(kBinaryView.size());
+  std::vector<int32_t> offsets(kNumberOfElements + 1);
+  std::string data;
+  for (int64_t i = 0; i < kNumberOfElements; i++) {
+    offsets[i] = static_cast<int32_t>(i) * value_length;
+    data.append(kBinaryView.data(), kBinaryView.size());
+  }
+  offsets[kNumberOfElements] = kNumberOfElements * value_length;
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+  for (auto _ : state) {
+    BinaryBuilder builder;
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(offsets.data(), raw_data, kNumberOfElements));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+}
+
 static void BuildChunkedBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   // 1MB chunks
@@ -446,10 +492,12 @@ BENCHMARK(ReferenceBuildVectorNoNulls);
 BENCHMARK(BuildBooleanArrayNoNulls);
 
 BENCHMARK(BuildIntArrayNoNulls);
+BENCHMARK(BuildIntArrayWithNullsBitmap);
 BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
+BENCHMARK(BuildBinaryArrayFromOffsets);
 BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
@@ -19,6 +19,7 @@
 
 #include "arrow/compare.h"
 
+#include <algorithm>
 #include <climits>
 #include <cmath>
 #include <cstdint>
@@ -49,6 +50,7 @@ namespace arrow {
 
 using internal::BitmapEquals;
 using internal::checked_cast;
+using internal::LoadBitmapWord;
 
 // ----------------------------------------------------------------------
 // Public method implementations
@@ -58,6 +60,26 @@ namespace internal {
 // These helper functions assume we already checked the arrays have equal
 // sizes and null bitmaps.
 
+// Values are compared in blocks of kEqualsBlockSize, without branching
+// inside a block so that the compiler can vectorize the loop.
+static constexpr int64_t kEqualsBlockSize = 256;
+
+template <typename T, typename EqualityFunc>
+inline bool BlockFloatingEquals(const T* left, const T* right, int64_t length,
+                                EqualityFunc&& equals) {
+  for (int64_t i = 0; i < length; i += kEqualsBlockSize) {
+    const int64_t block_length = std::min(kEqualsBlockSize, length - i);
+    uint8_t all_equal = 1;
+    for (int64_t j = 0; j < block_length; ++j) {
+      all_equal &= static_cast<uint8_t>(equals(left[i + j], right[i + j]));
+    }
+    if (!all_equal) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename ArrowType, typename EqualityFunc>
 inline bool BaseFloatingEquals(const NumericArray<ArrowType>& left,
                                const NumericArray<ArrowType>& right,
@@ -67,21 +89,19 @@ inline bool BaseFloatingEquals(const NumericArray<ArrowType>& left,
   const T* left_data = left.raw_values();
   const T* right_data = right.raw_values();
 
-  if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (left.IsNull(i)) continue;
-      if (!equals(left_data[i], right_data[i])) {
-        return false;
-      }
-    }
-  } else {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (!equals(left_data[i], right_data[i])) {
-        return false;
-      }
-    }
-  }
-  return true;
+  if (left.null_count() == 0) {
+    return BlockFloatingEquals(left_data, right_data, left.length(), equals);
+  }
+  // The null bitmaps are equal: only the runs of valid values are compared
+  bool all_equal = true;
+  internal::VisitSetBitRuns(
+      left.null_bitmap_data(), left.offset(), left.length(),
+      [&](int64_t position, int64_t length) {
+        all_equal = all_equal && BlockFloatingEquals(left_data + position,
+                                                     right_data + position, length,
+                                                     equals);
+      });
+  return all_equal;
 }
 
 template <typename ArrowType>
@@ -414,19 +434,16 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
     }
     return true;
   } else if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
-    }
-    return true;
+    // The null bitmaps are equal: only the runs of valid values are compared
+    bool all_equal = true;
+    internal::VisitSetBitRuns(
+        left.null_bitmap_data(), left.offset(), left.length(),
+        [&](int64_t position, int64_t length) {
+          all_equal = all_equal && memcmp(left_data + position * byte_width,
+                                          right_data + position * byte_width,
+                                          static_cast<size_t>(length * byte_width)) == 0;
+        });
+    return all_equal;
   } else {
     auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
@@ -453,12 +470,17 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     const auto& right = checked_cast<const BooleanArray&>(right_);
 
     if (left.null_count() > 0) {
+      // Compare 64 values at a time, masking the bits of nulls
       const uint8_t* left_data = left.values()->data();
       const uint8_t* right_data = right.values()->data();
-
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
-                                   BitUtil::GetBit(right_data, i + right.offset())) {
+      const uint8_t* validity = left.null_bitmap_data();
+
+      for (int64_t i = 0; i < left.length(); i += 64) {
+        const int64_t num_bits = std::min<int64_t>(64, left.length() - i);
+        const uint64_t differences =
+            LoadBitmapWord(left_data, left.offset() + i, num_bits) ^
+            LoadBitmapWord(right_data, right.offset() + i, num_bits);
+        if (differences & LoadBitmapWord(validity, left.offset() + i, num_bits)) {
           result_ = false;
           return Status::OK();
         }
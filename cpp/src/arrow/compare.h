@@ -70,11 +70,24 @@ class EqualOptions {
     return res;
   }
 
+  /// Whether ChunkedArray::Equals and Table::Equals may compare ranges of
+  /// their chunks in parallel on the CPU thread pool.  No diff is formatted
+  /// for such comparisons.
+  bool use_threads() const { return use_threads_; }
+
+  /// Return a new EqualOptions object with the "use_threads" property changed.
+  EqualOptions use_threads(bool v) const {
+    auto res = EqualOptions(*this);
+    res.use_threads_ = v;
+    return res;
+  }
+
   static EqualOptions Defaults() { return EqualOptions(); }
 
  protected:
   double atol_ = kDefaultAbsoluteTolerance;
   bool nans_equal_ = false;
+  bool use_threads_ = false;
   std::ostream* diff_sink_ = NULLPTR;
 };
 
@@ -21,15 +21,21 @@
 #include "arrow/compute/context.h"  // IWYU pragma: export
 #include "arrow/compute/kernel.h"   // IWYU pragma: export
 
+#include "arrow/compute/kernels/arithmetic.h"       // IWYU pragma: export
 #include "arrow/compute/kernels/boolean.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/cast.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/compare.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/count.h"            // IWYU pragma: export
 #include "arrow/compute/kernels/filter.h"           // IWYU pragma: export
+#include "arrow/compute/kernels/group_by.h"         // IWYU pragma: export
 #include "arrow/compute/kernels/hash.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/hash_join.h"        // IWYU pragma: export
 #include "arrow/compute/kernels/isin.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/merge_sorted.h"     // IWYU pragma: export
+#include "arrow/compute/kernels/pipeline.h"         // IWYU pragma: export
 #include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/string.h"           // IWYU pragma: export
 #include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
 #include "arrow/compute/kernels/take.h"             // IWYU pragma: export
 
@@ -37,6 +37,7 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/test_util.h"
 
@@ -91,5 +92,79 @@ TEST_F(TestInvokeBinaryKernel, Exceptions) {
                                                          a1->Slice(1), &outputs));
 }
 
+// ----------------------------------------------------------------------
+// FunctionContext
+
+TEST(TestFunctionContext, RecycleBuffers) {
+  FunctionContext ctx;
+  ASSERT_FALSE(ctx.recycle_buffers());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(ctx.Allocate(100, &buffer));
+  ASSERT_EQ(0, ctx.num_recycled_buffers());
+
+  ctx.set_recycle_buffers(true);
+  ASSERT_OK(ctx.Allocate(100, &buffer));
+  ASSERT_EQ(1, ctx.num_recycled_buffers());
+  const uint8_t* data = buffer->data();
+
+  // Still in use
+  std::shared_ptr<Buffer> other;
+  ASSERT_OK(ctx.Allocate(50, &other));
+  ASSERT_NE(data, other->data());
+  ASSERT_EQ(2, ctx.num_recycled_buffers());
+
+  // Released buffers are handed out again, resized
+  buffer.reset();
+  ASSERT_OK(ctx.Allocate(80, &buffer));
+  ASSERT_EQ(data, buffer->data());
+  ASSERT_EQ(80, buffer->size());
+  ASSERT_EQ(2, ctx.num_recycled_buffers());
+
+  // A free buffer too small is not reused
+  other.reset();
+  std::shared_ptr<Buffer> large;
+  ASSERT_OK(ctx.Allocate(1000, &large));
+  ASSERT_EQ(3, ctx.num_recycled_buffers());
+
+  ctx.ReleaseUnusedBuffers();
+  ASSERT_EQ(2, ctx.num_recycled_buffers());
+  ctx.set_recycle_buffers(false);
+  ASSERT_EQ(0, ctx.num_recycled_buffers());
+  ASSERT_EQ(80, buffer->size());
+}
+
+TEST(TestFunctionContext, ReuseOutputAcrossBatches) {
+  FunctionContext ctx;
+  ctx.set_recycle_buffers(true);
+  std::shared_ptr<UnaryKernel> kernel;
+  ASSERT_OK(MakeUnaryArithmeticKernel(UnaryArithmeticOperator::NEGATE, int32(),
+                                      ArithmeticOptions(), &kernel));
+  detail::PrimitiveAllocatingUnaryKernel allocating(kernel.get());
+
+  auto first = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3}, {});
+  auto second = _MakeArray<Int32Type, int32_t>(int32(), {4, 5, 6}, {});
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {-4, -5, -6}, {});
+
+  // The output of the previous batch is released before the next one
+  const uint8_t* data;
+  {
+    Datum out(ArrayData::Make(int32(), 3));
+    ASSERT_OK(allocating.Call(&ctx, first, &out));
+    data = out.array()->buffers[1]->data();
+  }
+  Datum out(ArrayData::Make(int32(), 3));
+  ASSERT_OK(allocating.Call(&ctx, second, &out));
+  ASSERT_EQ(data, out.array()->buffers[1]->data());
+  AssertArraysEqual(*expected, *out.make_array());
+
+  // A preallocated output buffer is written into directly
+  std::shared_ptr<Buffer> values;
+  ASSERT_OK(AllocateBuffer(sizeof(int32_t) * 3, &values));
+  out = ArrayData::Make(int32(), 3, {nullptr, values});
+  ASSERT_OK(allocating.Call(&ctx, second, &out));
+  ASSERT_EQ(values.get(), out.array()->buffers[1].get());
+  AssertArraysEqual(*expected, *out.make_array());
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,7 +17,9 @@
 
 #include "arrow/compute/context.h"
 
+#include <algorithm>
 #include <memory>
+#include <utility>
 
 #include "arrow/buffer.h"
 #include "arrow/util/cpu_info.h"
@@ -30,8 +32,57 @@ FunctionContext::FunctionContext(MemoryPool* pool)
 
 MemoryPool* FunctionContext::memory_pool() const { return pool_; }
 
+// Bounds the number of buffers kept by a context, which are scanned linearly
+static constexpr size_t kMaxRecycledBuffers = 64;
+
 Status FunctionContext::Allocate(const int64_t nbytes, std::shared_ptr<Buffer>* out) {
-  return AllocateBuffer(pool_, nbytes, out);
+  if (!recycle_buffers_) {
+    return AllocateBuffer(pool_, nbytes, out);
+  }
+
+  // A buffer is free once the context holds the only reference to it. The
+  // smallest free buffer large enough is reused.
+  std::shared_ptr<ResizableBuffer>* best = nullptr;
+  for (auto& buffer : recycled_buffers_) {
+    if (buffer.use_count() == 1 && buffer->capacity() >= nbytes &&
+        (best == nullptr || buffer->capacity() < (*best)->capacity())) {
+      best = &buffer;
+    }
+  }
+  if (best != nullptr) {
+    RETURN_NOT_OK((*best)->Resize(nbytes, /*shrink_to_fit=*/false));
+    *out = *best;
+    return Status::OK();
+  }
+
+  if (recycled_buffers_.size() >= kMaxRecycledBuffers) {
+    // The free buffers are all too small for this allocation
+    ReleaseUnusedBuffers();
+  }
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+  if (recycled_buffers_.size() < kMaxRecycledBuffers) {
+    recycled_buffers_.push_back(buffer);
+  }
+  *out = std::move(buffer);
+  return Status::OK();
+}
+
+void FunctionContext::set_recycle_buffers(bool recycle_buffers) {
+  recycle_buffers_ = recycle_buffers;
+  if (!recycle_buffers_) {
+    // Buffers still in use are freed once released by their users
+    recycled_buffers_.clear();
+  }
+}
+
+void FunctionContext::ReleaseUnusedBuffers() {
+  recycled_buffers_.erase(
+      std::remove_if(recycled_buffers_.begin(), recycled_buffers_.end(),
+                     [](const std::shared_ptr<ResizableBuffer>& buffer) {
+                       return buffer.use_count() == 1;
+                     }),
+      recycled_buffers_.end());
 }
 
 void FunctionContext::SetStatus(const Status& status) {
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -29,6 +30,7 @@
 namespace arrow {
 
 class Buffer;
+class ResizableBuffer;
 
 namespace internal {
 class CpuInfo;
@@ -50,6 +52,9 @@ class ARROW_EXPORT FunctionContext {
   MemoryPool* memory_pool() const;
 
   /// \brief Allocate buffer from the context's memory pool
+  ///
+  /// If recycle_buffers() is set, a previously allocated buffer may be handed
+  /// out again instead; its contents are undefined.
   Status Allocate(const int64_t nbytes, std::shared_ptr<Buffer>* out);
 
   /// \brief Indicate that an error has occurred, to be checked by a parent caller
@@ -70,10 +75,47 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Return true if kernels may process independent columns or chunks
+  /// in parallel on the CPU thread pool
+  ///
+  /// Off by default: the parallel kernels wait for their tasks, so enabling it
+  /// from a task already running on the CPU thread pool can exhaust the pool.
+  /// Parallel tasks are given their own FunctionContext on the same memory
+  /// pool, since a FunctionContext's status is not thread-safe.
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief Set whether kernels may run in parallel, see use_threads()
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
+  /// \brief Return true if buffers allocated through Allocate() are recycled
+  ///
+  /// The context then keeps a reference to the buffers it allocates. Once all
+  /// other references to one of them are gone (e.g. the output of a kernel
+  /// for the previous batch of a stream was consumed and released), Allocate()
+  /// hands it out again instead of allocating from the memory pool. Off by
+  /// default, since the recycled buffers stay allocated as long as the context.
+  bool recycle_buffers() const { return recycle_buffers_; }
+
+  /// \brief Set whether buffers are recycled, see recycle_buffers()
+  ///
+  /// Disabling recycling releases the buffers not in use.
+  void set_recycle_buffers(bool recycle_buffers);
+
+  /// \brief Release the recycled buffers not currently in use
+  void ReleaseUnusedBuffers();
+
+  /// \brief The number of buffers currently kept for recycling
+  int64_t num_recycled_buffers() const {
+    return static_cast<int64_t>(recycled_buffers_.size());
+  }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_ = false;
+  bool recycle_buffers_ = false;
+  std::vector<std::shared_ptr<ResizableBuffer>> recycled_buffers_;
 };
 
 }  // namespace compute
@@ -16,17 +16,34 @@
 // under the License.
 
 #include "arrow/compute/kernels/add.h"
+
+#include <type_traits>
+
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type_traits.h"
 
 namespace arrow {
 namespace compute {
 
+// Values in null slots are added too, so integers must wrap around on overflow
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> WrappingAdd(T left, T right) {
+  using Unsigned = typename std::make_unsigned<T>::type;
+  return static_cast<T>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> WrappingAdd(T left, T right) {
+  return left + right;
+}
+
 template <typename ArrowType>
 class AddKernelImpl : public AddKernel {
  private:
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename ArrowType::c_type;
   std::shared_ptr<DataType> result_type_;
 
   Status Add(FunctionContext* ctx, const std::shared_ptr<ArrayType>& lhs,
@@ -43,6 +60,19 @@ class AddKernelImpl : public AddKernel {
     return builder.Finish(result);
   }
 
+  // Add into the preallocated data buffer of out
+  Status AddInto(FunctionContext* ctx, const ArrayData& lhs, const ArrayData& rhs,
+                 ArrayData* out) {
+    RETURN_NOT_OK(detail::AssignNullIntersection(ctx, lhs, rhs, out));
+    const CType* left = lhs.GetValues<CType>(1);
+    const CType* right = rhs.GetValues<CType>(1);
+    CType* values = out->GetMutableValues<CType>(1);
+    for (int64_t i = 0; i < lhs.length; i++) {
+      values[i] = WrappingAdd(left[i], right[i]);
+    }
+    return Status::OK();
+  }
+
  public:
   explicit AddKernelImpl(std::shared_ptr<DataType> result_type)
       : result_type_(result_type) {}
@@ -55,6 +85,11 @@ class AddKernelImpl : public AddKernel {
     if (lhs.length() != rhs.length()) {
       return Status::Invalid("AddKernel expects arrays with the same length");
     }
+    if (out->kind() == Datum::ARRAY) {
+      // The output data buffer was preallocated, see
+      // detail::PrimitiveAllocatingBinaryKernel
+      return AddInto(ctx, *lhs.array(), *rhs.array(), out->array().get());
+    }
     auto lhs_array = lhs.make_array();
     auto rhs_array = rhs.make_array();
     std::shared_ptr<Array> result;
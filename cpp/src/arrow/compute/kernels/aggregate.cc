@@ -15,10 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 
 namespace arrow {
 namespace compute {
@@ -49,14 +53,51 @@ class ManagedAggregateState {
   std::shared_ptr<Buffer> state_;
 };
 
+// Chunks are consumed in slices of at most this many values, each into its own
+// state, which are then merged in order. The result (e.g. the rounding of a
+// floating point sum) therefore doesn't depend on whether slices are consumed
+// in parallel.
+static constexpr int64_t kAggregateSliceLength = 1 << 20;
+
 Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
-  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+  ArrayVector chunks;
+  if (input.is_array()) {
+    chunks.push_back(input.make_array());
+  } else if (input.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = input.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
+
+  ArrayVector slices;
+  for (const auto& chunk : chunks) {
+    for (int64_t offset = 0; offset < chunk->length(); offset += kAggregateSliceLength) {
+      slices.push_back(chunk->Slice(offset, kAggregateSliceLength));
+    }
+  }
 
   auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
   if (!state) return Status::OutOfMemory("AggregateState allocation failed");
 
-  auto array = input.make_array();
-  RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
+  if (slices.size() == 1) {
+    RETURN_NOT_OK(aggregate_function_->Consume(*slices[0], state->mutable_data()));
+  } else {
+    std::vector<std::shared_ptr<ManagedAggregateState>> slice_states(slices.size());
+    RETURN_NOT_OK(detail::ParallelForEach(
+        ctx, static_cast<int>(slices.size()), [&](FunctionContext* task_ctx, int i) {
+          slice_states[i] =
+              ManagedAggregateState::Make(aggregate_function_, task_ctx->memory_pool());
+          if (!slice_states[i]) {
+            return Status::OutOfMemory("AggregateState allocation failed");
+          }
+          return aggregate_function_->Consume(*slices[i],
+                                              slice_states[i]->mutable_data());
+        }));
+    for (const auto& slice_state : slice_states) {
+      RETURN_NOT_OK(
+          aggregate_function_->Merge(slice_state->mutable_data(), state->mutable_data()));
+    }
+  }
   RETURN_NOT_OK(aggregate_function_->Finalize(state->mutable_data(), out));
 
   return Status::OK();
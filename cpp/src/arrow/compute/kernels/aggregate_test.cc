@@ -19,10 +19,12 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
@@ -30,6 +32,7 @@
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
@@ -154,7 +157,7 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
     ValidateSum<TypeParam>(&this->ctx_, *slice);
   }
 
-  // Trigger ConsumeSparse with different slice offsets.
+  // Trigger partially valid blocks with different slice offsets.
   auto rand = random::RandomArrayGenerator(0xfa432643);
   const int64_t length = 1U << 6;
   auto array = rand.Numeric<TypeParam>(length, 0, 10, 0.5);
@@ -166,6 +169,39 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
   }
 }
 
+TYPED_TEST(TestRandomNumericSumKernel, RandomChunkedArraySum) {
+  auto rand = random::RandomArrayGenerator(0x3819be1);
+  // The first chunk is consumed in several slices
+  auto array = rand.Numeric<TypeParam>((1 << 20) + 1100, 0, 100, 0.1);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, (1 << 20) + 100), array->Slice((1 << 20) + 100, 7),
+                  array->Slice((1 << 20) + 107)});
+
+  Datum expected = NaiveSum<TypeParam>(*array);
+  for (const bool use_threads : {false, true}) {
+    this->ctx_.set_use_threads(use_threads);
+    Datum result;
+    ASSERT_OK(Sum(&this->ctx_, chunked, &result));
+    DatumEqual<typename FindAccumulatorType<TypeParam>::Type>::EnsureEqual(result,
+                                                                            expected);
+  }
+}
+
+TEST(TestSumKernel, PairwiseSummation) {
+  // A running sum would lose every small value added to 1
+  const int64_t length = 1 << 20;
+  std::vector<double> values(length, 1e-16);
+  values[0] = 1;
+  std::shared_ptr<Array> array;
+  ArrayFromVector<DoubleType>(values, &array);
+
+  FunctionContext ctx;
+  Datum result;
+  ASSERT_OK(Sum(&ctx, *array, &result));
+  auto sum = checked_pointer_cast<DoubleScalar>(result.scalar());
+  ASSERT_NEAR(1 + (length - 1) * 1e-16, sum->value, 1e-14);
+}
+
 ///
 /// Mean
 ///
@@ -244,6 +280,18 @@ TYPED_TEST(TestRandomNumericMeanKernel, RandomArrayMean) {
   }
 }
 
+TYPED_TEST(TestRandomNumericMeanKernel, RandomChunkedArrayMean) {
+  auto rand = random::RandomArrayGenerator(0x7aa3cd1);
+  auto array = rand.Numeric<TypeParam>(5000, 0, 100, 0.1);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 1000), array->Slice(1000, 0), array->Slice(1000)});
+
+  this->ctx_.set_use_threads(true);
+  Datum result;
+  ASSERT_OK(Mean(&this->ctx_, chunked, &result));
+  DatumEqual<DoubleType>::EnsureEqual(result, NaiveMean<TypeParam>(*array));
+}
+
 ///
 /// Count
 ///
@@ -364,5 +412,22 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIs("[5, -Inf, 2, 3, 4]", -INFINITY, 5, options);
 }
 
+TYPED_TEST(TestNumericMinMaxKernel, ChunkedArray) {
+  using c_type = typename TypeParam::c_type;
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+
+  std::shared_ptr<Array> a, b, c;
+  ArrayFromVector<TypeParam, c_type>({true, false, true}, {5, 1, 9}, &a);
+  ArrayFromVector<TypeParam, c_type>({}, &b);
+  ArrayFromVector<TypeParam, c_type>({3, 7}, &c);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{a, b, c});
+
+  this->ctx_.set_use_threads(true);
+  Datum out;
+  ASSERT_OK(MinMax(&this->ctx_, MinMaxOptions(), chunked, &out));
+  ASSERT_EQ(3, checked_pointer_cast<ScalarType>(out.collection()[0].scalar())->value);
+  ASSERT_EQ(9, checked_pointer_cast<ScalarType>(out.collection()[1].scalar())->value);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,551 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// Unsigned type in which to compute wrapping integer arithmetic: narrower
+// unsigned types would be promoted to (signed) int, which may overflow
+template <typename T>
+using WrappingType =
+    typename std::conditional<sizeof(T) < sizeof(unsigned), unsigned,
+                              typename std::make_unsigned<T>::type>::type;
+
+template <typename T>
+T WrapAround(WrappingType<T> value) {
+  return static_cast<T>(value);
+}
+
+template <typename T>
+WrappingType<T> AsWrapping(T value) {
+  using Unsigned = typename std::make_unsigned<T>::type;
+  return static_cast<WrappingType<T>>(static_cast<Unsigned>(value));
+}
+
+// Each operator implements, for integers,
+//   bool Wrapping(T left, T right, T* out)
+//   bool Checked(T left, T right, T* out)
+// returning true if the result is invalid, and for floating point numbers
+//   T Float(T left, T right)
+//
+// Wrapping() is only expected to fail for errors which are always reported,
+// such as an integer division by zero; Checked() also reports overflows.
+
+Status Overflow() { return Status::Invalid("overflow"); }
+
+struct AddOp {
+  template <typename T>
+  static bool Wrapping(T left, T right, T* out) {
+    *out = WrapAround<T>(AsWrapping(left) + AsWrapping(right));
+    return false;
+  }
+
+  template <typename T>
+  static bool Checked(T left, T right, T* out) {
+    return internal::AddWithOverflow(left, right, out);
+  }
+
+  template <typename T>
+  static T Float(T left, T right) {
+    return left + right;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return Overflow();
+  }
+};
+
+struct SubtractOp {
+  template <typename T>
+  static bool Wrapping(T left, T right, T* out) {
+    *out = WrapAround<T>(AsWrapping(left) - AsWrapping(right));
+    return false;
+  }
+
+  template <typename T>
+  static bool Checked(T left, T right, T* out) {
+    return internal::SubtractWithOverflow(left, right, out);
+  }
+
+  template <typename T>
+  static T Float(T left, T right) {
+    return left - right;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return Overflow();
+  }
+};
+
+struct MultiplyOp {
+  template <typename T>
+  static bool Wrapping(T left, T right, T* out) {
+    *out = WrapAround<T>(AsWrapping(left) * AsWrapping(right));
+    return false;
+  }
+
+  template <typename T>
+  static bool Checked(T left, T right, T* out) {
+    return internal::MultiplyWithOverflow(left, right, out);
+  }
+
+  template <typename T>
+  static T Float(T left, T right) {
+    return left * right;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return Overflow();
+  }
+};
+
+struct DivideOp {
+  template <typename T>
+  static bool Wrapping(T left, T right, T* out) {
+    if (ARROW_PREDICT_FALSE(right == 0)) {
+      *out = 0;
+      return true;
+    }
+    if (std::is_signed<T>::value && ARROW_PREDICT_FALSE(IsOverflow(left, right))) {
+      // The quotient wraps around to the dividend
+      *out = left;
+      return false;
+    }
+    *out = static_cast<T>(left / right);
+    return false;
+  }
+
+  template <typename T>
+  static bool Checked(T left, T right, T* out) {
+    if (std::is_signed<T>::value && ARROW_PREDICT_FALSE(IsOverflow(left, right))) {
+      *out = left;
+      return true;
+    }
+    return Wrapping(left, right, out);
+  }
+
+  template <typename T>
+  static T Float(T left, T right) {
+    return left / right;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return right == 0 ? Status::Invalid("divide by zero") : Overflow();
+  }
+
+  template <typename T>
+  static bool IsOverflow(T left, T right) {
+    return left == std::numeric_limits<T>::min() && right == static_cast<T>(-1);
+  }
+};
+
+struct NegateOp {
+  template <typename T>
+  static bool Wrapping(T value, T* out) {
+    *out = WrapAround<T>(AsWrapping(T(0)) - AsWrapping(value));
+    return false;
+  }
+
+  template <typename T>
+  static bool Checked(T value, T* out) {
+    return internal::SubtractWithOverflow(T(0), value, out);
+  }
+
+  template <typename T>
+  static T Float(T value) {
+    return -value;
+  }
+};
+
+struct AbsOp {
+  template <typename T>
+  static enable_if_t<std::is_signed<T>::value, bool> Wrapping(T value, T* out) {
+    *out = value < 0 ? WrapAround<T>(AsWrapping(T(0)) - AsWrapping(value)) : value;
+    return false;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_unsigned<T>::value, bool> Wrapping(T value, T* out) {
+    *out = value;
+    return false;
+  }
+
+  template <typename T>
+  static bool Checked(T value, T* out) {
+    Wrapping(value, out);
+    return std::is_signed<T>::value && value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static T Float(T value) {
+    return std::fabs(value);
+  }
+};
+
+template <typename Op, bool kChecked, typename T>
+enable_if_t<std::is_integral<T>::value, bool> Apply(T left, T right, T* out) {
+  return kChecked ? Op::Checked(left, right, out) : Op::Wrapping(left, right, out);
+}
+
+template <typename Op, bool kChecked, typename T>
+enable_if_t<std::is_floating_point<T>::value, bool> Apply(T left, T right, T* out) {
+  *out = Op::Float(left, right);
+  return false;
+}
+
+template <typename Op, bool kChecked, typename T>
+enable_if_t<std::is_integral<T>::value, bool> Apply(T value, T* out) {
+  return kChecked ? Op::Checked(value, out) : Op::Wrapping(value, out);
+}
+
+template <typename Op, bool kChecked, typename T>
+enable_if_t<std::is_floating_point<T>::value, bool> Apply(T value, T* out) {
+  *out = Op::Float(value);
+  return false;
+}
+
+template <typename T>
+struct ArrayValues {
+  T operator[](int64_t i) const { return values[i]; }
+  const T* values;
+};
+
+template <typename T>
+struct ScalarValue {
+  T operator[](int64_t) const { return value; }
+  T value;
+};
+
+// Whether slot i of out (written at offset 0) is valid
+bool IsValid(const ArrayData& out, int64_t i) {
+  return out.null_count == 0 || BitUtil::GetBit(out.buffers[0]->data(), i);
+}
+
+// The loop is branch-free unless the operator can fail, so that it can be
+// vectorized by the compiler. Failures are accumulated and only attributed to
+// a valid slot afterwards, as values in null slots are computed too.
+template <typename Op, bool kChecked, typename T, typename Left, typename Right>
+Status ApplyBinary(const Left& left, const Right& right, ArrayData* out) {
+  T* values = out->GetMutableValues<T>(1);
+  bool invalid = false;
+  for (int64_t i = 0; i < out->length; ++i) {
+    invalid |= Apply<Op, kChecked>(left[i], right[i], &values[i]);
+  }
+  if (ARROW_PREDICT_FALSE(invalid)) {
+    T unused;
+    for (int64_t i = 0; i < out->length; ++i) {
+      if (IsValid(*out, i) && Apply<Op, kChecked>(left[i], right[i], &unused)) {
+        return Op::Error(left[i], right[i]);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status SetAllNullValues(FunctionContext* ctx, const ArrayData& array, ArrayData* out) {
+  RETURN_NOT_OK(detail::SetAllNulls(ctx, array, out));
+  std::memset(out->buffers[1]->mutable_data(), 0, out->buffers[1]->size());
+  return Status::OK();
+}
+
+template <typename ArrowType, typename Op, bool kChecked>
+class ArithmeticKernel final : public BinaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  explicit ArithmeticKernel(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out_datum) override {
+    ArrayData* out = out_datum->array().get();
+
+    if (left.is_array() && right.is_array()) {
+      const ArrayData& left_array = *left.array();
+      const ArrayData& right_array = *right.array();
+      RETURN_NOT_OK(detail::AssignNullIntersection(ctx, left_array, right_array, out));
+      return ApplyBinary<Op, kChecked, T>(ArrayValues<T>{left_array.GetValues<T>(1)},
+                                          ArrayValues<T>{right_array.GetValues<T>(1)},
+                                          out);
+    }
+
+    if (left.is_array() && right.is_scalar()) {
+      const ArrayData& left_array = *left.array();
+      const auto& right_scalar = checked_cast<const ScalarType&>(*right.scalar());
+      if (!right_scalar.is_valid) {
+        return SetAllNullValues(ctx, left_array, out);
+      }
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_array, out));
+      return ApplyBinary<Op, kChecked, T>(ArrayValues<T>{left_array.GetValues<T>(1)},
+                                          ScalarValue<T>{right_scalar.value}, out);
+    }
+
+    if (left.is_scalar() && right.is_array()) {
+      const auto& left_scalar = checked_cast<const ScalarType&>(*left.scalar());
+      const ArrayData& right_array = *right.array();
+      if (!left_scalar.is_valid) {
+        return SetAllNullValues(ctx, right_array, out);
+      }
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, right_array, out));
+      return ApplyBinary<Op, kChecked, T>(ScalarValue<T>{left_scalar.value},
+                                          ArrayValues<T>{right_array.GetValues<T>(1)},
+                                          out);
+    }
+
+    return Status::Invalid("Invalid datum signature for ArithmeticKernel::Call");
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+template <typename ArrowType, typename Op, bool kChecked>
+class UnaryArithmeticKernel final : public UnaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+
+  explicit UnaryArithmeticKernel(std::shared_ptr<DataType> type)
+      : type_(std::move(type)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    if (!input.is_array()) {
+      return Status::Invalid("UnaryArithmeticKernel expects array values");
+    }
+    const ArrayData& array = *input.array();
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out));
+
+    const T* in_values = array.GetValues<T>(1);
+    T* values = out->GetMutableValues<T>(1);
+    bool invalid = false;
+    for (int64_t i = 0; i < out->length; ++i) {
+      invalid |= Apply<Op, kChecked>(in_values[i], &values[i]);
+    }
+    if (ARROW_PREDICT_FALSE(invalid)) {
+      T unused;
+      for (int64_t i = 0; i < out->length; ++i) {
+        if (IsValid(*out, i) && Apply<Op, kChecked>(in_values[i], &unused)) {
+          return Overflow();
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+template <template <typename, typename, bool> class Kernel, typename Op,
+          typename KernelBase>
+Status MakeNumericKernel(const std::shared_ptr<DataType>& type, bool check_overflow,
+                         std::shared_ptr<KernelBase>* out) {
+  switch (type->id()) {
+#define NUMERIC_KERNEL_CASE(TYPE_CLASS)                               \
+  case TYPE_CLASS::type_id:                                           \
+    if (check_overflow) {                                             \
+      *out = std::make_shared<Kernel<TYPE_CLASS, Op, true>>(type);    \
+    } else {                                                          \
+      *out = std::make_shared<Kernel<TYPE_CLASS, Op, false>>(type);   \
+    }                                                                 \
+    return Status::OK();
+
+    NUMERIC_KERNEL_CASE(UInt8Type)
+    NUMERIC_KERNEL_CASE(Int8Type)
+    NUMERIC_KERNEL_CASE(UInt16Type)
+    NUMERIC_KERNEL_CASE(Int16Type)
+    NUMERIC_KERNEL_CASE(UInt32Type)
+    NUMERIC_KERNEL_CASE(Int32Type)
+    NUMERIC_KERNEL_CASE(UInt64Type)
+    NUMERIC_KERNEL_CASE(Int64Type)
+    NUMERIC_KERNEL_CASE(FloatType)
+    NUMERIC_KERNEL_CASE(DoubleType)
+
+#undef NUMERIC_KERNEL_CASE
+
+    default:
+      break;
+  }
+  return Status::NotImplemented("Arithmetic operations on ", *type, " arrays");
+}
+
+// Apply kernel between each chunk of array and scalar, in this order if
+// scalar_is_right
+Status InvokeWithScalar(FunctionContext* ctx, BinaryKernel* kernel, const Datum& array,
+                        const Datum& scalar, bool scalar_is_right, Datum* out) {
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (array.kind() == Datum::ARRAY) {
+    chunks.push_back(array.make_array());
+  } else if (array.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = array.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("Arithmetic operand was not array-like");
+  }
+
+  std::vector<Datum> results;
+  for (const auto& chunk : chunks) {
+    Datum result;
+    result.value = ArrayData::Make(kernel->out_type(), chunk->length());
+    if (scalar_is_right) {
+      RETURN_NOT_OK(kernel->Call(ctx, Datum(chunk), scalar, &result));
+    } else {
+      RETURN_NOT_OK(kernel->Call(ctx, scalar, Datum(chunk), &result));
+    }
+    results.push_back(std::move(result));
+  }
+  *out = detail::WrapDatumsLike(array, results);
+  return Status::OK();
+}
+
+Status ExecuteArithmetic(FunctionContext* ctx, ArithmeticOperator op, const Datum& left,
+                         const Datum& right, ArithmeticOptions options, Datum* out) {
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Arithmetic operands must have the same type, got ",
+                             *left.type(), " and ", *right.type());
+  }
+  std::shared_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(MakeArithmeticKernel(op, left.type(), options, &kernel));
+  detail::PrimitiveAllocatingBinaryKernel allocating(kernel.get());
+
+  if (left.is_scalar()) {
+    if (right.is_scalar()) {
+      return Status::Invalid("Invalid datum signature for arithmetic operation");
+    }
+    return InvokeWithScalar(ctx, &allocating, right, left, /*scalar_is_right=*/false,
+                            out);
+  }
+  if (right.is_scalar()) {
+    return InvokeWithScalar(ctx, &allocating, left, right, /*scalar_is_right=*/true, out);
+  }
+  return detail::InvokeBinaryArrayKernel(ctx, &allocating, left, right, out);
+}
+
+Status ExecuteUnaryArithmetic(FunctionContext* ctx, UnaryArithmeticOperator op,
+                              const Datum& value, ArithmeticOptions options,
+                              Datum* out) {
+  std::shared_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeUnaryArithmeticKernel(op, value.type(), options, &kernel));
+  detail::PrimitiveAllocatingUnaryKernel allocating(kernel.get());
+
+  std::vector<Datum> result;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &allocating, value, &result));
+  *out = detail::WrapDatumsLike(value, result);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status MakeArithmeticKernel(ArithmeticOperator op,
+                            const std::shared_ptr<DataType>& value_type,
+                            ArithmeticOptions options,
+                            std::shared_ptr<BinaryKernel>* out) {
+  const bool checked = options.check_overflow;
+  switch (op) {
+    case ArithmeticOperator::ADD:
+      return MakeNumericKernel<ArithmeticKernel, AddOp>(value_type, checked, out);
+    case ArithmeticOperator::SUBTRACT:
+      return MakeNumericKernel<ArithmeticKernel, SubtractOp>(value_type, checked, out);
+    case ArithmeticOperator::MULTIPLY:
+      return MakeNumericKernel<ArithmeticKernel, MultiplyOp>(value_type, checked, out);
+    case ArithmeticOperator::DIVIDE:
+      return MakeNumericKernel<ArithmeticKernel, DivideOp>(value_type, checked, out);
+  }
+  return Status::NotImplemented("Unknown arithmetic operator");
+}
+
+Status MakeUnaryArithmeticKernel(UnaryArithmeticOperator op,
+                                 const std::shared_ptr<DataType>& value_type,
+                                 ArithmeticOptions options,
+                                 std::shared_ptr<UnaryKernel>* out) {
+  const bool checked = options.check_overflow;
+  switch (op) {
+    case UnaryArithmeticOperator::NEGATE:
+      return MakeNumericKernel<UnaryArithmeticKernel, NegateOp>(value_type, checked, out);
+    case UnaryArithmeticOperator::ABS:
+      return MakeNumericKernel<UnaryArithmeticKernel, AbsOp>(value_type, checked, out);
+  }
+  return Status::NotImplemented("Unknown arithmetic operator");
+}
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           ArithmeticOptions options, Datum* out) {
+  return ExecuteArithmetic(ctx, ArithmeticOperator::ADD, left, right, options, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out) {
+  return ExecuteArithmetic(ctx, ArithmeticOperator::SUBTRACT, left, right, options, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out) {
+  return ExecuteArithmetic(ctx, ArithmeticOperator::MULTIPLY, left, right, options, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              ArithmeticOptions options, Datum* out) {
+  return ExecuteArithmetic(ctx, ArithmeticOperator::DIVIDE, left, right, options, out);
+}
+
+Status Negate(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+              Datum* out) {
+  return ExecuteUnaryArithmetic(ctx, UnaryArithmeticOperator::NEGATE, value, options,
+                                out);
+}
+
+Status AbsoluteValue(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+                     Datum* out) {
+  return ExecuteUnaryArithmetic(ctx, UnaryArithmeticOperator::ABS, value, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
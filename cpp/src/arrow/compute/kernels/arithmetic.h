@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+class Status;
+
+namespace compute {
+
+class FunctionContext;
+
+enum class ArithmeticOperator { ADD, SUBTRACT, MULTIPLY, DIVIDE };
+
+enum class UnaryArithmeticOperator { NEGATE, ABS };
+
+struct ARROW_EXPORT ArithmeticOptions {
+  ArithmeticOptions() : check_overflow(false) {}
+  explicit ArithmeticOptions(bool check_overflow) : check_overflow(check_overflow) {}
+
+  /// Return an Invalid status on integer overflow instead of wrapping around.
+  /// Values in null slots are never checked.
+  bool check_overflow;
+};
+
+/// \brief BinaryKernel implementing an arithmetic operator on numeric arrays
+/// and scalars of the given type
+///
+/// The kernel expects its output data buffer to be preallocated (see
+/// detail::PrimitiveAllocatingBinaryKernel).
+ARROW_EXPORT
+Status MakeArithmeticKernel(ArithmeticOperator op,
+                            const std::shared_ptr<DataType>& value_type,
+                            ArithmeticOptions options,
+                            std::shared_ptr<BinaryKernel>* out);
+
+/// \brief UnaryKernel implementing an arithmetic operator on numeric arrays of
+/// the given type
+///
+/// The kernel expects its output data buffer to be preallocated (see
+/// detail::PrimitiveAllocatingUnaryKernel).
+ARROW_EXPORT
+Status MakeUnaryArithmeticKernel(UnaryArithmeticOperator op,
+                                 const std::shared_ptr<DataType>& value_type,
+                                 ArithmeticOptions options,
+                                 std::shared_ptr<UnaryKernel>* out);
+
+/// \brief Add two numeric values elementwise
+///
+/// Either side may be a scalar, but not both. Array operands must have the
+/// same length and both operands the same type, which is the output type.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the first operand
+/// \param[in] right the second operand
+/// \param[in] options arithmetic options
+/// \param[out] out the resulting array
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           ArithmeticOptions options, Datum* out);
+
+/// \brief Subtract right from left elementwise, see Add()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out);
+
+/// \brief Multiply two numeric values elementwise, see Add()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out);
+
+/// \brief Divide left by right elementwise, see Add()
+///
+/// Integer division truncates towards zero and returns an Invalid status when
+/// dividing by zero; floating point division follows IEEE-754.
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              ArithmeticOptions options, Datum* out);
+
+/// \brief Negate a numeric array elementwise
+///
+/// Negating a non-zero unsigned integer overflows.
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Negate(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+              Datum* out);
+
+/// \brief Compute the absolute value of a numeric array elementwise
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AbsoluteValue(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+                     Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
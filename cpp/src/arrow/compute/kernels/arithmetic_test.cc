@@ -0,0 +1,310 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+using BinaryArithmeticFunc = std::function<Status(
+    FunctionContext*, const Datum&, const Datum&, ArithmeticOptions, Datum*)>;
+using UnaryArithmeticFunc =
+    std::function<Status(FunctionContext*, const Datum&, ArithmeticOptions, Datum*)>;
+
+template <typename ArrowType>
+class TestArithmetic : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<Array> MakeArray(const std::vector<CType>& values,
+                                   const std::vector<bool>& is_valid = {}) {
+    std::shared_ptr<Array> out;
+    if (is_valid.empty()) {
+      ArrayFromVector<ArrowType, CType>(values, &out);
+    } else {
+      ArrayFromVector<ArrowType, CType>(is_valid, values, &out);
+    }
+    return out;
+  }
+
+  Datum MakeScalar(CType value) { return Datum(std::make_shared<ScalarType>(value)); }
+
+  void AssertBinary(const BinaryArithmeticFunc& func, const Datum& left,
+                    const Datum& right, const std::shared_ptr<Array>& expected,
+                    ArithmeticOptions options = ArithmeticOptions()) {
+    Datum out;
+    ASSERT_OK(func(&ctx_, left, right, options, &out));
+    std::shared_ptr<Array> actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  void AssertUnary(const UnaryArithmeticFunc& func, const Datum& value,
+                   const std::shared_ptr<Array>& expected,
+                   ArithmeticOptions options = ArithmeticOptions()) {
+    Datum out;
+    ASSERT_OK(func(&ctx_, value, options, &out));
+    std::shared_ptr<Array> actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  ArithmeticOptions checked_{/*check_overflow=*/true};
+};
+
+template <typename ArrowType>
+class TestArithmeticNumeric : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticNumeric, NumericArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticIntegral : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticIntegral, IntegralArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticReal : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticReal, RealArrowTypes);
+
+TYPED_TEST(TestArithmeticNumeric, ArrayArray) {
+  auto left = this->MakeArray({8, 6, 9, 4, 12}, {true, true, false, true, true});
+  auto right = this->MakeArray({2, 3, 0, 4, 4}, {true, false, true, true, true});
+  const std::vector<bool> is_valid = {true, false, false, true, true};
+
+  for (const auto& options : {ArithmeticOptions(), this->checked_}) {
+    this->AssertBinary(Add, left, right, this->MakeArray({10, 0, 0, 8, 16}, is_valid),
+                       options);
+    this->AssertBinary(Subtract, left, right, this->MakeArray({6, 0, 0, 0, 8}, is_valid),
+                       options);
+    this->AssertBinary(Multiply, left, right,
+                       this->MakeArray({16, 0, 0, 16, 48}, is_valid), options);
+    // The division by zero is in a null slot
+    this->AssertBinary(Divide, left, right, this->MakeArray({4, 0, 0, 1, 3}, is_valid),
+                       options);
+  }
+
+  // Sliced inputs
+  this->AssertBinary(Add, left->Slice(1, 3), right->Slice(2, 3),
+                     this->MakeArray({6, 0, 8}, {true, false, true}));
+
+  this->AssertBinary(Add, this->MakeArray({}), this->MakeArray({}), this->MakeArray({}));
+}
+
+TYPED_TEST(TestArithmeticNumeric, ArrayScalar) {
+  auto array = this->MakeArray({8, 6, 9, 4}, {true, true, false, true});
+  const std::vector<bool> is_valid = {true, true, false, true};
+  auto two = this->MakeScalar(2);
+
+  this->AssertBinary(Add, array, two, this->MakeArray({10, 8, 0, 6}, is_valid));
+  this->AssertBinary(Add, two, array, this->MakeArray({10, 8, 0, 6}, is_valid));
+  this->AssertBinary(Subtract, array, two, this->MakeArray({6, 4, 0, 2}, is_valid));
+  this->AssertBinary(Subtract, this->MakeScalar(20), array,
+                     this->MakeArray({12, 14, 0, 16}, is_valid));
+  this->AssertBinary(Multiply, two, array, this->MakeArray({16, 12, 0, 8}, is_valid));
+  this->AssertBinary(Divide, array, two, this->MakeArray({4, 3, 0, 2}, is_valid));
+  this->AssertBinary(Divide, this->MakeScalar(24), array,
+                     this->MakeArray({3, 4, 0, 6}, is_valid));
+
+  auto null_scalar = Datum(MakeNullScalar(this->type()));
+  auto all_null = this->MakeArray({0, 0, 0, 0}, {false, false, false, false});
+  this->AssertBinary(Add, array, null_scalar, all_null);
+  // No division by zero is reported for null slots
+  this->AssertBinary(Divide, null_scalar, this->MakeArray({0, 0, 0, 0}), all_null);
+}
+
+TYPED_TEST(TestArithmeticIntegral, Overflow) {
+  using CType = typename TypeParam::c_type;
+  const CType min = std::numeric_limits<CType>::min();
+  const CType max = std::numeric_limits<CType>::max();
+  auto maxes = this->MakeArray({max, 1});
+  auto mins = this->MakeArray({min, 1});
+  auto ones = this->MakeArray({1, 1});
+  auto twos = this->MakeArray({2, 1});
+
+  // Unchecked arithmetic wraps around
+  this->AssertBinary(Add, maxes, ones, this->MakeArray({min, 2}));
+  this->AssertBinary(Subtract, mins, ones, this->MakeArray({max, 0}));
+  this->AssertBinary(Multiply, maxes, twos,
+                     this->MakeArray({static_cast<CType>(max * uint64_t(2)), 1}));
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, maxes, ones, this->checked_, &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, maxes, this->MakeScalar(1), this->checked_,
+                             &out));
+  ASSERT_RAISES(Invalid, Subtract(&this->ctx_, mins, ones, this->checked_, &out));
+  ASSERT_RAISES(Invalid, Subtract(&this->ctx_, this->MakeScalar(min), ones,
+                                  this->checked_, &out));
+  ASSERT_RAISES(Invalid, Multiply(&this->ctx_, maxes, twos, this->checked_, &out));
+
+  // Overflows in null slots are ignored
+  auto null_maxes = this->MakeArray({max, 1}, {false, true});
+  this->AssertBinary(Add, null_maxes, ones, this->MakeArray({0, 2}, {false, true}),
+                     this->checked_);
+  this->AssertBinary(Multiply, twos, null_maxes, this->MakeArray({0, 1}, {false, true}),
+                     this->checked_);
+}
+
+TYPED_TEST(TestArithmeticIntegral, Divide) {
+  using CType = typename TypeParam::c_type;
+  auto left = this->MakeArray({7, 1, 9});
+  auto right = this->MakeArray({2, 0, 3}, {true, true, false});
+
+  Datum out;
+  for (const auto& options : {ArithmeticOptions(), this->checked_}) {
+    ASSERT_RAISES(Invalid, Divide(&this->ctx_, left, right, options, &out));
+    ASSERT_RAISES(Invalid, Divide(&this->ctx_, left, this->MakeScalar(0), options, &out));
+  }
+  this->AssertBinary(Divide, left->Slice(2), right->Slice(2),
+                     this->MakeArray({0}, {false}));
+
+  if (std::is_signed<CType>::value) {
+    const CType min = std::numeric_limits<CType>::min();
+    const CType minus_one = static_cast<CType>(-1);
+    const CType minus_three = static_cast<CType>(-3);
+    auto mins = this->MakeArray({min, static_cast<CType>(-7)});
+    this->AssertBinary(Divide, mins, this->MakeScalar(minus_one),
+                       this->MakeArray({min, 7}));
+    this->AssertBinary(Divide, mins, this->MakeScalar(2),
+                       this->MakeArray({static_cast<CType>(min / 2), minus_three}));
+    ASSERT_RAISES(Invalid,
+                  Divide(&this->ctx_, mins, this->MakeScalar(minus_one), this->checked_,
+                         &out));
+  }
+}
+
+TYPED_TEST(TestArithmeticIntegral, NegateAndAbs) {
+  using CType = typename TypeParam::c_type;
+  const CType min = std::numeric_limits<CType>::min();
+  const CType max = std::numeric_limits<CType>::max();
+
+  Datum out;
+  if (std::is_signed<CType>::value) {
+    auto values = this->MakeArray({static_cast<CType>(-3), 0, max, min, 5},
+                                  {true, true, true, true, false});
+    const std::vector<bool> is_valid = {true, true, true, true, false};
+    const CType minus_max = static_cast<CType>(-max);
+    this->AssertUnary(Negate, values,
+                      this->MakeArray({3, 0, minus_max, min, 0}, is_valid));
+    this->AssertUnary(AbsoluteValue, values,
+                      this->MakeArray({3, 0, max, min, 0}, is_valid));
+    ASSERT_RAISES(Invalid, Negate(&this->ctx_, values, this->checked_, &out));
+    ASSERT_RAISES(Invalid, AbsoluteValue(&this->ctx_, values, this->checked_, &out));
+    this->AssertUnary(Negate, values->Slice(0, 3),
+                      this->MakeArray({3, 0, minus_max}), this->checked_);
+    this->AssertUnary(AbsoluteValue, values->Slice(4),
+                      this->MakeArray({0}, {false}), this->checked_);
+  } else {
+    auto values = this->MakeArray({0, 1, max});
+    this->AssertUnary(Negate, values, this->MakeArray({0, max, 1}));
+    this->AssertUnary(AbsoluteValue, values, values, this->checked_);
+    ASSERT_RAISES(Invalid, Negate(&this->ctx_, values, this->checked_, &out));
+    this->AssertUnary(Negate, values->Slice(0, 1), this->MakeArray({0}), this->checked_);
+  }
+}
+
+TYPED_TEST(TestArithmeticReal, FloatingPoint) {
+  using CType = typename TypeParam::c_type;
+  const CType inf = std::numeric_limits<CType>::infinity();
+  auto left = this->MakeArray({1.5, -3, 0.25, 2}, {true, true, true, false});
+  auto right = this->MakeArray({0.5, 0, 4, 1});
+  const std::vector<bool> is_valid = {true, true, true, false};
+
+  for (const auto& options : {ArithmeticOptions(), this->checked_}) {
+    this->AssertBinary(Add, left, right, this->MakeArray({2, -3, 4.25, 0}, is_valid),
+                       options);
+    this->AssertBinary(Multiply, left, right,
+                       this->MakeArray({0.75, -0.0, 1, 0}, is_valid), options);
+    // Division by zero follows IEEE-754
+    this->AssertBinary(Divide, left, right,
+                       this->MakeArray({3, -inf, 0.0625, 0}, is_valid), options);
+    this->AssertUnary(Negate, left, this->MakeArray({-1.5, 3, -0.25, 0}, is_valid),
+                      options);
+    this->AssertUnary(AbsoluteValue, left, this->MakeArray({1.5, 3, 0.25, 0}, is_valid),
+                      options);
+  }
+}
+
+class TestArithmeticKinds : public ComputeFixture, public TestBase {};
+
+TEST_F(TestArithmeticKinds, ChunkedArrays) {
+  std::shared_ptr<Array> a, b, c, d, sum, twice;
+  ArrayFromVector<Int32Type>({1, 2, 3}, &a);
+  ArrayFromVector<Int32Type>({4, 5}, &b);
+  ArrayFromVector<Int32Type>({10, 20}, &c);
+  ArrayFromVector<Int32Type>({30, 40, 50}, &d);
+  auto left = std::make_shared<ChunkedArray>(ArrayVector{a, b});
+  auto right = std::make_shared<ChunkedArray>(ArrayVector{c, d});
+
+  Datum out;
+  ASSERT_OK(Add(&ctx_, left, right, ArithmeticOptions(), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ArrayFromVector<Int32Type>({11, 22, 33, 44, 55}, &sum);
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({sum})));
+
+  ASSERT_OK(Multiply(&ctx_, left, Datum(std::make_shared<Int32Scalar>(2)),
+                     ArithmeticOptions(), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ArrayFromVector<Int32Type>({2, 4, 6, 8, 10}, &twice);
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({twice})));
+
+  ASSERT_OK(Negate(&ctx_, right, ArithmeticOptions(), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ASSERT_EQ(2, out.chunked_array()->num_chunks());
+  const auto& negated = checked_cast<const Int32Array&>(*out.chunked_array()->chunk(1));
+  ASSERT_EQ(-50, negated.Value(2));
+}
+
+TEST_F(TestArithmeticKinds, Errors) {
+  std::shared_ptr<Array> ints, longs, strings;
+  ArrayFromVector<Int32Type>({1, 2, 3}, &ints);
+  ArrayFromVector<Int64Type>({1, 2, 3}, &longs);
+  ArrayFromVector<StringType, std::string>({"a", "b", "c"}, &strings);
+  auto one = Datum(std::make_shared<Int32Scalar>(1));
+
+  Datum out;
+  ASSERT_RAISES(TypeError, Add(&ctx_, ints, longs, ArithmeticOptions(), &out));
+  ASSERT_RAISES(Invalid, Add(&ctx_, one, one, ArithmeticOptions(), &out));
+  ASSERT_RAISES(Invalid, Add(&ctx_, ints, ints->Slice(1), ArithmeticOptions(), &out));
+  ASSERT_RAISES(NotImplemented, Add(&ctx_, strings, strings, ArithmeticOptions(), &out));
+  ASSERT_RAISES(NotImplemented, Negate(&ctx_, strings, ArithmeticOptions(), &out));
+  ASSERT_RAISES(Invalid, Negate(&ctx_, one, ArithmeticOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
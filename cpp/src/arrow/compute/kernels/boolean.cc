@@ -33,12 +33,12 @@
 
 namespace arrow {
 
-using internal::Bitmap;
 using internal::BitmapAnd;
 using internal::BitmapOr;
 using internal::BitmapXor;
 using internal::CountSetBits;
 using internal::InvertBitmap;
+using internal::ShiftedBitmapReader;
 
 namespace compute {
 
@@ -105,55 +105,67 @@ class BinaryBooleanKernel : public BinaryKernel {
 
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
 
-  enum BitmapIndex { LEFT_VALID, LEFT_DATA, RIGHT_VALID, RIGHT_DATA };
-
+  // \brief Compute the output validity and data a word at a time from the
+  // true and false bits of the inputs, at any offsets
   template <typename ComputeWord>
   Status ComputeKleene(ComputeWord&& compute_word, FunctionContext* ctx,
                        const ArrayData& left, const ArrayData& right, ArrayData* out) {
     DCHECK(left.null_count != 0 || right.null_count != 0);
 
-    Bitmap bitmaps[4];
-    bitmaps[LEFT_VALID] = {left.buffers[0], left.offset, left.length};
-    bitmaps[LEFT_DATA] = {left.buffers[1], left.offset, left.length};
-
-    bitmaps[RIGHT_VALID] = {right.buffers[0], right.offset, right.length};
-    bitmaps[RIGHT_DATA] = {right.buffers[1], right.offset, right.length};
-
     RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), out->length, &out->buffers[0]));
 
     auto out_validity = out->GetMutableValues<uint64_t>(0);
     auto out_data = out->GetMutableValues<uint64_t>(1);
 
-    int64_t i = 0;
-    auto apply = [&](uint64_t left_valid, uint64_t left_data, uint64_t right_valid,
-                     uint64_t right_data) {
+    // Kleene logic is commutative: ensure only the right side may have no nulls
+    const ArrayData* left_array = &left;
+    const ArrayData* right_array = &right;
+    if (left.null_count == 0) {
+      std::swap(left_array, right_array);
+    }
+    const ShiftedBitmapReader left_valid(left_array->buffers[0]->data(),
+                                         left_array->offset);
+    const ShiftedBitmapReader left_data(left_array->buffers[1]->data(),
+                                        left_array->offset);
+    const ShiftedBitmapReader right_data(right_array->buffers[1]->data(),
+                                         right_array->offset);
+    // Without nulls, read the right data again as validity, all set by the mask
+    const bool right_has_nulls = right_array->null_count != 0;
+    const ShiftedBitmapReader right_valid =
+        right_has_nulls
+            ? ShiftedBitmapReader(right_array->buffers[0]->data(), right_array->offset)
+            : right_data;
+    const uint64_t right_valid_mask = right_has_nulls ? 0 : ~uint64_t(0);
+
+    auto apply = [&](int64_t i, uint64_t left_valid, uint64_t left_data,
+                     uint64_t right_valid, uint64_t right_data) {
+      right_valid |= right_valid_mask;
       auto left_true = left_valid & left_data;
       auto left_false = left_valid & ~left_data;
 
       auto right_true = right_valid & right_data;
       auto right_false = right_valid & ~right_data;
 
-      compute_word(left_true, left_false, right_true, right_false, &out_validity[i],
-                   &out_data[i]);
-      ++i;
+      uint64_t valid, data;
+      compute_word(left_true, left_false, right_true, right_false, &valid, &data);
+      out_validity[i] = BitUtil::ToLittleEndian(valid);
+      out_data[i] = BitUtil::ToLittleEndian(data);
     };
 
-    if (right.null_count == 0 || left.null_count == 0) {
-      if (left.null_count == 0) {
-        // ensure only bitmaps[RIGHT_VALID].buffer might be null
-        std::swap(bitmaps[LEFT_VALID], bitmaps[RIGHT_VALID]);
-        std::swap(bitmaps[LEFT_DATA], bitmaps[RIGHT_DATA]);
-      }
-      // override bitmaps[RIGHT_VALID] to make it safe for Visit()
-      bitmaps[RIGHT_VALID] = bitmaps[RIGHT_DATA];
-
-      Bitmap::VisitWords(bitmaps, [&](std::array<uint64_t, 4> words) {
-        apply(words[LEFT_VALID], words[LEFT_DATA], ~uint64_t(0), words[RIGHT_DATA]);
-      });
-    } else {
-      Bitmap::VisitWords(bitmaps, [&](std::array<uint64_t, 4> words) {
-        apply(words[LEFT_VALID], words[LEFT_DATA], words[RIGHT_VALID], words[RIGHT_DATA]);
-      });
+    // The readers load one byte past each word, which stays within the inputs
+    // as long as more bits follow
+    const int64_t num_words = out->length > 0 ? (out->length - 1) / 64 : 0;
+    for (int64_t i = 0; i < num_words; ++i) {
+      apply(i, left_valid.Word(i), left_data.Word(i), right_valid.Word(i),
+            right_data.Word(i));
+    }
+    const int64_t position = num_words * 64;
+    const int64_t num_bits = out->length - position;
+    if (num_bits > 0) {
+      apply(num_words, left_valid.PartialWord(position, num_bits),
+            left_data.PartialWord(position, num_bits),
+            right_valid.PartialWord(position, num_bits),
+            right_data.PartialWord(position, num_bits));
     }
     return Status::OK();
   }
@@ -264,5 +276,31 @@ Status Xor(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* o
   return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
 }
 
+Status MakeInvertKernel(std::shared_ptr<UnaryKernel>* out) {
+  *out = std::make_shared<InvertKernel>();
+  return Status::OK();
+}
+
+Status MakeBooleanKernel(BooleanOperator op, std::shared_ptr<BinaryKernel>* out) {
+  switch (op) {
+    case BooleanOperator::AND:
+      *out = std::make_shared<AndKernel>(ResolveNull::PROPAGATE);
+      break;
+    case BooleanOperator::OR:
+      *out = std::make_shared<OrKernel>(ResolveNull::PROPAGATE);
+      break;
+    case BooleanOperator::XOR:
+      *out = std::make_shared<XorKernel>();
+      break;
+    case BooleanOperator::KLEENE_AND:
+      *out = std::make_shared<AndKernel>(ResolveNull::KLEENE_LOGIC);
+      break;
+    case BooleanOperator::KLEENE_OR:
+      *out = std::make_shared<OrKernel>(ResolveNull::KLEENE_LOGIC);
+      break;
+  }
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
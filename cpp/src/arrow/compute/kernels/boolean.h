@@ -18,6 +18,8 @@
 #ifndef ARROW_COMPUTE_KERNELS_BOOLEAN_H
 #define ARROW_COMPUTE_KERNELS_BOOLEAN_H
 
+#include <memory>
+
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -25,7 +27,9 @@ namespace arrow {
 namespace compute {
 
 struct Datum;
+class BinaryKernel;
 class FunctionContext;
+class UnaryKernel;
 
 /// \brief Invert the values of a boolean datum
 /// \param[in] context the FunctionContext
@@ -102,6 +106,22 @@ Status KleeneOr(FunctionContext* context, const Datum& left, const Datum& right,
 ARROW_EXPORT
 Status Xor(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
 
+enum class BooleanOperator { AND, OR, XOR, KLEENE_AND, KLEENE_OR };
+
+/// \brief UnaryKernel implementing Invert
+///
+/// Unlike Invert(), the kernel expects its output data buffer to be
+/// preallocated (see detail::PrimitiveAllocatingUnaryKernel).
+ARROW_EXPORT
+Status MakeInvertKernel(std::shared_ptr<UnaryKernel>* out);
+
+/// \brief BinaryKernel implementing a boolean operator
+///
+/// Unlike the corresponding functions, the kernel expects its output data
+/// buffer to be preallocated (see detail::PrimitiveAllocatingBinaryKernel).
+ARROW_EXPORT
+Status MakeBooleanKernel(BooleanOperator op, std::shared_ptr<BinaryKernel>* out);
+
 }  // namespace compute
 }  // namespace arrow
 
@@ -25,16 +25,20 @@
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace compute {
 
+using internal::checked_pointer_cast;
+
 using BinaryKernelFunc =
     std::function<Status(FunctionContext*, const Datum&, const Datum&, Datum* out)>;
 
@@ -109,6 +113,47 @@ class TestBooleanKernel : public ComputeFixture, public TestBase {
                      _MakeArray<BooleanType, bool>(type, right, right),
                      _MakeArray<BooleanType, bool>(type, expected, expected_nulls));
   }
+
+  // Check a Kleene kernel on random inputs spanning several words, at various
+  // offsets, against a slot by slot evaluation
+  void TestKleeneRandom(const BinaryKernelFunc& kernel, bool is_and) {
+    auto rand = random::RandomArrayGenerator(0x5487655);
+    const int64_t length = 1000;
+    for (auto null_probability : {0.0, 0.1, 0.5}) {
+      auto left_boxed = rand.Boolean(length + 13, 0.5, null_probability);
+      auto right_boxed = rand.Boolean(length + 13, 0.5, 0.1);
+      for (int64_t left_offset : {0, 3, 8}) {
+        for (int64_t right_offset : {0, 5, 13}) {
+          for (int64_t slice_length : {int64_t(0), int64_t(1), int64_t(64),
+                                       int64_t(65), length}) {
+            auto left = checked_pointer_cast<BooleanArray>(
+                left_boxed->Slice(left_offset, slice_length));
+            auto right = checked_pointer_cast<BooleanArray>(
+                right_boxed->Slice(right_offset, slice_length));
+
+            BooleanBuilder builder;
+            for (int64_t i = 0; i < slice_length; ++i) {
+              const bool left_known = left->IsValid(i);
+              const bool right_known = right->IsValid(i);
+              // The absorbing value decides the result even against a null
+              const bool absorbing = !is_and;
+              if ((left_known && left->Value(i) == absorbing) ||
+                  (right_known && right->Value(i) == absorbing)) {
+                ASSERT_OK(builder.Append(absorbing));
+              } else if (left_known && right_known) {
+                ASSERT_OK(builder.Append(!absorbing));
+              } else {
+                ASSERT_OK(builder.AppendNull());
+              }
+            }
+            std::shared_ptr<Array> expected;
+            ASSERT_OK(builder.Finish(&expected));
+            TestArrayBinary(kernel, left, right, expected);
+          }
+        }
+      }
+    }
+  }
 };
 
 TEST_F(TestBooleanKernel, Invert) {
@@ -200,6 +245,8 @@ TEST_F(TestBooleanKernel, KleeneAnd) {
   TestBinaryKernel(KleeneAnd, left, right, expected);
 }
 
+TEST_F(TestBooleanKernel, KleeneAndRandom) { TestKleeneRandom(KleeneAnd, true); }
+
 TEST_F(TestBooleanKernel, KleeneOr) {
   auto left = ArrayFromJSON(boolean(), "    [true, true,  true, false, false, null]");
   auto right = ArrayFromJSON(boolean(), "   [true, false, null, false, null,  null]");
@@ -212,5 +259,7 @@ TEST_F(TestBooleanKernel, KleeneOr) {
   TestBinaryKernel(KleeneOr, left, right, expected);
 }
 
+TEST_F(TestBooleanKernel, KleeneOrRandom) { TestKleeneRandom(KleeneOr, false); }
+
 }  // namespace compute
 }  // namespace arrow
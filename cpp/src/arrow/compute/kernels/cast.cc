@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/cast.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -29,8 +30,10 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/extension_type.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/formatting.h"
@@ -278,31 +281,34 @@ struct CastFunctor<O, I,
       constexpr in_type kMax = SafeMaximum<O, I>();
       constexpr in_type kMin = SafeMinimum<O, I>();
 
-      // Null count may be -1 if the input array had been sliced
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  (*in_data > kMax || *in_data < kMin))) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-          }
-          *out_data++ = static_cast<out_type>(*in_data++);
-          is_valid_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(*in_data > kMax || *in_data < kMin)) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-          }
-          *out_data++ = static_cast<out_type>(*in_data++);
-        }
-      }
-    } else {
-      for (int64_t i = 0; i < input.length; ++i) {
-        *out_data++ = static_cast<out_type>(*in_data++);
+      // Bounds are checked in branch-free loops over all-valid blocks, skipping
+      // the null slots of the other blocks. Null count may be -1 if the input
+      // array had been sliced
+      const uint8_t* valid_bits =
+          input.null_count != 0 ? input.buffers[0]->data() : nullptr;
+      bool out_of_bounds = false;
+      internal::VisitValidityBlocks(
+          valid_bits, in_offset, input.length,
+          [&](int64_t position, int64_t length) {
+            bool block_out_of_bounds = false;
+            for (int64_t i = position; i < position + length; ++i) {
+              block_out_of_bounds |= (in_data[i] > kMax) | (in_data[i] < kMin);
+            }
+            out_of_bounds |= block_out_of_bounds;
+          },
+          [&](int64_t position, int64_t length) {
+            for (int64_t i = position; i < position + length; ++i) {
+              out_of_bounds |= BitUtil::GetBit(valid_bits, in_offset + i) &&
+                               (in_data[i] > kMax || in_data[i] < kMin);
+            }
+          });
+      if (ARROW_PREDICT_FALSE(out_of_bounds)) {
+        ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
       }
     }
+    for (int64_t i = 0; i < input.length; ++i) {
+      *out_data++ = static_cast<out_type>(*in_data++);
+    }
   }
 };
 
@@ -332,35 +338,36 @@ struct CastFunctor<O, I, enable_if_t<is_float_truncate<O, I>::value>> {
     const in_type* in_data = input.GetValues<in_type>(1);
     auto out_data = output->GetMutableValues<out_type>(1);
 
-    if (options.allow_float_truncate) {
-      // unsafe cast
-      for (int64_t i = 0; i < input.length; ++i) {
-        *out_data++ = static_cast<out_type>(*in_data++);
-      }
-    } else {
-      // safe cast
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          auto out_value = static_cast<out_type>(*in_data);
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  static_cast<in_type>(out_value) != *in_data)) {
-            ctx->SetStatus(Status::Invalid("Floating point value truncated"));
+    for (int64_t i = 0; i < input.length; ++i) {
+      out_data[i] = static_cast<out_type>(in_data[i]);
+    }
+    if (!options.allow_float_truncate) {
+      // safe cast: the round trip of valid values must be exact. As for
+      // integers, all-valid blocks are checked without branches (not through
+      // a lambda, which wouldn't inherit ARROW_DISABLE_UBSAN)
+      const uint8_t* valid_bits =
+          input.null_count != 0 ? input.buffers[0]->data() : nullptr;
+      internal::OptionalBitBlockCounter counter(valid_bits, in_offset, input.length);
+      bool truncated = false;
+      for (int64_t position = 0; position < input.length;) {
+        const internal::BitBlockCount block = counter.NextBlock();
+        const int64_t end = position + block.length;
+        if (block.AllSet()) {
+          bool block_truncated = false;
+          for (int64_t i = position; i < end; ++i) {
+            block_truncated |= static_cast<in_type>(out_data[i]) != in_data[i];
           }
-          *out_data++ = out_value;
-          in_data++;
-          is_valid_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          auto out_value = static_cast<out_type>(*in_data);
-          if (ARROW_PREDICT_FALSE(static_cast<in_type>(out_value) != *in_data)) {
-            ctx->SetStatus(Status::Invalid("Floating point value truncated"));
+          truncated |= block_truncated;
+        } else if (!block.NoneSet()) {
+          for (int64_t i = position; i < end; ++i) {
+            truncated |= BitUtil::GetBit(valid_bits, in_offset + i) &&
+                         static_cast<in_type>(out_data[i]) != in_data[i];
           }
-          *out_data++ = out_value;
-          in_data++;
         }
+        position = end;
+      }
+      if (ARROW_PREDICT_FALSE(truncated)) {
+        ctx->SetStatus(Status::Invalid("Floating point value truncated"));
       }
     }
   }
@@ -759,6 +766,15 @@ class FromNullCastKernel : public CastKernelBase {
 // ----------------------------------------------------------------------
 // Dictionary to other things
 
+// Dictionaries are unpacked by gathering slices of this many indices, in
+// parallel if the FunctionContext allows it
+static constexpr int64_t kUnpackSliceLength = 1 << 16;
+
+inline int NumUnpackSlices(int64_t length) {
+  return static_cast<int>(std::max<int64_t>(
+      1, BitUtil::CeilDiv(length, kUnpackSliceLength)));
+}
+
 template <typename T, typename IndexType, typename Enable = void>
 struct FromDictVisitor {};
 
@@ -767,12 +783,12 @@ template <typename T, typename IndexType>
 struct FromDictVisitor<T, IndexType, enable_if_fixed_size_binary<T>> {
   using ArrayType = typename TypeTraits<T>::ArrayType;
 
-  FromDictVisitor(FunctionContext* ctx, const ArrayType& dictionary, ArrayData* output)
+  // Writes from the given row of the output on
+  FromDictVisitor(const ArrayType& dictionary, ArrayData* output, int64_t start)
       : dictionary_(dictionary),
         byte_width_(dictionary.byte_width()),
-        out_(output->buffers[1]->mutable_data() + byte_width_ * output->offset) {}
-
-  Status Init() { return Status::OK(); }
+        out_(output->buffers[1]->mutable_data() +
+             byte_width_ * (output->offset + start)) {}
 
   Status VisitNull() {
     memset(out_, 0, byte_width_);
@@ -787,51 +803,11 @@ struct FromDictVisitor<T, IndexType, enable_if_fixed_size_binary<T>> {
     return Status::OK();
   }
 
-  Status Finish() { return Status::OK(); }
-
   const ArrayType& dictionary_;
   int32_t byte_width_;
   uint8_t* out_;
 };
 
-// Visitor for Dict<BinaryType>
-template <typename T, typename IndexType>
-struct FromDictVisitor<T, IndexType, enable_if_base_binary<T>> {
-  using ArrayType = typename TypeTraits<T>::ArrayType;
-
-  FromDictVisitor(FunctionContext* ctx, const ArrayType& dictionary, ArrayData* output)
-      : ctx_(ctx), dictionary_(dictionary), output_(output) {}
-
-  Status Init() {
-    RETURN_NOT_OK(MakeBuilder(ctx_->memory_pool(), output_->type, &builder_));
-    binary_builder_ = checked_cast<BinaryBuilder*>(builder_.get());
-    return Status::OK();
-  }
-
-  Status VisitNull() { return binary_builder_->AppendNull(); }
-
-  Status VisitValue(typename IndexType::c_type dict_index) {
-    return binary_builder_->Append(dictionary_.GetView(dict_index));
-  }
-
-  Status Finish() {
-    std::shared_ptr<Array> plain_array;
-    RETURN_NOT_OK(binary_builder_->Finish(&plain_array));
-    // Copy all buffer except the valid bitmap
-    DCHECK_EQ(output_->buffers.size(), 1);
-    for (size_t i = 1; i < plain_array->data()->buffers.size(); i++) {
-      output_->buffers.push_back(plain_array->data()->buffers[i]);
-    }
-    return Status::OK();
-  }
-
-  FunctionContext* ctx_;
-  const ArrayType& dictionary_;
-  ArrayData* output_;
-  std::unique_ptr<ArrayBuilder> builder_;
-  BinaryBuilder* binary_builder_;
-};
-
 // Visitor for Dict<NumericType | TemporalType>
 template <typename T, typename IndexType>
 struct FromDictVisitor<
@@ -840,10 +816,8 @@ struct FromDictVisitor<
 
   using value_type = typename T::c_type;
 
-  FromDictVisitor(FunctionContext* ctx, const ArrayType& dictionary, ArrayData* output)
-      : dictionary_(dictionary), out_(output->GetMutableValues<value_type>(1)) {}
-
-  Status Init() { return Status::OK(); }
+  FromDictVisitor(const ArrayType& dictionary, ArrayData* output, int64_t start)
+      : dictionary_(dictionary), out_(output->GetMutableValues<value_type>(1) + start) {}
 
   Status VisitNull() {
     *out_++ = value_type{};  // Zero-initialize
@@ -855,23 +829,83 @@ struct FromDictVisitor<
     return Status::OK();
   }
 
-  Status Finish() { return Status::OK(); }
-
   const ArrayType& dictionary_;
   value_type* out_;
 };
 
-template <typename T>
+// Fixed-width values are gathered into the preallocated output
+template <typename T, typename Enable = void>
 struct FromDictUnpackHelper {
   using ArrayType = typename TypeTraits<T>::ArrayType;
 
   template <typename IndexType>
   Status Unpack(FunctionContext* ctx, const ArrayData& indices,
                 const ArrayType& dictionary, ArrayData* output) {
-    FromDictVisitor<T, IndexType> visitor{ctx, dictionary, output};
-    RETURN_NOT_OK(visitor.Init());
-    RETURN_NOT_OK(ArrayDataVisitor<IndexType>::Visit(indices, &visitor));
-    return visitor.Finish();
+    return detail::ParallelForEach(
+        ctx, NumUnpackSlices(indices.length), [&](FunctionContext*, int i) {
+          const int64_t start = i * kUnpackSliceLength;
+          const ArrayData slice =
+              indices.Slice(start, std::min(kUnpackSliceLength, indices.length - start));
+          FromDictVisitor<T, IndexType> visitor{dictionary, output, start};
+          return ArrayDataVisitor<IndexType>::Visit(slice, &visitor);
+        });
+  }
+};
+
+// Binary values are gathered in two passes: the output offsets are computed
+// first, then the values can be copied independently
+template <typename T>
+struct FromDictUnpackHelper<T, enable_if_base_binary<T>> {
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using offset_type = typename T::offset_type;
+
+  template <typename IndexType>
+  Status Unpack(FunctionContext* ctx, const ArrayData& indices,
+                const ArrayType& dictionary, ArrayData* output) {
+    using index_type = typename IndexType::c_type;
+    const index_type* index_values = indices.GetValues<index_type>(1);
+    const uint8_t* valid_bits =
+        indices.GetNullCount() != 0 ? indices.buffers[0]->data() : nullptr;
+    const int64_t length = indices.length;
+
+    std::shared_ptr<Buffer> offsets_buffer, data_buffer;
+    RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(offset_type), &offsets_buffer));
+    auto offsets = reinterpret_cast<offset_type*>(offsets_buffer->mutable_data());
+    int64_t total_length = 0;
+    offsets[0] = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      if (valid_bits == nullptr || BitUtil::GetBit(valid_bits, indices.offset + i)) {
+        total_length += dictionary.value_length(index_values[i]);
+        if (ARROW_PREDICT_FALSE(total_length > std::numeric_limits<offset_type>::max())) {
+          return Status::CapacityError("Unpacked dictionary array too large for type ",
+                                       output->type->ToString());
+        }
+      }
+      offsets[i + 1] = static_cast<offset_type>(total_length);
+    }
+    RETURN_NOT_OK(ctx->Allocate(total_length, &data_buffer));
+    uint8_t* data = data_buffer->mutable_data();
+
+    RETURN_NOT_OK(detail::ParallelForEach(
+        ctx, NumUnpackSlices(length), [&](FunctionContext*, int slice) {
+          const int64_t start = slice * kUnpackSliceLength;
+          const int64_t end = std::min(start + kUnpackSliceLength, length);
+          for (int64_t i = start; i < end; ++i) {
+            // Null slots are empty, their index needn't be valid
+            const offset_type value_length = offsets[i + 1] - offsets[i];
+            if (value_length > 0) {
+              offset_type unused;
+              memcpy(data + offsets[i], dictionary.GetValue(index_values[i], &unused),
+                     value_length);
+            }
+          }
+          return Status::OK();
+        }));
+
+    DCHECK_EQ(output->buffers.size(), 1);
+    output->buffers.push_back(std::move(offsets_buffer));
+    output->buffers.push_back(std::move(data_buffer));
+    return Status::OK();
   }
 };
 
@@ -919,6 +953,66 @@ struct CastFunctor<T, DictionaryType> {
 // ----------------------------------------------------------------------
 // String to Number
 
+// Convert all non-null values of a string-like array from its raw offsets and
+// data, returning the index of the first value failing to convert or -1.
+//
+// Failures are only recorded in the main loop so that it stays free of early
+// exits and per-value array accessors; the failing index is looked up again
+// afterwards.
+template <typename I, typename Converter, typename out_type>
+int64_t ConvertStrings(const ArrayData& input, Converter* converter, out_type* out) {
+  using offset_type = typename I::offset_type;
+  static const char kEmpty = '\0';
+
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  const char* data = input.buffers[2] != nullptr
+                         ? reinterpret_cast<const char*>(input.buffers[2]->data())
+                         : &kEmpty;
+  auto convert = [&](int64_t i) {
+    const auto length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+    return (*converter)(data + offsets[i], length, out + i);
+  };
+
+  const uint8_t* valid_bits =
+      input.GetNullCount() != 0 ? input.buffers[0]->data() : nullptr;
+  auto is_valid = [&](int64_t i) {
+    return valid_bits == nullptr || BitUtil::GetBit(valid_bits, input.offset + i);
+  };
+
+  bool all_ok = true;
+  internal::VisitValidityBlocks(
+      valid_bits, input.offset, input.length,
+      [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+          all_ok &= convert(i);
+        }
+      },
+      [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+          if (is_valid(i)) {
+            all_ok &= convert(i);
+          }
+        }
+      });
+  if (ARROW_PREDICT_TRUE(all_ok)) {
+    return -1;
+  }
+  for (int64_t i = 0; i < input.length; ++i) {
+    if (is_valid(i) && !convert(i)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+template <typename I>
+Status StringConversionError(const ArrayData& input, int64_t index,
+                             const DataType& out_type) {
+  typename TypeTraits<I>::ArrayType input_array(input.Copy());
+  return Status::Invalid("Failed to cast String '", input_array.GetView(index),
+                         "' into ", out_type.ToString());
+}
+
 template <typename I, typename O>
 struct CastFunctor<
     O, I, enable_if_t<is_string_like_type<I>::value && is_number_type<O>::value>> {
@@ -926,21 +1020,12 @@ struct CastFunctor<
                   const ArrayData& input, ArrayData* output) {
     using out_type = typename O::c_type;
 
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
     auto out_data = output->GetMutableValues<out_type>(1);
     internal::StringConverter<O> converter;
 
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
-
-      auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), out_data)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
-                                       output->type->ToString()));
-        return;
-      }
+    const int64_t failed = ConvertStrings<I>(input, &converter, out_data);
+    if (ARROW_PREDICT_FALSE(failed >= 0)) {
+      ctx->SetStatus(StringConversionError<I>(input, failed, *output->type));
     }
   }
 };
@@ -992,21 +1077,12 @@ struct CastFunctor<TimestampType, I, enable_if_t<is_string_like_type<I>::value>>
                   const ArrayData& input, ArrayData* output) {
     using out_type = TimestampType::c_type;
 
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
     auto out_data = output->GetMutableValues<out_type>(1);
     internal::StringConverter<TimestampType> converter(output->type);
 
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
-
-      const auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), out_data)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
-                                       output->type->ToString()));
-        return;
-      }
+    const int64_t failed = ConvertStrings<I>(input, &converter, out_data);
+    if (ARROW_PREDICT_FALSE(failed >= 0)) {
+      ctx->SetStatus(StringConversionError<I>(input, failed, *output->type));
     }
   }
 };
@@ -1026,29 +1102,64 @@ struct CastFunctor<O, I,
   Status Convert(FunctionContext* ctx, const CastOptions& options, const ArrayData& input,
                  ArrayData* output) {
     using value_type = typename TypeTraits<I>::CType;
-    using BuilderType = typename TypeTraits<O>::BuilderType;
+    using offset_type = typename O::offset_type;
     using FormatterType = typename internal::StringFormatter<I>;
 
+    // The values are formatted straight into the data buffer, which is grown
+    // when it can't hold a value of the maximum formatted size
     struct Visitor {
       Visitor(FunctionContext* ctx, const ArrayData& input)
-          : formatter_(input.type), builder_(input.type, ctx->memory_pool()) {}
+          : formatter_(input.type),
+            offsets_builder_(ctx->memory_pool()),
+            data_builder_(ctx->memory_pool()) {}
 
-      Status VisitNull() { return builder_.AppendNull(); }
+      Status VisitNull() {
+        offsets_builder_.UnsafeAppend(static_cast<offset_type>(data_builder_.length()));
+        return Status::OK();
+      }
 
       Status VisitValue(value_type value) {
-        return formatter_(value,
-                          [this](util::string_view v) { return builder_.Append(v); });
+        if (ARROW_PREDICT_FALSE(data_builder_.capacity() - data_builder_.length() <
+                                FormatterType::buffer_size)) {
+          RETURN_NOT_OK(data_builder_.Reserve(FormatterType::buffer_size));
+        }
+        char* out = reinterpret_cast<char*>(data_builder_.mutable_data()) +
+                    data_builder_.length();
+        data_builder_.UnsafeAdvance(formatter_.FormatValue(value, out));
+        offsets_builder_.UnsafeAppend(static_cast<offset_type>(data_builder_.length()));
+        return Status::OK();
       }
 
       FormatterType formatter_;
-      BuilderType builder_;
+      TypedBufferBuilder<offset_type> offsets_builder_;
+      BufferBuilder data_builder_;
     };
 
     Visitor visitor(ctx, input);
+    // Every valid value takes at least one character
+    RETURN_NOT_OK(visitor.offsets_builder_.Reserve(input.length + 1));
+    RETURN_NOT_OK(visitor.data_builder_.Reserve(input.length));
+    visitor.offsets_builder_.UnsafeAppend(0);
     RETURN_NOT_OK(ArrayDataVisitor<I>::Visit(input, &visitor));
-    std::shared_ptr<Array> output_array;
-    RETURN_NOT_OK(visitor.builder_.Finish(&output_array));
-    *output = std::move(*output_array->data());
+    // The offsets are increasing, so only the last one can have overflowed
+    if (ARROW_PREDICT_FALSE(visitor.data_builder_.length() >
+                            std::numeric_limits<offset_type>::max())) {
+      return Status::CapacityError("Cast to ", *output->type, " of ", input.length,
+                                   " values overflows the offsets");
+    }
+
+    const int64_t null_count = input.GetNullCount();
+    std::shared_ptr<Buffer> null_bitmap, offsets, data;
+    if (null_count != 0) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap,
+                            CopyBitmap(ctx->memory_pool(), input.buffers[0]->data(),
+                                       input.offset, input.length));
+    }
+    RETURN_NOT_OK(visitor.offsets_builder_.Finish(&offsets));
+    RETURN_NOT_OK(visitor.data_builder_.Finish(&data));
+    *output = ArrayData(output->type, input.length,
+                        {std::move(null_bitmap), std::move(offsets), std::move(data)},
+                        null_count);
     return Status::OK();
   }
 };
@@ -1067,14 +1178,20 @@ template <typename I, typename O>
 struct BinaryToStringSameWidthCastFunctor {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
-    if (!options.allow_invalid_utf8) {
+    if (!options.allow_invalid_utf8 && input.length > 0) {
       util::InitializeUTF8();
 
-      ArrayDataVisitor<I> visitor;
-      Status st = visitor.Visit(input, this);
-      if (!st.ok()) {
-        ctx->SetStatus(st);
-        return;
+      // Validate all the values at once, and one by one if that fails, as
+      // it may be because of the bytes of null slots
+      if (!util::ValidateUTF8Values(input.GetValues<uint8_t>(2, 0),
+                                    input.GetValues<typename I::offset_type>(1),
+                                    input.length)) {
+        ArrayDataVisitor<I> visitor;
+        Status st = visitor.Visit(input, this);
+        if (!st.ok()) {
+          ctx->SetStatus(st);
+          return;
+        }
       }
     }
     ZeroCopyData(input, output);
@@ -1247,21 +1364,45 @@ Status GetListCastFunc(const DataType& in_type, std::shared_ptr<DataType> out_ty
 
 }  // namespace
 
-inline bool IsZeroCopyCast(Type::type in_type, Type::type out_type) {
-  switch (in_type) {
+inline bool IsZeroCopyCast(const DataType& in_type, const DataType& out_type,
+                           const CastOptions& options) {
+  // An extension array is laid out exactly as its storage
+  if (in_type.id() == Type::EXTENSION) {
+    return checked_cast<const ExtensionType&>(in_type).storage_type()->Equals(out_type);
+  }
+  if (out_type.id() == Type::EXTENSION) {
+    return checked_cast<const ExtensionType&>(out_type).storage_type()->Equals(in_type);
+  }
+  const Type::type out_id = out_type.id();
+  switch (in_type.id()) {
     case Type::INT32:
-      return (out_type == Type::DATE32) || (out_type == Type::TIME32);
+      return (out_id == Type::DATE32) || (out_id == Type::TIME32);
     case Type::INT64:
-      return ((out_type == Type::DATE64) || (out_type == Type::TIME64) ||
-              (out_type == Type::TIMESTAMP) || (out_type == Type::DURATION));
+      return ((out_id == Type::DATE64) || (out_id == Type::TIME64) ||
+              (out_id == Type::TIMESTAMP) || (out_id == Type::DURATION));
     case Type::DATE32:
     case Type::TIME32:
-      return out_type == Type::INT32;
+      return out_id == Type::INT32;
     case Type::DATE64:
     case Type::TIME64:
-    case Type::TIMESTAMP:
     case Type::DURATION:
-      return out_type == Type::INT64;
+      return out_id == Type::INT64;
+    case Type::TIMESTAMP:
+      // Timestamps are stored as UTC, so changing only the time zone keeps the
+      // values as is
+      return out_id == Type::INT64 ||
+             (out_id == Type::TIMESTAMP &&
+              checked_cast<const TimestampType&>(in_type).unit() ==
+                  checked_cast<const TimestampType&>(out_type).unit());
+    case Type::STRING:
+      return out_id == Type::BINARY;
+    case Type::LARGE_STRING:
+      return out_id == Type::LARGE_BINARY;
+    case Type::BINARY:
+      // Otherwise the values are validated as UTF8
+      return out_id == Type::STRING && options.allow_invalid_utf8;
+    case Type::LARGE_BINARY:
+      return out_id == Type::LARGE_STRING && options.allow_invalid_utf8;
     default:
       break;
   }
@@ -1275,7 +1416,7 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
     return Status::OK();
   }
 
-  if (IsZeroCopyCast(in_type.id(), out_type->id())) {
+  if (IsZeroCopyCast(in_type, *out_type, options)) {
     kernel->reset(new ZeroCopyCast(std::move(out_type)));
     return Status::OK();
   }
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <limits>
+#include <memory>
+
+#include "arrow/compute/kernels/cast.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+static void BenchmarkCastToString(benchmark::State& state,  // NOLINT non-const reference
+                                  const std::shared_ptr<Array>& array) {
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Cast(&ctx, *array, utf8(), CastOptions(), &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * array->length());
+}
+
+static void CastInt32ToString(benchmark::State& state) {  // NOLINT non-const reference
+  RegressionArgs args(state);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  BenchmarkCastToString(state, rand.Int32(args.size / sizeof(int32_t), -1000000000,
+                                          1000000000, args.null_proportion));
+}
+
+static void CastInt64ToString(benchmark::State& state) {  // NOLINT non-const reference
+  RegressionArgs args(state);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  BenchmarkCastToString(
+      state, rand.Int64(args.size / sizeof(int64_t), std::numeric_limits<int64_t>::min(),
+                        std::numeric_limits<int64_t>::max(), args.null_proportion));
+}
+
+static void CastDoubleToString(benchmark::State& state) {  // NOLINT non-const reference
+  RegressionArgs args(state);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  BenchmarkCastToString(state, rand.Float64(args.size / sizeof(double), -1e6, 1e6,
+                                            args.null_proportion));
+}
+
+static void CastBooleanToString(benchmark::State& state) {  // NOLINT non-const reference
+  RegressionArgs args(state);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  BenchmarkCastToString(state, rand.Boolean(args.size, 0.5, args.null_proportion));
+}
+
+BENCHMARK(CastInt32ToString)->Apply(RegressionSetArgs);
+BENCHMARK(CastInt64ToString)->Apply(RegressionSetArgs);
+BENCHMARK(CastDoubleToString)->Apply(RegressionSetArgs);
+BENCHMARK(CastBooleanToString)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
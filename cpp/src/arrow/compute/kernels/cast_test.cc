@@ -26,9 +26,11 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -42,6 +44,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/test_util.h"
 
@@ -84,9 +87,10 @@ class TestCast : public ComputeFixture, public TestBase {
     ASSERT_RAISES(Invalid, Cast(&ctx_, *input, out_type, options, &result));
   }
 
-  void CheckZeroCopy(const Array& input, const std::shared_ptr<DataType>& out_type) {
+  void CheckZeroCopy(const Array& input, const std::shared_ptr<DataType>& out_type,
+                     const CastOptions& options = CastOptions()) {
     std::shared_ptr<Array> result;
-    ASSERT_OK(Cast(&ctx_, input, out_type, {}, &result));
+    ASSERT_OK(Cast(&ctx_, input, out_type, options, &result));
     ASSERT_OK(result->ValidateFull());
     ASSERT_EQ(input.data()->buffers.size(), result->data()->buffers.size());
     for (size_t i = 0; i < input.data()->buffers.size(); ++i) {
@@ -156,6 +160,22 @@ class TestCast : public ComputeFixture, public TestBase {
     options.allow_invalid_utf8 = true;
     CheckCase<SourceType, std::string, DestType, std::string>(
         src_type, strings, all, dest_type, strings, options);
+    ArrayFromVector<SourceType, std::string>(src_type, all, strings, &array);
+    CheckZeroCopy(*array, dest_type, options);
+  }
+
+  template <typename SourceType, typename DestType>
+  void TestCastStringToBinary() {
+    auto src_type = TypeTraits<SourceType>::type_singleton();
+    auto dest_type = TypeTraits<DestType>::type_singleton();
+
+    std::vector<bool> valid = {1, 1, 0, 1};
+    std::vector<std::string> strings = {"Hi", "olá mundo", "", "你好世界"};
+
+    std::shared_ptr<Array> array;
+    ArrayFromVector<SourceType, std::string>(src_type, valid, strings, &array);
+    CheckZeroCopy(*array, dest_type);
+    CheckZeroCopy(*array->Slice(1), dest_type);
   }
 
   template <typename DestType>
@@ -183,6 +203,25 @@ class TestCast : public ComputeFixture, public TestBase {
                   R"(["0", "-0", "1.5", "-inf", "inf", "nan", null])");
     CheckCaseJSON(float64(), dest_type, "[0.0, -0.0, 1.5, -Inf, Inf, NaN, null]",
                   R"(["0", "-0", "1.5", "-inf", "inf", "nan", null])");
+
+    // Enough values to grow the data buffer
+    Int64Builder values_builder;
+    typename TypeTraits<DestType>::BuilderType expected_builder;
+    for (int64_t i = 0; i < 1000; ++i) {
+      if (i % 7 == 3) {
+        ASSERT_OK(values_builder.AppendNull());
+        ASSERT_OK(expected_builder.AppendNull());
+      } else {
+        const int64_t value = (i % 2 ? -1 : 1) * i * i * i * i * i;
+        ASSERT_OK(values_builder.Append(value));
+        ASSERT_OK(expected_builder.Append(std::to_string(value)));
+      }
+    }
+    std::shared_ptr<Array> values, expected;
+    ASSERT_OK(values_builder.Finish(&values));
+    ASSERT_OK(expected_builder.Finish(&expected));
+    CheckPass(*values, *expected, dest_type, CastOptions());
+    CheckPass(*values->Slice(5), *expected->Slice(5), dest_type, CastOptions());
   }
 
   template <typename DestType>
@@ -456,6 +495,38 @@ TEST_F(TestCast, IntegerSignedToUnsigned) {
       options);
 }
 
+TEST_F(TestCast, IntegerDowncastSpanningBlocks) {
+  CastOptions options;
+  options.allow_int_overflow = false;
+
+  // Several 64-bit validity blocks: all valid, mixed, all null
+  const int64_t length = 300;
+  std::vector<bool> is_valid(length, true);
+  std::vector<int32_t> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = static_cast<int32_t>(i % 100);
+    if (i >= 64 && i < 128) {
+      is_valid[i] = i % 3 != 0;
+    } else if (i >= 128 && i < 192) {
+      is_valid[i] = false;
+    }
+  }
+  // Out of range values hidden under nulls are not checked
+  values[66] = INT32_MAX;
+  values[150] = INT32_MIN;
+  CheckCase<Int32Type, int32_t, Int8Type, int8_t>(
+      int32(), values, is_valid, int8(), UnsafeVectorCast<int8_t, int32_t>(values),
+      options);
+
+  // Out of range values in all-valid and in mixed blocks fail the cast
+  std::vector<int32_t> over = values;
+  over[10] = 1000;
+  CheckFails<Int32Type>(int32(), over, is_valid, int8(), options);
+  over = values;
+  over[65] = -1000;
+  CheckFails<Int32Type>(int32(), over, is_valid, int8(), options);
+}
+
 TEST_F(TestCast, IntegerUnsignedToSigned) {
   CastOptions options;
   options.allow_int_overflow = false;
@@ -1070,6 +1141,40 @@ TEST_F(TestCast, DateTimeZeroCopy) {
   CheckZeroCopy(*arr, duration(TimeUnit::MILLI));
 }
 
+TEST_F(TestCast, TimestampTimeZoneZeroCopy) {
+  std::vector<bool> is_valid = {true, false, true};
+  std::vector<int64_t> values = {0, 70000, -2000};
+  std::shared_ptr<Array> arr;
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), is_valid, values,
+                                          &arr);
+
+  CheckZeroCopy(*arr, timestamp(TimeUnit::MILLI, "Europe/Paris"));
+  CheckZeroCopy(*arr->Slice(1), timestamp(TimeUnit::MILLI, "UTC"));
+
+  // Changing the unit converts the values
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Cast(&ctx_, *arr, timestamp(TimeUnit::MICRO, "UTC"), {}, &result));
+  ASSERT_NE(arr->data()->buffers[1], result->data()->buffers[1]);
+}
+
+TEST_F(TestCast, ExtensionZeroCopy) {
+  auto ext_type = smallint();
+  auto storage = ArrayFromJSON(int16(), "[1, null, -3]");
+
+  CheckZeroCopy(*storage, ext_type);
+  std::shared_ptr<Array> ext_array;
+  ASSERT_OK(Cast(&ctx_, *storage, ext_type, {}, &ext_array));
+  ASSERT_EQ(Type::EXTENSION, ext_array->type_id());
+  CheckZeroCopy(*ext_array, int16());
+  CheckZeroCopy(*ext_array->Slice(1), int16());
+
+  // Other casts aren't supported
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(NotImplemented, Cast(&ctx_, *ext_array, int32(), {}, &result));
+  ASSERT_RAISES(NotImplemented,
+                Cast(&ctx_, *ArrayFromJSON(int32(), "[1]"), ext_type, {}, &result));
+}
+
 TEST_F(TestCast, PreallocatedMemory) {
   CastOptions options;
   options.allow_int_overflow = false;
@@ -1217,6 +1322,19 @@ TEST_F(TestCast, StringToNumberErrors) {
   CheckFails<StringType, std::string>(utf8(), {"-1"}, is_valid, uint8(), options);
 
   CheckFails<StringType, std::string>(utf8(), {"z"}, is_valid, float32(), options);
+
+  // The first invalid value is reported, invalid values in null slots are ignored
+  std::shared_ptr<Array> input, result;
+  ArrayFromVector<StringType, std::string>(utf8(), {true, false, true, true, true},
+                                           {"1", "x", "12345678", "1234567y", "z"},
+                                           &input);
+  for (const auto& type : {int32(), int64(), float64(), timestamp(TimeUnit::SECOND)}) {
+    Status st = Cast(&ctx_, *input, type, options, &result);
+    ASSERT_RAISES(Invalid, st);
+    ASSERT_NE(st.message().find(type->id() == Type::TIMESTAMP ? "'1'" : "'1234567y'"),
+              std::string::npos)
+        << st.ToString();
+  }
 }
 
 TEST_F(TestCast, StringToTimestamp) { TestCastStringToTimestamp<StringType>(); }
@@ -1241,6 +1359,12 @@ TEST_F(TestCast, LargeBinaryToLargeString) {
   TestCastBinaryToString<LargeBinaryType, LargeStringType>();
 }
 
+TEST_F(TestCast, StringToBinary) { TestCastStringToBinary<StringType, BinaryType>(); }
+
+TEST_F(TestCast, LargeStringToLargeBinary) {
+  TestCastStringToBinary<LargeStringType, LargeBinaryType>();
+}
+
 TEST_F(TestCast, NumberToString) { TestCastNumberToString<StringType>(); }
 
 TEST_F(TestCast, NumberToLargeString) { TestCastNumberToString<LargeStringType>(); }
@@ -1469,6 +1593,21 @@ TYPED_TEST(TestDictionaryCast, OutTypeError) {
                 GetCastFunction(*in_type, out_type, CastOptions(), &kernel));
 }
 
+TEST_F(TestCast, DictionaryUnpackParallel) {
+  // Long enough for several slices, with an offset and null indices
+  const int64_t length = (1 << 17) + 5;
+  random::RandomArrayGenerator rand(0x81f3);
+  auto indices = rand.Int32(length + 3, 0, 99, 0.05)->Slice(3);
+  ctx_.set_use_threads(true);
+  for (const auto& dict : {rand.String(100, 0, 12, 0), rand.Int64(100, -10, 10, 0)}) {
+    auto dict_array = std::make_shared<DictionaryArray>(
+        dictionary(int32(), dict->type()), indices, dict);
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(Take(&ctx_, *dict, *indices, TakeOptions(), &expected));
+    CheckPass(*dict_array, *expected, dict->type(), CastOptions());
+  }
+}
+
 /*TYPED_TEST(TestDictionaryCast, Reverse) {
   CastOptions options;
   std::shared_ptr<Array> plain_array =
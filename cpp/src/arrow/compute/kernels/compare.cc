@@ -21,10 +21,12 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/string_view.h"
 #include "arrow/visitor_inline.h"
 
@@ -180,6 +182,66 @@ Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   return Status::OK();
 }
 
+// Primitive values are compared in batches of kCompareBatchSize into one byte
+// per value, in loops simple enough for the compiler to vectorize, and each
+// batch is then packed into the output bitmap as a whole.
+static constexpr int64_t kCompareBatchSize = 32;
+
+// Pack kCompareBatchSize bytes (each 0 or 1) into kCompareBatchSize bits
+static inline void PackCompareBatch(const uint8_t* bytes, uint8_t* bits) {
+#if defined(ARROW_HAVE_SSE2)
+  for (int i = 0; i < kCompareBatchSize / 16; ++i) {
+    // Move each bool to the sign bit of its byte, then gather the sign bits
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i * 16));
+    const auto mask = static_cast<uint16_t>(_mm_movemask_epi8(_mm_slli_epi16(v, 7)));
+    bits[i * 2] = static_cast<uint8_t>(mask);
+    bits[i * 2 + 1] = static_cast<uint8_t>(mask >> 8);
+  }
+#else
+  for (int i = 0; i < kCompareBatchSize / 8; ++i) {
+    const uint8_t* b = bytes + i * 8;
+    bits[i] = static_cast<uint8_t>(b[0] | b[1] << 1 | b[2] << 2 | b[3] << 3 | b[4] << 4 |
+                                   b[5] << 5 | b[6] << 6 | b[7] << 7);
+  }
+#endif
+}
+
+template <CompareOperator Op, typename T, typename GetRight>
+void ComparePrimitive(const T* left, GetRight&& get_right, int64_t length,
+                      uint8_t* out_bitmap) {
+  uint8_t batch[kCompareBatchSize];
+  int64_t i = 0;
+  for (; i + kCompareBatchSize <= length; i += kCompareBatchSize) {
+    for (int64_t j = 0; j < kCompareBatchSize; ++j) {
+      batch[j] = Comparator<T, Op>::Compare(left[i + j], get_right(i + j));
+    }
+    PackCompareBatch(batch, out_bitmap + i / 8);
+  }
+  for (; i < length; ++i) {
+    BitUtil::SetBitTo(out_bitmap, i, Comparator<T, Op>::Compare(left[i], get_right(i)));
+  }
+}
+
+template <CompareOperator Op, typename T>
+Status Compare(DereferenceIncrementPointer<T>&& get_left,
+               DereferenceIncrementPointer<T>&& get_right, ArrayData* out) {
+  const T* right = get_right.ptr_;
+  ComparePrimitive<Op>(
+      get_left.ptr_, [right](int64_t i) { return right[i]; }, out->length,
+      out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
+template <CompareOperator Op, typename T>
+Status Compare(DereferenceIncrementPointer<T>&& get_left, RepeatedValue<T>&& get_right,
+               ArrayData* out) {
+  const T right = get_right.value_;
+  ComparePrimitive<Op>(
+      get_left.ptr_, [right](int64_t) { return right; }, out->length,
+      out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
 template <typename ArrowType, CompareOperator Op>
 class CompareKernel final : public BinaryKernel {
  public:
@@ -294,6 +356,16 @@ struct UnpackType {
   CompareOptions options_;
 };
 
+Status MakeCompareKernel(const DataType& type, CompareOptions options,
+                         std::shared_ptr<BinaryKernel>* out) {
+  UnpackType visitor{out, options};
+  RETURN_NOT_OK(VisitTypeInline(type, &visitor));
+  if (*out == nullptr) {
+    return Status::NotImplemented("Compare not implemented for type ", type);
+  }
+  return Status::OK();
+}
+
 // make a compare kernel and invoke it
 inline Status FinishCompare(FunctionContext* context, const Datum& left,
                             const Datum& right, CompareOptions options, Datum* out) {
@@ -307,8 +379,42 @@ inline Status FinishCompare(FunctionContext* context, const Datum& left,
       .Call(context, left, right, out);
 }
 
+// Compare the dictionary, then take the result of each index
+Status CompareDictionary(FunctionContext* context, const Datum& left,
+                         const Datum& right, CompareOptions options, Datum* out) {
+  const ArrayData& data = *left.array();
+  const auto& dict_type = checked_cast<const DictionaryType&>(*data.type);
+  if (!dict_type.value_type()->Equals(right.type())) {
+    return Status::TypeError("Cannot compare data of differing type ", *left.type(),
+                             " vs ", *right.type());
+  }
+
+  Datum dictionary_result;
+  RETURN_NOT_OK(FinishCompare(context, data.dictionary, right, options,
+                              &dictionary_result));
+  auto indices = data.Copy();
+  indices->type = dict_type.index_type();
+  indices->dictionary = nullptr;
+  // Null indices yield nulls
+  std::shared_ptr<Array> result;
+  RETURN_NOT_OK(Take(context, *dictionary_result.make_array(), *MakeArray(indices),
+                     TakeOptions(), &result));
+  *out = result;
+  return Status::OK();
+}
+
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                CompareOptions options, Datum* out) {
+  if (left.kind() == Datum::ARRAY && left.type()->id() == Type::DICTIONARY &&
+      right.is_scalar()) {
+    return CompareDictionary(context, left, right, options, out);
+  }
+  if (right.kind() == Datum::ARRAY && right.type()->id() == Type::DICTIONARY &&
+      left.is_scalar()) {
+    options.op = FlippedCompareOperator(options.op);
+    return CompareDictionary(context, right, left, options, out);
+  }
+
   if (!left.type()->Equals(right.type())) {
     return Status::TypeError("Cannot compare data of differing type ", *left.type(),
                              " vs ", *right.type());
@@ -62,6 +62,10 @@ Status MakeCompareKernel(const DataType& type, CompareOptions options,
 ///
 /// Note on floating point arrays, this uses ieee-754 compare semantics.
 ///
+/// A dictionary array can be compared with a scalar of its value type: the
+/// comparison is then evaluated once per dictionary entry and mapped over the
+/// indices.
+///
 /// \since 0.14.0
 /// \note API not yet finalized
 ARROW_EXPORT
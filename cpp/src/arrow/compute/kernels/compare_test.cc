@@ -423,6 +423,28 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, RandomCompareSlicedArrays) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  // Lengths and offsets which don't line up with the batches of the kernel
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  auto lhs = rand.Numeric<TypeParam>(200, 0, 100, 0.1);
+  auto rhs = rand.Numeric<TypeParam>(200, 0, 100, 0.1);
+  auto fifty = Datum(std::make_shared<ScalarType>(CType(50)));
+  for (int64_t offset : {0, 1, 7, 31, 33}) {
+    for (int64_t length : {1, 31, 32, 33, 100, 167}) {
+      for (auto op : {EQUAL, NOT_EQUAL, GREATER, LESS_EQUAL}) {
+        auto options = CompareOptions(op);
+        ValidateCompare<TypeParam>(&this->ctx_, options, lhs->Slice(offset, length),
+                                   fifty);
+        ValidateCompare<TypeParam>(&this->ctx_, options, lhs->Slice(offset, length),
+                                   rhs->Slice(200 - offset - length, length));
+      }
+    }
+  }
+}
+
 class TestStringCompareKernel : public ComputeFixture, public TestBase {};
 
 TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
@@ -552,5 +574,36 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, DictionaryCompareArrayScalar) {
+  // The predicate is evaluated once per dictionary entry and gathered by index
+  std::shared_ptr<Array> dict, indices, expected;
+  ArrayFromVector<StringType, std::string>({"a", "b", "c"}, &dict);
+  ArrayFromVector<Int8Type, int8_t>({true, true, false, true, true}, {0, 2, 0, 1, 0},
+                                    &indices);
+  auto arr = std::make_shared<DictionaryArray>(dictionary(int8(), utf8()), indices, dict);
+  Datum a(std::make_shared<StringScalar>("a"));
+  Datum b(std::make_shared<StringScalar>("b"));
+
+  Datum out;
+  ASSERT_OK(Compare(&ctx_, arr, a, CompareOptions(EQUAL), &out));
+  ArrayFromVector<BooleanType, bool>({true, true, false, true, true},
+                                     {true, false, false, false, true}, &expected);
+  AssertArraysEqual(*expected, *out.make_array());
+
+  // Scalar on the left: "b" > x is x < "b"
+  ASSERT_OK(Compare(&ctx_, b, arr, CompareOptions(GREATER), &out));
+  ArrayFromVector<BooleanType, bool>({true, true, false, true, true},
+                                     {true, false, false, false, true}, &expected);
+  AssertArraysEqual(*expected, *out.make_array());
+
+  ASSERT_OK(Compare(&ctx_, arr->Slice(1), b, CompareOptions(GREATER_EQUAL), &out));
+  ArrayFromVector<BooleanType, bool>({true, false, true, true},
+                                     {true, false, true, false}, &expected);
+  AssertArraysEqual(*expected, *out.make_array());
+
+  ASSERT_RAISES(TypeError, Compare(&ctx_, arr, Datum(std::make_shared<Int8Scalar>(1)),
+                                   CompareOptions(EQUAL), &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,6 +17,9 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <algorithm>
+#include <bitset>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -24,9 +27,12 @@
 
 #include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
+#include "arrow/compute/kernels/filter_internal.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -36,44 +42,135 @@ namespace compute {
 using internal::checked_cast;
 using internal::checked_pointer_cast;
 
-// IndexSequence which yields the indices of positions in a BooleanArray
-// which are either null or true
-class FilterIndexSequence {
- public:
-  // constexpr so we'll never instantiate bounds checking
-  constexpr bool never_out_of_bounds() const { return true; }
-  void set_never_out_of_bounds() {}
-
-  constexpr FilterIndexSequence() = default;
+// ----------------------------------------------------------------------
+// Compaction of the values and validity bits selected by a filter word
 
-  FilterIndexSequence(const BooleanArray& filter, int64_t out_length)
-      : filter_(&filter), out_length_(out_length) {}
+namespace {
 
-  std::pair<int64_t, bool> Next() {
-    // skip until an index is found at which the filter is either null or true
-    while (filter_->IsValid(index_) && !filter_->Value(index_)) {
-      ++index_;
+template <typename Word>
+void CompactFilterValuesScalar(const Word* values, uint64_t selection, int popcount,
+                               Word* out) {
+  if (popcount < kFilterSparseWordPopCount) {
+    for (uint64_t remaining = selection; remaining != 0; remaining &= remaining - 1) {
+      *out++ = values[BitUtil::CountTrailingZeros(remaining)];
     }
-    bool is_valid = filter_->IsValid(index_);
-    return std::make_pair(index_++, is_valid);
+    return;
+  }
+  // The values past the last selected one are neither read nor written
+  const int num_scanned = 64 - BitUtil::CountLeadingZeros(selection);
+  if (popcount > kFilterDenseWordPopCount) {
+    // Copy the runs of values between the unselected ones
+    int run_start = 0;
+    uint64_t unselected = BitUtil::TrailingBits(~selection, num_scanned);
+    for (; unselected != 0; unselected &= unselected - 1) {
+      const int run_end = BitUtil::CountTrailingZeros(unselected);
+      std::memcpy(out, values + run_start,
+                  static_cast<size_t>(run_end - run_start) * sizeof(Word));
+      out += run_end - run_start;
+      run_start = run_end + 1;
+    }
+    std::memcpy(out, values + run_start,
+                static_cast<size_t>(num_scanned - run_start) * sizeof(Word));
+    return;
+  }
+  // Write every value without branching, the output only advancing past
+  // the selected ones
+  int64_t k = 0;
+  for (int j = 0; j < num_scanned; ++j) {
+    out[k] = values[j];
+    k += (selection >> j) & 1;
   }
+}
 
-  int64_t length() const { return out_length_; }
+uint64_t CompactFilterBitsScalar(uint64_t bits, uint64_t selection) {
+  uint64_t compacted = 0;
+  int k = 0;
+  for (uint64_t remaining = selection; remaining != 0; remaining &= remaining - 1) {
+    compacted |= ((bits >> BitUtil::CountTrailingZeros(remaining)) & 1) << k++;
+  }
+  return compacted;
+}
 
-  int64_t null_count() const { return filter_->null_count(); }
+template <typename Word>
+struct CompactFilterValuesDispatch {
+  using FunctionType = CompactFilterValuesFunc<Word>;
 
- private:
-  const BooleanArray* filter_ = nullptr;
-  int64_t index_ = 0, out_length_ = -1;
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {{internal::DispatchLevel::NONE, CompactFilterValuesScalar<Word>}};
+  }
+};
+
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+// Compressing 1 and 2 byte values requires AVX512-VBMI2, which isn't targeted
+template <>
+struct CompactFilterValuesDispatch<uint32_t> {
+  using FunctionType = CompactFilterValuesFunc<uint32_t>;
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {{internal::DispatchLevel::NONE, CompactFilterValuesScalar<uint32_t>},
+            {internal::DispatchLevel::AVX512, CompactFilterValuesAvx512}};
+  }
+};
+
+template <>
+struct CompactFilterValuesDispatch<uint64_t> {
+  using FunctionType = CompactFilterValuesFunc<uint64_t>;
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {{internal::DispatchLevel::NONE, CompactFilterValuesScalar<uint64_t>},
+            {internal::DispatchLevel::AVX512, CompactFilterValuesAvx512}};
+  }
+};
+#endif
+
+struct CompactFilterBitsDispatch {
+  using FunctionType = CompactFilterBitsFunc;
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+        {internal::DispatchLevel::NONE, CompactFilterBitsScalar},
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+        {internal::DispatchLevel::AVX512, CompactFilterBitsAvx512},
+#endif
+    };
+  }
 };
 
-// TODO(bkietz) this can be optimized
+}  // namespace
+
+template <typename Word>
+CompactFilterValuesFunc<Word> GetCompactFilterValues() {
+  static internal::DynamicDispatch<CompactFilterValuesDispatch<Word>> dispatch;
+  return dispatch.func;
+}
+
+template CompactFilterValuesFunc<uint8_t> GetCompactFilterValues<uint8_t>();
+template CompactFilterValuesFunc<uint16_t> GetCompactFilterValues<uint16_t>();
+template CompactFilterValuesFunc<uint32_t> GetCompactFilterValues<uint32_t>();
+template CompactFilterValuesFunc<uint64_t> GetCompactFilterValues<uint64_t>();
+
+CompactFilterBitsFunc GetCompactFilterBits() {
+  static internal::DynamicDispatch<CompactFilterBitsDispatch> dispatch;
+  return dispatch.func;
+}
+
+// ----------------------------------------------------------------------
+
+// The number of slots which are either null or true, counted a word at a time
 static int64_t OutputSize(const BooleanArray& filter) {
+  if (filter.null_count() == 0) {
+    return internal::CountSetBits(filter.values()->data(), filter.offset(),
+                                  filter.length());
+  }
+  const FilterIndexSequence sequence(filter, -1);
   int64_t size = 0;
-  for (auto i = 0; i < filter.length(); ++i) {
-    if (filter.IsNull(i) || filter.Value(i)) {
-      ++size;
-    }
+  for (int64_t position = 0; position < filter.length(); position += 64) {
+    const int64_t num_bits = std::min<int64_t>(64, filter.length() - position);
+    size += std::bitset<64>(sequence.SelectionWord(position, num_bits)).count();
   }
   return size;
 }
@@ -155,10 +252,11 @@ Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filte
 
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
   auto out_length = OutputSize(*filter_array);
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    RETURN_NOT_OK(kernels[i]->Filter(ctx, *batch.column(i), *filter_array, out_length,
-                                     &columns[i]));
-  }
+  RETURN_NOT_OK(detail::ParallelForEach(
+      ctx, batch.num_columns(), [&](FunctionContext* task_ctx, int i) {
+        return kernels[i]->Filter(task_ctx, *batch.column(i), *filter_array, out_length,
+                                  &columns[i]);
+      }));
 
   *out = RecordBatch::Make(batch.schema(), out_length, columns);
   return Status::OK();
@@ -171,18 +269,21 @@ Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& fil
   }
   auto num_chunks = values.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<Array> current_chunk;
+  std::vector<int64_t> offsets(num_chunks);
   int64_t offset = 0;
-  int64_t len;
-
   for (int i = 0; i < num_chunks; i++) {
-    current_chunk = values.chunk(i);
-    len = current_chunk->length();
-    RETURN_NOT_OK(
-        Filter(ctx, *current_chunk, *filter.Slice(offset, len), &new_chunks[i]));
-    offset += len;
+    offsets[i] = offset;
+    offset += values.chunk(i)->length();
   }
 
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, num_chunks, [&](FunctionContext* task_ctx, int i) {
+        const auto& current_chunk = values.chunk(i);
+        return Filter(task_ctx, *current_chunk,
+                      *filter.Slice(offsets[i], current_chunk->length()),
+                      &new_chunks[i]);
+      }));
+
   *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
   return Status::OK();
 }
@@ -194,32 +295,34 @@ Status Filter(FunctionContext* ctx, const ChunkedArray& values,
   }
   auto num_chunks = values.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<Array> current_chunk;
-  std::shared_ptr<ChunkedArray> current_chunked_filter;
-  std::shared_ptr<Array> current_filter;
+  std::vector<int64_t> offsets(num_chunks);
   int64_t offset = 0;
-  int64_t len;
-
   for (int i = 0; i < num_chunks; i++) {
-    current_chunk = values.chunk(i);
-    len = current_chunk->length();
-    if (len > 0) {
-      current_chunked_filter = filter.Slice(offset, len);
-      if (current_chunked_filter->num_chunks() == 1) {
-        current_filter = current_chunked_filter->chunk(0);
-      } else {
-        // Concatenate the chunks of the filter so we have an Array
-        RETURN_NOT_OK(Concatenate(current_chunked_filter->chunks(), default_memory_pool(),
-                                  &current_filter));
-      }
-      RETURN_NOT_OK(Filter(ctx, *current_chunk, *current_filter, &new_chunks[i]));
-      offset += len;
-    } else {
-      // Put a zero length array there, which we know our current chunk to be
-      new_chunks[i] = current_chunk;
-    }
+    offsets[i] = offset;
+    offset += values.chunk(i)->length();
   }
 
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, num_chunks, [&](FunctionContext* task_ctx, int i) {
+        const auto& current_chunk = values.chunk(i);
+        const int64_t len = current_chunk->length();
+        if (len == 0) {
+          // Put a zero length array there, which we know our current chunk to be
+          new_chunks[i] = current_chunk;
+          return Status::OK();
+        }
+        auto current_chunked_filter = filter.Slice(offsets[i], len);
+        std::shared_ptr<Array> current_filter;
+        if (current_chunked_filter->num_chunks() == 1) {
+          current_filter = current_chunked_filter->chunk(0);
+        } else {
+          // Concatenate the chunks of the filter so we have an Array
+          RETURN_NOT_OK(Concatenate(current_chunked_filter->chunks(),
+                                    default_memory_pool(), &current_filter));
+        }
+        return Filter(task_ctx, *current_chunk, *current_filter, &new_chunks[i]);
+      }));
+
   *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
   return Status::OK();
 }
@@ -230,9 +333,10 @@ Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
 
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Filter(ctx, *table.column(j), filter, &columns[j]));
-  }
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, ncols, [&](FunctionContext* task_ctx, int j) {
+        return Filter(task_ctx, *table.column(j), filter, &columns[j]);
+      }));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
@@ -243,9 +347,10 @@ Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filt
 
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Filter(ctx, *table.column(j), filter, &columns[j]));
-  }
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, ncols, [&](FunctionContext* task_ctx, int j) {
+        return Filter(task_ctx, *table.column(j), filter, &columns[j]);
+      }));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Built with the AVX-512 flags, see ARROW_AVX512_FLAG
+
+#include <immintrin.h>
+
+#include "arrow/compute/kernels/filter_internal.h"
+
+namespace arrow {
+namespace compute {
+
+// The values are loaded and compressed a vector at a time. The loads are
+// masked so as not to read past the last selected value.
+
+void CompactFilterValuesAvx512(const uint32_t* values, uint64_t selection, int popcount,
+                               uint32_t* out) {
+  for (int i = 0; i < 64; i += 16) {
+    const auto mask = static_cast<__mmask16>(selection >> i);
+    if (mask != 0) {
+      const __m512i vector = _mm512_maskz_loadu_epi32(mask, values + i);
+      _mm512_mask_compressstoreu_epi32(out, mask, vector);
+      out += _mm_popcnt_u32(mask);
+    }
+  }
+}
+
+void CompactFilterValuesAvx512(const uint64_t* values, uint64_t selection, int popcount,
+                               uint64_t* out) {
+  for (int i = 0; i < 64; i += 8) {
+    const auto mask = static_cast<__mmask8>(selection >> i);
+    if (mask != 0) {
+      const __m512i vector = _mm512_maskz_loadu_epi64(mask, values + i);
+      _mm512_mask_compressstoreu_epi64(out, mask, vector);
+      out += _mm_popcnt_u32(mask);
+    }
+  }
+}
+
+uint64_t CompactFilterBitsAvx512(uint64_t bits, uint64_t selection) {
+  return _pext_u64(bits, selection);
+}
+
+}  // namespace compute
+}  // namespace arrow
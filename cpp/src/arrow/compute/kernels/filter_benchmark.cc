@@ -29,7 +29,9 @@ namespace compute {
 
 constexpr auto kSeed = 0x0ff1ce;
 
-static void FilterInt64(benchmark::State& state) {
+// The selectivity is the probability of a filter slot being true (the
+// generator takes the probability of a false slot)
+static void FilterInt64(benchmark::State& state, double selectivity) {
   RegressionArgs args(state);
 
   const int64_t array_size = args.size / sizeof(int64_t);
@@ -37,7 +39,7 @@ static void FilterInt64(benchmark::State& state) {
   auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
       rand.Int64(array_size, -100, 100, args.null_proportion));
   auto filter = std::static_pointer_cast<BooleanArray>(
-      rand.Boolean(array_size, 0.75, args.null_proportion));
+      rand.Boolean(array_size, 1.0 - selectivity, args.null_proportion));
 
   FunctionContext ctx;
   for (auto _ : state) {
@@ -68,7 +70,7 @@ static void FilterFixedSizeList1Int64(benchmark::State& state) {
   }
 }
 
-static void FilterString(benchmark::State& state) {
+static void FilterString(benchmark::State& state, double selectivity) {
   RegressionArgs args(state);
 
   int32_t string_min_length = 0, string_max_length = 128;
@@ -82,7 +84,7 @@ static void FilterString(benchmark::State& state) {
   auto array = std::static_pointer_cast<StringArray>(rand.String(
       array_size, string_min_length, string_max_length, args.null_proportion));
   auto filter = std::static_pointer_cast<BooleanArray>(
-      rand.Boolean(array_size, 0.75, args.null_proportion));
+      rand.Boolean(array_size, 1.0 - selectivity, args.null_proportion));
 
   FunctionContext ctx;
   for (auto _ : state) {
@@ -92,26 +94,26 @@ static void FilterString(benchmark::State& state) {
   }
 }
 
-BENCHMARK(FilterInt64)
-    ->Apply(RegressionSetArgs)
-    ->Args({1 << 20, 1})
-    ->Args({1 << 23, 1})
-    ->MinTime(1.0)
-    ->Unit(benchmark::TimeUnit::kNanosecond);
-
-BENCHMARK(FilterFixedSizeList1Int64)
-    ->Apply(RegressionSetArgs)
-    ->Args({1 << 20, 1})
-    ->Args({1 << 23, 1})
-    ->MinTime(1.0)
-    ->Unit(benchmark::TimeUnit::kNanosecond);
-
-BENCHMARK(FilterString)
-    ->Apply(RegressionSetArgs)
-    ->Args({1 << 20, 1})
-    ->Args({1 << 23, 1})
-    ->MinTime(1.0)
-    ->Unit(benchmark::TimeUnit::kNanosecond);
+static void FilterSetArgs(benchmark::internal::Benchmark* bench) {
+  RegressionSetArgs(bench);
+  bench->Args({1 << 20, 1})
+      ->Args({1 << 23, 1})
+      ->MinTime(1.0)
+      ->Unit(benchmark::TimeUnit::kNanosecond);
+}
+
+BENCHMARK_CAPTURE(FilterInt64, Selectivity01, 0.01)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterInt64, Selectivity10, 0.1)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterInt64, Selectivity50, 0.5)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterInt64, Selectivity75, 0.75)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterInt64, Selectivity99, 0.99)->Apply(FilterSetArgs);
+
+BENCHMARK(FilterFixedSizeList1Int64)->Apply(FilterSetArgs);
+
+BENCHMARK_CAPTURE(FilterString, Selectivity01, 0.01)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterString, Selectivity50, 0.5)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterString, Selectivity75, 0.75)->Apply(FilterSetArgs);
+BENCHMARK_CAPTURE(FilterString, Selectivity99, 0.99)->Apply(FilterSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
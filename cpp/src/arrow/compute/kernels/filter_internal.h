@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace compute {
+
+// Filtering fixed-width values proceeds a word of the filter at a time, the
+// selection of a word being its bits which are either null or true. The
+// values and validity bits of the slots selected by a partly set word are
+// compacted by these functions, which have implementations for several
+// instruction sets.
+
+// Words of a filter selecting fewer values than this are gathered bit by bit
+constexpr int kFilterSparseWordPopCount = 16;
+
+// Words of a filter selecting more values than this are copied by runs
+constexpr int kFilterDenseWordPopCount = 48;
+
+// Store the values[i] for the bits i set in selection (which has popcount
+// bits set) to out. Only the values up to the last selected one are read, and
+// only popcount values are written.
+template <typename Word>
+using CompactFilterValuesFunc = void (*)(const Word* values, uint64_t selection,
+                                         int popcount, Word* out);
+
+// Pack the bits of `bits` at the positions set in selection
+using CompactFilterBitsFunc = uint64_t (*)(uint64_t bits, uint64_t selection);
+
+// The implementations for the best instruction set supported at runtime,
+// instantiated for unsigned integers of 1, 2, 4 and 8 bytes
+template <typename Word>
+CompactFilterValuesFunc<Word> GetCompactFilterValues();
+
+CompactFilterBitsFunc GetCompactFilterBits();
+
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+void CompactFilterValuesAvx512(const uint32_t* values, uint64_t selection, int popcount,
+                               uint32_t* out);
+void CompactFilterValuesAvx512(const uint64_t* values, uint64_t selection, int popcount,
+                               uint64_t* out);
+uint64_t CompactFilterBitsAvx512(uint64_t bits, uint64_t selection);
+#endif
+
+}  // namespace compute
+}  // namespace arrow
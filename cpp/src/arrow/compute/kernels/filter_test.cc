@@ -20,11 +20,13 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -173,6 +175,21 @@ TYPED_TEST(TestFilterKernelWithNumeric, FilterRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestFilterKernelWithNumeric, FilterSlicedRandomNumeric) {
+  // The filter is read a word at a time, at offsets which aren't multiples
+  // of 8, and selects all, most, half or few of the slots of its words
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 1000;
+  for (auto null_probability : {0.0, 0.1}) {
+    // The probability of a filter slot being false
+    for (auto filter_probability : {0.0, 0.05, 0.5, 0.9}) {
+      auto values = rand.Numeric<TypeParam>(length, 0, 127, null_probability);
+      auto filter = rand.Boolean(length + 5, filter_probability, null_probability);
+      this->ValidateFilter(values->Slice(3), filter->Slice(5, length - 3));
+    }
+  }
+}
+
 template <typename CType>
 using Comparator = bool(CType, CType);
 
@@ -450,6 +467,17 @@ TEST_F(TestFilterKernelWithStruct, FilterStruct) {
   ])");
 }
 
+class TestFilterKernelWithExtension : public TestFilterKernel<ExtensionType> {};
+
+TEST_F(TestFilterKernelWithExtension, FilterExtension) {
+  // Extension arrays are filtered by their storage
+  auto values = ExtensionArrayFromJSON(smallint(), "[1, null, 3, 4]");
+  this->AssertFilterArrays(values, ArrayFromJSON(boolean(), "[0, 1, 1, null]"),
+                           ExtensionArrayFromJSON(smallint(), "[null, 3, null]"));
+  this->AssertFilterArrays(values, ArrayFromJSON(boolean(), "[1, 0, 0, 1]"),
+                           ExtensionArrayFromJSON(smallint(), "[1, 4]"));
+}
+
 class TestFilterKernelWithUnion : public TestFilterKernel<UnionType> {};
 
 TEST_F(TestFilterKernelWithUnion, FilterUnion) {
@@ -631,5 +659,39 @@ TEST_F(TestFilterKernelWithTable, FilterTable) {
   this->AssertChunkedFilter(schm, table_json, {"[1]", "[1, 1, 1]"}, table_json);
 }
 
+TEST_F(TestFilterKernelWithTable, FilterTableUseThreads) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < 16; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int32()));
+    columns.push_back(std::make_shared<ChunkedArray>(
+        ArrayVector{rand.Int32(100, -100, 100, 0.1), rand.Int32(0, -100, 100, 0),
+                    rand.Int32(200, -100, 100, 0.1)}));
+  }
+  auto table = Table::Make(schema(fields), columns);
+  auto filter = std::make_shared<ChunkedArray>(
+      ArrayVector{rand.Boolean(150, 0.5, 0.1), rand.Boolean(150, 0.5, 0.1)});
+
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(arrow::compute::Filter(&ctx_, *table, *filter, &expected));
+  std::shared_ptr<ChunkedArray> expected_column, actual_column;
+  ASSERT_OK(arrow::compute::Filter(&ctx_, *table->column(0), *filter, &expected_column));
+
+  // Columns of a table, and chunks of a single column, are filtered in parallel
+  ctx_.set_use_threads(true);
+  ASSERT_OK(arrow::compute::Filter(&ctx_, *table, *filter, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+  ASSERT_OK(arrow::compute::Filter(&ctx_, *table->column(0), *filter, &actual_column));
+  ASSERT_OK(actual_column->ValidateFull());
+  AssertChunkedEqual(*expected_column, *actual_column);
+
+  std::shared_ptr<Array> concatenated_filter;
+  ASSERT_OK(Concatenate(filter->chunks(), default_memory_pool(), &concatenated_filter));
+  ASSERT_OK(arrow::compute::Filter(&ctx_, *table, *concatenated_filter, &actual));
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+}
+
 }  // namespace compute
 }  // namespace arrow
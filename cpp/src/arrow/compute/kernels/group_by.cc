@@ -0,0 +1,887 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BinaryMemoTable;
+using internal::BitmapReader;
+using internal::checked_cast;
+using internal::ComputeFixedSizeStringHashes;
+using internal::DictionaryTraits;
+using internal::hash_t;
+using internal::HashTraits;
+using internal::VisitHashedValues;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+
+// Assigns each value of a key column the index of its distinct value (its
+// "memo index"), in order of first appearance
+class KeyColumnEncoder {
+ public:
+  virtual ~KeyColumnEncoder() = default;
+
+  virtual Status Encode(const ArrayData& data, int32_t* memo_indices) = 0;
+
+  virtual int32_t size() const = 0;
+
+  // The type of the distinct values
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+
+  // The distinct values, in memo index order
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) const = 0;
+};
+
+template <typename Type>
+class MemoKeyColumnEncoder : public KeyColumnEncoder {
+ public:
+  using MemoTableType = typename HashTraits<Type>::MemoTableType;
+
+  MemoKeyColumnEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(pool, 0) {}
+
+  Status Encode(const ArrayData& data, int32_t* memo_indices) override {
+    out_ = memo_indices;
+    return VisitHashedValues<Type>(data, memo_table_, this);
+  }
+
+  Status VisitNull() {
+    *out_++ = memo_table_.GetOrInsertNull();
+    return Status::OK();
+  }
+
+  template <typename Value>
+  Status VisitValue(const Value& value, hash_t h) {
+    *out_++ = memo_table_.GetOrInsertHashed(value, h);
+    return Status::OK();
+  }
+
+  int32_t size() const override { return memo_table_.size(); }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) const override {
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, memo_table_,
+                                                          0 /* start_offset */, out);
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTableType memo_table_;
+  int32_t* out_ = NULLPTR;
+};
+
+// Encodes dictionary keys through their indices: each dictionary entry is
+// memoized once, when its index first appears, and the memo indices of the
+// entries seen are kept for as long as batches share the same dictionary.
+// The distinct values are output decoded, and dense arrays of the value type
+// (as given by Merge) are encoded as well.
+class DictionaryKeyColumnEncoder : public KeyColumnEncoder {
+ public:
+  DictionaryKeyColumnEncoder(std::unique_ptr<KeyColumnEncoder> values, MemoryPool* pool)
+      : values_(std::move(values)), ctx_(pool) {}
+
+  Status Encode(const ArrayData& data, int32_t* memo_indices) override {
+    if (data.type->id() != Type::DICTIONARY) {
+      return values_->Encode(data, memo_indices);
+    }
+    if (data.dictionary != dictionary_) {
+      dictionary_ = data.dictionary;
+      entry_memo_indices_.assign(dictionary_->length(), kUnseen);
+      null_memo_index_ = kUnseen;
+    }
+    switch (checked_cast<const DictionaryType&>(*data.type).index_type()->id()) {
+      case Type::INT8:
+        return EncodeIndices<int8_t>(data, memo_indices);
+      case Type::INT16:
+        return EncodeIndices<int16_t>(data, memo_indices);
+      case Type::INT32:
+        return EncodeIndices<int32_t>(data, memo_indices);
+      case Type::INT64:
+        return EncodeIndices<int64_t>(data, memo_indices);
+      default:
+        return Status::TypeError("Invalid index type: ", data.type->ToString());
+    }
+  }
+
+  int32_t size() const override { return values_->size(); }
+
+  std::shared_ptr<DataType> out_type() const override { return values_->out_type(); }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) const override {
+    return values_->GetUniques(out);
+  }
+
+ private:
+  enum : int32_t { kUnseen = -1, kPending = -2 };
+
+  template <typename IndexCType>
+  Status EncodeIndices(const ArrayData& data, int32_t* memo_indices) {
+    const IndexCType* indices = data.GetValues<IndexCType>(1);
+    const uint8_t* valid_bits =
+        data.GetNullCount() != 0 ? data.buffers[0]->data() : NULLPTR;
+    auto is_valid = [&](int64_t i) {
+      return valid_bits == NULLPTR || BitUtil::GetBit(valid_bits, data.offset + i);
+    };
+
+    // Collect the entries (and null) seen for the first time, in order of
+    // appearance so that groups are numbered as for dense keys
+    Int32Builder new_entries(ctx_.memory_pool());
+    for (int64_t i = 0; i < data.length; ++i) {
+      int32_t* memo_index =
+          is_valid(i) ? &entry_memo_indices_[indices[i]] : &null_memo_index_;
+      if (ARROW_PREDICT_FALSE(*memo_index == kUnseen)) {
+        *memo_index = kPending;
+        RETURN_NOT_OK(is_valid(i) ? new_entries.Append(static_cast<int32_t>(indices[i]))
+                                  : new_entries.AppendNull());
+      }
+    }
+    if (new_entries.length() > 0) {
+      // Memoize the values of the new entries
+      std::shared_ptr<Array> entries, values;
+      RETURN_NOT_OK(new_entries.Finish(&entries));
+      RETURN_NOT_OK(Take(&ctx_, *dictionary_, *entries, TakeOptions(), &values));
+      std::vector<int32_t> entry_memo_indices(entries->length());
+      RETURN_NOT_OK(values_->Encode(*values->data(), entry_memo_indices.data()));
+      const auto& entry_indices = checked_cast<const Int32Array&>(*entries);
+      for (int64_t k = 0; k < entries->length(); ++k) {
+        int32_t* memo_index = entry_indices.IsValid(k)
+                                  ? &entry_memo_indices_[entry_indices.Value(k)]
+                                  : &null_memo_index_;
+        *memo_index = entry_memo_indices[k];
+      }
+    }
+
+    for (int64_t i = 0; i < data.length; ++i) {
+      memo_indices[i] = is_valid(i) ? entry_memo_indices_[indices[i]] : null_memo_index_;
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<KeyColumnEncoder> values_;
+  FunctionContext ctx_;
+  std::shared_ptr<Array> dictionary_;
+  // The memo index of each dictionary entry, or kUnseen
+  std::vector<int32_t> entry_memo_indices_;
+  int32_t null_memo_index_ = kUnseen;
+};
+
+struct KeyColumnEncoderMaker {
+  template <typename T>
+  enable_if_memoize<T, Status> Visit(const T&) {
+    out->reset(new MemoKeyColumnEncoder<T>(type, pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& dict_type) {
+    std::unique_ptr<KeyColumnEncoder> values;
+    KeyColumnEncoderMaker maker{dict_type.value_type(), pool, &values};
+    RETURN_NOT_OK(VisitTypeInline(*dict_type.value_type(), &maker));
+    out->reset(new DictionaryKeyColumnEncoder(std::move(values), pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("Grouping by keys of type ", type->ToString());
+  }
+
+  std::shared_ptr<DataType> type;
+  MemoryPool* pool;
+  std::unique_ptr<KeyColumnEncoder>* out;
+};
+
+// Assigns each row a group id from the values of all its key columns.
+//
+// With a single key column the group id is the memo index of the key. With
+// several, the memo indices of a row are concatenated and memoized again in
+// a BinaryMemoTable, whose values then record the key indices of each group.
+class GroupKeyEncoder {
+ public:
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types,
+              MemoryPool* pool) {
+    for (const auto& type : key_types) {
+      std::unique_ptr<KeyColumnEncoder> encoder;
+      KeyColumnEncoderMaker maker{type, pool, &encoder};
+      RETURN_NOT_OK(VisitTypeInline(*type, &maker));
+      columns_.push_back(std::move(encoder));
+    }
+    if (columns_.size() > 1) {
+      groups_.reset(new BinaryMemoTable(pool, 0));
+    }
+    return Status::OK();
+  }
+
+  Status Encode(const std::vector<std::shared_ptr<Array>>& keys,
+                std::vector<int32_t>* group_ids) {
+    const int64_t length = keys[0]->length();
+    group_ids->resize(length);
+    if (columns_.size() == 1) {
+      return columns_[0]->Encode(*keys[0]->data(), group_ids->data());
+    }
+
+    const size_t num_columns = columns_.size();
+    memo_indices_.resize(length);
+    row_indices_.resize(length * num_columns);
+    for (size_t col = 0; col < num_columns; ++col) {
+      RETURN_NOT_OK(columns_[col]->Encode(*keys[col]->data(), memo_indices_.data()));
+      for (int64_t i = 0; i < length; ++i) {
+        row_indices_[i * num_columns + col] = memo_indices_[i];
+      }
+    }
+    const auto row_size = static_cast<int32_t>(num_columns * sizeof(int32_t));
+    const auto rows = reinterpret_cast<const uint8_t*>(row_indices_.data());
+    row_hashes_.resize(length);
+    ComputeFixedSizeStringHashes<0>(rows, row_size, length, row_hashes_.data());
+    for (int64_t i = 0; i < length; ++i) {
+      (*group_ids)[i] =
+          groups_->GetOrInsertHashed(rows + i * row_size, row_size, row_hashes_[i]);
+    }
+    return Status::OK();
+  }
+
+  int32_t num_groups() const {
+    return groups_ ? groups_->size() : columns_[0]->size();
+  }
+
+  // The key values of each group, one array per key column
+  Status GetKeys(FunctionContext* ctx, std::vector<std::shared_ptr<Array>>* out) const {
+    out->clear();
+    if (columns_.size() == 1) {
+      std::shared_ptr<ArrayData> uniques;
+      RETURN_NOT_OK(columns_[0]->GetUniques(&uniques));
+      out->push_back(MakeArray(uniques));
+      return Status::OK();
+    }
+
+    const int32_t num_groups = groups_->size();
+    const size_t num_columns = columns_.size();
+    std::vector<int32_t> group_rows(num_groups * num_columns);
+    groups_->CopyValues(reinterpret_cast<uint8_t*>(group_rows.data()));
+    for (size_t col = 0; col < num_columns; ++col) {
+      std::shared_ptr<ArrayData> uniques;
+      RETURN_NOT_OK(columns_[col]->GetUniques(&uniques));
+
+      std::shared_ptr<Buffer> indices_buffer;
+      RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), num_groups * sizeof(int32_t),
+                                   &indices_buffer));
+      auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+      for (int32_t g = 0; g < num_groups; ++g) {
+        indices[g] = group_rows[g * num_columns + col];
+      }
+      Int32Array indices_array(num_groups, indices_buffer);
+
+      std::shared_ptr<Array> keys;
+      RETURN_NOT_OK(
+          Take(ctx, *MakeArray(uniques), indices_array, TakeOptions(), &keys));
+      out->push_back(std::move(keys));
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<KeyColumnEncoder>> columns_;
+  std::unique_ptr<BinaryMemoTable> groups_;
+  // Scratch space for Encode() with several key columns
+  std::vector<int32_t> memo_indices_;
+  std::vector<int32_t> row_indices_;
+  std::vector<hash_t> row_hashes_;
+};
+
+// ----------------------------------------------------------------------
+// Aggregation states
+
+// Holds an aggregate for each group, grown as new groups appear
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Update the aggregates with the values of a batch, the group of row i
+  // being group_ids[i]
+  virtual Status Consume(const ArrayData& argument, const int32_t* group_ids) = 0;
+
+  // Merge the aggregates of another instance, whose group g corresponds to
+  // group group_id_mapping[g] of this one
+  virtual void Merge(const GroupedAggregator& other,
+                     const int32_t* group_id_mapping) = 0;
+
+  virtual Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call visit(group_id, value) for each non-null value of a numeric array
+template <typename Type, typename Visit>
+void VisitGroupedValues(const ArrayData& data, const int32_t* group_ids,
+                        Visit&& visit) {
+  using c_type = typename Type::c_type;
+  const c_type* values = data.GetValues<c_type>(1);
+  if (data.GetNullCount() != 0) {
+    BitmapReader valid_reader(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (valid_reader.IsSet()) {
+        visit(group_ids[i], values[i]);
+      }
+      valid_reader.Next();
+    }
+  } else {
+    for (int64_t i = 0; i < data.length; ++i) {
+      visit(group_ids[i], values[i]);
+    }
+  }
+}
+
+class GroupedCount : public GroupedAggregator {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  Status Consume(const ArrayData& argument, const int32_t* group_ids) override {
+    if (argument.type->id() == Type::NA) {
+      return Status::OK();
+    }
+    if (argument.GetNullCount() != 0) {
+      BitmapReader valid_reader(argument.buffers[0]->data(), argument.offset,
+                                argument.length);
+      for (int64_t i = 0; i < argument.length; ++i) {
+        counts_[group_ids[i]] += valid_reader.IsSet();
+        valid_reader.Next();
+      }
+    } else {
+      for (int64_t i = 0; i < argument.length; ++i) {
+        ++counts_[group_ids[i]];
+      }
+    }
+    return Status::OK();
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_counts = checked_cast<const GroupedCount&>(other).counts_;
+    for (size_t g = 0; g < other_counts.size(); ++g) {
+      counts_[group_id_mapping[g]] += other_counts[g];
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(builder.AppendValues(counts_));
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedSum : public GroupedAggregator {
+ public:
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const ArrayData& argument, const int32_t* group_ids) override {
+    VisitGroupedValues<ArrowType>(argument, group_ids,
+                                  [this](int32_t g, typename ArrowType::c_type value) {
+                                    sums_[g] += value;
+                                    ++counts_[g];
+                                  });
+    return Status::OK();
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_sum = checked_cast<const GroupedSum&>(other);
+    for (size_t g = 0; g < other_sum.counts_.size(); ++g) {
+      sums_[group_id_mapping[g]] += other_sum.sums_[g];
+      counts_[group_id_mapping[g]] += other_sum.counts_[g];
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    NumericBuilder<SumType> builder(pool);
+    RETURN_NOT_OK(builder.Reserve(sums_.size()));
+    for (size_t g = 0; g < sums_.size(); ++g) {
+      if (counts_[g] > 0) {
+        builder.UnsafeAppend(sums_[g]);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<SumType>::type_singleton();
+  }
+
+ private:
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedMean : public GroupedAggregator {
+ public:
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const ArrayData& argument, const int32_t* group_ids) override {
+    VisitGroupedValues<ArrowType>(argument, group_ids,
+                                  [this](int32_t g, typename ArrowType::c_type value) {
+                                    sums_[g] += static_cast<double>(value);
+                                    ++counts_[g];
+                                  });
+    return Status::OK();
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_mean = checked_cast<const GroupedMean&>(other);
+    for (size_t g = 0; g < other_mean.counts_.size(); ++g) {
+      sums_[group_id_mapping[g]] += other_mean.sums_[g];
+      counts_[group_id_mapping[g]] += other_mean.counts_[g];
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    DoubleBuilder builder(pool);
+    RETURN_NOT_OK(builder.Reserve(sums_.size()));
+    for (size_t g = 0; g < sums_.size(); ++g) {
+      if (counts_[g] > 0) {
+        builder.UnsafeAppend(sums_[g] / static_cast<double>(counts_[g]));
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  std::vector<double> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType, bool kIsMin>
+class GroupedMinOrMax : public GroupedAggregator {
+ public:
+  using CType = typename ArrowType::c_type;
+
+  void Resize(int64_t num_groups) override {
+    values_.resize(num_groups, 0);
+    has_values_.resize(num_groups, false);
+  }
+
+  Status Consume(const ArrayData& argument, const int32_t* group_ids) override {
+    VisitGroupedValues<ArrowType>(
+        argument, group_ids, [this](int32_t g, CType value) { Update(g, value); });
+    return Status::OK();
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_state = checked_cast<const GroupedMinOrMax&>(other);
+    for (size_t g = 0; g < other_state.values_.size(); ++g) {
+      if (other_state.has_values_[g]) {
+        Update(group_id_mapping[g], other_state.values_[g]);
+      }
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    NumericBuilder<ArrowType> builder(pool);
+    RETURN_NOT_OK(builder.Reserve(values_.size()));
+    for (size_t g = 0; g < values_.size(); ++g) {
+      if (has_values_[g]) {
+        builder.UnsafeAppend(values_[g]);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+ private:
+  void Update(int32_t g, CType value) {
+    if (!has_values_[g]) {
+      values_[g] = value;
+      has_values_[g] = true;
+    } else if (kIsMin ? value < values_[g] : values_[g] < value) {
+      values_[g] = value;
+    }
+  }
+
+  std::vector<CType> values_;
+  std::vector<bool> has_values_;
+};
+
+struct GroupedAggregatorMaker {
+  template <typename T>
+  using enable_if_aggregable =
+      enable_if_t<is_number_type<T>::value && !std::is_same<T, HalfFloatType>::value,
+                  Status>;
+
+  template <typename T>
+  enable_if_aggregable<T> Visit(const T&) {
+    switch (aggregate.kind) {
+      case GroupByAggregate::SUM:
+        out->reset(new GroupedSum<T>());
+        break;
+      case GroupByAggregate::MEAN:
+        out->reset(new GroupedMean<T>());
+        break;
+      case GroupByAggregate::MIN:
+        out->reset(new GroupedMinOrMax<T, true>());
+        break;
+      case GroupByAggregate::MAX:
+        out->reset(new GroupedMinOrMax<T, false>());
+        break;
+      default:
+        return Status::Invalid("Unknown aggregate kind");
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Grouped aggregation of type ", type.ToString());
+  }
+
+  const GroupByAggregate& aggregate;
+  std::unique_ptr<GroupedAggregator>* out;
+};
+
+Status MakeGroupedAggregator(const GroupByAggregate& aggregate,
+                             const std::shared_ptr<DataType>& argument_type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  if (aggregate.kind == GroupByAggregate::COUNT) {
+    out->reset(new GroupedCount());
+    return Status::OK();
+  }
+  GroupedAggregatorMaker maker{aggregate, out};
+  return VisitTypeInline(*argument_type, &maker);
+}
+
+std::string AggregateName(const GroupByAggregate& aggregate) {
+  if (!aggregate.name.empty()) {
+    return aggregate.name;
+  }
+  switch (aggregate.kind) {
+    case GroupByAggregate::COUNT:
+      return "count";
+    case GroupByAggregate::SUM:
+      return "sum";
+    case GroupByAggregate::MEAN:
+      return "mean";
+    case GroupByAggregate::MIN:
+      return "min";
+    case GroupByAggregate::MAX:
+      return "max";
+  }
+  return "";
+}
+
+// ----------------------------------------------------------------------
+// HashGroupBy implementation
+
+class HashGroupByImpl : public HashGroupBy {
+ public:
+  HashGroupByImpl(FunctionContext* ctx, std::shared_ptr<DataType> out_type)
+      : ctx_(ctx), out_type_(std::move(out_type)) {}
+
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types,
+              const std::vector<GroupByAggregate>& aggregates,
+              const std::vector<std::shared_ptr<DataType>>& argument_types) {
+    key_types_ = key_types;
+    argument_types_ = argument_types;
+    RETURN_NOT_OK(keys_.Init(key_types, ctx_->memory_pool()));
+    for (size_t i = 0; i < aggregates.size(); ++i) {
+      std::unique_ptr<GroupedAggregator> aggregator;
+      RETURN_NOT_OK(MakeGroupedAggregator(aggregates[i], argument_types[i], &aggregator));
+      aggregators_.push_back(std::move(aggregator));
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 const std::vector<std::shared_ptr<Array>>& arguments) override {
+    RETURN_NOT_OK(CheckBatch(keys, arguments));
+    RETURN_NOT_OK(keys_.Encode(keys, &group_ids_));
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+      aggregators_[i]->Resize(keys_.num_groups());
+      RETURN_NOT_OK(aggregators_[i]->Consume(*arguments[i]->data(), group_ids_.data()));
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const HashGroupBy& other) override {
+    const auto& other_impl = checked_cast<const HashGroupByImpl&>(other);
+    if (!other_impl.out_type_->Equals(*out_type_)) {
+      return Status::Invalid("Cannot merge grouped aggregations of different types");
+    }
+    // Find the groups of the other instance's keys in this instance
+    std::vector<std::shared_ptr<Array>> other_keys;
+    RETURN_NOT_OK(other_impl.keys_.GetKeys(ctx_, &other_keys));
+    std::vector<int32_t> group_id_mapping;
+    RETURN_NOT_OK(keys_.Encode(other_keys, &group_id_mapping));
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+      aggregators_[i]->Resize(keys_.num_groups());
+      aggregators_[i]->Merge(*other_impl.aggregators_[i], group_id_mapping.data());
+    }
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return keys_.num_groups(); }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(keys_.GetKeys(ctx_, &columns));
+    for (const auto& aggregator : aggregators_) {
+      // Groups may have been added after the last batch of an aggregator
+      aggregator->Resize(keys_.num_groups());
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(aggregator->Finish(ctx_->memory_pool(), &column));
+      columns.push_back(std::move(column));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto result,
+                          StructArray::Make(columns, out_type_->children()));
+    *out = std::move(result);
+    return Status::OK();
+  }
+
+ private:
+  Status CheckBatch(const std::vector<std::shared_ptr<Array>>& keys,
+                    const std::vector<std::shared_ptr<Array>>& arguments) const {
+    if (keys.size() != key_types_.size() || arguments.size() != argument_types_.size()) {
+      return Status::Invalid("GroupBy expected ", key_types_.size(), " keys and ",
+                             argument_types_.size(), " arguments, got ", keys.size(),
+                             " and ", arguments.size());
+    }
+    const int64_t length = keys[0]->length();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (!keys[i]->type()->Equals(*key_types_[i])) {
+        return Status::TypeError("GroupBy key ", i, " should be of type ",
+                                 key_types_[i]->ToString(), ", got ",
+                                 keys[i]->type()->ToString());
+      }
+      if (keys[i]->length() != length) {
+        return Status::Invalid("GroupBy keys and arguments must have the same length");
+      }
+    }
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      if (!arguments[i]->type()->Equals(*argument_types_[i])) {
+        return Status::TypeError("GroupBy argument ", i, " should be of type ",
+                                 argument_types_[i]->ToString(), ", got ",
+                                 arguments[i]->type()->ToString());
+      }
+      if (arguments[i]->length() != length) {
+        return Status::Invalid("GroupBy keys and arguments must have the same length");
+      }
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<DataType> out_type_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::shared_ptr<DataType>> argument_types_;
+  GroupKeyEncoder keys_;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators_;
+  // Scratch space for Consume()
+  std::vector<int32_t> group_ids_;
+};
+
+Status DatumToChunks(const Datum& datum, std::vector<std::shared_ptr<Array>>* out) {
+  if (datum.kind() == Datum::ARRAY) {
+    *out = {datum.make_array()};
+  } else if (datum.kind() == Datum::CHUNKED_ARRAY) {
+    *out = datum.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("GroupBy expects Array or ChunkedArray inputs");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status HashGroupBy::Make(FunctionContext* ctx,
+                         const std::vector<std::shared_ptr<DataType>>& key_types,
+                         const std::vector<GroupByAggregate>& aggregates,
+                         const std::vector<std::shared_ptr<DataType>>& argument_types,
+                         std::unique_ptr<HashGroupBy>* out) {
+  if (key_types.empty()) {
+    return Status::Invalid("GroupBy needs at least one key");
+  }
+  if (aggregates.size() != argument_types.size()) {
+    return Status::Invalid("GroupBy needs one argument per aggregate, got ",
+                           argument_types.size(), " arguments for ", aggregates.size(),
+                           " aggregates");
+  }
+
+  // Aggregators are made once for their output types, then again by Init
+  std::vector<std::shared_ptr<Field>> fields;
+  for (size_t i = 0; i < key_types.size(); ++i) {
+    // Dictionary keys are output decoded
+    const auto& key_type = key_types[i]->id() == Type::DICTIONARY
+                               ? checked_cast<const DictionaryType&>(*key_types[i])
+                                     .value_type()
+                               : key_types[i];
+    fields.push_back(field("key_" + std::to_string(i), key_type));
+  }
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    std::unique_ptr<GroupedAggregator> aggregator;
+    RETURN_NOT_OK(MakeGroupedAggregator(aggregates[i], argument_types[i], &aggregator));
+    fields.push_back(field(AggregateName(aggregates[i]), aggregator->out_type()));
+  }
+
+  std::unique_ptr<HashGroupByImpl> impl(new HashGroupByImpl(ctx, struct_(fields)));
+  RETURN_NOT_OK(impl->Init(key_types, aggregates, argument_types));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               const std::vector<Datum>& arguments, const GroupByOptions& options,
+               Datum* out) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy needs at least one key");
+  }
+  std::vector<std::shared_ptr<DataType>> key_types;
+  std::vector<std::shared_ptr<DataType>> argument_types;
+  std::vector<std::vector<std::shared_ptr<Array>>> columns;
+  const int64_t length = keys[0].length();
+  for (const auto& datum : keys) {
+    if (datum.is_arraylike()) {
+      key_types.push_back(datum.type());
+    }
+    columns.emplace_back();
+    RETURN_NOT_OK(DatumToChunks(datum, &columns.back()));
+    if (datum.length() != length) {
+      return Status::Invalid("GroupBy keys and arguments must have the same length");
+    }
+  }
+  for (const auto& datum : arguments) {
+    if (datum.is_arraylike()) {
+      argument_types.push_back(datum.type());
+    }
+    columns.emplace_back();
+    RETURN_NOT_OK(DatumToChunks(datum, &columns.back()));
+    if (datum.length() != length) {
+      return Status::Invalid("GroupBy keys and arguments must have the same length");
+    }
+  }
+
+  // Slice all columns along the same chunk boundaries, so that each chunk
+  // can be consumed as a batch
+  columns = arrow::internal::RechunkArraysConsistently(columns);
+  const int num_chunks = static_cast<int>(columns[0].size());
+  auto get_batch = [&](int chunk, std::vector<std::shared_ptr<Array>>* batch_keys,
+                       std::vector<std::shared_ptr<Array>>* batch_arguments) {
+    batch_keys->clear();
+    batch_arguments->clear();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      batch_keys->push_back(columns[i][chunk]);
+    }
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      batch_arguments->push_back(columns[keys.size() + i][chunk]);
+    }
+  };
+
+  int num_tasks = 1;
+  if (options.use_threads) {
+    num_tasks = std::max(
+        1, std::min(num_chunks, GetCpuThreadPoolCapacity()));
+  }
+  std::vector<std::unique_ptr<HashGroupBy>> partials(num_tasks);
+  for (auto& partial : partials) {
+    RETURN_NOT_OK(
+        HashGroupBy::Make(ctx, key_types, aggregates, argument_types, &partial));
+  }
+
+  // Each task consumes a contiguous range of chunks, so that merging the
+  // partial results in task order preserves the order of first appearance
+  RETURN_NOT_OK(arrow::internal::OptionalParallelFor(
+      options.use_threads, num_tasks, [&](int task) {
+        const int begin = static_cast<int>(static_cast<int64_t>(num_chunks) * task /
+                                           num_tasks);
+        const int end = static_cast<int>(static_cast<int64_t>(num_chunks) *
+                                         (task + 1) / num_tasks);
+        std::vector<std::shared_ptr<Array>> batch_keys, batch_arguments;
+        for (int chunk = begin; chunk < end; ++chunk) {
+          get_batch(chunk, &batch_keys, &batch_arguments);
+          RETURN_NOT_OK(partials[task]->Consume(batch_keys, batch_arguments));
+        }
+        return Status::OK();
+      }));
+  for (int task = 1; task < num_tasks; ++task) {
+    RETURN_NOT_OK(partials[0]->Merge(*partials[task]));
+  }
+
+  std::shared_ptr<Array> result;
+  RETURN_NOT_OK(partials[0]->Finish(&result));
+  *out = result;
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
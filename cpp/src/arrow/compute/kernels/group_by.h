@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \class GroupByAggregate
+///
+/// An aggregation computed for each group of a GroupBy. Nulls are skipped,
+/// groups without any non-null value get a null SUM, MEAN, MIN and MAX.
+struct ARROW_EXPORT GroupByAggregate {
+  enum Kind {
+    // Number of non-null values, as int64
+    COUNT = 0,
+    // Sum of numeric values, as int64, uint64 or double like Sum
+    SUM,
+    // Mean of numeric values, as double
+    MEAN,
+    // Minimum of numeric values, of the argument's type
+    MIN,
+    // Maximum of numeric values, of the argument's type
+    MAX,
+  };
+
+  explicit GroupByAggregate(Kind kind, std::string name = "")
+      : kind(kind), name(std::move(name)) {}
+
+  Kind kind;
+  /// Name of the output column, the lowercase name of the kind if empty
+  std::string name;
+};
+
+/// \class GroupByOptions
+struct ARROW_EXPORT GroupByOptions {
+  /// Consume ChunkedArray inputs in parallel on the CPU thread pool. Each task
+  /// aggregates a contiguous range of chunks into its own partial groups, which
+  /// are merged once all tasks are done.
+  bool use_threads = false;
+};
+
+/// \brief Grouped aggregation state, built incrementally
+///
+/// Rows are assigned to groups by hashing their key columns with the memo
+/// tables of util/hashing.h, null being a key value like any other. Groups
+/// are numbered in order of first appearance.
+///
+/// An instance isn't thread-safe: parallel callers should consume into
+/// separate instances (made with the same types and aggregates) and Merge
+/// them.
+class ARROW_EXPORT HashGroupBy {
+ public:
+  virtual ~HashGroupBy() = default;
+
+  /// \brief Create a grouped aggregation
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types the types of the key columns, at least one
+  /// \param[in] aggregates the aggregations to compute
+  /// \param[in] argument_types the types of the aggregated columns, one for
+  /// each aggregate
+  /// \param[out] out the new grouped aggregation
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const std::vector<std::shared_ptr<DataType>>& argument_types,
+                     std::unique_ptr<HashGroupBy>* out);
+
+  /// \brief Consume a batch of rows
+  ///
+  /// \param[in] keys the key columns, all of the same length
+  /// \param[in] arguments the aggregated columns, of the same length as keys
+  virtual Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                         const std::vector<std::shared_ptr<Array>>& arguments) = 0;
+
+  /// \brief Merge the groups and partial aggregates of another instance
+  ///
+  /// The other instance must have been made with the same types and
+  /// aggregates. Its groups which are new to this instance are numbered after
+  /// the existing ones.
+  virtual Status Merge(const HashGroupBy& other) = 0;
+
+  /// \brief The number of groups seen so far
+  virtual int64_t num_groups() const = 0;
+
+  /// \brief The type of the result: a struct of the key columns (named
+  /// "key_0", "key_1"...) followed by the aggregates
+  ///
+  /// Dictionary key columns are grouped by their indices, each dictionary
+  /// entry being hashed once, and output decoded.
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+
+  /// \brief Emit a StructArray with one row per group
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+};
+
+/// \brief Compute aggregates for each distinct combination of key values
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] keys key columns, Array or ChunkedArray all of the same length
+/// \param[in] aggregates the aggregations to compute
+/// \param[in] arguments the aggregated columns, Array or ChunkedArray of the
+/// same length as the keys, one for each aggregate
+/// \param[in] options see GroupByOptions for more information
+/// \param[out] out resulting datum, a StructArray as described in
+/// HashGroupBy::out_type
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               const std::vector<Datum>& arguments, const GroupByOptions& options,
+               Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
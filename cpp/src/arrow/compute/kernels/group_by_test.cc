@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ protected:
+  void AssertGroupBy(const std::vector<Datum>& keys,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const std::vector<Datum>& arguments, const Array& expected,
+                     bool use_threads = false) {
+    GroupByOptions options;
+    options.use_threads = use_threads;
+    Datum out;
+    ASSERT_OK(GroupBy(&ctx_, keys, aggregates, arguments, options, &out));
+    std::shared_ptr<Array> result = out.make_array();
+    ASSERT_OK(result->ValidateFull());
+    AssertArraysEqual(expected, *result, /*verbose=*/true);
+  }
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2, 1, null, 2, 1, null]");
+  auto values = ArrayFromJSON(int64(), "[1, 2, 3, 4, null, 6, 7]");
+
+  auto expected_type =
+      struct_({field("key_0", int32()), field("count", int64()), field("sum", int64()),
+               field("mean", float64()), field("min", int64()), field("max", int64())});
+  auto expected = ArrayFromJSON(expected_type, R"([
+    {"key_0": 1, "count": 3, "sum": 10, "mean": 3.3333333333333335, "min": 1, "max": 6},
+    {"key_0": 2, "count": 1, "sum": 2, "mean": 2.0, "min": 2, "max": 2},
+    {"key_0": null, "count": 2, "sum": 11, "mean": 5.5, "min": 4, "max": 7}
+  ])");
+  AssertGroupBy({keys},
+                {GroupByAggregate(GroupByAggregate::COUNT),
+                 GroupByAggregate(GroupByAggregate::SUM),
+                 GroupByAggregate(GroupByAggregate::MEAN),
+                 GroupByAggregate(GroupByAggregate::MIN),
+                 GroupByAggregate(GroupByAggregate::MAX)},
+                {values, values, values, values, values}, *expected);
+}
+
+TEST_F(TestGroupBy, StringKeyAndNamedAggregates) {
+  auto keys = ArrayFromJSON(utf8(), R"(["b", "a", "b", "c"])");
+  auto values = ArrayFromJSON(float64(), "[1.5, 2.5, null, null]");
+
+  auto expected_type = struct_({field("key_0", utf8()), field("n", int64()),
+                                field("total", float64())});
+  auto expected = ArrayFromJSON(expected_type, R"([
+    {"key_0": "b", "n": 1, "total": 1.5},
+    {"key_0": "a", "n": 1, "total": 2.5},
+    {"key_0": "c", "n": 0, "total": null}
+  ])");
+  AssertGroupBy({keys},
+                {GroupByAggregate(GroupByAggregate::COUNT, "n"),
+                 GroupByAggregate(GroupByAggregate::SUM, "total")},
+                {values, values}, *expected);
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto keys0 = ArrayFromJSON(int8(), "[1, 1, 2, 1, 2, null]");
+  auto keys1 = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x", "y"])");
+  auto values = ArrayFromJSON(uint16(), "[1, 2, 3, 4, 5, 6]");
+
+  auto expected_type = struct_(
+      {field("key_0", int8()), field("key_1", utf8()), field("sum", uint64())});
+  auto expected = ArrayFromJSON(expected_type, R"([
+    {"key_0": 1, "key_1": "x", "sum": 5},
+    {"key_0": 1, "key_1": "y", "sum": 2},
+    {"key_0": 2, "key_1": "x", "sum": 8},
+    {"key_0": null, "key_1": "y", "sum": 6}
+  ])");
+  AssertGroupBy({keys0, keys1}, {GroupByAggregate(GroupByAggregate::SUM)}, {values},
+                *expected);
+}
+
+TEST_F(TestGroupBy, ChunkedInputs) {
+  auto keys = ChunkedArrayFromJSON(int64(), {"[3, 1]", "[1, 2, 3]", "[]", "[2, 4]"});
+  auto values = ChunkedArrayFromJSON(int32(), {"[1, 2, 3]", "[4, 5, 6]", "[null]"});
+
+  auto expected_type = struct_(
+      {field("key_0", int64()), field("min", int32()), field("max", int32())});
+  auto expected = ArrayFromJSON(expected_type, R"([
+    {"key_0": 3, "min": 1, "max": 5},
+    {"key_0": 1, "min": 2, "max": 3},
+    {"key_0": 2, "min": 4, "max": 6},
+    {"key_0": 4, "min": null, "max": null}
+  ])");
+  for (bool use_threads : {false, true}) {
+    AssertGroupBy({keys},
+                  {GroupByAggregate(GroupByAggregate::MIN),
+                   GroupByAggregate(GroupByAggregate::MAX)},
+                  {values, values}, *expected, use_threads);
+  }
+}
+
+TEST_F(TestGroupBy, DictionaryKeys) {
+  // Dictionary keys group like their decoded values, including across chunks
+  // with differing dictionaries
+  auto dict_type = dictionary(int8(), utf8());
+  std::shared_ptr<Array> dict1, dict2, indices1, indices2, dense1, dense2;
+  ArrayFromVector<StringType, std::string>({"z", "a", "b"}, &dict1);
+  ArrayFromVector<StringType, std::string>({"b", "c"}, &dict2);
+  ArrayFromVector<Int8Type, int8_t>({true, true, false, true, true}, {2, 1, 0, 2, 1},
+                                    &indices1);
+  ArrayFromVector<Int8Type, int8_t>({1, 0, 1}, &indices2);
+  ArrayFromVector<StringType, std::string>({true, true, false, true, true},
+                                           {"b", "a", "", "b", "a"}, &dense1);
+  ArrayFromVector<StringType, std::string>({"c", "b", "c"}, &dense2);
+  auto keys = std::make_shared<ChunkedArray>(
+      ArrayVector{std::make_shared<DictionaryArray>(dict_type, indices1, dict1),
+                  std::make_shared<DictionaryArray>(dict_type, indices2, dict2)});
+  auto dense_keys = std::make_shared<ChunkedArray>(ArrayVector{dense1, dense2});
+
+  std::shared_ptr<Array> values1, values2;
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3, 4, 5}, &values1);
+  ArrayFromVector<Int64Type, int64_t>({6, 7, 8}, &values2);
+  auto values = std::make_shared<ChunkedArray>(ArrayVector{values1, values2});
+
+  std::vector<GroupByAggregate> aggregates = {GroupByAggregate(GroupByAggregate::COUNT),
+                                              GroupByAggregate(GroupByAggregate::SUM)};
+  for (bool use_threads : {false, true}) {
+    GroupByOptions options;
+    options.use_threads = use_threads;
+    Datum expected;
+    ASSERT_OK(GroupBy(&ctx_, {dense_keys}, aggregates, {values, values}, options,
+                      &expected));
+    AssertGroupBy({keys}, aggregates, {values, values}, *expected.make_array(),
+                  use_threads);
+  }
+}
+
+TEST_F(TestGroupBy, NoAggregates) {
+  auto keys = ArrayFromJSON(boolean(), "[true, false, true, null]");
+  auto expected =
+      ArrayFromJSON(struct_({field("key_0", boolean())}),
+                    R"([{"key_0": true}, {"key_0": false}, {"key_0": null}])");
+  AssertGroupBy({keys}, {}, {}, *expected);
+}
+
+TEST_F(TestGroupBy, Merge) {
+  std::unique_ptr<HashGroupBy> left, right;
+  std::vector<GroupByAggregate> aggregates = {GroupByAggregate(GroupByAggregate::COUNT),
+                                              GroupByAggregate(GroupByAggregate::MAX)};
+  ASSERT_OK(HashGroupBy::Make(&ctx_, {int32(), utf8()}, aggregates, {int32(), int32()},
+                              &left));
+  ASSERT_OK(HashGroupBy::Make(&ctx_, {int32(), utf8()}, aggregates, {int32(), int32()},
+                              &right));
+
+  auto values = ArrayFromJSON(int32(), "[10, 20]");
+  ASSERT_OK(left->Consume(
+      {ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(utf8(), R"(["a", "b"])")},
+      {values, values}));
+  ASSERT_OK(right->Consume(
+      {ArrayFromJSON(int32(), "[3, 1]"), ArrayFromJSON(utf8(), R"(["c", "a"])")},
+      {values, values}));
+  ASSERT_EQ(2, left->num_groups());
+
+  ASSERT_OK(left->Merge(*right));
+  ASSERT_EQ(3, left->num_groups());
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(left->Finish(&result));
+  ASSERT_OK(result->ValidateFull());
+  auto expected = ArrayFromJSON(left->out_type(), R"([
+    {"key_0": 1, "key_1": "a", "count": 2, "max": 20},
+    {"key_0": 2, "key_1": "b", "count": 1, "max": 20},
+    {"key_0": 3, "key_1": "c", "count": 1, "max": 10}
+  ])");
+  AssertArraysEqual(*expected, *result, /*verbose=*/true);
+}
+
+TEST_F(TestGroupBy, Errors) {
+  Datum out;
+  auto keys = ArrayFromJSON(int32(), "[1, 2]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b"])");
+
+  // No keys
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {}, {}, {}, GroupByOptions(), &out));
+  // Mismatching lengths
+  ASSERT_RAISES(Invalid,
+                GroupBy(&ctx_, {keys}, {GroupByAggregate(GroupByAggregate::COUNT)},
+                        {ArrayFromJSON(int32(), "[1]")}, GroupByOptions(), &out));
+  // Missing argument
+  ASSERT_RAISES(Invalid,
+                GroupBy(&ctx_, {keys}, {GroupByAggregate(GroupByAggregate::COUNT)}, {},
+                        GroupByOptions(), &out));
+  // Non-numeric sum
+  ASSERT_RAISES(NotImplemented,
+                GroupBy(&ctx_, {keys}, {GroupByAggregate(GroupByAggregate::SUM)},
+                        {strings}, GroupByOptions(), &out));
+  // COUNT accepts any type
+  ASSERT_OK(GroupBy(&ctx_, {keys}, {GroupByAggregate(GroupByAggregate::COUNT)},
+                    {strings}, GroupByOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/dict_internal.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
@@ -41,6 +42,7 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
 #include "arrow/visitor_inline.h"
 
@@ -49,8 +51,13 @@ namespace arrow {
 class MemoryPool;
 
 using internal::checked_cast;
+using internal::ComputeArrayHashes;
+using internal::CopyBitmap;
 using internal::DictionaryTraits;
+using internal::hash_t;
 using internal::HashTraits;
+using internal::RadixPartitioner;
+using internal::VisitHashedValues;
 
 namespace compute {
 
@@ -282,7 +289,7 @@ class RegularHashKernelImpl : public HashKernelImpl {
 
   Status Append(const ArrayData& arr) override {
     RETURN_NOT_OK(action_.Reserve(arr.length));
-    return ArrayDataVisitor<Type>::Visit(arr, this);
+    return VisitHashedValues<Type>(arr, *memo_table_, this);
   }
 
   Status Flush(Datum* out) override { return action_.Flush(out); }
@@ -327,24 +334,24 @@ class RegularHashKernelImpl : public HashKernelImpl {
   }
 
   template <bool HasError = with_error_status>
-  enable_if_t<!HasError, Status> VisitValue(const Scalar& value) {
+  enable_if_t<!HasError, Status> VisitValue(const Scalar& value, hash_t h) {
     auto on_found = [this](int32_t memo_index) { action_.ObserveFound(memo_index); };
     auto on_not_found = [this](int32_t memo_index) {
       action_.ObserveNotFound(memo_index);
     };
 
-    memo_table_->GetOrInsert(value, on_found, on_not_found);
+    memo_table_->GetOrInsertHashed(value, h, on_found, on_not_found);
     return Status::OK();
   }
 
   template <bool HasError = with_error_status>
-  enable_if_t<HasError, Status> VisitValue(const Scalar& value) {
+  enable_if_t<HasError, Status> VisitValue(const Scalar& value, hash_t h) {
     Status s = Status::OK();
     auto on_found = [this](int32_t memo_index) { action_.ObserveFound(memo_index); };
     auto on_not_found = [this, &s](int32_t memo_index) {
       action_.ObserveNotFound(memo_index, &s);
     };
-    memo_table_->GetOrInsert(value, on_found, on_not_found);
+    memo_table_->GetOrInsertHashed(value, h, on_found, on_not_found);
     return s;
   }
 
@@ -430,6 +437,318 @@ struct HashKernelTraits<Type, Action, with_error_status, with_memo_visit_null,
                                                with_error_status, with_memo_visit_null>;
 };
 
+// ----------------------------------------------------------------------
+// Radix-partitioned hashing (see HashOptions::radix_partitioned)
+
+template <typename Type, typename Enable = void>
+struct PartitionedScalar {
+  using type = typename Type::c_type;
+};
+
+template <typename Type>
+struct PartitionedScalar<Type, enable_if_has_string_view<Type>> {
+  using type = util::string_view;
+};
+
+// The distinct values of all partitions, along with (if requested) the count
+// of each distinct value and the dictionary index of each input value
+struct PartitionedHashResult {
+  std::shared_ptr<Array> dictionary;
+  std::shared_ptr<Array> counts;
+  std::vector<std::shared_ptr<Array>> indices;
+};
+
+template <typename Type>
+class PartitionedHasher {
+ public:
+  using Scalar = typename PartitionedScalar<Type>::type;
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  // Approximate size of a memo table entry: a hash table slot (hash and memo
+  // index) at the default load factor of 2, plus the value
+  static constexpr int64_t kEntrySize =
+      2 * (sizeof(hash_t) + sizeof(int32_t)) + sizeof(Scalar);
+
+  // count_nulls: whether nulls are output as a distinct value (after all
+  // others), as by Unique and ValueCounts
+  PartitionedHasher(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                    const HashOptions& options, bool count_nulls, bool with_counts,
+                    bool with_indices)
+      : pool_(ctx->memory_pool()),
+        type_(type),
+        options_(options),
+        count_nulls_(count_nulls),
+        with_counts_(with_counts),
+        with_indices_(with_indices),
+        partitioner_(0) {}
+
+  // Scatter the non-null values of all chunks into contiguous partitions.
+  // *partitioned is false if a single partition would be used, in which case
+  // nothing more should be done with this hasher.
+  Status Partition(const std::vector<std::shared_ptr<ArrayData>>& chunks,
+                   bool* partitioned) {
+    chunks_ = chunks;
+    int64_t num_values = 0;
+    for (const auto& chunk : chunks_) {
+      num_values += chunk->length - chunk->GetNullCount();
+    }
+    partitioner_ = RadixPartitioner(RadixPartitioner::ChooseNumBits(
+        num_values, kEntrySize, options_.partition_size));
+    *partitioned = partitioner_.num_partitions() > 1;
+    if (!*partitioned) {
+      return Status::OK();
+    }
+
+    // First pass: hash the values, in input order
+    values_.reserve(num_values);
+    partitions_.reserve(num_values);
+    if (with_indices_) {
+      rows_.reserve(num_values);
+    }
+    std::vector<hash_t> hashes;
+    for (const auto& chunk : chunks_) {
+      // The memo tables use the other hash function, whose low bits pick slots
+      hashes.resize(chunk->length);
+      RETURN_NOT_OK(ComputeArrayHashes<1>(*chunk, hashes.data()));
+      chunk_hashes_ = hashes.data();
+      chunk_start_ = row_;
+      RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(*chunk, this));
+    }
+
+    // Second pass: scatter the values by partition
+    const int32_t num_partitions = partitioner_.num_partitions();
+    offsets_.assign(num_partitions + 1, 0);
+    for (int32_t partition : partitions_) {
+      ++offsets_[partition + 1];
+    }
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      offsets_[p + 1] += offsets_[p];
+    }
+    std::vector<int64_t> positions(offsets_.begin(), offsets_.end() - 1);
+    std::vector<Scalar> scattered_values(values_.size());
+    std::vector<int64_t> scattered_rows(rows_.size());
+    for (size_t i = 0; i < values_.size(); ++i) {
+      const int64_t position = positions[partitions_[i]]++;
+      scattered_values[position] = values_[i];
+      if (with_indices_) {
+        scattered_rows[position] = rows_[i];
+      }
+    }
+    values_ = std::move(scattered_values);
+    rows_ = std::move(scattered_rows);
+    partitions_.clear();
+    partitions_.shrink_to_fit();
+    return Status::OK();
+  }
+
+  // Build the memo table of each partition
+  Status Build() {
+    const int32_t num_partitions = partitioner_.num_partitions();
+    memo_tables_.resize(num_partitions);
+    memo_indices_.resize(values_.size());
+    return arrow::internal::OptionalParallelFor(
+        options_.use_threads, num_partitions, [this](int p) {
+          memo_tables_[p].reset(new MemoTable(pool_, 0));
+          for (int64_t i = offsets_[p]; i < offsets_[p + 1]; ++i) {
+            memo_indices_[i] = memo_tables_[p]->GetOrInsert(values_[i]);
+          }
+          return Status::OK();
+        });
+  }
+
+  Status Finish(PartitionedHashResult* out) {
+    const int32_t num_partitions = partitioner_.num_partitions();
+    // Partitions hold disjoint values: their dictionaries are concatenated
+    std::vector<int64_t> dict_offsets(num_partitions + 1, 0);
+    std::vector<std::shared_ptr<Array>> dictionaries;
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      std::shared_ptr<ArrayData> dictionary;
+      RETURN_NOT_OK(DictionaryTraits<Type>::GetDictionaryArrayData(
+          pool_, type_, *memo_tables_[p], 0 /* start_offset */, &dictionary));
+      dict_offsets[p + 1] = dict_offsets[p] + dictionary->length;
+      // Concatenate() doesn't accept the missing buffers of empty dictionaries
+      if (dictionary->length > 0 || (p == num_partitions - 1 && dictionaries.empty())) {
+        dictionaries.push_back(MakeArray(dictionary));
+      }
+    }
+    const bool null_entry = count_nulls_ && null_count_ > 0;
+    if (null_entry) {
+      std::shared_ptr<Array> null_array;
+      RETURN_NOT_OK(MakeArrayOfNull(pool_, type_, 1, &null_array));
+      dictionaries.push_back(std::move(null_array));
+    }
+    RETURN_NOT_OK(Concatenate(dictionaries, pool_, &out->dictionary));
+
+    if (with_counts_) {
+      std::vector<int64_t> counts(out->dictionary->length(), 0);
+      for (int32_t p = 0; p < num_partitions; ++p) {
+        for (int64_t i = offsets_[p]; i < offsets_[p + 1]; ++i) {
+          ++counts[dict_offsets[p] + memo_indices_[i]];
+        }
+      }
+      if (null_entry) {
+        counts.back() = null_count_;
+      }
+      Int64Builder builder(pool_);
+      RETURN_NOT_OK(builder.AppendValues(counts));
+      RETURN_NOT_OK(builder.Finish(&out->counts));
+    }
+
+    if (with_indices_) {
+      RETURN_NOT_OK(FinishIndices(dict_offsets, &out->indices));
+    }
+    return Status::OK();
+  }
+
+  Status VisitNull() {
+    ++null_count_;
+    ++row_;
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    values_.push_back(value);
+    partitions_.push_back(partitioner_.Partition(chunk_hashes_[row_ - chunk_start_]));
+    if (with_indices_) {
+      rows_.push_back(row_);
+    }
+    ++row_;
+    return Status::OK();
+  }
+
+ private:
+  Status FinishIndices(const std::vector<int64_t>& dict_offsets,
+                       std::vector<std::shared_ptr<Array>>* out) {
+    std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, row_ * sizeof(int32_t), &indices_buffer));
+    auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+    // Null slots are left zeroed
+    std::memset(indices, 0, row_ * sizeof(int32_t));
+    for (int32_t p = 0; p < partitioner_.num_partitions(); ++p) {
+      for (int64_t i = offsets_[p]; i < offsets_[p + 1]; ++i) {
+        indices[rows_[i]] = static_cast<int32_t>(dict_offsets[p] + memo_indices_[i]);
+      }
+    }
+
+    int64_t chunk_start = 0;
+    for (const auto& chunk : chunks_) {
+      std::shared_ptr<Buffer> null_bitmap;
+      const int64_t null_count = chunk->GetNullCount();
+      if (null_count > 0) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, CopyBitmap(pool_, chunk->buffers[0]->data(),
+                                                      chunk->offset, chunk->length));
+      }
+      auto chunk_indices = SliceBuffer(indices_buffer, chunk_start * sizeof(int32_t),
+                                       chunk->length * sizeof(int32_t));
+      out->push_back(MakeArray(ArrayData::Make(
+          int32(), chunk->length, {null_bitmap, chunk_indices}, null_count)));
+      chunk_start += chunk->length;
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<DataType> type_;
+  HashOptions options_;
+  bool count_nulls_;
+  bool with_counts_;
+  bool with_indices_;
+  RadixPartitioner partitioner_;
+  std::vector<std::shared_ptr<ArrayData>> chunks_;
+
+  // The non-null values, scattered by partition once Partition() is done:
+  // the values of partition p are values_[offsets_[p]:offsets_[p + 1]]
+  std::vector<Scalar> values_;
+  std::vector<int32_t> partitions_;
+  // The input row of each value, if with_indices_
+  std::vector<int64_t> rows_;
+  std::vector<int64_t> offsets_;
+  int64_t null_count_ = 0;
+  int64_t row_ = 0;
+  // While partitioning, the partition hashes of the chunk starting at row
+  // chunk_start_
+  const hash_t* chunk_hashes_ = NULLPTR;
+  int64_t chunk_start_ = 0;
+
+  std::vector<std::unique_ptr<MemoTable>> memo_tables_;
+  // The index of each value in the memo table of its partition
+  std::vector<int32_t> memo_indices_;
+};
+
+template <typename Type>
+Status RunPartitionedHash(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                          const std::vector<std::shared_ptr<ArrayData>>& chunks,
+                          const HashOptions& options, bool count_nulls, bool with_counts,
+                          bool with_indices, bool* partitioned,
+                          PartitionedHashResult* out) {
+  PartitionedHasher<Type> hasher(ctx, type, options, count_nulls, with_counts,
+                                 with_indices);
+  RETURN_NOT_OK(hasher.Partition(chunks, partitioned));
+  if (!*partitioned) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(hasher.Build());
+  return hasher.Finish(out);
+}
+
+// Types whose memo tables may outgrow the CPU caches (8-bit types use
+// SmallScalarMemoTable)
+#define PROCESS_PARTITIONED_HASH_TYPES(PROCESS) \
+  PROCESS(UInt16Type)                           \
+  PROCESS(Int16Type)                            \
+  PROCESS(UInt32Type)                           \
+  PROCESS(Int32Type)                            \
+  PROCESS(UInt64Type)                           \
+  PROCESS(Int64Type)                            \
+  PROCESS(FloatType)                            \
+  PROCESS(DoubleType)                           \
+  PROCESS(Date32Type)                           \
+  PROCESS(Date64Type)                           \
+  PROCESS(Time32Type)                           \
+  PROCESS(Time64Type)                           \
+  PROCESS(TimestampType)                        \
+  PROCESS(BinaryType)                           \
+  PROCESS(StringType)                           \
+  PROCESS(FixedSizeBinaryType)                  \
+  PROCESS(Decimal128Type)
+
+// Hash the input with radix partitioning if the options ask for it and the
+// input is suitable, otherwise set *partitioned to false
+Status PartitionedHash(FunctionContext* ctx, const Datum& value,
+                       const HashOptions& options, bool count_nulls, bool with_counts,
+                       bool with_indices, bool* partitioned, PartitionedHashResult* out) {
+  *partitioned = false;
+  if (!options.radix_partitioned) {
+    return Status::OK();
+  }
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    for (const auto& chunk : value.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  } else {
+    return Status::OK();
+  }
+
+  const auto& type = value.type();
+  switch (type->id()) {
+#define PROCESS(InType)                                                              \
+  case InType::type_id:                                                              \
+    return RunPartitionedHash<InType>(ctx, type, chunks, options, count_nulls,      \
+                                      with_counts, with_indices, partitioned, out);
+
+    PROCESS_PARTITIONED_HASH_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
+#undef PROCESS_PARTITIONED_HASH_TYPES
+
 }  // namespace
 
 #define PROCESS_SUPPORTED_HASH_TYPES(PROCESS) \
@@ -545,7 +864,137 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
 
 }  // namespace
 
+namespace {
+
+// Dictionary arrays are hashed by their indices, which are then wrapped with
+// the dictionary again. The chunks of a ChunkedArray with differing
+// dictionaries are first transposed to a unified dictionary.
+struct DictionaryIndices {
+  Status Init(FunctionContext* ctx, const Datum& value) {
+    if (value.kind() == Datum::ARRAY) {
+      type = value.type();
+      dictionary = value.array()->dictionary;
+      indices = IndicesData(*value.array());
+      return Status::OK();
+    }
+    if (value.kind() != Datum::CHUNKED_ARRAY) {
+      return Status::Invalid("Hashing expects array-like inputs");
+    }
+
+    const auto& chunked = *value.chunked_array();
+    type = chunked.type();
+    ArrayVector chunks = chunked.chunks();
+    bool same_dictionary = true;
+    for (const auto& chunk : chunks) {
+      const auto& chunk_dictionary = chunk->data()->dictionary;
+      const auto& first_dictionary = chunks[0]->data()->dictionary;
+      same_dictionary &= chunk_dictionary == first_dictionary ||
+                         chunk_dictionary->Equals(*first_dictionary);
+    }
+    if (chunks.empty()) {
+      const auto& value_type = checked_cast<const DictionaryType&>(*type).value_type();
+      RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), value_type, 0, &dictionary));
+    } else if (same_dictionary) {
+      dictionary = chunks[0]->data()->dictionary;
+    } else {
+      RETURN_NOT_OK(Unify(ctx, &chunks));
+    }
+    ArrayVector index_chunks;
+    for (const auto& chunk : chunks) {
+      index_chunks.push_back(MakeArray(IndicesData(*chunk->data())));
+    }
+    const auto& index_type = checked_cast<const DictionaryType&>(*type).index_type();
+    indices = std::make_shared<ChunkedArray>(std::move(index_chunks), index_type);
+    return Status::OK();
+  }
+
+  // Wrap hashed indices with the dictionary
+  std::shared_ptr<Array> Wrap(const std::shared_ptr<Array>& hashed_indices) const {
+    return std::make_shared<DictionaryArray>(type, hashed_indices, dictionary);
+  }
+
+  std::shared_ptr<DataType> type;
+  std::shared_ptr<Array> dictionary;
+  Datum indices;
+
+ private:
+  static std::shared_ptr<ArrayData> IndicesData(const ArrayData& data) {
+    auto indices = data.Copy();
+    indices->type = checked_cast<const DictionaryType&>(*data.type).index_type();
+    indices->dictionary = nullptr;
+    return indices;
+  }
+
+  Status Unify(FunctionContext* ctx, ArrayVector* chunks) {
+    const auto& value_type = checked_cast<const DictionaryType&>(*type).value_type();
+    std::unique_ptr<DictionaryUnifier> unifier;
+    RETURN_NOT_OK(DictionaryUnifier::Make(ctx->memory_pool(), value_type, &unifier));
+    std::vector<std::shared_ptr<Buffer>> transpose_maps;
+    for (const auto& chunk : *chunks) {
+      std::shared_ptr<Buffer> transpose_map;
+      RETURN_NOT_OK(unifier->Unify(*chunk->data()->dictionary, &transpose_map));
+      transpose_maps.push_back(std::move(transpose_map));
+    }
+    RETURN_NOT_OK(unifier->GetResult(&type, &dictionary));
+    for (size_t i = 0; i < chunks->size(); ++i) {
+      const auto& chunk = checked_cast<const DictionaryArray&>(*(*chunks)[i]);
+      RETURN_NOT_OK(chunk.Transpose(
+          ctx->memory_pool(), type, dictionary,
+          reinterpret_cast<const int32_t*>(transpose_maps[i]->data()), &(*chunks)[i]));
+    }
+    return Status::OK();
+  }
+};
+
+}  // namespace
+
+namespace {
+
+// Give the dictionaries of arrays encoded from extension storage the extension
+// type back
+Datum WrapExtensionDictionaries(const std::shared_ptr<DataType>& ext_type,
+                                const Datum& encoded) {
+  const Array* storage_dictionary = nullptr;
+  std::shared_ptr<Array> dictionary;
+  auto wrap = [&](const Array& chunk) -> std::shared_ptr<Array> {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(chunk);
+    if (dict_array.dictionary().get() != storage_dictionary) {
+      storage_dictionary = dict_array.dictionary().get();
+      dictionary = detail::WrapExtension(ext_type, dict_array.dictionary());
+    }
+    auto dict_type = ::arrow::dictionary(dict_array.indices()->type(), ext_type);
+    return std::make_shared<DictionaryArray>(dict_type, dict_array.indices(), dictionary);
+  };
+  if (encoded.kind() == Datum::ARRAY) {
+    return Datum(wrap(*encoded.make_array())->data());
+  }
+  ArrayVector chunks;
+  for (const auto& chunk : encoded.chunked_array()->chunks()) {
+    chunks.push_back(wrap(*chunk));
+  }
+  return Datum(std::make_shared<ChunkedArray>(std::move(chunks),
+                                              ::arrow::dictionary(int32(), ext_type)));
+}
+
+}  // namespace
+
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (value.type()->id() == Type::EXTENSION) {
+    // Equal extension values have equal storage
+    std::shared_ptr<Array> unique_storage;
+    RETURN_NOT_OK(Unique(ctx, detail::ExtensionStorage(value), &unique_storage));
+    *out = detail::WrapExtension(value.type(), unique_storage);
+    return Status::OK();
+  }
+  if (value.type()->id() == Type::DICTIONARY) {
+    DictionaryIndices dict_indices;
+    RETURN_NOT_OK(dict_indices.Init(ctx, value));
+    std::shared_ptr<Array> unique_indices;
+    RETURN_NOT_OK(Unique(ctx, dict_indices.indices, &unique_indices));
+    *out = dict_indices.Wrap(unique_indices);
+    return Status::OK();
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
@@ -554,6 +1003,13 @@ Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>*
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
+  if (value.type()->id() == Type::EXTENSION) {
+    Datum encoded_storage;
+    RETURN_NOT_OK(
+        DictionaryEncode(ctx, detail::ExtensionStorage(value), &encoded_storage));
+    *out = WrapExtensionDictionaries(value.type(), encoded_storage);
+    return Status::OK();
+  }
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
 
@@ -591,8 +1047,66 @@ const char kCountsFieldName[] = "counts";
 const int32_t kValuesFieldIndex = 0;
 const int32_t kCountsFieldIndex = 1;
 
+namespace {
+
+std::shared_ptr<Array> MakeValueCountsArray(const std::shared_ptr<Array>& uniques,
+                                            const std::shared_ptr<Array>& counts) {
+  auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
+      std::make_shared<Field>(kValuesFieldName, uniques->type()),
+      std::make_shared<Field>(kCountsFieldName, int64())});
+  return std::make_shared<StructArray>(
+      data_type, uniques->length(), std::vector<std::shared_ptr<Array>>{uniques, counts});
+}
+
+// Count the values of a dictionary array by its indices
+template <typename CountIndices>
+Status DictionaryValueCounts(FunctionContext* ctx, const Datum& value,
+                             CountIndices&& count_indices,
+                             std::shared_ptr<Array>* counts) {
+  DictionaryIndices dict_indices;
+  RETURN_NOT_OK(dict_indices.Init(ctx, value));
+  std::shared_ptr<Array> index_counts;
+  RETURN_NOT_OK(count_indices(dict_indices.indices, &index_counts));
+  const auto& struct_counts = checked_cast<const StructArray&>(*index_counts);
+  auto values = dict_indices.Wrap(struct_counts.field(kValuesFieldIndex));
+  *counts = MakeValueCountsArray(values, struct_counts.field(kCountsFieldIndex));
+  return Status::OK();
+}
+
+// Count the values of an extension array by its storage
+template <typename CountStorage>
+Status ExtensionValueCounts(const Datum& value, CountStorage&& count_storage,
+                            std::shared_ptr<Array>* counts) {
+  std::shared_ptr<Array> storage_counts;
+  RETURN_NOT_OK(count_storage(detail::ExtensionStorage(value), &storage_counts));
+  const auto& struct_counts = checked_cast<const StructArray&>(*storage_counts);
+  auto values =
+      detail::WrapExtension(value.type(), struct_counts.field(kValuesFieldIndex));
+  *counts = MakeValueCountsArray(values, struct_counts.field(kCountsFieldIndex));
+  return Status::OK();
+}
+
+}  // namespace
+
 Status ValueCounts(FunctionContext* ctx, const Datum& value,
                    std::shared_ptr<Array>* counts) {
+  if (value.type()->id() == Type::DICTIONARY) {
+    return DictionaryValueCounts(
+        ctx, value,
+        [&](const Datum& indices, std::shared_ptr<Array>* out) {
+          return ValueCounts(ctx, indices, out);
+        },
+        counts);
+  }
+  if (value.type()->id() == Type::EXTENSION) {
+    return ExtensionValueCounts(
+        value,
+        [&](const Datum& storage, std::shared_ptr<Array>* out) {
+          return ValueCounts(ctx, storage, out);
+        },
+        counts);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
 
@@ -604,12 +1118,95 @@ Status ValueCounts(FunctionContext* ctx, const Datum& value,
   Datum value_counts;
   RETURN_NOT_OK(func->FlushFinal(&value_counts));
 
-  auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
-      std::make_shared<Field>(kValuesFieldName, uniques->type()),
-      std::make_shared<Field>(kCountsFieldName, int64())});
-  *counts = std::make_shared<StructArray>(
-      data_type, uniques->length(),
-      std::vector<std::shared_ptr<Array>>{uniques, MakeArray(value_counts.array())});
+  *counts = MakeValueCountsArray(uniques, MakeArray(value_counts.array()));
+  return Status::OK();
+}
+
+Status Unique(FunctionContext* ctx, const Datum& value, const HashOptions& options,
+              std::shared_ptr<Array>* out) {
+  if (value.type()->id() == Type::EXTENSION) {
+    // Equal extension values have equal storage
+    std::shared_ptr<Array> unique_storage;
+    RETURN_NOT_OK(Unique(ctx, detail::ExtensionStorage(value), options, &unique_storage));
+    *out = detail::WrapExtension(value.type(), unique_storage);
+    return Status::OK();
+  }
+  if (value.type()->id() == Type::DICTIONARY) {
+    DictionaryIndices dict_indices;
+    RETURN_NOT_OK(dict_indices.Init(ctx, value));
+    std::shared_ptr<Array> unique_indices;
+    RETURN_NOT_OK(Unique(ctx, dict_indices.indices, options, &unique_indices));
+    *out = dict_indices.Wrap(unique_indices);
+    return Status::OK();
+  }
+
+  bool partitioned;
+  PartitionedHashResult result;
+  RETURN_NOT_OK(PartitionedHash(ctx, value, options, /*count_nulls=*/true,
+                                /*with_counts=*/false, /*with_indices=*/false,
+                                &partitioned, &result));
+  if (!partitioned) {
+    return Unique(ctx, value, out);
+  }
+  *out = std::move(result.dictionary);
+  return Status::OK();
+}
+
+Status ValueCounts(FunctionContext* ctx, const Datum& value, const HashOptions& options,
+                   std::shared_ptr<Array>* counts) {
+  if (value.type()->id() == Type::DICTIONARY) {
+    return DictionaryValueCounts(
+        ctx, value,
+        [&](const Datum& indices, std::shared_ptr<Array>* out) {
+          return ValueCounts(ctx, indices, options, out);
+        },
+        counts);
+  }
+  if (value.type()->id() == Type::EXTENSION) {
+    return ExtensionValueCounts(
+        value,
+        [&](const Datum& storage, std::shared_ptr<Array>* out) {
+          return ValueCounts(ctx, storage, options, out);
+        },
+        counts);
+  }
+
+  bool partitioned;
+  PartitionedHashResult result;
+  RETURN_NOT_OK(PartitionedHash(ctx, value, options, /*count_nulls=*/true,
+                                /*with_counts=*/true, /*with_indices=*/false,
+                                &partitioned, &result));
+  if (!partitioned) {
+    return ValueCounts(ctx, value, counts);
+  }
+  *counts = MakeValueCountsArray(result.dictionary, result.counts);
+  return Status::OK();
+}
+
+Status DictionaryEncode(FunctionContext* ctx, const Datum& value,
+                        const HashOptions& options, Datum* out) {
+  if (value.type()->id() == Type::EXTENSION) {
+    Datum encoded_storage;
+    RETURN_NOT_OK(DictionaryEncode(ctx, detail::ExtensionStorage(value), options,
+                                   &encoded_storage));
+    *out = WrapExtensionDictionaries(value.type(), encoded_storage);
+    return Status::OK();
+  }
+  bool partitioned;
+  PartitionedHashResult result;
+  RETURN_NOT_OK(PartitionedHash(ctx, value, options, /*count_nulls=*/false,
+                                /*with_counts=*/false, /*with_indices=*/true,
+                                &partitioned, &result));
+  if (!partitioned) {
+    return DictionaryEncode(ctx, value, out);
+  }
+  auto dict_type = ::arrow::dictionary(int32(), result.dictionary->type());
+  std::vector<std::shared_ptr<Array>> dict_chunks;
+  for (const auto& indices : result.indices) {
+    dict_chunks.emplace_back(
+        std::make_shared<DictionaryArray>(dict_type, indices, result.dictionary));
+  }
+  *out = detail::WrapArraysLike(value, dict_chunks);
   return Status::OK();
 }
 
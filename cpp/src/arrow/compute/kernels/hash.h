@@ -18,6 +18,7 @@
 #ifndef ARROW_COMPUTE_KERNELS_HASH_H
 #define ARROW_COMPUTE_KERNELS_HASH_H
 
+#include <cstdint>
 #include <memory>
 
 #include "arrow/compute/kernel.h"
@@ -34,10 +35,39 @@ namespace compute {
 
 class FunctionContext;
 
+/// \class HashOptions
+///
+/// Options for Unique, ValueCounts and DictionaryEncode
+struct ARROW_EXPORT HashOptions {
+  /// \brief Scatter the values into partitions by hash, then build a separate
+  /// hash table for each partition
+  ///
+  /// This keeps each hash table in the CPU cache, which pays off for inputs
+  /// with many distinct values. The distinct values are then output in an
+  /// unspecified order rather than in order of first appearance (nulls, if
+  /// counted as a value, come last). Boolean, 8-bit integer and null inputs,
+  /// and inputs small enough for a single partition, are hashed as usual.
+  bool radix_partitioned = false;
+
+  /// Target size in bytes of the hash table of each partition, e.g. the size
+  /// of the L2 cache
+  int64_t partition_size = 256 * 1024;
+
+  /// Build the hash tables of the partitions in parallel on the CPU thread pool
+  bool use_threads = true;
+
+  static HashOptions Defaults() { return HashOptions(); }
+};
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
 ///
+/// Dictionary arrays are hashed by their indices, without decoding. The
+/// result is then a DictionaryArray of the distinct indices (values repeated
+/// in the dictionary thus occur several times); the chunks of a ChunkedArray
+/// are first unified to a common dictionary if needed.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -47,6 +77,19 @@ class FunctionContext;
 ARROW_EXPORT
 Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Array>* out);
 
+/// \brief Compute unique elements from an array-like object
+///
+/// \param[in] context the FunctionContext
+/// \param[in] datum array-like input
+/// \param[in] options see HashOptions for more information
+/// \param[out] out result as Array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Unique(FunctionContext* context, const Datum& datum, const HashOptions& options,
+              std::shared_ptr<Array>* out);
+
 // Constants for accessing the output of ValueCounts
 ARROW_EXPORT extern const char kValuesFieldName[];
 ARROW_EXPORT extern const char kCountsFieldName[];
@@ -60,6 +103,8 @@ ARROW_EXPORT extern const int32_t kCountsFieldIndex;
 /// For floating point arrays there is no attempt to normalize -0.0, 0.0 and NaN values
 /// which can lead to unexpected results if the input Array has these values.
 ///
+/// Dictionary arrays are counted by their indices, see Unique().
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value array-like input
 /// \param[out] counts An array of  <input type "Values", int64_t "Counts"> structs.
@@ -70,6 +115,19 @@ ARROW_EXPORT
 Status ValueCounts(FunctionContext* context, const Datum& value,
                    std::shared_ptr<Array>* counts);
 
+/// \brief Return counts of unique elements from an array-like object.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input
+/// \param[in] options see HashOptions for more information
+/// \param[out] counts An array of  <input type "Values", int64_t "Counts"> structs.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ValueCounts(FunctionContext* context, const Datum& value,
+                   const HashOptions& options, std::shared_ptr<Array>* counts);
+
 /// \brief Dictionary-encode values in an array-like object
 /// \param[in] context the FunctionContext
 /// \param[in] data array-like input
@@ -80,6 +138,18 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
+/// \brief Dictionary-encode values in an array-like object
+/// \param[in] context the FunctionContext
+/// \param[in] data array-like input
+/// \param[in] options see HashOptions for more information
+/// \param[out] out result with same shape and type as input
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DictionaryEncode(FunctionContext* context, const Datum& data,
+                        const HashOptions& options, Datum* out);
+
 // TODO(wesm): Define API for incremental dictionary encoding
 
 // TODO(wesm): Define API for regularizing DictionaryArray objects with
@@ -0,0 +1,528 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BinaryMemoTable;
+using internal::ComputeFixedSizeStringHashes;
+using internal::hash_t;
+using internal::HashTraits;
+using internal::kKeyNotFound;
+using internal::VisitHashedValues;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+
+// Maps the values of a key column to memo indices. Build values are
+// inserted, probe values are only looked up; nulls and values missing from
+// the build side get kKeyNotFound.
+class JoinKeyColumn {
+ public:
+  virtual ~JoinKeyColumn() = default;
+
+  virtual Status Insert(const ArrayData& data, int32_t* memo_indices) = 0;
+
+  virtual Status Lookup(const ArrayData& data, int32_t* memo_indices) const = 0;
+};
+
+template <typename Type>
+class MemoJoinKeyColumn : public JoinKeyColumn {
+ public:
+  using MemoTableType = typename HashTraits<Type>::MemoTableType;
+
+  explicit MemoJoinKeyColumn(MemoryPool* pool) : memo_table_(pool, 0) {}
+
+  Status Insert(const ArrayData& data, int32_t* memo_indices) override {
+    Inserter inserter{&memo_table_, memo_indices};
+    return VisitHashedValues<Type>(data, memo_table_, &inserter);
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* memo_indices) const override {
+    Finder finder{&memo_table_, memo_indices};
+    return VisitHashedValues<Type>(data, memo_table_, &finder);
+  }
+
+ private:
+  struct Inserter {
+    Status VisitNull() {
+      *out++ = kKeyNotFound;
+      return Status::OK();
+    }
+
+    template <typename Value>
+    Status VisitValue(const Value& value, hash_t h) {
+      *out++ = memo_table->GetOrInsertHashed(value, h);
+      return Status::OK();
+    }
+
+    MemoTableType* memo_table;
+    int32_t* out;
+  };
+
+  struct Finder {
+    Status VisitNull() {
+      *out++ = kKeyNotFound;
+      return Status::OK();
+    }
+
+    template <typename Value>
+    Status VisitValue(const Value& value, hash_t h) {
+      *out++ = memo_table->GetHashed(value, h);
+      return Status::OK();
+    }
+
+    const MemoTableType* memo_table;
+    int32_t* out;
+  };
+
+  MemoTableType memo_table_;
+};
+
+struct JoinKeyColumnMaker {
+  template <typename T>
+  enable_if_memoize<T, Status> Visit(const T&) {
+    out->reset(new MemoJoinKeyColumn<T>(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Joining on keys of type ", type.ToString());
+  }
+
+  MemoryPool* pool;
+  std::unique_ptr<JoinKeyColumn>* out;
+};
+
+// Maps the key values of each row to a key id, or kKeyNotFound if any key
+// is null or (when probing) missing from the build side.
+//
+// With several key columns, the memo indices of a row are concatenated and
+// memoized again in a BinaryMemoTable.
+class JoinKeyEncoder {
+ public:
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types,
+              MemoryPool* pool) {
+    for (const auto& type : key_types) {
+      std::unique_ptr<JoinKeyColumn> column;
+      JoinKeyColumnMaker maker{pool, &column};
+      RETURN_NOT_OK(VisitTypeInline(*type, &maker));
+      columns_.push_back(std::move(column));
+    }
+    if (columns_.size() > 1) {
+      rows_.reset(new BinaryMemoTable(pool, 0));
+    }
+    return Status::OK();
+  }
+
+  Status Insert(const std::vector<std::shared_ptr<Array>>& keys,
+                std::vector<int32_t>* ids) {
+    return Encode</*kInsert=*/true>(keys, ids);
+  }
+
+  Status Lookup(const std::vector<std::shared_ptr<Array>>& keys,
+                std::vector<int32_t>* ids) {
+    return Encode</*kInsert=*/false>(keys, ids);
+  }
+
+  int32_t num_ids() const {
+    if (rows_) {
+      return rows_->size();
+    }
+    return num_single_ids_;
+  }
+
+ private:
+  template <bool kInsert>
+  Status EncodeColumn(size_t col, const ArrayData& data, int32_t* out) {
+    if (kInsert) {
+      return columns_[col]->Insert(data, out);
+    }
+    return columns_[col]->Lookup(data, out);
+  }
+
+  template <bool kInsert>
+  Status Encode(const std::vector<std::shared_ptr<Array>>& keys,
+                std::vector<int32_t>* ids) {
+    const int64_t length = keys[0]->length();
+    ids->resize(length);
+    if (columns_.size() == 1) {
+      RETURN_NOT_OK(EncodeColumn<kInsert>(0, *keys[0]->data(), ids->data()));
+      if (kInsert) {
+        for (int64_t i = 0; i < length; ++i) {
+          num_single_ids_ = std::max(num_single_ids_, (*ids)[i] + 1);
+        }
+      }
+      return Status::OK();
+    }
+
+    const size_t num_columns = columns_.size();
+    memo_indices_.resize(length);
+    row_indices_.resize(length * num_columns);
+    for (size_t col = 0; col < num_columns; ++col) {
+      RETURN_NOT_OK(
+          EncodeColumn<kInsert>(col, *keys[col]->data(), memo_indices_.data()));
+      for (int64_t i = 0; i < length; ++i) {
+        row_indices_[i * num_columns + col] = memo_indices_[i];
+      }
+    }
+    const auto row_size = static_cast<int32_t>(num_columns * sizeof(int32_t));
+    row_hashes_.resize(length);
+    ComputeFixedSizeStringHashes<0>(reinterpret_cast<const uint8_t*>(row_indices_.data()),
+                                    row_size, length, row_hashes_.data());
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t* row = &row_indices_[i * num_columns];
+      bool complete = true;
+      for (size_t col = 0; col < num_columns; ++col) {
+        complete = complete && row[col] != kKeyNotFound;
+      }
+      if (!complete) {
+        (*ids)[i] = kKeyNotFound;
+      } else if (kInsert) {
+        (*ids)[i] = rows_->GetOrInsertHashed(row, row_size, row_hashes_[i]);
+      } else {
+        (*ids)[i] = rows_->GetHashed(row, row_size, row_hashes_[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::unique_ptr<JoinKeyColumn>> columns_;
+  std::unique_ptr<BinaryMemoTable> rows_;
+  // Number of distinct keys inserted, with a single key column
+  int32_t num_single_ids_ = 0;
+  // Scratch space for Encode() with several key columns
+  std::vector<int32_t> memo_indices_;
+  std::vector<int32_t> row_indices_;
+  std::vector<hash_t> row_hashes_;
+};
+
+Status GetKeyIndices(const Schema& schema, const std::vector<std::string>& names,
+                     std::vector<int>* out) {
+  out->clear();
+  for (const auto& name : names) {
+    const int index = schema.GetFieldIndex(name);
+    if (index == -1) {
+      return Status::Invalid("No key column named '", name, "' in schema ",
+                             schema.ToString());
+    }
+    out->push_back(index);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// HashJoiner implementation
+
+class HashJoinerImpl : public HashJoiner {
+ public:
+  HashJoinerImpl(FunctionContext* ctx, const HashJoinOptions& options,
+                 bool build_is_left)
+      : ctx_(ctx), type_(options.type), build_is_left_(build_is_left) {}
+
+  Status Init(const Table& build, const std::vector<std::string>& build_keys,
+              const std::shared_ptr<Schema>& probe_schema,
+              const std::vector<std::string>& probe_keys) {
+    if (build_keys.empty() || build_keys.size() != probe_keys.size()) {
+      return Status::Invalid("HashJoin needs the same non-zero number of keys on ",
+                             "both sides, got ", build_keys.size(), " and ",
+                             probe_keys.size());
+    }
+    std::vector<int> build_key_indices;
+    RETURN_NOT_OK(GetKeyIndices(*build.schema(), build_keys, &build_key_indices));
+    RETURN_NOT_OK(GetKeyIndices(*probe_schema, probe_keys, &probe_key_indices_));
+
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (size_t i = 0; i < build_keys.size(); ++i) {
+      const auto& build_type = build.schema()->field(build_key_indices[i])->type();
+      const auto& probe_type = probe_schema->field(probe_key_indices_[i])->type();
+      if (!build_type->Equals(*probe_type)) {
+        return Status::TypeError("HashJoin keys '", build_keys[i], "' and '",
+                                 probe_keys[i], "' have different types ",
+                                 build_type->ToString(), " and ",
+                                 probe_type->ToString());
+      }
+      key_types.push_back(build_type);
+    }
+
+    // Take() gathers build rows from contiguous columns
+    for (int i = 0; i < build.num_columns(); ++i) {
+      const auto& column = build.column(i);
+      std::shared_ptr<Array> array;
+      if (column->num_chunks() == 0) {
+        RETURN_NOT_OK(
+            MakeArrayOfNull(ctx_->memory_pool(), column->type(), 0, &array));
+      } else {
+        RETURN_NOT_OK(Concatenate(column->chunks(), ctx_->memory_pool(), &array));
+      }
+      build_columns_.push_back(std::move(array));
+    }
+    build_schema_ = build.schema();
+    probe_schema_ = probe_schema;
+
+    RETURN_NOT_OK(keys_.Init(key_types, ctx_->memory_pool()));
+    std::vector<std::shared_ptr<Array>> build_key_columns;
+    for (int index : build_key_indices) {
+      build_key_columns.push_back(build_columns_[index]);
+    }
+    std::vector<int32_t> build_ids;
+    RETURN_NOT_OK(keys_.Insert(build_key_columns, &build_ids));
+
+    // Lay out the build rows of each key id contiguously
+    const int32_t num_ids = keys_.num_ids();
+    id_offsets_.assign(num_ids + 1, 0);
+    for (int32_t id : build_ids) {
+      if (id != kKeyNotFound) {
+        ++id_offsets_[id + 1];
+      }
+    }
+    for (int32_t id = 0; id < num_ids; ++id) {
+      id_offsets_[id + 1] += id_offsets_[id];
+    }
+    id_rows_.resize(id_offsets_[num_ids]);
+    std::vector<int64_t> positions(id_offsets_.begin(), id_offsets_.end() - 1);
+    for (int64_t row = 0; row < static_cast<int64_t>(build_ids.size()); ++row) {
+      if (build_ids[row] != kKeyNotFound) {
+        id_rows_[positions[build_ids[row]]++] = row;
+      }
+    }
+
+    if (build_is_left_ && type_ != HashJoinOptions::INNER) {
+      build_matched_.assign(build.num_rows(), false);
+    }
+    out_schema_ = MakeOutSchema();
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> out_schema() const override { return out_schema_; }
+
+  Status Probe(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) override {
+    std::vector<std::shared_ptr<Array>> probe_key_columns;
+    for (int index : probe_key_indices_) {
+      probe_key_columns.push_back(batch.column(index));
+    }
+    RETURN_NOT_OK(keys_.Lookup(probe_key_columns, &probe_ids_));
+
+    Int64Builder probe_indices(ctx_->memory_pool());
+    Int64Builder build_indices(ctx_->memory_pool());
+    const bool probe_semi = type_ == HashJoinOptions::LEFT_SEMI && !build_is_left_;
+    const bool probe_outer = type_ == HashJoinOptions::LEFT_OUTER && !build_is_left_;
+    const bool build_semi = type_ == HashJoinOptions::LEFT_SEMI && build_is_left_;
+    for (int64_t i = 0; i < batch.num_rows(); ++i) {
+      const int32_t id = probe_ids_[i];
+      if (id == kKeyNotFound) {
+        if (probe_outer) {
+          RETURN_NOT_OK(probe_indices.Append(i));
+          RETURN_NOT_OK(build_indices.AppendNull());
+        }
+        continue;
+      }
+      if (probe_semi) {
+        RETURN_NOT_OK(probe_indices.Append(i));
+        continue;
+      }
+      for (int64_t j = id_offsets_[id]; j < id_offsets_[id + 1]; ++j) {
+        if (!build_matched_.empty()) {
+          build_matched_[id_rows_[j]] = true;
+        }
+        if (!build_semi) {
+          RETURN_NOT_OK(probe_indices.Append(i));
+          RETURN_NOT_OK(build_indices.Append(id_rows_[j]));
+        }
+      }
+    }
+
+    std::shared_ptr<Array> probe_index_array, build_index_array;
+    RETURN_NOT_OK(probe_indices.Finish(&probe_index_array));
+    RETURN_NOT_OK(build_indices.Finish(&build_index_array));
+
+    std::vector<std::shared_ptr<Array>> probe_columns;
+    if (!build_semi) {
+      std::shared_ptr<RecordBatch> taken;
+      RETURN_NOT_OK(Take(ctx_, batch, *probe_index_array, TakeOptions(), &taken));
+      for (int i = 0; i < taken->num_columns(); ++i) {
+        probe_columns.push_back(taken->column(i));
+      }
+    }
+    return MakeBatch(probe_columns, *build_index_array, probe_index_array->length(),
+                     out);
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out) override {
+    Int64Builder build_indices(ctx_->memory_pool());
+    // Rows of a LEFT_SEMI join are the matched ones, of a LEFT_OUTER join the
+    // unmatched ones
+    const bool emit_matched = type_ == HashJoinOptions::LEFT_SEMI;
+    for (size_t row = 0; row < build_matched_.size(); ++row) {
+      if (build_matched_[row] == emit_matched) {
+        RETURN_NOT_OK(build_indices.Append(row));
+      }
+    }
+    std::shared_ptr<Array> build_index_array;
+    RETURN_NOT_OK(build_indices.Finish(&build_index_array));
+    const int64_t length = build_index_array->length();
+
+    std::vector<std::shared_ptr<Array>> probe_columns;
+    for (const auto& field : probe_schema_->fields()) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(MakeArrayOfNull(ctx_->memory_pool(), field->type(), length, &column));
+      probe_columns.push_back(std::move(column));
+    }
+    return MakeBatch(probe_columns, *build_index_array, length, out);
+  }
+
+ private:
+  bool semi() const { return type_ == HashJoinOptions::LEFT_SEMI; }
+
+  std::shared_ptr<Schema> MakeOutSchema() const {
+    const auto& left = build_is_left_ ? build_schema_ : probe_schema_;
+    const auto& right = build_is_left_ ? probe_schema_ : build_schema_;
+    if (semi()) {
+      return left;
+    }
+    std::vector<std::shared_ptr<Field>> fields = left->fields();
+    fields.insert(fields.end(), right->fields().begin(), right->fields().end());
+    return schema(std::move(fields));
+  }
+
+  // Assemble the taken probe columns and the build rows at build_indices in
+  // the output column order
+  Status MakeBatch(const std::vector<std::shared_ptr<Array>>& probe_columns,
+                   const Array& build_indices, int64_t length,
+                   std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<Array>> build_columns;
+    if (!semi() || build_is_left_) {
+      for (const auto& column : build_columns_) {
+        std::shared_ptr<Array> taken;
+        RETURN_NOT_OK(Take(ctx_, *column, build_indices, TakeOptions(), &taken));
+        build_columns.push_back(std::move(taken));
+      }
+    }
+
+    std::vector<std::shared_ptr<Array>> columns;
+    if (semi()) {
+      columns = build_is_left_ ? build_columns : probe_columns;
+    } else {
+      const auto& left = build_is_left_ ? build_columns : probe_columns;
+      const auto& right = build_is_left_ ? probe_columns : build_columns;
+      columns = left;
+      columns.insert(columns.end(), right.begin(), right.end());
+    }
+    *out = RecordBatch::Make(out_schema_, length, std::move(columns));
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  HashJoinOptions::Type type_;
+  bool build_is_left_;
+
+  std::shared_ptr<Schema> build_schema_;
+  std::shared_ptr<Schema> probe_schema_;
+  std::shared_ptr<Schema> out_schema_;
+  std::vector<int> probe_key_indices_;
+
+  JoinKeyEncoder keys_;
+  std::vector<std::shared_ptr<Array>> build_columns_;
+  // The build rows with key id i are id_rows_[id_offsets_[i]:id_offsets_[i + 1]]
+  std::vector<int64_t> id_offsets_;
+  std::vector<int64_t> id_rows_;
+  // Whether each build row was matched, if the build side is preserved
+  std::vector<bool> build_matched_;
+
+  // Scratch space for Probe()
+  std::vector<int32_t> probe_ids_;
+};
+
+}  // namespace
+
+Status HashJoiner::Make(FunctionContext* ctx, const HashJoinOptions& options,
+                        const std::shared_ptr<Table>& build,
+                        const std::vector<std::string>& build_keys, bool build_is_left,
+                        const std::shared_ptr<Schema>& probe_schema,
+                        const std::vector<std::string>& probe_keys,
+                        std::unique_ptr<HashJoiner>* out) {
+  std::unique_ptr<HashJoinerImpl> impl(new HashJoinerImpl(ctx, options, build_is_left));
+  RETURN_NOT_OK(impl->Init(*build, build_keys, probe_schema, probe_keys));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status HashJoin(FunctionContext* ctx, const std::shared_ptr<Table>& left,
+                const std::shared_ptr<Table>& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys,
+                const HashJoinOptions& options, std::shared_ptr<Table>* out) {
+  // Build from the smaller side, the hash table being the memory-hungry part
+  const bool build_is_left = left->num_rows() < right->num_rows();
+  const auto& build = build_is_left ? left : right;
+  const auto& probe = build_is_left ? right : left;
+
+  std::unique_ptr<HashJoiner> joiner;
+  RETURN_NOT_OK(HashJoiner::Make(ctx, options, build,
+                                 build_is_left ? left_keys : right_keys, build_is_left,
+                                 probe->schema(), build_is_left ? right_keys : left_keys,
+                                 &joiner));
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  TableBatchReader reader(*probe);
+  std::shared_ptr<RecordBatch> batch, joined;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(joiner->Probe(*batch, &joined));
+    if (joined->num_rows() > 0) {
+      batches.push_back(std::move(joined));
+    }
+  }
+  RETURN_NOT_OK(joiner->Finish(&joined));
+  if (joined->num_rows() > 0) {
+    batches.push_back(std::move(joined));
+  }
+  return Table::FromRecordBatches(joiner->out_schema(), batches, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+class Status;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class HashJoinOptions
+struct ARROW_EXPORT HashJoinOptions {
+  enum Type {
+    // Pairs of left and right rows with equal keys
+    INNER = 0,
+    // Like INNER, plus left rows without a match, with null right columns
+    LEFT_OUTER,
+    // Left rows with at least one match, without any right columns
+    LEFT_SEMI,
+  };
+
+  Type type = INNER;
+};
+
+/// \brief Hash table over the key columns of one side of a join, probed with
+/// record batches of the other side
+///
+/// Keys are compared for equality with the memo tables of util/hashing.h.
+/// A null key never matches, as in SQL.
+///
+/// Joined batches have the left columns followed by the right columns (the
+/// left columns only, for LEFT_SEMI), whichever side is the build side.
+class ARROW_EXPORT HashJoiner {
+ public:
+  virtual ~HashJoiner() = default;
+
+  /// \brief Create a joiner by building a hash table over a table
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] options the type of join
+  /// \param[in] build the table to build the hash table from
+  /// \param[in] build_keys names of the key columns of the build table
+  /// \param[in] build_is_left whether the build table is the left side of the
+  /// join
+  /// \param[in] probe_schema the schema of the batches to probe with
+  /// \param[in] probe_keys names of the key columns of the probe batches, of
+  /// the same types as the build keys
+  /// \param[out] out the new joiner
+  static Status Make(FunctionContext* ctx, const HashJoinOptions& options,
+                     const std::shared_ptr<Table>& build,
+                     const std::vector<std::string>& build_keys, bool build_is_left,
+                     const std::shared_ptr<Schema>& probe_schema,
+                     const std::vector<std::string>& probe_keys,
+                     std::unique_ptr<HashJoiner>* out);
+
+  /// \brief The schema of the joined batches
+  virtual std::shared_ptr<Schema> out_schema() const = 0;
+
+  /// \brief Join a batch of the probe side with the build table
+  virtual Status Probe(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) = 0;
+
+  /// \brief Emit the rows which can only be known once all probe batches were
+  /// seen
+  ///
+  /// If the build side is the left side, these are the unmatched build rows
+  /// for LEFT_OUTER and the matched build rows for LEFT_SEMI. Otherwise the
+  /// result is empty.
+  virtual Status Finish(std::shared_ptr<RecordBatch>* out) = 0;
+};
+
+/// \brief Join two tables on equality of their key columns
+///
+/// The hash table is built from the side with fewer rows, the other side is
+/// probed batch by batch. The order of the output rows is unspecified.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the left table
+/// \param[in] right the right table
+/// \param[in] left_keys names of the key columns of the left table
+/// \param[in] right_keys names of the key columns of the right table, of the
+/// same types as the left keys
+/// \param[in] options see HashJoinOptions for more information
+/// \param[out] out the joined table, see HashJoiner for its columns
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const std::shared_ptr<Table>& left,
+                const std::shared_ptr<Table>& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys,
+                const HashJoinOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
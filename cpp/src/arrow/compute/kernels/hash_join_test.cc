@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    left_schema_ = schema({field("k", int32()), field("s", utf8())});
+    right_schema_ = schema({field("rk", int32()), field("v", int64())});
+    left_ = TableFromJSON(left_schema_, {R"([
+      {"k": 1, "s": "a"},
+      {"k": 2, "s": "b"},
+      {"k": 3, "s": "c"}
+    ])",
+                                         R"([
+      {"k": null, "s": "n"},
+      {"k": 2, "s": "d"}
+    ])"});
+    // Fewer rows than the left table: the hash table is built from it
+    right_small_ = TableFromJSON(right_schema_, {R"([
+      {"rk": 2, "v": 20},
+      {"rk": 4, "v": 40},
+      {"rk": 2, "v": 21},
+      {"rk": null, "v": 0}
+    ])"});
+    // More rows than the left table: the hash table is built from the left
+    right_big_ = TableFromJSON(right_schema_, {R"([
+      {"rk": 2, "v": 20},
+      {"rk": 4, "v": 40},
+      {"rk": 2, "v": 21},
+      {"rk": null, "v": 0},
+      {"rk": 5, "v": 50},
+      {"rk": 6, "v": 60}
+    ])"});
+    joined_schema_ = schema({field("k", int32()), field("s", utf8()),
+                             field("rk", int32()), field("v", int64())});
+  }
+
+  void AssertJoin(const std::shared_ptr<Table>& right, HashJoinOptions::Type type,
+                  const std::shared_ptr<Schema>& expected_schema,
+                  const std::string& expected_json) {
+    HashJoinOptions options;
+    options.type = type;
+    std::shared_ptr<Table> out;
+    ASSERT_OK(HashJoin(&ctx_, left_, right, {"k"}, {"rk"}, options, &out));
+    ASSERT_OK(out->ValidateFull());
+    auto expected = TableFromJSON(expected_schema, {expected_json});
+    AssertTablesEqual(*expected, *out, /*same_chunk_layout=*/false);
+  }
+
+  std::shared_ptr<Schema> left_schema_, right_schema_, joined_schema_;
+  std::shared_ptr<Table> left_, right_small_, right_big_;
+};
+
+TEST_F(TestHashJoin, InnerBuildRight) {
+  AssertJoin(right_small_, HashJoinOptions::INNER, joined_schema_, R"([
+    {"k": 2, "s": "b", "rk": 2, "v": 20},
+    {"k": 2, "s": "b", "rk": 2, "v": 21},
+    {"k": 2, "s": "d", "rk": 2, "v": 20},
+    {"k": 2, "s": "d", "rk": 2, "v": 21}
+  ])");
+}
+
+TEST_F(TestHashJoin, InnerBuildLeft) {
+  AssertJoin(right_big_, HashJoinOptions::INNER, joined_schema_, R"([
+    {"k": 2, "s": "b", "rk": 2, "v": 20},
+    {"k": 2, "s": "d", "rk": 2, "v": 20},
+    {"k": 2, "s": "b", "rk": 2, "v": 21},
+    {"k": 2, "s": "d", "rk": 2, "v": 21}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuterBuildRight) {
+  AssertJoin(right_small_, HashJoinOptions::LEFT_OUTER, joined_schema_, R"([
+    {"k": 1, "s": "a", "rk": null, "v": null},
+    {"k": 2, "s": "b", "rk": 2, "v": 20},
+    {"k": 2, "s": "b", "rk": 2, "v": 21},
+    {"k": 3, "s": "c", "rk": null, "v": null},
+    {"k": null, "s": "n", "rk": null, "v": null},
+    {"k": 2, "s": "d", "rk": 2, "v": 20},
+    {"k": 2, "s": "d", "rk": 2, "v": 21}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuterBuildLeft) {
+  // Unmatched left rows are emitted once all right rows were probed
+  AssertJoin(right_big_, HashJoinOptions::LEFT_OUTER, joined_schema_, R"([
+    {"k": 2, "s": "b", "rk": 2, "v": 20},
+    {"k": 2, "s": "d", "rk": 2, "v": 20},
+    {"k": 2, "s": "b", "rk": 2, "v": 21},
+    {"k": 2, "s": "d", "rk": 2, "v": 21},
+    {"k": 1, "s": "a", "rk": null, "v": null},
+    {"k": 3, "s": "c", "rk": null, "v": null},
+    {"k": null, "s": "n", "rk": null, "v": null}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  for (const auto& right : {right_small_, right_big_}) {
+    AssertJoin(right, HashJoinOptions::LEFT_SEMI, left_schema_, R"([
+      {"k": 2, "s": "b"},
+      {"k": 2, "s": "d"}
+    ])");
+  }
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto left = TableFromJSON(schema({field("a", int8()), field("b", utf8())}), {R"([
+    {"a": 1, "b": "x"},
+    {"a": 1, "b": "y"},
+    {"a": 2, "b": "x"},
+    {"a": 2, "b": null}
+  ])"});
+  auto right = TableFromJSON(schema({field("c", int8()), field("d", utf8())}), {R"([
+    {"c": 1, "d": "y"},
+    {"c": 2, "d": "x"},
+    {"c": 2, "d": null}
+  ])"});
+  auto expected = TableFromJSON(schema({field("a", int8()), field("b", utf8()),
+                                        field("c", int8()), field("d", utf8())}),
+                                {R"([
+    {"a": 1, "b": "y", "c": 1, "d": "y"},
+    {"a": 2, "b": "x", "c": 2, "d": "x"}
+  ])"});
+
+  std::shared_ptr<Table> out;
+  ASSERT_OK(
+      HashJoin(&ctx_, left, right, {"a", "b"}, {"c", "d"}, HashJoinOptions(), &out));
+  ASSERT_OK(out->ValidateFull());
+  AssertTablesEqual(*expected, *out, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestHashJoin, ProbeBatches) {
+  std::unique_ptr<HashJoiner> joiner;
+  ASSERT_OK(HashJoiner::Make(&ctx_, HashJoinOptions(), right_small_, {"rk"},
+                             /*build_is_left=*/false, left_schema_, {"k"}, &joiner));
+  AssertSchemaEqual(*joined_schema_, *joiner->out_schema());
+
+  auto batch = RecordBatchFromJSON(left_schema_, R"([
+    {"k": 4, "s": "x"},
+    {"k": 1, "s": "y"}
+  ])");
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(joiner->Probe(*batch, &out));
+  ASSERT_OK(out->ValidateFull());
+  AssertBatchesEqual(*RecordBatchFromJSON(joined_schema_, R"([
+    {"k": 4, "s": "x", "rk": 4, "v": 40}
+  ])"),
+                     *out);
+
+  ASSERT_OK(joiner->Finish(&out));
+  ASSERT_EQ(0, out->num_rows());
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<Table> out;
+  ASSERT_RAISES(Invalid,
+                HashJoin(&ctx_, left_, right_small_, {"k"}, {}, HashJoinOptions(), &out));
+  ASSERT_RAISES(Invalid, HashJoin(&ctx_, left_, right_small_, {"k"}, {"missing"},
+                                  HashJoinOptions(), &out));
+  ASSERT_RAISES(TypeError, HashJoin(&ctx_, left_, right_small_, {"s"}, {"rk"},
+                                    HashJoinOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -20,6 +20,7 @@
 #include <cstdio>
 #include <functional>
 #include <locale>
+#include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -29,11 +30,14 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -42,6 +46,7 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/test_util.h"
 
@@ -606,5 +611,188 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, DictionaryUniqueValueCounts) {
+  // Dictionary inputs are hashed on their indices
+  auto dict_type = dictionary(int8(), utf8());
+  std::shared_ptr<Array> dict, indices, expected_indices, expected_counts;
+  ArrayFromVector<StringType, std::string>({"z", "a", "b"}, &dict);
+  ArrayFromVector<Int8Type, int8_t>({true, true, false, true, true}, {2, 1, 0, 2, 1},
+                                    &indices);
+  auto arr = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, arr, &result));
+  ASSERT_OK(result->ValidateFull());
+  ArrayFromVector<Int8Type, int8_t>({true, true, false}, {2, 1, 0}, &expected_indices);
+  AssertArraysEqual(DictionaryArray(dict_type, expected_indices, dict), *result);
+
+  ASSERT_OK(ValueCounts(&this->ctx_, arr, &result));
+  ASSERT_OK(result->ValidateFull());
+  const auto& counts_struct = internal::checked_cast<const StructArray&>(*result);
+  ArrayFromVector<Int64Type, int64_t>({2, 2, 1}, &expected_counts);
+  AssertArraysEqual(DictionaryArray(dict_type, expected_indices, dict),
+                    *counts_struct.field(kValuesFieldIndex));
+  AssertArraysEqual(*expected_counts, *counts_struct.field(kCountsFieldIndex));
+
+  // Chunks with differing dictionaries are unified first
+  std::shared_ptr<Array> other_dict, other_indices;
+  ArrayFromVector<StringType, std::string>({"b", "c"}, &other_dict);
+  ArrayFromVector<Int8Type, int8_t>({1, 0, 1}, &other_indices);
+  auto other = std::make_shared<DictionaryArray>(dict_type, other_indices, other_dict);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{arr, other});
+
+  ASSERT_OK(ValueCounts(&this->ctx_, chunked, &result));
+  ASSERT_OK(result->ValidateFull());
+  const auto& chunked_counts = internal::checked_cast<const StructArray&>(*result);
+  const auto& unique_values = internal::checked_cast<const DictionaryArray&>(
+      *chunked_counts.field(kValuesFieldIndex));
+  std::shared_ptr<Array> unified_dict;
+  ArrayFromVector<StringType, std::string>({"z", "a", "b", "c"}, &unified_dict);
+  ArrayFromVector<Int8Type, int8_t>({true, true, false, true}, {2, 1, 0, 3},
+                                    &expected_indices);
+  AssertArraysEqual(*unified_dict, *unique_values.dictionary());
+  AssertArraysEqual(*expected_indices, *unique_values.indices());
+  ArrayFromVector<Int64Type, int64_t>({3, 2, 1, 2}, &expected_counts);
+  AssertArraysEqual(*expected_counts, *chunked_counts.field(kCountsFieldIndex));
+}
+
+TEST_F(TestHashKernel, ExtensionType) {
+  // Extension inputs are hashed on their storage
+  auto arr = ExtensionArrayFromJSON(smallint(), "[2, 1, null, 2, 1]");
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, arr, &result));
+  ASSERT_OK(result->ValidateFull());
+  AssertArraysEqual(*ExtensionArrayFromJSON(smallint(), "[2, 1, null]"), *result);
+
+  ASSERT_OK(ValueCounts(&this->ctx_, arr, &result));
+  ASSERT_OK(result->ValidateFull());
+  const auto& counts_struct = internal::checked_cast<const StructArray&>(*result);
+  AssertArraysEqual(*ExtensionArrayFromJSON(smallint(), "[2, 1, null]"),
+                    *counts_struct.field(kValuesFieldIndex));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 2, 1]"),
+                    *counts_struct.field(kCountsFieldIndex));
+
+  Datum encoded;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, arr, &encoded));
+  AssertArraysEqual(DictionaryArray(dictionary(int32(), smallint()),
+                                    ArrayFromJSON(int32(), "[0, 1, null, 0, 1]"),
+                                    ExtensionArrayFromJSON(smallint(), "[2, 1]")),
+                    *encoded.make_array());
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{arr, ExtensionArrayFromJSON(smallint(), "[3, 1]")});
+  ASSERT_OK(Unique(&this->ctx_, chunked, &result));
+  AssertArraysEqual(*ExtensionArrayFromJSON(smallint(), "[2, 1, null, 3]"), *result);
+  ASSERT_OK(DictionaryEncode(&this->ctx_, chunked, &encoded));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, encoded.kind());
+  ASSERT_TRUE(encoded.type()->Equals(*dictionary(int32(), smallint())));
+}
+
+// ----------------------------------------------------------------------
+// Radix-partitioned hashing
+
+using internal::checked_cast;
+
+// Map each distinct value (as a string) to its count, checking that values
+// are distinct
+std::map<std::string, int64_t> ValueCountsToMap(const Array& value_counts) {
+  const auto& value_counts_struct = checked_cast<const StructArray&>(value_counts);
+  const auto& values = value_counts_struct.field(kValuesFieldIndex);
+  const auto& counts =
+      checked_cast<const Int64Array&>(*value_counts_struct.field(kCountsFieldIndex));
+  std::map<std::string, int64_t> out;
+  for (int64_t i = 0; i < values->length(); ++i) {
+    const auto key = values->Slice(i, 1)->ToString();
+    EXPECT_EQ(0, out.count(key)) << "duplicate value " << key;
+    out[key] = counts.Value(i);
+  }
+  return out;
+}
+
+class TestRadixPartitionedHash : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    options_.radix_partitioned = true;
+    // Small enough to partition the test inputs
+    options_.partition_size = 1024;
+  }
+
+  void CheckPartitioned(const std::shared_ptr<Array>& values) {
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{values->Slice(0, values->length() / 3),
+                    values->Slice(values->length() / 3)});
+    for (const Datum& input : {Datum(values), Datum(chunked)}) {
+      // Same values and counts as without partitioning, in another order
+      std::shared_ptr<Array> expected, actual;
+      ASSERT_OK(ValueCounts(&ctx_, input, &expected));
+      ASSERT_OK(ValueCounts(&ctx_, input, options_, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      ASSERT_EQ(ValueCountsToMap(*expected), ValueCountsToMap(*actual));
+
+      ASSERT_OK(Unique(&ctx_, input, &expected));
+      ASSERT_OK(Unique(&ctx_, input, options_, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      ASSERT_EQ(expected->length(), actual->length());
+
+      // Dictionary-encoded values decode to the input
+      Datum encoded;
+      ASSERT_OK(DictionaryEncode(&ctx_, input, options_, &encoded));
+      ASSERT_EQ(input.kind(), encoded.kind());
+      ArrayVector encoded_chunks = encoded.kind() == Datum::ARRAY
+                                       ? ArrayVector{encoded.make_array()}
+                                       : encoded.chunked_array()->chunks();
+      ArrayVector decoded_chunks;
+      for (const auto& chunk : encoded_chunks) {
+        ASSERT_OK(chunk->ValidateFull());
+        const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+        ASSERT_EQ(expected->length() - (values->null_count() > 0),
+                  dict_array.dictionary()->length());
+        std::shared_ptr<Array> decoded;
+        ASSERT_OK(Take(&ctx_, *dict_array.dictionary(), *dict_array.indices(),
+                       TakeOptions(), &decoded));
+        decoded_chunks.push_back(decoded);
+      }
+      std::shared_ptr<Array> decoded;
+      ASSERT_OK(Concatenate(decoded_chunks, default_memory_pool(), &decoded));
+      AssertArraysEqual(*values, *decoded);
+    }
+  }
+
+  HashOptions options_;
+};
+
+TEST_F(TestRadixPartitionedHash, Integers) {
+  random::RandomArrayGenerator rng(42);
+  CheckPartitioned(rng.Int64(10000, 0, 3000, /*null_probability=*/0.1));
+  CheckPartitioned(rng.Int32(10000, 0, 3000, /*null_probability=*/0));
+}
+
+TEST_F(TestRadixPartitionedHash, Strings) {
+  random::RandomArrayGenerator rng(42);
+  CheckPartitioned(rng.String(5000, 0, 3, /*null_probability=*/0.1));
+}
+
+TEST_F(TestRadixPartitionedHash, ExtensionType) {
+  random::RandomArrayGenerator rng(42);
+  CheckPartitioned(WrapExtensionArray(
+      smallint(), rng.Int16(10000, 0, 3000, /*null_probability=*/0.1)));
+}
+
+TEST_F(TestRadixPartitionedHash, SmallInputs) {
+  // Inputs which fit in a single partition, or of 8-bit types, are hashed as
+  // usual: values are in order of first appearance
+  options_.partition_size = 256 * 1024;
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&ctx_, ArrayFromJSON(int64(), "[3, 1, null, 3, 2]"), options_,
+                   &result));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[3, 1, null, 2]"), *result);
+
+  options_.partition_size = 1;
+  ASSERT_OK(
+      Unique(&ctx_, ArrayFromJSON(int8(), "[3, 1, null, 3, 2]"), options_, &result));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[3, 1, null, 2]"), *result);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -53,137 +54,402 @@ using internal::HashTraits;
 
 namespace compute {
 
-class IsInKernelImpl : public UnaryKernel {
-  virtual Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) = 0;
+// ----------------------------------------------------------------------
+// The value set ("right" input) of IsIn and Match, mapping each distinct
+// value to the index of its first occurrence
 
+template <typename Type, typename Scalar>
+class ValueSet {
  public:
-  // \brief Check if value in both arrays or not and returns boolean values/null
-  Status Call(FunctionContext* ctx, const Datum& left, Datum* out) override {
-    DCHECK_EQ(Datum::ARRAY, left.kind());
-    RETURN_NOT_OK(Compute(ctx, left, out));
+  explicit ValueSet(MemoryPool* pool) : memo_table_(new MemoTable(pool, 0)) {}
+
+  Status VisitNull() {
+    if (null_index_ == -1) {
+      null_index_ = static_cast<int32_t>(length_);
+    }
+    ++length_;
     return Status::OK();
   }
 
-  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+  Status VisitValue(const Scalar& value) {
+    const auto value_index = static_cast<int32_t>(length_++);
+    memo_table_->GetOrInsert(value, [](int32_t memo_index) {},
+                             [&](int32_t memo_index) {
+                               memo_index_to_value_index_.push_back(value_index);
+                             });
+    return Status::OK();
+  }
 
-  virtual Status ConstructRight(FunctionContext* ctx, const Datum& right) = 0;
-};
+  Status Append(const ArrayData& data) {
+    if (length_ + data.length > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Value set of more than 2^31 - 1 values");
+    }
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
 
-// ----------------------------------------------------------------------
-// Using a visitor create a memo_table_ for the right array
-// TODO: Implement for small lists
+  // \brief Called once the whole value set was appended
+  Status Finish() { return Status::OK(); }
 
-template <typename T, typename Scalar>
-struct MemoTableRight {
-  Status VisitNull() { return Status::OK(); }
+  bool has_nulls() const { return null_index_ != -1; }
 
-  Status VisitValue(const Scalar& value) {
-    memo_table_->GetOrInsert(value);
-    return Status::OK();
+  // \brief The index of the first null of the value set, or -1
+  int32_t null_index() const { return null_index_; }
+
+  // \brief The index of the first occurrence of value in the value set, or -1
+  int32_t Find(const Scalar& value) const {
+    const int32_t memo_index = memo_table_->Get(value);
+    return memo_index == -1 ? -1 : memo_index_to_value_index_[memo_index];
   }
 
-  Status Reset(MemoryPool* pool) {
-    memo_table_.reset(new MemoTable(pool, 0));
-    return Status::OK();
+  // \brief Write the result of Find() for each value of data, or null_index()
+  // for its nulls
+  void FindMany(const ArrayData& data, int32_t* out) const {
+    struct {
+      Status VisitNull() {
+        *out++ = value_set.null_index();
+        return Status::OK();
+      }
+      Status VisitValue(const Scalar& value) {
+        *out++ = value_set.Find(value);
+        return Status::OK();
+      }
+      const ValueSet& value_set;
+      int32_t* out;
+    } visitor{*this, out};
+    DCHECK_OK(ArrayDataVisitor<Type>::Visit(data, &visitor));
   }
 
-  Status Append(FunctionContext* ctx, const Datum& right) {
-    const ArrayData& right_data = *right.array();
-    right_null_count += right_data.GetNullCount();
-    return ArrayDataVisitor<T>::Visit(right_data, this);
+  // \brief Write whether each value of data is in the value set to a bitmap,
+  // nulls being set
+  void ContainsMany(const ArrayData& data, uint8_t* out_bitmap,
+                    int64_t out_offset) const {
+    struct {
+      Status VisitNull() {
+        writer.Set();
+        writer.Next();
+        return Status::OK();
+      }
+      Status VisitValue(const Scalar& value) {
+        if (value_set.Find(value) != -1) {
+          writer.Set();
+        } else {
+          writer.Clear();
+        }
+        writer.Next();
+        return Status::OK();
+      }
+      const ValueSet& value_set;
+      internal::FirstTimeBitmapWriter writer;
+    } visitor{*this,
+              internal::FirstTimeBitmapWriter(out_bitmap, out_offset, data.length)};
+    DCHECK_OK(ArrayDataVisitor<Type>::Visit(data, &visitor));
+    visitor.writer.Finish();
   }
 
-  using MemoTable = typename HashTraits<T>::MemoTableType;
+ protected:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
   std::unique_ptr<MemoTable> memo_table_;
-  int64_t right_null_count{};
+  std::vector<int32_t> memo_index_to_value_index_;
+  int64_t length_ = 0;
+  int32_t null_index_ = -1;
 };
 
+// \brief Call visit(i) for each null slot i of data, a word of its validity
+// bitmap at a time
+template <typename Visitor>
+void VisitNullSlots(const ArrayData& data, Visitor&& visit) {
+  if (data.GetNullCount() == 0) {
+    return;
+  }
+  const uint8_t* validity = data.buffers[0]->data();
+  for (int64_t position = 0; position < data.length; position += 64) {
+    const int num_bits = static_cast<int>(std::min<int64_t>(64, data.length - position));
+    uint64_t nulls = BitUtil::TrailingBits(
+        ~internal::LoadBitmapWord(validity, data.offset + position, num_bits), num_bits);
+    for (; nulls != 0; nulls &= nulls - 1) {
+      visit(position + BitUtil::CountTrailingZeros(nulls));
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
+// Value sets of integers wider than a byte (including temporal types),
+// which are usually small or dense enough to beat hashing: a narrow range
+// of values is looked up in a bitmap, and a few scattered values are
+// compared against a block of inputs at once (which vectorizes). Byte-wide
+// integers already use a direct lookup table.
+
+// Up to this many distinct values are compared rather than looked up
+constexpr int32_t kSmallValueSetSize = 16;
+// The largest range of values looked up in a bitmap (32 KiB)
+constexpr uint64_t kMaxValueSetBitmapRange = 1 << 18;
+// The number of values compared at once against a small value set
+constexpr int64_t kSmallValueSetBlockSize = 256;
+
+template <typename Type>
+class IntegerValueSet : public ValueSet<Type, typename Type::c_type> {
+  using Base = ValueSet<Type, typename Type::c_type>;
+  using CType = typename Type::c_type;
+  using UnsignedCType = typename std::make_unsigned<CType>::type;
 
-template <typename Type, typename Scalar>
-class IsInKernel : public IsInKernelImpl {
  public:
-  IsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : type_(type), pool_(pool) {}
+  explicit IntegerValueSet(MemoryPool* pool) : Base(pool) {}
+
+  Status Finish() {
+    const auto num_values = static_cast<int32_t>(memo_index_to_value_index_.size());
+    values_.resize(num_values);
+    memo_table_->CopyValues(values_.data());
+    if (num_values == 0) {
+      strategy_ = SMALL_SET;
+      return Status::OK();
+    }
 
-  // \brief if left array has a null return true
-  Status VisitNull() {
-    writer->Set();
-    writer->Next();
+    // A bitmap lookup is as fast as comparing a handful of values
+    const auto minmax = std::minmax_element(values_.begin(), values_.end());
+    min_ = *minmax.first;
+    range_ = Offset(*minmax.second);
+    if (range_ < kMaxValueSetBitmapRange) {
+      strategy_ = BITMAP;
+      bitmap_.assign(BitUtil::BytesForBits(range_ + 2), 0);
+      for (CType value : values_) {
+        BitUtil::SetBit(bitmap_.data(), Offset(value));
+      }
+    } else if (num_values <= kSmallValueSetSize) {
+      strategy_ = SMALL_SET;
+      return Status::OK();
+    } else {
+      strategy_ = HASH;
+    }
+    // Only the small set compares the values themselves
+    values_.clear();
+    values_.shrink_to_fit();
     return Status::OK();
   }
 
-  // \brief Iterate over the left array using another visitor.
-  // In VisitValue, use the memo_table_ (for right array) and check if value
-  // in left array is in the memo_table_. Return true if condition satisfied,
-  // else false.
-  Status VisitValue(const Scalar& value) {
-    if (memo_table_->Get(value) != -1) {
-      writer->Set();
-    } else {
-      writer->Clear();
+  void FindMany(const ArrayData& data, int32_t* out) const {
+    const CType* values = data.GetValues<CType>(1);
+    switch (strategy_) {
+      case SMALL_SET:
+        for (int64_t i = 0; i < data.length; i += kSmallValueSetBlockSize) {
+          const int64_t block_length =
+              std::min(kSmallValueSetBlockSize, data.length - i);
+          std::fill(out + i, out + i + block_length, -1);
+          for (size_t j = 0; j < values_.size(); ++j) {
+            // The values are distinct, so at most one matches
+            const CType value = values_[j];
+            const int32_t index = memo_index_to_value_index_[j];
+            for (int64_t k = i; k < i + block_length; ++k) {
+              out[k] = values[k] == value ? index : out[k];
+            }
+          }
+        }
+        break;
+      case BITMAP:
+        for (int64_t i = 0; i < data.length; ++i) {
+          out[i] = InBitmap(values[i]) ? Base::Find(values[i]) : -1;
+        }
+        break;
+      case HASH:
+        for (int64_t i = 0; i < data.length; ++i) {
+          out[i] = Base::Find(values[i]);
+        }
+        break;
+    }
+    VisitNullSlots(data, [&](int64_t i) { out[i] = null_index_; });
+  }
+
+  void ContainsMany(const ArrayData& data, uint8_t* out_bitmap,
+                    int64_t out_offset) const {
+    const CType* values = data.GetValues<CType>(1);
+    int64_t i = 0;
+    switch (strategy_) {
+      case SMALL_SET: {
+        // Comparing at the width of the values vectorizes best
+        UnsignedCType found[kSmallValueSetBlockSize];
+        uint8_t found_bytes[kSmallValueSetBlockSize];
+        for (; i < data.length; i += kSmallValueSetBlockSize) {
+          const int64_t block_length =
+              std::min(kSmallValueSetBlockSize, data.length - i);
+          std::fill(found, found + block_length, 0);
+          for (CType value : values_) {
+            for (int64_t k = 0; k < block_length; ++k) {
+              found[k] |= values[i + k] == value;
+            }
+          }
+          for (int64_t k = 0; k < block_length; ++k) {
+            found_bytes[k] = static_cast<uint8_t>(found[k]);
+          }
+          internal::PackBytesToBitmap(found_bytes, block_length, out_bitmap,
+                                      out_offset + i);
+        }
+      } break;
+      case BITMAP:
+        internal::GenerateBitsUnrolled(out_bitmap, out_offset, data.length,
+                                       [&] { return InBitmap(values[i++]); });
+        break;
+      case HASH:
+        internal::GenerateBitsUnrolled(out_bitmap, out_offset, data.length,
+                                       [&] { return Base::Find(values[i++]) != -1; });
+        break;
     }
-    writer->Next();
+    VisitNullSlots(data, [&](int64_t k) { BitUtil::SetBit(out_bitmap, out_offset + k); });
+  }
+
+ private:
+  using Base::memo_index_to_value_index_;
+  using Base::memo_table_;
+  using Base::null_index_;
+
+  enum Strategy { SMALL_SET, BITMAP, HASH };
+
+  // The offset of value from the minimum, wrapping around below it
+  UnsignedCType Offset(CType value) const {
+    return static_cast<UnsignedCType>(static_cast<UnsignedCType>(value) -
+                                      static_cast<UnsignedCType>(min_));
+  }
+
+  // Branch-free, as the values are often as likely out of the range as in
+  // it: those out of it read the unset bit past the range
+  bool InBitmap(CType value) const {
+    const UnsignedCType offset = std::min<UnsignedCType>(Offset(value), range_ + 1);
+    return BitUtil::GetBit(bitmap_.data(), offset);
+  }
+
+  Strategy strategy_ = HASH;
+  // The distinct values in memo index order, for SMALL_SET
+  std::vector<CType> values_;
+  // The values as offsets from min_, for BITMAP
+  std::vector<uint8_t> bitmap_;
+  CType min_ = 0;
+  UnsignedCType range_ = 0;
+};
+
+// ----------------------------------------------------------------------
+
+class SetLookupKernel : public UnaryKernel {
+  virtual Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) = 0;
+
+ public:
+  // \brief Look up the values of left in the value set
+  Status Call(FunctionContext* ctx, const Datum& left, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, left.kind());
+    RETURN_NOT_OK(Compute(ctx, left, out));
     return Status::OK();
   }
 
+  virtual Status ConstructRight(FunctionContext* ctx, const Datum& right) = 0;
+};
+
+template <typename ValueSetType>
+Status AppendValueSet(const Datum& right, ValueSetType* value_set) {
+  if (right.kind() == Datum::ARRAY) {
+    RETURN_NOT_OK(value_set->Append(*right.array()));
+  } else if (right.kind() == Datum::CHUNKED_ARRAY) {
+    const ChunkedArray& right_array = *right.chunked_array();
+    for (int i = 0; i < right_array.num_chunks(); i++) {
+      RETURN_NOT_OK(value_set->Append(*right_array.chunk(i)->data()));
+    }
+  } else {
+    return Status::Invalid("Input Datum was not array-like");
+  }
+  return value_set->Finish();
+}
+
+template <typename ValueSetType>
+class IsInKernel : public SetLookupKernel {
+ public:
+  IsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : value_set_(pool) {}
+
+  // \brief Check whether each value of left is in the value set, nulls
+  // being in it if the value set has nulls
   Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
     const ArrayData& left_data = *left.array();
-
-    output = out->array();
+    ArrayData* output = out->array().get();
     output->type = boolean();
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
-
-    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(left_data, this));
-    writer->Finish();
+    value_set_.ContainsMany(left_data, output->buffers[1]->mutable_data(),
+                            output->offset);
 
     // if right null count is zero and left null count is not zero, propagate nulls
-    if (right_null_count_ == 0 && left_data.GetNullCount() != 0) {
-      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output.get()));
+    if (!value_set_.has_nulls() && left_data.GetNullCount() != 0) {
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output));
     }
     return Status::OK();
   }
 
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
   Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
-    MemoTableRight<Type, Scalar> func;
-    RETURN_NOT_OK(func.Reset(pool_));
-
-    if (right.kind() == Datum::ARRAY) {
-      RETURN_NOT_OK(func.Append(ctx, right));
-    } else if (right.kind() == Datum::CHUNKED_ARRAY) {
-      const ChunkedArray& right_array = *right.chunked_array();
-      for (int i = 0; i < right_array.num_chunks(); i++) {
-        RETURN_NOT_OK(func.Append(ctx, right_array.chunk(i)));
-      }
-    } else {
-      return Status::Invalid("Input Datum was not array-like");
-    }
+    return AppendValueSet(right, &value_set_);
+  }
 
-    memo_table_ = std::move(func.memo_table_);
-    right_null_count_ = func.right_null_count;
-    return Status::OK();
+ private:
+  ValueSetType value_set_;
+};
+
+// \brief Make the indices of Match null where they are -1
+Status SetMissingIndicesNull(FunctionContext* ctx, ArrayData* output) {
+  const int32_t* indices = output->GetValues<int32_t>(1);
+  std::shared_ptr<Buffer> validity;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(output->length), &validity));
+  int64_t null_count = 0;
+  int64_t i = 0;
+  internal::GenerateBitsUnrolled(validity->mutable_data(), 0, output->length, [&] {
+    const bool found = indices[i++] != -1;
+    null_count += !found;
+    return found;
+  });
+  output->null_count = null_count;
+  if (null_count > 0) {
+    output->buffers[0] = std::move(validity);
   }
+  return Status::OK();
+}
 
- protected:
-  using MemoTable = typename HashTraits<Type>::MemoTableType;
-  std::unique_ptr<MemoTable> memo_table_;
-  std::shared_ptr<DataType> type_;
-  MemoryPool* pool_;
+template <typename ValueSetType>
+class MatchKernel : public SetLookupKernel {
+ public:
+  MatchKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : value_set_(pool) {}
+
+  // \brief Find the index of each value of left in the value set, null if
+  // it is absent
+  Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
+    const ArrayData& left_data = *left.array();
+    ArrayData* output = out->array().get();
+    output->type = int32();
+
+    value_set_.FindMany(left_data, output->GetMutableValues<int32_t>(1));
+    return SetMissingIndicesNull(ctx, output);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+  Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
+    return AppendValueSet(right, &value_set_);
+  }
 
  private:
-  // \brief Additional member "right_null_count" is used to check if
-  // null count in right is not 0
-  int64_t right_null_count_{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
+  ValueSetType value_set_;
 };
 
 // ----------------------------------------------------------------------
 // (NullType has a separate implementation)
 
-class NullIsInKernel : public IsInKernelImpl {
+// \brief The value set of NullType, where the first null is the first value
+struct NullValueSet {
+  Status Append(const ArrayData& data) {
+    length += data.length;
+    return Status::OK();
+  }
+
+  Status Finish() { return Status::OK(); }
+
+  int64_t length = 0;
+};
+
+class NullIsInKernel : public SetLookupKernel {
  public:
   NullIsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool) {}
 
@@ -191,120 +457,162 @@ class NullIsInKernel : public IsInKernelImpl {
   // return true, else propagate to all nulls
   Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
     const ArrayData& left_data = *left.array();
-    left_null_count = left_data.GetNullCount();
-
-    output = out->array();
+    ArrayData* output = out->array().get();
     output->type = boolean();
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
-
-    if (left_null_count != 0 && right_null_count == 0) {
-      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output.get()));
+    if (left_data.GetNullCount() != 0 && value_set_.length == 0) {
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output));
     } else {
-      for (int64_t i = 0; i < left_data.length; ++i) {
-        writer->Set();
-        writer->Next();
-      }
-      writer->Finish();
+      BitUtil::SetBitsTo(output->buffers[1]->mutable_data(), output->offset,
+                         left_data.length, true);
     }
     return Status::OK();
   }
 
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
   Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
-    if (right.kind() == Datum::ARRAY) {
-      const ArrayData& right_data = *right.array();
-      right_null_count = right_data.GetNullCount();
-    } else if (right.kind() == Datum::CHUNKED_ARRAY) {
-      const ChunkedArray& right_array = *right.chunked_array();
-      for (int i = 0; i < right_array.num_chunks(); i++) {
-        right_null_count += right_array.chunk(i)->null_count();
-      }
-    } else {
-      return Status::Invalid("Input Datum was not array-like");
-    }
-    return Status::OK();
+    return AppendValueSet(right, &value_set_);
+  }
+
+ private:
+  NullValueSet value_set_;
+};
+
+class NullMatchKernel : public SetLookupKernel {
+ public:
+  NullMatchKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool) {}
+
+  // \brief All nulls match the first value of a non-empty value set
+  Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
+    const ArrayData& left_data = *left.array();
+    ArrayData* output = out->array().get();
+    output->type = int32();
+
+    int32_t* indices = output->GetMutableValues<int32_t>(1);
+    std::fill(indices, indices + left_data.length, value_set_.length == 0 ? -1 : 0);
+    return SetMissingIndicesNull(ctx, output);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+  Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
+    return AppendValueSet(right, &value_set_);
   }
 
  private:
-  int64_t left_null_count{};
-  int64_t right_null_count{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
+  NullValueSet value_set_;
 };
 
 // ----------------------------------------------------------------------
 // Kernel wrapper for generic hash table kernels
 
+// Integers wider than a byte, including temporal types
 template <typename Type, typename Enable = void>
-struct IsInKernelTraits {};
+struct IsWideInteger : std::false_type {};
 
 template <typename Type>
-struct IsInKernelTraits<Type, enable_if_null<Type>> {
-  using IsInKernelImpl = NullIsInKernel;
+struct IsWideInteger<Type, enable_if_has_c_type<Type>>
+    : std::integral_constant<bool,
+                             std::is_integral<typename Type::c_type>::value &&
+                                 !std::is_same<typename Type::c_type, bool>::value &&
+                                 (sizeof(typename Type::c_type) > 1)> {};
+
+template <typename ValueSetType>
+struct SetLookupKernels {
+  using IsInKernelType = IsInKernel<ValueSetType>;
+  using MatchKernelType = MatchKernel<ValueSetType>;
 };
 
+template <typename Type, typename Enable = void>
+struct SetLookupKernelTraits {};
+
 template <typename Type>
-struct IsInKernelTraits<Type, enable_if_has_c_type<Type>> {
-  using IsInKernelImpl = IsInKernel<Type, typename Type::c_type>;
+struct SetLookupKernelTraits<Type, enable_if_null<Type>> {
+  using IsInKernelType = NullIsInKernel;
+  using MatchKernelType = NullMatchKernel;
 };
 
 template <typename Type>
-struct IsInKernelTraits<Type, enable_if_has_string_view<Type>> {
-  using IsInKernelImpl = IsInKernel<Type, util::string_view>;
+struct SetLookupKernelTraits<
+    Type, enable_if_t<has_c_type<Type>::value && !IsWideInteger<Type>::value>>
+    : SetLookupKernels<ValueSet<Type, typename Type::c_type>> {};
+
+template <typename Type>
+struct SetLookupKernelTraits<Type, enable_if_t<IsWideInteger<Type>::value>>
+    : SetLookupKernels<IntegerValueSet<Type>> {};
+
+template <typename Type>
+struct SetLookupKernelTraits<Type, enable_if_has_string_view<Type>>
+    : SetLookupKernels<ValueSet<Type, util::string_view>> {};
+
+struct IsInKernelSelector {
+  template <typename Type>
+  using KernelType = typename SetLookupKernelTraits<Type>::IsInKernelType;
+  static const char* name() { return "IsIn"; }
+};
+
+struct MatchKernelSelector {
+  template <typename Type>
+  using KernelType = typename SetLookupKernelTraits<Type>::MatchKernelType;
+  static const char* name() { return "Match"; }
 };
 
-Status GetIsInKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
-                     const Datum& right, std::unique_ptr<IsInKernelImpl>* out) {
-  std::unique_ptr<IsInKernelImpl> kernel;
+template <typename KernelSelector>
+Status GetSetLookupKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                          const Datum& right, std::unique_ptr<SetLookupKernel>* out) {
+  std::unique_ptr<SetLookupKernel> kernel;
 
-#define ISIN_CASE(InType)                                               \
-  case InType::type_id:                                                 \
-    kernel.reset(new typename IsInKernelTraits<InType>::IsInKernelImpl( \
-        type, ctx->memory_pool()));                                     \
+#define SET_LOOKUP_CASE(InType)                                                 \
+  case InType::type_id:                                                         \
+    kernel.reset(new typename KernelSelector::template KernelType<InType>(      \
+        type, ctx->memory_pool()));                                             \
     break
 
   switch (type->id()) {
-    ISIN_CASE(NullType);
-    ISIN_CASE(BooleanType);
-    ISIN_CASE(UInt8Type);
-    ISIN_CASE(Int8Type);
-    ISIN_CASE(UInt16Type);
-    ISIN_CASE(Int16Type);
-    ISIN_CASE(UInt32Type);
-    ISIN_CASE(Int32Type);
-    ISIN_CASE(UInt64Type);
-    ISIN_CASE(Int64Type);
-    ISIN_CASE(FloatType);
-    ISIN_CASE(DoubleType);
-    ISIN_CASE(Date32Type);
-    ISIN_CASE(Date64Type);
-    ISIN_CASE(Time32Type);
-    ISIN_CASE(Time64Type);
-    ISIN_CASE(TimestampType);
-    ISIN_CASE(BinaryType);
-    ISIN_CASE(StringType);
-    ISIN_CASE(FixedSizeBinaryType);
-    ISIN_CASE(Decimal128Type);
+    SET_LOOKUP_CASE(NullType);
+    SET_LOOKUP_CASE(BooleanType);
+    SET_LOOKUP_CASE(UInt8Type);
+    SET_LOOKUP_CASE(Int8Type);
+    SET_LOOKUP_CASE(UInt16Type);
+    SET_LOOKUP_CASE(Int16Type);
+    SET_LOOKUP_CASE(UInt32Type);
+    SET_LOOKUP_CASE(Int32Type);
+    SET_LOOKUP_CASE(UInt64Type);
+    SET_LOOKUP_CASE(Int64Type);
+    SET_LOOKUP_CASE(FloatType);
+    SET_LOOKUP_CASE(DoubleType);
+    SET_LOOKUP_CASE(Date32Type);
+    SET_LOOKUP_CASE(Date64Type);
+    SET_LOOKUP_CASE(Time32Type);
+    SET_LOOKUP_CASE(Time64Type);
+    SET_LOOKUP_CASE(TimestampType);
+    SET_LOOKUP_CASE(BinaryType);
+    SET_LOOKUP_CASE(StringType);
+    SET_LOOKUP_CASE(FixedSizeBinaryType);
+    SET_LOOKUP_CASE(Decimal128Type);
     default:
       break;
   }
-#undef ISIN_CASE
+#undef SET_LOOKUP_CASE
 
   if (!kernel) {
-    return Status::NotImplemented("IsIn is not implemented for ", type->ToString());
+    return Status::NotImplemented(KernelSelector::name(), " is not implemented for ",
+                                  type->ToString());
   }
   RETURN_NOT_OK(kernel->ConstructRight(ctx, right));
   *out = std::move(kernel);
   return Status::OK();
 }
 
-Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+template <typename KernelSelector>
+Status SetLookup(FunctionContext* ctx, const Datum& left, const Datum& right,
+                 Datum* out) {
   DCHECK(left.type()->Equals(right.type()));
   std::vector<Datum> outputs;
-  std::unique_ptr<IsInKernelImpl> lkernel;
+  std::unique_ptr<SetLookupKernel> lkernel;
 
-  RETURN_NOT_OK(GetIsInKernel(ctx, left.type(), right, &lkernel));
+  RETURN_NOT_OK(GetSetLookupKernel<KernelSelector>(ctx, left.type(), right, &lkernel));
   detail::PrimitiveAllocatingUnaryKernel kernel(lkernel.get());
   RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, left, &outputs));
 
@@ -312,5 +620,13 @@ Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum*
   return Status::OK();
 }
 
+Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  return SetLookup<IsInKernelSelector>(ctx, left, right, out);
+}
+
+Status Match(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  return SetLookup<MatchKernelSelector>(ctx, left, right, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -45,5 +45,22 @@ namespace compute {
 ARROW_EXPORT
 Status IsIn(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
 
+/// \brief Match returns the index in right of the first occurrence of
+/// each value of left, as int32, or null if it doesn't occur.
+///
+/// If null occurs in left, if null count in right is not 0,
+/// it returns the index of the first null in right, else returns null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left array-like input
+/// \param[in] right array-like input
+/// \param[out] out resulting datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Match(FunctionContext* context, const Datum& left, const Datum& right,
+             Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/compute/kernels/isin.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x1515;
+
+// Values in [0, max_value] looked up in a value set of value_set_size values
+// of the same range, small and narrow value sets having specialized lookups
+static void MakeSetLookupInt64(const RegressionArgs& args, int64_t value_set_size,
+                               int64_t max_value, std::shared_ptr<Array>* values,
+                               std::shared_ptr<Array>* value_set) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t array_size = args.size / sizeof(int64_t);
+  *values = rand.Int64(array_size, 0, max_value, args.null_proportion);
+  *value_set = rand.Int64(value_set_size, 0, max_value, 0);
+}
+
+static void IsInInt64(benchmark::State& state, int64_t value_set_size,
+                      int64_t max_value) {
+  RegressionArgs args(state);
+  std::shared_ptr<Array> values, value_set;
+  MakeSetLookupInt64(args, value_set_size, max_value, &values, &value_set);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(IsIn(&ctx, Datum(values), Datum(value_set), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void MatchInt64(benchmark::State& state, int64_t value_set_size,
+                       int64_t max_value) {
+  RegressionArgs args(state);
+  std::shared_ptr<Array> values, value_set;
+  MakeSetLookupInt64(args, value_set_size, max_value, &values, &value_set);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Match(&ctx, Datum(values), Datum(value_set), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void IsInString(benchmark::State& state, int64_t value_set_size) {
+  RegressionArgs args(state);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t array_size = args.size / 8;
+  auto values = rand.String(array_size, 1, 4, args.null_proportion);
+  auto value_set = rand.String(value_set_size, 1, 4, 0);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(IsIn(&ctx, Datum(values), Datum(value_set), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK_CAPTURE(IsInInt64, SmallSet, 8, 100)->Apply(RegressionSetArgs);
+BENCHMARK_CAPTURE(IsInInt64, NarrowSet, 200, 10000)->Apply(RegressionSetArgs);
+BENCHMARK_CAPTURE(IsInInt64, LargeSet, 1000, 1LL << 40)->Apply(RegressionSetArgs);
+BENCHMARK_CAPTURE(MatchInt64, SmallSet, 8, 100)->Apply(RegressionSetArgs);
+BENCHMARK_CAPTURE(MatchInt64, NarrowSet, 200, 10000)->Apply(RegressionSetArgs);
+BENCHMARK_CAPTURE(MatchInt64, LargeSet, 1000, 1LL << 40)->Apply(RegressionSetArgs);
+BENCHMARK_CAPTURE(IsInString, SmallSet, 8)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
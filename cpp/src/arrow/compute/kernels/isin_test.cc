@@ -20,9 +20,12 @@
 #include <cstdio>
 #include <functional>
 #include <locale>
+#include <limits>
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -411,5 +414,159 @@ TEST_F(TestIsInKernel, IsInChunkedArrayInvoke) {
   AssertChunkedEqual(*expected_carr, *encoded_out.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// Match tests
+
+template <typename Type, typename T = typename TypeTraits<Type>::c_type>
+void CheckMatch(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                const std::vector<T>& in_values, const std::vector<bool>& in_is_valid,
+                const std::vector<T>& member_set_values,
+                const std::vector<bool>& member_set_is_valid,
+                const std::vector<int32_t>& out_values,
+                const std::vector<bool>& out_is_valid) {
+  std::shared_ptr<Array> input = _MakeArray<Type, T>(type, in_values, in_is_valid);
+  std::shared_ptr<Array> member_set =
+      _MakeArray<Type, T>(type, member_set_values, member_set_is_valid);
+  std::shared_ptr<Array> expected =
+      _MakeArray<Int32Type, int32_t>(int32(), out_values, out_is_valid);
+
+  Datum datum_out;
+  ASSERT_OK(Match(ctx, input, member_set, &datum_out));
+  std::shared_ptr<Array> result = datum_out.make_array();
+  ASSERT_OK(result->ValidateFull());
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+}
+
+TYPED_TEST(TestIsInKernelPrimitive, Match) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+
+  // No Nulls, the first occurrence is matched
+  CheckMatch<TypeParam, T>(&this->ctx_, type, {2, 1, 2, 1, 2, 3}, {}, {4, 2, 1, 2, 3},
+                           {}, {1, 2, 1, 2, 1, 4}, {});
+  // Nulls in left array
+  CheckMatch<TypeParam, T>(&this->ctx_, type, {2, 1, 2, 1}, {false, true, false, true},
+                           {2, 1}, {}, {0, 1, 0, 1}, {false, true, false, true});
+  // Nulls in both the arrays
+  CheckMatch<TypeParam, T>(&this->ctx_, type, {2, 1, 2, 3}, {false, true, true, false},
+                           {1, 1, 0, 0}, {true, true, false, false}, {2, 0, 0, 2},
+                           {true, true, false, true});
+  // No Match
+  CheckMatch<TypeParam, T>(&this->ctx_, type, {7, 8}, {}, {2, 1}, {}, {0, 0},
+                           {false, false});
+
+  // Empty Arrays
+  CheckMatch<TypeParam, T>(&this->ctx_, type, {}, {}, {}, {}, {}, {});
+}
+
+TEST_F(TestIsInKernel, MatchNull) {
+  CheckMatch<NullType, std::nullptr_t>(&this->ctx_, null(), {nullptr, nullptr}, {},
+                                       {nullptr, nullptr}, {}, {0, 0}, {});
+
+  // Empty right array
+  CheckMatch<NullType, std::nullptr_t>(&this->ctx_, null(), {nullptr, nullptr}, {}, {},
+                                       {}, {0, 0}, {false, false});
+}
+
+TEST_F(TestIsInKernel, MatchBinary) {
+  CheckMatch<StringType, std::string>(&this->ctx_, utf8(), {"foo", "", "bar", "quux"},
+                                      {true, false, true, true},
+                                      {"bar", "", "foo", "bar"},
+                                      {true, false, true, true}, {2, 1, 0, 0},
+                                      {true, true, true, false});
+}
+
+TEST_F(TestIsInKernel, MatchChunkedArrayInvoke) {
+  auto type = utf8();
+  auto a1 = _MakeArray<StringType, std::string>(type, {"foo", "bar"}, {});
+  auto a2 = _MakeArray<StringType, std::string>(type, {"baz", "foo"}, {});
+  auto s1 = _MakeArray<StringType, std::string>(type, {"foo"}, {});
+  auto s2 = _MakeArray<StringType, std::string>(type, {"bar", "foo"}, {});
+
+  auto carr = std::make_shared<ChunkedArray>(ArrayVector{a1, a2});
+  auto member_set = std::make_shared<ChunkedArray>(ArrayVector{s1, s2});
+
+  auto i1 = _MakeArray<Int32Type, int32_t>(int32(), {0, 1}, {});
+  auto i2 = _MakeArray<Int32Type, int32_t>(int32(), {0, 0}, {false, true});
+  ChunkedArray expected({i1, i2});
+
+  Datum out;
+  ASSERT_OK(Match(&this->ctx_, carr, member_set, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(expected, *out.chunked_array());
+}
+
+// Integers wider than a byte compare small value sets, look up narrow ones
+// in a bitmap and hash the others
+template <typename Type>
+class TestSetLookupInteger : public ComputeFixture, public TestBase {};
+
+typedef ::testing::Types<Int16Type, UInt16Type, Int32Type, UInt32Type, Int64Type,
+                         UInt64Type, Date64Type>
+    WideIntegerTypes;
+
+TYPED_TEST_CASE(TestSetLookupInteger, WideIntegerTypes);
+
+TYPED_TEST(TestSetLookupInteger, ValueSetSizesAndRanges) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  std::default_random_engine engine(42);
+
+  // (value set size, spread of the values)
+  const std::vector<std::pair<int, int64_t>> value_sets = {
+      {0, 1}, {1, 1}, {5, 10}, {16, 1000}, {17, 20}, {200, 2000}, {200, 1LL << 40}};
+  for (const auto& size_and_spread : value_sets) {
+    const int64_t spread =
+        std::min<int64_t>(size_and_spread.second, std::numeric_limits<T>::max() / 4);
+    // Centered around the lowest value of signed types, to cover wraparound
+    const T base = std::is_signed<T>::value ? static_cast<T>(-spread / 2) : 3;
+    std::uniform_int_distribution<int64_t> dist(0, spread);
+    auto random_value = [&]() { return static_cast<T>(base + dist(engine)); };
+
+    std::vector<T> member_set(size_and_spread.first);
+    std::generate(member_set.begin(), member_set.end(), random_value);
+    std::vector<T> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = (member_set.empty() || i % 2) ? random_value()
+                                                : member_set[i % member_set.size()];
+    }
+    std::vector<bool> is_valid(values.size());
+    for (size_t i = 0; i < is_valid.size(); ++i) {
+      is_valid[i] = i % 7 != 0;
+    }
+
+    std::vector<bool> expected_is_in;
+    std::vector<int32_t> expected_match;
+    std::vector<bool> expected_match_is_valid;
+    for (size_t i = 0; i < values.size(); ++i) {
+      const auto it = std::find(member_set.begin(), member_set.end(), values[i]);
+      expected_is_in.push_back(it != member_set.end());
+      expected_match.push_back(static_cast<int32_t>(it - member_set.begin()));
+      expected_match_is_valid.push_back(it != member_set.end() && is_valid[i]);
+    }
+    std::vector<bool> expected_is_in_is_valid = is_valid;
+
+    SCOPED_TRACE("value set size = " + std::to_string(member_set.size()) +
+                 ", spread = " + std::to_string(spread));
+    CheckIsIn<TypeParam, T>(&this->ctx_, type, values, is_valid, member_set, {},
+                            expected_is_in, expected_is_in_is_valid);
+    CheckMatch<TypeParam, T>(&this->ctx_, type, values, is_valid, member_set, {},
+                             expected_match, expected_match_is_valid);
+
+    // Sliced input
+    Datum out;
+    auto input = _MakeArray<TypeParam, T>(type, values, is_valid)->Slice(3);
+    auto right = _MakeArray<TypeParam, T>(type, member_set, {});
+    ASSERT_OK(IsIn(&this->ctx_, input, right, &out));
+    auto expected = _MakeArray<BooleanType, bool>(boolean(), expected_is_in,
+                                                  expected_is_in_is_valid);
+    AssertArraysEqual(*expected->Slice(3), *out.make_array());
+    ASSERT_OK(Match(&this->ctx_, input, right, &out));
+    expected = _MakeArray<Int32Type, int32_t>(int32(), expected_match,
+                                              expected_match_is_valid);
+    AssertArraysEqual(*expected->Slice(3), *out.make_array());
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
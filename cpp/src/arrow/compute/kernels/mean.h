@@ -43,7 +43,7 @@ std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& typ
 /// \brief Compute the mean of a numeric array.
 ///
 /// \param[in] context the FunctionContext
-/// \param[in] value datum to compute the mean, expecting Array
+/// \param[in] value datum to compute the mean, expecting Array or ChunkedArray
 /// \param[out] mean datum of the computed mean as a DoubleScalar
 ///
 /// \since 0.13.0
@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/compute/kernels/merge_sorted.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sort_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+class MergeSortedReader : public RecordBatchReader {
+ public:
+  MergeSortedReader(FunctionContext* ctx,
+                    std::vector<std::shared_ptr<RecordBatchReader>> inputs,
+                    int64_t batch_size)
+      : ctx_(ctx),
+        inputs_(std::move(inputs)),
+        batch_size_(batch_size),
+        batches_(inputs_.size()),
+        positions_(inputs_.size(), 0) {}
+
+  Status Init(const SortOptions& options) {
+    schema_ = inputs_[0]->schema();
+    for (const auto& input : inputs_) {
+      if (!input->schema()->Equals(*schema_)) {
+        return Status::Invalid("Cannot merge streams of differing schemas ", *schema_,
+                               " and ", *input->schema());
+      }
+    }
+
+    for (const auto& sort_key : options.sort_keys) {
+      int i = schema_->GetFieldIndex(sort_key.name);
+      if (i == -1) {
+        return Status::Invalid("Sort key column '", sort_key.name,
+                               "' not found in schema");
+      }
+      std::unique_ptr<SortKeyColumn> key;
+      RETURN_NOT_OK(MakeSortKeyColumn(ArrayVector(inputs_.size()),
+                                      *schema_->field(i)->type(), sort_key.order, &key));
+      key_indices_.push_back(i);
+      keys_.push_back(std::move(key));
+    }
+
+    for (int input = 0; input < static_cast<int>(inputs_.size()); ++input) {
+      bool has_rows;
+      RETURN_NOT_OK(NextBatch(input, &has_rows));
+      if (has_rows) {
+        heap_.push_back(input);
+      }
+    }
+    std::make_heap(heap_.begin(), heap_.end(), heap_order());
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    // Contiguous rows of the same input batch are taken as one slice
+    struct Run {
+      std::shared_ptr<RecordBatch> batch;
+      int64_t offset;
+      int64_t length;
+    };
+    std::vector<Run> runs;
+    int64_t num_rows = 0;
+
+    while (num_rows < batch_size_ && !heap_.empty()) {
+      std::pop_heap(heap_.begin(), heap_.end(), heap_order());
+      const int input = heap_.back();
+      const std::shared_ptr<RecordBatch>& batch = batches_[input];
+      const int64_t position = positions_[input];
+      if (!runs.empty() && runs.back().batch == batch &&
+          runs.back().offset + runs.back().length == position) {
+        ++runs.back().length;
+      } else {
+        runs.push_back({batch, position, 1});
+      }
+      ++num_rows;
+
+      if (++positions_[input] == batch->num_rows()) {
+        bool has_rows;
+        RETURN_NOT_OK(NextBatch(input, &has_rows));
+        if (!has_rows) {
+          heap_.pop_back();
+          continue;
+        }
+      }
+      std::push_heap(heap_.begin(), heap_.end(), heap_order());
+    }
+
+    if (num_rows == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<Array>> columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector slices;
+      for (const auto& run : runs) {
+        slices.push_back(run.batch->column(i)->Slice(run.offset, run.length));
+      }
+      if (slices.size() == 1) {
+        columns[i] = std::move(slices[0]);
+      } else {
+        RETURN_NOT_OK(Concatenate(slices, ctx_->memory_pool(), &columns[i]));
+      }
+    }
+    *out = RecordBatch::Make(schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  // Whether the heap should yield the current row of right before the one of
+  // left: ties are broken by input order
+  struct After {
+    bool operator()(int left, int right) const {
+      for (const auto& key : reader->keys_) {
+        const int cmp = key->Compare(left, reader->positions_[left], right,
+                                     reader->positions_[right]);
+        if (cmp != 0) {
+          return cmp > 0;
+        }
+      }
+      return left > right;
+    }
+
+    const MergeSortedReader* reader;
+  };
+
+  After heap_order() const { return {this}; }
+
+  // Read the next non-empty batch of an input
+  Status NextBatch(int input, bool* has_rows) {
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      RETURN_NOT_OK(inputs_[input]->ReadNext(&batch));
+    } while (batch != nullptr && batch->num_rows() == 0);
+
+    positions_[input] = 0;
+    batches_[input] = batch;
+    *has_rows = batch != nullptr;
+    if (batch != nullptr) {
+      for (size_t i = 0; i < keys_.size(); ++i) {
+        keys_[i]->SetChunk(input, *batch->column(key_indices_[i]));
+      }
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<RecordBatchReader>> inputs_;
+  int64_t batch_size_;
+  std::shared_ptr<Schema> schema_;
+
+  std::vector<int> key_indices_;
+  std::vector<std::unique_ptr<SortKeyColumn>> keys_;
+
+  // The current batch of each input, and the position of its next row
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  std::vector<int64_t> positions_;
+  // The inputs which have rows left
+  std::vector<int> heap_;
+};
+
+}  // namespace
+
+Status MakeMergeSortedReader(FunctionContext* ctx,
+                             std::vector<std::shared_ptr<RecordBatchReader>> inputs,
+                             const SortOptions& options, int64_t batch_size,
+                             std::shared_ptr<RecordBatchReader>* out) {
+  if (inputs.empty()) {
+    return Status::Invalid("Must specify one or more streams to merge");
+  }
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  if (batch_size <= 0) {
+    return Status::Invalid("Batch size must be positive, got ", batch_size);
+  }
+
+  auto reader = std::make_shared<MergeSortedReader>(ctx, std::move(inputs), batch_size);
+  RETURN_NOT_OK(reader->Init(options));
+  *out = std::move(reader);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+class Status;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Merge streams of record batches which are each sorted on the same
+/// keys into one sorted stream
+///
+/// The inputs must have equal schemas and be sorted as SortToIndices would
+/// sort them with options: stably, nulls last. Rows with equal keys are read
+/// in the order of their input, then of their position in it.
+///
+/// Only the current batch of each input, and the batches the next output
+/// batch takes rows from, are held in memory: inputs are read as their rows
+/// are consumed.
+///
+/// \param[in] ctx the FunctionContext, which must outlive the reader
+/// \param[in] inputs the sorted streams
+/// \param[in] options the sort keys of the inputs; options.use_threads is
+/// ignored
+/// \param[in] batch_size the maximum number of rows of the output batches
+/// \param[out] out the merged stream
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MakeMergeSortedReader(FunctionContext* ctx,
+                             std::vector<std::shared_ptr<RecordBatchReader>> inputs,
+                             const SortOptions& options, int64_t batch_size,
+                             std::shared_ptr<RecordBatchReader>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/merge_sorted.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestMergeSorted : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<RecordBatchReader> MakeReader(
+      const std::shared_ptr<Schema>& schema,
+      const std::vector<std::string>& batches_json) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (const auto& json : batches_json) {
+      batches.push_back(RecordBatchFromJSON(schema, json));
+    }
+    std::shared_ptr<RecordBatchReader> reader;
+    ABORT_NOT_OK(MakeRecordBatchReader(batches, schema, &reader));
+    return reader;
+  }
+
+  void AssertMerged(std::vector<std::shared_ptr<RecordBatchReader>> inputs,
+                    const SortOptions& options, int64_t batch_size,
+                    const Table& expected) {
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(MakeMergeSortedReader(&ctx_, std::move(inputs), options, batch_size,
+                                    &reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    for (const auto& batch : batches) {
+      ASSERT_OK(batch->ValidateFull());
+      ASSERT_GT(batch->num_rows(), 0);
+      ASSERT_LE(batch->num_rows(), batch_size);
+    }
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(Table::FromRecordBatches(expected.schema(), batches, &actual));
+    AssertTablesEqual(expected, *actual, /*same_chunk_layout=*/false);
+  }
+};
+
+TEST_F(TestMergeSorted, Basics) {
+  auto batch_schema = schema({field("k", int32()), field("v", utf8())});
+  auto expected = TableFromJSON(batch_schema, {R"([
+    {"k": 1, "v": "a0"},
+    {"k": 1, "v": "b0"},
+    {"k": 2, "v": "a1"},
+    {"k": 3, "v": "b1"},
+    {"k": 4, "v": "a2"},
+    {"k": 5, "v": "c0"},
+    {"k": null, "v": "a3"},
+    {"k": null, "v": "b2"}
+  ])"});
+
+  for (int64_t batch_size : {1, 3, 100}) {
+    auto a = MakeReader(batch_schema, {R"([{"k": 1, "v": "a0"}, {"k": 2, "v": "a1"}])",
+                                       "[]", R"([{"k": 4, "v": "a2"}])",
+                                       R"([{"k": null, "v": "a3"}])"});
+    auto b = MakeReader(batch_schema, {R"([{"k": 1, "v": "b0"}, {"k": 3, "v": "b1"},
+                                          {"k": null, "v": "b2"}])"});
+    auto c = MakeReader(batch_schema, {R"([{"k": 5, "v": "c0"}])"});
+    AssertMerged({a, b, MakeReader(batch_schema, {}), c}, SortOptions({SortKey("k")}),
+                 batch_size, *expected);
+  }
+}
+
+TEST_F(TestMergeSorted, RandomValues) {
+  random::RandomArrayGenerator rand(0x5487655);
+  auto table_schema =
+      schema({field("a", int16()), field("b", utf8()), field("c", float64())});
+  SortOptions options({SortKey("a", SortKey::DESCENDING), SortKey("b")});
+
+  // Sort random tables, then read each as a stream of batches of various sizes
+  const int num_inputs = 5;
+  std::vector<std::shared_ptr<Table>> inputs;
+  std::vector<std::shared_ptr<RecordBatchReader>> readers;
+  for (int i = 0; i < num_inputs; ++i) {
+    const int64_t length = 100 * i;
+    auto table = Table::Make(table_schema, {rand.Int16(length, 0, 20, 0.1),
+                                            rand.String(length, 0, 1, 0.1),
+                                            rand.Float64(length, 0, 1, 0.1)});
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(SortToIndices(&ctx_, *table, options, &indices));
+    std::shared_ptr<Table> sorted;
+    ASSERT_OK(Take(&ctx_, *table, *indices, TakeOptions(), &sorted));
+    inputs.push_back(sorted);
+
+    // The reader references the table, which inputs keeps alive
+    auto batch_reader = std::make_shared<TableBatchReader>(*sorted);
+    batch_reader->set_chunksize(7 * i + 1);
+    readers.push_back(std::move(batch_reader));
+  }
+
+  // A stable sort of the concatenated inputs yields the same rows
+  std::shared_ptr<Table> concatenated, expected;
+  ASSERT_OK(ConcatenateTables(inputs, &concatenated));
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(SortToIndices(&ctx_, *concatenated, options, &indices));
+  ASSERT_OK(Take(&ctx_, *concatenated, *indices, TakeOptions(), &expected));
+
+  AssertMerged(readers, options, 64, *expected);
+}
+
+TEST_F(TestMergeSorted, Errors) {
+  auto batch_schema = schema({field("k", int32()), field("b", boolean())});
+  std::shared_ptr<RecordBatchReader> out;
+  SortOptions options({SortKey("k")});
+
+  ASSERT_RAISES(Invalid, MakeMergeSortedReader(&ctx_, {}, options, 10, &out));
+  ASSERT_RAISES(Invalid, MakeMergeSortedReader(&ctx_, {MakeReader(batch_schema, {})},
+                                               SortOptions(), 10, &out));
+  ASSERT_RAISES(Invalid, MakeMergeSortedReader(&ctx_, {MakeReader(batch_schema, {})},
+                                               options, 0, &out));
+  ASSERT_RAISES(Invalid,
+                MakeMergeSortedReader(&ctx_, {MakeReader(batch_schema, {})},
+                                      SortOptions({SortKey("missing")}), 10, &out));
+  ASSERT_RAISES(NotImplemented,
+                MakeMergeSortedReader(&ctx_, {MakeReader(batch_schema, {})},
+                                      SortOptions({SortKey("b")}), 10, &out));
+  ASSERT_RAISES(Invalid,
+                MakeMergeSortedReader(
+                    &ctx_,
+                    {MakeReader(batch_schema, {}),
+                     MakeReader(schema({field("k", int32())}), {})},
+                    options, 10, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
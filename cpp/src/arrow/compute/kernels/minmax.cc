@@ -84,11 +84,20 @@ class MinMaxAggregateFunction final
   Status Consume(const Array& array, StateType* state) const override {
     StateType local;
 
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
     const auto values =
         checked_cast<const typename TypeTraits<ArrowType>::ArrayType&>(array)
             .raw_values();
+    // Arrays without nulls may have no validity bitmap to read
+    if (array.null_count() == 0) {
+      for (int64_t i = 0; i < array.length(); i++) {
+        local.MergeOne(values[i]);
+      }
+      *state = local;
+      return Status::OK();
+    }
+
+    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
+                                  array.length());
     for (int64_t i = 0; i < array.length(); i++) {
       if (reader.IsSet()) {
         local.MergeOne(values[i]);
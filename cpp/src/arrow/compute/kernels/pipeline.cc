@@ -0,0 +1,354 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/pipeline.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CopyBitmap;
+
+namespace compute {
+
+constexpr int64_t ElementwisePipeline::kDefaultMorselLength;
+
+namespace {
+
+// An input, constant or step output of a pipeline
+struct PipelineValue {
+  std::shared_ptr<DataType> type;
+  // Only set for scalar constants
+  std::shared_ptr<Scalar> scalar;
+};
+
+struct PipelineStep {
+  std::shared_ptr<UnaryKernel> unary;
+  std::shared_ptr<BinaryKernel> binary;
+  int args[2];
+  // The id of the step's output value
+  int out;
+};
+
+int BitWidth(const DataType& type) {
+  return checked_cast<const FixedWidthType&>(type).bit_width();
+}
+
+// Size of the data buffer of a fixed-width array, see
+// detail::PrimitiveAllocatingUnaryKernel
+int64_t DataBufferSize(int bit_width, int64_t length) {
+  return bit_width == 1 ? BitUtil::BytesForBits(length) : length * (bit_width / 8);
+}
+
+Status AllocateDataBuffer(FunctionContext* ctx, int bit_width, int64_t length,
+                          std::shared_ptr<Buffer>* out) {
+  const int64_t size = DataBufferSize(bit_width, length);
+  RETURN_NOT_OK(ctx->Allocate(size, out));
+  if (bit_width == 1 && size > 0) {
+    // Trailing bits of the last byte may not be written by the kernels
+    (*out)->mutable_data()[size - 1] = 0;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+class ElementwisePipeline::Impl {
+ public:
+  explicit Impl(int64_t morsel_length)
+      : morsel_length_(BitUtil::RoundUp(std::max<int64_t>(morsel_length, 1), 64)) {}
+
+  int AddInput(const std::shared_ptr<DataType>& type) {
+    input_ids_.push_back(AddValue({type, nullptr}));
+    return input_ids_.back();
+  }
+
+  int AddScalar(const std::shared_ptr<Scalar>& value) {
+    return AddValue({value->type, value});
+  }
+
+  Status Cast(int value, const std::shared_ptr<DataType>& to_type,
+              const CastOptions& options, int* out) {
+    RETURN_NOT_OK(CheckArray(value));
+    if (!is_fixed_width(to_type->id()) || to_type->id() == Type::DICTIONARY) {
+      return Status::NotImplemented("Only casts to fixed-width types can be fused, not ",
+                                    *to_type);
+    }
+    std::unique_ptr<UnaryKernel> kernel;
+    RETURN_NOT_OK(GetCastFunction(*values_[value].type, to_type, options, &kernel));
+    return AddStep(std::move(kernel), nullptr, {value, -1}, to_type, out);
+  }
+
+  Status Add(int left, int right, int* out) {
+    RETURN_NOT_OK(CheckArray(left));
+    RETURN_NOT_OK(CheckArray(right));
+    const auto& type = values_[left].type;
+    if (!type->Equals(values_[right].type)) {
+      return Status::Invalid("Array types should be equal to use arithmetic kernels");
+    }
+    std::unique_ptr<AddKernel> kernel;
+    RETURN_NOT_OK(AddKernel::Make(type, &kernel));
+    return AddStep(nullptr, std::move(kernel), {left, right}, type, out);
+  }
+
+  Status Compare(int left, int right, CompareOptions options, int* out) {
+    RETURN_NOT_OK(CheckArray(left));
+    RETURN_NOT_OK(CheckId(right));
+    const auto& type = values_[left].type;
+    if (!type->Equals(values_[right].type)) {
+      return Status::TypeError("Cannot compare data of differing type ", *type, " vs ",
+                               *values_[right].type);
+    }
+    std::shared_ptr<BinaryKernel> kernel;
+    RETURN_NOT_OK(MakeCompareKernel(*type, options, &kernel));
+    return AddStep(nullptr, std::move(kernel), {left, right}, boolean(), out);
+  }
+
+  Status Invert(int value, int* out) {
+    RETURN_NOT_OK(CheckBoolean(value));
+    std::shared_ptr<UnaryKernel> kernel;
+    RETURN_NOT_OK(MakeInvertKernel(&kernel));
+    return AddStep(std::move(kernel), nullptr, {value, -1}, boolean(), out);
+  }
+
+  Status Boolean(BooleanOperator op, int left, int right, int* out) {
+    RETURN_NOT_OK(CheckBoolean(left));
+    RETURN_NOT_OK(CheckBoolean(right));
+    std::shared_ptr<BinaryKernel> kernel;
+    RETURN_NOT_OK(MakeBooleanKernel(op, &kernel));
+    return AddStep(nullptr, std::move(kernel), {left, right}, boolean(), out);
+  }
+
+  std::shared_ptr<DataType> type(int id) const {
+    return CheckId(id).ok() ? values_[id].type : nullptr;
+  }
+
+  Status Execute(FunctionContext* ctx, const std::vector<Datum>& inputs, Datum* out) {
+    if (steps_.empty()) {
+      return Status::Invalid("Cannot execute a pipeline without steps");
+    }
+    if (inputs.size() != input_ids_.size()) {
+      return Status::Invalid("Pipeline expects ", input_ids_.size(), " inputs, got ",
+                             inputs.size());
+    }
+    int64_t length = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      if (!inputs[i].is_array()) {
+        return Status::Invalid("Pipeline inputs must be arrays");
+      }
+      const auto& type = values_[input_ids_[i]].type;
+      if (!inputs[i].type()->Equals(type)) {
+        return Status::TypeError("Pipeline input ", i, " should be of type ", *type,
+                                 ", got ", *inputs[i].type());
+      }
+      if (i > 0 && inputs[i].length() != length) {
+        return Status::Invalid("Pipeline inputs must have the same length");
+      }
+      length = inputs[i].length();
+    }
+
+    const auto& out_type = values_[steps_.back().out].type;
+    const int out_bit_width = BitWidth(*out_type);
+    std::shared_ptr<Buffer> out_data, out_bitmap;
+    RETURN_NOT_OK(AllocateDataBuffer(ctx, out_bit_width, length, &out_data));
+    RETURN_NOT_OK(AllocateDataBuffer(ctx, 1, length, &out_bitmap));
+
+    // Intermediate outputs are written to scratch buffers reused for every morsel
+    std::vector<std::shared_ptr<Buffer>> scratch(steps_.size() - 1);
+    for (size_t i = 0; i < scratch.size(); ++i) {
+      const int bit_width = BitWidth(*values_[steps_[i].out].type);
+      RETURN_NOT_OK(AllocateDataBuffer(ctx, bit_width, morsel_length_, &scratch[i]));
+    }
+
+    std::vector<Datum> morsel(values_.size());
+    for (size_t id = 0; id < values_.size(); ++id) {
+      if (values_[id].scalar) {
+        morsel[id] = values_[id].scalar;
+      }
+    }
+
+    int64_t null_count = 0;
+    for (int64_t offset = 0; offset < length; offset += morsel_length_) {
+      const int64_t morsel_length = std::min(morsel_length_, length - offset);
+      for (size_t i = 0; i < inputs.size(); ++i) {
+        morsel[input_ids_[i]] =
+            std::make_shared<ArrayData>(inputs[i].array()->Slice(offset, morsel_length));
+      }
+
+      // The last step writes directly into the output; morsels start at a
+      // multiple of 64 so this is byte aligned even for boolean outputs
+      const auto out_slice = SliceMutableBuffer(
+          out_data, DataBufferSize(out_bit_width, offset),
+          DataBufferSize(out_bit_width, morsel_length));
+      for (size_t i = 0; i < steps_.size(); ++i) {
+        const auto& step = steps_[i];
+        const auto& data = i + 1 < steps_.size() ? scratch[i] : out_slice;
+        Datum result(ArrayData::Make(values_[step.out].type, morsel_length,
+                                     {nullptr, data}));
+        if (step.unary) {
+          RETURN_NOT_OK(step.unary->Call(ctx, morsel[step.args[0]], &result));
+        } else {
+          RETURN_NOT_OK(step.binary->Call(ctx, morsel[step.args[0]],
+                                          morsel[step.args[1]], &result));
+        }
+        ARROW_RETURN_IF_ERROR(ctx);
+        morsel[step.out] = std::move(result);
+      }
+
+      const ArrayData& result = *morsel[steps_.back().out].array();
+      if (result.buffers[1] != out_slice || result.offset != 0) {
+        // The kernel didn't write into the output (e.g. a zero-copy cast)
+        const uint8_t* values = result.buffers[1]->data();
+        if (out_bit_width == 1) {
+          CopyBitmap(values, result.offset, morsel_length, out_data->mutable_data(),
+                     offset);
+        } else {
+          const int byte_width = out_bit_width / 8;
+          std::memcpy(out_slice->mutable_data(), values + result.offset * byte_width,
+                      morsel_length * byte_width);
+        }
+      }
+      const int64_t morsel_null_count = result.GetNullCount();
+      if (morsel_null_count > 0) {
+        CopyBitmap(result.buffers[0]->data(), result.offset, morsel_length,
+                   out_bitmap->mutable_data(), offset);
+      } else {
+        BitUtil::SetBitsTo(out_bitmap->mutable_data(), offset, morsel_length, true);
+      }
+      null_count += morsel_null_count;
+    }
+
+    if (null_count == 0) {
+      out_bitmap = nullptr;
+    }
+    out->value = ArrayData::Make(out_type, length, {out_bitmap, out_data}, null_count);
+    return Status::OK();
+  }
+
+ private:
+  int AddValue(PipelineValue value) {
+    values_.push_back(std::move(value));
+    return static_cast<int>(values_.size()) - 1;
+  }
+
+  Status AddStep(std::shared_ptr<UnaryKernel> unary, std::shared_ptr<BinaryKernel> binary,
+                 std::array<int, 2> args, const std::shared_ptr<DataType>& out_type,
+                 int* out) {
+    PipelineStep step;
+    step.unary = std::move(unary);
+    step.binary = std::move(binary);
+    step.args[0] = args[0];
+    step.args[1] = args[1];
+    step.out = *out = AddValue({out_type, nullptr});
+    steps_.push_back(std::move(step));
+    return Status::OK();
+  }
+
+  Status CheckId(int id) const {
+    if (id < 0 || id >= static_cast<int>(values_.size())) {
+      return Status::Invalid("Unknown pipeline value ", id);
+    }
+    return Status::OK();
+  }
+
+  Status CheckArray(int id) const {
+    RETURN_NOT_OK(CheckId(id));
+    if (values_[id].scalar) {
+      return Status::Invalid("Pipeline value ", id, " must be an array");
+    }
+    return Status::OK();
+  }
+
+  Status CheckBoolean(int id) const {
+    RETURN_NOT_OK(CheckArray(id));
+    if (values_[id].type->id() != Type::BOOL) {
+      return Status::TypeError("Expected a boolean array, got ", *values_[id].type);
+    }
+    return Status::OK();
+  }
+
+  int64_t morsel_length_;
+  std::vector<PipelineValue> values_;
+  std::vector<int> input_ids_;
+  std::vector<PipelineStep> steps_;
+};
+
+ElementwisePipeline::ElementwisePipeline(int64_t morsel_length)
+    : impl_(new Impl(morsel_length)) {}
+
+ElementwisePipeline::~ElementwisePipeline() {}
+
+int ElementwisePipeline::AddInput(const std::shared_ptr<DataType>& type) {
+  return impl_->AddInput(type);
+}
+
+int ElementwisePipeline::AddScalar(const std::shared_ptr<Scalar>& value) {
+  return impl_->AddScalar(value);
+}
+
+Status ElementwisePipeline::Cast(int value, const std::shared_ptr<DataType>& to_type,
+                                 const CastOptions& options, int* out) {
+  return impl_->Cast(value, to_type, options, out);
+}
+
+Status ElementwisePipeline::Add(int left, int right, int* out) {
+  return impl_->Add(left, right, out);
+}
+
+Status ElementwisePipeline::Compare(int left, int right, CompareOptions options,
+                                    int* out) {
+  return impl_->Compare(left, right, options, out);
+}
+
+Status ElementwisePipeline::Invert(int value, int* out) {
+  return impl_->Invert(value, out);
+}
+
+Status ElementwisePipeline::Boolean(BooleanOperator op, int left, int right, int* out) {
+  return impl_->Boolean(op, left, right, out);
+}
+
+std::shared_ptr<DataType> ElementwisePipeline::type(int id) const {
+  return impl_->type(id);
+}
+
+Status ElementwisePipeline::Execute(FunctionContext* ctx,
+                                    const std::vector<Datum>& inputs, Datum* out) {
+  return impl_->Execute(ctx, inputs, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+class Scalar;
+class Status;
+
+namespace compute {
+
+class BinaryKernel;
+class FunctionContext;
+class UnaryKernel;
+struct Datum;
+
+/// \brief A chain of elementwise kernels fused into a single pass over the
+/// input arrays
+///
+/// Steps are added in evaluation order. Each step consumes inputs of the
+/// pipeline, scalar constants or outputs of earlier steps, all referred to by
+/// the integer ids returned when adding them.
+///
+/// Execute() runs every step over a morsel of the inputs before moving on to
+/// the next morsel. Intermediate results are written to scratch buffers sized
+/// for one morsel, which are reused across morsels and stay cache resident;
+/// only the output of the last step is materialized for the whole length of
+/// the inputs.
+///
+/// Only kernels writing into preallocated fixed-width outputs are fused: Cast
+/// to fixed-width types, Add, Compare and the boolean kernels.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT ElementwisePipeline {
+ public:
+  /// Intermediate values of a morsel of this many int64 values fit in L2 cache
+  static constexpr int64_t kDefaultMorselLength = 1 << 14;
+
+  /// \brief Create an empty pipeline
+  ///
+  /// \param[in] morsel_length rows processed at once, rounded up to a multiple
+  /// of 64
+  explicit ElementwisePipeline(int64_t morsel_length = kDefaultMorselLength);
+
+  ~ElementwisePipeline();
+
+  /// \brief Declare an array input of the pipeline, bound by Execute()
+  int AddInput(const std::shared_ptr<DataType>& type);
+
+  /// \brief Declare a scalar constant
+  int AddScalar(const std::shared_ptr<Scalar>& value);
+
+  /// \brief Cast an array value to a fixed-width type
+  Status Cast(int value, const std::shared_ptr<DataType>& to_type,
+              const CastOptions& options, int* out);
+
+  /// \brief Add two numeric arrays of the same type
+  Status Add(int left, int right, int* out);
+
+  /// \brief Compare an array to an array or scalar of the same type
+  Status Compare(int left, int right, CompareOptions options, int* out);
+
+  /// \brief Invert a boolean array
+  Status Invert(int value, int* out);
+
+  /// \brief Apply a boolean operator to two boolean arrays
+  Status Boolean(BooleanOperator op, int left, int right, int* out);
+
+  /// \brief The type of an input, constant or step output
+  std::shared_ptr<DataType> type(int id) const;
+
+  /// \brief Execute the pipeline, emitting the output of the last step
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] inputs arrays of equal length, one per AddInput() call
+  /// \param[out] out the output array of the last step
+  Status Execute(FunctionContext* ctx, const std::vector<Datum>& inputs, Datum* out);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/pipeline.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestElementwisePipeline : public ComputeFixture, public TestBase {};
+
+// (cast(a, int64) + b > 100) and c, evaluated one kernel at a time
+static void UnfusedChain(FunctionContext* ctx, const std::shared_ptr<Array>& a,
+                         const std::shared_ptr<Array>& b,
+                         const std::shared_ptr<Array>& c, Datum* out) {
+  std::shared_ptr<Array> cast, sum;
+  ASSERT_OK(Cast(ctx, *a, int64(), CastOptions(), &cast));
+  ASSERT_OK(Add(ctx, *cast, *b, &sum));
+  Datum greater;
+  ASSERT_OK(Compare(ctx, sum, Datum(std::make_shared<Int64Scalar>(100)),
+                    CompareOptions(GREATER), &greater));
+  ASSERT_OK(KleeneAnd(ctx, greater, c, out));
+}
+
+TEST_F(TestElementwisePipeline, FusedChain) {
+  ElementwisePipeline pipeline(/*morsel_length=*/100);
+  const int a = pipeline.AddInput(int32());
+  const int b = pipeline.AddInput(int64());
+  const int c = pipeline.AddInput(boolean());
+  const int hundred = pipeline.AddScalar(std::make_shared<Int64Scalar>(100));
+  int cast, sum, greater, result;
+  ASSERT_OK(pipeline.Cast(a, int64(), CastOptions(), &cast));
+  ASSERT_OK(pipeline.Add(cast, b, &sum));
+  ASSERT_OK(pipeline.Compare(sum, hundred, CompareOptions(GREATER), &greater));
+  ASSERT_OK(pipeline.Boolean(BooleanOperator::KLEENE_AND, greater, c, &result));
+  AssertTypeEqual(*boolean(), *pipeline.type(result));
+
+  random::RandomArrayGenerator rand(0x5487);
+  for (const double null_probability : {0.0, 0.1}) {
+    // Several morsels, the last one partial, and sliced inputs
+    const int64_t length = 1000;
+    auto arr_a = rand.Int32(length + 3, -100, 100, null_probability)->Slice(3);
+    auto arr_b = rand.Int64(length, 0, 200, null_probability);
+    auto arr_c = rand.Boolean(length + 7, 0.5, null_probability)->Slice(7);
+
+    Datum expected, actual;
+    UnfusedChain(&ctx_, arr_a, arr_b, arr_c, &expected);
+    ASSERT_OK(pipeline.Execute(&ctx_, {arr_a, arr_b, arr_c}, &actual));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*expected.make_array(), *actual.make_array());
+  }
+}
+
+TEST_F(TestElementwisePipeline, LastStepZeroCopy) {
+  // An identity cast returns its input instead of writing into the output
+  ElementwisePipeline pipeline(/*morsel_length=*/64);
+  const int a = pipeline.AddInput(int32());
+  int invert, cast;
+  ASSERT_OK(pipeline.Cast(a, int32(), CastOptions(), &cast));
+
+  random::RandomArrayGenerator rand(0x5487);
+  auto arr = rand.Int32(301, -100, 100, 0.1)->Slice(1);
+  Datum out;
+  ASSERT_OK(pipeline.Execute(&ctx_, {arr}, &out));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*arr, *out.make_array());
+
+  ElementwisePipeline bool_pipeline(/*morsel_length=*/64);
+  const int b = bool_pipeline.AddInput(boolean());
+  ASSERT_OK(bool_pipeline.Invert(b, &invert));
+  ASSERT_OK(bool_pipeline.Cast(invert, boolean(), CastOptions(), &cast));
+  auto bools = rand.Boolean(300, 0.5, 0.1);
+  Datum expected;
+  ASSERT_OK(Invert(&ctx_, bools, &expected));
+  ASSERT_OK(bool_pipeline.Execute(&ctx_, {bools}, &out));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*expected.make_array(), *out.make_array());
+}
+
+TEST_F(TestElementwisePipeline, Errors) {
+  ElementwisePipeline pipeline;
+  const int a = pipeline.AddInput(int32());
+  const int b = pipeline.AddInput(int64());
+  const int s = pipeline.AddScalar(std::make_shared<Int32Scalar>(1));
+  int out;
+
+  Datum result;
+  ASSERT_RAISES(Invalid, pipeline.Execute(&ctx_, {}, &result));
+
+  ASSERT_RAISES(Invalid, pipeline.Add(a, b, &out));
+  ASSERT_RAISES(Invalid, pipeline.Add(a, s, &out));
+  ASSERT_RAISES(Invalid, pipeline.Add(a, 42, &out));
+  ASSERT_RAISES(TypeError, pipeline.Compare(a, b, CompareOptions(EQUAL), &out));
+  ASSERT_RAISES(TypeError, pipeline.Invert(a, &out));
+  ASSERT_RAISES(NotImplemented, pipeline.Cast(a, utf8(), CastOptions(), &out));
+  ASSERT_EQ(nullptr, pipeline.type(42));
+
+  ASSERT_OK(pipeline.Add(a, a, &out));
+  random::RandomArrayGenerator rand(0x5487);
+  auto arr_a = rand.Int32(10, 0, 10, 0);
+  auto arr_b = rand.Int64(10, 0, 10, 0);
+  ASSERT_RAISES(Invalid, pipeline.Execute(&ctx_, {arr_a}, &result));
+  ASSERT_RAISES(TypeError, pipeline.Execute(&ctx_, {arr_b, arr_b}, &result));
+  ASSERT_RAISES(Invalid, pipeline.Execute(&ctx_, {arr_a, arr_b->Slice(1)}, &result));
+  ASSERT_OK(pipeline.Execute(&ctx_, {arr_a, arr_b}, &result));
+}
+
+}  // namespace compute
+}  // namespace arrow
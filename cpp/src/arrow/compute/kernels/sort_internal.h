@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace compute {
+
+// One sort key, over a set of chunks of its column
+class SortKeyColumn {
+ public:
+  virtual ~SortKeyColumn() = default;
+
+  // Replace a chunk, which is then referenced until the next call
+  virtual void SetChunk(int chunk, const Array& values) = 0;
+
+  // Three-way comparison of two values, nulls last whatever the order
+  virtual int Compare(int left_chunk, int64_t left_index, int right_chunk,
+                      int64_t right_index) const = 0;
+
+  // Stably sort the indices of values of a chunk by this key only
+  virtual void SortStable(int chunk, int64_t* begin, int64_t* end,
+                          std::vector<int64_t>* scratch) const = 0;
+};
+
+// \brief Make a SortKeyColumn over chunks of the given type; chunks may be
+// null, to be set later
+Status MakeSortKeyColumn(const ArrayVector& chunks, const DataType& type,
+                         SortKey::Order order, std::unique_ptr<SortKeyColumn>* out);
+
+}  // namespace compute
+}  // namespace arrow
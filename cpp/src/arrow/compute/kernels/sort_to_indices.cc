@@ -19,13 +19,23 @@
 
 #include <algorithm>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/sort_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/extension_type.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -33,6 +43,8 @@ class Array;
 
 namespace compute {
 
+using internal::checked_cast;
+
 /// \brief UnaryKernel implementing SortToIndices operation
 class ARROW_EXPORT SortToIndicesKernel : public UnaryKernel {
  protected:
@@ -177,6 +189,10 @@ Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
 }
 
 Status SortToIndices(FunctionContext* ctx, const Datum& values, Datum* offsets) {
+  if (values.type()->id() == Type::EXTENSION) {
+    // Extension values are ordered by their storage
+    return SortToIndices(ctx, detail::ExtensionStorage(values), offsets);
+  }
   std::unique_ptr<SortToIndicesKernel> kernel;
   RETURN_NOT_OK(SortToIndicesKernel::Make(values.type(), &kernel));
   return kernel->Call(ctx, values, offsets);
@@ -190,5 +206,492 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Sorting chunked arrays and tables
+
+namespace {
+
+// Reorder the indices of the non-null values of an integer array in a stable
+// way, one byte of the values at a time (LSD radix sort)
+template <typename CType>
+void RadixSortIndices(const CType* values, bool descending, int64_t* begin,
+                      int64_t* end, std::vector<int64_t>* scratch) {
+  using Unsigned = typename std::make_unsigned<CType>::type;
+  constexpr int kNumBits = sizeof(CType) * 8;
+  // Map the values to unsigned integers in the same order
+  auto key = [&](int64_t index) -> Unsigned {
+    auto u = static_cast<Unsigned>(values[index]);
+    if (std::is_signed<CType>::value) {
+      u ^= static_cast<Unsigned>(Unsigned(1) << (kNumBits - 1));
+    }
+    return descending ? static_cast<Unsigned>(~u) : u;
+  };
+
+  const int64_t length = end - begin;
+  scratch->resize(length);
+  int64_t* src = begin;
+  int64_t* dst = scratch->data();
+  for (int shift = 0; shift < kNumBits; shift += 8) {
+    int64_t offsets[257] = {0};
+    for (int64_t i = 0; i < length; ++i) {
+      ++offsets[((key(src[i]) >> shift) & 0xFF) + 1];
+    }
+    if (std::find(offsets + 1, offsets + 257, length) != offsets + 257) {
+      // All values have the same digit
+      continue;
+    }
+    std::partial_sum(offsets, offsets + 257, offsets);
+    for (int64_t i = 0; i < length; ++i) {
+      dst[offsets[(key(src[i]) >> shift) & 0xFF]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != begin) {
+    std::copy(src, src + length, begin);
+  }
+}
+
+template <typename ArrowType>
+class TypedSortKeyColumn : public SortKeyColumn {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  TypedSortKeyColumn(const ArrayVector& chunks, bool descending)
+      : descending_(descending) {
+    for (const auto& chunk : chunks) {
+      chunks_.push_back(static_cast<const ArrayType*>(chunk.get()));
+    }
+  }
+
+  void SetChunk(int chunk, const Array& values) override {
+    chunks_[chunk] = static_cast<const ArrayType*>(&values);
+  }
+
+  int Compare(int left_chunk, int64_t left_index, int right_chunk,
+              int64_t right_index) const override {
+    const ArrayType& left = *chunks_[left_chunk];
+    const ArrayType& right = *chunks_[right_chunk];
+    const bool left_null = left.IsNull(left_index);
+    const bool right_null = right.IsNull(right_index);
+    if (left_null || right_null) {
+      return left_null - right_null;
+    }
+    const auto left_value = left.GetView(left_index);
+    const auto right_value = right.GetView(right_index);
+    const int cmp = (left_value > right_value) - (left_value < right_value);
+    return descending_ ? -cmp : cmp;
+  }
+
+  void SortStable(int chunk, int64_t* begin, int64_t* end,
+                  std::vector<int64_t>* scratch) const override {
+    const ArrayType& values = *chunks_[chunk];
+    int64_t* nulls_begin = end;
+    if (values.null_count() != 0) {
+      nulls_begin = std::stable_partition(
+          begin, end, [&values](int64_t index) { return !values.IsNull(index); });
+    }
+    SortValues(values, begin, nulls_begin, scratch);
+  }
+
+ private:
+  template <typename T = ArrowType>
+  enable_if_integer<T> SortValues(const ArrayType& values, int64_t* begin, int64_t* end,
+                                  std::vector<int64_t>* scratch) const {
+    RadixSortIndices(values.raw_values(), descending_, begin, end, scratch);
+  }
+
+  template <typename T = ArrowType>
+  enable_if_t<!is_integer_type<T>::value> SortValues(const ArrayType& values,
+                                                     int64_t* begin, int64_t* end,
+                                                     std::vector<int64_t>*) const {
+    if (descending_) {
+      std::stable_sort(begin, end, [&values](int64_t left, int64_t right) {
+        return values.GetView(right) < values.GetView(left);
+      });
+    } else {
+      std::stable_sort(begin, end, [&values](int64_t left, int64_t right) {
+        return values.GetView(left) < values.GetView(right);
+      });
+    }
+  }
+
+  std::vector<const ArrayType*> chunks_;
+  bool descending_;
+};
+
+}  // namespace
+
+// Extension arrays are ordered by their storage
+class ExtensionSortKeyColumn : public SortKeyColumn {
+ public:
+  explicit ExtensionSortKeyColumn(std::unique_ptr<SortKeyColumn> storage_key)
+      : storage_key_(std::move(storage_key)) {}
+
+  void SetChunk(int chunk, const Array& values) override {
+    // The storage is owned by the extension array
+    storage_key_->SetChunk(chunk, *checked_cast<const ExtensionArray&>(values).storage());
+  }
+
+  int Compare(int left_chunk, int64_t left_index, int right_chunk,
+              int64_t right_index) const override {
+    return storage_key_->Compare(left_chunk, left_index, right_chunk, right_index);
+  }
+
+  void SortStable(int chunk, int64_t* begin, int64_t* end,
+                  std::vector<int64_t>* scratch) const override {
+    storage_key_->SortStable(chunk, begin, end, scratch);
+  }
+
+ private:
+  std::unique_ptr<SortKeyColumn> storage_key_;
+};
+
+Status MakeSortKeyColumn(const ArrayVector& chunks, const DataType& type,
+                         SortKey::Order order, std::unique_ptr<SortKeyColumn>* out) {
+  const bool descending = order == SortKey::DESCENDING;
+  if (type.id() == Type::EXTENSION) {
+    ArrayVector storage_chunks;
+    for (const auto& chunk : chunks) {
+      storage_chunks.push_back(
+          chunk ? checked_cast<const ExtensionArray&>(*chunk).storage() : nullptr);
+    }
+    std::unique_ptr<SortKeyColumn> storage_key;
+    RETURN_NOT_OK(MakeSortKeyColumn(
+        storage_chunks, *checked_cast<const ExtensionType&>(type).storage_type(), order,
+        &storage_key));
+    out->reset(new ExtensionSortKeyColumn(std::move(storage_key)));
+    return Status::OK();
+  }
+  switch (type.id()) {
+#define SORT_KEY_COLUMN_CASE(TYPE_ID, ARROW_TYPE)                          \
+  case Type::TYPE_ID:                                                      \
+    out->reset(new TypedSortKeyColumn<ARROW_TYPE>(chunks, descending)); \
+    return Status::OK();
+
+    SORT_KEY_COLUMN_CASE(UINT8, UInt8Type)
+    SORT_KEY_COLUMN_CASE(INT8, Int8Type)
+    SORT_KEY_COLUMN_CASE(UINT16, UInt16Type)
+    SORT_KEY_COLUMN_CASE(INT16, Int16Type)
+    SORT_KEY_COLUMN_CASE(UINT32, UInt32Type)
+    SORT_KEY_COLUMN_CASE(INT32, Int32Type)
+    SORT_KEY_COLUMN_CASE(UINT64, UInt64Type)
+    SORT_KEY_COLUMN_CASE(INT64, Int64Type)
+    SORT_KEY_COLUMN_CASE(FLOAT, FloatType)
+    SORT_KEY_COLUMN_CASE(DOUBLE, DoubleType)
+    SORT_KEY_COLUMN_CASE(BINARY, BinaryType)
+    SORT_KEY_COLUMN_CASE(STRING, StringType)
+
+#undef SORT_KEY_COLUMN_CASE
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", type, " arrays");
+}
+
+namespace {
+
+Status SortChunkedColumns(FunctionContext* ctx,
+                          const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                          const std::vector<SortKey::Order>& orders, bool use_threads,
+                          std::shared_ptr<Array>* offsets) {
+  const int64_t length = columns[0]->length();
+
+  // Slice all key columns along the same chunk boundaries
+  std::vector<ArrayVector> chunks;
+  for (const auto& column : columns) {
+    chunks.push_back(column->chunks());
+  }
+  chunks = arrow::internal::RechunkArraysConsistently(chunks);
+  const int num_chunks = static_cast<int>(chunks[0].size());
+
+  std::vector<std::unique_ptr<SortKeyColumn>> keys(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    RETURN_NOT_OK(MakeSortKeyColumn(chunks[i], *columns[i]->type(), orders[i], &keys[i]));
+  }
+
+  std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    chunk_offsets[chunk + 1] = chunk_offsets[chunk] + chunks[0][chunk]->length();
+  }
+
+  // Sort each chunk by all keys, with one stable pass per key from the least
+  // significant to the most significant one
+  std::vector<int64_t> chunk_indices(length);
+  RETURN_NOT_OK(arrow::internal::OptionalParallelFor(
+      use_threads, num_chunks, [&](int chunk) {
+        int64_t* begin = chunk_indices.data() + chunk_offsets[chunk];
+        int64_t* end = chunk_indices.data() + chunk_offsets[chunk + 1];
+        std::iota(begin, end, 0);
+        std::vector<int64_t> scratch;
+        for (auto key = keys.rbegin(); key != keys.rend(); ++key) {
+          (*key)->SortStable(chunk, begin, end, &scratch);
+        }
+        return Status::OK();
+      }));
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  auto out = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+
+  // k-way merge of the sorted chunks, with a heap of the next index of each one
+  struct Cursor {
+    int chunk;
+    int64_t position;
+  };
+  auto index_of = [&](const Cursor& cursor) {
+    return chunk_indices[chunk_offsets[cursor.chunk] + cursor.position];
+  };
+  // Whether the heap should yield right before left: ties are broken by chunk
+  // order, which keeps the merge stable
+  auto after = [&](const Cursor& left, const Cursor& right) {
+    const int64_t left_index = index_of(left);
+    const int64_t right_index = index_of(right);
+    for (const auto& key : keys) {
+      const int cmp = key->Compare(left.chunk, left_index, right.chunk, right_index);
+      if (cmp != 0) {
+        return cmp > 0;
+      }
+    }
+    return left.chunk > right.chunk;
+  };
+
+  std::vector<Cursor> heap;
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    if (chunk_offsets[chunk + 1] > chunk_offsets[chunk]) {
+      heap.push_back({chunk, 0});
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), after);
+  while (heap.size() > 1) {
+    std::pop_heap(heap.begin(), heap.end(), after);
+    Cursor& cursor = heap.back();
+    *out++ = chunk_offsets[cursor.chunk] + index_of(cursor);
+    if (++cursor.position ==
+        chunk_offsets[cursor.chunk + 1] - chunk_offsets[cursor.chunk]) {
+      heap.pop_back();
+    } else {
+      std::push_heap(heap.begin(), heap.end(), after);
+    }
+  }
+  if (!heap.empty()) {
+    // The last chunk left needs no merging
+    const Cursor& cursor = heap.back();
+    for (int64_t i = chunk_offsets[cursor.chunk] + cursor.position;
+         i < chunk_offsets[cursor.chunk + 1]; ++i) {
+      *out++ = chunk_offsets[cursor.chunk] + chunk_indices[i];
+    }
+  }
+
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     std::shared_ptr<Array>* offsets) {
+  auto column = std::make_shared<ChunkedArray>(values.chunks(), values.type());
+  return SortChunkedColumns(ctx, {column}, {SortKey::ASCENDING},
+                            /*use_threads=*/false, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  std::vector<SortKey::Order> orders;
+  for (const auto& key : options.sort_keys) {
+    auto column = table.GetColumnByName(key.name);
+    if (column == nullptr) {
+      return Status::Invalid("Sort key column '", key.name, "' not found in table");
+    }
+    columns.push_back(std::move(column));
+    orders.push_back(key.order);
+  }
+  return SortChunkedColumns(ctx, columns, orders, options.use_threads, offsets);
+}
+
+// ----------------------------------------------------------------------
+// TopKIndices
+
+template <typename ArrayType, typename Comparator>
+Status TopKIndicesImpl(FunctionContext* ctx, const ArrayType& values,
+                       const TopKOptions& options, Comparator compare,
+                       std::shared_ptr<Array>* indices) {
+  const int64_t k = std::min(options.k, values.length());
+  const bool descending = options.order == TopKOptions::DESCENDING;
+  // Whether the value at lhs comes before the one at rhs in a stable sort
+  auto before = [&](uint64_t lhs, uint64_t rhs) {
+    if (descending ? compare(values, rhs, lhs) : compare(values, lhs, rhs)) {
+      return true;
+    }
+    if (descending ? compare(values, lhs, rhs) : compare(values, rhs, lhs)) {
+      return false;
+    }
+    return lhs < rhs;
+  };
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), k * sizeof(uint64_t), &indices_buf));
+  auto out_begin = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  auto out = out_begin;
+
+  std::vector<uint64_t> null_indices;
+  if (values.null_count() != 0) {
+    const int64_t max_nulls = std::min(k, values.null_count());
+    for (int64_t i = 0; static_cast<int64_t>(null_indices.size()) < max_nulls; ++i) {
+      if (values.IsNull(i)) {
+        null_indices.push_back(i);
+      }
+    }
+  }
+  const auto num_nulls = static_cast<int64_t>(null_indices.size());
+
+  if (options.null_placement == TopKOptions::NULLS_FIRST) {
+    out = std::copy(null_indices.begin(), null_indices.end(), out);
+  }
+
+  // A max-heap of the first values seen so far: its top is the last of them
+  const int64_t num_values =
+      std::min(options.null_placement == TopKOptions::NULLS_FIRST ? k - num_nulls : k,
+               values.length() - values.null_count());
+  std::vector<uint64_t> heap;
+  heap.reserve(num_values);
+  for (int64_t i = 0; i < values.length() && num_values > 0; ++i) {
+    if (values.IsNull(i)) {
+      continue;
+    }
+    if (static_cast<int64_t>(heap.size()) < num_values) {
+      heap.push_back(i);
+      std::push_heap(heap.begin(), heap.end(), before);
+    } else if (before(i, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), before);
+      heap.back() = i;
+      std::push_heap(heap.begin(), heap.end(), before);
+    }
+  }
+  std::sort_heap(heap.begin(), heap.end(), before);
+  out = std::copy(heap.begin(), heap.end(), out);
+
+  if (options.null_placement == TopKOptions::NULLS_LAST) {
+    std::copy(null_indices.begin(), null_indices.begin() + (out_begin + k - out), out);
+  }
+
+  *indices = std::make_shared<UInt64Array>(k, indices_buf);
+  return Status::OK();
+}
+
+template <typename ArrowType, typename Comparator>
+Status TopKIndicesOfType(FunctionContext* ctx, const Array& values,
+                         const TopKOptions& options, Comparator compare,
+                         std::shared_ptr<Array>* indices) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  return TopKIndicesImpl(ctx, static_cast<const ArrayType&>(values), options, compare,
+                         indices);
+}
+
+Status TopKIndices(FunctionContext* ctx, const Array& values, const TopKOptions& options,
+                   std::shared_ptr<Array>* indices) {
+  if (options.k < 0) {
+    return Status::Invalid("TopKIndices expects a non-negative k, got ", options.k);
+  }
+
+  if (values.type_id() == Type::EXTENSION) {
+    return TopKIndices(ctx, *checked_cast<const ExtensionArray&>(values).storage(),
+                       options, indices);
+  }
+
+  switch (values.type_id()) {
+    case Type::UINT8:
+      return TopKIndicesOfType<UInt8Type>(ctx, values, options,
+                                          CompareValues<UInt8Array>, indices);
+    case Type::INT8:
+      return TopKIndicesOfType<Int8Type>(ctx, values, options, CompareValues<Int8Array>,
+                                         indices);
+    case Type::UINT16:
+      return TopKIndicesOfType<UInt16Type>(ctx, values, options,
+                                           CompareValues<UInt16Array>, indices);
+    case Type::INT16:
+      return TopKIndicesOfType<Int16Type>(ctx, values, options,
+                                          CompareValues<Int16Array>, indices);
+    case Type::UINT32:
+      return TopKIndicesOfType<UInt32Type>(ctx, values, options,
+                                           CompareValues<UInt32Array>, indices);
+    case Type::INT32:
+      return TopKIndicesOfType<Int32Type>(ctx, values, options,
+                                          CompareValues<Int32Array>, indices);
+    case Type::UINT64:
+      return TopKIndicesOfType<UInt64Type>(ctx, values, options,
+                                           CompareValues<UInt64Array>, indices);
+    case Type::INT64:
+      return TopKIndicesOfType<Int64Type>(ctx, values, options,
+                                          CompareValues<Int64Array>, indices);
+    case Type::FLOAT:
+      return TopKIndicesOfType<FloatType>(ctx, values, options,
+                                          CompareValues<FloatArray>, indices);
+    case Type::DOUBLE:
+      return TopKIndicesOfType<DoubleType>(ctx, values, options,
+                                           CompareValues<DoubleArray>, indices);
+    case Type::BINARY:
+      return TopKIndicesOfType<BinaryType>(ctx, values, options,
+                                           CompareViews<BinaryArray>, indices);
+    case Type::STRING:
+      return TopKIndicesOfType<StringType>(ctx, values, options,
+                                           CompareViews<StringArray>, indices);
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", *values.type(), " arrays");
+}
+
+Status TopKIndices(FunctionContext* ctx, const ChunkedArray& values,
+                   const TopKOptions& options, std::shared_ptr<Array>* indices) {
+  if (values.num_chunks() == 1) {
+    return TopKIndices(ctx, *values.chunk(0), options, indices);
+  }
+
+  // The top k of every chunk, in chunk order: among equal values, the candidates
+  // are then ordered by their logical index, as required for a stable order
+  ArrayVector candidates;
+  std::vector<uint64_t> candidate_indices;
+  int64_t chunk_offset = 0;
+  for (const auto& chunk : values.chunks()) {
+    std::shared_ptr<Array> chunk_indices, chunk_candidates;
+    RETURN_NOT_OK(TopKIndices(ctx, *chunk, options, &chunk_indices));
+    RETURN_NOT_OK(Take(ctx, *chunk, *chunk_indices, TakeOptions(), &chunk_candidates));
+    const auto& typed_indices = static_cast<const UInt64Array&>(*chunk_indices);
+    for (int64_t i = 0; i < typed_indices.length(); ++i) {
+      candidate_indices.push_back(chunk_offset + typed_indices.Value(i));
+    }
+    candidates.push_back(std::move(chunk_candidates));
+    chunk_offset += chunk->length();
+  }
+
+  std::shared_ptr<Array> merged;
+  if (candidates.empty()) {
+    RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), values.type(), 0, &merged));
+  } else {
+    RETURN_NOT_OK(Concatenate(candidates, ctx->memory_pool(), &merged));
+  }
+
+  std::shared_ptr<Array> merged_indices;
+  RETURN_NOT_OK(TopKIndices(ctx, *merged, options, &merged_indices));
+  const auto& typed_indices = static_cast<const UInt64Array&>(*merged_indices);
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(),
+                               typed_indices.length() * sizeof(uint64_t), &indices_buf));
+  auto out = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  for (int64_t i = 0; i < typed_indices.length(); ++i) {
+    out[i] = candidate_indices[typed_indices.Value(i)];
+  }
+  *indices = std::make_shared<UInt64Array>(typed_indices.length(), indices_buf);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
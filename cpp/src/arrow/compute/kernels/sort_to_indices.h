@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,6 +30,8 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
+class Table;
 
 namespace compute {
 
@@ -47,5 +53,128 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \brief Returns the indices that would sort a chunked array.
+///
+/// Like SortToIndices for an Array, without concatenating the chunks: see the
+/// Table overload.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to sort
+/// \param[out] offsets indices into the logical (unchunked) values that would
+/// sort them
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     std::shared_ptr<Array>* offsets);
+
+/// \class SortKey
+/// \brief A column to sort a table by, and its order
+struct ARROW_EXPORT SortKey {
+  enum Order {
+    ASCENDING,
+    DESCENDING,
+  };
+
+  explicit SortKey(std::string name, Order order = ASCENDING)
+      : name(std::move(name)), order(order) {}
+
+  std::string name;
+  Order order;
+};
+
+/// \class SortOptions
+struct ARROW_EXPORT SortOptions {
+  explicit SortOptions(std::vector<SortKey> sort_keys = {})
+      : sort_keys(std::move(sort_keys)) {}
+
+  /// The columns to sort by, the first one being the most significant
+  std::vector<SortKey> sort_keys;
+  /// Whether to sort the chunks on the CPU thread pool
+  bool use_threads = true;
+};
+
+/// \brief Returns the indices that would sort a table by several columns.
+///
+/// The sort is stable, and nulls are placed at the end whatever the order of
+/// their key. The key columns are sliced along common chunk boundaries, each
+/// slice is sorted on its own (in parallel if options.use_threads), with a
+/// radix sort for integer keys, and the sorted slices are then merged: the key
+/// columns are never concatenated.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] options the sort keys, see SortOptions for more information
+/// \param[out] offsets indices of the rows of table that would sort it
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
+/// \class TopKOptions
+struct ARROW_EXPORT TopKOptions {
+  enum Order {
+    ASCENDING,
+    DESCENDING,
+  };
+
+  enum NullPlacement {
+    // Nulls come after all the non-null values
+    NULLS_LAST,
+    // Nulls come before all the non-null values
+    NULLS_FIRST,
+  };
+
+  explicit TopKOptions(int64_t k = 0, Order order = ASCENDING,
+                       NullPlacement null_placement = NULLS_LAST)
+      : k(k), order(order), null_placement(null_placement) {}
+
+  /// The number of indices to return
+  int64_t k;
+  Order order;
+  NullPlacement null_placement;
+};
+
+/// \brief Returns the indices of the first k values of an array in sort order.
+///
+/// The output is what the first k indices of a stable sort of the array in the
+/// requested order would be, without sorting the whole array: the selected
+/// values are kept in a heap of size k, so the cost is O(n log(k)).
+///
+/// For example given values = [null, 1, 3.3, null, 2, 5.3] and k = 3, the
+/// output will be [1, 4, 2] in ascending order and [5, 2, 4] in descending
+/// order, or [0, 3, 5] in descending order with nulls first.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] options the number of indices to return and the sort order
+/// \param[out] indices min(k, values.length()) indices of values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopKIndices(FunctionContext* ctx, const Array& values, const TopKOptions& options,
+                   std::shared_ptr<Array>* indices);
+
+/// \brief Returns the indices of the first k values of a chunked array in sort
+/// order.
+///
+/// The top k values of every chunk are selected first, then merged.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to select from
+/// \param[in] options the number of indices to return and the sort order
+/// \param[out] indices min(k, values.length()) indices into the logical
+/// (unchunked) values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopKIndices(FunctionContext* ctx, const ChunkedArray& values,
+                   const TopKOptions& options, std::shared_ptr<Array>* indices);
+
 }  // namespace compute
 }  // namespace arrow
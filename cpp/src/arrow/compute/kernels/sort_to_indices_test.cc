@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,6 +25,8 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -191,5 +195,291 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+// ----------------------------------------------------------------------
+// Sorting chunked arrays and tables
+
+class TestSortTableToIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const Table& table, const SortOptions& options,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, table, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestSortTableToIndices, ChunkedArray) {
+  auto values = ChunkedArrayFromJSON(int32(), {"[3, null, 1]", "[]", "[2, 1, null, 0]"});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *values, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[6, 2, 4, 3, 0, 1, 5]"), *actual);
+
+  ASSERT_OK(SortToIndices(&this->ctx_, ChunkedArray({}, int32()), &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[]"), *actual);
+}
+
+TEST_F(TestSortTableToIndices, MultipleKeys) {
+  auto table_schema =
+      schema({field("a", int16()), field("b", utf8()), field("c", float64())});
+  auto table = TableFromJSON(table_schema, {R"([
+    {"a": 2, "b": "x", "c": 1.5},
+    {"a": 1, "b": "y", "c": 2.5},
+    {"a": null, "b": "x", "c": 0.5}
+  ])",
+                                            R"([
+    {"a": 2, "b": "y", "c": null},
+    {"a": 1, "b": "y", "c": 3.5},
+    {"a": 2, "b": null, "c": 1.5}
+  ])"});
+
+  AssertSortToIndices(*table, SortOptions({SortKey("a")}), "[1, 4, 0, 3, 5, 2]");
+  AssertSortToIndices(*table, SortOptions({SortKey("a", SortKey::DESCENDING)}),
+                      "[0, 3, 5, 1, 4, 2]");
+  AssertSortToIndices(*table,
+                      SortOptions({SortKey("b"), SortKey("a", SortKey::DESCENDING)}),
+                      "[0, 2, 3, 1, 4, 5]");
+  AssertSortToIndices(*table,
+                      SortOptions({SortKey("a"), SortKey("c", SortKey::DESCENDING)}),
+                      "[4, 1, 0, 5, 3, 2]");
+}
+
+TEST_F(TestSortTableToIndices, ExtensionType) {
+  // Extension values are ordered by their storage
+  auto array = ExtensionArrayFromJSON(smallint(), "[3, null, 1, 2]");
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *array, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 3, 0, 1]"), *actual);
+  ASSERT_OK(TopKIndices(&this->ctx_, *array, TopKOptions(2), &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 3]"), *actual);
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array, ExtensionArrayFromJSON(smallint(), "[0, null]")});
+  ASSERT_OK(SortToIndices(&this->ctx_, *chunked, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[4, 2, 3, 0, 1, 5]"), *actual);
+
+  auto table = Table::Make(schema({field("a", smallint())}), {chunked});
+  AssertSortToIndices(*table, SortOptions({SortKey("a", SortKey::DESCENDING)}),
+                      "[0, 3, 2, 4, 1, 5]");
+}
+
+TEST_F(TestSortTableToIndices, Errors) {
+  auto table = TableFromJSON(schema({field("a", int32()), field("b", boolean())}),
+                             {R"([{"a": 1, "b": true}])"});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *table, SortOptions(), &out));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *table,
+                                       SortOptions({SortKey("missing")}), &out));
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&this->ctx_, *table, SortOptions({SortKey("b")}), &out));
+}
+
+// Three-way comparison of two values of a column, nulls last
+template <typename ArrayType>
+int CompareColumnValues(const ArrayType& array, int64_t left, int64_t right,
+                        SortKey::Order order) {
+  if (array.IsNull(left) || array.IsNull(right)) {
+    return array.IsNull(left) - array.IsNull(right);
+  }
+  int cmp = (array.GetView(left) > array.GetView(right)) -
+            (array.GetView(left) < array.GetView(right));
+  return order == SortKey::ASCENDING ? cmp : -cmp;
+}
+
+TEST_F(TestSortTableToIndices, RandomValues) {
+  const int64_t length = 3000;
+  random::RandomArrayGenerator rand(0x5487655);
+  auto small_ints = rand.Int8(length, -4, 4, 0.1);
+  auto large_ints = rand.Int64(length, std::numeric_limits<int64_t>::min(),
+                               std::numeric_limits<int64_t>::max(), 0.1);
+  auto strings = rand.String(length, 0, 2, 0.1);
+  auto doubles = rand.Float64(length, -1, 1, 0.1);
+
+  // Chunk the columns differently
+  auto chunked = [](const std::shared_ptr<Array>& array, std::vector<int64_t> bounds) {
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (int64_t bound : bounds) {
+      chunks.push_back(array->Slice(offset, bound - offset));
+      offset = bound;
+    }
+    chunks.push_back(array->Slice(offset));
+    return std::make_shared<ChunkedArray>(chunks);
+  };
+  auto table_schema = schema({field("small_ints", int8()), field("large_ints", int64()),
+                              field("strings", utf8()), field("doubles", float64())});
+  auto table = Table::Make(
+      table_schema, {chunked(small_ints, {1000, 2000}), chunked(large_ints, {500}),
+                     chunked(strings, {1000, 1000, 2999}), chunked(doubles, {})});
+
+  std::vector<std::vector<SortKey>> sort_keys_cases = {
+      {SortKey("large_ints")},
+      {SortKey("small_ints", SortKey::DESCENDING), SortKey("large_ints")},
+      {SortKey("strings"), SortKey("small_ints"),
+       SortKey("doubles", SortKey::DESCENDING)},
+      {SortKey("small_ints"), SortKey("strings", SortKey::DESCENDING)},
+  };
+  for (const auto& sort_keys : sort_keys_cases) {
+    for (bool use_threads : {false, true}) {
+      SortOptions options(sort_keys);
+      options.use_threads = use_threads;
+      std::shared_ptr<Array> offsets;
+      ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &offsets));
+      ASSERT_OK(offsets->ValidateFull());
+      ASSERT_EQ(length, offsets->length());
+      const auto& indices = static_cast<const UInt64Array&>(*offsets);
+
+      // Sorted, and stable
+      auto compare_rows = [&](int64_t left, int64_t right) {
+        for (const auto& key : sort_keys) {
+          int cmp = 0;
+          if (key.name == "small_ints") {
+            cmp = CompareColumnValues(static_cast<const Int8Array&>(*small_ints), left,
+                                      right, key.order);
+          } else if (key.name == "large_ints") {
+            cmp = CompareColumnValues(static_cast<const Int64Array&>(*large_ints), left,
+                                      right, key.order);
+          } else if (key.name == "strings") {
+            cmp = CompareColumnValues(static_cast<const StringArray&>(*strings), left,
+                                      right, key.order);
+          } else {
+            cmp = CompareColumnValues(static_cast<const DoubleArray&>(*doubles), left,
+                                      right, key.order);
+          }
+          if (cmp != 0) return cmp;
+        }
+        return 0;
+      };
+      for (int64_t i = 1; i < length; ++i) {
+        const auto left = static_cast<int64_t>(indices.Value(i - 1));
+        const auto right = static_cast<int64_t>(indices.Value(i));
+        const int cmp = compare_rows(left, right);
+        ASSERT_TRUE(cmp < 0 || (cmp == 0 && left < right)) << "at " << i;
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// TopKIndices
+
+template <typename ArrowType>
+class TestTopKIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopKIndices(const std::string& values, const TopKOptions& options,
+                         const std::string& expected) {
+    auto type = TypeTraits<ArrowType>::type_singleton();
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopKIndices(&this->ctx_, *ArrayFromJSON(type, values), options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+template <typename ArrowType>
+class TestTopKIndicesForNumbers : public TestTopKIndices<ArrowType> {};
+TYPED_TEST_CASE(TestTopKIndicesForNumbers, NumericArrowTypes);
+
+template <typename ArrowType>
+class TestTopKIndicesForStrings : public TestTopKIndices<ArrowType> {};
+using BaseBinaryArrowTypes = testing::Types<StringType, BinaryType>;
+TYPED_TEST_CASE(TestTopKIndicesForStrings, BaseBinaryArrowTypes);
+
+TYPED_TEST(TestTopKIndicesForNumbers, TopK) {
+  this->AssertTopKIndices("[]", TopKOptions(3), "[]");
+  this->AssertTopKIndices("[3, 2, 6]", TopKOptions(0), "[]");
+  this->AssertTopKIndices("[3, 2, 6]", TopKOptions(5), "[1, 0, 2]");
+  this->AssertTopKIndices("[10, 12, 4, 50, 50, 32, 11]", TopKOptions(4), "[2, 0, 6, 1]");
+  this->AssertTopKIndices("[10, 12, 4, 50, 50, 32, 11]",
+                          TopKOptions(3, TopKOptions::DESCENDING), "[3, 4, 5]");
+
+  this->AssertTopKIndices("[null, 1, 3, null, 2, 5]", TopKOptions(3), "[1, 4, 2]");
+  this->AssertTopKIndices("[null, 1, 3, null, 2, 5]", TopKOptions(5), "[1, 4, 2, 5, 0]");
+  this->AssertTopKIndices("[null, 1, 3, null, 2, 5]",
+                          TopKOptions(3, TopKOptions::DESCENDING), "[5, 2, 4]");
+  this->AssertTopKIndices(
+      "[null, 1, 3, null, 2, 5]",
+      TopKOptions(3, TopKOptions::DESCENDING, TopKOptions::NULLS_FIRST), "[0, 3, 5]");
+  this->AssertTopKIndices(
+      "[null, 1, 3, null, 2, 5]",
+      TopKOptions(1, TopKOptions::ASCENDING, TopKOptions::NULLS_FIRST), "[0]");
+  this->AssertTopKIndices("[null, null]", TopKOptions(1), "[0]");
+}
+
+TYPED_TEST(TestTopKIndicesForStrings, TopK) {
+  this->AssertTopKIndices(R"(["testing", "sort", "for", "strings"])", TopKOptions(2),
+                          "[2, 1]");
+  this->AssertTopKIndices(R"(["testing", null, "for", "strings"])",
+                          TopKOptions(2, TopKOptions::DESCENDING), "[0, 3]");
+}
+
+TEST(TestTopKIndices, Errors) {
+  FunctionContext ctx;
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, TopKIndices(&ctx, *ArrayFromJSON(int32(), "[1, 2]"),
+                                     TopKOptions(-1), &out));
+  ASSERT_RAISES(NotImplemented, TopKIndices(&ctx, *ArrayFromJSON(boolean(), "[true]"),
+                                            TopKOptions(1), &out));
+}
+
+// The first k indices of a stable sort
+template <typename ArrayType>
+std::vector<uint64_t> ReferenceTopKIndices(const ArrayType& array,
+                                           const TopKOptions& options) {
+  std::vector<uint64_t> indices(array.length());
+  std::iota(indices.begin(), indices.end(), 0);
+  const bool nulls_first = options.null_placement == TopKOptions::NULLS_FIRST;
+  std::stable_sort(indices.begin(), indices.end(), [&](uint64_t lhs, uint64_t rhs) {
+    if (array.IsNull(lhs) || array.IsNull(rhs)) {
+      return nulls_first ? array.IsNull(lhs) && !array.IsNull(rhs)
+                         : !array.IsNull(lhs) && array.IsNull(rhs);
+    }
+    return options.order == TopKOptions::ASCENDING
+               ? array.GetView(lhs) < array.GetView(rhs)
+               : array.GetView(rhs) < array.GetView(lhs);
+  });
+  indices.resize(std::min<int64_t>(options.k, array.length()));
+  return indices;
+}
+
+template <typename ArrowType>
+class TestTopKIndicesRandom : public ComputeFixture, public TestBase {};
+TYPED_TEST_CASE(TestTopKIndicesRandom, SortToIndicesableTypes);
+
+TYPED_TEST(TestTopKIndicesRandom, TopKRandomValues) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  Random<TypeParam> rand(0x5487655);
+  const int64_t length = 2000;
+  for (auto null_probability : {0.0, 0.1, 0.5, 1.0}) {
+    auto array = rand.Generate(length, null_probability);
+    const auto& typed_array = static_cast<const ArrayType&>(*array);
+    // Several chunks, including empty ones
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{array->Slice(0, 700), array->Slice(700, 0), array->Slice(700, 1),
+                    array->Slice(701, 1299)});
+
+    for (int64_t k : {0, 1, 10, 100, 2000, 3000}) {
+      for (auto order : {TopKOptions::ASCENDING, TopKOptions::DESCENDING}) {
+        for (auto null_placement : {TopKOptions::NULLS_LAST, TopKOptions::NULLS_FIRST}) {
+          TopKOptions options(k, order, null_placement);
+          std::shared_ptr<Array> expected;
+          ArrayFromVector<UInt64Type, uint64_t>(
+              ReferenceTopKIndices(typed_array, options), &expected);
+
+          std::shared_ptr<Array> actual;
+          ASSERT_OK(TopKIndices(&this->ctx_, *array, options, &actual));
+          ASSERT_OK(actual->ValidateFull());
+          AssertArraysEqual(*expected, *actual);
+
+          ASSERT_OK(TopKIndices(&this->ctx_, *chunked, options, &actual));
+          ASSERT_OK(actual->ValidateFull());
+          AssertArraysEqual(*expected, *actual);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,464 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+inline bool IsUtf8Continuation(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+
+// The offsets and data of a string or binary array, indexed from its offset
+template <typename Type>
+struct StringValues {
+  using offset_type = typename Type::offset_type;
+
+  explicit StringValues(const ArrayData& data)
+      : length(data.length),
+        offsets(data.GetValues<offset_type>(1)),
+        bytes(data.buffers[2] ? data.buffers[2]->data() : NULLPTR) {}
+
+  const uint8_t* value(int64_t i) const { return bytes + offsets[i]; }
+  offset_type value_length(int64_t i) const { return offsets[i + 1] - offsets[i]; }
+
+  int64_t length;
+  const offset_type* offsets;
+  const uint8_t* bytes;
+};
+
+template <typename Type>
+class Utf8LengthKernel : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& array = *input.array();
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out));
+
+    const StringValues<Type> values(array);
+    auto lengths = out->GetMutableValues<offset_type>(1);
+    for (int64_t i = 0; i < values.length; ++i) {
+      const uint8_t* bytes = values.value(i);
+      const offset_type size = values.value_length(i);
+      offset_type continuations = 0;
+      for (offset_type j = 0; j < size; ++j) {
+        continuations += IsUtf8Continuation(bytes[j]);
+      }
+      lengths[i] = size - continuations;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return CTypeTraits<offset_type>::type_singleton();
+  }
+};
+
+struct AsciiUpperOp {
+  static uint8_t Apply(uint8_t c) {
+    return static_cast<uint8_t>(c - (static_cast<uint8_t>(c - 'a') < 26) * ('a' - 'A'));
+  }
+};
+
+struct AsciiLowerOp {
+  static uint8_t Apply(uint8_t c) {
+    return static_cast<uint8_t>(c + (static_cast<uint8_t>(c - 'A') < 26) * ('a' - 'A'));
+  }
+};
+
+// Output strings of the same byte lengths as the input ones, transforming the
+// data buffer as a whole
+template <typename Type, typename Op>
+class TransformBytesKernel : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit TransformBytesKernel(std::shared_ptr<DataType> type)
+      : type_(std::move(type)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& array = *input.array();
+    if (array.length == 0) {
+      *out_datum = input;
+      return Status::OK();
+    }
+    ArrayData* out = out_datum->array().get();
+    const StringValues<Type> values(array);
+    const offset_type first = values.offsets[0];
+    const offset_type data_length = values.offsets[array.length] - first;
+
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(ctx->Allocate(data_length, &data));
+    const uint8_t* in_bytes = values.bytes + first;
+    uint8_t* out_bytes = data->mutable_data();
+    for (offset_type j = 0; j < data_length; ++j) {
+      out_bytes[j] = Op::Apply(in_bytes[j]);
+    }
+
+    if (first == 0) {
+      // The input offsets index the output data as well
+      out->buffers = {array.buffers[0], array.buffers[1], std::move(data)};
+      out->offset = array.offset;
+      out->null_count = array.null_count;
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(ctx->Allocate((array.length + 1) * sizeof(offset_type), &offsets));
+    auto out_offsets = reinterpret_cast<offset_type*>(offsets->mutable_data());
+    for (int64_t i = 0; i <= array.length; ++i) {
+      out_offsets[i] = values.offsets[i] - first;
+    }
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out));
+    out->buffers.resize(3);
+    out->buffers[1] = std::move(offsets);
+    out->buffers[2] = std::move(data);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+template <typename Type>
+using AsciiUpperKernel = TransformBytesKernel<Type, AsciiUpperOp>;
+
+template <typename Type>
+using AsciiLowerKernel = TransformBytesKernel<Type, AsciiLowerOp>;
+
+// The start of the n-th code point from it on, or end if there are fewer
+inline const uint8_t* SkipCodePoints(const uint8_t* it, const uint8_t* end, int64_t n) {
+  for (; it < end; ++it) {
+    if (!IsUtf8Continuation(*it) && n-- == 0) {
+      return it;
+    }
+  }
+  return end;
+}
+
+// The start of the n-th code point counting back from it, or begin if there
+// are fewer
+inline const uint8_t* SkipCodePointsBackward(const uint8_t* begin, const uint8_t* it,
+                                             int64_t n) {
+  while (n > 0 && it > begin) {
+    --it;
+    n -= !IsUtf8Continuation(*it);
+  }
+  return it;
+}
+
+template <typename Type>
+class SubstringKernel : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  SubstringKernel(std::shared_ptr<DataType> type, const SubstringOptions& options)
+      : type_(std::move(type)), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& array = *input.array();
+    if (array.length == 0) {
+      *out_datum = input;
+      return Status::OK();
+    }
+    const StringValues<Type> values(array);
+
+    // Compute the substrings' offsets first, so that the output data is
+    // allocated once, or not at all if no string is shortened. Null slots are
+    // sliced as well rather than tested.
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(ctx->Allocate((array.length + 1) * sizeof(offset_type), &offsets));
+    auto out_offsets = reinterpret_cast<offset_type*>(offsets->mutable_data());
+    std::vector<offset_type> begins(static_cast<size_t>(array.length));
+    bool shortened;
+    if (IsAscii(values)) {
+      shortened = SliceValues<true>(values, out_offsets, begins.data());
+    } else {
+      shortened = SliceValues<false>(values, out_offsets, begins.data());
+    }
+    if (!shortened) {
+      *out_datum = input;
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(ctx->Allocate(out_offsets[array.length], &data));
+    uint8_t* out_bytes = data->mutable_data();
+    for (int64_t i = 0; i < array.length; ++i) {
+      std::memcpy(out_bytes + out_offsets[i], values.bytes + begins[i],
+                  out_offsets[i + 1] - out_offsets[i]);
+    }
+
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out));
+    out->buffers.resize(3);
+    out->buffers[1] = std::move(offsets);
+    out->buffers[2] = std::move(data);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  // Whether the data of all the strings is ASCII, so that code points are bytes
+  static bool IsAscii(const StringValues<Type>& values) {
+    const uint8_t* bytes = values.value(0);
+    const offset_type size = values.offsets[values.length] - values.offsets[0];
+    uint8_t all = 0;
+    for (offset_type j = 0; j < size; ++j) {
+      all |= bytes[j];
+    }
+    return (all & 0x80) == 0;
+  }
+
+  // Write the offsets of the substrings and the input offsets they start at,
+  // returning whether any string was shortened
+  template <bool kAscii>
+  bool SliceValues(const StringValues<Type>& values, offset_type* out_offsets,
+                   offset_type* begins) const {
+    const int64_t start = options_.start;
+    const int64_t length = options_.length;
+    bool shortened = false;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < values.length; ++i) {
+      const uint8_t* value = values.value(i);
+      const int64_t size = values.value_length(i);
+      int64_t begin, end;
+      if (kAscii) {
+        begin = start >= 0 ? std::min(start, size) : std::max<int64_t>(size + start, 0);
+        end = length < 0 ? size : std::min(begin + length, size);
+      } else {
+        const uint8_t* value_end = value + size;
+        const uint8_t* begin_ptr = start >= 0
+                                       ? SkipCodePoints(value, value_end, start)
+                                       : SkipCodePointsBackward(value, value_end, -start);
+        const uint8_t* end_ptr =
+            length < 0 ? value_end : SkipCodePoints(begin_ptr, value_end, length);
+        begin = begin_ptr - value;
+        end = end_ptr - value;
+      }
+      shortened |= begin != 0 || end != size;
+      begins[i] = values.offsets[i] + static_cast<offset_type>(begin);
+      out_offsets[i + 1] = out_offsets[i] + static_cast<offset_type>(end - begin);
+    }
+    return shortened;
+  }
+
+  std::shared_ptr<DataType> type_;
+  SubstringOptions options_;
+};
+
+template <typename Type>
+class MatchStringKernel : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit MatchStringKernel(const StringMatchOptions& options) : options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    const ArrayData& array = *input.array();
+    ArrayData* out = out_datum->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out));
+    uint8_t* out_bitmap = out->buffers[1]->mutable_data();
+
+    const StringValues<Type> values(array);
+    const auto pattern = reinterpret_cast<const uint8_t*>(options_.pattern.data());
+    const auto pattern_length = static_cast<int64_t>(options_.pattern.size());
+    if (pattern_length == 0) {
+      BitUtil::SetBitsTo(out_bitmap, 0, array.length, true);
+      return Status::OK();
+    }
+
+    int64_t i = 0;
+    switch (options_.op) {
+      case StringMatchOperator::STARTS_WITH:
+        internal::GenerateBitsUnrolled(out_bitmap, 0, array.length, [&] {
+          const bool match = values.value_length(i) >= pattern_length &&
+                             std::memcmp(values.value(i), pattern, pattern_length) == 0;
+          ++i;
+          return match;
+        });
+        break;
+      case StringMatchOperator::ENDS_WITH:
+        internal::GenerateBitsUnrolled(out_bitmap, 0, array.length, [&] {
+          const bool match =
+              values.value_length(i) >= pattern_length &&
+              std::memcmp(values.value(i + 1) - pattern_length, pattern,
+                          pattern_length) == 0;
+          ++i;
+          return match;
+        });
+        break;
+      case StringMatchOperator::CONTAINS:
+        BitUtil::SetBitsTo(out_bitmap, 0, array.length, false);
+        FindContaining(values, pattern, pattern_length, out_bitmap);
+        break;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+ private:
+  // Search the data of all the strings at once rather than each string in
+  // turn, finding candidates with memchr on the first byte of the pattern, and
+  // set the bit of the string each match lies within
+  static void FindContaining(const StringValues<Type>& values, const uint8_t* pattern,
+                             int64_t pattern_length, uint8_t* out_bitmap) {
+    const int64_t rest_length = pattern_length - 1;
+    const uint8_t* it = values.value(0);
+    const uint8_t* data_end = values.value(values.length);
+    int64_t i = 0;
+    while (data_end - it >= pattern_length) {
+      it = static_cast<const uint8_t*>(
+          std::memchr(it, pattern[0], static_cast<size_t>(data_end - it - rest_length)));
+      if (it == NULLPTR) {
+        break;
+      }
+      const int64_t position = it - values.bytes;
+      while (values.offsets[i + 1] <= position) {
+        ++i;
+      }
+      if (position + pattern_length <= values.offsets[i + 1] &&
+          std::memcmp(it + 1, pattern + 1, rest_length) == 0) {
+        BitUtil::SetBit(out_bitmap, i);
+        // Skip the rest of this string
+        ++i;
+        it = values.value(i);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  StringMatchOptions options_;
+};
+
+// Instantiate Kernel<Type>(args...) for string types, and binary types if
+// allow_binary
+template <template <typename> class Kernel, typename... Args>
+Status MakeStringKernel(const char* name, const std::shared_ptr<DataType>& type,
+                        bool allow_binary, std::unique_ptr<UnaryKernel>* out,
+                        Args&&... args) {
+  switch (type->id()) {
+    case Type::STRING:
+      out->reset(new Kernel<StringType>(std::forward<Args>(args)...));
+      return Status::OK();
+    case Type::LARGE_STRING:
+      out->reset(new Kernel<LargeStringType>(std::forward<Args>(args)...));
+      return Status::OK();
+    case Type::BINARY:
+      if (allow_binary) {
+        out->reset(new Kernel<BinaryType>(std::forward<Args>(args)...));
+        return Status::OK();
+      }
+      break;
+    case Type::LARGE_BINARY:
+      if (allow_binary) {
+        out->reset(new Kernel<LargeBinaryType>(std::forward<Args>(args)...));
+        return Status::OK();
+      }
+      break;
+    default:
+      break;
+  }
+  return Status::NotImplemented(name, " on ", *type, " arrays");
+}
+
+Status ExecuteStringKernel(FunctionContext* ctx, UnaryKernel* kernel, const Datum& value,
+                           Datum* out) {
+  std::vector<Datum> result;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel, value, &result));
+  *out = detail::WrapDatumsLike(value, result);
+  return Status::OK();
+}
+
+Status CheckArrayLike(const char* name, const Datum& value) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid(name, " expects array-like input");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out) {
+  RETURN_NOT_OK(CheckArrayLike("Utf8Length", value));
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<Utf8LengthKernel>("Utf8Length", value.type(),
+                                                   /*allow_binary=*/false, &kernel));
+  detail::PrimitiveAllocatingUnaryKernel allocating(kernel.get());
+  return ExecuteStringKernel(ctx, &allocating, value, out);
+}
+
+Status AsciiUpper(FunctionContext* ctx, const Datum& value, Datum* out) {
+  RETURN_NOT_OK(CheckArrayLike("AsciiUpper", value));
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<AsciiUpperKernel>(
+      "AsciiUpper", value.type(), /*allow_binary=*/false, &kernel, value.type()));
+  return ExecuteStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status AsciiLower(FunctionContext* ctx, const Datum& value, Datum* out) {
+  RETURN_NOT_OK(CheckArrayLike("AsciiLower", value));
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<AsciiLowerKernel>(
+      "AsciiLower", value.type(), /*allow_binary=*/false, &kernel, value.type()));
+  return ExecuteStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status Substring(FunctionContext* ctx, const Datum& value,
+                 const SubstringOptions& options, Datum* out) {
+  RETURN_NOT_OK(CheckArrayLike("Substring", value));
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<SubstringKernel>(
+      "Substring", value.type(), /*allow_binary=*/false, &kernel, value.type(), options));
+  return ExecuteStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status MatchString(FunctionContext* ctx, const Datum& value,
+                   const StringMatchOptions& options, Datum* out) {
+  RETURN_NOT_OK(CheckArrayLike("MatchString", value));
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<MatchStringKernel>(
+      "MatchString", value.type(), /*allow_binary=*/true, &kernel, options));
+  detail::PrimitiveAllocatingUnaryKernel allocating(kernel.get());
+  return ExecuteStringKernel(ctx, &allocating, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
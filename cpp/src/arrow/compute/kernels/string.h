@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Compute the number of UTF-8 code points in each string
+///
+/// The output is int32 for string arrays and int64 for large_string arrays,
+/// with the nulls of the input. Code points are counted as the bytes which
+/// aren't UTF-8 continuation bytes; the input isn't validated.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value array-like input of string or large_string type
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Convert the ASCII letters of each string to upper case
+///
+/// Other bytes, including non-ASCII UTF-8 sequences, are left unchanged. The
+/// output shares the validity and offsets of the input when the input data
+/// isn't sliced.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value array-like input of string or large_string type
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiUpper(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Convert the ASCII letters of each string to lower case, see
+/// AsciiUpper()
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiLower(FunctionContext* ctx, const Datum& value, Datum* out);
+
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start = 0, int64_t length = -1)
+      : start(start), length(length) {}
+
+  /// Index of the first code point of the substring, counting from the end of
+  /// the string when negative
+  int64_t start;
+  /// Maximum number of code points in the substring, or -1 for all the code
+  /// points after start
+  int64_t length;
+};
+
+/// \brief Slice each string by UTF-8 code points
+///
+/// Substrings which would start past the end of a string are empty. When no
+/// string is shortened the input is returned as is, without copying.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value array-like input of string or large_string type
+/// \param[in] options the start and length of the substrings
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Substring(FunctionContext* ctx, const Datum& value,
+                 const SubstringOptions& options, Datum* out);
+
+enum class StringMatchOperator { STARTS_WITH, ENDS_WITH, CONTAINS };
+
+struct ARROW_EXPORT StringMatchOptions {
+  StringMatchOptions(StringMatchOperator op, std::string pattern)
+      : op(op), pattern(std::move(pattern)) {}
+
+  StringMatchOperator op;
+  /// The bytes to look for; an empty pattern matches every string
+  std::string pattern;
+};
+
+/// \brief Return whether each string starts with, ends with or contains a
+/// pattern, as a boolean array with the nulls of the input
+///
+/// Matching is bytewise, so that binary arrays are supported as well.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value array-like input of string, large_string, binary or
+/// large_binary type
+/// \param[in] options the pattern and how to match it
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchString(FunctionContext* ctx, const Datum& value,
+                   const StringMatchOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
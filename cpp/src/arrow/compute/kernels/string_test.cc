@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+namespace arrow {
+namespace compute {
+
+using StringFunc = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+template <typename ArrowType>
+class TestStringKernels : public ComputeFixture, public TestBase {
+ protected:
+  using offset_type = typename ArrowType::offset_type;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<DataType> offset_type_singleton() {
+    return CTypeTraits<offset_type>::type_singleton();
+  }
+
+  void AssertUnary(const StringFunc& func, const std::shared_ptr<Array>& input,
+                   const std::shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(func(&ctx_, input, &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    std::shared_ptr<Array> actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  void AssertUnary(const StringFunc& func, const std::string& input_json,
+                   const std::shared_ptr<DataType>& out_type,
+                   const std::string& expected_json) {
+    AssertUnary(func, ArrayFromJSON(type(), input_json),
+                ArrayFromJSON(out_type, expected_json));
+  }
+
+  void AssertSubstring(const SubstringOptions& options, const std::string& input_json,
+                       const std::string& expected_json) {
+    AssertUnary(
+        [&](FunctionContext* ctx, const Datum& value, Datum* out) {
+          return Substring(ctx, value, options, out);
+        },
+        input_json, type(), expected_json);
+  }
+
+  void AssertMatch(StringMatchOperator op, const std::string& pattern,
+                   const std::shared_ptr<Array>& input,
+                   const std::string& expected_json) {
+    AssertUnary(
+        [&](FunctionContext* ctx, const Datum& value, Datum* out) {
+          return MatchString(ctx, value, StringMatchOptions(op, pattern), out);
+        },
+        input, ArrayFromJSON(boolean(), expected_json));
+  }
+};
+
+typedef ::testing::Types<StringType, LargeStringType> StringArrowTypes;
+
+TYPED_TEST_CASE(TestStringKernels, StringArrowTypes);
+
+TYPED_TEST(TestStringKernels, Utf8Length) {
+  this->AssertUnary(Utf8Length, R"(["abc", null, "", "é€x", "ñ"])",
+                    this->offset_type_singleton(), "[3, null, 0, 3, 1]");
+  this->AssertUnary(Utf8Length, "[]", this->offset_type_singleton(), "[]");
+}
+
+TYPED_TEST(TestStringKernels, AsciiUpperLower) {
+  const std::string input = R"(["aBc", null, "", "xyz@[`{é", "Zz"])";
+  this->AssertUnary(AsciiUpper, input, this->type(),
+                    R"(["ABC", null, "", "XYZ@[`{é", "ZZ"])");
+  this->AssertUnary(AsciiLower, input, this->type(),
+                    R"(["abc", null, "", "xyz@[`{é", "zz"])");
+  this->AssertUnary(AsciiUpper, "[]", this->type(), "[]");
+
+  // Sliced input, with and without data before the first string
+  auto array = ArrayFromJSON(this->type(), R"(["a", "bC", null, "d"])");
+  this->AssertUnary(AsciiUpper, array->Slice(1),
+                    ArrayFromJSON(this->type(), R"(["BC", null, "D"])"));
+  array = ArrayFromJSON(this->type(), R"([null, "", "bC", "d"])");
+  this->AssertUnary(AsciiLower, array->Slice(1, 2),
+                    ArrayFromJSON(this->type(), R"(["", "bc"])"));
+}
+
+TYPED_TEST(TestStringKernels, AsciiUpperSharesOffsets) {
+  auto array = ArrayFromJSON(this->type(), R"(["a", null, "bc"])");
+  Datum out;
+  ASSERT_OK(AsciiUpper(&this->ctx_, array, &out));
+  ASSERT_EQ(out.array()->buffers[0], array->data()->buffers[0]);
+  ASSERT_EQ(out.array()->buffers[1], array->data()->buffers[1]);
+}
+
+TYPED_TEST(TestStringKernels, Substring) {
+  const std::string input = R"(["abcde", null, "", "ab", "éa€bñ"])";
+  this->AssertSubstring(SubstringOptions(1), input,
+                        R"(["bcde", null, "", "b", "a€bñ"])");
+  this->AssertSubstring(SubstringOptions(1, 2), input, R"(["bc", null, "", "b", "a€"])");
+  this->AssertSubstring(SubstringOptions(0, 1), input, R"(["a", null, "", "a", "é"])");
+  this->AssertSubstring(SubstringOptions(3), input, R"(["de", null, "", "", "bñ"])");
+  this->AssertSubstring(SubstringOptions(-2), input, R"(["de", null, "", "ab", "bñ"])");
+  this->AssertSubstring(SubstringOptions(-4, 2), input,
+                        R"(["bc", null, "", "ab", "a€"])");
+  this->AssertSubstring(SubstringOptions(10), input, R"(["", null, "", "", ""])");
+  this->AssertSubstring(SubstringOptions(0, 0), input, R"(["", null, "", "", ""])");
+  // ASCII only
+  this->AssertSubstring(SubstringOptions(1, 3), R"(["abcde", "xy", null])",
+                        R"(["bcd", "y", null])");
+  this->AssertSubstring(SubstringOptions(-3, 2), R"(["abcde", "xy", null])",
+                        R"(["cd", "xy", null])");
+  this->AssertSubstring(SubstringOptions(1), "[]", "[]");
+}
+
+TYPED_TEST(TestStringKernels, SubstringUnchanged) {
+  // No string is shortened: the input is returned without copying
+  auto array = ArrayFromJSON(this->type(), R"(["ab", null, "é"])");
+  Datum out;
+  ASSERT_OK(Substring(&this->ctx_, array, SubstringOptions(0, 2), &out));
+  ASSERT_EQ(out.array(), array->data());
+  ASSERT_OK(Substring(&this->ctx_, array, SubstringOptions(-5), &out));
+  ASSERT_EQ(out.array(), array->data());
+}
+
+TYPED_TEST(TestStringKernels, MatchString) {
+  auto input =
+      ArrayFromJSON(this->type(), R"(["abcab", null, "", "ab", "xaby", "ca"])");
+  this->AssertMatch(StringMatchOperator::STARTS_WITH, "ab", input,
+                    "[true, null, false, true, false, false]");
+  this->AssertMatch(StringMatchOperator::ENDS_WITH, "ab", input,
+                    "[true, null, false, true, false, false]");
+  this->AssertMatch(StringMatchOperator::CONTAINS, "ab", input,
+                    "[true, null, false, true, true, false]");
+  this->AssertMatch(StringMatchOperator::CONTAINS, "ca", input,
+                    "[true, null, false, false, false, true]");
+  this->AssertMatch(StringMatchOperator::CONTAINS, "", input,
+                    "[true, null, true, true, true, true]");
+  this->AssertMatch(StringMatchOperator::STARTS_WITH, "", input,
+                    "[true, null, true, true, true, true]");
+
+  // Matches across consecutive strings don't count
+  input = ArrayFromJSON(this->type(), R"(["xa", "by", "a", "", "b", "ab"])");
+  this->AssertMatch(StringMatchOperator::CONTAINS, "ab", input,
+                    "[false, false, false, false, false, true]");
+  this->AssertMatch(StringMatchOperator::CONTAINS, "ab", input->Slice(1, 4),
+                    "[false, false, false, false]");
+  this->AssertMatch(StringMatchOperator::ENDS_WITH, "b", input->Slice(1),
+                    "[false, false, false, true, true]");
+  this->AssertMatch(StringMatchOperator::CONTAINS, "abc",
+                    ArrayFromJSON(this->type(), "[]"), "[]");
+}
+
+TYPED_TEST(TestStringKernels, ChunkedArray) {
+  auto chunked = ChunkedArrayFromJSON(this->type(), {R"(["ab", null])", R"(["c"])"});
+  Datum out;
+  ASSERT_OK(AsciiUpper(&this->ctx_, chunked, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(
+      *ChunkedArrayFromJSON(this->type(), {R"(["AB", null])", R"(["C"])"}),
+      *out.chunked_array());
+
+  ASSERT_OK(Utf8Length(&this->ctx_, chunked, &out));
+  AssertChunkedEqual(
+      *ChunkedArrayFromJSON(this->offset_type_singleton(), {"[2, null]", "[1]"}),
+      *out.chunked_array());
+}
+
+class TestStringKernelsBinary : public ComputeFixture, public TestBase {};
+
+TEST_F(TestStringKernelsBinary, MatchBinary) {
+  auto input = ArrayFromJSON(binary(), R"(["abc", null, "xbc"])");
+  Datum out;
+  ASSERT_OK(MatchString(&ctx_, input,
+                        StringMatchOptions(StringMatchOperator::ENDS_WITH, "bc"), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, true]"), *out.make_array());
+}
+
+TEST_F(TestStringKernelsBinary, UnsupportedTypes) {
+  Datum out;
+  ASSERT_RAISES(NotImplemented,
+                Utf8Length(&ctx_, ArrayFromJSON(binary(), R"(["a"])"), &out));
+  ASSERT_RAISES(NotImplemented, AsciiUpper(&ctx_, ArrayFromJSON(int32(), "[1]"), &out));
+  ASSERT_RAISES(
+      NotImplemented,
+      MatchString(&ctx_, ArrayFromJSON(int32(), "[1]"),
+                  StringMatchOptions(StringMatchOperator::CONTAINS, "a"), &out));
+  ASSERT_RAISES(Invalid, Substring(&ctx_, Datum(), SubstringOptions(1), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
@@ -23,63 +24,32 @@
 namespace arrow {
 namespace compute {
 
-template <typename ArrowType,
-          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
-struct SumState {
-  using ThisType = SumState<ArrowType, SumType>;
-
-  ThisType operator+(const ThisType& rhs) const {
-    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
-  }
-
-  ThisType& operator+=(const ThisType& rhs) {
-    this->count += rhs.count;
-    this->sum += rhs.sum;
-
-    return *this;
+namespace {
+
+struct SumDispatch {
+  using FunctionType = std::shared_ptr<AggregateFunction> (*)(const DataType&);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+        {internal::DispatchLevel::NONE,
+         MakeSumAggregateFunctionForLevel<internal::DispatchLevel::NONE>},
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+        {internal::DispatchLevel::AVX2, MakeSumAggregateFunctionAvx2},
+#endif
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+        {internal::DispatchLevel::AVX512, MakeSumAggregateFunctionAvx512},
+#endif
+    };
   }
-
-  std::shared_ptr<Scalar> Finalize() const {
-    using ScalarType = typename TypeTraits<SumType>::ScalarType;
-
-    if (count == 0) {
-      return std::make_shared<ScalarType>();
-    }
-
-    return MakeScalar(sum);
-  }
-
-  static std::shared_ptr<DataType> out_type() {
-    return TypeTraits<SumType>::type_singleton();
-  }
-
-  size_t count = 0;
-  typename SumType::c_type sum = 0;
 };
 
-#define SUM_AGG_FN_CASE(T)                              \
-  case T::type_id:                                      \
-    return std::static_pointer_cast<AggregateFunction>( \
-        std::make_shared<SumAggregateFunction<T, SumState<T>>>());
+}  // namespace
 
 std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type,
                                                             FunctionContext* ctx) {
-  switch (type.id()) {
-    SUM_AGG_FN_CASE(UInt8Type);
-    SUM_AGG_FN_CASE(Int8Type);
-    SUM_AGG_FN_CASE(UInt16Type);
-    SUM_AGG_FN_CASE(Int16Type);
-    SUM_AGG_FN_CASE(UInt32Type);
-    SUM_AGG_FN_CASE(Int32Type);
-    SUM_AGG_FN_CASE(UInt64Type);
-    SUM_AGG_FN_CASE(Int64Type);
-    SUM_AGG_FN_CASE(FloatType);
-    SUM_AGG_FN_CASE(DoubleType);
-    default:
-      return nullptr;
-  }
-
-#undef SUM_AGG_FN_CASE
+  static internal::DynamicDispatch<SumDispatch> dispatch;
+  return dispatch.func(type);
 }
 
 static Status GetSumKernel(FunctionContext* ctx, const DataType& type,
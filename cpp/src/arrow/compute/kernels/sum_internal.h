@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 
@@ -25,7 +28,9 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -54,17 +59,85 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
-template <typename ArrowType, typename StateType>
+// Values are summed in blocks of kSumBlockSize, each over kSumLanes
+// independent accumulators so that the compiler can vectorize the loop.
+//
+// The summing templates are also instantiated for the instruction sets of
+// internal::DispatchLevel, in units built for them (sum_avx2.cc, ...) where
+// the compiler vectorizes the loop with wider registers.
+static constexpr int64_t kSumLanes = 8;
+static constexpr int64_t kSumBlockSize = 256;
+
+template <typename SumCType,
+          internal::DispatchLevel Level = internal::DispatchLevel::NONE,
+          typename CType>
+SumCType SumBlock(const CType* values, int64_t length) {
+  SumCType lanes[kSumLanes] = {};
+  int64_t i = 0;
+  for (; i + kSumLanes <= length; i += kSumLanes) {
+    for (int64_t j = 0; j < kSumLanes; j++) {
+      lanes[j] += values[i + j];
+    }
+  }
+  for (; i < length; i++) {
+    lanes[0] += values[i];
+  }
+  return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+         ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+// Accumulates block sums.
+template <typename SumCType,
+          internal::DispatchLevel Level = internal::DispatchLevel::NONE,
+          typename Enable = void>
+class SumAccumulator {
+ public:
+  void Add(SumCType block_sum) { sum_ += block_sum; }
+
+  SumCType total() const { return sum_; }
+
+ private:
+  SumCType sum_ = 0;
+};
+
+// Floating point block sums are combined pairwise, which bounds the rounding
+// error by O(log(n)) instead of O(n) for a running sum.
+template <typename SumCType, internal::DispatchLevel Level>
+class SumAccumulator<SumCType, Level,
+                     enable_if_t<std::is_floating_point<SumCType>::value>> {
+ public:
+  void Add(SumCType block_sum) {
+    // partials_[level] holds the sum of 2^level blocks if that bit of count_
+    // is set; adding a block carries like incrementing a binary counter.
+    int level = 0;
+    for (uint64_t bit = 1; count_ & bit; bit <<= 1, level++) {
+      block_sum += partials_[level];
+    }
+    partials_[level] = block_sum;
+    count_++;
+  }
+
+  SumCType total() const {
+    SumCType sum = 0;
+    for (int level = 0; level < 64; level++) {
+      if (count_ & (uint64_t(1) << level)) {
+        sum += partials_[level];
+      }
+    }
+    return sum;
+  }
+
+ private:
+  uint64_t count_ = 0;
+  SumCType partials_[64] = {};
+};
+
+template <typename ArrowType, typename StateType,
+          internal::DispatchLevel Level = internal::DispatchLevel::NONE>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
-
-  // A small number of elements rounded to the next cacheline. This should
-  // amount to a maximum of 4 cachelines when dealing with 8 bytes elements.
-  static constexpr int64_t kTinyThreshold = 32;
-  static_assert(kTinyThreshold >= (2 * CHAR_BIT) + 1,
-                "ConsumeSparse requires 3 bytes of null bitmap, and 17 is the"
-                "required minimum number of bits/elements to cover 3 bytes.");
+  using SumCType = decltype(StateType().sum);
 
  public:
   Status Consume(const Array& input, StateType* state) const override {
@@ -72,12 +145,8 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
 
     if (input.null_count() == 0) {
       *state = ConsumeDense(array);
-    } else if (input.length() <= kTinyThreshold) {
-      // In order to simplify ConsumeSparse implementation (requires at least 3
-      // bytes of bitmap data), small arrays are handled differently.
-      *state = ConsumeTiny(array);
     } else {
-      *state = ConsumeSparse(array);
+      *state = ConsumeWithNulls(array);
     }
 
     return Status::OK();
@@ -101,107 +170,123 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
 
     const auto values = array.raw_values();
     const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
+    SumAccumulator<SumCType, Level> sum;
+    for (int64_t i = 0; i < length; i += kSumBlockSize) {
+      sum.Add(
+          SumBlock<SumCType, Level>(values + i, std::min(kSumBlockSize, length - i)));
     }
 
+    local.sum = sum.total();
     local.count = length;
 
     return local;
   }
 
-  StateType ConsumeTiny(const ArrayType& array) const {
-    StateType local;
-
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
-    const auto values = array.raw_values();
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (reader.IsSet()) {
-        local.sum += values[i];
-        local.count++;
-      }
-      reader.Next();
-    }
-
-    return local;
-  }
-
   // While this is not branchless, gcc needs this to be in a different function
   // for it to generate cmov which ends to be slightly faster than
   // multiplication but safe for handling NaN with doubles.
   inline CType MaskedValue(bool valid, CType value) const { return valid ? value : 0; }
 
-  inline StateType UnrolledSum(uint8_t bits, const CType* values) const {
+  // Blocks of 64 values are summed like dense arrays when all valid and
+  // skipped when all null; only the other blocks are masked value by value.
+  StateType ConsumeWithNulls(const ArrayType& array) const {
     StateType local;
 
-    if (bits < 0xFF) {
-      // Some nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
-      }
-      local.count += BitUtil::kBytePopcount[bits];
-    } else {
-      // No nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
-      }
-      local.count += 8;
-    }
-
+    const auto values = array.raw_values();
+    const uint8_t* bitmap = array.null_bitmap_data();
+    const int64_t offset = array.offset();
+    SumAccumulator<SumCType, Level> sum;
+    internal::VisitValidityBlocks(
+        bitmap, offset, array.length(),
+        [&](int64_t position, int64_t length) {
+          sum.Add(SumBlock<SumCType, Level>(values + position, length));
+          local.count += length;
+        },
+        [&](int64_t position, int64_t length) {
+          const uint64_t bits =
+              internal::LoadBitmapWord(bitmap, offset + position, length);
+          SumCType block_sum = 0;
+          for (int64_t i = 0; i < length; i++) {
+            block_sum += MaskedValue((bits >> i) & 1, values[position + i]);
+          }
+          sum.Add(block_sum);
+          local.count += std::bitset<64>(bits).count();
+        });
+
+    local.sum = sum.total();
     return local;
   }
+};  // namespace compute
 
-  StateType ConsumeSparse(const ArrayType& array) const {
-    StateType local;
+template <typename ArrowType,
+          internal::DispatchLevel Level = internal::DispatchLevel::NONE,
+          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
+struct SumState {
+  using ThisType = SumState<ArrowType, Level, SumType>;
 
-    // Sliced bitmaps on non-byte positions induce problem with the branchless
-    // unrolled technique. Thus extra padding is added on both left and right
-    // side of the slice such that both ends are byte-aligned. The first and
-    // last bitmap are properly masked to ignore extra values induced by
-    // padding.
-    //
-    // The execution is divided in 3 sections.
-    //
-    // 1. Compute the sum of the first masked byte.
-    // 2. Compute the sum of the middle bytes
-    // 3. Compute the sum of the last masked byte.
+  ThisType operator+(const ThisType& rhs) const {
+    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
+  }
 
-    const int64_t length = array.length();
-    const int64_t offset = array.offset();
+  ThisType& operator+=(const ThisType& rhs) {
+    this->count += rhs.count;
+    this->sum += rhs.sum;
 
-    // The number of bytes covering the range, this includes partial bytes.
-    // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
-    // on the left, and on the right.
-    const int64_t covering_bytes = BitUtil::CoveringBytes(offset, length);
-    DCHECK_GE(covering_bytes, 3);
+    return *this;
+  }
 
-    // Align values to the first batch of 8 elements. Note that raw_values() is
-    // already adjusted with the offset, thus we rewind a little to align to
-    // the closest 8-batch offset.
-    const auto values = array.raw_values() - (offset % 8);
+  std::shared_ptr<Scalar> Finalize() const {
+    using ScalarType = typename TypeTraits<SumType>::ScalarType;
 
-    // Align bitmap at the first consumable byte.
-    const auto bitmap = array.null_bitmap_data() + BitUtil::RoundDown(offset, 8) / 8;
+    if (count == 0) {
+      return std::make_shared<ScalarType>();
+    }
 
-    // Consume the first (potentially partial) byte.
-    const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
-    local += UnrolledSum(bitmap[0] & first_mask, values);
+    return MakeScalar(sum);
+  }
 
-    // Consume the (full) middle bytes. The loop iterates in unit of
-    // batches of 8 values and 1 byte of bitmap.
-    for (int64_t i = 1; i < covering_bytes - 1; i++) {
-      local += UnrolledSum(bitmap[i], &values[i * 8]);
-    }
+  static std::shared_ptr<DataType> out_type() {
+    return TypeTraits<SumType>::type_singleton();
+  }
 
-    // Consume the last (potentially partial) byte.
-    const int64_t last_idx = covering_bytes - 1;
-    const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
-    local += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8]);
+  size_t count = 0;
+  typename SumType::c_type sum = 0;
+};
 
-    return local;
+#define SUM_AGG_FN_CASE(T)                              \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<SumAggregateFunction<T, SumState<T, Level>, Level>>());
+
+// The sum for an instruction set, or null if the type isn't supported
+template <internal::DispatchLevel Level>
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionForLevel(
+    const DataType& type) {
+  switch (type.id()) {
+    SUM_AGG_FN_CASE(UInt8Type);
+    SUM_AGG_FN_CASE(Int8Type);
+    SUM_AGG_FN_CASE(UInt16Type);
+    SUM_AGG_FN_CASE(Int16Type);
+    SUM_AGG_FN_CASE(UInt32Type);
+    SUM_AGG_FN_CASE(Int32Type);
+    SUM_AGG_FN_CASE(UInt64Type);
+    SUM_AGG_FN_CASE(Int64Type);
+    SUM_AGG_FN_CASE(FloatType);
+    SUM_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
   }
-};  // namespace compute
+}
+
+#undef SUM_AGG_FN_CASE
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionAvx2(const DataType& type);
+#endif
+
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionAvx512(const DataType& type);
+#endif
 
 }  // namespace compute
 }  // namespace arrow
@@ -23,6 +23,7 @@
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/visitor_inline.h"
 
@@ -127,21 +128,14 @@ Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indic
 
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = indices.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<ChunkedArray> current_chunk;
-
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &current_chunk));
-    // Concatenate the result to make a single array for this chunk
-    RETURN_NOT_OK(
-        Concatenate(current_chunk->chunks(), default_memory_pool(), &new_chunks[i]));
+  // Concatenate `values` once (see above), then take each indices chunk from it
+  std::shared_ptr<Array> values_array;
+  if (values.num_chunks() == 1) {
+    values_array = values.chunk(0);
+  } else {
+    RETURN_NOT_OK(Concatenate(values.chunks(), default_memory_pool(), &values_array));
   }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
-  return Status::OK();
+  return Take(ctx, *values_array, indices, options, out);
 }
 
 Status Take(FunctionContext* ctx, const Array& values, const ChunkedArray& indices,
@@ -149,11 +143,12 @@ Status Take(FunctionContext* ctx, const Array& values, const ChunkedArray& indic
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
 
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &new_chunks[i]));
-  }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, num_chunks, [&](FunctionContext* task_ctx, int i) {
+        // Take with that indices chunk
+        return Take(task_ctx, values, *indices.chunk(i), options, &new_chunks[i]);
+      }));
+  *out = std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   return Status::OK();
 }
 
@@ -164,9 +159,10 @@ Status Take(FunctionContext* ctx, const RecordBatch& batch, const Array& indices
 
   std::vector<std::shared_ptr<Array>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *batch.column(j), indices, options, &columns[j]));
-  }
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, ncols, [&](FunctionContext* task_ctx, int j) {
+        return Take(task_ctx, *batch.column(j), indices, options, &columns[j]);
+      }));
   *out = RecordBatch::Make(batch.schema(), nrows, columns);
   return Status::OK();
 }
@@ -176,9 +172,10 @@ Status Take(FunctionContext* ctx, const Table& table, const Array& indices,
   auto ncols = table.num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
-  }
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, ncols, [&](FunctionContext* task_ctx, int j) {
+        return Take(task_ctx, *table.column(j), indices, options, &columns[j]);
+      }));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
@@ -188,9 +185,10 @@ Status Take(FunctionContext* ctx, const Table& table, const ChunkedArray& indice
   auto ncols = table.num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
-  }
+  RETURN_NOT_OK(
+      detail::ParallelForEach(ctx, ncols, [&](FunctionContext* task_ctx, int j) {
+        return Take(task_ctx, *table.column(j), indices, options, &columns[j]);
+      }));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
@@ -54,6 +54,20 @@ static void TakeInt64(benchmark::State& state) {
   TakeBenchmark(state, values, indices);
 }
 
+static void TakeInt32(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int32_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Int32(array_size, -100, 100, args.null_proportion);
+
+  auto indices = rand.Int32(static_cast<int32_t>(array_size), 0,
+                            static_cast<int32_t>(array_size - 1), args.null_proportion);
+
+  TakeBenchmark(state, values, indices);
+}
+
 static void TakeFixedSizeList1Int64(benchmark::State& state) {
   RegressionArgs args(state);
 
@@ -125,6 +139,13 @@ BENCHMARK(TakeInt64)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(TakeInt32)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 BENCHMARK(TakeFixedSizeList1Int64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
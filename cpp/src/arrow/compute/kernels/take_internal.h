@@ -18,18 +18,25 @@
 #pragma once
 
 #include <algorithm>
+#include <bitset>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/filter_internal.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -230,12 +237,80 @@ class ArrayIndexSequence {
 
   int64_t null_count() const { return indices_->null_count(); }
 
+  const NumericArray<IndexType>& indices() const { return *indices_; }
+
  private:
   const NumericArray<IndexType>* indices_ = nullptr;
   int64_t index_ = 0;
   bool never_out_of_bounds_ = false;
 };
 
+// IndexSequence which yields the indices of positions in a BooleanArray
+// which are either null or true
+class FilterIndexSequence {
+ public:
+  // constexpr so we'll never instantiate bounds checking
+  constexpr bool never_out_of_bounds() const { return true; }
+  void set_never_out_of_bounds() {}
+
+  constexpr FilterIndexSequence() = default;
+
+  FilterIndexSequence(const BooleanArray& filter, int64_t out_length)
+      : filter_(&filter),
+        values_(filter.data()->GetValues<uint8_t>(1, 0)),
+        validity_(filter.null_count() > 0 ? filter.null_bitmap_data() : NULLPTR),
+        out_length_(out_length) {}
+
+  std::pair<int64_t, bool> Next() {
+    // skip to the next word with an index at which the filter is either null
+    // or true, and pop its lowest such index
+    while (selection_ == 0) {
+      word_position_ += 64;
+      selection_ = SelectionWord(
+          word_position_, std::min<int64_t>(64, filter_->length() - word_position_));
+    }
+    const int64_t index = word_position_ + BitUtil::CountTrailingZeros(selection_);
+    selection_ &= selection_ - 1;
+    return std::make_pair(index, filter_->IsValid(index));
+  }
+
+  int64_t length() const { return out_length_; }
+
+  int64_t null_count() const { return filter_->null_count(); }
+
+  const BooleanArray& filter() const { return *filter_; }
+
+  // The bits of the slots in [position, position + num_bits) which are
+  // either null or true, num_bits being at most 64
+  uint64_t SelectionWord(int64_t position, int64_t num_bits) const {
+    const int64_t offset = filter_->offset() + position;
+    const uint64_t values = internal::LoadBitmapWord(values_, offset, num_bits);
+    if (validity_ == NULLPTR) {
+      return values;
+    }
+    const uint64_t validity = internal::LoadBitmapWord(validity_, offset, num_bits);
+    return (values & validity) |
+           BitUtil::TrailingBits(~validity, static_cast<int>(num_bits));
+  }
+
+  // The validity bits of the slots in [position, position + num_bits)
+  uint64_t ValidityWord(int64_t position, int64_t num_bits) const {
+    if (validity_ == NULLPTR) {
+      return BitUtil::TrailingBits(~uint64_t(0), static_cast<int>(num_bits));
+    }
+    return internal::LoadBitmapWord(validity_, filter_->offset() + position, num_bits);
+  }
+
+ private:
+  const BooleanArray* filter_ = nullptr;
+  const uint8_t* values_ = nullptr;
+  const uint8_t* validity_ = nullptr;
+  int64_t out_length_ = -1;
+  // The selection bits of the word at word_position_ not yet yielded
+  int64_t word_position_ = -64;
+  uint64_t selection_ = 0;
+};
+
 // Default implementation: taking from a simple array into a builder requires only that
 // the array supports array.GetView() and the corresponding builder supports
 // builder.UnsafeAppend(array.GetView())
@@ -270,6 +345,347 @@ class TakerImpl : public Taker<IndexSequence> {
   std::unique_ptr<BuilderType> builder_;
 };
 
+// Number of indices which are bounds checked at once, before their values are gathered
+constexpr int64_t kTakeBlockSize = 1024;
+
+// Distance (in indices) at which values are prefetched while gathering
+constexpr int64_t kTakePrefetchDistance = 32;
+
+// Values smaller than this are expected to be cache resident and aren't prefetched
+constexpr int64_t kTakePrefetchMinBytes = 1 << 20;
+
+// Unsigned integer of a given byte width, values of all fixed-width types of that
+// width are gathered as such
+template <int kWidth>
+struct TakeWord {};
+
+template <>
+struct TakeWord<1> {
+  using type = uint8_t;
+};
+
+template <>
+struct TakeWord<2> {
+  using type = uint16_t;
+};
+
+template <>
+struct TakeWord<4> {
+  using type = uint32_t;
+};
+
+template <>
+struct TakeWord<8> {
+  using type = uint64_t;
+};
+
+template <typename T>
+using is_take_word_type =
+    std::integral_constant<bool, has_c_type<T>::value && !is_boolean_type<T>::value>;
+
+// Whether all indices are in [0, values_length), without branching per index
+template <typename IndexCType>
+bool TakeIndicesInBounds(const IndexCType* indices, int64_t length,
+                         int64_t values_length) {
+  uint64_t max_index = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    // negative indices wrap around to large unsigned values
+    max_index =
+        std::max(max_index, static_cast<uint64_t>(static_cast<int64_t>(indices[i])));
+  }
+  return length == 0 || max_index < static_cast<uint64_t>(values_length);
+}
+
+// Gather values at in bounds indices
+template <typename Word, typename IndexCType>
+void GatherTakeValues(const Word* values, const IndexCType* indices, int64_t length,
+                      bool prefetch, Word* out) {
+  int64_t i = 0;
+  if (prefetch) {
+    for (; i + kTakePrefetchDistance < length; ++i) {
+      ARROW_PREFETCH(values + indices[i + kTakePrefetchDistance]);
+      out[i] = values[indices[i]];
+    }
+  }
+  for (; i < length; ++i) {
+    out[i] = values[indices[i]];
+  }
+}
+
+#if defined(ARROW_HAVE_AVX2)
+
+// Hardware gathers for the index and value widths AVX2 supports natively
+
+inline void GatherTakeValues(const uint32_t* values, const int32_t* indices,
+                             int64_t length, bool, uint32_t* out) {
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    const __m256i value =
+        _mm256_i32gather_epi32(reinterpret_cast<const int*>(values), index, 4);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), value);
+  }
+  for (; i < length; ++i) {
+    out[i] = values[indices[i]];
+  }
+}
+
+inline void GatherTakeValues(const uint64_t* values, const int32_t* indices,
+                             int64_t length, bool, uint64_t* out) {
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+    const __m256i value =
+        _mm256_i32gather_epi64(reinterpret_cast<const long long*>(values), index, 8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), value);
+  }
+  for (; i < length; ++i) {
+    out[i] = values[indices[i]];
+  }
+}
+
+inline void GatherTakeValues(const uint64_t* values, const int64_t* indices,
+                             int64_t length, bool, uint64_t* out) {
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    const __m256i value =
+        _mm256_i64gather_epi64(reinterpret_cast<const long long*>(values), index, 8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), value);
+  }
+  for (; i < length; ++i) {
+    out[i] = values[indices[i]];
+  }
+}
+
+#endif  // ARROW_HAVE_AVX2
+
+// Taking from fixed-width arrays: skip the builder and gather raw values (as
+// unsigned integers of the same width) into a buffer. Integer index arrays get
+// dedicated loops, split by whether indices or values have nulls.
+template <typename IndexSequence, typename Word>
+class PrimitiveTakerImpl : public Taker<IndexSequence> {
+ public:
+  using Taker<IndexSequence>::Taker;
+
+  Status SetContext(FunctionContext* ctx) override {
+    values_builder_.reset(new TypedBufferBuilder<Word>(ctx->memory_pool()));
+    null_bitmap_builder_.reset(new TypedBufferBuilder<bool>(ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  Status Take(const Array& values, IndexSequence indices) override {
+    DCHECK(this->type_->Equals(values.type()));
+    RETURN_NOT_OK(values_builder_->Reserve(indices.length()));
+    RETURN_NOT_OK(null_bitmap_builder_->Reserve(indices.length()));
+    return Gather(values, indices);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    const int64_t length = values_builder_->length();
+    const int64_t null_count = null_bitmap_builder_->false_count();
+    std::shared_ptr<Buffer> null_bitmap, data;
+    if (null_count > 0) {
+      RETURN_NOT_OK(null_bitmap_builder_->Finish(&null_bitmap));
+    } else {
+      null_bitmap_builder_->Reset();
+    }
+    RETURN_NOT_OK(values_builder_->Finish(&data));
+    *out =
+        MakeArray(ArrayData::Make(this->type_, length, {null_bitmap, data}, null_count));
+    return Status::OK();
+  }
+
+ private:
+  template <typename OtherIndexSequence>
+  Status Gather(const Array& values, OtherIndexSequence indices) {
+    const Word* raw_values = values.data()->GetValues<Word>(1);
+    return VisitIndices(indices, values, [&](int64_t index, bool is_valid) {
+      values_builder_->UnsafeAppend(is_valid ? raw_values[index] : Word(0));
+      null_bitmap_builder_->UnsafeAppend(is_valid);
+      return Status::OK();
+    });
+  }
+
+  template <typename IndexType>
+  Status Gather(const Array& values, ArrayIndexSequence<IndexType> indices) {
+    using IndexCType = typename IndexType::c_type;
+
+    const ArrayData& index_data = *indices.indices().data();
+    const IndexCType* raw_indices = index_data.GetValues<IndexCType>(1);
+    const Word* raw_values = values.data()->GetValues<Word>(1);
+    const int64_t length = index_data.length;
+    const int64_t values_length = values.length();
+    const bool check_bounds = !indices.never_out_of_bounds();
+    Word* out = values_builder_->mutable_data() + values_builder_->length();
+
+    if (indices.null_count() == 0 && values.null_count() == 0) {
+      const bool prefetch =
+          values_length * static_cast<int64_t>(sizeof(Word)) >= kTakePrefetchMinBytes;
+      for (int64_t i = 0; i < length; i += kTakeBlockSize) {
+        const int64_t block_length = std::min(kTakeBlockSize, length - i);
+        if (check_bounds &&
+            !TakeIndicesInBounds(raw_indices + i, block_length, values_length)) {
+          return Status::IndexError("take index out of bounds");
+        }
+        GatherTakeValues(raw_values, raw_indices + i, block_length, prefetch, out + i);
+      }
+      values_builder_->UnsafeAdvance(length);
+      null_bitmap_builder_->UnsafeAppend(length, true);
+      return Status::OK();
+    }
+
+    if (values.null_count() == 0) {
+      return GatherNullIndices<IndexCType>(index_data, raw_values, values_length,
+                                           check_bounds, out);
+    }
+
+    // Compute the validity of each output slot while gathering it
+    const uint8_t* index_bitmap =
+        indices.null_count() > 0 ? index_data.buffers[0]->data() : NULLPTR;
+    const uint8_t* values_bitmap =
+        values.null_count() > 0 ? values.null_bitmap_data() : NULLPTR;
+    bool out_of_bounds = false;
+    int64_t i = 0;
+    null_bitmap_builder_->UnsafeAppend</*count_falses=*/true>(length, [&]() {
+      const int64_t position = i++;
+      out[position] = Word(0);
+      if (index_bitmap != NULLPTR &&
+          !BitUtil::GetBit(index_bitmap, index_data.offset + position)) {
+        return false;
+      }
+      const auto index = static_cast<int64_t>(raw_indices[position]);
+      if (check_bounds && ARROW_PREDICT_FALSE(static_cast<uint64_t>(index) >=
+                                              static_cast<uint64_t>(values_length))) {
+        out_of_bounds = true;
+        return false;
+      }
+      if (values_bitmap != NULLPTR &&
+          !BitUtil::GetBit(values_bitmap, values.offset() + index)) {
+        return false;
+      }
+      out[position] = raw_values[index];
+      return true;
+    });
+    if (out_of_bounds) {
+      return Status::IndexError("take index out of bounds");
+    }
+    values_builder_->UnsafeAdvance(length);
+    return Status::OK();
+  }
+
+  // Filtering goes through the filter a word at a time (see filter_internal.h):
+  // the values of fully selected words are copied at once, and those of partly
+  // selected words compacted.
+  Status Gather(const Array& values, FilterIndexSequence indices) {
+    const auto compact_values = GetCompactFilterValues<Word>();
+    const auto compact_bits = GetCompactFilterBits();
+    const int64_t length = indices.filter().length();
+    const Word* raw_values = values.data()->GetValues<Word>(1);
+    const uint8_t* values_bitmap =
+        values.null_count() > 0 ? values.null_bitmap_data() : NULLPTR;
+    const bool some_nulls = values_bitmap != NULLPTR || indices.null_count() > 0;
+    Word* out = values_builder_->mutable_data() + values_builder_->length();
+    int64_t out_length = 0;
+
+    for (int64_t position = 0; position < length; position += 64) {
+      const int64_t num_bits = std::min<int64_t>(64, length - position);
+      const uint64_t selection = indices.SelectionWord(position, num_bits);
+      if (selection == 0) {
+        continue;
+      }
+      const int popcount = static_cast<int>(std::bitset<64>(selection).count());
+      if (popcount == num_bits) {
+        std::memcpy(out + out_length, raw_values + position,
+                    static_cast<size_t>(num_bits) * sizeof(Word));
+      } else {
+        compact_values(raw_values + position, selection, popcount, out + out_length);
+      }
+      out_length += popcount;
+
+      if (some_nulls) {
+        // A selected slot is valid if both the filter and the value are
+        uint64_t validity = indices.ValidityWord(position, num_bits);
+        if (values_bitmap != NULLPTR) {
+          validity &= internal::LoadBitmapWord(values_bitmap, values.offset() + position,
+                                               num_bits);
+        }
+        if (popcount != num_bits) {
+          validity = compact_bits(validity, selection);
+        }
+        const uint64_t validity_bytes = BitUtil::ToLittleEndian(validity);
+        null_bitmap_builder_->UnsafeAppend(
+            reinterpret_cast<const uint8_t*>(&validity_bytes), 0, popcount);
+      }
+    }
+    DCHECK_EQ(out_length, indices.length());
+    if (!some_nulls) {
+      null_bitmap_builder_->UnsafeAppend(out_length, true);
+    }
+    values_builder_->UnsafeAdvance(out_length);
+    return Status::OK();
+  }
+
+  // With nulls only in the indices, the output validity is that of the
+  // indices: all-valid blocks are gathered like null-free indices and all-null
+  // blocks are zeroed.
+  template <typename IndexCType>
+  Status GatherNullIndices(const ArrayData& index_data, const Word* raw_values,
+                           int64_t values_length, bool check_bounds, Word* out) {
+    const IndexCType* raw_indices = index_data.GetValues<IndexCType>(1);
+    const uint8_t* index_bitmap = index_data.buffers[0]->data();
+    const int64_t length = index_data.length;
+    const bool prefetch =
+        values_length * static_cast<int64_t>(sizeof(Word)) >= kTakePrefetchMinBytes;
+    internal::OptionalBitBlockCounter counter(index_bitmap, index_data.offset, length);
+    int64_t position = 0;
+    while (position < length) {
+      const internal::BitBlockCount block = counter.NextBlock();
+      if (block.AllSet()) {
+        if (check_bounds && !TakeIndicesInBounds(raw_indices + position, block.length,
+                                                 values_length)) {
+          return Status::IndexError("take index out of bounds");
+        }
+        GatherTakeValues(raw_values, raw_indices + position, block.length, prefetch,
+                         out + position);
+        null_bitmap_builder_->UnsafeAppend(block.length, true);
+      } else if (block.NoneSet()) {
+        std::fill(out + position, out + position + block.length, Word(0));
+        null_bitmap_builder_->UnsafeAppend(block.length, false);
+      } else {
+        bool out_of_bounds = false;
+        int64_t i = position;
+        null_bitmap_builder_->UnsafeAppend</*count_falses=*/true>(block.length, [&]() {
+          const int64_t slot = i++;
+          out[slot] = Word(0);
+          if (!BitUtil::GetBit(index_bitmap, index_data.offset + slot)) {
+            return false;
+          }
+          const auto index = static_cast<int64_t>(raw_indices[slot]);
+          if (check_bounds && ARROW_PREDICT_FALSE(static_cast<uint64_t>(index) >=
+                                                  static_cast<uint64_t>(values_length))) {
+            out_of_bounds = true;
+            return false;
+          }
+          out[slot] = raw_values[index];
+          return true;
+        });
+        if (out_of_bounds) {
+          return Status::IndexError("take index out of bounds");
+        }
+      }
+      position += block.length;
+    }
+    values_builder_->UnsafeAdvance(length);
+    return Status::OK();
+  }
+
+  std::unique_ptr<TypedBufferBuilder<Word>> values_builder_;
+  std::unique_ptr<TypedBufferBuilder<bool>> null_bitmap_builder_;
+};
+
 // Gathering from NullArrays is trivial; skip the builder and just
 // do bounds checking
 template <typename IndexSequence>
@@ -749,11 +1165,18 @@ class TakerImpl<IndexSequence, ExtensionType> : public Taker<IndexSequence> {
 template <typename IndexSequence>
 struct TakerMakeImpl {
   template <typename T>
-  Status Visit(const T&) {
+  enable_if_t<!is_take_word_type<T>::value, Status> Visit(const T&) {
     out_->reset(new TakerImpl<IndexSequence, T>(type_));
     return (*out_)->Init();
   }
 
+  template <typename T>
+  enable_if_t<is_take_word_type<T>::value, Status> Visit(const T&) {
+    using Word = typename TakeWord<sizeof(typename T::c_type)>::type;
+    out_->reset(new PrimitiveTakerImpl<IndexSequence, Word>(type_));
+    return (*out_)->Init();
+  }
+
   std::shared_ptr<DataType> type_;
   std::unique_ptr<Taker<IndexSequence>>* out_;
 };
@@ -21,8 +21,11 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/take_internal.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -182,6 +185,50 @@ TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumericIndexTypes) {
+  using CType = typename TypeParam::c_type;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  // Enough values for them to be prefetched, and indices over several blocks
+  const int64_t length = kTakePrefetchMinBytes / static_cast<int64_t>(sizeof(CType)) + 3;
+  const int64_t indices_length = 3 * kTakeBlockSize + 5;
+
+  for (auto values_null_probability : {0.0, 0.1}) {
+    auto values =
+        rand.Numeric<TypeParam>(length + 1, 0, 127, values_null_probability)->Slice(1);
+    for (auto indices_null_probability : {0.0, 0.1}) {
+      auto indices = checked_pointer_cast<Int64Array>(
+          rand.Int64(indices_length + 2, 0, length - 1, indices_null_probability)
+              ->Slice(2));
+      for (auto index_type : {int64(), int32(), uint32()}) {
+        std::shared_ptr<Array> cast_indices, taken;
+        ASSERT_OK(Cast(&this->ctx_, *indices, index_type, CastOptions(), &cast_indices));
+        ASSERT_OK(arrow::compute::Take(&this->ctx_, *values, *cast_indices,
+                                       TakeOptions(), &taken));
+        ASSERT_OK(taken->ValidateFull());
+        ASSERT_EQ(indices_length, taken->length());
+        for (int64_t i = 0; i < indices_length; ++i) {
+          if (indices->IsNull(i)) {
+            ASSERT_TRUE(taken->IsNull(i));
+            continue;
+          }
+          const int64_t index = indices->Value(i);
+          ASSERT_TRUE(values->RangeEquals(index, index + 1, i, taken));
+        }
+
+        // An out of bounds index in the last block
+        std::shared_ptr<Array> out_of_bounds;
+        ASSERT_OK(Concatenate({indices, rand.Int64(1, length, length, 0)},
+                              default_memory_pool(), &out_of_bounds));
+        ASSERT_OK(Cast(&this->ctx_, *out_of_bounds, index_type, CastOptions(),
+                       &cast_indices));
+        ASSERT_RAISES(IndexError, arrow::compute::Take(&this->ctx_, *values,
+                                                       *cast_indices, TakeOptions(),
+                                                       &taken));
+      }
+    }
+  }
+}
+
 using StringTypes =
     ::testing::Types<BinaryType, StringType, LargeBinaryType, LargeStringType>;
 
@@ -696,5 +743,42 @@ TEST_F(TestTakeKernelWithTable, TakeTable) {
   this->AssertChunkedTake(schm, table_json, {"[0, 1]", "[2, 3]"}, table_json);
 }
 
+TEST_F(TestTakeKernelWithTable, TakeTableUseThreads) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < 16; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int32()));
+    columns.push_back(std::make_shared<ChunkedArray>(
+        ArrayVector{rand.Int32(100, -100, 100, 0.1), rand.Int32(200, -100, 100, 0.1)}));
+  }
+  auto table = Table::Make(schema(fields), columns);
+  auto indices = std::make_shared<ChunkedArray>(
+      ArrayVector{rand.Int32(50, 0, 299, 0.1), rand.Int32(0, 0, 299, 0),
+                  rand.Int32(70, 0, 299, 0)});
+
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(arrow::compute::Take(&ctx_, *table, *indices, TakeOptions(), &expected));
+  std::shared_ptr<ChunkedArray> expected_column, actual_column;
+  ASSERT_OK(arrow::compute::Take(&ctx_, *table->column(0), *indices, TakeOptions(),
+                                 &expected_column));
+
+  // Columns of a table, and indices chunks of a single column, are taken in
+  // parallel
+  ctx_.set_use_threads(true);
+  ASSERT_OK(arrow::compute::Take(&ctx_, *table, *indices, TakeOptions(), &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+  ASSERT_OK(arrow::compute::Take(&ctx_, *table->column(0), *indices, TakeOptions(),
+                                 &actual_column));
+  ASSERT_OK(actual_column->ValidateFull());
+  AssertChunkedEqual(*expected_column, *actual_column);
+
+  // Errors are propagated from the parallel tasks
+  ASSERT_RAISES(IndexError,
+                arrow::compute::Take(&ctx_, *table, *rand.Int32(10, 300, 400, 0),
+                                     TakeOptions(), &actual));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -24,11 +24,14 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/extension_type.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/tracing.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -47,6 +50,7 @@ inline void ZeroLastByte(Buffer* buffer) {
   *(buffer->mutable_data() + (buffer->size() - 1)) = 0;
 }
 
+// A mutable buffer already in *buffer is reused if large enough
 Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t length,
                            std::shared_ptr<Buffer>* buffer) {
   if (type.id() != Type::NA) {
@@ -62,13 +66,16 @@ Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t l
           << "Only bit widths with multiple of 8 are currently supported";
       buffer_size = length * fw_type.bit_width() / 8;
     }
-    RETURN_NOT_OK(ctx->Allocate(buffer_size, buffer));
+    if (*buffer == nullptr || !(*buffer)->is_mutable() ||
+        (*buffer)->size() < buffer_size) {
+      RETURN_NOT_OK(ctx->Allocate(buffer_size, buffer));
+    }
 
     if (bit_width == 1 && buffer_size > 0) {
       // Some utility methods access the last byte before it might be
       // initialized this makes valgrind/asan unhappy, so we proactively
       // zero it.
-      ZeroLastByte(buffer->get());
+      (*buffer)->mutable_data()[buffer_size - 1] = 0;
     }
   }
   return Status::OK();
@@ -78,6 +85,7 @@ Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t l
 
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs) {
+  ARROW_TRACE_SPAN("compute", "UnaryKernel");
   if (value.kind() == Datum::ARRAY) {
     Datum out;
     out.value = ArrayData::Make(kernel->out_type(), value.array()->length);
@@ -100,6 +108,7 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
                                std::vector<Datum>* outputs) {
+  ARROW_TRACE_SPAN("compute", "BinaryKernel");
   int64_t left_length;
   std::vector<std::shared_ptr<Array>> left_arrays;
   if (left.kind() == Datum::ARRAY) {
@@ -205,6 +214,29 @@ Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums) {
   }
 }
 
+Datum ExtensionStorage(const Datum& value) {
+  const auto& ext_type = checked_cast<const ExtensionType&>(*value.type());
+  if (value.kind() == Datum::ARRAY) {
+    auto storage = value.array()->Copy();
+    storage->type = ext_type.storage_type();
+    return Datum(storage);
+  }
+  DCHECK_EQ(Datum::CHUNKED_ARRAY, value.kind());
+  ArrayVector storage_chunks;
+  for (const auto& chunk : value.chunked_array()->chunks()) {
+    storage_chunks.push_back(checked_cast<const ExtensionArray&>(*chunk).storage());
+  }
+  return Datum(
+      std::make_shared<ChunkedArray>(std::move(storage_chunks), ext_type.storage_type()));
+}
+
+std::shared_ptr<Array> WrapExtension(const std::shared_ptr<DataType>& type,
+                                     const std::shared_ptr<Array>& storage) {
+  auto data = storage->data()->Copy();
+  data->type = type;
+  return MakeArray(data);
+}
+
 PrimitiveAllocatingUnaryKernel::PrimitiveAllocatingUnaryKernel(UnaryKernel* delegate)
     : delegate_(delegate) {}
 
@@ -286,6 +318,20 @@ Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
   return Status::OK();
 }
 
+Status ParallelForEach(FunctionContext* ctx, int num_tasks,
+                       const std::function<Status(FunctionContext*, int)>& func) {
+  if (!ctx->use_threads() || num_tasks <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(ctx, i));
+    }
+    return Status::OK();
+  }
+  return ::arrow::internal::ParallelFor(num_tasks, [&](int i) {
+    FunctionContext task_ctx(ctx->memory_pool());
+    return func(&task_ctx, i);
+  });
+}
+
 Status PrimitiveAllocatingUnaryKernel::Call(FunctionContext* ctx, const Datum& input,
                                             Datum* out) {
   DCHECK_EQ(out->kind(), Datum::ARRAY);
@@ -18,6 +18,7 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -103,6 +104,16 @@ ARROW_EXPORT
 Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
                               const ArrayData& right, ArrayData* output);
 
+/// \brief Call func(task_ctx, i) for every i in [0, num_tasks), in parallel
+/// on the CPU thread pool if ctx->use_threads()
+///
+/// Parallel tasks are given their own FunctionContext on the same memory pool,
+/// without threads, so that nested parallel kernels run serially inside them.
+/// When running serially, func is called with ctx itself.
+ARROW_EXPORT
+Status ParallelForEach(FunctionContext* ctx, int num_tasks,
+                       const std::function<Status(FunctionContext*, int)>& func);
+
 ARROW_EXPORT
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays);
@@ -110,9 +121,24 @@ Datum WrapArraysLike(const Datum& value,
 ARROW_EXPORT
 Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums);
 
+/// \brief Return an extension array or chunked array as its storage, without
+/// copying, so that kernels preserving the layout can run on the storage
+ARROW_EXPORT
+Datum ExtensionStorage(const Datum& value);
+
+/// \brief Give an array computed from extension storage the extension type
+/// back, without copying
+ARROW_EXPORT
+std::shared_ptr<Array> WrapExtension(const std::shared_ptr<DataType>& type,
+                                     const std::shared_ptr<Array>& storage);
+
 /// \brief Kernel used to preallocate outputs for primitive types. This
 /// does not include allocations for the validity bitmap (PropagateNulls
 /// should be used for that).
+///
+/// A mutable data buffer already set in the output ArrayData is written into
+/// instead if it is large enough, e.g. to reuse the output buffer of the
+/// previous batch of a stream.
 class ARROW_EXPORT PrimitiveAllocatingUnaryKernel : public UnaryKernel {
  public:
   // \brief Construct with a delegate that must live longer
@@ -128,7 +154,8 @@ class ARROW_EXPORT PrimitiveAllocatingUnaryKernel : public UnaryKernel {
   UnaryKernel* delegate_;
 };
 
-/// \brief Kernel used to preallocate outputs for primitive types.
+/// \brief Kernel used to preallocate outputs for primitive types, see
+/// PrimitiveAllocatingUnaryKernel.
 class ARROW_EXPORT PrimitiveAllocatingBinaryKernel : public BinaryKernel {
  public:
   // \brief Construct with a kernel to delegate operations to.
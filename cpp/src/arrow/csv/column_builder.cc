@@ -35,6 +35,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string_builder.h"
 #include "arrow/util/task_group.h"
 
 namespace arrow {
@@ -226,6 +227,8 @@ class InferringColumnBuilder : public ColumnBuilder {
 
  protected:
   Status LoosenType(const Status& conversion_error);
+  // Lock in the type if all sample chunks are converted
+  void MaybeLockType(std::unique_lock<std::mutex>* lock);
   Status UpdateType();
   Status TryConvertChunk(size_t chunk_index);
   // This must be called unlocked!
@@ -257,6 +260,11 @@ class InferringColumnBuilder : public ColumnBuilder {
   InferKind infer_kind_;
   bool can_loosen_type_;
 
+  // Whether the type was decided from the first options_.inference_blocks chunks
+  bool type_locked_ = false;
+  // Chunks inserted while the sample chunks were still being inferred
+  std::vector<size_t> deferred_chunks_;
+
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
 };
@@ -330,7 +338,7 @@ Status InferringColumnBuilder::UpdateType() {
     return Status::OK();
   };
 
-  can_loosen_type_ = true;
+  can_loosen_type_ = !type_locked_;
 
   switch (infer_kind_) {
     case InferKind::Null:
@@ -387,6 +395,8 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
     if (!can_loosen_type_) {
       // We won't try to reconvert anymore
       parsers_[chunk_index].reset();
+    } else if (static_cast<int64_t>(chunk_index) < options_.inference_blocks) {
+      MaybeLockType(&lock);
     }
     return Status::OK();
   } else if (can_loosen_type_) {
@@ -412,12 +422,43 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
     ScheduleConvertChunk(chunk_index);
 
     return Status::OK();
+  } else if (type_locked_) {
+    return maybe_array.status().WithMessage(util::StringBuilder(
+        maybe_array.status().message(), " (column type was inferred from the first ",
+        options_.inference_blocks, " blocks)"));
   } else {
     // Conversion failed but cannot loosen more
     return maybe_array.status();
   }
 }
 
+void InferringColumnBuilder::MaybeLockType(std::unique_lock<std::mutex>* lock) {
+  // We are locked
+  const auto num_samples = static_cast<size_t>(options_.inference_blocks);
+  if (chunks_.size() < num_samples) {
+    return;
+  }
+  for (size_t i = 0; i < num_samples; ++i) {
+    if (chunks_[i] == nullptr) {
+      // Still converting
+      return;
+    }
+  }
+  // All sample chunks converted to the current type: lock it in
+  type_locked_ = true;
+  can_loosen_type_ = false;
+  for (size_t i = 0; i < num_samples; ++i) {
+    parsers_[i].reset();
+  }
+  auto deferred_chunks = std::move(deferred_chunks_);
+  deferred_chunks_.clear();
+  lock->unlock();
+  for (const auto chunk_index : deferred_chunks) {
+    ScheduleConvertChunk(chunk_index);
+  }
+  lock->lock();
+}
+
 void InferringColumnBuilder::Insert(int64_t block_index,
                                     const std::shared_ptr<BlockParser>& parser) {
   // Create a slot for the new chunk and spawn a task to convert it
@@ -435,6 +476,13 @@ void InferringColumnBuilder::Insert(int64_t block_index,
     // Should not insert an already converting chunk
     DCHECK_EQ(parsers_[chunk_index], nullptr);
     parsers_[chunk_index] = parser;
+
+    if (options_.inference_blocks > 0 && !type_locked_ &&
+        block_index >= options_.inference_blocks) {
+      // Wait for the type to be decided from the sample chunks
+      deferred_chunks_.push_back(chunk_index);
+      return;
+    }
   }
 
   ScheduleConvertChunk(chunk_index);
@@ -424,6 +424,33 @@ TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   CheckInferred(tg, {{"1", "2"}, {"3"}, {"4", "5"}, {"6", "7"}}, options, expected);
 }
 
+TEST(InferringColumnBuilder, InferenceBlocks) {
+  auto options = ConvertOptions::Defaults();
+  options.inference_blocks = 2;
+  std::shared_ptr<ChunkedArray> expected;
+
+  // Type is inferred from the first two chunks, later ones are converted to it
+  ChunkedArrayFromVector<DoubleType>({{1, 2}, {3.5}, {4}, {5}}, &expected);
+  for (auto tg : {TaskGroup::MakeSerial(), TaskGroup::MakeThreaded(GetCpuThreadPool())}) {
+    CheckInferred(tg, {{"1", "2"}, {"3.5"}, {"4"}, {"5"}}, options, expected);
+  }
+
+  // Fewer chunks than inference blocks
+  ChunkedArrayFromVector<Int64Type>({{1}}, &expected);
+  CheckInferred(TaskGroup::MakeSerial(), {{"1"}}, options, expected);
+
+  // Later chunks cannot loosen the type
+  auto tg = TaskGroup::MakeSerial();
+  ASSERT_OK_AND_ASSIGN(auto builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options, tg));
+  for (const auto& chunk : ChunkData{{"1"}, {"2"}, {"3.5"}}) {
+    std::shared_ptr<BlockParser> parser;
+    MakeColumnParser(chunk, &parser);
+    builder->Append(parser);
+  }
+  ASSERT_RAISES(Invalid, tg->Finish());
+}
+
 void CheckAutoDictEncoded(const std::shared_ptr<TaskGroup>& tg, const ChunkData& csv_data,
                           const ConvertOptions& options,
                           std::vector<std::shared_ptr<Array>> expected_indices,
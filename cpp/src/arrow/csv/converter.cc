@@ -24,12 +24,16 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/csv/parser.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/trie.h"
@@ -38,6 +42,7 @@
 namespace arrow {
 namespace csv {
 
+using internal::checked_cast;
 using internal::StringConverter;
 using internal::Trie;
 using internal::TrieBuilder;
@@ -161,27 +166,45 @@ class BinaryConverter : public ConcreteConverter {
 
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
-    using BuilderType = typename TypeTraits<T>::BuilderType;
-    BuilderType builder(pool_);
+    using offset_type = typename T::offset_type;
+    const int64_t num_rows = parser.num_rows();
+
+    // First pass: compute offsets, checking whether
+    // the values lie contiguously in the parser's buffer
+    TypedBufferBuilder<offset_type> offsets_builder(pool_);
+    TypedBufferBuilder<bool> validity_builder(pool_);
+    RETURN_NOT_OK(offsets_builder.Reserve(num_rows + 1));
+    if (options_.strings_can_be_null) {
+      RETURN_NOT_OK(validity_builder.Reserve(num_rows));
+    }
+    offset_type data_size = 0;
+    offsets_builder.UnsafeAppend(data_size);
+    const uint8_t* first_data = nullptr;
+    const uint8_t* next_data = nullptr;
+    bool contiguous = true;
 
     auto visit_non_null = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
-        return Status::Invalid("CSV conversion error to ", type_->ToString(),
-                               ": invalid UTF8 data");
+      if (first_data == nullptr) {
+        first_data = data;
+      } else if (data != next_data) {
+        contiguous = false;
       }
-      builder.UnsafeAppend(data, size);
+      next_data = data + size;
+      data_size += static_cast<offset_type>(size);
+      offsets_builder.UnsafeAppend(data_size);
       return Status::OK();
     };
 
-    RETURN_NOT_OK(builder.Resize(parser.num_rows()));
-    RETURN_NOT_OK(builder.ReserveData(parser.num_bytes()));
-
     if (options_.strings_can_be_null) {
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
         if (IsNull(data, size, false /* quoted */)) {
-          builder.UnsafeAppendNull();
+          // Null slots are empty, so skipping a null spelling breaks contiguity
+          contiguous = contiguous && size == 0;
+          offsets_builder.UnsafeAppend(data_size);
+          validity_builder.UnsafeAppend(false);
           return Status::OK();
         } else {
+          validity_builder.UnsafeAppend(true);
           return visit_non_null(data, size, quoted);
         }
       };
@@ -190,9 +213,41 @@ class BinaryConverter : public ConcreteConverter {
       RETURN_NOT_OK(parser.VisitColumn(col_index, visit_non_null));
     }
 
-    std::shared_ptr<Array> res;
-    RETURN_NOT_OK(builder.Finish(&res));
-    return res;
+    std::shared_ptr<Buffer> offsets, data, validity;
+    RETURN_NOT_OK(offsets_builder.Finish(&offsets));
+    const int64_t null_count = validity_builder.false_count();
+    if (null_count > 0) {
+      RETURN_NOT_OK(validity_builder.Finish(&validity));
+    }
+
+    if (first_data != nullptr && contiguous) {
+      // Zero-copy: the values are a slice of the parser's buffer
+      const auto& parsed_buffer = parser.parsed_buffer();
+      data = SliceBuffer(parsed_buffer, first_data - parsed_buffer->data(), data_size);
+    } else {
+      // Second pass: copy the values, now that their total size is known
+      RETURN_NOT_OK(AllocateBuffer(pool_, data_size, &data));
+      auto out_data = data->mutable_data();
+      const auto out_offsets = reinterpret_cast<const offset_type*>(offsets->data());
+      int64_t i = 0;
+      auto copy = [&](const uint8_t* value, uint32_t size, bool quoted) -> Status {
+        memcpy(out_data + out_offsets[i], value, out_offsets[i + 1] - out_offsets[i]);
+        ++i;
+        return Status::OK();
+      };
+      RETURN_NOT_OK(parser.VisitColumn(col_index, copy));
+    }
+
+    // Validate all the values at once, which is faster than one by one
+    // (null slots are empty)
+    const auto raw_offsets = reinterpret_cast<const offset_type*>(offsets->data());
+    if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8Values(
+                         data->data(), raw_offsets, num_rows))) {
+      return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                             ": invalid UTF8 data");
+    }
+    return MakeArray(ArrayData::Make(type_, num_rows, {validity, offsets, data},
+                                     null_count));
   }
 
  protected:
@@ -214,10 +269,6 @@ class DictionaryBinaryConverter : public ConcreteDictionaryConverter {
     BuilderType builder(type_, pool_);
 
     auto visit_non_null = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
-        return Status::Invalid("CSV conversion error to ", type_->ToString(),
-                               ": invalid UTF8 data");
-      }
       RETURN_NOT_OK(
           builder.Append(util::string_view(reinterpret_cast<const char*>(data), size)));
       if (ARROW_PREDICT_FALSE(builder.dictionary_length() > max_cardinality_)) {
@@ -243,6 +294,17 @@ class DictionaryBinaryConverter : public ConcreteDictionaryConverter {
 
     std::shared_ptr<Array> res;
     RETURN_NOT_OK(builder.Finish(&res));
+    if (CheckUTF8) {
+      // Only validate the distinct values, all at once
+      const auto& dictionary = checked_cast<const typename TypeTraits<T>::ArrayType&>(
+          *checked_cast<const DictionaryArray&>(*res).dictionary());
+      if (ARROW_PREDICT_FALSE(!util::ValidateUTF8Values(dictionary.value_data()->data(),
+                                                        dictionary.raw_value_offsets(),
+                                                        dictionary.length()))) {
+        return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                               ": invalid UTF8 data");
+      }
+    }
     return res;
   }
 
@@ -424,7 +486,11 @@ class DecimalConverter : public ConcreteConverter {
   Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
                                          int32_t col_index) override {
     Decimal128Builder builder(type_, pool_);
+    const auto& type = internal::checked_cast<const DecimalType&>(*type_);
+    const int32_t type_precision = type.precision();
+    const int32_t type_scale = type.scale();
 
+    // The values are parsed straight into the builder's preallocated data
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       if (IsNull(data, size, quoted)) {
         builder.UnsafeAppendNull();
@@ -435,18 +501,14 @@ class DecimalConverter : public ConcreteConverter {
       int32_t precision, scale;
       util::string_view view(reinterpret_cast<const char*>(data), size);
       RETURN_NOT_OK(Decimal128::FromString(view, &decimal, &precision, &scale));
-      DecimalType& type = *internal::checked_cast<DecimalType*>(type_.get());
-      if (precision > type.precision()) {
+      if (ARROW_PREDICT_FALSE(precision > type_precision)) {
         return Status::Invalid("Error converting ", view, " to ", type_->ToString(),
                                " precision not supported by type.");
       }
-      if (scale != type.scale()) {
-        Decimal128 scaled;
-        ARROW_ASSIGN_OR_RAISE(scaled, decimal.Rescale(scale, type.scale()));
-        builder.UnsafeAppend(scaled);
-      } else {
-        builder.UnsafeAppend(decimal);
+      if (scale != type_scale) {
+        ARROW_ASSIGN_OR_RAISE(decimal, decimal.Rescale(scale, type_scale));
       }
+      builder.UnsafeAppend(decimal);
       return Status::OK();
     };
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
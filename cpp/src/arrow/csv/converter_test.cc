@@ -211,6 +211,36 @@ TEST(StringConversion, Nulls) {
                                             {{true, false}, {false, false}}, options);
 }
 
+TEST(StringConversion, ZeroCopy) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Array> array, expected_array;
+  std::shared_ptr<Converter> converter;
+  ASSERT_OK_AND_ASSIGN(converter, Converter::Make(utf8(), ConvertOptions::Defaults()));
+
+  // The values of a single column are contiguous in the parser's buffer
+  MakeCSVParser({"ab\n", "\"\"\n", "cdé\n"}, &parser);
+  ASSERT_OK_AND_ASSIGN(array, converter->Convert(*parser, 0));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<StringType, std::string>({"ab", "", "cdé"}, &expected_array);
+  AssertArraysEqual(*expected_array, *array);
+  const auto& data = internal::checked_cast<const StringArray&>(*array).value_data();
+  const auto& parsed = parser->parsed_buffer();
+  ASSERT_GE(data->data(), parsed->data());
+  ASSERT_LE(data->data() + data->size(), parsed->data() + parsed->size());
+
+  // Non-empty null spellings are skipped, so the values are copied
+  auto options = ConvertOptions::Defaults();
+  options.strings_can_be_null = true;
+  ASSERT_OK_AND_ASSIGN(converter, Converter::Make(utf8(), options));
+  MakeCSVParser({"ab\n", "NA\n", "cdé\n"}, &parser);
+  ASSERT_OK_AND_ASSIGN(array, converter->Convert(*parser, 0));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<StringType, std::string>({true, false, true}, {"ab", "", "cdé"},
+                                           &expected_array);
+  AssertArraysEqual(*expected_array, *array);
+  ASSERT_EQ(6, internal::checked_cast<const StringArray&>(*array).value_data()->size());
+}
+
 template <typename T>
 static void TestStringConversionErrors() {
   auto type = TypeTraits<T>::type_singleton();
@@ -88,6 +88,14 @@ struct ARROW_EXPORT ConvertOptions {
   bool auto_dict_encode = false;
   int32_t auto_dict_max_cardinality = 50;
 
+  /// If positive, the types of inferred columns are decided from the first
+  /// `inference_blocks` blocks of the file; the following blocks are converted
+  /// to those types, and error out if they don't fit.
+  /// If 0, types are inferred from all blocks: a late type promotion then
+  /// requires reconverting all blocks already converted.
+  /// StreamingReader infers from at least one block.
+  int32_t inference_blocks = 0;
+
   // XXX Should we have a separate FilterOptions?
 
   /// If non-empty, indicates the names of columns from the CSV file that should
@@ -125,10 +133,35 @@ struct ARROW_EXPORT ReadOptions {
   /// If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  /// If positive, merge consecutive chunks of the resulting table into chunks
+  /// of up to this many rows (see Table::CoalesceChunks); chunks are kept as
+  /// parsed if both coalescing targets are 0
+  int64_t coalesce_target_rows = 0;
+  /// If positive, merge consecutive chunks of the resulting table into chunks
+  /// of up to this many bytes
+  int64_t coalesce_target_bytes = 0;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write a first row of the column names
+  bool include_header = true;
+  /// Field delimiter
+  char delimiter = ',';
+  /// The number of rows of a table formatted at once
+  int32_t batch_size = 1 << 14;
+  /// Whether to format the columns and rows of each batch on the global CPU
+  /// thread pool
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
 
@@ -24,7 +24,9 @@
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
 
 namespace arrow {
 namespace csv {
@@ -74,13 +76,154 @@ class SpecializedOptions {
   static constexpr bool escaping = Escaping;
 };
 
+// Vectorized scanning of field contents.  Runs of plain characters, which can
+// neither end a field nor alter its contents, are copied in bulk instead of
+// going through the parsing state machine.  Only full vectors are examined: the
+// state machine handles the remaining bytes.  Whole vectors are stored, so the
+// destination must have room for one past the run.
+
+#if defined(ARROW_HAVE_AVX2)
+
+using SimdBytes = __m256i;
+
+static inline SimdBytes SimdLoad(const char* data) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+static inline void SimdStore(uint8_t* out, SimdBytes a) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), a);
+}
+static inline SimdBytes SimdBroadcast(char c) { return _mm256_set1_epi8(c); }
+static inline SimdBytes SimdEqual(SimdBytes a, SimdBytes b) {
+  return _mm256_cmpeq_epi8(a, b);
+}
+static inline SimdBytes SimdOr(SimdBytes a, SimdBytes b) { return _mm256_or_si256(a, b); }
+static inline SimdBytes SimdMaxUnsigned(SimdBytes a, SimdBytes b) {
+  return _mm256_max_epu8(a, b);
+}
+static inline uint32_t SimdMask(SimdBytes a) {
+  return static_cast<uint32_t>(_mm256_movemask_epi8(a));
+}
+
+#elif defined(ARROW_HAVE_SSE2)
+
+using SimdBytes = __m128i;
+
+static inline SimdBytes SimdLoad(const char* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+static inline void SimdStore(uint8_t* out, SimdBytes a) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), a);
+}
+static inline SimdBytes SimdBroadcast(char c) { return _mm_set1_epi8(c); }
+static inline SimdBytes SimdEqual(SimdBytes a, SimdBytes b) {
+  return _mm_cmpeq_epi8(a, b);
+}
+static inline SimdBytes SimdOr(SimdBytes a, SimdBytes b) { return _mm_or_si128(a, b); }
+static inline SimdBytes SimdMaxUnsigned(SimdBytes a, SimdBytes b) {
+  return _mm_max_epu8(a, b);
+}
+static inline uint32_t SimdMask(SimdBytes a) {
+  return static_cast<uint32_t>(_mm_movemask_epi8(a));
+}
+
+#endif
+
+#if defined(ARROW_HAVE_AVX2) || defined(ARROW_HAVE_SSE2)
+
+template <typename SpecializedOptions>
+class FieldScanner {
+ public:
+  explicit FieldScanner(const ParseOptions& options)
+      : delimiter_(SimdBroadcast(options.delimiter)),
+        quote_char_(SimdBroadcast(options.quote_char)),
+        escape_char_(SimdBroadcast(options.escape_char)),
+        last_control_char_(SimdBroadcast(' ' - 1)) {}
+
+  static constexpr uint32_t kVectorSize = sizeof(SimdBytes);
+
+  // Whether to scan after `scalar_run` plain characters went through the
+  // state machine.  Vectors only pay off on long fields, so short ones are
+  // left to the state machine.
+  bool ShouldScan(uint32_t scalar_run) const { return scalar_run >= kMinScalarRun; }
+
+  // Copy the run of plain characters in a non-quoted part of a field to `out`,
+  // return its length
+  uint32_t CopyUnquotedRun(const char* data, const char* data_end, uint8_t* out) const {
+    return CopyRun(data, data_end, out, [this](SimdBytes bytes) {
+      // Control characters are those not above ' ' - 1 as unsigned bytes
+      auto special = SimdOr(
+          SimdEqual(bytes, delimiter_),
+          SimdEqual(SimdMaxUnsigned(bytes, last_control_char_), last_control_char_));
+      if (SpecializedOptions::escaping) {
+        special = SimdOr(special, SimdEqual(bytes, escape_char_));
+      }
+      return special;
+    });
+  }
+
+  // Copy the run of plain characters in a quoted part of a field to `out`,
+  // return its length
+  uint32_t CopyQuotedRun(const char* data, const char* data_end, uint8_t* out) const {
+    return CopyRun(data, data_end, out, [this](SimdBytes bytes) {
+      auto special = SimdEqual(bytes, quote_char_);
+      if (SpecializedOptions::escaping) {
+        special = SimdOr(special, SimdEqual(bytes, escape_char_));
+      }
+      return special;
+    });
+  }
+
+ protected:
+  template <typename ClassifyFunc>
+  uint32_t CopyRun(const char* data, const char* data_end, uint8_t* out,
+                   ClassifyFunc&& classify) const {
+    uint32_t run = 0;
+    while (data_end - data >= static_cast<int64_t>(kVectorSize)) {
+      const SimdBytes bytes = SimdLoad(data);
+      SimdStore(out + run, bytes);
+      const uint32_t mask = SimdMask(classify(bytes));
+      if (mask != 0) {
+        return run + BitUtil::CountTrailingZeros(mask);
+      }
+      run += kVectorSize;
+      data += kVectorSize;
+    }
+    return run;
+  }
+
+  static constexpr uint32_t kMinScalarRun = 4;
+
+  const SimdBytes delimiter_;
+  const SimdBytes quote_char_;
+  const SimdBytes escape_char_;
+  const SimdBytes last_control_char_;
+};
+
+#else
+
+// No vectorization: the state machine processes all characters
+template <typename SpecializedOptions>
+class FieldScanner {
+ public:
+  explicit FieldScanner(const ParseOptions&) {}
+
+  bool ShouldScan(uint32_t) const { return false; }
+
+  uint32_t CopyUnquotedRun(const char*, const char*, uint8_t*) const { return 0; }
+  uint32_t CopyQuotedRun(const char*, const char*, uint8_t*) const { return 0; }
+};
+
+#endif
+
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    ARROW_CHECK_OK(AllocateResizableBuffer(pool, parsed_capacity_, &parsed_buffer_));
+    // Leave room for the whole vectors stored by FieldScanner
+    ARROW_CHECK_OK(AllocateResizableBuffer(pool, parsed_capacity_ + kMaxVectorSize,
+                                           &parsed_buffer_));
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -96,9 +239,23 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Bulk writing of field characters: write at most kMaxVectorSize bytes past
+  // the current size, then push the first `size` ones
+  uint8_t* parsed_end() { return parsed_ + parsed_size_; }
+
+  void PushFieldChars(uint32_t size) {
+    DCHECK_LE(parsed_size_ + size, parsed_capacity_);
+    parsed_size_ += size;
+  }
+
+  static constexpr uint32_t kMaxVectorSize = 32;
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
+  // Drop the characters pushed since the size was `size`
+  void Truncate(int64_t size) { parsed_size_ = size; }
+
   int64_t size() { return parsed_size_; }
 
  protected:
@@ -222,7 +379,23 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
   DCHECK_GT(data_end, data);
 
-  auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+  // Size of the parsed values at the start of the current field
+  int64_t field_start = 0;
+
+  auto FinishField = [&]() {
+    if (ARROW_PREDICT_TRUE(stored_positions_.empty()) ||
+        (num_cols < static_cast<int32_t>(stored_positions_.size()) &&
+         stored_positions_[num_cols] >= 0)) {
+      values_writer->FinishField(parsed_writer);
+    } else {
+      // Not a stored column
+      parsed_writer->Truncate(field_start);
+    }
+  };
+  const FieldScanner<SpecializedOptions> scanner(options_);
+
+  // Number of plain characters seen in a row by the state machine
+  uint32_t scalar_run = 0;
 
   values_writer->BeginLine();
   parsed_writer->BeginLine();
@@ -247,6 +420,8 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
 FieldStart:
   // At the start of a field
+  scalar_run = 0;
+  field_start = parsed_writer->size();
   // Quoting is only recognized at start of field
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
@@ -259,6 +434,13 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+  if (scanner.ShouldScan(scalar_run)) {
+    const uint32_t run =
+        scanner.CopyUnquotedRun(data, data_end, parsed_writer->parsed_end());
+    parsed_writer->PushFieldChars(run);
+    data += run;
+    scalar_run = 0;
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -287,10 +469,18 @@ InField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  ++scalar_run;
   goto InField;
 
 InQuotedField:
   // Inside a quoted part of a field
+  if (scanner.ShouldScan(scalar_run)) {
+    const uint32_t run =
+        scanner.CopyQuotedRun(data, data_end, parsed_writer->parsed_end());
+    parsed_writer->PushFieldChars(run);
+    data += run;
+    scalar_run = 0;
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -314,6 +504,7 @@ InQuotedField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  ++scalar_run;
   goto InQuotedField;
 
 FieldEnd:
@@ -366,9 +557,9 @@ EmptyLine:
       num_cols_ = 1;
     }
     // Record as row of empty (null?) values
-    while (num_cols++ < num_cols_) {
+    for (int32_t i = 0; i < num_stored_cols(); ++i) {
       values_writer->StartField(false /* quoted */);
-      FinishField();
+      values_writer->FinishField(parsed_writer);
     }
     ++num_rows_;
   }
@@ -453,14 +644,15 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
 
       int32_t rows_in_chunk;
       constexpr int32_t kTargetChunkSize = 32768;
-      if (num_cols_ > 0) {
-        rows_in_chunk = std::min(std::max(kTargetChunkSize / num_cols_, 512),
+      const int32_t num_stored_cols = this->num_stored_cols();
+      if (num_stored_cols > 0) {
+        rows_in_chunk = std::min(std::max(kTargetChunkSize / num_stored_cols, 512),
                                  max_num_rows_ - num_rows_);
       } else {
         rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - num_rows_);
       }
 
-      PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
+      PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_stored_cols);
       values_writer.Start(parsed_writer);
 
       RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
@@ -481,7 +673,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   parsed_size_ = static_cast<int32_t>(parsed_buffer_->size());
   parsed_ = parsed_buffer_->data();
 
-  DCHECK_EQ(values_size_, num_rows_ * num_cols_);
+  DCHECK_EQ(values_size_, num_rows_ * num_stored_cols());
   if (num_cols_ == -1) {
     DCHECK_EQ(num_rows_, 0);
   }
@@ -546,7 +738,18 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_col
       options_(options),
       num_rows_(-1),
       num_cols_(num_cols),
-      max_num_rows_(max_num_rows) {}
+      max_num_rows_(max_num_rows),
+      num_stored_cols_(0) {}
+
+BlockParser::BlockParser(MemoryPool* pool, ParseOptions options,
+                         std::vector<bool> stored_columns, int32_t max_num_rows)
+    : BlockParser(pool, options, static_cast<int32_t>(stored_columns.size()),
+                  max_num_rows) {
+  stored_positions_.reserve(stored_columns.size());
+  for (const bool stored : stored_columns) {
+    stored_positions_.push_back(stored ? num_stored_cols_++ : -1);
+  }
+}
 
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int32_t max_num_rows)
     : BlockParser(default_memory_pool(), options, num_cols, max_num_rows) {}
@@ -62,6 +62,13 @@ class ARROW_EXPORT BlockParser {
                        int32_t max_num_rows = kMaxParserNumRows);
   explicit BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols = -1,
                        int32_t max_num_rows = kMaxParserNumRows);
+  /// \brief Create a parser storing the values of some columns only
+  ///
+  /// `stored_columns` tells, for each of the CSV columns, whether to store its
+  /// values.  The fields of the other columns are delimited but not stored,
+  /// and cannot be visited.
+  BlockParser(MemoryPool* pool, ParseOptions options, std::vector<bool> stored_columns,
+              int32_t max_num_rows = kMaxParserNumRows);
 
   /// \brief Parse a block of data
   ///
@@ -91,6 +98,14 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols() const { return num_cols_; }
   /// \brief Return the total size in bytes of parsed data
   uint32_t num_bytes() const { return parsed_size_; }
+  /// \brief Return the buffer holding the parsed data
+  ///
+  /// The values passed to visitors point into this buffer.
+  const std::shared_ptr<Buffer>& parsed_buffer() const { return parsed_buffer_; }
+  /// \brief Return whether the values of a column are stored
+  bool is_stored(int32_t col_index) const {
+    return stored_positions_.empty() || stored_positions_[col_index] >= 0;
+  }
 
   /// \brief Visit parsed values in a column
   ///
@@ -98,12 +113,15 @@ class ARROW_EXPORT BlockParser {
   /// Status(const uint8_t* data, uint32_t size, bool quoted)
   template <typename Visitor>
   Status VisitColumn(int32_t col_index, Visitor&& visit) const {
+    const int32_t first_pos =
+        stored_positions_.empty() ? col_index : stored_positions_[col_index];
+    const int32_t num_stored_cols = this->num_stored_cols();
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_) {
+      for (int32_t pos = first_pos; pos < max_pos; pos += num_stored_cols) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -113,13 +131,16 @@ class ARROW_EXPORT BlockParser {
     return Status::OK();
   }
 
+  /// \brief Visit the stored values of the last row
   template <typename Visitor>
   Status VisitLastRow(Visitor&& visit) const {
     const auto& values_buffer = values_buffers_.back();
     const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
+    const int32_t num_stored_cols = this->num_stored_cols();
     const auto start_pos =
-        static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) -
+        num_stored_cols - 1;
+    for (int32_t col_index = 0; col_index < num_stored_cols; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -131,6 +152,10 @@ class ARROW_EXPORT BlockParser {
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
 
+  int32_t num_stored_cols() const {
+    return stored_positions_.empty() ? num_cols_ : num_stored_cols_;
+  }
+
   Status DoParse(const std::vector<util::string_view>& data, bool is_final,
                  uint32_t* out_size);
   template <typename SpecializedOptions>
@@ -156,6 +181,10 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols_;
   // The maximum number of rows to parse from this block
   int32_t max_num_rows_;
+  // For each column, the position of its values in a row of stored values,
+  // -1 if they are not stored (empty if all columns are stored)
+  std::vector<int32_t> stored_positions_;
+  int32_t num_stored_cols_;
 
   // Linear scratchpad for parsed values
   struct ValueDesc {
@@ -35,7 +35,13 @@ namespace csv {
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
 
+const char* one_row_long_fields =
+    "2020-01-01T00:00:00,Lorem ipsum dolor sit amet consectetur adipiscing elit,"
+    "\"sed do eiusmod tempor, incididunt ut labore et dolore magna aliqua\",1234.5\n";
+
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
+const auto num_rows_long_fields =
+    static_cast<int32_t>((1024 * 64) / strlen(one_row_long_fields));
 
 static std::string BuildCSVData(const std::string& row, int32_t repeat) {
   std::stringstream ss;
@@ -139,11 +145,33 @@ static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long_fields, num_rows_long_fields);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_rows_long_fields, options);
+}
+
+static void ParseCSVLongFieldsEscapedBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long_fields, num_rows_long_fields);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = true;
+
+  BenchmarkCSVParsing(state, csv, num_rows_long_fields, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVLongFieldsBlock);
+BENCHMARK(ParseCSVLongFieldsEscapedBlock);
 
 }  // namespace csv
 }  // namespace arrow
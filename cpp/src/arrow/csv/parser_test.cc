@@ -245,6 +245,44 @@ TEST(BlockParser, Basics) {
   }
 }
 
+TEST(BlockParser, StoredColumns) {
+  auto options = ParseOptions::Defaults();
+  options.ignore_empty_lines = false;
+  const std::vector<bool> stored_columns = {true, false, true};
+  {
+    auto csv = MakeCSVData({"ab,cd,\n", "ef,\"gh,\",ij\n", "\n", "kl,mn,\"op\""});
+    BlockParser parser(default_memory_pool(), options, stored_columns);
+    AssertParseFinal(parser, csv);
+    ASSERT_EQ(3, parser.num_cols());
+    ASSERT_EQ(4, parser.num_rows());
+    ASSERT_FALSE(parser.is_stored(1));
+    AssertColumnEq(parser, 0, {"ab", "ef", "", "kl"}, {false, false, false, false});
+    AssertColumnEq(parser, 2, {"", "ij", "", "op"}, {false, false, false, true});
+    // Values of column 1 were not stored
+    ASSERT_EQ(10, parser.num_bytes());
+
+    std::vector<std::string> last_row;
+    GetLastRow(parser, &last_row);
+    ASSERT_EQ(last_row, std::vector<std::string>({"kl", "op"}));
+  }
+  {
+    // Truncated line
+    auto csv = MakeCSVData({"ab,cd,ef\n", "gh,ij"});
+    BlockParser parser(default_memory_pool(), options, stored_columns);
+    AssertParsePartial(parser, csv, 9);
+    AssertColumnEq(parser, 0, {"ab"});
+    AssertColumnEq(parser, 2, {"ef"});
+  }
+  {
+    auto csv = MakeCSVData({"ab,cd\n"});
+    BlockParser parser(default_memory_pool(), options, stored_columns);
+    uint32_t out_size;
+    ASSERT_RAISES(Invalid, Parse(parser, csv, &out_size));
+    csv = MakeCSVData({"ab,cd,ef,gh\n"});
+    ASSERT_RAISES(Invalid, Parse(parser, csv, &out_size));
+  }
+}
+
 TEST(BlockParser, EmptyHeader) {
   // Cannot infer number of columns
   uint32_t out_size;
@@ -580,6 +618,39 @@ TEST(BlockParser, Escaping) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several vectors, with special characters at all offsets
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  const std::string tail(40, 'y');
+
+  for (size_t offset = 0; offset < 70; ++offset) {
+    const std::string head(offset, 'x');
+    {
+      auto csv = MakeCSVData({head + "\\," + tail + "," + head + "\t" + tail + "\n"});
+      BlockParser parser(options);
+      AssertParseOk(parser, csv);
+      AssertColumnsEq(parser, {{head + "," + tail}, {head + "\t" + tail}});
+    }
+    {
+      auto csv = MakeCSVData(
+          {"\"" + head + "\"\",\n" + tail + "\"," + head + "\\\"" + tail + "\r\n"});
+      BlockParser parser(options);
+      AssertParseOk(parser, csv);
+      AssertColumnsEq(parser, {{head + "\",\n" + tail}, {head + "\"" + tail}},
+                      {{true}, {false}} /* quoted */);
+    }
+    {
+      // Truncated line
+      const std::string row = head + "," + tail + "\n";
+      auto csv = MakeCSVData({row, "\"" + head + tail});
+      BlockParser parser(options);
+      AssertParsePartial(parser, csv, static_cast<uint32_t>(row.size()));
+      AssertColumnsEq(parser, {{head}, {tail}});
+    }
+  }
+}
+
 // Generate test data with the given number of columns.
 std::string MakeLotsOfCsvColumns(int32_t num_columns) {
   std::string values, header;
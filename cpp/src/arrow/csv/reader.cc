@@ -17,26 +17,33 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
+#include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -56,25 +63,24 @@ class InputStream;
 
 namespace csv {
 
+using internal::checked_cast;
 using internal::GetCpuThreadPool;
 using internal::ThreadPool;
 
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class ReaderMixin {
  public:
-  BaseTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
-                  const ReadOptions& read_options, const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+              const ReadOptions& read_options, const ParseOptions& parse_options,
+              const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
         input_(std::move(input)) {}
 
-  virtual Status Init() = 0;
-
  protected:
   Status ReadNextBlock(bool first_block, std::shared_ptr<Buffer>* out) {
     ARROW_ASSIGN_OR_RAISE(auto buf, block_iterator_.Next());
@@ -112,7 +118,7 @@ class BaseTableReader : public csv::TableReader {
 
   Status ReadFirstBlock(std::shared_ptr<Buffer>* out) { return ReadNextBlock(true, out); }
 
-  // Read header and column names from buffer, create column builders
+  // Read header and column names from buffer
   Status ProcessHeader(const std::shared_ptr<Buffer>& buf,
                        std::shared_ptr<Buffer>* rest) {
     const uint8_t* data = buf->data();
@@ -168,6 +174,101 @@ class BaseTableReader : public csv::TableReader {
     num_csv_cols_ = static_cast<int32_t>(column_names_.size());
     DCHECK_GT(num_csv_cols_, 0);
 
+    if (!convert_options_.include_columns.empty()) {
+      // Only the values of included columns need to be stored when parsing
+      std::unordered_set<std::string> included(convert_options_.include_columns.begin(),
+                                               convert_options_.include_columns.end());
+      stored_columns_.resize(num_csv_cols_);
+      for (int32_t i = 0; i < num_csv_cols_; ++i) {
+        stored_columns_[i] = included.count(column_names_[i]) > 0;
+      }
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::string> GenerateColumnNames(int32_t num_cols) {
+    std::vector<std::string> res;
+    res.reserve(num_cols);
+    for (int32_t i = 0; i < num_cols; ++i) {
+      std::stringstream ss;
+      ss << "f" << i;
+      res.push_back(ss.str());
+    }
+    return res;
+  }
+
+  // Parse the CSV rows of `partial + completion + block`
+  Result<std::shared_ptr<BlockParser>> Parse(const std::shared_ptr<Buffer>& partial,
+                                             const std::shared_ptr<Buffer>& completion,
+                                             const std::shared_ptr<Buffer>& block,
+                                             bool is_final,
+                                             uint32_t* out_parsed_size = nullptr) {
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    std::shared_ptr<BlockParser> parser;
+    if (stored_columns_.empty()) {
+      parser = std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_,
+                                             max_num_rows);
+    } else {
+      parser = std::make_shared<BlockParser>(pool_, parse_options_, stored_columns_,
+                                             max_num_rows);
+    }
+
+    std::shared_ptr<Buffer> straddling;
+    std::vector<util::string_view> views;
+    if (partial->size() != 0 || completion->size() != 0) {
+      if (partial->size() == 0) {
+        straddling = completion;
+      } else if (completion->size() == 0) {
+        straddling = partial;
+      } else {
+        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
+      }
+      views = {util::string_view(*straddling), util::string_view(*block)};
+    } else {
+      views = {util::string_view(*block)};
+    }
+    uint32_t parsed_size;
+    if (is_final) {
+      RETURN_NOT_OK(parser->ParseFinal(views, &parsed_size));
+    } else {
+      RETURN_NOT_OK(parser->Parse(views, &parsed_size));
+    }
+    if (out_parsed_size) {
+      *out_parsed_size = parsed_size;
+    }
+    return parser;
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+
+  // Number of columns in the CSV file
+  int32_t num_csv_cols_ = -1;
+  // Column names in the CSV file
+  std::vector<std::string> column_names_;
+  // Whether the parser should store each CSV column (empty if all are stored)
+  std::vector<bool> stored_columns_;
+
+  std::shared_ptr<io::InputStream> input_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+
+  // Whether there was a trailing CR at the end of last parsed line
+  bool trailing_cr_ = false;
+};
+
+class BaseTableReader : public csv::TableReader, public ReaderMixin {
+ public:
+  using ReaderMixin::ReaderMixin;
+
+  virtual Status Init() = 0;
+
+ protected:
+  // Read header and column names from buffer, create column builders
+  Status ProcessHeader(const std::shared_ptr<Buffer>& buf,
+                       std::shared_ptr<Buffer>* rest) {
+    RETURN_NOT_OK(ReaderMixin::ProcessHeader(buf, rest));
     if (convert_options_.include_columns.empty()) {
       return MakeColumnBuilders();
     } else {
@@ -246,48 +347,12 @@ class BaseTableReader : public csv::TableReader {
     return ColumnBuilder::MakeNull(pool_, type, task_group_);
   }
 
-  std::vector<std::string> GenerateColumnNames(int32_t num_cols) {
-    std::vector<std::string> res;
-    res.reserve(num_cols);
-    for (int32_t i = 0; i < num_cols; ++i) {
-      std::stringstream ss;
-      ss << "f" << i;
-      res.push_back(ss.str());
-    }
-    return res;
-  }
-
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& block, int64_t block_index,
                         bool is_final, uint32_t* out_parsed_size = nullptr) {
-    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser =
-        std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
-
-    std::shared_ptr<Buffer> straddling;
-    std::vector<util::string_view> views;
-    if (partial->size() != 0 || completion->size() != 0) {
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
-      }
-      views = {util::string_view(*straddling), util::string_view(*block)};
-    } else {
-      views = {util::string_view(*block)};
-    }
-    uint32_t parsed_size;
-    if (is_final) {
-      RETURN_NOT_OK(parser->ParseFinal(views, &parsed_size));
-    } else {
-      RETURN_NOT_OK(parser->Parse(views, &parsed_size));
-    }
-    if (out_parsed_size) {
-      *out_parsed_size = parsed_size;
-    }
+    ARROW_ASSIGN_OR_RAISE(auto parser,
+                          Parse(partial, completion, block, is_final, out_parsed_size));
     return ProcessData(parser, block_index);
   }
 
@@ -310,29 +375,24 @@ class BaseTableReader : public csv::TableReader {
       fields.push_back(::arrow::field(builder_names_[i], array->type()));
       columns.emplace_back(std::move(array));
     }
-    return Table::Make(schema(fields), columns);
+    auto table = Table::Make(schema(fields), columns);
+    if (read_options_.coalesce_target_rows > 0 ||
+        read_options_.coalesce_target_bytes > 0) {
+      CoalesceOptions coalesce_options(read_options_.coalesce_target_rows,
+                                       read_options_.coalesce_target_bytes);
+      std::shared_ptr<Table> coalesced;
+      RETURN_NOT_OK(table->CoalesceChunks(coalesce_options, pool_, &coalesced));
+      return coalesced;
+    }
+    return table;
   }
 
-  MemoryPool* pool_;
-  ReadOptions read_options_;
-  ParseOptions parse_options_;
-  ConvertOptions convert_options_;
-
-  // Number of columns in the CSV file
-  int32_t num_csv_cols_ = -1;
-  // Column names in the CSV file
-  std::vector<std::string> column_names_;
   // Column builders for target Table (not necessarily in CSV file order)
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
   // Names of columns, in same order as column_builders_
   std::vector<std::string> builder_names_;
 
-  std::shared_ptr<io::InputStream> input_;
-  Iterator<std::shared_ptr<Buffer>> block_iterator_;
   std::shared_ptr<internal::TaskGroup> task_group_;
-
-  // Whether there was a trailing CR at the end of last parsed line
-  bool trailing_cr_ = false;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -486,7 +546,301 @@ class ThreadedTableReader : public BaseTableReader {
 };
 
 /////////////////////////////////////////////////////////////////////////
-// TableReader factory function
+// StreamingReader implementation
+
+class StreamingReaderImpl : public StreamingReader, public ReaderMixin {
+ public:
+  // `thread_pool` is null if blocks should be converted serially
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : ReaderMixin(pool, std::move(input), read_options, parse_options,
+                    convert_options),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(thread_pool ? thread_pool->GetCapacity() : 1) {}
+
+  ~StreamingReaderImpl() override {
+    // Pending tasks refer to this reader's options and converters
+    for (auto& pending : pending_blocks_) {
+      pending.wait();
+    }
+  }
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+    RETURN_NOT_OK(MakeReadaheadIterator(std::move(block_iterator_), max_blocks_in_flight_)
+                      .Value(&block_iterator_));
+
+    std::shared_ptr<Buffer> first_block;
+    RETURN_NOT_OK(ReadFirstBlock(&first_block));
+    if (!first_block) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_block, &block_));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    chunker_ = MakeChunker(parse_options_);
+    partial_ = std::make_shared<Buffer>("");
+
+    // Parse the first blocks with data serially, to infer column types
+    const auto num_samples =
+        static_cast<size_t>(std::max(convert_options_.inference_blocks, 1));
+    std::vector<std::shared_ptr<BlockParser>> parsers;
+    std::shared_ptr<BlockParser> parser;
+    Chunk chunk;
+    bool has_chunk = true;
+    while (parsers.size() < num_samples) {
+      RETURN_NOT_OK(NextChunk(&chunk, &has_chunk));
+      if (!has_chunk) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          parser, Parse(chunk.partial, chunk.completion, chunk.whole, chunk.is_final));
+      if (parser->num_rows() > 0) {
+        parsers.push_back(parser);
+      }
+    }
+    if (parsers.empty()) {
+      // No data: infer from the last (empty) block
+      parsers.push_back(parser);
+    }
+    return InferColumnTypes(parsers);
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    RETURN_NOT_OK(LaunchBlocks());
+    if (!sample_batches_.empty()) {
+      *batch = std::move(sample_batches_.front());
+      sample_batches_.pop_front();
+      return Status::OK();
+    }
+    while (!pending_blocks_.empty()) {
+      auto pending = std::move(pending_blocks_.front());
+      pending_blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto next_batch, pending.get());
+      RETURN_NOT_OK(LaunchBlocks());
+      if (next_batch->num_rows() > 0) {
+        *batch = std::move(next_batch);
+        return Status::OK();
+      }
+    }
+    // EOF
+    batch->reset();
+    return Status::OK();
+  }
+
+ protected:
+  // A block of whole CSV rows, possibly straddling two IO blocks
+  struct Chunk {
+    std::shared_ptr<Buffer> partial;
+    std::shared_ptr<Buffer> completion;
+    std::shared_ptr<Buffer> whole;
+    bool is_final;
+  };
+
+  // How to produce one column of the output batches
+  struct ColumnDecoder {
+    // Index of the column in the CSV file, -1 for a column of nulls
+    int32_t col_index;
+    // Output type, null if it is yet to be inferred
+    std::shared_ptr<DataType> type;
+    // Converter shared by all blocks, null for dictionary columns since
+    // dictionary converters accumulate their dictionary
+    std::shared_ptr<Converter> converter;
+  };
+
+  Status MakeColumnDecoders() {
+    std::unordered_map<std::string, int32_t> col_indices;
+    col_indices.reserve(column_names_.size());
+    for (int32_t i = 0; i < static_cast<int32_t>(column_names_.size()); ++i) {
+      col_indices.emplace(column_names_[i], i);
+    }
+    const auto& names = convert_options_.include_columns.empty()
+                            ? column_names_
+                            : convert_options_.include_columns;
+    for (const auto& col_name : names) {
+      ColumnDecoder decoder;
+      auto it = col_indices.find(col_name);
+      if (it != col_indices.end()) {
+        decoder.col_index = it->second;
+      } else if (convert_options_.include_missing_columns) {
+        decoder.col_index = -1;
+      } else {
+        return Status::KeyError("Column '", col_name,
+                                "' in include_columns "
+                                "does not exist in CSV file");
+      }
+      // Does the named column have a fixed type?
+      auto type_it = convert_options_.column_types.find(col_name);
+      if (type_it != convert_options_.column_types.end()) {
+        decoder.type = type_it->second;
+      } else if (decoder.col_index < 0) {
+        decoder.type = null();
+      }
+      decoders_.push_back(std::move(decoder));
+      decoder_names_.push_back(col_name);
+    }
+    return Status::OK();
+  }
+
+  // Convert the sample blocks, inferring the types that are not fixed
+  Status InferColumnTypes(const std::vector<std::shared_ptr<BlockParser>>& parsers) {
+    auto task_group = thread_pool_ ? internal::TaskGroup::MakeThreaded(thread_pool_)
+                                   : internal::TaskGroup::MakeSerial();
+    std::vector<std::shared_ptr<ColumnBuilder>> builders(decoders_.size());
+    for (size_t i = 0; i < decoders_.size(); ++i) {
+      if (decoders_[i].type == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(builders[i],
+                              ColumnBuilder::Make(pool_, decoders_[i].col_index,
+                                                  convert_options_, task_group));
+        for (size_t block_index = 0; block_index < parsers.size(); ++block_index) {
+          builders[i]->Insert(static_cast<int64_t>(block_index), parsers[block_index]);
+        }
+      }
+    }
+    RETURN_NOT_OK(task_group->Finish());
+
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<ArrayVector> columns(parsers.size());
+    for (size_t i = 0; i < decoders_.size(); ++i) {
+      auto& decoder = decoders_[i];
+      std::shared_ptr<ChunkedArray> chunked;
+      if (builders[i] != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(chunked, builders[i]->Finish());
+        DCHECK_EQ(chunked->num_chunks(), static_cast<int>(parsers.size()));
+        decoder.type = chunked->type();
+      }
+      if (decoder.col_index >= 0 && decoder.type->id() != Type::DICTIONARY) {
+        ARROW_ASSIGN_OR_RAISE(decoder.converter,
+                              Converter::Make(decoder.type, convert_options_, pool_));
+      }
+      for (size_t block_index = 0; block_index < parsers.size(); ++block_index) {
+        if (chunked != nullptr) {
+          columns[block_index].push_back(chunked->chunk(static_cast<int>(block_index)));
+        } else {
+          ARROW_ASSIGN_OR_RAISE(auto array,
+                                DecodeColumn(decoder, *parsers[block_index]));
+          columns[block_index].push_back(std::move(array));
+        }
+      }
+      fields.push_back(::arrow::field(decoder_names_[i], decoder.type));
+    }
+    schema_ = ::arrow::schema(std::move(fields));
+    for (size_t block_index = 0; block_index < parsers.size(); ++block_index) {
+      const auto num_rows = parsers[block_index]->num_rows();
+      if (num_rows > 0) {
+        sample_batches_.push_back(
+            RecordBatch::Make(schema_, num_rows, std::move(columns[block_index])));
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Array>> DecodeColumn(const ColumnDecoder& decoder,
+                                              const BlockParser& parser) {
+    std::shared_ptr<Array> array;
+    if (decoder.col_index < 0) {
+      RETURN_NOT_OK(MakeArrayOfNull(pool_, decoder.type, parser.num_rows(), &array));
+      return array;
+    }
+    if (decoder.converter != nullptr) {
+      return decoder.converter->Convert(parser, decoder.col_index);
+    }
+    const auto& dict_type = checked_cast<const DictionaryType&>(*decoder.type);
+    ARROW_ASSIGN_OR_RAISE(
+        auto converter,
+        DictionaryConverter::Make(dict_type.value_type(), convert_options_, pool_));
+    return converter->Convert(parser, decoder.col_index);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> DecodeChunk(const Chunk& chunk) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto parser, Parse(chunk.partial, chunk.completion, chunk.whole, chunk.is_final));
+    ArrayVector columns;
+    columns.reserve(decoders_.size());
+    for (const auto& decoder : decoders_) {
+      ARROW_ASSIGN_OR_RAISE(auto array, DecodeColumn(decoder, *parser));
+      columns.push_back(std::move(array));
+    }
+    return RecordBatch::Make(schema_, parser->num_rows(), std::move(columns));
+  }
+
+  // Carve the next block of whole CSV rows out of the input
+  Status NextChunk(Chunk* out, bool* has_chunk) {
+    if (!block_) {
+      *has_chunk = false;
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto next_block, block_iterator_.Next());
+    std::shared_ptr<Buffer> next_partial;
+    out->partial = partial_;
+    out->is_final = (next_block == nullptr);
+    if (out->is_final) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &out->completion, &out->whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &out->completion,
+                                                 &starts_with_whole));
+      // Get a complete CSV block inside `partial + block`, and keep
+      // the rest for the next iteration.
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &out->whole, &next_partial));
+    }
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    *has_chunk = true;
+    return Status::OK();
+  }
+
+  // Launch decoding of the next blocks, up to the in-flight limit
+  Status LaunchBlocks() {
+    while (static_cast<int>(pending_blocks_.size()) < max_blocks_in_flight_) {
+      Chunk chunk;
+      bool has_chunk;
+      RETURN_NOT_OK(NextChunk(&chunk, &has_chunk));
+      if (!has_chunk) {
+        break;
+      }
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto pending, thread_pool_->Submit([this, chunk] {
+          return DecodeChunk(chunk);
+        }));
+        pending_blocks_.push_back(std::move(pending));
+      } else {
+        std::promise<Result<std::shared_ptr<RecordBatch>>> decoded;
+        decoded.set_value(DecodeChunk(chunk));
+        pending_blocks_.push_back(decoded.get_future());
+      }
+    }
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  const int max_blocks_in_flight_;
+
+  std::vector<ColumnDecoder> decoders_;
+  // Names of output columns, in same order as decoders_
+  std::vector<std::string> decoder_names_;
+  std::shared_ptr<Schema> schema_;
+  // Batches of the blocks column types were inferred from
+  std::deque<std::shared_ptr<RecordBatch>> sample_batches_;
+
+  std::unique_ptr<Chunker> chunker_;
+  // Incomplete row at the end of the last carved block
+  std::shared_ptr<Buffer> partial_;
+  // Next IO block to carve, null at EOF
+  std::shared_ptr<Buffer> block_;
+  // Batches being decoded, in file order
+  std::deque<std::future<Result<std::shared_ptr<RecordBatch>>>> pending_blocks_;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Factory functions
 
 Result<std::shared_ptr<TableReader>> TableReader::Make(
     MemoryPool* pool, std::shared_ptr<io::InputStream> input,
@@ -504,6 +858,17 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
   return reader;
 }
 
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, std::move(input), read_options, parse_options, convert_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // Deprecated API(s)
 
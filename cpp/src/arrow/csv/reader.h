@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -55,5 +56,27 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a CSV file incrementally as Arrow RecordBatches
+///
+/// Blocks of `ReadOptions::block_size` bytes are parsed and converted in
+/// parallel on the CPU thread pool (if `ReadOptions::use_threads` is true),
+/// with at most as many blocks in flight as the pool has threads, so that
+/// memory usage stays bounded regardless of the file size.  Batches are
+/// yielded in file order, one per block.
+///
+/// Column types not given in `ConvertOptions::column_types` are inferred
+/// from the first `ConvertOptions::inference_blocks` blocks that contain data
+/// (at least one), and then enforced for the following blocks.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance
+  ///
+  /// The header and the first block are read and converted before returning,
+  /// so that the schema is known.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&, const ConvertOptions&);
+};
+
 }  // namespace csv
 }  // namespace arrow
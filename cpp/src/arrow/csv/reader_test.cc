@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::checked_cast;
+
+std::shared_ptr<io::InputStream> MakeCSVInput(std::string csv) {
+  return std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+}
+
+// A CSV file of `num_rows` rows (i, "s<i>", i / 2)
+std::string MakeCSV(int num_rows) {
+  std::string csv = "a,b,c\n";
+  for (int i = 0; i < num_rows; ++i) {
+    csv += std::to_string(i) + ",s" + std::to_string(i) + "," +
+           std::to_string(i / 2) + (i % 2 ? ".5" : ".0") + "\n";
+  }
+  return csv;
+}
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  ReadOptions MakeReadOptions() {
+    auto read_options = ReadOptions::Defaults();
+    read_options.use_threads = GetParam();
+    read_options.block_size = 64;
+    return read_options;
+  }
+};
+
+TEST_P(TestStreamingReader, BatchesInOrder) {
+  const int num_rows = 500;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      StreamingReader::Make(default_memory_pool(), MakeCSVInput(MakeCSV(num_rows)),
+                            MakeReadOptions(), ParseOptions::Defaults(),
+                            ConvertOptions::Defaults()));
+  auto expected_schema =
+      schema({field("a", int64()), field("b", utf8()), field("c", float64())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  // Small blocks yield many batches
+  ASSERT_GT(batches.size(), 10);
+  int64_t row = 0;
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    AssertSchemaEqual(*expected_schema, *batch->schema());
+    const auto& a = checked_cast<const Int64Array&>(*batch->column(0));
+    const auto& b = checked_cast<const StringArray&>(*batch->column(1));
+    const auto& c = checked_cast<const DoubleArray&>(*batch->column(2));
+    for (int64_t i = 0; i < batch->num_rows(); ++i, ++row) {
+      ASSERT_EQ(row, a.Value(i));
+      ASSERT_EQ("s" + std::to_string(row), b.GetString(i));
+      ASSERT_EQ(row * 0.5, c.Value(i));
+    }
+  }
+  ASSERT_EQ(num_rows, row);
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+}
+
+TEST_P(TestStreamingReader, ColumnOptions) {
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.include_columns = {"c", "d", "a"};
+  convert_options.include_missing_columns = true;
+  convert_options.column_types["a"] = int16();
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      StreamingReader::Make(default_memory_pool(), MakeCSVInput(MakeCSV(100)),
+                            MakeReadOptions(), ParseOptions::Defaults(),
+                            convert_options));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_OK(table->ValidateFull());
+  AssertSchemaEqual(
+      *schema({field("c", float64()), field("d", null()), field("a", int16())}),
+      *table->schema());
+  ASSERT_EQ(100, table->num_rows());
+  ASSERT_EQ(100, table->column(1)->null_count());
+
+  // Each batch has its own dictionary
+  convert_options = ConvertOptions::Defaults();
+  convert_options.auto_dict_encode = true;
+  ASSERT_OK_AND_ASSIGN(
+      reader, StreamingReader::Make(default_memory_pool(), MakeCSVInput(MakeCSV(100)),
+                                    MakeReadOptions(), ParseOptions::Defaults(),
+                                    convert_options));
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_OK(table->ValidateFull());
+  AssertTypeEqual(*dictionary(int32(), utf8()), *table->column(1)->type());
+  ASSERT_EQ(100, table->num_rows());
+
+  convert_options.include_columns = {"c", "d", "a"};
+  convert_options.include_missing_columns = false;
+  ASSERT_RAISES(KeyError, StreamingReader::Make(default_memory_pool(),
+                                                MakeCSVInput(MakeCSV(100)),
+                                                MakeReadOptions(),
+                                                ParseOptions::Defaults(),
+                                                convert_options));
+}
+
+TEST_P(TestStreamingReader, TypesInferredFromFirstBlock) {
+  // Values of the following blocks must convert to the inferred types
+  std::string csv = MakeCSV(50) + "x,y,z\n";
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, StreamingReader::Make(default_memory_pool(), MakeCSVInput(csv),
+                                         MakeReadOptions(), ParseOptions::Defaults(),
+                                         ConvertOptions::Defaults()));
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&table));
+
+  // Unless the last block is sampled as well
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.inference_blocks = 1000;
+  ASSERT_OK_AND_ASSIGN(
+      reader, StreamingReader::Make(default_memory_pool(), MakeCSVInput(csv),
+                                    MakeReadOptions(), ParseOptions::Defaults(),
+                                    convert_options));
+  AssertSchemaEqual(*schema({field("a", utf8()), field("b", utf8()), field("c", utf8())}),
+                    *reader->schema());
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_OK(table->ValidateFull());
+  ASSERT_EQ(51, table->num_rows());
+}
+
+TEST_P(TestStreamingReader, EmptyFile) {
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), MakeCSVInput(""),
+                                               MakeReadOptions(),
+                                               ParseOptions::Defaults(),
+                                               ConvertOptions::Defaults()));
+
+  // A header alone gives an empty stream
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      StreamingReader::Make(default_memory_pool(), MakeCSVInput("a,b\n"),
+                            MakeReadOptions(), ParseOptions::Defaults(),
+                            ConvertOptions::Defaults()));
+  ASSERT_EQ(2, reader->schema()->num_fields());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestStreamingReader, ::testing::Bool());
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,396 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::TaskGroup;
+
+namespace {
+
+constexpr char kQuote = '"';
+
+// The number of rows assembled by a task
+constexpr int64_t kRowsPerTask = 1 << 12;
+
+// Detects the bytes which require quoting a field, a word at a time
+class QuotingDetector {
+ public:
+  explicit QuotingDetector(char delimiter)
+      : delimiter_(delimiter),
+        delimiter_word_(Broadcast(delimiter)),
+        quote_word_(Broadcast(kQuote)),
+        cr_word_(Broadcast('\r')),
+        lf_word_(Broadcast('\n')) {}
+
+  bool NeedsQuoting(const uint8_t* data, int64_t length) const {
+    int64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      uint64_t word;
+      std::memcpy(&word, data + i, 8);
+      if (HasZeroByte(word ^ delimiter_word_) | HasZeroByte(word ^ quote_word_) |
+          HasZeroByte(word ^ cr_word_) | HasZeroByte(word ^ lf_word_)) {
+        return true;
+      }
+    }
+    for (; i < length; ++i) {
+      const char c = static_cast<char>(data[i]);
+      if (c == delimiter_ || c == kQuote || c == '\r' || c == '\n') {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  static uint64_t Broadcast(char c) {
+    return 0x0101010101010101ULL * static_cast<uint8_t>(c);
+  }
+
+  // Nonzero if and only if a byte of the word is zero
+  static uint64_t HasZeroByte(uint64_t word) {
+    return (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+  }
+
+  char delimiter_;
+  uint64_t delimiter_word_, quote_word_, cr_word_, lf_word_;
+};
+
+// Append a value between quotes, doubling the quotes inside it
+Status AppendQuoted(const uint8_t* data, int64_t length, BufferBuilder* out) {
+  RETURN_NOT_OK(out->Reserve(2 * length + 2));
+  uint8_t* begin = out->mutable_data() + out->length();
+  uint8_t* cursor = begin;
+  *cursor++ = kQuote;
+  for (int64_t i = 0; i < length; ++i) {
+    *cursor++ = data[i];
+    if (data[i] == kQuote) {
+      *cursor++ = kQuote;
+    }
+  }
+  *cursor++ = kQuote;
+  out->UnsafeAdvance(cursor - begin);
+  return Status::OK();
+}
+
+bool IsSupported(const DataType& type) {
+  switch (type.id()) {
+    case Type::NA:
+    case Type::BOOL:
+    case Type::UINT8:
+    case Type::INT8:
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::DECIMAL:
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The fields of a column of a batch, one after the other, null values being
+// empty fields
+struct FormattedColumn {
+  explicit FormattedColumn(MemoryPool* pool) : data(pool), offsets(pool) {}
+
+  BufferBuilder data;
+  TypedBufferBuilder<int64_t> offsets;
+};
+
+class ColumnFormatter {
+ public:
+  ColumnFormatter(const Array& array, const QuotingDetector& detector,
+                  FormattedColumn* out)
+      : array_(array), detector_(detector), out_(out) {}
+
+  Status Format() {
+    RETURN_NOT_OK(out_->offsets.Reserve(array_.length() + 1));
+    out_->offsets.UnsafeAppend(0);
+    return VisitTypeInline(*array_.type(), this);
+  }
+
+  Status Visit(const NullType&) {
+    out_->offsets.UnsafeAppend(array_.length(), 0);
+    return Status::OK();
+  }
+
+  // Numbers are formatted straight into the data buffer, which is grown when
+  // it can't hold a value of the maximum formatted size
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || std::is_same<T, BooleanType>::value ||
+                  std::is_same<T, FloatType>::value ||
+                  std::is_same<T, DoubleType>::value ||
+                  std::is_same<T, Decimal128Type>::value,
+              Status>
+  Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    using FormatterType = internal::StringFormatter<T>;
+
+    const auto& values = checked_cast<const ArrayType&>(array_);
+    FormatterType formatter(array_.type());
+    BufferBuilder* data = &out_->data;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) {
+        if (ARROW_PREDICT_FALSE(data->capacity() - data->length() <
+                                FormatterType::buffer_size)) {
+          RETURN_NOT_OK(data->Reserve(FormatterType::buffer_size));
+        }
+        char* out = reinterpret_cast<char*>(data->mutable_data()) + data->length();
+        data->UnsafeAdvance(formatter.FormatValue(GetValue(values, i), out));
+      }
+      out_->offsets.UnsafeAppend(data->length());
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    using offset_type = typename T::offset_type;
+
+    const auto& values = checked_cast<const ArrayType&>(array_);
+    const int64_t length = values.length();
+    const offset_type* value_offsets = values.raw_value_offsets();
+    const uint8_t* value_data =
+        values.value_data() ? values.value_data()->data() : NULLPTR;
+    const int64_t data_length = value_offsets[length] - value_offsets[0];
+    BufferBuilder* data = &out_->data;
+    TypedBufferBuilder<int64_t>* offsets = &out_->offsets;
+
+    // Most columns have no value to quote, which is checked for all the values
+    // at once
+    const bool any_needs_quoting =
+        data_length > 0 && detector_.NeedsQuoting(value_data + value_offsets[0],
+                                                  data_length);
+    if (!any_needs_quoting && values.null_count() == 0) {
+      if (data_length > 0) {
+        RETURN_NOT_OK(data->Append(value_data + value_offsets[0], data_length));
+      }
+      for (int64_t i = 1; i <= length; ++i) {
+        offsets->UnsafeAppend(value_offsets[i] - value_offsets[0]);
+      }
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(data->Reserve(data_length));
+    for (int64_t i = 0; i < length; ++i) {
+      if (values.IsValid(i)) {
+        const uint8_t* value = value_data + value_offsets[i];
+        const int64_t value_length = value_offsets[i + 1] - value_offsets[i];
+        if (any_needs_quoting && detector_.NeedsQuoting(value, value_length)) {
+          RETURN_NOT_OK(AppendQuoted(value, value_length, data));
+        } else if (value_length > 0) {
+          RETURN_NOT_OK(data->Append(value, value_length));
+        }
+      }
+      offsets->UnsafeAppend(data->length());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Writing CSV of type ", type);
+  }
+
+ private:
+  template <typename ArrayType>
+  static auto GetValue(const ArrayType& values, int64_t i) -> decltype(values.Value(i)) {
+    return values.Value(i);
+  }
+
+  static Decimal128 GetValue(const Decimal128Array& values, int64_t i) {
+    return Decimal128(values.GetValue(i));
+  }
+
+  const Array& array_;
+  const QuotingDetector& detector_;
+  FormattedColumn* out_;
+};
+
+class CSVWriter {
+ public:
+  CSVWriter(const WriteOptions& options, MemoryPool* pool, io::OutputStream* output)
+      : options_(options), pool_(pool), output_(output), detector_(options.delimiter) {}
+
+  Status WriteHeader(const Schema& schema) {
+    for (const auto& field : schema.fields()) {
+      if (!IsSupported(*field->type())) {
+        return Status::NotImplemented("Writing CSV of type ", *field->type());
+      }
+    }
+    if (!options_.include_header || schema.num_fields() == 0) {
+      return Status::OK();
+    }
+
+    BufferBuilder header(pool_);
+    for (const auto& field : schema.fields()) {
+      const auto& name = field->name();
+      const auto* data = reinterpret_cast<const uint8_t*>(name.data());
+      const auto length = static_cast<int64_t>(name.size());
+      if (detector_.NeedsQuoting(data, length)) {
+        RETURN_NOT_OK(AppendQuoted(data, length, &header));
+      } else {
+        RETURN_NOT_OK(header.Append(data, length));
+      }
+      RETURN_NOT_OK(header.Append(1, static_cast<uint8_t>(options_.delimiter)));
+    }
+    header.mutable_data()[header.length() - 1] = '\n';
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(header.Finish(&buffer));
+    return output_->Write(buffer);
+  }
+
+  Status WriteBatch(const RecordBatch& batch) {
+    const int num_columns = batch.num_columns();
+    const int64_t num_rows = batch.num_rows();
+    if (num_columns == 0 || num_rows == 0) {
+      return Status::OK();
+    }
+
+    std::vector<std::unique_ptr<FormattedColumn>> columns(num_columns);
+    auto format_group = MakeTaskGroup();
+    for (int i = 0; i < num_columns; ++i) {
+      columns[i].reset(new FormattedColumn(pool_));
+      format_group->Append([&, i] {
+        return ColumnFormatter(*batch.column(i), detector_, columns[i].get()).Format();
+      });
+    }
+    RETURN_NOT_OK(format_group->Finish());
+
+    // The start of each row in the output, each field being followed by the
+    // delimiter or a line break
+    std::vector<int64_t> row_starts(num_rows + 1, 0);
+    for (const auto& column : columns) {
+      const int64_t* offsets = column->offsets.data();
+      for (int64_t row = 0; row < num_rows; ++row) {
+        row_starts[row + 1] += offsets[row + 1] - offsets[row] + 1;
+      }
+    }
+    for (int64_t row = 0; row < num_rows; ++row) {
+      row_starts[row + 1] += row_starts[row];
+    }
+
+    // The rows are assembled by ranges, which are written to in parallel
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, row_starts[num_rows], &buffer));
+    uint8_t* out = buffer->mutable_data();
+    auto assemble_group = MakeTaskGroup();
+    for (int64_t begin = 0; begin < num_rows; begin += kRowsPerTask) {
+      const int64_t end = std::min(begin + kRowsPerTask, num_rows);
+      assemble_group->Append([&, begin, end] {
+        for (int64_t row = begin; row < end; ++row) {
+          uint8_t* cursor = out + row_starts[row];
+          for (const auto& column : columns) {
+            const int64_t* offsets = column->offsets.data();
+            const int64_t length = offsets[row + 1] - offsets[row];
+            std::memcpy(cursor, column->data.data() + offsets[row], length);
+            cursor += length;
+            *cursor++ = static_cast<uint8_t>(options_.delimiter);
+          }
+          cursor[-1] = '\n';
+        }
+        return Status::OK();
+      });
+    }
+    RETURN_NOT_OK(assemble_group->Finish());
+    return output_->Write(buffer);
+  }
+
+ private:
+  std::shared_ptr<TaskGroup> MakeTaskGroup() const {
+    return options_.use_threads ? TaskGroup::MakeThreaded(GetCpuThreadPool())
+                                : TaskGroup::MakeSerial();
+  }
+
+  const WriteOptions options_;
+  MemoryPool* pool_;
+  io::OutputStream* output_;
+  QuotingDetector detector_;
+};
+
+}  // namespace
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  TableBatchReader reader(table);
+  reader.set_chunksize(options.batch_size);
+  return WriteCSV(&reader, options, pool, output);
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options,
+                MemoryPool* pool, io::OutputStream* output) {
+  CSVWriter writer(options, pool, output);
+  RETURN_NOT_OK(writer.WriteHeader(*batch.schema()));
+  return writer.WriteBatch(batch);
+}
+
+Status WriteCSV(RecordBatchReader* reader, const WriteOptions& options,
+                MemoryPool* pool, io::OutputStream* output) {
+  CSVWriter writer(options, pool, output);
+  RETURN_NOT_OK(writer.WriteHeader(*reader->schema()));
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == NULLPTR) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(writer.WriteBatch(*batch));
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
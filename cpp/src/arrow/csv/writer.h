@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+// Columns of null, boolean, integer, floating point (other than half float),
+// decimal, string and binary types can be written.  Null values are written
+// as empty fields, and the fields which contain the delimiter, a quote or a
+// line break are quoted, their quotes being doubled.  Lines end with LF.
+//
+// The columns of each batch are formatted in parallel into their own buffers,
+// then the rows are assembled in parallel into a buffer which is written to
+// the output, so that the output is in order.
+
+/// \brief Write a table as CSV, in batches of `WriteOptions::batch_size` rows
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write a record batch as CSV
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options,
+                MemoryPool* pool, io::OutputStream* output);
+
+/// \brief Write the record batches of a reader as CSV, as they are read
+ARROW_EXPORT
+Status WriteCSV(RecordBatchReader* reader, const WriteOptions& options,
+                MemoryPool* pool, io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+
+#include "arrow/csv/options.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace csv {
+
+constexpr int64_t kNumRows = 1 << 16;
+constexpr auto kSeed = 0x0ff1ce;
+
+static void BenchmarkWriteCSV(benchmark::State& state,  // NOLINT non-const reference
+                              const RecordBatch& batch) {
+  auto options = WriteOptions::Defaults();
+  options.use_threads = state.range(0) != 0;
+
+  for (auto _ : state) {
+    std::shared_ptr<io::BufferOutputStream> out;
+    ABORT_NOT_OK(io::BufferOutputStream::Create(1 << 20).Value(&out));
+    ABORT_NOT_OK(WriteCSV(batch, options, default_memory_pool(), out.get()));
+    std::shared_ptr<Buffer> buffer;
+    ABORT_NOT_OK(out->Finish(&buffer));
+    benchmark::DoNotOptimize(buffer);
+  }
+  state.SetItemsProcessed(state.iterations() * batch.num_rows());
+}
+
+static void WriteCSVNumbers(benchmark::State& state) {  // NOLINT non-const reference
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto batch = RecordBatch::Make(
+      schema({field("a", int64()), field("b", int32()), field("c", float64())}),
+      kNumRows,
+      {rand.Int64(kNumRows, -1000000000000, 1000000000000, 0.1),
+       rand.Int32(kNumRows, -1000, 1000, 0.1), rand.Float64(kNumRows, -1e6, 1e6, 0.1)});
+  BenchmarkWriteCSV(state, *batch);
+}
+
+static void WriteCSVStrings(benchmark::State& state) {  // NOLINT non-const reference
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto batch = RecordBatch::Make(
+      schema({field("a", utf8()), field("b", utf8())}), kNumRows,
+      {rand.String(kNumRows, 0, 20, 0.1), rand.String(kNumRows, 10, 40, 0.1)});
+  BenchmarkWriteCSV(state, *batch);
+}
+
+// The argument is whether the columns and rows are formatted in parallel
+BENCHMARK(WriteCSVNumbers)->Arg(0)->Arg(1);
+BENCHMARK(WriteCSVStrings)->Arg(0)->Arg(1);
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace csv {
+
+class TestWriteCSV : public ::testing::TestWithParam<bool> {
+ public:
+  WriteOptions MakeWriteOptions() {
+    auto options = WriteOptions::Defaults();
+    options.use_threads = GetParam();
+    return options;
+  }
+
+  std::string ToCSV(const RecordBatch& batch, const WriteOptions& options) {
+    std::shared_ptr<io::BufferOutputStream> out;
+    ARROW_EXPECT_OK(io::BufferOutputStream::Create(1024).Value(&out));
+    ARROW_EXPECT_OK(WriteCSV(batch, options, default_memory_pool(), out.get()));
+    std::shared_ptr<Buffer> buffer;
+    ARROW_EXPECT_OK(out->Finish(&buffer));
+    return buffer->ToString();
+  }
+
+  std::string ToCSV(const Table& table, const WriteOptions& options) {
+    std::shared_ptr<io::BufferOutputStream> out;
+    ARROW_EXPECT_OK(io::BufferOutputStream::Create(1024).Value(&out));
+    ARROW_EXPECT_OK(WriteCSV(table, options, default_memory_pool(), out.get()));
+    std::shared_ptr<Buffer> buffer;
+    ARROW_EXPECT_OK(out->Finish(&buffer));
+    return buffer->ToString();
+  }
+};
+
+TEST_P(TestWriteCSV, Types) {
+  auto batch_schema =
+      schema({field("a", int32()), field("b", float64()), field("c", boolean()),
+              field("d", utf8()), field("e", decimal(5, 2)), field("f", null())});
+  auto batch = RecordBatchFromJSON(batch_schema, R"([
+    [1, 1.5, true, "x", "123.45", null],
+    [null, null, null, null, null, null],
+    [-20, -0.25, false, "", "-0.01", null]
+  ])");
+
+  ASSERT_EQ(
+      "a,b,c,d,e,f\n"
+      "1,1.5,true,x,123.45,\n"
+      ",,,,,\n"
+      "-20,-0.25,false,,-0.01,\n",
+      ToCSV(*batch, MakeWriteOptions()));
+
+  auto options = MakeWriteOptions();
+  options.include_header = false;
+  ASSERT_EQ(
+      ",,,,,\n"
+      "-20,-0.25,false,,-0.01,\n",
+      ToCSV(*batch->Slice(1), options));
+}
+
+TEST_P(TestWriteCSV, Quoting) {
+  auto batch_schema = schema({field("a,b", utf8()), field("c", large_binary())});
+  auto batch = RecordBatchFromJSON(batch_schema, R"([
+    ["plain", "a value longer than a word"],
+    ["with,delimiter", "a value longer than a word, with a delimiter"],
+    ["with \"quotes\"", "with\nline feed"],
+    [null, "with\rcarriage return"]
+  ])");
+
+  ASSERT_EQ(
+      "\"a,b\",c\n"
+      "plain,a value longer than a word\n"
+      "\"with,delimiter\",\"a value longer than a word, with a delimiter\"\n"
+      "\"with \"\"quotes\"\"\",\"with\nline feed\"\n"
+      ",\"with\rcarriage return\"\n",
+      ToCSV(*batch, MakeWriteOptions()));
+
+  auto options = MakeWriteOptions();
+  options.delimiter = ';';
+  ASSERT_EQ(
+      "a,b;c\n"
+      "plain;a value longer than a word\n"
+      "with,delimiter;a value longer than a word, with a delimiter\n"
+      "\"with \"\"quotes\"\"\";\"with\nline feed\"\n"
+      ";\"with\rcarriage return\"\n",
+      ToCSV(*batch, options));
+}
+
+TEST_P(TestWriteCSV, RoundTrip) {
+  auto table_schema =
+      schema({field("a", int64()), field("b", utf8()), field("c", float64())});
+  std::vector<std::string> chunks;
+  for (int chunk = 0; chunk < 3; ++chunk) {
+    std::string json = "[";
+    for (int i = 0; i < 1000; ++i) {
+      const int64_t value = chunk * 1000 + i;
+      json += (i ? ", [" : "[") + std::to_string(value * value * value) +
+              (i % 3 ? ", \"s" : ", \"t,\\\"") + std::to_string(value) + "\", " +
+              std::to_string(value) + ".25]";
+    }
+    chunks.push_back(json + "]");
+  }
+  auto table = TableFromJSON(table_schema, chunks);
+
+  auto options = MakeWriteOptions();
+  options.batch_size = 700;
+  std::string csv = ToCSV(*table, options);
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = GetParam();
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       TableReader::Make(default_memory_pool(), input, read_options,
+                                         parse_options, ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(auto read_table, reader->Read());
+  AssertTablesEqual(*table, *read_table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestWriteCSV, UnsupportedType) {
+  auto batch = RecordBatchFromJSON(schema({field("a", list(int32()))}), "[[[1]]]");
+  std::shared_ptr<io::BufferOutputStream> out;
+  ASSERT_OK(io::BufferOutputStream::Create(1024).Value(&out));
+  ASSERT_RAISES(NotImplemented,
+                WriteCSV(*batch, MakeWriteOptions(), default_memory_pool(), out.get()));
+  ASSERT_OK_AND_EQ(0, out->Tell());
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestWriteCSV, ::testing::Bool());
+
+}  // namespace csv
+}  // namespace arrow
@@ -29,9 +29,47 @@
 namespace arrow {
 namespace dataset {
 
+Status ScanSummary::Merge(const ScanSummary& other) {
+  if (other.min.size() != min.size()) {
+    return Status::Invalid("Cannot merge the summaries of ", other.min.size(), " and ",
+                           min.size(), " columns");
+  }
+  num_rows += other.num_rows;
+  for (size_t i = 0; i < min.size(); ++i) {
+    RETURN_NOT_OK(MergeBounds(i, other.min[i], other.max[i]));
+  }
+  return Status::OK();
+}
+
+Status ScanSummary::MergeBounds(size_t i, const std::shared_ptr<Scalar>& other_min,
+                                const std::shared_ptr<Scalar>& other_max) {
+  if (other_min == nullptr || other_max == nullptr) {
+    return Status::OK();
+  }
+  if (min[i] == nullptr) {
+    min[i] = other_min;
+    max[i] = other_max;
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto min_cmp, CompareScalars(*other_min, *min[i]));
+  if (min_cmp < 0) {
+    min[i] = other_min;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto max_cmp, CompareScalars(*other_max, *max[i]));
+  if (max_cmp > 0) {
+    max[i] = other_max;
+  }
+  return Status::OK();
+}
+
 DataFragment::DataFragment(std::shared_ptr<ScanOptions> scan_options)
     : scan_options_(std::move(scan_options)), partition_expression_(scalar(true)) {}
 
+Result<std::shared_ptr<ScanSummary>> DataFragment::Summarize(
+    const std::vector<std::string>& columns) {
+  return nullptr;
+}
+
 SimpleDataFragment::SimpleDataFragment(
     std::vector<std::shared_ptr<RecordBatch>> record_batches,
     std::shared_ptr<ScanOptions> scan_options)
@@ -94,6 +132,9 @@ bool DataSource::AssumePartitionExpression(
 DataFragmentIterator DataSource::GetFragments(std::shared_ptr<ScanOptions> scan_options) {
   std::shared_ptr<ScanOptions> simplified_scan_options;
   if (!AssumePartitionExpression(scan_options, &simplified_scan_options)) {
+    if (scan_options->metrics != nullptr) {
+      ++scan_options->metrics->sources_pruned_by_partition;
+    }
     return MakeEmptyIterator<std::shared_ptr<DataFragment>>();
   }
   return GetFragmentsImpl(std::move(simplified_scan_options));
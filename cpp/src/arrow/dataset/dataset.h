@@ -29,6 +29,25 @@
 namespace arrow {
 namespace dataset {
 
+/// \brief Aggregates of the rows of a scan which satisfy its filter
+struct ARROW_DS_EXPORT ScanSummary {
+  explicit ScanSummary(size_t num_columns = 0) : min(num_columns), max(num_columns) {}
+
+  /// The number of rows
+  int64_t num_rows = 0;
+
+  /// The min and max of the non-null values of each summarized column, null if
+  /// none of the rows has a value
+  std::vector<std::shared_ptr<Scalar>> min, max;
+
+  /// \brief Merge the summary of other rows, of the same columns
+  Status Merge(const ScanSummary& other);
+
+  /// \brief Merge the bounds of other values of column i, null if there are none
+  Status MergeBounds(size_t i, const std::shared_ptr<Scalar>& other_min,
+                     const std::shared_ptr<Scalar>& other_max);
+};
+
 /// \brief A granular piece of a Dataset, such as an individual file,
 /// which can be read/scanned separately from other fragments.
 ///
@@ -44,6 +63,15 @@ class ARROW_DS_EXPORT DataFragment {
   /// scanning
   virtual bool splittable() const = 0;
 
+  /// \brief Summarize the rows of this DataFragment which satisfy the filter of
+  /// its scan options from its metadata, without reading them.
+  ///
+  /// \param[in] columns the columns whose values are bounded
+  /// \return the summary, or null if the metadata does not determine it, in which
+  /// case the DataFragment must be scanned. The default implementation returns null.
+  virtual Result<std::shared_ptr<ScanSummary>> Summarize(
+      const std::vector<std::string>& columns);
+
   /// \brief Filtering, schema reconciliation, and partition options to use when
   /// scanning this fragment. May be nullptr, which indicates that no filtering
   /// or schema reconciliation will be performed and all partitions will be
@@ -26,6 +26,7 @@
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/stl.h"
 #include "arrow/testing/generator.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/optional.h"
 
 namespace arrow {
@@ -229,6 +230,45 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, BatchesOfVaryingLengthsAndSchemas) {
+  auto to_schema = schema({field("i32", int32()), field("f64", float64())});
+  RecordBatchProjector projector(to_schema);
+
+  auto AssertProjected = [&](const std::shared_ptr<RecordBatch>& batch) {
+    ASSERT_OK_AND_ASSIGN(auto projected, projector.Project(*batch));
+    ASSERT_EQ(projected->num_rows(), batch->num_rows());
+    for (int i = 0; i < to_schema->num_fields(); ++i) {
+      auto column = batch->GetColumnByName(to_schema->field(i)->name());
+      if (column != nullptr) {
+        AssertArraysEqual(*column, *projected->column(i));
+      } else {
+        ASSERT_EQ(projected->column(i)->null_count(), batch->num_rows());
+      }
+    }
+  };
+
+  auto f64_schema = schema({field("f64", float64())});
+  AssertProjected(ConstantArrayGenerator::Zeroes(8, f64_schema));
+  AssertProjected(ConstantArrayGenerator::Zeroes(3, f64_schema));
+  AssertProjected(ConstantArrayGenerator::Zeroes(16, f64_schema));
+  // An equal schema which is another object
+  AssertProjected(ConstantArrayGenerator::Zeroes(16, schema({field("f64", float64())})));
+
+  // "f64" becomes missing, "i32" is not
+  auto i32_schema = schema({field("i32", int32())});
+  AssertProjected(ConstantArrayGenerator::Zeroes(4, i32_schema));
+  AssertProjected(ConstantArrayGenerator::Zeroes(32, i32_schema));
+
+  AssertProjected(ConstantArrayGenerator::Zeroes(5, f64_schema));
+
+  // A default value replaces the nulls which were materialized before
+  ASSERT_OK(projector.SetDefaultValue(0, std::make_shared<Int32Scalar>(3)));
+  ASSERT_OK_AND_ASSIGN(auto projected,
+                       projector.Project(*ConstantArrayGenerator::Zeroes(5, f64_schema)));
+  ASSERT_EQ(projected->column(0)->null_count(), 0);
+  ASSERT_EQ(internal::checked_cast<const Int32Array&>(*projected->column(0)).Value(4), 3);
+}
+
 class TestEndToEnd : public TestDataset {
   void SetUp() {
     bool nullable = false;
@@ -18,6 +18,7 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -27,10 +28,22 @@
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -55,6 +68,33 @@ FileSystemDataSourceDiscovery::FileSystemDataSourceDiscovery(
       format_(std::move(format)),
       options_(std::move(options)) {}
 
+namespace {
+
+// Call func(i) for i in [0, num_files), in parallel on the I/O thread pool if
+// use_threads is set since the calls are expected to block on reads
+template <typename Function>
+Status ForEachFile(bool use_threads, size_t num_files, Function&& func) {
+  if (!use_threads || num_files <= 1) {
+    for (size_t i = 0; i < num_files; ++i) {
+      RETURN_NOT_OK(func(i));
+    }
+    return Status::OK();
+  }
+
+  auto pool = internal::GetIOThreadPool();
+  std::vector<std::future<Status>> futures(num_files);
+  for (size_t i = 0; i < num_files; ++i) {
+    ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(func, i));
+  }
+  Status st;
+  for (auto& future : futures) {
+    st &= future.get();
+  }
+  return st;
+}
+
+}  // namespace
+
 bool StartsWithAnyOf(const std::vector<std::string>& prefixes, const std::string& path) {
   if (prefixes.empty()) {
     return false;
@@ -74,27 +114,35 @@ Result<fs::PathForest> FileSystemDataSourceDiscovery::Filter(
     const std::shared_ptr<fs::FileSystem>& filesystem,
     const std::shared_ptr<FileFormat>& format, const FileSystemDiscoveryOptions& options,
     fs::PathForest forest) {
-  fs::FileStatsVector out;
-
-  auto& stats = forest.stats();
+  std::vector<int> kept;
   RETURN_NOT_OK(forest.Visit([&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
-    const auto& path = ref.stats().path();
-
-    if (StartsWithAnyOf(options.ignore_prefixes, path)) {
+    if (StartsWithAnyOf(options.ignore_prefixes, ref.stats().path())) {
       return fs::PathForest::Prune;
     }
+    kept.push_back(ref.i);
+    return fs::PathForest::Continue;
+  }));
 
-    if (ref.stats().IsFile() && options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem.get())));
-      if (!supported) {
-        return fs::PathForest::Continue;
+  auto& stats = forest.stats();
+  std::vector<char> supported(kept.size(), true);
+  if (options.exclude_invalid_files) {
+    RETURN_NOT_OK(ForEachFile(options.use_threads, kept.size(), [&](size_t i) -> Status {
+      if (!stats[kept[i]].IsFile()) {
+        return Status::OK();
       }
-    }
+      FileSource source(stats[kept[i]].path(), filesystem.get());
+      ARROW_ASSIGN_OR_RAISE(bool is_supported, format->IsSupported(source));
+      supported[i] = is_supported;
+      return Status::OK();
+    }));
+  }
 
-    out.push_back(std::move(stats[ref.i]));
-    return fs::PathForest::Continue;
-  }));
+  fs::FileStatsVector out;
+  for (size_t i = 0; i < kept.size(); ++i) {
+    if (supported[i]) {
+      out.push_back(std::move(stats[kept[i]]));
+    }
+  }
 
   return fs::PathForest::MakeFromPreSorted(std::move(out));
 }
@@ -151,6 +199,113 @@ Result<std::shared_ptr<DataSourceDiscovery>> FileSystemDataSourceDiscovery::Make
       filesystem, std::move(forest), std::move(format), std::move(options)));
 }
 
+namespace {
+
+const char kManifestSchemaKey[] = "ARROW:dataset:schema";
+const char kManifestBaseDirKey[] = "ARROW:dataset:partition_base_dir";
+
+std::shared_ptr<Schema> ManifestSchema(std::shared_ptr<const KeyValueMetadata> metadata) {
+  return schema({field("path", utf8(), false), field("type", int8(), false),
+                 field("size", int64(), false), field("mtime", int64(), false)},
+                std::move(metadata));
+}
+
+}  // namespace
+
+Result<std::shared_ptr<DataSourceDiscovery>>
+FileSystemDataSourceDiscovery::MakeFromManifest(
+    std::shared_ptr<fs::FileSystem> filesystem, const std::string& manifest_path,
+    std::shared_ptr<FileFormat> format, FileSystemDiscoveryOptions options) {
+  ARROW_ASSIGN_OR_RAISE(auto file, filesystem->OpenInputFile(manifest_path));
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  RETURN_NOT_OK(ipc::RecordBatchFileReader::Open(file, &reader));
+
+  auto metadata = reader->schema()->metadata();
+  const int schema_index =
+      metadata == nullptr ? -1 : metadata->FindKey(kManifestSchemaKey);
+  const int base_dir_index =
+      metadata == nullptr ? -1 : metadata->FindKey(kManifestBaseDirKey);
+  if (schema_index == -1 || base_dir_index == -1 ||
+      !reader->schema()->Equals(*ManifestSchema(nullptr), /*check_metadata=*/false)) {
+    return Status::Invalid("'", manifest_path, "' is not a dataset manifest");
+  }
+
+  std::shared_ptr<Schema> schema;
+  auto schema_buffer =
+      std::make_shared<Buffer>(util::base64_decode(metadata->value(schema_index)));
+  io::BufferReader schema_input(schema_buffer);
+  ipc::DictionaryMemo dictionary_memo;
+  RETURN_NOT_OK(ipc::ReadSchema(&schema_input, &dictionary_memo, &schema));
+
+  if (options.partition_base_dir.empty()) {
+    options.partition_base_dir = metadata->value(base_dir_index);
+  }
+
+  fs::FileStatsVector stats;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadRecordBatch(i, &batch));
+    const auto& paths = internal::checked_cast<const StringArray&>(*batch->column(0));
+    const auto& types = internal::checked_cast<const Int8Array&>(*batch->column(1));
+    const auto& sizes = internal::checked_cast<const Int64Array&>(*batch->column(2));
+    const auto& mtimes = internal::checked_cast<const Int64Array&>(*batch->column(3));
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      fs::FileStats file_stats;
+      file_stats.set_path(paths.GetString(row));
+      file_stats.set_type(static_cast<fs::FileType>(types.Value(row)));
+      file_stats.set_size(sizes.Value(row));
+      file_stats.set_mtime(fs::TimePoint(fs::TimePoint::duration(mtimes.Value(row))));
+      stats.push_back(std::move(file_stats));
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(stats)));
+  std::shared_ptr<FileSystemDataSourceDiscovery> discovery(
+      new FileSystemDataSourceDiscovery(std::move(filesystem), std::move(forest),
+                                        std::move(format), std::move(options)));
+  discovery->file_schemas_ = {std::move(schema)};
+  discovery->files_inspected_ = true;
+  return discovery;
+}
+
+Status FileSystemDataSourceDiscovery::WriteManifest(const std::string& manifest_path) {
+  ARROW_ASSIGN_OR_RAISE(auto schema, Inspect());
+
+  std::shared_ptr<Buffer> serialized_schema;
+  ipc::DictionaryMemo dictionary_memo;
+  RETURN_NOT_OK(ipc::SerializeSchema(*schema, &dictionary_memo, default_memory_pool(),
+                                     &serialized_schema));
+  auto metadata = key_value_metadata(
+      {kManifestSchemaKey, kManifestBaseDirKey},
+      {util::base64_encode(serialized_schema->data(),
+                           static_cast<unsigned int>(serialized_schema->size())),
+       options_.partition_base_dir});
+
+  StringBuilder paths;
+  Int8Builder types;
+  Int64Builder sizes, mtimes;
+  for (const auto& stats : forest_.stats()) {
+    RETURN_NOT_OK(paths.Append(stats.path()));
+    RETURN_NOT_OK(types.Append(static_cast<int8_t>(stats.type())));
+    RETURN_NOT_OK(sizes.Append(stats.size()));
+    RETURN_NOT_OK(mtimes.Append(stats.mtime().time_since_epoch().count()));
+  }
+  std::vector<std::shared_ptr<Array>> columns(4);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(types.Finish(&columns[1]));
+  RETURN_NOT_OK(sizes.Finish(&columns[2]));
+  RETURN_NOT_OK(mtimes.Finish(&columns[3]));
+  auto manifest_schema = ManifestSchema(std::move(metadata));
+  auto batch = RecordBatch::Make(manifest_schema, forest_.size(), std::move(columns));
+
+  ARROW_ASSIGN_OR_RAISE(auto sink, fs_->OpenOutputStream(manifest_path));
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::RecordBatchFileWriter::Open(sink.get(), manifest_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return sink->Close();
+}
+
 Result<std::shared_ptr<Schema>> FileSystemDataSourceDiscovery::PartitionSchema() {
   if (auto partition_scheme = options_.partition_scheme.scheme()) {
     return partition_scheme->schema();
@@ -169,15 +324,34 @@ Result<std::shared_ptr<Schema>> FileSystemDataSourceDiscovery::PartitionSchema()
 
 Result<std::vector<std::shared_ptr<Schema>>>
 FileSystemDataSourceDiscovery::InspectSchemas() {
-  std::vector<std::shared_ptr<Schema>> schemas;
+  if (!files_inspected_) {
+    std::vector<const fs::FileStats*> files;
+    for (const auto& f : forest_.stats()) {
+      if (f.IsFile()) files.push_back(&f);
+    }
 
-  for (const auto& f : forest_.stats()) {
-    if (!f.IsFile()) continue;
-    FileSource src(f.path(), fs_.get());
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(src));
-    schemas.push_back(schema);
+    // Sample the files evenly, starting with the first one
+    const auto num_files = static_cast<int64_t>(files.size());
+    int64_t num_inspected = options_.inspect_num_files;
+    if (num_inspected < 0 || num_inspected > num_files) {
+      num_inspected = num_files;
+    }
+    auto file_index = [&](size_t i) {
+      return static_cast<size_t>(static_cast<int64_t>(i) * num_files / num_inspected);
+    };
+
+    std::vector<std::shared_ptr<Schema>> file_schemas(num_inspected);
+    RETURN_NOT_OK(ForEachFile(options_.use_threads, file_schemas.size(),
+                              [&](size_t i) -> Status {
+                                FileSource src(files[file_index(i)]->path(), fs_.get());
+                                return format_->Inspect(src).Value(&file_schemas[i]);
+                              }));
+
+    file_schemas_ = std::move(file_schemas);
+    files_inspected_ = true;
   }
 
+  std::vector<std::shared_ptr<Schema>> schemas = file_schemas_;
   ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
   schemas.push_back(partition_schema);
 
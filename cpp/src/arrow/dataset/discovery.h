@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -113,11 +114,21 @@ struct FileSystemDiscoveryOptions {
 
   // Invalid files (via selector or explicitly) will be excluded by checking
   // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
+  // (in parallel if use_threads is set). Disabling this feature will skip the
   // IO, but unsupported files may be present in the DataSource
   // (resulting in an error at scan time).
   bool exclude_invalid_files = true;
 
+  // Number of files whose schema is read by InspectSchemas() and Inspect(),
+  // spread evenly over the discovered files. The first file is always
+  // inspected, so 1 trusts it to have the schema of the whole DataSource.
+  // A negative number inspects every file.
+  int64_t inspect_num_files = -1;
+
+  // Check and inspect files in parallel on the I/O thread pool. This hides the
+  // latency of filesystems such as S3 where each inspection is a blocking read.
+  bool use_threads = true;
+
   // Files matching one of the following prefix will be ignored by the
   // discovery process. This is matched to the basename of a path.
   //
@@ -165,6 +176,29 @@ class ARROW_DS_EXPORT FileSystemDataSourceDiscovery : public DataSourceDiscovery
       std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
       std::shared_ptr<FileFormat> format, FileSystemDiscoveryOptions options);
 
+  /// \brief Build a FileSystemDataSourceDiscovery from a manifest written by
+  /// WriteManifest(), without listing, checking or inspecting any file.
+  ///
+  /// The partition expressions are parsed from the paths of the manifest, so
+  /// options.partition_scheme must be the one the manifest was written with.
+  /// If options.partition_base_dir is not provided, it is the one of the
+  /// manifest.
+  ///
+  /// \param[in] filesystem passed to FileSystemDataSource
+  /// \param[in] manifest_path path of the manifest in filesystem
+  /// \param[in] format passed to FileSystemDataSource
+  /// \param[in] options see FileSystemDiscoveryOptions for more information.
+  static Result<std::shared_ptr<DataSourceDiscovery>> MakeFromManifest(
+      std::shared_ptr<fs::FileSystem> filesystem, const std::string& manifest_path,
+      std::shared_ptr<FileFormat> format, FileSystemDiscoveryOptions options);
+
+  /// \brief Write the discovered files and the inspected schema to a manifest
+  ///
+  /// The manifest is an Arrow IPC file with a row per file or directory (path,
+  /// type, size and modification time). The schema returned by Inspect() and
+  /// the partition_base_dir are stored in its metadata.
+  Status WriteManifest(const std::string& manifest_path);
+
   Result<std::vector<std::shared_ptr<Schema>>> InspectSchemas() override;
 
   Result<std::shared_ptr<DataSource>> Finish(
@@ -186,6 +220,10 @@ class ARROW_DS_EXPORT FileSystemDataSourceDiscovery : public DataSourceDiscovery
   fs::PathForest forest_;
   std::shared_ptr<FileFormat> format_;
   FileSystemDiscoveryOptions options_;
+
+  // The schemas of the inspected files, read once by InspectSchemas()
+  std::vector<std::shared_ptr<Schema>> file_schemas_;
+  bool files_inspected_ = false;
 };
 
 }  // namespace dataset
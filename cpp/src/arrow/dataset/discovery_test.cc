@@ -17,7 +17,10 @@
 
 #include "arrow/dataset/discovery.h"
 
+#include <atomic>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -25,10 +28,13 @@
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_pointer_cast;
+
 class DataSourceDiscoveryTest : public TestFileSystemDataSource {
  public:
   void AssertInspect(const std::vector<std::shared_ptr<Field>>& expected_fields) {
@@ -244,5 +250,78 @@ TEST_F(FileSystemDataSourceDiscoveryTest, Inspect) {
   AssertInspect(s->fields());
 }
 
+TEST_F(FileSystemDataSourceDiscoveryTest, InspectSampledFilesOnce) {
+  std::atomic<int> num_inspections(0);
+  format_ = std::make_shared<JSONRecordBatchFileFormat>([&](const FileSource& source) {
+    ++num_inspections;
+    return schema({field(source.path(), int32())});
+  });
+  auto expected_schemas = [](std::vector<std::string> names) {
+    std::vector<std::shared_ptr<Schema>> schemas;
+    for (const auto& name : names) {
+      schemas.push_back(schema({field(name, int32())}));
+    }
+    // the (empty) partition schema
+    schemas.push_back(schema({}));
+    return schemas;
+  };
+  std::vector<fs::FileStats> files = {fs::File("a"), fs::File("b"), fs::File("c"),
+                                      fs::File("d")};
+
+  MakeDiscovery(files);
+  AssertInspectSchemas(expected_schemas({"a", "b", "c", "d"}));
+  ASSERT_EQ(num_inspections.load(), 4);
+  // Inspected schemas are cached
+  AssertInspect({field("a", int32()), field("b", int32()), field("c", int32()),
+                 field("d", int32())});
+  ASSERT_EQ(num_inspections.load(), 4);
+
+  num_inspections = 0;
+  discovery_options_.inspect_num_files = 2;
+  discovery_options_.use_threads = false;
+  MakeDiscovery(files);
+  AssertInspectSchemas(expected_schemas({"a", "c"}));
+  ASSERT_EQ(num_inspections.load(), 2);
+
+  // Trust the first file
+  num_inspections = 0;
+  discovery_options_.inspect_num_files = 1;
+  MakeDiscovery(files);
+  AssertInspect({field("a", int32())});
+  ASSERT_EQ(num_inspections.load(), 1);
+}
+
+TEST_F(FileSystemDataSourceDiscoveryTest, Manifest) {
+  std::atomic<int> num_inspections(0);
+  auto s = schema({field("f64", float64())});
+  format_ = std::make_shared<JSONRecordBatchFileFormat>([&](const FileSource&) {
+    ++num_inspections;
+    return s;
+  });
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  discovery_options_.partition_scheme = HivePartitionScheme::MakeDiscovery();
+  MakeDiscovery({fs::Dir("base/a=1"), fs::File("base/a=1/dat"), fs::Dir("base/a=2"),
+                 fs::File("base/a=2/dat")});
+  ASSERT_OK(checked_pointer_cast<FileSystemDataSourceDiscovery>(discovery_)
+                ->WriteManifest("_manifest"));
+  ASSERT_EQ(num_inspections.load(), 2);
+
+  // Reopening from the manifest neither lists nor inspects the files
+  ASSERT_OK(fs_->DeleteDirContents("base"));
+  ASSERT_OK_AND_ASSIGN(discovery_, FileSystemDataSourceDiscovery::MakeFromManifest(
+                                       fs_, "_manifest", format_, discovery_options_));
+  AssertInspect({field("f64", float64()), field("a", int32())});
+  ASSERT_EQ(num_inspections.load(), 2);
+  AssertFinishWithPaths({"base/a=1/dat", "base/a=2/dat"});
+
+  options_->filter = ("a"_ == 2).Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), {"base/a=2/dat"});
+
+  ASSERT_OK(fs_->CreateDir("not_a_manifest"));
+  ASSERT_RAISES(IOError, FileSystemDataSourceDiscovery::MakeFromManifest(
+                             fs_, "not_a_manifest", format_, discovery_options_));
+}
+
 }  // namespace dataset
 }  // namespace arrow
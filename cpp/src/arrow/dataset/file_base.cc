@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
@@ -39,10 +40,96 @@ Result<std::shared_ptr<arrow::io::RandomAccessFile>> FileSource::Open() const {
   return std::make_shared<::arrow::io::BufferReader>(buffer());
 }
 
+namespace {
+
+// A RandomAccessFile which counts the bytes read from another one
+class MeteredRandomAccessFile : public io::RandomAccessFile {
+ public:
+  MeteredRandomAccessFile(std::shared_ptr<io::RandomAccessFile> file,
+                          std::shared_ptr<ScanMetrics> metrics)
+      : file_(std::move(file)), metrics_(std::move(metrics)) {}
+
+  Status Close() override { return file_->Close(); }
+  Status Abort() override { return file_->Abort(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+  bool supports_zero_copy() const override { return file_->supports_zero_copy(); }
+
+  Result<util::string_view> Peek(int64_t nbytes) override { return file_->Peek(nbytes); }
+
+  Status WillNeed(const std::vector<io::ReadRange>& ranges) override {
+    return file_->WillNeed(ranges);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return Count(file_->Read(nbytes, out));
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return Count(file_->Read(nbytes));
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return Count(file_->ReadAt(position, nbytes, out));
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return Count(file_->ReadAt(position, nbytes));
+  }
+
+ private:
+  Result<int64_t> Count(Result<int64_t> bytes_read) {
+    if (bytes_read.ok()) {
+      metrics_->bytes_read += *bytes_read;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Count(Result<std::shared_ptr<Buffer>> buffer) {
+    if (buffer.ok()) {
+      metrics_->bytes_read += (*buffer)->size();
+    }
+    return buffer;
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file_;
+  std::shared_ptr<ScanMetrics> metrics_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<arrow::io::RandomAccessFile>> FileSource::Open(
+    std::shared_ptr<ScanMetrics> metrics) const {
+  ARROW_ASSIGN_OR_RAISE(auto file, Open());
+  if (metrics == nullptr || type() != PATH) {
+    return file;
+  }
+  return std::make_shared<MeteredRandomAccessFile>(std::move(file), std::move(metrics));
+}
+
+Result<std::unique_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options) const {
+  return Status::NotImplemented("Writing files of format ", type_name());
+}
+
+Result<std::shared_ptr<ScanSummary>> FileFormat::SummarizeFile(
+    const FileSource& source, const std::shared_ptr<ScanOptions>& options,
+    const std::vector<std::string>& columns) const {
+  return nullptr;
+}
+
 Result<ScanTaskIterator> FileDataFragment::Scan(std::shared_ptr<ScanContext> context) {
   return format_->ScanFile(source_, scan_options_, context);
 }
 
+Result<std::shared_ptr<ScanSummary>> FileDataFragment::Summarize(
+    const std::vector<std::string>& columns) {
+  return format_->SummarizeFile(source_, scan_options_, columns);
+}
+
 FileSystemDataSource::FileSystemDataSource(std::shared_ptr<fs::FileSystem> filesystem,
                                            fs::PathForest forest,
                                            ExpressionVector file_partitions,
@@ -51,9 +138,9 @@ FileSystemDataSource::FileSystemDataSource(std::shared_ptr<fs::FileSystem> files
     : DataSource(std::move(source_partition)),
       filesystem_(std::move(filesystem)),
       forest_(std::move(forest)),
-      partitions_(std::move(file_partitions)),
+      partitions_(std::make_shared<ExpressionVector>(std::move(file_partitions))),
       format_(std::move(format)) {
-  DCHECK_EQ(static_cast<size_t>(forest_.size()), partitions_.size());
+  DCHECK_EQ(static_cast<size_t>(forest_.size()), partitions_->size());
 }
 
 Result<std::shared_ptr<DataSource>> FileSystemDataSource::Make(
@@ -92,8 +179,9 @@ std::string FileSystemDataSource::ToString() const {
   DCHECK_OK(forest_.Visit([&](fs::PathForest::Ref ref) {
     repr += "\n" + ref.stats().path();
 
-    if (!partitions_[ref.i]->Equals(true)) {
-      repr += ": " + partitions_[ref.i]->ToString();
+    const auto& partition = (*partitions_)[ref.i];
+    if (!partition->Equals(true)) {
+      repr += ": " + partition->ToString();
     }
 
     return Status::OK();
@@ -128,56 +216,112 @@ util::optional<std::pair<std::string, std::shared_ptr<Scalar>>> GetKey(
       internal::checked_cast<const ScalarExpression&>(*cmp.right_operand()).value());
 }
 
-DataFragmentIterator FileSystemDataSource::GetFragmentsImpl(
-    std::shared_ptr<ScanOptions> root_options) {
-  DataFragmentVector fragments;
-  std::vector<std::shared_ptr<ScanOptions>> options(forest_.size());
-
-  auto collect_fragments = [&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
-    auto partition = partitions_[ref.i];
-
-    // if available, copy parent's filter and projector
-    // (which are appropriately simplified and loaded with default values)
-    if (auto parent = ref.parent()) {
-      options[ref.i].reset(new ScanOptions(*options[parent.i]));
-    } else {
-      options[ref.i].reset(new ScanOptions(*root_options));
+namespace {
+
+// Lazily yields the fragments of the files of a forest, in depth first order.
+//
+// The filter is simplified by the partition expression of each node and the
+// subtrees where it can't be satisfied are skipped. Nodes whose partition
+// expression is trivially true share the ScanOptions of their parent, and only
+// the options of the ancestors of the current node are kept.
+class FileSystemFragmentGenerator {
+ public:
+  FileSystemFragmentGenerator(fs::PathForest forest,
+                              std::shared_ptr<const ExpressionVector> partitions,
+                              std::shared_ptr<fs::FileSystem> filesystem,
+                              std::shared_ptr<FileFormat> format,
+                              std::shared_ptr<ScanOptions> root_options)
+      : forest_(std::move(forest)),
+        partitions_(std::move(partitions)),
+        filesystem_(std::move(filesystem)),
+        format_(std::move(format)),
+        root_options_(std::move(root_options)) {
+    if (!Satisfiable(*root_options_->filter)) {
+      i_ = forest_.size();
     }
+  }
 
-    // simplify filter by partition information
-    auto filter = options[ref.i]->filter->Assume(partition);
-    options[ref.i]->filter = filter;
+  Result<std::shared_ptr<DataFragment>> Next() {
+    while (i_ < forest_.size()) {
+      auto ref = forest_[i_];
+      const int end_of_subtree = i_ + ref.num_descendants() + 1;
 
-    if (filter->IsNull() || filter->Equals(false)) {
-      // directories (and descendants) which can't satisfy the filter are pruned
-      return fs::PathForest::Prune;
-    }
+      while (!ancestors_.empty() && ancestors_.back().first <= i_) {
+        ancestors_.pop_back();
+      }
+      auto options = ancestors_.empty() ? root_options_ : ancestors_.back().second;
+
+      const auto& partition = (*partitions_)[i_];
+      if (!partition->Equals(true)) {
+        // simplify filter by partition information
+        auto filter = options->filter->Assume(partition);
+        if (!Satisfiable(*filter)) {
+          // directories (and descendants) which can't satisfy the filter are pruned
+          if (options->metrics != nullptr) {
+            options->metrics->fragments_pruned_by_partition += CountFiles(end_of_subtree);
+          }
+          i_ = end_of_subtree;
+          continue;
+        }
+
+        options = std::make_shared<ScanOptions>(*options);
+        options->filter = std::move(filter);
+
+        // if possible, extract a partition key and pass it to the projector
+        if (auto name_value = GetKey(*partition)) {
+          auto index = options->projector.schema()->GetFieldIndex(name_value->first);
+          if (index != -1) {
+            RETURN_NOT_OK(options->projector.SetDefaultValue(
+                index, std::move(name_value->second)));
+          }
+        }
+      }
 
-    // if possible, extract a partition key and pass it to the projector
-    auto projector = &options[ref.i]->projector;
-    if (auto name_value = GetKey(*partition)) {
-      auto index = projector->schema()->GetFieldIndex(name_value->first);
-      if (index != -1) {
-        RETURN_NOT_OK(projector->SetDefaultValue(index, std::move(name_value->second)));
+      ++i_;
+      if (ref.stats().IsFile()) {
+        // generate a fragment for this file
+        FileSource src(ref.stats().path(), filesystem_.get());
+        return format_->MakeFragment(src, std::move(options));
+      }
+      if (end_of_subtree > i_) {
+        ancestors_.emplace_back(end_of_subtree, std::move(options));
       }
     }
 
-    if (ref.stats().IsFile()) {
-      // generate a fragment for this file
-      FileSource src(ref.stats().path(), filesystem_.get());
-      ARROW_ASSIGN_OR_RAISE(auto fragment, format_->MakeFragment(src, options[ref.i]));
-      fragments.push_back(std::move(fragment));
-    }
+    return IterationTraits<std::shared_ptr<DataFragment>>::End();
+  }
 
-    return fs::PathForest::Continue;
-  };
+ private:
+  static bool Satisfiable(const Expression& filter) {
+    return !filter.IsNull() && !filter.Equals(false);
+  }
 
-  auto status = forest_.Visit(collect_fragments);
-  if (!status.ok()) {
-    return MakeErrorIterator<std::shared_ptr<DataFragment>>(status);
+  // The number of files from the current node to the end of its subtree
+  int64_t CountFiles(int end_of_subtree) const {
+    int64_t count = 0;
+    for (int i = i_; i < end_of_subtree; ++i) {
+      count += forest_[i].stats().IsFile();
+    }
+    return count;
   }
 
-  return MakeVectorIterator(std::move(fragments));
+  fs::PathForest forest_;
+  std::shared_ptr<const ExpressionVector> partitions_;
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<ScanOptions> root_options_;
+
+  int i_ = 0;
+  // (end of subtree, simplified options) of the directories above the current node
+  std::vector<std::pair<int, std::shared_ptr<ScanOptions>>> ancestors_;
+};
+
+}  // namespace
+
+DataFragmentIterator FileSystemDataSource::GetFragmentsImpl(
+    std::shared_ptr<ScanOptions> root_options) {
+  return DataFragmentIterator(FileSystemFragmentGenerator(
+      forest_, partitions_, filesystem_, format_, std::move(root_options)));
 }
 
 }  // namespace dataset
@@ -100,6 +100,11 @@ class ARROW_DS_EXPORT FileSource {
   /// \brief Get a RandomAccessFile which views this file source
   Result<std::shared_ptr<arrow::io::RandomAccessFile>> Open() const;
 
+  /// \brief Get a RandomAccessFile which views this file source, and adds the
+  /// bytes read from a filesystem to the bytes_read of metrics if not null
+  Result<std::shared_ptr<arrow::io::RandomAccessFile>> Open(
+      std::shared_ptr<ScanMetrics> metrics) const;
+
  private:
   struct PathAndFileSystem {
     std::string path;
@@ -126,6 +131,18 @@ class ARROW_DS_EXPORT FileWriteOptions : public WriteOptions {
   virtual std::string file_type() const = 0;
 };
 
+/// \brief A writer of record batches to a single file of some FileFormat
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a record batch with the schema the writer was made with
+  virtual Status Write(const RecordBatch& batch) = 0;
+
+  /// \brief Finish the file and close its destination
+  virtual Status Close() = 0;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat {
  public:
@@ -145,9 +162,26 @@ class ARROW_DS_EXPORT FileFormat {
       const FileSource& source, std::shared_ptr<ScanOptions> options,
       std::shared_ptr<ScanContext> context) const = 0;
 
+  /// \brief Summarize the rows of a file which satisfy the filter of options
+  /// from its metadata, see DataFragment::Summarize
+  ///
+  /// The default implementation returns null, the file must be scanned.
+  virtual Result<std::shared_ptr<ScanSummary>> SummarizeFile(
+      const FileSource& source, const std::shared_ptr<ScanOptions>& options,
+      const std::vector<std::string>& columns) const;
+
   /// \brief Open a fragment
   virtual Result<std::shared_ptr<DataFragment>> MakeFragment(
       const FileSource& location, std::shared_ptr<ScanOptions> options) = 0;
+
+  /// \brief Make a writer of files of this format
+  ///
+  /// \param[in] destination the stream the file is written to
+  /// \param[in] schema the schema of the written record batches
+  /// \param[in] options options specific to the format, or null for defaults
+  virtual Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<FileWriteOptions> options) const;
 };
 
 /// \brief A DataFragment that is stored in a file with a known format
@@ -161,6 +195,9 @@ class ARROW_DS_EXPORT FileDataFragment : public DataFragment {
 
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override;
 
+  Result<std::shared_ptr<ScanSummary>> Summarize(
+      const std::vector<std::string>& columns) override;
+
   const FileSource& source() const { return source_; }
   std::shared_ptr<FileFormat> format() const { return format_; }
 
@@ -232,7 +269,9 @@ class ARROW_DS_EXPORT FileSystemDataSource : public DataSource {
 
   std::shared_ptr<fs::FileSystem> filesystem_;
   fs::PathForest forest_;
-  ExpressionVector partitions_;
+  /// Partition expressions of the nodes of forest_, shared with the iterators
+  /// returned by GetFragments()
+  std::shared_ptr<const ExpressionVector> partitions_;
   std::shared_ptr<FileFormat> format_;
 };
 
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/csv/reader.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+static Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
+    const FileSource& source, const CsvFileFormat& format,
+    const csv::ConvertOptions& convert_options, MemoryPool* pool,
+    std::shared_ptr<ScanMetrics> metrics = NULLPTR) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open(std::move(metrics)));
+  return csv::StreamingReader::Make(pool, std::move(input), format.read_options,
+                                    format.parse_options, convert_options);
+}
+
+/// \brief A ScanTask which reads a whole CSV file
+class CsvScanTask : public ScanTask {
+ public:
+  CsvScanTask(FileSource source, CsvFileFormat format,
+              csv::ConvertOptions convert_options, std::shared_ptr<ScanOptions> options,
+              std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        format_(std::move(format)),
+        convert_options_(std::move(convert_options)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // The file is only opened once the ScanTask executes, as with parquet's
+    // RecordBatchReader
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, format_, convert_options_,
+                                                  context_->pool, options_->metrics));
+    return MakeFunctionIterator([reader] { return reader->Next(); });
+  }
+
+ private:
+  FileSource source_;
+  CsvFileFormat format_;
+  csv::ConvertOptions convert_options_;
+};
+
+Result<bool> CsvFileFormat::IsSupported(const FileSource& source) const {
+  auto maybe_schema = Inspect(source);
+  // Errors reading the file are reported, errors parsing it are not
+  if (!maybe_schema.ok() && maybe_schema.status().IsIOError()) {
+    return maybe_schema.status();
+  }
+  return maybe_schema.ok();
+}
+
+Result<std::shared_ptr<Schema>> CsvFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, *this,
+                                                csv::ConvertOptions::Defaults(),
+                                                default_memory_pool()));
+  return reader->schema();
+}
+
+Result<ScanTaskIterator> CsvFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  ARROW_ASSIGN_OR_RAISE(auto file_schema, Inspect(source));
+
+  // Only convert the materialized fields which are in the file, the others are
+  // materialized by the projector. Their types are those of the projection rather
+  // than the inferred ones.
+  auto convert_options = csv::ConvertOptions::Defaults();
+  auto& include_columns = convert_options.include_columns;
+  for (const auto& name : options->MaterializedFields()) {
+    if (file_schema->GetFieldByName(name) == nullptr ||
+        std::find(include_columns.begin(), include_columns.end(), name) !=
+            include_columns.end()) {
+      continue;
+    }
+    include_columns.push_back(name);
+    if (auto field = options->schema()->GetFieldByName(name)) {
+      convert_options.column_types[name] = field->type();
+    }
+  }
+  // An empty list would convert every column, while one is enough to count rows
+  if (include_columns.empty() && file_schema->num_fields() > 0) {
+    include_columns.push_back(file_schema->field(0)->name());
+  }
+
+  ScanTaskVector tasks{std::make_shared<CsvScanTask>(
+      source, *this, std::move(convert_options), std::move(options), std::move(context))};
+  return MakeVectorIterator(std::move(tasks));
+}
+
+Result<std::shared_ptr<DataFragment>> CsvFileFormat::MakeFragment(
+    const FileSource& source, std::shared_ptr<ScanOptions> options) {
+  return std::make_shared<CsvFragment>(
+      source, std::make_shared<CsvFileFormat>(*this), std::move(options));
+}
+
+}  // namespace dataset
+}  // namespace arrow
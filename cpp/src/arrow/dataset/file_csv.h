@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/csv/options.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A FileFormat implementation that reads from CSV files
+///
+/// A file is scanned by a single ScanTask, whose blocks are parsed and converted
+/// in parallel by a csv::StreamingReader (see csv::ReadOptions::use_threads).
+/// Only the columns of the projection and of the filter are converted, to the
+/// types of the fields of the projection if they are in it.
+class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return "csv"; }
+
+  /// \brief Return true if the header and the first block of the file can be parsed.
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file, inferred from its first block.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const override;
+
+  Result<std::shared_ptr<DataFragment>> MakeFragment(
+      const FileSource& source, std::shared_ptr<ScanOptions> options) override;
+
+  /// Options for parsing the files
+  csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+
+  /// Options for reading the files, e.g. their column names and block size
+  csv::ReadOptions read_options = csv::ReadOptions::Defaults();
+};
+
+class ARROW_DS_EXPORT CsvFragment : public FileDataFragment {
+ public:
+  CsvFragment(const FileSource& source, std::shared_ptr<CsvFileFormat> format,
+              std::shared_ptr<ScanOptions> options)
+      : FileDataFragment(source, std::move(format), std::move(options)) {}
+
+  bool splittable() const override { return false; }
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestCsvFileFormat : public testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource(std::string csv) {
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(csv)));
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> Scan(const FileSource& source) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, format_->ScanFile(source, opts_, ctx_));
+    for (auto maybe_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      EXPECT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+      for (auto maybe_batch : rb_it) {
+        EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        batches.push_back(std::move(batch));
+      }
+    }
+    return batches;
+  }
+
+ protected:
+  std::shared_ptr<CsvFileFormat> format_ = std::make_shared<CsvFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestCsvFileFormat, Inspect) {
+  auto source = GetFileSource("f64,i64,str\n1.5,1,a\n2.5,2,b\n");
+
+  ASSERT_OK_AND_ASSIGN(bool supported, format_->IsSupported(*source));
+  ASSERT_TRUE(supported);
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source));
+  AssertSchemaEqual(
+      *schema({field("f64", float64()), field("i64", int64()), field("str", utf8())}),
+      *actual);
+}
+
+TEST_F(TestCsvFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource("f64\n1.5\n2.5\n\n3.5\n");
+  opts_ = ScanOptions::Make(schema({field("f64", float64())}));
+
+  int64_t row_count = 0;
+  for (const auto& batch : Scan(*source)) {
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 3);
+}
+
+TEST_F(TestCsvFileFormat, ScanOnlyMaterializedColumns) {
+  auto source = GetFileSource("a,b,c\n1,x,2\n3,y,4\n");
+
+  // "b" is neither projected nor filtered on, "d" is not in the file and "a" is
+  // converted to the type of the projection rather than the inferred one
+  opts_ = ScanOptions::Make(schema({field("a", float64()), field("d", int32())}));
+  opts_->filter = ("c"_ > int64_t(0)).Copy();
+
+  auto batches = Scan(*source);
+  ASSERT_EQ(batches.size(), 1);
+  AssertSchemaEqual(*schema({field("a", float64()), field("c", int64())}),
+                    *batches[0]->schema());
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+}
+
+TEST_F(TestCsvFileFormat, ScanNoMaterializedColumns) {
+  auto source = GetFileSource("a,b\n1,x\n3,y\n5,z\n");
+
+  // One column is still read, to count rows
+  opts_ = ScanOptions::Make(schema({field("d", int32())}));
+
+  auto batches = Scan(*source);
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0]->num_columns(), 1);
+  ASSERT_EQ(batches[0]->num_rows(), 3);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_ipc.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+static Result<std::shared_ptr<io::RandomAccessFile>> OpenInput(
+    const FileSource& source, std::shared_ptr<ScanMetrics> metrics = NULLPTR) {
+  // Batches read from a memory map are zero-copy slices of it, no bytes are
+  // read from it until they are accessed so none are counted in the metrics
+  if (source.type() == FileSource::PATH && source.filesystem()->type_name() == "local") {
+    return io::MemoryMappedFile::Open(source.path(), io::FileMode::READ);
+  }
+  return source.Open(std::move(metrics));
+}
+
+static Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
+    const FileSource& source, std::shared_ptr<ScanMetrics> metrics = NULLPTR) {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, std::move(metrics)));
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  auto status = ipc::RecordBatchFileReader::Open(input, &reader);
+  if (!status.ok()) {
+    return Status::IOError("Could not open IPC input source '", source.path(),
+                           "': ", status.message());
+  }
+  return reader;
+}
+
+/// \brief A ScanTask which reads a record batch of an IPC file
+class IpcScanTask : public ScanTask {
+ public:
+  IpcScanTask(std::shared_ptr<ipc::RecordBatchFileReader> reader, int batch_index,
+              std::vector<int> included_fields, std::shared_ptr<ScanOptions> options,
+              std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        reader_(std::move(reader)),
+        batch_index_(batch_index),
+        included_fields_(std::move(included_fields)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader_->ReadRecordBatch(batch_index_, included_fields_, &batch));
+    return MakeVectorIterator(std::vector<std::shared_ptr<RecordBatch>>{batch});
+  }
+
+ private:
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int batch_index_;
+  std::vector<int> included_fields_;
+};
+
+Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source));
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  return ipc::RecordBatchFileReader::Open(input, &reader).ok();
+}
+
+Result<std::shared_ptr<Schema>> IpcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  return reader->schema();
+}
+
+Result<ScanTaskIterator> IpcFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, options->metrics));
+  auto schema = reader->schema();
+
+  // Only read the materialized fields which are in the file, the others are
+  // materialized by the projector. The number of rows of a batch is in its
+  // metadata, so no field needs to be read to count them.
+  std::vector<int> included_fields;
+  for (const auto& name : options->MaterializedFields()) {
+    auto index = schema->GetFieldIndex(name);
+    if (index != -1 && std::find(included_fields.begin(), included_fields.end(),
+                                 index) == included_fields.end()) {
+      included_fields.push_back(index);
+    }
+  }
+  std::sort(included_fields.begin(), included_fields.end());
+
+  ScanTaskVector tasks;
+  if (reader->num_record_batches() == 0) {
+    return MakeVectorIterator(std::move(tasks));
+  }
+
+  // The reader shared by the ScanTasks loads the dictionaries of the file on
+  // its first read, do it now so that the ScanTasks can read concurrently
+  std::shared_ptr<RecordBatch> first_batch;
+  RETURN_NOT_OK(reader->ReadRecordBatch(0, {}, &first_batch));
+
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    tasks.push_back(
+        std::make_shared<IpcScanTask>(reader, i, included_fields, options, context));
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+Result<std::shared_ptr<DataFragment>> IpcFileFormat::MakeFragment(
+    const FileSource& source, std::shared_ptr<ScanOptions> options) {
+  return std::make_shared<IpcFragment>(source, std::move(options));
+}
+
+}  // namespace dataset
+}  // namespace arrow
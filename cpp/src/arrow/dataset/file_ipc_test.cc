@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_ipc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kBatchSize = 1UL << 10;
+constexpr int64_t kBatchRepetitions = 1 << 3;
+constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
+
+Status WriteIpcFile(std::shared_ptr<Schema> schema, io::OutputStream* sink) {
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema);
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::RecordBatchFileWriter::Open(sink, schema));
+  for (int64_t i = 0; i < kBatchRepetitions; ++i) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+class TestIpcFileFormat : public testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource() {
+    EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+    ARROW_EXPECT_OK(WriteIpcFile(schema_, sink.get()));
+    EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    return internal::make_unique<FileSource>(std::move(buffer));
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> Scan(const FileSource& source) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, format_->ScanFile(source, opts_, ctx_));
+    for (auto maybe_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      EXPECT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+      for (auto maybe_batch : rb_it) {
+        EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        batches.push_back(std::move(batch));
+      }
+    }
+    return batches;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("f64", float64()), field("i32", int32()), field("str", utf8())});
+  std::shared_ptr<IpcFileFormat> format_ = std::make_shared<IpcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestIpcFileFormat, Inspect) {
+  auto source = GetFileSource();
+
+  ASSERT_OK_AND_ASSIGN(bool supported, format_->IsSupported(*source));
+  ASSERT_TRUE(supported);
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source));
+  AssertSchemaEqual(*schema_, *actual);
+}
+
+TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  ASSERT_OK_AND_ASSIGN(bool supported, format_->IsSupported({buf}));
+  ASSERT_FALSE(supported);
+
+  auto result = format_->Inspect({buf});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, testing::HasSubstr("<Buffer>"),
+                                  result.status());
+}
+
+TEST_F(TestIpcFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema_);
+
+  int64_t row_count = 0;
+  auto batches = Scan(*source);
+  ASSERT_EQ(static_cast<int64_t>(batches.size()), kBatchRepetitions);
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*schema_, *batch->schema());
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestIpcFileFormat, ScanOnlyMaterializedColumns) {
+  auto source = GetFileSource();
+
+  // "f64" is neither projected nor filtered on, "missing" is not in the file
+  opts_ = ScanOptions::Make(schema({field("str", utf8()), field("missing", int8())}));
+  opts_->filter = ("i32"_ > int32_t(0)).Copy();
+
+  int64_t row_count = 0;
+  for (const auto& batch : Scan(*source)) {
+    // The fields are in the order of the file
+    AssertSchemaEqual(*schema({field("i32", int32()), field("str", utf8())}),
+                      *batch->schema());
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestIpcFileFormat, ScanNoMaterializedColumns) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema({field("missing", int8())}));
+
+  // The number of rows is known without reading any column
+  int64_t row_count = 0;
+  for (const auto& batch : Scan(*source)) {
+    ASSERT_EQ(batch->num_columns(), 0);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestIpcFileFormat, ScanMemoryMappedLocalFile) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, internal::TemporaryDir::Make("test-ipc-"));
+  auto path = temp_dir->path().ToString() + "data.arrow";
+  {
+    ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(path));
+    ASSERT_OK(WriteIpcFile(schema_, sink.get()));
+    ASSERT_OK(sink->Close());
+  }
+
+  fs::LocalFileSystem localfs;
+  FileSource source(path, &localfs);
+  opts_ = ScanOptions::Make(schema({field("f64", float64())}));
+
+  int64_t row_count = 0;
+  for (const auto& batch : Scan(source)) {
+    ASSERT_EQ(batch->num_columns(), 1);
+    // Buffers read from a memory map are views of it, which can't be written
+    ASSERT_FALSE(batch->column_data(0)->buffers[1]->is_mutable());
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/scalar.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+using adapters::orc::ORCFileReader;
+using adapters::orc::StripeColumnStatistics;
+
+static Result<std::unique_ptr<ORCFileReader>> OpenReader(
+    const FileSource& source, MemoryPool* pool,
+    std::shared_ptr<ScanMetrics> metrics = NULLPTR) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open(std::move(metrics)));
+  std::unique_ptr<ORCFileReader> reader;
+  auto status = ORCFileReader::Open(input, pool, &reader);
+  if (!status.ok()) {
+    return Status::IOError("Could not open ORC input source '", source.path(),
+                           "': ", status.message());
+  }
+  return std::move(reader);
+}
+
+/// \brief A ScanTask which reads a stripe of an ORC file
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(FileSource source, int64_t stripe, std::vector<int> included_fields,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        stripe_(stripe),
+        included_fields_(std::move(included_fields)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // liborc readers are not meant to be shared between threads, each ScanTask
+    // opens its own
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          OpenReader(source_, context_->pool, options_->metrics));
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadStripe(stripe_, included_fields_, &batch));
+    return MakeVectorIterator(std::vector<std::shared_ptr<RecordBatch>>{batch});
+  }
+
+ private:
+  FileSource source_;
+  int64_t stripe_;
+  std::vector<int> included_fields_;
+};
+
+// An expression which holds for every row of a stripe, given the statistics of
+// the fields referenced by a filter
+static std::shared_ptr<Expression> StripeStatisticsAsExpression(
+    const Schema& schema, const std::vector<StripeColumnStatistics>& statistics,
+    const std::unordered_set<std::string>& filter_fields) {
+  ExpressionVector expressions;
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    const auto& field = schema.field(static_cast<int>(i));
+    if (filter_fields.find(field->name()) == filter_fields.end()) {
+      continue;
+    }
+    auto field_expr = field_ref(field->name());
+    const auto& column = statistics[i];
+    if (column.num_values == 0 && column.has_null) {
+      expressions.push_back(equal(field_expr, scalar(MakeNullScalar(field->type()))));
+    } else if (column.min != nullptr && column.max != nullptr &&
+               column.min->type->Equals(*field->type()) &&
+               column.max->type->Equals(*field->type())) {
+      expressions.push_back(and_(greater_equal(field_expr, scalar(column.min)),
+                                 less_equal(field_expr, scalar(column.max))));
+    }
+  }
+  return expressions.empty() ? scalar(true) : and_(expressions);
+}
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  std::unique_ptr<ORCFileReader> reader;
+  return ORCFileReader::Open(input, default_memory_pool(), &reader).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, default_memory_pool()));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool, options->metrics));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+
+  // Only read the materialized fields which are in the file, the others are
+  // materialized by the projector. One field is enough to count rows.
+  std::vector<int> included_fields;
+  for (const auto& name : options->MaterializedFields()) {
+    auto index = schema->GetFieldIndex(name);
+    if (index != -1 && std::find(included_fields.begin(), included_fields.end(),
+                                 index) == included_fields.end()) {
+      included_fields.push_back(index);
+    }
+  }
+  if (included_fields.empty() && schema->num_fields() > 0) {
+    included_fields.push_back(0);
+  }
+  std::sort(included_fields.begin(), included_fields.end());
+
+  const auto& filter = options->filter;
+  auto fields = FieldsInExpression(*filter);
+  std::unordered_set<std::string> filter_fields(fields.begin(), fields.end());
+
+  ScanTaskVector tasks;
+  if (filter->Equals(false)) {
+    return MakeVectorIterator(std::move(tasks));
+  }
+  for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); ++stripe) {
+    // As with parquet statistics, errors are ignored and post-filtering applies
+    std::vector<StripeColumnStatistics> statistics;
+    if (!filter_fields.empty() &&
+        reader->ReadStripeStatistics(stripe, &statistics).ok()) {
+      auto expr = filter->Assume(
+          StripeStatisticsAsExpression(*schema, statistics, filter_fields));
+      if (expr->IsNull() || expr->Equals(false)) {
+        if (options->metrics != nullptr) {
+          ++options->metrics->row_groups_skipped;
+        }
+        continue;
+      }
+    }
+    tasks.push_back(
+        std::make_shared<OrcScanTask>(source, stripe, included_fields, options, context));
+  }
+  if (tasks.empty() && reader->NumberOfStripes() > 0 && options->metrics != nullptr) {
+    ++options->metrics->fragments_pruned_by_statistics;
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+Result<std::shared_ptr<DataFragment>> OrcFileFormat::MakeFragment(
+    const FileSource& source, std::shared_ptr<ScanOptions> options) {
+  return std::make_shared<OrcFragment>(source, std::move(options));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <orc/OrcFile.hh>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace liborc = orc;
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kStripeCount = 4;
+constexpr int64_t kStripeRowCount = 1024;
+
+class MemoryOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 1024; }
+
+  void write(const void* buf, size_t size) override {
+    auto bytes = reinterpret_cast<const char*>(buf);
+    data_.insert(data_.end(), bytes, bytes + size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  std::shared_ptr<Buffer> Finish() { return Buffer::FromString(std::move(data_)); }
+
+ private:
+  std::string data_;
+  std::string name_ = "MemoryOutputStream";
+};
+
+class TestOrcFileFormat : public testing::Test {
+ public:
+  // Write a file of two int columns "i32" and "j32", every stripe of which
+  // holds the values [stripe * kStripeRowCount, (stripe + 1) * kStripeRowCount)
+  std::unique_ptr<FileSource> GetFileSource() {
+    MemoryOutputStream stream;
+    ORC_UNIQUE_PTR<liborc::Type> type(
+        liborc::Type::buildTypeFromString("struct<i32:int,j32:int>"));
+
+    liborc::WriterOptions options;
+    // Stripes are flushed as soon as they exceed this size, i.e. on every add
+    options.setStripeSize(1024);
+    options.setCompressionBlockSize(1024);
+    options.setMemoryPool(liborc::getDefaultPool());
+    options.setRowIndexStride(0);
+    auto writer = liborc::createWriter(*type, &stream, options);
+
+    auto batch = writer->createRowBatch(kStripeRowCount);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    for (int64_t stripe = 0; stripe < kStripeCount; ++stripe) {
+      for (auto field_batch : struct_batch->fields) {
+        auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(field_batch);
+        for (int64_t i = 0; i < kStripeRowCount; ++i) {
+          long_batch->data[i] = stripe * kStripeRowCount + i;
+        }
+        long_batch->numElements = kStripeRowCount;
+      }
+      struct_batch->numElements = kStripeRowCount;
+      writer->add(*batch);
+    }
+    writer->close();
+
+    return internal::make_unique<FileSource>(stream.Finish());
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> Scan(const FileSource& source) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, format_->ScanFile(source, opts_, ctx_));
+    for (auto maybe_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      EXPECT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+      for (auto maybe_batch : rb_it) {
+        EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        batches.push_back(std::move(batch));
+      }
+    }
+    return batches;
+  }
+
+ protected:
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  auto source = GetFileSource();
+
+  ASSERT_OK_AND_ASSIGN(bool supported, format_->IsSupported(*source));
+  ASSERT_TRUE(supported);
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source));
+  AssertSchemaEqual(*schema({field("i32", int32()), field("j32", int32())}), *actual);
+}
+
+TEST_F(TestOrcFileFormat, OpenFailureWithRelevantError) {
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  auto result = format_->Inspect({buf});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, testing::HasSubstr("<Buffer>"),
+                                  result.status());
+}
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema({field("i32", int32())}));
+
+  int64_t row_count = 0;
+  for (const auto& batch : Scan(*source)) {
+    // Only the projected column is read
+    ASSERT_EQ(batch->num_columns(), 1);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kStripeCount * kStripeRowCount);
+}
+
+TEST_F(TestOrcFileFormat, FilterStripesByStatistics) {
+  auto source = GetFileSource();
+  opts_ = ScanOptions::Make(schema({field("i32", int32())}));
+
+  auto CountStripes = [&](const Expression& filter) {
+    opts_->filter = filter.Copy();
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, format_->ScanFile(*source, opts_, ctx_));
+    int64_t stripe_count = 0;
+    for (auto maybe_task : scan_task_it) {
+      ARROW_EXPECT_OK(maybe_task.status());
+      ++stripe_count;
+    }
+    return stripe_count;
+  };
+
+  EXPECT_EQ(CountStripes(*scalar(true)), kStripeCount);
+  EXPECT_EQ(CountStripes(*scalar(false)), 0);
+  EXPECT_EQ(CountStripes("i32"_ < int32_t(0)), 0);
+  EXPECT_EQ(CountStripes("i32"_ < int32_t(kStripeRowCount)), 1);
+  EXPECT_EQ(CountStripes("j32"_ >= int32_t(2 * kStripeRowCount)), kStripeCount - 2);
+  EXPECT_EQ(CountStripes("i32"_ == int32_t(kStripeRowCount + 1)), 1);
+  EXPECT_EQ(CountStripes("i32"_ >= int32_t(kStripeRowCount) and
+                         "j32"_ < int32_t(2 * kStripeRowCount)),
+            1);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,7 +17,9 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -25,12 +27,18 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/properties.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -40,19 +48,36 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
+                  std::vector<int> predicate_columns,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
+        predicate_columns_(std::move(predicate_columns)),
         reader_(reader) {}
 
   Result<RecordBatchIterator> Execute() {
+    if (!predicate_columns_.empty()) {
+      std::shared_ptr<Table> table;
+      RETURN_NOT_OK(ReadSelectedRows(&table));
+      if (table != nullptr) {
+        auto batch_reader = std::make_shared<TableBatchReader>(*table);
+        batch_reader->set_chunksize(
+            parquet::default_arrow_reader_properties().batch_size());
+        return MakeFunctionIterator(
+            [table, batch_reader] { return batch_reader->Next(); });
+      }
+    }
+
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
@@ -68,33 +93,138 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // Read the columns of the filter and evaluate it first, then only the rows it
+  // selects of the other columns. Yields no table if the filter does not
+  // evaluate to a selection of rows, in which case it applies after reading.
+  Status ReadSelectedRows(std::shared_ptr<Table>* out) {
+    std::shared_ptr<Table> chunked_table, predicate_table;
+    RETURN_NOT_OK(reader_->ReadRowGroup(row_group_, predicate_columns_, &chunked_table));
+    RETURN_NOT_OK(chunked_table->CombineChunks(context_->pool, &predicate_table));
+    if (!options_->filter->Validate(*predicate_table->schema()).ok()) {
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> predicate_batch;
+    TableBatchReader table_reader(*predicate_table);
+    RETURN_NOT_OK(table_reader.ReadNext(&predicate_batch));
+    if (predicate_batch == nullptr) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto selection, options_->evaluator->Evaluate(
+                                              *options_->filter, *predicate_batch,
+                                              context_->pool));
+    if (!selection.is_array() || selection.type()->id() != Type::BOOL) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(predicate_batch,
+                          options_->evaluator->Filter(selection, predicate_batch,
+                                                      context_->pool));
+
+    std::vector<int> other_columns;
+    for (int column : column_projection_) {
+      if (std::find(predicate_columns_.begin(), predicate_columns_.end(), column) ==
+          predicate_columns_.end()) {
+        other_columns.push_back(column);
+      }
+    }
+    std::shared_ptr<Table> other_table;
+    RETURN_NOT_OK(reader_->ReadRowGroup(row_group_, other_columns,
+                                        BooleanArray(selection.array()), &other_table));
+
+    // The projector of the scanner matches columns by name, so their order
+    // does not matter
+    auto fields = predicate_batch->schema()->fields();
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (int i = 0; i < predicate_batch->num_columns(); ++i) {
+      columns.push_back(std::make_shared<ChunkedArray>(predicate_batch->column(i)));
+    }
+    for (int i = 0; i < other_table->num_columns(); ++i) {
+      fields.push_back(other_table->schema()->field(i));
+      columns.push_back(other_table->column(i));
+    }
+    *out = Table::Make(schema(fields), columns, predicate_batch->num_rows());
+    return Status::OK();
+  }
+
   int row_group_;
   std::vector<int> column_projection_;
+  // Columns of the filter, read before the others if not empty
+  std::vector<int> predicate_columns_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
 
-// Skip RowGroups with a filter and metadata
+template <typename M>
+static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
+  SchemaManifest manifest;
+  RETURN_NOT_OK(SchemaManifest::Make(
+      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
+  return manifest;
+}
+
+static std::shared_ptr<Expression> RowGroupStatisticsAsExpression(
+    const parquet::RowGroupMetaData& metadata, const SchemaManifest& manifest,
+    const std::unordered_set<std::string>& filter_fields);
+
+/// \brief A conjunct of a filter which only holds if a column contains one of
+/// the given values, i.e. `field == value` or `field.isin(values)`
+struct BloomFilterPredicate {
+  int column_index;
+  std::shared_ptr<Array> values;
+};
+
+static void BloomFilterPredicatesInExpression(
+    const Expression& expr, const SchemaManifest& manifest,
+    std::vector<BloomFilterPredicate>* out);
+
+static bool BloomFilterMayContainAny(const parquet::BloomFilter& bloom_filter,
+                                     parquet::Type::type physical_type,
+                                     const Array& values);
+
+// Skip RowGroups with a filter and metadata, and with the bloom filters of the
+// file if a reader is given. The filter of the RowGroups which are not skipped
+// is simplified by their statistics.
 class RowGroupSkipper {
  public:
   static constexpr int kIterationDone = -1;
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
-                  std::shared_ptr<Expression> filter)
-      : metadata_(std::move(metadata)), filter_(filter), row_group_idx_(0) {
+                  std::shared_ptr<Expression> filter,
+                  parquet::ParquetFileReader* reader = NULLPTR)
+      : metadata_(std::move(metadata)),
+        filter_(filter),
+        reader_(reader),
+        row_group_idx_(0) {
     num_row_groups_ = metadata_->num_row_groups();
+
+    // A trivial filter can't skip anything, don't bother with statistics
+    if (filter_->Equals(true)) {
+      return;
+    }
+    // Errors with statistics are ignored and post-filtering will apply.
+    auto maybe_manifest = GetSchemaManifest(*metadata_);
+    if (maybe_manifest.ok()) {
+      manifest_ = std::move(maybe_manifest).ValueOrDie();
+      auto fields = FieldsInExpression(*filter_);
+      filter_fields_.insert(fields.begin(), fields.end());
+      use_statistics_ = true;
+      if (reader_ != NULLPTR) {
+        BloomFilterPredicatesInExpression(*filter_, manifest_, &bloom_predicates_);
+      }
+    }
   }
 
-  int Next() {
+  /// \brief Return the index of the next RowGroup which can't be skipped, and
+  /// the filter to apply to its rows
+  int Next(std::shared_ptr<Expression>* row_group_filter) {
     while (row_group_idx_ < num_row_groups_) {
       const auto row_group_idx = row_group_idx_++;
-      const auto row_group = metadata_->RowGroup(row_group_idx);
 
-      const auto num_rows = row_group->num_rows();
-      if (CanSkip(*row_group)) {
-        rows_skipped_ += num_rows;
+      if (CanSkip(row_group_idx, row_group_filter)) {
+        rows_skipped_ += metadata_->RowGroup(row_group_idx)->num_rows();
+        ++row_groups_skipped_;
         continue;
       }
 
@@ -104,34 +234,107 @@ class RowGroupSkipper {
     return kIterationDone;
   }
 
+  int num_row_groups() const { return num_row_groups_; }
+
+  int row_groups_skipped() const { return row_groups_skipped_; }
+
  private:
-  bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
-    auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata);
-    // Errors with statistics are ignored and post-filtering will apply.
-    if (!maybe_stats_expr.ok()) {
+  bool CanSkip(int row_group_idx, std::shared_ptr<Expression>* row_group_filter) const {
+    *row_group_filter = filter_;
+    if (filter_->Equals(false)) {
+      return true;
+    }
+    if (!use_statistics_) {
       return false;
     }
 
-    auto stats_expr = maybe_stats_expr.ValueOrDie();
+    const auto row_group = metadata_->RowGroup(row_group_idx);
+    auto stats_expr = RowGroupStatisticsAsExpression(*row_group, manifest_, filter_fields_);
     auto expr = filter_->Assume(stats_expr);
-    return (expr->IsNull() || expr->Equals(false));
+    if (expr->IsNull() || expr->Equals(false)) {
+      return true;
+    }
+    if (CanSkipWithBloomFilters(row_group_idx)) {
+      return true;
+    }
+    // The statistics only bound the non-null values, so the filter can only be
+    // simplified if the columns it references have no nulls
+    if (!expr->Equals(*filter_) && FilterColumnsHaveNoNulls(*row_group)) {
+      *row_group_filter = std::move(expr);
+    }
+    return false;
+  }
+
+  // Whether every field of the filter is a column of the file without nulls in
+  // the RowGroup
+  bool FilterColumnsHaveNoNulls(const parquet::RowGroupMetaData& row_group) const {
+    size_t num_columns = 0;
+    for (const auto& schema_field : manifest_.schema_fields) {
+      if (filter_fields_.find(schema_field.field->name()) == filter_fields_.end()) {
+        continue;
+      }
+      if (!schema_field.is_leaf()) {
+        return false;
+      }
+      auto column_metadata = row_group.ColumnChunk(schema_field.column_index);
+      if (!column_metadata->is_stats_set()) {
+        return false;
+      }
+      auto statistics = column_metadata->statistics();
+      if (statistics == nullptr || statistics->null_count() != 0) {
+        return false;
+      }
+      ++num_columns;
+    }
+    return num_columns == filter_fields_.size();
+  }
+
+  // Bloom filters are only read once statistics failed to exclude the RowGroup,
+  // and before any of its pages is fetched
+  bool CanSkipWithBloomFilters(int row_group_idx) const {
+    if (bloom_predicates_.empty()) {
+      return false;
+    }
+    // As with statistics, errors are ignored and post-filtering will apply
+    try {
+      const auto row_group_metadata = metadata_->RowGroup(row_group_idx);
+      std::shared_ptr<parquet::RowGroupReader> row_group;
+      for (const auto& predicate : bloom_predicates_) {
+        const auto column_metadata =
+            row_group_metadata->ColumnChunk(predicate.column_index);
+        if (!column_metadata->has_bloom_filter()) {
+          continue;
+        }
+        if (row_group == nullptr) {
+          row_group = reader_->RowGroup(row_group_idx);
+        }
+        auto bloom_filter = row_group->GetBloomFilter(predicate.column_index);
+        if (bloom_filter != nullptr &&
+            !BloomFilterMayContainAny(*bloom_filter, column_metadata->type(),
+                                      *predicate.values)) {
+          return true;
+        }
+      }
+    } catch (const ::parquet::ParquetException&) {
+    }
+    return false;
   }
 
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<Expression> filter_;
+  // Not owned, nullptr if bloom filters are not read
+  parquet::ParquetFileReader* reader_;
+  // Only the statistics of the columns referenced by the filter are decoded
+  bool use_statistics_ = false;
+  SchemaManifest manifest_;
+  std::unordered_set<std::string> filter_fields_;
+  std::vector<BloomFilterPredicate> bloom_predicates_;
   int row_group_idx_;
   int num_row_groups_;
-  int64_t rows_skipped_;
+  int64_t rows_skipped_ = 0;
+  int row_groups_skipped_ = 0;
 };
 
-template <typename M>
-static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
-  SchemaManifest manifest;
-  RETURN_NOT_OK(SchemaManifest::Make(
-      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
-  return manifest;
-}
-
 class ParquetScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(
@@ -140,6 +343,7 @@ class ParquetScanTaskIterator {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, options);
+    auto predicate_columns = InferPredicateColumns(*metadata, options, column_projection);
 
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
@@ -147,19 +351,34 @@ class ParquetScanTaskIterator {
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(metadata), std::move(arrow_reader)));
+        std::move(predicate_columns), std::move(metadata), std::move(arrow_reader)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
-    auto row_group = skipper_.Next();
+    std::shared_ptr<Expression> row_group_filter;
+    auto row_group = skipper_.Next(&row_group_filter);
 
     // Iteration is done.
     if (row_group == RowGroupSkipper::kIterationDone) {
+      RecordMetrics();
       return nullptr;
     }
 
+    // The statistics of the RowGroup simplified the filter, possibly to true in
+    // which case its rows are read without being filtered
+    auto options = options_;
+    auto predicate_columns = predicate_columns_;
+    if (row_group_filter != options_->filter) {
+      options = std::make_shared<ScanOptions>(*options_);
+      options->filter = std::move(row_group_filter);
+      if (options->filter->Equals(true)) {
+        predicate_columns.clear();
+      }
+    }
+
     return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+        new ParquetScanTask(row_group, column_projection_, std::move(predicate_columns),
+                            reader_, std::move(options), context_));
   }
 
  private:
@@ -196,6 +415,40 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // The columns of the filter, if it only references top-level leaves of the
+  // file and some other column is projected. Otherwise none, and all columns
+  // are read before filtering.
+  static std::vector<int> InferPredicateColumns(
+      const parquet::FileMetaData& metadata, const std::shared_ptr<ScanOptions>& options,
+      const std::vector<int>& column_projection) {
+    if (options->filter->Equals(true)) {
+      return {};
+    }
+    auto maybe_manifest = GetSchemaManifest(metadata);
+    if (!maybe_manifest.ok()) {
+      return {};
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+
+    std::vector<int> predicate_columns;
+    for (const auto& name : FieldsInExpression(*options->filter)) {
+      auto it = std::find_if(
+          manifest.schema_fields.begin(), manifest.schema_fields.end(),
+          [&name](const SchemaField& field) { return field.field->name() == name; });
+      if (it == manifest.schema_fields.end() || !it->is_leaf()) {
+        return {};
+      }
+      if (std::find(predicate_columns.begin(), predicate_columns.end(),
+                    it->column_index) == predicate_columns.end()) {
+        predicate_columns.push_back(it->column_index);
+      }
+    }
+    if (predicate_columns.size() >= column_projection.size()) {
+      return {};
+    }
+    return predicate_columns;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -211,21 +464,65 @@ class ParquetScanTaskIterator {
   ParquetScanTaskIterator(std::shared_ptr<ScanOptions> options,
                           std::shared_ptr<ScanContext> context,
                           std::vector<int> column_projection,
+                          std::vector<int> predicate_columns,
                           std::shared_ptr<parquet::FileMetaData> metadata,
                           std::unique_ptr<parquet::arrow::FileReader> reader)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
-        skipper_(std::move(metadata), options_->filter),
+        predicate_columns_(std::move(predicate_columns)),
+        skipper_(std::move(metadata), options_->filter, reader->parquet_reader()),
         reader_(std::move(reader)) {}
 
+  // Account for the skipped RowGroups once, when iteration is done
+  void RecordMetrics() {
+    const auto& metrics = options_->metrics;
+    if (metrics == nullptr || metrics_recorded_) {
+      return;
+    }
+    metrics_recorded_ = true;
+    metrics->row_groups_skipped += skipper_.row_groups_skipped();
+    if (skipper_.num_row_groups() > 0 &&
+        skipper_.row_groups_skipped() == skipper_.num_row_groups()) {
+      ++metrics->fragments_pruned_by_statistics;
+    }
+  }
+
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
+  std::vector<int> predicate_columns_;
   RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  bool metrics_recorded_ = false;
 };
 
+std::shared_ptr<parquet::FileMetaData> ParquetMetadataCache::Get(
+    const std::string& path, fs::TimePoint mtime) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(path);
+  if (it == entries_.end() || it->second.first != mtime) {
+    return nullptr;
+  }
+  return it->second.second;
+}
+
+void ParquetMetadataCache::Put(const std::string& path, fs::TimePoint mtime,
+                               std::shared_ptr<parquet::FileMetaData> metadata) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_[path] = std::make_pair(mtime, std::move(metadata));
+}
+
+size_t ParquetMetadataCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+void ParquetMetadataCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
 Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
   try {
     ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
@@ -257,20 +554,168 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context) const {
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool, options->metrics));
   return ParquetScanTaskIterator::Make(options, context, std::move(reader));
 }
 
+// Bound the non-null values of a column chunk with its statistics, by null
+// scalars if it has none. Return false if the statistics do not bound them.
+static bool ColumnChunkBounds(const parquet::ColumnChunkMetaData& column_metadata,
+                              const DataType& type, std::shared_ptr<Scalar>* min,
+                              std::shared_ptr<Scalar>* max) {
+  if (!column_metadata.is_stats_set()) {
+    return false;
+  }
+  auto statistics = column_metadata.statistics();
+  if (statistics == nullptr) {
+    return false;
+  }
+  // num_values only counts non-null values
+  if (statistics->num_values() == 0) {
+    *min = *max = nullptr;
+    return true;
+  }
+  if (!statistics->HasMinMax() || !StatisticsAsScalars(*statistics, min, max).ok()) {
+    return false;
+  }
+  return (*min)->type->Equals(type) && (*max)->type->Equals(type);
+}
+
+Result<std::shared_ptr<ScanSummary>> ParquetFileFormat::SummarizeFile(
+    const FileSource& source, const std::shared_ptr<ScanOptions>& options,
+    const std::vector<std::string>& columns) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, default_memory_pool()));
+  auto metadata = reader->metadata();
+  auto maybe_manifest = GetSchemaManifest(*metadata);
+  if (!maybe_manifest.ok()) {
+    return nullptr;
+  }
+  auto manifest = std::move(maybe_manifest).ValueOrDie();
+
+  // Only leaf columns of the file have statistics, other columns (e.g. partition
+  // fields) must be scanned
+  std::vector<const SchemaField*> schema_fields;
+  for (const auto& name : columns) {
+    auto it = std::find_if(manifest.schema_fields.begin(), manifest.schema_fields.end(),
+                           [&name](const SchemaField& schema_field) {
+                             return schema_field.field->name() == name;
+                           });
+    if (it == manifest.schema_fields.end() || !it->is_leaf()) {
+      return nullptr;
+    }
+    schema_fields.push_back(&*it);
+  }
+
+  auto summary = std::make_shared<ScanSummary>(columns.size());
+  auto filter = options != nullptr ? options->filter : scalar(true);
+  RowGroupSkipper skipper(std::move(metadata), std::move(filter));
+  std::shared_ptr<Expression> row_group_filter;
+  for (int i = skipper.Next(&row_group_filter); i != RowGroupSkipper::kIterationDone;
+       i = skipper.Next(&row_group_filter)) {
+    // The statistics must guarantee that every row satisfies the filter
+    if (!row_group_filter->Equals(true)) {
+      return nullptr;
+    }
+    auto row_group = reader->metadata()->RowGroup(i);
+    summary->num_rows += row_group->num_rows();
+    for (size_t c = 0; c < schema_fields.size(); ++c) {
+      std::shared_ptr<Scalar> min, max;
+      if (!ColumnChunkBounds(*row_group->ColumnChunk(schema_fields[c]->column_index),
+                             *schema_fields[c]->field->type(), &min, &max)) {
+        return nullptr;
+      }
+      RETURN_NOT_OK(summary->MergeBounds(c, min, max));
+    }
+  }
+  return summary;
+}
+
 Result<std::shared_ptr<DataFragment>> ParquetFileFormat::MakeFragment(
     const FileSource& source, std::shared_ptr<ScanOptions> options) {
-  return std::make_shared<ParquetFragment>(source, options);
+  return std::make_shared<ParquetFragment>(
+      source, std::make_shared<ParquetFileFormat>(metadata_cache_), options);
+}
+
+class ParquetFileWriter : public FileWriter {
+ public:
+  ParquetFileWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::unique_ptr<parquet::arrow::FileWriter> writer,
+                    int64_t row_group_size)
+      : destination_(std::move(destination)),
+        writer_(std::move(writer)),
+        row_group_size_(row_group_size) {}
+
+  Status Write(const RecordBatch& batch) override {
+    std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns[i] = batch.column(i);
+    }
+    auto table = Table::Make(batch.schema(), columns, batch.num_rows());
+    return writer_->WriteTable(*table, row_group_size_);
+  }
+
+  Status Close() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+  int64_t row_group_size_;
+};
+
+Result<std::unique_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options) const {
+  auto parquet_options = std::make_shared<ParquetWriteOptions>();
+  if (options != nullptr) {
+    if (options->file_type() != type_name()) {
+      return Status::Invalid("Cannot write a Parquet file with options for ",
+                             options->file_type(), " files");
+    }
+    parquet_options = checked_pointer_cast<ParquetWriteOptions>(options);
+  }
+  auto properties = parquet_options->writer_properties;
+  if (properties == nullptr) {
+    properties = parquet::default_writer_properties();
+  }
+  auto arrow_properties = parquet_options->arrow_writer_properties;
+  if (arrow_properties == nullptr) {
+    arrow_properties = parquet::default_arrow_writer_properties();
+  }
+
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, default_memory_pool(),
+                                                 destination, properties,
+                                                 arrow_properties, &writer));
+  return std::unique_ptr<FileWriter>(new ParquetFileWriter(
+      std::move(destination), std::move(writer), parquet_options->row_group_size));
 }
 
 Result<std::unique_ptr<parquet::ParquetFileReader>> ParquetFileFormat::OpenReader(
-    const FileSource& source, MemoryPool* pool) const {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    const FileSource& source, MemoryPool* pool,
+    std::shared_ptr<ScanMetrics> metrics) const {
+  // Files without a modification time cannot be told apart from their
+  // previous versions, and are not cached
+  fs::TimePoint mtime = fs::kNoTime;
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  if (metadata_cache_ != nullptr && source.type() == FileSource::PATH) {
+    ARROW_ASSIGN_OR_RAISE(auto stats, source.filesystem()->GetTargetStats(source.path()));
+    mtime = stats.mtime();
+    if (mtime != fs::kNoTime) {
+      metadata = metadata_cache_->Get(source.path(), mtime);
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open(std::move(metrics)));
   try {
-    return parquet::ParquetFileReader::Open(input);
+    auto reader = parquet::ParquetFileReader::Open(
+        input, parquet::default_reader_properties(), metadata);
+    if (metadata == nullptr && mtime != fs::kNoTime) {
+      metadata_cache_->Put(source.path(), mtime, reader->metadata());
+    }
+    return std::move(reader);
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -305,8 +750,9 @@ static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
     return scalar(true);
   }
 
-  // Optimize for corner case where all values are nulls
-  if (statistics->num_values() == statistics->null_count()) {
+  // Optimize for corner case where all values are nulls (num_values only
+  // counts non-null values)
+  if (statistics->num_values() == 0 && statistics->null_count() > 0) {
     return equal(field_expr, scalar(MakeNullScalar(field->type())));
   }
 
@@ -315,10 +761,175 @@ static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
     return scalar(true);
   }
 
+  // The filter can only be simplified against scalars of the field's type
+  if (!min->type->Equals(*field->type()) || !max->type->Equals(*field->type())) {
+    return scalar(true);
+  }
+
   return and_(greater_equal(field_expr, scalar(min)),
               less_equal(field_expr, scalar(max)));
 }
 
+static void AddBloomFilterPredicate(const Expression& field_expr,
+                                    std::shared_ptr<Array> values,
+                                    const SchemaManifest& manifest,
+                                    std::vector<BloomFilterPredicate>* out) {
+  if (field_expr.type() != ExpressionType::FIELD) {
+    return;
+  }
+  const auto name = checked_cast<const FieldExpression&>(field_expr).name();
+  for (const auto& schema_field : manifest.schema_fields) {
+    // The values are hashed as the column's physical values, which requires
+    // them to have the exact type of the field
+    if (schema_field.is_leaf() && schema_field.field->name() == name &&
+        values->type()->Equals(*schema_field.field->type()) &&
+        values->null_count() == 0) {
+      out->push_back({schema_field.column_index, std::move(values)});
+      return;
+    }
+  }
+}
+
+static void BloomFilterPredicatesInExpression(const Expression& expr,
+                                              const SchemaManifest& manifest,
+                                              std::vector<BloomFilterPredicate>* out) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      BloomFilterPredicatesInExpression(*and_expr.left_operand(), manifest, out);
+      BloomFilterPredicatesInExpression(*and_expr.right_operand(), manifest, out);
+      break;
+    }
+    case ExpressionType::COMPARISON: {
+      const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+      if (cmp.op() != compute::CompareOperator::EQUAL) {
+        break;
+      }
+      const Expression* field_expr = cmp.left_operand().get();
+      const Expression* scalar_expr = cmp.right_operand().get();
+      if (field_expr->type() == ExpressionType::SCALAR) {
+        std::swap(field_expr, scalar_expr);
+      }
+      if (scalar_expr->type() != ExpressionType::SCALAR) {
+        break;
+      }
+      const auto& value = checked_cast<const ScalarExpression&>(*scalar_expr).value();
+      std::shared_ptr<Array> values;
+      if (value->is_valid && MakeArrayFromScalar(*value, 1, &values).ok()) {
+        AddBloomFilterPredicate(*field_expr, std::move(values), manifest, out);
+      }
+      break;
+    }
+    case ExpressionType::IN: {
+      const auto& in_expr = checked_cast<const InExpression&>(expr);
+      AddBloomFilterPredicate(*in_expr.operand(), in_expr.set(), manifest, out);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+template <typename PhysicalType, typename ArrayType>
+static bool BloomFilterMayContainAnyInteger(const parquet::BloomFilter& bloom_filter,
+                                            const Array& values) {
+  const auto& array = checked_cast<const ArrayType&>(values);
+  for (int64_t i = 0; i < array.length(); ++i) {
+    // Same conversion as the parquet writer's
+    if (bloom_filter.FindHash(
+            bloom_filter.Hash(static_cast<PhysicalType>(array.Value(i))))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename ArrayType>
+static bool BloomFilterMayContainAnyFloating(const parquet::BloomFilter& bloom_filter,
+                                             const Array& values) {
+  const auto& array = checked_cast<const ArrayType&>(values);
+  for (int64_t i = 0; i < array.length(); ++i) {
+    // 0.0 and -0.0 compare equal but have different hashes
+    if (array.Value(i) == 0 ||
+        bloom_filter.FindHash(bloom_filter.Hash(array.Value(i)))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool BloomFilterMayContainAnyBinary(const parquet::BloomFilter& bloom_filter,
+                                           const Array& values) {
+  const auto& array = checked_cast<const BinaryArray&>(values);
+  for (int64_t i = 0; i < array.length(); ++i) {
+    parquet::ByteArray value(array.GetView(i));
+    if (bloom_filter.FindHash(bloom_filter.Hash(&value))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Return false only if the bloom filter proves that none of the values is in the
+// column chunk. Values of a type which can't be hashed like the column's physical
+// values may always be contained.
+static bool BloomFilterMayContainAny(const parquet::BloomFilter& bloom_filter,
+                                     parquet::Type::type physical_type,
+                                     const Array& values) {
+  switch (values.type_id()) {
+    case Type::INT8:
+      return physical_type != parquet::Type::INT32 ||
+             BloomFilterMayContainAnyInteger<int32_t, Int8Array>(bloom_filter, values);
+    case Type::UINT8:
+      return physical_type != parquet::Type::INT32 ||
+             BloomFilterMayContainAnyInteger<int32_t, UInt8Array>(bloom_filter, values);
+    case Type::INT16:
+      return physical_type != parquet::Type::INT32 ||
+             BloomFilterMayContainAnyInteger<int32_t, Int16Array>(bloom_filter, values);
+    case Type::UINT16:
+      return physical_type != parquet::Type::INT32 ||
+             BloomFilterMayContainAnyInteger<int32_t, UInt16Array>(bloom_filter, values);
+    case Type::INT32:
+      return physical_type != parquet::Type::INT32 ||
+             BloomFilterMayContainAnyInteger<int32_t, Int32Array>(bloom_filter, values);
+    case Type::UINT32:
+      return physical_type != parquet::Type::INT32 ||
+             BloomFilterMayContainAnyInteger<int32_t, UInt32Array>(bloom_filter, values);
+    case Type::INT64:
+      return physical_type != parquet::Type::INT64 ||
+             BloomFilterMayContainAnyInteger<int64_t, Int64Array>(bloom_filter, values);
+    case Type::UINT64:
+      return physical_type != parquet::Type::INT64 ||
+             BloomFilterMayContainAnyInteger<int64_t, UInt64Array>(bloom_filter, values);
+    case Type::FLOAT:
+      return physical_type != parquet::Type::FLOAT ||
+             BloomFilterMayContainAnyFloating<FloatArray>(bloom_filter, values);
+    case Type::DOUBLE:
+      return physical_type != parquet::Type::DOUBLE ||
+             BloomFilterMayContainAnyFloating<DoubleArray>(bloom_filter, values);
+    case Type::STRING:
+    case Type::BINARY:
+      return physical_type != parquet::Type::BYTE_ARRAY ||
+             BloomFilterMayContainAnyBinary(bloom_filter, values);
+    default:
+      return true;
+  }
+}
+
+static std::shared_ptr<Expression> RowGroupStatisticsAsExpression(
+    const parquet::RowGroupMetaData& metadata, const SchemaManifest& manifest,
+    const std::unordered_set<std::string>& filter_fields) {
+  ExpressionVector expressions;
+  for (const auto& schema_field : manifest.schema_fields) {
+    if (filter_fields.find(schema_field.field->name()) == filter_fields.end()) {
+      continue;
+    }
+    expressions.emplace_back(ColumnChunkStatisticsAsExpression(schema_field, metadata));
+  }
+
+  return expressions.empty() ? scalar(true) : and_(expressions);
+}
+
 Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
     const parquet::RowGroupMetaData& metadata) {
   ARROW_ASSIGN_OR_RAISE(auto manifest, GetSchemaManifest(metadata));
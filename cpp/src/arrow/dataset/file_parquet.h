@@ -18,7 +18,10 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -28,6 +31,8 @@ namespace parquet {
 class ParquetFileReader;
 class RowGroupMetaData;
 class FileMetaData;
+class WriterProperties;
+class ArrowWriterProperties;
 }  // namespace parquet
 
 namespace arrow {
@@ -41,11 +46,53 @@ class ARROW_DS_EXPORT ParquetScanOptions : public FileScanOptions {
 class ARROW_DS_EXPORT ParquetWriteOptions : public FileWriteOptions {
  public:
   std::string file_type() const override { return "parquet"; }
+
+  /// Properties of the written files, or null for the defaults
+  std::shared_ptr<parquet::WriterProperties> writer_properties;
+  std::shared_ptr<parquet::ArrowWriterProperties> arrow_writer_properties;
+
+  /// Maximum number of rows of a row group. Each written batch starts a new
+  /// row group.
+  int64_t row_group_size = 64 * 1024;
+};
+
+/// \brief A cache of the metadata of Parquet files, keyed by path and
+/// modification time
+///
+/// Entries are replaced once their file changes. Paths are not qualified by
+/// their filesystem, so a cache should only be shared among formats scanning
+/// files of the same filesystem.
+class ARROW_DS_EXPORT ParquetMetadataCache {
+ public:
+  /// \brief Return the cached metadata of the file at path, or null if there
+  /// is none for this modification time
+  std::shared_ptr<parquet::FileMetaData> Get(const std::string& path,
+                                             fs::TimePoint mtime) const;
+
+  void Put(const std::string& path, fs::TimePoint mtime,
+           std::shared_ptr<parquet::FileMetaData> metadata);
+
+  /// \brief The number of cached files
+  size_t size() const;
+
+  void Clear();
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string,
+                     std::pair<fs::TimePoint, std::shared_ptr<parquet::FileMetaData>>>
+      entries_;
 };
 
 /// \brief A FileFormat implementation that reads from Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
+  /// \brief Create a format that reuses the metadata of the files in
+  /// metadata_cache, if given, across scans and fragments
+  explicit ParquetFileFormat(std::shared_ptr<ParquetMetadataCache> metadata_cache =
+                                 NULLPTR)
+      : metadata_cache_(std::move(metadata_cache)) {}
+
   std::string type_name() const override { return "parquet"; }
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -58,12 +105,32 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
                                     std::shared_ptr<ScanOptions> options,
                                     std::shared_ptr<ScanContext> context) const override;
 
+  /// \brief Summarize the file from the row counts and the column statistics of
+  /// its RowGroups. The statistics must resolve the filter of options, and bound
+  /// the values of the columns, for every RowGroup.
+  Result<std::shared_ptr<ScanSummary>> SummarizeFile(
+      const FileSource& source, const std::shared_ptr<ScanOptions>& options,
+      const std::vector<std::string>& columns) const override;
+
   Result<std::shared_ptr<DataFragment>> MakeFragment(
       const FileSource& source, std::shared_ptr<ScanOptions> options) override;
 
+  /// \brief Make a writer of Parquet files, options must be null or
+  /// ParquetWriteOptions
+  Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<FileWriteOptions> options) const override;
+
+  const std::shared_ptr<ParquetMetadataCache>& metadata_cache() const {
+    return metadata_cache_;
+  }
+
  private:
   Result<std::unique_ptr<::parquet::ParquetFileReader>> OpenReader(
-      const FileSource& source, MemoryPool* pool) const;
+      const FileSource& source, MemoryPool* pool,
+      std::shared_ptr<ScanMetrics> metrics = NULLPTR) const;
+
+  std::shared_ptr<ParquetMetadataCache> metadata_cache_;
 };
 
 class ARROW_DS_EXPORT ParquetFragment : public FileDataFragment {
@@ -71,6 +138,10 @@ class ARROW_DS_EXPORT ParquetFragment : public FileDataFragment {
   ParquetFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
       : FileDataFragment(source, std::make_shared<ParquetFileFormat>(), options) {}
 
+  ParquetFragment(const FileSource& source, std::shared_ptr<ParquetFileFormat> format,
+                  std::shared_ptr<ScanOptions> options)
+      : FileDataFragment(source, std::move(format), std::move(options)) {}
+
   bool splittable() const override { return true; }
 };
 
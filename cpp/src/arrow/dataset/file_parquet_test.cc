@@ -24,6 +24,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
@@ -46,12 +47,12 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
 
-Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+Status WriteRecordBatch(const RecordBatch& batch,
+                        parquet::arrow::FileWriter* writer) {
   auto schema = batch.schema();
   auto size = batch.num_rows();
 
@@ -69,7 +70,8 @@ Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
   return Status::OK();
 }
 
-Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+Status WriteRecordBatchReader(RecordBatchReader* reader,
+                              parquet::arrow::FileWriter* writer) {
   auto schema = reader->schema();
 
   if (!schema->Equals(*writer->schema(), false)) {
@@ -90,31 +92,35 @@ Status WriteRecordBatchReader(
     const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
     const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
         default_arrow_writer_properties()) {
-  std::unique_ptr<FileWriter> writer;
-  RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                 arrow_properties, &writer));
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*reader->schema(), pool, sink,
+                                                 properties, arrow_properties, &writer));
   RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
   return writer->Close();
 }
 
 class ArrowParquetWriterMixin : public ::testing::Test {
  public:
-  std::shared_ptr<Buffer> Write(std::vector<RecordBatchReader*> readers) {
+  std::shared_ptr<Buffer> Write(
+      std::vector<RecordBatchReader*> readers,
+      const std::shared_ptr<WriterProperties>& properties = default_writer_properties()) {
     auto pool = ::arrow::default_memory_pool();
 
     std::shared_ptr<Buffer> out;
     auto sink = CreateOutputStream(pool);
 
     for (auto reader : readers) {
-      ARROW_EXPECT_OK(WriteRecordBatchReader(reader, pool, sink));
+      ARROW_EXPECT_OK(WriteRecordBatchReader(reader, pool, sink, properties));
     }
     // XXX the rest of the test may crash if this fails, since out will be nullptr
     EXPECT_OK_AND_ASSIGN(out, sink->Finish());
     return out;
   }
 
-  std::shared_ptr<Buffer> Write(RecordBatchReader* reader) {
-    return Write(std::vector<RecordBatchReader*>{reader});
+  std::shared_ptr<Buffer> Write(
+      RecordBatchReader* reader,
+      const std::shared_ptr<WriterProperties>& properties = default_writer_properties()) {
+    return Write(std::vector<RecordBatchReader*>{reader}, properties);
   }
 
   std::shared_ptr<Buffer> Write(const Table& table) {
@@ -200,6 +206,44 @@ TEST_F(TestParquetFileFormat, OpenFailureWithRelevantError) {
                                   result.status());
 }
 
+TEST_F(TestParquetFileFormat, CacheMetadata) {
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+
+  const fs::TimePoint mtime(fs::TimePoint::duration(42));
+  auto filesystem = std::make_shared<fs::internal::MockFileSystem>(mtime);
+  ASSERT_OK_AND_ASSIGN(auto stream, filesystem->OpenOutputStream("data.parquet"));
+  ASSERT_OK(stream->Write(buffer->data(), buffer->size()));
+  ASSERT_OK(stream->Close());
+  FileSource source("data.parquet", filesystem.get());
+
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  auto format = std::make_shared<ParquetFileFormat>(cache);
+  ASSERT_OK_AND_ASSIGN(auto inspected, format->Inspect(source));
+  AssertSchemaEqual(*reader->schema(), *inspected);
+  ASSERT_EQ(1, cache->size());
+  auto metadata = cache->Get("data.parquet", mtime);
+  ASSERT_NE(nullptr, metadata);
+  ASSERT_EQ(nullptr, cache->Get("data.parquet", fs::TimePoint(fs::TimePoint::duration(43))));
+
+  // Fragments of the format scan with the cached metadata
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format->MakeFragment(source, opts_));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t row_count = 0;
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ASSERT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+    for (auto maybe_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+  }
+  ASSERT_EQ(row_count, kNumRows);
+  ASSERT_EQ(1, cache->size());
+  ASSERT_EQ(metadata, cache->Get("data.parquet", mtime));
+}
+
 TEST_F(TestParquetFileFormat, ScanRecordBatchReaderProjected) {
   schema_ = schema({field("f64", float64()), field("i64", int64()),
                     field("f32", float32()), field("i32", int32())});
@@ -394,5 +438,208 @@ TEST_F(TestParquetFileFormatPushDown, Basic) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormatPushDown, TemporalAndStringStatistics) {
+  // Each RecordBatch is written as a RowGroup, sorted on both columns:
+  // RowGroup `i` holds timestamps in [10 * i, 10 * i + 9] and strings "i*".
+  constexpr int64_t kNumRowGroups = 4;
+  auto ts_type = timestamp(TimeUnit::MILLI);
+  auto row_group_schema = schema({field("ts", ts_type), field("str", utf8())});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t i = 0; i < kNumRowGroups; i++) {
+    auto start = std::to_string(10 * i), end = std::to_string(10 * i + 9);
+    auto key = std::to_string(i);
+    batches.push_back(RecordBatchFromJSON(
+        row_group_schema, "[{\"ts\": " + start + ", \"str\": \"" + key + "a\"}," +
+                              " {\"ts\": " + end + ", \"str\": \"" + key + "z\"}]"));
+  }
+  BatchIterator reader(row_group_schema, batches);
+  auto source = GetFileSource(&reader);
+
+  opts_ = ScanOptions::Make(row_group_schema);
+  auto fragment = std::make_shared<ParquetFragment>(*source, opts_);
+
+  auto ts = [&](int64_t value) {
+    return scalar(std::make_shared<TimestampScalar>(value, ts_type));
+  };
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(*fragment, 2 * kNumRowGroups, kNumRowGroups);
+
+  opts_->filter = equal(field_ref("ts"), ts(15));
+  CountRowsAndBatchesInScan(*fragment, 2, 1);
+  opts_->filter = greater_equal(field_ref("ts"), ts(20));
+  CountRowsAndBatchesInScan(*fragment, 4, 2);
+  opts_->filter = less(field_ref("ts"), ts(0));
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+
+  opts_->filter = ("str"_ == "2m").Copy();
+  CountRowsAndBatchesInScan(*fragment, 2, 1);
+  opts_->filter = ("str"_ > "9").Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+}
+
+TEST_F(TestParquetFileFormatPushDown, BloomFilter) {
+  // RowGroup `i` holds the values {i, i + 10, 100}, so the statistics of all
+  // RowGroups overlap and only the bloom filters can tell them apart.
+  constexpr int64_t kNumRowGroups = 4;
+  auto row_group_schema = schema({field("i64", int64()), field("str", utf8())});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t i = 0; i < kNumRowGroups; i++) {
+    std::string json = "[";
+    for (int64_t value : {i, i + 10, int64_t(100)}) {
+      auto str = std::to_string(value);
+      json += "{\"i64\": " + str + ", \"str\": \"" + str + "\"},";
+    }
+    json.back() = ']';
+    batches.push_back(RecordBatchFromJSON(row_group_schema, json));
+  }
+  BatchIterator reader(row_group_schema, batches);
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  FileSource source(Write(&reader, properties));
+
+  opts_ = ScanOptions::Make(row_group_schema);
+  auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(*fragment, 3 * kNumRowGroups, kNumRowGroups);
+
+  opts_->filter = ("i64"_ == int64_t(12)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 3, 1);
+  opts_->filter = ("i64"_ == int64_t(50)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+  opts_->filter = ("i64"_ == int64_t(100)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 3 * kNumRowGroups, kNumRowGroups);
+
+  opts_->filter = ("str"_ == "13").Copy();
+  CountRowsAndBatchesInScan(*fragment, 3, 1);
+  opts_->filter = ("str"_ == "2" and "i64"_ == int64_t(13)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+
+  opts_->filter = "i64"_.In(ArrayFromJSON(int64(), "[1, 13]")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 6, 2);
+  opts_->filter = "str"_.In(ArrayFromJSON(utf8(), R"(["102", "20"])")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+
+  // Bloom filters can't prune other predicates
+  opts_->filter = ("i64"_ != int64_t(100)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 3 * kNumRowGroups, kNumRowGroups);
+}
+
+TEST_F(TestParquetFileFormatPushDown, LateMaterialization) {
+  // An evaluator lets the scan task read the filter's column first, and only
+  // the selected rows of the others
+  auto row_group_schema = schema({field("i64", int64()), field("str", utf8())});
+  std::string json = "[";
+  for (int64_t i = 0; i < 100; i++) {
+    json += "{\"i64\": " + std::to_string(i % 10) + ", \"str\": \"" +
+            std::to_string(i) + "\"},";
+  }
+  json.back() = ']';
+  BatchIterator reader(row_group_schema, {RecordBatchFromJSON(row_group_schema, json)});
+  FileSource source(Write(&reader));
+
+  opts_ = ScanOptions::Make(row_group_schema);
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+  opts_->filter = ("i64"_ == int64_t(3)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 10, 1);
+
+  ASSERT_OK_AND_ASSIGN(auto it, fragment->Scan(ctx_));
+  for (auto maybe_scan_task : it) {
+    ASSERT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+    ASSERT_OK_AND_ASSIGN(auto rb_it, scan_task->Execute());
+    for (auto maybe_record_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto record_batch, std::move(maybe_record_batch));
+      AssertArraysEqual(*ArrayFromJSON(int64(), "[3, 3, 3, 3, 3, 3, 3, 3, 3, 3]"),
+                        *record_batch->GetColumnByName("i64"));
+      AssertArraysEqual(
+          *ArrayFromJSON(utf8(),
+                         R"(["3", "13", "23", "33", "43", "53", "63", "73", "83", "93"])"),
+          *record_batch->GetColumnByName("str"));
+    }
+  }
+
+  // Statistics can't prune this RowGroup, but the selection is empty
+  opts_->filter = ("i64"_ > int64_t(3) and "i64"_ < int64_t(4)).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+}
+
+TEST_F(TestParquetFileFormatPushDown, StatisticsSimplifyFilter) {
+  auto row_group_schema = schema({field("i64", int64()), field("str", utf8())});
+  auto ScanTaskFilters = [&](const std::string& json) {
+    BatchIterator reader(row_group_schema,
+                         {RecordBatchFromJSON(row_group_schema, json)});
+    FileSource source(Write(&reader));
+    auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+    std::vector<std::shared_ptr<Expression>> filters;
+    EXPECT_OK_AND_ASSIGN(auto it, fragment->Scan(ctx_));
+    for (auto maybe_scan_task : it) {
+      EXPECT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+      filters.push_back(scan_task->options()->filter);
+    }
+    return filters;
+  };
+  const std::string json = R"([{"i64": 1, "str": "a"}, {"i64": 5, "str": "b"}])";
+  opts_ = ScanOptions::Make(row_group_schema);
+
+  // Statistics guarantee the filter: the rows are not filtered
+  opts_->filter = ("i64"_ >= int64_t(1)).Copy();
+  auto filters = ScanTaskFilters(json);
+  ASSERT_EQ(filters.size(), 1U);
+  ASSERT_TRUE(filters[0]->Equals(true));
+
+  // The conjunct guaranteed by the statistics is dropped
+  opts_->filter = ("i64"_ >= int64_t(1) and "str"_ == "b").Copy();
+  filters = ScanTaskFilters(json);
+  ASSERT_EQ(filters.size(), 1U);
+  ASSERT_EQ(FieldsInExpression(*filters[0]), std::vector<std::string>{"str"});
+
+  // Statistics don't bound the nulls, which the filter excludes
+  opts_->filter = ("i64"_ >= int64_t(1)).Copy();
+  filters = ScanTaskFilters(R"([{"i64": 1, "str": "a"}, {"i64": null, "str": "b"}])");
+  ASSERT_EQ(filters.size(), 1U);
+  ASSERT_TRUE(filters[0]->Equals(*opts_->filter));
+}
+
+TEST_F(TestParquetFileFormatPushDown, SummarizeFromStatistics) {
+  // RowGroup i has i rows whose "i64" is i, see the Basic test
+  constexpr int64_t kNumRowGroups = 16;
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+  opts_ = ScanOptions::Make(reader->schema());
+  auto fragment = std::make_shared<ParquetFragment>(*source, opts_);
+
+  ASSERT_OK_AND_ASSIGN(auto summary, fragment->Summarize({"i64"}));
+  ASSERT_NE(summary, nullptr);
+  ASSERT_EQ(summary->num_rows, kNumRowGroups * (kNumRowGroups + 1) / 2);
+  ASSERT_TRUE(summary->min[0]->Equals(*MakeScalar(int64_t(1))));
+  ASSERT_TRUE(summary->max[0]->Equals(*MakeScalar(kNumRowGroups)));
+
+  // RowGroups 1 to 5 are skipped, the others satisfy the filter
+  opts_->filter = ("i64"_ >= int64_t(6)).Copy();
+  ASSERT_OK_AND_ASSIGN(summary, fragment->Summarize({}));
+  ASSERT_NE(summary, nullptr);
+  ASSERT_EQ(summary->num_rows, kNumRowGroups * (kNumRowGroups + 1) / 2 - 15);
+
+  // Columns without statistics can't be summarized
+  ASSERT_OK_AND_ASSIGN(summary, fragment->Summarize({"not_in_file"}));
+  ASSERT_EQ(summary, nullptr);
+
+  // Nor can rows which only partly satisfy the filter
+  auto row_group_schema = schema({field("i64", int64())});
+  const std::string json = R"([{"i64": 1}, {"i64": 5}])";
+  BatchIterator batches(row_group_schema, {RecordBatchFromJSON(row_group_schema, json)});
+  FileSource partly(Write(&batches));
+  opts_ = ScanOptions::Make(row_group_schema);
+  opts_->filter = ("i64"_ >= int64_t(2)).Copy();
+  fragment = std::make_shared<ParquetFragment>(partly, opts_);
+  ASSERT_OK_AND_ASSIGN(summary, fragment->Summarize({"i64"}));
+  ASSERT_EQ(summary, nullptr);
+}
+
 }  // namespace dataset
 }  // namespace arrow
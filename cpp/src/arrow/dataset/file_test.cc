@@ -26,6 +26,7 @@
 #include "arrow/dataset/api.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/status.h"
@@ -78,6 +79,25 @@ TEST(FileSource, BufferBased) {
   ASSERT_EQ(Compression::LZ4, source2.compression());
 }
 
+TEST(FileSource, OpenWithMetrics) {
+  auto metrics = std::make_shared<ScanMetrics>();
+  fs::internal::MockFileSystem mockfs(fs::kNoTime);
+  ASSERT_OK(mockfs.CreateFile("f", "0123456789", /*recursive=*/false));
+
+  FileSource source("f", &mockfs);
+  ASSERT_OK_AND_ASSIGN(auto file, source.Open(metrics));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(2, 4));
+  ASSERT_OK_AND_ASSIGN(buffer, file->Read(100));
+  ASSERT_EQ(buffer->size(), 10);
+  ASSERT_EQ(metrics->bytes_read, 14);
+
+  // Buffers are not read from a filesystem, and not counted
+  FileSource buffer_source(buffer);
+  ASSERT_OK_AND_ASSIGN(file, buffer_source.Open(metrics));
+  ASSERT_OK_AND_ASSIGN(buffer, file->Read(10));
+  ASSERT_EQ(metrics->bytes_read, 14);
+}
+
 TEST_F(TestFileSystemDataSource, Basic) {
   MakeSource({});
   AssertFragmentsAreFromPath(source_->GetFragments(options_), {});
@@ -156,5 +176,52 @@ TEST_F(TestFileSystemDataSource, TreePartitionPruning) {
   AssertFragmentsAreFromPath(source_->GetFragments(options_), franklins);
 }
 
+TEST_F(TestFileSystemDataSource, PrunedSubtreesAreNotVisited) {
+  std::vector<fs::FileStats> stats = {fs::Dir("a=1")};
+  ExpressionVector partitions = {("a"_ == 1).Copy()};
+  for (int i = 0; i < 1000; ++i) {
+    stats.push_back(fs::File("a=1/" + std::to_string(i)));
+    partitions.push_back(scalar(true));
+  }
+  stats.push_back(fs::Dir("a=2"));
+  partitions.push_back(("a"_ == 2).Copy());
+  stats.push_back(fs::File("a=2/0"));
+  partitions.push_back(scalar(true));
+  MakeSource(stats, scalar(true), partitions);
+
+  options_->filter = ("a"_ == 2).Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), {"a=2/0"});
+
+  // Files whose partition is trivially true share the options of their directory
+  options_->filter = ("a"_ == 1).Copy();
+  auto it = source_->GetFragments(options_);
+  ASSERT_OK_AND_ASSIGN(auto first, it.Next());
+  ASSERT_OK_AND_ASSIGN(auto second, it.Next());
+  ASSERT_EQ(first->scan_options(), second->scan_options());
+  ASSERT_TRUE(first->scan_options()->filter->Equals(true));
+
+  options_->filter = scalar(false);
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), {});
+}
+
+TEST_F(TestFileSystemDataSource, PartitionPruningMetrics) {
+  std::vector<fs::FileStats> stats = {fs::Dir("a=1"), fs::File("a=1/0"),
+                                      fs::File("a=1/1"), fs::Dir("a=2"),
+                                      fs::File("a=2/0")};
+  ExpressionVector partitions = {("a"_ == 1).Copy(), scalar(true), scalar(true),
+                                 ("a"_ == 2).Copy(), scalar(true)};
+  MakeSource(stats, ("b"_ == 0).Copy(), partitions);
+
+  options_->metrics = std::make_shared<ScanMetrics>();
+  options_->filter = ("a"_ == 2).Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), {"a=2/0"});
+  ASSERT_EQ(options_->metrics->fragments_pruned_by_partition, 2);
+  ASSERT_EQ(options_->metrics->sources_pruned_by_partition, 0);
+
+  options_->filter = ("b"_ == 1).Copy();
+  AssertFragmentsAreFromPath(source_->GetFragments(options_), {});
+  ASSERT_EQ(options_->metrics->sources_pruned_by_partition, 1);
+}
+
 }  // namespace dataset
 }  // namespace arrow
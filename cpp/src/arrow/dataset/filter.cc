@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -26,6 +27,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/context.h"
@@ -34,11 +36,14 @@
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
 #include "arrow/compute/kernels/isin.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -183,6 +188,21 @@ Result<Comparison::type> Compare(const Scalar& lhs, const Scalar& rhs) {
   return vis.result_;
 }
 
+Result<int> CompareScalars(const Scalar& lhs, const Scalar& rhs) {
+  ARROW_ASSIGN_OR_RAISE(auto cmp, Compare(lhs, rhs));
+  switch (cmp) {
+    case Comparison::LESS:
+      return -1;
+    case Comparison::EQUAL:
+      return 0;
+    case Comparison::GREATER:
+      return 1;
+    default:
+      break;
+  }
+  return Status::Invalid("Cannot compare null scalars");
+}
+
 compute::CompareOperator InvertCompareOperator(compute::CompareOperator op) {
   using compute::CompareOperator;
 
@@ -340,7 +360,12 @@ std::shared_ptr<Expression> ComparisonExpression::AssumeGivenComparison(
   const auto& given_rhs =
       checked_cast<const ScalarExpression&>(*given.right_operand_).value();
 
-  auto cmp = Compare(*this_rhs, *given_rhs).ValueOrDie();
+  auto maybe_cmp = Compare(*this_rhs, *given_rhs);
+  if (!maybe_cmp.ok()) {
+    // e.g. the scalars are of differing types, nothing can be inferred
+    return Copy();
+  }
+  auto cmp = maybe_cmp.ValueOrDie();
 
   if (cmp == Comparison::NULL_) {
     // the RHS of e or given was null
@@ -596,6 +621,16 @@ std::shared_ptr<Expression> IsValidExpression::Assume(const Expression& given) c
   return std::make_shared<IsValidExpression>(std::move(operand));
 }
 
+std::shared_ptr<Expression> StringMatchExpression::Assume(const Expression& given) const {
+  return std::make_shared<StringMatchExpression>(operand_->Assume(given), options_);
+}
+
+std::shared_ptr<Expression> StringFunctionExpression::Assume(
+    const Expression& given) const {
+  return std::make_shared<StringFunctionExpression>(operand_->Assume(given), function_,
+                                                    substring_options_);
+}
+
 std::shared_ptr<Expression> CastExpression::Assume(const Expression& given) const {
   auto operand = operand_->Assume(given);
   if (arrow::util::holds_alternative<std::shared_ptr<DataType>>(to_)) {
@@ -666,6 +701,39 @@ std::string InExpression::ToString() const {
       {"(", operand_->ToString(), " is in ", set_->ToString(), ")"}, "");
 }
 
+std::string StringMatchExpression::ToString() const {
+  util::string_view op;
+  switch (options_.op) {
+    case compute::StringMatchOperator::STARTS_WITH:
+      op = " starts with \"";
+      break;
+    case compute::StringMatchOperator::ENDS_WITH:
+      op = " ends with \"";
+      break;
+    case compute::StringMatchOperator::CONTAINS:
+      op = " contains \"";
+      break;
+  }
+  return internal::JoinStrings({"(", operand_->ToString(), op, options_.pattern, "\")"},
+                               "");
+}
+
+std::string StringFunctionExpression::ToString() const {
+  switch (function_) {
+    case StringFunction::UTF8_LENGTH:
+      return "utf8_length(" + operand_->ToString() + ")";
+    case StringFunction::ASCII_UPPER:
+      return "ascii_upper(" + operand_->ToString() + ")";
+    case StringFunction::ASCII_LOWER:
+      return "ascii_lower(" + operand_->ToString() + ")";
+    case StringFunction::SUBSTRING:
+      break;
+  }
+  return "substring(" + operand_->ToString() + ", " +
+         std::to_string(substring_options_.start) + ", " +
+         std::to_string(substring_options_.length) + ")";
+}
+
 std::string CastExpression::ToString() const {
   std::string to;
   if (arrow::util::holds_alternative<std::shared_ptr<DataType>>(to_)) {
@@ -702,6 +770,27 @@ bool ComparisonExpression::Equals(const Expression& other) const {
          op_ == checked_cast<const ComparisonExpression&>(other).op_;
 }
 
+bool StringMatchExpression::Equals(const Expression& other) const {
+  if (!UnaryExpression::Equals(other)) {
+    return false;
+  }
+  const auto& other_options = checked_cast<const StringMatchExpression&>(other).options_;
+  return options_.op == other_options.op && options_.pattern == other_options.pattern;
+}
+
+bool StringFunctionExpression::Equals(const Expression& other) const {
+  if (!UnaryExpression::Equals(other)) {
+    return false;
+  }
+  const auto& other_function = checked_cast<const StringFunctionExpression&>(other);
+  if (function_ != other_function.function_) {
+    return false;
+  }
+  return function_ != StringFunction::SUBSTRING ||
+         (substring_options_.start == other_function.substring_options_.start &&
+          substring_options_.length == other_function.substring_options_.length);
+}
+
 bool ScalarExpression::Equals(const Expression& other) const {
   return other.type() == ExpressionType::SCALAR &&
          value_->Equals(*checked_cast<const ScalarExpression&>(other).value_);
@@ -738,6 +827,41 @@ InExpression Expression::In(std::shared_ptr<Array> set) const {
 
 IsValidExpression Expression::IsValid() const { return IsValidExpression(Copy()); }
 
+StringMatchExpression Expression::StartsWith(std::string pattern) const {
+  return StringMatchExpression(
+      Copy(), compute::StringMatchOptions(compute::StringMatchOperator::STARTS_WITH,
+                                          std::move(pattern)));
+}
+
+StringMatchExpression Expression::EndsWith(std::string pattern) const {
+  return StringMatchExpression(
+      Copy(), compute::StringMatchOptions(compute::StringMatchOperator::ENDS_WITH,
+                                          std::move(pattern)));
+}
+
+StringMatchExpression Expression::Contains(std::string pattern) const {
+  return StringMatchExpression(
+      Copy(), compute::StringMatchOptions(compute::StringMatchOperator::CONTAINS,
+                                          std::move(pattern)));
+}
+
+StringFunctionExpression Expression::Utf8Length() const {
+  return StringFunctionExpression(Copy(), StringFunction::UTF8_LENGTH);
+}
+
+StringFunctionExpression Expression::AsciiUpper() const {
+  return StringFunctionExpression(Copy(), StringFunction::ASCII_UPPER);
+}
+
+StringFunctionExpression Expression::AsciiLower() const {
+  return StringFunctionExpression(Copy(), StringFunction::ASCII_LOWER);
+}
+
+StringFunctionExpression Expression::Substring(int64_t start, int64_t length) const {
+  return StringFunctionExpression(Copy(), StringFunction::SUBSTRING,
+                                  compute::SubstringOptions(start, length));
+}
+
 std::shared_ptr<Expression> FieldExpression::Copy() const {
   return std::make_shared<FieldExpression>(*this);
 }
@@ -870,6 +994,46 @@ Result<std::shared_ptr<DataType>> IsValidExpression::Validate(
   return boolean();
 }
 
+Status EnsureNullOrString(const std::string& msg_prefix,
+                          const std::shared_ptr<DataType>& type, bool allow_binary) {
+  switch (type->id()) {
+    case Type::NA:
+    case Type::STRING:
+    case Type::LARGE_STRING:
+      return Status::OK();
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+      if (allow_binary) {
+        return Status::OK();
+      }
+      break;
+    default:
+      break;
+  }
+  return Status::TypeError(msg_prefix, *type);
+}
+
+Result<std::shared_ptr<DataType>> StringMatchExpression::Validate(
+    const Schema& schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto operand_type, operand_->Validate(schema));
+  RETURN_NOT_OK(
+      EnsureNullOrString("cannot match a pattern against an expression of type ",
+                         operand_type, /*allow_binary=*/true));
+  return boolean();
+}
+
+Result<std::shared_ptr<DataType>> StringFunctionExpression::Validate(
+    const Schema& schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto operand_type, operand_->Validate(schema));
+  RETURN_NOT_OK(
+      EnsureNullOrString("cannot apply a string function to an expression of type ",
+                         operand_type, /*allow_binary=*/false));
+  if (function_ != StringFunction::UTF8_LENGTH || operand_type->id() == Type::NA) {
+    return operand_type;
+  }
+  return operand_type->id() == Type::LARGE_STRING ? int64() : int32();
+}
+
 Result<std::shared_ptr<DataType>> CastExpression::Validate(const Schema& schema) const {
   ARROW_ASSIGN_OR_RAISE(auto operand_type, operand_->Validate(schema));
   std::shared_ptr<DataType> to_type;
@@ -1025,13 +1189,19 @@ std::vector<std::string> FieldsInExpression(const std::shared_ptr<Expression>& e
   return FieldsInExpression(*expr);
 }
 
+Result<std::shared_ptr<RecordBatch>> ExpressionEvaluator::FilterBatch(
+    const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  return Evaluate(filter, *batch, pool).Map([&](Datum selection) {
+    return Filter(selection, batch, pool);
+  });
+}
+
 RecordBatchIterator ExpressionEvaluator::FilterBatches(RecordBatchIterator unfiltered,
                                                        std::shared_ptr<Expression> filter,
                                                        MemoryPool* pool) {
   auto filter_batches = [filter, pool, this](std::shared_ptr<RecordBatch> unfiltered) {
-    auto filtered = Evaluate(*filter, *unfiltered, pool).Map([&](Datum selection) {
-      return Filter(selection, unfiltered, pool);
-    });
+    auto filtered = FilterBatch(*filter, unfiltered, pool);
 
     if (filtered.ok() && (*filtered)->num_rows() == 0) {
       // drop empty batches
@@ -1139,6 +1309,54 @@ struct TreeEvaluator::Impl {
     return std::move(out);
   }
 
+  Result<Datum> operator()(const StringMatchExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand_values, EvaluateStringOperand(expr));
+    if (IsNullDatum(operand_values)) {
+      return Datum(std::make_shared<BooleanScalar>());
+    }
+
+    Datum out;
+    RETURN_NOT_OK(compute::MatchString(&ctx_, operand_values, expr.options(), &out));
+    return std::move(out);
+  }
+
+  Result<Datum> operator()(const StringFunctionExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand_values, EvaluateStringOperand(expr));
+    if (IsNullDatum(operand_values)) {
+      return NullDatum();
+    }
+
+    Datum out;
+    switch (expr.function()) {
+      case StringFunction::UTF8_LENGTH:
+        RETURN_NOT_OK(compute::Utf8Length(&ctx_, operand_values, &out));
+        break;
+      case StringFunction::ASCII_UPPER:
+        RETURN_NOT_OK(compute::AsciiUpper(&ctx_, operand_values, &out));
+        break;
+      case StringFunction::ASCII_LOWER:
+        RETURN_NOT_OK(compute::AsciiLower(&ctx_, operand_values, &out));
+        break;
+      case StringFunction::SUBSTRING:
+        RETURN_NOT_OK(compute::Substring(&ctx_, operand_values, expr.substring_options(),
+                                         &out));
+        break;
+    }
+    return std::move(out);
+  }
+
+  // String kernels only take arrays: broadcast a valid scalar operand
+  Result<Datum> EvaluateStringOperand(const UnaryExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand_values, Evaluate(*expr.operand()));
+    if (operand_values.is_scalar() && operand_values.scalar()->is_valid) {
+      std::shared_ptr<Array> operand_array;
+      RETURN_NOT_OK(MakeArrayFromScalar(ctx_.memory_pool(), *operand_values.scalar(),
+                                        batch_.num_rows(), &operand_array));
+      return Datum(std::move(operand_array));
+    }
+    return std::move(operand_values);
+  }
+
   Result<Datum> operator()(const IsValidExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(auto operand_values, Evaluate(*expr.operand()));
     if (IsNullDatum(operand_values)) {
@@ -1229,5 +1447,218 @@ Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
   return batch->Slice(0, 0);
 }
 
+namespace {
+
+void FlattenConjunction(const Expression& expr, std::vector<const Expression*>* out) {
+  if (expr.type() == ExpressionType::AND) {
+    const auto& conjunction = checked_cast<const AndExpression&>(expr);
+    FlattenConjunction(*conjunction.left_operand(), out);
+    FlattenConjunction(*conjunction.right_operand(), out);
+    return;
+  }
+  out->push_back(&expr);
+}
+
+bool ContainsCustomExpression(const Expression& expr) {
+  struct {
+    void operator()(const CustomExpression&) { found = true; }
+
+    void operator()(const UnaryExpression& expr) {
+      VisitExpression(*expr.operand(), *this);
+    }
+
+    void operator()(const BinaryExpression& expr) {
+      VisitExpression(*expr.left_operand(), *this);
+      VisitExpression(*expr.right_operand(), *this);
+    }
+
+    void operator()(const Expression&) const {}
+
+    bool found = false;
+  } visitor;
+
+  VisitExpression(expr, visitor);
+  return visitor.found;
+}
+
+// The rows of a batch which passed the operands of a conjunction evaluated so far.
+//
+// Following Kleene logic, a row for which an operand was null is only rejected if a
+// later operand is false; otherwise Filter yields a null row for it. Such rows keep
+// their index but are null in the selection vector.
+class SelectionVector {
+ public:
+  explicit SelectionVector(int64_t num_rows) : length_(num_rows) {}
+
+  int64_t length() const { return length_; }
+
+  // Gather the columns of batch which expr references, at the selected rows
+  Result<std::shared_ptr<RecordBatch>> Gather(compute::FunctionContext* ctx,
+                                              const Expression& expr,
+                                              const std::shared_ptr<RecordBatch>& batch) {
+    if (indices_ == nullptr) {
+      return batch;
+    }
+
+    std::vector<int> columns;
+    if (ContainsCustomExpression(expr)) {
+      columns.resize(batch->num_columns());
+      std::iota(columns.begin(), columns.end(), 0);
+    } else {
+      for (const auto& name : FieldsInExpression(expr)) {
+        int i = batch->schema()->GetFieldIndex(name);
+        if (i != -1 && std::find(columns.begin(), columns.end(), i) == columns.end()) {
+          columns.push_back(i);
+        }
+      }
+    }
+
+    // Null selected rows must be gathered too, ignore the validity bitmap
+    Int32Array indices(length_, indices_);
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> gathered;
+    for (int i : columns) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(compute::Take(ctx, *batch->column(i), indices,
+                                  compute::TakeOptions(), &column));
+      fields.push_back(batch->schema()->field(i));
+      gathered.push_back(std::move(column));
+    }
+    return RecordBatch::Make(schema(std::move(fields)), length_, std::move(gathered));
+  }
+
+  // Narrow the selection with the mask an operand yielded for the selected rows
+  Status Narrow(MemoryPool* pool, const Datum& mask) {
+    if (mask.is_scalar()) {
+      if (!mask.scalar()->is_valid) {
+        return NullifyAll(pool);
+      }
+      if (mask.type()->id() != Type::BOOL) {
+        return NotABooleanMask(mask);
+      }
+      if (!checked_cast<const BooleanScalar&>(*mask.scalar()).value) {
+        length_ = 0;
+        indices_ = validity_ = nullptr;
+      }
+      return Status::OK();
+    }
+
+    if (!mask.is_array()) {
+      return NotABooleanMask(mask);
+    }
+    if (mask.type()->id() == Type::NA) {
+      return NullifyAll(pool);
+    }
+    if (mask.type()->id() != Type::BOOL) {
+      return NotABooleanMask(mask);
+    }
+
+    BooleanArray mask_array(mask.array());
+    DCHECK_EQ(mask_array.length(), length_);
+    TypedBufferBuilder<int32_t> indices_builder(pool);
+    TypedBufferBuilder<bool> validity_builder(pool);
+    RETURN_NOT_OK(indices_builder.Reserve(length_));
+    RETURN_NOT_OK(validity_builder.Reserve(length_));
+
+    const int32_t* indices =
+        indices_ ? reinterpret_cast<const int32_t*>(indices_->data()) : nullptr;
+    const uint8_t* validity = validity_ ? validity_->data() : nullptr;
+    for (int64_t i = 0; i < length_; ++i) {
+      const bool mask_valid = mask_array.IsValid(i);
+      if (mask_valid && !mask_array.Value(i)) {
+        continue;
+      }
+      indices_builder.UnsafeAppend(indices ? indices[i] : static_cast<int32_t>(i));
+      validity_builder.UnsafeAppend(
+          mask_valid && (validity == nullptr || BitUtil::GetBit(validity, i)));
+    }
+
+    if (indices == nullptr && indices_builder.length() == length_ &&
+        validity_builder.false_count() == 0) {
+      // all rows are still selected
+      return Status::OK();
+    }
+
+    length_ = indices_builder.length();
+    null_count_ = validity_builder.false_count();
+    RETURN_NOT_OK(indices_builder.Finish(&indices_));
+    if (null_count_ == 0) {
+      validity_ = nullptr;
+    } else {
+      RETURN_NOT_OK(validity_builder.Finish(&validity_));
+    }
+    return Status::OK();
+  }
+
+  // Gather the selected rows of the whole batch
+  Result<std::shared_ptr<RecordBatch>> Apply(compute::FunctionContext* ctx,
+                                             const std::shared_ptr<RecordBatch>& batch) {
+    if (indices_ == nullptr) {
+      return length_ == 0 ? batch->Slice(0, 0) : batch;
+    }
+
+    std::shared_ptr<RecordBatch> out;
+    RETURN_NOT_OK(compute::Take(ctx, *batch,
+                                Int32Array(length_, indices_, validity_, null_count_),
+                                compute::TakeOptions(), &out));
+    return std::move(out);
+  }
+
+ private:
+  Status NullifyAll(MemoryPool* pool) {
+    if (indices_ == nullptr) {
+      TypedBufferBuilder<int32_t> indices_builder(pool);
+      RETURN_NOT_OK(indices_builder.Reserve(length_));
+      for (int64_t i = 0; i < length_; ++i) {
+        indices_builder.UnsafeAppend(static_cast<int32_t>(i));
+      }
+      RETURN_NOT_OK(indices_builder.Finish(&indices_));
+    }
+
+    TypedBufferBuilder<bool> validity_builder(pool);
+    RETURN_NOT_OK(validity_builder.Append(length_, false));
+    RETURN_NOT_OK(validity_builder.Finish(&validity_));
+    null_count_ = length_;
+    return Status::OK();
+  }
+
+  static Status NotABooleanMask(const Datum& mask) {
+    return Status::NotImplemented("Filtering batches against DatumKind::", mask.kind(),
+                                  " of type ", *mask.type());
+  }
+
+  int64_t length_;
+  // null if all rows are selected, or none (length_ == 0)
+  std::shared_ptr<Buffer> indices_;
+  std::shared_ptr<Buffer> validity_;
+  int64_t null_count_ = 0;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatch>> TreeEvaluator::FilterBatch(
+    const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  if (!use_selection_vectors_ || filter.type() != ExpressionType::AND ||
+      batch->num_rows() > std::numeric_limits<int32_t>::max()) {
+    return ExpressionEvaluator::FilterBatch(filter, batch, pool);
+  }
+
+  std::vector<const Expression*> operands;
+  FlattenConjunction(filter, &operands);
+
+  compute::FunctionContext ctx{pool};
+  SelectionVector selection(batch->num_rows());
+  for (const Expression* operand : operands) {
+    if (selection.length() == 0) {
+      break;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto selected, selection.Gather(&ctx, *operand, batch));
+    ARROW_ASSIGN_OR_RAISE(auto mask, Evaluate(*operand, *selected, pool));
+    RETURN_NOT_OK(selection.Narrow(pool, mask));
+  }
+  return selection.Apply(&ctx, batch);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/string.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/result.h"
@@ -74,6 +75,12 @@ struct ExpressionType {
     /// check each element for membership in a set
     IN,
 
+    /// match each string against a pattern
+    STRING_MATCH,
+
+    /// apply a function to each string
+    STRING_FUNCTION,
+
     /// custom user defined expression
     CUSTOM,
   };
@@ -196,6 +203,20 @@ class ARROW_DS_EXPORT Expression {
 
   IsValidExpression IsValid() const;
 
+  StringMatchExpression StartsWith(std::string pattern) const;
+
+  StringMatchExpression EndsWith(std::string pattern) const;
+
+  StringMatchExpression Contains(std::string pattern) const;
+
+  StringFunctionExpression Utf8Length() const;
+
+  StringFunctionExpression AsciiUpper() const;
+
+  StringFunctionExpression AsciiLower() const;
+
+  StringFunctionExpression Substring(int64_t start, int64_t length = -1) const;
+
   CastExpression CastTo(std::shared_ptr<DataType> type,
                         compute::CastOptions options = compute::CastOptions()) const;
 
@@ -351,6 +372,63 @@ class ARROW_DS_EXPORT InExpression final
   std::shared_ptr<Array> set_;
 };
 
+/// Match each string of an expression against a pattern
+class ARROW_DS_EXPORT StringMatchExpression final
+    : public ExpressionImpl<UnaryExpression, StringMatchExpression,
+                            ExpressionType::STRING_MATCH> {
+ public:
+  StringMatchExpression(std::shared_ptr<Expression> operand,
+                        compute::StringMatchOptions options)
+      : ExpressionImpl(std::move(operand)), options_(std::move(options)) {}
+
+  std::string ToString() const override;
+
+  bool Equals(const Expression& other) const override;
+
+  Result<std::shared_ptr<DataType>> Validate(const Schema& schema) const override;
+
+  std::shared_ptr<Expression> Assume(const Expression& given) const override;
+
+  const compute::StringMatchOptions& options() const { return options_; }
+
+ private:
+  compute::StringMatchOptions options_;
+};
+
+enum class StringFunction { UTF8_LENGTH, ASCII_UPPER, ASCII_LOWER, SUBSTRING };
+
+/// Apply a function to each string of an expression
+class ARROW_DS_EXPORT StringFunctionExpression final
+    : public ExpressionImpl<UnaryExpression, StringFunctionExpression,
+                            ExpressionType::STRING_FUNCTION> {
+ public:
+  StringFunctionExpression(std::shared_ptr<Expression> operand, StringFunction function,
+                           compute::SubstringOptions substring_options =
+                               compute::SubstringOptions())
+      : ExpressionImpl(std::move(operand)),
+        function_(function),
+        substring_options_(substring_options) {}
+
+  std::string ToString() const override;
+
+  bool Equals(const Expression& other) const override;
+
+  Result<std::shared_ptr<DataType>> Validate(const Schema& schema) const override;
+
+  std::shared_ptr<Expression> Assume(const Expression& given) const override;
+
+  StringFunction function() const { return function_; }
+
+  /// The start and length of substrings, for StringFunction::SUBSTRING
+  const compute::SubstringOptions& substring_options() const {
+    return substring_options_;
+  }
+
+ private:
+  StringFunction function_;
+  compute::SubstringOptions substring_options_;
+};
+
 /// Explicitly cast an expression to a different type
 class ARROW_DS_EXPORT CastExpression final
     : public ExpressionImpl<UnaryExpression, CastExpression, ExpressionType::CAST> {
@@ -518,6 +596,12 @@ auto VisitExpression(const Expression& expr, Visitor&& visitor)
     case ExpressionType::IS_VALID:
       return visitor(internal::checked_cast<const IsValidExpression&>(expr));
 
+    case ExpressionType::STRING_MATCH:
+      return visitor(internal::checked_cast<const StringMatchExpression&>(expr));
+
+    case ExpressionType::STRING_FUNCTION:
+      return visitor(internal::checked_cast<const StringFunctionExpression&>(expr));
+
     case ExpressionType::AND:
       return visitor(internal::checked_cast<const AndExpression&>(expr));
 
@@ -550,6 +634,12 @@ ARROW_DS_EXPORT std::vector<std::string> FieldsInExpression(const Expression& ex
 ARROW_DS_EXPORT std::vector<std::string> FieldsInExpression(
     const std::shared_ptr<Expression>& expr);
 
+/// \brief Compare two valid scalars of the same type.
+///
+/// \return a negative value, zero or a positive value if lhs is less than, equal
+/// to or greater than rhs.
+ARROW_DS_EXPORT Result<int> CompareScalars(const Scalar& lhs, const Scalar& rhs);
+
 /// Interface for evaluation of expressions against record batches.
 class ARROW_DS_EXPORT ExpressionEvaluator {
  public:
@@ -580,6 +670,21 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
     return Filter(selection, batch, default_memory_pool());
   }
 
+  /// \brief Return the rows of a batch which satisfy a filter expression.
+  ///
+  /// The default implementation evaluates filter against the whole batch, then
+  /// filters the batch with the result.
+  ///
+  /// filter must be validated against the schema of batch before calling this method.
+  virtual Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+      MemoryPool* pool) const;
+
+  Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch) const {
+    return FilterBatch(filter, batch, default_memory_pool());
+  }
+
   /// \brief Wrap an iterator of record batches with a filter expression. The resulting
   /// iterator will yield record batches filtered by the given expression.
   ///
@@ -595,8 +700,21 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
 
 /// construct an Evaluator which uses compute kernels to evaluate expressions and
 /// filter record batches in depth first order
+///
+/// If use_selection_vectors is true, FilterBatch evaluates the operands of a
+/// conjunction one after the other, each against the rows selected by the previous
+/// ones only. The selected rows are tracked as a vector of their indices, which is
+/// used to gather the columns referenced by the next operand, and finally the whole
+/// batch. This avoids evaluating the later predicates of a selective conjunction
+/// against rows which were already rejected. The resulting batch is the same as the
+/// one Filter would yield.
 class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
  public:
+  explicit TreeEvaluator(bool use_selection_vectors = false)
+      : use_selection_vectors_(use_selection_vectors) {}
+
+  using ExpressionEvaluator::FilterBatch;
+
   Result<compute::Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
                                   MemoryPool* pool) const override;
 
@@ -604,8 +722,16 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
                                               const std::shared_ptr<RecordBatch>& batch,
                                               MemoryPool* pool) const override;
 
+  Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+      MemoryPool* pool) const override;
+
+  bool use_selection_vectors() const { return use_selection_vectors_; }
+
  protected:
   struct Impl;
+
+  bool use_selection_vectors_;
 };
 
 }  // namespace dataset
@@ -86,6 +86,10 @@ TEST_F(ExpressionsTest, StringRepresentation) {
   ASSERT_EQ(("f"_ > double(4)).ToString(), "(f > 4:double)");
   ASSERT_EQ("f"_.CastTo(float64()).ToString(), "(cast f to double)");
   ASSERT_EQ("f"_.CastLike("a"_).ToString(), "(cast f like a)");
+  ASSERT_EQ("s"_.StartsWith("ab").ToString(), "(s starts with \"ab\")");
+  ASSERT_EQ("s"_.Contains("ab").ToString(), "(s contains \"ab\")");
+  ASSERT_EQ("s"_.Utf8Length().ToString(), "utf8_length(s)");
+  ASSERT_EQ("s"_.Substring(1, 2).ToString(), "substring(s, 1, 2)");
 }
 
 TEST_F(ExpressionsTest, Equality) {
@@ -103,6 +107,13 @@ TEST_F(ExpressionsTest, Equality) {
 
   ASSERT_EQ(E("b"_ > 2 and "b"_ < 3), E("b"_ > 2 and "b"_ < 3));
   ASSERT_NE(E("b"_ > 2 and "b"_ < 3), E("b"_ < 3 and "b"_ > 2));
+
+  ASSERT_EQ(E{"s"_.Contains("a")}, E{"s"_.Contains("a")});
+  ASSERT_NE(E{"s"_.Contains("a")}, E{"s"_.Contains("b")});
+  ASSERT_NE(E{"s"_.Contains("a")}, E{"s"_.EndsWith("a")});
+  ASSERT_EQ(E{"s"_.AsciiUpper()}, E{"s"_.AsciiUpper()});
+  ASSERT_NE(E{"s"_.AsciiUpper()}, E{"s"_.AsciiLower()});
+  ASSERT_NE(E{"s"_.Substring(1)}, E{"s"_.Substring(1, 2)});
 }
 
 TEST_F(ExpressionsTest, SimplificationOfCompoundQuery) {
@@ -148,6 +159,14 @@ TEST_F(ExpressionsTest, SimplificationToNull) {
   AssertSimplifiesTo(*not_equal(field_ref("b"), null32) or "b"_ > 2, "b"_ == 3, *always);
 }
 
+TEST_F(ExpressionsTest, SimplificationAgainstDifferingType) {
+  // Nothing can be inferred from a condition on a scalar of another type
+  auto expr = "b"_ == 3;
+  ASSERT_EQ(E{expr.Assume("b"_ == int64_t(4))}, E{expr.Copy()});
+  expr = "b"_ > 3;
+  ASSERT_EQ(E{expr.Assume("b"_ < int64_t(2))}, E{expr.Copy()});
+}
+
 class FilterTest : public ::testing::Test {
  public:
   FilterTest() { evaluator_ = std::make_shared<TreeEvaluator>(); }
@@ -283,6 +302,47 @@ TEST_F(FilterTest, InExpression) {
   ])");
 }
 
+TEST_F(FilterTest, StringMatchExpression) {
+  ASSERT_RAISES(TypeError, "a"_.Contains("x").Validate(Schema({field("a", int32())})));
+
+  AssertFilter("s"_.StartsWith("he") or "s"_.Contains("oo"), {field("s", utf8())}, R"([
+      {"s": "hello", "in": 1},
+      {"s": "world", "in": 0},
+      {"s": "",      "in": 0},
+      {"s": null,    "in": null},
+      {"s": "foo",   "in": 1},
+      {"s": "the",   "in": 0},
+      {"s": "bar",   "in": 0}
+  ])");
+
+  AssertFilter("s"_.EndsWith("o"), {field("s", utf8())}, R"([
+      {"s": "hello", "in": 1},
+      {"s": "world", "in": 0},
+      {"s": null,    "in": null}
+  ])");
+}
+
+TEST_F(FilterTest, StringFunctionExpression) {
+  ASSERT_RAISES(TypeError, "a"_.Utf8Length().Validate(Schema({field("a", binary())})));
+
+  AssertFilter("s"_.Utf8Length() > int32_t(3), {field("s", utf8())}, R"([
+      {"s": "hello", "in": 1},
+      {"s": "héé",   "in": 0},
+      {"s": "",      "in": 0},
+      {"s": null,    "in": null},
+      {"s": "héllo", "in": 1}
+  ])");
+
+  AssertFilter("s"_.AsciiLower().Substring(1, 3).StartsWith("ell"), {field("s", utf8())},
+               R"([
+      {"s": "HELLO", "in": 1},
+      {"s": "hEllo", "in": 1},
+      {"s": "yell",  "in": 1},
+      {"s": null,    "in": null},
+      {"s": "ell",   "in": 0}
+  ])");
+}
+
 TEST_F(FilterTest, IsValidExpression) {
   AssertFilter("s"_.IsValid(), {field("s", utf8())}, R"([
       {"s": "hello", "in": 1},
@@ -513,6 +573,50 @@ TEST_F(FilterTest, EvaluateTakeExpression) {
   ])");
 }
 
+class SelectionVectorFilterTest : public ::testing::Test {
+ public:
+  // Filtering with selection vectors must yield the same batch as filtering with
+  // the mask of the whole filter
+  void AssertFilterBatch(const Expression& expr, const std::shared_ptr<Schema>& schm,
+                         const std::string& batch_json) {
+    auto batch = RecordBatchFromJSON(schm, batch_json);
+    ASSERT_OK_AND_ASSIGN(auto expr_type, expr.Validate(*schm));
+    ASSERT_TRUE(expr_type->Equals(boolean()));
+
+    ASSERT_OK_AND_ASSIGN(auto expected, TreeEvaluator().FilterBatch(expr, batch));
+    ASSERT_OK_AND_ASSIGN(auto actual, TreeEvaluator(true).FilterBatch(expr, batch));
+    ASSERT_OK(actual->ValidateFull());
+    AssertBatchesEqual(*expected, *actual);
+  }
+};
+
+TEST_F(SelectionVectorFilterTest, Conjunctions) {
+  auto schm = schema({field("a", int32()), field("b", float64()), field("c", utf8())});
+  auto batch_json = R"([
+      {"a": 0, "b": -0.1, "c": "x"},
+      {"a": 0, "b":  0.3, "c": "y"},
+      {"a": 1, "b":  0.2, "c": null},
+      {"a": 2, "b": -0.1, "c": "y"},
+      {"a": 0, "b":  0.1, "c": "x"},
+      {"a": 0, "b": null, "c": "x"},
+      {"a": null, "b": 0.5, "c": "y"},
+      {"a": 0, "b":  1.0, "c": "z"}
+  ])";
+
+  AssertFilterBatch("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0, schm, batch_json);
+  // a null operand is only resolved by a later false one
+  AssertFilterBatch("b"_ > 0.0 and "a"_ == 0 and "c"_ == "x", schm, batch_json);
+  AssertFilterBatch(("a"_ == 0 or "c"_ == "y") and not("b"_ > 0.2), schm, batch_json);
+  // nothing selected after the first operand
+  AssertFilterBatch("a"_ == 5 and "b"_ > 0.0, schm, batch_json);
+  // everything selected
+  AssertFilterBatch("b"_ > -1.0 and "a"_ < 3, schm, batch_json);
+  AssertFilterBatch("a"_ == 0 and "absent"_ == 0, schm, batch_json);
+  AssertFilterBatch(*and_(scalar(false), ("a"_ == 0).Copy()), schm, batch_json);
+  // not a conjunction
+  AssertFilterBatch("a"_ == 0 or "b"_ > 0.0, schm, batch_json);
+}
+
 void AssertFieldsInExpression(std::shared_ptr<Expression> expr,
                               std::vector<std::string> expected) {
   EXPECT_THAT(FieldsInExpression(expr), testing::ContainerEq(expected));
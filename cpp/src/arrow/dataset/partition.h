@@ -151,6 +151,13 @@ class ARROW_DS_EXPORT PartitionKeysScheme : public PartitionScheme {
   /// Extract a partition key from a path segment.
   virtual util::optional<Key> ParseKey(const std::string& segment, int i) const = 0;
 
+  /// Format the path segment of the i-th field of the schema, the inverse of
+  /// ParseKey. Used to write partitioned datasets.
+  virtual Result<std::string> FormatKey(const Key& key, int i) const {
+    return Status::NotImplemented("Formatting keys of the ", type_name(),
+                                  " partition scheme");
+  }
+
   Result<std::shared_ptr<Expression>> Parse(const std::string& segment,
                                             int i) const override;
 
@@ -173,6 +180,11 @@ class ARROW_DS_EXPORT SchemaPartitionScheme : public PartitionKeysScheme {
 
   util::optional<Key> ParseKey(const std::string& segment, int i) const override;
 
+  /// Return the value of the key
+  Result<std::string> FormatKey(const Key& key, int i) const override {
+    return key.value;
+  }
+
   static std::shared_ptr<PartitionSchemeDiscovery> MakeDiscovery(
       std::vector<std::string> field_names);
 };
@@ -199,6 +211,11 @@ class ARROW_DS_EXPORT HivePartitionScheme : public PartitionKeysScheme {
 
   static util::optional<Key> ParseKey(const std::string& segment);
 
+  /// Return "$key=$value"
+  Result<std::string> FormatKey(const Key& key, int i) const override {
+    return key.name + "=" + key.value;
+  }
+
   static std::shared_ptr<PartitionSchemeDiscovery> MakeDiscovery();
 };
 
@@ -0,0 +1,319 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end benchmarks of pipelines combining several modules, on generated
+// datasets of a few typical shapes. Each reports the throughput of its input
+// and the peak memory allocated by the pipeline (peak_memory, in bytes).
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/api.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/csv/api.h"
+#include "arrow/dataset/api.h"
+#include "arrow/dataset/file_parquet.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+#include "parquet/arrow/writer.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+constexpr int64_t kNumRows = 1 << 18;
+constexpr int kNumGroups = 100;
+constexpr int kNumFiles = 4;
+
+enum class Shape {
+  // A few string columns of various cardinalities
+  STRINGS,
+  // Many numeric columns
+  WIDE,
+  // List and struct columns
+  NESTED,
+};
+
+// Every shape has an int32 "group" column in [0, kNumGroups) and a double
+// "value" column, which the pipelines filter and aggregate on.
+std::shared_ptr<Table> MakeTable(Shape shape, int64_t num_rows) {
+  random::RandomArrayGenerator rng(42);
+  std::vector<std::shared_ptr<Field>> fields = {field("group", int32()),
+                                                field("value", float64())};
+  std::vector<std::shared_ptr<Array>> columns = {
+      rng.Int32(num_rows, 0, kNumGroups - 1, /*null_probability=*/0),
+      rng.Float64(num_rows, -1000, 1000, /*null_probability=*/0.05)};
+
+  switch (shape) {
+    case Shape::STRINGS:
+      for (int64_t unique : {int64_t(10), int64_t(1000), num_rows}) {
+        fields.push_back(field("str" + std::to_string(unique), utf8()));
+        columns.push_back(rng.StringWithRepeats(num_rows, std::min(unique, num_rows),
+                                                /*min_length=*/4, /*max_length=*/40,
+                                                /*null_probability=*/0.05));
+      }
+      break;
+    case Shape::WIDE:
+      for (int i = 0; i < 50; ++i) {
+        fields.push_back(field("int" + std::to_string(i), int64()));
+        columns.push_back(rng.Int64(num_rows, 0, 1 << 20, /*null_probability=*/0.01));
+        fields.push_back(field("double" + std::to_string(i), float64()));
+        columns.push_back(rng.Float64(num_rows, 0, 1, /*null_probability=*/0.01));
+      }
+      break;
+    case Shape::NESTED: {
+      // Lists of 0 to 8 integers
+      auto lengths = std::static_pointer_cast<Int32Array>(
+          rng.Int32(num_rows, 0, 8, /*null_probability=*/0));
+      Int32Builder offsets_builder;
+      ABORT_NOT_OK(offsets_builder.Reserve(num_rows + 1));
+      int32_t offset = 0;
+      offsets_builder.UnsafeAppend(offset);
+      for (int64_t i = 0; i < num_rows; ++i) {
+        offset += lengths->Value(i);
+        offsets_builder.UnsafeAppend(offset);
+      }
+      std::shared_ptr<Array> offsets, list;
+      ABORT_NOT_OK(offsets_builder.Finish(&offsets));
+      ABORT_NOT_OK(ListArray::FromArrays(*offsets, *rng.Int32(offset, 0, 1000, 0.1),
+                                         default_memory_pool(), &list));
+      fields.push_back(field("list", list->type()));
+      columns.push_back(list);
+
+      auto maybe_struct = StructArray::Make(
+          ArrayVector{rng.Int64(num_rows, 0, 1 << 30, 0.1),
+                      rng.String(num_rows, 4, 16, 0.1)},
+          std::vector<std::string>{"id", "name"});
+      ABORT_NOT_OK(maybe_struct.status());
+      fields.push_back(field("struct", (*maybe_struct)->type()));
+      columns.push_back(*maybe_struct);
+      break;
+    }
+  }
+  return Table::Make(schema(fields), columns);
+}
+
+void FormatCsvValue(const Array& array, int64_t row, std::ostream* os) {
+  switch (array.type_id()) {
+    case Type::INT32:
+      *os << checked_cast<const Int32Array&>(array).Value(row);
+      break;
+    case Type::INT64:
+      *os << checked_cast<const Int64Array&>(array).Value(row);
+      break;
+    case Type::DOUBLE:
+      *os << checked_cast<const DoubleArray&>(array).Value(row);
+      break;
+    case Type::STRING:
+      // The characters of the random generator don't need quoting
+      *os << checked_cast<const StringArray&>(array).GetView(row);
+      break;
+    default:
+      ABORT_NOT_OK(Status::NotImplemented("CSV formatting of ", *array.type()));
+  }
+}
+
+std::shared_ptr<Buffer> MakeCsv(const Table& table) {
+  std::stringstream ss;
+  ss.precision(17);
+  for (int i = 0; i < table.num_columns(); ++i) {
+    ss << (i == 0 ? "" : ",") << table.schema()->field(i)->name();
+  }
+  ss << "\n";
+  for (int64_t row = 0; row < table.num_rows(); ++row) {
+    for (int i = 0; i < table.num_columns(); ++i) {
+      if (i > 0) {
+        ss << ",";
+      }
+      const auto& array = *table.column(i)->chunk(0);
+      if (array.IsValid(row)) {
+        FormatCsvValue(array, row, &ss);
+      }
+    }
+    ss << "\n";
+  }
+  return Buffer::FromString(ss.str());
+}
+
+std::shared_ptr<Buffer> WriteParquet(const Table& table, MemoryPool* pool) {
+  auto maybe_sink = io::BufferOutputStream::Create(1024, pool);
+  ABORT_NOT_OK(maybe_sink.status());
+  auto sink = *maybe_sink;
+  ABORT_NOT_OK(parquet::arrow::WriteTable(table, pool, sink, /*chunk_size=*/1 << 16));
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(sink->Finish(&buffer));
+  return buffer;
+}
+
+void SetPipelineCounters(benchmark::State& state, int64_t input_bytes,
+                         int64_t num_rows, int64_t peak_memory) {
+  state.SetBytesProcessed(state.iterations() * input_bytes);
+  state.SetItemsProcessed(state.iterations() * num_rows);
+  state.counters["peak_memory"] = static_cast<double>(peak_memory);
+}
+
+// CSV text -> Table -> Parquet file
+template <Shape shape>
+static void CsvToParquet(benchmark::State& state) {
+  auto csv = MakeCsv(*MakeTable(shape, kNumRows));
+  int64_t peak_memory = 0;
+
+  for (auto _ : state) {
+    ProxyMemoryPool pool(default_memory_pool());
+    auto read_options = csv::ReadOptions::Defaults();
+    auto reader = csv::TableReader::Make(&pool, std::make_shared<io::BufferReader>(csv),
+                                         read_options, csv::ParseOptions::Defaults(),
+                                         csv::ConvertOptions::Defaults());
+    ABORT_NOT_OK(reader.status());
+    auto table = (*reader)->Read();
+    ABORT_NOT_OK(table.status());
+    auto parquet = WriteParquet(**table, &pool);
+    benchmark::DoNotOptimize(parquet);
+    peak_memory = std::max(peak_memory, pool.max_memory());
+  }
+  SetPipelineCounters(state, csv->size(), kNumRows, peak_memory);
+}
+
+// Parquet files -> Scanner with a filter on 10% of the groups -> sum and count
+// of the values per group
+template <Shape shape>
+static void ParquetScanFilterAggregate(benchmark::State& state) {
+  auto table = MakeTable(shape, kNumRows);
+  std::vector<fs::FileStats> stats;
+  for (int i = 0; i < kNumFiles; ++i) {
+    fs::FileStats file;
+    file.set_type(fs::FileType::File);
+    file.set_path("data/part" + std::to_string(i) + ".parquet");
+    stats.push_back(file);
+  }
+  auto maybe_fs = fs::internal::MockFileSystem::Make(fs::kNoTime, {});
+  ABORT_NOT_OK(maybe_fs.status());
+  auto filesystem = *maybe_fs;
+  int64_t input_bytes = 0;
+  const int64_t rows_per_file = kNumRows / kNumFiles;
+  for (int i = 0; i < kNumFiles; ++i) {
+    auto slice = table->Slice(i * rows_per_file, rows_per_file);
+    auto buffer = WriteParquet(*slice, default_memory_pool());
+    auto maybe_stream = filesystem->OpenOutputStream(stats[i].path());
+    ABORT_NOT_OK(maybe_stream.status());
+    ABORT_NOT_OK((*maybe_stream)->Write(buffer));
+    ABORT_NOT_OK((*maybe_stream)->Close());
+    stats[i].set_size(buffer->size());
+    input_bytes += buffer->size();
+  }
+
+  int64_t peak_memory = 0;
+  for (auto _ : state) {
+    ProxyMemoryPool pool(default_memory_pool());
+    auto context = std::make_shared<ScanContext>();
+    context->pool = &pool;
+
+    auto source = FileSystemDataSource::Make(filesystem, stats, scalar(true),
+                                             std::make_shared<ParquetFileFormat>());
+    ABORT_NOT_OK(source.status());
+    auto dataset = Dataset::Make({*source}, table->schema());
+    ABORT_NOT_OK(dataset.status());
+    auto builder = (*dataset)->NewScan(context);
+    ABORT_NOT_OK(builder.status());
+    ABORT_NOT_OK((*builder)->Filter("group"_ < kNumGroups / 10));
+    auto scanner = (*builder)->Finish();
+    ABORT_NOT_OK(scanner.status());
+    auto scanned = (*scanner)->ToTable();
+    ABORT_NOT_OK(scanned.status());
+
+    compute::FunctionContext ctx(&pool);
+    const auto& values = (*scanned)->GetColumnByName("value");
+    compute::Datum out;
+    ABORT_NOT_OK(compute::GroupBy(
+        &ctx, {(*scanned)->GetColumnByName("group")},
+        {compute::GroupByAggregate(compute::GroupByAggregate::COUNT),
+         compute::GroupByAggregate(compute::GroupByAggregate::SUM)},
+        {values, values}, compute::GroupByOptions(), &out));
+    benchmark::DoNotOptimize(out);
+    peak_memory = std::max(peak_memory, pool.max_memory());
+  }
+  SetPipelineCounters(state, input_bytes, kNumRows, peak_memory);
+}
+
+// Table -> IPC stream -> Table, the wire format of Flight without the network
+template <Shape shape>
+static void IpcRoundTrip(benchmark::State& state) {
+  auto table = MakeTable(shape, kNumRows);
+  TableBatchReader batch_reader(*table);
+  batch_reader.set_chunksize(1 << 16);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ABORT_NOT_OK(batch_reader.ReadAll(&batches));
+
+  int64_t input_bytes = 0;
+  int64_t peak_memory = 0;
+  for (auto _ : state) {
+    ProxyMemoryPool pool(default_memory_pool());
+    auto maybe_sink = io::BufferOutputStream::Create(1024, &pool);
+    ABORT_NOT_OK(maybe_sink.status());
+    auto sink = *maybe_sink;
+    auto writer = ipc::RecordBatchStreamWriter::Open(sink.get(), table->schema());
+    ABORT_NOT_OK(writer.status());
+    for (const auto& batch : batches) {
+      ABORT_NOT_OK((*writer)->WriteRecordBatch(*batch));
+    }
+    ABORT_NOT_OK((*writer)->Close());
+    std::shared_ptr<Buffer> stream;
+    ABORT_NOT_OK(sink->Finish(&stream));
+    input_bytes = stream->size();
+
+    io::BufferReader source(stream);
+    std::shared_ptr<RecordBatchReader> reader;
+    ABORT_NOT_OK(ipc::RecordBatchStreamReader::Open(&source, &reader));
+    std::shared_ptr<Table> out;
+    ABORT_NOT_OK(reader->ReadAll(&out));
+    benchmark::DoNotOptimize(out);
+    peak_memory = std::max(peak_memory, pool.max_memory());
+  }
+  SetPipelineCounters(state, input_bytes, kNumRows, peak_memory);
+}
+
+BENCHMARK_TEMPLATE(CsvToParquet, Shape::STRINGS)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(CsvToParquet, Shape::WIDE)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(ParquetScanFilterAggregate, Shape::STRINGS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ParquetScanFilterAggregate, Shape::WIDE)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ParquetScanFilterAggregate, Shape::NESTED)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(IpcRoundTrip, Shape::STRINGS)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(IpcRoundTrip, Shape::WIDE)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(IpcRoundTrip, Shape::NESTED)->Unit(benchmark::kMillisecond);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -37,6 +37,7 @@ namespace dataset {
 RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
       missing_columns_(to_->num_fields(), nullptr),
+      sliced_missing_columns_(to_->num_fields(), nullptr),
       column_indices_(to_->num_fields(), kNoMatch),
       scalars_(to_->num_fields(), nullptr) {}
 
@@ -51,17 +52,40 @@ Status RecordBatchProjector::SetDefaultValue(int index, std::shared_ptr<Scalar>
   }
 
   scalars_[index] = std::move(scalar);
+  // The cached column of this field, if any, holds the previous default value
+  missing_columns_[index] = nullptr;
+  missing_columns_length_ = 0;
+  sliced_length_ = -1;
   return Status::OK();
 }
 
 Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
     const RecordBatch& batch, MemoryPool* pool) {
-  if (from_ == nullptr || !batch.schema()->Equals(*from_)) {
-    RETURN_NOT_OK(SetInputSchema(batch.schema(), pool));
+  if (batch.schema() != from_) {
+    if (from_ == nullptr || !batch.schema()->Equals(*from_)) {
+      RETURN_NOT_OK(SetInputSchema(batch.schema(), pool));
+    } else {
+      // An equal schema needs no new field indices; remember its pointer so that
+      // the following batches sharing it are not compared field by field again.
+      from_ = batch.schema();
+    }
   }
 
-  if (missing_columns_length_ < batch.num_rows()) {
-    RETURN_NOT_OK(ResizeMissingColumns(batch.num_rows(), pool));
+  const int64_t length = batch.num_rows();
+  if (missing_columns_length_ < length) {
+    RETURN_NOT_OK(ResizeMissingColumns(length, pool));
+  }
+  if (sliced_length_ != length) {
+    for (int i = 0; i < to_->num_fields(); ++i) {
+      if (column_indices_[i] != kNoMatch) {
+        sliced_missing_columns_[i] = nullptr;
+      } else if (missing_columns_[i]->length() == length) {
+        sliced_missing_columns_[i] = missing_columns_[i];
+      } else {
+        sliced_missing_columns_[i] = missing_columns_[i]->Slice(0, length);
+      }
+    }
+    sliced_length_ = length;
   }
 
   std::vector<std::shared_ptr<Array>> columns(to_->num_fields());
@@ -70,16 +94,18 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
     if (column_indices_[i] != kNoMatch) {
       columns[i] = batch.column(column_indices_[i]);
     } else {
-      columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
+      columns[i] = sliced_missing_columns_[i];
     }
   }
 
-  return RecordBatch::Make(to_, batch.num_rows(), std::move(columns));
+  return RecordBatch::Make(to_, length, std::move(columns));
 }
 
 Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
                                             MemoryPool* pool) {
   from_ = std::move(from);
+  // The set of missing columns may differ, slice them again
+  sliced_length_ = -1;
 
   for (int i = 0; i < to_->num_fields(); ++i) {
     const auto& field = to_->field(i);
@@ -87,18 +113,17 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
 
     if (matching_index != kNoMatch) {
       if (!from_->field(matching_index)->Equals(field)) {
-        return Status::TypeError("fields had matching names but were not equivalent ",
-                                 from_->field(matching_index)->ToString(), " vs ",
-                                 field->ToString());
+        auto status = Status::TypeError(
+            "fields had matching names but were not equivalent ",
+            from_->field(matching_index)->ToString(), " vs ", field->ToString());
+        // column_indices_ are partially resolved, resolve them again next time
+        from_ = nullptr;
+        return status;
       }
-
-      // Mark column i as not missing by setting missing_columns_[i] to nullptr
-      missing_columns_[i] = nullptr;
-    } else {
-      // Mark column i as missing by setting missing_columns_[i]
-      // to a non-null placeholder.
-      RETURN_NOT_OK(
-          MakeArrayOfNull(pool, to_->field(i)->type(), 0, &missing_columns_[i]));
+    } else if (missing_columns_[i] == nullptr) {
+      // A column missing for the first time is materialized on the next resize.
+      // The columns which were materialized before are kept.
+      missing_columns_length_ = 0;
     }
 
     column_indices_[i] = matching_index;
@@ -110,11 +135,14 @@ Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool
   // TODO(bkietz) MakeArrayOfNull could use fewer buffers by reusing a single zeroed
   // buffer for every buffer in every column which is null
   for (int i = 0; i < to_->num_fields(); ++i) {
-    if (missing_columns_[i] == nullptr) {
+    if (column_indices_[i] != kNoMatch) {
+      continue;
+    }
+    if (missing_columns_[i] != nullptr && missing_columns_[i]->length() >= new_length) {
       continue;
     }
     if (scalars_[i] == nullptr) {
-      RETURN_NOT_OK(MakeArrayOfNull(pool, missing_columns_[i]->type(), new_length,
+      RETURN_NOT_OK(MakeArrayOfNull(pool, to_->field(i)->type(), new_length,
                                     &missing_columns_[i]));
       continue;
     }
@@ -122,6 +150,7 @@ Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool
         MakeArrayFromScalar(pool, *scalars_[i], new_length, &missing_columns_[i]));
   }
   missing_columns_length_ = new_length;
+  sliced_length_ = -1;
   return Status::OK();
 }
 
@@ -37,7 +37,9 @@ namespace dataset {
 ///
 /// RecordBatchProjector is most efficient when projecting record batches with a
 /// consistent schema (for example batches from a table), but it can project record
-/// batches having any schema.
+/// batches having any schema. Field indices are resolved once per input schema, and
+/// the columns which are materialized from nulls or scalars are cached for the most
+/// recent batch length.
 class ARROW_DS_EXPORT RecordBatchProjector {
  public:
   static constexpr int kNoMatch = -1;
@@ -62,8 +64,12 @@ class ARROW_DS_EXPORT RecordBatchProjector {
   Status ResizeMissingColumns(int64_t new_length, MemoryPool* pool);
 
   std::shared_ptr<Schema> from_, to_;
+  // Columns absent from the input schema, materialized with the capacity
+  // missing_columns_length_, and their slices of the length of the last batch.
   int64_t missing_columns_length_ = 0;
   std::vector<std::shared_ptr<Array>> missing_columns_;
+  int64_t sliced_length_ = -1;
+  std::vector<std::shared_ptr<Array>> sliced_missing_columns_;
   std::vector<int> column_indices_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
 };
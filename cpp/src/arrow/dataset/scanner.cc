@@ -18,9 +18,15 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <sstream>
+#include <string>
 
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
@@ -29,10 +35,22 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace dataset {
 
+std::string ScanMetrics::ToString() const {
+  std::stringstream ss;
+  ss << "sources_pruned_by_partition=" << sources_pruned_by_partition
+     << " fragments_pruned_by_partition=" << fragments_pruned_by_partition
+     << " fragments_pruned_by_statistics=" << fragments_pruned_by_statistics
+     << " row_groups_skipped=" << row_groups_skipped << " bytes_read=" << bytes_read
+     << " decode_time_ns=" << decode_time_ns << " filter_time_ns=" << filter_time_ns
+     << " project_time_ns=" << project_time_ns;
+  return ss.str();
+}
+
 ScanOptions::ScanOptions(std::shared_ptr<Schema> schema)
     : filter(scalar(true)),
       evaluator(ExpressionEvaluator::Null()),
@@ -42,8 +60,15 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
     std::shared_ptr<Schema> schema) const {
   auto copy = ScanOptions::Make(std::move(schema));
   copy->use_threads = use_threads;
+  copy->fragment_readahead = fragment_readahead;
+  copy->batch_readahead = batch_readahead;
+  copy->readahead_bytes_limit = readahead_bytes_limit;
+  copy->coalesce_target_rows = coalesce_target_rows;
+  copy->coalesce_target_bytes = coalesce_target_bytes;
   copy->filter = filter;
+  copy->use_selection_vectors = use_selection_vectors;
   copy->evaluator = evaluator;
+  copy->metrics = metrics;
   return copy;
 }
 
@@ -67,8 +92,9 @@ Result<RecordBatchIterator> SimpleScanTask::Execute() {
 
 /// \brief GetScanTaskIterator transforms an Iterator<DataFragment> in a
 /// flattened Iterator<ScanTask>.
-static ScanTaskIterator GetScanTaskIterator(DataFragmentIterator fragments,
-                                            std::shared_ptr<ScanContext> context) {
+static Result<ScanTaskIterator> GetScanTaskIterator(
+    DataFragmentIterator fragments, std::shared_ptr<ScanContext> context,
+    int fragment_readahead) {
   // DataFragment -> ScanTaskIterator
   auto fn = [context](std::shared_ptr<DataFragment> fragment) {
     return fragment->Scan(context);
@@ -77,6 +103,13 @@ static ScanTaskIterator GetScanTaskIterator(DataFragmentIterator fragments,
   // Iterator<Iterator<ScanTask>>
   auto maybe_scantask_it = MakeMaybeMapIterator(fn, std::move(fragments));
 
+  if (fragment_readahead > 0) {
+    // Open the next fragments while the current one is being scanned
+    ARROW_ASSIGN_OR_RAISE(maybe_scantask_it,
+                          MakeReadaheadIterator(std::move(maybe_scantask_it),
+                                                fragment_readahead));
+  }
+
   // Iterator<ScanTask>
   return MakeFlattenIterator(std::move(maybe_scantask_it));
 }
@@ -89,11 +122,19 @@ Result<ScanTaskIterator> Scanner::Scan() {
   // Second, transforms Iterator<DataFragment> into a unified
   // Iterator<ScanTask>. The first Iterator::Next invocation is going to do
   // all the work of unwinding the chained iterators.
-  auto scan_task_it = GetScanTaskIterator(std::move(fragments_it), context_);
+  ARROW_ASSIGN_OR_RAISE(auto scan_task_it,
+                        GetScanTaskIterator(std::move(fragments_it), context_,
+                                            options_->fragment_readahead));
   // Third, apply the filter and/or projection to incoming RecordBatches by
-  // wrapping the ScanTask with a FilterAndProjectScanTask
-  auto wrap_scan_task = [](std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
-    return std::make_shared<FilterAndProjectScanTask>(std::move(task));
+  // wrapping the ScanTask with a FilterAndProjectScanTask. Batch readahead of all
+  // the ScanTasks of this Scan shares a single memory budget.
+  std::shared_ptr<ReadaheadBudget> budget;
+  if (options_->batch_readahead > 0 && options_->readahead_bytes_limit > 0) {
+    budget = std::make_shared<ReadaheadBudget>(options_->readahead_bytes_limit);
+  }
+  auto wrap_scan_task = [budget](
+                            std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
+    return std::make_shared<FilterAndProjectScanTask>(std::move(task), budget);
   };
   return MakeMapIterator(wrap_scan_task, std::move(scan_task_it));
 }
@@ -145,6 +186,53 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::UseSelectionVectors(bool use_selection_vectors) {
+  options_->use_selection_vectors = use_selection_vectors;
+  return Status::OK();
+}
+
+Status ScannerBuilder::FragmentReadahead(int fragment_readahead) {
+  if (fragment_readahead < 0) {
+    return Status::Invalid("FragmentReadahead must be greater than or equal to 0, got ",
+                           fragment_readahead);
+  }
+  options_->fragment_readahead = fragment_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::BatchReadahead(int batch_readahead) {
+  if (batch_readahead < 0) {
+    return Status::Invalid("BatchReadahead must be greater than or equal to 0, got ",
+                           batch_readahead);
+  }
+  options_->batch_readahead = batch_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::ReadaheadBytesLimit(int64_t readahead_bytes_limit) {
+  if (readahead_bytes_limit < 0) {
+    return Status::Invalid("ReadaheadBytesLimit must be greater than or equal to 0, got ",
+                           readahead_bytes_limit);
+  }
+  options_->readahead_bytes_limit = readahead_bytes_limit;
+  return Status::OK();
+}
+
+Status ScannerBuilder::RecordMetrics(std::shared_ptr<ScanMetrics> metrics) {
+  options_->metrics = std::move(metrics);
+  return Status::OK();
+}
+
+Status ScannerBuilder::CoalesceBatches(int64_t target_rows, int64_t target_bytes) {
+  if (target_rows < 0 || target_bytes < 0) {
+    return Status::Invalid("CoalesceBatches targets must be greater than or equal to 0, ",
+                           "got ", target_rows, " and ", target_bytes);
+  }
+  options_->coalesce_target_rows = target_rows;
+  options_->coalesce_target_bytes = target_bytes;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -154,7 +242,7 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!options->filter->Equals(true)) {
-    options->evaluator = std::make_shared<TreeEvaluator>();
+    options->evaluator = std::make_shared<TreeEvaluator>(options->use_selection_vectors);
   }
 
   return std::make_shared<Scanner>(dataset_->sources(), std::move(options), context_);
@@ -168,33 +256,45 @@ std::shared_ptr<TaskGroup> Scanner::TaskGroup() const {
 }
 
 struct TableAggregator {
-  void Append(std::shared_ptr<RecordBatch> batch) {
+  void Append(size_t scan_task_index, std::vector<std::shared_ptr<RecordBatch>> batches) {
     std::lock_guard<std::mutex> lock(m);
-    batches.emplace_back(std::move(batch));
+    if (scan_task_index >= task_batches.size()) {
+      task_batches.resize(scan_task_index + 1);
+    }
+    task_batches[scan_task_index] = std::move(batches);
   }
 
   Result<std::shared_ptr<Table>> Finish(const std::shared_ptr<Schema>& schema) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto& task : task_batches) {
+      batches.insert(batches.end(), task.begin(), task.end());
+    }
     std::shared_ptr<Table> out;
     RETURN_NOT_OK(Table::FromRecordBatches(schema, batches, &out));
     return out;
   }
 
   std::mutex m;
-  std::vector<std::shared_ptr<RecordBatch>> batches;
+  // The batches of each ScanTask, in the order of Scan
+  std::vector<std::vector<std::shared_ptr<RecordBatch>>> task_batches;
 };
 
 struct ScanTaskPromise {
   Status operator()() {
+    ARROW_TRACE_SPAN("dataset", "ScanTask");
+    std::vector<std::shared_ptr<RecordBatch>> batches;
     ARROW_ASSIGN_OR_RAISE(auto it, task->Execute());
     for (auto maybe_batch : it) {
       ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
-      aggregator.Append(std::move(batch));
+      batches.push_back(std::move(batch));
     }
 
+    aggregator.Append(scan_task_index, std::move(batches));
     return Status::OK();
   }
 
   TableAggregator& aggregator;
+  size_t scan_task_index;
   std::shared_ptr<ScanTask> task;
 };
 
@@ -202,16 +302,330 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
   auto task_group = TaskGroup();
 
   TableAggregator aggregator;
+  size_t scan_task_index = 0;
   ARROW_ASSIGN_OR_RAISE(auto it, Scan());
   for (auto maybe_scan_task : it) {
     ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
-    task_group->Append(ScanTaskPromise{aggregator, std::move(scan_task)});
+    task_group->Append(
+        ScanTaskPromise{aggregator, scan_task_index++, std::move(scan_task)});
   }
 
   // Wait for all tasks to complete, or the first error.
   RETURN_NOT_OK(task_group->Finish());
 
-  return aggregator.Finish(options_->schema());
+  ARROW_ASSIGN_OR_RAISE(auto table, aggregator.Finish(options_->schema()));
+  if (options_->coalesce_target_rows > 0 || options_->coalesce_target_bytes > 0) {
+    // Batches of different ScanTasks are only merged here
+    CoalesceOptions coalesce_options(options_->coalesce_target_rows,
+                                     options_->coalesce_target_bytes);
+    std::shared_ptr<Table> coalesced;
+    RETURN_NOT_OK(table->CoalesceChunks(coalesce_options, context_->pool, &coalesced));
+    return coalesced;
+  }
+  return table;
+}
+
+/// \brief Yield the batches of ScanTasks executed one after the other by the
+/// consumer
+class SerialScanBatchesIterator {
+ public:
+  explicit SerialScanBatchesIterator(ScanTaskIterator scan_tasks)
+      : scan_tasks_(std::move(scan_tasks)) {}
+
+  Result<TaggedRecordBatch> Next() {
+    for (;;) {
+      if (batches_ != IterationTraits<RecordBatchIterator>::End()) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, batches_.Next());
+        if (batch != nullptr) {
+          return TaggedRecordBatch{std::move(batch), scan_task_index_, batch_index_++};
+        }
+      }
+
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, scan_tasks_.Next());
+      if (scan_task == nullptr) {
+        return IterationTraits<TaggedRecordBatch>::End();
+      }
+      ++scan_task_index_;
+      batch_index_ = 0;
+      ARROW_ASSIGN_OR_RAISE(batches_, scan_task->Execute());
+    }
+  }
+
+ private:
+  ScanTaskIterator scan_tasks_;
+  RecordBatchIterator batches_;
+  int64_t scan_task_index_ = -1;
+  int64_t batch_index_ = 0;
+};
+
+/// \brief The state shared by a ThreadedScanBatchesIterator and the ScanTasks it
+/// executes in a ThreadPool
+///
+/// Only the consumer pulls ScanTasks and launches them, up to max_scan_tasks at a
+/// time. Each launched ScanTask has a slot buffering up to max_batches_per_task of
+/// its batches; a slot is retired once its ScanTask is finished and its batches
+/// were all yielded, which in order only happens to the first slot.
+class ThreadedScanBatchesState
+    : public std::enable_shared_from_this<ThreadedScanBatchesState> {
+ public:
+  ThreadedScanBatchesState(ScanTaskIterator scan_tasks, internal::ThreadPool* pool,
+                           bool ordered, size_t max_scan_tasks,
+                           size_t max_batches_per_task)
+      : scan_tasks_(std::move(scan_tasks)),
+        pool_(pool),
+        ordered_(ordered),
+        max_scan_tasks_(max_scan_tasks),
+        max_batches_per_task_(max_batches_per_task) {}
+
+  Result<TaggedRecordBatch> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      RETURN_NOT_OK(status_);
+
+      for (auto it = slots_.begin(); it != slots_.end();) {
+        if ((*it)->finished && (*it)->batches.empty()) {
+          it = slots_.erase(it);
+        } else if (ordered_) {
+          break;
+        } else {
+          ++it;
+        }
+      }
+
+      RETURN_NOT_OK(LaunchScanTasks(&lock));
+      if (slots_.empty()) {
+        return IterationTraits<TaggedRecordBatch>::End();
+      }
+
+      for (const auto& slot : slots_) {
+        if (!slot->batches.empty()) {
+          auto batch = std::move(slot->batches.front());
+          slot->batches.pop_front();
+          not_full_.notify_all();
+          return batch;
+        }
+        if (ordered_) {
+          break;
+        }
+      }
+
+      ready_.wait(lock);
+    }
+  }
+
+  /// \brief Release the ScanTasks waiting for room in their slot, and have the
+  /// others stop at their next batch
+  void Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    not_full_.notify_all();
+  }
+
+ private:
+  struct Slot {
+    int64_t scan_task_index;
+    std::deque<TaggedRecordBatch> batches;
+    bool finished = false;
+  };
+
+  Status LaunchScanTasks(std::unique_lock<std::mutex>* lock) {
+    while (!scan_tasks_exhausted_ && slots_.size() < max_scan_tasks_) {
+      // Only the consumer pulls ScanTasks, which may open DataFragments: don't
+      // block the ScanTasks in the meantime
+      lock->unlock();
+      auto maybe_scan_task = scan_tasks_.Next();
+      lock->lock();
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+      if (scan_task == nullptr) {
+        scan_tasks_exhausted_ = true;
+        break;
+      }
+
+      auto slot = std::make_shared<Slot>();
+      slot->scan_task_index = next_scan_task_index_++;
+      slots_.push_back(slot);
+      auto self = shared_from_this();
+      RETURN_NOT_OK(pool_->Spawn([self, slot, scan_task] {
+        self->Finish(slot.get(), self->RunScanTask(slot.get(), scan_task.get()));
+      }));
+    }
+    return Status::OK();
+  }
+
+  Status RunScanTask(Slot* slot, ScanTask* scan_task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return Status::OK();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto it, scan_task->Execute());
+    int64_t batch_index = 0;
+    for (auto maybe_batch : it) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_full_.wait(lock, [&] {
+        return stopped_ || slot->batches.size() < max_batches_per_task_;
+      });
+      if (stopped_) {
+        return Status::OK();
+      }
+      slot->batches.push_back(
+          TaggedRecordBatch{std::move(batch), slot->scan_task_index, batch_index++});
+      ready_.notify_one();
+    }
+    return Status::OK();
+  }
+
+  void Finish(Slot* slot, Status status) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slot->finished = true;
+    if (!status.ok() && status_.ok()) {
+      // The consumer reports the first error, the other ScanTasks are stopped
+      status_ = std::move(status);
+      stopped_ = true;
+      not_full_.notify_all();
+    }
+    ready_.notify_one();
+  }
+
+  ScanTaskIterator scan_tasks_;
+  internal::ThreadPool* pool_;
+  const bool ordered_;
+  const size_t max_scan_tasks_;
+  const size_t max_batches_per_task_;
+
+  std::mutex mutex_;
+  // Notified when a batch is buffered, or a ScanTask finishes
+  std::condition_variable ready_;
+  // Notified when a batch is yielded, or the scan is stopped
+  std::condition_variable not_full_;
+  std::list<std::shared_ptr<Slot>> slots_;
+  int64_t next_scan_task_index_ = 0;
+  bool scan_tasks_exhausted_ = false;
+  bool stopped_ = false;
+  Status status_;
+};
+
+class ThreadedScanBatchesIterator {
+ public:
+  explicit ThreadedScanBatchesIterator(std::shared_ptr<ThreadedScanBatchesState> state)
+      : state_(std::move(state)) {}
+
+  ThreadedScanBatchesIterator(ThreadedScanBatchesIterator&&) = default;
+  ThreadedScanBatchesIterator& operator=(ThreadedScanBatchesIterator&&) = default;
+
+  ~ThreadedScanBatchesIterator() {
+    if (state_ != nullptr) {
+      state_->Stop();
+    }
+  }
+
+  Result<TaggedRecordBatch> Next() { return state_->Next(); }
+
+ private:
+  std::shared_ptr<ThreadedScanBatchesState> state_;
+};
+
+Result<TaggedRecordBatchIterator> Scanner::ScanBatches() { return ScanBatches(true); }
+
+Result<TaggedRecordBatchIterator> Scanner::ScanBatchesUnordered() {
+  return ScanBatches(false);
+}
+
+Result<TaggedRecordBatchIterator> Scanner::ScanBatches(bool ordered) {
+  ARROW_ASSIGN_OR_RAISE(auto scan_tasks, Scan());
+  if (!options_->use_threads) {
+    return TaggedRecordBatchIterator(SerialScanBatchesIterator(std::move(scan_tasks)));
+  }
+
+  auto max_scan_tasks = static_cast<size_t>(
+      std::max(context_->thread_pool->GetCapacity(), 1));
+  auto max_batches_per_task = static_cast<size_t>(std::max(options_->batch_readahead, 1));
+  auto state = std::make_shared<ThreadedScanBatchesState>(
+      std::move(scan_tasks), context_->thread_pool, ordered, max_scan_tasks,
+      max_batches_per_task);
+  return TaggedRecordBatchIterator(ThreadedScanBatchesIterator(std::move(state)));
+}
+
+struct SummarizeFragmentPromise {
+  // Summarize the fragment from its metadata, or else by scanning it
+  Status operator()() {
+    ARROW_ASSIGN_OR_RAISE(auto fragment_summary, fragment->Summarize(columns));
+    if (fragment_summary == nullptr) {
+      fragment_summary = std::make_shared<ScanSummary>(columns.size());
+      ARROW_ASSIGN_OR_RAISE(auto scan_task_it, fragment->Scan(context));
+      for (auto maybe_scan_task : scan_task_it) {
+        ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+        FilterAndProjectScanTask task(std::move(scan_task));
+        ARROW_ASSIGN_OR_RAISE(auto batch_it, task.Execute());
+        for (auto maybe_batch : batch_it) {
+          ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+          RETURN_NOT_OK(SummarizeBatch(*batch, fragment_summary.get()));
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(*mutex);
+    return summary->Merge(*fragment_summary);
+  }
+
+  Status SummarizeBatch(const RecordBatch& batch, ScanSummary* out) {
+    out->num_rows += batch.num_rows();
+    compute::FunctionContext ctx(context->pool);
+    for (size_t i = 0; i < columns.size(); ++i) {
+      // Fragments may ignore the projection of the scan
+      auto column = batch.GetColumnByName(columns[i]);
+      if (column == nullptr) {
+        return Status::Invalid("Column ", columns[i], " is not in the scanned batches");
+      }
+      if (column->null_count() == column->length()) {
+        continue;
+      }
+      compute::Datum bounds;
+      RETURN_NOT_OK(compute::MinMax(&ctx, compute::MinMaxOptions(), *column, &bounds));
+      const auto& min_max = bounds.collection();
+      RETURN_NOT_OK(out->MergeBounds(i, min_max[0].scalar(), min_max[1].scalar()));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataFragment> fragment;
+  const std::vector<std::string>& columns;
+  std::shared_ptr<ScanContext> context;
+  std::mutex* mutex;
+  ScanSummary* summary;
+};
+
+Result<ScanSummary> Scanner::Summarize(const std::vector<std::string>& columns) {
+  RETURN_NOT_OK(EnsureColumnsInSchema(options_->schema(), columns));
+
+  // Fragments which are scanned need only read the summarized columns, or a
+  // single column to count rows since batches without columns may lack a row
+  // count
+  auto projected_columns = columns;
+  if (projected_columns.empty() && options_->schema()->num_fields() > 0) {
+    projected_columns.push_back(options_->schema()->field(0)->name());
+  }
+  auto options = options_->ReplaceSchema(
+      SchemaFromColumnNames(options_->schema(), projected_columns));
+
+  auto task_group = TaskGroup();
+  std::mutex mutex;
+  ScanSummary summary(columns.size());
+  for (auto maybe_fragment : GetFragmentsFromSources(sources_, options)) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, std::move(maybe_fragment));
+    task_group->Append(SummarizeFragmentPromise{std::move(fragment), columns, context_,
+                                                &mutex, &summary});
+  }
+
+  RETURN_NOT_OK(task_group->Finish());
+  return summary;
+}
+
+Result<int64_t> Scanner::CountRows() {
+  ARROW_ASSIGN_OR_RAISE(auto summary, Summarize());
+  return summary.num_rows;
 }
 
 }  // namespace dataset
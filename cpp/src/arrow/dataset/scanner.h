@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -29,6 +31,7 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/memory_pool.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -47,6 +50,33 @@ struct ARROW_DS_EXPORT ScanContext {
   internal::ThreadPool* thread_pool = arrow::internal::GetCpuThreadPool();
 };
 
+/// \brief Counters of the work done by a Scan, to tell where its time goes
+///
+/// A Scan updates the ScanMetrics of its ScanOptions, if any. The counters of a
+/// ScanMetrics shared by several Scans add up. Times are summed over all the
+/// threads of the Scan.
+struct ARROW_DS_EXPORT ScanMetrics {
+  /// DataSources whose partition expression can't satisfy the filter
+  std::atomic<int64_t> sources_pruned_by_partition{0};
+  /// Files skipped because the partition expression of a directory above them
+  /// can't satisfy the filter
+  std::atomic<int64_t> fragments_pruned_by_partition{0};
+  /// Files whose RowGroups (or stripes) were all skipped by their statistics
+  std::atomic<int64_t> fragments_pruned_by_statistics{0};
+  /// Parquet RowGroups and ORC stripes skipped by their statistics
+  std::atomic<int64_t> row_groups_skipped{0};
+  /// Bytes read from the files of a filesystem
+  std::atomic<int64_t> bytes_read{0};
+  /// Time spent reading and decoding RecordBatches in ScanTasks
+  std::atomic<int64_t> decode_time_ns{0};
+  /// Time spent filtering RecordBatches
+  std::atomic<int64_t> filter_time_ns{0};
+  /// Time spent projecting RecordBatches to the schema of the Scan
+  std::atomic<int64_t> project_time_ns{0};
+
+  std::string ToString() const;
+};
+
 class ARROW_DS_EXPORT ScanOptions {
  public:
   virtual ~ScanOptions() = default;
@@ -62,12 +92,39 @@ class ARROW_DS_EXPORT ScanOptions {
   // ScanContext.
   bool use_threads = false;
 
+  // Number of DataFragments to open ahead of the one currently scanned, in
+  // the background.  0 disables fragment readahead.
+  int fragment_readahead = 0;
+
+  // Number of RecordBatches each ScanTask reads, filters and projects ahead
+  // of the consumer, in the background.  0 disables batch readahead.
+  int batch_readahead = 0;
+
+  // Upper bound on the total size of the RecordBatches buffered by batch
+  // readahead across all the ScanTasks of a Scan.  Each ScanTask may
+  // always buffer one batch.  0 means no limit.
+  int64_t readahead_bytes_limit = 0;
+
+  // Merge consecutive small RecordBatches of each ScanTask, after filtering
+  // and projection, into batches of up to this many rows and bytes; ToTable
+  // also merges the chunks of the resulting Table.  Batches are passed through
+  // as they are if both targets are 0.  See MakeCoalescingIterator.
+  int64_t coalesce_target_rows = 0;
+  int64_t coalesce_target_bytes = 0;
+
   // Filter
   std::shared_ptr<Expression> filter;
 
+  // If the filter is a conjunction, evaluate each of its operands against the
+  // rows selected by the previous ones only.  See TreeEvaluator.
+  bool use_selection_vectors = false;
+
   // Evaluator for Filter
   std::shared_ptr<ExpressionEvaluator> evaluator;
 
+  // Counters updated by the Scan, or null to not collect them
+  std::shared_ptr<ScanMetrics> metrics;
+
   // Schema to which record batches will be reconciled
   const std::shared_ptr<Schema>& schema() const { return projector.schema(); }
 
@@ -136,6 +193,33 @@ Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext>);
 
+/// \brief A RecordBatch yielded by Scanner::ScanBatches, tagged with its position
+/// in the Scan.
+struct TaggedRecordBatch {
+  std::shared_ptr<RecordBatch> record_batch;
+  /// The index of the ScanTask which yielded the batch, in the order of
+  /// Scanner::Scan
+  int64_t scan_task_index;
+  /// The index of the batch among those yielded by its ScanTask
+  int64_t batch_index;
+
+  bool operator==(const TaggedRecordBatch& other) const {
+    return record_batch == other.record_batch &&
+           scan_task_index == other.scan_task_index && batch_index == other.batch_index;
+  }
+};
+
+}  // namespace dataset
+
+template <>
+struct IterationTraits<dataset::TaggedRecordBatch> {
+  static dataset::TaggedRecordBatch End() { return {NULLPTR, -1, -1}; }
+};
+
+namespace dataset {
+
+using TaggedRecordBatchIterator = Iterator<TaggedRecordBatch>;
+
 /// \brief Scanner is a materialized scan operation with context and options
 /// bound. A scanner is the class that glues ScanTask, DataFragment,
 /// and DataSource. In python pseudo code, it performs the following:
@@ -158,18 +242,49 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Stream the RecordBatches of the Scan in order: those of each ScanTask
+  /// in turn, in the order of Scan.
+  ///
+  /// If use_threads is set, as many ScanTasks as the ThreadPool of the ScanContext
+  /// has threads execute ahead of the consumer, each buffering up to
+  /// batch_readahead (at least one) RecordBatches. Batches of a ScanTask wait in
+  /// its buffer until those of the previous ScanTasks have been yielded, so at
+  /// most that many batches are buffered. Otherwise the ScanTasks execute one
+  /// after the other, as batches are consumed.
+  Result<TaggedRecordBatchIterator> ScanBatches();
+
+  /// \brief Stream the RecordBatches of the Scan as soon as any ScanTask yields
+  /// them, see ScanBatches.
+  ///
+  /// Without use_threads, the order is that of ScanBatches.
+  Result<TaggedRecordBatchIterator> ScanBatchesUnordered();
+
   /// \brief Convert a Scanner into a Table.
   ///
-  /// Use this convenience utility with care. This will serially materialize the
-  /// Scan result in memory before creating the Table.
+  /// Use this convenience utility with care. This will materialize the Scan
+  /// result in memory before creating the Table, whose chunks are in the order
+  /// of ScanBatches.
   Result<std::shared_ptr<Table>> ToTable();
 
+  /// \brief Summarize the rows which satisfy the filter: count them, and bound
+  /// the non-null values of the given columns.
+  ///
+  /// DataFragments whose metadata determines their summary, e.g. Parquet files
+  /// whose RowGroup statistics resolve the filter, are not scanned. The others
+  /// are scanned for the given columns only, which must then be numeric.
+  Result<ScanSummary> Summarize(const std::vector<std::string>& columns = {});
+
+  /// \brief Count the rows which satisfy the filter, see Summarize.
+  Result<int64_t> CountRows();
+
   std::shared_ptr<Schema> schema() const { return options_->schema(); }
 
  protected:
   /// \brief Return a TaskGroup according to ScanContext thread rules.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 
+  Result<TaggedRecordBatchIterator> ScanBatches(bool ordered);
+
   DataSourceVector sources_;
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
@@ -212,6 +327,38 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Indicate if the Scanner should evaluate the operands of a conjunctive
+  ///        filter against the rows selected by the previous operands only.
+  Status UseSelectionVectors(bool use_selection_vectors = true);
+
+  /// \brief Set the number of DataFragments to open ahead of the one currently
+  ///        scanned.
+  ///
+  /// \return Failure if `fragment_readahead` is negative.
+  Status FragmentReadahead(int fragment_readahead);
+
+  /// \brief Set the number of RecordBatches each ScanTask reads ahead of its
+  ///        consumer.
+  ///
+  /// \return Failure if `batch_readahead` is negative.
+  Status BatchReadahead(int batch_readahead);
+
+  /// \brief Bound the memory used by batch readahead across all ScanTasks of
+  ///        a Scan; 0 means no limit.
+  ///
+  /// \return Failure if `readahead_bytes_limit` is negative.
+  Status ReadaheadBytesLimit(int64_t readahead_bytes_limit);
+
+  /// \brief Merge consecutive small RecordBatches of each ScanTask into
+  ///        batches of up to `target_rows` rows and `target_bytes` bytes; 0
+  ///        means no limit, and both 0 disables merging.
+  ///
+  /// \return Failure if a target is negative.
+  Status CoalesceBatches(int64_t target_rows, int64_t target_bytes);
+
+  /// \brief Have the Scan update the counters of `metrics`; null disables them.
+  Status RecordMetrics(std::shared_ptr<ScanMetrics> metrics);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
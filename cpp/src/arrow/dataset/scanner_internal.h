@@ -17,52 +17,152 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/stopwatch.h"
 
 namespace arrow {
 namespace dataset {
 
-static inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
-                                                    const ExpressionEvaluator& evaluator,
-                                                    const Expression& filter,
-                                                    MemoryPool* pool) {
+// Call fn, adding the time it took to *time_ns if it is not null
+template <typename Fn>
+static inline auto Timed(std::atomic<int64_t>* time_ns, Fn&& fn) -> decltype(fn()) {
+  if (time_ns == NULLPTR) {
+    return fn();
+  }
+  internal::StopWatch watch;
+  watch.Start();
+  auto out = fn();
+  *time_ns += static_cast<int64_t>(watch.Stop());
+  return out;
+}
+
+// Time the batches yielded by an iterator, i.e. the reading and decoding of
+// the batches of a ScanTask
+class TimedRecordBatchIterator {
+ public:
+  TimedRecordBatchIterator(RecordBatchIterator it, std::atomic<int64_t>* time_ns)
+      : it_(std::move(it)), time_ns_(time_ns) {}
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    return Timed(time_ns_, [this] { return it_.Next(); });
+  }
+
+ private:
+  RecordBatchIterator it_;
+  std::atomic<int64_t>* time_ns_;
+};
+
+static inline RecordBatchIterator FilterRecordBatch(
+    RecordBatchIterator it, const ExpressionEvaluator& evaluator,
+    const Expression& filter, MemoryPool* pool,
+    std::atomic<int64_t>* time_ns = NULLPTR) {
   return MakeMaybeMapIterator(
-      [&filter, &evaluator, pool](std::shared_ptr<RecordBatch> in) {
-        return evaluator.Evaluate(filter, *in, pool).Map([&](compute::Datum selection) {
-          return evaluator.Filter(selection, in);
-        });
+      [&filter, &evaluator, pool, time_ns](std::shared_ptr<RecordBatch> in) {
+        return Timed(time_ns, [&] { return evaluator.FilterBatch(filter, in, pool); });
       },
       std::move(it));
 }
 
-static inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
-                                                     RecordBatchProjector* projector,
-                                                     MemoryPool* pool) {
+static inline RecordBatchIterator ProjectRecordBatch(
+    RecordBatchIterator it, RecordBatchProjector* projector, MemoryPool* pool,
+    std::atomic<int64_t>* time_ns = NULLPTR) {
   return MakeMaybeMapIterator(
-      [=](std::shared_ptr<RecordBatch> in) { return projector->Project(*in, pool); },
+      [=](std::shared_ptr<RecordBatch> in) {
+        return Timed(time_ns, [&] { return projector->Project(*in, pool); });
+      },
       std::move(it));
 }
 
+// An estimate of the memory held by an array, for readahead accounting
+static inline int64_t ArrayDataBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataBufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += ArrayDataBufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+static inline int64_t RecordBatchBufferSize(const std::shared_ptr<RecordBatch>& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    size += ArrayDataBufferSize(*batch->column_data(i));
+  }
+  return size;
+}
+
 class FilterAndProjectScanTask : public ScanTask {
  public:
-  explicit FilterAndProjectScanTask(std::shared_ptr<ScanTask> task)
-      : ScanTask(task->options(), task->context()), task_(std::move(task)) {}
+  explicit FilterAndProjectScanTask(std::shared_ptr<ScanTask> task,
+                                    std::shared_ptr<ReadaheadBudget> budget = NULLPTR)
+      : ScanTask(task->options(), task->context()),
+        task_(std::move(task)),
+        budget_(std::move(budget)) {}
 
   Result<RecordBatchIterator> Execute() override {
-    ARROW_ASSIGN_OR_RAISE(auto it, task_->Execute());
-    auto filter_it = FilterRecordBatch(std::move(it), *options_->evaluator,
-                                       *options_->filter, context_->pool);
-    return ProjectRecordBatch(std::move(filter_it), &task_->options()->projector,
-                              context_->pool);
+    ScanMetrics* metrics = options_->metrics.get();
+    std::atomic<int64_t>* decode_time_ns = NULLPTR;
+    std::atomic<int64_t>* filter_time_ns = NULLPTR;
+    std::atomic<int64_t>* project_time_ns = NULLPTR;
+    if (metrics != NULLPTR) {
+      decode_time_ns = &metrics->decode_time_ns;
+      filter_time_ns = &metrics->filter_time_ns;
+      project_time_ns = &metrics->project_time_ns;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          Timed(decode_time_ns, [this] { return task_->Execute(); }));
+    if (decode_time_ns != NULLPTR) {
+      it = RecordBatchIterator(TimedRecordBatchIterator(std::move(it), decode_time_ns));
+    }
+    // The filter may have been simplified to true for this task, e.g. by the
+    // statistics of a parquet RowGroup
+    auto filter_it = options_->filter->Equals(true)
+                         ? std::move(it)
+                         : FilterRecordBatch(std::move(it), *options_->evaluator,
+                                             *options_->filter, context_->pool,
+                                             filter_time_ns);
+    auto project_it = ProjectRecordBatch(std::move(filter_it),
+                                         &task_->options()->projector, context_->pool,
+                                         project_time_ns);
+    if (options_->coalesce_target_rows > 0 || options_->coalesce_target_bytes > 0) {
+      CoalesceOptions coalesce_options(options_->coalesce_target_rows,
+                                       options_->coalesce_target_bytes);
+      project_it = MakeCoalescingIterator(std::move(project_it), coalesce_options,
+                                          context_->pool);
+    }
+    if (options_->batch_readahead <= 0) {
+      return project_it;
+    }
+    // Read, filter and project the next batches while the consumer
+    // processes the current one
+    if (budget_ == nullptr) {
+      return MakeReadaheadIterator(std::move(project_it), options_->batch_readahead);
+    }
+    return MakeReadaheadIterator(std::move(project_it), options_->batch_readahead,
+                                 budget_, RecordBatchBufferSize);
   }
 
  private:
   std::shared_ptr<ScanTask> task_;
+  std::shared_ptr<ReadaheadBudget> budget_;
 };
 
 }  // namespace dataset
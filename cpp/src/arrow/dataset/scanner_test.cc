@@ -16,15 +16,23 @@
 // under the License.
 
 #include "arrow/dataset/scanner.h"
+
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 class TestScanner : public DatasetFixtureMixin {
@@ -68,6 +76,22 @@ TEST_F(TestScanner, Scan) {
   AssertScannerEqualsRepetitionsOf(MakeScanner(batch), batch);
 }
 
+TEST_F(TestScanner, ScanWithReadahead) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+
+  options_->fragment_readahead = 2;
+  options_->batch_readahead = 4;
+  AssertScannerEqualsRepetitionsOf(MakeScanner(batch), batch);
+
+  // A limit smaller than a single batch still lets every ScanTask progress
+  options_->readahead_bytes_limit = 1;
+  AssertScannerEqualsRepetitionsOf(MakeScanner(batch), batch);
+
+  options_->readahead_bytes_limit = 8 * kBatchSize * (sizeof(int32_t) + sizeof(double));
+  AssertScannerEqualsRepetitionsOf(MakeScanner(batch), batch);
+}
+
 TEST_F(TestScanner, FilteredScan) {
   SetSchema({field("f64", float64())});
 
@@ -133,13 +157,205 @@ TEST_F(TestScanner, ToTable) {
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
 
-  // There is no guarantee on the ordering when using multiple threads, but
-  // since the RecordBatch is always the same it will pass.
+  // The chunks are in the order of the ScanTasks when using multiple threads too
   options_->use_threads = true;
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, ToTableWithCoalescing) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  const int64_t total_batches = kNumberBatches * kNumberFragments * kNumberSources;
+  std::vector<std::shared_ptr<RecordBatch>> batches{total_batches, batch};
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches(batches, &expected));
+
+  options_->coalesce_target_rows = 4 * kBatchSize;
+  auto scanner = MakeScanner(batch);
+  ASSERT_OK_AND_ASSIGN(auto actual, scanner.ToTable());
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  for (int i = 0; i < actual->num_columns(); ++i) {
+    ASSERT_EQ(total_batches / 4, actual->column(i)->num_chunks());
+  }
+}
+
+TEST_F(TestScanner, RecordMetrics) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+
+  options_->filter = ("i32"_ == 0).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+  options_->metrics = std::make_shared<ScanMetrics>();
+  AssertScannerEqualsRepetitionsOf(MakeScanner(batch), batch);
+
+  const auto& metrics = *options_->metrics;
+  ASSERT_GT(metrics.decode_time_ns, 0);
+  ASSERT_GT(metrics.filter_time_ns, 0);
+  ASSERT_GT(metrics.project_time_ns, 0);
+  // Nothing is pruned or read from a file
+  ASSERT_EQ(metrics.sources_pruned_by_partition, 0);
+  ASSERT_EQ(metrics.bytes_read, 0);
+}
+
+// A DataFragment whose batches are all yielded by a single ScanTask
+class SingleScanTaskFragment : public SimpleDataFragment {
+ public:
+  using SimpleDataFragment::SimpleDataFragment;
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override {
+    return ScanTaskIteratorFromRecordBatch(record_batches_, scan_options_,
+                                           std::move(context));
+  }
+};
+
+class TestScanBatches : public TestScanner {
+ protected:
+  static constexpr int32_t kNumberTasks = 8;
+  static constexpr int32_t kBatchesPerTask = 4;
+
+  // The batch at position (i, j) holds the single value i * kBatchesPerTask + j
+  Scanner MakeScanner() {
+    SetSchema({field("i32", int32())});
+    DataFragmentVector fragments;
+    for (int32_t i = 0; i < kNumberTasks; ++i) {
+      std::vector<std::shared_ptr<RecordBatch>> batches;
+      for (int32_t j = 0; j < kBatchesPerTask; ++j) {
+        std::shared_ptr<Array> i32;
+        ArrayFromVector<Int32Type, int32_t>({i * kBatchesPerTask + j}, &i32);
+        batches.push_back(RecordBatch::Make(schema_, 1, {i32}));
+      }
+      fragments.push_back(std::make_shared<SingleScanTaskFragment>(batches, options_));
+    }
+    return Scanner{{std::make_shared<SimpleDataSource>(fragments)}, options_, ctx_};
+  }
+
+  // Return the positions of the batches in the order they were yielded
+  std::vector<int32_t> Positions(TaggedRecordBatchIterator it) {
+    std::vector<int32_t> positions;
+    for (auto maybe_batch : it) {
+      EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      auto position = static_cast<int32_t>(batch.scan_task_index * kBatchesPerTask +
+                                           batch.batch_index);
+      const auto& i32 = checked_cast<const Int32Array&>(*batch.record_batch->column(0));
+      EXPECT_EQ(i32.Value(0), position);
+      positions.push_back(position);
+    }
+    return positions;
+  }
+
+  std::vector<int32_t> AllPositions() {
+    std::vector<int32_t> positions(kNumberTasks * kBatchesPerTask);
+    std::iota(positions.begin(), positions.end(), 0);
+    return positions;
+  }
+};
+
+constexpr int32_t TestScanBatches::kNumberTasks;
+constexpr int32_t TestScanBatches::kBatchesPerTask;
+
+TEST_F(TestScanBatches, Ordered) {
+  auto scanner = MakeScanner();
+  for (bool use_threads : {false, true}) {
+    for (int batch_readahead : {0, 2}) {
+      options_->use_threads = use_threads;
+      options_->batch_readahead = batch_readahead;
+      ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatches());
+      ASSERT_EQ(Positions(std::move(it)), AllPositions());
+    }
+  }
+}
+
+TEST_F(TestScanBatches, Unordered) {
+  auto scanner = MakeScanner();
+  for (bool use_threads : {false, true}) {
+    options_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatchesUnordered());
+    auto positions = Positions(std::move(it));
+    std::sort(positions.begin(), positions.end());
+    ASSERT_EQ(positions, AllPositions());
+  }
+}
+
+TEST_F(TestScanBatches, StopEarly) {
+  auto scanner = MakeScanner();
+  options_->use_threads = true;
+  for (int i = 0; i < 10; ++i) {
+    // The ScanTasks waiting for the consumer are released
+    ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatchesUnordered());
+    ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+    ASSERT_NE(batch.record_batch, nullptr);
+  }
+}
+
+// A DataFragment whose metadata determines its summary, and which can't be
+// scanned. Its rows satisfy any filter, and only bound column "i32".
+class SummarizedFragment : public SimpleDataFragment {
+ public:
+  SummarizedFragment(int64_t num_rows, int32_t i32_min, int32_t i32_max,
+                     std::shared_ptr<ScanOptions> options)
+      : SimpleDataFragment({}, std::move(options)),
+        num_rows_(num_rows),
+        i32_min_(i32_min),
+        i32_max_(i32_max) {}
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override {
+    return Status::Invalid("SummarizedFragment can't be scanned");
+  }
+
+  Result<std::shared_ptr<ScanSummary>> Summarize(
+      const std::vector<std::string>& columns) override {
+    auto summary = std::make_shared<ScanSummary>(columns.size());
+    summary->num_rows = num_rows_;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (columns[i] == "i32") {
+        summary->min[i] = MakeScalar(i32_min_);
+        summary->max[i] = MakeScalar(i32_max_);
+      }
+    }
+    return summary;
+  }
+
+ private:
+  int64_t num_rows_;
+  int32_t i32_min_, i32_max_;
+};
+
+TEST_F(TestScanner, Summarize) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  std::shared_ptr<Array> i32, f64;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true}, {3, -1, 0, 7}, &i32);
+  ArrayFromVector<DoubleType, double>({1.5, 0.5, -4.0, 0.5}, &f64);
+  auto batch = RecordBatch::Make(schema_, 4, {i32, f64});
+
+  DataFragmentVector fragments{
+      std::make_shared<SimpleDataFragment>(
+          std::vector<std::shared_ptr<RecordBatch>>{batch, batch}, options_),
+      std::make_shared<SummarizedFragment>(100, -10, 5, options_)};
+  Scanner scanner({std::make_shared<SimpleDataSource>(fragments)}, options_, ctx_);
+
+  ASSERT_OK_AND_ASSIGN(auto summary, scanner.Summarize({"i32"}));
+  ASSERT_EQ(summary.num_rows, 108);
+  ASSERT_TRUE(summary.min[0]->Equals(*MakeScalar(-10)));
+  ASSERT_TRUE(summary.max[0]->Equals(*MakeScalar(7)));
+
+  // Rows which don't satisfy the filter are neither counted nor bounded
+  options_->filter = ("f64"_ > 1.0).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+  options_->use_threads = true;
+  ASSERT_OK_AND_ASSIGN(summary, scanner.Summarize({"i32", "f64"}));
+  ASSERT_EQ(summary.num_rows, 102);
+  ASSERT_TRUE(summary.min[0]->Equals(*MakeScalar(-10)));
+  ASSERT_TRUE(summary.max[0]->Equals(*MakeScalar(5)));
+  ASSERT_TRUE(summary.min[1]->Equals(*MakeScalar(1.5)));
+  ASSERT_TRUE(summary.max[1]->Equals(*MakeScalar(1.5)));
+  ASSERT_OK_AND_ASSIGN(auto num_rows, scanner.CountRows());
+  ASSERT_EQ(num_rows, 102);
+
+  ASSERT_RAISES(Invalid, scanner.Summarize({"i64"}));
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     DataSourceVector sources;
@@ -187,6 +403,21 @@ TEST_F(TestScannerBuilder, TestFilter) {
                 builder.Filter("i64"_ == int64_t(10) || "not_a_column"_ == true));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.FragmentReadahead(0));
+  ASSERT_OK(builder.FragmentReadahead(4));
+  ASSERT_OK(builder.BatchReadahead(0));
+  ASSERT_OK(builder.BatchReadahead(16));
+  ASSERT_OK(builder.ReadaheadBytesLimit(0));
+  ASSERT_OK(builder.ReadaheadBytesLimit(1 << 30));
+
+  ASSERT_RAISES(Invalid, builder.FragmentReadahead(-1));
+  ASSERT_RAISES(Invalid, builder.BatchReadahead(-1));
+  ASSERT_RAISES(Invalid, builder.ReadaheadBytesLimit(-1));
+}
+
 using testing::ElementsAre;
 using testing::IsEmpty;
 
@@ -55,6 +55,8 @@ struct DiscoveryOptions;
 class DataSourceDiscovery;
 
 class FileFormat;
+class FileWriter;
+class FileWriteOptions;
 
 class Expression;
 using ExpressionVector = std::vector<std::shared_ptr<Expression>>;
@@ -62,6 +64,8 @@ using ExpressionVector = std::vector<std::shared_ptr<Expression>>;
 class ComparisonExpression;
 class InExpression;
 class IsValidExpression;
+class StringMatchExpression;
+class StringFunctionExpression;
 class AndExpression;
 class OrExpression;
 class NotExpression;
@@ -78,8 +82,12 @@ class PartitionSchemeOrDiscovery;
 
 struct ScanContext;
 
+struct ScanMetrics;
+
 class ScanOptions;
 
+struct ScanSummary;
+
 class Scanner;
 
 class ScannerBuilder;
@@ -91,7 +99,7 @@ using ScanTaskIterator = Iterator<std::shared_ptr<ScanTask>>;
 class RecordBatchProjector;
 
 class DatasetWriter;
-class WriteContext;
+struct WriteContext;
 class WriteOptions;
 
 }  // namespace dataset
@@ -0,0 +1,573 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/writer.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+using internal::TaskGroup;
+
+namespace {
+
+int64_t ArrayDataBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataBufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += ArrayDataBufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+int64_t RecordBatchBufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += ArrayDataBufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+// Format the i-th value of an array as a partition key value
+struct PartitionValueFormatter {
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || std::is_same<T, BooleanType>::value ||
+                  std::is_same<T, FloatType>::value ||
+                  std::is_same<T, DoubleType>::value,
+              Status>
+  Visit(const T&) {
+    internal::StringFormatter<T> formatter(array.type());
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    return formatter(typed_array.Value(i), [this](util::string_view formatted) {
+      out = formatted.to_string();
+      return Status::OK();
+    });
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    out = checked_cast<const typename TypeTraits<T>::ArrayType&>(array).GetString(i);
+    if (out.find('/') != std::string::npos) {
+      return Status::Invalid("Partition key value '", out, "' contains a '/'");
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Partitioning by values of type ", type);
+  }
+
+  const Array& array;
+  int64_t i;
+  std::string out;
+};
+
+// The rows of a batch going to the same partition
+struct PartitionGroup {
+  std::string directory;
+  std::shared_ptr<RecordBatch> batch;
+};
+
+}  // namespace
+
+class DatasetWriter::Impl {
+ public:
+  Impl(std::shared_ptr<Schema> schema, std::shared_ptr<PartitionKeysScheme> scheme,
+       std::vector<int> partition_indices, std::shared_ptr<Schema> file_schema,
+       WriteContext context)
+      : schema_(std::move(schema)),
+        scheme_(std::move(scheme)),
+        partition_indices_(std::move(partition_indices)),
+        file_schema_(std::move(file_schema)),
+        context_(std::move(context)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) {
+    if (!batch->schema()->Equals(*schema_, false)) {
+      return Status::Invalid("Cannot write a batch of schema ", *batch->schema(),
+                             " to a dataset of schema ", *schema_);
+    }
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    std::vector<PartitionGroup> groups;
+    RETURN_NOT_OK(SplitBatch(*batch, &groups));
+    for (const auto& group : groups) {
+      RETURN_NOT_OK(WriteToPartition(group.directory, group.batch));
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::vector<Partition*> partitions;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& entry : partitions_) {
+        partitions.push_back(entry.second.get());
+      }
+    }
+    Status st;
+    for (Partition* partition : partitions) {
+      std::lock_guard<std::mutex> lock(partition->mutex);
+      if (partition->writer != nullptr) {
+        st &= CloseFile(partition);
+      }
+    }
+    return st;
+  }
+
+  std::vector<std::string> written_paths() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return written_paths_;
+  }
+
+ private:
+  // The files of a partition. Only one file is open at a time.
+  struct Partition {
+    explicit Partition(std::string directory) : directory(std::move(directory)) {}
+
+    const std::string directory;
+
+    // Serializes the writes to the partition, and guards the members below
+    std::mutex mutex;
+    std::unique_ptr<FileWriter> writer;
+    int64_t file_rows = 0;
+    int64_t file_bytes = 0;
+    int next_file_index = 0;
+
+    // Guarded by Impl::mutex_. A partition is only closed by another thread
+    // when no thread uses it.
+    bool open = false;
+    int in_use = 0;
+    uint64_t last_used = 0;
+  };
+
+  // Split a batch into the rows of each partition, without the partition fields
+  Status SplitBatch(const RecordBatch& batch, std::vector<PartitionGroup>* groups) {
+    const int64_t num_rows = batch.num_rows();
+    std::vector<std::shared_ptr<Array>> file_columns;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      if (std::find(partition_indices_.begin(), partition_indices_.end(), i) ==
+          partition_indices_.end()) {
+        file_columns.push_back(batch.column(i));
+      }
+    }
+    auto file_batch = RecordBatch::Make(file_schema_, num_rows, std::move(file_columns));
+
+    if (partition_indices_.empty()) {
+      groups->push_back({context_.base_dir, std::move(file_batch)});
+      return Status::OK();
+    }
+
+    // Hash the values of each partition field, then combine the codes of the
+    // fields into dense group ids
+    compute::FunctionContext ctx(context_.pool);
+    std::vector<int32_t> group_ids(num_rows, 0);
+    int64_t num_groups = 1;
+    std::vector<std::shared_ptr<Array>> dictionaries;
+    std::vector<std::shared_ptr<Array>> codes;
+    for (int index : partition_indices_) {
+      const auto& column = batch.column(index);
+      if (column->null_count() > 0) {
+        return Status::Invalid("Partition field '", schema_->field(index)->name(),
+                               "' has nulls");
+      }
+      compute::Datum encoded;
+      RETURN_NOT_OK(compute::DictionaryEncode(&ctx, column, &encoded));
+      auto encoded_array = encoded.make_array();
+      const auto& dict_array = checked_cast<const DictionaryArray&>(*encoded_array);
+      dictionaries.push_back(dict_array.dictionary());
+      codes.push_back(dict_array.indices());
+      const int32_t* field_codes =
+          checked_cast<const Int32Array&>(*codes.back()).raw_values();
+      const int64_t num_values = dict_array.dictionary()->length();
+
+      std::unordered_map<int64_t, int32_t> combined_ids;
+      for (int64_t row = 0; row < num_rows; ++row) {
+        const int64_t combined = group_ids[row] * num_values + field_codes[row];
+        const auto next_id = static_cast<int32_t>(combined_ids.size());
+        auto it = combined_ids.emplace(combined, next_id).first;
+        group_ids[row] = it->second;
+      }
+      num_groups = static_cast<int64_t>(combined_ids.size());
+    }
+
+    // Sort the row indices by group
+    std::vector<int64_t> group_offsets(num_groups + 1, 0);
+    std::vector<int64_t> first_rows(num_groups, -1);
+    for (int64_t row = 0; row < num_rows; ++row) {
+      ++group_offsets[group_ids[row] + 1];
+      if (first_rows[group_ids[row]] < 0) {
+        first_rows[group_ids[row]] = row;
+      }
+    }
+    std::partial_sum(group_offsets.begin(), group_offsets.end(), group_offsets.begin());
+    std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(context_.pool, num_rows * sizeof(int64_t),
+                                 &indices_buffer));
+    auto* indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+    std::vector<int64_t> positions(group_offsets.begin(), group_offsets.end() - 1);
+    for (int64_t row = 0; row < num_rows; ++row) {
+      indices[positions[group_ids[row]]++] = row;
+    }
+    Int64Array all_indices(num_rows, indices_buffer);
+
+    for (int64_t group = 0; group < num_groups; ++group) {
+      // Format the directory from the values of the first row of the group
+      std::string directory = context_.base_dir;
+      for (size_t k = 0; k < partition_indices_.size(); ++k) {
+        const int64_t code =
+            checked_cast<const Int32Array&>(*codes[k]).Value(first_rows[group]);
+        PartitionValueFormatter formatter{*dictionaries[k], code, ""};
+        RETURN_NOT_OK(VisitTypeInline(*dictionaries[k]->type(), &formatter));
+        PartitionKeysScheme::Key key{schema_->field(partition_indices_[k])->name(),
+                                     std::move(formatter.out)};
+        ARROW_ASSIGN_OR_RAISE(auto segment,
+                              scheme_->FormatKey(key, static_cast<int>(k)));
+        directory = fs::internal::ConcatAbstractPath(directory, segment);
+      }
+
+      std::shared_ptr<RecordBatch> group_batch = file_batch;
+      if (num_groups > 1) {
+        const int64_t begin = group_offsets[group];
+        const int64_t length = group_offsets[group + 1] - begin;
+        RETURN_NOT_OK(compute::Take(&ctx, *file_batch, *all_indices.Slice(begin, length),
+                                    compute::TakeOptions(), &group_batch));
+      }
+      groups->push_back({std::move(directory), std::move(group_batch)});
+    }
+    return Status::OK();
+  }
+
+  Status WriteToPartition(const std::string& directory,
+                          const std::shared_ptr<RecordBatch>& batch) {
+    Partition* partition = Acquire(directory);
+    Status st;
+    {
+      std::lock_guard<std::mutex> lock(partition->mutex);
+      st = WriteRows(partition, batch);
+    }
+    Release(partition);
+    return st;
+  }
+
+  // Append the rows of a batch to the files of a partition, starting new files
+  // as the files reach their targets
+  Status WriteRows(Partition* partition, const std::shared_ptr<RecordBatch>& batch) {
+    const int64_t num_rows = batch->num_rows();
+    const int64_t batch_bytes = RecordBatchBufferSize(*batch);
+    const int64_t row_bytes = std::max<int64_t>(batch_bytes / num_rows, 1);
+    const int64_t max_rows = context_.max_rows_per_file;
+    const int64_t max_bytes = context_.max_bytes_per_file;
+
+    int64_t offset = 0;
+    while (offset < num_rows) {
+      if (partition->writer == nullptr) {
+        RETURN_NOT_OK(OpenFile(partition));
+      }
+      int64_t length = num_rows - offset;
+      if (max_rows > 0) {
+        length = std::min(length, max_rows - partition->file_rows);
+      }
+      if (max_bytes > 0) {
+        const int64_t room = (max_bytes - partition->file_bytes) / row_bytes;
+        length = std::min(length, std::max<int64_t>(room, 1));
+      }
+
+      const auto slice =
+          length == num_rows ? batch : batch->Slice(offset, length);
+      RETURN_NOT_OK(partition->writer->Write(*slice));
+      partition->file_rows += length;
+      partition->file_bytes += length * row_bytes;
+      offset += length;
+
+      if ((max_rows > 0 && partition->file_rows >= max_rows) ||
+          (max_bytes > 0 && partition->file_bytes >= max_bytes)) {
+        RETURN_NOT_OK(CloseFile(partition));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Open the next file of a partition, whose mutex is held
+  Status OpenFile(Partition* partition) {
+    RETURN_NOT_OK(ReserveFile(partition));
+    auto st = [&]() -> Status {
+      if (partition->next_file_index == 0 && !partition->directory.empty()) {
+        RETURN_NOT_OK(context_.filesystem->CreateDir(partition->directory));
+      }
+      const std::string path = fs::internal::ConcatAbstractPath(
+          partition->directory, "part-" + std::to_string(partition->next_file_index++) +
+                                    "." + context_.format->type_name());
+      ARROW_ASSIGN_OR_RAISE(auto destination,
+                            context_.filesystem->OpenOutputStream(path));
+      ARROW_ASSIGN_OR_RAISE(partition->writer,
+                            context_.format->MakeWriter(destination, file_schema_,
+                                                        context_.format_options));
+      std::lock_guard<std::mutex> lock(mutex_);
+      written_paths_.push_back(path);
+      return Status::OK();
+    }();
+    if (!st.ok()) {
+      ReleaseFile(partition);
+    }
+    return st;
+  }
+
+  // Close the file of a partition, whose mutex is held
+  Status CloseFile(Partition* partition) {
+    auto st = partition->writer->Close();
+    partition->writer.reset();
+    partition->file_rows = 0;
+    partition->file_bytes = 0;
+    ReleaseFile(partition);
+    return st;
+  }
+
+  Partition* Acquire(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& partition = partitions_[directory];
+    if (partition == nullptr) {
+      partition.reset(new Partition(directory));
+    }
+    ++partition->in_use;
+    partition->last_used = ++clock_;
+    return partition.get();
+  }
+
+  void Release(Partition* partition) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--partition->in_use == 0) {
+      cv_.notify_all();
+    }
+  }
+
+  // Count a file about to be opened for a partition against max_open_files,
+  // first closing the least recently written file of an unused partition if
+  // there are too many open files
+  Status ReserveFile(Partition* self) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (num_open_files_ >= context_.max_open_files) {
+      Partition* victim = nullptr;
+      for (const auto& entry : partitions_) {
+        Partition* partition = entry.second.get();
+        if (partition->open && partition->in_use == 0 &&
+            (victim == nullptr || partition->last_used < victim->last_used)) {
+          victim = partition;
+        }
+      }
+      if (victim == nullptr) {
+        // All the open files are being written, wait for one to be released
+        cv_.wait(lock);
+        continue;
+      }
+
+      ++victim->in_use;
+      lock.unlock();
+      Status st;
+      {
+        std::lock_guard<std::mutex> victim_lock(victim->mutex);
+        // Its file may have been closed since by another user of the partition
+        if (victim->writer != nullptr) {
+          st = CloseFile(victim);
+        }
+      }
+      lock.lock();
+      --victim->in_use;
+      RETURN_NOT_OK(st);
+    }
+    ++num_open_files_;
+    self->open = true;
+    return Status::OK();
+  }
+
+  void ReleaseFile(Partition* partition) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    partition->open = false;
+    --num_open_files_;
+    cv_.notify_all();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<PartitionKeysScheme> scheme_;
+  std::vector<int> partition_indices_;
+  std::shared_ptr<Schema> file_schema_;
+  WriteContext context_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::unordered_map<std::string, std::unique_ptr<Partition>> partitions_;
+  int num_open_files_ = 0;
+  uint64_t clock_ = 0;
+  std::vector<std::string> written_paths_;
+};
+
+Result<std::shared_ptr<DatasetWriter>> DatasetWriter::Make(
+    std::shared_ptr<Schema> schema, std::shared_ptr<PartitionScheme> scheme,
+    WriteContext context) {
+  if (context.filesystem == nullptr || context.format == nullptr) {
+    return Status::Invalid("A filesystem and a format are required to write a dataset");
+  }
+  if (context.max_open_files < 1) {
+    return Status::Invalid("max_open_files must be positive");
+  }
+
+  std::vector<int> partition_indices;
+  std::shared_ptr<PartitionKeysScheme> keys_scheme;
+  if (scheme != nullptr && scheme->schema()->num_fields() > 0) {
+    keys_scheme = std::dynamic_pointer_cast<PartitionKeysScheme>(scheme);
+    if (keys_scheme == nullptr) {
+      return Status::NotImplemented("Writing datasets partitioned by the ",
+                                    scheme->type_name(), " partition scheme");
+    }
+    for (const auto& field : scheme->schema()->fields()) {
+      const int index = schema->GetFieldIndex(field->name());
+      if (index < 0) {
+        return Status::Invalid("Partition field '", field->name(),
+                               "' is not in the schema of the dataset");
+      }
+      partition_indices.push_back(index);
+    }
+  }
+
+  // The partition fields are not written to the files
+  std::vector<int> removed = partition_indices;
+  std::sort(removed.rbegin(), removed.rend());
+  std::shared_ptr<Schema> file_schema = schema;
+  for (int index : removed) {
+    std::shared_ptr<Schema> remaining;
+    RETURN_NOT_OK(file_schema->RemoveField(index, &remaining));
+    file_schema = std::move(remaining);
+  }
+
+  std::unique_ptr<Impl> impl(new Impl(std::move(schema), std::move(keys_scheme),
+                                      std::move(partition_indices),
+                                      std::move(file_schema), std::move(context)));
+  return std::shared_ptr<DatasetWriter>(new DatasetWriter(std::move(impl)));
+}
+
+DatasetWriter::DatasetWriter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+DatasetWriter::~DatasetWriter() {
+  auto st = impl_->Close();
+  if (!st.ok()) {
+    ARROW_LOG(WARNING) << "Error closing the files of a dataset: " << st.ToString();
+  }
+}
+
+Status DatasetWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  return impl_->Write(batch);
+}
+
+Status DatasetWriter::Close() { return impl_->Close(); }
+
+std::vector<std::string> DatasetWriter::written_paths() const {
+  return impl_->written_paths();
+}
+
+namespace {
+
+std::shared_ptr<TaskGroup> MakeTaskGroup(const WriteContext& context) {
+  return context.use_threads ? TaskGroup::MakeThreaded(internal::GetCpuThreadPool())
+                             : TaskGroup::MakeSerial();
+}
+
+}  // namespace
+
+Status WriteDataset(RecordBatchReader* reader, std::shared_ptr<PartitionScheme> scheme,
+                    const WriteContext& context) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto writer, DatasetWriter::Make(reader->schema(), std::move(scheme), context));
+  // Read ahead a window of batches, and write them while the next window is read
+  const int window = context.use_threads ? GetCpuThreadPoolCapacity() : 1;
+  bool done = false;
+  while (!done) {
+    auto task_group = MakeTaskGroup(context);
+    for (int i = 0; i < window; ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        done = true;
+        break;
+      }
+      task_group->Append([writer, batch] { return writer->Write(batch); });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+  }
+  return writer->Close();
+}
+
+Status WriteDataset(Scanner* scanner, std::shared_ptr<PartitionScheme> scheme,
+                    const WriteContext& context) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto writer, DatasetWriter::Make(scanner->schema(), std::move(scheme), context));
+  auto task_group = MakeTaskGroup(context);
+  ARROW_ASSIGN_OR_RAISE(auto scan_tasks, scanner->Scan());
+  for (auto maybe_scan_task : scan_tasks) {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+    task_group->Append([writer, scan_task]() -> Status {
+      ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
+      for (auto maybe_batch : batches) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+        RETURN_NOT_OK(writer->Write(batch));
+      }
+      return Status::OK();
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+  return writer->Close();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,14 +17,20 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
 
 namespace arrow {
+
+class RecordBatchReader;
+
 namespace dataset {
 
 class ARROW_DS_EXPORT WriteOptions {
@@ -32,5 +38,88 @@ class ARROW_DS_EXPORT WriteOptions {
   virtual ~WriteOptions() = default;
 };
 
+/// \brief Where and how a DatasetWriter writes files
+struct ARROW_DS_EXPORT WriteContext {
+  /// The filesystem and the directory the files are written to
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+
+  /// The format of the files, and its options (null for the defaults)
+  std::shared_ptr<FileFormat> format;
+  std::shared_ptr<FileWriteOptions> format_options;
+
+  /// Maximum number of files open at once. When another file must be opened,
+  /// the least recently written one is closed and its partition continues in
+  /// a new file.
+  int max_open_files = 128;
+
+  /// Number of rows after which a file is closed and its partition continues
+  /// in a new file, 0 for no limit
+  int64_t max_rows_per_file = 0;
+
+  /// Estimated number of bytes (the size of the written buffers) after which a
+  /// file is closed and its partition continues in a new file, 0 for no limit
+  int64_t max_bytes_per_file = 0;
+
+  /// Whether WriteDataset writes batches in parallel on the CPU thread pool
+  bool use_threads = true;
+
+  MemoryPool* pool = arrow::default_memory_pool();
+};
+
+/// \brief Write record batches to the files of a partitioned dataset
+///
+/// Each batch is split by the values of the fields of the partition scheme,
+/// which are not written to the files. The rows of a partition go to files
+/// named "part-<n>.<format>" in the directory formatted by the scheme, e.g.
+/// "year=2009/month=11" for a HivePartitionScheme.
+///
+/// Write() is thread-safe: concurrent batches are split in parallel, and
+/// written in parallel as long as they go to different partitions.
+class ARROW_DS_EXPORT DatasetWriter {
+ public:
+  /// \brief Make a writer of batches of the given schema
+  ///
+  /// The scheme must have no fields or be a PartitionKeysScheme whose fields
+  /// are in the schema.
+  static Result<std::shared_ptr<DatasetWriter>> Make(
+      std::shared_ptr<Schema> schema, std::shared_ptr<PartitionScheme> scheme,
+      WriteContext context);
+
+  ~DatasetWriter();
+
+  /// \brief Split a batch by partition and append the rows to the files of
+  /// their partitions
+  Status Write(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Close the open files. Must not run concurrently with Write().
+  Status Close();
+
+  /// \brief The paths of the files written so far
+  std::vector<std::string> written_paths() const;
+
+ private:
+  class Impl;
+  explicit DatasetWriter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Write the batches of a reader to a partitioned dataset
+///
+/// With context.use_threads, batches are read ahead up to the capacity of the
+/// CPU thread pool and written in parallel.
+ARROW_DS_EXPORT
+Status WriteDataset(RecordBatchReader* reader, std::shared_ptr<PartitionScheme> scheme,
+                    const WriteContext& context);
+
+/// \brief Write the result of a scan to a partitioned dataset
+///
+/// With context.use_threads, the scan tasks are executed and their batches
+/// written in parallel.
+ARROW_DS_EXPORT
+Status WriteDataset(Scanner* scanner, std::shared_ptr<PartitionScheme> scheme,
+                    const WriteContext& context);
+
 }  // namespace dataset
 }  // namespace arrow
@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/dataset/writer.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+/// \brief Writes the rows of int32 columns as comma separated text lines
+class TextFileWriter : public FileWriter {
+ public:
+  explicit TextFileWriter(std::shared_ptr<io::OutputStream> destination)
+      : destination_(std::move(destination)) {}
+
+  Status Write(const RecordBatch& batch) override {
+    std::string text;
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        const auto& column = checked_cast<const Int32Array&>(*batch.column(i));
+        text += (i > 0 ? "," : "") + std::to_string(column.Value(row));
+      }
+      text += "\n";
+    }
+    return destination_->Write(text.data(), static_cast<int64_t>(text.size()));
+  }
+
+  Status Close() override { return destination_->Close(); }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+};
+
+class TextFileFormat : public DummyFileFormat {
+ public:
+  std::string type_name() const override { return "txt"; }
+
+  Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<FileWriteOptions> options) const override {
+    for (const auto& field : schema->fields()) {
+      if (field->type()->id() != Type::INT32) {
+        return Status::TypeError("Cannot write field ", field->ToString());
+      }
+    }
+    return std::unique_ptr<FileWriter>(new TextFileWriter(std::move(destination)));
+  }
+};
+
+class TestDatasetWriter : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    context_.filesystem = fs_;
+    context_.base_dir = "out";
+    context_.format = std::make_shared<TextFileFormat>();
+    schema_ = schema({field("key", int32()), field("x", int32())});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::vector<int32_t>& keys,
+                                         const std::vector<int32_t>& xs) {
+    std::shared_ptr<Array> key_array, x_array;
+    ArrayFromVector<Int32Type, int32_t>(keys, &key_array);
+    ArrayFromVector<Int32Type, int32_t>(xs, &x_array);
+    return RecordBatch::Make(schema_, static_cast<int64_t>(keys.size()),
+                             {key_array, x_array});
+  }
+
+  std::shared_ptr<PartitionScheme> HiveScheme() {
+    return std::make_shared<HivePartitionScheme>(schema({field("key", int32())}));
+  }
+
+  void AssertFiles(const std::vector<fs::internal::FileInfo>& expected) {
+    ASSERT_EQ(fs_->AllFiles(), expected);
+  }
+
+ protected:
+  std::shared_ptr<fs::internal::MockFileSystem> fs_;
+  std::shared_ptr<Schema> schema_;
+  WriteContext context_;
+};
+
+TEST_F(TestDatasetWriter, NoPartitioning) {
+  auto scheme = std::make_shared<SchemaPartitionScheme>(schema({}));
+  ASSERT_OK_AND_ASSIGN(auto writer, DatasetWriter::Make(schema_, scheme, context_));
+  ASSERT_OK(writer->Write(MakeBatch({1, 2}, {10, 20})));
+  ASSERT_OK(writer->Write(MakeBatch({3}, {30})));
+  ASSERT_OK(writer->Close());
+
+  ASSERT_EQ(writer->written_paths(), std::vector<std::string>{"out/part-0.txt"});
+  AssertFiles({{"out/part-0.txt", fs::kNoTime, "1,10\n2,20\n3,30\n"}});
+}
+
+TEST_F(TestDatasetWriter, HivePartitioning) {
+  ASSERT_OK_AND_ASSIGN(auto writer, DatasetWriter::Make(schema_, HiveScheme(), context_));
+  ASSERT_OK(writer->Write(MakeBatch({1, 2, 1, 3}, {10, 20, 11, 30})));
+  ASSERT_OK(writer->Write(MakeBatch({2, 2}, {21, 22})));
+  ASSERT_OK(writer->Close());
+
+  // The partition field is not written to the files
+  AssertFiles({{"out/key=1/part-0.txt", fs::kNoTime, "10\n11\n"},
+               {"out/key=2/part-0.txt", fs::kNoTime, "20\n21\n22\n"},
+               {"out/key=3/part-0.txt", fs::kNoTime, "30\n"}});
+}
+
+TEST_F(TestDatasetWriter, MaxRowsPerFile) {
+  context_.max_rows_per_file = 2;
+  ASSERT_OK_AND_ASSIGN(auto writer, DatasetWriter::Make(schema_, HiveScheme(), context_));
+  ASSERT_OK(writer->Write(MakeBatch({1, 1, 1, 2}, {10, 11, 12, 20})));
+  ASSERT_OK(writer->Write(MakeBatch({1, 2}, {13, 21})));
+  ASSERT_OK(writer->Close());
+
+  AssertFiles({{"out/key=1/part-0.txt", fs::kNoTime, "10\n11\n"},
+               {"out/key=1/part-1.txt", fs::kNoTime, "12\n13\n"},
+               {"out/key=2/part-0.txt", fs::kNoTime, "20\n21\n"}});
+}
+
+TEST_F(TestDatasetWriter, MaxOpenFiles) {
+  context_.max_open_files = 1;
+  ASSERT_OK_AND_ASSIGN(auto writer, DatasetWriter::Make(schema_, HiveScheme(), context_));
+  ASSERT_OK(writer->Write(MakeBatch({1}, {10})));
+  // Opening the file of key=2 closes the file of key=1, which continues in a
+  // new file
+  ASSERT_OK(writer->Write(MakeBatch({2}, {20})));
+  ASSERT_OK(writer->Write(MakeBatch({1}, {11})));
+  ASSERT_OK(writer->Close());
+
+  AssertFiles({{"out/key=1/part-0.txt", fs::kNoTime, "10\n"},
+               {"out/key=1/part-1.txt", fs::kNoTime, "11\n"},
+               {"out/key=2/part-0.txt", fs::kNoTime, "20\n"}});
+}
+
+TEST_F(TestDatasetWriter, WriteDatasetFromReader) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(
+      {MakeBatch({1, 2}, {10, 20}), MakeBatch({2, 1}, {21, 11})}, &table));
+  TableBatchReader reader(*table);
+  context_.use_threads = false;
+  ASSERT_OK(WriteDataset(&reader, HiveScheme(), context_));
+
+  AssertFiles({{"out/key=1/part-0.txt", fs::kNoTime, "10\n11\n"},
+               {"out/key=2/part-0.txt", fs::kNoTime, "20\n21\n"}});
+}
+
+TEST_F(TestDatasetWriter, WriteDatasetInParallel) {
+  const int32_t num_keys = 5;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int32_t i = 0; i < 64; ++i) {
+    std::vector<int32_t> keys, xs;
+    for (int32_t j = 0; j < 10; ++j) {
+      keys.push_back((i + j) % num_keys);
+      xs.push_back(i * 10 + j);
+    }
+    batches.push_back(MakeBatch(keys, xs));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  TableBatchReader reader(*table);
+  context_.max_open_files = 2;
+  ASSERT_OK(WriteDataset(&reader, HiveScheme(), context_));
+
+  // Every row is written once, to a file of its partition
+  int64_t num_rows = 0;
+  for (const auto& file : fs_->AllFiles()) {
+    const int key = file.full_path[8] - '0';
+    ASSERT_EQ(file.full_path.substr(0, 8), "out/key=");
+    std::istringstream lines(file.data);
+    std::string line;
+    while (std::getline(lines, line)) {
+      const int32_t x = std::stoi(line);
+      ASSERT_EQ((x / 10 + x % 10) % num_keys, key);
+      ++num_rows;
+    }
+  }
+  ASSERT_EQ(num_rows, 640);
+}
+
+TEST_F(TestDatasetWriter, Errors) {
+  // Partition field missing from the schema
+  auto scheme = std::make_shared<HivePartitionScheme>(schema({field("y", int32())}));
+  ASSERT_RAISES(Invalid, DatasetWriter::Make(schema_, scheme, context_));
+
+  context_.max_open_files = 0;
+  ASSERT_RAISES(Invalid, DatasetWriter::Make(schema_, HiveScheme(), context_));
+  context_.max_open_files = 1;
+
+  // Null partition keys
+  ASSERT_OK_AND_ASSIGN(auto writer, DatasetWriter::Make(schema_, HiveScheme(), context_));
+  std::shared_ptr<Array> keys, xs;
+  ArrayFromVector<Int32Type, int32_t>({true, false}, {1, 2}, &keys);
+  ArrayFromVector<Int32Type, int32_t>({10, 20}, &xs);
+  ASSERT_RAISES(Invalid, writer->Write(RecordBatch::Make(schema_, 2, {keys, xs})));
+  ASSERT_OK(writer->Close());
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -121,6 +121,16 @@ Result<std::vector<FileStats>> FileSystem::GetTargetStats(
   return res;
 }
 
+Result<FileStatsBatchIterator> FileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto stats, GetTargetStats(select));
+  std::vector<std::vector<FileStats>> batches;
+  if (!stats.empty()) {
+    batches.push_back(std::move(stats));
+  }
+  return MakeVectorIterator(std::move(batches));
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
@@ -194,6 +204,21 @@ Result<std::vector<FileStats>> SubTreeFileSystem::GetTargetStats(
   return stats;
 }
 
+Result<FileStatsBatchIterator> SubTreeFileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  auto selector = select;
+  selector.base_dir = PrependBase(selector.base_dir);
+  ARROW_ASSIGN_OR_RAISE(auto batches, base_fs_->GetTargetStatsBatches(selector));
+  auto batches_ptr = std::make_shared<FileStatsBatchIterator>(std::move(batches));
+  return MakeFunctionIterator([this, batches_ptr]() -> Result<std::vector<FileStats>> {
+    ARROW_ASSIGN_OR_RAISE(auto stats, batches_ptr->Next());
+    for (auto& st : stats) {
+      RETURN_NOT_OK(FixStats(&st));
+    }
+    return stats;
+  });
+}
+
 Status SubTreeFileSystem::CreateDir(const std::string& path, bool recursive) {
   auto s = path;
   RETURN_NOT_OK(PrependBaseNonEmpty(&s));
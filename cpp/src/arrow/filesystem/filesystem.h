@@ -27,6 +27,7 @@
 
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -164,6 +165,20 @@ struct ARROW_EXPORT FileSelector {
   FileSelector() {}
 };
 
+}  // namespace fs
+
+template <>
+struct IterationTraits<std::vector<fs::FileStats>> {
+  static std::vector<fs::FileStats> End() { return {}; }
+};
+
+namespace fs {
+
+/// \brief An iterator over batches of FileStats
+///
+/// Batches are never empty: an empty batch marks the end of iteration.
+using FileStatsBatchIterator = Iterator<std::vector<FileStats>>;
+
 /// \brief Abstract file system API
 class ARROW_EXPORT FileSystem {
  public:
@@ -187,6 +202,17 @@ class ARROW_EXPORT FileSystem {
   /// it exists.
   /// If it doesn't exist, see `FileSelector::allow_non_existent`.
   virtual Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) = 0;
+  /// Same, yielding the selected entries in batches as they are listed.
+  ///
+  /// This allows processing the entries of large trees before listing
+  /// is complete.  Entries may be yielded in a different order than
+  /// GetTargetStats(const FileSelector&) would return them.  The filesystem
+  /// must outlive the iterator.
+  ///
+  /// The default implementation yields the result of
+  /// GetTargetStats(const FileSelector&) as a single batch.
+  virtual Result<FileStatsBatchIterator> GetTargetStatsBatches(
+      const FileSelector& select);
 
   /// Create a directory and subdirectories.
   ///
@@ -266,6 +292,8 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<FileStatsBatchIterator> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -22,6 +22,7 @@
 
 #include "arrow/filesystem/hdfs.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/filesystem/util_internal.h"
 #include "arrow/io/hdfs.h"
 #include "arrow/io/hdfs_internal.h"
 #include "arrow/util/logging.h"
@@ -89,16 +90,18 @@ class HadoopFileSystem::Impl {
     return st;
   }
 
-  Status StatSelector(const std::string& wd, const std::string& path,
-                      const FileSelector& select, int nesting_depth,
-                      std::vector<FileStats>* out) {
+  // List the entries of a single directory (subdirectories are walked by the caller)
+  Result<std::vector<FileStats>> StatDirectory(const std::string& wd,
+                                               const std::string& path,
+                                               const FileSelector& select) {
+    std::vector<FileStats> out;
     std::vector<io::HdfsPathInfo> children;
     Status st = client_->ListDirectory(path, &children);
     if (!st.ok()) {
       if (select.allow_non_existent) {
         ARROW_ASSIGN_OR_RAISE(auto stat, GetTargetStats(path));
         if (stat.type() == FileType::NonExistent) {
-          return Status::OK();
+          return out;
         }
       }
       return st;
@@ -115,18 +118,12 @@ class HadoopFileSystem::Impl {
       FileStats stat;
       stat.set_path(child_path);
       PathInfoToFileStats(child_info, &stat);
-      const bool is_dir = stat.type() == FileType::Directory;
-      out->push_back(std::move(stat));
-      if (is_dir && select.recursive && nesting_depth < select.max_recursion) {
-        RETURN_NOT_OK(StatSelector(wd, child_path, select, nesting_depth + 1, out));
-      }
+      out.push_back(std::move(stat));
     }
-    return Status::OK();
+    return out;
   }
 
-  Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) {
-    std::vector<FileStats> results;
-
+  Result<FileStatsBatchIterator> GetTargetStatsBatches(const FileSelector& select) {
     std::string wd;
     if (select.base_dir.empty() || select.base_dir.front() != '/') {
       // Fetch working directory, because we need to trim it from the start
@@ -143,8 +140,11 @@ class HadoopFileSystem::Impl {
           "GetTargetStates expects base_dir of selector to be a directory, while '",
           select.base_dir, "' is a file");
     }
-    RETURN_NOT_OK(StatSelector(wd, select.base_dir, select, 0, &results));
-    return results;
+    auto list_dir = [this, wd, select](const std::string& path, int32_t) {
+      return StatDirectory(wd, path, select);
+    };
+    return internal::WalkDirectories(std::move(list_dir), select,
+                                     internal::DefaultListingParallelism(select));
   }
 
   Status CreateDir(const std::string& path, bool recursive) {
@@ -290,6 +290,16 @@ void HdfsOptions::ConfigureHdfsBlockSize(int64_t default_block_size) {
   this->default_block_size = default_block_size;
 }
 
+void HdfsOptions::ConfigureShortCircuitReads(const std::string& domain_socket_path) {
+  connection_config.short_circuit_reads = true;
+  connection_config.domain_socket_path = domain_socket_path;
+}
+
+void HdfsOptions::ConfigureHedgedReads(int32_t threadpool_size, int64_t threshold_ms) {
+  connection_config.hedged_read_threadpool_size = threadpool_size;
+  connection_config.hedged_read_threshold_ms = threshold_ms;
+}
+
 Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
   HdfsOptions options;
 
@@ -349,6 +359,31 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     const auto& v = it->second;
     options.ConfigureHdfsUser(v);
   }
+  it = options_map.find("domain_socket_path");
+  if (it != options_map.end()) {
+    options.ConfigureShortCircuitReads(it->second);
+  }
+  it = options_map.find("hedged_read_threads");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    ::arrow::internal::StringConverter<Int32Type> converter;
+    int32_t threads;
+    if (!converter(v.data(), v.size(), &threads)) {
+      return Status::Invalid("Invalid value for option 'hedged_read_threads': '", v,
+                             "'");
+    }
+    int64_t threshold_ms = 0;
+    it = options_map.find("hedged_read_threshold_ms");
+    if (it != options_map.end()) {
+      const auto& threshold = it->second;
+      ::arrow::internal::StringConverter<Int64Type> threshold_converter;
+      if (!threshold_converter(threshold.data(), threshold.size(), &threshold_ms)) {
+        return Status::Invalid("Invalid value for option 'hedged_read_threshold_ms': '",
+                               threshold, "'");
+      }
+    }
+    options.ConfigureHedgedReads(threads, threshold_ms);
+  }
   return options;
 }
 
@@ -376,7 +411,13 @@ Result<FileStats> HadoopFileSystem::GetTargetStats(const std::string& path) {
 
 Result<std::vector<FileStats>> HadoopFileSystem::GetTargetStats(
     const FileSelector& select) {
-  return impl_->GetTargetStats(select);
+  ARROW_ASSIGN_OR_RAISE(auto batches, impl_->GetTargetStatsBatches(select));
+  return internal::CollectFileStats(std::move(batches));
+}
+
+Result<FileStatsBatchIterator> HadoopFileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  return impl_->GetTargetStatsBatches(select);
 }
 
 Status HadoopFileSystem::CreateDir(const std::string& path, bool recursive) {
@@ -48,6 +48,12 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureHdfsUser(const std::string& user_name);
   void ConfigureHdfsBufferSize(int32_t buffer_size);
   void ConfigureHdfsBlockSize(int64_t default_block_size);
+  /// Read blocks stored on the local host directly from disk, through the
+  /// given domain socket shared with the datanode
+  void ConfigureShortCircuitReads(const std::string& domain_socket_path);
+  /// Start a second read against another replica when a random access read
+  /// takes longer than threshold_ms (0 keeps the HDFS client default)
+  void ConfigureHedgedReads(int32_t threadpool_size, int64_t threshold_ms = 0);
 
   static Result<HdfsOptions> FromUri(const ::arrow::internal::Uri& uri);
   static Result<HdfsOptions> FromUri(const std::string& uri);
@@ -68,6 +74,8 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<FileStatsBatchIterator> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
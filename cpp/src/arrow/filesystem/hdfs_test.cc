@@ -68,6 +68,20 @@ TEST(TestHdfsOptions, FromUri) {
   ASSERT_EQ(options.connection_config.port, 0);
   ASSERT_EQ(options.connection_config.user, "");
   ASSERT_EQ(options.connection_config.driver, HdfsDriver::LIBHDFS);
+  ASSERT_FALSE(options.connection_config.short_circuit_reads);
+  ASSERT_EQ(options.connection_config.hedged_read_threadpool_size, 0);
+
+  ASSERT_OK(
+      uri.Parse("hdfs://otherhost:9999/?domain_socket_path=/var/run/dn_socket"
+                "&hedged_read_threads=8&hedged_read_threshold_ms=50"));
+  ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
+  ASSERT_TRUE(options.connection_config.short_circuit_reads);
+  ASSERT_EQ(options.connection_config.domain_socket_path, "/var/run/dn_socket");
+  ASSERT_EQ(options.connection_config.hedged_read_threadpool_size, 8);
+  ASSERT_EQ(options.connection_config.hedged_read_threshold_ms, 50);
+
+  ASSERT_OK(uri.Parse("hdfs://otherhost:9999/?hedged_read_threads=x"));
+  ASSERT_RAISES(Invalid, HdfsOptions::FromUri(uri));
 }
 
 struct JNIDriver {
@@ -166,15 +166,18 @@ Result<FileStats> StatFile(const std::string& path) {
 
 #endif
 
-Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
-                    int32_t nesting_depth, std::vector<FileStats>* out) {
+// List the entries of a single directory (subdirectories are walked by the caller)
+Result<std::vector<FileStats>> StatDirectory(const std::string& path,
+                                             const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto dir_fn, PlatformFilename::FromString(path));
+  std::vector<FileStats> out;
   auto result = ListDir(dir_fn);
   if (!result.ok()) {
     auto status = result.status();
     if (select.allow_non_existent && status.IsIOError()) {
       ARROW_ASSIGN_OR_RAISE(bool exists, FileExists(dir_fn));
       if (!exists) {
-        return Status::OK();
+        return out;
       }
     }
     return status;
@@ -184,14 +187,10 @@ Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
     PlatformFilename full_fn = dir_fn.Join(child_fn);
     ARROW_ASSIGN_OR_RAISE(FileStats st, StatFile(full_fn.ToNative()));
     if (st.type() != FileType::NonExistent) {
-      out->push_back(std::move(st));
-    }
-    if (nesting_depth < select.max_recursion && select.recursive &&
-        st.type() == FileType::Directory) {
-      RETURN_NOT_OK(StatSelector(full_fn, select, nesting_depth + 1, out));
+      out.push_back(std::move(st));
     }
   }
-  return Status::OK();
+  return out;
 }
 
 }  // namespace
@@ -214,10 +213,19 @@ Result<FileStats> LocalFileSystem::GetTargetStats(const std::string& path) {
 
 Result<std::vector<FileStats>> LocalFileSystem::GetTargetStats(
     const FileSelector& select) {
-  ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(select.base_dir));
-  std::vector<FileStats> results;
-  RETURN_NOT_OK(StatSelector(fn, select, 0, &results));
-  return results;
+  ARROW_ASSIGN_OR_RAISE(auto batches, GetTargetStatsBatches(select));
+  return internal::CollectFileStats(std::move(batches));
+}
+
+Result<FileStatsBatchIterator> LocalFileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
+  // Subdirectories are listed concurrently, as readdir() and stat() calls are
+  // mostly waiting for the disk or network on large trees
+  auto list_dir = [select](const std::string& path, int32_t) {
+    return StatDirectory(path, select);
+  };
+  return internal::WalkDirectories(std::move(list_dir), select,
+                                   internal::DefaultListingParallelism(select));
 }
 
 Status LocalFileSystem::CreateDir(const std::string& path, bool recursive) {
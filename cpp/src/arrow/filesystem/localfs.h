@@ -55,6 +55,8 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<FileStatsBatchIterator> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
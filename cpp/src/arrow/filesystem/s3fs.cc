@@ -19,7 +19,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <future>
 #include <mutex>
 #include <sstream>
 #include <utility>
@@ -63,12 +67,14 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/s3_internal.h"
+#include "arrow/filesystem/util_internal.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace fs {
@@ -251,16 +257,36 @@ std::string FormatRange(int64_t start, int64_t length) {
   return ss.str();
 }
 
-Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t start,
-                      int64_t length, S3Model::GetObjectResult* out) {
+S3Model::GetObjectRequest GetObjectRangeRequest(const S3Path& path, int64_t start,
+                                                int64_t length) {
   S3Model::GetObjectRequest req;
   req.SetBucket(ToAwsString(path.bucket));
   req.SetKey(ToAwsString(path.key));
   req.SetRange(ToAwsString(FormatRange(start, length)));
-  ARROW_AWS_ASSIGN_OR_RAISE(*out, client->GetObject(req));
+  return req;
+}
+
+Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t start,
+                      int64_t length, S3Model::GetObjectResult* out) {
+  ARROW_TRACE_SPAN_DETAIL("filesystem", "S3GetObject", path.full_path);
+  ARROW_AWS_ASSIGN_OR_RAISE(*out,
+                            client->GetObject(GetObjectRangeRequest(path, start, length)));
   return Status::OK();
 }
 
+// Copy the body of a GetObject response into a new buffer
+Result<std::shared_ptr<Buffer>> GetObjectBody(S3Model::GetObjectResult* result,
+                                              int64_t nbytes) {
+  std::shared_ptr<ResizableBuffer> buf;
+  RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
+  auto& stream = result->GetBody();
+  stream.read(reinterpret_cast<char*>(buf->mutable_data()), nbytes);
+  // NOTE: stream.fail() may return true if EOF is reached, see ReadAt() below.
+  DCHECK_LE(stream.gcount(), nbytes);
+  RETURN_NOT_OK(buf->Resize(stream.gcount()));
+  return buf;
+}
+
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile : public io::RandomAccessFile {
  public:
@@ -270,6 +296,7 @@ class ObjectInputFile : public io::RandomAccessFile {
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
     // errors (e.g. file not found) don't wait until the first Read() call.
+    ARROW_TRACE_SPAN_DETAIL("filesystem", "S3HeadObject", path_.full_path);
     S3Model::HeadObjectRequest req;
     req.SetBucket(ToAwsString(path_.bucket));
     req.SetKey(ToAwsString(path_.key));
@@ -372,6 +399,33 @@ class ObjectInputFile : public io::RandomAccessFile {
     return buf;
   }
 
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override {
+    Status st = CheckClosed();
+    if (st.ok()) {
+      st = CheckPosition(position, "read");
+    }
+    if (!st.ok()) {
+      return io::internal::MakeReadyFuture<Result<std::shared_ptr<Buffer>>>(st);
+    }
+
+    nbytes = std::min(nbytes, content_length_ - position);
+    if (nbytes == 0) {
+      return io::internal::MakeReadyFuture<Result<std::shared_ptr<Buffer>>>(
+          std::make_shared<Buffer>(nullptr, 0));
+    }
+
+    // The request is issued right away on the AWS SDK's executor; the
+    // response body is only copied out when the result is waited for.
+    auto outcome = std::make_shared<S3Model::GetObjectOutcomeCallable>(
+        client_->GetObjectCallable(GetObjectRangeRequest(path_, position, nbytes)));
+    return std::async(std::launch::deferred,
+                      [outcome, nbytes]() -> Result<std::shared_ptr<Buffer>> {
+                        ARROW_AWS_ASSIGN_OR_RAISE(auto result, outcome->get());
+                        return GetObjectBody(&result, nbytes);
+                      });
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) override {
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
     pos_ += bytes_read;
@@ -392,6 +446,114 @@ class ObjectInputFile : public io::RandomAccessFile {
   int64_t content_length_ = -1;
 };
 
+// A sequential InputStream over a S3 object that keeps up to `ranges` range
+// requests of `range_size` bytes in flight ahead of the current position,
+// so that the download of the following data overlaps with the consumption
+// of the current range.
+class ObjectReadaheadStream : public io::InputStream {
+ public:
+  ObjectReadaheadStream(std::shared_ptr<ObjectInputFile> file, int32_t ranges,
+                        int64_t range_size)
+      : file_(std::move(file)), ranges_(ranges), range_size_(range_size) {}
+
+  Status Close() override {
+    pending_.clear();
+    current_.reset();
+    return file_->Close();
+  }
+
+  bool closed() const override { return file_->closed(); }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(file_->CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(file_->CheckClosed());
+    auto dest = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      RETURN_NOT_OK(EnsureCurrentRange());
+      if (current_ == nullptr) {
+        // End of object
+        break;
+      }
+      const int64_t n =
+          std::min(nbytes - bytes_read, current_->size() - current_offset_);
+      memcpy(dest + bytes_read, current_->data() + current_offset_, n);
+      bytes_read += n;
+      current_offset_ += n;
+    }
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    RETURN_NOT_OK(file_->CheckClosed());
+    RETURN_NOT_OK(EnsureCurrentRange());
+    if (current_ != nullptr && nbytes <= current_->size() - current_offset_) {
+      // Entirely within the current range, no need to copy
+      auto buf = SliceBuffer(current_, current_offset_, nbytes);
+      current_offset_ += nbytes;
+      pos_ += nbytes;
+      return buf;
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file_->GetSize());
+    nbytes = std::min(nbytes, size - pos_);
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    return buf;
+  }
+
+ protected:
+  // Make current_ point to a range with unread data, or null at end of object
+  Status EnsureCurrentRange() {
+    if (current_ != nullptr && current_offset_ < current_->size()) {
+      return Status::OK();
+    }
+    current_.reset();
+    RETURN_NOT_OK(RequestRanges());
+    if (pending_.empty()) {
+      return Status::OK();
+    }
+    auto future = std::move(pending_.front());
+    pending_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(current_, future.get());
+    current_offset_ = 0;
+    if (current_->size() == 0) {
+      // Object was truncated since it was opened
+      current_.reset();
+      pending_.clear();
+      return Status::OK();
+    }
+    // Replace the range being consumed with the next one
+    return RequestRanges();
+  }
+
+  Status RequestRanges() {
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file_->GetSize());
+    while (pending_.size() < static_cast<size_t>(ranges_) && next_range_ < size) {
+      const int64_t nbytes = std::min(range_size_, size - next_range_);
+      pending_.push_back(file_->ReadAsync(next_range_, nbytes));
+      next_range_ += nbytes;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<ObjectInputFile> file_;
+  const int32_t ranges_;
+  const int64_t range_size_;
+  int64_t pos_ = 0;
+  // Start of the next range to request
+  int64_t next_range_ = 0;
+  std::deque<std::future<Result<std::shared_ptr<Buffer>>>> pending_;
+  std::shared_ptr<Buffer> current_;
+  int64_t current_offset_ = 0;
+};
+
 // A non-copying istream.
 // See https://stackoverflow.com/questions/35322033/aws-c-sdk-uploadpart-times-out
 // https://stackoverflow.com/questions/13059091/creating-an-input-stream-from-constant-memory
@@ -419,7 +581,10 @@ class ObjectOutputStream : public io::OutputStream {
  public:
   ObjectOutputStream(Aws::S3::S3Client* client, const S3Path& path,
                      const S3Options& options)
-      : client_(client), path_(path), options_(options) {}
+      : client_(client),
+        path_(path),
+        options_(options),
+        part_upload_threshold_(options.part_size) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -538,7 +703,8 @@ class ObjectOutputStream : public io::OutputStream {
 
     // With up to 10000 parts in an upload (S3 limit), a stream writing chunks
     // of exactly 5MB would be limited to 50GB total.  To avoid that, we bump
-    // the upload threshold every 100 parts.  So the pattern is:
+    // the upload threshold every 100 parts.  So the pattern is (with the
+    // default part_size):
     // - part 1 to 99: 5MB threshold
     // - part 100 to 199: 10MB threshold
     // - part 200 to 299: 15MB threshold
@@ -548,7 +714,7 @@ class ObjectOutputStream : public io::OutputStream {
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ += options_.part_size;
     }
 
     if (!current_part_ && nbytes >= part_upload_threshold_) {
@@ -610,6 +776,7 @@ class ObjectOutputStream : public io::OutputStream {
     req.SetContentLength(nbytes);
 
     if (!options_.background_writes) {
+      ARROW_TRACE_SPAN_DETAIL("filesystem", "S3UploadPart", path_.full_path);
       req.SetBody(std::make_shared<StringViewStream>(data, nbytes));
       auto outcome = client_->UploadPart(req);
       if (!outcome.IsSuccess()) {
@@ -619,6 +786,14 @@ class ObjectOutputStream : public io::OutputStream {
       }
     } else {
       std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      if (options_.max_parts_in_flight > 0) {
+        // Throttle the writer until a part upload finishes
+        upload_state_->cv.wait(lock, [this]() {
+          return upload_state_->parts_in_progress < options_.max_parts_in_flight;
+        });
+      }
+      // Don't bother uploading more parts if a previous one failed
+      RETURN_NOT_OK(upload_state_->status);
       auto state = upload_state_;  // Keep upload state alive in closure
       auto part_number = part_number_;
 
@@ -644,10 +819,10 @@ class ObjectOutputStream : public io::OutputStream {
         } else {
           AddCompletedPart(state, part_number, outcome.GetResult());
         }
-        // Notify completion, regardless of success / error status
-        if (--state->parts_in_progress == 0) {
-          state->cv.notify_all();
-        }
+        // Notify completion, regardless of success / error status.  Both Flush()
+        // and throttled writers may be waiting.
+        --state->parts_in_progress;
+        state->cv.notify_all();
       };
       ++upload_state_->parts_in_progress;
       client_->UploadPartAsync(req, handler);
@@ -689,7 +864,7 @@ class ObjectOutputStream : public io::OutputStream {
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -718,6 +893,210 @@ void FileObjectToStats(const S3Model::Object& obj, FileStats* st) {
   st->set_mtime(ToTimePoint(obj.GetLastModified()));
 }
 
+// Thread-safe counters backing S3FileSystem::metrics()
+class S3MetricsCollector {
+ public:
+  enum RequestType { kGet, kPut, kHead, kList, kOther, kNumRequestTypes };
+
+  S3MetricsCollector() {
+    for (auto& count : requests_) {
+      count.store(0);
+    }
+    for (auto& count : latency_histogram_) {
+      count.store(0);
+    }
+  }
+
+  void RecordRequest(RequestType type, std::chrono::steady_clock::time_point start,
+                     bool success) {
+    requests_[type].fetch_add(1, std::memory_order_relaxed);
+    if (!success) {
+      failed_requests_.fetch_add(1, std::memory_order_relaxed);
+    }
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+    int bucket = 0;
+    while (millis > 0 && bucket < S3Metrics::kLatencyBuckets - 1) {
+      millis >>= 1;
+      ++bucket;
+    }
+    latency_histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void RecordRetry() { retries_.fetch_add(1, std::memory_order_relaxed); }
+
+  void RecordDownload(int64_t nbytes) {
+    bytes_downloaded_.fetch_add(nbytes, std::memory_order_relaxed);
+  }
+
+  void RecordUpload(int64_t nbytes) {
+    bytes_uploaded_.fetch_add(nbytes, std::memory_order_relaxed);
+  }
+
+  S3Metrics Snapshot() const {
+    S3Metrics metrics;
+    metrics.get_requests = requests_[kGet].load();
+    metrics.put_requests = requests_[kPut].load();
+    metrics.head_requests = requests_[kHead].load();
+    metrics.list_requests = requests_[kList].load();
+    metrics.other_requests = requests_[kOther].load();
+    metrics.failed_requests = failed_requests_.load();
+    metrics.retries = retries_.load();
+    metrics.bytes_downloaded = bytes_downloaded_.load();
+    metrics.bytes_uploaded = bytes_uploaded_.load();
+    for (int i = 0; i < S3Metrics::kLatencyBuckets; ++i) {
+      metrics.latency_histogram[i] = latency_histogram_[i].load();
+    }
+    return metrics;
+  }
+
+ protected:
+  std::atomic<int64_t> requests_[kNumRequestTypes];
+  std::atomic<int64_t> failed_requests_{0};
+  std::atomic<int64_t> retries_{0};
+  std::atomic<int64_t> bytes_downloaded_{0};
+  std::atomic<int64_t> bytes_uploaded_{0};
+  std::atomic<int64_t> latency_histogram_[S3Metrics::kLatencyBuckets];
+};
+
+// A S3 client recording the requests of all operations used by S3FileSystem.
+// The SDK's asynchronous operations (e.g. UploadPartAsync) call the synchronous
+// ones, hence are recorded as well.
+class InstrumentedS3Client : public Aws::S3::S3Client {
+ public:
+  using RequestType = S3MetricsCollector::RequestType;
+
+  InstrumentedS3Client(std::shared_ptr<S3MetricsCollector> metrics,
+                       const Aws::Auth::AWSCredentials& credentials,
+                       const Aws::Client::ClientConfiguration& config,
+                       bool use_virtual_addressing)
+      : Aws::S3::S3Client(credentials, config,
+                          Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Never,
+                          use_virtual_addressing),
+        metrics_(std::move(metrics)) {}
+
+  S3Model::GetObjectOutcome GetObject(
+      const S3Model::GetObjectRequest& req) const override {
+    auto outcome = Track(RequestType::kGet, [&] { return S3Client::GetObject(req); });
+    if (outcome.IsSuccess()) {
+      metrics_->RecordDownload(outcome.GetResult().GetContentLength());
+    }
+    return outcome;
+  }
+
+  S3Model::PutObjectOutcome PutObject(
+      const S3Model::PutObjectRequest& req) const override {
+    metrics_->RecordUpload(req.GetContentLength());
+    return Track(RequestType::kPut, [&] { return S3Client::PutObject(req); });
+  }
+
+  S3Model::UploadPartOutcome UploadPart(
+      const S3Model::UploadPartRequest& req) const override {
+    metrics_->RecordUpload(req.GetContentLength());
+    return Track(RequestType::kPut, [&] { return S3Client::UploadPart(req); });
+  }
+
+  S3Model::CreateMultipartUploadOutcome CreateMultipartUpload(
+      const S3Model::CreateMultipartUploadRequest& req) const override {
+    return Track(RequestType::kPut,
+                 [&] { return S3Client::CreateMultipartUpload(req); });
+  }
+
+  S3Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(
+      const S3Model::CompleteMultipartUploadRequest& req) const override {
+    return Track(RequestType::kPut,
+                 [&] { return S3Client::CompleteMultipartUpload(req); });
+  }
+
+  S3Model::AbortMultipartUploadOutcome AbortMultipartUpload(
+      const S3Model::AbortMultipartUploadRequest& req) const override {
+    return Track(RequestType::kPut, [&] { return S3Client::AbortMultipartUpload(req); });
+  }
+
+  S3Model::CopyObjectOutcome CopyObject(
+      const S3Model::CopyObjectRequest& req) const override {
+    return Track(RequestType::kPut, [&] { return S3Client::CopyObject(req); });
+  }
+
+  S3Model::HeadObjectOutcome HeadObject(
+      const S3Model::HeadObjectRequest& req) const override {
+    return Track(RequestType::kHead, [&] { return S3Client::HeadObject(req); });
+  }
+
+  S3Model::HeadBucketOutcome HeadBucket(
+      const S3Model::HeadBucketRequest& req) const override {
+    return Track(RequestType::kHead, [&] { return S3Client::HeadBucket(req); });
+  }
+
+  S3Model::ListObjectsV2Outcome ListObjectsV2(
+      const S3Model::ListObjectsV2Request& req) const override {
+    return Track(RequestType::kList, [&] { return S3Client::ListObjectsV2(req); });
+  }
+
+  S3Model::ListBucketsOutcome ListBuckets() const override {
+    return Track(RequestType::kList, [&] { return S3Client::ListBuckets(); });
+  }
+
+  S3Model::CreateBucketOutcome CreateBucket(
+      const S3Model::CreateBucketRequest& req) const override {
+    return Track(RequestType::kOther, [&] { return S3Client::CreateBucket(req); });
+  }
+
+  S3Model::DeleteBucketOutcome DeleteBucket(
+      const S3Model::DeleteBucketRequest& req) const override {
+    return Track(RequestType::kOther, [&] { return S3Client::DeleteBucket(req); });
+  }
+
+  S3Model::DeleteObjectOutcome DeleteObject(
+      const S3Model::DeleteObjectRequest& req) const override {
+    return Track(RequestType::kOther, [&] { return S3Client::DeleteObject(req); });
+  }
+
+  S3Model::DeleteObjectsOutcome DeleteObjects(
+      const S3Model::DeleteObjectsRequest& req) const override {
+    return Track(RequestType::kOther, [&] { return S3Client::DeleteObjects(req); });
+  }
+
+ protected:
+  template <typename Call>
+  auto Track(RequestType type, Call&& call) const -> decltype(call()) {
+    const auto start = std::chrono::steady_clock::now();
+    auto outcome = call();
+    metrics_->RecordRequest(type, start, outcome.IsSuccess());
+    return outcome;
+  }
+
+  std::shared_ptr<S3MetricsCollector> metrics_;
+};
+
+// A RetryStrategy counting the retries decided by another one
+class MetricsRetryStrategy : public Aws::Client::RetryStrategy {
+ public:
+  MetricsRetryStrategy(std::shared_ptr<Aws::Client::RetryStrategy> wrapped,
+                       std::shared_ptr<S3MetricsCollector> metrics)
+      : wrapped_(std::move(wrapped)), metrics_(std::move(metrics)) {}
+
+  bool ShouldRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors>& error,
+                   long attempted_retries) const override {  // NOLINT
+    const bool retry = wrapped_->ShouldRetry(error, attempted_retries);
+    if (retry) {
+      metrics_->RecordRetry();
+    }
+    return retry;
+  }
+
+  long CalculateDelayBeforeNextRetry(  // NOLINT
+      const Aws::Client::AWSError<Aws::Client::CoreErrors>& error,
+      long attempted_retries) const override {  // NOLINT
+    return wrapped_->CalculateDelayBeforeNextRetry(error, attempted_retries);
+  }
+
+ protected:
+  std::shared_ptr<Aws::Client::RetryStrategy> wrapped_;
+  std::shared_ptr<S3MetricsCollector> metrics_;
+};
+
 }  // namespace
 
 class S3FileSystem::Impl {
@@ -725,6 +1104,7 @@ class S3FileSystem::Impl {
   S3Options options_;
   Aws::Client::ClientConfiguration client_config_;
   Aws::Auth::AWSCredentials credentials_;
+  std::shared_ptr<S3MetricsCollector> metrics_ = std::make_shared<S3MetricsCollector>();
   std::unique_ptr<Aws::S3::S3Client> client_;
 
   const int32_t kListObjectsMaxKeys = 1000;
@@ -746,12 +1126,41 @@ class S3FileSystem::Impl {
     } else {
       return Status::Invalid("Invalid S3 connection scheme '", options_.scheme, "'");
     }
-    client_config_.retryStrategy = std::make_shared<ConnectRetryStrategy>();
+    if (options_.part_size < kMinimumPartUpload) {
+      return Status::Invalid("S3 part size must be at least ", kMinimumPartUpload,
+                             " bytes");
+    }
+    if (options_.max_parts_in_flight < 0 || options_.readahead_ranges < 0 ||
+        options_.readahead_range_size <= 0 || options_.max_connections < 0 ||
+        options_.connect_timeout_ms < 0 || options_.request_timeout_ms < 0) {
+      return Status::Invalid("Invalid S3 connection or concurrency options");
+    }
+    if (options_.max_connections > 0) {
+      client_config_.maxConnections = options_.max_connections;
+    } else {
+      // Leave room for concurrent part uploads and readahead requests, on top
+      // of the SDK's default connection pool size
+      client_config_.maxConnections =
+          std::max<unsigned>(client_config_.maxConnections,
+                             options_.max_parts_in_flight + options_.readahead_ranges);
+    }
+    if (options_.connect_timeout_ms > 0) {
+      client_config_.connectTimeoutMs = static_cast<long>(  // NOLINT
+          options_.connect_timeout_ms);
+    }
+    if (options_.request_timeout_ms > 0) {
+      client_config_.requestTimeoutMs = static_cast<long>(  // NOLINT
+          options_.request_timeout_ms);
+    }
+    std::shared_ptr<Aws::Client::RetryStrategy> retry_strategy = options_.retry_strategy;
+    if (retry_strategy == nullptr) {
+      retry_strategy = std::make_shared<ConnectRetryStrategy>();
+    }
+    client_config_.retryStrategy =
+        std::make_shared<MetricsRetryStrategy>(std::move(retry_strategy), metrics_);
     bool use_virtual_addressing = options_.endpoint_override.empty();
-    client_.reset(
-        new Aws::S3::S3Client(credentials_, client_config_,
-                              Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Never,
-                              use_virtual_addressing));
+    client_.reset(new InstrumentedS3Client(metrics_, credentials_, client_config_,
+                                           use_virtual_addressing));
     return Status::OK();
   }
 
@@ -888,23 +1297,36 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
-  // Recursive workhorse for GetTargetStats(FileSelector...)
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, std::vector<FileStats>* out) {
-    int32_t nesting_depth = 0;
-    return Walk(select, bucket, key, nesting_depth, out);
-  }
-
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, int32_t nesting_depth,
-              std::vector<FileStats>* out) {
+  // List the entries of a single "directory", or the buckets if `path` is empty.
+  // Subdirectories are walked by the caller.
+  Result<std::vector<FileStats>> StatDirectory(const FileSelector& select,
+                                               const std::string& path,
+                                               int32_t nesting_depth) {
     if (nesting_depth >= kMaxNestingDepth) {
       return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
                              kMaxNestingDepth, ")");
     }
+    S3Path s3_path;
+    RETURN_NOT_OK(S3Path::FromString(path, &s3_path));
+    std::vector<FileStats> out;
+    if (s3_path.empty()) {
+      std::vector<std::string> buckets;
+      RETURN_NOT_OK(ListBuckets(&buckets));
+      for (const auto& bucket : buckets) {
+        FileStats st;
+        st.set_path(bucket);
+        st.set_type(FileType::Directory);
+        out.push_back(std::move(st));
+      }
+    } else {
+      RETURN_NOT_OK(StatDirectory(select, s3_path.bucket, s3_path.key, &out));
+    }
+    return out;
+  }
 
+  Status StatDirectory(const FileSelector& select, const std::string& bucket,
+                       const std::string& key, std::vector<FileStats>* out) {
     bool is_empty = true;
-    std::vector<std::string> child_keys;
 
     auto handle_results = [&](const S3Model::ListObjectsV2Result& result) -> Status {
       // Walk "files"
@@ -933,9 +1355,6 @@ class S3FileSystem::Impl {
         st.set_path(ss.str());
         st.set_type(FileType::Directory);
         out->push_back(std::move(st));
-        if (select.recursive) {
-          child_keys.emplace_back(child_key);
-        }
       }
       return Status::OK();
     };
@@ -952,13 +1371,6 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(
         ListObjectsV2(bucket, key, std::move(handle_results), std::move(handle_error)));
 
-    // Recurse
-    if (select.recursive && nesting_depth < select.max_recursion) {
-      for (const auto& child_key : child_keys) {
-        RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
-      }
-    }
-
     // If no contents were found, perhaps it's an empty "directory",
     // or perhaps it's a non-existent entry.  Check.
     if (is_empty && !select.allow_non_existent) {
@@ -1108,7 +1520,10 @@ Result<std::shared_ptr<S3FileSystem>> S3FileSystem::Make(const S3Options& option
   return ptr;
 }
 
+S3Metrics S3FileSystem::metrics() const { return impl_->metrics_->Snapshot(); }
+
 Result<FileStats> S3FileSystem::GetTargetStats(const std::string& s) {
+  ARROW_TRACE_SPAN_DETAIL("filesystem", "S3GetTargetStats", s);
   S3Path path;
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   FileStats st;
@@ -1175,30 +1590,23 @@ Result<FileStats> S3FileSystem::GetTargetStats(const std::string& s) {
 }
 
 Result<std::vector<FileStats>> S3FileSystem::GetTargetStats(const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto batches, GetTargetStatsBatches(select));
+  return internal::CollectFileStats(std::move(batches));
+}
+
+Result<FileStatsBatchIterator> S3FileSystem::GetTargetStatsBatches(
+    const FileSelector& select) {
   S3Path base_path;
   RETURN_NOT_OK(S3Path::FromString(select.base_dir, &base_path));
 
-  std::vector<FileStats> results;
-
-  if (base_path.empty()) {
-    // List all buckets
-    std::vector<std::string> buckets;
-    RETURN_NOT_OK(impl_->ListBuckets(&buckets));
-    for (const auto& bucket : buckets) {
-      FileStats st;
-      st.set_path(bucket);
-      st.set_type(FileType::Directory);
-      results.push_back(std::move(st));
-      if (select.recursive) {
-        RETURN_NOT_OK(impl_->Walk(select, bucket, "", &results));
-      }
-    }
-    return results;
-  }
-
-  // Nominal case -> walk a single bucket
-  RETURN_NOT_OK(impl_->Walk(select, base_path.bucket, base_path.key, &results));
-  return results;
+  // Each "directory" is a separate prefix listing, several of which are issued
+  // concurrently to hide the latency of the requests.
+  auto impl = impl_.get();
+  auto list_dir = [impl, select](const std::string& path, int32_t nesting_depth) {
+    return impl->StatDirectory(select, path, nesting_depth);
+  };
+  return internal::WalkDirectories(std::move(list_dir), select,
+                                   internal::DefaultListingParallelism(select));
 }
 
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
@@ -1346,6 +1754,12 @@ Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
 
   auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
   RETURN_NOT_OK(ptr->Init());
+  const auto& options = impl_->options_;
+  if (options.readahead_ranges > 0) {
+    return std::make_shared<ObjectReadaheadStream>(std::move(ptr),
+                                                   options.readahead_ranges,
+                                                   options.readahead_range_size);
+  }
   return ptr;
 }
 
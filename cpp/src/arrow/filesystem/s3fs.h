@@ -30,6 +30,11 @@ namespace Auth {
 class AWSCredentialsProvider;
 
 }  // namespace Auth
+namespace Client {
+
+class RetryStrategy;
+
+}  // namespace Client
 }  // namespace Aws
 
 namespace arrow {
@@ -54,6 +59,45 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Minimum size of each part of a multipart upload, except for the last one
+  ///
+  /// Must be at least 5 MiB (the S3 limit).  Larger parts mean fewer requests
+  /// but more memory buffered per OutputStream.
+  int64_t part_size = 5 * 1024 * 1024;
+
+  /// Maximum number of parts an OutputStream uploads concurrently when
+  /// background_writes is true (0 for no limit)
+  ///
+  /// Writes block while that many uploads are in progress, which bounds the
+  /// memory held by an OutputStream to about part_size * max_parts_in_flight.
+  int32_t max_parts_in_flight = 8;
+
+  /// Number of ranges that streams returned by OpenInputStream fetch ahead of
+  /// the current position, in parallel (0 disables readahead)
+  int32_t readahead_ranges = 0;
+
+  /// Size of each range fetched ahead by streams returned by OpenInputStream
+  int64_t readahead_range_size = 8 * 1024 * 1024;
+
+  /// Maximum number of HTTP connections to S3
+  ///
+  /// If 0, the SDK default is used, raised if necessary to accommodate
+  /// max_parts_in_flight and readahead_ranges.
+  int32_t max_connections = 0;
+
+  /// Timeout for establishing a connection, in milliseconds (0 for the SDK default)
+  int64_t connect_timeout_ms = 0;
+
+  /// Timeout for receiving data after a request was sent, in milliseconds
+  /// (0 for the SDK default)
+  int64_t request_timeout_ms = 0;
+
+  /// Strategy deciding which failed requests are retried, and after how long
+  ///
+  /// If null, connection errors and 502/503/504 responses are retried every
+  /// 200 ms for up to 4 seconds.
+  std::shared_ptr<Aws::Client::RetryStrategy> retry_strategy;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -70,6 +114,43 @@ struct ARROW_EXPORT S3Options {
                                  const std::string& secret_key);
 };
 
+/// Counters of the requests issued by a S3FileSystem, see S3FileSystem::metrics()
+struct ARROW_EXPORT S3Metrics {
+  /// Number of latency_histogram buckets
+  static constexpr int kLatencyBuckets = 16;
+
+  /// GetObject requests (object reads)
+  int64_t get_requests = 0;
+  /// PutObject, UploadPart, CopyObject and other multipart upload requests
+  int64_t put_requests = 0;
+  /// HeadObject and HeadBucket requests
+  int64_t head_requests = 0;
+  /// ListObjectsV2 and ListBuckets requests
+  int64_t list_requests = 0;
+  /// DeleteObject(s), DeleteBucket and CreateBucket requests
+  int64_t other_requests = 0;
+
+  /// Requests that failed, after any retries
+  int64_t failed_requests = 0;
+  /// Failed attempts that were retried (throttling shows up here)
+  int64_t retries = 0;
+
+  /// Bytes of object data received by GetObject requests
+  int64_t bytes_downloaded = 0;
+  /// Bytes of object data sent by PutObject and UploadPart requests
+  int64_t bytes_uploaded = 0;
+
+  /// Latencies of requests (including retries): bucket 0 counts requests
+  /// faster than 1 ms, bucket i those taking [2^(i-1), 2^i) ms, and the last
+  /// bucket all slower ones.
+  std::vector<int64_t> latency_histogram = std::vector<int64_t>(kLatencyBuckets, 0);
+
+  int64_t total_requests() const {
+    return get_requests + put_requests + head_requests + list_requests +
+           other_requests;
+  }
+};
+
 /// S3-backed FileSystem implementation.
 ///
 /// Some implementation notes:
@@ -86,6 +167,8 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
   Result<FileStats> GetTargetStats(const std::string& path) override;
   Result<std::vector<FileStats>> GetTargetStats(const FileSelector& select) override;
+  Result<FileStatsBatchIterator> GetTargetStatsBatches(
+      const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -100,15 +183,17 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
 
   /// Create a sequential input stream for reading from a S3 object.
   ///
-  /// NOTE: Reads from the stream will be synchronous and unbuffered.
-  /// You way want to wrap the stream in a BufferedInputStream or use
-  /// a custom readahead strategy to avoid idle waits.
+  /// NOTE: Unless S3Options.readahead_ranges is non-zero, reads from the
+  /// stream will be synchronous and unbuffered.  Otherwise, the stream keeps
+  /// that many ranges of S3Options.readahead_range_size bytes downloading
+  /// in parallel ahead of the current position.
   Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) override;
 
   /// Create a random access file for reading from a S3 object.
   ///
-  /// See OpenInputStream for performance notes.
+  /// Reads from the file are synchronous and unbuffered, each issuing a separate
+  /// range request; use ReadAsync to issue several of them in parallel.
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
 
@@ -117,13 +202,20 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// NOTE: Writes to the stream will be buffered.  Depending on
   /// S3Options.background_writes, they can be synchronous or not.
   /// It is recommended to enable background_writes unless you prefer
-  /// implementing your own background execution strategy.
+  /// implementing your own background execution strategy.  See also
+  /// S3Options.part_size and S3Options.max_parts_in_flight.
   Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
       const std::string& path) override;
 
   Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
       const std::string& path) override;
 
+  /// Return a snapshot of the counters of the requests issued so far
+  ///
+  /// Counters cover all streams and files opened from this filesystem,
+  /// and are updated as requests complete, from any thread.
+  S3Metrics metrics() const;
+
   /// Create a S3FileSystem instance from the given options.
   static Result<std::shared_ptr<S3FileSystem>> Make(const S3Options& options);
 
@@ -690,6 +690,70 @@ TEST_F(TestS3FS, OpenInputStream) {
   ASSERT_RAISES(IOError, fs_->OpenInputStream("bucket"));
 }
 
+TEST_F(TestS3FS, OpenInputStreamReadahead) {
+  // Ranges much smaller than the reads, so that reads straddle several of them
+  options_.readahead_ranges = 3;
+  options_.readahead_range_size = 2;
+  MakeFileSystem();
+
+  std::shared_ptr<io::InputStream> stream;
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(stream, fs_->OpenInputStream("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(1));
+  AssertBufferEqual(*buf, "s");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
+  AssertBufferEqual(*buf, "ome d");
+  ASSERT_OK_AND_EQ(6, stream->Tell());
+  char result[10];
+  ASSERT_OK_AND_EQ(3, stream->Read(10, result));
+  ASSERT_EQ("ata", std::string(result, 3));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(Invalid, stream->Read(5));
+
+  // Larger than the number of ranges in flight
+  const auto expected = random_string(1000, /*seed =*/42);
+  options_.readahead_range_size = 64;
+  MakeFileSystem();
+  ASSERT_OK_AND_ASSIGN(auto out, fs_->OpenOutputStream("bucket/newfile"));
+  ASSERT_OK(out->Write(expected));
+  ASSERT_OK(out->Close());
+  ASSERT_OK_AND_ASSIGN(stream, fs_->OpenInputStream("bucket/newfile"));
+  std::string actual;
+  do {
+    ASSERT_OK_AND_ASSIGN(buf, stream->Read(100));
+    actual += buf->ToString();
+  } while (buf->size() > 0);
+  ASSERT_EQ(expected, actual);
+}
+
+TEST_F(TestS3FS, Metrics) {
+  std::shared_ptr<Buffer> buf;
+  const auto before = fs_->metrics();
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(4));
+  ASSERT_OK_AND_ASSIGN(auto out, fs_->OpenOutputStream("bucket/newfile"));
+  ASSERT_OK(out->Write("some data"));
+  ASSERT_OK(out->Close());
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("bucket/zzzt"));
+
+  const auto after = fs_->metrics();
+  ASSERT_EQ(1, after.get_requests - before.get_requests);
+  // CreateMultipartUpload, UploadPart, CompleteMultipartUpload
+  ASSERT_EQ(3, after.put_requests - before.put_requests);
+  ASSERT_EQ(2, after.head_requests - before.head_requests);
+  ASSERT_EQ(1, after.failed_requests - before.failed_requests);
+  ASSERT_EQ(4, after.bytes_downloaded - before.bytes_downloaded);
+  ASSERT_EQ(9, after.bytes_uploaded - before.bytes_uploaded);
+  int64_t histogram_total = 0;
+  for (auto count : after.latency_histogram) {
+    histogram_total += count;
+  }
+  ASSERT_EQ(after.total_requests(), histogram_total);
+}
+
 TEST_F(TestS3FS, OpenInputFile) {
   std::shared_ptr<io::RandomAccessFile> file;
   std::shared_ptr<Buffer> buf;
@@ -740,6 +804,24 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamOnePartInFlight) {
+  options_.max_parts_in_flight = 1;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
+TEST_F(TestS3FS, OpenOutputStreamLargerParts) {
+  options_.part_size = 7 * 1024 * 1024;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
+TEST_F(TestS3FS, InvalidPartSize) {
+  options_.part_size = 1024 * 1024;
+  options_.ConfigureAccessKey(minio_.access_key(), minio_.secret_key());
+  ASSERT_RAISES(Invalid, S3FileSystem::Make(options_));
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
@@ -718,6 +718,59 @@ void GenericFileSystemTest::TestGetTargetStatsSelectorWithRecursion(FileSystem*
                          File("AA/AA.file")));
 }
 
+void GenericFileSystemTest::TestGetTargetStatsBatches(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("01/02/03"));
+  ASSERT_OK(fs->CreateDir("AA"));
+  CreateFile(fs, "00.file", "00");
+  CreateFile(fs, "01/01.file", "01");
+  CreateFile(fs, "AA/AA.file", "aa");
+  CreateFile(fs, "01/02/02.file", "02");
+  CreateFile(fs, "01/02/03/03.file", "03");
+
+  auto collect_batches = [&](const FileSelector& s, std::vector<FileStats>* out) {
+    out->clear();
+    ASSERT_OK_AND_ASSIGN(auto it, fs->GetTargetStatsBatches(s));
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+      if (batch.empty()) {
+        break;
+      }
+      out->insert(out->end(), batch.begin(), batch.end());
+    }
+    SortStats(out);
+  };
+
+  std::vector<FileStats> expected, stats;
+  FileSelector s;
+  for (const bool recursive : {false, true}) {
+    for (const std::string base_dir : {"", "01"}) {
+      s.base_dir = base_dir;
+      s.recursive = recursive;
+      ASSERT_OK_AND_ASSIGN(expected, fs->GetTargetStats(s));
+      SortStats(&expected);
+      collect_batches(s, &stats);
+      ASSERT_EQ(stats.size(), expected.size());
+      for (size_t i = 0; i < stats.size(); ++i) {
+        ASSERT_TRUE(stats[i].Equals(expected[i])) << stats[i].ToString();
+      }
+    }
+  }
+  ASSERT_EQ(stats.size(), 5);
+
+  // Errors are reported on creation or while iterating
+  s.base_dir = "XX";
+  s.recursive = true;
+  auto maybe_it = fs->GetTargetStatsBatches(s);
+  if (maybe_it.ok()) {
+    ASSERT_RAISES(IOError, maybe_it.ValueOrDie().Next());
+  } else {
+    ASSERT_RAISES(IOError, maybe_it.status());
+  }
+  s.allow_non_existent = true;
+  collect_batches(s, &stats);
+  ASSERT_EQ(stats.size(), 0);
+}
+
 void GenericFileSystemTest::TestOpenOutputStream(FileSystem* fs) {
   std::shared_ptr<io::OutputStream> stream;
 
@@ -854,6 +907,7 @@ GENERIC_FS_TEST_DEFINE(TestGetTargetStatsSingle)
 GENERIC_FS_TEST_DEFINE(TestGetTargetStatsVector)
 GENERIC_FS_TEST_DEFINE(TestGetTargetStatsSelector)
 GENERIC_FS_TEST_DEFINE(TestGetTargetStatsSelectorWithRecursion)
+GENERIC_FS_TEST_DEFINE(TestGetTargetStatsBatches)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
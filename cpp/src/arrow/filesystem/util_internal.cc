@@ -16,9 +16,16 @@
 // under the License.
 
 #include "arrow/filesystem/util_internal.h"
+
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <utility>
+
 #include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -48,6 +55,114 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
   return Status::OK();
 }
 
+namespace {
+
+class DirectoryWalker {
+ public:
+  DirectoryWalker(ListDirectoryFunc list_dir, const FileSelector& select,
+                  int parallelism)
+      : list_dir_(std::move(list_dir)),
+        select_(select),
+        parallelism_(std::max(parallelism, 1)) {
+    to_list_.push_back({select_.base_dir, 0});
+  }
+
+  DirectoryWalker(DirectoryWalker&&) = default;
+
+  ~DirectoryWalker() {
+    // Listings in progress may reference the filesystem
+    for (auto& listing : in_flight_) {
+      listing.entries.wait();
+    }
+  }
+
+  Result<std::vector<FileStats>> Next() {
+    while (true) {
+      RETURN_NOT_OK(LaunchListings());
+      if (in_flight_.empty()) {
+        return IterationTraits<std::vector<FileStats>>::End();
+      }
+      auto listing = std::move(in_flight_.front());
+      in_flight_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto entries, listing.entries.get());
+      if (select_.recursive && listing.depth < select_.max_recursion) {
+        for (const auto& entry : entries) {
+          if (entry.type() == FileType::Directory) {
+            to_list_.push_back({entry.path(), listing.depth + 1});
+          }
+        }
+      }
+      if (!entries.empty()) {
+        return entries;
+      }
+    }
+  }
+
+ protected:
+  struct Directory {
+    std::string path;
+    int32_t depth;
+  };
+
+  struct Listing {
+    int32_t depth;
+    std::future<Result<std::vector<FileStats>>> entries;
+  };
+
+  Status LaunchListings() {
+    while (!to_list_.empty() && in_flight_.size() < static_cast<size_t>(parallelism_)) {
+      auto dir = std::move(to_list_.front());
+      to_list_.pop_front();
+      std::future<Result<std::vector<FileStats>>> entries;
+      if (parallelism_ == 1) {
+        std::promise<Result<std::vector<FileStats>>> promise;
+        promise.set_value(list_dir_(dir.path, dir.depth));
+        entries = promise.get_future();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(entries, ::arrow::internal::GetIOThreadPool()->Submit(
+                                           list_dir_, dir.path, dir.depth));
+      }
+      in_flight_.push_back({dir.depth, std::move(entries)});
+    }
+    return Status::OK();
+  }
+
+  ListDirectoryFunc list_dir_;
+  FileSelector select_;
+  const int parallelism_;
+  std::deque<Directory> to_list_;
+  std::deque<Listing> in_flight_;
+};
+
+}  // namespace
+
+FileStatsBatchIterator WalkDirectories(ListDirectoryFunc list_dir,
+                                       const FileSelector& select, int parallelism) {
+  return FileStatsBatchIterator(
+      DirectoryWalker(std::move(list_dir), select, parallelism));
+}
+
+int DefaultListingParallelism(const FileSelector& select) {
+  return select.recursive ? ::arrow::GetIOThreadPoolCapacity() : 1;
+}
+
+Result<std::vector<FileStats>> CollectFileStats(FileStatsBatchIterator it) {
+  std::vector<FileStats> out;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, it.Next());
+    if (batch.empty()) {
+      break;
+    }
+    if (out.empty()) {
+      out = std::move(batch);
+    } else {
+      out.insert(out.end(), std::make_move_iterator(batch.begin()),
+                 std::make_move_iterator(batch.end()));
+    }
+  }
+  return out;
+}
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -18,7 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/io/interfaces.h"
@@ -36,6 +39,28 @@ ARROW_EXPORT
 Status CopyStream(const std::shared_ptr<io::InputStream>& src,
                   const std::shared_ptr<io::OutputStream>& dest, int64_t chunk_size);
 
+/// A callable listing the entries of the directory at `path`, itself `depth`
+/// levels below the FileSelector's base directory.
+using ListDirectoryFunc =
+    std::function<Result<std::vector<FileStats>>(const std::string& path, int32_t depth)>;
+
+/// \brief Walk a directory tree according to a FileSelector
+///
+/// Starting from select.base_dir, up to `parallelism` directories are listed
+/// concurrently on the I/O thread pool (or inline, if `parallelism` is 1).
+/// The entries of each directory are yielded as a batch, in breadth-first order.
+ARROW_EXPORT
+FileStatsBatchIterator WalkDirectories(ListDirectoryFunc list_dir,
+                                       const FileSelector& select, int parallelism);
+
+/// \brief The default `parallelism` for WalkDirectories
+ARROW_EXPORT
+int DefaultListingParallelism(const FileSelector& select);
+
+/// \brief Concatenate the batches of a FileStatsBatchIterator
+ARROW_EXPORT
+Result<std::vector<FileStats>> CollectFileStats(FileStatsBatchIterator it);
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -20,11 +20,16 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #ifdef GRPCPP_PP_INCLUDE
@@ -40,7 +45,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/client_auth.h"
@@ -59,7 +66,8 @@ class MemoryPool;
 
 namespace flight {
 
-FlightCallOptions::FlightCallOptions() : timeout(-1) {}
+FlightCallOptions::FlightCallOptions()
+    : timeout(-1), compression(Compression::UNCOMPRESSED) {}
 
 struct ClientRpc {
   grpc::ClientContext context;
@@ -79,6 +87,17 @@ struct ClientRpc {
     return Status::IOError(ss.str());
   }
 
+  /// \brief Request body compression of the call, if any
+  Status SetCompression(const FlightCallOptions& options) {
+    if (options.compression != Compression::UNCOMPRESSED) {
+      const std::string name = util::Codec::GetCodecAsString(options.compression);
+      // Fail early rather than on the first batch
+      RETURN_NOT_OK(internal::ParseCompressionHeader(name));
+      context.AddMetadata(internal::kGrpcCompressionHeader, name);
+    }
+    return Status::OK();
+  }
+
   /// \brief Add an auth token via an auth handler
   Status SetToken(ClientAuthHandler* auth_handler) {
     if (auth_handler) {
@@ -365,7 +384,7 @@ class GrpcStreamWriter : public FlightStreamWriter {
       std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
       std::shared_ptr<std::mutex> read_mutex,
       std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+      const ipc::IpcOptions& ipc_options, std::unique_ptr<FlightStreamWriter>* out);
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
@@ -482,12 +501,13 @@ Status GrpcStreamWriter::Open(
     std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
     std::shared_ptr<std::mutex> read_mutex,
     std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-    std::unique_ptr<FlightStreamWriter>* out) {
+    const ipc::IpcOptions& ipc_options, std::unique_ptr<FlightStreamWriter>* out) {
   std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
   std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
       descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
-  RETURN_NOT_OK(ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema,
-                                                     &result->batch_writer_));
+  ARROW_ASSIGN_OR_RAISE(result->batch_writer_,
+                        ipc::internal::OpenRecordBatchWriter(std::move(payload_writer),
+                                                             schema, ipc_options));
   *out = std::move(result);
   return Status::OK();
 }
@@ -518,6 +538,123 @@ class GrpcMetadataReader : public FlightMetadataReader {
   std::shared_ptr<std::mutex> read_mutex_;
 };
 
+FlightStreamListener::~FlightStreamListener() = default;
+
+void FlightStreamListener::OnSchema(const std::shared_ptr<Schema>& schema) {}
+
+FlightAsyncCall::~FlightAsyncCall() = default;
+
+// An asynchronous call driven by the completion queue of its client. The
+// call object is the tag of its only pending gRPC operation.
+class AsyncClientCall : public FlightAsyncCall {
+ public:
+  explicit AsyncClientCall(std::unique_ptr<ClientRpc> rpc) : rpc_(std::move(rpc)) {}
+
+  void Cancel() override { rpc_->context.TryCancel(); }
+
+  /// \brief Handle the completion of the pending operation, and start the
+  /// next one. Return false once the call is finished.
+  virtual bool Proceed(bool ok) = 0;
+
+ protected:
+  std::unique_ptr<ClientRpc> rpc_;
+};
+
+// A MessageReader over the messages already received by an asynchronous
+// call. Batches are only decoded once their message has arrived, so the
+// queue never runs dry in the middle of a batch.
+class QueuedMessageReader : public ipc::MessageReader {
+ public:
+  explicit QueuedMessageReader(std::deque<std::unique_ptr<ipc::Message>>* queue)
+      : queue_(queue) {}
+
+  Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
+    if (queue_->empty()) {
+      return Status::Invalid("No Flight message received yet");
+    }
+    *out = std::move(queue_->front());
+    queue_->pop_front();
+    return Status::OK();
+  }
+
+ private:
+  std::deque<std::unique_ptr<ipc::Message>>* queue_;
+};
+
+class AsyncDoGetCall : public AsyncClientCall {
+ public:
+  AsyncDoGetCall(std::unique_ptr<ClientRpc> rpc,
+                 std::shared_ptr<FlightStreamListener> listener)
+      : AsyncClientCall(std::move(rpc)),
+        listener_(std::move(listener)),
+        state_(State::STARTING) {}
+
+  void Start(pb::FlightService::Stub* stub, const pb::Ticket& ticket,
+             grpc::CompletionQueue* cq) {
+    reader_ = stub->PrepareAsyncDoGet(&rpc_->context, ticket, cq);
+    reader_->StartCall(this);
+  }
+
+  bool Proceed(bool ok) override {
+    if (state_ == State::FINISHING) {
+      // Report our own error rather than the cancellation it caused
+      listener_->OnFinish(status_.ok() ? internal::FromGrpcStatus(grpc_status_)
+                                       : status_);
+      return false;
+    }
+    if (ok && state_ == State::READING) {
+      status_ = Consume();
+      if (!status_.ok()) {
+        rpc_->context.TryCancel();
+        ok = false;
+      }
+    }
+    if (ok) {
+      state_ = State::READING;
+      data_ = internal::FlightData();
+      internal::ReadPayloadAsync(reader_.get(), &data_, this);
+    } else {
+      // Stream exhausted or broken, get its status
+      state_ = State::FINISHING;
+      reader_->Finish(&grpc_status_, this);
+    }
+    return true;
+  }
+
+ private:
+  enum class State { STARTING, READING, FINISHING };
+
+  Status Consume() {
+    std::unique_ptr<ipc::Message> message;
+    RETURN_NOT_OK(data_.OpenMessage(&message));
+    const bool is_batch = message->type() == ipc::Message::RECORD_BATCH;
+    messages_.push_back(std::move(message));
+    if (!batch_reader_) {
+      // The first message is the schema
+      RETURN_NOT_OK(ipc::RecordBatchStreamReader::Open(
+          std::unique_ptr<ipc::MessageReader>(new QueuedMessageReader(&messages_)),
+          &batch_reader_));
+      listener_->OnSchema(batch_reader_->schema());
+    } else if (is_batch) {
+      // Also consumes the dictionaries received since the previous batch
+      FlightStreamChunk chunk;
+      RETURN_NOT_OK(batch_reader_->ReadNext(&chunk.data));
+      chunk.app_metadata = std::move(data_.app_metadata);
+      listener_->OnNext(std::move(chunk));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<FlightStreamListener> listener_;
+  State state_;
+  std::unique_ptr<grpc::ClientAsyncReader<pb::FlightData>> reader_;
+  internal::FlightData data_;
+  grpc::Status grpc_status_;
+  Status status_;
+  std::deque<std::unique_ptr<ipc::Message>> messages_;
+  std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+};
+
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const Location& location, const FlightClientOptions& options) {
@@ -694,6 +831,7 @@ class FlightClient::FlightClientImpl {
 
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    RETURN_NOT_OK(rpc->SetCompression(options));
     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
         stub_->DoGet(&rpc->context, pb_ticket));
 
@@ -709,6 +847,7 @@ class FlightClient::FlightClientImpl {
                std::unique_ptr<FlightMetadataReader>* reader) {
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    RETURN_NOT_OK(rpc->SetCompression(options));
     std::unique_ptr<pb::PutResult> response(new pb::PutResult);
     std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer(
         stub_->DoPut(&rpc->context));
@@ -716,13 +855,296 @@ class FlightClient::FlightClientImpl {
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
     *reader =
         std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
+    ipc::IpcOptions ipc_options = ipc::IpcOptions::Defaults();
+    ipc_options.compression = options.compression;
     return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+                                  read_mutex, writer, ipc_options, out);
+  }
+
+  Status DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                    std::shared_ptr<FlightStreamListener> listener,
+                    std::shared_ptr<FlightAsyncCall>* out) {
+    if (!listener) {
+      return Status::Invalid("DoGetAsync requires a listener");
+    }
+    pb::Ticket pb_ticket;
+    internal::ToProto(ticket, &pb_ticket);
+
+    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    RETURN_NOT_OK(rpc->SetCompression(options));
+    auto call = std::make_shared<AsyncDoGetCall>(std::move(rpc), std::move(listener));
+    call->Start(stub_.get(), pb_ticket, RegisterAsyncCall(call));
+    if (out) {
+      *out = std::move(call);
+    }
+    return Status::OK();
+  }
+
+  ~FlightClientImpl() {
+    std::unique_lock<std::mutex> lock(async_mutex_);
+    if (!cq_) {
+      return;
+    }
+    // New operations can't be queued after shutting down the completion
+    // queue, so let every call finish first
+    for (const auto& entry : async_calls_) {
+      entry.second->Cancel();
+    }
+    async_calls_done_.wait(lock, [this] { return async_calls_.empty(); });
+    lock.unlock();
+    cq_->Shutdown();
+    cq_thread_.join();
   }
 
  private:
+  // Keep the call alive until it is finished, and return the completion
+  // queue to start it on
+  grpc::CompletionQueue* RegisterAsyncCall(std::shared_ptr<AsyncClientCall> call) {
+    std::lock_guard<std::mutex> lock(async_mutex_);
+    if (!cq_) {
+      cq_.reset(new grpc::CompletionQueue);
+      cq_thread_ = std::thread([this] { RunCompletionQueue(); });
+    }
+    AsyncClientCall* tag = call.get();
+    async_calls_.emplace(tag, std::move(call));
+    return cq_.get();
+  }
+
+  void RunCompletionQueue() {
+    void* tag;
+    bool ok;
+    while (cq_->Next(&tag, &ok)) {
+      auto call = static_cast<AsyncClientCall*>(tag);
+      if (!call->Proceed(ok)) {
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        async_calls_.erase(call);
+        async_calls_done_.notify_all();
+      }
+    }
+  }
+
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
+
+  // State of asynchronous calls, set up on first use
+  std::mutex async_mutex_;
+  std::condition_variable async_calls_done_;
+  std::unordered_map<AsyncClientCall*, std::shared_ptr<AsyncClientCall>> async_calls_;
+  std::unique_ptr<grpc::CompletionQueue> cq_;
+  std::thread cq_thread_;
+};
+
+// Merges the streams of several endpoints into a single RecordBatchReader.
+// Each endpoint is read by a task on a dedicated thread pool, which queues the
+// batches it receives until the consumer pulls them.
+class MultiEndpointStreamReader : public RecordBatchReader {
+ public:
+  MultiEndpointStreamReader(FlightClient* default_client,
+                            const FlightCallOptions& options,
+                            std::shared_ptr<Schema> schema,
+                            std::vector<FlightEndpoint> endpoints,
+                            const FlightDoGetAllOptions& get_options)
+      : default_client_(default_client),
+        call_options_(options),
+        schema_(std::move(schema)),
+        endpoints_(std::move(endpoints)),
+        get_options_(get_options),
+        // In unordered mode, all endpoints share the first queue
+        queues_(get_options.ordered ? endpoints_.size() : 1),
+        num_finished_(0),
+        current_(0),
+        stopped_(false) {}
+
+  ~MultiEndpointStreamReader() override {
+    Stop();
+    if (pool_) {
+      // Drop endpoints not started yet, and wait for the others to notice
+      ARROW_UNUSED(pool_->Shutdown(false /* wait */));
+    }
+  }
+
+  Status Start() {
+    if (endpoints_.empty()) {
+      return Status::OK();
+    }
+    const int num_threads =
+        std::max(1, std::min(get_options_.max_concurrency,
+                             static_cast<int>(endpoints_.size())));
+    ARROW_ASSIGN_OR_RAISE(pool_, ::arrow::internal::ThreadPool::Make(num_threads));
+    // The pool runs tasks in submission order, so in ordered mode an
+    // endpoint never waits for a later one to make room
+    for (size_t i = 0; i < endpoints_.size(); ++i) {
+      RETURN_NOT_OK(pool_->Spawn([this, i]() { Finish(i, ReadEndpoint(i)); }));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (current_ == queues_.size() || endpoints_.empty()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      auto& queue = queues_[current_];
+      if (!queue.batches.empty()) {
+        *out = std::move(queue.batches.front());
+        queue.batches.pop_front();
+        cv_.notify_all();
+        return Status::OK();
+      }
+      if (queue.finished) {
+        ++current_;
+        continue;
+      }
+      cv_.wait(lock);
+    }
+  }
+
+ private:
+  struct BatchQueue {
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool finished = false;
+  };
+
+  BatchQueue& QueueFor(size_t endpoint) {
+    return queues_[get_options_.ordered ? endpoint : 0];
+  }
+
+  Status ReadEndpoint(size_t i) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return Status::OK();
+      }
+    }
+    std::unique_ptr<FlightStreamReader> stream;
+    RETURN_NOT_OK(OpenStream(endpoints_[i], &stream));
+    if (!stream->schema()->Equals(*schema_)) {
+      return Status::Invalid("Schema of endpoint ", i,
+                             " differs from the flight schema: ",
+                             stream->schema()->ToString());
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return Status::OK();
+      }
+      active_streams_.push_back(stream.get());
+    }
+    Status st = ReadStream(i, stream.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_streams_.erase(
+        std::find(active_streams_.begin(), active_streams_.end(), stream.get()));
+    return st;
+  }
+
+  Status ReadStream(size_t i, FlightStreamReader* stream) {
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(stream->Next(&chunk));
+      if (chunk.data == nullptr) {
+        return Status::OK();
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto& queue = QueueFor(i);
+      cv_.wait(lock, [&]() {
+        return stopped_ || static_cast<int>(queue.batches.size()) <
+                               std::max(1, get_options_.max_queued_batches);
+      });
+      if (stopped_) {
+        return Status::OK();
+      }
+      queue.batches.push_back(std::move(chunk.data));
+      cv_.notify_all();
+    }
+  }
+
+  Status OpenStream(const FlightEndpoint& endpoint,
+                    std::unique_ptr<FlightStreamReader>* stream) {
+    if (endpoint.locations.empty()) {
+      return default_client_->DoGet(call_options_, endpoint.ticket, stream);
+    }
+    // The ticket may be redeemed at any of the locations
+    Status st;
+    for (const auto& location : endpoint.locations) {
+      FlightClient* client = nullptr;
+      st = GetClient(location, &client);
+      if (st.ok()) {
+        st = client->DoGet(call_options_, endpoint.ticket, stream);
+      }
+      if (st.ok()) {
+        break;
+      }
+    }
+    return st;
+  }
+
+  // Connections are pooled by location
+  Status GetClient(const Location& location, FlightClient** out) {
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    auto& client = clients_[location.ToString()];
+    if (client == nullptr) {
+      RETURN_NOT_OK(
+          FlightClient::Connect(location, get_options_.client_options, &client));
+    }
+    *out = client.get();
+    return Status::OK();
+  }
+
+  void Finish(size_t i, Status st) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!st.ok() && status_.ok()) {
+      status_ = std::move(st);
+      // No point in reading the other endpoints
+      StopUnlocked();
+    }
+    if (get_options_.ordered) {
+      queues_[i].finished = true;
+    } else if (++num_finished_ == endpoints_.size()) {
+      queues_[0].finished = true;
+    }
+    cv_.notify_all();
+  }
+
+  void Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    StopUnlocked();
+  }
+
+  void StopUnlocked() {
+    stopped_ = true;
+    for (auto stream : active_streams_) {
+      stream->Cancel();
+    }
+    cv_.notify_all();
+  }
+
+  FlightClient* default_client_;
+  FlightCallOptions call_options_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<FlightEndpoint> endpoints_;
+  FlightDoGetAllOptions get_options_;
+
+  std::mutex clients_mutex_;
+  std::map<std::string, std::unique_ptr<FlightClient>> clients_;
+
+  // Protects everything below
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<BatchQueue> queues_;
+  size_t num_finished_;
+  // Index of the queue being consumed
+  size_t current_;
+  bool stopped_;
+  Status status_;
+  std::vector<FlightStreamReader*> active_streams_;
+
+  std::shared_ptr<::arrow::internal::ThreadPool> pool_;
 };
 
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
@@ -782,6 +1204,25 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGetAll(const FlightCallOptions& options, const FlightInfo& info,
+                              const FlightDoGetAllOptions& get_options,
+                              std::unique_ptr<RecordBatchReader>* stream) {
+  ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+  std::unique_ptr<MultiEndpointStreamReader> reader(new MultiEndpointStreamReader(
+      this, options, std::move(schema), info.endpoints(), get_options));
+  RETURN_NOT_OK(reader->Start());
+  *stream = std::move(reader);
+  return Status::OK();
+}
+
+Status FlightClient::DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                                std::shared_ptr<FlightStreamListener> listener,
+                                std::shared_ptr<FlightAsyncCall>* call) {
+  return impl_->DoGetAsync(options, ticket, std::move(listener), call);
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -29,6 +29,7 @@
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 #include "arrow/flight/types.h"  // IWYU pragma: keep
 #include "arrow/flight/visibility.h"
@@ -37,6 +38,7 @@ namespace arrow {
 
 class MemoryPool;
 class RecordBatch;
+class RecordBatchReader;
 class Schema;
 
 namespace flight {
@@ -58,6 +60,15 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
   /// mean an implementation-defined default behavior will be used
   /// instead. This is the default value.
   TimeoutDuration timeout;
+
+  /// \brief Codec to compress record batch bodies with on this call.
+  ///
+  /// For DoGet, the codec is requested from the server, which sends
+  /// uncompressed data if it does not support or allow it. For DoPut,
+  /// uploaded batches are compressed with it. Only LZ4 and ZSTD are
+  /// supported, see ipc::IpcOptions::compression. Defaults to
+  /// UNCOMPRESSED.
+  Compression::type compression;
 };
 
 class ARROW_FLIGHT_EXPORT FlightClientOptions {
@@ -71,6 +82,22 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   std::vector<std::shared_ptr<ClientMiddlewareFactory>> middleware;
 };
 
+/// \brief Options for FlightClient::DoGetAll.
+class ARROW_FLIGHT_EXPORT FlightDoGetAllOptions {
+ public:
+  /// \brief Whether to return batches in endpoint order. Otherwise,
+  /// batches are returned as soon as they are received from any
+  /// endpoint.
+  bool ordered = true;
+  /// \brief The maximum number of endpoints read concurrently.
+  int max_concurrency = 8;
+  /// \brief The maximum number of batches received ahead of the
+  /// consumer, for each endpoint if ordered, overall otherwise.
+  int max_queued_batches = 16;
+  /// \brief Options for connecting to endpoint locations.
+  FlightClientOptions client_options;
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -79,6 +106,34 @@ class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader
   virtual void Cancel() = 0;
 };
 
+/// \brief Receives the results of an asynchronous DoGet.
+///
+/// Callbacks of a call are invoked one at a time from the client's
+/// completion queue thread, which is shared by all asynchronous calls of
+/// the client. They must not block.
+class ARROW_FLIGHT_EXPORT FlightStreamListener {
+ public:
+  virtual ~FlightStreamListener();
+
+  /// \brief Called once with the stream schema, before any chunk.
+  virtual void OnSchema(const std::shared_ptr<Schema>& schema);
+
+  /// \brief Called for each chunk of the stream.
+  virtual void OnNext(FlightStreamChunk chunk) = 0;
+
+  /// \brief Called exactly once, when the stream is exhausted or failed.
+  virtual void OnFinish(Status status) = 0;
+};
+
+/// \brief A handle to an asynchronous call.
+class ARROW_FLIGHT_EXPORT FlightAsyncCall {
+ public:
+  virtual ~FlightAsyncCall();
+
+  /// \brief Try to cancel the call. The listener is still finished.
+  virtual void Cancel() = 0;
+};
+
 // Silence warning
 // "non dll-interface class RecordBatchReader used as base for dll-interface class"
 #ifdef _MSC_VER
@@ -217,6 +272,49 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Request the stream of a flight ticket without blocking.
+  ///
+  /// Unlike DoGet, no thread is held while waiting for data: all
+  /// asynchronous calls of a client are multiplexed on a single gRPC
+  /// completion queue, and the results are pushed to the listener.
+  /// Calls still running when the client is destroyed are cancelled.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] ticket The flight ticket to use
+  /// \param[in] listener receives the schema, the chunks and the outcome
+  /// \param[out] call a handle to cancel the call, may be null
+  /// \return Status an error if the call could not be started, in which
+  /// case the listener is not invoked
+  Status DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                    std::shared_ptr<FlightStreamListener> listener,
+                    std::shared_ptr<FlightAsyncCall>* call);
+  Status DoGetAsync(const Ticket& ticket,
+                    std::shared_ptr<FlightStreamListener> listener) {
+    return DoGetAsync({}, ticket, std::move(listener), NULLPTR);
+  }
+
+  /// \brief Read the streams of all endpoints of a flight
+  /// concurrently, merged into a single stream of record batches.
+  ///
+  /// Endpoints without a location are read through this client, which
+  /// must then outlive the returned reader. Other endpoints are read
+  /// through a connection to the first of their locations that accepts
+  /// the ticket; connections are shared between endpoints and are not
+  /// authenticated. Destroying the reader cancels the remaining
+  /// streams.
+  ///
+  /// \param[in] options Per-RPC options for each DoGet
+  /// \param[in] info the flight to read, which must include its schema
+  /// \param[in] get_options options for reading the endpoints
+  /// \param[out] stream the merged RecordBatchReader
+  /// \return Status
+  Status DoGetAll(const FlightCallOptions& options, const FlightInfo& info,
+                  const FlightDoGetAllOptions& get_options,
+                  std::unique_ptr<RecordBatchReader>* stream);
+  Status DoGetAll(const FlightInfo& info, std::unique_ptr<RecordBatchReader>* stream) {
+    return DoGetAll({}, info, {}, stream);
+  }
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -15,9 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
 #include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -39,12 +44,22 @@ DEFINE_string(server_host, "",
               "An existing performance server to benchmark against (leave blank to spawn "
               "one automatically)");
 DEFINE_int32(server_port, 31337, "The port to connect to");
+DEFINE_string(server_unix, "",
+              "Unix domain socket path to use instead of TCP. If server_host "
+              "is empty, a local server is started listening on this path");
 DEFINE_int32(num_servers, 1, "Number of performance servers to run");
 DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(suite, false,
+            "Run DoGet and DoPut over a matrix of batch sizes and stream counts "
+            "and print one result row per configuration");
+DEFINE_string(suite_records_per_batch, "1024,4096,65536",
+              "Comma-separated batch sizes to run with --suite");
+DEFINE_string(suite_num_streams, "1,4,16",
+              "Comma-separated stream counts to run with --suite");
 
 namespace perf = arrow::flight::perf;
 
@@ -58,21 +73,72 @@ namespace flight {
 struct PerformanceResult {
   int64_t num_records;
   int64_t num_bytes;
+  // Bytes of column data referencing the gRPC receive buffers, i.e. not copied
+  int64_t zero_copy_bytes;
+  // Time spent reading (DoGet) or writing (DoPut) each batch
+  std::vector<uint64_t> batch_nanos;
 };
 
 struct PerformanceStats {
-  PerformanceStats() : total_records(0), total_bytes(0) {}
+  PerformanceStats() : total_records(0), total_bytes(0), total_zero_copy_bytes(0) {}
   std::mutex mutex;
   int64_t total_records;
   int64_t total_bytes;
+  int64_t total_zero_copy_bytes;
+  std::vector<uint64_t> batch_nanos;
 
-  void Update(const int64_t total_records, const int64_t total_bytes) {
+  void Update(const PerformanceResult& result) {
     std::lock_guard<std::mutex> lock(this->mutex);
-    this->total_records += total_records;
-    this->total_bytes += total_bytes;
+    this->total_records += result.num_records;
+    this->total_bytes += result.num_bytes;
+    this->total_zero_copy_bytes += result.zero_copy_bytes;
+    this->batch_nanos.insert(this->batch_nanos.end(), result.batch_nanos.begin(),
+                             result.batch_nanos.end());
   }
 };
 
+// The parameters of one benchmark run
+struct PerformanceConfig {
+  bool test_put;
+  int32_t num_streams;
+  int32_t records_per_stream;
+  int32_t records_per_batch;
+};
+
+// The measurements of one benchmark run
+struct PerformanceSummary {
+  int64_t total_bytes;
+  int64_t total_zero_copy_bytes;
+  uint64_t elapsed_nanos;
+  // Client process CPU time, across all threads
+  double cpu_seconds;
+  // Per-batch latency percentiles
+  uint64_t p50_nanos;
+  uint64_t p99_nanos;
+  uint64_t p999_nanos;
+
+  double megabytes_per_second() const {
+    constexpr double kMegabyte = static_cast<double>(1 << 20);
+    return static_cast<double>(total_bytes) / kMegabyte /
+           (static_cast<double>(elapsed_nanos) / 1e9);
+  }
+
+  double cpu_seconds_per_gigabyte() const {
+    constexpr double kGigabyte = static_cast<double>(1 << 30);
+    return cpu_seconds / (static_cast<double>(total_bytes) / kGigabyte);
+  }
+};
+
+// Nearest-rank percentile of sorted values
+uint64_t Percentile(const std::vector<uint64_t>& sorted_values, double percentile) {
+  if (sorted_values.empty()) {
+    return 0;
+  }
+  const auto rank = static_cast<size_t>(percentile / 100.0 *
+                                        static_cast<double>(sorted_values.size()));
+  return sorted_values[std::min(rank, sorted_values.size() - 1)];
+}
+
 Status WaitForReady(FlightClient* client) {
   Action action{"ping", nullptr};
   for (int attempt = 0; attempt < 10; attempt++) {
@@ -101,11 +167,26 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
   int64_t num_bytes = 0;
   int64_t num_records = 0;
+  int64_t zero_copy_bytes = 0;
+  std::vector<uint64_t> batch_nanos;
+  StopWatch timer;
   while (true) {
+    timer.Start();
     RETURN_NOT_OK(reader->Next(&batch));
     if (!batch.data) {
       break;
     }
+    batch_nanos.push_back(timer.Stop());
+
+    // Buffers copied out of the received message are freshly allocated,
+    // zero-copy ones are slices of it
+    for (int i = 0; i < batch.data->num_columns(); ++i) {
+      for (const auto& buffer : batch.data->column_data(i)->buffers) {
+        if (buffer != nullptr && buffer->parent() != nullptr) {
+          zero_copy_bytes += buffer->size();
+        }
+      }
+    }
 
     if (verify) {
       auto values = batch.data->column_data(0)->GetValues<int64_t>(1);
@@ -122,7 +203,8 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
     // Hard-coded
     num_bytes += batch.data->num_rows() * bytes_per_record;
   }
-  return PerformanceResult{num_records, num_bytes};
+  return PerformanceResult{num_records, num_bytes, zero_copy_bytes,
+                           std::move(batch_nanos)};
 }
 
 arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
@@ -155,18 +237,24 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
 
   std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
 
+  std::vector<uint64_t> batch_nanos;
+  StopWatch timer;
   int records_sent = 0;
   const int total_records = token.definition().records_per_stream();
   while (records_sent < total_records) {
     if (records_sent + length > total_records) {
       const int last_length = total_records - records_sent;
+      timer.Start();
       RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, last_length))));
+      batch_nanos.push_back(timer.Stop());
       num_records += last_length;
       // Hard-coded
       num_bytes += last_length * bytes_per_record;
       records_sent += last_length;
     } else {
+      timer.Start();
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+      batch_nanos.push_back(timer.Stop());
       num_records += length;
       // Hard-coded
       num_bytes += length * bytes_per_record;
@@ -175,18 +263,19 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   }
 
   RETURN_NOT_OK(writer->Close());
-  return PerformanceResult{num_records, num_bytes};
+  return PerformanceResult{num_records, num_bytes, 0, std::move(batch_nanos)};
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
+arrow::Result<PerformanceSummary> RunPerformanceTest(FlightClient* client,
+                                                     const PerformanceConfig& config) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
   // schema not needed
   perf::Perf perf;
-  perf.set_stream_count(FLAGS_num_streams);
-  perf.set_records_per_stream(FLAGS_records_per_stream);
-  perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_stream_count(config.num_streams);
+  perf.set_records_per_stream(config.records_per_stream);
+  perf.set_records_per_batch(config.records_per_batch);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -202,7 +291,7 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   RETURN_NOT_OK(plan->GetSchema(&dict_memo, &schema));
 
   PerformanceStats stats;
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
+  auto test_loop = config.test_put ? &RunDoPutTest : &RunDoGetTest;
   auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
@@ -213,14 +302,14 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 
     const auto& result = test_loop(client.get(), token, endpoint);
     if (result.ok()) {
-      const PerformanceResult& perf = result.ValueOrDie();
-      stats.Update(perf.num_records, perf.num_bytes);
+      stats.Update(result.ValueOrDie());
     }
     return result.status();
   };
 
   StopWatch timer;
   timer.Start();
+  const std::clock_t cpu_start = std::clock();
 
   // XXX(wesm): Serial version for debugging
   // for (const auto& endpoint : plan->endpoints()) {
@@ -239,28 +328,89 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
     RETURN_NOT_OK(task.get());
   }
 
-  // Elapsed time in seconds
-  uint64_t elapsed_nanos = timer.Stop();
-  double time_elapsed =
-      static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
-
-  constexpr double kMegabyte = static_cast<double>(1 << 20);
+  PerformanceSummary summary;
+  summary.elapsed_nanos = timer.Stop();
+  summary.cpu_seconds =
+      static_cast<double>(std::clock() - cpu_start) / static_cast<double>(CLOCKS_PER_SEC);
 
   // Check that number of rows read / written is as expected
   if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
-  if (FLAGS_test_put) {
-    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
+  summary.total_bytes = stats.total_bytes;
+  summary.total_zero_copy_bytes = stats.total_zero_copy_bytes;
+  std::sort(stats.batch_nanos.begin(), stats.batch_nanos.end());
+  summary.p50_nanos = Percentile(stats.batch_nanos, 50);
+  summary.p99_nanos = Percentile(stats.batch_nanos, 99);
+  summary.p999_nanos = Percentile(stats.batch_nanos, 99.9);
+  return summary;
+}
+
+void PrintSummary(const PerformanceConfig& config, const PerformanceSummary& summary) {
+  if (config.test_put) {
+    std::cout << "Bytes written: " << summary.total_bytes << std::endl;
   } else {
-    std::cout << "Bytes read: " << stats.total_bytes << std::endl;
+    std::cout << "Bytes read: " << summary.total_bytes << std::endl;
+    std::cout << "Zero-copy bytes: " << summary.total_zero_copy_bytes << " ("
+              << (100.0 * static_cast<double>(summary.total_zero_copy_bytes) /
+                  static_cast<double>(summary.total_bytes))
+              << "%)" << std::endl;
   }
 
-  std::cout << "Nanos: " << elapsed_nanos << std::endl;
-  std::cout << "Speed: "
-            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
-            << " MB/s" << std::endl;
+  std::cout << "Nanos: " << summary.elapsed_nanos << std::endl;
+  std::cout << "Speed: " << summary.megabytes_per_second() << " MB/s" << std::endl;
+  std::cout << "Batch latency (us): p50 " << summary.p50_nanos / 1000 << ", p99 "
+            << summary.p99_nanos / 1000 << ", p999 " << summary.p999_nanos / 1000
+            << std::endl;
+  std::cout << "Client CPU seconds per GB: " << summary.cpu_seconds_per_gigabyte()
+            << std::endl;
+}
+
+Status ParseIntList(const std::string& flag, std::vector<int32_t>* out) {
+  std::stringstream ss(flag);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    try {
+      out->push_back(static_cast<int32_t>(std::stoi(item)));
+    } catch (const std::exception&) {
+      return Status::Invalid("Invalid integer in list '", flag, "'");
+    }
+  }
+  if (out->empty()) {
+    return Status::Invalid("Empty list '", flag, "'");
+  }
+  return Status::OK();
+}
+
+// Run every combination of method, batch size and stream count, printing
+// one whitespace-separated row per configuration
+Status RunPerformanceSuite(FlightClient* client) {
+  std::vector<int32_t> batch_sizes, stream_counts;
+  RETURN_NOT_OK(ParseIntList(FLAGS_suite_records_per_batch, &batch_sizes));
+  RETURN_NOT_OK(ParseIntList(FLAGS_suite_num_streams, &stream_counts));
+
+  std::cout << std::left << std::setw(8) << "method" << std::setw(10) << "batch"
+            << std::setw(9) << "streams" << std::setw(12) << "MB/s" << std::setw(10)
+            << "p50_us" << std::setw(10) << "p99_us" << std::setw(10) << "p999_us"
+            << "cpu_s/GB" << std::endl;
+  for (bool test_put : {false, true}) {
+    for (int32_t records_per_batch : batch_sizes) {
+      for (int32_t num_streams : stream_counts) {
+        PerformanceConfig config{test_put, num_streams, FLAGS_records_per_stream,
+                                 records_per_batch};
+        ARROW_ASSIGN_OR_RAISE(auto summary, RunPerformanceTest(client, config));
+        std::cout << std::left << std::setw(8) << (test_put ? "DoPut" : "DoGet")
+                  << std::setw(10) << records_per_batch << std::setw(9) << num_streams
+                  << std::setw(12) << std::fixed << std::setprecision(1)
+                  << summary.megabytes_per_second() << std::setw(10)
+                  << summary.p50_nanos / 1000 << std::setw(10)
+                  << summary.p99_nanos / 1000 << std::setw(10)
+                  << summary.p999_nanos / 1000 << std::setprecision(3)
+                  << summary.cpu_seconds_per_gigabyte() << std::endl;
+      }
+    }
+  }
   return Status::OK();
 }
 
@@ -274,33 +424,51 @@ int main(int argc, char** argv) {
   std::string hostname = "localhost";
   if (FLAGS_server_host == "") {
     std::cout << "Using standalone server: false" << std::endl;
-    server.reset(
-        new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+    server.reset(new arrow::flight::TestServer("arrow-flight-perf-server",
+                                               FLAGS_server_port, FLAGS_server_unix));
     server->Start();
   } else {
     std::cout << "Using standalone server: true" << std::endl;
     hostname = FLAGS_server_host;
   }
 
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
-  } else {
-    std::cout << "DoGet";
+  if (!FLAGS_suite) {
+    std::cout << "Testing method: ";
+    if (FLAGS_test_put) {
+      std::cout << "DoPut";
+    } else {
+      std::cout << "DoGet";
+    }
+    std::cout << std::endl;
   }
-  std::cout << std::endl;
-
-  std::cout << "Server host: " << hostname << std::endl
-            << "Server port: " << FLAGS_server_port << std::endl;
 
   std::unique_ptr<arrow::flight::FlightClient> client;
   arrow::flight::Location location;
-  ABORT_NOT_OK(
-      arrow::flight::Location::ForGrpcTcp(hostname, FLAGS_server_port, &location));
+  if (FLAGS_server_unix.empty()) {
+    std::cout << "Server host: " << hostname << std::endl
+              << "Server port: " << FLAGS_server_port << std::endl;
+    ABORT_NOT_OK(
+        arrow::flight::Location::ForGrpcTcp(hostname, FLAGS_server_port, &location));
+  } else {
+    std::cout << "Server unix socket: " << FLAGS_server_unix << std::endl;
+    ABORT_NOT_OK(arrow::flight::Location::ForGrpcUnix(FLAGS_server_unix, &location));
+  }
   ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
   ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  arrow::Status s;
+  if (FLAGS_suite) {
+    s = arrow::flight::RunPerformanceSuite(client.get());
+  } else {
+    arrow::flight::PerformanceConfig config{FLAGS_test_put, FLAGS_num_streams,
+                                            FLAGS_records_per_stream,
+                                            FLAGS_records_per_batch};
+    auto result = arrow::flight::RunPerformanceTest(client.get(), config);
+    s = result.status();
+    if (s.ok()) {
+      arrow::flight::PrintSummary(config, *result);
+    }
+  }
 
   if (server) {
     server->Stop();
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -34,6 +35,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/make_unique.h"
 
 #include "arrow/flight/api.h"
@@ -287,6 +289,97 @@ TEST(TestFlight, BuilderHook) {
   ASSERT_OK(server->Shutdown());
 }
 
+#ifndef _WIN32
+TEST(TestFlight, DoGetOverUnixSocket) {
+  // Co-located clients and servers can bypass the TCP stack entirely
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("flight-unix-"));
+  const std::string path = temp_dir->path().ToString() + "flight.sock";
+
+  Location location;
+  ASSERT_OK(Location::ForGrpcUnix(path, &location));
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  FlightServerOptions options(location);
+  ASSERT_OK(server->Init(options));
+
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, &client));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  FlightStreamChunk chunk;
+  for (const auto& expected : expected_batches) {
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*expected, *chunk.data);
+  }
+  ASSERT_OK(stream->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+
+  ASSERT_OK(server->Shutdown());
+}
+#endif
+
+TEST(TestFlight, DoGetCoalescedWrites) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  FlightServerOptions options(location);
+  // Larger than the whole stream, so every payload is held back until
+  // the call finishes
+  options.write_coalesce_bytes = 1 << 20;
+  options.memory_quota = 64 << 20;
+  ASSERT_OK(server->Init(options));
+
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  ASSERT_OK(FlightClient::Connect(location, &client));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  FlightStreamChunk chunk;
+  for (const auto& expected : expected_batches) {
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*expected, *chunk.data);
+  }
+  ASSERT_OK(stream->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST(TestFlight, DoGetMaxMessageSize) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  FlightServerOptions options(location);
+  // Large enough for the ticket, too small for the schema
+  options.max_message_size = 32;
+  ASSERT_OK(server->Init(options));
+
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  ASSERT_OK(FlightClient::Connect(location, &client));
+
+  std::unique_ptr<FlightStreamReader> stream;
+  Status st = client->DoGet(Ticket{"ticket-ints-1"}, &stream);
+  FlightStreamChunk chunk;
+  if (st.ok()) {
+    st = stream->Next(&chunk);
+  }
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_THAT(st.message(), ::testing::HasSubstr("max_message_size"));
+
+  ASSERT_OK(server->Shutdown());
+}
+
 // ----------------------------------------------------------------------
 // Client tests
 
@@ -518,10 +611,11 @@ class TestDoPut : public ::testing::Test {
   }
 
   void CheckDoPut(FlightDescriptor descr, const std::shared_ptr<Schema>& schema,
-                  const BatchVector& batches) {
+                  const BatchVector& batches,
+                  const FlightCallOptions& options = FlightCallOptions()) {
     std::unique_ptr<FlightStreamWriter> stream;
     std::unique_ptr<FlightMetadataReader> reader;
-    ASSERT_OK(client_->DoPut(descr, schema, &stream, &reader));
+    ASSERT_OK(client_->DoPut(options, descr, schema, &stream, &reader));
     for (const auto& batch : batches) {
       ASSERT_OK(stream->WriteRecordBatch(*batch));
     }
@@ -905,6 +999,36 @@ TEST_F(TestFlightClient, DoGetInts) {
   CheckDoGet(descr, expected_batches, check_endpoints);
 }
 
+TEST_F(TestFlightClient, DoGetCompressed) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  for (auto codec : {Compression::LZ4, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    FlightCallOptions options;
+    options.compression = codec;
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(options, Ticket{"ticket-ints-1"}, &stream));
+
+    FlightStreamChunk chunk;
+    for (const auto& expected : expected_batches) {
+      ASSERT_OK(stream->Next(&chunk));
+      ASSERT_NE(nullptr, chunk.data);
+      ASSERT_BATCHES_EQUAL(*expected, *chunk.data);
+    }
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_EQ(nullptr, chunk.data);
+  }
+
+  // Only codecs usable for IPC body compression may be requested
+  FlightCallOptions options;
+  options.compression = Compression::GZIP;
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_RAISES(Invalid, client_->DoGet(options, Ticket{"ticket-ints-1"}, &stream));
+}
+
 TEST_F(TestFlightClient, DoGetDicts) {
   auto descr = FlightDescriptor::Path({"examples", "dicts"});
   BatchVector expected_batches;
@@ -919,6 +1043,133 @@ TEST_F(TestFlightClient, DoGetDicts) {
   CheckDoGet(descr, expected_batches, check_endpoints);
 }
 
+// Collects the results of an asynchronous DoGet
+class CollectingListener : public FlightStreamListener {
+ public:
+  void OnSchema(const std::shared_ptr<Schema>& schema) override { schema_ = schema; }
+
+  void OnNext(FlightStreamChunk chunk) override {
+    batches_.push_back(std::move(chunk.data));
+  }
+
+  void OnFinish(Status status) override { finished_.set_value(std::move(status)); }
+
+  Status Wait() { return finished_.get_future().get(); }
+
+  std::shared_ptr<Schema> schema_;
+  BatchVector batches_;
+
+ private:
+  std::promise<Status> finished_;
+};
+
+TEST_F(TestFlightClient, DoGetAsync) {
+  BatchVector int_batches, dict_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  ASSERT_OK(ExampleDictBatches(&dict_batches));
+
+  // Many concurrent calls share the client's completion queue
+  std::vector<std::shared_ptr<CollectingListener>> listeners;
+  for (int i = 0; i < 32; ++i) {
+    auto listener = std::make_shared<CollectingListener>();
+    Ticket ticket{i % 2 == 0 ? "ticket-ints-1" : "ticket-dicts-1"};
+    ASSERT_OK(client_->DoGetAsync(ticket, listener));
+    listeners.push_back(std::move(listener));
+  }
+  for (int i = 0; i < 32; ++i) {
+    const auto& listener = listeners[i];
+    const auto& expected = i % 2 == 0 ? int_batches : dict_batches;
+    ASSERT_OK(listener->Wait());
+    ASSERT_NE(nullptr, listener->schema_);
+    AssertSchemaEqual(*expected[0]->schema(), *listener->schema_);
+    ASSERT_EQ(expected.size(), listener->batches_.size());
+    for (size_t j = 0; j < expected.size(); ++j) {
+      ASSERT_BATCHES_EQUAL(*expected[j], *listener->batches_[j]);
+    }
+  }
+
+  // Server errors are reported to the listener
+  auto listener = std::make_shared<CollectingListener>();
+  ASSERT_OK(client_->DoGetAsync(Ticket{"no-such-ticket"}, listener));
+  ASSERT_FALSE(listener->Wait().ok());
+
+  // A cancelled call is still finished
+  listener = std::make_shared<CollectingListener>();
+  std::shared_ptr<FlightAsyncCall> call;
+  ASSERT_OK(client_->DoGetAsync({}, Ticket{"ticket-ints-1"}, listener, &call));
+  call->Cancel();
+  ARROW_UNUSED(listener->Wait());
+
+  // Destroying the client finishes the calls it still runs
+  listener = std::make_shared<CollectingListener>();
+  ASSERT_OK(client_->DoGetAsync(Ticket{"ticket-ints-1"}, listener));
+  client_.reset();
+  ARROW_UNUSED(listener->Wait());
+}
+
+TEST_F(TestFlightClient, DoGetAll) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+
+  // Endpoints read through this client and through new connections
+  std::vector<FlightEndpoint> endpoints = {
+      {{"ticket-ints-1"}, {}}, {{"ticket-ints-1"}, {location}}, {{"ticket-ints-1"}, {}}};
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(),
+                           FlightDescriptor::Path({"examples", "ints"}), endpoints,
+                           -1, -1, &data));
+  FlightInfo info(data);
+
+  FlightDoGetAllOptions get_options;
+  get_options.max_concurrency = 2;
+  get_options.max_queued_batches = 1;
+  std::unique_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGetAll({}, info, get_options, &reader));
+  AssertSchemaEqual(*batches[0]->schema(), *reader->schema());
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    for (const auto& expected : batches) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+      ASSERT_NE(nullptr, batch);
+      ASSERT_BATCHES_EQUAL(*expected, *batch);
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  ASSERT_EQ(nullptr, batch);
+
+  get_options.ordered = false;
+  ASSERT_OK(client_->DoGetAll({}, info, get_options, &reader));
+  int64_t num_rows = 0;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(batch, reader->Next());
+    if (batch == nullptr) break;
+    num_rows += batch->num_rows();
+  }
+  int64_t expected_rows = 0;
+  for (const auto& expected : batches) {
+    expected_rows += expected->num_rows();
+  }
+  ASSERT_EQ(expected_rows * static_cast<int64_t>(endpoints.size()), num_rows);
+
+  // Errors on any endpoint are reported
+  endpoints.push_back({{"ARROW-5095-fail"}, {}});
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(),
+                           FlightDescriptor::Path({"examples", "ints"}), endpoints,
+                           -1, -1, &data));
+  ASSERT_OK(client_->DoGetAll(FlightInfo(data), &reader));
+  Status st;
+  while (st.ok()) {
+    st = reader->ReadNext(&batch);
+    if (st.ok() && batch == nullptr) break;
+  }
+  ASSERT_RAISES(UnknownError, st);
+
+  // Stop reading early
+  ASSERT_OK(client_->DoGetAll({}, FlightInfo(data), get_options, &reader));
+  reader.reset();
+}
+
 TEST_F(TestFlightClient, ListActions) {
   std::vector<ActionType> actions;
   ASSERT_OK(client_->ListActions(&actions));
@@ -1039,6 +1290,22 @@ TEST_F(TestDoPut, DoPutDicts) {
   CheckDoPut(descr, schema, batches);
 }
 
+TEST_F(TestDoPut, DoPutCompressed) {
+  FlightCallOptions options;
+  if (util::Codec::IsAvailable(Compression::LZ4)) {
+    options.compression = Compression::LZ4;
+  } else if (util::Codec::IsAvailable(Compression::ZSTD)) {
+    options.compression = Compression::ZSTD;
+  } else {
+    return;
+  }
+
+  auto descr = FlightDescriptor::Path({"ints"});
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  CheckDoPut(descr, batches[0]->schema(), batches, options);
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
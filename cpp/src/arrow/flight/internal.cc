@@ -37,6 +37,7 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_builder.h"
 
@@ -45,6 +46,19 @@ namespace flight {
 namespace internal {
 
 const char* kGrpcAuthHeader = "auth-token-bin";
+const char* kGrpcCompressionHeader = "arrow-flight-compression";
+
+Result<Compression::type> ParseCompressionHeader(const std::string& value) {
+  ARROW_ASSIGN_OR_RAISE(auto codec, util::Codec::GetCompressionType(value));
+  if (codec != Compression::LZ4 && codec != Compression::ZSTD) {
+    return Status::Invalid("Only LZ4 and ZSTD compression allowed in Flight, got ",
+                           value);
+  }
+  if (!util::Codec::IsAvailable(codec)) {
+    return Status::NotImplemented("Support for codec '", value, "' not built");
+  }
+  return codec;
+}
 
 Status FromGrpcStatus(const grpc::Status& grpc_status) {
   if (grpc_status.ok()) {
@@ -22,6 +22,8 @@
 
 #include "arrow/flight/protocol_internal.h"  // IWYU pragma: keep
 #include "arrow/flight/types.h"
+#include "arrow/result.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
 
 namespace grpc {
@@ -67,6 +69,15 @@ namespace internal {
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcAuthHeader;
 
+/// The name of the header used to request body compression of a call.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcCompressionHeader;
+
+/// \brief Parse the value of the compression header. Fails unless the
+/// codec can be used for Flight (IPC) body compression in this build.
+ARROW_FLIGHT_EXPORT
+Result<Compression::type> ParseCompressionHeader(const std::string& value);
+
 ARROW_FLIGHT_EXPORT
 Status SchemaToString(const Schema& schema, std::string* out);
 
@@ -17,9 +17,12 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/flight/platform.h"
@@ -60,31 +63,24 @@ using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  *out = SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  return input->Skip(static_cast<int>(length));
-}
-
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
  public:
   GrpcBuffer(grpc_slice slice, bool incref)
-      : MutableBuffer(GRPC_SLICE_START_PTR(slice),
-                      static_cast<int64_t>(GRPC_SLICE_LENGTH(slice))),
-        slice_(incref ? grpc_slice_ref(slice) : slice) {}
+      : MutableBuffer(nullptr, 0), slice_(incref ? grpc_slice_ref(slice) : slice) {
+    // Point into our own copy of the slice: small slices are inlined, and
+    // carry their data with them
+    data_ = mutable_data_ = GRPC_SLICE_START_PTR(slice_);
+    size_ = capacity_ = static_cast<int64_t>(GRPC_SLICE_LENGTH(slice_));
+  }
 
   ~GrpcBuffer() override {
     // Decref slice
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  static Status Wrap(ByteBuffer* cpp_buf, BufferVector* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
 
@@ -93,15 +89,17 @@ class GrpcBuffer : public MutableBuffer {
     // This part below is based on the Flatbuffers gRPC SerializationTraits in
     // flatbuffers/grpc.h
 
-    // Check if this is a single uncompressed slice.
+    out->clear();
+    // Check if this is uncompressed.
     if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      // Increment reference count so this memory remains valid
-      *out = std::make_shared<GrpcBuffer>(slice, true);
+        (buffer->data.raw.compression == GRPC_COMPRESS_NONE)) {
+      // If it is, then we can reference the `grpc_slice`s directly.
+      const grpc_slice_buffer& slices = buffer->data.raw.slice_buffer;
+      out->reserve(slices.count);
+      for (size_t i = 0; i < slices.count; ++i) {
+        // Increment reference count so this memory remains valid
+        out->push_back(std::make_shared<GrpcBuffer>(slices.slices[i], true));
+      }
     } else {
       // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
       // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
@@ -114,7 +112,7 @@ class GrpcBuffer : public MutableBuffer {
       grpc_byte_buffer_reader_destroy(&reader);
 
       // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+      out->push_back(std::make_shared<GrpcBuffer>(slice, false));
     }
 
     return Status::OK();
@@ -124,6 +122,106 @@ class GrpcBuffer : public MutableBuffer {
   grpc_slice slice_;
 };
 
+// Protobuf input stream over a sequence of buffers, so that a message split
+// in several gRPC slices can be parsed without first making it contiguous
+class BufferVectorInputStream : public google::protobuf::io::ZeroCopyInputStream {
+ public:
+  explicit BufferVectorInputStream(const BufferVector& buffers) : buffers_(buffers) {}
+
+  bool Next(const void** data, int* size) override {
+    while (index_ < buffers_.size() && offset_ == buffers_[index_]->size()) {
+      ++index_;
+      offset_ = 0;
+    }
+    if (index_ == buffers_.size()) {
+      return false;
+    }
+    const auto& buffer = buffers_[index_];
+    *data = buffer->data() + offset_;
+    *size = static_cast<int>(buffer->size() - offset_);
+    byte_count_ += *size;
+    offset_ = buffer->size();
+    return true;
+  }
+
+  void BackUp(int count) override {
+    // Only called right after Next(), on the buffer it returned
+    offset_ -= count;
+    byte_count_ -= count;
+  }
+
+  bool Skip(int count) override {
+    while (count > 0) {
+      if (index_ == buffers_.size()) {
+        return false;
+      }
+      const int64_t available = buffers_[index_]->size() - offset_;
+      if (count < available) {
+        offset_ += count;
+        byte_count_ += count;
+        return true;
+      }
+      count -= static_cast<int>(available);
+      byte_count_ += available;
+      ++index_;
+      offset_ = 0;
+    }
+    return true;
+  }
+
+  int64_t ByteCount() const override { return byte_count_; }
+
+ private:
+  const BufferVector& buffers_;
+  size_t index_ = 0;
+  int64_t offset_ = 0;
+  int64_t byte_count_ = 0;
+};
+
+// Read a length-delimited field as slices of the underlying buffers, starting
+// at the current stream position, and skip over it
+bool ReadBytesZeroCopy(const BufferVector& source_data,
+                       const std::vector<int64_t>& source_offsets,
+                       CodedInputStream* input, BufferVector* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  const int64_t start = input->CurrentPosition();
+  const int64_t end = start + static_cast<int64_t>(length);
+  if (end > source_offsets.back()) {
+    return false;
+  }
+  out->clear();
+  // First buffer containing start
+  auto it = std::upper_bound(source_offsets.begin(), source_offsets.end(), start);
+  for (size_t i = static_cast<size_t>(it - source_offsets.begin()) - 1;
+       i < source_data.size() && source_offsets[i] < end; ++i) {
+    const int64_t slice_start = std::max(start, source_offsets[i]);
+    const int64_t slice_end = std::min(end, source_offsets[i + 1]);
+    if (slice_end > slice_start) {
+      out->push_back(SliceBuffer(source_data[i], slice_start - source_offsets[i],
+                                 slice_end - slice_start));
+    }
+  }
+  return input->Skip(static_cast<int>(length));
+}
+
+bool ReadBytesZeroCopy(const BufferVector& source_data,
+                       const std::vector<int64_t>& source_offsets,
+                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
+  BufferVector chunks;
+  if (!ReadBytesZeroCopy(source_data, source_offsets, input, &chunks)) {
+    return false;
+  }
+  if (chunks.size() == 1) {
+    *out = std::move(chunks[0]);
+    return true;
+  }
+  // Metadata fields are small, make them contiguous
+  return ConcatenateBuffers(chunks, default_memory_pool(), out).ok();
+}
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -271,11 +369,25 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
     return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
   }
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  // The message usually arrives in several slices: parse it across them, so
+  // that the body can reference them instead of being copied
+  BufferVector wrapped_buffers;
+  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffers));
+  std::vector<int64_t> wrapped_offsets;
+  wrapped_offsets.reserve(wrapped_buffers.size() + 1);
+  int64_t total_length = 0;
+  for (const auto& wrapped_buffer : wrapped_buffers) {
+    wrapped_offsets.push_back(total_length);
+    total_length += wrapped_buffer->size();
+  }
+  wrapped_offsets.push_back(total_length);
+  if (total_length > kInt32Max) {
+    return grpc::Status(grpc::StatusCode::INTERNAL, "FlightData too large");
+  }
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+  auto buffer_length = static_cast<int>(total_length);
+  BufferVectorInputStream input_stream(wrapped_buffers);
+  CodedInputStream pb_stream(&input_stream);
 
   pb_stream.SetTotalBytesLimit(buffer_length);
 
@@ -305,22 +417,33 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!ReadBytesZeroCopy(wrapped_buffers, wrapped_offsets, &pb_stream,
+                               &out->metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData metadata");
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!ReadBytesZeroCopy(wrapped_buffers, wrapped_offsets, &pb_stream,
+                               &out->app_metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData application metadata");
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        BufferVector body_chunks;
+        if (!ReadBytesZeroCopy(wrapped_buffers, wrapped_offsets, &pb_stream,
+                               &body_chunks)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData body");
         }
+        if (body_chunks.empty()) {
+          out->body = std::make_shared<Buffer>(nullptr, 0);
+        } else if (body_chunks.size() == 1) {
+          out->body = std::move(body_chunks[0]);
+        } else {
+          out->body_chunks = std::move(body_chunks);
+        }
       } break;
       default:
         DCHECK(false) << "cannot happen";
@@ -335,6 +458,9 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
 }
 
 Status FlightData::OpenMessage(std::unique_ptr<ipc::Message>* message) {
+  if (!body_chunks.empty()) {
+    return ipc::Message::Open(metadata, body_chunks, message);
+  }
   return ipc::Message::Open(metadata, body, message);
 }
 
@@ -361,10 +487,13 @@ bool WritePayload(const FlightPayload& payload,
 }
 
 bool WritePayload(const FlightPayload& payload,
-                  grpc::ServerWriter<pb::FlightData>* writer) {
+                  grpc::ServerWriter<pb::FlightData>* writer, bool buffer_hint) {
+  grpc::WriteOptions options;
+  if (buffer_hint) {
+    options.set_buffer_hint();
+  }
   // Pretend to be pb::FlightData and intercept in SerializationTraits
-  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
-                       grpc::WriteOptions());
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload), options);
 }
 
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
@@ -378,6 +507,12 @@ bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
 }
 
+void ReadPayloadAsync(grpc::ClientAsyncReader<pb::FlightData>* reader, FlightData* data,
+                      void* tag) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  reader->Read(reinterpret_cast<pb::FlightData*>(data), tag);
+}
+
 #ifndef _WIN32
 #pragma GCC diagnostic pop
 #endif
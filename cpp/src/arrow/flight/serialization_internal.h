@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/types.h"
@@ -49,16 +50,22 @@ struct FlightData {
   /// Message body
   std::shared_ptr<Buffer> body;
 
+  /// Message body split in several chunks, referencing the gRPC slices it was
+  /// received in.  If non-empty, body is null.
+  std::vector<std::shared_ptr<Buffer>> body_chunks;
+
   /// Open IPC message from the metadata and body
   Status OpenMessage(std::unique_ptr<ipc::Message>* message);
 };
 
 /// Write Flight message on gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if some error occurred (connection closed?).
+/// If buffer_hint is true, gRPC may hold the message back to coalesce it
+/// with following writes.
 bool WritePayload(const FlightPayload& payload,
                   grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer);
 bool WritePayload(const FlightPayload& payload,
-                  grpc::ServerWriter<pb::FlightData>* writer);
+                  grpc::ServerWriter<pb::FlightData>* writer, bool buffer_hint = false);
 
 /// Read Flight message from gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if stream ended.
@@ -66,6 +73,12 @@ bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data);
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data);
 
+/// Start reading a Flight message from an asynchronous gRPC stream with
+/// zero-copy optimizations. The message is available in data once tag
+/// completes successfully; data must stay alive until then.
+void ReadPayloadAsync(grpc::ClientAsyncReader<pb::FlightData>* reader, FlightData* data,
+                      void* tag);
+
 }  // namespace internal
 }  // namespace flight
 }  // namespace arrow
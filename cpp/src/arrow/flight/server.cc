@@ -21,8 +21,10 @@
 #include "arrow/flight/server.h"
 
 #include <signal.h>
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -280,6 +282,21 @@ class GrpcAddCallHeaders : public AddCallHeaders {
   grpc::ServerContext* context_;
 };
 
+// The number of bytes a payload occupies on the wire, excluding framing
+int64_t PayloadSize(const FlightPayload& payload) {
+  int64_t size = payload.ipc_message.body_length;
+  if (payload.ipc_message.metadata) {
+    size += payload.ipc_message.metadata->size();
+  }
+  if (payload.app_metadata) {
+    size += payload.app_metadata->size();
+  }
+  if (payload.descriptor) {
+    size += payload.descriptor->size();
+  }
+  return size;
+}
+
 // This class glues an implementation of FlightServerBase together with the
 // gRPC service definition, so the latter is not exposed in the public API
 class FlightServiceImpl : public FlightService::Service {
@@ -288,8 +305,14 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      FlightServerBase* server, int64_t max_message_size = -1,
+      int64_t write_coalesce_bytes = 0, bool allow_compression = true)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        server_(server),
+        max_message_size_(max_message_size),
+        write_coalesce_bytes_(write_coalesce_bytes),
+        allow_compression_(allow_compression) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -475,6 +498,27 @@ class FlightServiceImpl : public FlightService::Service {
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
 
+  // The body compression requested by the client, or UNCOMPRESSED
+  Status GetRequestedCompression(ServerContext* context, Compression::type* out) {
+    *out = Compression::UNCOMPRESSED;
+    const auto& client_metadata = context->client_metadata();
+    const auto header = client_metadata.find(internal::kGrpcCompressionHeader);
+    if (header != client_metadata.end()) {
+      const std::string value(header->second.data(), header->second.length());
+      ARROW_ASSIGN_OR_RAISE(*out, internal::ParseCompressionHeader(value));
+    }
+    return Status::OK();
+  }
+
+  Status CheckPayloadSize(const FlightPayload& payload) const {
+    if (max_message_size_ >= 0 && PayloadSize(payload) > max_message_size_) {
+      return Status::Invalid("Flight payload of ", PayloadSize(payload),
+                             " bytes exceeds the server's max_message_size of ",
+                             max_message_size_, " bytes");
+    }
+    return Status::OK();
+  }
+
   grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
                      ServerWriter<pb::FlightData>* writer) {
     GrpcServerCallContext flight_context;
@@ -494,23 +538,47 @@ class FlightServiceImpl : public FlightService::Service {
                                                           "No data in this flight"));
     }
 
+    // Honor the client's compression request if we can, otherwise fall
+    // back to sending the stream uncompressed
+    Compression::type compression;
+    if (allow_compression_ && GetRequestedCompression(context, &compression).ok() &&
+        compression != Compression::UNCOMPRESSED) {
+      const Status st = data_stream->SetCompression(compression);
+      if (!st.IsNotImplemented()) {
+        SERVICE_RETURN_NOT_OK(flight_context, st);
+      }
+    }
+
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
     SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
+    SERVICE_RETURN_NOT_OK(flight_context, CheckPayloadSize(schema_payload));
     if (!internal::WritePayload(schema_payload, writer)) {
       // Connection terminated?  XXX return error code?
       RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
     }
 
-    // Consume data stream and write out payloads
+    // Consume data stream and write out payloads. Small payloads may be
+    // held back by the transport until write_coalesce_bytes are pending;
+    // anything still buffered is flushed when the call finishes.
+    int64_t pending_bytes = 0;
     while (true) {
       FlightPayload payload;
       SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
+      if (payload.ipc_message.metadata == nullptr) {
+        // No more messages to write
         break;
+      }
+      SERVICE_RETURN_NOT_OK(flight_context, CheckPayloadSize(payload));
+      pending_bytes += PayloadSize(payload);
+      const bool buffer_hint = pending_bytes < write_coalesce_bytes_;
+      if (!internal::WritePayload(payload, writer, buffer_hint)) {
+        // Connection terminated for some other reason
+        break;
+      }
+      if (!buffer_hint) {
+        pending_bytes = 0;
+      }
     }
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
@@ -520,6 +588,14 @@ class FlightServiceImpl : public FlightService::Service {
     GrpcServerCallContext flight_context;
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoPut, context, flight_context));
 
+    // Compressed uploads are decompressed transparently by the reader
+    Compression::type compression;
+    SERVICE_RETURN_NOT_OK(flight_context, GetRequestedCompression(context, &compression));
+    if (compression != Compression::UNCOMPRESSED && !allow_compression_) {
+      SERVICE_RETURN_NOT_OK(flight_context,
+                            Status::NotImplemented("Compressed uploads are disabled"));
+    }
+
     auto message_reader =
         std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
@@ -579,6 +655,9 @@ class FlightServiceImpl : public FlightService::Service {
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
   FlightServerBase* server_;
+  int64_t max_message_size_;
+  int64_t write_coalesce_bytes_;
+  bool allow_compression_;
 };
 
 }  // namespace
@@ -635,7 +714,12 @@ thread_local std::atomic<FlightServerBase::Impl*>
 #endif
 
 FlightServerOptions::FlightServerOptions(const Location& location_)
-    : location(location_), auth_handler(nullptr) {}
+    : location(location_),
+      auth_handler(nullptr),
+      max_message_size(-1),
+      write_coalesce_bytes(0),
+      memory_quota(-1),
+      allow_compression(true) {}
 
 FlightServerOptions::~FlightServerOptions() = default;
 
@@ -644,12 +728,24 @@ FlightServerBase::FlightServerBase() { impl_.reset(new Impl); }
 FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
-  impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+  impl_->service_.reset(new FlightServiceImpl(options.auth_handler, options.middleware,
+                                              this, options.max_message_size,
+                                              options.write_coalesce_bytes,
+                                              options.allow_compression));
 
   grpc::ServerBuilder builder;
-  // Allow uploading messages of any length
-  builder.SetMaxReceiveMessageSize(-1);
+  if (options.max_message_size >= 0) {
+    builder.SetMaxReceiveMessageSize(static_cast<int>(
+        std::min<int64_t>(options.max_message_size, std::numeric_limits<int>::max())));
+  } else {
+    // Allow uploading messages of any length
+    builder.SetMaxReceiveMessageSize(-1);
+  }
+  if (options.memory_quota >= 0) {
+    grpc::ResourceQuota quota("arrow-flight-server");
+    quota.Resize(static_cast<size_t>(options.memory_quota));
+    builder.SetResourceQuota(quota);
+  }
 
   const Location& location = options.location;
   const std::string scheme = location.scheme();
@@ -804,6 +900,14 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
   std::shared_ptr<Schema> schema() { return reader_->schema(); }
 
+  Status SetCompression(Compression::type codec) {
+    if (stage_ != Stage::NEW) {
+      return Status::Invalid("Cannot change compression of a started stream");
+    }
+    ipc_options_.compression = codec;
+    return Status::OK();
+  }
+
   Status GetSchemaPayload(FlightPayload* payload) {
     return ipc::internal::GetSchemaPayload(*reader_->schema(), ipc_options_,
                                            &dictionary_memo_, &payload->ipc_message);
@@ -873,6 +977,10 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
 FlightDataStream::~FlightDataStream() {}
 
+Status FlightDataStream::SetCompression(Compression::type codec) {
+  return Status::NotImplemented("Compression not supported by this stream");
+}
+
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      MemoryPool* pool) {
   impl_.reset(new RecordBatchStreamImpl(reader, pool));
@@ -888,5 +996,9 @@ Status RecordBatchStream::GetSchemaPayload(FlightPayload* payload) {
 
 Status RecordBatchStream::Next(FlightPayload* payload) { return impl_->Next(payload); }
 
+Status RecordBatchStream::SetCompression(Compression::type codec) {
+  return impl_->SetCompression(codec);
+}
+
 }  // namespace flight
 }  // namespace arrow
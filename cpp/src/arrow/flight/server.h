@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -32,6 +33,7 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -58,6 +60,13 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
   // When the stream is completed, the last payload written will have null
   // metadata
   virtual Status Next(FlightPayload* payload) = 0;
+
+  /// \brief Compress record batch bodies with the given codec, as
+  /// negotiated with the client. Called before GetSchemaPayload.
+  ///
+  /// The default implementation returns NotImplemented, in which case
+  /// the stream is sent uncompressed.
+  virtual Status SetCompression(Compression::type codec);
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -73,6 +82,7 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::shared_ptr<Schema> schema() override;
   Status GetSchemaPayload(FlightPayload* payload) override;
   Status Next(FlightPayload* payload) override;
+  Status SetCompression(Compression::type codec) override;
 
  private:
   class RecordBatchStreamImpl;
@@ -138,6 +148,40 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   /// link to the same transport implementation as Flight to avoid
   /// runtime problems.
   std::function<void(void*)> builder_hook;
+
+  /// \brief The maximum size in bytes of a single message the server
+  /// will send or receive. -1 (the default) means no limit.
+  ///
+  /// A DoGet stream that produces a larger payload fails with an
+  /// Invalid status instead of sending it.
+  int64_t max_message_size;
+
+  /// \brief Coalesce DoGet writes until this many bytes are pending.
+  ///
+  /// The transport is allowed to buffer successive payloads of a DoGet
+  /// stream instead of flushing each one to the wire, until at least
+  /// this many bytes are pending. This amortizes per-message overhead
+  /// for streams of many small record batches, at the cost of holding
+  /// up to this many bytes per call. 0 (the default) flushes every
+  /// payload as soon as it is written.
+  int64_t write_coalesce_bytes;
+
+  /// \brief The maximum memory in bytes the transport may use for its
+  /// buffers, across all calls. Once exhausted, reads from clients are
+  /// throttled instead of allocating more. -1 (the default) means no
+  /// limit.
+  ///
+  /// Writes to slow clients are already flow-controlled: DoGet blocks
+  /// until the client has room, so at most one payload (or
+  /// write_coalesce_bytes) is queued per call.
+  int64_t memory_quota;
+
+  /// \brief Whether to honor clients' requests for compressed calls
+  /// (see FlightCallOptions::compression). Defaults to true.
+  ///
+  /// If false, DoGet streams are always sent uncompressed and
+  /// compressed DoPut uploads are rejected.
+  bool allow_compression;
 };
 
 /// \brief Skeleton RPC server implementation which can be used to create
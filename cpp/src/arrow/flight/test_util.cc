@@ -105,8 +105,14 @@ void TestServer::Start() {
   }
 
   try {
-    server_process_ = std::make_shared<bp::child>(
-        bp::search_path(executable_name_, search_path), "-port", str_port);
+    if (unix_sock_.empty()) {
+      server_process_ = std::make_shared<bp::child>(
+          bp::search_path(executable_name_, search_path), "-port", str_port);
+    } else {
+      server_process_ =
+          std::make_shared<bp::child>(bp::search_path(executable_name_, search_path),
+                                      "-port", str_port, "-server_unix", unix_sock_);
+    }
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
@@ -139,6 +145,8 @@ bool TestServer::IsRunning() { return server_process_->running(); }
 
 int TestServer::port() const { return port_; }
 
+const std::string& TestServer::unix_sock() const { return unix_sock_; }
+
 Status GetBatchForFlight(const Ticket& ticket, std::shared_ptr<RecordBatchReader>* out) {
   if (ticket.ticket == "ticket-ints-1") {
     BatchVector batches;
@@ -267,6 +275,10 @@ Status NumberingStream::GetSchemaPayload(FlightPayload* payload) {
   return stream_->GetSchemaPayload(payload);
 }
 
+Status NumberingStream::SetCompression(Compression::type codec) {
+  return stream_->SetCompression(codec);
+}
+
 Status NumberingStream::Next(FlightPayload* payload) {
   RETURN_NOT_OK(stream_->Next(payload));
   if (payload && payload->ipc_message.type == ipc::Message::RECORD_BATCH) {
@@ -51,6 +51,10 @@ class ARROW_FLIGHT_EXPORT TestServer {
       : executable_name_(executable_name), port_(::arrow::GetListenPort()) {}
   explicit TestServer(const std::string& executable_name, int port)
       : executable_name_(executable_name), port_(port) {}
+  /// \brief Launch a server listening on the given Unix domain socket
+  /// instead of the TCP port, if unix_sock is non-empty
+  TestServer(const std::string& executable_name, int port, const std::string& unix_sock)
+      : executable_name_(executable_name), port_(port), unix_sock_(unix_sock) {}
 
   void Start();
 
@@ -60,9 +64,12 @@ class ARROW_FLIGHT_EXPORT TestServer {
 
   int port() const;
 
+  const std::string& unix_sock() const;
+
  private:
   std::string executable_name_;
   int port_;
+  std::string unix_sock_;
   std::shared_ptr<::boost::process::child> server_process_;
 };
 
@@ -118,6 +125,7 @@ class ARROW_FLIGHT_EXPORT NumberingStream : public FlightDataStream {
   std::shared_ptr<Schema> schema() override;
   Status GetSchemaPayload(FlightPayload* payload) override;
   Status Next(FlightPayload* payload) override;
+  Status SetCompression(Compression::type codec) override;
 
  private:
   int counter_;
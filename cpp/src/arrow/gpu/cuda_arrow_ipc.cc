@@ -20,9 +20,13 @@
 #include <cstdint>
 #include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
+#include <cuda.h>
+
 #include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/reader.h"
@@ -33,6 +37,7 @@
 
 #include "generated/Message_generated.h"
 
+#include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_memory.h"
 
@@ -84,5 +89,182 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ipc::ReadRecordBatch(*message, schema, &unused_memo, out);
 }
 
+// ----------------------------------------------------------------------
+// CudaRecordBatchStreamReader
+
+class CudaRecordBatchStreamReader::CudaRecordBatchStreamReaderImpl {
+ public:
+  explicit CudaRecordBatchStreamReaderImpl(const std::shared_ptr<CudaContext>& context)
+      : context_(context) {}
+
+  ~CudaRecordBatchStreamReaderImpl() {
+    ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+    for (auto& slot : slots_) {
+      if (slot.stream != nullptr) {
+        // Pending copies must complete before their buffers are released
+        cuStreamSynchronize(slot.stream);
+        cuStreamDestroy(slot.stream);
+      }
+    }
+  }
+
+  Status Open(io::InputStream* stream) {
+    host_pool_.reset(new CudaHostMemoryPool(context_->device_number()));
+    // The bodies of the batches consumed are reused for the next ones
+    recycling_pool_.reset(new RecyclingMemoryPool(host_pool_.get()));
+    return Open(ipc::MessageReader::Open(stream, recycling_pool_.get()));
+  }
+
+  Status Open(std::unique_ptr<ipc::MessageReader> message_reader) {
+    message_reader_ = std::move(message_reader);
+
+    std::unique_ptr<ipc::Message> message;
+    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    if (!message) {
+      return Status::Invalid("Tried reading schema message, was null or length 0");
+    }
+    if (message->type() != ipc::Message::SCHEMA) {
+      return Status::IOError("Expected IPC message of type schema but got type ",
+                             ipc::FormatMessageType(message->type()));
+    }
+    RETURN_NOT_OK(ipc::ReadSchema(*message, &dictionary_memo_, &schema_));
+    if (dictionary_memo_.num_fields() > 0) {
+      return Status::NotImplemented(
+          "Reading dictionary-encoded fields into device memory");
+    }
+
+    ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+    for (auto& slot : slots_) {
+      CU_RETURN_NOT_OK(cuStreamCreate(&slot.stream, CU_STREAM_NON_BLOCKING));
+    }
+    return Status::OK();
+  }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+    if (!started_) {
+      RETURN_NOT_OK(Prefetch(&slots_[0]));
+      started_ = true;
+    }
+    Slot& current = slots_[current_slot_];
+    if (current.message == nullptr) {
+      // End of stream
+      *batch = nullptr;
+      return Status::OK();
+    }
+
+    // Start the copy of the next batch before waiting for this one
+    current_slot_ = (current_slot_ + 1) % kNumSlots;
+    RETURN_NOT_OK(Prefetch(&slots_[current_slot_]));
+
+    {
+      ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+      CU_RETURN_NOT_OK(cuStreamSynchronize(current.stream));
+    }
+    std::unique_ptr<ipc::Message> device_message;
+    RETURN_NOT_OK(
+        ipc::Message::Open(current.message->metadata(), current.body, &device_message));
+    // Release the host body, for the reading of the batch after the next one
+    current.message.reset();
+    current.body.reset();
+    return ipc::ReadRecordBatch(*device_message, schema_, &dictionary_memo_, batch);
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+ private:
+  // A batch being copied to the device
+  struct Slot {
+    CUstream stream = nullptr;
+    // The message as read on the host, alive until its copy completes
+    std::unique_ptr<ipc::Message> message;
+    std::shared_ptr<CudaBuffer> body;
+  };
+
+  // Read the next record batch message and start copying its body
+  Status Prefetch(Slot* slot) {
+    while (!end_of_stream_) {
+      std::unique_ptr<ipc::Message> message;
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (!message) {
+        end_of_stream_ = true;
+        break;
+      }
+      if (message->type() == ipc::Message::DICTIONARY_BATCH) {
+        return Status::NotImplemented("Reading dictionary batches into device memory");
+      }
+      if (message->type() != ipc::Message::RECORD_BATCH) {
+        return Status::IOError("Expected IPC message of type record batch but got type ",
+                               ipc::FormatMessageType(message->type()));
+      }
+
+      const auto& host_body = message->body();
+      const int64_t body_length = host_body == nullptr ? 0 : host_body->size();
+      RETURN_NOT_OK(context_->Allocate(body_length, &slot->body));
+      if (body_length > 0) {
+        ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+        CU_RETURN_NOT_OK(
+            cuMemcpyHtoDAsync(reinterpret_cast<CUdeviceptr>(slot->body->mutable_data()),
+                              host_body->data(), static_cast<size_t>(body_length),
+                              slot->stream));
+      }
+      slot->message = std::move(message);
+      return Status::OK();
+    }
+    slot->message = nullptr;
+    return Status::OK();
+  }
+
+  static constexpr int kNumSlots = 2;
+
+  std::shared_ptr<CudaContext> context_;
+  // The pools outlive the messages allocated from them
+  std::unique_ptr<CudaHostMemoryPool> host_pool_;
+  std::unique_ptr<RecyclingMemoryPool> recycling_pool_;
+  std::unique_ptr<ipc::MessageReader> message_reader_;
+
+  std::shared_ptr<Schema> schema_;
+  ipc::DictionaryMemo dictionary_memo_;
+
+  Slot slots_[kNumSlots];
+  int current_slot_ = 0;
+  bool started_ = false;
+  bool end_of_stream_ = false;
+};
+
+constexpr int CudaRecordBatchStreamReader::CudaRecordBatchStreamReaderImpl::kNumSlots;
+
+CudaRecordBatchStreamReader::CudaRecordBatchStreamReader() {}
+
+CudaRecordBatchStreamReader::~CudaRecordBatchStreamReader() {}
+
+Status CudaRecordBatchStreamReader::Open(io::InputStream* stream,
+                                         const std::shared_ptr<CudaContext>& context,
+                                         std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<CudaRecordBatchStreamReader> result(new CudaRecordBatchStreamReader());
+  result->impl_.reset(new CudaRecordBatchStreamReaderImpl(context));
+  RETURN_NOT_OK(result->impl_->Open(stream));
+  *out = result;
+  return Status::OK();
+}
+
+Status CudaRecordBatchStreamReader::Open(
+    std::unique_ptr<ipc::MessageReader> message_reader,
+    const std::shared_ptr<CudaContext>& context,
+    std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<CudaRecordBatchStreamReader> result(new CudaRecordBatchStreamReader());
+  result->impl_.reset(new CudaRecordBatchStreamReaderImpl(context));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  *out = result;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> CudaRecordBatchStreamReader::schema() const {
+  return impl_->schema();
+}
+
+Status CudaRecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
 }  // namespace cuda
 }  // namespace arrow
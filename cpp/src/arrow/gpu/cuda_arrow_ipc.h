@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -33,9 +34,16 @@ class MemoryPool;
 class RecordBatch;
 class Schema;
 
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
 namespace ipc {
 
 class Message;
+class MessageReader;
 
 }  // namespace ipc
 
@@ -71,6 +79,57 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
                        const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \class CudaRecordBatchStreamReader
+/// \brief Read the record batches of an IPC stream on the host into device
+/// memory
+///
+/// The body of each record batch is copied to the device asynchronously, on
+/// one of two CUDA streams in turn, so that the copy of a batch overlaps with
+/// the reading of the next one and with the use of the previous one. The
+/// batches returned have their buffers on the device and their copy complete.
+///
+/// Dictionary-encoded fields are not supported.
+class ARROW_EXPORT CudaRecordBatchStreamReader : public RecordBatchReader {
+ public:
+  ~CudaRecordBatchStreamReader() override;
+
+  /// \brief Open a reader of an IPC stream into device memory
+  /// \param[in] stream the input stream, must stay alive throughout the
+  /// lifetime of the reader
+  /// \param[in] context the CudaContext to allocate device memory from
+  /// \param[out] out the created reader
+  /// \return Status
+  ///
+  /// Unless the stream supports zero-copy, the message bodies are read into
+  /// page-locked host memory, reused from one batch to the next, from which
+  /// the copies to the device are truly asynchronous.
+  static Status Open(io::InputStream* stream, const std::shared_ptr<CudaContext>& context,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Open a reader of the IPC messages of a MessageReader into device
+  /// memory
+  /// \param[in] message_reader the MessageReader, e.g. of another transport
+  /// \param[in] context the CudaContext to allocate device memory from
+  /// \param[out] out the created reader
+  /// \return Status
+  ///
+  /// The message bodies should be in page-locked host memory, e.g. allocated
+  /// from a CudaHostMemoryPool, for the copies to the device to overlap.
+  static Status Open(std::unique_ptr<ipc::MessageReader> message_reader,
+                     const std::shared_ptr<CudaContext>& context,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  CudaRecordBatchStreamReader();
+
+  class CudaRecordBatchStreamReaderImpl;
+  std::unique_ptr<CudaRecordBatchStreamReaderImpl> impl_;
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
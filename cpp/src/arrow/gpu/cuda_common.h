@@ -39,6 +39,16 @@ namespace cuda {
     }                                                                           \
   } while (0)
 
+// Make a CUDA context current for the lifetime of the object
+class ContextSaver {
+ public:
+  explicit ContextSaver(CUcontext new_context) { cuCtxPushCurrent(new_context); }
+  ~ContextSaver() {
+    CUcontext unused;
+    cuCtxPopCurrent(&unused);
+  }
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
@@ -0,0 +1,618 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cuda.h>
+#include <nvrtc.h>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/gpu/cuda_common.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace cuda {
+
+#define NVRTC_RETURN_NOT_OK(STMT)                                                 \
+  do {                                                                            \
+    nvrtcResult nvrtc_result = (STMT);                                            \
+    if (nvrtc_result != NVRTC_SUCCESS) {                                          \
+      return Status::IOError("NVRTC call in ", __FILE__, " at line ", __LINE__,   \
+                             " failed with ", nvrtcGetErrorString(nvrtc_result), \
+                             ": ", #STMT);                                        \
+    }                                                                             \
+  } while (0)
+
+// The kernels, compiled with NVRTC. Kernels which write bitmaps write whole
+// bytes of them per thread, zeroing the trailing bits.
+static const char kKernelSource[] = R"(
+typedef signed char int8_t;
+typedef short int16_t;
+typedef int int32_t;
+typedef long long int64_t;
+typedef unsigned char uint8_t;
+typedef unsigned short uint16_t;
+typedef unsigned int uint32_t;
+typedef unsigned long long uint64_t;
+
+#define KERNEL extern "C" __global__
+
+#define GRID_STRIDE_LOOP(i, n)                                                  \
+  for (int64_t i = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x; \
+       i < (n); i += static_cast<int64_t>(blockDim.x) * gridDim.x)
+
+__device__ bool GetBit(const uint8_t* bits, int64_t i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+template <typename GetOutputBit>
+__device__ void WriteBits(int64_t length, uint8_t* out, GetOutputBit get_bit) {
+  GRID_STRIDE_LOOP(byte_index, (length + 7) / 8) {
+    uint8_t byte = 0;
+    for (int64_t i = byte_index * 8; i < length && i < byte_index * 8 + 8; ++i) {
+      byte |= static_cast<uint8_t>(get_bit(i) << (i & 7));
+    }
+    out[byte_index] = byte;
+  }
+}
+
+KERNEL void copy_bits(const uint8_t* bits, int64_t offset, int64_t length,
+                      uint8_t* out) {
+  WriteBits(length, out, [=](int64_t i) { return GetBit(bits, offset + i); });
+}
+
+KERNEL void count_bits(const uint8_t* bits, int64_t nbytes, uint64_t* out) {
+  uint64_t count = 0;
+  GRID_STRIDE_LOOP(i, nbytes) { count += __popc(bits[i]); }
+  atomicAdd(out, count);
+}
+
+// Filter: the rows selected by a mask, whose null rows are dropped
+
+__device__ bool IsSelected(const uint8_t* mask, const uint8_t* validity, int64_t offset,
+                           int64_t length, int64_t i) {
+  return i < length && GetBit(mask, offset + i) &&
+         (validity == nullptr || GetBit(validity, offset + i));
+}
+
+// The number of rows selected in every block of rows
+KERNEL void filter_count(const uint8_t* mask, const uint8_t* validity, int64_t offset,
+                         int64_t length, int64_t* block_counts) {
+  int64_t i = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x;
+  int count = __syncthreads_count(IsSelected(mask, validity, offset, length, i));
+  if (threadIdx.x == 0) {
+    block_counts[blockIdx.x] = count;
+  }
+}
+
+// The indices of the selected rows, given the output offsets of the blocks
+KERNEL void filter_indices(const uint8_t* mask, const uint8_t* validity,
+                           int64_t offset, int64_t length,
+                           const int64_t* block_offsets, int64_t* out) {
+  __shared__ int warp_offsets[32];
+  int64_t i = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x;
+  bool selected = IsSelected(mask, validity, offset, length, i);
+  unsigned int ballot = __ballot_sync(0xffffffff, selected);
+  int lane = threadIdx.x % 32;
+  int warp = threadIdx.x / 32;
+  if (lane == 0) {
+    warp_offsets[warp] = __popc(ballot);
+  }
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    int num_warps = blockDim.x / 32;
+    int warp_offset = 0;
+    for (int w = 0; w < num_warps; ++w) {
+      int count = warp_offsets[w];
+      warp_offsets[w] = warp_offset;
+      warp_offset += count;
+    }
+  }
+  __syncthreads();
+  if (selected) {
+    out[block_offsets[blockIdx.x] + warp_offsets[warp] +
+        __popc(ballot & ((1u << lane) - 1))] = i;
+  }
+}
+
+// Take: the rows at some indices, values of fixed width arrays being taken
+// by their bit width
+
+template <typename T, typename Index>
+__device__ void TakeValues(const T* values, const Index* indices, int64_t length,
+                           T* out) {
+  GRID_STRIDE_LOOP(i, length) { out[i] = values[indices[i]]; }
+}
+
+#define DEFINE_TAKE_VALUES_KERNEL(WIDTH, INDEX)                                   \
+  KERNEL void take_values_##WIDTH##_##INDEX(const uint##WIDTH##_t* values,        \
+                                            const INDEX##_t* indices,             \
+                                            int64_t length, uint##WIDTH##_t* out) { \
+    TakeValues(values, indices, length, out);                                     \
+  }
+
+#define DEFINE_TAKE_KERNELS(INDEX)                                                 \
+  KERNEL void check_indices_##INDEX(const INDEX##_t* indices, int64_t length,      \
+                                    int64_t num_rows, int32_t* out_of_bounds) {    \
+    GRID_STRIDE_LOOP(i, length) {                                                  \
+      if (indices[i] < 0 || indices[i] >= num_rows) {                              \
+        *out_of_bounds = 1;                                                        \
+      }                                                                            \
+    }                                                                              \
+  }                                                                                \
+  KERNEL void take_bits_##INDEX(const uint8_t* bits, int64_t offset,               \
+                                const INDEX##_t* indices, int64_t length,          \
+                                uint8_t* out) {                                    \
+    WriteBits(length, out,                                                         \
+              [=](int64_t i) { return GetBit(bits, offset + indices[i]); });       \
+  }                                                                                \
+  DEFINE_TAKE_VALUES_KERNEL(8, INDEX)                                              \
+  DEFINE_TAKE_VALUES_KERNEL(16, INDEX)                                             \
+  DEFINE_TAKE_VALUES_KERNEL(32, INDEX)                                             \
+  DEFINE_TAKE_VALUES_KERNEL(64, INDEX)
+
+DEFINE_TAKE_KERNELS(int32)
+DEFINE_TAKE_KERNELS(int64)
+
+// Compare: values with a scalar, by the value of a compute::CompareOperator
+
+template <typename T>
+__device__ bool CompareValues(T left, T right, int32_t op) {
+  switch (op) {
+    case 0:
+      return left == right;
+    case 1:
+      return left != right;
+    case 2:
+      return left > right;
+    case 3:
+      return left >= right;
+    case 4:
+      return left < right;
+    default:
+      return left <= right;
+  }
+}
+
+#define DEFINE_COMPARE_KERNEL(NAME, TYPE)                                       \
+  KERNEL void compare_##NAME(const TYPE* values, int64_t length, TYPE value,    \
+                             int32_t op, uint8_t* out) {                        \
+    WriteBits(length, out,                                                      \
+              [=](int64_t i) { return CompareValues(values[i], value, op); }); \
+  }
+
+DEFINE_COMPARE_KERNEL(int8, int8_t)
+DEFINE_COMPARE_KERNEL(int16, int16_t)
+DEFINE_COMPARE_KERNEL(int32, int32_t)
+DEFINE_COMPARE_KERNEL(int64, int64_t)
+DEFINE_COMPARE_KERNEL(uint8, uint8_t)
+DEFINE_COMPARE_KERNEL(uint16, uint16_t)
+DEFINE_COMPARE_KERNEL(uint32, uint32_t)
+DEFINE_COMPARE_KERNEL(uint64, uint64_t)
+DEFINE_COMPARE_KERNEL(float, float)
+DEFINE_COMPARE_KERNEL(double, double)
+)";
+
+static_assert(compute::EQUAL == 0 && compute::NOT_EQUAL == 1 && compute::GREATER == 2 &&
+                  compute::GREATER_EQUAL == 3 && compute::LESS == 4 &&
+                  compute::LESS_EQUAL == 5,
+              "The compare kernels switch on the values of CompareOperator");
+
+// Threads per block, a multiple of the warp size
+constexpr int kBlockSize = 256;
+// Grid-stride kernels need no more blocks than can run concurrently
+constexpr int64_t kMaxGridSize = 1 << 16;
+
+static int64_t GridSize(int64_t num_threads) {
+  return std::min(BitUtil::CeilDiv(num_threads, kBlockSize), kMaxGridSize);
+}
+
+// The kernels compiled for and loaded in every CUDA context they are used in
+class KernelModules {
+ public:
+  static KernelModules* GetInstance() {
+    static KernelModules instance;
+    return &instance;
+  }
+
+  // Get a kernel of the current context, compiling and loading the kernels
+  // on first use
+  Status GetFunction(const std::string& name, CUfunction* out) {
+    CUcontext context;
+    CU_RETURN_NOT_OK(cuCtxGetCurrent(&context));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = modules_.find(context);
+    if (it == modules_.end()) {
+      CUmodule module;
+      RETURN_NOT_OK(LoadModule(&module));
+      it = modules_.emplace(context, module).first;
+    }
+    CU_RETURN_NOT_OK(cuModuleGetFunction(out, it->second, name.c_str()));
+    return Status::OK();
+  }
+
+ private:
+  Status LoadModule(CUmodule* out) {
+    CUdevice device;
+    int major = 0;
+    int minor = 0;
+    CU_RETURN_NOT_OK(cuCtxGetDevice(&device));
+    CU_RETURN_NOT_OK(cuDeviceGetAttribute(
+        &major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, device));
+    CU_RETURN_NOT_OK(cuDeviceGetAttribute(
+        &minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, device));
+
+    nvrtcProgram program;
+    NVRTC_RETURN_NOT_OK(nvrtcCreateProgram(&program, kKernelSource,
+                                           "cuda_compute_kernels.cu", 0, nullptr,
+                                           nullptr));
+    std::string ptx;
+    Status status = Compile(program, major * 10 + minor, &ptx);
+    nvrtcDestroyProgram(&program);
+    RETURN_NOT_OK(status);
+    CU_RETURN_NOT_OK(cuModuleLoadData(out, ptx.data()));
+    return Status::OK();
+  }
+
+  Status Compile(nvrtcProgram program, int compute_capability, std::string* out) {
+    const std::string arch =
+        "--gpu-architecture=compute_" + std::to_string(compute_capability);
+    const char* options[] = {arch.c_str(), "--std=c++11"};
+    if (nvrtcCompileProgram(program, 2, options) != NVRTC_SUCCESS) {
+      size_t log_size = 0;
+      NVRTC_RETURN_NOT_OK(nvrtcGetProgramLogSize(program, &log_size));
+      std::string log(log_size, '\0');
+      NVRTC_RETURN_NOT_OK(nvrtcGetProgramLog(program, &log[0]));
+      return Status::IOError("Failed to compile the CUDA kernels: ", log);
+    }
+    size_t ptx_size = 0;
+    NVRTC_RETURN_NOT_OK(nvrtcGetPTXSize(program, &ptx_size));
+    out->resize(ptx_size);
+    NVRTC_RETURN_NOT_OK(nvrtcGetPTX(program, &(*out)[0]));
+    return Status::OK();
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<CUcontext, CUmodule> modules_;
+};
+
+// Launches the kernels of a call on a stream, allocating their outputs in
+// the context on that stream. The context must be current.
+class KernelLauncher {
+ public:
+  KernelLauncher(const std::shared_ptr<CudaContext>& context, void* stream)
+      : context_(context), stream_(stream) {}
+
+  template <typename... Args>
+  Status Launch(const std::string& name, int64_t num_blocks, Args... args) {
+    if (num_blocks == 0) {
+      return Status::OK();
+    }
+    CUfunction function;
+    RETURN_NOT_OK(KernelModules::GetInstance()->GetFunction(name, &function));
+    void* params[] = {&args...};
+    CU_RETURN_NOT_OK(cuLaunchKernel(function, static_cast<unsigned int>(num_blocks), 1,
+                                    1, kBlockSize, 1, 1, 0,
+                                    reinterpret_cast<CUstream>(stream_), params,
+                                    nullptr));
+    return Status::OK();
+  }
+
+  Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+    return context_->Allocate(nbytes, stream_, out);
+  }
+
+  Status AllocateZeroed(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+    RETURN_NOT_OK(Allocate(nbytes, out));
+    if (nbytes > 0) {
+      CU_RETURN_NOT_OK(cuMemsetD8Async(
+          reinterpret_cast<CUdeviceptr>((*out)->mutable_data()), 0,
+          static_cast<size_t>(nbytes), reinterpret_cast<CUstream>(stream_)));
+    }
+    return Status::OK();
+  }
+
+  // Copy a device buffer to the host once the work queued before completes
+  Status CopyToHost(const CudaBuffer& buffer, void* out) {
+    std::shared_ptr<CudaEvent> event;
+    RETURN_NOT_OK(buffer.CopyToHostAsync(0, buffer.size(), out, stream_, &event));
+    return event->Wait();
+  }
+
+ private:
+  std::shared_ptr<CudaContext> context_;
+  void* stream_;
+};
+
+static Status DeviceAddress(const std::shared_ptr<Buffer>& buffer, const uint8_t** out) {
+  if (buffer == nullptr) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  std::shared_ptr<CudaBuffer> cuda_buffer;
+  RETURN_NOT_OK(CudaBuffer::FromBuffer(buffer, &cuda_buffer));
+  *out = cuda_buffer->data();
+  return Status::OK();
+}
+
+// The validity bitmap of an array, nullptr if it has no nulls
+static Status DeviceValidity(const ArrayData& data, const uint8_t** out) {
+  if (data.null_count == 0) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  return DeviceAddress(data.buffers[0], out);
+}
+
+// The bit width of the values of a type, by which they are taken
+static Status TakeBitWidth(const DataType& type, int* out) {
+  if (is_fixed_width(type.id()) && type.id() != Type::DICTIONARY) {
+    *out = checked_cast<const FixedWidthType&>(type).bit_width();
+    if (*out == 1 || *out == 8 || *out == 16 || *out == 32 || *out == 64) {
+      return Status::OK();
+    }
+  }
+  return Status::NotImplemented("CUDA kernels on ", type.ToString(), " arrays");
+}
+
+// Take the rows of a batch at indices which are in bounds
+static Status TakeBatch(KernelLauncher* launcher, const RecordBatch& batch,
+                        const std::string& index_name, const uint8_t* indices,
+                        int64_t length, std::shared_ptr<RecordBatch>* out) {
+  const int num_columns = batch.num_columns();
+  std::vector<int> bit_widths(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    RETURN_NOT_OK(TakeBitWidth(*batch.schema()->field(i)->type(), &bit_widths[i]));
+  }
+
+  // The valid bits of the taken columns are counted on the device
+  std::shared_ptr<CudaBuffer> valid_counts;
+  RETURN_NOT_OK(launcher->AllocateZeroed(num_columns * sizeof(uint64_t), &valid_counts));
+  auto valid_counts_data = reinterpret_cast<uint64_t*>(valid_counts->mutable_data());
+  const int64_t bitmap_size = BitUtil::BytesForBits(length);
+  bool any_nulls = false;
+
+  std::vector<std::shared_ptr<ArrayData>> columns(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    const ArrayData& values = *batch.column_data(i);
+    const uint8_t* values_data;
+    RETURN_NOT_OK(DeviceAddress(values.buffers[1], &values_data));
+    std::shared_ptr<CudaBuffer> data;
+    if (bit_widths[i] == 1) {
+      RETURN_NOT_OK(launcher->Allocate(bitmap_size, &data));
+      RETURN_NOT_OK(launcher->Launch("take_bits_" + index_name, GridSize(bitmap_size),
+                                     values_data, values.offset, indices, length,
+                                     data->mutable_data()));
+    } else {
+      const int byte_width = bit_widths[i] / 8;
+      RETURN_NOT_OK(launcher->Allocate(length * byte_width, &data));
+      RETURN_NOT_OK(launcher->Launch(
+          "take_values_" + std::to_string(bit_widths[i]) + "_" + index_name,
+          GridSize(length), values_data + values.offset * byte_width, indices, length,
+          data->mutable_data()));
+    }
+
+    const uint8_t* values_validity;
+    RETURN_NOT_OK(DeviceValidity(values, &values_validity));
+    std::shared_ptr<CudaBuffer> validity;
+    if (values_validity != nullptr) {
+      any_nulls = true;
+      RETURN_NOT_OK(launcher->Allocate(bitmap_size, &validity));
+      RETURN_NOT_OK(launcher->Launch("take_bits_" + index_name, GridSize(bitmap_size),
+                                     values_validity, values.offset, indices, length,
+                                     validity->mutable_data()));
+      RETURN_NOT_OK(launcher->Launch("count_bits", GridSize(bitmap_size),
+                                     validity->data(), bitmap_size,
+                                     valid_counts_data + i));
+    }
+    columns[i] = ArrayData::Make(values.type, length, {validity, data},
+                                 validity == nullptr ? 0 : kUnknownNullCount);
+  }
+
+  if (any_nulls) {
+    std::vector<uint64_t> counts(num_columns);
+    RETURN_NOT_OK(launcher->CopyToHost(*valid_counts, counts.data()));
+    for (int i = 0; i < num_columns; ++i) {
+      if (columns[i]->null_count != 0) {
+        columns[i]->null_count = length - static_cast<int64_t>(counts[i]);
+      }
+    }
+  }
+  *out = RecordBatch::Make(batch.schema(), length, std::move(columns));
+  return Status::OK();
+}
+
+Status Filter(const std::shared_ptr<CudaContext>& context, const RecordBatch& batch,
+              const Array& mask, void* stream, std::shared_ptr<RecordBatch>* out) {
+  if (mask.type_id() != Type::BOOL) {
+    return Status::TypeError("Filter mask must be boolean, got ",
+                             mask.type()->ToString());
+  }
+  if (mask.length() != batch.num_rows()) {
+    return Status::Invalid("Filter mask of length ", mask.length(),
+                           " for a record batch of ", batch.num_rows(), " rows");
+  }
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context->handle()));
+  KernelLauncher launcher(context, stream);
+
+  const ArrayData& mask_data = *mask.data();
+  const uint8_t* mask_bits;
+  const uint8_t* mask_validity;
+  RETURN_NOT_OK(DeviceAddress(mask_data.buffers[1], &mask_bits));
+  RETURN_NOT_OK(DeviceValidity(mask_data, &mask_validity));
+  const int64_t length = mask.length();
+  const int64_t num_blocks = BitUtil::CeilDiv(length, kBlockSize);
+
+  // The selected rows are counted by block, the counts scanned into the
+  // offsets of the indices of the blocks on the host
+  std::shared_ptr<CudaBuffer> block_offsets;
+  RETURN_NOT_OK(launcher.Allocate(num_blocks * sizeof(int64_t), &block_offsets));
+  RETURN_NOT_OK(launcher.Launch("filter_count", num_blocks, mask_bits, mask_validity,
+                                mask_data.offset, length,
+                                block_offsets->mutable_data()));
+  std::vector<int64_t> offsets(num_blocks);
+  RETURN_NOT_OK(launcher.CopyToHost(*block_offsets, offsets.data()));
+  int64_t num_selected = 0;
+  for (auto& offset : offsets) {
+    const int64_t count = offset;
+    offset = num_selected;
+    num_selected += count;
+  }
+  RETURN_NOT_OK(block_offsets->CopyFromHostAsync(
+      0, offsets.data(), num_blocks * sizeof(int64_t), stream));
+
+  std::shared_ptr<CudaBuffer> indices;
+  RETURN_NOT_OK(launcher.Allocate(num_selected * sizeof(int64_t), &indices));
+  RETURN_NOT_OK(launcher.Launch("filter_indices", num_blocks, mask_bits, mask_validity,
+                                mask_data.offset, length, block_offsets->data(),
+                                indices->mutable_data()));
+  return TakeBatch(&launcher, batch, "int64", indices->data(), num_selected, out);
+}
+
+Status Take(const std::shared_ptr<CudaContext>& context, const RecordBatch& batch,
+            const Array& indices, void* stream, std::shared_ptr<RecordBatch>* out) {
+  std::string index_name;
+  int index_width;
+  switch (indices.type_id()) {
+    case Type::INT32:
+      index_name = "int32";
+      index_width = 4;
+      break;
+    case Type::INT64:
+      index_name = "int64";
+      index_width = 8;
+      break;
+    default:
+      return Status::TypeError("Take indices must be int32 or int64, got ",
+                               indices.type()->ToString());
+  }
+  const ArrayData& indices_data = *indices.data();
+  if (indices_data.null_count != 0 && indices_data.buffers[0] != nullptr) {
+    return Status::NotImplemented("Take with null indices on the device");
+  }
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context->handle()));
+  KernelLauncher launcher(context, stream);
+
+  const uint8_t* indices_address;
+  RETURN_NOT_OK(DeviceAddress(indices_data.buffers[1], &indices_address));
+  indices_address += indices_data.offset * index_width;
+  const int64_t length = indices.length();
+
+  std::shared_ptr<CudaBuffer> out_of_bounds;
+  RETURN_NOT_OK(launcher.AllocateZeroed(sizeof(int32_t), &out_of_bounds));
+  RETURN_NOT_OK(launcher.Launch("check_indices_" + index_name, GridSize(length),
+                                indices_address, length, batch.num_rows(),
+                                out_of_bounds->mutable_data()));
+  int32_t any_out_of_bounds = 0;
+  RETURN_NOT_OK(launcher.CopyToHost(*out_of_bounds, &any_out_of_bounds));
+  if (any_out_of_bounds) {
+    return Status::IndexError("Take index out of bounds");
+  }
+  return TakeBatch(&launcher, batch, index_name, indices_address, length, out);
+}
+
+template <typename ArrowType>
+static Status LaunchCompare(KernelLauncher* launcher, const std::string& name,
+                            const ArrayData& values, const Scalar& value,
+                            compute::CompareOperator op, uint8_t* out) {
+  using CType = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  const uint8_t* values_data;
+  RETURN_NOT_OK(DeviceAddress(values.buffers[1], &values_data));
+  return launcher->Launch(
+      "compare_" + name, GridSize(BitUtil::BytesForBits(values.length)),
+      reinterpret_cast<const CType*>(values_data) + values.offset, values.length,
+      checked_cast<const ScalarType&>(value).value, static_cast<int32_t>(op), out);
+}
+
+Status Compare(const std::shared_ptr<CudaContext>& context, const Array& values,
+               const Scalar& value, compute::CompareOperator op, void* stream,
+               std::shared_ptr<Array>* out) {
+  if (!value.is_valid) {
+    return Status::Invalid("Compare with a null scalar");
+  }
+  if (!value.type->Equals(*values.type())) {
+    return Status::TypeError("Compare ", values.type()->ToString(), " values with a ",
+                             value.type->ToString(), " scalar");
+  }
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context->handle()));
+  KernelLauncher launcher(context, stream);
+
+  const ArrayData& data = *values.data();
+  const int64_t bitmap_size = BitUtil::BytesForBits(data.length);
+  std::shared_ptr<CudaBuffer> bits;
+  RETURN_NOT_OK(launcher.Allocate(bitmap_size, &bits));
+
+#define COMPARE_CASE(TYPE_CLASS, NAME)                                          \
+  case TYPE_CLASS##Type::type_id:                                               \
+    RETURN_NOT_OK(LaunchCompare<TYPE_CLASS##Type>(&launcher, NAME, data, value, \
+                                                  op, bits->mutable_data()));   \
+    break;
+
+  switch (values.type_id()) {
+    COMPARE_CASE(Int8, "int8")
+    COMPARE_CASE(Int16, "int16")
+    COMPARE_CASE(Int32, "int32")
+    COMPARE_CASE(Int64, "int64")
+    COMPARE_CASE(UInt8, "uint8")
+    COMPARE_CASE(UInt16, "uint16")
+    COMPARE_CASE(UInt32, "uint32")
+    COMPARE_CASE(UInt64, "uint64")
+    COMPARE_CASE(Float, "float")
+    COMPARE_CASE(Double, "double")
+    default:
+      return Status::NotImplemented("CUDA comparison of ", values.type()->ToString(),
+                                    " values");
+  }
+
+#undef COMPARE_CASE
+
+  // The result is null where the values are
+  const uint8_t* values_validity;
+  RETURN_NOT_OK(DeviceValidity(data, &values_validity));
+  std::shared_ptr<CudaBuffer> validity;
+  if (values_validity != nullptr) {
+    RETURN_NOT_OK(launcher.Allocate(bitmap_size, &validity));
+    RETURN_NOT_OK(launcher.Launch("copy_bits", GridSize(bitmap_size), values_validity,
+                                  data.offset, data.length, validity->mutable_data()));
+  }
+  *out = MakeArray(ArrayData::Make(boolean(), data.length, {validity, bits},
+                                   validity == nullptr ? 0 : data.null_count));
+  return Status::OK();
+}
+
+}  // namespace cuda
+}  // namespace arrow
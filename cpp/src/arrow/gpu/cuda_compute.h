@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_GPU_CUDA_COMPUTE_H
+#define ARROW_GPU_CUDA_COMPUTE_H
+
+#include <memory>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+struct Scalar;
+
+namespace cuda {
+
+class CudaContext;
+
+// Kernels on arrays whose buffers are CudaBuffers, as read by ReadRecordBatch.
+// The columns may be of boolean type or of a fixed width type of 8, 16, 32
+// or 64 bits, other than dictionary. The kernels are compiled for the device
+// with NVRTC on their first use in a context, and are queued on a CUDA
+// stream; the results are allocated in the context on that stream.
+
+/// \brief Select the rows of a record batch on the device where a mask is true
+/// \param[in] context the context of the device memory
+/// \param[in] batch the record batch on the device
+/// \param[in] mask a boolean array on the device of the length of the batch,
+/// whose null rows are dropped
+/// \param[in] stream the CUstream to run on, nullptr for the legacy default
+/// stream
+/// \param[out] out the selected rows on the device
+/// \return Status
+///
+/// \note The number of selected rows is copied to the host, which
+/// synchronizes with the stream
+ARROW_EXPORT
+Status Filter(const std::shared_ptr<CudaContext>& context, const RecordBatch& batch,
+              const Array& mask, void* stream, std::shared_ptr<RecordBatch>* out);
+
+/// \brief Select the rows of a record batch on the device at some indices
+/// \param[in] context the context of the device memory
+/// \param[in] batch the record batch on the device
+/// \param[in] indices an int32 or int64 array on the device, without nulls
+/// \param[in] stream the CUstream to run on, nullptr for the legacy default
+/// stream
+/// \param[out] out the selected rows on the device
+/// \return Status
+///
+/// \note The bounds of the indices and the null counts of the selected
+/// columns are copied to the host, which synchronizes with the stream
+ARROW_EXPORT
+Status Take(const std::shared_ptr<CudaContext>& context, const RecordBatch& batch,
+            const Array& indices, void* stream, std::shared_ptr<RecordBatch>* out);
+
+/// \brief Compare the values of an array on the device with a scalar
+/// \param[in] context the context of the device memory
+/// \param[in] values a numeric array on the device
+/// \param[in] value a valid scalar of the type of the values
+/// \param[in] op the comparison, the values being the left operand
+/// \param[in] stream the CUstream to run on, nullptr for the legacy default
+/// stream
+/// \param[out] out a boolean array on the device, null where the values are
+/// \return Status
+ARROW_EXPORT
+Status Compare(const std::shared_ptr<CudaContext>& context, const Array& values,
+               const Scalar& value, compute::CompareOperator op, void* stream,
+               std::shared_ptr<Array>* out);
+
+}  // namespace cuda
+}  // namespace arrow
+
+#endif  // ARROW_GPU_CUDA_COMPUTE_H
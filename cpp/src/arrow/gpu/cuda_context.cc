@@ -17,8 +17,12 @@
 
 #include "arrow/gpu/cuda_context.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -27,27 +31,24 @@
 
 #include <cuda.h>
 
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
 #include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_memory.h"
 
 namespace arrow {
 namespace cuda {
 
+// Freed device memory kept for reuse by default, see SetMaxCachedBytes
+constexpr int64_t kDefaultMaxCachedBytes = 256 << 20;
+
 struct CudaDevice {
   int device_num;
   CUdevice handle;
   int64_t total_memory;
 };
 
-class ContextSaver {
- public:
-  explicit ContextSaver(CUcontext new_context) { cuCtxPushCurrent(new_context); }
-  ~ContextSaver() {
-    CUcontext unused;
-    cuCtxPopCurrent(&unused);
-  }
-};
-
 class CudaContext::CudaContextImpl {
  public:
   CudaContextImpl() : bytes_allocated_(0) {}
@@ -68,7 +69,19 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  ~CudaContextImpl() {
+    if (is_open_) {
+      Status st = SetMaxCachedBytes(0);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to free cached device memory: " << st.ToString();
+      }
+    }
+  }
+
   Status Close() {
+    if (is_open_) {
+      RETURN_NOT_OK(SetMaxCachedBytes(0));
+    }
     if (is_open_ && own_context_) {
       CU_RETURN_NOT_OK(cuDevicePrimaryCtxRelease(device_.handle));
     }
@@ -78,16 +91,34 @@ class CudaContext::CudaContextImpl {
 
   int64_t bytes_allocated() const { return bytes_allocated_.load(); }
 
-  Status Allocate(int64_t nbytes, uint8_t** out) {
-    if (nbytes > 0) {
-      ContextSaver set_temporary(context_);
+  Status Allocate(int64_t nbytes, CUstream stream, uint8_t** out) {
+    if (nbytes == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    const int64_t size = SizeClass(nbytes);
+    ContextSaver set_temporary(context_);
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    ++stats_.num_allocations;
+    RETURN_NOT_OK(TakeCachedBlock(size, stream, out));
+    if (*out != nullptr) {
+      ++stats_.num_cache_hits;
+    } else {
       CUdeviceptr data;
-      CU_RETURN_NOT_OK(cuMemAlloc(&data, static_cast<size_t>(nbytes)));
-      bytes_allocated_ += nbytes;
+      CUresult result = cuMemAlloc(&data, static_cast<size_t>(size));
+      if (result == CUDA_ERROR_OUT_OF_MEMORY && stats_.bytes_cached > 0) {
+        // The cached blocks may be in the way, give them back and retry
+        RETURN_NOT_OK(ReleaseCachedBlocks(0));
+        result = cuMemAlloc(&data, static_cast<size_t>(size));
+      }
+      CU_RETURN_NOT_OK(result);
+      ++stats_.num_device_allocations;
       *out = reinterpret_cast<uint8_t*>(data);
-    } else {
-      *out = nullptr;
     }
+    if (stream != nullptr) {
+      block_streams_[*out] = stream;
+    }
+    bytes_allocated_ += nbytes;
     return Status::OK();
   }
 
@@ -105,6 +136,22 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyHtoDAsync(reinterpret_cast<CUdeviceptr>(dst), src,
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyDtoHAsync(dst, reinterpret_cast<const CUdeviceptr>(src),
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK(cuMemcpyDtoD(reinterpret_cast<CUdeviceptr>(dst),
@@ -130,11 +177,53 @@ class CudaContext::CudaContextImpl {
   }
 
   Status Free(void* device_ptr, int64_t nbytes) {
-    CU_RETURN_NOT_OK(cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
+    const int64_t size = SizeClass(nbytes);
+    auto data = reinterpret_cast<uint8_t*>(device_ptr);
+    std::lock_guard<std::mutex> lock(cache_mutex_);
     bytes_allocated_ -= nbytes;
+
+    CUstream stream = nullptr;
+    auto it = block_streams_.find(data);
+    if (it != block_streams_.end()) {
+      stream = it->second;
+      block_streams_.erase(it);
+    }
+    if (!is_open_ || stats_.bytes_cached + size > max_cached_bytes_) {
+      CU_RETURN_NOT_OK(cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
+      return Status::OK();
+    }
+
+    // The block may still be in use by work queued on its stream, which
+    // completes before the event does
+    ContextSaver set_temporary(context_);
+    CachedBlock block{data, stream, nullptr};
+    CU_RETURN_NOT_OK(cuEventCreate(&block.event, CU_EVENT_DISABLE_TIMING));
+    CU_RETURN_NOT_OK(cuEventRecord(block.event, stream));
+    cached_blocks_.emplace(size, block);
+    stats_.bytes_cached += size;
     return Status::OK();
   }
 
+  Status SetMaxCachedBytes(int64_t max_cached_bytes) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    max_cached_bytes_ = max_cached_bytes;
+    ContextSaver set_temporary(context_);
+    return ReleaseCachedBlocks(max_cached_bytes);
+  }
+
+  Status ReleaseCachedMemory() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    ContextSaver set_temporary(context_);
+    return ReleaseCachedBlocks(0);
+  }
+
+  CudaMemoryStats memory_stats() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    CudaMemoryStats stats = stats_;
+    stats.bytes_allocated = bytes_allocated_.load();
+    return stats;
+  }
+
   Status ExportIpcBuffer(void* data, int64_t size,
                          std::shared_ptr<CudaIpcMemHandle>* handle) {
     CUipcMemHandle cu_handle;
@@ -174,6 +263,80 @@ class CudaContext::CudaContextImpl {
   bool own_context_;
 
   std::atomic<int64_t> bytes_allocated_;
+
+  // A freed allocation kept for reuse
+  struct CachedBlock {
+    uint8_t* data;
+    // The stream the block was last used on, null for the legacy default one
+    CUstream stream;
+    // Complete once the work queued on the block before it was freed is
+    CUevent event;
+  };
+
+  // Allocations are rounded up to size classes, so that the blocks of a size
+  // class can be reused for any allocation of that class. Small sizes are
+  // rounded to 512 bytes, larger ones to a quarter of their power of two so
+  // that at most a fifth of a block is wasted.
+  static int64_t SizeClass(int64_t nbytes) {
+    constexpr int64_t kSmallSize = 1 << 20;
+    if (nbytes < kSmallSize) {
+      return BitUtil::RoundUp(nbytes, 512);
+    }
+    int64_t power = BitUtil::NextPower2(nbytes);
+    if (power != nbytes) {
+      power /= 2;
+    }
+    return BitUtil::RoundUp(nbytes, power / 4);
+  }
+
+  // Take a cached block of the size class, which is either used on the same
+  // stream, so that the work queued on it is ordered with the previous use,
+  // or no longer in use. The cache mutex must be held.
+  Status TakeCachedBlock(int64_t size, CUstream stream, uint8_t** out) {
+    *out = nullptr;
+    auto range = cached_blocks_.equal_range(size);
+    for (auto it = range.first; it != range.second; ++it) {
+      const CachedBlock& block = it->second;
+      bool reusable = block.stream == stream;
+      if (!reusable) {
+        CUresult result = cuEventQuery(block.event);
+        if (result != CUDA_ERROR_NOT_READY) {
+          CU_RETURN_NOT_OK(result);
+          reusable = true;
+        }
+      }
+      if (reusable) {
+        *out = block.data;
+        CU_RETURN_NOT_OK(cuEventDestroy(block.event));
+        cached_blocks_.erase(it);
+        stats_.bytes_cached -= size;
+        return Status::OK();
+      }
+    }
+    return Status::OK();
+  }
+
+  // Free cached blocks, largest first, until at most max_cached_bytes are
+  // cached. The cache mutex must be held and the context current.
+  Status ReleaseCachedBlocks(int64_t max_cached_bytes) {
+    while (stats_.bytes_cached > max_cached_bytes) {
+      auto it = std::prev(cached_blocks_.end());
+      // cuMemFree waits for the work queued on the block
+      CU_RETURN_NOT_OK(cuEventDestroy(it->second.event));
+      CU_RETURN_NOT_OK(cuMemFree(reinterpret_cast<CUdeviceptr>(it->second.data)));
+      stats_.bytes_cached -= it->first;
+      cached_blocks_.erase(it);
+    }
+    return Status::OK();
+  }
+
+  std::mutex cache_mutex_;
+  int64_t max_cached_bytes_ = kDefaultMaxCachedBytes;
+  // Cached blocks by size class
+  std::multimap<int64_t, CachedBlock> cached_blocks_;
+  // The streams of the allocations in use which were made on a stream
+  std::unordered_map<uint8_t*, CUstream> block_streams_;
+  CudaMemoryStats stats_;
 };
 
 class CudaDeviceManager::CudaDeviceManagerImpl {
@@ -282,6 +445,49 @@ Status CudaDeviceManager::FreeHost(void* data, int64_t nbytes) {
 
 int CudaDeviceManager::num_devices() const { return impl_->num_devices(); }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+// Zero-size allocations all point to this area, like in the CPU pools
+alignas(64) static uint8_t zero_size_area[1];
+
+CudaHostMemoryPool::CudaHostMemoryPool(int device_number)
+    : device_number_(device_number), bytes_allocated_(0) {}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (size == 0) {
+    *out = zero_size_area;
+    return Status::OK();
+  }
+  CudaDeviceManager* manager;
+  RETURN_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  // Page-locked memory is page aligned, more than the pools guarantee
+  RETURN_NOT_OK(manager->impl_->AllocateHost(device_number_, size, out));
+  bytes_allocated_ += size;
+  return Status::OK();
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  uint8_t* previous = *ptr;
+  RETURN_NOT_OK(Allocate(new_size, ptr));
+  memcpy(*ptr, previous, static_cast<size_t>(std::min(old_size, new_size)));
+  Free(previous, old_size);
+  return Status::OK();
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (buffer == zero_size_area) {
+    return;
+  }
+  CudaDeviceManager* manager;
+  ARROW_CHECK_OK(CudaDeviceManager::GetInstance(&manager));
+  ARROW_CHECK_OK(manager->impl_->FreeHost(buffer, size));
+  bytes_allocated_ -= size;
+}
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return bytes_allocated_.load(); }
+
 // ----------------------------------------------------------------------
 // CudaContext public API
 
@@ -290,12 +496,25 @@ CudaContext::CudaContext() { impl_.reset(new CudaContextImpl()); }
 CudaContext::~CudaContext() {}
 
 Status CudaContext::Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+  return Allocate(nbytes, nullptr, out);
+}
+
+Status CudaContext::Allocate(int64_t nbytes, void* stream,
+                             std::shared_ptr<CudaBuffer>* out) {
   uint8_t* data = nullptr;
-  RETURN_NOT_OK(impl_->Allocate(nbytes, &data));
+  RETURN_NOT_OK(impl_->Allocate(nbytes, reinterpret_cast<CUstream>(stream), &data));
   *out = std::make_shared<CudaBuffer>(data, nbytes, this->shared_from_this(), true);
   return Status::OK();
 }
 
+Status CudaContext::SetMaxCachedBytes(int64_t max_cached_bytes) {
+  return impl_->SetMaxCachedBytes(max_cached_bytes);
+}
+
+Status CudaContext::ReleaseCachedMemory() { return impl_->ReleaseCachedMemory(); }
+
+CudaMemoryStats CudaContext::memory_stats() const { return impl_->memory_stats(); }
+
 Status CudaContext::View(uint8_t* data, int64_t nbytes,
                          std::shared_ptr<CudaBuffer>* out) {
   *out = std::make_shared<CudaBuffer>(data, nbytes, this->shared_from_this(), false);
@@ -325,6 +544,18 @@ Status CudaContext::CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>
   return impl_->CopyDeviceToAnotherDevice(dst_ctx, dst, src, nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                                          void* stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                                          void* stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream));
+}
+
 Status CudaContext::Synchronize(void) { return impl_->Synchronize(); }
 
 Status CudaContext::Close() { return impl_->Close(); }
@@ -374,5 +605,52 @@ Status CudaContext::GetDeviceAddress(uint8_t* addr, uint8_t** devaddr) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// CudaEvent
+
+CudaEvent::CudaEvent(const std::shared_ptr<CudaContext>& context, void* event)
+    : context_(context), event_(event) {}
+
+CudaEvent::~CudaEvent() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  if (cuEventDestroy(reinterpret_cast<CUevent>(event_)) != CUDA_SUCCESS) {
+    ARROW_LOG(WARNING) << "Failed to destroy CUDA event";
+  }
+}
+
+Status CudaEvent::Record(const std::shared_ptr<CudaContext>& context, void* stream,
+                         std::shared_ptr<CudaEvent>* out) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context->handle()));
+  CUevent event;
+  CU_RETURN_NOT_OK(cuEventCreate(&event, CU_EVENT_DISABLE_TIMING));
+  // Owned by the CudaEvent from now on, so that it is destroyed on error
+  out->reset(new CudaEvent(context, event));
+  CU_RETURN_NOT_OK(cuEventRecord(event, reinterpret_cast<CUstream>(stream)));
+  return Status::OK();
+}
+
+Status CudaEvent::Wait() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CU_RETURN_NOT_OK(cuEventSynchronize(reinterpret_cast<CUevent>(event_)));
+  return Status::OK();
+}
+
+Status CudaEvent::IsComplete(bool* out) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUresult result = cuEventQuery(reinterpret_cast<CUevent>(event_));
+  *out = result != CUDA_ERROR_NOT_READY;
+  if (*out) {
+    CU_RETURN_NOT_OK(result);
+  }
+  return Status::OK();
+}
+
+Status CudaEvent::StreamWait(void* stream) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CU_RETURN_NOT_OK(cuStreamWaitEvent(reinterpret_cast<CUstream>(stream),
+                                     reinterpret_cast<CUevent>(event_), 0));
+  return Status::OK();
+}
+
 }  // namespace cuda
 }  // namespace arrow
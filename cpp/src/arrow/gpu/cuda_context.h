@@ -18,9 +18,12 @@
 #ifndef ARROW_GPU_CUDA_CONTEXT_H
 #define ARROW_GPU_CUDA_CONTEXT_H
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <string>
 
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -67,10 +70,49 @@ class ARROW_EXPORT CudaDeviceManager {
   std::unique_ptr<CudaDeviceManagerImpl> impl_;
 
   friend CudaContext;
+  friend class CudaHostMemoryPool;
+};
+
+/// \class CudaHostMemoryPool
+/// \brief A MemoryPool of page-locked host memory with fast access to a GPU
+/// device, which can be copied to and from the device asynchronously
+///
+/// Page-locked allocations are expensive, wrap the pool in a
+/// RecyclingMemoryPool to reuse them.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  /// \brief Create a pool of host memory for a particular device
+  /// \param[in] device_number the CUDA device
+  explicit CudaHostMemoryPool(int device_number);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+  std::string backend_name() const override { return "cuda_host"; }
+
+ private:
+  int device_number_;
+  std::atomic<int64_t> bytes_allocated_;
 };
 
 struct ARROW_EXPORT CudaDeviceInfo {};
 
+/// \brief Statistics of the device memory allocations of a CudaContext
+struct ARROW_EXPORT CudaMemoryStats {
+  /// Bytes of the buffers in use
+  int64_t bytes_allocated = 0;
+  /// Bytes of the freed buffers kept for reuse
+  int64_t bytes_cached = 0;
+  /// Number of allocations
+  int64_t num_allocations = 0;
+  /// Number of allocations which reused the memory of a freed buffer
+  int64_t num_cache_hits = 0;
+  /// Number of allocations of new device memory
+  int64_t num_device_allocations = 0;
+};
+
 /// \class CudaContext
 /// \brief Friendlier interface to the CUDA driver API
 class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext> {
@@ -83,8 +125,39 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \param[in] nbytes number of bytes
   /// \param[out] out the allocated buffer
   /// \return Status
+  ///
+  /// The memory of freed buffers is kept for reuse, see SetMaxCachedBytes. The
+  /// buffer is considered used on the legacy default stream.
   Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
 
+  /// \brief Allocate CUDA memory on GPU device for this context, for use on a
+  /// CUDA stream
+  /// \param[in] nbytes number of bytes
+  /// \param[in] stream the CUstream the buffer is used on
+  /// \param[out] out the allocated buffer
+  /// \return Status
+  ///
+  /// Once the buffer is freed, its memory is reused right away by allocations
+  /// on the same stream, whose work is queued after the work on the buffer,
+  /// and by other allocations once that work has completed. The stream must
+  /// outlive the buffer.
+  Status Allocate(int64_t nbytes, void* stream, std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief Set the maximum number of bytes of freed device memory kept for
+  /// reuse, 256 MiB by default
+  ///
+  /// Allocations are rounded up to size classes, of which the freed memory is
+  /// reused by later allocations instead of being allocated anew with
+  /// cuMemAlloc, which is slow and synchronizing. Set to 0 to disable the
+  /// caching.
+  Status SetMaxCachedBytes(int64_t max_cached_bytes);
+
+  /// \brief Free the device memory kept for reuse
+  Status ReleaseCachedMemory();
+
+  /// \brief Return statistics of the device memory allocations
+  CudaMemoryStats memory_stats() const;
+
   /// \brief Create a view of CUDA memory on GPU device of this context
   /// \param[in] data the starting device address
   /// \param[in] nbytes number of bytes
@@ -149,6 +222,8 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
                                    const void* src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes, void* stream);
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes, void* stream);
 
   class CudaContextImpl;
   std::unique_ptr<CudaContextImpl> impl_;
@@ -162,6 +237,45 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \endcond
 };
 
+/// \class CudaEvent
+/// \brief A CUDA event, which completes once the work queued on a stream
+/// before it was recorded has completed
+class ARROW_EXPORT CudaEvent {
+ public:
+  ~CudaEvent();
+
+  /// \brief Record an event on a CUDA stream
+  /// \param[in] context the context of the stream
+  /// \param[in] stream the CUstream to record the event on, nullptr for the
+  /// legacy default stream
+  /// \param[out] out the recorded event
+  /// \return Status
+  static Status Record(const std::shared_ptr<CudaContext>& context, void* stream,
+                       std::shared_ptr<CudaEvent>* out);
+
+  /// \brief Block until the event has completed
+  Status Wait();
+
+  /// \brief Return whether the event has completed, without blocking
+  /// \param[out] out true if the event has completed
+  /// \return Status
+  Status IsComplete(bool* out);
+
+  /// \brief Make the work queued later on a CUDA stream wait for the event
+  /// \param[in] stream the CUstream which waits
+  /// \return Status
+  Status StreamWait(void* stream);
+
+  /// \brief Expose CUDA event handle to other libraries
+  void* handle() const { return event_; }
+
+ private:
+  CudaEvent(const std::shared_ptr<CudaContext>& context, void* event);
+
+  std::shared_ptr<CudaContext> context_;
+  void* event_;
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
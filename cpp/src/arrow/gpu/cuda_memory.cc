@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include <cuda.h>
 
@@ -160,6 +162,33 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, void* stream,
+                                   std::shared_ptr<CudaEvent>* event) const {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  RETURN_NOT_OK(context_->CopyDeviceToHostAsync(out, data_ + position, nbytes, stream));
+  if (event != nullptr) {
+    RETURN_NOT_OK(CudaEvent::Record(context_, stream, event));
+  }
+  return Status::OK();
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, void* stream,
+                                     std::shared_ptr<CudaEvent>* event) {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  RETURN_NOT_OK(
+      context_->CopyHostToDeviceAsync(mutable_data_ + position, data, nbytes, stream));
+  if (event != nullptr) {
+    RETURN_NOT_OK(CudaEvent::Record(context_, stream, event));
+  }
+  return Status::OK();
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -206,10 +235,55 @@ CudaBufferReader::CudaBufferReader(const std::shared_ptr<Buffer>& buffer)
 
 CudaBufferReader::~CudaBufferReader() {}
 
+Status CudaBufferReader::SetStream(void* stream, int64_t chunk_size) {
+  if (chunk_size <= 0) {
+    return Status::Invalid("Chunk size must be positive");
+  }
+  std::lock_guard<std::mutex> lock(chunk_mutex_);
+  for (auto& chunk_buffer : chunk_buffers_) {
+    RETURN_NOT_OK(
+        AllocateCudaHostBuffer(context_->device_number(), chunk_size, &chunk_buffer));
+  }
+  stream_ = stream;
+  chunk_size_ = chunk_size;
+  return Status::OK();
+}
+
+Status CudaBufferReader::PipelinedRead(int64_t position, int64_t nbytes, uint8_t* out) {
+  std::lock_guard<std::mutex> lock(chunk_mutex_);
+  const int64_t num_chunks = (nbytes + chunk_size_ - 1) / chunk_size_;
+  std::shared_ptr<CudaEvent> events[2];
+  auto CopyChunk = [&](int64_t chunk) {
+    const int64_t offset = chunk * chunk_size_;
+    return cuda_buffer_->CopyToHostAsync(
+        position + offset, std::min(chunk_size_, nbytes - offset),
+        chunk_buffers_[chunk % 2]->mutable_data(), stream_, &events[chunk % 2]);
+  };
+
+  // The next chunk is copied from the device into the buffer which the chunk
+  // before the current one was copied out of, while the current one is
+  // copied to the destination
+  RETURN_NOT_OK(CopyChunk(0));
+  for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    if (chunk + 1 < num_chunks) {
+      RETURN_NOT_OK(CopyChunk(chunk + 1));
+    }
+    RETURN_NOT_OK(events[chunk % 2]->Wait());
+    const int64_t offset = chunk * chunk_size_;
+    std::memcpy(out + offset, chunk_buffers_[chunk % 2]->data(),
+                static_cast<size_t>(std::min(chunk_size_, nbytes - offset)));
+  }
+  return Status::OK();
+}
+
 Result<int64_t> CudaBufferReader::DoReadAt(int64_t position, int64_t nbytes,
                                            void* buffer) {
   nbytes = std::min(nbytes, size_ - position);
-  RETURN_NOT_OK(context_->CopyDeviceToHost(buffer, data_ + position, nbytes));
+  if (chunk_size_ > 0 && nbytes > chunk_size_) {
+    RETURN_NOT_OK(PipelinedRead(position, nbytes, reinterpret_cast<uint8_t*>(buffer)));
+  } else {
+    RETURN_NOT_OK(context_->CopyDeviceToHost(buffer, data_ + position, nbytes));
+  }
   return nbytes;
 }
 
@@ -278,6 +352,10 @@ class CudaBufferWriter::CudaBufferWriterImpl {
   }
 
   Status FlushInternal() {
+    if (pipelined_) {
+      RETURN_NOT_OK(FlushAsync());
+      return WaitForCopies();
+    }
     if (buffer_size_ > 0 && buffer_position_ > 0) {
       // Only need to flush when the write has been buffered
       RETURN_NOT_OK(
@@ -301,6 +379,23 @@ class CudaBufferWriter::CudaBufferWriterImpl {
       return Status::OK();
     }
 
+    if (pipelined_) {
+      // Fill the host buffers in turn, queueing the copy of each one once full
+      auto bytes = reinterpret_cast<const uint8_t*>(data);
+      while (nbytes > 0) {
+        const int64_t chunk_size = std::min(nbytes, buffer_size_ - buffer_position_);
+        std::memcpy(host_buffer_data_ + buffer_position_, bytes, chunk_size);
+        buffer_position_ += chunk_size;
+        position_ += chunk_size;
+        bytes += chunk_size;
+        nbytes -= chunk_size;
+        if (buffer_position_ == buffer_size_) {
+          RETURN_NOT_OK(FlushAsync());
+        }
+      }
+      return Status::OK();
+    }
+
     if (buffer_size_ > 0) {
       if (nbytes + buffer_position_ >= buffer_size_) {
         // Reach end of buffer, write everything
@@ -329,17 +424,39 @@ class CudaBufferWriter::CudaBufferWriterImpl {
 
   Status SetBufferSize(const int64_t buffer_size) {
     CHECK_CLOSED();
-    if (buffer_position_ > 0) {
+    if (buffer_position_ > 0 || pipelined_) {
       // Flush any buffered data
       RETURN_NOT_OK(Flush());
     }
+    if (pipelined_ && buffer_size <= 0) {
+      return Status::Invalid("Writes on a CUDA stream must be buffered");
+    }
     RETURN_NOT_OK(AllocateCudaHostBuffer(context_.get()->device_number(), buffer_size,
                                          &host_buffer_));
     host_buffer_data_ = host_buffer_->mutable_data();
+    if (pipelined_) {
+      RETURN_NOT_OK(AllocateCudaHostBuffer(context_->device_number(), buffer_size,
+                                           &spare_host_buffer_));
+    }
     buffer_size_ = buffer_size;
     return Status::OK();
   }
 
+  Status SetStream(void* stream) {
+    CHECK_CLOSED();
+    if (buffer_size_ <= 0) {
+      return Status::Invalid("Writes on a CUDA stream must be buffered");
+    }
+    RETURN_NOT_OK(Flush());
+    if (spare_host_buffer_ == nullptr || spare_host_buffer_->size() != buffer_size_) {
+      RETURN_NOT_OK(AllocateCudaHostBuffer(context_->device_number(), buffer_size_,
+                                           &spare_host_buffer_));
+    }
+    stream_ = stream;
+    pipelined_ = true;
+    return Status::OK();
+  }
+
   int64_t buffer_size() const { return buffer_size_; }
 
   int64_t buffer_position() const { return buffer_position_; }
@@ -347,6 +464,36 @@ class CudaBufferWriter::CudaBufferWriterImpl {
 #undef CHECK_CLOSED
 
  private:
+  // Queue the copy of the buffered bytes on the stream, then switch to the
+  // spare host buffer once its own copy has completed
+  Status FlushAsync() {
+    if (buffer_position_ == 0) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(buffer_->CopyFromHostAsync(position_ - buffer_position_,
+                                             host_buffer_data_, buffer_position_,
+                                             stream_, &host_buffer_event_));
+    buffer_position_ = 0;
+    std::swap(host_buffer_, spare_host_buffer_);
+    std::swap(host_buffer_event_, spare_host_buffer_event_);
+    host_buffer_data_ = host_buffer_->mutable_data();
+    if (host_buffer_event_ != nullptr) {
+      RETURN_NOT_OK(host_buffer_event_->Wait());
+      host_buffer_event_.reset();
+    }
+    return Status::OK();
+  }
+
+  Status WaitForCopies() {
+    for (auto event : {&host_buffer_event_, &spare_host_buffer_event_}) {
+      if (*event != nullptr) {
+        RETURN_NOT_OK((*event)->Wait());
+        event->reset();
+      }
+    }
+    return Status::OK();
+  }
+
   std::shared_ptr<CudaContext> context_;
   std::shared_ptr<CudaBuffer> buffer_;
   std::mutex lock_;
@@ -360,6 +507,13 @@ class CudaBufferWriter::CudaBufferWriterImpl {
   int64_t buffer_position_;
   std::shared_ptr<CudaHostBuffer> host_buffer_;
   uint8_t* host_buffer_data_;
+
+  // Copies queued on a CUDA stream, see SetStream
+  bool pipelined_ = false;
+  void* stream_ = nullptr;
+  std::shared_ptr<CudaEvent> host_buffer_event_;
+  std::shared_ptr<CudaHostBuffer> spare_host_buffer_;
+  std::shared_ptr<CudaEvent> spare_host_buffer_event_;
 };
 
 CudaBufferWriter::CudaBufferWriter(const std::shared_ptr<CudaBuffer>& buffer) {
@@ -395,6 +549,8 @@ Status CudaBufferWriter::SetBufferSize(const int64_t buffer_size) {
   return impl_->SetBufferSize(buffer_size);
 }
 
+Status CudaBufferWriter::SetStream(void* stream) { return impl_->SetStream(stream); }
+
 int64_t CudaBufferWriter::buffer_size() const { return impl_->buffer_size(); }
 
 int64_t CudaBufferWriter::num_bytes_buffered() const { return impl_->buffer_position(); }
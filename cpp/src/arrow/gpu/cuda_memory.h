@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "arrow/buffer.h"
 #include "arrow/io/memory.h"
@@ -30,6 +31,7 @@ namespace arrow {
 namespace cuda {
 
 class CudaContext;
+class CudaEvent;
 class CudaIpcMemHandle;
 
 /// \class CudaBuffer
@@ -70,6 +72,37 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Queue a copy of memory from GPU device to CPU host on a CUDA stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the CUstream to queue the copy on, nullptr for the
+  /// legacy default stream
+  /// \param[out] event if not null, an event completing with the copy
+  /// \return Status
+  ///
+  /// The host memory must stay valid until the copy has completed. The copy
+  /// only overlaps with other work if the host memory is page-locked, as
+  /// allocated by AllocateCudaHostBuffer.
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         void* stream,
+                         std::shared_ptr<CudaEvent>* event = NULLPTR) const;
+
+  /// \brief Queue a copy of memory to device at position on a CUDA stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the CUstream to queue the copy on, nullptr for the
+  /// legacy default stream
+  /// \param[out] event if not null, an event completing with the copy
+  /// \return Status
+  ///
+  /// The host data must stay valid until the copy has completed. The copy
+  /// only overlaps with other work if the host memory is page-locked, as
+  /// allocated by AllocateCudaHostBuffer.
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           void* stream, std::shared_ptr<CudaEvent>* event = NULLPTR);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -161,7 +194,21 @@ class ARROW_EXPORT CudaBufferReader : public io::BufferReader {
   explicit CudaBufferReader(const std::shared_ptr<Buffer>& buffer);
   ~CudaBufferReader() override;
 
+  /// \brief Copy reads to host memory in chunks, through two page-locked
+  /// buffers in turn on a CUDA stream
+  /// \param[in] stream the CUstream to copy on, nullptr for the legacy
+  /// default stream
+  /// \param[in] chunk_size the size of the page-locked buffers
+  /// \return Status
+  ///
+  /// The copy of a chunk from the device then overlaps with the copy of the
+  /// previous chunk to the destination. By default reads are copied with a
+  /// single synchronous copy.
+  Status SetStream(void* stream, int64_t chunk_size = 1 << 22);
+
  private:
+  Status PipelinedRead(int64_t position, int64_t nbytes, uint8_t* out);
+
   // Read to host memory (copy)
   Result<int64_t> DoRead(int64_t nbytes, void* out) override;
   Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) override;
@@ -172,6 +219,12 @@ class ARROW_EXPORT CudaBufferReader : public io::BufferReader {
 
   std::shared_ptr<CudaBuffer> cuda_buffer_;
   std::shared_ptr<CudaContext> context_;
+
+  // Pipelined reads to host memory, see SetStream
+  void* stream_ = NULLPTR;
+  int64_t chunk_size_ = 0;
+  std::shared_ptr<CudaHostBuffer> chunk_buffers_[2];
+  std::mutex chunk_mutex_;
 };
 
 /// \class CudaBufferWriter
@@ -204,6 +257,17 @@ class ARROW_EXPORT CudaBufferWriter : public io::WritableFile {
   /// By default writes are unbuffered
   Status SetBufferSize(const int64_t buffer_size);
 
+  /// \brief Queue the copies of the buffered bytes on a CUDA stream
+  /// \param[in] stream the CUstream to copy on, nullptr for the legacy
+  /// default stream
+  /// \return Status
+  ///
+  /// The writer then fills two host buffers of buffer_size() in turn, so that
+  /// the writes to one overlap with the copy of the other, and writes larger
+  /// than the buffer are chunked through them. Flush and Close wait for the
+  /// copies to complete. Requires a buffer, see SetBufferSize.
+  Status SetStream(void* stream);
+
   /// \brief Returns size of host (CPU) buffer, 0 for unbuffered
   int64_t buffer_size() const;
 
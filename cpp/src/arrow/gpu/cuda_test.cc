@@ -18,9 +18,12 @@
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include "arrow/io/buffered.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/test_common.h"
@@ -82,6 +85,36 @@ TEST_F(TestCudaBuffer, CopyFromHost) {
   AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, default_memory_pool(), &host_buffer));
+  std::shared_ptr<CudaHostBuffer> pinned_buffer;
+  ASSERT_OK(AllocateCudaHostBuffer(kGpuNumber, kSize, &pinned_buffer));
+  std::memcpy(pinned_buffer->mutable_data(), host_buffer->data(), kSize);
+
+  std::shared_ptr<CudaEvent> event;
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, pinned_buffer->data(), kSize, nullptr,
+                                             &event));
+  ASSERT_OK(event->Wait());
+  bool complete = false;
+  ASSERT_OK(event->IsComplete(&complete));
+  ASSERT_TRUE(complete);
+  AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
+
+  std::memset(pinned_buffer->mutable_data(), 0, kSize);
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, pinned_buffer->mutable_data(),
+                                           nullptr, &event));
+  ASSERT_OK(event->Wait());
+  ASSERT_EQ(0, std::memcmp(pinned_buffer->data(), host_buffer->data(), kSize));
+
+  ASSERT_RAISES(Invalid, device_buffer->CopyToHostAsync(
+                             500, kSize, pinned_buffer->mutable_data(), nullptr));
+}
+
 TEST_F(TestCudaBuffer, FromBuffer) {
   const int64_t kSize = 1000;
   // Initialize device buffer with random data
@@ -218,6 +251,18 @@ TEST_F(TestCudaBufferWriter, BufferedWrites) {
   TestWrites(kTotalSize, 1000, 1 << 12);
 }
 
+TEST_F(TestCudaBufferWriter, StreamWrites) {
+  const int64_t kTotalSize = 1 << 16;
+  Allocate(kTotalSize);
+  ASSERT_RAISES(Invalid, writer_->SetStream(nullptr));
+  ASSERT_OK(writer_->SetBufferSize(1 << 12));
+  ASSERT_OK(writer_->SetStream(nullptr));
+  TestWrites(kTotalSize, 1000);
+  // Writes larger than the buffers
+  ASSERT_OK(writer_->Seek(0));
+  TestWrites(kTotalSize, 10000);
+}
+
 TEST_F(TestCudaBufferWriter, EdgeCases) {
   Allocate(1000);
 
@@ -314,6 +359,29 @@ TEST_F(TestCudaBufferReader, Basics) {
   ASSERT_EQ(0, std::memcmp(stack_buffer, host_data + 980, tmp->size()));
 }
 
+TEST_F(TestCudaBufferReader, StreamReads) {
+  const int64_t kSize = 10000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, default_memory_pool(), &buffer));
+  const uint8_t* host_data = buffer->data();
+  ASSERT_OK(device_buffer->CopyFromHost(0, host_data, kSize));
+
+  CudaBufferReader reader(device_buffer);
+  ASSERT_OK(reader.SetStream(nullptr, 1000));
+
+  std::vector<uint8_t> out(kSize);
+  // Reads of whole and partial chunks
+  for (int64_t nbytes : {500, 1000, 3500, 4000}) {
+    ASSERT_OK_AND_EQ(nbytes, reader.ReadAt(123, nbytes, out.data()));
+    ASSERT_EQ(0, std::memcmp(out.data(), host_data + 123, nbytes));
+  }
+  ASSERT_OK_AND_EQ(kSize, reader.Read(kSize + 1, out.data()));
+  ASSERT_EQ(0, std::memcmp(out.data(), host_data, kSize));
+}
+
 class TestCudaArrowIpc : public TestCudaBufferBase {
  public:
   void SetUp() {
@@ -351,6 +419,72 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+// Copy the buffers of a batch of flat arrays read into device memory back to
+// the host
+static void CopyBatchToHost(const RecordBatch& device_batch,
+                            std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < device_batch.num_columns(); ++i) {
+    auto data = device_batch.column_data(i)->Copy();
+    for (auto& buffer : data->buffers) {
+      if (buffer == nullptr) {
+        continue;
+      }
+      std::shared_ptr<CudaBuffer> device_buffer;
+      ASSERT_OK(CudaBuffer::FromBuffer(buffer, &device_buffer));
+      std::shared_ptr<Buffer> host_buffer;
+      ASSERT_OK(AllocateBuffer(buffer->size(), &host_buffer));
+      ASSERT_OK(
+          device_buffer->CopyToHost(0, buffer->size(), host_buffer->mutable_data()));
+      buffer = host_buffer;
+    }
+    columns.push_back(MakeArray(data));
+  }
+  *out = RecordBatch::Make(device_batch.schema(), device_batch.num_rows(), columns);
+}
+
+TEST_F(TestCudaArrowIpc, StreamReader) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+  const int kNumBatches = 5;
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(1024, pool_));
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ASSERT_OK(ipc::RecordBatchStreamWriter::Open(sink.get(), batch->schema(), &writer));
+  for (int i = 0; i < kNumBatches; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Both zero-copy bodies in pageable memory, and bodies read into
+  // page-locked memory
+  auto zero_copy = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto buffered,
+                       io::BufferedInputStream::Create(
+                           1024, pool_, std::make_shared<io::BufferReader>(buffer)));
+  std::vector<std::shared_ptr<io::InputStream>> streams = {zero_copy, buffered};
+  for (const auto& stream : streams) {
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(CudaRecordBatchStreamReader::Open(stream.get(), context_, &reader));
+    AssertSchemaEqual(*batch->schema(), *reader->schema());
+
+    int num_batches = 0;
+    while (true) {
+      std::shared_ptr<RecordBatch> device_batch;
+      ASSERT_OK(reader->ReadNext(&device_batch));
+      if (device_batch == nullptr) {
+        break;
+      }
+      std::shared_ptr<RecordBatch> host_batch;
+      CopyBatchToHost(*device_batch, &host_batch);
+      CompareBatch(*batch, *host_batch);
+      ++num_batches;
+    }
+    ASSERT_EQ(num_batches, kNumBatches);
+  }
+}
+
 class TestCudaContext : public TestCudaBufferBase {
  public:
   void SetUp() { TestCudaBufferBase::SetUp(); }
@@ -365,5 +499,147 @@ TEST_F(TestCudaContext, GetDeviceAddress) {
   ASSERT_EQ(buffer.get()->mutable_data(), devptr);
 }
 
+TEST_F(TestCudaContext, CachingAllocator) {
+  ASSERT_OK(context_->ReleaseCachedMemory());
+  auto stats = context_->memory_stats();
+
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(context_->Allocate(1000, &buffer));
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+  ASSERT_EQ(context_->memory_stats().bytes_cached, stats.bytes_cached + 1024);
+
+  // An allocation of the same size class reuses the freed memory
+  ASSERT_OK(context_->Allocate(900, &buffer));
+  ASSERT_EQ(buffer->data(), data);
+  ASSERT_EQ(buffer->size(), 900);
+  auto new_stats = context_->memory_stats();
+  ASSERT_EQ(new_stats.num_allocations, stats.num_allocations + 2);
+  ASSERT_EQ(new_stats.num_cache_hits, stats.num_cache_hits + 1);
+  ASSERT_EQ(new_stats.num_device_allocations, stats.num_device_allocations + 1);
+  ASSERT_EQ(new_stats.bytes_cached, stats.bytes_cached);
+  buffer.reset();
+
+  // Without caching, freed memory is given back to the device
+  ASSERT_OK(context_->SetMaxCachedBytes(0));
+  ASSERT_EQ(context_->memory_stats().bytes_cached, 0);
+  ASSERT_OK(context_->Allocate(1000, &buffer));
+  buffer.reset();
+  new_stats = context_->memory_stats();
+  ASSERT_EQ(new_stats.bytes_cached, 0);
+  ASSERT_EQ(new_stats.num_device_allocations, stats.num_device_allocations + 2);
+}
+
+class TestCudaCompute : public TestCudaBufferBase {
+ public:
+  void SetUp() {
+    TestCudaBufferBase::SetUp();
+    auto schema = ::arrow::schema(
+        {field("i", int32()), field("b", boolean()), field("d", float64())});
+    host_batch_ = RecordBatch::Make(
+        schema, 5,
+        {ArrayFromJSON(int32(), "[1, null, 3, 4, 5]"),
+         ArrayFromJSON(boolean(), "[true, false, null, true, false]"),
+         ArrayFromJSON(float64(), "[0.5, 1.5, 2.5, 3.5, 4.5]")});
+    ToDevice(*host_batch_, &device_batch_);
+  }
+
+  void ToDevice(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<CudaBuffer> serialized;
+    ASSERT_OK(SerializeRecordBatch(batch, context_.get(), &serialized));
+    ASSERT_OK(ReadRecordBatch(batch.schema(), serialized, default_memory_pool(), out));
+  }
+
+  void ToDevice(const std::shared_ptr<Array>& array, std::shared_ptr<Array>* out) {
+    auto batch = RecordBatch::Make(::arrow::schema({field("", array->type())}),
+                                   array->length(), {array});
+    std::shared_ptr<RecordBatch> device_batch;
+    ToDevice(*batch, &device_batch);
+    *out = device_batch->column(0);
+  }
+
+  void AssertRowsEqual(const std::vector<int>& rows, const RecordBatch& device_batch) {
+    std::shared_ptr<RecordBatch> actual;
+    CopyBatchToHost(device_batch, &actual);
+    ASSERT_EQ(static_cast<int64_t>(rows.size()), actual->num_rows());
+    for (int i = 0; i < actual->num_columns(); ++i) {
+      for (size_t j = 0; j < rows.size(); ++j) {
+        AssertArraysEqual(*host_batch_->column(i)->Slice(rows[j], 1),
+                          *actual->column(i)->Slice(j, 1));
+      }
+    }
+  }
+
+ protected:
+  std::shared_ptr<RecordBatch> host_batch_;
+  std::shared_ptr<RecordBatch> device_batch_;
+};
+
+TEST_F(TestCudaCompute, Filter) {
+  std::shared_ptr<Array> mask;
+  ToDevice(ArrayFromJSON(boolean(), "[true, false, null, true, true]"), &mask);
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(Filter(context_, *device_batch_, *mask, nullptr, &out));
+  AssertRowsEqual({0, 3, 4}, *out);
+
+  ToDevice(ArrayFromJSON(boolean(), "[false, false, false, false, false]"), &mask);
+  ASSERT_OK(Filter(context_, *device_batch_, *mask, nullptr, &out));
+  AssertRowsEqual({}, *out);
+
+  ToDevice(ArrayFromJSON(boolean(), "[true]"), &mask);
+  ASSERT_RAISES(Invalid, Filter(context_, *device_batch_, *mask, nullptr, &out));
+}
+
+TEST_F(TestCudaCompute, Take) {
+  std::shared_ptr<Array> indices;
+  ToDevice(ArrayFromJSON(int32(), "[4, 0, 0, 2, 1]"), &indices);
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(Take(context_, *device_batch_, *indices, nullptr, &out));
+  AssertRowsEqual({4, 0, 0, 2, 1}, *out);
+  ASSERT_EQ(1, out->column(0)->null_count());
+  ASSERT_EQ(1, out->column(1)->null_count());
+
+  ToDevice(ArrayFromJSON(int64(), "[3]"), &indices);
+  ASSERT_OK(Take(context_, *device_batch_, *indices, nullptr, &out));
+  AssertRowsEqual({3}, *out);
+  ASSERT_EQ(0, out->column(0)->null_count());
+
+  ToDevice(ArrayFromJSON(int64(), "[1, 5]"), &indices);
+  ASSERT_RAISES(IndexError, Take(context_, *device_batch_, *indices, nullptr, &out));
+  ToDevice(ArrayFromJSON(int64(), "[-1]"), &indices);
+  ASSERT_RAISES(IndexError, Take(context_, *device_batch_, *indices, nullptr, &out));
+  ToDevice(ArrayFromJSON(float64(), "[1]"), &indices);
+  ASSERT_RAISES(TypeError, Take(context_, *device_batch_, *indices, nullptr, &out));
+}
+
+TEST_F(TestCudaCompute, Compare) {
+  auto CompareToHost = [&](const Array& values, const Scalar& value,
+                           compute::CompareOperator op) {
+    std::shared_ptr<Array> out;
+    ARROW_EXPECT_OK(Compare(context_, values, value, op, nullptr, &out));
+    std::shared_ptr<RecordBatch> host_batch;
+    CopyBatchToHost(*RecordBatch::Make(::arrow::schema({field("", boolean())}),
+                                       out->length(), {out}),
+                    &host_batch);
+    return host_batch->column(0);
+  };
+
+  const Array& ints = *device_batch_->column(0);
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, null, true, true, true]"),
+                    *CompareToHost(ints, Int32Scalar(2), compute::GREATER));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, null, true, false, false]"),
+                    *CompareToHost(ints, Int32Scalar(3), compute::EQUAL));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, false, false, false]"),
+                    *CompareToHost(*device_batch_->column(2), DoubleScalar(1.0),
+                                   compute::LESS_EQUAL));
+
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(TypeError, Compare(context_, ints, Int64Scalar(2), compute::LESS,
+                                   nullptr, &out));
+  ASSERT_RAISES(NotImplemented, Compare(context_, *device_batch_->column(1),
+                                        BooleanScalar(true), compute::EQUAL, nullptr,
+                                        &out));
+}
+
 }  // namespace cuda
 }  // namespace arrow
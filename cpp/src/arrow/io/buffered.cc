@@ -156,6 +156,24 @@ class BufferedOutputStream::Impl : public BufferedBase {
     return Status::OK();
   }
 
+  // Buffer the data if it all fits, otherwise pass it on in a single call
+  Status WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t nbytes = 0;
+    for (const auto& buffer : data) {
+      nbytes += buffer->size();
+    }
+    if (nbytes + buffer_pos_ < buffer_size_) {
+      for (const auto& buffer : data) {
+        AppendToBuffer(buffer->data(), buffer->size());
+      }
+      return Status::OK();
+    }
+    RETURN_NOT_OK(FlushUnlocked());
+    raw_pos_ = -1;
+    return raw_->WriteVectored(data);
+  }
+
   Status FlushUnlocked() {
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
@@ -249,6 +267,11 @@ Status BufferedOutputStream::Write(const std::shared_ptr<Buffer>& data) {
   return impl_->Write(data);
 }
 
+Status BufferedOutputStream::WriteVectored(
+    const std::vector<std::shared_ptr<Buffer>>& data) {
+  return impl_->WriteVectored(data);
+}
+
 Status BufferedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
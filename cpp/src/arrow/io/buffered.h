@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -85,6 +86,7 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
   Status Write(const std::shared_ptr<Buffer>& data) override;
+  Status WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data) override;
 
   Status Flush() override;
 
@@ -34,6 +34,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
@@ -223,6 +224,26 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
+TEST_F(TestBufferedOutputStream, WriteVectored) {
+  OpenBuffered(100);
+
+  const std::string data = GenerateRandomData(1000);
+  auto slice = [&](size_t pos, size_t nbytes) {
+    return Buffer::FromString(data.substr(pos, nbytes));
+  };
+
+  // Buffered while it fits, then flushed and written through
+  ASSERT_OK(buffered_->WriteVectored({slice(0, 10), slice(10, 20)}));
+  ASSERT_EQ(30, buffered_->bytes_buffered());
+  ASSERT_OK(buffered_->WriteVectored({slice(30, 50), slice(80, 900)}));
+  ASSERT_EQ(0, buffered_->bytes_buffered());
+  ASSERT_OK(buffered_->WriteVectored({slice(980, 20)}));
+  ASSERT_OK_AND_EQ(1000, buffered_->Tell());
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
 TEST_F(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
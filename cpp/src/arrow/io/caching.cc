@@ -0,0 +1,520 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+
+namespace io {
+
+CacheOptions CacheOptions::Defaults() {
+  return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
+                      internal::ReadRangeCache::kDefaultRangeSizeLimit};
+}
+
+// ----------------------------------------------------------------------
+// BlockCache implementation
+
+constexpr int64_t BlockCache::kDefaultBlockSize;
+constexpr int64_t BlockCache::kDefaultMemoryCapacity;
+
+BlockCacheOptions BlockCacheOptions::Defaults() {
+  return BlockCacheOptions{BlockCache::kDefaultBlockSize,
+                           BlockCache::kDefaultMemoryCapacity, "", 0};
+}
+
+struct BlockCache::Impl {
+  struct Entry {
+    std::string key;
+    int64_t block_index;
+    // Set for blocks held in memory
+    std::shared_ptr<Buffer> block;
+    // Set for blocks kept on disk
+    std::string path;
+    int64_t size;
+  };
+  // Most recently used first
+  using LruList = std::list<Entry>;
+
+  struct BlockKeyHash {
+    size_t operator()(const std::pair<std::string, int64_t>& key) const {
+      return std::hash<std::string>()(key.first) * 31 +
+             std::hash<int64_t>()(key.second);
+    }
+  };
+  using EntryMap = std::unordered_map<std::pair<std::string, int64_t>,
+                                      LruList::iterator, BlockKeyHash>;
+
+  explicit Impl(const BlockCacheOptions& options) : options(options) {}
+
+  ~Impl() {
+    for (const auto& entry : disk_lru) {
+      Status st = DeleteBlockFile(entry.path);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "When deleting cached block: " << st;
+      }
+    }
+  }
+
+  static Status DeleteBlockFile(const std::string& path) {
+    ARROW_ASSIGN_OR_RAISE(auto filename, PlatformFilename::FromString(path));
+    return ::arrow::internal::DeleteFile(filename).status();
+  }
+
+  Result<std::shared_ptr<Buffer>> Get(const std::string& key, int64_t block_index) {
+    const auto map_key = std::make_pair(key, block_index);
+    auto it = memory_map.find(map_key);
+    if (it != memory_map.end()) {
+      memory_lru.splice(memory_lru.begin(), memory_lru, it->second);
+      ++hits;
+      return it->second->block;
+    }
+    it = disk_map.find(map_key);
+    if (it == disk_map.end()) {
+      ++misses;
+      return nullptr;
+    }
+    // Move the block back from disk to memory
+    Entry entry = std::move(*it->second);
+    disk_lru.erase(it->second);
+    disk_map.erase(it);
+    disk_usage -= entry.size;
+    ARROW_ASSIGN_OR_RAISE(auto file, ReadableFile::Open(entry.path));
+    ARROW_ASSIGN_OR_RAISE(auto block, file->Read(entry.size));
+    RETURN_NOT_OK(file->Close());
+    RETURN_NOT_OK(DeleteBlockFile(entry.path));
+    if (block->size() != entry.size) {
+      return Status::IOError("Cached block file '", entry.path, "' was truncated");
+    }
+    ++hits;
+    RETURN_NOT_OK(Put(key, block_index, block));
+    return block;
+  }
+
+  Status Put(const std::string& key, int64_t block_index, std::shared_ptr<Buffer> block) {
+    auto map_key = std::make_pair(key, block_index);
+    if (memory_map.count(map_key) > 0) {
+      // Concurrently read by another file
+      return Status::OK();
+    }
+    const int64_t size = block->size();
+    memory_lru.push_front(Entry{key, block_index, std::move(block), "", size});
+    memory_map[std::move(map_key)] = memory_lru.begin();
+    memory_usage += size;
+    while (memory_usage > options.memory_capacity) {
+      RETURN_NOT_OK(EvictFromMemory());
+    }
+    return Status::OK();
+  }
+
+  Status EvictFromMemory() {
+    Entry entry = std::move(memory_lru.back());
+    memory_lru.pop_back();
+    auto map_key = std::make_pair(entry.key, entry.block_index);
+    memory_map.erase(map_key);
+    memory_usage -= entry.size;
+    if (options.disk_directory.empty() || entry.size > options.disk_capacity) {
+      return Status::OK();
+    }
+    // Spill the block to disk
+    while (disk_usage + entry.size > options.disk_capacity) {
+      const Entry& victim = disk_lru.back();
+      disk_usage -= victim.size;
+      disk_map.erase(std::make_pair(victim.key, victim.block_index));
+      RETURN_NOT_OK(DeleteBlockFile(victim.path));
+      disk_lru.pop_back();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto directory,
+                          PlatformFilename::FromString(options.disk_directory));
+    const auto file_name = "arrow-block-" + std::to_string(next_file_id++);
+    ARROW_ASSIGN_OR_RAISE(auto filename, directory.Join(file_name));
+    entry.path = filename.ToString();
+    ARROW_ASSIGN_OR_RAISE(auto file, FileOutputStream::Open(entry.path));
+    RETURN_NOT_OK(file->Write(entry.block->data(), entry.size));
+    RETURN_NOT_OK(file->Close());
+    entry.block.reset();
+    disk_lru.push_front(std::move(entry));
+    disk_map[std::move(map_key)] = disk_lru.begin();
+    disk_usage += disk_lru.front().size;
+    return Status::OK();
+  }
+
+  const BlockCacheOptions options;
+  // Protects all members below
+  std::mutex mutex;
+  LruList memory_lru;
+  LruList disk_lru;
+  EntryMap memory_map;
+  EntryMap disk_map;
+  int64_t memory_usage = 0;
+  int64_t disk_usage = 0;
+  int64_t hits = 0;
+  int64_t misses = 0;
+  int64_t next_file_id = 0;
+  int64_t next_anonymous_key = 0;
+};
+
+BlockCache::BlockCache(const BlockCacheOptions& options) : impl_(new Impl(options)) {}
+
+BlockCache::~BlockCache() {}
+
+Result<std::shared_ptr<BlockCache>> BlockCache::Make(const BlockCacheOptions& options) {
+  if (options.block_size <= 0) {
+    return Status::Invalid("Block size must be strictly positive");
+  }
+  if (options.memory_capacity < 0 || options.disk_capacity < 0) {
+    return Status::Invalid("Block cache capacities must be positive");
+  }
+  return std::shared_ptr<BlockCache>(new BlockCache(options));
+}
+
+const BlockCacheOptions& BlockCache::options() const { return impl_->options; }
+
+int64_t BlockCache::memory_usage() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->memory_usage;
+}
+
+int64_t BlockCache::disk_usage() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->disk_usage;
+}
+
+int64_t BlockCache::hits() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->hits;
+}
+
+int64_t BlockCache::misses() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->misses;
+}
+
+std::string BlockCache::NewAnonymousKey() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  // Cannot collide with user keys, which don't start with a NUL character
+  return std::string(1, '\0') + std::to_string(impl_->next_anonymous_key++);
+}
+
+Result<std::shared_ptr<Buffer>> BlockCache::Get(const std::string& key,
+                                                int64_t block_index) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->Get(key, block_index);
+}
+
+Status BlockCache::Put(const std::string& key, int64_t block_index,
+                       std::shared_ptr<Buffer> block) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->Put(key, block_index, std::move(block));
+}
+
+// ----------------------------------------------------------------------
+// CachedRandomAccessFile implementation
+
+CachedRandomAccessFile::CachedRandomAccessFile(std::shared_ptr<RandomAccessFile> raw,
+                                               std::shared_ptr<BlockCache> cache,
+                                               std::string cache_key, int64_t size)
+    : raw_(std::move(raw)),
+      cache_(std::move(cache)),
+      cache_key_(std::move(cache_key)),
+      size_(size) {}
+
+CachedRandomAccessFile::~CachedRandomAccessFile() {}
+
+Result<std::shared_ptr<CachedRandomAccessFile>> CachedRandomAccessFile::Make(
+    std::shared_ptr<RandomAccessFile> raw, std::shared_ptr<BlockCache> cache,
+    std::string cache_key) {
+  ARROW_ASSIGN_OR_RAISE(int64_t size, raw->GetSize());
+  if (cache_key.empty()) {
+    cache_key = cache->NewAnonymousKey();
+  }
+  return std::shared_ptr<CachedRandomAccessFile>(new CachedRandomAccessFile(
+      std::move(raw), std::move(cache), std::move(cache_key), size));
+}
+
+std::shared_ptr<RandomAccessFile> CachedRandomAccessFile::raw() const { return raw_; }
+
+bool CachedRandomAccessFile::closed() const { return closed_; }
+
+Status CachedRandomAccessFile::DoClose() {
+  closed_ = true;
+  return raw_->Close();
+}
+
+Status CachedRandomAccessFile::DoAbort() {
+  closed_ = true;
+  return raw_->Abort();
+}
+
+Result<int64_t> CachedRandomAccessFile::DoTell() const {
+  if (closed_) {
+    return Status::Invalid("Operation on closed file");
+  }
+  return position_;
+}
+
+Status CachedRandomAccessFile::DoSeek(int64_t position) {
+  if (closed_) {
+    return Status::Invalid("Operation on closed file");
+  }
+  if (position < 0 || position > size_) {
+    return Status::IOError("Cannot seek to position ", position, " in file of size ",
+                           size_);
+  }
+  position_ = position;
+  return Status::OK();
+}
+
+Result<int64_t> CachedRandomAccessFile::DoGetSize() {
+  if (closed_) {
+    return Status::Invalid("Operation on closed file");
+  }
+  return size_;
+}
+
+Result<int64_t> CachedRandomAccessFile::DoRead(int64_t nbytes, void* out) {
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+  position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> CachedRandomAccessFile::DoRead(int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+  position_ += buffer->size();
+  return buffer;
+}
+
+Result<std::vector<std::shared_ptr<Buffer>>> CachedRandomAccessFile::GetBlocks(
+    int64_t position, int64_t nbytes) {
+  const int64_t block_size = cache_->options().block_size;
+  const int64_t first_block = position / block_size;
+  const int64_t end_block = (position + nbytes + block_size - 1) / block_size;
+
+  std::vector<std::shared_ptr<Buffer>> blocks(end_block - first_block);
+  for (int64_t i = first_block; i < end_block; ++i) {
+    ARROW_ASSIGN_OR_RAISE(blocks[i - first_block], cache_->Get(cache_key_, i));
+  }
+  // Read runs of missing blocks from the raw file
+  int64_t i = first_block;
+  while (i < end_block) {
+    if (blocks[i - first_block] != nullptr) {
+      ++i;
+      continue;
+    }
+    int64_t run_end = i + 1;
+    while (run_end < end_block && blocks[run_end - first_block] == nullptr) {
+      ++run_end;
+    }
+    const int64_t run_offset = i * block_size;
+    const int64_t run_length = std::min(run_end * block_size, size_) - run_offset;
+    ARROW_ASSIGN_OR_RAISE(auto run, raw_->ReadAt(run_offset, run_length));
+    if (run->size() != run_length) {
+      return Status::IOError("Expected to read ", run_length, " bytes at offset ",
+                             run_offset, ", got ", run->size());
+    }
+    for (; i < run_end; ++i) {
+      const int64_t offset = i * block_size - run_offset;
+      auto block = SliceBuffer(run, offset, std::min(block_size, run_length - offset));
+      RETURN_NOT_OK(cache_->Put(cache_key_, i, block));
+      blocks[i - first_block] = std::move(block);
+    }
+  }
+  return blocks;
+}
+
+Result<std::shared_ptr<Buffer>> CachedRandomAccessFile::DoReadAt(int64_t position,
+                                                                 int64_t nbytes) {
+  if (closed_) {
+    return Status::Invalid("Operation on closed file");
+  }
+  if (position < 0 || position > size_) {
+    return Status::IOError("Cannot read at position ", position, " in file of size ",
+                           size_);
+  }
+  nbytes = std::min(nbytes, size_ - position);
+  if (nbytes == 0) {
+    return std::make_shared<Buffer>(nullptr, 0);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto blocks, GetBlocks(position, nbytes));
+  const int64_t block_size = cache_->options().block_size;
+  const int64_t offset_in_block = position % block_size;
+  if (blocks.size() == 1) {
+    return SliceBuffer(blocks[0], offset_in_block, nbytes);
+  }
+  std::shared_ptr<Buffer> out;
+  RETURN_NOT_OK(AllocateBuffer(nbytes, &out));
+  int64_t copied = 0;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    const int64_t start = i == 0 ? offset_in_block : 0;
+    const int64_t length = std::min(blocks[i]->size() - start, nbytes - copied);
+    memcpy(out->mutable_data() + copied, blocks[i]->data() + start, length);
+    copied += length;
+  }
+  DCHECK_EQ(copied, nbytes);
+  return out;
+}
+
+Result<int64_t> CachedRandomAccessFile::DoReadAt(int64_t position, int64_t nbytes,
+                                                 void* out) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position, nbytes));
+  memcpy(out, buffer->data(), buffer->size());
+  return buffer->size();
+}
+
+namespace internal {
+
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  DCHECK_GT(range_size_limit, hole_size_limit);
+
+  // Remove zero-sized ranges
+  auto end = std::remove_if(ranges.begin(), ranges.end(),
+                            [](const ReadRange& range) { return range.length == 0; });
+  ranges.resize(end - ranges.begin());
+  if (ranges.empty()) {
+    return ranges;
+  }
+
+  // Sort in position order
+  std::sort(ranges.begin(), ranges.end(),
+            [](const ReadRange& a, const ReadRange& b) { return a.offset < b.offset; });
+
+  std::vector<ReadRange> coalesced;
+  auto it = ranges.begin();
+  int64_t coalesced_start = it->offset;
+  int64_t prev_range_end = it->offset + it->length;
+
+  for (++it; it != ranges.end(); ++it) {
+    const int64_t current_range_start = it->offset;
+    const int64_t current_range_end = current_range_start + it->length;
+    // We don't expect to have overlapping ranges
+    DCHECK_LE(prev_range_end, current_range_start);
+
+    const int64_t distance = current_range_start - prev_range_end;
+    const int64_t coalesced_length = current_range_end - coalesced_start;
+    if (distance > hole_size_limit || coalesced_length > range_size_limit) {
+      // Close the current coalesced range and start a new one
+      coalesced.push_back({coalesced_start, prev_range_end - coalesced_start});
+      coalesced_start = current_range_start;
+    }
+    prev_range_end = current_range_end;
+  }
+  coalesced.push_back({coalesced_start, prev_range_end - coalesced_start});
+
+  return coalesced;
+}
+
+struct RangeCacheEntry {
+  ReadRange range;
+  std::shared_future<Result<std::shared_ptr<Buffer>>> future;
+
+  friend bool operator<(const RangeCacheEntry& left, const RangeCacheEntry& right) {
+    return left.range.offset < right.range.offset;
+  }
+};
+
+struct ReadRangeCache::Impl {
+  std::shared_ptr<RandomAccessFile> file;
+  CacheOptions options;
+
+  // Ordered by offset (so as to find a matching region by binary search)
+  std::vector<RangeCacheEntry> entries;
+
+  // Issue the coalesced reads in the background
+  std::vector<RangeCacheEntry> MakeCacheEntries(const std::vector<ReadRange>& ranges) {
+    std::vector<RangeCacheEntry> new_entries;
+    new_entries.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      new_entries.push_back({range, file->ReadAsync(range.offset, range.length).share()});
+    }
+    return new_entries;
+  }
+};
+
+ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file,
+                               CacheOptions options)
+    : impl_(new Impl()) {
+  impl_->file = std::move(file);
+  impl_->options = options;
+}
+
+ReadRangeCache::~ReadRangeCache() {
+  // Wait for pending reads, as they may reference the file
+  for (auto& entry : impl_->entries) {
+    entry.future.wait();
+  }
+}
+
+Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
+  ranges = CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
+                              impl_->options.range_size_limit);
+  std::vector<RangeCacheEntry> new_entries = impl_->MakeCacheEntries(ranges);
+  // Add new entries, themselves ordered by offset
+  if (impl_->entries.size() > 0) {
+    std::vector<RangeCacheEntry> merged(impl_->entries.size() + new_entries.size());
+    std::merge(impl_->entries.begin(), impl_->entries.end(), new_entries.begin(),
+               new_entries.end(), merged.begin());
+    impl_->entries = std::move(merged);
+  } else {
+    impl_->entries = std::move(new_entries);
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
+  if (range.length == 0) {
+    static const uint8_t byte = 0;
+    return std::make_shared<Buffer>(&byte, 0);
+  }
+
+  const auto it = std::lower_bound(
+      impl_->entries.begin(), impl_->entries.end(), range,
+      [](const RangeCacheEntry& entry, const ReadRange& range) {
+        return entry.range.offset + entry.range.length < range.offset + range.length;
+      });
+  if (it != impl_->entries.end() && it->range.Contains(range)) {
+    ARROW_ASSIGN_OR_RAISE(auto buf, it->future.get());
+    const int64_t slice_offset = range.offset - it->range.offset;
+    if (slice_offset + range.length > buf->size()) {
+      return Status::IOError("Expected to be able to read ", range.length,
+                             " bytes at offset ", range.offset, ", got ",
+                             std::max<int64_t>(buf->size() - slice_offset, 0));
+    }
+    return SliceBuffer(std::move(buf), slice_offset, range.length);
+  }
+  return Status::Invalid("ReadRangeCache did not find matching cache entry");
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Coalescing and caching of read ranges, for high-latency file systems
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/concurrency.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+struct ARROW_EXPORT CacheOptions {
+  /// \brief The maximum distance in bytes between two consecutive
+  /// ranges; beyond this value, ranges are not combined
+  int64_t hole_size_limit;
+  /// \brief The maximum size in bytes of a combined range; if
+  /// combining two consecutive ranges would produce a range of a
+  /// size greater than this, they are not combined
+  int64_t range_size_limit;
+
+  static CacheOptions Defaults();
+};
+
+struct ARROW_EXPORT BlockCacheOptions {
+  /// \brief The size in bytes of the aligned file blocks held by the cache
+  int64_t block_size;
+  /// \brief The maximum number of bytes of blocks held in memory
+  int64_t memory_capacity;
+  /// \brief A local directory where blocks evicted from memory are kept
+  ///
+  /// Blocks found there are read back instead of being read again from the
+  /// cached file.  Empty to disable the disk tier.
+  std::string disk_directory;
+  /// \brief The maximum number of bytes of blocks kept in disk_directory
+  int64_t disk_capacity;
+
+  static BlockCacheOptions Defaults();
+};
+
+/// \brief A cache of fixed-size file blocks with a byte budget
+///
+/// A single BlockCache can be shared between any number of
+/// CachedRandomAccessFile instances, which then compete for its capacity.
+/// The least recently used blocks are evicted first.  All methods are
+/// thread-safe.
+class ARROW_EXPORT BlockCache {
+ public:
+  static constexpr int64_t kDefaultBlockSize = 1 << 20;
+  static constexpr int64_t kDefaultMemoryCapacity = 256 << 20;
+
+  ~BlockCache();
+
+  /// \brief Create a BlockCache
+  ///
+  /// The disk directory, if any, must exist.  Files created there are deleted
+  /// when evicted and when the cache is destroyed.
+  static Result<std::shared_ptr<BlockCache>> Make(
+      const BlockCacheOptions& options = BlockCacheOptions::Defaults());
+
+  const BlockCacheOptions& options() const;
+
+  /// \brief The number of bytes of blocks currently held in memory
+  int64_t memory_usage() const;
+
+  /// \brief The number of bytes of blocks currently kept on disk
+  int64_t disk_usage() const;
+
+  /// \brief The number of block lookups satisfied from memory or disk
+  int64_t hits() const;
+
+  /// \brief The number of block lookups that required reading the cached file
+  int64_t misses() const;
+
+ protected:
+  friend class CachedRandomAccessFile;
+
+  explicit BlockCache(const BlockCacheOptions& options);
+
+  // Return a key prefix unique to this cache
+  std::string NewAnonymousKey();
+  // Return the given block if cached, or null
+  Result<std::shared_ptr<Buffer>> Get(const std::string& key, int64_t block_index);
+  Status Put(const std::string& key, int64_t block_index, std::shared_ptr<Buffer> block);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class CachedRandomAccessFile
+/// \brief A RandomAccessFile caching the blocks it reads from another one
+///
+/// Reads are served from the aligned blocks of a BlockCache, which are read from
+/// the wrapped file on miss (consecutive missing blocks with a single ReadAt
+/// call).  Reads within a single block don't copy data.
+class ARROW_EXPORT CachedRandomAccessFile
+    : public internal::RandomAccessFileConcurrencyWrapper<CachedRandomAccessFile> {
+ public:
+  ~CachedRandomAccessFile() override;
+
+  /// \brief Create a CachedRandomAccessFile
+  /// \param[in] raw the file to cache, which must not change while it is cached
+  /// \param[in] cache the cache holding the blocks
+  /// \param[in] cache_key identifies the contents of `raw` in the cache, so that
+  /// files opened again later (e.g. by path and modification time) can reuse the
+  /// blocks cached by predecessors.  If empty, blocks are private to this file.
+  static Result<std::shared_ptr<CachedRandomAccessFile>> Make(
+      std::shared_ptr<RandomAccessFile> raw, std::shared_ptr<BlockCache> cache,
+      std::string cache_key = "");
+
+  /// \brief Return the wrapped file
+  std::shared_ptr<RandomAccessFile> raw() const;
+
+  bool closed() const override;
+
+ protected:
+  CachedRandomAccessFile(std::shared_ptr<RandomAccessFile> raw,
+                         std::shared_ptr<BlockCache> cache, std::string cache_key,
+                         int64_t size);
+
+  friend RandomAccessFileConcurrencyWrapper<CachedRandomAccessFile>;
+
+  Status DoClose();
+  Status DoAbort() override;
+
+  Result<int64_t> DoTell() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoGetSize();
+
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  // Return the blocks overlapping [position, position + nbytes)
+  Result<std::vector<std::shared_ptr<Buffer>>> GetBlocks(int64_t position,
+                                                         int64_t nbytes);
+
+  std::shared_ptr<RandomAccessFile> raw_;
+  std::shared_ptr<BlockCache> cache_;
+  std::string cache_key_;
+  int64_t size_;
+  int64_t position_ = 0;
+  bool closed_ = false;
+};
+
+namespace internal {
+
+/// \brief Coalesce nearby read ranges
+///
+/// Zero-length ranges are dropped and the result is sorted by offset.
+/// The ranges must not overlap.
+ARROW_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit);
+
+/// \brief A read cache designed to hide IO latencies when reading.
+///
+/// To use this, you must first pass it the ranges you'll need in the future.
+/// The cache will combine those ranges according to parameters (see constructor)
+/// and start fetching the combined ranges in the background.
+/// You can then individually fetch them using Read().
+class ARROW_EXPORT ReadRangeCache {
+ public:
+  static constexpr int64_t kDefaultHoleSizeLimit = 8192;
+  static constexpr int64_t kDefaultRangeSizeLimit = 32 * 1024 * 1024;
+
+  /// Construct a read cache with default options
+  explicit ReadRangeCache(std::shared_ptr<RandomAccessFile> file)
+      : ReadRangeCache(file, CacheOptions::Defaults()) {}
+
+  /// Construct a read cache with given options
+  ReadRangeCache(std::shared_ptr<RandomAccessFile> file, CacheOptions options);
+  ~ReadRangeCache();
+
+  /// \brief Cache the given ranges in the background.
+  ///
+  /// The caller must ensure that the ranges do not overlap with each other,
+  /// nor with previously cached ranges.  Otherwise, behaviour will be undefined.
+  Status Cache(std::vector<ReadRange> ranges);
+
+  /// \brief Read a range previously given to Cache().
+  Result<std::shared_ptr<Buffer>> Read(ReadRange range);
+
+ protected:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -30,6 +32,7 @@
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -39,15 +42,41 @@ using util::Decompressor;
 
 namespace io {
 
+namespace {
+
+// Whether the concatenation of streams compressed with the codec is itself a
+// valid compressed stream
+bool SupportsConcatenation(const Codec& codec) {
+  const std::string name = codec.name();
+  return name == "gzip" || name == "zstd" || name == "lz4" || name == "bz2";
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
 class CompressedOutputStream::Impl {
  public:
-  Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
-      : pool_(pool), raw_(raw), is_open_(false), compressed_pos_(0), total_pos_(0) {}
+  Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw,
+       const CompressedOutputStreamOptions& options)
+      : pool_(pool),
+        raw_(raw),
+        options_(options),
+        is_open_(false),
+        compressed_pos_(0),
+        total_pos_(0),
+        codec_(NULLPTR),
+        pending_size_(0),
+        max_blocks_in_flight_(0),
+        blocks_submitted_(0) {}
+
+  ~Impl() { WaitForBlocks(); }
 
   Status Init(Codec* codec) {
+    if (options_.use_threads) {
+      return InitThreaded(codec);
+    }
     ARROW_ASSIGN_OR_RAISE(compressor_, codec->MakeCompressor());
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, kChunkSize, &compressed_));
     compressed_pos_ = 0;
@@ -73,6 +102,9 @@ class CompressedOutputStream::Impl {
   Status Write(const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (options_.use_threads) {
+      return WriteThreaded(data, nbytes);
+    }
     auto input = reinterpret_cast<const uint8_t*>(data);
     while (nbytes > 0) {
       int64_t input_len = nbytes;
@@ -111,6 +143,10 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (options_.use_threads) {
+      RETURN_NOT_OK(SubmitPending());
+      return WriteBlocks(0);
+    }
     while (true) {
       // Flush compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -132,6 +168,14 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (options_.use_threads) {
+      if (blocks_submitted_ == 0) {
+        // Emit an empty compressed stream, so that the output is never empty
+        RETURN_NOT_OK(AllocateResizableBuffer(pool_, 0, &pending_));
+      }
+      RETURN_NOT_OK(SubmitPending());
+      return WriteBlocks(0);
+    }
     while (true) {
       // Try to end compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -170,6 +214,7 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
+      WaitForBlocks();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -182,11 +227,129 @@ class CompressedOutputStream::Impl {
   }
 
  private:
+  using BlockFuture = std::future<Result<std::shared_ptr<Buffer>>>;
+
+  Status InitThreaded(Codec* codec) {
+    if (!SupportsConcatenation(*codec)) {
+      return Status::NotImplemented("Multi-threaded compression with codec '",
+                                    codec->name(), "'");
+    }
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Compression block size must be strictly positive");
+    }
+    if (options_.max_blocks_in_flight < 0) {
+      return Status::Invalid("Maximum number of blocks in flight must be positive");
+    }
+    codec_ = codec;
+    max_blocks_in_flight_ = options_.max_blocks_in_flight;
+    if (max_blocks_in_flight_ == 0) {
+      max_blocks_in_flight_ = 2 * ::arrow::internal::GetCpuThreadPool()->GetCapacity();
+    }
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  // Compress a block of data as a complete compressed stream
+  static Result<std::shared_ptr<Buffer>> CompressBlock(
+      Codec* codec, MemoryPool* pool, const std::shared_ptr<Buffer>& block) {
+    ARROW_ASSIGN_OR_RAISE(auto compressor, codec->MakeCompressor());
+    int64_t out_size = codec->MaxCompressedLen(block->size(), block->data());
+    if (out_size < kChunkSize) {
+      out_size = kChunkSize;
+    }
+    std::shared_ptr<ResizableBuffer> out;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, out_size, &out));
+    int64_t out_pos = 0;
+
+    const uint8_t* input = block->data();
+    int64_t input_len = block->size();
+    while (input_len > 0) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto result, compressor->Compress(input_len, input, out->size() - out_pos,
+                                            out->mutable_data() + out_pos));
+      input += result.bytes_read;
+      input_len -= result.bytes_read;
+      out_pos += result.bytes_written;
+      if (result.bytes_read == 0 || out_pos == out->size()) {
+        RETURN_NOT_OK(out->Resize(out->size() * 2));
+      }
+    }
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto result, compressor->End(out->size() - out_pos,
+                                                         out->mutable_data() + out_pos));
+      out_pos += result.bytes_written;
+      if (!result.should_retry) {
+        break;
+      }
+      RETURN_NOT_OK(out->Resize(out->size() * 2));
+    }
+    RETURN_NOT_OK(out->Resize(out_pos));
+    return out;
+  }
+
+  Status WriteThreaded(const void* data, int64_t nbytes) {
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      if (!pending_) {
+        RETURN_NOT_OK(AllocateResizableBuffer(pool_, options_.block_size, &pending_));
+        pending_size_ = 0;
+      }
+      const int64_t chunk_size = std::min(nbytes, options_.block_size - pending_size_);
+      std::memcpy(pending_->mutable_data() + pending_size_, input, chunk_size);
+      pending_size_ += chunk_size;
+      input += chunk_size;
+      nbytes -= chunk_size;
+      total_pos_ += chunk_size;
+      if (pending_size_ == options_.block_size) {
+        RETURN_NOT_OK(SubmitPending());
+      }
+    }
+    return Status::OK();
+  }
+
+  // Submit the pending block (if any) for compression
+  Status SubmitPending() {
+    if (!pending_) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(WriteBlocks(max_blocks_in_flight_ - 1));
+    RETURN_NOT_OK(pending_->Resize(pending_size_));
+    std::shared_ptr<Buffer> block = std::move(pending_);
+    pending_.reset();
+    pending_size_ = 0;
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    ARROW_ASSIGN_OR_RAISE(auto fut,
+                          pool->Submit(CompressBlock, codec_, pool_, std::move(block)));
+    blocks_.push_back(std::move(fut));
+    ++blocks_submitted_;
+    return Status::OK();
+  }
+
+  // Write compressed blocks, in order, until at most max_remaining are in flight
+  Status WriteBlocks(size_t max_remaining) {
+    while (blocks_.size() > max_remaining) {
+      auto fut = std::move(blocks_.front());
+      blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto compressed, fut.get());
+      RETURN_NOT_OK(raw_->Write(compressed->data(), compressed->size()));
+    }
+    return Status::OK();
+  }
+
+  // Wait for in-flight blocks, discarding them
+  void WaitForBlocks() {
+    for (auto& fut : blocks_) {
+      fut.wait();
+    }
+    blocks_.clear();
+  }
+
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
 
   MemoryPool* pool_;
   std::shared_ptr<OutputStream> raw_;
+  const CompressedOutputStreamOptions options_;
   bool is_open_;
   std::shared_ptr<Compressor> compressor_;
   std::shared_ptr<ResizableBuffer> compressed_;
@@ -194,14 +357,30 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  // Multi-threaded compression state
+  Codec* codec_;
+  // Block being filled, not submitted yet
+  std::shared_ptr<ResizableBuffer> pending_;
+  int64_t pending_size_;
+  // Blocks being compressed or not written yet, in stream order
+  std::deque<BlockFuture> blocks_;
+  size_t max_blocks_in_flight_;
+  int64_t blocks_submitted_;
+
   mutable std::mutex lock_;
 };
 
 Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
     util::Codec* codec, const std::shared_ptr<OutputStream>& raw, MemoryPool* pool) {
+  return Make(codec, raw, CompressedOutputStreamOptions::Defaults(), pool);
+}
+
+Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
+    util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+    const CompressedOutputStreamOptions& options, MemoryPool* pool) {
   // CAUTION: codec is not owned
   std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
-  res->impl_.reset(new Impl(pool, std::move(raw)));
+  res->impl_.reset(new Impl(pool, std::move(raw), options));
   RETURN_NOT_OK(res->impl_->Init(codec));
   return res;
 }
@@ -241,13 +420,19 @@ std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_
 
 class CompressedInputStream::Impl {
  public:
-  Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
+  Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw,
+       const CompressedInputStreamOptions& options)
       : pool_(pool),
         raw_(raw),
+        options_(options),
         is_open_(true),
         compressed_pos_(0),
         decompressed_pos_(0),
-        total_pos_(0) {}
+        total_pos_(0),
+        readahead_pos_(0),
+        readahead_eof_(false) {}
+
+  ~Impl() { WaitForReadahead(); }
 
   Status Init(Codec* codec) {
     ARROW_ASSIGN_OR_RAISE(decompressor_, codec->MakeDecompressor());
@@ -258,6 +443,7 @@ class CompressedInputStream::Impl {
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      WaitForReadahead();
       return raw_->Close();
     } else {
       return Status::OK();
@@ -267,6 +453,7 @@ class CompressedInputStream::Impl {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      WaitForReadahead();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -365,8 +552,74 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
+  // Decompress the next non-empty chunk of data, or return null at the end
+  // of the stream.  With readahead, this runs on the I/O thread pool, one call
+  // at a time, and is the only code touching the decompression state.
+  Result<std::shared_ptr<Buffer>> DecompressNext() {
+    while (true) {
+      bool has_data;
+      RETURN_NOT_OK(RefillDecompressed(&has_data));
+      if (!has_data) {
+        return nullptr;
+      }
+      if (decompressed_->size() > 0) {
+        std::shared_ptr<Buffer> chunk = std::move(decompressed_);
+        decompressed_.reset();
+        return chunk;
+      }
+    }
+  }
+
+  Status SubmitReadahead() {
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    ARROW_ASSIGN_OR_RAISE(readahead_,
+                          pool->Submit([this]() { return DecompressNext(); }));
+    return Status::OK();
+  }
+
+  void WaitForReadahead() {
+    if (readahead_.valid()) {
+      readahead_.wait();
+    }
+  }
+
+  Result<int64_t> ReadWithReadahead(int64_t nbytes, uint8_t* out) {
+    int64_t total_read = 0;
+    while (total_read < nbytes) {
+      const int64_t readable =
+          readahead_chunk_ ? readahead_chunk_->size() - readahead_pos_ : 0;
+      if (readable > 0) {
+        const int64_t read_bytes = std::min(readable, nbytes - total_read);
+        memcpy(out + total_read, readahead_chunk_->data() + readahead_pos_, read_bytes);
+        readahead_pos_ += read_bytes;
+        total_read += read_bytes;
+        continue;
+      }
+      // Current chunk is exhausted, wait for the next one and start
+      // decompressing the one after it
+      if (readahead_eof_) {
+        break;
+      }
+      if (!readahead_.valid()) {
+        RETURN_NOT_OK(SubmitReadahead());
+      }
+      ARROW_ASSIGN_OR_RAISE(readahead_chunk_, readahead_.get());
+      readahead_pos_ = 0;
+      if (!readahead_chunk_) {
+        readahead_eof_ = true;
+        break;
+      }
+      RETURN_NOT_OK(SubmitReadahead());
+    }
+    total_pos_ += total_read;
+    return total_read;
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) {
     auto out_data = reinterpret_cast<uint8_t*>(out);
+    if (options_.readahead) {
+      return ReadWithReadahead(nbytes, out_data);
+    }
 
     int64_t total_read = 0;
     bool decompressor_has_data = true;
@@ -405,6 +658,7 @@ class CompressedInputStream::Impl {
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
+  const CompressedInputStreamOptions options_;
   bool is_open_;
   std::shared_ptr<Decompressor> decompressor_;
   std::shared_ptr<Buffer> compressed_;
@@ -417,16 +671,28 @@ class CompressedInputStream::Impl {
   bool fresh_decompressor_;
   // Total number of bytes decompressed
   int64_t total_pos_;
+
+  // Readahead state, only touched by the reading thread
+  std::future<Result<std::shared_ptr<Buffer>>> readahead_;
+  // Decompressed chunk being consumed
+  std::shared_ptr<Buffer> readahead_chunk_;
+  int64_t readahead_pos_;
+  bool readahead_eof_;
 };
 
 Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
     Codec* codec, const std::shared_ptr<InputStream>& raw, MemoryPool* pool) {
+  return Make(codec, raw, CompressedInputStreamOptions::Defaults(), pool);
+}
+
+Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
+    Codec* codec, const std::shared_ptr<InputStream>& raw,
+    const CompressedInputStreamOptions& options, MemoryPool* pool) {
   // CAUTION: codec is not owned
   std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
-  res->impl_.reset(new Impl(pool, std::move(raw)));
+  res->impl_.reset(new Impl(pool, std::move(raw), options));
   RETURN_NOT_OK(res->impl_->Init(codec));
   return res;
-  return Status::OK();
 }
 
 Status CompressedInputStream::Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
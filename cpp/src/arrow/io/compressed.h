@@ -40,6 +40,44 @@ class Codec;
 
 namespace io {
 
+/// \brief Options for CompressedOutputStream
+struct ARROW_EXPORT CompressedOutputStreamOptions {
+  /// \brief Whether to compress on the CPU thread pool
+  ///
+  /// If true, the data is cut into blocks of block_size bytes which are
+  /// compressed independently and concurrently, each as a complete compressed
+  /// stream (a gzip member, a zstd or LZ4 frame, a bzip2 stream).  The output
+  /// is the concatenation of these streams, in order, which standard tools
+  /// and CompressedInputStream decompress as a whole.  This is only supported
+  /// for codecs whose formats allow concatenation: gzip, zstd, lz4 and bz2.
+  ///
+  /// The compression ratio is slightly lower, since blocks don't share a
+  /// compression window.
+  bool use_threads = false;
+
+  /// Size of the blocks compressed independently if use_threads is true
+  int64_t block_size = 1 << 20;
+
+  /// Maximum number of blocks being compressed or waiting to be written, which
+  /// bounds memory usage (0 for twice the CPU thread pool capacity)
+  int32_t max_blocks_in_flight = 0;
+
+  static CompressedOutputStreamOptions Defaults() {
+    return CompressedOutputStreamOptions();
+  }
+};
+
+/// \brief Options for CompressedInputStream
+struct ARROW_EXPORT CompressedInputStreamOptions {
+  /// Whether to read and decompress the next chunk of data on a background
+  /// thread (of the I/O thread pool) while the current one is consumed
+  bool readahead = false;
+
+  static CompressedInputStreamOptions Defaults() {
+    return CompressedInputStreamOptions();
+  }
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -49,6 +87,14 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
       util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed output stream wrapping the given output stream.
+  ///
+  /// The codec must outlive the stream.
+  static Result<std::shared_ptr<CompressedOutputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      const CompressedOutputStreamOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   ARROW_DEPRECATED("Use Result-returning overload")
   static Status Make(util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
                      std::shared_ptr<CompressedOutputStream>* out);
@@ -95,6 +141,12 @@ class ARROW_EXPORT CompressedInputStream
       util::Codec* codec, const std::shared_ptr<InputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed input stream wrapping the given input stream.
+  static Result<std::shared_ptr<CompressedInputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      const CompressedInputStreamOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   ARROW_DEPRECATED("Use Result-returning overload")
   static Status Make(util::Codec* codec, const std::shared_ptr<InputStream>& raw,
                      std::shared_ptr<CompressedInputStream>* out);
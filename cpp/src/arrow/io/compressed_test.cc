@@ -81,10 +81,12 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
 }
 
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                const CompressedInputStreamOptions& options,
                                 int64_t* stream_pos, std::vector<uint8_t>* out) {
   // Create compressed input stream
   auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        CompressedInputStream::Make(codec, buffer_reader, options));
 
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
@@ -106,18 +108,22 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
   return Status::OK();
 }
 
-Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                std::vector<uint8_t>* out) {
-  return RunCompressedInputStream(codec, compressed, nullptr, out);
+Status RunCompressedInputStream(
+    Codec* codec, std::shared_ptr<Buffer> compressed, std::vector<uint8_t>* out,
+    const CompressedInputStreamOptions& options = CompressedInputStreamOptions()) {
+  return RunCompressedInputStream(codec, compressed, options, nullptr, out);
 }
 
-void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
+void CheckCompressedInputStream(
+    Codec* codec, const std::vector<uint8_t>& data,
+    const CompressedInputStreamOptions& options = CompressedInputStreamOptions()) {
   // Create compressed data
   auto compressed = CompressDataOneShot(codec, data);
 
   std::vector<uint8_t> decompressed;
   int64_t stream_pos = -1;
-  ASSERT_OK(RunCompressedInputStream(codec, compressed, &stream_pos, &decompressed));
+  ASSERT_OK(
+      RunCompressedInputStream(codec, compressed, options, &stream_pos, &decompressed));
 
   ASSERT_EQ(decompressed.size(), data.size());
   ASSERT_EQ(decompressed, data);
@@ -154,6 +160,37 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+void CheckThreadedCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                         const CompressedOutputStreamOptions& options,
+                                         bool do_flush) {
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create(1024));
+  ASSERT_OK_AND_ASSIGN(auto stream,
+                       CompressedOutputStream::Make(codec, buffer_writer, options));
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 77777;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ASSERT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), stream->Tell());
+  ASSERT_OK(stream->Close());
+
+  // The output is a concatenation of compressed streams, decompress it
+  // with a streaming decompressor
+  ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+  ASSERT_GT(compressed->size(), 0);
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -182,6 +219,17 @@ TEST_P(CompressedInputStreamTest, RandomData) {
   CheckCompressedInputStream(codec.get(), data);
 }
 
+TEST_P(CompressedInputStreamTest, Readahead) {
+  auto codec = MakeCodec();
+  CompressedInputStreamOptions options;
+  options.readahead = true;
+
+  CheckCompressedInputStream(codec.get(), MakeCompressibleData(COMPRESSIBLE_DATA_SIZE),
+                             options);
+  CheckCompressedInputStream(codec.get(), MakeRandomData(RANDOM_DATA_SIZE), options);
+  CheckCompressedInputStream(codec.get(), {}, options);
+}
+
 TEST_P(CompressedInputStreamTest, TruncatedData) {
   auto codec = MakeCodec();
   auto data = MakeRandomData(10000);
@@ -190,6 +238,11 @@ TEST_P(CompressedInputStreamTest, TruncatedData) {
 
   std::vector<uint8_t> decompressed;
   ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, &decompressed));
+
+  CompressedInputStreamOptions options;
+  options.readahead = true;
+  ASSERT_RAISES(IOError,
+                RunCompressedInputStream(codec.get(), truncated, &decompressed, options));
 }
 
 TEST_P(CompressedInputStreamTest, InvalidData) {
@@ -240,6 +293,33 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, MultiThreaded) {
+  auto codec = MakeCodec();
+  CompressedOutputStreamOptions options;
+  options.use_threads = true;
+  options.block_size = 100000;
+
+  std::shared_ptr<OutputStream> sink = std::make_shared<MockOutputStream>();
+  if (GetCompression() == Compression::BROTLI) {
+    // Concatenated brotli streams are not a valid brotli stream
+    ASSERT_RAISES(NotImplemented,
+                  CompressedOutputStream::Make(codec.get(), sink, options));
+    return;
+  }
+  auto compressible = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto random = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckThreadedCompressedOutputStream(codec.get(), compressible, options, false);
+  CheckThreadedCompressedOutputStream(codec.get(), random, options, true);
+  CheckThreadedCompressedOutputStream(codec.get(), {}, options, false);
+
+  // Few blocks in flight
+  options.max_blocks_in_flight = 1;
+  CheckThreadedCompressedOutputStream(codec.get(), compressible, options, false);
+
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CompressedOutputStream::Make(codec.get(), sink, options));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
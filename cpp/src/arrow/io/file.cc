@@ -30,6 +30,19 @@
 #include <unistd.h>  // IWYU pragma: keep
 #endif
 
+// io_uring is driven through the raw system calls, which only requires
+// the kernel headers
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define ARROW_HAVE_IO_URING
+#endif
+#endif
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
@@ -39,6 +52,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -98,10 +112,11 @@ class OSFile {
     return Status::OK();
   }
 
-  Status OpenReadable(const std::string& path) {
+  Status OpenReadable(const std::string& path, bool direct_io = false) {
     RETURN_NOT_OK(SetFileName(path));
 
-    ARROW_ASSIGN_OR_RAISE(fd_, ::arrow::internal::FileOpenReadable(file_name_));
+    ARROW_ASSIGN_OR_RAISE(fd_,
+                          ::arrow::internal::FileOpenReadable(file_name_, direct_io));
     ARROW_ASSIGN_OR_RAISE(size_, ::arrow::internal::FileGetSize(fd_));
 
     is_open_ = true;
@@ -181,6 +196,14 @@ class OSFile {
                                         length);
   }
 
+  Status WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+    return ::arrow::internal::FileWriteVectored(fd_, data);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -327,6 +350,492 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(internal::ValidateReadRanges(ranges));
+  if (!impl_->is_open()) {
+    return Status::Invalid("Invalid operation on closed file");
+  }
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(
+        ::arrow::internal::FileAdviseWillNeed(impl_->fd(), range.offset, range.length));
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// UringReadableFile implementation
+
+namespace {
+
+// A read of `length` bytes at `offset` into `out`
+struct ReadRequest {
+  uint8_t* out;
+  int64_t offset;
+  int64_t length;
+};
+
+// Larger reads are split, so that the number of bytes read fits in the
+// int32 result of an io_uring completion
+constexpr int64_t kMaxReadRequestSize = 1 << 30;
+
+#ifdef ARROW_HAVE_IO_URING
+
+// A minimal io_uring instance, only issuing reads.  Not thread-safe.
+class Uring {
+ public:
+  static Result<std::unique_ptr<Uring>> Make(int32_t entries) {
+    std::unique_ptr<Uring> ring(new Uring());
+    RETURN_NOT_OK(ring->Init(static_cast<uint32_t>(entries)));
+    return std::move(ring);
+  }
+
+  ~Uring() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (fd_ >= 0) {
+      ARROW_UNUSED(::arrow::internal::FileClose(fd_));
+    }
+  }
+
+  // Issue the reads, as many at a time as the submission queue holds, and
+  // store the number of bytes read by each in `bytes_read`
+  Status Read(int fd, const std::vector<ReadRequest>& requests,
+              std::vector<int64_t>* bytes_read) {
+    bytes_read->assign(requests.size(), 0);
+    std::vector<struct iovec> iovecs(requests.size());
+    Status status;
+    size_t next = 0;
+    while (next < requests.size()) {
+      const auto batch = static_cast<unsigned>(
+          std::min<size_t>(requests.size() - next, static_cast<size_t>(sq_entries_)));
+      // We are the only producer of the submission queue
+      unsigned tail = *sq_tail_;
+      for (size_t i = next; i < next + batch; ++i, ++tail) {
+        const unsigned index = tail & *sq_mask_;
+        struct io_uring_sqe* sqe = &sqes_[index];
+        memset(sqe, 0, sizeof(*sqe));
+        iovecs[i].iov_base = requests[i].out;
+        iovecs[i].iov_len = static_cast<size_t>(requests[i].length);
+        // IORING_OP_READV rather than IORING_OP_READ, for Linux < 5.6
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&iovecs[i]);
+        sqe->len = 1;
+        sqe->off = static_cast<uint64_t>(requests[i].offset);
+        sqe->user_data = i;
+        sq_array_[index] = index;
+      }
+      __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+      RETURN_NOT_OK(Enter(batch, batch));
+
+      // Reap all completions of the batch, even after an error, so that
+      // none is left in the queue for the next batch
+      unsigned completed = 0;
+      while (completed < batch) {
+        unsigned head = *cq_head_;
+        const unsigned cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        if (head == cq_tail) {
+          RETURN_NOT_OK(Enter(0, batch - completed));
+          continue;
+        }
+        for (; head != cq_tail; ++head, ++completed) {
+          const struct io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+          if (cqe.res < 0) {
+            if (status.ok()) {
+              status =
+                  ::arrow::internal::IOErrorFromErrno(-cqe.res, "Error reading file");
+            }
+          } else {
+            (*bytes_read)[cqe.user_data] = cqe.res;
+          }
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      }
+      next += batch;
+    }
+    return status;
+  }
+
+ private:
+  Uring() = default;
+
+  Status Init(uint32_t entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    ARROW_ASSIGN_OR_RAISE(sq_ring_, MapRing(sq_ring_size_, IORING_OFF_SQ_RING));
+    ARROW_ASSIGN_OR_RAISE(cq_ring_, MapRing(cq_ring_size_, IORING_OFF_CQ_RING));
+    ARROW_ASSIGN_OR_RAISE(void* sqes, MapRing(sqes_size_, IORING_OFF_SQES));
+    sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+    auto sq = static_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto cq = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+  }
+
+  Result<void*> MapRing(size_t size, off_t offset) {
+    void* result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        fd_, offset);
+    if (result == MAP_FAILED) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Mapping io_uring failed");
+    }
+    return result;
+  }
+
+  // Submit `to_submit` entries and wait for `min_complete` completions
+  Status Enter(unsigned to_submit, unsigned min_complete) {
+    while (true) {
+      const auto ret = syscall(__NR_io_uring_enter, fd_, to_submit, min_complete,
+                               IORING_ENTER_GETEVENTS, nullptr, 0);
+      if (ret < 0) {
+        if (errno == EINTR || errno == EAGAIN) {
+          continue;
+        }
+        return ::arrow::internal::IOErrorFromErrno(errno, "io_uring_enter failed");
+      }
+      to_submit -= static_cast<unsigned>(ret);
+      if (to_submit == 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+  int fd_ = -1;
+  uint32_t sq_entries_ = 0;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  struct io_uring_sqe* sqes_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+#else
+
+// Placeholder on platforms without io_uring
+class Uring {};
+
+#endif
+
+}  // namespace
+
+class UringReadableFile::UringReadableFileImpl : public OSFile {
+ public:
+  UringReadableFileImpl(const UringReadableFileOptions& options, MemoryPool* pool)
+      : OSFile(), options_(options), pool_(pool), position_(0), uses_io_uring_(false) {}
+
+  Status Open(const std::string& path) {
+    if (options_.queue_depth <= 0) {
+      return Status::Invalid("UringReadableFileOptions::queue_depth must be positive");
+    }
+    if (options_.direct_io &&
+        (options_.alignment <= 0 || (options_.alignment & (options_.alignment - 1)) ||
+         options_.alignment > kMaxReadRequestSize)) {
+      return Status::Invalid(
+          "UringReadableFileOptions::alignment must be a power of two, got ",
+          options_.alignment);
+    }
+    RETURN_NOT_OK(OpenReadable(path, options_.direct_io));
+#ifdef ARROW_HAVE_IO_URING
+    // Check that io_uring is usable, and keep the ring for the first reads
+    auto maybe_ring = Uring::Make(options_.queue_depth);
+    if (maybe_ring.ok()) {
+      free_rings_.push_back(std::move(maybe_ring).ValueOrDie());
+      uses_io_uring_ = true;
+    }
+#endif
+    return Status::OK();
+  }
+
+  Status Close() {
+    free_rings_.clear();
+    return OSFile::Close();
+  }
+
+  bool uses_io_uring() const { return uses_io_uring_; }
+
+  int64_t position() const { return position_; }
+
+  Status Seek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  void Advance(int64_t nbytes) { position_ += nbytes; }
+
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadRanges(
+      const std::vector<ReadRange>& ranges) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateReadRanges(ranges));
+
+    // For each range, the buffer read into and the offset of the range in it
+    std::vector<std::shared_ptr<Buffer>> buffers(ranges.size());
+    std::vector<int64_t> data_offsets(ranges.size(), 0);
+    // The requests of range i are [first_requests[i], first_requests[i + 1])
+    std::vector<size_t> first_requests(ranges.size() + 1, 0);
+    std::vector<ReadRequest> requests;
+
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      first_requests[i] = requests.size();
+      int64_t start = ranges[i].offset;
+      int64_t end = std::min(ranges[i].offset + ranges[i].length, size());
+      if (start >= end) {
+        buffers[i] = std::make_shared<Buffer>(nullptr, 0);
+        continue;
+      }
+      std::shared_ptr<Buffer> buffer;
+      uint8_t* out;
+      if (options_.direct_io) {
+        // Read whole aligned blocks into aligned memory
+        start = AlignDown(start);
+        end = AlignUp(end);
+        RETURN_NOT_OK(AllocateBuffer(pool_, end - start + options_.alignment, &buffer));
+        const auto address = reinterpret_cast<uintptr_t>(buffer->data());
+        const auto aligned_address =
+            static_cast<uintptr_t>(AlignUp(static_cast<int64_t>(address)));
+        out = buffer->mutable_data() + (aligned_address - address);
+        data_offsets[i] = (out - buffer->data()) + (ranges[i].offset - start);
+      } else {
+        RETURN_NOT_OK(AllocateBuffer(pool_, end - start, &buffer));
+        out = buffer->mutable_data();
+      }
+      buffers[i] = std::move(buffer);
+      AddRequests(out, start, end - start, &requests);
+    }
+    first_requests[ranges.size()] = requests.size();
+
+    std::vector<int64_t> bytes_read;
+    RETURN_NOT_OK(Execute(requests, &bytes_read));
+
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      if (first_requests[i] == first_requests[i + 1]) {
+        continue;
+      }
+      const int64_t bytes_in_window =
+          BytesRead(requests, bytes_read, first_requests[i], first_requests[i + 1]);
+      // With direct I/O, the window starts before the range
+      const int64_t range_start_in_window =
+          ranges[i].offset - requests[first_requests[i]].offset;
+      const int64_t length = std::max<int64_t>(
+          0, std::min(ranges[i].length, bytes_in_window - range_start_in_window));
+      buffers[i] = SliceBuffer(buffers[i], data_offsets[i], length);
+    }
+    return buffers;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (options_.direct_io) {
+      // Read into aligned memory, then copy
+      ARROW_ASSIGN_OR_RAISE(auto buffers, ReadRanges({{position, nbytes}}));
+      if (buffers[0]->size() > 0) {
+        memcpy(out, buffers[0]->data(), static_cast<size_t>(buffers[0]->size()));
+      }
+      return buffers[0]->size();
+    }
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateReadRanges({{position, nbytes}}));
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size() - position));
+    std::vector<ReadRequest> requests;
+    AddRequests(reinterpret_cast<uint8_t*>(out), position, nbytes, &requests);
+    std::vector<int64_t> bytes_read;
+    RETURN_NOT_OK(Execute(requests, &bytes_read));
+    return BytesRead(requests, bytes_read, 0, requests.size());
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffers, ReadRanges({{position, nbytes}}));
+    return std::move(buffers[0]);
+  }
+
+ private:
+  int64_t AlignDown(int64_t value) const { return value & ~(options_.alignment - 1); }
+
+  int64_t AlignUp(int64_t value) const {
+    return AlignDown(value + options_.alignment - 1);
+  }
+
+  static void AddRequests(uint8_t* out, int64_t offset, int64_t length,
+                          std::vector<ReadRequest>* requests) {
+    while (length > 0) {
+      const int64_t chunk_size = std::min(length, kMaxReadRequestSize);
+      requests->push_back({out, offset, chunk_size});
+      out += chunk_size;
+      offset += chunk_size;
+      length -= chunk_size;
+    }
+  }
+
+  // The number of contiguous bytes read by requests [begin, end), up to the
+  // first short read (i.e. EOF)
+  static int64_t BytesRead(const std::vector<ReadRequest>& requests,
+                           const std::vector<int64_t>& bytes_read, size_t begin,
+                           size_t end) {
+    int64_t total = 0;
+    for (size_t i = begin; i < end; ++i) {
+      total += bytes_read[i];
+      if (bytes_read[i] < requests[i].length) {
+        break;
+      }
+    }
+    return total;
+  }
+
+  Status Execute(const std::vector<ReadRequest>& requests,
+                 std::vector<int64_t>* bytes_read) {
+#ifdef ARROW_HAVE_IO_URING
+    if (uses_io_uring_ && !requests.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto ring, AcquireRing());
+      Status st = ring->Read(fd(), requests, bytes_read);
+      ReleaseRing(std::move(ring));
+      RETURN_NOT_OK(st);
+      // Complete any short read (e.g. interrupted); at EOF, this reads nothing
+      for (size_t i = 0; i < requests.size(); ++i) {
+        auto& nread = (*bytes_read)[i];
+        if (nread > 0 && nread < requests[i].length) {
+          ARROW_ASSIGN_OR_RAISE(
+              int64_t more, ::arrow::internal::FileReadAt(
+                                fd(), requests[i].out + nread, requests[i].offset + nread,
+                                requests[i].length - nread));
+          nread += more;
+        }
+      }
+      return Status::OK();
+    }
+#endif
+    bytes_read->resize(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+      const auto& request = requests[i];
+      ARROW_ASSIGN_OR_RAISE(
+          (*bytes_read)[i],
+          ::arrow::internal::FileReadAt(fd(), request.out, request.offset,
+                                        request.length));
+    }
+    return Status::OK();
+  }
+
+#ifdef ARROW_HAVE_IO_URING
+  // Each concurrent reader uses its own ring
+  Result<std::unique_ptr<Uring>> AcquireRing() {
+    {
+      std::lock_guard<std::mutex> guard(rings_lock_);
+      if (!free_rings_.empty()) {
+        auto ring = std::move(free_rings_.back());
+        free_rings_.pop_back();
+        return std::move(ring);
+      }
+    }
+    return Uring::Make(options_.queue_depth);
+  }
+
+  void ReleaseRing(std::unique_ptr<Uring> ring) {
+    std::lock_guard<std::mutex> guard(rings_lock_);
+    free_rings_.push_back(std::move(ring));
+  }
+#endif
+
+  const UringReadableFileOptions options_;
+  MemoryPool* pool_;
+  int64_t position_;
+  bool uses_io_uring_;
+  std::mutex rings_lock_;
+  std::vector<std::unique_ptr<Uring>> free_rings_;
+};
+
+UringReadableFile::UringReadableFile(const UringReadableFileOptions& options,
+                                     MemoryPool* pool) {
+  impl_.reset(new UringReadableFileImpl(options, pool));
+}
+
+UringReadableFile::~UringReadableFile() { internal::CloseFromDestructor(this); }
+
+Result<std::shared_ptr<UringReadableFile>> UringReadableFile::Open(
+    const std::string& path, const UringReadableFileOptions& options, MemoryPool* pool) {
+  auto file = std::shared_ptr<UringReadableFile>(new UringReadableFile(options, pool));
+  RETURN_NOT_OK(file->impl_->Open(path));
+  return file;
+}
+
+Status UringReadableFile::DoClose() { return impl_->Close(); }
+
+bool UringReadableFile::closed() const { return !impl_->is_open(); }
+
+bool UringReadableFile::uses_io_uring() const { return impl_->uses_io_uring(); }
+
+int UringReadableFile::file_descriptor() const { return impl_->fd(); }
+
+Result<std::vector<std::shared_ptr<Buffer>>> UringReadableFile::ReadRanges(
+    const std::vector<ReadRange>& ranges) {
+  return impl_->ReadRanges(ranges);
+}
+
+Result<int64_t> UringReadableFile::DoTell() const {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  return impl_->position();
+}
+
+Status UringReadableFile::DoSeek(int64_t position) { return impl_->Seek(position); }
+
+Result<int64_t> UringReadableFile::DoGetSize() {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  return impl_->size();
+}
+
+Result<int64_t> UringReadableFile::DoRead(int64_t nbytes, void* out) {
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                        impl_->ReadAt(impl_->position(), nbytes, out));
+  impl_->Advance(bytes_read);
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> UringReadableFile::DoRead(int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadBufferAt(impl_->position(), nbytes));
+  impl_->Advance(buffer->size());
+  return buffer;
+}
+
+Result<int64_t> UringReadableFile::DoReadAt(int64_t position, int64_t nbytes,
+                                            void* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> UringReadableFile::DoReadAt(int64_t position,
+                                                            int64_t nbytes) {
+  return impl_->ReadBufferAt(position, nbytes);
+}
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -394,6 +903,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data) {
+  return impl_->WriteVectored(data);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -454,8 +967,10 @@ class MemoryMappedFile::MemoryMap
   }
 
   Status Open(const std::string& path, FileMode::type mode, const int64_t offset = 0,
-              const int64_t length = -1) {
+              const int64_t length = -1,
+              const MemoryMapOptions& options = MemoryMapOptions::Defaults()) {
     file_.reset(new OSFile());
+    options_ = options;
 
     if (mode != FileMode::READ) {
       // Memory mapping has permission failures if PROT_READ not set
@@ -522,6 +1037,7 @@ class MemoryMappedFile::MemoryMap
       if (position_ > map_len_) {
         position_ = map_len_;
       }
+      RETURN_NOT_OK(ApplyOptions());
     } else {
       DCHECK_EQ(position_, 0);
       // the mmap is not yet initialized, resize the underlying
@@ -571,7 +1087,57 @@ class MemoryMappedFile::MemoryMap
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  Status Advise(MemoryMapOptions::Advice advice) {
+    options_.advice = advice;
+    if (map_len_ == 0) {
+      // Not mapped yet, the advice will be applied by InitMMap()
+      return Status::OK();
+    }
+    return ::arrow::internal::MemoryAdvise(data(), static_cast<size_t>(map_len_),
+                                           ToMemoryAdvice(advice));
+  }
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) {
+    for (const auto& range : ranges) {
+      const int64_t length =
+          std::max<int64_t>(0, std::min(range.length, map_len_ - range.offset));
+      if (length > 0) {
+        RETURN_NOT_OK(::arrow::internal::MemoryAdvise(
+            data() + range.offset, static_cast<size_t>(length),
+            ::arrow::internal::MemoryAdvice::WillNeed));
+      }
+    }
+    return Status::OK();
+  }
+
  private:
+  static ::arrow::internal::MemoryAdvice ToMemoryAdvice(MemoryMapOptions::Advice advice) {
+    switch (advice) {
+      case MemoryMapOptions::Advice::Sequential:
+        return ::arrow::internal::MemoryAdvice::Sequential;
+      case MemoryMapOptions::Advice::Random:
+        return ::arrow::internal::MemoryAdvice::Random;
+      case MemoryMapOptions::Advice::WillNeed:
+        return ::arrow::internal::MemoryAdvice::WillNeed;
+      default:
+        return ::arrow::internal::MemoryAdvice::Normal;
+    }
+  }
+
+  // Apply the access hints to the current mapping
+  Status ApplyOptions() {
+    const auto size = static_cast<size_t>(map_len_);
+    if (options_.huge_pages) {
+      RETURN_NOT_OK(::arrow::internal::MemoryAdvise(
+          data(), size, ::arrow::internal::MemoryAdvice::HugePage));
+    }
+    if (options_.advice != MemoryMapOptions::Advice::Normal) {
+      RETURN_NOT_OK(
+          ::arrow::internal::MemoryAdvise(data(), size, ToMemoryAdvice(options_.advice)));
+    }
+    return Status::OK();
+  }
+
   // Initialize the mmap and set size, capacity and the data pointers
   Status InitMMap(int64_t initial_size, bool resize_file = false,
                   const int64_t offset = 0, const int64_t length = -1) {
@@ -590,7 +1156,13 @@ class MemoryMappedFile::MemoryMap
       mmap_length = static_cast<size_t>(length);
     }
 
-    void* result = mmap(nullptr, mmap_length, prot_flags_, map_mode_, file_->fd(),
+    int map_flags = map_mode_;
+#ifdef MAP_POPULATE
+    if (options_.populate) {
+      map_flags |= MAP_POPULATE;
+    }
+#endif
+    void* result = mmap(nullptr, mmap_length, prot_flags_, map_flags, file_->fd(),
                         static_cast<off_t>(offset));
     if (result == MAP_FAILED) {
       return Status::IOError("Memory mapping file failed: ",
@@ -602,9 +1174,10 @@ class MemoryMappedFile::MemoryMap
                                        map_len_);
     file_size_ = initial_size;
 
-    return Status::OK();
+    return ApplyOptions();
   }
 
+  MemoryMapOptions options_;
   std::unique_ptr<OSFile> file_;
   int prot_flags_;
   int map_mode_;
@@ -643,14 +1216,18 @@ Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::stri
   return result;
 }
 
-Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::string& path,
-                                                                 FileMode::type mode,
-                                                                 const int64_t offset,
-                                                                 const int64_t length) {
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const MemoryMapOptions& options) {
+  return Open(path, mode, 0, -1, options);
+}
+
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const int64_t offset,
+    const int64_t length, const MemoryMapOptions& options) {
   std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
 
   result->memory_map_.reset(new MemoryMap());
-  RETURN_NOT_OK(result->memory_map_->Open(path, mode, offset, length));
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode, offset, length, options));
   return result;
 }
 
@@ -774,5 +1351,20 @@ Status MemoryMappedFile::Resize(int64_t new_size) {
 
 int MemoryMappedFile::file_descriptor() const { return memory_map_->fd(); }
 
+Status MemoryMappedFile::Advise(MemoryMapOptions::Advice advice) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  std::lock_guard<std::mutex> guard(memory_map_->resize_lock());
+  return memory_map_->Advise(advice);
+}
+
+Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  RETURN_NOT_OK(internal::ValidateReadRanges(ranges));
+  auto guard_resize = memory_map_->writable()
+                          ? std::unique_lock<std::mutex>(memory_map_->resize_lock())
+                          : std::unique_lock<std::mutex>();
+  return memory_map_->WillNeed(ranges);
+}
+
 }  // namespace io
 }  // namespace arrow
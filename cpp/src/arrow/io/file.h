@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -87,6 +88,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   using Writable::Write;
   /// \endcond
 
+  // Write the buffers with a single writev() call where possible. Thread-safe
+  Status WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data) override;
+
   int file_descriptor() const;
 
  private:
@@ -138,6 +142,9 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Start reading the given ranges into the OS page cache
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
@@ -161,6 +168,108 @@ class ARROW_EXPORT ReadableFile
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief Options for UringReadableFile::Open
+struct ARROW_EXPORT UringReadableFileOptions {
+  /// Maximum number of reads submitted at once to the kernel
+  int32_t queue_depth = 64;
+
+  /// Whether reads bypass the OS page cache (O_DIRECT)
+  ///
+  /// Reads are then issued on aligned offsets and lengths, into aligned
+  /// memory carved out of buffers allocated from the file's MemoryPool.
+  bool direct_io = false;
+
+  /// Alignment of direct reads, a power of two no smaller than the logical
+  /// block size of the device
+  int64_t alignment = 4096;
+
+  static UringReadableFileOptions Defaults() { return UringReadableFileOptions(); }
+};
+
+/// \brief A local file open in read-only mode, read with io_uring
+///
+/// All reads are positional: ReadRanges() submits a batch of reads at once,
+/// letting fast devices (e.g. NVMe arrays) serve them in parallel without
+/// using a thread per read.  ReadAt() can also be called from several
+/// threads concurrently, each of which then uses its own ring.
+///
+/// Where io_uring is unavailable (non-Linux platforms, old kernels or
+/// sandboxes that forbid it), reads fall back to pread().
+class ARROW_EXPORT UringReadableFile
+    : public internal::RandomAccessFileConcurrencyWrapper<UringReadableFile> {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options the read options
+  /// \param[in] pool a MemoryPool for memory allocations
+  static Result<std::shared_ptr<UringReadableFile>> Open(
+      const std::string& path,
+      const UringReadableFileOptions& options = UringReadableFileOptions::Defaults(),
+      MemoryPool* pool = default_memory_pool());
+
+  bool closed() const override;
+
+  /// \brief Read several ranges of the file at once
+  ///
+  /// The returned buffers may be shorter than requested if EOF is reached.
+  /// This method is thread-safe.
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadRanges(
+      const std::vector<ReadRange>& ranges);
+
+  /// \brief Whether reads are issued with io_uring rather than pread()
+  bool uses_io_uring() const;
+
+  int file_descriptor() const;
+
+ private:
+  friend RandomAccessFileConcurrencyWrapper<UringReadableFile>;
+
+  UringReadableFile(const UringReadableFileOptions& options, MemoryPool* pool);
+
+  Status DoClose();
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+  Result<int64_t> DoGetSize();
+  Status DoSeek(int64_t position);
+
+  class ARROW_NO_EXPORT UringReadableFileImpl;
+  std::unique_ptr<UringReadableFileImpl> impl_;
+};
+
+/// \brief Options for MemoryMappedFile::Open
+struct ARROW_EXPORT MemoryMapOptions {
+  /// \brief Expected access pattern of a memory map
+  enum class Advice : int8_t {
+    /// No particular pattern
+    Normal,
+    /// Pages are accessed in order: read ahead aggressively, and reclaim
+    /// pages soon after they are accessed
+    Sequential,
+    /// Pages are accessed in random order: disable readahead
+    Random,
+    /// The whole mapping will be accessed soon: start reading it in the background
+    WillNeed,
+  };
+
+  /// Hint passed to the kernel (with madvise()) when the file is mapped
+  Advice advice = Advice::Normal;
+
+  /// Whether to read the whole mapping into memory when the file is mapped,
+  /// rather than faulting pages in on first access (MAP_POPULATE, Linux only)
+  bool populate = false;
+
+  /// Whether to ask for the mapping to be backed by transparent huge pages,
+  /// which is only honoured by some filesystems (MADV_HUGEPAGE, Linux only)
+  bool huge_pages = false;
+
+  static MemoryMapOptions Defaults() { return MemoryMapOptions(); }
+};
+
 /// \brief A file interface that uses memory-mapped files for memory interactions
 ///
 /// This implementation supports zero-copy reads. The same class is used
@@ -188,11 +297,16 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   static Status Open(const std::string& path, FileMode::type mode,
                      std::shared_ptr<MemoryMappedFile>* out);
 
-  // mmap() with a region of file, the offset must be a multiple of the page size
+  // mmap() with whole file, with the given access hints
   static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
                                                         FileMode::type mode,
-                                                        const int64_t offset,
-                                                        const int64_t length);
+                                                        const MemoryMapOptions& options);
+
+  // mmap() with a region of file, the offset must be a multiple of the page size
+  static Result<std::shared_ptr<MemoryMappedFile>> Open(
+      const std::string& path, FileMode::type mode, const int64_t offset,
+      const int64_t length,
+      const MemoryMapOptions& options = MemoryMapOptions::Defaults());
 
   ARROW_DEPRECATED("Use Result-returning overload")
   static Status Open(const std::string& path, FileMode::type mode, const int64_t offset,
@@ -239,6 +353,14 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   int file_descriptor() const;
 
+  /// \brief Change the expected access pattern of the whole mapping
+  Status Advise(MemoryMapOptions::Advice advice);
+
+  /// \brief Start reading the given ranges of the mapping in the background
+  ///
+  /// This avoids stalling on page faults when the ranges are first accessed.
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
  private:
   MemoryMappedFile();
 
@@ -214,6 +214,25 @@ TEST_F(TestFileOutputStream, Append) {
   AssertFileContents(path_, "testdata");
 }
 
+TEST_F(TestFileOutputStream, WriteVectored) {
+  OpenFile();
+
+  // More buffers than a single writev() call takes, some of them empty
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::string expected;
+  for (int i = 0; i < 3000; ++i) {
+    std::string data(i % 7, static_cast<char>('a' + i % 26));
+    expected += data;
+    buffers.push_back(Buffer::FromString(std::move(data)));
+  }
+  ASSERT_OK(file_->WriteVectored(buffers));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()), file_->Tell());
+  ASSERT_OK(file_->Close());
+
+  AssertFileContents(path_, expected);
+  ASSERT_RAISES(Invalid, file_->WriteVectored(buffers));
+}
+
 // ----------------------------------------------------------------------
 // File input tests
 
@@ -358,6 +377,21 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
 }
 
+TEST_F(TestReadableFile, WillNeed) {
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK(file_->WillNeed({}));
+  ASSERT_OK(file_->WillNeed({{0, 4}, {4, 4}}));
+  // Past the end of file
+  ASSERT_OK(file_->WillNeed({{6, 100}}));
+  ASSERT_RAISES(Invalid, file_->WillNeed({{-1, 4}}));
+  ASSERT_RAISES(Invalid, file_->WillNeed({{0, -4}}));
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->WillNeed({{0, 4}}));
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -460,6 +494,140 @@ TEST_F(TestReadableFile, ThreadSafety) {
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
 
+// ----------------------------------------------------------------------
+// UringReadableFile tests
+
+class TestUringReadableFile : public FileTestFixture {
+ public:
+  void MakeTestFile(int64_t size) {
+    data_.resize(static_cast<size_t>(size));
+    random_bytes(size, 0, data_.data());
+    ASSERT_OK_AND_ASSIGN(auto stream, FileOutputStream::Open(path_));
+    ASSERT_OK(stream->Write(data_.data(), size));
+    ASSERT_OK(stream->Close());
+  }
+
+  void AssertBufferEqual(const std::shared_ptr<Buffer>& buffer, int64_t offset,
+                         int64_t length) {
+    ASSERT_EQ(buffer->size(), length);
+    ASSERT_EQ(0, memcmp(buffer->data(), data_.data() + offset, length));
+  }
+
+  void CheckReads(UringReadableFile* file) {
+    const auto size = static_cast<int64_t>(data_.size());
+    ASSERT_OK_AND_EQ(size, file->GetSize());
+
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(10, 1000));
+    AssertBufferEqual(buffer, 10, 1000);
+    ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(size - 5, 100));
+    AssertBufferEqual(buffer, size - 5, 5);
+    ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(size + 5, 100));
+    AssertBufferEqual(buffer, 0, 0);
+
+    std::vector<uint8_t> out(100);
+    ASSERT_OK_AND_EQ(100, file->ReadAt(4097, 100, out.data()));
+    ASSERT_EQ(0, memcmp(out.data(), data_.data() + 4097, 100));
+
+    ASSERT_OK_AND_ASSIGN(
+        auto buffers,
+        file->ReadRanges({{0, 10}, {5000, 0}, {4090, 20}, {100, size}, {size, 10}}));
+    ASSERT_EQ(buffers.size(), 5);
+    AssertBufferEqual(buffers[0], 0, 10);
+    AssertBufferEqual(buffers[1], 0, 0);
+    AssertBufferEqual(buffers[2], 4090, 20);
+    AssertBufferEqual(buffers[3], 100, size - 100);
+    AssertBufferEqual(buffers[4], 0, 0);
+    ASSERT_RAISES(Invalid, file->ReadRanges({{0, 10}, {-1, 10}}));
+
+    // Sequential reads
+    ASSERT_OK(file->Seek(size - 20));
+    ASSERT_OK_AND_ASSIGN(buffer, file->Read(10));
+    AssertBufferEqual(buffer, size - 20, 10);
+    ASSERT_OK_AND_EQ(10, file->Read(100, out.data()));
+    ASSERT_EQ(0, memcmp(out.data(), data_.data() + size - 10, 10));
+    ASSERT_OK_AND_EQ(size, file->Tell());
+
+    ASSERT_OK(file->Close());
+    ASSERT_TRUE(file->closed());
+    ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+    ASSERT_RAISES(Invalid, file->ReadRanges({{0, 1}}));
+  }
+
+ protected:
+  std::vector<uint8_t> data_;
+};
+
+TEST_F(TestUringReadableFile, Reads) {
+  MakeTestFile(20000);
+  ASSERT_OK_AND_ASSIGN(auto file, UringReadableFile::Open(path_));
+  CheckReads(file.get());
+}
+
+TEST_F(TestUringReadableFile, SmallQueue) {
+  MakeTestFile(20000);
+  UringReadableFileOptions options;
+  options.queue_depth = 2;
+  ASSERT_OK_AND_ASSIGN(auto file, UringReadableFile::Open(path_, options));
+
+  std::vector<ReadRange> ranges;
+  for (int64_t offset = 0; offset < 20000; offset += 1000) {
+    ranges.push_back({offset, 1000});
+  }
+  ASSERT_OK_AND_ASSIGN(auto buffers, file->ReadRanges(ranges));
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    AssertBufferEqual(buffers[i], ranges[i].offset, ranges[i].length);
+  }
+  CheckReads(file.get());
+}
+
+TEST_F(TestUringReadableFile, DirectIO) {
+  MakeTestFile(20000);
+  UringReadableFileOptions options;
+  options.direct_io = true;
+  auto maybe_file = UringReadableFile::Open(path_, options);
+  if (!maybe_file.ok()) {
+    // The filesystem of the test directory may not support direct I/O
+    ASSERT_RAISES(IOError, maybe_file.status());
+    return;
+  }
+  CheckReads(maybe_file.ValueOrDie().get());
+}
+
+TEST_F(TestUringReadableFile, ThreadSafety) {
+  MakeTestFile(100000);
+  ASSERT_OK_AND_ASSIGN(auto file, UringReadableFile::Open(path_));
+
+  std::atomic<int> correct_count(0);
+  const int niter = 200;
+  auto ReadData = [&](int64_t offset) {
+    for (int i = 0; i < niter; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto buffers, file->ReadRanges({{offset, 1000}, {0, 10}}));
+      if (0 == memcmp(data_.data() + offset, buffers[0]->data(), 1000) &&
+          0 == memcmp(data_.data(), buffers[1]->data(), 10)) {
+        correct_count += 1;
+      }
+    }
+  };
+  std::thread thread1(ReadData, 1000);
+  std::thread thread2(ReadData, 50000);
+  thread1.join();
+  thread2.join();
+  ASSERT_EQ(niter * 2, correct_count);
+}
+
+TEST_F(TestUringReadableFile, InvalidOptions) {
+  MakeTestFile(10);
+  UringReadableFileOptions options;
+  options.queue_depth = 0;
+  ASSERT_RAISES(Invalid, UringReadableFile::Open(path_, options));
+  options = UringReadableFileOptions::Defaults();
+  options.direct_io = true;
+  options.alignment = 1000;
+  ASSERT_RAISES(Invalid, UringReadableFile::Open(path_, options));
+  ASSERT_RAISES(IOError, UringReadableFile::Open("nonexistent-file"));
+}
+
 class TestPipeIO : public ::testing::Test {
  public:
   void MakePipe() {
@@ -937,6 +1105,72 @@ TEST_F(TestMemoryMappedFile, CastableToFileInterface) {
   std::shared_ptr<FileInterface> file = memory_mapped_file;
 }
 
+TEST_F(TestMemoryMappedFile, OpenWithOptions) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-options-test";
+  ASSERT_OK_AND_ASSIGN(auto rwmmap, InitMemoryMap(buffer_size, path));
+  ASSERT_OK(rwmmap->Write(buffer.data(), buffer_size));
+  ASSERT_OK(rwmmap->Close());
+
+  for (const auto advice :
+       {MemoryMapOptions::Advice::Normal, MemoryMapOptions::Advice::Sequential,
+        MemoryMapOptions::Advice::Random, MemoryMapOptions::Advice::WillNeed}) {
+    for (const bool populate : {false, true}) {
+      MemoryMapOptions options;
+      options.advice = advice;
+      options.populate = populate;
+      options.huge_pages = true;
+      ASSERT_OK_AND_ASSIGN(auto mmap,
+                           MemoryMappedFile::Open(path, FileMode::READ, options));
+      ASSERT_OK_AND_ASSIGN(auto out_buffer, mmap->ReadAt(0, buffer_size));
+      ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+      ASSERT_OK(mmap->Close());
+    }
+  }
+
+  // Options are kept when the map is resized
+  MemoryMapOptions options;
+  options.advice = MemoryMapOptions::Advice::Sequential;
+  ASSERT_OK_AND_ASSIGN(rwmmap,
+                       MemoryMappedFile::Open(path, FileMode::READWRITE, options));
+  ASSERT_OK(rwmmap->Resize(buffer_size * 2));
+  ASSERT_OK(rwmmap->WriteAt(buffer_size, buffer.data(), buffer_size));
+  ASSERT_OK_AND_ASSIGN(auto out_buffer, rwmmap->ReadAt(buffer_size, buffer_size));
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+  ASSERT_OK(rwmmap->Close());
+}
+
+TEST_F(TestMemoryMappedFile, AdviseAndWillNeed) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-will-need-test";
+  ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(buffer_size * 4, path));
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK(mmap->Write(buffer.data(), buffer_size));
+  }
+
+  ASSERT_OK(mmap->Advise(MemoryMapOptions::Advice::Random));
+  ASSERT_OK(mmap->WillNeed({}));
+  // Unaligned ranges, and ranges crossing or past the end of the map
+  ASSERT_OK(mmap->WillNeed({{1, 10}, {buffer_size + 7, buffer_size * 2}}));
+  ASSERT_OK(mmap->WillNeed({{buffer_size * 3, buffer_size * 2}}));
+  ASSERT_OK(mmap->WillNeed({{buffer_size * 10, buffer_size}}));
+  ASSERT_RAISES(Invalid, mmap->WillNeed({{-1, 10}}));
+  ASSERT_OK(mmap->Advise(MemoryMapOptions::Advice::Normal));
+
+  ASSERT_OK_AND_ASSIGN(auto out_buffer, mmap->ReadAt(buffer_size * 3, buffer_size));
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+
+  ASSERT_OK(mmap->Close());
+  ASSERT_RAISES(Invalid, mmap->WillNeed({{0, 10}}));
+  ASSERT_RAISES(Invalid, mmap->Advise(MemoryMapOptions::Advice::Random));
+}
+
 TEST_F(TestMemoryMappedFile, ThreadSafety) {
   std::string data = "foobar";
   std::string path = "ipc-multithreading-test";
@@ -19,6 +19,7 @@
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -143,11 +144,23 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       RETURN_NOT_OK(Seek(position));
       return Read(nbytes, buffer);
     }
-    tSize ret =
-        driver_->Pread(fs_, file_, static_cast<tOffset>(position),
-                       reinterpret_cast<void*>(buffer), static_cast<tSize>(nbytes));
-    CHECK_FAILURE(ret, "read");
-    return ret;
+    // Positional reads don't touch the file position, so they can run
+    // concurrently without the lock.  hdfsPread may return less than asked
+    // (e.g. at block boundaries), so loop until done or EOF.
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      tSize ret = driver_->Pread(
+          fs_, file_, static_cast<tOffset>(position + total_bytes),
+          reinterpret_cast<uint8_t*>(buffer) + total_bytes,
+          static_cast<tSize>(std::min<int64_t>(std::numeric_limits<tSize>::max(),
+                                               nbytes - total_bytes)));
+      CHECK_FAILURE(ret, "read");
+      total_bytes += ret;
+      if (ret == 0) {
+        break;
+      }
+    }
+    return total_bytes;
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
@@ -353,7 +366,27 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
-    for (auto& kv : config->extra_conf) {
+    // These are set before extra_conf, so that the latter takes precedence
+    std::unordered_map<std::string, std::string> conf;
+    if (config->short_circuit_reads) {
+      conf["dfs.client.read.shortcircuit"] = "true";
+      if (!config->domain_socket_path.empty()) {
+        conf["dfs.domain.socket.path"] = config->domain_socket_path;
+      }
+    }
+    if (config->hedged_read_threadpool_size > 0) {
+      conf["dfs.client.hedged.read.threadpool.size"] =
+          std::to_string(config->hedged_read_threadpool_size);
+      if (config->hedged_read_threshold_ms > 0) {
+        conf["dfs.client.hedged.read.threshold.millis"] =
+            std::to_string(config->hedged_read_threshold_ms);
+      }
+    }
+    for (const auto& kv : config->extra_conf) {
+      conf[kv.first] = kv.second;
+    }
+
+    for (auto& kv : conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
     }
@@ -67,7 +67,25 @@ struct HdfsConnectionConfig {
   std::unordered_map<std::string, std::string> extra_conf;
   HdfsDriver driver;
 
-  HdfsConnectionConfig() : driver(HdfsDriver::LIBHDFS) {}
+  // Short-circuit local reads: when a block is stored on the local host, read
+  // it directly from disk instead of streaming it through the datanode.
+  // Requires a UNIX domain socket shared with the datanode.
+  bool short_circuit_reads;
+  std::string domain_socket_path;
+
+  // Hedged reads: if a positional read (ReadAt) hasn't completed after
+  // hedged_read_threshold_ms, another read is started against a different
+  // replica and the first one to complete wins.  Disabled if the thread pool
+  // size is 0; a threshold of 0 keeps the HDFS client default.  Only supported
+  // by the libhdfs (JNI) driver.
+  int32_t hedged_read_threadpool_size;
+  int64_t hedged_read_threshold_ms;
+
+  HdfsConnectionConfig()
+      : driver(HdfsDriver::LIBHDFS),
+        short_circuit_reads(false),
+        hedged_read_threadpool_size(0),
+        hedged_read_threshold_ms(0) {}
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -205,7 +223,9 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   bool closed() const override;
 
   // NOTE: If you wish to read a particular range of a file in a multithreaded
-  // context, you may prefer to use ReadAt to avoid locking issues
+  // context, you may prefer to use ReadAt to avoid locking issues.  When the
+  // driver supports positional reads, ReadAt doesn't take any lock and
+  // benefits from hedged reads (see HdfsConnectionConfig).
   Result<int64_t> Read(int64_t nbytes, void* out) override;
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
@@ -33,6 +33,7 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -121,6 +122,21 @@ Result<std::shared_ptr<Buffer>> RandomAccessFile::ReadAt(int64_t position,
   return Read(nbytes);
 }
 
+std::future<Result<std::shared_ptr<Buffer>>> RandomAccessFile::ReadAsync(
+    int64_t position, int64_t nbytes) {
+  auto maybe_future = ::arrow::internal::GetIOThreadPool()->Submit(
+      [this, position, nbytes]() { return ReadAt(position, nbytes); });
+  if (!maybe_future.ok()) {
+    return internal::MakeReadyFuture<Result<std::shared_ptr<Buffer>>>(
+        maybe_future.status());
+  }
+  return std::move(maybe_future).ValueOrDie();
+}
+
+Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return Status::OK();
+}
+
 Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
   return ReadAt(position, nbytes, out).Value(bytes_read);
@@ -141,6 +157,13 @@ Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data) {
+  for (const auto& buffer : data) {
+    RETURN_NOT_OK(Write(buffer));
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 class FileSegmentReader
@@ -226,6 +249,16 @@ void CloseFromDestructor(FileInterface* file) {
   }
 }
 
+Status ValidateReadRanges(const std::vector<ReadRange>& ranges) {
+  for (const auto& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read range (offset = ", range.offset,
+                             ", length = ", range.length, ")");
+    }
+  }
+  return Status::OK();
+}
+
 #ifndef NDEBUG
 
 // Debug mode concurrency checking
@@ -19,6 +19,7 @@
 #define ARROW_IO_INTERFACES_H
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,6 +40,23 @@ struct ObjectType {
   enum type { FILE, DIRECTORY };
 };
 
+/// \brief A byte range within a file
+struct ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  friend bool operator==(const ReadRange& left, const ReadRange& right) {
+    return (left.offset == right.offset && left.length == right.length);
+  }
+  friend bool operator!=(const ReadRange& left, const ReadRange& right) {
+    return !(left == right);
+  }
+
+  bool Contains(const ReadRange& other) const {
+    return (offset <= other.offset && offset + length >= other.offset + other.length);
+  }
+};
+
 /// DEPRECATED.  Use the FileSystem API in arrow::fs instead.
 struct ARROW_EXPORT FileStatistics {
   /// Size of file, -1 if finding length is unsupported
@@ -132,6 +150,13 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write the given buffers to the stream, in order
+  ///
+  /// This is equivalent to writing each buffer in turn, which the default
+  /// implementation does.  Streams backed by a file descriptor write them
+  /// with a single gather write (writev) where possible.
+  virtual Status WriteVectored(const std::vector<std::shared_ptr<Buffer>>& data);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -248,6 +273,27 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// \return A buffer containing the bytes read, or an error
   virtual Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes);
 
+  /// \brief Read data asynchronously from given file position.
+  ///
+  /// Like ReadAt(), but return immediately with a future for the result.
+  /// The default implementation runs a blocking ReadAt() on the I/O thread
+  /// pool; subclasses may override it with a natively asynchronous read.
+  ///
+  /// The file must be kept alive until the returned future is satisfied.
+  ///
+  /// \param[in] position Where to read bytes from
+  /// \param[in] nbytes The number of bytes to read
+  /// \return A future for a buffer containing the bytes read, or an error
+  virtual std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                                 int64_t nbytes);
+
+  /// \brief Inform that the given ranges of the file will be read soon.
+  ///
+  /// This is only a hint: implementations may use it to start loading the
+  /// data in the background (e.g. with madvise() or posix_fadvise()).  The
+  /// default implementation does nothing.
+  virtual Status WillNeed(const std::vector<ReadRange>& ranges);
+
   // Deprecated APIs
 
   ARROW_DEPRECATED("Use Result-returning overload")
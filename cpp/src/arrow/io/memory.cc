@@ -374,5 +374,137 @@ Status BufferReader::DoSeek(int64_t position) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// ChunkedBufferReader
+
+ChunkedBufferReader::ChunkedBufferReader(std::vector<std::shared_ptr<Buffer>> chunks,
+                                         int64_t alignment, MemoryPool* pool)
+    : chunks_(std::move(chunks)),
+      alignment_(alignment),
+      pool_(pool),
+      size_(0),
+      position_(0),
+      is_open_(true) {
+  offsets_.reserve(chunks_.size() + 1);
+  for (const auto& chunk : chunks_) {
+    offsets_.push_back(size_);
+    size_ += chunk->size();
+  }
+  offsets_.push_back(size_);
+}
+
+Status ChunkedBufferReader::DoClose() {
+  chunks_.clear();
+  offsets_.assign(1, 0);
+  size_ = 0;
+  is_open_ = false;
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::closed() const { return !is_open_; }
+
+Status ChunkedBufferReader::CheckClosed() const {
+  if (!is_open_) {
+    return Status::Invalid("Operation forbidden on closed ChunkedBufferReader");
+  }
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::supports_zero_copy() const { return true; }
+
+size_t ChunkedBufferReader::FindChunk(int64_t position) const {
+  // Last chunk starting at or before position; empty chunks are skipped since
+  // the next chunk starts at the same offset
+  auto it = std::upper_bound(offsets_.begin(), offsets_.end(), position);
+  return static_cast<size_t>(it - offsets_.begin()) - 1;
+}
+
+Result<int64_t> ChunkedBufferReader::DoReadAt(int64_t position, int64_t nbytes,
+                                              void* out) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (nbytes < 0) {
+    return Status::IOError(
+        "Cannot read a negative number of bytes from ChunkedBufferReader.");
+  }
+  const int64_t bytes_read = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+  if (bytes_read == 0) {
+    return 0;
+  }
+  auto out_data = reinterpret_cast<uint8_t*>(out);
+  int64_t copied = 0;
+  size_t i = FindChunk(position);
+  while (copied < bytes_read) {
+    const int64_t chunk_offset = position + copied - offsets_[i];
+    const int64_t chunk_bytes =
+        std::min(bytes_read - copied, chunks_[i]->size() - chunk_offset);
+    memcpy(out_data + copied, chunks_[i]->data() + chunk_offset, chunk_bytes);
+    copied += chunk_bytes;
+    ++i;
+  }
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoReadAt(int64_t position,
+                                                              int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (nbytes < 0) {
+    return Status::IOError(
+        "Cannot read a negative number of bytes from ChunkedBufferReader.");
+  }
+  const int64_t size = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+
+  if (size > 0) {
+    const size_t i = FindChunk(position);
+    const int64_t chunk_offset = position - offsets_[i];
+    const auto address = reinterpret_cast<uintptr_t>(chunks_[i]->data() + chunk_offset);
+    if (position + size <= offsets_[i + 1] &&
+        address % static_cast<uintptr_t>(alignment_) == 0) {
+      return SliceBuffer(chunks_[i], chunk_offset, size);
+    }
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool_, size, &buffer));
+  RETURN_NOT_OK(DoReadAt(position, size, buffer->mutable_data()).status());
+  return buffer;
+}
+
+Result<int64_t> ChunkedBufferReader::DoRead(int64_t nbytes, void* out) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+  position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> ChunkedBufferReader::DoRead(int64_t nbytes) {
+  RETURN_NOT_OK(CheckClosed());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+  position_ += buffer->size();
+  return buffer;
+}
+
+Result<int64_t> ChunkedBufferReader::DoTell() const {
+  RETURN_NOT_OK(CheckClosed());
+  return position_;
+}
+
+Result<int64_t> ChunkedBufferReader::DoGetSize() {
+  RETURN_NOT_OK(CheckClosed());
+  return size_;
+}
+
+Status ChunkedBufferReader::DoSeek(int64_t position) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (position < 0 || position > size_) {
+    return Status::IOError("Seek out of bounds");
+  }
+
+  position_ = position;
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace arrow
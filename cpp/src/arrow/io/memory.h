@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -190,5 +191,54 @@ class ARROW_EXPORT BufferReader
   bool is_open_;
 };
 
+/// \class ChunkedBufferReader
+/// \brief Random access reads on a sequence of arrow::Buffers, as if they
+/// were concatenated
+///
+/// Reads that fall within a single chunk are zero-copy, provided the data is
+/// aligned on the given number of bytes.  Other reads copy the data into a
+/// new buffer.
+class ARROW_EXPORT ChunkedBufferReader
+    : public internal::RandomAccessFileConcurrencyWrapper<ChunkedBufferReader> {
+ public:
+  explicit ChunkedBufferReader(std::vector<std::shared_ptr<Buffer>> chunks,
+                               int64_t alignment = 1,
+                               MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  bool closed() const override;
+
+  bool supports_zero_copy() const override;
+
+  const std::vector<std::shared_ptr<Buffer>>& chunks() const { return chunks_; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<ChunkedBufferReader>;
+
+  Status DoClose();
+
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  Result<int64_t> DoTell() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoGetSize();
+
+  inline Status CheckClosed() const;
+
+  // Index of the chunk containing the given position (< size_)
+  size_t FindChunk(int64_t position) const;
+
+  std::vector<std::shared_ptr<Buffer>> chunks_;
+  // Start offset of each chunk, followed by the total size
+  std::vector<int64_t> offsets_;
+  int64_t alignment_;
+  MemoryPool* pool_;
+  int64_t size_;
+  int64_t position_;
+  bool is_open_;
+};
+
 }  // namespace io
 }  // namespace arrow
@@ -21,10 +21,12 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/buffer.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/slow.h"
@@ -32,6 +34,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 
 namespace arrow {
@@ -208,6 +211,64 @@ TEST(TestBufferReader, RetainParentReference) {
   ASSERT_EQ(0, std::memcmp(slice2->data(), data.c_str() + 4, 6));
 }
 
+TEST(TestChunkedBufferReader, Basics) {
+  std::string data = "data1data2data3data4";
+  std::vector<std::shared_ptr<Buffer>> chunks = {
+      Buffer::FromString(data.substr(0, 5)), Buffer::FromString(""),
+      Buffer::FromString(data.substr(5, 10)), Buffer::FromString(data.substr(15))};
+  ChunkedBufferReader reader(chunks);
+  ASSERT_TRUE(reader.supports_zero_copy());
+  ASSERT_OK_AND_EQ(20, reader.GetSize());
+
+  // Within a chunk: zero-copy
+  ASSERT_OK_AND_ASSIGN(auto buf, reader.ReadAt(6, 4));
+  AssertBufferEqual(*buf, "ata2");
+  ASSERT_EQ(buf->data(), chunks[2]->data() + 1);
+
+  // Across chunks: copied
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(3, 14));
+  AssertBufferEqual(*buf, "a1data2data3da");
+
+  // Past the end
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(17, 10));
+  AssertBufferEqual(*buf, "ta4");
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(20, 10));
+  ASSERT_EQ(buf->size(), 0);
+
+  std::string out(20, '\0');
+  ASSERT_OK_AND_EQ(20, reader.ReadAt(0, 25, &out[0]));
+  ASSERT_EQ(out, data);
+
+  // Streaming reads
+  ASSERT_OK(reader.Seek(2));
+  ASSERT_OK_AND_ASSIGN(buf, reader.Read(5));
+  AssertBufferEqual(*buf, "ta1da");
+  ASSERT_OK_AND_EQ(7, reader.Tell());
+  ASSERT_OK_AND_EQ(4, reader.Read(4, &out[0]));
+  ASSERT_EQ(out.substr(0, 4), "ta2d");
+
+  ASSERT_OK(reader.Close());
+  ASSERT_TRUE(reader.closed());
+  ASSERT_RAISES(Invalid, reader.ReadAt(0, 1));
+}
+
+TEST(TestChunkedBufferReader, Alignment) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateBuffer(64, &buffer));
+  std::memset(buffer->mutable_data(), 0, 64);
+  ChunkedBufferReader reader({SliceBuffer(buffer, 0, 32), SliceBuffer(buffer, 32, 32)},
+                             /*alignment=*/8);
+
+  ASSERT_OK_AND_ASSIGN(auto buf, reader.ReadAt(8, 16));
+  ASSERT_EQ(buf->data(), buffer->data() + 8);
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(40, 16));
+  ASSERT_EQ(buf->data(), buffer->data() + 40);
+  // Misaligned data is copied
+  ASSERT_OK_AND_ASSIGN(buf, reader.ReadAt(4, 16));
+  ASSERT_NE(buf->data(), buffer->data() + 4);
+  ASSERT_EQ(buf->size(), 16);
+}
+
 TEST(TestRandomAccessFile, GetStream) {
   std::string data = "data1data2data3data4data5";
 
@@ -263,6 +324,25 @@ TEST(TestRandomAccessFile, GetStream) {
   ASSERT_RAISES(IOError, stream1->Read(1, buf3));
 }
 
+TEST(TestRandomAccessFile, ReadAsync) {
+  std::string data = "data1data2data3data4data5";
+
+  auto buf = std::make_shared<Buffer>(data);
+  auto file = std::make_shared<BufferReader>(buf);
+
+  auto fut1 = file->ReadAsync(1, 10);
+  auto fut2 = file->ReadAsync(20, 10);
+
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK_AND_ASSIGN(out, fut1.get());
+  AssertBufferEqual(*out, "ata1data2d");
+  ASSERT_OK_AND_ASSIGN(out, fut2.get());
+  AssertBufferEqual(*out, "data5");
+
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAsync(1, 10).get());
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
 #if defined(ARROW_VALGRIND)
   // Compensate for Valgrind's slowness
@@ -355,5 +435,186 @@ TEST(TestInputStreamIterator, Closed) {
   ASSERT_RAISES(Invalid, it.Next().status());
 }
 
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges,
+                  std::vector<ReadRange> expected) -> void {
+    const int64_t hole_size_limit = 9;
+    const int64_t range_size_limit = 99;
+    auto coalesced =
+        internal::CoalesceReadRanges(ranges, hole_size_limit, range_size_limit);
+    ASSERT_EQ(coalesced, expected);
+  };
+
+  check({}, {});
+  // Zero sized range that ends up in empty list
+  check({{110, 0}}, {});
+  // Combination on 1 zero sized range and 1 non-zero sized range
+  check({{110, 10}, {120, 0}}, {{110, 10}});
+  // 1 non-zero sized range
+  check({{110, 10}}, {{110, 10}});
+  // No holes + unordered ranges
+  check({{130, 10}, {110, 10}, {120, 10}}, {{110, 30}});
+  // No holes
+  check({{110, 10}, {120, 10}, {130, 10}}, {{110, 30}});
+  // Small holes only
+  check({{110, 11}, {130, 0}, {130, 10}, {145, 10}}, {{110, 45}});
+  // Large holes
+  check({{110, 10}, {130, 10}}, {{110, 10}, {130, 10}});
+  check({{110, 11}, {130, 0}, {130, 10}, {145, 10}, {165, 10}},
+        {{110, 45}, {165, 10}});
+  // With range size limit
+  check({{110, 20}, {130, 20}, {150, 20}, {170, 20}, {190, 20}, {210, 20}},
+        {{110, 80}, {190, 40}});
+  check({{110, 50}, {160, 50}}, {{110, 50}, {160, 50}});
+  check({{110, 200}}, {{110, 200}});
+}
+
+TEST(RangeReadCache, Basics) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer::FromString(std::move(data)));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  internal::ReadRangeCache cache(file, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}}));
+  ASSERT_OK(cache.Cache({{10, 4}, {14, 0}, {15, 4}}));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({10, 4}));
+  AssertBufferEqual(*buf, "klmn");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  // Zero-sized
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({14, 0}));
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({25, 0}));
+  AssertBufferEqual(*buf, "");
+
+  // Non-cached ranges
+  ASSERT_RAISES(Invalid, cache.Read({20, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({19, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({0, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({25, 2}));
+}
+
+class TestCachedRandomAccessFile : public ::testing::Test {
+ public:
+  void SetUp() override {
+    raw_ = std::make_shared<BufferReader>(Buffer::FromString(std::string(data_)));
+    options_ = BlockCacheOptions::Defaults();
+    options_.block_size = 4;
+    options_.memory_capacity = 12;
+  }
+
+  void AssertReadAt(RandomAccessFile* file, int64_t position, int64_t nbytes) {
+    const auto expected = data_.substr(position, nbytes);
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buf, expected);
+    std::string out(nbytes, '\0');
+    ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()),
+                     file->ReadAt(position, nbytes, &out[0]));
+    ASSERT_EQ(expected, out.substr(0, expected.size()));
+  }
+
+ protected:
+  std::string data_ = "abcdefghijklmnopqrstuvwxyz";
+  std::shared_ptr<BufferReader> raw_;
+  BlockCacheOptions options_;
+};
+
+TEST_F(TestCachedRandomAccessFile, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto cache, BlockCache::Make(options_));
+  ASSERT_OK_AND_ASSIGN(auto file, CachedRandomAccessFile::Make(raw_, cache));
+  ASSERT_OK_AND_EQ(26, file->GetSize());
+
+  // Straddling blocks 0 and 1, both missing
+  AssertReadAt(file.get(), 2, 6);
+  ASSERT_EQ(2, cache->misses());
+  ASSERT_EQ(2, cache->hits());  // The second read in AssertReadAt
+  AssertReadAt(file.get(), 4, 4);
+  ASSERT_EQ(2, cache->misses());
+  // Last block is shorter
+  AssertReadAt(file.get(), 22, 10);
+  AssertReadAt(file.get(), 26, 10);
+  ASSERT_LE(cache->memory_usage(), options_.memory_capacity);
+  // Block 0 was evicted
+  AssertReadAt(file.get(), 0, 1);
+  ASSERT_EQ(5, cache->misses());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, file->Read(3));
+  AssertBufferEqual(*buf, "abc");
+  ASSERT_OK(file->Seek(24));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(3));
+  AssertBufferEqual(*buf, "yz");
+  ASSERT_OK_AND_EQ(26, file->Tell());
+  ASSERT_RAISES(IOError, file->ReadAt(27, 1));
+  ASSERT_RAISES(IOError, file->Seek(27));
+
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(file->closed());
+  ASSERT_TRUE(raw_->closed());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+}
+
+TEST_F(TestCachedRandomAccessFile, SharedBetweenFiles) {
+  ASSERT_OK_AND_ASSIGN(auto cache, BlockCache::Make(options_));
+  ASSERT_OK_AND_ASSIGN(auto file1, CachedRandomAccessFile::Make(raw_, cache, "key"));
+  ASSERT_OK_AND_ASSIGN(auto file2, CachedRandomAccessFile::Make(raw_, cache, "key"));
+  ASSERT_OK_AND_ASSIGN(auto file3, CachedRandomAccessFile::Make(raw_, cache));
+
+  AssertReadAt(file1.get(), 8, 8);
+  ASSERT_EQ(2, cache->misses());
+  // Same cache key: same blocks
+  AssertReadAt(file2.get(), 9, 6);
+  ASSERT_EQ(2, cache->misses());
+  // Anonymous key: different blocks
+  AssertReadAt(file3.get(), 9, 6);
+  ASSERT_EQ(4, cache->misses());
+  ASSERT_EQ(options_.memory_capacity, cache->memory_usage());
+}
+
+TEST_F(TestCachedRandomAccessFile, DiskTier) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, ::arrow::internal::TemporaryDir::Make("cache-"));
+  options_.memory_capacity = 4;
+  options_.disk_directory = temp_dir->path().ToString();
+  options_.disk_capacity = 16;
+  ASSERT_OK_AND_ASSIGN(auto cache, BlockCache::Make(options_));
+  ASSERT_OK_AND_ASSIGN(auto file, CachedRandomAccessFile::Make(raw_, cache));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 26));
+  AssertBufferEqual(*buf, data_);
+  ASSERT_EQ(7, cache->misses());
+  ASSERT_EQ(2, cache->memory_usage());
+  ASSERT_EQ(16, cache->disk_usage());
+  // Blocks 2 to 5 are on disk, blocks 0 and 1 were dropped
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(9, 14));
+  AssertBufferEqual(*buf, data_.substr(9, 14));
+  ASSERT_EQ(7, cache->misses());
+  ASSERT_EQ(4, cache->hits());
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1, 2));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(8, cache->misses());
+
+  cache.reset();
+  file.reset();
+  ASSERT_OK_AND_ASSIGN(auto files, ::arrow::internal::ListDir(temp_dir->path()));
+  ASSERT_EQ(0, files.size());
+}
+
+TEST(BlockCache, InvalidOptions) {
+  auto options = BlockCacheOptions::Defaults();
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, BlockCache::Make(options));
+}
+
 }  // namespace io
 }  // namespace arrow
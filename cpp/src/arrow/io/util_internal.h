@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <future>
+#include <utility>
+#include <vector>
+
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
@@ -26,6 +30,17 @@ namespace internal {
 
 ARROW_EXPORT void CloseFromDestructor(FileInterface* file);
 
+/// \brief Check that the ranges have a non-negative offset and length
+ARROW_EXPORT Status ValidateReadRanges(const std::vector<ReadRange>& ranges);
+
+/// \brief Return a future that is already satisfied with the given value
+template <typename T>
+std::future<T> MakeReadyFuture(T value) {
+  std::promise<T> promise;
+  promise.set_value(std::move(value));
+  return promise.get_future();
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -24,6 +24,7 @@
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -134,6 +135,26 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::AddDictionaryDelta(int64_t id,
+                                          const std::shared_ptr<Array>& dictionary,
+                                          MemoryPool* pool) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("No dictionary with id ", id, " to apply a delta to");
+  }
+  return Concatenate({it->second, dictionary}, pool, &it->second);
+}
+
+Status DictionaryMemo::UpdateDictionary(int64_t id,
+                                        const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("Dictionary with id ", id, " not found");
+  }
+  it->second = dictionary;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
@@ -180,5 +201,51 @@ Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
   return collector.Collect(batch);
 }
 
+// Unlike DictionaryCollector, walks the fields of a given schema rather than
+// those of the batch, so that batches with an equal but distinct schema find
+// the ids assigned to the fields of the first one
+struct DictionaryGatherer {
+  const DictionaryMemo& dictionary_memo_;
+  DictionaryVector* out_;
+
+  Status WalkChildren(const DataType& type, const Array& array) {
+    for (int i = 0; i < type.num_children(); ++i) {
+      auto boxed_child = MakeArray(array.data()->child_data[i]);
+      RETURN_NOT_OK(Visit(*type.child(i), *boxed_child));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const Field& field, const Array& array) {
+    const auto& type = *field.type();
+    if (type.id() == Type::DICTIONARY) {
+      auto dictionary = static_cast<const DictionaryArray&>(array).dictionary();
+      int64_t id = -1;
+      RETURN_NOT_OK(dictionary_memo_.GetId(field, &id));
+      out_->emplace_back(id, dictionary);
+
+      const auto& dict_type = static_cast<const DictionaryType&>(type);
+      RETURN_NOT_OK(WalkChildren(*dict_type.value_type(), *dictionary));
+    } else {
+      RETURN_NOT_OK(WalkChildren(type, array));
+    }
+    return Status::OK();
+  }
+
+  Status Gather(const Schema& schema, const RecordBatch& batch) {
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      RETURN_NOT_OK(Visit(*schema.field(i), *batch.column(i)));
+    }
+    return Status::OK();
+  }
+};
+
+Status GetDictionaries(const Schema& schema, const RecordBatch& batch,
+                       const DictionaryMemo& memo, DictionaryVector* out) {
+  out->clear();
+  DictionaryGatherer gatherer{memo, out};
+  return gatherer.Gather(schema, batch);
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -23,6 +23,8 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -33,11 +35,14 @@ namespace arrow {
 class Array;
 class DataType;
 class Field;
+class MemoryPool;
 class RecordBatch;
+class Schema;
 
 namespace ipc {
 
 using DictionaryMap = std::unordered_map<int64_t, std::shared_ptr<Array>>;
+using DictionaryVector = std::vector<std::pair<int64_t, std::shared_ptr<Array>>>;
 
 /// \brief Memoization data structure for assigning id numbers to
 /// dictionaries and tracking their current state through possible
@@ -77,6 +82,15 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Append a delta to the dictionary with a particular id. Returns
+  /// KeyError if there is no dictionary with that id yet
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& dictionary,
+                            MemoryPool* pool);
+
+  /// \brief Replace the dictionary with a particular id. Returns KeyError
+  /// if there is no dictionary with that id yet
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of fields tracked in the memo
@@ -100,6 +114,12 @@ class ARROW_EXPORT DictionaryMemo {
 ARROW_EXPORT
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo);
 
+/// \brief Gather the dictionaries of a record batch with the schema
+/// `schema`, whose fields have already been assigned ids in the memo
+ARROW_EXPORT
+Status GetDictionaries(const Schema& schema, const RecordBatch& batch,
+                       const DictionaryMemo& memo, DictionaryVector* out);
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -17,9 +17,11 @@
 
 #include "arrow/ipc/feather.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
 #include <utility>
@@ -31,7 +33,11 @@
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/feather_internal.h"
+#include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/util.h"  // IWYU pragma: keep
+#include "arrow/ipc/writer.h"
 #include "arrow/status.h"
 #include "arrow/table.h"  // IWYU pragma: keep
 #include "arrow/type.h"
@@ -271,6 +277,86 @@ std::unique_ptr<ColumnBuilder> TableBuilder::AddColumn(const std::string& name)
 // ----------------------------------------------------------------------
 // reader.cc
 
+// Reader of version 2 files, which are Arrow IPC files
+class TableReaderV2 {
+ public:
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& source) {
+    RETURN_NOT_OK(RecordBatchFileReader::Open(source, &reader_));
+    schema_ = reader_->schema();
+
+    // Reading no column only reads the metadata of the record batches
+    num_rows_ = 0;
+    for (int i = 0; i < reader_->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader_->ReadRecordBatch(i, std::vector<int>{}, &batch));
+      num_rows_ += batch->num_rows();
+    }
+    return Status::OK();
+  }
+
+  int64_t num_rows() const { return num_rows_; }
+  int64_t num_columns() const { return schema_->num_fields(); }
+
+  std::string GetColumnName(int i) const { return schema_->field(i)->name(); }
+
+  Status GetColumn(int i, std::shared_ptr<ChunkedArray>* out) {
+    if (i < 0 || i >= num_columns()) {
+      return Status::Invalid("Column index ", i, " out of bounds");
+    }
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(ReadColumns({i}, &table));
+    *out = table->column(0);
+    return Status::OK();
+  }
+
+  Status Read(std::shared_ptr<Table>* out) {
+    std::vector<int> field_indices(num_columns());
+    std::iota(field_indices.begin(), field_indices.end(), 0);
+    return ReadColumns(field_indices, out);
+  }
+
+  // As with version 1 files, the columns are read in file order and unknown
+  // columns are ignored
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    std::vector<int> field_indices;
+    for (int i = 0; i < num_columns(); ++i) {
+      if (std::find(indices.begin(), indices.end(), i) != indices.end()) {
+        field_indices.push_back(i);
+      }
+    }
+    return ReadColumns(field_indices, out);
+  }
+
+  Status Read(const std::vector<std::string>& names, std::shared_ptr<Table>* out) {
+    std::vector<int> field_indices;
+    for (int i = 0; i < num_columns(); ++i) {
+      if (std::find(names.begin(), names.end(), GetColumnName(i)) != names.end()) {
+        field_indices.push_back(i);
+      }
+    }
+    return ReadColumns(field_indices, out);
+  }
+
+ private:
+  // Only the buffers of the given columns are read
+  Status ReadColumns(const std::vector<int>& field_indices, std::shared_ptr<Table>* out) {
+    std::vector<std::shared_ptr<RecordBatch>> batches(reader_->num_record_batches());
+    for (int i = 0; i < reader_->num_record_batches(); ++i) {
+      RETURN_NOT_OK(reader_->ReadRecordBatch(i, field_indices, &batches[i]));
+    }
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i : field_indices) {
+      fields.push_back(schema_->field(i));
+    }
+    return Table::FromRecordBatches(::arrow::schema(fields, schema_->metadata()),
+                                    batches, out);
+  }
+
+  std::shared_ptr<RecordBatchFileReader> reader_;
+  std::shared_ptr<Schema> schema_;
+  int64_t num_rows_;
+};
+
 class TableReader::TableReaderImpl {
  public:
   TableReaderImpl() {}
@@ -287,7 +373,15 @@ class TableReader::TableReaderImpl {
       return Status::Invalid("File is too small to be a well-formed file");
     }
 
-    ARROW_ASSIGN_OR_RAISE(auto buffer, source->ReadAt(0, magic_size));
+    const int ipc_magic_size = static_cast<int>(strlen(internal::kArrowMagicBytes));
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          source->ReadAt(0, std::max(magic_size, ipc_magic_size)));
+
+    if (buffer->size() >= ipc_magic_size &&
+        !memcmp(buffer->data(), internal::kArrowMagicBytes, ipc_magic_size)) {
+      v2_.reset(new TableReaderV2());
+      return v2_->Open(source);
+    }
 
     if (memcmp(buffer->data(), kFeatherMagicBytes, magic_size)) {
       return Status::Invalid("Not a feather file");
@@ -392,7 +486,9 @@ class TableReader::TableReaderImpl {
     std::vector<std::shared_ptr<Buffer>> buffers;
 
     // Buffer data from the source (may or may not perform a copy depending on
-    // input source)
+    // input source).  With memory maps, the slice is only paged in when accessed:
+    // have it loaded in the background rather than stall on page faults then.
+    RETURN_NOT_OK(source_->WillNeed({{meta->offset(), meta->total_bytes()}}));
     ARROW_ASSIGN_OR_RAISE(auto buffer,
                           source_->ReadAt(meta->offset(), meta->total_bytes()));
 
@@ -426,20 +522,31 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
-  bool HasDescription() const { return metadata_->HasDescription(); }
+  // Version 2 files have no description
+  bool HasDescription() const { return v2_ ? false : metadata_->HasDescription(); }
 
-  std::string GetDescription() const { return metadata_->GetDescription(); }
+  std::string GetDescription() const {
+    return v2_ ? std::string() : metadata_->GetDescription();
+  }
 
-  int version() const { return metadata_->version(); }
-  int64_t num_rows() const { return metadata_->num_rows(); }
-  int64_t num_columns() const { return metadata_->num_columns(); }
+  int version() const { return v2_ ? kFeatherV2Version : metadata_->version(); }
+  int64_t num_rows() const { return v2_ ? v2_->num_rows() : metadata_->num_rows(); }
+  int64_t num_columns() const {
+    return v2_ ? v2_->num_columns() : metadata_->num_columns();
+  }
 
   std::string GetColumnName(int i) const {
+    if (v2_) {
+      return v2_->GetColumnName(i);
+    }
     const fbs::Column* col_meta = metadata_->column(i);
     return col_meta->name()->str();
   }
 
   Status GetColumn(int i, std::shared_ptr<ChunkedArray>* out) {
+    if (v2_) {
+      return v2_->GetColumn(i, out);
+    }
     const fbs::Column* col_meta = metadata_->column(i);
 
     // auto user_meta = column->user_metadata();
@@ -453,6 +560,9 @@ class TableReader::TableReaderImpl {
   }
 
   Status Read(std::shared_ptr<Table>* out) {
+    if (v2_) {
+      return v2_->Read(out);
+    }
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
     for (int i = 0; i < num_columns(); ++i) {
@@ -466,6 +576,9 @@ class TableReader::TableReaderImpl {
   }
 
   Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    if (v2_) {
+      return v2_->Read(indices, out);
+    }
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
     for (int i = 0; i < num_columns(); ++i) {
@@ -489,6 +602,9 @@ class TableReader::TableReaderImpl {
   }
 
   Status Read(const std::vector<std::string>& names, std::shared_ptr<Table>* out) {
+    if (v2_) {
+      return v2_->Read(names, out);
+    }
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
     for (int i = 0; i < num_columns(); ++i) {
@@ -517,6 +633,9 @@ class TableReader::TableReaderImpl {
   std::unique_ptr<TableMetadata> metadata_;
 
   std::shared_ptr<Schema> schema_;
+
+  // Set for version 2 files, which have no TableMetadata
+  std::unique_ptr<TableReaderV2> v2_;
 };
 
 // ----------------------------------------------------------------------
@@ -889,6 +1008,68 @@ Status TableWriter::Write(const Table& table) { return impl_->Write(table); }
 
 Status TableWriter::Finalize() { return impl_->Finalize(); }
 
+// ----------------------------------------------------------------------
+// WriteTable
+
+WriteProperties WriteProperties::Defaults() {
+  WriteProperties properties;
+  if (util::Codec::IsAvailable(Compression::LZ4)) {
+    properties.compression = Compression::LZ4;
+  }
+  return properties;
+}
+
+static Status WriteTableV1(const Table& table,
+                           const std::shared_ptr<io::OutputStream>& stream,
+                           const WriteProperties& properties) {
+  if (properties.compression != Compression::UNCOMPRESSED) {
+    return Status::Invalid("Feather version 1 files cannot be compressed");
+  }
+  std::unique_ptr<TableWriter> writer;
+  RETURN_NOT_OK(TableWriter::Open(stream, &writer));
+  writer->SetNumRows(table.num_rows());
+  RETURN_NOT_OK(writer->Write(table));
+  return writer->Finalize();
+}
+
+static Status WriteTableV2(const Table& table,
+                           const std::shared_ptr<io::OutputStream>& stream,
+                           const WriteProperties& properties) {
+  if (properties.chunksize <= 0) {
+    return Status::Invalid("Chunk size must be positive, got ", properties.chunksize);
+  }
+  IpcOptions options = IpcOptions::Defaults();
+  options.compression = properties.compression;
+  options.compression_level = properties.compression_level;
+  options.emit_dictionary_deltas = true;
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto writer, RecordBatchFileWriter::Open(stream.get(), table.schema(), options));
+  TableBatchReader batches(table);
+  batches.set_chunksize(properties.chunksize);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(batches.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+Status WriteTable(const Table& table, const std::shared_ptr<io::OutputStream>& stream,
+                  const WriteProperties& properties) {
+  switch (properties.version) {
+    case kFeatherV1Version:
+      return WriteTableV1(table, stream, properties);
+    case kFeatherV2Version:
+      return WriteTableV2(table, stream, properties);
+    default:
+      return Status::Invalid("Unsupported Feather version ", properties.version);
+  }
+}
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
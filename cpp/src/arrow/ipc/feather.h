@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -47,6 +48,11 @@ namespace feather {
 
 static constexpr const int kFeatherVersion = 2;
 
+/// The original Feather layout, described by feather.fbs
+static constexpr const int kFeatherV1Version = 2;
+/// The Arrow IPC file format, with optional compression of the buffers
+static constexpr const int kFeatherV2Version = 3;
+
 // ----------------------------------------------------------------------
 // Metadata accessor classes
 
@@ -73,7 +79,8 @@ class ARROW_EXPORT TableReader {
   /// \brief Return true if the table has a description field populated
   bool HasDescription() const;
 
-  /// \brief Return the version number of the Feather file
+  /// \brief Return the version number of the Feather file, kFeatherV2Version
+  /// for Arrow IPC files
   int version() const;
 
   /// \brief Return the number of rows in the file
@@ -166,6 +173,41 @@ class ARROW_EXPORT TableWriter {
   std::unique_ptr<TableWriterImpl> impl_;
 };
 
+struct ARROW_EXPORT WriteProperties {
+  static WriteProperties Defaults();
+
+  /// \brief Feather file version, kFeatherV2Version or kFeatherV1Version
+  int version = kFeatherV2Version;
+
+  /// \brief The maximum number of rows of each record batch, only used by
+  /// version 2 files. Columns with more rows, or chunked differently, are
+  /// split into several record batches
+  int64_t chunksize = 1LL << 16;
+
+  /// \brief Codec compressing the buffers of version 2 files, UNCOMPRESSED,
+  /// LZ4 or ZSTD. Defaults() uses LZ4 when it is available
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// \brief Compression level to pass to the codec
+  int compression_level = util::kUseDefaultCompressionLevel;
+};
+
+/// \brief Write a table to a Feather file
+///
+/// Version 2 files are Arrow IPC files, which TableReader and any IPC file
+/// reader can read. They support all the types and chunked columns, unlike
+/// version 1 files. The dictionaries of a dictionary-encoded column must be
+/// the same in all its chunks, or extend the dictionary of the previous
+/// chunk.
+///
+/// \param[in] table the table to write
+/// \param[in] stream the output stream
+/// \param[in] properties the file version and compression to use
+/// \return Status
+ARROW_EXPORT
+Status WriteTable(const Table& table, const std::shared_ptr<io::OutputStream>& stream,
+                  const WriteProperties& properties = WriteProperties::Defaults());
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
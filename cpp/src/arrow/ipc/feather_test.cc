@@ -33,6 +33,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 
 #include "generated/feather_generated.h"
 
@@ -565,6 +566,91 @@ INSTANTIATE_TEST_CASE_P(TestTableWriterSliceOffsets, TestTableWriterSlice,
                                                              304, 305, 306, 307),
                                            ::testing::Values(0, 1, 7, 8, 30, 32, 100)));
 
+// ----------------------------------------------------------------------
+// Version 2 files
+
+class TestWriteTable : public ::testing::Test {
+ public:
+  void SetUp() {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(ipc::test::MakeIntBatchSized(600, &batch));
+    ASSERT_OK(Table::FromRecordBatches({batch}, &table_));
+  }
+
+  void WriteAndOpen(const WriteProperties& properties) {
+    ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create(1024));
+    ASSERT_OK(WriteTable(*table_, stream, properties));
+    ASSERT_OK_AND_ASSIGN(auto output, stream->Finish());
+    ASSERT_OK(TableReader::Open(std::make_shared<io::BufferReader>(output), &reader_));
+  }
+
+ protected:
+  std::shared_ptr<Table> table_;
+  std::unique_ptr<TableReader> reader_;
+};
+
+TEST_F(TestWriteTable, V2RoundTrip) {
+  std::vector<Compression::type> compressions = {Compression::UNCOMPRESSED};
+  for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+    if (util::Codec::IsAvailable(compression)) {
+      compressions.push_back(compression);
+    }
+  }
+  for (auto compression : compressions) {
+    WriteProperties properties;
+    properties.compression = compression;
+    properties.chunksize = 100;
+    WriteAndOpen(properties);
+
+    ASSERT_EQ(kFeatherV2Version, reader_->version());
+    ASSERT_FALSE(reader_->HasDescription());
+    ASSERT_EQ(600, reader_->num_rows());
+    ASSERT_EQ(table_->num_columns(), reader_->num_columns());
+    ASSERT_EQ("f1", reader_->GetColumnName(1));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader_->Read(&result));
+    ASSERT_EQ(6, result->column(0)->num_chunks());
+    AssertTablesEqual(*table_, *result, /*same_chunk_layout=*/false);
+
+    std::shared_ptr<ChunkedArray> column;
+    ASSERT_OK(reader_->GetColumn(1, &column));
+    AssertChunkedEqual(*table_->column(1), *column);
+  }
+}
+
+TEST_F(TestWriteTable, V2ReadSelectedColumns) {
+  WriteProperties properties;
+  properties.chunksize = 250;
+  WriteAndOpen(properties);
+
+  // Columns are returned in file order and unknown columns are ignored
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->Read(std::vector<int>{1, 0, 5}, &result));
+  AssertTablesEqual(*table_, *result, /*same_chunk_layout=*/false);
+
+  ASSERT_OK(reader_->Read(std::vector<std::string>{"f1", "unknown"}, &result));
+  ASSERT_EQ(1, result->num_columns());
+  ASSERT_EQ("f1", result->field(0)->name());
+  AssertChunkedEqual(*table_->column(1), *result->column(0));
+}
+
+TEST_F(TestWriteTable, V1) {
+  WriteProperties properties;
+  properties.version = kFeatherV1Version;
+  WriteAndOpen(properties);
+
+  ASSERT_EQ(kFeatherV1Version, reader_->version());
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->Read(&result));
+  AssertTablesEqual(*table_, *result);
+
+  // Version 1 files are never compressed
+  properties.compression = Compression::ZSTD;
+  ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create(1024));
+  ASSERT_RAISES(Invalid, WriteTable(*table_, stream, properties));
+}
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
@@ -472,7 +472,8 @@ class ArrayWriter {
     for (int64_t i = 0; i < arr.length(); ++i) {
       if (arr.IsValid(i)) {
         const Decimal128 value(arr.GetValue(i));
-        writer_->String(value.ToIntegerString());
+        char buffer[Decimal128::kMaxStringLength];
+        writer_->String(buffer, value.ToIntegerChars(buffer));
       } else {
         writer_->String(null_string, sizeof(null_string));
       }
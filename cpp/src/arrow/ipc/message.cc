@@ -20,17 +20,22 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 #include "arrow/util/ubsan.h"
 
 #include "generated/Message_generated.h"
@@ -44,6 +49,14 @@ class Message::MessageImpl {
                        const std::shared_ptr<Buffer>& body)
       : metadata_(metadata), message_(nullptr), body_(body) {}
 
+  MessageImpl(const std::shared_ptr<Buffer>& metadata, BufferVector body_chunks)
+      : metadata_(metadata), message_(nullptr), body_chunks_(std::move(body_chunks)) {
+    if (body_chunks_.size() == 1) {
+      body_ = body_chunks_[0];
+      body_chunks_.clear();
+    }
+  }
+
   Status Open() {
     RETURN_NOT_OK(
         internal::VerifyMessage(metadata_->data(), metadata_->size(), &message_));
@@ -81,7 +94,30 @@ class Message::MessageImpl {
 
   int64_t body_length() const { return message_->bodyLength(); }
 
-  std::shared_ptr<Buffer> body() const { return body_; }
+  std::shared_ptr<Buffer> body() const {
+    if (!body_chunks_.empty()) {
+      std::call_once(concatenate_once_, [this]() {
+        auto st = ConcatenateBuffers(body_chunks_, default_memory_pool(), &body_);
+        if (!st.ok()) {
+          ARROW_LOG(WARNING) << "Failed to concatenate IPC message body: "
+                             << st.ToString();
+        }
+      });
+    }
+    return body_;
+  }
+
+  std::unique_ptr<io::RandomAccessFile> body_reader() const {
+    if (!body_chunks_.empty()) {
+      // Arrow buffers in the body are 8-byte aligned, keep them so
+      return std::unique_ptr<io::RandomAccessFile>(
+          new io::ChunkedBufferReader(body_chunks_, /*alignment=*/8));
+    }
+    if (body_ == nullptr) {
+      return nullptr;
+    }
+    return std::unique_ptr<io::RandomAccessFile>(new io::BufferReader(body_));
+  }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
 
@@ -90,8 +126,11 @@ class Message::MessageImpl {
   std::shared_ptr<Buffer> metadata_;
   const flatbuf::Message* message_;
 
-  // The message body, if any
-  std::shared_ptr<Buffer> body_;
+  // The message body, if any.  If the body was given in several chunks, this
+  // is their concatenation, computed on demand.
+  mutable std::shared_ptr<Buffer> body_;
+  BufferVector body_chunks_;
+  mutable std::once_flag concatenate_once_;
 };
 
 Message::Message(const std::shared_ptr<Buffer>& metadata,
@@ -99,16 +138,29 @@ Message::Message(const std::shared_ptr<Buffer>& metadata,
   impl_.reset(new MessageImpl(metadata, body));
 }
 
+Message::Message(std::unique_ptr<MessageImpl> impl) : impl_(std::move(impl)) {}
+
 Status Message::Open(const std::shared_ptr<Buffer>& metadata,
                      const std::shared_ptr<Buffer>& body, std::unique_ptr<Message>* out) {
   out->reset(new Message(metadata, body));
   return (*out)->impl_->Open();
 }
 
+Status Message::Open(const std::shared_ptr<Buffer>& metadata, BufferVector body_chunks,
+                     std::unique_ptr<Message>* out) {
+  out->reset(new Message(std::unique_ptr<MessageImpl>(
+      new MessageImpl(metadata, std::move(body_chunks)))));
+  return (*out)->impl_->Open();
+}
+
 Message::~Message() {}
 
 std::shared_ptr<Buffer> Message::body() const { return impl_->body(); }
 
+std::unique_ptr<io::RandomAccessFile> Message::body_reader() const {
+  return impl_->body_reader();
+}
+
 int64_t Message::body_length() const { return impl_->body_length(); }
 
 std::shared_ptr<Buffer> Message::metadata() const { return impl_->metadata(); }
@@ -162,11 +214,26 @@ Status CheckMetadataAndGetBodyLength(const Buffer& metadata, int64_t* body_lengt
 
 Status Message::ReadFrom(std::shared_ptr<Buffer> metadata, io::InputStream* stream,
                          std::unique_ptr<Message>* out) {
+  return ReadFrom(std::move(metadata), stream, /*pool=*/nullptr, out);
+}
+
+Status Message::ReadFrom(std::shared_ptr<Buffer> metadata, io::InputStream* stream,
+                         MemoryPool* pool, std::unique_ptr<Message>* out) {
   RETURN_NOT_OK(MaybeAlignMetadata(&metadata));
   int64_t body_length = -1;
   RETURN_NOT_OK(CheckMetadataAndGetBodyLength(*metadata, &body_length));
 
-  ARROW_ASSIGN_OR_RAISE(auto body, stream->Read(body_length));
+  std::shared_ptr<Buffer> body;
+  if (pool != nullptr && !stream->supports_zero_copy()) {
+    std::shared_ptr<ResizableBuffer> pool_body;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, body_length, &pool_body));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          stream->Read(body_length, pool_body->mutable_data()));
+    RETURN_NOT_OK(pool_body->Resize(bytes_read, /*shrink_to_fit=*/false));
+    body = std::move(pool_body);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(body, stream->Read(body_length));
+  }
   if (body->size() < body_length) {
     return Status::IOError("Expected to be able to read ", body_length,
                            " bytes for message body, got ", body->size());
@@ -241,6 +308,20 @@ std::string FormatMessageType(Message::Type type) {
 
 Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
                    std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN("ipc", "ReadMessage");
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadMessageMetadata(offset, metadata_length, file, &metadata));
+  if (metadata == nullptr) {
+    // EOS
+    *message = nullptr;
+    return Status::OK();
+  }
+  return Message::ReadFrom(offset + metadata_length, metadata, file, message);
+}
+
+Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                           io::RandomAccessFile* file,
+                           std::shared_ptr<Buffer>* metadata) {
   ARROW_CHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t))
       << "metadata_length should be at least 4";
 
@@ -276,7 +357,7 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
 
   if (flatbuffer_length == 0) {
     // EOS
-    *message = nullptr;
+    *metadata = nullptr;
     return Status::OK();
   }
 
@@ -286,9 +367,8 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
                            ", metadata length: ", metadata_length);
   }
 
-  std::shared_ptr<Buffer> metadata =
-      SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
-  return Message::ReadFrom(offset + metadata_length, metadata, file, message);
+  *metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  return MaybeAlignMetadata(metadata);
 }
 
 Status AlignStream(io::InputStream* stream, int32_t alignment) {
@@ -318,7 +398,8 @@ Status CheckAligned(io::FileInterface* stream, int32_t alignment) {
 namespace {
 
 Status ReadMessage(io::InputStream* file, MemoryPool* pool, bool copy_metadata,
-                   std::unique_ptr<Message>* message) {
+                   MemoryPool* body_pool, std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN("ipc", "ReadMessage");
   int32_t continuation = 0;
   ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, file->Read(sizeof(int32_t), &continuation));
 
@@ -361,18 +442,19 @@ Status ReadMessage(io::InputStream* file, MemoryPool* pool, bool copy_metadata,
                            " metadata bytes, but ", "only read ", bytes_read);
   }
 
-  return Message::ReadFrom(metadata, file, message);
+  return Message::ReadFrom(metadata, file, body_pool, message);
 }
 
 }  // namespace
 
 Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* out) {
-  return ReadMessage(file, default_memory_pool(), /*copy_metadata=*/false, out);
+  return ReadMessage(file, default_memory_pool(), /*copy_metadata=*/false,
+                     /*body_pool=*/nullptr, out);
 }
 
 Status ReadMessageCopy(io::InputStream* file, MemoryPool* pool,
                        std::unique_ptr<Message>* out) {
-  return ReadMessage(file, pool, /*copy_metadata=*/true, out);
+  return ReadMessage(file, pool, /*copy_metadata=*/true, /*body_pool=*/nullptr, out);
 }
 
 Status WriteMessage(const Buffer& message, const IpcOptions& options,
@@ -413,22 +495,28 @@ Status WriteMessage(const Buffer& message, const IpcOptions& options,
 /// \brief Implementation of MessageReader that reads from InputStream
 class InputStreamMessageReader : public MessageReader {
  public:
-  explicit InputStreamMessageReader(io::InputStream* stream) : stream_(stream) {}
+  explicit InputStreamMessageReader(io::InputStream* stream,
+                                    MemoryPool* body_pool = nullptr)
+      : stream_(stream), body_pool_(body_pool) {}
 
-  explicit InputStreamMessageReader(const std::shared_ptr<io::InputStream>& owned_stream)
-      : InputStreamMessageReader(owned_stream.get()) {
+  explicit InputStreamMessageReader(const std::shared_ptr<io::InputStream>& owned_stream,
+                                    MemoryPool* body_pool = nullptr)
+      : InputStreamMessageReader(owned_stream.get(), body_pool) {
     owned_stream_ = owned_stream;
   }
 
   ~InputStreamMessageReader() {}
 
   Status ReadNextMessage(std::unique_ptr<Message>* message) {
-    return ReadMessage(stream_, message);
+    return ReadMessage(stream_, default_memory_pool(), /*copy_metadata=*/false,
+                       body_pool_, message);
   }
 
  private:
   io::InputStream* stream_;
   std::shared_ptr<io::InputStream> owned_stream_;
+  // The pool to allocate message bodies from, or null to let the stream allocate
+  MemoryPool* body_pool_;
 };
 
 std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream) {
@@ -440,5 +528,15 @@ std::unique_ptr<MessageReader> MessageReader::Open(
   return std::unique_ptr<MessageReader>(new InputStreamMessageReader(owned_stream));
 }
 
+std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream,
+                                                   MemoryPool* pool) {
+  return std::unique_ptr<MessageReader>(new InputStreamMessageReader(stream, pool));
+}
+
+std::unique_ptr<MessageReader> MessageReader::Open(
+    const std::shared_ptr<io::InputStream>& owned_stream, MemoryPool* pool) {
+  return std::unique_ptr<MessageReader>(new InputStreamMessageReader(owned_stream, pool));
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/ipc/options.h"
 #include "arrow/status.h"
@@ -84,6 +85,20 @@ class ARROW_EXPORT Message {
   static Status Open(const std::shared_ptr<Buffer>& metadata,
                      const std::shared_ptr<Buffer>& body, std::unique_ptr<Message>* out);
 
+  /// \brief Create and validate a Message instance whose body is split in
+  /// several non-contiguous chunks
+  ///
+  /// Arrays read from the message reference the chunks directly when their
+  /// buffers are each contained in a single, suitably aligned chunk.
+  ///
+  /// \param[in] metadata a buffer containing the Flatbuffer metadata
+  /// \param[in] body_chunks buffers making up the message body, in order
+  /// \param[out] out the created message
+  /// \return Status
+  static Status Open(const std::shared_ptr<Buffer>& metadata,
+                     std::vector<std::shared_ptr<Buffer>> body_chunks,
+                     std::unique_ptr<Message>* out);
+
   /// \brief Read message body and create Message given Flatbuffer metadata
   /// \param[in] metadata containing a serialized Message flatbuffer
   /// \param[in] stream an InputStream
@@ -94,6 +109,18 @@ class ARROW_EXPORT Message {
   static Status ReadFrom(std::shared_ptr<Buffer> metadata, io::InputStream* stream,
                          std::unique_ptr<Message>* out);
 
+  /// \brief Read message body and create Message given Flatbuffer metadata
+  /// \param[in] metadata containing a serialized Message flatbuffer
+  /// \param[in] stream an InputStream
+  /// \param[in] pool the pool to allocate the body from, if stream does not
+  /// support zero-copy
+  /// \param[out] out the created Message
+  /// \return Status
+  ///
+  /// \note If stream supports zero-copy, this is zero-copy
+  static Status ReadFrom(std::shared_ptr<Buffer> metadata, io::InputStream* stream,
+                         MemoryPool* pool, std::unique_ptr<Message>* out);
+
   /// \brief Read message body from position in file, and create Message given
   /// the Flatbuffer metadata
   /// \param[in] offset the position in the file where the message body starts.
@@ -119,9 +146,17 @@ class ARROW_EXPORT Message {
 
   /// \brief the Message body, if any
   ///
+  /// If the body is made of several chunks, they are concatenated on first
+  /// access; prefer body_reader() to avoid the copy.
+  ///
   /// \return buffer is null if no body
   std::shared_ptr<Buffer> body() const;
 
+  /// \brief A reader over the Message body, if any
+  ///
+  /// \return reader is null if no body
+  std::unique_ptr<io::RandomAccessFile> body_reader() const;
+
   /// \brief The expected body length according to the metadata, for
   /// verification purposes
   int64_t body_length() const;
@@ -154,6 +189,8 @@ class ARROW_EXPORT Message {
   class MessageImpl;
   std::unique_ptr<MessageImpl> impl_;
 
+  explicit Message(std::unique_ptr<MessageImpl> impl);
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(Message);
 };
 
@@ -172,6 +209,19 @@ class ARROW_EXPORT MessageReader {
   static std::unique_ptr<MessageReader> Open(
       const std::shared_ptr<io::InputStream>& owned_stream);
 
+  /// \brief Create MessageReader that reads from InputStream, allocating the
+  /// message bodies from a pool
+  ///
+  /// Unless the stream supports zero-copy, the message bodies are allocated
+  /// from the given pool. With a RecyclingMemoryPool, the buffers of consumed
+  /// record batches are reused for the next messages of the same size.
+  static std::unique_ptr<MessageReader> Open(io::InputStream* stream, MemoryPool* pool);
+
+  /// \brief Create MessageReader that reads from owned InputStream, allocating
+  /// the message bodies from a pool
+  static std::unique_ptr<MessageReader> Open(
+      const std::shared_ptr<io::InputStream>& owned_stream, MemoryPool* pool);
+
   /// \brief Read next Message from the interface
   ///
   /// \param[out] message an arrow::ipc::Message instance
@@ -197,6 +247,19 @@ ARROW_EXPORT
 Status ReadMessage(const int64_t offset, const int32_t metadata_length,
                    io::RandomAccessFile* file, std::unique_ptr<Message>* message);
 
+/// \brief Read the metadata of an encapsulated message from position in file,
+/// without reading its body
+///
+/// \param[in] offset the position in the file where the message starts. The
+/// body of the message starts at offset + metadata_length
+/// \param[in] metadata_length the total number of bytes to read from file
+/// \param[in] file the seekable file interface to read from
+/// \param[out] metadata the message flatbuffer, null at the end of stream
+/// \return Status success or failure
+ARROW_EXPORT
+Status ReadMessageMetadata(const int64_t offset, const int32_t metadata_length,
+                           io::RandomAccessFile* file, std::shared_ptr<Buffer>* metadata);
+
 /// \brief Advance stream to an 8-byte offset if its position is not a multiple
 /// of 8 already
 /// \param[in] stream an input stream
@@ -489,6 +489,21 @@ Status KeyValueMetadataFromFlatbuffer(const KVVector* fb_metadata,
   return Status::OK();
 }
 
+Status GetCompression(const flatbuf::Message* message, Compression::type* out) {
+  *out = Compression::UNCOMPRESSED;
+  if (message->custom_metadata() == nullptr) {
+    return Status::OK();
+  }
+  std::shared_ptr<KeyValueMetadata> metadata;
+  RETURN_NOT_OK(KeyValueMetadataFromFlatbuffer(message->custom_metadata(), &metadata));
+  int index = metadata->FindKey(kCompressionMetadataKey);
+  if (index != -1) {
+    ARROW_ASSIGN_OR_RAISE(*out,
+                          util::Codec::GetCompressionType(metadata->value(index)));
+  }
+  return Status::OK();
+}
+
 class FieldToFlatbufferVisitor {
  public:
   FieldToFlatbufferVisitor(FBB& fbb, DictionaryMemo* dictionary_memo)
@@ -848,12 +863,17 @@ Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema, DictionaryMemo* dictio
   return Status::OK();
 }
 
-Result<std::shared_ptr<Buffer>> WriteFBMessage(FBB& fbb,
-                                               flatbuf::MessageHeader header_type,
-                                               flatbuffers::Offset<void> header,
-                                               int64_t body_length) {
+Result<std::shared_ptr<Buffer>> WriteFBMessage(
+    FBB& fbb, flatbuf::MessageHeader header_type, flatbuffers::Offset<void> header,
+    int64_t body_length, const KeyValueMetadata* custom_metadata = NULLPTR) {
+  flatbuffers::Offset<KVVector> fb_custom_metadata;
+  if (custom_metadata != nullptr && custom_metadata->size() > 0) {
+    std::vector<KeyValueOffset> key_values;
+    AppendKeyValueMetadata(fbb, *custom_metadata, &key_values);
+    fb_custom_metadata = fbb.CreateVector(key_values);
+  }
   auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                                        body_length, fb_custom_metadata);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb);
 }
@@ -1062,12 +1082,13 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               const KeyValueMetadata* custom_metadata,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
-                        body_length)
+                        body_length, custom_metadata)
       .Value(out);
 }
 
@@ -1117,16 +1138,19 @@ Result<std::shared_ptr<Buffer>> WriteSparseTensorMessage(
                         fb_sparse_tensor.Union(), body_length);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              const KeyValueMetadata* custom_metadata,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
-                        body_length)
+                        body_length, custom_metadata)
       .Value(out);
 }
 
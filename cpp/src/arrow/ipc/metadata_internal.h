@@ -34,6 +34,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 #include "generated/Message_generated.h"
 #include "generated/Schema_generated.h"
@@ -41,6 +42,7 @@
 namespace arrow {
 
 class DataType;
+class KeyValueMetadata;
 class Schema;
 class Tensor;
 class SparseTensor;
@@ -122,6 +124,14 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
                                std::vector<std::string>* dim_names, int64_t* length,
                                SparseTensorFormat::type* sparse_tensor_format_id);
 
+// EXPERIMENTAL: Extract the body buffer compression codec recorded in the
+// Message custom_metadata, if any. UNCOMPRESSED is returned otherwise
+Status GetCompression(const flatbuf::Message* message, Compression::type* out);
+
+// EXPERIMENTAL: custom_metadata key under which the body compression codec
+// is written
+static constexpr const char* kCompressionMetadataKey = "ARROW:experimental_compression";
+
 static inline Status VerifyMessage(const uint8_t* data, int64_t size,
                                    const flatbuf::Message** out) {
   flatbuffers::Verifier verifier(data, size, /*max_depth=*/128);
@@ -145,6 +155,7 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               const KeyValueMetadata* custom_metadata,
                                std::shared_ptr<Buffer>* out);
 
 Result<std::shared_ptr<Buffer>> WriteTensorMessage(const Tensor& tensor,
@@ -158,10 +169,11 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
-                              const int64_t body_length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta,
+                              const int64_t length, const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              const KeyValueMetadata* custom_metadata,
                               std::shared_ptr<Buffer>* out);
 
 static inline Result<std::shared_ptr<Buffer>> WriteFlatbufferBuilder(
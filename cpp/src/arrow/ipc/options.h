@@ -18,7 +18,9 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +46,51 @@ struct ARROW_EXPORT IpcOptions {
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
 
+  /// \brief EXPERIMENTAL: Codec to use for compressing and decompressing
+  /// record batch body buffers. May only be UNCOMPRESSED, LZ4 or ZSTD
+  ///
+  /// Each compressed buffer is prefixed with its uncompressed length as a
+  /// little-endian int64, and the codec is recorded in the Message's
+  /// custom_metadata. Readers detect and decompress such messages
+  /// regardless of this setting.
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// \brief Compression level to pass to the codec
+  int compression_level = util::kUseDefaultCompressionLevel;
+
+  /// \brief EXPERIMENTAL: Dictionary for the ZSTD codec, see
+  /// util::Codec::TrainDictionary
+  ///
+  /// A dictionary trained on typical body buffers greatly improves the
+  /// compression of small record batches.  It is not written to the stream:
+  /// readers must be given the same dictionary in their IpcOptions.  Readers
+  /// ignore it for streams not compressed with ZSTD.
+  std::shared_ptr<Buffer> compression_dictionary;
+
+  /// \brief Write only the new entries of a dictionary that grew since the
+  /// previous record batch, as a delta dictionary batch
+  ///
+  /// This requires each dictionary to begin with all the values of the
+  /// previously written one, as when the batches are built by
+  /// DictionaryBuilders sharing one memo table.  Without it, a dictionary
+  /// that changes between record batches is an error.  In the file format,
+  /// readers apply all the deltas before reading the first record batch.
+  bool emit_dictionary_deltas = false;
+
+  /// \brief Target size in bytes of the record batch messages written by the
+  /// stream and file writers, or 0 to write each record batch as given
+  ///
+  /// Record batches whose message would be larger are split into slices, and
+  /// consecutive smaller ones are held back and concatenated, so that
+  /// messages come close to the target without exceeding it.  A single row
+  /// larger than the target is still written on its own.  Held back batches
+  /// are written at the latest when the writer is closed.
+  int64_t target_message_size = 0;
+
+  /// \brief Use global CPU thread pool to parallelize any computational tasks
+  /// like decompressing the body buffers of a record batch
+  bool use_threads = true;
+
   static IpcOptions Defaults();
 };
 
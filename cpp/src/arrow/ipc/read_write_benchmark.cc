@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "arrow/api.h"
 #include "arrow/io/memory.h"
@@ -101,7 +102,71 @@ static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const refe
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Read 2 columns of a file with a varying number of columns
+static void ReadSelectedFields(benchmark::State& state) {  // NOLINT non-const reference
+  // 1MB
+  constexpr int64_t kTotalSize = 1 << 20;
+  auto record_batch = MakeRecordBatch(kTotalSize, state.range(0));
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(AllocateResizableBuffer(kTotalSize, &buffer));
+  io::BufferOutputStream stream(buffer);
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(
+      ipc::RecordBatchFileWriter::Open(&stream, record_batch->schema()).Value(&writer));
+  ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(stream.Close());
+
+  io::BufferReader source(buffer);
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  ABORT_NOT_OK(ipc::RecordBatchFileReader::Open(&source, &reader));
+  const std::vector<int> field_indices = {0, static_cast<int>(state.range(0) - 1)};
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    if (!reader->ReadRecordBatch(0, field_indices, &result).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+}
+
+// Read a stream of many small record batches with a varying number of columns
+static void ReadSmallBatchStream(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumBatches = 1000;
+  auto record_batch = MakeRecordBatch(state.range(0) * 16 * sizeof(int64_t),
+                                      state.range(0));
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream stream(buffer);
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(
+      ipc::RecordBatchStreamWriter::Open(&stream, record_batch->schema()).Value(&writer));
+  for (int i = 0; i < kNumBatches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(stream.Close());
+
+  while (state.KeepRunning()) {
+    io::BufferReader source(buffer);
+    std::shared_ptr<RecordBatchReader> reader;
+    ABORT_NOT_OK(ipc::RecordBatchStreamReader::Open(&source, &reader));
+    std::shared_ptr<RecordBatch> result;
+    do {
+      if (!reader->ReadNext(&result).ok()) {
+        state.SkipWithError("Failed to read!");
+        break;
+      }
+    } while (result != nullptr);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kNumBatches);
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadSelectedFields)->RangeMultiplier(4)->Range(4, 1 << 12)->UseRealTime();
+BENCHMARK(ReadSmallBatchStream)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
 
 }  // namespace arrow
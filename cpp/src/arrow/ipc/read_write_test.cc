@@ -20,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 
 #include <flatbuffers/flatbuffers.h>
@@ -28,6 +29,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
@@ -40,6 +42,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -47,6 +50,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/key_value_metadata.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
@@ -166,6 +170,40 @@ TEST(TestMessage, LegacyIpcBackwardsCompatibility) {
   ASSERT_TRUE(legacy_message->body()->Equals(*message->body()));
 }
 
+TEST(TestMessage, ChunkedBody) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(36, &batch));
+
+  std::shared_ptr<Buffer> serialized;
+  ASSERT_OK(SerializeRecordBatch(*batch, default_memory_pool(), &serialized));
+  io::BufferReader io_reader(serialized);
+  std::unique_ptr<Message> message;
+  ASSERT_OK(ReadMessage(&io_reader, &message));
+  auto body = message->body();
+
+  // Split the body in the middle of the second buffer
+  const int64_t split = body->size() / 2 + 1;
+  std::unique_ptr<Message> chunked;
+  ASSERT_OK(Message::Open(
+      message->metadata(),
+      {SliceBuffer(body, 0, split), SliceBuffer(body, split, body->size() - split)},
+      &chunked));
+  ASSERT_EQ(chunked->type(), Message::RECORD_BATCH);
+
+  DictionaryMemo memo;
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(ReadRecordBatch(*chunked, batch->schema(), &memo, &result));
+  AssertBatchesEqual(*batch, *result);
+
+  // Buffers contained in the first chunk are not copied
+  auto first_buffer = result->column_data(0)->buffers[1];
+  ASSERT_GE(first_buffer->data(), body->data());
+  ASSERT_LE(first_buffer->data() + first_buffer->size(), body->data() + split);
+
+  ASSERT_TRUE(chunked->body()->Equals(*body));
+  ASSERT_TRUE(chunked->Equals(*message));
+}
+
 TEST(TestMessage, Verify) {
   std::string metadata = "invalid";
   std::string body = "abcdef";
@@ -555,6 +593,106 @@ void TestGetRecordBatchSize(const IpcOptions& options,
   ASSERT_EQ(mock.GetExtentBytesWritten(), size);
 }
 
+TEST_F(TestWriteRecordBatch, CompressedWideBatch) {
+  constexpr int kNumColumns = 100;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int i = 0; i < kNumColumns; ++i) {
+    std::shared_ptr<Array> array;
+    ASSERT_OK(MakeRandomInt32Array(1000, /*include_nulls=*/true, pool_, &array, i));
+    fields.push_back(field("f" + std::to_string(i), array->type()));
+    arrays.push_back(array);
+  }
+  auto batch = RecordBatch::Make(schema(fields), 1000, arrays);
+
+  for (auto codec : {Compression::LZ4, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    for (bool use_threads : {false, true}) {
+      auto options = IpcOptions::Defaults();
+      options.compression = codec;
+      options.use_threads = use_threads;
+
+      std::stringstream ss;
+      ss << "test-compressed-wide-batch-" << g_file_number++;
+      ASSERT_OK_AND_ASSIGN(mmap_, io::MemoryMapFixture::InitMemoryMap(1 << 22, ss.str()));
+      int32_t metadata_length;
+      int64_t body_length;
+      ASSERT_OK(WriteRecordBatch(*batch, 0, mmap_.get(), &metadata_length, &body_length,
+                                 options, pool_));
+
+      std::unique_ptr<Message> message;
+      ASSERT_OK(ReadMessage(0, metadata_length, mmap_.get(), &message));
+
+      DictionaryMemo empty_memo;
+      io::BufferReader reader(message->body());
+      std::shared_ptr<RecordBatch> result;
+      ASSERT_OK(ReadRecordBatch(*message->metadata(), batch->schema(), &empty_memo,
+                                options, &reader, &result));
+      CheckReadResult(*result, *batch);
+    }
+  }
+}
+
+TEST_F(TestWriteRecordBatch, CompressedWithDictionary) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    return;
+  }
+  // Train a dictionary on the buffers of many small batches
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < 200; ++i) {
+    std::shared_ptr<Array> array;
+    ASSERT_OK(MakeRandomInt32Array(100, /*include_nulls=*/true, pool_, &array, i));
+    for (const auto& buffer : array->data()->buffers) {
+      if (buffer != nullptr) {
+        samples.push_back(buffer);
+      }
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       util::Codec::TrainDictionary(Compression::ZSTD, samples, 8192));
+
+  std::shared_ptr<Array> array;
+  ASSERT_OK(MakeRandomInt32Array(100, /*include_nulls=*/true, pool_, &array, 1000));
+  auto batch = RecordBatch::Make(schema({field("f0", array->type())}), 100, {array});
+
+  auto options = IpcOptions::Defaults();
+  options.compression = Compression::ZSTD;
+  options.compression_dictionary = dictionary;
+
+  ASSERT_OK_AND_ASSIGN(mmap_, io::MemoryMapFixture::InitMemoryMap(
+                                  1 << 20, "test-compressed-with-dictionary"));
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_OK(WriteRecordBatch(*batch, 0, mmap_.get(), &metadata_length, &body_length,
+                             options, pool_));
+
+  std::unique_ptr<Message> message;
+  ASSERT_OK(ReadMessage(0, metadata_length, mmap_.get(), &message));
+
+  DictionaryMemo empty_memo;
+  std::shared_ptr<RecordBatch> result;
+  io::BufferReader reader(message->body());
+  ASSERT_OK(ReadRecordBatch(*message->metadata(), batch->schema(), &empty_memo, options,
+                            &reader, &result));
+  CheckReadResult(*result, *batch);
+
+  // The same dictionary is required for reading
+  io::BufferReader other_reader(message->body());
+  ASSERT_RAISES(IOError, ReadRecordBatch(*message->metadata(), batch->schema(),
+                                         &empty_memo, IpcOptions::Defaults(),
+                                         &other_reader, &result));
+
+  // LZ4 doesn't support dictionaries
+  options.compression = Compression::LZ4;
+  if (util::Codec::IsAvailable(Compression::LZ4)) {
+    ASSERT_RAISES(NotImplemented,
+                  WriteRecordBatch(*batch, 0, mmap_.get(), &metadata_length,
+                                   &body_length, options, pool_));
+  }
+}
+
 TEST_F(TestWriteRecordBatch, IntegerGetRecordBatchSize) {
   std::shared_ptr<RecordBatch> batch;
 
@@ -811,6 +949,29 @@ class ReaderWriterMixin {
     }
   }
 
+  template <typename Param>
+  void TestCompressedRoundTrip(Param&& param) {
+    for (auto codec : {Compression::LZ4, Compression::ZSTD}) {
+      if (!util::Codec::IsAvailable(codec)) {
+        continue;
+      }
+      IpcOptions options;
+      options.compression = codec;
+      TestRoundTrip(param, options);
+      TestZeroLengthRoundTrip(param, options);
+    }
+  }
+
+  void TestUnsupportedCompression() {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntRecordBatch(&batch));
+
+    IpcOptions options;
+    options.compression = Compression::GZIP;
+    BatchVector out_batches;
+    ASSERT_RAISES(Invalid, RoundTripHelper({batch}, options, &out_batches));
+  }
+
   void TestDictionaryRoundtrip() {
     std::shared_ptr<RecordBatch> batch;
     ASSERT_OK(MakeDictionary(&batch));
@@ -901,6 +1062,8 @@ TEST_P(TestFileFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  TestCompressedRoundTrip(*GetParam());
 }
 
 TEST_P(TestStreamFormat, RoundTrip) {
@@ -911,6 +1074,8 @@ TEST_P(TestStreamFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  TestCompressedRoundTrip(*GetParam());
 }
 
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
@@ -958,6 +1123,44 @@ TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
+TEST_F(TestStreamFormat, UnsupportedCompression) { TestUnsupportedCompression(); }
+
+TEST_F(TestFileFormat, UnsupportedCompression) { TestUnsupportedCompression(); }
+
+TEST(TestRecordBatchFileReader, ReadSelectedFields) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  io::BufferReader buf_reader(helper.buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, helper.footer_offset_, &reader));
+
+  // Fields after a nested and a dictionary-encoded field, in any order
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadRecordBatch(0, {4, 0, 3}, &result));
+  ASSERT_OK(result->ValidateFull());
+  ASSERT_EQ(result->num_columns(), 3);
+  ASSERT_EQ(result->num_rows(), batch->num_rows());
+  const std::vector<int> selected = {4, 0, 3};
+  for (int i = 0; i < result->num_columns(); ++i) {
+    ASSERT_EQ(result->schema()->field(i)->name(),
+              batch->schema()->field(selected[i])->name());
+    AssertArraysEqual(*batch->column(selected[i]), *result->column(i));
+  }
+
+  ASSERT_OK(reader->ReadRecordBatch(0, {}, &result));
+  ASSERT_EQ(result->num_columns(), 0);
+  ASSERT_EQ(result->num_rows(), batch->num_rows());
+
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {5}, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {1, 1}, &result));
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -979,6 +1182,49 @@ TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   ASSERT_EQ(nullptr, batch);
 }
 
+TEST(TestRecordBatchStreamReader, RecycledBodyBuffers) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create(0));
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(out.get(), batch->schema(), &writer));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+
+  // A stream without zero-copy support, so that message bodies are allocated
+  ASSERT_OK_AND_ASSIGN(
+      auto stream,
+      io::BufferedInputStream::Create(1 << 16, default_memory_pool(),
+                                      std::make_shared<io::BufferReader>(buffer)));
+  ProxyMemoryPool proxy(default_memory_pool());
+  RecyclingMemoryPool pool(&proxy);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(MessageReader::Open(stream, &pool), &reader));
+
+  int64_t body_bytes = -1;
+  int num_batches = 0;
+  while (true) {
+    std::shared_ptr<RecordBatch> read_batch;
+    ASSERT_OK(reader->ReadNext(&read_batch));
+    if (read_batch == nullptr) {
+      break;
+    }
+    AssertBatchesEqual(*batch, *read_batch);
+    if (body_bytes == -1) {
+      body_bytes = proxy.bytes_allocated();
+      ASSERT_GT(body_bytes, 0);
+    }
+    ++num_batches;
+  }
+  ASSERT_EQ(5, num_batches);
+  // Each body reused the buffer of the previous one
+  ASSERT_EQ(body_bytes, proxy.max_memory());
+}
+
 // Delimit IPC stream messages and reassemble with the indicated messages
 // included. This way we can remove messages from an IPC stream to test
 // different failure modes or other difficult-to-test behaviors
@@ -1416,6 +1662,198 @@ TEST(TestRecordBatchStreamReader, MalformedInput) {
   ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&garbage_reader, &batch_reader));
 }
 
+// ----------------------------------------------------------------------
+// Delta dictionaries
+
+TEST(TestRecordBatchFileWriter, ParallelWriteTable) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(1000, &batch));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+
+  auto options = IpcOptions::Defaults();
+  if (util::Codec::IsAvailable(Compression::LZ4)) {
+    options.compression = Compression::LZ4;
+  }
+  auto write_table = [&](bool use_threads, std::shared_ptr<Buffer>* out) -> Status {
+    options.use_threads = use_threads;
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(0));
+    ARROW_ASSIGN_OR_RAISE(
+        auto writer, RecordBatchFileWriter::Open(sink.get(), table->schema(), options));
+    RETURN_NOT_OK(writer->WriteTable(*table, /*max_chunksize=*/100));
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish().Value(out);
+  };
+
+  // The batches are assembled in parallel but written in order
+  std::shared_ptr<Buffer> serial, parallel;
+  ASSERT_OK(write_table(false, &serial));
+  ASSERT_OK(write_table(true, &parallel));
+  ASSERT_TRUE(serial->Equals(*parallel));
+
+  auto buf_reader = std::make_shared<io::BufferReader>(parallel);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(buf_reader, &reader));
+  ASSERT_EQ(10, reader->num_record_batches());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadRecordBatch(i, &result));
+    AssertBatchesEqual(*batch->Slice(i * 100, 100), *result);
+  }
+}
+
+TEST(TestRecordBatchStreamWriter, TargetMessageSize) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(1000, &batch));
+
+  auto options = IpcOptions::Defaults();
+  options.target_message_size = 2048;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(
+      auto writer, RecordBatchStreamWriter::Open(sink.get(), batch->schema(), options));
+  // A large batch, then small ones
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch->Slice(i * 10, 10)));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  io::BufferReader buf_reader(buffer);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+  BatchVector results;
+  while (true) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadNext(&result));
+    if (result == nullptr) {
+      break;
+    }
+    int64_t size;
+    ASSERT_OK(GetRecordBatchSize(*result, &size));
+    ASSERT_LE(size, options.target_message_size);
+    results.push_back(result);
+  }
+  // The large batch is split, and the small ones are concatenated
+  ASSERT_GT(results.size(), 2U);
+  ASSERT_LT(results.size(), 11U);
+
+  std::shared_ptr<Table> expected, result;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch->Slice(0, 100)}, &expected));
+  ASSERT_OK(Table::FromRecordBatches(results, &result));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+}
+
+class TestDictionaryDeltas : public ::testing::Test {
+ public:
+  // Make a batch of dictionary-encoded strings. Each batch is built on the
+  // memo table of the previous one, so that its dictionary extends the
+  // previous dictionary
+  void AppendBatch(const std::vector<std::string>& values) {
+    std::unique_ptr<StringDictionary32Builder> builder;
+    if (batches_.empty()) {
+      builder.reset(new StringDictionary32Builder());
+    } else {
+      builder.reset(new StringDictionary32Builder(memo_table_));
+    }
+    for (const auto& value : values) {
+      ASSERT_OK(builder->Append(value));
+    }
+    memo_table_ = builder->memo_table();
+    std::shared_ptr<Array> array;
+    ASSERT_OK(builder->Finish(&array));
+    if (schema_ == nullptr) {
+      schema_ = ::arrow::schema({field("f0", array->type())});
+    }
+    batches_.push_back(RecordBatch::Make(schema_, array->length(), {array}));
+  }
+
+  Status WriteStream(const IpcOptions& options, std::shared_ptr<Buffer>* out) {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(0));
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          RecordBatchStreamWriter::Open(sink.get(), schema_, options));
+    for (const auto& batch : batches_) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish().Value(out);
+  }
+
+ protected:
+  std::shared_ptr<::arrow::internal::DictionaryMemoTable> memo_table_;
+  std::shared_ptr<Schema> schema_;
+  BatchVector batches_;
+};
+
+TEST_F(TestDictionaryDeltas, StreamRoundTrip) {
+  AppendBatch({"foo", "bar", "foo"});
+  AppendBatch({"bar", "baz"});
+  AppendBatch({"foo"});
+  AppendBatch({"qux", "baz", "quux"});
+
+  IpcOptions options;
+  options.emit_dictionary_deltas = true;
+  std::shared_ptr<Buffer> stream;
+  ASSERT_OK(WriteStream(options, &stream));
+
+  // Only the new entries are written after the first dictionary
+  io::BufferReader message_source(stream);
+  auto message_reader = MessageReader::Open(&message_source);
+  std::vector<int64_t> dictionary_lengths;
+  std::unique_ptr<Message> message;
+  ASSERT_OK(message_reader->ReadNextMessage(&message));
+  while (message != nullptr) {
+    if (message->type() == Message::DICTIONARY_BATCH) {
+      auto batch_meta = flatbuf::GetMessage(message->metadata()->data())
+                            ->header_as_DictionaryBatch();
+      ASSERT_EQ(batch_meta->isDelta(), !dictionary_lengths.empty());
+      dictionary_lengths.push_back(batch_meta->data()->length());
+    }
+    ASSERT_OK(message_reader->ReadNextMessage(&message));
+  }
+  ASSERT_EQ(dictionary_lengths, (std::vector<int64_t>{2, 1, 2}));
+
+  io::BufferReader source(stream);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&source, &reader));
+  for (const auto& expected : batches_) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_NE(batch, nullptr);
+    CompareBatch(*expected, *batch);
+  }
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_F(TestDictionaryDeltas, DisabledByDefault) {
+  AppendBatch({"foo", "bar"});
+  AppendBatch({"bar"});
+  AppendBatch({"baz"});
+
+  std::shared_ptr<Buffer> stream;
+  ASSERT_RAISES(Invalid, WriteStream(IpcOptions::Defaults(), &stream));
+
+  // Unchanged dictionaries are accepted
+  batches_.pop_back();
+  ASSERT_OK(WriteStream(IpcOptions::Defaults(), &stream));
+}
+
+TEST_F(TestDictionaryDeltas, NotAnExtension) {
+  AppendBatch({"foo", "bar"});
+  auto dictionary = ArrayFromJSON(utf8(), R"(["bar", "foo", "baz"])");
+  auto indices = ArrayFromJSON(int32(), "[2, 0]");
+  batches_.push_back(RecordBatch::Make(
+      schema_, 2, {std::make_shared<DictionaryArray>(schema_->field(0)->type(), indices,
+                                                     dictionary)}));
+
+  IpcOptions options;
+  options.emit_dictionary_deltas = true;
+  std::shared_ptr<Buffer> stream;
+  ASSERT_RAISES(Invalid, WriteStream(options, &stream));
+}
+
 // ----------------------------------------------------------------------
 // DictionaryMemo miscellanea
 
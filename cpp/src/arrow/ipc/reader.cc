@@ -34,13 +34,17 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
 #include "generated/File_generated.h"  // IWYU pragma: export
@@ -88,6 +92,17 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
     }                                                                   \
   } while (0)
 
+// Like CHECK_HAS_BODY, but doesn't concatenate bodies made of several chunks
+Status OpenBodyReader(const Message& message,
+                      std::unique_ptr<io::RandomAccessFile>* out) {
+  *out = message.body_reader();
+  if (*out == nullptr) {
+    return Status::IOError("Expected body in IPC message of type ",
+                           FormatMessageType(message.type()));
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------
@@ -96,11 +111,16 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  // The buffers are read from `file` at `body_offset` plus their offset in the body
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : buffers_(metadata->buffers()),
+        nodes_(metadata->nodes()),
+        file_(file),
+        body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
-    auto buffers = metadata_->buffers();
+    auto buffers = buffers_;
     if (buffers == nullptr) {
       return Status::IOError(
           "Buffers-pointer of flatbuffer-encoded RecordBatch is null.");
@@ -120,12 +140,12 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length()).Value(out);
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length()).Value(out);
     }
   }
 
   Status GetFieldMetadata(int field_index, ArrayData* out) {
-    auto nodes = metadata_->nodes();
+    auto nodes = nodes_;
     if (nodes == nullptr) {
       return Status::IOError("Nodes-pointer of flatbuffer-encoded Table is null.");
     }
@@ -142,122 +162,68 @@ class IpcComponentSource {
   }
 
  private:
-  const flatbuf::RecordBatch* metadata_;
+  // Looked up once rather than for each field
+  const flatbuffers::Vector<const flatbuf::Buffer*>* buffers_;
+  const flatbuffers::Vector<const flatbuf::FieldNode*>* nodes_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
 };
 
-/// Bookkeeping struct for loading array objects from their constituent pieces of raw data
-///
-/// The field_index and buffer_index are incremented in the ArrayLoader
-/// based on how much of the batch is "consumed" (through nested data
-/// reconstruction, for example)
-struct ArrayLoaderContext {
-  IpcComponentSource* source;
-  const DictionaryMemo* dictionary_memo;
-  int buffer_index;
-  int field_index;
-  int max_recursion_depth;
-};
+/// The layout of an array in the field nodes and buffers of a record batch
+/// body.  It is computed once per schema, so that loading each record batch
+/// of a stream or file does not visit the field types again.
+struct ArrayLoadPlan {
+  /// How the data buffers of an empty array are loaded
+  enum EmptyData { kRead, kZeroLength, kNone };
 
-static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
+  /// The type of the loaded array
+  std::shared_ptr<DataType> type;
+  /// The size of ArrayData::buffers
+  int num_slots = 1;
+  /// Whether a validity bitmap precedes the data buffers, i.e. the type is
+  /// not NullType
+  bool has_validity = true;
+  /// The body buffers after the validity bitmap, loaded in ArrayData::buffers
+  /// from index 1
+  int num_data_buffers = 0;
+  EmptyData empty_data = kRead;
+  /// For dictionary arrays, the field whose dictionary is looked up, and its
+  /// id if the DictionaryMemo knows it
+  const Field* dictionary_field = NULLPTR;
+  int64_t dictionary_id = -1;
+  /// The field nodes and body buffers spanned by the array and its children
+  int num_nodes = 1;
+  int num_buffers = 0;
+  std::vector<ArrayLoadPlan> children;
+};
 
-class ArrayLoader {
+class ArrayLoadPlanMaker {
  public:
-  ArrayLoader(const Field& field, ArrayData* out, ArrayLoaderContext* context)
-      : field_(field), context_(context), out_(out) {}
-
-  Status Load() {
-    if (context_->max_recursion_depth <= 0) {
+  ArrayLoadPlanMaker(const Field& field, const DictionaryMemo* dictionary_memo,
+                     int max_recursion_depth, ArrayLoadPlan* out)
+      : field_(field),
+        dictionary_memo_(dictionary_memo),
+        max_recursion_depth_(max_recursion_depth),
+        out_(out) {}
+
+  Status Make() {
+    if (max_recursion_depth_ <= 0) {
       return Status::Invalid("Max recursion depth reached");
     }
-
     RETURN_NOT_OK(VisitTypeInline(*field_.type(), this));
     out_->type = field_.type();
-    return Status::OK();
-  }
-
-  Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
-    return context_->source->GetBuffer(buffer_index, out);
-  }
-
-  Status LoadCommon() {
-    // This only contains the length and null count, which we need to figure
-    // out what to do with the buffers. For example, if null_count == 0, then
-    // we can skip that buffer without reading from shared memory
-    RETURN_NOT_OK(context_->source->GetFieldMetadata(context_->field_index++, out_));
 
-    // extract null_bitmap which is common to all arrays
-    if (out_->null_count == 0) {
-      out_->buffers[0] = nullptr;
-    } else {
-      RETURN_NOT_OK(GetBuffer(context_->buffer_index, &out_->buffers[0]));
-    }
-    context_->buffer_index++;
-    return Status::OK();
-  }
-
-  template <typename TYPE>
-  Status LoadPrimitive() {
-    out_->buffers.resize(2);
-
-    RETURN_NOT_OK(LoadCommon());
-    if (out_->length > 0) {
-      RETURN_NOT_OK(GetBuffer(context_->buffer_index++, &out_->buffers[1]));
-    } else {
-      context_->buffer_index++;
-      out_->buffers[1].reset(new Buffer(nullptr, 0));
-    }
-    return Status::OK();
-  }
-
-  template <typename TYPE>
-  Status LoadBinary() {
-    out_->buffers.resize(3);
-
-    RETURN_NOT_OK(LoadCommon());
-    RETURN_NOT_OK(GetBuffer(context_->buffer_index++, &out_->buffers[1]));
-    return GetBuffer(context_->buffer_index++, &out_->buffers[2]);
-  }
-
-  template <typename TYPE>
-  Status LoadList(const TYPE& type) {
-    out_->buffers.resize(2);
-
-    RETURN_NOT_OK(LoadCommon());
-    RETURN_NOT_OK(GetBuffer(context_->buffer_index++, &out_->buffers[1]));
-
-    const int num_children = type.num_children();
-    if (num_children != 1) {
-      return Status::Invalid("Wrong number of children: ", num_children);
-    }
-
-    return LoadChildren(type.children());
-  }
-
-  Status LoadChild(const Field& field, ArrayData* out) {
-    ArrayLoader loader(field, out, context_);
-    --context_->max_recursion_depth;
-    RETURN_NOT_OK(loader.Load());
-    ++context_->max_recursion_depth;
-    return Status::OK();
-  }
-
-  Status LoadChildren(std::vector<std::shared_ptr<Field>> child_fields) {
-    out_->child_data.reserve(static_cast<int>(child_fields.size()));
-
-    for (const auto& child_field : child_fields) {
-      auto field_array = std::make_shared<ArrayData>();
-      RETURN_NOT_OK(LoadChild(*child_field, field_array.get()));
-      out_->child_data.emplace_back(field_array);
+    out_->num_buffers = (out_->has_validity ? 1 : 0) + out_->num_data_buffers;
+    for (const auto& child : out_->children) {
+      out_->num_nodes += child.num_nodes;
+      out_->num_buffers += child.num_buffers;
     }
     return Status::OK();
   }
 
   Status Visit(const NullType& type) {
-    out_->buffers.resize(1);
-
     // ARROW-6379: NullType has no buffers in the IPC payload
-    RETURN_NOT_OK(context_->source->GetFieldMetadata(context_->field_index++, out_));
+    out_->has_validity = false;
     return Status::OK();
   }
 
@@ -267,85 +233,154 @@ class ArrayLoader {
                   !std::is_base_of<DictionaryType, T>::value,
               Status>
   Visit(const T& type) {
-    return LoadPrimitive<T>();
+    return SetBuffers(2, 1, ArrayLoadPlan::kZeroLength);
   }
 
   template <typename T>
   enable_if_base_binary<T, Status> Visit(const T& type) {
-    return LoadBinary<T>();
+    return SetBuffers(3, 2);
   }
 
-  Status Visit(const FixedSizeBinaryType& type) {
-    out_->buffers.resize(2);
-    RETURN_NOT_OK(LoadCommon());
-    return GetBuffer(context_->buffer_index++, &out_->buffers[1]);
-  }
+  Status Visit(const FixedSizeBinaryType& type) { return SetBuffers(2, 1); }
 
   template <typename T>
   enable_if_base_list<T, Status> Visit(const T& type) {
-    return LoadList(type);
+    RETURN_NOT_OK(SetBuffers(2, 1));
+    return MakeChildren(type, /*expected_num_children=*/1);
   }
 
   Status Visit(const FixedSizeListType& type) {
-    out_->buffers.resize(1);
+    return MakeChildren(type, /*expected_num_children=*/1);
+  }
 
-    RETURN_NOT_OK(LoadCommon());
+  Status Visit(const StructType& type) { return MakeChildren(type); }
 
-    const int num_children = type.num_children();
-    if (num_children != 1) {
-      return Status::Invalid("Wrong number of children: ", num_children);
-    }
+  Status Visit(const UnionType& type) {
+    RETURN_NOT_OK(
+        SetBuffers(3, type.mode() == UnionMode::DENSE ? 2 : 1, ArrayLoadPlan::kNone));
+    return MakeChildren(type);
+  }
 
-    return LoadChildren(type.children());
+  Status Visit(const DictionaryType& type) {
+    RETURN_NOT_OK(VisitTypeInline(*type.index_type(), this));
+    out_->dictionary_field = &field_;
+    if (dictionary_memo_ != nullptr &&
+        !dictionary_memo_->GetId(field_, &out_->dictionary_id).ok()) {
+      // The error is reported if a record batch is loaded
+      out_->dictionary_id = -1;
+    }
+    return Status::OK();
   }
 
-  Status Visit(const StructType& type) {
-    out_->buffers.resize(1);
-    RETURN_NOT_OK(LoadCommon());
-    return LoadChildren(type.children());
+  Status Visit(const ExtensionType& type) {
+    return VisitTypeInline(*type.storage_type(), this);
   }
 
-  Status Visit(const UnionType& type) {
-    out_->buffers.resize(3);
+ private:
+  Status SetBuffers(int num_slots, int num_data_buffers,
+                    ArrayLoadPlan::EmptyData empty_data = ArrayLoadPlan::kRead) {
+    out_->num_slots = num_slots;
+    out_->num_data_buffers = num_data_buffers;
+    out_->empty_data = empty_data;
+    return Status::OK();
+  }
 
-    RETURN_NOT_OK(LoadCommon());
-    if (out_->length > 0) {
-      RETURN_NOT_OK(GetBuffer(context_->buffer_index, &out_->buffers[1]));
-      if (type.mode() == UnionMode::DENSE) {
-        RETURN_NOT_OK(GetBuffer(context_->buffer_index + 1, &out_->buffers[2]));
-      }
+  Status MakeChildren(const DataType& type, int expected_num_children = -1) {
+    const int num_children = type.num_children();
+    if (expected_num_children >= 0 && num_children != expected_num_children) {
+      return Status::Invalid("Wrong number of children: ", num_children);
+    }
+    out_->children.resize(num_children);
+    for (int i = 0; i < num_children; ++i) {
+      ArrayLoadPlanMaker maker(*type.child(i), dictionary_memo_, max_recursion_depth_ - 1,
+                               &out_->children[i]);
+      RETURN_NOT_OK(maker.Make());
     }
-    context_->buffer_index += type.mode() == UnionMode::DENSE ? 2 : 1;
-    return LoadChildren(type.children());
+    return Status::OK();
   }
 
-  Status Visit(const DictionaryType& type) {
-    RETURN_NOT_OK(
-        LoadArray(*::arrow::field("indices", type.index_type()), context_, out_));
+  const Field& field_;
+  const DictionaryMemo* dictionary_memo_;
+  int max_recursion_depth_;
+  ArrayLoadPlan* out_;
+};
 
-    // Look up dictionary
-    int64_t id = -1;
-    RETURN_NOT_OK(context_->dictionary_memo->GetId(field_, &id));
-    RETURN_NOT_OK(context_->dictionary_memo->GetDictionary(id, &out_->dictionary));
+/// Make the load plans of the fields of a schema
+static Status MakeLoadPlan(const Schema& schema, const DictionaryMemo* dictionary_memo,
+                           int max_recursion_depth, std::vector<ArrayLoadPlan>* out) {
+  out->resize(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    ArrayLoadPlanMaker maker(*schema.field(i), dictionary_memo, max_recursion_depth,
+                             &(*out)[i]);
+    RETURN_NOT_OK(maker.Make());
+  }
+  return Status::OK();
+}
 
-    return Status::OK();
+/// Bookkeeping struct for loading array objects from their constituent pieces of raw data
+///
+/// The field_index and buffer_index are incremented in LoadArray() based on
+/// how much of the batch is "consumed" (through nested data reconstruction,
+/// for example)
+struct ArrayLoaderContext {
+  IpcComponentSource* source;
+  const DictionaryMemo* dictionary_memo;
+  int buffer_index;
+  int field_index;
+
+  /// Advance past an array without reading it
+  void Skip(const ArrayLoadPlan& plan) {
+    field_index += plan.num_nodes;
+    buffer_index += plan.num_buffers;
   }
+};
 
-  Status Visit(const ExtensionType& type) {
-    return LoadArray(*::arrow::field("storage", type.storage_type()), context_, out_);
+static Status LoadArray(const ArrayLoadPlan& plan, ArrayLoaderContext* context,
+                        ArrayData* out) {
+  out->type = plan.type;
+  out->buffers.resize(plan.num_slots);
+
+  // This only contains the length and null count, which we need to figure
+  // out what to do with the buffers. For example, if null_count == 0, then
+  // we can skip that buffer without reading from shared memory
+  RETURN_NOT_OK(context->source->GetFieldMetadata(context->field_index++, out));
+
+  if (plan.has_validity) {
+    if (out->null_count != 0) {
+      RETURN_NOT_OK(context->source->GetBuffer(context->buffer_index, &out->buffers[0]));
+    }
+    context->buffer_index++;
   }
 
- private:
-  const Field& field_;
-  ArrayLoaderContext* context_;
+  if (out->length == 0 && plan.empty_data != ArrayLoadPlan::kRead) {
+    if (plan.empty_data == ArrayLoadPlan::kZeroLength) {
+      for (int i = 1; i <= plan.num_data_buffers; ++i) {
+        out->buffers[i] = std::make_shared<Buffer>(nullptr, 0);
+      }
+    }
+    context->buffer_index += plan.num_data_buffers;
+  } else {
+    for (int i = 1; i <= plan.num_data_buffers; ++i) {
+      RETURN_NOT_OK(
+          context->source->GetBuffer(context->buffer_index++, &out->buffers[i]));
+    }
+  }
 
-  // Used in visitor pattern
-  ArrayData* out_;
-};
+  out->child_data.reserve(plan.children.size());
+  for (const auto& child_plan : plan.children) {
+    auto child = std::make_shared<ArrayData>();
+    RETURN_NOT_OK(LoadArray(child_plan, context, child.get()));
+    out->child_data.push_back(std::move(child));
+  }
 
-static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out) {
-  ArrayLoader loader(field, out, context);
-  return loader.Load();
+  if (plan.dictionary_field != nullptr) {
+    int64_t id = plan.dictionary_id;
+    if (id < 0) {
+      RETURN_NOT_OK(context->dictionary_memo->GetId(*plan.dictionary_field, &id));
+    }
+    RETURN_NOT_OK(context->dictionary_memo->GetDictionary(id, &out->dictionary));
+  }
+  return Status::OK();
 }
 
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
@@ -359,53 +394,179 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
                        const DictionaryMemo* dictionary_memo,
                        std::shared_ptr<RecordBatch>* out) {
   CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message.type());
-  CHECK_HAS_BODY(message);
+  std::unique_ptr<io::RandomAccessFile> reader;
+  RETURN_NOT_OK(OpenBodyReader(message, &reader));
   auto options = IpcOptions::Defaults();
-  io::BufferReader reader(message.body());
-  return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options, &reader,
-                         out);
+  return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options,
+                         reader.get(), out);
 }
 
 // ----------------------------------------------------------------------
 // Array loading
 
+static Status DecompressBuffer(const std::shared_ptr<Buffer>& buf, util::Codec* codec,
+                               std::shared_ptr<Buffer>* out) {
+  if (buf == nullptr || buf->size() == 0) {
+    *out = buf;
+    return Status::OK();
+  }
+
+  if (buf->size() < 8) {
+    return Status::Invalid(
+        "Likely corrupted message, compressed buffers "
+        "are larger than 8 bytes by construction");
+  }
+
+  const uint8_t* data = buf->data();
+  int64_t compressed_size = buf->size() - sizeof(int64_t);
+  int64_t uncompressed_size =
+      BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+  if (uncompressed_size < 0) {
+    return Status::Invalid("Likely corrupted message, negative uncompressed size");
+  }
+
+  std::shared_ptr<Buffer> uncompressed;
+  RETURN_NOT_OK(AllocateBuffer(uncompressed_size, &uncompressed));
+
+  int64_t actual_decompressed;
+  ARROW_ASSIGN_OR_RAISE(
+      actual_decompressed,
+      codec->Decompress(compressed_size, data + sizeof(int64_t), uncompressed_size,
+                        uncompressed->mutable_data()));
+  if (actual_decompressed != uncompressed_size) {
+    return Status::Invalid("Failed to fully decompress buffer, expected ",
+                           uncompressed_size, " bytes but decompressed ",
+                           actual_decompressed);
+  }
+  *out = std::move(uncompressed);
+  return Status::OK();
+}
+
+static Status DecompressBuffers(Compression::type compression, const IpcOptions& options,
+                                std::vector<std::shared_ptr<ArrayData>>* fields) {
+  struct BufferAccumulator {
+    using BufferPtrVector = std::vector<std::shared_ptr<Buffer>*>;
+
+    void AppendFrom(std::vector<std::shared_ptr<ArrayData>>* fields) {
+      for (const auto& field : *fields) {
+        for (auto& buffer : field->buffers) {
+          buffers_.push_back(&buffer);
+        }
+        AppendFrom(&field->child_data);
+      }
+    }
+
+    BufferPtrVector Get(std::vector<std::shared_ptr<ArrayData>>* fields) && {
+      AppendFrom(fields);
+      return std::move(buffers_);
+    }
+
+    BufferPtrVector buffers_;
+  };
+
+  // Flatten all buffers
+  auto buffers = BufferAccumulator{}.Get(fields);
+
+  // One-shot decompression does not keep any state in the codec, so the
+  // instance can be shared among worker threads
+  std::unique_ptr<util::Codec> codec;
+  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  if (codec->SupportsDictionary()) {
+    RETURN_NOT_OK(codec->SetDictionary(options.compression_dictionary));
+  }
+
+  return ::arrow::internal::OptionalParallelFor(
+      options.use_threads && buffers.size() > 1, static_cast<int>(buffers.size()),
+      [&](int i) { return DecompressBuffer(*buffers[i], codec.get(), buffers[i]); });
+}
+
+// Load the fields of `schema` at `field_indices`, or all of them if it is null.
+// `load_plan` is the load plan of `schema`, or null to make it here
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
-                                        int64_t num_rows, int max_recursion_depth,
+                                        const std::vector<ArrayLoadPlan>* load_plan,
+                                        const std::vector<int>* field_indices,
+                                        int64_t num_rows, Compression::type compression,
+                                        const IpcOptions& options,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
-  ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
-                             /*buffer_index=*/0, max_recursion_depth};
+  std::vector<ArrayLoadPlan> own_load_plan;
+  if (load_plan == nullptr) {
+    RETURN_NOT_OK(MakeLoadPlan(*schema, dictionary_memo, options.max_recursion_depth,
+                               &own_load_plan));
+    load_plan = &own_load_plan;
+  }
+  ArrayLoaderContext context{source, dictionary_memo, /*buffer_index=*/0,
+                             /*field_index=*/0};
+
+  std::shared_ptr<Schema> out_schema = schema;
+  // The position in the output of each field of the schema, -1 if not selected
+  std::vector<int> out_positions;
+  if (field_indices != nullptr) {
+    out_positions.assign(schema->num_fields(), -1);
+    std::vector<std::shared_ptr<Field>> out_fields;
+    for (size_t j = 0; j < field_indices->size(); ++j) {
+      const int i = (*field_indices)[j];
+      if (i < 0 || i >= schema->num_fields()) {
+        return Status::Invalid("Field index ", i, " out of bounds");
+      }
+      if (out_positions[i] != -1) {
+        return Status::Invalid("Field index ", i, " selected twice");
+      }
+      out_positions[i] = static_cast<int>(j);
+      out_fields.push_back(schema->field(i));
+    }
+    out_schema = ::arrow::schema(std::move(out_fields), schema->metadata());
+  }
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
-  for (int i = 0; i < schema->num_fields(); ++i) {
+  std::vector<std::shared_ptr<ArrayData>> arrays(out_schema->num_fields());
+  int num_loaded = 0;
+  // Stop after the last selected field: the fields after it needn't be walked
+  for (int i = 0; i < schema->num_fields() && num_loaded < out_schema->num_fields();
+       ++i) {
+    const int out_position = field_indices == nullptr ? i : out_positions[i];
+    if (out_position < 0) {
+      context.Skip((*load_plan)[i]);
+      continue;
+    }
     auto arr = std::make_shared<ArrayData>();
-    RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
+    RETURN_NOT_OK(LoadArray((*load_plan)[i], &context, arr.get()));
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    arrays[out_position] = std::move(arr);
+    ++num_loaded;
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  if (compression != Compression::UNCOMPRESSED) {
+    RETURN_NOT_OK(DecompressBuffers(compression, options, &arrays));
+  }
+
+  *out = RecordBatch::Make(out_schema, num_rows, std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
+                                     const std::vector<ArrayLoadPlan>* load_plan,
+                                     const std::vector<int>* field_indices,
                                      const DictionaryMemo* dictionary_memo,
+                                     Compression::type compression,
                                      const IpcOptions& options,
-                                     io::RandomAccessFile* file,
+                                     io::RandomAccessFile* file, int64_t body_offset,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  IpcComponentSource source(metadata, file, body_offset);
+  return LoadRecordBatchFromSource(schema, load_plan, field_indices, metadata->length(),
+                                   compression, options, &source, dictionary_memo, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
-                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+static Status ReadRecordBatch(const Buffer& metadata,
+                              const std::shared_ptr<Schema>& schema,
+                              const std::vector<ArrayLoadPlan>* load_plan,
+                              const std::vector<int>* field_indices,
+                              const DictionaryMemo* dictionary_memo,
+                              const IpcOptions& options, io::RandomAccessFile* file,
+                              int64_t body_offset, std::shared_ptr<RecordBatch>* out) {
   const flatbuf::Message* message;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -413,7 +574,26 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
-  return ReadRecordBatch(batch, schema, dictionary_memo, options, file, out);
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
+  return ReadRecordBatch(batch, schema, load_plan, field_indices, dictionary_memo,
+                         compression, options, file, body_offset, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, /*load_plan=*/nullptr,
+                         /*field_indices=*/nullptr, dictionary_memo, options, file,
+                         /*body_offset=*/0, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const DictionaryMemo* dictionary_memo,
+                       const std::vector<int>& field_indices, const IpcOptions& options,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, /*load_plan=*/nullptr, &field_indices,
+                         dictionary_memo, options, file, /*body_offset=*/0, out);
 }
 
 Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
@@ -428,6 +608,9 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
         "Header-type of flatbuffer-encoded Message is not DictionaryBatch.");
   }
 
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
+
   int64_t id = dictionary_batch->id();
 
   // Look up the field, which must have been added to the
@@ -441,11 +624,16 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta = dictionary_batch->data();
   RETURN_NOT_OK(ReadRecordBatch(batch_meta, ::arrow::schema({value_field}),
-                                dictionary_memo, options, file, &batch));
+                                /*load_plan=*/nullptr, /*field_indices=*/nullptr,
+                                dictionary_memo, compression, options, file,
+                                /*body_offset=*/0, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, default_memory_pool());
+  }
   return dictionary_memo->AddDictionary(id, dictionary);
 }
 
@@ -477,15 +665,17 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     if (message->header() == nullptr) {
       return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
     }
-    return internal::GetSchema(message->header(), &dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(message->header(), &dictionary_memo_, &schema_));
+    return MakeLoadPlan(*schema_, &dictionary_memo_, options_.max_recursion_depth,
+                        &load_plan_);
   }
 
   Status ParseDictionary(const Message& message) {
     // Only invoke this method if we already know we have a dictionary message
     DCHECK_EQ(message.type(), Message::DICTIONARY_BATCH);
-    CHECK_HAS_BODY(message);
-    io::BufferReader reader(message.body());
-    return ReadDictionary(*message.metadata(), &dictionary_memo_, &reader);
+    std::unique_ptr<io::RandomAccessFile> reader;
+    RETURN_NOT_OK(OpenBodyReader(message, &reader));
+    return ReadDictionary(*message.metadata(), &dictionary_memo_, reader.get());
   }
 
   Status ReadInitialDictionaries() {
@@ -540,21 +730,23 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    // Apply any dictionary deltas preceding the record batch
+    while (message != nullptr && message->type() == Message::DICTIONARY_BATCH) {
+      RETURN_NOT_OK(ParseDictionary(*message));
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    }
     if (message == nullptr) {
       // End of stream
       *batch = nullptr;
       return Status::OK();
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      // TODO(wesm): implement delta dictionaries
-      return Status::NotImplemented("Delta dictionaries not yet implemented");
-    } else {
-      CHECK_HAS_BODY(*message);
-      io::BufferReader reader(message->body());
-      return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, &reader,
-                             batch);
-    }
+    std::unique_ptr<io::RandomAccessFile> reader;
+    RETURN_NOT_OK(OpenBodyReader(*message, &reader));
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &load_plan_,
+                                         /*field_indices=*/nullptr, &dictionary_memo_,
+                                         options_, reader.get(), /*body_offset=*/0,
+                                         batch);
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
@@ -570,6 +762,9 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
   DictionaryMemo dictionary_memo_;
   std::shared_ptr<Schema> schema_;
+  // The load plan of schema_, made once for all the record batches
+  std::vector<ArrayLoadPlan> load_plan_;
+  IpcOptions options_ = IpcOptions::Defaults();
 };
 
 RecordBatchStreamReader::RecordBatchStreamReader() {
@@ -711,17 +906,50 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       read_dictionaries_ = true;
     }
 
+    const FileBlock block = GetRecordBatchBlock(i);
+    // Zero-copy reads (e.g. from memory maps) only page in the body when it is
+    // accessed: have it loaded in the background instead
+    RETURN_NOT_OK(
+        file_->WillNeed({{block.offset, block.metadata_length + block.body_length}}));
+
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    RETURN_NOT_OK(ReadMessageFromBlock(block, &message));
 
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         &reader, batch);
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &load_plan_,
+                                         /*field_indices=*/nullptr, &dictionary_memo_,
+                                         options_, &reader, /*body_offset=*/0, batch);
+  }
+
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch) {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+
+    // Only read the metadata: the buffers of the selected fields are read
+    // directly from the file, and the rest of the body is never touched
+    const FileBlock block = GetRecordBatchBlock(i);
+    std::shared_ptr<Buffer> metadata;
+    RETURN_NOT_OK(ReadMessageMetadata(block.offset, block.metadata_length, file_,
+                                      &metadata));
+    if (metadata == nullptr) {
+      return Status::IOError("Unexpected end of stream in record batch ", i);
+    }
+    return ::arrow::ipc::ReadRecordBatch(*metadata, schema_, &load_plan_, &field_indices,
+                                         &dictionary_memo_, options_, file_,
+                                         block.offset + block.metadata_length, batch);
   }
 
   Status ReadSchema() {
     // Get the schema and record any observed dictionaries
-    return internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_));
+    return MakeLoadPlan(*schema_, &dictionary_memo_, options_.max_recursion_depth,
+                        &load_plan_);
   }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
@@ -756,6 +984,9 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+  // The load plan of schema_, made once for all the record batches
+  std::vector<ArrayLoadPlan> load_plan_;
+  IpcOptions options_ = IpcOptions::Defaults();
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -802,6 +1033,12 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::ReadRecordBatch(int i,
+                                              const std::vector<int>& field_indices,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, field_indices, batch);
+}
+
 static Status ReadContiguousPayload(io::InputStream* file,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, message));
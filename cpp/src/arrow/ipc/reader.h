@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -161,6 +162,21 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read some of the columns of a particular record batch from the
+  /// file.
+  ///
+  /// Only the metadata of the record batch and the buffers of the selected
+  /// columns are read, so that with a memory-mapped file the cost does not
+  /// depend on the number of other columns or on their size.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] field_indices the indices in the schema of the columns to
+  /// read, in the order they should appear in the batch
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch);
+
  private:
   RecordBatchFileReader();
 
@@ -256,6 +272,27 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
                        const DictionaryMemo* dictionary_memo, const IpcOptions& options,
                        io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out);
 
+/// Read some of the columns of a record batch from file given metadata and schema
+///
+/// The buffers of the other columns are not read from the file.
+///
+/// \param[in] metadata a Message containing the record batch metadata
+/// \param[in] schema the record batch schema
+/// \param[in] dictionary_memo DictionaryMemo which has any
+/// dictionaries. Can be nullptr if you are sure there are no
+/// dictionary-encoded fields
+/// \param[in] field_indices the indices in the schema of the columns to read,
+/// in the order they should appear in the output
+/// \param[in] options options for deserialization
+/// \param[in] file a random access file
+/// \param[out] out the read record batch, with only the selected columns
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const DictionaryMemo* dictionary_memo,
+                       const std::vector<int>& field_indices, const IpcOptions& options,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out);
+
 /// \brief Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] file an InputStream pointed at the start of the message
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/interfaces.h"
@@ -44,8 +45,12 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -156,7 +161,54 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, custom_metadata_.get(), &out_->metadata);
+  }
+
+  Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
+                        std::shared_ptr<Buffer>* out) {
+    // Convert buffer to uncompressed-length-prefixed compressed buffer
+    int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+    std::shared_ptr<Buffer> result;
+    RETURN_NOT_OK(AllocateBuffer(pool_, maximum_length + sizeof(int64_t), &result));
+
+    int64_t actual_length;
+    ARROW_ASSIGN_OR_RAISE(actual_length,
+                          codec->Compress(buffer.size(), buffer.data(), maximum_length,
+                                          result->mutable_data() + sizeof(int64_t)));
+    *reinterpret_cast<int64_t*>(result->mutable_data()) =
+        BitUtil::ToLittleEndian(buffer.size());
+    *out = SliceBuffer(result, /*offset=*/0, actual_length + sizeof(int64_t));
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    if (options_.compression != Compression::LZ4 &&
+        options_.compression != Compression::ZSTD) {
+      return Status::Invalid("Only LZ4 and ZSTD compression allowed in IPC, got ",
+                             util::Codec::GetCodecAsString(options_.compression));
+    }
+    std::unique_ptr<util::Codec> codec;
+    ARROW_ASSIGN_OR_RAISE(
+        codec, util::Codec::Create(options_.compression, options_.compression_level));
+    RETURN_NOT_OK(codec->SetDictionary(options_.compression_dictionary));
+
+    // One-shot compression does not keep any state in the codec, so the
+    // instance can be shared among worker threads.  Zero-length buffers,
+    // including the placeholders for validity bitmaps without nulls, are
+    // left as-is
+    auto& buffers = out_->body_buffers;
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        options_.use_threads && buffers.size() > 1, static_cast<int>(buffers.size()),
+        [&](int i) {
+          if (buffers[i] && buffers[i]->size() > 0) {
+            return CompressBuffer(*buffers[i], codec.get(), &buffers[i]);
+          }
+          return Status::OK();
+        }));
+    custom_metadata_ = key_value_metadata(
+        {internal::kCompressionMetadataKey},
+        {util::Codec::GetCodecAsString(options_.compression)});
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -171,6 +223,10 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    if (options_.compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -503,6 +559,9 @@ class RecordBatchSerializer : public ArrayVisitor {
   std::vector<internal::FieldMetadata> field_nodes_;
   std::vector<internal::BufferMetadata> buffer_meta_;
 
+  // Message-level custom metadata, e.g. the body compression codec
+  std::shared_ptr<KeyValueMetadata> custom_metadata_;
+
   const IpcOptions& options_;
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
@@ -510,14 +569,17 @@ class RecordBatchSerializer : public ArrayVisitor {
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   const IpcOptions& options, IpcPayload* out)
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
       : RecordBatchSerializer(pool, buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
+                                  field_nodes_, buffer_meta_, custom_metadata_.get(),
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -529,36 +591,55 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
+static std::shared_ptr<Buffer> GetPadding(int64_t nbytes) {
+  static std::shared_ptr<Buffer> kPadding =
+      std::make_shared<Buffer>(kPaddingBytes, kArrowAlignment);
+  DCHECK_LE(nbytes, kArrowAlignment);
+  return SliceBuffer(kPadding, 0, nbytes);
+}
+
 Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
                        io::OutputStream* dst, int32_t* metadata_length) {
-  RETURN_NOT_OK(WriteMessage(*payload.metadata, options, dst, metadata_length));
-
-#ifndef NDEBUG
-  RETURN_NOT_OK(CheckAligned(dst));
-#endif
-
-  // Now write the buffers
-  for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
-    const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
-    int64_t size = 0;
-    int64_t padding = 0;
+  // The message is framed as in WriteMessage(), and the whole payload is
+  // passed to the stream in a single gather write
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(payload.body_buffers.size() * 2 + 3);
+
+  const int32_t prefix_size = options.write_legacy_ipc_format ? 4 : 8;
+  const int32_t flatbuffer_size = static_cast<int32_t>(payload.metadata->size());
+  *metadata_length = static_cast<int32_t>(
+      PaddedLength(flatbuffer_size + prefix_size, options.alignment));
+
+  // ARROW-6314: Continuation token, then the flatbuffer size including padding
+  const int32_t prefix[2] = {internal::kIpcContinuationToken,
+                             *metadata_length - prefix_size};
+  const char* prefix_data = reinterpret_cast<const char*>(prefix);
+  if (options.write_legacy_ipc_format) {
+    prefix_data += sizeof(int32_t);
+  }
+  buffers.push_back(Buffer::FromString(std::string(prefix_data, prefix_size)));
+  buffers.push_back(payload.metadata);
+  const int64_t metadata_padding = *metadata_length - flatbuffer_size - prefix_size;
+  if (metadata_padding > 0) {
+    buffers.push_back(GetPadding(metadata_padding));
+  }
 
+  for (const auto& buffer : payload.body_buffers) {
     // The buffer might be null if we are handling zero row lengths.
-    if (buffer) {
-      size = buffer->size();
-      padding = BitUtil::RoundUpToMultipleOf8(size) - size;
-    }
-
-    if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
+    if (buffer == nullptr || buffer->size() == 0) {
+      continue;
     }
-
+    buffers.push_back(buffer);
+    const int64_t size = buffer->size();
+    const int64_t padding = BitUtil::RoundUpToMultipleOf8(size) - size;
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      buffers.push_back(GetPadding(padding));
     }
   }
+  RETURN_NOT_OK(dst->WriteVectored(buffers));
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -576,9 +657,16 @@ Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, pool, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionaryWriter writer(id, pool, /*buffer_start_offset=*/0, options, out);
+  DictionaryWriter writer(id, is_delta, pool, /*buffer_start_offset=*/0, options, out);
   return writer.Assemble(dictionary);
 }
 
@@ -933,27 +1021,76 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
-    if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
-      return Status::Invalid("Tried to write record batch with different schema");
-    }
-
-    RETURN_NOT_OK(CheckStarted());
-
-    if (!wrote_dictionaries_) {
-      RETURN_NOT_OK(WriteDictionaries(batch));
-      wrote_dictionaries_ = true;
+    if (options_.target_message_size > 0) {
+      if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
+        return Status::Invalid("Tried to write record batch with different schema");
+      }
+      return WriteResized(batch.Slice(0));
     }
 
-    // TODO(wesm): Check for delta dictionaries. Can we scan for
-    // deltas while computing the RecordBatch payload to save time?
+    RETURN_NOT_OK(PrepareRecordBatch(batch));
 
     internal::IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
     return payload_writer_->WritePayload(payload);
   }
 
+  using RecordBatchWriter::WriteTable;
+
+  // Assemble and compress the payloads of up to one record batch per CPU
+  // thread in parallel, then write them and their dictionaries in order
+  Status WriteTable(const Table& table, int64_t max_chunksize) override {
+    if (!options_.use_threads || options_.target_message_size > 0) {
+      return RecordBatchWriter::WriteTable(table, max_chunksize);
+    }
+
+    TableBatchReader reader(table);
+    if (max_chunksize > 0) {
+      reader.set_chunksize(max_chunksize);
+    }
+
+    // The buffers of a record batch are only compressed in parallel when it
+    // is assembled alone, as tasks must not wait on the thread pool they run on
+    IpcOptions batch_options = options_;
+    batch_options.use_threads = false;
+
+    const int window = std::max(1, ::arrow::internal::GetCpuThreadPoolCapacity());
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    std::vector<internal::IpcPayload> payloads;
+    bool finished = false;
+    while (!finished) {
+      batches.clear();
+      while (static_cast<int>(batches.size()) < window) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(reader.ReadNext(&batch));
+        if (batch == nullptr) {
+          finished = true;
+          break;
+        }
+        batches.push_back(std::move(batch));
+      }
+
+      const bool parallel_batches = batches.size() > 1;
+      payloads.clear();
+      payloads.resize(batches.size());
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          parallel_batches, static_cast<int>(batches.size()), [&](int i) {
+            return GetRecordBatchPayload(*batches[i],
+                                         parallel_batches ? batch_options : options_,
+                                         pool_, &payloads[i]);
+          }));
+
+      for (size_t i = 0; i < batches.size(); ++i) {
+        RETURN_NOT_OK(PrepareRecordBatch(*batches[i]));
+        RETURN_NOT_OK(payload_writer_->WritePayload(payloads[i]));
+      }
+    }
+    return Status::OK();
+  }
+
   Status Close() override {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(FlushPending());
     return payload_writer_->Close();
   }
 
@@ -976,6 +1113,125 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  int64_t MessageSize(const internal::IpcPayload& payload) const {
+    // Length prefix and padded metadata, as framed by WriteIpcPayload(), then body
+    const int32_t prefix_size = options_.write_legacy_ipc_format ? 4 : 8;
+    return PaddedLength(prefix_size + payload.metadata->size(), options_.alignment) +
+           payload.body_length;
+  }
+
+  // Split the batch into slices whose messages fit in target_message_size,
+  // and hold back smaller batches to concatenate them with the next ones
+  Status WriteResized(const std::shared_ptr<RecordBatch>& batch) {
+    const int64_t target = options_.target_message_size;
+    internal::IpcPayload payload;
+    RETURN_NOT_OK(GetRecordBatchPayload(*batch, options_, pool_, &payload));
+    const int64_t size = MessageSize(payload);
+
+    if (size > target && batch->num_rows() > 1) {
+      // The slices are sized from the average row size, and split again if
+      // their rows turn out larger
+      const int64_t num_rows = batch->num_rows();
+      const int64_t num_slices = std::min(num_rows, (size + target - 1) / target);
+      const int64_t slice_length = (num_rows + num_slices - 1) / num_slices;
+      for (int64_t offset = 0; offset < num_rows; offset += slice_length) {
+        RETURN_NOT_OK(WriteResized(batch->Slice(offset, slice_length)));
+      }
+      return Status::OK();
+    }
+
+    if (pending_size_ + size > target || !HasPendingDictionaries(*batch)) {
+      RETURN_NOT_OK(FlushPending());
+    }
+    if (size >= target) {
+      RETURN_NOT_OK(PrepareRecordBatch(*batch));
+      return payload_writer_->WritePayload(payload);
+    }
+    if (pending_.empty()) {
+      pending_payload_ = std::move(payload);
+    }
+    pending_.push_back(batch);
+    pending_size_ += size;
+    return Status::OK();
+  }
+
+  // Whether the top-level dictionaries of the batch are those of the held
+  // back batches, so that they can be concatenated
+  bool HasPendingDictionaries(const RecordBatch& batch) const {
+    if (pending_.empty()) {
+      return true;
+    }
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const auto& data = batch.column_data(i);
+      if (data->type->id() == Type::DICTIONARY &&
+          data->dictionary != pending_.front()->column_data(i)->dictionary) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Write the held back batches as a single record batch
+  Status FlushPending() {
+    if (pending_.empty()) {
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    batches.swap(pending_);
+    pending_size_ = 0;
+
+    if (batches.size() == 1) {
+      RETURN_NOT_OK(PrepareRecordBatch(*batches[0]));
+      return payload_writer_->WritePayload(pending_payload_);
+    }
+
+    int64_t num_rows = 0;
+    for (const auto& batch : batches) {
+      num_rows += batch->num_rows();
+    }
+    std::vector<std::shared_ptr<Array>> columns(schema_.num_fields());
+    for (int i = 0; i < schema_.num_fields(); ++i) {
+      ArrayVector chunks;
+      for (const auto& batch : batches) {
+        chunks.push_back(batch->column(i));
+      }
+      Status st = Concatenate(chunks, pool_, &columns[i]);
+      if (st.IsNotImplemented()) {
+        // Nested dictionaries differ between the batches
+        for (const auto& batch : batches) {
+          RETURN_NOT_OK(PrepareRecordBatch(*batch));
+          internal::IpcPayload payload;
+          RETURN_NOT_OK(GetRecordBatchPayload(*batch, options_, pool_, &payload));
+          RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+        }
+        return Status::OK();
+      }
+      RETURN_NOT_OK(st);
+    }
+    auto batch = RecordBatch::Make(batches[0]->schema(), num_rows, columns);
+
+    RETURN_NOT_OK(PrepareRecordBatch(*batch));
+    internal::IpcPayload payload;
+    RETURN_NOT_OK(GetRecordBatchPayload(*batch, options_, pool_, &payload));
+    return payload_writer_->WritePayload(payload);
+  }
+
+  // Write the schema and the dictionaries that must precede the record batch
+  Status PrepareRecordBatch(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
+      return Status::Invalid("Tried to write record batch with different schema");
+    }
+
+    RETURN_NOT_OK(CheckStarted());
+
+    if (!wrote_dictionaries_) {
+      RETURN_NOT_OK(WriteDictionaries(batch));
+      wrote_dictionaries_ = true;
+      return Status::OK();
+    }
+    return WriteDictionaryDeltas(batch);
+  }
+
   Status WriteDictionaries(const RecordBatch& batch) {
     RETURN_NOT_OK(CollectDictionaries(batch, dictionary_memo_));
 
@@ -991,6 +1247,43 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write the new entries of the dictionaries that grew since the previous
+  // record batch
+  Status WriteDictionaryDeltas(const RecordBatch& batch) {
+    RETURN_NOT_OK(GetDictionaries(schema_, batch, *dictionary_memo_, &dictionaries_));
+
+    for (const auto& pair : dictionaries_) {
+      int64_t dictionary_id = pair.first;
+      const auto& dictionary = pair.second;
+      std::shared_ptr<Array> last_dictionary;
+      RETURN_NOT_OK(dictionary_memo_->GetDictionary(dictionary_id, &last_dictionary));
+      if (dictionary == last_dictionary) {
+        continue;
+      }
+
+      const int64_t last_length = last_dictionary->length();
+      if (dictionary->length() < last_length ||
+          !dictionary->RangeEquals(0, last_length, 0, *last_dictionary)) {
+        return Status::Invalid("Dictionary with id ", dictionary_id,
+                               " is not an extension of the previously written one");
+      }
+      if (dictionary->length() > last_length) {
+        if (!options_.emit_dictionary_deltas) {
+          return Status::Invalid("Dictionary with id ", dictionary_id,
+                                 " grew between record batches, enable "
+                                 "emit_dictionary_deltas to write it");
+        }
+        internal::IpcPayload payload;
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, /*is_delta=*/true,
+                                           dictionary->Slice(last_length), options_,
+                                           pool_, &payload));
+        RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      }
+      RETURN_NOT_OK(dictionary_memo_->UpdateDictionary(dictionary_id, dictionary));
+    }
+    return Status::OK();
+  }
+
  protected:
   std::unique_ptr<internal::IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
@@ -1001,6 +1294,15 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   bool started_ = false;
   bool wrote_dictionaries_ = false;
   IpcOptions options_;
+
+  // Scratch space for WriteDictionaryDeltas()
+  DictionaryVector dictionaries_;
+
+  // Batches held back by WriteResized(), their total message size, and the
+  // payload of the first one
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_size_ = 0;
+  internal::IpcPayload pending_payload_;
 };
 
 // ----------------------------------------------------------------------
@@ -1068,9 +1370,7 @@ class PayloadStreamWriter : public internal::IpcPayloadWriter,
 #endif
 
     int32_t metadata_length = 0;  // unused
-    RETURN_NOT_OK(WriteIpcPayload(payload, options_, sink_, &metadata_length));
-    RETURN_NOT_OK(UpdatePositionCheckAligned());
-    return Status::OK();
+    return WriteIpcPayload(payload, options_, sink_, &metadata_length);
   }
 
   Status Close() override { return WriteEOS(); }
@@ -1095,7 +1395,8 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Metadata length must include padding, it's computed by WriteIpcPayload()
     FileBlock block = {position_, 0, payload.body_length};
     RETURN_NOT_OK(WriteIpcPayload(payload, options_, sink_, &block.metadata_length));
-    RETURN_NOT_OK(UpdatePositionCheckAligned());
+    // Track the position rather than asking the sink for it
+    position_ += block.metadata_length + block.body_length;
 
     // Record position and size of some message types, to list them in the footer
     switch (payload.type) {
@@ -1187,6 +1488,10 @@ Status RecordBatchStreamWriter::WriteRecordBatch(const RecordBatch& batch) {
   return impl_->WriteRecordBatch(batch);
 }
 
+Status RecordBatchStreamWriter::WriteTable(const Table& table, int64_t max_chunksize) {
+  return impl_->WriteTable(table, max_chunksize);
+}
+
 void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
   impl_->set_memory_pool(pool);
 }
@@ -1245,6 +1550,10 @@ Status RecordBatchFileWriter::WriteRecordBatch(const RecordBatch& batch) {
   return file_impl_->WriteRecordBatch(batch);
 }
 
+Status RecordBatchFileWriter::WriteTable(const Table& table, int64_t max_chunksize) {
+  return file_impl_->WriteTable(table, max_chunksize);
+}
+
 Status RecordBatchFileWriter::Close() { return file_impl_->Close(); }
 
 namespace internal {
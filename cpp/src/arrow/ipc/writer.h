@@ -68,10 +68,14 @@ class ARROW_EXPORT RecordBatchWriter {
   Status WriteTable(const Table& table);
 
   /// \brief Write Table with a particular chunksize
+  ///
+  /// The stream and file writers assemble and compress several record
+  /// batches in parallel when IpcOptions::use_threads is set.
+  ///
   /// \param[in] table table to write
   /// \param[in] max_chunksize maximum chunk size for table chunks
   /// \return Status
-  Status WriteTable(const Table& table, int64_t max_chunksize);
+  virtual Status WriteTable(const Table& table, int64_t max_chunksize);
 
   /// \brief Perform any logic necessary to finish the stream
   ///
@@ -120,6 +124,9 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
   /// \return Status
   Status WriteRecordBatch(const RecordBatch& batch) override;
 
+  using RecordBatchWriter::WriteTable;
+  Status WriteTable(const Table& table, int64_t max_chunksize) override;
+
   /// \brief Close the stream by writing a 4-byte int32 0 EOS market
   /// \return Status
   Status Close() override;
@@ -167,6 +174,9 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   /// \return Status
   Status WriteRecordBatch(const RecordBatch& batch) override;
 
+  using RecordBatchWriter::WriteTable;
+  Status WriteTable(const Table& table, int64_t max_chunksize) override;
+
   /// \brief Close the file stream by writing the file footer and magic number
   /// \return Status
   Status Close() override;
@@ -385,6 +395,20 @@ Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* payload);
 
+/// \brief Compute IpcPayload for a dictionary or a dictionary delta
+/// \param[in] id the dictionary id
+/// \param[in] is_delta whether the values are to be appended to the
+/// dictionary with the same id
+/// \param[in] dictionary the dictionary values
+/// \param[in] options options for serialization
+/// \param[out] payload the output IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* payload);
+
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
 /// \param[in] options options for serialization
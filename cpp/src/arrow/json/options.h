@@ -38,6 +38,15 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+enum class ParserBackend : char {
+  /// Values are read with rapidjson's SAX reader
+  RapidJSON,
+  /// A vectorized pass indexes the structural characters of each block, then
+  /// values are read from that index (see StructuralIndexReader). Values of
+  /// fields ignored per UnexpectedFieldBehavior::Ignore are skipped unparsed.
+  StructuralIndex
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -52,6 +61,9 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Which implementation reads JSON values from each block
+  ParserBackend parser_backend = ParserBackend::RapidJSON;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -65,6 +77,14 @@ struct ARROW_EXPORT ReadOptions {
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
 
+  /// If positive, merge consecutive chunks of the resulting table into chunks
+  /// of up to this many rows (see Table::CoalesceChunks); chunks are kept as
+  /// parsed if both coalescing targets are 0
+  int64_t coalesce_target_rows = 0;
+  /// If positive, merge consecutive chunks of the resulting table into chunks
+  /// of up to this many bytes
+  int64_t coalesce_target_bytes = 0;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 };
@@ -31,6 +31,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
+#include "arrow/json/structural_index.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
@@ -99,6 +100,7 @@ Status Kind::ForType(const DataType& type, Kind::type* kind) {
     Status Visit(const NumberType&) { return SetKind(Kind::kNumber); }
     Status Visit(const TimeType&) { return SetKind(Kind::kNumber); }
     Status Visit(const DateType&) { return SetKind(Kind::kNumber); }
+    Status Visit(const TimestampType&) { return SetKind(Kind::kString); }
     Status Visit(const BinaryType&) { return SetKind(Kind::kString); }
     Status Visit(const FixedSizeBinaryType&) { return SetKind(Kind::kString); }
     Status Visit(const DictionaryType& dict_type) {
@@ -585,6 +587,9 @@ class HandlerBase : public BlockParser,
   /// Accessor for a stored error Status
   Status Error() { return status_; }
 
+  /// Whether the value of the last key is irrelevant (see StructuralIndexReader)
+  bool ShouldSkipValue() { return false; }
+
   /// \defgroup rapidjson-handler-interface functions expected by rj::Reader
   ///
   /// bool Key(const char* data, rj::SizeType size, ...) is omitted since
@@ -638,7 +643,8 @@ class HandlerBase : public BlockParser,
   /// @}
 
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  Status Initialize(const std::shared_ptr<Schema>& s, ParserBackend backend) {
+    backend_ = backend;
     auto type = struct_({});
     if (s) {
       type = struct_(s->fields());
@@ -700,9 +706,32 @@ class HandlerBase : public BlockParser,
     return Status::Invalid("Exceeded maximum rows");
   }
 
+  template <typename Handler>
+  Status DoParseIndexed(Handler& handler, StructuralIndexReader* reader) {
+    for (; num_rows_ < kMaxParserNumRows; ++num_rows_) {
+      if (reader->Done()) {
+        return Status::OK();
+      }
+      if (!reader->Parse(handler)) {
+        if (reader->error() == nullptr) {
+          // handler emitted an error
+          return handler.Error();
+        }
+        return ParseError(reader->error(), " in row ", num_rows_);
+      }
+    }
+    return Status::Invalid("Exceeded maximum rows");
+  }
+
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (backend_ == ParserBackend::StructuralIndex) {
+      StructuralIndexReader reader;
+      RETURN_NOT_OK(reader.Index(reinterpret_cast<const char*>(json->data()),
+                                 json->size()));
+      return DoParseIndexed(handler, &reader);
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -830,6 +859,7 @@ class HandlerBase : public BlockParser,
   }
 
   Status status_;
+  ParserBackend backend_ = ParserBackend::RapidJSON;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
   // top of this stack is the parent of builder_
@@ -958,6 +988,9 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
     return HandlerBase::EndArray(size);
   }
 
+  /// Values of unexpected fields can be skipped wholesale
+  bool ShouldSkipValue() { return Skipping(); }
+
  private:
   bool Skipping() { return depth_ >= skip_depth_; }
 
@@ -1085,7 +1118,8 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema,
+                                                     options.parser_backend);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -36,13 +36,23 @@ std::shared_ptr<Schema> TestSchema() {
 
 constexpr int seed = 0x432432;
 
-std::string TestJsonData(int num_rows, bool pretty = false) {
+// A schema whose JSON is mostly made of fields outside of TestSchema()
+std::shared_ptr<Schema> WideTestSchema() {
+  auto nested = struct_({field("list", list(float64())), field("str", utf8()),
+                         field("struct", struct_({field("bool", boolean())}))});
+  return schema({field("int", int32()), field("nested0", nested),
+                 field("nested1", list(nested)), field("str", utf8()),
+                 field("nested2", nested)});
+}
+
+std::string TestJsonData(int num_rows, bool pretty = false,
+                         const std::shared_ptr<Schema>& schm = TestSchema()) {
   std::default_random_engine engine(seed);
   std::string json;
   for (int i = 0; i < num_rows; ++i) {
     StringBuffer sb;
     Writer writer(sb);
-    ABORT_NOT_OK(Generate(TestSchema(), engine, &writer));
+    ABORT_NOT_OK(Generate(schm, engine, &writer));
     json += pretty ? PrettyPrint(sb.GetString()) : sb.GetString();
     json += "\n";
   }
@@ -113,6 +123,40 @@ static void ParseJSONBlockWithSchema(
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockWithSchemaStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  options.explicit_schema = TestSchema();
+  options.parser_backend = ParserBackend::StructuralIndex;
+
+  auto json = TestJsonData(num_rows);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void BenchmarkProjectedJSONParsing(
+    benchmark::State& state, ParserBackend backend) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema = TestSchema();
+  options.parser_backend = backend;
+
+  auto json = TestJsonData(num_rows, /* pretty */ false, WideTestSchema());
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseProjectedJSONBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkProjectedJSONParsing(state, ParserBackend::RapidJSON);
+}
+
+static void ParseProjectedJSONBlockStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkProjectedJSONParsing(state, ParserBackend::StructuralIndex);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -158,6 +202,9 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaStructuralIndex);
+BENCHMARK(ParseProjectedJSONBlock);
+BENCHMARK(ParseProjectedJSONBlockStructuralIndex);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -145,12 +146,15 @@ TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
-class BlockParserTypeError : public ::testing::TestWithParam<UnexpectedFieldBehavior> {
+class BlockParserTypeError
+    : public ::testing::TestWithParam<
+          std::tuple<UnexpectedFieldBehavior, ParserBackend>> {
  public:
   ParseOptions Options(std::shared_ptr<Schema> explicit_schema) {
     auto options = ParseOptions::Defaults();
     options.explicit_schema = std::move(explicit_schema);
-    options.unexpected_field_behavior = GetParam();
+    options.unexpected_field_behavior = std::get<0>(GetParam());
+    options.parser_backend = std::get<1>(GetParam());
     return options;
   }
 };
@@ -188,10 +192,13 @@ TEST_P(BlockParserTypeError, FailOnDuplicateKeys) {
       testing::StartsWith("JSON parse error: Column(/a) was specified twice in row 0"));
 }
 
-INSTANTIATE_TEST_CASE_P(BlockParserTypeError, BlockParserTypeError,
-                        ::testing::Values(UnexpectedFieldBehavior::Ignore,
-                                          UnexpectedFieldBehavior::Error,
-                                          UnexpectedFieldBehavior::InferType));
+INSTANTIATE_TEST_CASE_P(
+    BlockParserTypeError, BlockParserTypeError,
+    ::testing::Combine(::testing::Values(UnexpectedFieldBehavior::Ignore,
+                                         UnexpectedFieldBehavior::Error,
+                                         UnexpectedFieldBehavior::InferType),
+                       ::testing::Values(ParserBackend::RapidJSON,
+                                         ParserBackend::StructuralIndex)));
 
 TEST(BlockParserWithSchema, Nested) {
   auto options = ParseOptions::Defaults();
@@ -235,5 +242,109 @@ TEST(BlockParser, Nested) {
                       R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
 }
 
+class BlockParserBackend : public ::testing::TestWithParam<ParserBackend> {
+ public:
+  ParseOptions Options() {
+    auto options = ParseOptions::Defaults();
+    options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+    options.parser_backend = GetParam();
+    return options;
+  }
+};
+
+TEST_P(BlockParserBackend, Basics) {
+  AssertParseColumns(
+      Options(), scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_P(BlockParserBackend, Nested) {
+  AssertParseColumns(Options(), nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_P(BlockParserBackend, SkipFieldsOutsideSchema) {
+  auto options = Options();
+  options.explicit_schema = schema({field("hello", float64()), field("yo", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, nested_src(), {field("hello", utf8()), field("yo", utf8())},
+                     {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]",
+                      "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_P(BlockParserBackend, SkipNestedFieldsOutsideSchema) {
+  auto options = Options();
+  options.explicit_schema = schema({field("a", int64())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, R"(
+    {"x": {"y": [1, {"z": "}]\""}], "w": null}, "a": 1}
+    {"a": 2, "x": [[], {}, "[{", -3.5e2, true]}
+    {"x": "{\"a\": 3}"}
+  )",
+                     {field("a", utf8())}, {R"(["1", "2", null])"});
+
+  // Skipped values must still be well formed
+  for (std::string src : {"{\"a\": 1, \"x\": [1, {]}", "{\"x\": {\"y\": 1]}",
+                          "{\"x\": [1, 2}", "{\"a\": 1, \"x\": }"}) {
+    std::shared_ptr<Array> parsed;
+    ASSERT_RAISES(Invalid, ParseFromString(options, src, &parsed)) << src;
+  }
+}
+
+TEST_P(BlockParserBackend, Numbers) {
+  AssertParseColumns(Options(), R"(
+    {"n": 0}
+    {"n": -12}
+    {"n": 1.5e+30}
+    {"n": -0.25E-3}
+  )",
+                     {field("n", utf8())}, {R"(["0", "-12", "1.5e+30", "-0.25E-3"])"});
+}
+
+TEST_P(BlockParserBackend, Escapes) {
+  AssertParseColumns(Options(), R"(
+    {"s\"": "\"\\\/\b\f\n\r\t"}
+    {"s\"": "\u00e9\ud83d\ude00", "t": "\\\\"}
+  )",
+                     {field("s\"", utf8()), field("t", utf8())},
+                     {R"(["\"\\/\b\f\n\r\t", "\u00e9\ud83d\ude00"])",
+                      R"([null, "\\\\"])"});
+}
+
+TEST_P(BlockParserBackend, LongStrings) {
+  // Strings and escape sequences straddling the 64 byte blocks of the index
+  std::string src, expected;
+  for (int length = 50; length < 200; length += 7) {
+    const std::string value = "\"" + std::string(length, 'x') + R"(\\\")" +
+                              std::string(length / 3, 'y') + "\"";
+    src += "{\"a\": " + value + ", \"b\": 1}\n";
+    expected += (expected.empty() ? "[" : ", ") + value;
+  }
+  AssertParseColumns(Options(), src, {field("a", utf8())}, {expected + "]"});
+}
+
+TEST_P(BlockParserBackend, FailOnMalformedJson) {
+  for (std::string src :
+       {"{\"a\": 01}", "{\"a\": 1.}", "{\"a\": tru}", "{\"a\" 1}", "{\"a\": 1 \"b\": 2}",
+        "{\"a\": [1,]}", "{\"a\": 1,}", "{\"a\": \"unterminated}", "{\"a\": \"\\q\"}",
+        "{\"a\": \"\\ud800\"}", "{\"a\": \"\\u12\"}", "{\"a\": \"tab\there\"}",
+        "{\"a\": 0, \"b\"", "{\"a\": [}", "{\"a\"}"}) {
+    std::shared_ptr<Array> parsed;
+    Status error = ParseFromString(Options(), src, &parsed);
+    ASSERT_RAISES(Invalid, error) << src;
+    EXPECT_THAT(error.message(), testing::HasSubstr("in row 0")) << src;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(BlockParserBackend, BlockParserBackend,
+                        ::testing::Values(ParserBackend::RapidJSON,
+                                          ParserBackend::StructuralIndex));
+
 }  // namespace json
 }  // namespace arrow
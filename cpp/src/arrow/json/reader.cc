@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <deque>
+#include <future>
 #include <utility>
 #include <vector>
 
@@ -45,6 +47,36 @@ using internal::ThreadPool;
 
 namespace json {
 
+// Parse the objects of a block, starting with the one straddling the previous block
+static Status ParseBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                         const std::shared_ptr<Buffer>& partial,
+                         const std::shared_ptr<Buffer>& completion,
+                         const std::shared_ptr<Buffer>& whole,
+                         std::shared_ptr<Array>* parsed) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool, &straddling));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  return parser->Finish(parsed);
+}
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -108,6 +140,14 @@ class TableReaderImpl : public TableReader,
 
     std::shared_ptr<ChunkedArray> array;
     RETURN_NOT_OK(builder_->Finish(&array));
+    if (read_options_.coalesce_target_rows > 0 ||
+        read_options_.coalesce_target_bytes > 0) {
+      std::shared_ptr<Table> table;
+      RETURN_NOT_OK(Table::FromChunkedStructArray(array, &table));
+      CoalesceOptions coalesce_options(read_options_.coalesce_target_rows,
+                                       read_options_.coalesce_target_bytes);
+      return table->CoalesceChunks(coalesce_options, pool_, out);
+    }
     return Table::FromChunkedStructArray(array, out);
   }
 
@@ -128,30 +168,203 @@ class TableReaderImpl : public TableReader,
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
+    std::shared_ptr<Array> parsed;
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, partial, completion, whole, &parsed));
+    builder_->Insert(block_index, field("", parsed->type()), parsed);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<TaskGroup> task_group_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<ChunkedArrayBuilder> builder_;
+};
+
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  // `thread_pool` is null if blocks should be decoded serially
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(thread_pool ? thread_pool->GetCapacity() : 1) {}
+
+  ~StreamingReaderImpl() override {
+    // Pending tasks refer to this reader's options
+    for (auto& pending : pending_blocks_) {
+      pending.wait();
+    }
+  }
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    RETURN_NOT_OK(MakeReadaheadIterator(std::move(it), max_blocks_in_flight_)
+                      .Value(&block_iterator_));
+    RETURN_NOT_OK(block_iterator_.Next().Value(&block_));
+    if (block_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+
+    // Decode the blocks up to the first object serially, inferring the schema
+    auto type = parse_options_.explicit_schema
+                    ? struct_(parse_options_.explicit_schema->fields())
+                    : struct_({});
+    auto promotion_graph =
+        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+            ? GetPromotionGraph()
+            : nullptr;
+    Chunk chunk;
+    bool has_chunk;
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(NextChunk(&chunk, &has_chunk));
+    while (has_chunk) {
+      std::shared_ptr<Array> parsed;
+      RETURN_NOT_OK(ParseBlock(pool_, parse_options_, chunk.partial, chunk.completion,
+                               chunk.whole, &parsed));
+      RETURN_NOT_OK(ConvertBlock(parsed, promotion_graph, type, &batch));
+      if (batch->num_rows() > 0) {
+        break;
       }
-      RETURN_NOT_OK(parser->Parse(straddling));
+      RETURN_NOT_OK(NextChunk(&chunk, &has_chunk));
     }
+    schema_ = batch->schema();
+    first_batch_ = std::move(batch);
+
+    // The following blocks are decoded against that schema
+    parse_options_.explicit_schema = schema_;
+    type_ = struct_(schema_->fields());
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
 
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    RETURN_NOT_OK(LaunchBlocks());
+    if (first_batch_ != nullptr) {
+      auto first_batch = std::move(first_batch_);
+      if (first_batch->num_rows() > 0) {
+        *batch = std::move(first_batch);
+        return Status::OK();
+      }
+    }
+    while (!pending_blocks_.empty()) {
+      auto pending = std::move(pending_blocks_.front());
+      pending_blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto next_batch, pending.get());
+      RETURN_NOT_OK(LaunchBlocks());
+      if (next_batch->num_rows() > 0) {
+        *batch = std::move(next_batch);
+        return Status::OK();
+      }
     }
+    // EOF
+    batch->reset();
+    return Status::OK();
+  }
 
+ private:
+  // A block of whole JSON objects, possibly straddling two IO blocks
+  struct Chunk {
+    std::shared_ptr<Buffer> partial;
+    std::shared_ptr<Buffer> completion;
+    std::shared_ptr<Buffer> whole;
+  };
+
+  Status ConvertBlock(const std::shared_ptr<Array>& parsed,
+                      const PromotionGraph* promotion_graph,
+                      const std::shared_ptr<DataType>& type,
+                      std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool_,
+                                          promotion_graph, type, &builder));
+    builder->Insert(0, field("", parsed->type()), parsed);
+    std::shared_ptr<ChunkedArray> converted;
+    RETURN_NOT_OK(builder->Finish(&converted));
+    return RecordBatch::FromStructArray(converted->chunk(0), out);
+  }
+
+  Status DecodeChunk(const Chunk& chunk, std::shared_ptr<RecordBatch>* out) {
     std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, chunk.partial, chunk.completion,
+                             chunk.whole, &parsed));
+    const auto& parsed_type = *parsed->type();
+    if (parsed_type.num_children() > schema_->num_fields()) {
+      // Only inferred fields can be unexpected, and they come last
+      return Status::Invalid("JSON field '",
+                             parsed_type.child(schema_->num_fields())->name(),
+                             "' is absent from the first block, which determines "
+                             "the schema of a streaming reader");
+    }
+    // Fields are in schema order, so no promotion is needed
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(ConvertBlock(parsed, nullptr, type_, &batch));
+    ArrayVector columns(batch->num_columns());
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      columns[i] = batch->column(i);
+    }
+    *out = RecordBatch::Make(schema_, batch->num_rows(), std::move(columns));
+    return Status::OK();
+  }
+
+  // Carve the next block of whole JSON objects out of the input
+  Status NextChunk(Chunk* out, bool* has_chunk) {
+    if (block_ == nullptr) {
+      *has_chunk = false;
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> next_block, next_partial;
+    RETURN_NOT_OK(block_iterator_.Next().Value(&next_block));
+    out->partial = partial_;
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &out->completion, &out->whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &out->completion,
+                                                 &starts_with_whole));
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &out->whole, &next_partial));
+    }
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    *has_chunk = true;
+    return Status::OK();
+  }
+
+  // Launch decoding of the next blocks, up to the in-flight limit
+  Status LaunchBlocks() {
+    using DecodeResult = Result<std::shared_ptr<RecordBatch>>;
+    while (static_cast<int>(pending_blocks_.size()) < max_blocks_in_flight_) {
+      Chunk chunk;
+      bool has_chunk;
+      RETURN_NOT_OK(NextChunk(&chunk, &has_chunk));
+      if (!has_chunk) {
+        break;
+      }
+      auto decode = [this, chunk]() -> DecodeResult {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(DecodeChunk(chunk, &batch));
+        return batch;
+      };
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto pending, thread_pool_->Submit(std::move(decode)));
+        pending_blocks_.push_back(std::move(pending));
+      } else {
+        std::promise<DecodeResult> decoded;
+        decoded.set_value(decode());
+        pending_blocks_.push_back(decoded.get_future());
+      }
+    }
     return Status::OK();
   }
 
@@ -159,9 +372,22 @@ class TableReaderImpl : public TableReader,
   ReadOptions read_options_;
   ParseOptions parse_options_;
   std::unique_ptr<Chunker> chunker_;
-  std::shared_ptr<TaskGroup> task_group_;
+  ThreadPool* thread_pool_;
+  const int max_blocks_in_flight_;
   Iterator<std::shared_ptr<Buffer>> block_iterator_;
-  std::shared_ptr<ChunkedArrayBuilder> builder_;
+
+  std::shared_ptr<Schema> schema_;
+  // Conversion target of the blocks following the first
+  std::shared_ptr<DataType> type_;
+  // Batch of the block the schema was inferred from
+  std::shared_ptr<RecordBatch> first_batch_;
+
+  // Incomplete object at the end of the last carved block
+  std::shared_ptr<Buffer> partial_;
+  // Next IO block to carve, null at EOF
+  std::shared_ptr<Buffer> block_;
+  // Batches being decoded, in file order
+  std::deque<std::future<Result<std::shared_ptr<RecordBatch>>>> pending_blocks_;
 };
 
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
@@ -181,6 +407,18 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, read_options, parse_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(reader->Init(std::move(input)));
+  *out = std::move(reader);
+  return Status::OK();
+}
+
 Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                 std::shared_ptr<RecordBatch>* out) {
   std::unique_ptr<BlockParser> parser;
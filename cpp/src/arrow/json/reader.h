@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -55,6 +56,30 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally as Arrow RecordBatches
+///
+/// Blocks of `ReadOptions::block_size` bytes are parsed and converted in
+/// parallel on the CPU thread pool (if `ReadOptions::use_threads` is true),
+/// with at most as many blocks in flight as the pool has threads, so that
+/// memory usage stays bounded regardless of the file size.  Batches are
+/// yielded in file order, one per block.
+///
+/// The schema is that of the first block containing objects: its fields are
+/// inferred as configured by `ParseOptions::unexpected_field_behavior`, and
+/// the following blocks are converted to the same fields and types.  In these
+/// blocks a field absent from the schema is an error if new fields would be
+/// inferred, and a field of null type must remain null.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance
+  ///
+  /// The first block with objects is read and converted before returning,
+  /// so that the schema is known.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
@@ -273,5 +273,121 @@ TEST(ReaderTest, MultipleChunksParallel) {
   AssertTablesEqual(*serial, *threaded);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    std::shared_ptr<io::InputStream> stream;
+    ASSERT_OK(MakeStream(input, &stream));
+    ASSERT_OK(StreamingReader::Make(default_memory_pool(), stream, read_options_,
+                                    parse_options_, &reader_));
+  }
+
+  void ReadAll(std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_OK(batch->ValidateFull());
+      ASSERT_TRUE(batch->schema()->Equals(*reader_->schema()));
+      batches->push_back(std::move(batch));
+    }
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, BatchesInOrder) {
+  const int count = 1 << 10;
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ", \"b\": \"" + std::to_string(i) + "\"}\n";
+  }
+  read_options_.block_size = 200;
+  SetUpReader(json);
+
+  auto expected_schema = schema({field("a", int64()), field("b", utf8())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_GT(batches.size(), static_cast<size_t>(10));
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    const auto& a = checked_cast<const Int64Array&>(*batch->column(0));
+    const auto& b = checked_cast<const StringArray&>(*batch->column(1));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      ASSERT_EQ(a.Value(i), expected);
+      ASSERT_EQ(b.GetString(i), std::to_string(expected));
+      ++expected;
+    }
+  }
+  ASSERT_EQ(expected, count);
+}
+
+TEST_P(StreamingReaderTest, SchemaFromFirstBlock) {
+  // The first block is only whitespace, so the schema comes from the second
+  const int block_size = 64;
+  read_options_.block_size = block_size;
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  std::string first_object = "{\"a\": 1, \"b\": null}";
+  first_object.resize(block_size - 1, ' ');
+  SetUpReader(std::string(block_size, '\n') + first_object +
+              "\n{\"a\": 2.5}\n{\"a\": 3, \"b\": null}\n");
+  auto expected_schema = schema({field("a", int64()), field("b", null())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+
+  // The second object's block is converted to the inferred type
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch->num_rows(), 1);
+  ASSERT_RAISES(Invalid, reader_->ReadNext(&batch));
+}
+
+TEST_P(StreamingReaderTest, UnexpectedFieldsAfterFirstBlock) {
+  read_options_.block_size = 16;
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  SetUpReader("{\"a\": 1}\n{\"a\": 2}\n{\"a\": 3, \"b\": 4}\n");
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  while ((st = reader_->ReadNext(&batch)).ok() && batch != nullptr) {
+  }
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_NE(st.message().find("'b'"), std::string::npos) << st.message();
+
+  // Ignored fields are not an error
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  SetUpReader("{\"a\": 1}\n{\"a\": 2}\n{\"a\": 3, \"b\": 4}\n");
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 3);
+}
+
+TEST_P(StreamingReaderTest, Empty) {
+  std::shared_ptr<io::InputStream> stream;
+  ASSERT_OK(MakeStream("", &stream));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), stream,
+                                               read_options_, parse_options_, &reader_));
+
+  SetUpReader("\n\n");
+  ASSERT_EQ(reader_->schema()->num_fields(), 0);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,447 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index.h"
+
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+constexpr int64_t kBlockSize = 64;
+constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+
+// Bitmasks of the bytes of a 64 byte block which belong to each character class
+struct BlockMasks {
+  uint64_t quote = 0;
+  uint64_t backslash = 0;
+  uint64_t whitespace = 0;
+  // brackets, colons and commas
+  uint64_t op = 0;
+  uint64_t control = 0;
+};
+
+#if defined(ARROW_HAVE_SSE2)
+
+inline uint64_t ToMask(__m128i matches) {
+  return static_cast<uint16_t>(_mm_movemask_epi8(matches));
+}
+
+BlockMasks ClassifyBlock(const uint8_t* block) {
+  BlockMasks masks;
+  for (int i = 0; i < kBlockSize / 16; ++i) {
+    const __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+    // Setting the 0x20 bit maps '[' and ']' onto '{' and '}'
+    const __m128i folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+    const __m128i whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')),
+                     _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')),
+                     _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r'))));
+    const __m128i op = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                     _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+        _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')),
+                     _mm_cmpeq_epi8(bytes, _mm_set1_epi8(','))));
+    const __m128i control =
+        _mm_cmpeq_epi8(_mm_min_epu8(bytes, _mm_set1_epi8(0x1F)), bytes);
+    const int shift = 16 * i;
+    masks.quote |= ToMask(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"'))) << shift;
+    masks.backslash |= ToMask(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\'))) << shift;
+    masks.whitespace |= ToMask(whitespace) << shift;
+    masks.op |= ToMask(op) << shift;
+    masks.control |= ToMask(control) << shift;
+  }
+  return masks;
+}
+
+#else
+
+BlockMasks ClassifyBlock(const uint8_t* block) {
+  BlockMasks masks;
+  for (int i = 0; i < kBlockSize; ++i) {
+    const uint64_t bit = uint64_t(1) << i;
+    switch (block[i]) {
+      case '"':
+        masks.quote |= bit;
+        break;
+      case '\\':
+        masks.backslash |= bit;
+        break;
+      case ' ':
+        masks.whitespace |= bit;
+        break;
+      case '\t':
+      case '\n':
+      case '\r':
+        masks.whitespace |= bit;
+        masks.control |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        masks.op |= bit;
+        break;
+      default:
+        if (block[i] < 0x20) {
+          masks.control |= bit;
+        }
+        break;
+    }
+  }
+  return masks;
+}
+
+#endif
+
+// Characters following an odd number of backslashes. *prev_escaped carries
+// whether the first character of the next block is escaped.
+inline uint64_t FindEscaped(uint64_t backslash, uint64_t* prev_escaped) {
+  backslash &= ~*prev_escaped;
+  const uint64_t follows_escape = backslash << 1 | *prev_escaped;
+  // Runs of backslashes starting on an odd bit are offset by adding their
+  // first bit: the carry lands one past the end of the run
+  const uint64_t odd_sequence_starts = backslash & ~kEvenBits & ~follows_escape;
+  const uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+  *prev_escaped = sequences_starting_on_even_bits < backslash;
+  const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+  return (kEvenBits ^ invert_mask) & follows_escape;
+}
+
+// Bit i of the result is the parity of bits 0 to i of x
+inline uint64_t PrefixXor(uint64_t x) {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline int HexValue(char c) {
+  if (IsDigit(c)) {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Parse the 4 hex digits of a \u escape
+inline bool ParseHex4(const char* data, const char* end, uint32_t* out) {
+  if (end - data < 4) {
+    return false;
+  }
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    const int digit = HexValue(data[i]);
+    if (digit < 0) {
+      return false;
+    }
+    value = value << 4 | static_cast<uint32_t>(digit);
+  }
+  *out = value;
+  return true;
+}
+
+void AppendUTF8(uint32_t codepoint, std::string* out) {
+  if (codepoint < 0x80) {
+    out->push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+inline bool IsWhitespace(char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+}  // namespace
+
+Status StructuralIndexReader::Index(const char* data, int64_t size) {
+  if (size > std::numeric_limits<uint32_t>::max()) {
+    return Status::Invalid("JSON block of ", size, " bytes is too large to index");
+  }
+  data_ = data;
+  size_ = size;
+  position_ = 0;
+  first_control_in_string_ = -1;
+  // Every byte may be structural
+  offsets_.resize(static_cast<size_t>(size));
+  uint32_t* out = offsets_.data();
+
+  uint64_t prev_escaped = 0;
+  uint64_t prev_in_string = 0;
+  uint64_t prev_scalar = 0;
+  uint8_t padded[kBlockSize];
+  for (int64_t base = 0; base < size; base += kBlockSize) {
+    auto block = reinterpret_cast<const uint8_t*>(data) + base;
+    if (size - base < kBlockSize) {
+      std::memset(padded, ' ', kBlockSize);
+      std::memcpy(padded, block, static_cast<size_t>(size - base));
+      block = padded;
+    }
+    const auto masks = ClassifyBlock(block);
+
+    const uint64_t quote = masks.quote & ~FindEscaped(masks.backslash, &prev_escaped);
+    // Opening quotes and the contents of strings, but not closing quotes
+    const uint64_t in_string = PrefixXor(quote) ^ prev_in_string;
+    prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    const uint64_t outside = ~(in_string | quote);
+    // Numbers and literals are runs of any other characters
+    const uint64_t scalar = ~(masks.op | masks.whitespace) & outside;
+    const uint64_t scalar_starts = scalar & ~(scalar << 1 | prev_scalar);
+    prev_scalar = scalar >> 63;
+
+    const uint64_t control_in_string = masks.control & in_string;
+    if (ARROW_PREDICT_FALSE(control_in_string != 0) && first_control_in_string_ < 0) {
+      first_control_in_string_ = base + BitUtil::CountTrailingZeros(control_in_string);
+    }
+
+    uint64_t structurals = (masks.op & outside) | quote | scalar_starts;
+    while (structurals != 0) {
+      *out++ = static_cast<uint32_t>(base + BitUtil::CountTrailingZeros(structurals));
+      structurals &= structurals - 1;
+    }
+  }
+  offsets_.resize(static_cast<size_t>(out - offsets_.data()));
+  return Status::OK();
+}
+
+bool StructuralIndexReader::ParseString(util::string_view* out) {
+  // Strings contain no structural characters, so the next offset is the
+  // closing quote
+  if (position_ + 1 >= offsets_.size()) {
+    return Fail("Missing a closing quotation mark in string.");
+  }
+  const int64_t begin = offsets_[position_] + 1;
+  const int64_t end = offsets_[position_ + 1];
+  position_ += 2;
+  if (ARROW_PREDICT_FALSE(first_control_in_string_ >= begin &&
+                          first_control_in_string_ < end)) {
+    return Fail("Invalid encoding in string.");
+  }
+
+  const char* data = data_ + begin;
+  const char* data_end = data_ + end;
+  const char* escape = static_cast<const char*>(std::memchr(data, '\\', end - begin));
+  if (ARROW_PREDICT_TRUE(escape == NULLPTR)) {
+    *out = util::string_view(data, end - begin);
+    return true;
+  }
+
+  unescaped_.assign(data, escape);
+  data = escape;
+  while (data < data_end) {
+    if (*data != '\\') {
+      unescaped_.push_back(*data++);
+      continue;
+    }
+    ++data;
+    switch (*data++) {
+      case '"':
+        unescaped_.push_back('"');
+        break;
+      case '\\':
+        unescaped_.push_back('\\');
+        break;
+      case '/':
+        unescaped_.push_back('/');
+        break;
+      case 'b':
+        unescaped_.push_back('\b');
+        break;
+      case 'f':
+        unescaped_.push_back('\f');
+        break;
+      case 'n':
+        unescaped_.push_back('\n');
+        break;
+      case 'r':
+        unescaped_.push_back('\r');
+        break;
+      case 't':
+        unescaped_.push_back('\t');
+        break;
+      case 'u': {
+        uint32_t codepoint;
+        if (!ParseHex4(data, data_end, &codepoint)) {
+          return Fail("Incorrect hex digit after \\u escape in string.");
+        }
+        data += 4;
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+          // A high surrogate must be followed by an escaped low surrogate
+          uint32_t low;
+          if (data_end - data < 2 || data[0] != '\\' || data[1] != 'u' ||
+              !ParseHex4(data + 2, data_end, &low) || low < 0xDC00 || low > 0xDFFF) {
+            return Fail("The surrogate pair in string is invalid.");
+          }
+          data += 6;
+          codepoint = (((codepoint - 0xD800) << 10) | (low - 0xDC00)) + 0x10000;
+        }
+        AppendUTF8(codepoint, &unescaped_);
+        break;
+      }
+      default:
+        return Fail("Invalid escape character in string.");
+    }
+  }
+  *out = util::string_view(unescaped_);
+  return true;
+}
+
+bool StructuralIndexReader::SkipValue() {
+  switch (Peek()) {
+    case '"':
+      if (position_ + 1 >= offsets_.size()) {
+        return Fail("Missing a closing quotation mark in string.");
+      }
+      position_ += 2;
+      return true;
+    case '{':
+    case '[':
+      break;
+    case '\0':
+    case '}':
+    case ']':
+    case ',':
+    case ':':
+      return Fail("Invalid value.");
+    default:
+      ++position_;
+      return true;
+  }
+
+  // Strings take two offsets and scalars one, so only brackets need attention
+  skipped_brackets_.clear();
+  do {
+    const char c = Peek();
+    switch (c) {
+      case '{':
+      case '[':
+        skipped_brackets_.push_back(c);
+        break;
+      case '}':
+      case ']':
+        // Matching brackets differ by 2 in ASCII
+        if (skipped_brackets_.back() + 2 != c) {
+          return Fail(skipped_brackets_.back() == '{'
+                          ? "Missing a comma or '}' after an object member."
+                          : "Missing a comma or ']' after an array element.");
+        }
+        skipped_brackets_.pop_back();
+        break;
+      case '\0':
+        if (position_ == offsets_.size()) {
+          return Fail(skipped_brackets_.back() == '{'
+                          ? "Missing a comma or '}' after an object member."
+                          : "Missing a comma or ']' after an array element.");
+        }
+        break;
+      default:
+        break;
+    }
+    ++position_;
+  } while (!skipped_brackets_.empty());
+  return true;
+}
+
+util::string_view StructuralIndexReader::ScalarToken() const {
+  // A scalar extends to the next structural character, less any whitespace
+  const int64_t begin = offsets_[position_];
+  int64_t end = position_ + 1 < offsets_.size() ? offsets_[position_ + 1] : size_;
+  while (IsWhitespace(data_[end - 1])) {
+    --end;
+  }
+  return util::string_view(data_ + begin, end - begin);
+}
+
+bool IsJSONNumber(util::string_view token) {
+  const char* data = token.data();
+  const char* end = data + token.size();
+  if (data != end && *data == '-') {
+    ++data;
+  }
+  const auto rest = util::string_view(data, end - data);
+  if (rest == "NaN" || rest == "Inf" || rest == "Infinity") {
+    return true;
+  }
+
+  // int = zero / ( digit1-9 *DIGIT )
+  if (data == end || !IsDigit(*data)) {
+    return false;
+  }
+  if (*data++ != '0') {
+    while (data != end && IsDigit(*data)) {
+      ++data;
+    }
+  }
+  // frac = decimal-point 1*DIGIT
+  if (data != end && *data == '.') {
+    ++data;
+    if (data == end || !IsDigit(*data)) {
+      return false;
+    }
+    while (data != end && IsDigit(*data)) {
+      ++data;
+    }
+  }
+  // exp = e [ minus / plus ] 1*DIGIT
+  if (data != end && (*data == 'e' || *data == 'E')) {
+    ++data;
+    if (data != end && (*data == '+' || *data == '-')) {
+      ++data;
+    }
+    if (data == end || !IsDigit(*data)) {
+      return false;
+    }
+    while (data != end && IsDigit(*data)) {
+      ++data;
+    }
+  }
+  return data == end;
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,289 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// \class StructuralIndexReader
+/// \brief A JSON reader driven by an index of structural characters
+///
+/// Indexing makes a single pass over a block, 64 bytes at a time, which
+/// locates with vector comparisons the quotes, brackets, colons and commas
+/// outside of strings as well as the first character of each number or
+/// literal. Parsing then walks the index instead of the bytes and emits
+/// the same events as rapidjson's SAX reader to a handler:
+///
+///   bool Null();
+///   bool Bool(bool value);
+///   bool RawNumber(const char* data, uint32_t size, bool copy);
+///   bool String(const char* data, uint32_t size, bool copy);
+///   bool Key(const char* data, uint32_t size, bool copy);
+///   bool StartObject();
+///   bool EndObject(uint32_t member_count);
+///   bool StartArray();
+///   bool EndArray(uint32_t element_count);
+///
+/// After each Key event the reader also calls `bool ShouldSkipValue()`: if it
+/// returns true, the value of that key is skipped using only the index, without
+/// emitting events, unescaping strings or validating numbers.
+///
+/// As with the handlers of rapidjson (whose configuration here is
+/// kParseNumbersAsStringsFlag | kParseNanAndInfFlag), a handler returns false
+/// to stop parsing. Strings passed to the handler are only valid for the
+/// duration of the call.
+class ARROW_EXPORT StructuralIndexReader {
+ public:
+  /// \brief Index a block of JSON
+  ///
+  /// The block must outlive the reader.
+  Status Index(const char* data, int64_t size);
+
+  /// \brief Whether all values of the block were parsed
+  bool Done() const { return position_ == offsets_.size(); }
+
+  /// \brief Parse the next value of the block, emitting its events to handler
+  ///
+  /// Returns false if the value was malformed, in which case error() describes
+  /// the problem, or if the handler stopped parsing, in which case error()
+  /// is null.
+  template <typename Handler>
+  bool Parse(Handler& handler);
+
+  /// \brief Description of the last syntax error
+  const char* error() const { return error_; }
+
+  /// \brief Offsets of the structural characters of the indexed block
+  const std::vector<uint32_t>& offsets() const { return offsets_; }
+
+ protected:
+  struct Frame {
+    bool is_object;
+    uint32_t count;
+  };
+
+  char Peek() const {
+    return position_ < offsets_.size() ? data_[offsets_[position_]] : '\0';
+  }
+
+  bool Fail(const char* error) {
+    error_ = error;
+    return false;
+  }
+
+  bool Terminate() { return Fail(NULLPTR); }
+
+  /// Consume a string and its closing quote, unescaping it if necessary
+  bool ParseString(util::string_view* out);
+
+  /// Consume a value without parsing it, only checking that brackets match
+  bool SkipValue();
+
+  /// Consume a number or literal
+  template <typename Handler>
+  bool ParseScalar(Handler& handler);
+
+  /// Return the extent of the number or literal at the current offset
+  util::string_view ScalarToken() const;
+
+  const char* data_ = NULLPTR;
+  int64_t size_ = 0;
+  std::vector<uint32_t> offsets_;
+  size_t position_ = 0;
+  // Offset of the first unescaped control character inside a string, or -1
+  int64_t first_control_in_string_ = -1;
+  std::vector<Frame> stack_;
+  // Opening brackets of the value being skipped
+  std::string skipped_brackets_;
+  std::string unescaped_;
+  const char* error_ = NULLPTR;
+};
+
+/// \brief Whether a token is a JSON number, NaN or (possibly negative) Inf/Infinity
+ARROW_EXPORT bool IsJSONNumber(util::string_view token);
+
+template <typename Handler>
+bool StructuralIndexReader::Parse(Handler& handler) {
+  enum class State { kValue, kKey, kAfterValue };
+  error_ = NULLPTR;
+  stack_.clear();
+  util::string_view string;
+  auto state = State::kValue;
+  while (true) {
+    switch (state) {
+      case State::kValue:
+        switch (Peek()) {
+          case '{':
+            ++position_;
+            if (!handler.StartObject()) {
+              return Terminate();
+            }
+            if (Peek() == '}') {
+              ++position_;
+              if (!handler.EndObject(0)) {
+                return Terminate();
+              }
+              state = State::kAfterValue;
+            } else {
+              stack_.push_back({true, 0});
+              state = State::kKey;
+            }
+            break;
+          case '[':
+            ++position_;
+            if (!handler.StartArray()) {
+              return Terminate();
+            }
+            if (Peek() == ']') {
+              ++position_;
+              if (!handler.EndArray(0)) {
+                return Terminate();
+              }
+              state = State::kAfterValue;
+            } else {
+              stack_.push_back({false, 0});
+            }
+            break;
+          case '"':
+            if (!ParseString(&string)) {
+              return false;
+            }
+            if (!handler.String(string.data(), static_cast<uint32_t>(string.size()),
+                                true)) {
+              return Terminate();
+            }
+            state = State::kAfterValue;
+            break;
+          case '\0':
+          case '}':
+          case ']':
+          case ',':
+          case ':':
+            return Fail("Invalid value.");
+          default:
+            if (!ParseScalar(handler)) {
+              return false;
+            }
+            state = State::kAfterValue;
+            break;
+        }
+        break;
+
+      case State::kKey:
+        if (Peek() != '"') {
+          return Fail("Missing a name for object member.");
+        }
+        if (!ParseString(&string)) {
+          return false;
+        }
+        if (!handler.Key(string.data(), static_cast<uint32_t>(string.size()), true)) {
+          return Terminate();
+        }
+        if (Peek() != ':') {
+          return Fail("Missing a colon after a name of object member.");
+        }
+        ++position_;
+        if (handler.ShouldSkipValue()) {
+          if (!SkipValue()) {
+            return false;
+          }
+          state = State::kAfterValue;
+        } else {
+          state = State::kValue;
+        }
+        break;
+
+      case State::kAfterValue: {
+        if (stack_.empty()) {
+          return true;
+        }
+        auto& frame = stack_.back();
+        ++frame.count;
+        const char c = Peek();
+        if (c == ',') {
+          ++position_;
+          state = frame.is_object ? State::kKey : State::kValue;
+        } else if (frame.is_object && c == '}') {
+          ++position_;
+          const uint32_t count = frame.count;
+          stack_.pop_back();
+          if (!handler.EndObject(count)) {
+            return Terminate();
+          }
+        } else if (!frame.is_object && c == ']') {
+          ++position_;
+          const uint32_t count = frame.count;
+          stack_.pop_back();
+          if (!handler.EndArray(count)) {
+            return Terminate();
+          }
+        } else {
+          return Fail(frame.is_object ? "Missing a comma or '}' after an object member."
+                                      : "Missing a comma or ']' after an array element.");
+        }
+        break;
+      }
+    }
+  }
+}
+
+template <typename Handler>
+bool StructuralIndexReader::ParseScalar(Handler& handler) {
+  const auto token = ScalarToken();
+  ++position_;
+  bool ok;
+  switch (token[0]) {
+    case 'n':
+      if (token != "null") {
+        return Fail("Invalid value.");
+      }
+      ok = handler.Null();
+      break;
+    case 't':
+      if (token != "true") {
+        return Fail("Invalid value.");
+      }
+      ok = handler.Bool(true);
+      break;
+    case 'f':
+      if (token != "false") {
+        return Fail("Invalid value.");
+      }
+      ok = handler.Bool(false);
+      break;
+    default:
+      if (!IsJSONNumber(token)) {
+        return Fail("Invalid value.");
+      }
+      ok = handler.RawNumber(token.data(), static_cast<uint32_t>(token.size()), true);
+      break;
+  }
+  return ok || Terminate();
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -18,14 +18,31 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/macros.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -262,6 +279,95 @@ class MimallocAllocator {
 
 #endif  // defined(ARROW_MIMALLOC)
 
+///////////////////////////////////////////////////////////////////////
+// Placement of large buffers in physical memory
+
+bool GetEnvFlag(const char* name) {
+  auto result = internal::GetEnvVar(name);
+  return result.ok() && (*result == "1" || *result == "true");
+}
+
+std::atomic<bool> use_huge_pages(GetEnvFlag("ARROW_MEMORY_HUGE_PAGES"));
+std::atomic<bool> use_numa_local(GetEnvFlag("ARROW_MEMORY_NUMA_LOCAL"));
+
+#ifdef __linux__
+
+// Round 'data' up and 'data + size' down to a multiple of 'alignment'.
+// Returns false if no aligned range is left.
+inline bool AlignedInteriorRange(uint8_t* data, int64_t size, int64_t alignment,
+                                 uint8_t** start, int64_t* length) {
+  const auto begin = reinterpret_cast<uintptr_t>(data);
+  const auto end = begin + static_cast<uintptr_t>(size);
+  const auto mask = static_cast<uintptr_t>(alignment - 1);
+  const uintptr_t aligned_begin = (begin + mask) & ~mask;
+  const uintptr_t aligned_end = end & ~mask;
+  if (aligned_end <= aligned_begin) {
+    return false;
+  }
+  *start = reinterpret_cast<uint8_t*>(aligned_begin);
+  *length = static_cast<int64_t>(aligned_end - aligned_begin);
+  return true;
+}
+
+#ifdef MADV_HUGEPAGE
+
+constexpr int64_t kHugePageSize = 2 << 20;
+
+void AdviseHugePages(uint8_t* data, int64_t size) {
+  uint8_t* start;
+  int64_t length;
+  if (size >= kHugePageSize &&
+      AlignedInteriorRange(data, size, kHugePageSize, &start, &length)) {
+    madvise(start, static_cast<size_t>(length), MADV_HUGEPAGE);
+  }
+}
+
+#endif  // defined(MADV_HUGEPAGE)
+
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+
+constexpr int64_t kMinNumaLocalSize = 64 << 10;
+
+// From linux/mempolicy.h
+constexpr int kMpolPreferred = 1;
+constexpr unsigned kMpolMfMove = 1 << 1;
+constexpr unsigned kMaxNumaNodes = 1024;
+
+void BindToCurrentNumaNode(uint8_t* data, int64_t size) {
+  static const int64_t page_size = sysconf(_SC_PAGESIZE);
+  uint8_t* start;
+  int64_t length;
+  unsigned cpu, node;
+  if (size < kMinNumaLocalSize ||
+      !AlignedInteriorRange(data, size, page_size, &start, &length) ||
+      syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || node >= kMaxNumaNodes) {
+    return;
+  }
+  uint64_t node_mask[kMaxNumaNodes / 64] = {};
+  node_mask[node / 64] = uint64_t(1) << (node % 64);
+  // Best effort: on failure, the buffer is left where it is
+  syscall(SYS_mbind, start, length, kMpolPreferred, node_mask, kMaxNumaNodes + 1,
+          kMpolMfMove);
+}
+
+#endif  // defined(SYS_getcpu) && defined(SYS_mbind)
+
+#endif  // defined(__linux__)
+
+// Apply the placement options to a newly (re)allocated buffer.
+inline void PlaceBuffer(uint8_t* data, int64_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (ARROW_PREDICT_FALSE(use_huge_pages.load(std::memory_order_relaxed))) {
+    AdviseHugePages(data, size);
+  }
+#endif
+#if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind)
+  if (ARROW_PREDICT_FALSE(use_numa_local.load(std::memory_order_relaxed))) {
+    BindToCurrentNumaNode(data, size);
+  }
+#endif
+}
+
 }  // namespace
 
 MemoryPool::MemoryPool() {}
@@ -293,6 +399,7 @@ class BaseMemoryPoolImpl : public MemoryPool {
       return Status::CapacityError("malloc size overflows size_t");
     }
     RETURN_NOT_OK(Allocator::AllocateAligned(size, out));
+    PlaceBuffer(*out, size);
 #ifndef NDEBUG
     // Poison data
     if (size > 0) {
@@ -314,6 +421,7 @@ class BaseMemoryPoolImpl : public MemoryPool {
       return Status::CapacityError("realloc overflows size_t");
     }
     RETURN_NOT_OK(Allocator::ReallocateAligned(old_size, new_size, ptr));
+    PlaceBuffer(*ptr, new_size);
 #ifndef NDEBUG
     // Poison data
     if (new_size > old_size) {
@@ -442,6 +550,24 @@ Status jemalloc_set_decay_ms(int ms) {
 #endif
 }
 
+Status memory_pool_set_huge_pages(bool enable) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  use_huge_pages = enable;
+  return Status::OK();
+#else
+  return Status::NotImplemented("huge pages are only supported on Linux");
+#endif
+}
+
+Status memory_pool_set_numa_local(bool enable) {
+#if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind)
+  use_numa_local = enable;
+  return Status::OK();
+#else
+  return Status::NotImplemented("NUMA-local allocation is only supported on Linux");
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////
 // LoggingMemoryPool implementation
 
@@ -538,4 +664,913 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ThreadCachingMemoryPool implementation
+
+namespace {
+
+// Size classes are the powers of two from 64 bytes to 32 KiB.
+constexpr int kMinSizeClassLog2 = 6;
+constexpr int kMaxSizeClassLog2 = 15;
+constexpr int kNumSizeClasses = kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+constexpr int64_t kMaxCachedSize = int64_t(1) << kMaxSizeClassLog2;
+
+// Bytes kept in the free list of one size class of one thread.
+constexpr int64_t kMaxCachedBytesPerSizeClass = 256 * 1024;
+
+// Allocation statistics are published once a thread has allocated or freed
+// this many bytes.
+constexpr int64_t kStatsBatchSize = 256 * 1024;
+
+inline int SizeClass(int64_t size) {
+  return std::max(BitUtil::Log2(static_cast<uint64_t>(size)), kMinSizeClassLog2) -
+         kMinSizeClassLog2;
+}
+
+inline int64_t SizeClassBytes(int size_class) {
+  return int64_t(1) << (size_class + kMinSizeClassLog2);
+}
+
+inline size_t MaxCachedBuffers(int size_class) {
+  return static_cast<size_t>(kMaxCachedBytesPerSizeClass / SizeClassBytes(size_class));
+}
+
+}  // namespace
+
+class ThreadCachingMemoryPool::ThreadCachingMemoryPoolImpl
+    : public std::enable_shared_from_this<ThreadCachingMemoryPoolImpl> {
+ public:
+  // The cache of one thread for one pool. Only the owning thread touches the
+  // free lists; pending_bytes is also read by bytes_allocated().
+  struct ThreadCache {
+    std::shared_ptr<ThreadCachingMemoryPoolImpl> owner;
+    std::vector<uint8_t*> free_lists[kNumSizeClasses];
+    std::atomic<int64_t> pending_bytes{0};
+  };
+
+  explicit ThreadCachingMemoryPoolImpl(MemoryPool* pool) : pool_(pool) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size <= 0 || size > kMaxCachedSize) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+      stats_.UpdateAllocatedBytes(size);
+      return Status::OK();
+    }
+    const int size_class = SizeClass(size);
+    ThreadCache* cache = GetThreadCache();
+    auto& free_list = cache->free_lists[size_class];
+    if (free_list.empty()) {
+      RETURN_NOT_OK(pool_->Allocate(SizeClassBytes(size_class), out));
+    } else {
+      *out = free_list.back();
+      free_list.pop_back();
+    }
+    UpdatePendingBytes(cache, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_cached = old_size > 0 && old_size <= kMaxCachedSize;
+    const bool new_cached = new_size > 0 && new_size <= kMaxCachedSize;
+    if (!old_cached && !new_cached) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (old_cached && new_cached && SizeClass(old_size) == SizeClass(new_size)) {
+      // The buffer is already large enough
+      UpdatePendingBytes(GetThreadCache(), new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size <= 0 || size > kMaxCachedSize) {
+      pool_->Free(buffer, size);
+      stats_.UpdateAllocatedBytes(-size);
+      return;
+    }
+    const int size_class = SizeClass(size);
+    ThreadCache* cache = GetThreadCache();
+    auto& free_list = cache->free_lists[size_class];
+    if (free_list.size() < MaxCachedBuffers(size_class)) {
+      free_list.push_back(buffer);
+    } else {
+      pool_->Free(buffer, SizeClassBytes(size_class));
+    }
+    UpdatePendingBytes(cache, -size);
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = stats_.bytes_allocated();
+    for (const ThreadCache* cache : caches_) {
+      total += cache->pending_bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  int64_t max_memory() const { return std::max(stats_.max_memory(), bytes_allocated()); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  // Return the buffers cached by all threads to the wrapped pool.
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (ThreadCache* cache : caches_) {
+      Drain(cache);
+    }
+    caches_.clear();
+    closed_ = true;
+  }
+
+  // Return the buffers cached by an exiting thread to the wrapped pool.
+  void ReleaseThreadCache(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return;
+    }
+    Drain(cache);
+    caches_.erase(std::find(caches_.begin(), caches_.end(), cache));
+  }
+
+ private:
+  // The caches of the calling thread, released when the thread exits.
+  class ThreadCaches {
+   public:
+    ~ThreadCaches() {
+      for (auto& cache : caches_) {
+        cache->owner->ReleaseThreadCache(cache.get());
+      }
+    }
+
+    ThreadCache* Get(ThreadCachingMemoryPoolImpl* owner) {
+      if (last_ != nullptr && last_->owner.get() == owner) {
+        return last_;
+      }
+      for (auto& cache : caches_) {
+        if (cache->owner.get() == owner) {
+          return last_ = cache.get();
+        }
+      }
+      // Forget about the caches of destroyed pools
+      caches_.erase(std::remove_if(caches_.begin(), caches_.end(),
+                                   [](const std::unique_ptr<ThreadCache>& cache) {
+                                     return cache->owner->closed();
+                                   }),
+                    caches_.end());
+      std::unique_ptr<ThreadCache> cache(new ThreadCache);
+      cache->owner = owner->shared_from_this();
+      owner->RegisterThreadCache(cache.get());
+      caches_.push_back(std::move(cache));
+      return last_ = caches_.back().get();
+    }
+
+   private:
+    std::vector<std::unique_ptr<ThreadCache>> caches_;
+    ThreadCache* last_ = nullptr;
+  };
+
+  ThreadCache* GetThreadCache() {
+    static thread_local ThreadCaches caches;
+    return caches.Get(this);
+  }
+
+  void RegisterThreadCache(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    caches_.push_back(cache);
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  void UpdatePendingBytes(ThreadCache* cache, int64_t diff) {
+    int64_t pending = cache->pending_bytes.load(std::memory_order_relaxed) + diff;
+    if (pending >= kStatsBatchSize || pending <= -kStatsBatchSize) {
+      stats_.UpdateAllocatedBytes(pending);
+      pending = 0;
+    }
+    cache->pending_bytes.store(pending, std::memory_order_relaxed);
+  }
+
+  void Drain(ThreadCache* cache) {
+    for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+      for (uint8_t* buffer : cache->free_lists[size_class]) {
+        pool_->Free(buffer, SizeClassBytes(size_class));
+      }
+      cache->free_lists[size_class].clear();
+    }
+    stats_.UpdateAllocatedBytes(cache->pending_bytes.exchange(0));
+  }
+
+  MemoryPool* pool_;
+  internal::MemoryPoolStats stats_;
+  mutable std::mutex mutex_;
+  std::vector<ThreadCache*> caches_;
+  bool closed_ = false;
+};
+
+ThreadCachingMemoryPool::ThreadCachingMemoryPool(MemoryPool* pool)
+    : impl_(std::make_shared<ThreadCachingMemoryPoolImpl>(pool)) {}
+
+ThreadCachingMemoryPool::~ThreadCachingMemoryPool() { impl_->Close(); }
+
+Status ThreadCachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ThreadCachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                           uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ThreadCachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ThreadCachingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t ThreadCachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ThreadCachingMemoryPool::backend_name() const {
+  return impl_->backend_name();
+}
+
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* pool, int64_t chunk_size)
+      : pool_(pool),
+        chunk_size_(BitUtil::RoundUpToMultipleOf64(std::max<int64_t>(chunk_size, 1))) {}
+
+  ~ArenaMemoryPoolImpl() {
+    ReleaseChunks(&chunks_, 0);
+    ReleaseChunks(&large_chunks_, 0);
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(AllocateUnlocked(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (old_size == 0 || new_size == 0) {
+      uint8_t* out;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t old_reserved = BitUtil::RoundUpToMultipleOf64(old_size);
+    const int64_t new_reserved = BitUtil::RoundUpToMultipleOf64(new_size);
+    if (new_reserved <= old_reserved) {
+      // Shrink in place, giving back the tail of the most recent allocation
+      if (IsMostRecent(*ptr, old_reserved)) {
+        current_ -= old_reserved - new_reserved;
+      }
+    } else if (IsMostRecent(*ptr, old_reserved) &&
+               new_reserved - old_reserved <= end_ - current_) {
+      // Grow the most recent allocation in place
+      current_ += new_reserved - old_reserved;
+    } else {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateUnlocked(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(old_size));
+      FreeUnlocked(*ptr, old_reserved);
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeUnlocked(buffer, BitUtil::RoundUpToMultipleOf64(size));
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DCHECK_EQ(stats_.bytes_allocated(), 0) << "buffers are still in use";
+    // Keep the first chunk, so that the next batch usually needs no allocation
+    const size_t retained = chunks_.empty() ? 0 : 1;
+    ReleaseChunks(&chunks_, retained);
+    ReleaseChunks(&large_chunks_, 0);
+    if (retained) {
+      begin_ = current_ = chunks_[0].first;
+      end_ = begin_ + chunk_size_;
+    } else {
+      begin_ = current_ = end_ = nullptr;
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_reserved_;
+  }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+ private:
+  using ChunkVector = std::vector<std::pair<uint8_t*, int64_t>>;
+
+  bool IsLarge(int64_t reserved) const { return reserved > chunk_size_ / 4; }
+
+  bool IsMostRecent(uint8_t* buffer, int64_t reserved) const {
+    return buffer >= begin_ && buffer + reserved == current_;
+  }
+
+  Status AllocateUnlocked(int64_t size, uint8_t** out) {
+    const int64_t reserved = BitUtil::RoundUpToMultipleOf64(size);
+    if (IsLarge(reserved)) {
+      // Large allocations get a chunk of their own, leaving the current one alone
+      RETURN_NOT_OK(pool_->Allocate(reserved, out));
+      large_chunks_.emplace_back(*out, reserved);
+      bytes_reserved_ += reserved;
+      return Status::OK();
+    }
+    if (end_ - current_ < reserved) {
+      uint8_t* chunk;
+      RETURN_NOT_OK(pool_->Allocate(chunk_size_, &chunk));
+      chunks_.emplace_back(chunk, chunk_size_);
+      bytes_reserved_ += chunk_size_;
+      begin_ = current_ = chunk;
+      end_ = chunk + chunk_size_;
+    }
+    *out = current_;
+    current_ += reserved;
+    return Status::OK();
+  }
+
+  void FreeUnlocked(uint8_t* buffer, int64_t reserved) {
+    if (IsLarge(reserved)) {
+      // Give large allocations back right away
+      for (size_t i = 0; i < large_chunks_.size(); ++i) {
+        if (large_chunks_[i].first == buffer) {
+          pool_->Free(buffer, large_chunks_[i].second);
+          bytes_reserved_ -= large_chunks_[i].second;
+          large_chunks_[i] = large_chunks_.back();
+          large_chunks_.pop_back();
+          return;
+        }
+      }
+    }
+    if (IsMostRecent(buffer, reserved)) {
+      current_ = buffer;
+    }
+  }
+
+  // Return the chunks from index 'first' on to the wrapped pool.
+  void ReleaseChunks(ChunkVector* chunks, size_t first) {
+    for (size_t i = first; i < chunks->size(); ++i) {
+      pool_->Free((*chunks)[i].first, (*chunks)[i].second);
+      bytes_reserved_ -= (*chunks)[i].second;
+    }
+    chunks->resize(first);
+  }
+
+  MemoryPool* pool_;
+  const int64_t chunk_size_;
+  internal::MemoryPoolStats stats_;
+  mutable std::mutex mutex_;
+  // The chunks obtained from the wrapped pool, and their sizes
+  ChunkVector chunks_;
+  ChunkVector large_chunks_;
+  int64_t bytes_reserved_ = 0;
+  // The current chunk, and its free space
+  uint8_t* begin_ = nullptr;
+  uint8_t* current_ = nullptr;
+  uint8_t* end_ = nullptr;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* pool, int64_t chunk_size)
+    : impl_(new ArenaMemoryPoolImpl(pool, chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+std::string ArenaMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* pool, int64_t max_cached_bytes)
+      : pool_(pool), max_cached_bytes_(max_cached_bytes) {}
+
+  ~RecyclingMemoryPoolImpl() { Trim(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (!TakeCached(size, out)) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    if (size > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cached_bytes_ + size <= max_cached_bytes_) {
+        free_lists_[size].push_back(buffer);
+        cached_bytes_ += size;
+        return;
+      }
+    }
+    pool_->Free(buffer, size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+  void Trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : free_lists_) {
+      for (uint8_t* buffer : entry.second) {
+        pool_->Free(buffer, entry.first);
+      }
+    }
+    free_lists_.clear();
+    cached_bytes_ = 0;
+  }
+
+ private:
+  bool TakeCached(int64_t size, uint8_t** out) {
+    if (size <= 0) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = free_lists_.find(size);
+    if (it == free_lists_.end() || it->second.empty()) {
+      return false;
+    }
+    *out = it->second.back();
+    it->second.pop_back();
+    cached_bytes_ -= size;
+    return true;
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_cached_bytes_;
+  internal::MemoryPoolStats stats_;
+  mutable std::mutex mutex_;
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_lists_;
+  int64_t cached_bytes_ = 0;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* pool, int64_t max_cached_bytes)
+    : impl_(new RecyclingMemoryPoolImpl(pool, max_cached_bytes)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t RecyclingMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+void RecyclingMemoryPool::Trim() { impl_->Trim(); }
+
+///////////////////////////////////////////////////////////////////////
+// LimitingMemoryPool implementation
+
+class LimitingMemoryPool::LimitingMemoryPoolImpl {
+ public:
+  LimitingMemoryPoolImpl(MemoryPool* pool, int64_t limit, int64_t max_wait_ms)
+      : pool_(pool), limit_(limit), max_wait_ms_(max_wait_ms) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      Release(size);
+    }
+    return st;
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      RETURN_NOT_OK(Reserve(diff));
+    }
+    Status st = pool_->Reallocate(old_size, new_size, ptr);
+    if (!st.ok()) {
+      if (diff > 0) {
+        Release(diff);
+      }
+      return st;
+    }
+    if (diff < 0) {
+      Release(-diff);
+    }
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    Release(size);
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t limit() const { return limit_; }
+
+  int RegisterReclaimCallback(ReclaimCallback callback) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    callbacks_.emplace_back(next_callback_id_, std::move(callback));
+    return next_callback_id_++;
+  }
+
+  void UnregisterReclaimCallback(int id) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    callbacks_.erase(std::remove_if(callbacks_.begin(), callbacks_.end(),
+                                    [id](const std::pair<int, ReclaimCallback>& entry) {
+                                      return entry.first == id;
+                                    }),
+                     callbacks_.end());
+  }
+
+ private:
+  // Account for 'size' more bytes, if the limit allows it.
+  bool TryReserve(int64_t size) {
+    int64_t allocated = bytes_allocated_.load();
+    do {
+      if (allocated + size > limit_) {
+        return false;
+      }
+    } while (!bytes_allocated_.compare_exchange_weak(allocated, allocated + size));
+    allocated += size;
+    // "maximum" allocated memory is ill-defined in multi-threaded code,
+    // so don't try to be too rigorous here
+    if (allocated > max_memory_) {
+      max_memory_ = allocated;
+    }
+    return true;
+  }
+
+  Status Reserve(int64_t size) {
+    if (TryReserve(size)) {
+      return Status::OK();
+    }
+    if (size > limit_) {
+      return Status::OutOfMemory("Allocation of ", size,
+                                 " bytes exceeds the memory limit of ", limit_, " bytes");
+    }
+    // Ask the registered callbacks to release memory, and try again
+    std::vector<ReclaimCallback> callbacks;
+    {
+      std::lock_guard<std::mutex> lock(callbacks_mutex_);
+      for (const auto& entry : callbacks_) {
+        callbacks.push_back(entry.second);
+      }
+    }
+    for (const auto& callback : callbacks) {
+      callback(bytes_allocated_.load() + size - limit_);
+      if (TryReserve(size)) {
+        return Status::OK();
+      }
+    }
+    // Wait for other threads to free memory
+    if (max_wait_ms_ > 0) {
+      std::unique_lock<std::mutex> lock(wait_mutex_);
+      ++num_waiters_;
+      bool reserved = wait_cv_.wait_for(lock, std::chrono::milliseconds(max_wait_ms_),
+                                        [&] { return TryReserve(size); });
+      --num_waiters_;
+      if (reserved) {
+        return Status::OK();
+      }
+    }
+    return Status::OutOfMemory("Allocation of ", size,
+                               " bytes exceeds the memory limit of ", limit_, " bytes (",
+                               bytes_allocated_.load(), " bytes allocated)");
+  }
+
+  void Release(int64_t size) {
+    bytes_allocated_.fetch_sub(size);
+    if (num_waiters_.load() > 0) {
+      // Take the lock so that the notification can't be missed by a waiter
+      // between its check and its wait.
+      std::lock_guard<std::mutex> lock(wait_mutex_);
+      wait_cv_.notify_all();
+    }
+  }
+
+  MemoryPool* pool_;
+  const int64_t limit_;
+  const int64_t max_wait_ms_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+
+  std::mutex callbacks_mutex_;
+  std::vector<std::pair<int, ReclaimCallback>> callbacks_;
+  int next_callback_id_ = 0;
+
+  std::mutex wait_mutex_;
+  std::condition_variable wait_cv_;
+  std::atomic<int> num_waiters_{0};
+};
+
+LimitingMemoryPool::LimitingMemoryPool(MemoryPool* pool, int64_t limit,
+                                       int64_t max_wait_ms)
+    : impl_(new LimitingMemoryPoolImpl(pool, limit, max_wait_ms)) {}
+
+LimitingMemoryPool::~LimitingMemoryPool() {}
+
+Status LimitingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status LimitingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void LimitingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t LimitingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LimitingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string LimitingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t LimitingMemoryPool::limit() const { return impl_->limit(); }
+
+int LimitingMemoryPool::RegisterReclaimCallback(ReclaimCallback callback) {
+  return impl_->RegisterReclaimCallback(std::move(callback));
+}
+
+void LimitingMemoryPool::UnregisterReclaimCallback(int id) {
+  impl_->UnregisterReclaimCallback(id);
+}
+
+///////////////////////////////////////////////////////////////////////
+// ProfilingMemoryPool implementation
+
+namespace {
+
+constexpr int kNumHistogramBuckets = 64;
+
+static thread_local const std::string* current_allocation_tag = nullptr;
+
+inline int HistogramBucket(int64_t value) {
+  return value <= 1 ? 0 : BitUtil::NumRequiredBits(static_cast<uint64_t>(value)) - 1;
+}
+
+}  // namespace
+
+ProfilingMemoryPool::ScopedTag::ScopedTag(std::string tag)
+    : tag_(std::move(tag)), previous_tag_(current_allocation_tag) {
+  current_allocation_tag = &tag_;
+}
+
+ProfilingMemoryPool::ScopedTag::~ScopedTag() { current_allocation_tag = previous_tag_; }
+
+class ProfilingMemoryPool::ProfilingMemoryPoolImpl {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  ProfilingMemoryPoolImpl(MemoryPool* pool, int64_t sample_interval)
+      : pool_(pool), sample_interval_(std::max<int64_t>(sample_interval, 1)) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    if (num_allocations_.fetch_add(1) % sample_interval_ == 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const std::string tag =
+          current_allocation_tag == nullptr ? "" : *current_allocation_tag;
+      auto& profile = GetProfile(tag);
+      RecordAllocation(&profile, size);
+      sampled_[*out] = Sample{&profile, size, Clock::now()};
+    }
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    uint8_t* previous = *ptr;
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sampled_.find(previous);
+    if (it != sampled_.end()) {
+      // The buffer keeps its tag and its lifetime
+      Sample sample = it->second;
+      sampled_.erase(it);
+      sample.profile->live_bytes -= sample.size;
+      RecordAllocation(sample.profile, new_size);
+      sample.size = new_size;
+      sampled_[*ptr] = sample;
+    }
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = sampled_.find(buffer);
+      if (it != sampled_.end()) {
+        const Sample& sample = it->second;
+        auto lifetime = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - sample.start);
+        sample.profile->live_bytes -= sample.size;
+        ++sample.profile->lifetime_histogram[HistogramBucket(lifetime.count())];
+        sampled_.erase(it);
+      }
+    }
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  std::vector<Profile> GetProfiles() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Profile> profiles;
+    for (const auto& entry : profiles_) {
+      profiles.push_back(entry.second);
+    }
+    return profiles;
+  }
+
+ private:
+  struct Sample {
+    Profile* profile;
+    int64_t size;
+    Clock::time_point start;
+  };
+
+  Profile& GetProfile(const std::string& tag) {
+    auto it = profiles_.find(tag);
+    if (it == profiles_.end()) {
+      Profile profile;
+      profile.tag = tag;
+      profile.size_histogram.resize(kNumHistogramBuckets);
+      profile.lifetime_histogram.resize(kNumHistogramBuckets);
+      it = profiles_.emplace(tag, std::move(profile)).first;
+    }
+    return it->second;
+  }
+
+  void RecordAllocation(Profile* profile, int64_t size) {
+    ++profile->num_allocations;
+    profile->bytes_allocated += size;
+    profile->live_bytes += size;
+    profile->peak_live_bytes = std::max(profile->peak_live_bytes, profile->live_bytes);
+    ++profile->size_histogram[HistogramBucket(size)];
+  }
+
+  MemoryPool* pool_;
+  const int64_t sample_interval_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> num_allocations_{0};
+
+  mutable std::mutex mutex_;
+  // std::map keeps the profiles sorted, and their addresses stable
+  std::map<std::string, Profile> profiles_;
+  std::unordered_map<uint8_t*, Sample> sampled_;
+};
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool, int64_t sample_interval)
+    : impl_(new ProfilingMemoryPoolImpl(pool, sample_interval)) {}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ProfilingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ProfilingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ProfilingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+std::vector<ProfilingMemoryPool::Profile> ProfilingMemoryPool::GetProfiles() const {
+  return impl_->GetProfiles();
+}
+
+std::string ProfilingMemoryPool::ProfilesToString() const {
+  std::stringstream ss;
+  for (const auto& profile : GetProfiles()) {
+    ss << "tag '" << profile.tag << "': " << profile.num_allocations
+       << " allocations, " << profile.bytes_allocated << " bytes, "
+       << profile.live_bytes << " live bytes, " << profile.peak_live_bytes
+       << " peak live bytes" << std::endl;
+    ss << "  sizes (bytes):";
+    for (int i = 0; i < kNumHistogramBuckets; ++i) {
+      if (profile.size_histogram[i] > 0) {
+        ss << " [" << (int64_t(1) << i) << "]=" << profile.size_histogram[i];
+      }
+    }
+    ss << std::endl << "  lifetimes (us):";
+    for (int i = 0; i < kNumHistogramBuckets; ++i) {
+      if (profile.lifetime_histogram[i] > 0) {
+        ss << " [" << (int64_t(1) << i) << "]=" << profile.lifetime_histogram[i];
+      }
+    }
+    ss << std::endl;
+  }
+  return ss.str();
+}
+
 }  // namespace arrow
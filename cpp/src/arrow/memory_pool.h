@@ -20,8 +20,10 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -150,6 +152,225 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A MemoryPool front-end caching small buffers in per-thread free lists.
+///
+/// Allocations of up to 32 KiB are rounded up to a power-of-two size class and
+/// served from a free list owned by the calling thread, so that the common case
+/// touches neither the wrapped pool nor any shared state. Freed buffers go back
+/// to the free list of the freeing thread, up to a bounded number of bytes per
+/// size class. Larger allocations are forwarded to the wrapped pool.
+///
+/// The allocation statistics are accumulated per thread and published in
+/// batches: bytes_allocated() is exact for single-threaded use and may lag
+/// behind concurrent allocations otherwise.
+///
+/// The cached buffers of a thread are returned to the wrapped pool when the
+/// thread exits or when this pool is destroyed, which must not happen while
+/// other threads are still using it.
+class ARROW_EXPORT ThreadCachingMemoryPool : public MemoryPool {
+ public:
+  explicit ThreadCachingMemoryPool(MemoryPool* pool);
+  ~ThreadCachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class ThreadCachingMemoryPoolImpl;
+  std::shared_ptr<ThreadCachingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool carving allocations out of large chunks, all released at once.
+///
+/// Allocations are served by bumping a pointer in the current chunk, which is
+/// obtained from the wrapped pool. Allocations larger than a quarter of the chunk
+/// size get a chunk of their own, which Free() returns to the wrapped pool.
+/// Otherwise, Free() only reclaims the space of the most recent allocation;
+/// everything else is reclaimed by Reset(), which keeps the first chunk for
+/// reuse and returns the other chunks to the wrapped pool.
+///
+/// This is meant for short-lived temporaries, e.g. those of a single batch: all
+/// the buffers allocated from the arena must be released before calling Reset().
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  explicit ArenaMemoryPool(MemoryPool* pool, int64_t chunk_size = 1 << 20);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// Release all allocations at once.
+  void Reset();
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes held from the wrapped pool.
+  int64_t bytes_reserved() const;
+
+  std::string backend_name() const override;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool recycling freed buffers for allocations of the same size.
+///
+/// Freed buffers are kept in free lists keyed by their exact size, up to
+/// 'max_cached_bytes' in total, and handed out again to the next allocations
+/// of that size. Consumers releasing buffers of a steady stream of same-shaped
+/// batches (e.g. IPC message bodies) thus feed the producer, which then makes
+/// no calls to the wrapped pool. Buffers may be freed and allocated from any
+/// thread.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  explicit RecyclingMemoryPool(MemoryPool* pool, int64_t max_cached_bytes = 64 << 20);
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes of the buffers waiting to be recycled.
+  int64_t bytes_cached() const;
+
+  /// Return the buffers waiting to be recycled to the wrapped pool.
+  void Trim();
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool enforcing a limit on the number of bytes allocated.
+///
+/// An allocation which would exceed the limit first calls the registered reclaim
+/// callbacks, in registration order, until enough memory was freed. If that is
+/// not enough, the allocation waits for up to 'max_wait_ms' milliseconds for
+/// other threads to free memory, then fails with Status::OutOfMemory.
+///
+/// A single instance can be shared by several pipelines to enforce a budget
+/// on all of them.
+class ARROW_EXPORT LimitingMemoryPool : public MemoryPool {
+ public:
+  /// \brief A callback releasing memory allocated from the pool.
+  ///
+  /// It is called with the number of bytes missing, without any lock held, and
+  /// returns the number of bytes it released by calling Free() or Reallocate().
+  using ReclaimCallback = std::function<int64_t(int64_t bytes_needed)>;
+
+  LimitingMemoryPool(MemoryPool* pool, int64_t limit, int64_t max_wait_ms = 0);
+  ~LimitingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The maximum number of bytes allocated at any time.
+  int64_t limit() const;
+
+  /// \brief Register a reclaim callback.
+  ///
+  /// \return an id to pass to UnregisterReclaimCallback()
+  int RegisterReclaimCallback(ReclaimCallback callback);
+
+  /// \brief Unregister a reclaim callback.
+  ///
+  /// The callback may still be running in another thread when this returns.
+  void UnregisterReclaimCallback(int id);
+
+ private:
+  class LimitingMemoryPoolImpl;
+  std::unique_ptr<LimitingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool recording histograms of allocation sizes and lifetimes.
+///
+/// Allocations are attributed to the tag set by the innermost ScopedTag alive
+/// in the calling thread, e.g. the name of a reader or of a kernel, or to an
+/// empty tag outside of any ScopedTag. Only one
+/// allocation out of 'sample_interval' is recorded, so that profiling stays
+/// cheap under load; the counts of a profile are those of the sampled
+/// allocations.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  /// \brief Attribute the allocations of the current thread to a tag, until
+  /// destroyed.
+  class ARROW_EXPORT ScopedTag {
+   public:
+    explicit ScopedTag(std::string tag);
+    ~ScopedTag();
+
+   private:
+    std::string tag_;
+    const std::string* previous_tag_;
+  };
+
+  /// The sampled allocations of a tag.
+  struct Profile {
+    std::string tag;
+    int64_t num_allocations = 0;
+    int64_t bytes_allocated = 0;
+    /// Bytes not freed yet, and their peak.
+    int64_t live_bytes = 0;
+    int64_t peak_live_bytes = 0;
+    /// Bucket i counts the allocations (and reallocations) of [2^i, 2^(i+1)) bytes.
+    std::vector<int64_t> size_histogram;
+    /// Bucket i counts the buffers freed after [2^i, 2^(i+1)) microseconds.
+    std::vector<int64_t> lifetime_histogram;
+  };
+
+  explicit ProfilingMemoryPool(MemoryPool* pool, int64_t sample_interval = 1);
+  ~ProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The profiles of all tags, sorted by tag.
+  std::vector<Profile> GetProfiles() const;
+
+  /// A human-readable dump of GetProfiles().
+  std::string ProfilesToString() const;
+
+ private:
+  class ProfilingMemoryPoolImpl;
+  std::unique_ptr<ProfilingMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -169,6 +390,30 @@ ARROW_EXPORT Status jemalloc_memory_pool(MemoryPool** out);
 ARROW_EXPORT
 Status jemalloc_set_decay_ms(int ms);
 
+/// \brief Back large buffers of the default memory pools with transparent huge
+/// pages.
+///
+/// Buffers of 2 MiB or more are advised to the kernel as huge page candidates,
+/// which reduces TLB misses when streaming over them. This can also be enabled
+/// by setting the ARROW_MEMORY_HUGE_PAGES environment variable to 1.
+///
+/// Returns NotImplemented on platforms other than Linux.
+ARROW_EXPORT
+Status memory_pool_set_huge_pages(bool enable);
+
+/// \brief Bind large buffers of the default memory pools to the NUMA node of
+/// the allocating thread.
+///
+/// The pages of newly allocated buffers of 64 KiB or more are placed on (or
+/// moved to) the NUMA node of the CPU the allocating thread runs on, even when
+/// the allocator reuses memory first touched by a thread on another node. This
+/// can also be enabled by setting the ARROW_MEMORY_NUMA_LOCAL environment
+/// variable to 1.
+///
+/// Returns NotImplemented on platforms other than Linux.
+ARROW_EXPORT
+Status memory_pool_set_numa_local(bool enable);
+
 /// Return a process-wide memory pool based on mimalloc.
 ///
 /// May return NotImplemented if mimalloc is not available.
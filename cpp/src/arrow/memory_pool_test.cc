@@ -15,7 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -54,6 +59,31 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct ThreadCachingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    // Don't keep cached buffers in the default pool, whose statistics other tests check
+    static std::unique_ptr<MemoryPool> wrapped = MemoryPool::CreateDefault();
+    static ThreadCachingMemoryPool pool(wrapped.get());
+    return &pool;
+  }
+};
+
+struct ArenaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static std::unique_ptr<MemoryPool> wrapped = MemoryPool::CreateDefault();
+    static ArenaMemoryPool pool(wrapped.get());
+    return &pool;
+  }
+};
+
+struct RecyclingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static std::unique_ptr<MemoryPool> wrapped = MemoryPool::CreateDefault();
+    static RecyclingMemoryPool pool(wrapped.get());
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -76,6 +106,10 @@ REGISTER_TYPED_TEST_CASE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_CASE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_CASE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_CASE_P(ThreadCaching, TestMemoryPool,
+                              ThreadCachingMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_CASE_P(Arena, TestMemoryPool, ArenaMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_CASE_P(Recycling, TestMemoryPool, RecyclingMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_CASE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -144,6 +178,332 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(ThreadCachingMemoryPool, ReusesBuffers) {
+  ProxyMemoryPool proxy(default_memory_pool());
+  {
+    ThreadCachingMemoryPool pool(&proxy);
+
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(100, &data));
+    ASSERT_EQ(100, pool.bytes_allocated());
+    ASSERT_EQ(128, proxy.bytes_allocated());
+
+    // The freed buffer stays in the cache, and is reused for the same size class
+    pool.Free(data, 100);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(128, proxy.bytes_allocated());
+    uint8_t* data2;
+    ASSERT_OK(pool.Allocate(120, &data2));
+    ASSERT_EQ(data, data2);
+
+    // Large allocations bypass the cache
+    uint8_t* large;
+    ASSERT_OK(pool.Allocate(1 << 20, &large));
+    ASSERT_EQ(120 + (1 << 20), pool.bytes_allocated());
+    ASSERT_EQ(128 + (1 << 20), proxy.bytes_allocated());
+    pool.Free(large, 1 << 20);
+    ASSERT_EQ(128, proxy.bytes_allocated());
+
+    // Reallocating to another size class copies the data
+    data2[0] = 42;
+    ASSERT_OK(pool.Reallocate(120, 1000, &data2));
+    ASSERT_EQ(42, data2[0]);
+    ASSERT_EQ(1000, pool.bytes_allocated());
+    pool.Free(data2, 1000);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(128 + 1024, proxy.bytes_allocated());
+  }
+  // Destroying the pool returns the cached buffers
+  ASSERT_EQ(0, proxy.bytes_allocated());
+}
+
+TEST(ThreadCachingMemoryPool, MultipleThreads) {
+  ProxyMemoryPool proxy(default_memory_pool());
+  ThreadCachingMemoryPool pool(&proxy);
+
+  constexpr int kNumThreads = 4;
+  std::vector<uint8_t*> live(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&pool, &live, i]() {
+      for (int64_t size = 1; size < 100000; size += 97) {
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(size, &data));
+        data[size - 1] = 1;
+        pool.Free(data, size);
+      }
+      ASSERT_OK(pool.Allocate(10, &live[i]));
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(kNumThreads * 10, pool.bytes_allocated());
+
+  // Buffers may be freed by another thread than the one which allocated them
+  for (uint8_t* data : live) {
+    pool.Free(data, 10);
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+  // The exited threads returned their cached buffers
+  ASSERT_EQ(kNumThreads * 64, proxy.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, BumpAllocation) {
+  ProxyMemoryPool proxy(default_memory_pool());
+  {
+    ArenaMemoryPool pool(&proxy, 4096);
+
+    uint8_t* data1;
+    uint8_t* data2;
+    ASSERT_OK(pool.Allocate(100, &data1));
+    ASSERT_OK(pool.Allocate(10, &data2));
+    ASSERT_EQ(data1 + 128, data2);
+    ASSERT_EQ(110, pool.bytes_allocated());
+    ASSERT_EQ(4096, pool.bytes_reserved());
+    ASSERT_EQ(4096, proxy.bytes_allocated());
+
+    // The most recent allocation can grow in place
+    data2[0] = 42;
+    uint8_t* data = data2;
+    ASSERT_OK(pool.Reallocate(10, 500, &data2));
+    ASSERT_EQ(data, data2);
+    ASSERT_EQ(600, pool.bytes_allocated());
+
+    // Freeing the most recent allocation reclaims its space
+    pool.Free(data2, 500);
+    ASSERT_OK(pool.Allocate(64, &data2));
+    ASSERT_EQ(data, data2);
+
+    // Large allocations get their own chunk, returned on Free
+    uint8_t* large;
+    ASSERT_OK(pool.Allocate(2000, &large));
+    ASSERT_EQ(4096 + 2048, pool.bytes_reserved());
+    pool.Free(large, 2000);
+    ASSERT_EQ(4096, pool.bytes_reserved());
+
+    // Filling a chunk allocates a new one
+    std::vector<uint8_t*> buffers(10);
+    for (auto& buffer : buffers) {
+      ASSERT_OK(pool.Allocate(1000, &buffer));
+    }
+    ASSERT_EQ(3 * 4096, pool.bytes_reserved());
+
+    // Reset keeps the first chunk only
+    for (auto buffer : buffers) {
+      pool.Free(buffer, 1000);
+    }
+    pool.Free(data1, 100);
+    pool.Free(data2, 64);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    pool.Reset();
+    ASSERT_EQ(4096, pool.bytes_reserved());
+    ASSERT_OK(pool.Allocate(10, &data));
+    ASSERT_EQ(data1, data);
+    pool.Free(data, 10);
+  }
+  ASSERT_EQ(0, proxy.bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, RecyclesSameSize) {
+  ProxyMemoryPool proxy(default_memory_pool());
+  {
+    RecyclingMemoryPool pool(&proxy, /*max_cached_bytes=*/1500);
+
+    uint8_t* data;
+    uint8_t* data2;
+    ASSERT_OK(pool.Allocate(1000, &data));
+    ASSERT_OK(pool.Allocate(1000, &data2));
+    pool.Free(data, 1000);
+    // Over the cache capacity
+    pool.Free(data2, 1000);
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(1000, pool.bytes_cached());
+    ASSERT_EQ(1000, proxy.bytes_allocated());
+
+    // Only allocations of the same size reuse the buffer
+    ASSERT_OK(pool.Allocate(500, &data2));
+    uint8_t* recycled;
+    ASSERT_OK(pool.Allocate(1000, &recycled));
+    ASSERT_EQ(data, recycled);
+    ASSERT_EQ(0, pool.bytes_cached());
+    ASSERT_EQ(1500, pool.bytes_allocated());
+
+    pool.Free(recycled, 1000);
+    pool.Free(data2, 500);
+    ASSERT_EQ(1500, pool.bytes_cached());
+    pool.Trim();
+    ASSERT_EQ(0, pool.bytes_cached());
+    ASSERT_EQ(0, proxy.bytes_allocated());
+
+    ASSERT_OK(pool.Allocate(100, &data));
+    pool.Free(data, 100);
+  }
+  // Destroying the pool returns the cached buffers
+  ASSERT_EQ(0, proxy.bytes_allocated());
+}
+
+TEST(LimitingMemoryPool, Limit) {
+  LimitingMemoryPool pool(default_memory_pool(), 1000);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(600, &data));
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data2));
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(600, 1200, &data));
+  ASSERT_EQ(600, pool.bytes_allocated());
+
+  ASSERT_OK(pool.Reallocate(600, 400, &data));
+  ASSERT_OK(pool.Allocate(600, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.max_memory());
+
+  pool.Free(data, 400);
+  pool.Free(data2, 600);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(LimitingMemoryPool, ReclaimCallbacks) {
+  LimitingMemoryPool pool(default_memory_pool(), 1000);
+
+  // A cache of buffers which can be dropped on demand
+  std::vector<uint8_t*> cached(4);
+  for (auto& data : cached) {
+    ASSERT_OK(pool.Allocate(200, &data));
+  }
+  int64_t requested = 0;
+  int id = pool.RegisterReclaimCallback([&](int64_t bytes_needed) {
+    requested = bytes_needed;
+    int64_t released = 0;
+    while (released < bytes_needed && !cached.empty()) {
+      pool.Free(cached.back(), 200);
+      cached.pop_back();
+      released += 200;
+    }
+    return released;
+  });
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(500, &data));
+  ASSERT_EQ(300, requested);
+  ASSERT_EQ(2U, cached.size());
+  ASSERT_EQ(900, pool.bytes_allocated());
+
+  pool.UnregisterReclaimCallback(id);
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(500, &data2));
+
+  pool.Free(data, 500);
+  for (auto data : cached) {
+    pool.Free(data, 200);
+  }
+}
+
+TEST(LimitingMemoryPool, WaitForMemory) {
+  LimitingMemoryPool pool(default_memory_pool(), 1000, /*max_wait_ms=*/60000);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(800, &data));
+  std::thread thread([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.Free(data, 800);
+  });
+  // Blocks until the other thread frees its buffer
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(800, &data2));
+  thread.join();
+  pool.Free(data2, 800);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, Tags) {
+  ProfilingMemoryPool pool(default_memory_pool());
+
+  uint8_t* data;
+  uint8_t* data2;
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(100, &data));
+  {
+    ProfilingMemoryPool::ScopedTag tag("reader");
+    ASSERT_OK(pool.Allocate(1000, &data2));
+    {
+      ProfilingMemoryPool::ScopedTag inner_tag("decoder");
+      ASSERT_OK(pool.Allocate(10, &data3));
+    }
+    ASSERT_OK(pool.Reallocate(1000, 5000, &data2));
+  }
+  pool.Free(data3, 10);
+  ASSERT_EQ(5100, pool.bytes_allocated());
+
+  auto profiles = pool.GetProfiles();
+  ASSERT_EQ(3U, profiles.size());
+  ASSERT_EQ("", profiles[0].tag);
+  ASSERT_EQ(1, profiles[0].num_allocations);
+  ASSERT_EQ(1, profiles[0].size_histogram[6]);
+  ASSERT_EQ("decoder", profiles[1].tag);
+  ASSERT_EQ(0, profiles[1].live_bytes);
+  ASSERT_EQ(10, profiles[1].peak_live_bytes);
+  int64_t num_freed = 0;
+  for (int64_t count : profiles[1].lifetime_histogram) {
+    num_freed += count;
+  }
+  ASSERT_EQ(1, num_freed);
+  ASSERT_EQ("reader", profiles[2].tag);
+  ASSERT_EQ(2, profiles[2].num_allocations);
+  ASSERT_EQ(6000, profiles[2].bytes_allocated);
+  ASSERT_EQ(5000, profiles[2].live_bytes);
+  ASSERT_EQ(1, profiles[2].size_histogram[9]);
+  ASSERT_EQ(1, profiles[2].size_histogram[12]);
+  ASSERT_NE(std::string::npos, pool.ProfilesToString().find("tag 'reader'"));
+
+  pool.Free(data, 100);
+  pool.Free(data2, 5000);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(0, pool.GetProfiles()[2].live_bytes);
+}
+
+TEST(ProfilingMemoryPool, Sampling) {
+  ProfilingMemoryPool pool(default_memory_pool(), /*sample_interval=*/10);
+
+  std::vector<uint8_t*> buffers(100);
+  for (auto& data : buffers) {
+    ASSERT_OK(pool.Allocate(64, &data));
+  }
+  auto profiles = pool.GetProfiles();
+  ASSERT_EQ(1U, profiles.size());
+  ASSERT_EQ(10, profiles[0].num_allocations);
+  ASSERT_EQ(640, profiles[0].live_bytes);
+  for (auto data : buffers) {
+    pool.Free(data, 64);
+  }
+  ASSERT_EQ(0, pool.GetProfiles()[0].live_bytes);
+}
+
+TEST(MemoryPool, PlacementOptions) {
+#ifdef __linux__
+  ASSERT_OK(memory_pool_set_huge_pages(true));
+  ASSERT_OK(memory_pool_set_numa_local(true));
+#else
+  ASSERT_RAISES(NotImplemented, memory_pool_set_huge_pages(true));
+  ASSERT_RAISES(NotImplemented, memory_pool_set_numa_local(true));
+#endif
+  // The options are hints, allocations behave the same
+  MemoryPool* pool = default_memory_pool();
+  const int64_t size = 8 << 20;
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(size, &data));
+  data[0] = 1;
+  data[size - 1] = 2;
+  ASSERT_OK(pool->Reallocate(size, 2 * size, &data));
+  ASSERT_EQ(1, data[0]);
+  ASSERT_EQ(2, data[size - 1]);
+  pool->Free(data, 2 * size);
+#ifdef __linux__
+  ASSERT_OK(memory_pool_set_huge_pages(false));
+  ASSERT_OK(memory_pool_set_numa_local(false));
+#endif
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -510,39 +510,58 @@ inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArra
   using ArrayType = typename TypeTraits<Type>::ArrayType;
   using Scalar = typename MemoizationTraits<Type>::Scalar;
 
-  PyAcquireGIL lock;
-  // TODO(fsaintjacques): propagate memory pool.
-  ::arrow::internal::ScalarMemoTable<Scalar> memo_table(default_memory_pool());
-  std::vector<PyObject*> unique_values;
-  int32_t memo_size = 0;
-
-  auto WrapMemoized = [&](const Scalar& value, PyObject** out_values) {
-    int32_t memo_index = memo_table.GetOrInsert(value);
-    if (memo_index == memo_size) {
-      // New entry
-      RETURN_NOT_OK(wrap_func(value, out_values));
-      unique_values.push_back(*out_values);
-      ++memo_size;
-    } else {
-      // Duplicate entry
-      Py_INCREF(unique_values[memo_index]);
-      *out_values = unique_values[memo_index];
+  if (!options.deduplicate_objects) {
+    PyAcquireGIL lock;
+    for (int c = 0; c < data.num_chunks(); c++) {
+      const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
+      RETURN_NOT_OK(WriteArrayObjects(arr, wrap_func, out_values));
+      out_values += arr.length();
     }
     return Status::OK();
-  };
-
-  auto WrapUnmemoized = [&](const Scalar& value, PyObject** out_values) {
-    return wrap_func(value, out_values);
-  };
+  }
 
+  // Values are hashed without holding the GIL, so that other columns can be
+  // converted meanwhile. It is only acquired to wrap the unique values, and
+  // to reference them from the output.
+  ::arrow::internal::ScalarMemoTable<Scalar> memo_table(options.pool);
+  std::vector<Scalar> unique_scalars;
+  // The memo index of each value, -1 for nulls
+  std::vector<int32_t> memo_indices(static_cast<size_t>(data.length()));
+  auto memo_index = memo_indices.begin();
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
-    if (options.deduplicate_objects) {
-      RETURN_NOT_OK(WriteArrayObjects(arr, WrapMemoized, out_values));
-    } else {
-      RETURN_NOT_OK(WriteArrayObjects(arr, WrapUnmemoized, out_values));
+    const bool has_nulls = arr.null_count() > 0;
+    for (int64_t i = 0; i < arr.length(); ++i, ++memo_index) {
+      if (has_nulls && arr.IsNull(i)) {
+        *memo_index = -1;
+        continue;
+      }
+      const Scalar value = arr.GetView(i);
+      *memo_index = memo_table.GetOrInsert(
+          value, [](int32_t) {},
+          [&unique_scalars, &value](int32_t) { unique_scalars.push_back(value); });
+    }
+  }
+
+  PyAcquireGIL lock;
+  std::vector<PyObject*> unique_values(unique_scalars.size());
+  for (size_t i = 0; i < unique_scalars.size(); ++i) {
+    Status status = wrap_func(unique_scalars[i], &unique_values[i]);
+    if (!status.ok()) {
+      for (size_t j = 0; j < i; ++j) {
+        Py_DECREF(unique_values[j]);
+      }
+      return status;
     }
-    out_values += arr.length();
+  }
+  for (int32_t index : memo_indices) {
+    *out_values = index == -1 ? Py_None : unique_values[index];
+    Py_INCREF(*out_values);
+    ++out_values;
+  }
+  // The output holds a reference to every unique value
+  for (PyObject* value : unique_values) {
+    Py_DECREF(value);
   }
   return Status::OK();
 }
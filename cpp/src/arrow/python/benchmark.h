@@ -26,7 +26,8 @@ namespace arrow {
 namespace py {
 namespace benchmark {
 
-// Micro-benchmark routines for use from ASV
+// Micro-benchmark routines for use from ASV. The C++ benchmarks of the
+// conversions are in conversion_benchmark.cc
 
 // Run PandasObjectIsNull() once over every object in *list*
 ARROW_PYTHON_EXPORT
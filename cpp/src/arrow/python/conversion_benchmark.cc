@@ -0,0 +1,376 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/python/platform.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/python/arrow_to_pandas.h"
+#include "arrow/python/common.h"
+#include "arrow/python/deserialize.h"
+#include "arrow/python/numpy_to_arrow.h"
+#include "arrow/python/python_to_arrow.h"
+#include "arrow/python/serialize.h"
+
+namespace arrow {
+namespace py {
+
+// Every benchmark holds the GIL, except around the calls which pyarrow makes
+// without it. The interpreter is set up by util/benchmark_main.cc.
+
+constexpr int kNumColumns = 8;
+constexpr int kSeed = 0x0ff1ce;
+constexpr double kNullProbability = 0.1;
+
+// The benchmarks don't recover from Python errors
+static PyObject* CheckPy(PyObject* obj) {
+  ABORT_NOT_OK(CheckPyError());
+  return obj;
+}
+
+static OwnedRef ImportNumPy() {
+  return OwnedRef(CheckPy(PyImport_ImportModule("numpy")));
+}
+
+// ----------------------------------------------------------------------
+// Arrow to pandas
+
+static std::shared_ptr<Table> MakeTable(
+    const std::function<std::shared_ptr<Array>(random::RandomArrayGenerator*)>& gen) {
+  random::RandomArrayGenerator rng(kSeed);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    columns.push_back(gen(&rng));
+    fields.push_back(field("f" + std::to_string(i), columns.back()->type()));
+  }
+  return Table::Make(schema(fields), columns);
+}
+
+static void ArrowToPandas(benchmark::State& state, const std::shared_ptr<Table>& table,
+                          bool deduplicate_objects = false) {
+  PandasOptions options;
+  options.use_threads = state.range(1) != 0;
+  options.deduplicate_objects = deduplicate_objects;
+
+  PyAcquireGIL lock;
+  while (state.KeepRunning()) {
+    PyObject* out;
+    {
+      PyReleaseGIL release;
+      ABORT_NOT_OK(ConvertTableToPandas(options, table, &out));
+    }
+    Py_DECREF(out);
+  }
+  state.SetItemsProcessed(state.iterations() * table->num_rows() * kNumColumns);
+}
+
+static void ArrowToPandasInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  ArrowToPandas(state, MakeTable([&](random::RandomArrayGenerator* rng) {
+                  return rng->Int64(length, -1000, 1000);
+                }));
+}
+
+static void ArrowToPandasFloat64WithNulls(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  ArrowToPandas(state, MakeTable([&](random::RandomArrayGenerator* rng) {
+                  return rng->Float64(length, -1000, 1000, kNullProbability);
+                }));
+}
+
+static void ArrowToPandasString(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  ArrowToPandas(state, MakeTable([&](random::RandomArrayGenerator* rng) {
+                  return rng->String(length, 1, 16, kNullProbability);
+                }));
+}
+
+static void ArrowToPandasStringDeduplicate(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  ArrowToPandas(state,
+                MakeTable([&](random::RandomArrayGenerator* rng) {
+                  return rng->StringWithRepeats(length, 100, 1, 16, kNullProbability);
+                }),
+                /*deduplicate_objects=*/true);
+}
+
+// ----------------------------------------------------------------------
+// NumPy to Arrow
+
+static void NumPyToArrow(benchmark::State& state, PyObject* values, PyObject* mask,
+                         bool from_pandas, const std::shared_ptr<DataType>& type) {
+  while (state.KeepRunning()) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(NdarrayToArrow(default_memory_pool(), values, mask, from_pandas, type,
+                                &out));
+  }
+  const auto& fw_type = ::arrow::internal::checked_cast<const FixedWidthType&>(*type);
+  state.SetBytesProcessed(state.iterations() * state.range(0) * fw_type.bit_width() / 8);
+}
+
+static void NumPyToArrowInt64(benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  auto numpy = ImportNumPy();
+  OwnedRef values(
+      CheckPy(cpp_PyObject_CallMethod(numpy.obj(), "arange", "n", state.range(0))));
+  NumPyToArrow(state, values.obj(), Py_None, false, int64());
+}
+
+static void NumPyToArrowInt64WithMask(
+    benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  auto numpy = ImportNumPy();
+  OwnedRef values(
+      CheckPy(cpp_PyObject_CallMethod(numpy.obj(), "arange", "n", state.range(0))));
+  OwnedRef ten(PyLong_FromLong(10));
+  OwnedRef remainders(CheckPy(PyNumber_Remainder(values.obj(), ten.obj())));
+  OwnedRef zero(PyLong_FromLong(0));
+  OwnedRef mask(CheckPy(PyObject_RichCompare(remainders.obj(), zero.obj(), Py_EQ)));
+  NumPyToArrow(state, values.obj(), mask.obj(), false, int64());
+}
+
+static void NumPyToArrowFloat64WithNaNs(
+    benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  auto numpy = ImportNumPy();
+  OwnedRef ints(
+      CheckPy(cpp_PyObject_CallMethod(numpy.obj(), "arange", "n", state.range(0))));
+  OwnedRef values(CheckPy(cpp_PyObject_CallMethod(ints.obj(), "astype", "s", "float64")));
+  // Every tenth value is a null when converting from pandas
+  OwnedRef step(PyLong_FromLong(10));
+  OwnedRef every_tenth(CheckPy(PySlice_New(nullptr, nullptr, step.obj())));
+  OwnedRef nan(PyFloat_FromDouble(NAN));
+  PyObject_SetItem(values.obj(), every_tenth.obj(), nan.obj());
+  CheckPy(values.obj());
+  NumPyToArrow(state, values.obj(), Py_None, true, float64());
+}
+
+static void NumPyToArrowStridedInt64(
+    benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  auto numpy = ImportNumPy();
+  OwnedRef ints(
+      CheckPy(cpp_PyObject_CallMethod(numpy.obj(), "arange", "n", 2 * state.range(0))));
+  OwnedRef step(PyLong_FromLong(2));
+  OwnedRef every_other(CheckPy(PySlice_New(nullptr, nullptr, step.obj())));
+  OwnedRef values(CheckPy(PyObject_GetItem(ints.obj(), every_other.obj())));
+  NumPyToArrow(state, values.obj(), Py_None, false, int64());
+}
+
+// ----------------------------------------------------------------------
+// Python sequences to Arrow
+
+static OwnedRef MakeList(int64_t length, const std::function<PyObject*(int64_t)>& item) {
+  OwnedRef list(CheckPy(PyList_New(length)));
+  for (int64_t i = 0; i < length; ++i) {
+    PyList_SET_ITEM(list.obj(), i, CheckPy(item(i)));
+  }
+  return list;
+}
+
+static PyObject* MakeInt(int64_t i) { return PyLong_FromLongLong(i * 7919 % 100003); }
+
+static PyObject* MakeFloat(int64_t i) { return PyFloat_FromDouble(i * 0.5); }
+
+static PyObject* MakeString(int64_t i) {
+  auto value = "value_" + std::to_string(i % 1000);
+  return PyUnicode_FromStringAndSize(value.data(), value.size());
+}
+
+static PyObject* MakeIntOrNone(int64_t i) {
+  if (i % 10 == 0) {
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+  return MakeInt(i);
+}
+
+static void PythonToArrow(benchmark::State& state,
+                          const std::function<PyObject*(int64_t)>& item) {
+  PyAcquireGIL lock;
+  auto list = MakeList(state.range(0), item);
+  PyConversionOptions options;
+  while (state.KeepRunning()) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(ConvertPySequence(list.obj(), options, &out));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void PythonToArrowInt64(benchmark::State& state) {  // NOLINT non-const reference
+  PythonToArrow(state, MakeInt);
+}
+
+static void PythonToArrowFloat64(benchmark::State& state) {  // NOLINT non-const reference
+  PythonToArrow(state, MakeFloat);
+}
+
+static void PythonToArrowString(benchmark::State& state) {  // NOLINT non-const reference
+  PythonToArrow(state, MakeString);
+}
+
+static void PythonToArrowInt64WithNones(
+    benchmark::State& state) {  // NOLINT non-const reference
+  PythonToArrow(state, MakeIntOrNone);
+}
+
+// ----------------------------------------------------------------------
+// Serialization
+
+// Serialize and write to a preallocated buffer, as pyarrow.serialize(...).to_buffer()
+static void Serialize(benchmark::State& state, PyObject* obj) {
+  const int num_threads = static_cast<int>(state.range(1));
+  int64_t size = 0;
+  while (state.KeepRunning()) {
+    SerializedPyObject serialized;
+    ABORT_NOT_OK(SerializeObject(Py_None, obj, &serialized));
+
+    PyReleaseGIL release;
+    io::MockOutputStream mock;
+    ABORT_NOT_OK(serialized.WriteTo(&mock));
+    size = mock.GetExtentBytesWritten();
+    std::shared_ptr<Buffer> buffer;
+    ABORT_NOT_OK(AllocateBuffer(size, &buffer));
+    io::FixedSizeBufferWriter writer(buffer);
+    writer.set_memcopy_threads(num_threads);
+    ABORT_NOT_OK(serialized.WriteTo(&writer));
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+
+// Deserialize from a buffer, as pyarrow.deserialize(buffer)
+static void Deserialize(benchmark::State& state, PyObject* obj) {
+  SerializedPyObject serialized;
+  ABORT_NOT_OK(SerializeObject(Py_None, obj, &serialized));
+  ASSIGN_OR_ABORT(auto stream,
+                  io::BufferOutputStream::Create(1024, default_memory_pool()));
+  ABORT_NOT_OK(serialized.WriteTo(stream.get()));
+  ASSIGN_OR_ABORT(auto buffer, stream->Finish());
+
+  // Deserialized ndarrays are views of the buffer, which outlives them
+  OwnedRef base(PyTuple_New(0));
+  while (state.KeepRunning()) {
+    io::BufferReader reader(buffer);
+    SerializedPyObject read;
+    ABORT_NOT_OK(ReadSerializedObject(&reader, &read));
+    PyObject* out;
+    ABORT_NOT_OK(DeserializeObject(Py_None, read, base.obj(), &out));
+    Py_DECREF(out);
+  }
+  state.SetBytesProcessed(state.iterations() * buffer->size());
+}
+
+// A list of kNumColumns float64 ndarrays
+static OwnedRef MakeNdarrays(int64_t length) {
+  auto numpy = ImportNumPy();
+  return MakeList(kNumColumns, [&](int64_t) {
+    OwnedRef ints(CheckPy(cpp_PyObject_CallMethod(numpy.obj(), "arange", "n", length)));
+    return cpp_PyObject_CallMethod(ints.obj(), "astype", "s", "float64");
+  });
+}
+
+static void SerializeNdarrays(benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  Serialize(state, MakeNdarrays(state.range(0)).obj());
+}
+
+static void SerializeInt64List(benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  Serialize(state, MakeList(state.range(0), MakeInt).obj());
+}
+
+static void SerializeStringList(benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  Serialize(state, MakeList(state.range(0), MakeString).obj());
+}
+
+static void DeserializeNdarrays(benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  Deserialize(state, MakeNdarrays(state.range(0)).obj());
+}
+
+static void DeserializeInt64List(benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  Deserialize(state, MakeList(state.range(0), MakeInt).obj());
+}
+
+static void DeserializeStringList(
+    benchmark::State& state) {  // NOLINT non-const reference
+  PyAcquireGIL lock;
+  Deserialize(state, MakeList(state.range(0), MakeString).obj());
+}
+
+// ----------------------------------------------------------------------
+
+// {length, use_threads or number of memcopy threads}
+static void SetArgsWithThreads(benchmark::internal::Benchmark* bench) {
+  for (int64_t length : {1 << 10, 1 << 16, 1 << 20}) {
+    for (int64_t threads : {0, 4}) {
+      bench->Args({length, threads});
+    }
+  }
+  bench->UseRealTime();
+}
+
+static void SetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t length : {1 << 10, 1 << 16, 1 << 20}) {
+    bench->Arg(length);
+  }
+}
+
+BENCHMARK(ArrowToPandasInt64)->Apply(SetArgsWithThreads);
+BENCHMARK(ArrowToPandasFloat64WithNulls)->Apply(SetArgsWithThreads);
+BENCHMARK(ArrowToPandasString)->Apply(SetArgsWithThreads);
+BENCHMARK(ArrowToPandasStringDeduplicate)->Apply(SetArgsWithThreads);
+
+BENCHMARK(NumPyToArrowInt64)->Apply(SetArgs);
+BENCHMARK(NumPyToArrowInt64WithMask)->Apply(SetArgs);
+BENCHMARK(NumPyToArrowFloat64WithNaNs)->Apply(SetArgs);
+BENCHMARK(NumPyToArrowStridedInt64)->Apply(SetArgs);
+
+BENCHMARK(PythonToArrowInt64)->Apply(SetArgs);
+BENCHMARK(PythonToArrowFloat64)->Apply(SetArgs);
+BENCHMARK(PythonToArrowString)->Apply(SetArgs);
+BENCHMARK(PythonToArrowInt64WithNones)->Apply(SetArgs);
+
+BENCHMARK(SerializeNdarrays)->Apply(SetArgsWithThreads);
+BENCHMARK(SerializeInt64List)->Apply(SetArgsWithThreads);
+BENCHMARK(SerializeStringList)->Apply(SetArgsWithThreads);
+BENCHMARK(DeserializeNdarrays)->Apply(SetArgs);
+BENCHMARK(DeserializeInt64List)->Apply(SetArgs);
+BENCHMARK(DeserializeStringList)->Apply(SetArgs);
+
+}  // namespace py
+}  // namespace arrow
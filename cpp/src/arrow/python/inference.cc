@@ -284,11 +284,15 @@ class TypeInferrer {
   // early with long sequences that may have problems up front
   // \param make_unions permit mixed-type data by creating union types (not yet
   // implemented)
+  // \param sample_size the number of non-null values to observe before
+  // inferring the type, all of them if negative
   explicit TypeInferrer(bool pandas_null_sentinels = false,
-                        int64_t validate_interval = 100, bool make_unions = false)
+                        int64_t validate_interval = 100, bool make_unions = false,
+                        int64_t sample_size = -1)
       : pandas_null_sentinels_(pandas_null_sentinels),
         validate_interval_(validate_interval),
         make_unions_(make_unions),
+        sample_size_(sample_size),
         total_count_(0),
         none_count_(0),
         bool_count_(0),
@@ -369,6 +373,10 @@ class TypeInferrer {
       RETURN_NOT_OK(Validate());
     }
 
+    if (sample_size_ >= 0 && total_count_ - none_count_ >= sample_size_) {
+      *keep_going = false;
+    }
+
     return Status::OK();
   }
 
@@ -591,6 +599,7 @@ class TypeInferrer {
   bool pandas_null_sentinels_;
   int64_t validate_interval_;
   bool make_unions_;
+  int64_t sample_size_;
   int64_t total_count_;
   int64_t none_count_;
   int64_t bool_count_;
@@ -626,7 +635,13 @@ class TypeInferrer {
 // Non-exhaustive type inference
 Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
                       std::shared_ptr<DataType>* out_type) {
-  TypeInferrer inferrer(pandas_null_sentinels);
+  return InferArrowType(obj, mask, pandas_null_sentinels, -1, out_type);
+}
+
+Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
+                      int64_t sample_size, std::shared_ptr<DataType>* out_type) {
+  TypeInferrer inferrer(pandas_null_sentinels, /*validate_interval=*/100,
+                        /*make_unions=*/false, sample_size);
   RETURN_NOT_OK(inferrer.VisitSequence(obj, mask));
   RETURN_NOT_OK(inferrer.GetType(out_type));
   if (*out_type == nullptr) {
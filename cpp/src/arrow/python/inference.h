@@ -50,6 +50,19 @@ ARROW_PYTHON_EXPORT
 arrow::Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
                              std::shared_ptr<arrow::DataType>* out_type);
 
+/// \brief Infer Arrow type from the first values of a Python sequence
+/// \param[in] obj the sequence of values
+/// \param[in] mask an optional mask where True values are null. May
+/// be nullptr
+/// \param[in] pandas_null_sentinels use pandas's null value markers
+/// \param[in] sample_size the number of non-null values to infer the type
+/// from, all of them if negative
+/// \param[out] out_type the inferred type
+ARROW_PYTHON_EXPORT
+arrow::Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
+                             int64_t sample_size,
+                             std::shared_ptr<arrow::DataType>* out_type);
+
 ARROW_PYTHON_EXPORT
 arrow::Status InferArrowTypeAndSize(PyObject* obj, PyObject* mask,
                                     bool pandas_null_sentinels, int64_t* size,
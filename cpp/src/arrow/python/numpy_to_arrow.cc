@@ -39,6 +39,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
@@ -60,7 +61,9 @@ namespace arrow {
 
 using internal::checked_cast;
 using internal::CopyBitmap;
+using internal::CountSetBits;
 using internal::GenerateBitsUnrolled;
+using internal::ParallelFor;
 
 namespace py {
 
@@ -152,20 +155,28 @@ class NumPyNullsConverter {
   int64_t null_count_;
 };
 
+// Pack eight bytes which are each 0 or 1 into the bits of a byte, the first
+// byte into the least significant bit
+static inline uint8_t PackBytesToBits(const uint8_t* bytes) {
+  uint64_t word;
+  memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  return static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+}
+
 // Returns null count
 int64_t MaskToBitmap(PyArrayObject* mask, int64_t length, uint8_t* bitmap) {
-  int64_t null_count = 0;
-
   Ndarray1DIndexer<uint8_t> mask_values(mask);
-  for (int i = 0; i < length; ++i) {
-    if (mask_values[i]) {
-      ++null_count;
-      BitUtil::ClearBit(bitmap, i);
-    } else {
-      BitUtil::SetBit(bitmap, i);
+  int64_t i = 0;
+  if (PyArray_DESCR(mask)->type_num == NPY_BOOL && !mask_values.is_strided()) {
+    // Contiguous booleans are packed eight at a time
+    const uint8_t* bytes = mask_values.data();
+    for (; i + 8 <= length; i += 8) {
+      bitmap[i / 8] = static_cast<uint8_t>(~PackBytesToBits(bytes + i));
     }
   }
-  return null_count;
+  GenerateBitsUnrolled(bitmap, i, length - i, [&]() { return mask_values[i++] == 0; });
+  return length - CountSetBits(bitmap, 0, length);
 }
 
 }  // namespace
@@ -197,7 +208,8 @@ class NumPyConverter {
     stride_ = static_cast<int64_t>(PyArray_STRIDES(arr_)[0]);
   }
 
-  bool is_strided() const { return itemsize_ != stride_; }
+  // The stride of an array of at most one element is meaningless
+  bool is_strided() const { return length_ > 1 && itemsize_ != stride_; }
 
   Status Convert();
 
@@ -388,6 +400,9 @@ void CopyStridedNatural(T* input_data, int64_t length, int64_t stride, T* output
   }
 }
 
+// Strided arrays are copied in blocks of this many values, in parallel
+constexpr int64_t kStridedCopyBlockLength = 1 << 18;
+
 class NumPyStridedConverter {
  public:
   static Status Convert(PyArrayObject* arr, int64_t length, MemoryPool* pool,
@@ -405,15 +420,32 @@ class NumPyStridedConverter {
     RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(T) * length_, &buffer_));
 
     const int64_t stride = PyArray_STRIDES(arr)[0];
-    if (stride % sizeof(T) == 0) {
-      const int64_t stride_elements = stride / sizeof(T);
-      CopyStridedNatural(reinterpret_cast<T*>(PyArray_DATA(arr)), length_,
-                         stride_elements, reinterpret_cast<T*>(buffer_->mutable_data()));
-    } else {
-      CopyStridedBytewise(reinterpret_cast<int8_t*>(PyArray_DATA(arr)), length_, stride,
-                          reinterpret_cast<T*>(buffer_->mutable_data()));
+    auto input_data = reinterpret_cast<int8_t*>(PyArray_DATA(arr));
+    auto output_data = reinterpret_cast<T*>(buffer_->mutable_data());
+    auto CopyBlock = [&](int64_t offset, int64_t length) {
+      if (stride % static_cast<int64_t>(sizeof(T)) == 0) {
+        const int64_t stride_elements = stride / static_cast<int64_t>(sizeof(T));
+        CopyStridedNatural(reinterpret_cast<T*>(input_data) + offset * stride_elements,
+                           length, stride_elements, output_data + offset);
+      } else {
+        CopyStridedBytewise(input_data + offset * stride, length, stride,
+                            output_data + offset);
+      }
+    };
+
+    if (length_ <= kStridedCopyBlockLength) {
+      CopyBlock(0, length_);
+      return Status::OK();
     }
-    return Status::OK();
+    // Gathering strided values is bound by memory latency rather than
+    // bandwidth, so large arrays are copied on several threads
+    const int num_blocks = static_cast<int>(
+        BitUtil::CeilDiv(length_, kStridedCopyBlockLength));
+    return ParallelFor(num_blocks, [&](int block) {
+      const int64_t offset = block * kStridedCopyBlockLength;
+      CopyBlock(offset, std::min(kStridedCopyBlockLength, length_ - offset));
+      return Status::OK();
+    });
   }
 
  protected:
@@ -853,5 +885,46 @@ Status NdarrayToArrow(MemoryPool* pool, PyObject* ao, PyObject* mo, bool from_pa
   return NdarrayToArrow(pool, ao, mo, from_pandas, type, compute::CastOptions(), out);
 }
 
+Status Ndarray2DToArrow(MemoryPool* pool, PyObject* ao, bool from_pandas,
+                        const std::shared_ptr<DataType>& type,
+                        const compute::CastOptions& cast_options,
+                        std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  if (!PyArray_Check(ao)) {
+    return Status::Invalid("Input object was not a NumPy array");
+  }
+  auto arr = reinterpret_cast<PyArrayObject*>(ao);
+  if (PyArray_NDIM(arr) != 2) {
+    return Status::Invalid("only handle 2-dimensional arrays");
+  }
+
+  npy_intp num_rows = PyArray_DIM(arr, 0);
+  npy_intp row_stride = PyArray_STRIDE(arr, 0);
+  const int flags = PyArray_FLAGS(arr) & (NPY_ARRAY_ALIGNED | NPY_ARRAY_WRITEABLE);
+
+  out->clear();
+  for (npy_intp i = 0; i < PyArray_DIM(arr, 1); ++i) {
+    // Each column is converted from a 1D view of the array, which is
+    // contiguous, and thus zero-copy, if the array is in Fortran order
+    PyArray_Descr* descr = PyArray_DESCR(arr);
+    Py_INCREF(descr);
+    OwnedRef column(PyArray_NewFromDescr(&PyArray_Type, descr, 1, &num_rows,
+                                         &row_stride,
+                                         PyArray_BYTES(arr) + i * PyArray_STRIDE(arr, 1),
+                                         flags, nullptr));
+    RETURN_IF_PYERROR();
+    Py_INCREF(ao);
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(column.obj()), ao) ==
+        -1) {
+      RETURN_IF_PYERROR();
+    }
+
+    std::shared_ptr<ChunkedArray> chunked;
+    RETURN_NOT_OK(NdarrayToArrow(pool, column.obj(), nullptr, from_pandas, type,
+                                 cast_options, &chunked));
+    out->push_back(std::move(chunked));
+  }
+  return Status::OK();
+}
+
 }  // namespace py
 }  // namespace arrow
@@ -23,6 +23,7 @@
 #include "arrow/python/platform.h"
 
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/python/visibility.h"
@@ -69,6 +70,22 @@ Status NdarrayToArrow(MemoryPool* pool, PyObject* ao, PyObject* mo, bool from_pa
                       const std::shared_ptr<DataType>& type,
                       std::shared_ptr<ChunkedArray>* out);
 
+/// Convert the columns of a 2D NumPy array to Arrow. The columns of an array
+/// in Fortran order are not copied.
+///
+/// \param[in] pool Memory pool for any memory allocations
+/// \param[in] ao a 2-dimensional ndarray with the array data
+/// \param[in] from_pandas If true, use pandas's null sentinels to determine
+/// whether values are null
+/// \param[in] type a specific type to cast to, may be null
+/// \param[in] cast_options casting options
+/// \param[out] out a ChunkedArray per column of the ndarray
+ARROW_PYTHON_EXPORT
+Status Ndarray2DToArrow(MemoryPool* pool, PyObject* ao, bool from_pandas,
+                        const std::shared_ptr<DataType>& type,
+                        const compute::CastOptions& cast_options,
+                        std::vector<std::shared_ptr<ChunkedArray>>* out);
+
 }  // namespace py
 }  // namespace arrow
 
@@ -21,6 +21,7 @@
 #include <datetime.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <sstream>
@@ -37,6 +38,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
 
 #include "arrow/python/datetime.h"
 #include "arrow/python/decimal.h"
@@ -1238,6 +1240,211 @@ Status GetConverter(const std::shared_ptr<DataType>& type, bool from_pandas,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Fast path for lists of int, float, str or bytes objects
+
+// Converts a list whose values are all None or of one of the above exact
+// types. The values are extracted in a single pass holding the GIL, then the
+// array is built without it.
+class HomogeneousListConverter {
+ public:
+  explicit HomogeneousListConverter(bool from_pandas) : from_pandas_(from_pandas) {}
+
+  /// \brief Extract the values of the list, *ok is false if it has values
+  /// which the fast path doesn't handle
+  Status Extract(PyObject* list, int64_t size, bool* ok) {
+    *ok = false;
+    valid_bytes_.reserve(size);
+    for (int64_t i = 0; i < size; ++i) {
+      PyObject* item = PyList_GET_ITEM(list, i);
+      if (item == Py_None) {
+        AppendNull();
+        continue;
+      }
+      const Kind kind = GetKind(item);
+      if (kind == UNKNOWN || (kind_ != UNKNOWN && kind != kind_)) {
+        return Status::OK();
+      }
+      if (kind_ == UNKNOWN) {
+        // Nulls preceding the first value
+        kind_ = kind;
+        ResizeValues(i);
+      }
+      if (!AppendValue(item)) {
+        return Status::OK();
+      }
+    }
+    // A list of nulls is left to inference
+    *ok = kind_ != UNKNOWN;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type() const {
+    switch (kind_) {
+      case INT:
+        return int64();
+      case FLOAT:
+        return float64();
+      case STR:
+        return utf8();
+      case BYTES:
+        return binary();
+      default:
+        return nullptr;
+    }
+  }
+
+  /// \brief Build the array of the extracted values, doesn't need the GIL
+  Status Finish(MemoryPool* pool, std::shared_ptr<ChunkedArray>* out) {
+    std::shared_ptr<Array> array;
+    const int64_t length = static_cast<int64_t>(valid_bytes_.size());
+    if (kind_ == INT) {
+      Int64Builder builder(pool);
+      RETURN_NOT_OK(builder.AppendValues(ints_.data(), length, valid_bytes_.data()));
+      RETURN_NOT_OK(builder.Finish(&array));
+    } else if (kind_ == FLOAT) {
+      DoubleBuilder builder(pool);
+      RETURN_NOT_OK(builder.AppendValues(doubles_.data(), length, valid_bytes_.data()));
+      RETURN_NOT_OK(builder.Finish(&array));
+    } else {
+      BinaryBuilder builder(type(), pool);
+      RETURN_NOT_OK(builder.Reserve(length));
+      RETURN_NOT_OK(builder.ReserveData(data_length_));
+      for (int64_t i = 0; i < length; ++i) {
+        if (valid_bytes_[i]) {
+          builder.UnsafeAppend(views_[i]);
+        } else {
+          builder.UnsafeAppendNull();
+        }
+      }
+      RETURN_NOT_OK(builder.Finish(&array));
+    }
+    *out = std::make_shared<ChunkedArray>(ArrayVector{array});
+    return Status::OK();
+  }
+
+ private:
+  enum Kind { UNKNOWN, INT, FLOAT, STR, BYTES };
+
+  // Subclasses, e.g. bool, are left to the regular path
+  static Kind GetKind(PyObject* item) {
+    if (PyLong_CheckExact(item)) {
+      return INT;
+    } else if (PyFloat_CheckExact(item)) {
+      return FLOAT;
+    } else if (PyUnicode_CheckExact(item)) {
+      return STR;
+    } else if (PyBytes_CheckExact(item)) {
+      return BYTES;
+    }
+    return UNKNOWN;
+  }
+
+  void ResizeValues(int64_t length) {
+    switch (kind_) {
+      case INT:
+        ints_.reserve(valid_bytes_.capacity());
+        ints_.resize(length);
+        break;
+      case FLOAT:
+        doubles_.reserve(valid_bytes_.capacity());
+        doubles_.resize(length);
+        break;
+      default:
+        views_.reserve(valid_bytes_.capacity());
+        views_.resize(length);
+        break;
+    }
+  }
+
+  void AppendNull() {
+    valid_bytes_.push_back(0);
+    if (kind_ != UNKNOWN) {
+      ResizeValues(static_cast<int64_t>(valid_bytes_.size()));
+    }
+  }
+
+  // Return false if the value can't be converted by the fast path
+  bool AppendValue(PyObject* item) {
+    switch (kind_) {
+      case INT: {
+        int overflow = 0;
+        const int64_t value = PyLong_AsLongLongAndOverflow(item, &overflow);
+        if (overflow != 0) {
+          return false;
+        }
+        ints_.push_back(value);
+        valid_bytes_.push_back(1);
+        return true;
+      }
+      case FLOAT: {
+        const double value = PyFloat_AS_DOUBLE(item);
+        doubles_.push_back(value);
+        valid_bytes_.push_back(!(from_pandas_ && std::isnan(value)));
+        return true;
+      }
+      case STR: {
+        Py_ssize_t length;
+        // The UTF8 representation is cached by, and lives as long as, the str
+        const char* data = PyUnicode_AsUTF8AndSize(item, &length);
+        if (data == nullptr) {
+          // e.g. surrogates, the regular path reports the error
+          PyErr_Clear();
+          return false;
+        }
+        return AppendView(data, length);
+      }
+      default:
+        return AppendView(PyBytes_AS_STRING(item), PyBytes_GET_SIZE(item));
+    }
+  }
+
+  bool AppendView(const char* data, int64_t length) {
+    data_length_ += length;
+    // Larger values are split in several chunks by the regular path
+    if (data_length_ > kBinaryMemoryLimit) {
+      return false;
+    }
+    views_.emplace_back(data, static_cast<size_t>(length));
+    valid_bytes_.push_back(1);
+    return true;
+  }
+
+  bool from_pandas_;
+  Kind kind_ = UNKNOWN;
+  std::vector<uint8_t> valid_bytes_;
+  std::vector<int64_t> ints_;
+  std::vector<double> doubles_;
+  std::vector<util::string_view> views_;
+  int64_t data_length_ = 0;
+};
+
+// Convert a list with the fast path if possible, *converted is false otherwise
+Status ConvertHomogeneousList(PyObject* seq, int64_t size,
+                              const PyConversionOptions& options, bool* converted,
+                              std::shared_ptr<ChunkedArray>* out) {
+  *converted = false;
+  if (!PyList_Check(seq)) {
+    return Status::OK();
+  }
+  // The copy keeps the values alive, and their data valid, while the GIL is
+  // released even if another thread modifies the list
+  OwnedRef list(PyList_GetSlice(seq, 0, size));
+  RETURN_IF_PYERROR();
+
+  HomogeneousListConverter converter(options.from_pandas);
+  bool ok;
+  RETURN_NOT_OK(converter.Extract(list.obj(), size, &ok));
+  if (!ok || (options.type != nullptr && !options.type->Equals(converter.type()))) {
+    return Status::OK();
+  }
+
+  PyReleaseGIL release_gil;
+  RETURN_NOT_OK(converter.Finish(options.pool, out));
+  *converted = true;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 
 // Convert *obj* to a sequence if necessary
@@ -1297,13 +1504,22 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
   RETURN_NOT_OK(ConvertToSequenceAndInferSize(sequence_source, &seq, &size));
   tmp_seq_nanny.reset(seq);
 
+  if (mask == nullptr || mask == Py_None) {
+    bool converted;
+    RETURN_NOT_OK(ConvertHomogeneousList(seq, size, options, &converted, out));
+    if (converted) {
+      return Status::OK();
+    }
+  }
+
   // In some cases, type inference may be "loose", like strings. If the user
   // passed pa.string(), then we will error if we encounter any non-UTF8
   // value. If not, then we will allow the result to be a BinaryArray
   bool strict_conversions = false;
 
   if (options.type == nullptr) {
-    RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &real_type));
+    RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas,
+                                 options.inference_sample_size, &real_type));
   } else {
     real_type = options.type;
     strict_conversions = true;
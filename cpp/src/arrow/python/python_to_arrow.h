@@ -40,11 +40,20 @@ class Status;
 namespace py {
 
 struct PyConversionOptions {
-  PyConversionOptions() : type(NULLPTR), size(-1), pool(NULLPTR), from_pandas(false) {}
+  PyConversionOptions()
+      : type(NULLPTR),
+        size(-1),
+        pool(NULLPTR),
+        from_pandas(false),
+        inference_sample_size(-1) {}
 
   PyConversionOptions(const std::shared_ptr<DataType>& type, int64_t size,
                       MemoryPool* pool, bool from_pandas)
-      : type(type), size(size), pool(default_memory_pool()), from_pandas(from_pandas) {}
+      : type(type),
+        size(size),
+        pool(default_memory_pool()),
+        from_pandas(from_pandas),
+        inference_sample_size(-1) {}
 
   // Set to null if to be inferred
   std::shared_ptr<DataType> type;
@@ -57,6 +66,10 @@ struct PyConversionOptions {
 
   // Default false
   bool from_pandas;
+
+  // The number of non-null values from which to infer the type, if not
+  // given. Default is -1: infer from all values
+  int64_t inference_sample_size;
 };
 
 /// \brief Convert sequence (list, generator, NumPy array with dtype object) of
@@ -496,6 +496,14 @@ Status Append(PyObject* context, PyObject* elem, SequenceBuilder* builder,
     std::shared_ptr<Buffer> buffer;
     RETURN_NOT_OK(unwrap_buffer(elem, &buffer));
     blobs_out->buffers.push_back(buffer);
+#if PY_VERSION_HEX >= 0x03080000
+  } else if (PyPickleBuffer_Check(elem)) {
+    // An out-of-band buffer of pickle protocol 5, it is stored as a blob
+    // without copying and deserializes to a pyarrow.Buffer viewing the input
+    RETURN_NOT_OK(builder->AppendBuffer(static_cast<int32_t>(blobs_out->buffers.size())));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, PyBuffer::FromPyObject(elem));
+    blobs_out->buffers.push_back(std::move(buffer));
+#endif
   } else if (is_tensor(elem)) {
     RETURN_NOT_OK(builder->AppendTensor(static_cast<int32_t>(blobs_out->tensors.size())));
     std::shared_ptr<Tensor> tensor;
@@ -0,0 +1,44 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/python/platform.h"
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/python/datetime.h"
+#include "arrow/python/init.h"
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+
+  Py_Initialize();
+  int ret = arrow_init_numpy();
+  if (ret != 0) {
+    return ret;
+  }
+  ::arrow::py::internal::InitDatetime();
+
+  // The benchmarks acquire the GIL themselves, as the pyarrow callers would,
+  // so that multithreaded conversions can take it from their worker threads
+  PyThreadState* state = PyEval_SaveThread();
+  benchmark::RunSpecifiedBenchmarks();
+  PyEval_RestoreThread(state);
+
+  Py_Finalize();
+
+  return 0;
+}
@@ -265,13 +265,16 @@ Status RecordBatch::Validate() const {
   return Status::OK();
 }
 
-Status RecordBatch::ValidateFull() const {
+Status RecordBatch::ValidateFull(bool use_threads) const {
   RETURN_NOT_OK(Validate());
+  ArrayVector columns;
+  std::vector<const Array*> arrays;
   for (int i = 0; i < num_columns(); ++i) {
-    const auto& array = *this->column(i);
-    RETURN_NOT_OK(internal::ValidateArrayData(array));
+    columns.push_back(this->column(i));
+    arrays.push_back(columns.back().get());
   }
-  return Status::OK();
+  int64_t invalid_column;
+  return internal::ValidateArraysData(arrays, use_threads, &invalid_column);
 }
 
 // ----------------------------------------------------------------------
@@ -166,8 +166,9 @@ class ARROW_EXPORT RecordBatch {
   ///
   /// This is potentially O(k*n) where n is the number of rows.
   ///
+  /// \param[in] use_threads validate the columns on the CPU thread pool
   /// \return Status
-  virtual Status ValidateFull() const;
+  virtual Status ValidateFull(bool use_threads = false) const;
 
  protected:
   RecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows);
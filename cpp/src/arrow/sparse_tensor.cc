@@ -25,6 +25,8 @@
 
 #include "arrow/compare.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -42,6 +44,32 @@ Status SparseIndex::ValidateShape(const std::vector<int64_t>& shape) const {
 
 namespace {
 
+// ----------------------------------------------------------------------
+// Parallel conversion helpers
+
+// Tensors with fewer elements than this are converted on the calling thread.
+constexpr int64_t kParallelConversionThreshold = 1 << 16;
+
+// Return the number of tasks a conversion of a tensor of `size` elements is split
+// into, when its outermost axis has `length` elements.
+int ConversionTaskCount(int64_t size, int64_t length) {
+  if (size < kParallelConversionThreshold || length < 2) {
+    return 1;
+  }
+  return static_cast<int>(
+      std::min<int64_t>(length, GetCpuThreadPoolCapacity()));
+}
+
+// Call func(task, begin, end) for `num_tasks` contiguous ranges splitting [0, length).
+template <typename Function>
+Status ForEachRange(int num_tasks, int64_t length, Function&& func) {
+  return ::arrow::internal::OptionalParallelFor(
+      num_tasks > 1, num_tasks, [&](int task) {
+        func(task, length * task / num_tasks, length * (task + 1) / num_tasks);
+        return Status::OK();
+      });
+}
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter
 
@@ -91,21 +119,14 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
     const int64_t indices_elsize = sizeof(c_index_value_type);
 
     const int64_t ndim = tensor_.ndim();
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
-
-    std::shared_ptr<Buffer> indices_buffer;
-    RETURN_NOT_OK(
-        AllocateBuffer(pool_, indices_elsize * ndim * nonzero_count, &indices_buffer));
-    c_index_value_type* indices =
-        reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
+    if (ndim <= 1) {
+      int64_t nonzero_count = -1;
+      RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
 
-    std::shared_ptr<Buffer> values_buffer;
-    RETURN_NOT_OK(
-        AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+      c_index_value_type* indices = nullptr;
+      value_type* values = nullptr;
+      RETURN_NOT_OK(AllocateOutput(indices_elsize, nonzero_count, &indices, &values));
 
-    if (ndim <= 1) {
       const value_type* data = reinterpret_cast<const value_type*>(tensor_.raw_data());
       const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
       for (int64_t i = 0; i < count; ++i, ++data) {
@@ -114,45 +135,33 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
           *values++ = *data;
         }
       }
-    } else {
-      const std::vector<int64_t>& shape = tensor_.shape();
-      std::vector<int64_t> coord(ndim, 0);
-
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const value_type x = tensor_.Value(coord);
-        if (tensor_.Value(coord) != 0) {
-          *values++ = x;
-
-          c_index_value_type* indp = indices;
-          for (int64_t i = 0; i < ndim; ++i) {
-            *indp = static_cast<c_index_value_type>(coord[i]);
-            indp += nonzero_count;
-          }
-          indices++;
-        }
-
-        // increment index
-        ++coord[ndim - 1];
-        if (n > 1 && coord[ndim - 1] == shape[ndim - 1]) {
-          int64_t d = ndim - 1;
-          while (d > 0 && coord[d] == shape[d]) {
-            coord[d] = 0;
-            ++coord[d - 1];
-            --d;
-          }
-        }
-      }
+      return MakeResult(indices_elsize, nonzero_count);
     }
 
-    // make results
-    const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
-    const std::vector<int64_t> indices_strides = {indices_elsize,
-                                                  indices_elsize * nonzero_count};
-    sparse_index = std::make_shared<SparseCOOIndex>(std::make_shared<Tensor>(
-        index_value_type_, indices_buffer, indices_shape, indices_strides));
-    data = values_buffer;
-
-    return Status::OK();
+    // Count the non-zero elements of each range of rows, then let each range
+    // write its coordinates and values from the offset given by the counts
+    // of the preceding ranges.
+    const int64_t length = tensor_.shape()[0];
+    const int num_tasks = ConversionTaskCount(tensor_.size(), length);
+    std::vector<int64_t> offsets(num_tasks + 1, 0);
+    RETURN_NOT_OK(ForEachRange(num_tasks, length,
+                               [&](int task, int64_t begin, int64_t end) {
+                                 offsets[task + 1] = VisitRows<c_index_value_type>(
+                                     begin, end, 0, nullptr, nullptr);
+                               }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets[num_tasks];
+
+    c_index_value_type* indices = nullptr;
+    value_type* values = nullptr;
+    RETURN_NOT_OK(AllocateOutput(indices_elsize, nonzero_count, &indices, &values));
+    RETURN_NOT_OK(ForEachRange(num_tasks, length,
+                               [&](int task, int64_t begin, int64_t end) {
+                                 VisitRows(begin, end, nonzero_count,
+                                           indices + offsets[task],
+                                           values + offsets[task]);
+                               }));
+    return MakeResult(indices_elsize, nonzero_count);
   }
 
 #define CALL_TYPE_SPECIFIC_CONVERT(TYPE_CLASS) \
@@ -178,8 +187,142 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
   using BaseClass::index_value_type_;
   using BaseClass::pool_;
   using BaseClass::tensor_;
+
+  std::shared_ptr<Buffer> indices_buffer_;
+
+  template <typename c_index_value_type>
+  Status AllocateOutput(int64_t indices_elsize, int64_t nonzero_count,
+                        c_index_value_type** indices, value_type** values) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * tensor_.ndim() * nonzero_count,
+                                 &indices_buffer_));
+    *indices = reinterpret_cast<c_index_value_type*>(indices_buffer_->mutable_data());
+    RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &data));
+    *values = reinterpret_cast<value_type*>(data->mutable_data());
+    return Status::OK();
+  }
+
+  Status MakeResult(int64_t indices_elsize, int64_t nonzero_count) {
+    const std::vector<int64_t> indices_shape = {nonzero_count, tensor_.ndim()};
+    const std::vector<int64_t> indices_strides = {indices_elsize,
+                                                  indices_elsize * nonzero_count};
+    sparse_index = std::make_shared<SparseCOOIndex>(std::make_shared<Tensor>(
+        index_value_type_, indices_buffer_, indices_shape, indices_strides));
+    return Status::OK();
+  }
+
+  // Visit the elements of the rows [begin, end) of the first axis in row-major
+  // order and return the number of non-zero ones. Unless `values` is null, also
+  // write the non-zero values and their coordinates, whose indices matrix has
+  // `nonzero_count` rows.
+  template <typename c_index_value_type>
+  int64_t VisitRows(int64_t begin, int64_t end, int64_t nonzero_count,
+                    c_index_value_type* indices, value_type* values) const {
+    const int ndim = tensor_.ndim();
+    const std::vector<int64_t>& shape = tensor_.shape();
+    const std::vector<int64_t>& strides = tensor_.strides();
+    const uint8_t* raw_data = tensor_.raw_data();
+    const int64_t row_size = tensor_.size() / std::max<int64_t>(shape[0], 1);
+
+    std::vector<int64_t> coord(ndim, 0);
+    int64_t k = 0;
+    for (int64_t i = begin; i < end; ++i) {
+      coord[0] = i;
+      std::fill(coord.begin() + 1, coord.end(), 0);
+      int64_t offset = i * strides[0];
+      for (int64_t n = row_size; n > 0; --n) {
+        const value_type x = *reinterpret_cast<const value_type*>(raw_data + offset);
+        if (x != 0) {
+          if (values != nullptr) {
+            values[k] = x;
+            c_index_value_type* indp = indices + k;
+            for (int d = 0; d < ndim; ++d) {
+              *indp = static_cast<c_index_value_type>(coord[d]);
+              indp += nonzero_count;
+            }
+          }
+          ++k;
+        }
+
+        // increment the coordinates within the row
+        int d = ndim - 1;
+        ++coord[d];
+        offset += strides[d];
+        while (d > 1 && coord[d] == shape[d]) {
+          offset -= coord[d] * strides[d];
+          coord[d] = 0;
+          --d;
+          ++coord[d];
+          offset += strides[d];
+        }
+      }
+    }
+    return k;
+  }
 };
 
+// ----------------------------------------------------------------------
+// Conversion of a dense matrix to the CSR or CSC format
+
+// Convert a matrix whose compressed axis has `outer_length` elements spaced by
+// `outer_stride` bytes, and whose other axis has `inner_length` elements spaced
+// by `inner_stride` bytes. The non-zero elements of each range of the compressed
+// axis are counted, then each range writes its indices and values.
+template <typename value_type, typename c_index_value_type>
+Status ConvertToSparseCSX(const uint8_t* raw_data, int64_t outer_length,
+                          int64_t outer_stride, int64_t inner_length,
+                          int64_t inner_stride, MemoryPool* pool,
+                          std::shared_ptr<Buffer>* out_indptr,
+                          std::shared_ptr<Buffer>* out_indices,
+                          std::shared_ptr<Buffer>* out_values,
+                          int64_t* out_nonzero_count) {
+  const int64_t indices_elsize = sizeof(c_index_value_type);
+  const int num_tasks = ConversionTaskCount(outer_length * inner_length, outer_length);
+
+  std::vector<int64_t> offsets(outer_length + 1, 0);
+  RETURN_NOT_OK(
+      ForEachRange(num_tasks, outer_length, [&](int, int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          const uint8_t* p = raw_data + i * outer_stride;
+          int64_t count = 0;
+          for (int64_t j = 0; j < inner_length; ++j, p += inner_stride) {
+            count += *reinterpret_cast<const value_type*>(p) != 0;
+          }
+          offsets[i + 1] = count;
+        }
+      }));
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const int64_t nonzero_count = offsets[outer_length];
+
+  RETURN_NOT_OK(AllocateBuffer(pool, indices_elsize * (outer_length + 1), out_indptr));
+  RETURN_NOT_OK(AllocateBuffer(pool, indices_elsize * nonzero_count, out_indices));
+  RETURN_NOT_OK(AllocateBuffer(pool, sizeof(value_type) * nonzero_count, out_values));
+  auto* indptr = reinterpret_cast<c_index_value_type*>((*out_indptr)->mutable_data());
+  auto* indices = reinterpret_cast<c_index_value_type*>((*out_indices)->mutable_data());
+  auto* values = reinterpret_cast<value_type*>((*out_values)->mutable_data());
+
+  for (int64_t i = 0; i <= outer_length; ++i) {
+    indptr[i] = static_cast<c_index_value_type>(offsets[i]);
+  }
+  RETURN_NOT_OK(
+      ForEachRange(num_tasks, outer_length, [&](int, int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          const uint8_t* p = raw_data + i * outer_stride;
+          int64_t k = offsets[i];
+          for (int64_t j = 0; j < inner_length; ++j, p += inner_stride) {
+            const value_type x = *reinterpret_cast<const value_type*>(p);
+            if (x != 0) {
+              values[k] = x;
+              indices[k] = static_cast<c_index_value_type>(j);
+              ++k;
+            }
+          }
+        }
+      }));
+
+  *out_nonzero_count = nonzero_count;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
@@ -200,7 +343,6 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
   Status Convert() {
     using c_index_value_type = typename IndexValueType::c_type;
     RETURN_NOT_OK(CheckMaximumValue(std::numeric_limits<c_index_value_type>::max()));
-    const int64_t indices_elsize = sizeof(c_index_value_type);
 
     const int64_t ndim = tensor_.ndim();
     if (ndim > 2) {
@@ -209,44 +351,18 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
       // LCOV_EXCL_STOP
     }
 
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
+
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
-
     std::shared_ptr<Buffer> indptr_buffer;
     std::shared_ptr<Buffer> indices_buffer;
-
-    std::shared_ptr<Buffer> values_buffer;
-    RETURN_NOT_OK(
-        AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * (nr + 1), &indptr_buffer));
-      auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
-
-      RETURN_NOT_OK(
-          AllocateBuffer(pool_, indices_elsize * nonzero_count, &indices_buffer));
-      auto* indices =
-          reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
-
-      c_index_value_type k = 0;
-      *indptr++ = 0;
-      for (int64_t i = 0; i < nr; ++i) {
-        for (int64_t j = 0; j < nc; ++j) {
-          const value_type x = tensor_.Value({i, j});
-          if (x != 0) {
-            *values++ = x;
-            *indices++ = static_cast<c_index_value_type>(j);
-            k++;
-          }
-        }
-        *indptr++ = k;
-      }
-    }
+    int64_t nonzero_count = -1;
+    RETURN_NOT_OK((ConvertToSparseCSX<value_type, c_index_value_type>(
+        tensor_.raw_data(), nr, tensor_.strides()[0], nc, tensor_.strides()[1], pool_,
+        &indptr_buffer, &indices_buffer, &data, &nonzero_count)));
 
     std::vector<int64_t> indptr_shape({nr + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -257,7 +373,6 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
         std::make_shared<Tensor>(index_value_type_, indices_buffer, indices_shape);
 
     sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
-    data = values_buffer;
 
     return Status::OK();
   }
@@ -321,7 +436,6 @@ class SparseTensorConverter<TYPE, SparseCSCIndex>
   Status Convert() {
     using c_index_value_type = typename IndexValueType::c_type;
     RETURN_NOT_OK(CheckMaximumValue(std::numeric_limits<c_index_value_type>::max()));
-    const int64_t indices_elsize = sizeof(c_index_value_type);
 
     const int64_t ndim = tensor_.ndim();
     if (ndim > 2) {
@@ -330,44 +444,18 @@ class SparseTensorConverter<TYPE, SparseCSCIndex>
       // LCOV_EXCL_STOP
     }
 
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
+
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
-
     std::shared_ptr<Buffer> indptr_buffer;
     std::shared_ptr<Buffer> indices_buffer;
-
-    std::shared_ptr<Buffer> values_buffer;
-    RETURN_NOT_OK(
-        AllocateBuffer(pool_, sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      RETURN_NOT_OK(AllocateBuffer(pool_, indices_elsize * (nc + 1), &indptr_buffer));
-      auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
-
-      RETURN_NOT_OK(
-          AllocateBuffer(pool_, indices_elsize * nonzero_count, &indices_buffer));
-      auto* indices =
-          reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
-
-      c_index_value_type k = 0;
-      *indptr++ = 0;
-      for (int64_t j = 0; j < nc; ++j) {
-        for (int64_t i = 0; i < nr; ++i) {
-          const value_type x = tensor_.Value({i, j});
-          if (x != 0) {
-            *values++ = x;
-            *indices++ = static_cast<c_index_value_type>(i);
-            k++;
-          }
-        }
-        *indptr++ = k;
-      }
-    }
+    int64_t nonzero_count = -1;
+    RETURN_NOT_OK((ConvertToSparseCSX<value_type, c_index_value_type>(
+        tensor_.raw_data(), nc, tensor_.strides()[1], nr, tensor_.strides()[0], pool_,
+        &indptr_buffer, &indices_buffer, &data, &nonzero_count)));
 
     std::vector<int64_t> indptr_shape({nc + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -378,7 +466,6 @@ class SparseTensorConverter<TYPE, SparseCSCIndex>
         std::make_shared<Tensor>(index_value_type_, indices_buffer, indices_shape);
 
     sparse_index = std::make_shared<SparseCSCIndex>(indptr_tensor, indices_tensor);
-    data = values_buffer;
 
     return Status::OK();
   }
@@ -524,24 +611,27 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
 
   std::fill_n(values, sparse_tensor->size(), static_cast<value_type>(0));
 
+  const auto raw_data = reinterpret_cast<const value_type*>(sparse_tensor->raw_data());
+
   switch (sparse_tensor->format_id()) {
     case SparseTensorFormat::COO: {
       const auto& sparse_index =
           internal::checked_cast<const SparseCOOIndex&>(*sparse_tensor->sparse_index());
       const std::shared_ptr<const Tensor> coords = sparse_index.indices();
-      const auto raw_data =
-          reinterpret_cast<const value_type*>(sparse_tensor->raw_data());
-      std::vector<int64_t> strides(sparse_tensor->ndim(), 1);
+      const int ndim = sparse_tensor->ndim();
+      std::vector<int64_t> strides(ndim, 1);
 
-      for (int i = sparse_tensor->ndim() - 1; i > 0; --i) {
+      for (int i = ndim - 1; i > 0; --i) {
         strides[i - 1] *= strides[i] * sparse_tensor->shape()[i];
       }
+      const uint8_t* coords_data = coords->raw_data();
+      const int64_t coords_row_stride = coords->strides()[0];
+      const int64_t coords_column_stride = coords->strides()[1];
       for (int64_t i = 0; i < sparse_tensor->non_zero_length(); ++i) {
-        std::vector<c_index_value_type> coord(sparse_tensor->ndim());
+        const uint8_t* coord = coords_data + i * coords_row_stride;
         int64_t offset = 0;
-        for (int64_t j = 0; j < static_cast<int>(coord.size()); ++j) {
-          coord[j] = coords->Value<IndexValueType>({i, j});
-          offset += coord[j] * strides[j];
+        for (int j = 0; j < ndim; ++j, coord += coords_column_stride) {
+          offset += *reinterpret_cast<const c_index_value_type*>(coord) * strides[j];
         }
         values[offset] = raw_data[i];
       }
@@ -550,45 +640,46 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
       return Status::OK();
     }
 
-    case SparseTensorFormat::CSR: {
-      const auto& sparse_index =
-          internal::checked_cast<const SparseCSRIndex&>(*sparse_tensor->sparse_index());
-      const std::shared_ptr<const Tensor> indptr = sparse_index.indptr();
-      const std::shared_ptr<const Tensor> indices = sparse_index.indices();
-      const auto raw_data =
-          reinterpret_cast<const value_type*>(sparse_tensor->raw_data());
-
-      int64_t offset;
-      for (int64_t i = 0; i < indptr->size() - 1; ++i) {
-        const int64_t start = indptr->Value<IndexValueType>({i});
-        const int64_t stop = indptr->Value<IndexValueType>({i + 1});
-        for (int64_t j = start; j < stop; ++j) {
-          offset = indices->Value<IndexValueType>({j}) + i * sparse_tensor->shape()[1];
-          values[offset] = raw_data[j];
-        }
-      }
-      *out = std::make_shared<Tensor>(sparse_tensor->type(), values_buffer,
-                                      sparse_tensor->shape());
-      return Status::OK();
-    }
-
+    case SparseTensorFormat::CSR:
     case SparseTensorFormat::CSC: {
-      const auto& sparse_index =
-          internal::checked_cast<const SparseCSCIndex&>(*sparse_tensor->sparse_index());
-      const std::shared_ptr<const Tensor> indptr = sparse_index.indptr();
-      const std::shared_ptr<const Tensor> indices = sparse_index.indices();
-      const auto raw_data =
-          reinterpret_cast<const value_type*>(sparse_tensor->raw_data());
-
-      int64_t offset;
-      for (int64_t j = 0; j < indptr->size() - 1; ++j) {
-        const int64_t start = indptr->Value<IndexValueType>({j});
-        const int64_t stop = indptr->Value<IndexValueType>({j + 1});
-        for (int64_t i = start; i < stop; ++i) {
-          offset = j + indices->Value<IndexValueType>({i}) * sparse_tensor->shape()[1];
-          values[offset] = raw_data[i];
-        }
+      std::shared_ptr<const Tensor> indptr;
+      std::shared_ptr<const Tensor> indices;
+      // Distance in the dense row-major matrix between consecutive elements
+      // of the compressed axis and of the other axis
+      int64_t outer_stride, inner_stride;
+      if (sparse_tensor->format_id() == SparseTensorFormat::CSR) {
+        const auto& sparse_index =
+            internal::checked_cast<const SparseCSRIndex&>(*sparse_tensor->sparse_index());
+        indptr = sparse_index.indptr();
+        indices = sparse_index.indices();
+        outer_stride = sparse_tensor->shape()[1];
+        inner_stride = 1;
+      } else {
+        const auto& sparse_index =
+            internal::checked_cast<const SparseCSCIndex&>(*sparse_tensor->sparse_index());
+        indptr = sparse_index.indptr();
+        indices = sparse_index.indices();
+        outer_stride = 1;
+        inner_stride = sparse_tensor->shape()[1];
       }
+      const auto indptr_data =
+          reinterpret_cast<const c_index_value_type*>(indptr->raw_data());
+      const auto indices_data =
+          reinterpret_cast<const c_index_value_type*>(indices->raw_data());
+
+      // Each element of the compressed axis writes a distinct part of the output
+      const int64_t length = indptr->size() - 1;
+      const int num_tasks = ConversionTaskCount(sparse_tensor->size(), length);
+      RETURN_NOT_OK(ForEachRange(num_tasks, length, [&](int, int64_t begin,
+                                                        int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          const int64_t start = indptr_data[i];
+          const int64_t stop = indptr_data[i + 1];
+          for (int64_t j = start; j < stop; ++j) {
+            values[i * outer_stride + indices_data[j] * inner_stride] = raw_data[j];
+          }
+        }
+      }));
       *out = std::make_shared<Tensor>(sparse_tensor->type(), values_buffer,
                                       sparse_tensor->shape());
       return Status::OK();
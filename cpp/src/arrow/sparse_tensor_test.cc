@@ -903,4 +903,81 @@ TEST_F(TestSparseCSCMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+// Tensors large enough to be converted in parallel
+
+class TestSparseTensorLargeConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    shape_ = {300, 20, 25};
+    values_.resize(300 * 20 * 25, 0);
+    for (size_t i = 0; i < values_.size(); i += 7 + i % 5) {
+      values_[i] = static_cast<int64_t>(i % 100) + 1;
+      ++non_zero_length_;
+    }
+  }
+
+ protected:
+  std::vector<int64_t> shape_;
+  std::vector<int64_t> values_;
+  int64_t non_zero_length_ = 0;
+};
+
+TEST_F(TestSparseTensorLargeConversion, COO) {
+  Tensor tensor(int64(), Buffer::Wrap(values_), shape_);
+
+  std::shared_ptr<SparseCOOTensor> st;
+  ASSERT_OK_AND_ASSIGN(st, SparseCOOTensor::Make(tensor, int32()));
+  ASSERT_EQ(non_zero_length_, st->non_zero_length());
+
+  // The coordinates are in row-major order
+  const auto& si = internal::checked_cast<const SparseCOOIndex&>(*st->sparse_index());
+  const std::shared_ptr<const Tensor> coords = si.indices();
+  const auto* data = reinterpret_cast<const int64_t*>(st->raw_data());
+  int64_t previous = -1;
+  for (int64_t i = 0; i < st->non_zero_length(); ++i) {
+    const int64_t offset = (coords->Value<Int32Type>({i, 0}) * 20 +
+                            coords->Value<Int32Type>({i, 1})) *
+                               25 +
+                           coords->Value<Int32Type>({i, 2});
+    ASSERT_GT(offset, previous);
+    ASSERT_EQ(values_[offset], data[i]);
+    previous = offset;
+  }
+
+  std::shared_ptr<Tensor> dense_tensor;
+  ASSERT_OK(st->ToTensor(&dense_tensor));
+  ASSERT_TRUE(tensor.Equals(*dense_tensor));
+}
+
+TEST_F(TestSparseTensorLargeConversion, CSRAndCSC) {
+  std::vector<int64_t> shape = {300, 500};
+  Tensor tensor(int64(), Buffer::Wrap(values_), shape);
+  // The same matrix stored in column-major order
+  std::vector<int64_t> transposed(values_.size());
+  for (int64_t i = 0; i < 300; ++i) {
+    for (int64_t j = 0; j < 500; ++j) {
+      transposed[j * 300 + i] = values_[i * 500 + j];
+    }
+  }
+  Tensor column_major(int64(), Buffer::Wrap(transposed), shape, {8, 8 * 300});
+
+  std::shared_ptr<SparseCSRMatrix> csr1, csr2;
+  ASSERT_OK_AND_ASSIGN(csr1, SparseCSRMatrix::Make(tensor));
+  ASSERT_OK_AND_ASSIGN(csr2, SparseCSRMatrix::Make(column_major));
+  ASSERT_EQ(non_zero_length_, csr1->non_zero_length());
+  ASSERT_TRUE(csr1->Equals(*csr2));
+
+  std::shared_ptr<SparseCSCMatrix> csc1, csc2;
+  ASSERT_OK_AND_ASSIGN(csc1, SparseCSCMatrix::Make(tensor));
+  ASSERT_OK_AND_ASSIGN(csc2, SparseCSCMatrix::Make(column_major));
+  ASSERT_EQ(non_zero_length_, csc1->non_zero_length());
+  ASSERT_TRUE(csc1->Equals(*csc2));
+
+  std::shared_ptr<Tensor> dense_tensor;
+  ASSERT_OK(csr1->ToTensor(&dense_tensor));
+  ASSERT_TRUE(tensor.Equals(*dense_tensor));
+  ASSERT_OK(csc1->ToTensor(&dense_tensor));
+  ASSERT_TRUE(tensor.Equals(*dense_tensor));
+}
+
 }  // namespace arrow
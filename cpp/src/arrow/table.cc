@@ -18,6 +18,7 @@
 #include "arrow/table.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <limits>
 #include <memory>
@@ -31,7 +32,9 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -42,96 +45,156 @@ using internal::checked_cast;
 // ChunkedArray methods
 
 ChunkedArray::ChunkedArray(const ArrayVector& chunks) : chunks_(chunks) {
-  length_ = 0;
-  null_count_ = 0;
-
   ARROW_CHECK_GT(chunks.size(), 0)
       << "cannot construct ChunkedArray from empty vector and omitted type";
   type_ = chunks[0]->type();
-  for (const std::shared_ptr<Array>& chunk : chunks) {
-    length_ += chunk->length();
-    null_count_ += chunk->null_count();
-  }
+  Init();
 }
 
 ChunkedArray::ChunkedArray(const ArrayVector& chunks,
                            const std::shared_ptr<DataType>& type)
     : chunks_(chunks), type_(type) {
+  Init();
+}
+
+void ChunkedArray::Init() {
   length_ = 0;
   null_count_ = 0;
-  for (const std::shared_ptr<Array>& chunk : chunks) {
-    length_ += chunk->length();
-    null_count_ += chunk->null_count();
+  chunk_offsets_.resize(chunks_.size() + 1);
+  for (size_t i = 0; i < chunks_.size(); ++i) {
+    chunk_offsets_[i] = length_;
+    length_ += chunks_[i]->length();
+    null_count_ += chunks_[i]->null_count();
   }
+  chunk_offsets_.back() = length_;
 }
 
-bool ChunkedArray::Equals(const ChunkedArray& other) const {
-  if (length_ != other.length()) {
-    return false;
-  }
-  if (null_count_ != other.null_count()) {
-    return false;
-  }
-  if (length_ == 0) {
-    return type_->Equals(other.type_);
-  }
+int ChunkedArray::FindChunk(int64_t index) const {
+  auto it = std::upper_bound(chunk_offsets_.begin() + 1, chunk_offsets_.end(), index);
+  return static_cast<int>(it - (chunk_offsets_.begin() + 1));
+}
 
-  // Check contents of the underlying arrays. This checks for equality of
-  // the underlying data independently of the chunk size.
-  int this_chunk_idx = 0;
-  int64_t this_start_idx = 0;
-  int other_chunk_idx = 0;
-  int64_t other_start_idx = 0;
+void ChunkedArray::Locate(int64_t index, int* chunk_index,
+                          int64_t* index_in_chunk) const {
+  DCHECK_GE(index, 0);
+  DCHECK_LT(index, length_);
+  *chunk_index = FindChunk(index);
+  *index_in_chunk = index - chunk_offsets_[*chunk_index];
+}
+
+namespace {
+
+// Equal-length ranges of two chunked arrays, each within a single chunk
+using EqualsRange = std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>;
+
+// When comparing on threads, chunks are split into ranges of at most this
+// length, so that a few large chunks still spread over the thread pool
+constexpr int64_t kParallelEqualsRangeLength = 1 << 16;
+
+// Append the ranges where the chunks of two chunked arrays of the same length
+// overlap, which lets them be compared independently of their chunkings
+void AppendEqualsRanges(const ChunkedArray& left, const ChunkedArray& right,
+                        int64_t max_range_length, std::vector<EqualsRange>* ranges) {
+  int left_chunk_idx = 0;
+  int64_t left_start_idx = 0;
+  int right_chunk_idx = 0;
+  int64_t right_start_idx = 0;
 
   int64_t elements_compared = 0;
-  while (elements_compared < length_) {
-    const std::shared_ptr<Array> this_array = chunks_[this_chunk_idx];
-    const std::shared_ptr<Array> other_array = other.chunk(other_chunk_idx);
-    int64_t common_length = std::min(this_array->length() - this_start_idx,
-                                     other_array->length() - other_start_idx);
-    if (!this_array->RangeEquals(this_start_idx, this_start_idx + common_length,
-                                 other_start_idx, other_array)) {
-      return false;
+  while (elements_compared < left.length()) {
+    const std::shared_ptr<Array>& left_array = left.chunk(left_chunk_idx);
+    const std::shared_ptr<Array>& right_array = right.chunk(right_chunk_idx);
+    int64_t common_length =
+        std::min({left_array->length() - left_start_idx,
+                  right_array->length() - right_start_idx, max_range_length});
+    if (common_length == left_array->length() &&
+        common_length == right_array->length()) {
+      ranges->emplace_back(left_array, right_array);
+    } else if (common_length > 0) {
+      ranges->emplace_back(left_array->Slice(left_start_idx, common_length),
+                           right_array->Slice(right_start_idx, common_length));
     }
 
     elements_compared += common_length;
 
     // If we have exhausted the current chunk, proceed to the next one individually.
-    if (this_start_idx + common_length == this_array->length()) {
-      this_chunk_idx++;
-      this_start_idx = 0;
+    if (left_start_idx + common_length == left_array->length()) {
+      left_chunk_idx++;
+      left_start_idx = 0;
     } else {
-      this_start_idx += common_length;
+      left_start_idx += common_length;
     }
 
-    if (other_start_idx + common_length == other_array->length()) {
-      other_chunk_idx++;
-      other_start_idx = 0;
+    if (right_start_idx + common_length == right_array->length()) {
+      right_chunk_idx++;
+      right_start_idx = 0;
     } else {
-      other_start_idx += common_length;
+      right_start_idx += common_length;
+    }
+  }
+}
+
+bool RangesEqual(const std::vector<EqualsRange>& ranges, const EqualOptions& opts) {
+  if (!opts.use_threads() || ranges.size() <= 1) {
+    for (const auto& range : ranges) {
+      if (!range.first->Equals(*range.second, opts)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // The ranges are compared by tasks, which skip their range once one of
+  // them found a difference
+  std::atomic<bool> equal(true);
+  const EqualOptions range_opts = opts.diff_sink(NULLPTR);
+  Status st = internal::ParallelFor(static_cast<int>(ranges.size()), [&](int i) {
+    if (equal.load() && !ranges[i].first->Equals(*ranges[i].second, range_opts)) {
+      equal.store(false);
     }
+    return Status::OK();
+  });
+  DCHECK_OK(st);
+  return equal.load();
+}
+
+}  // namespace
+
+bool ChunkedArray::Equals(const ChunkedArray& other, const EqualOptions& opts) const {
+  if (length_ != other.length()) {
+    return false;
   }
-  return true;
+  if (null_count_ != other.null_count()) {
+    return false;
+  }
+  if (length_ == 0) {
+    return type_->Equals(other.type_);
+  }
+
+  // Check contents of the underlying arrays. This checks for equality of
+  // the underlying data independently of the chunk size.
+  std::vector<EqualsRange> ranges;
+  AppendEqualsRanges(*this, other,
+                     opts.use_threads() ? kParallelEqualsRangeLength : length_, &ranges);
+  return RangesEqual(ranges, opts);
 }
 
-bool ChunkedArray::Equals(const std::shared_ptr<ChunkedArray>& other) const {
+bool ChunkedArray::Equals(const std::shared_ptr<ChunkedArray>& other,
+                          const EqualOptions& opts) const {
   if (this == other.get()) {
     return true;
   }
   if (!other) {
     return false;
   }
-  return Equals(*other.get());
+  return Equals(*other.get(), opts);
 }
 
 std::shared_ptr<ChunkedArray> ChunkedArray::Slice(int64_t offset, int64_t length) const {
   ARROW_CHECK_LE(offset, length_) << "Slice offset greater than array length";
 
-  int curr_chunk = 0;
-  while (curr_chunk < num_chunks() && offset >= chunk(curr_chunk)->length()) {
-    offset -= chunk(curr_chunk)->length();
-    curr_chunk++;
-  }
+  int curr_chunk = FindChunk(offset);
+  offset -= chunk_offsets_[curr_chunk];
 
   ArrayVector new_chunks;
   while (curr_chunk < num_chunks() && length > 0) {
@@ -210,16 +273,18 @@ Status ChunkedArray::Validate() const {
   return Status::OK();
 }
 
-Status ChunkedArray::ValidateFull() const {
+Status ChunkedArray::ValidateFull(bool use_threads) const {
   RETURN_NOT_OK(Validate());
-  for (size_t i = 0; i < chunks_.size(); ++i) {
-    const Array& chunk = *chunks_[i];
-    const Status st = internal::ValidateArrayData(chunk);
-    if (!st.ok()) {
-      return Status::Invalid("In chunk ", i, ": ", st.ToString());
-    }
+  std::vector<const Array*> chunks;
+  for (const auto& chunk : chunks_) {
+    chunks.push_back(chunk.get());
   }
-  return Status::OK();
+  int64_t invalid_chunk;
+  const Status st = internal::ValidateArraysData(chunks, use_threads, &invalid_chunk);
+  if (!st.ok() && invalid_chunk >= 0) {
+    return Status::Invalid("In chunk ", invalid_chunk, ": ", st.ToString());
+  }
+  return st;
 }
 
 // ----------------------------------------------------------------------
@@ -337,22 +402,7 @@ class SimpleTable : public Table {
   }
 
   Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out) const override {
-    std::vector<std::shared_ptr<Field>> flattened_fields;
-    std::vector<std::shared_ptr<ChunkedArray>> flattened_columns;
-    for (int i = 0; i < num_columns(); ++i) {
-      std::vector<std::shared_ptr<ChunkedArray>> new_columns;
-      std::vector<std::shared_ptr<Field>> new_fields = field(i)->Flatten();
-      RETURN_NOT_OK(column(i)->Flatten(pool, &new_columns));
-      DCHECK_EQ(new_columns.size(), new_fields.size());
-      for (size_t j = 0; j < new_columns.size(); ++j) {
-        flattened_fields.push_back(new_fields[j]);
-        flattened_columns.push_back(new_columns[j]);
-      }
-    }
-    auto flattened_schema =
-        std::make_shared<Schema>(flattened_fields, schema_->metadata());
-    *out = Table::Make(flattened_schema, flattened_columns);
-    return Status::OK();
+    return Table::Flatten(pool, /*use_threads=*/false, out);
   }
 
   Status Validate() const override {
@@ -369,18 +419,29 @@ class SimpleTable : public Table {
     return Status::OK();
   }
 
-  Status ValidateFull() const override {
+  Status ValidateFull(bool use_threads) const override {
     RETURN_NOT_OK(ValidateMeta());
+    // The chunks of all columns are validated together, so that threads
+    // share the work even if there are few columns
+    std::vector<const Array*> chunks;
+    std::vector<std::pair<int, int>> chunk_positions;
     for (int i = 0; i < num_columns(); ++i) {
       const ChunkedArray* col = columns_[i].get();
-      Status st = col->ValidateFull();
-      if (!st.ok()) {
-        std::stringstream ss;
-        ss << "Column " << i << ": " << st.message();
-        return st.WithMessage(ss.str());
+      for (int j = 0; j < col->num_chunks(); ++j) {
+        chunks.push_back(col->chunk(j).get());
+        chunk_positions.emplace_back(i, j);
       }
     }
-    return Status::OK();
+    int64_t invalid_chunk;
+    Status st = internal::ValidateArraysData(chunks, use_threads, &invalid_chunk);
+    if (!st.ok() && invalid_chunk >= 0) {
+      const auto& position = chunk_positions[invalid_chunk];
+      std::stringstream ss;
+      ss << "Column " << position.first << ": In chunk " << position.second << ": "
+         << st.ToString();
+      return Status::Invalid(ss.str());
+    }
+    return st;
   }
 
  protected:
@@ -440,26 +501,41 @@ std::shared_ptr<Table> Table::Make(const std::shared_ptr<Schema>& schema,
 Status Table::FromRecordBatches(const std::shared_ptr<Schema>& schema,
                                 const std::vector<std::shared_ptr<RecordBatch>>& batches,
                                 std::shared_ptr<Table>* table) {
+  return FromRecordBatches(schema, batches, /*use_threads=*/false, table);
+}
+
+Status Table::FromRecordBatches(const std::shared_ptr<Schema>& schema,
+                                const std::vector<std::shared_ptr<RecordBatch>>& batches,
+                                bool use_threads, std::shared_ptr<Table>* table) {
   const int nbatches = static_cast<int>(batches.size());
   const int ncolumns = static_cast<int>(schema->num_fields());
 
+  // Batches usually share their schema instance, which needs to be
+  // compared only once
+  const Schema* checked_schema = schema.get();
   for (int i = 0; i < nbatches; ++i) {
-    if (!batches[i]->schema()->Equals(*schema, false)) {
+    const Schema* batch_schema = batches[i]->schema().get();
+    if (batch_schema == checked_schema) {
+      continue;
+    }
+    if (!batch_schema->Equals(*schema, false)) {
       return Status::Invalid("Schema at index ", static_cast<int>(i),
                              " was different: \n", schema->ToString(), "\nvs\n",
-                             batches[i]->schema()->ToString());
+                             batch_schema->ToString());
     }
+    checked_schema = batch_schema;
   }
 
+  // Constructing a column counts the nulls of its chunks
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncolumns);
-  std::vector<std::shared_ptr<Array>> column_arrays(nbatches);
-
-  for (int i = 0; i < ncolumns; ++i) {
+  RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, ncolumns, [&](int i) {
+    std::vector<std::shared_ptr<Array>> column_arrays(nbatches);
     for (int j = 0; j < nbatches; ++j) {
       column_arrays[j] = batches[j]->column(i);
     }
     columns[i] = std::make_shared<ChunkedArray>(column_arrays, schema->field(i)->type());
-  }
+    return Status::OK();
+  }));
 
   *table = Table::Make(schema, columns);
   return Status::OK();
@@ -522,6 +598,103 @@ Status Table::RenameColumns(const std::vector<std::string>& names,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Coalescing record batch streams
+
+// An estimate of the memory referenced by an array
+static int64_t ArrayDataBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataBufferSize(*child);
+  }
+  return size;
+}
+
+static int64_t RecordBatchBufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += ArrayDataBufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+class CoalescingIterator {
+ public:
+  CoalescingIterator(RecordBatchIterator it, const CoalesceOptions& options,
+                     MemoryPool* pool)
+      : it_(std::move(it)), options_(options), pool_(pool) {}
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    std::vector<std::shared_ptr<RecordBatch>> run;
+    int64_t run_rows = 0;
+    int64_t run_bytes = 0;
+    while (!ReachesTargets(run_rows, run_bytes)) {
+      if (pending_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(pending_, it_.Next());
+        if (pending_ == nullptr) {
+          break;
+        }
+        if (pending_->num_rows() == 0) {
+          pending_.reset();
+          continue;
+        }
+        pending_bytes_ = RecordBatchBufferSize(*pending_);
+      }
+      if (!run.empty() &&
+          ExceedsTargets(run_rows + pending_->num_rows(), run_bytes + pending_bytes_)) {
+        break;
+      }
+      run_rows += pending_->num_rows();
+      run_bytes += pending_bytes_;
+      run.push_back(std::move(pending_));
+      pending_.reset();
+    }
+
+    if (run.size() <= 1) {
+      return run.empty() ? nullptr : std::move(run[0]);
+    }
+    const int num_columns = run[0]->num_columns();
+    std::vector<std::shared_ptr<Array>> columns(num_columns);
+    ArrayVector chunks(run.size());
+    for (int i = 0; i < num_columns; ++i) {
+      for (size_t j = 0; j < run.size(); ++j) {
+        chunks[j] = run[j]->column(i);
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool_, &columns[i]));
+    }
+    return RecordBatch::Make(run[0]->schema(), run_rows, std::move(columns));
+  }
+
+ private:
+  bool ExceedsTargets(int64_t rows, int64_t bytes) const {
+    return (options_.target_rows > 0 && rows > options_.target_rows) ||
+           (options_.target_bytes > 0 && bytes > options_.target_bytes);
+  }
+
+  bool ReachesTargets(int64_t rows, int64_t bytes) const {
+    return (options_.target_rows > 0 && rows >= options_.target_rows) ||
+           (options_.target_bytes > 0 && bytes >= options_.target_bytes);
+  }
+
+  RecordBatchIterator it_;
+  CoalesceOptions options_;
+  MemoryPool* pool_;
+  // The batch read ahead which did not fit in the previous run
+  std::shared_ptr<RecordBatch> pending_;
+  int64_t pending_bytes_ = 0;
+};
+
+RecordBatchIterator MakeCoalescingIterator(RecordBatchIterator it,
+                                           const CoalesceOptions& options,
+                                           MemoryPool* pool) {
+  return RecordBatchIterator(CoalescingIterator(std::move(it), options, pool));
+}
+
 Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
                          std::shared_ptr<Table>* table) {
   if (tables.size() == 0) {
@@ -652,7 +825,7 @@ Result<std::shared_ptr<Table>> PromoteTableToSchema(const std::shared_ptr<Table>
   return Table::Make(schema, std::move(columns));
 }
 
-bool Table::Equals(const Table& other) const {
+bool Table::Equals(const Table& other, const EqualOptions& opts) const {
   if (this == &other) {
     return true;
   }
@@ -663,31 +836,106 @@ bool Table::Equals(const Table& other) const {
     return false;
   }
 
+  if (!opts.use_threads()) {
+    for (int i = 0; i < this->num_columns(); i++) {
+      if (!this->column(i)->Equals(other.column(i), opts)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Compare the ranges of all columns on the thread pool at once
+  std::vector<EqualsRange> ranges;
   for (int i = 0; i < this->num_columns(); i++) {
-    if (!this->column(i)->Equals(other.column(i))) {
+    const ChunkedArray& left = *this->column(i);
+    const ChunkedArray& right = *other.column(i);
+    if (left.length() != right.length() || left.null_count() != right.null_count()) {
       return false;
     }
+    AppendEqualsRanges(left, right, kParallelEqualsRangeLength, &ranges);
+  }
+  return RangesEqual(ranges, opts);
+}
+
+Status Table::Flatten(MemoryPool* pool, bool use_threads,
+                      std::shared_ptr<Table>* out) const {
+  const int ncolumns = num_columns();
+  int num_struct_columns = 0;
+  for (int i = 0; i < ncolumns; ++i) {
+    num_struct_columns += column(i)->type()->id() == Type::STRUCT;
+  }
+  std::vector<std::vector<std::shared_ptr<ChunkedArray>>> new_columns(ncolumns);
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      use_threads && num_struct_columns > 1, ncolumns,
+      [&](int i) { return column(i)->Flatten(pool, &new_columns[i]); }));
+
+  std::vector<std::shared_ptr<Field>> flattened_fields;
+  std::vector<std::shared_ptr<ChunkedArray>> flattened_columns;
+  for (int i = 0; i < ncolumns; ++i) {
+    std::vector<std::shared_ptr<Field>> new_fields = field(i)->Flatten();
+    DCHECK_EQ(new_columns[i].size(), new_fields.size());
+    for (size_t j = 0; j < new_columns[i].size(); ++j) {
+      flattened_fields.push_back(new_fields[j]);
+      flattened_columns.push_back(new_columns[i][j]);
+    }
   }
-  return true;
+  auto flattened_schema =
+      std::make_shared<Schema>(flattened_fields, schema_->metadata());
+  *out = Table::Make(flattened_schema, flattened_columns);
+  return Status::OK();
 }
 
 Status Table::CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const {
+  return CombineChunks(pool, /*use_threads=*/false, out);
+}
+
+Status Table::CombineChunks(MemoryPool* pool, bool use_threads,
+                            std::shared_ptr<Table>* out) const {
   const int ncolumns = num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
+  std::vector<int> columns_to_combine;
   for (int i = 0; i < ncolumns; ++i) {
     auto col = column(i);
     if (col->num_chunks() <= 1) {
       compacted_columns[i] = col;
     } else {
-      std::shared_ptr<Array> compacted;
-      RETURN_NOT_OK(Concatenate(col->chunks(), pool, &compacted));
-      compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
+      columns_to_combine.push_back(i);
     }
   }
+  auto combine_column = [&](int j, bool column_use_threads) {
+    const int i = columns_to_combine[j];
+    std::shared_ptr<Array> compacted;
+    RETURN_NOT_OK(Concatenate(column(i)->chunks(), pool, column_use_threads, &compacted));
+    compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
+    return Status::OK();
+  };
+  const auto num_to_combine = static_cast<int>(columns_to_combine.size());
+  if (num_to_combine == 1) {
+    RETURN_NOT_OK(combine_column(0, use_threads));
+  } else {
+    // Each column is concatenated serially, as waiting for nested tasks
+    // could exhaust the thread pool
+    RETURN_NOT_OK(internal::OptionalParallelFor(
+        use_threads, num_to_combine, [&](int j) { return combine_column(j, false); }));
+  }
   *out = Table::Make(schema(), compacted_columns);
   return Status::OK();
 }
 
+Status Table::CoalesceChunks(const CoalesceOptions& options, MemoryPool* pool,
+                             std::shared_ptr<Table>* out) const {
+  auto reader = std::make_shared<TableBatchReader>(*this);
+  auto batches_it = MakeCoalescingIterator(
+      MakeFunctionIterator([reader] { return reader->Next(); }), options, pool);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (auto maybe_batch : batches_it) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+    batches.push_back(std::move(batch));
+  }
+  return Table::FromRecordBatches(schema(), batches, out);
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/compare.h"
 #include "arrow/record_batch.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
@@ -66,6 +67,19 @@ class ARROW_EXPORT ChunkedArray {
 
   const ArrayVector& chunks() const { return chunks_; }
 
+  /// \return the logical index of the first element of chunk i; chunk
+  /// num_chunks() starts at length()
+  int64_t chunk_offset(int i) const { return chunk_offsets_[i]; }
+
+  /// \brief Find the chunk holding the element at a logical index
+  ///
+  /// Chunk boundaries are binary searched, in O(log(num_chunks)).
+  ///
+  /// \param[in] index the logical index, in [0, length())
+  /// \param[out] chunk_index the index of the chunk holding the element
+  /// \param[out] index_in_chunk the index of the element in that chunk
+  void Locate(int64_t index, int* chunk_index, int64_t* index_in_chunk) const;
+
   /// \brief Construct a zero-copy slice of the chunked array with the
   /// indicated offset and length
   ///
@@ -99,9 +113,11 @@ class ARROW_EXPORT ChunkedArray {
   ///
   /// Two chunked arrays can be equal only if they have equal datatypes.
   /// However, they may be equal even if they have different chunkings.
-  bool Equals(const ChunkedArray& other) const;
+  bool Equals(const ChunkedArray& other,
+              const EqualOptions& opts = EqualOptions::Defaults()) const;
   /// \brief Determine if two chunked arrays are equal.
-  bool Equals(const std::shared_ptr<ChunkedArray>& other) const;
+  bool Equals(const std::shared_ptr<ChunkedArray>& other,
+              const EqualOptions& opts = EqualOptions::Defaults()) const;
 
   /// \brief Perform cheap validation checks to determine obvious inconsistencies
   /// within the chunk array's internal data.
@@ -118,19 +134,44 @@ class ARROW_EXPORT ChunkedArray {
   /// This is O(k*n) where k is the number of array descendents,
   /// and n is the length in elements.
   ///
+  /// \param[in] use_threads validate the chunks on the CPU thread pool
   /// \return Status
-  Status ValidateFull() const;
+  Status ValidateFull(bool use_threads = false) const;
 
  protected:
   ArrayVector chunks_;
   int64_t length_;
   int64_t null_count_;
   std::shared_ptr<DataType> type_;
+  // The logical index of the first element of each chunk, followed by length_
+  std::vector<int64_t> chunk_offsets_;
 
  private:
+  void Init();
+  // The first non-empty chunk ending after index, or num_chunks()
+  int FindChunk(int64_t index) const;
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(ChunkedArray);
 };
 
+/// \brief Targets for merging consecutive small chunks or record batches
+///
+/// Consecutive chunks are merged as long as the merged chunk stays within
+/// both targets; chunks already exceeding a target are left as they are.
+/// Byte sizes are estimated from the sizes of the buffers a chunk references.
+struct ARROW_EXPORT CoalesceOptions {
+  CoalesceOptions() = default;
+  CoalesceOptions(int64_t target_rows, int64_t target_bytes)
+      : target_rows(target_rows), target_bytes(target_bytes) {}
+
+  /// Maximum number of rows of a merged chunk, 0 means no limit
+  int64_t target_rows = 64 * 1024;
+  /// Maximum estimated number of bytes of a merged chunk, 0 means no limit
+  int64_t target_bytes = 8 << 20;
+
+  static CoalesceOptions Defaults() { return CoalesceOptions(); }
+};
+
 /// \class Table
 /// \brief Logical table as sequence of chunked arrays
 class ARROW_EXPORT Table {
@@ -176,6 +217,19 @@ class ARROW_EXPORT Table {
       const std::vector<std::shared_ptr<RecordBatch>>& batches,
       std::shared_ptr<Table>* table);
 
+  /// \brief Construct a Table from RecordBatches, using supplied schema,
+  /// optionally building the columns in parallel on the CPU thread pool
+  ///
+  /// \param[in] schema the arrow::Schema for each batch
+  /// \param[in] batches a std::vector of record batches
+  /// \param[in] use_threads Whether to use the CPU thread pool
+  /// \param[out] table the returned table
+  /// \return Status
+  static Status FromRecordBatches(
+      const std::shared_ptr<Schema>& schema,
+      const std::vector<std::shared_ptr<RecordBatch>>& batches, bool use_threads,
+      std::shared_ptr<Table>* table);
+
   /// \brief Construct a Table from a chunked StructArray. One column will be produced
   /// for each field of the StructArray.
   ///
@@ -251,6 +305,14 @@ class ARROW_EXPORT Table {
   /// \param[out] out The returned table
   virtual Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out) const = 0;
 
+  /// \brief Flatten the table, optionally flattening the struct columns in
+  /// parallel on the CPU thread pool
+  ///
+  /// \param[in] pool The pool for buffer allocations, if any
+  /// \param[in] use_threads Whether to use the CPU thread pool
+  /// \param[out] out The returned table
+  Status Flatten(MemoryPool* pool, bool use_threads, std::shared_ptr<Table>* out) const;
+
   /// \brief Perform cheap validation checks to determine obvious inconsistencies
   /// within the table's schema and internal data.
   ///
@@ -266,8 +328,10 @@ class ARROW_EXPORT Table {
   /// This is O(k*n) where k is the total number of field descendents,
   /// and n is the number of rows.
   ///
+  /// \param[in] use_threads validate the chunks of all columns on the CPU
+  /// thread pool
   /// \return Status
-  virtual Status ValidateFull() const = 0;
+  virtual Status ValidateFull(bool use_threads = false) const = 0;
 
   /// \brief Return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
@@ -279,7 +343,8 @@ class ARROW_EXPORT Table {
   ///
   /// Two tables can be equal only if they have equal schemas.
   /// However, they may be equal even if they have different chunkings.
-  bool Equals(const Table& other) const;
+  bool Equals(const Table& other,
+              const EqualOptions& opts = EqualOptions::Defaults()) const;
 
   /// \brief Make a new table by combining the chunks this table has.
   ///
@@ -290,6 +355,30 @@ class ARROW_EXPORT Table {
   /// \param[out] out The table with chunks combined
   Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const;
 
+  /// \brief Make a new table by combining the chunks this table has,
+  /// optionally on the CPU thread pool
+  ///
+  /// With use_threads, the columns are combined in parallel, and the buffers
+  /// of a single column with many chunks are copied in parallel parts.
+  ///
+  /// \param[in] pool The pool for buffer allocations
+  /// \param[in] use_threads Whether to use the CPU thread pool
+  /// \param[out] out The table with chunks combined
+  Status CombineChunks(MemoryPool* pool, bool use_threads,
+                       std::shared_ptr<Table>* out) const;
+
+  /// \brief Make a new table by merging runs of small chunks
+  ///
+  /// Unlike CombineChunks, chunks are merged up to the given targets only,
+  /// and chunks which are large enough are kept without copy. Columns are
+  /// rechunked consistently, see TableBatchReader.
+  ///
+  /// \param[in] options The targets for merged chunks
+  /// \param[in] pool The pool for buffer allocations
+  /// \param[out] out The table with chunks coalesced
+  Status CoalesceChunks(const CoalesceOptions& options, MemoryPool* pool,
+                        std::shared_ptr<Table>* out) const;
+
  protected:
   Table();
 
@@ -328,6 +417,17 @@ class ARROW_EXPORT TableBatchReader : public RecordBatchReader {
   int64_t max_chunksize_;
 };
 
+/// \brief Merge runs of consecutive small record batches of a stream
+///
+/// Batches are read ahead until the next one would exceed the targets of
+/// options, then concatenated into a single batch. A batch which cannot be
+/// merged with its neighbours is passed through without copy, and empty
+/// batches are dropped.
+ARROW_EXPORT
+RecordBatchIterator MakeCoalescingIterator(RecordBatchIterator it,
+                                           const CoalesceOptions& options,
+                                           MemoryPool* pool = default_memory_pool());
+
 /// \brief Construct table from multiple input tables.
 ///
 /// The tables are concatenated vertically.  Therefore, all tables should
@@ -106,6 +106,29 @@ TEST_F(TestChunkedArray, EqualsDifferingLengths) {
   ASSERT_TRUE(one_->Equals(*another_.get()));
 }
 
+TEST_F(TestChunkedArray, EqualsThreaded) {
+  // Chunks long enough to be split in several ranges, and chunkings which
+  // differ on both sides
+  const int64_t length = 300000;
+  auto array = MakeRandomArray<Int32Array>(length, 1000);
+  arrays_one_ = {array->Slice(0, 100000), array->Slice(100000)};
+  arrays_another_ = {array->Slice(0, 70000), array->Slice(70000, 180000),
+                     array->Slice(250000)};
+  Construct();
+  const auto opts = EqualOptions().use_threads(true);
+  ASSERT_TRUE(one_->Equals(another_, opts));
+  ASSERT_TRUE(another_->Equals(one_, opts));
+
+  // A single differing value
+  std::shared_ptr<Array> other;
+  ArrayFromVector<Int32Type, int32_t>(
+      {static_cast<const Int32Array&>(*array).Value(200000) + 1}, &other);
+  arrays_another_ = {array->Slice(0, 200000), other, array->Slice(200001)};
+  Construct();
+  ASSERT_FALSE(one_->Equals(another_, opts));
+  ASSERT_FALSE(one_->Equals(another_));
+}
+
 TEST_F(TestChunkedArray, SliceEquals) {
   arrays_one_.push_back(MakeRandomArray<Int32Array>(100));
   arrays_one_.push_back(MakeRandomArray<Int32Array>(50));
@@ -138,6 +161,36 @@ TEST_F(TestChunkedArray, SliceEquals) {
   ASSERT_TRUE(slice5->type()->Equals(one_->type()));
 }
 
+TEST_F(TestChunkedArray, SliceEmptyChunks) {
+  auto chunked = ChunkedArrayFromJSON(int32(), {"[]", "[1, 2]", "[]", "[]", "[3]", "[]"});
+  AssertChunkedEqual(*ChunkedArrayFromJSON(int32(), {"[2]", "[]", "[]", "[3]"}),
+                     *chunked->Slice(1, 2));
+  AssertChunkedEqual(*ChunkedArrayFromJSON(int32(), {"[3]", "[]"}), *chunked->Slice(2));
+  ASSERT_EQ(0, chunked->Slice(3)->num_chunks());
+}
+
+TEST_F(TestChunkedArray, Locate) {
+  auto chunked =
+      ChunkedArrayFromJSON(int32(), {"[]", "[1, 2]", "[]", "[3]", "[4, 5, 6]"});
+  const std::vector<int64_t> offsets = {0, 0, 2, 2, 3, 6};
+  for (int i = 0; i <= chunked->num_chunks(); ++i) {
+    ASSERT_EQ(offsets[i], chunked->chunk_offset(i));
+  }
+
+  const std::vector<int> chunk_indices = {1, 1, 3, 4, 4, 4};
+  const std::vector<int64_t> indices_in_chunk = {0, 1, 0, 0, 1, 2};
+  for (int64_t index = 0; index < chunked->length(); ++index) {
+    int chunk_index;
+    int64_t index_in_chunk;
+    chunked->Locate(index, &chunk_index, &index_in_chunk);
+    ASSERT_EQ(chunk_indices[index], chunk_index);
+    ASSERT_EQ(indices_in_chunk[index], index_in_chunk);
+  }
+
+  ChunkedArray empty({}, int32());
+  ASSERT_EQ(0, empty.chunk_offset(0));
+}
+
 TEST_F(TestChunkedArray, Validate) {
   // Valid if empty
   ArrayVector empty = {};
@@ -158,6 +211,32 @@ TEST_F(TestChunkedArray, Validate) {
   ASSERT_RAISES(Invalid, one_->ValidateFull());
 }
 
+TEST_F(TestChunkedArray, ValidateFullThreaded) {
+  random::RandomArrayGenerator gen(0);
+  for (int i = 0; i < 10; ++i) {
+    arrays_one_.push_back(gen.String(100, 0, 10, 0.1));
+  }
+  Construct();
+  ASSERT_OK(one_->ValidateFull(/*use_threads=*/true));
+
+  // The first invalid chunk is reported, whichever thread sees it first
+  for (int i : {3, 7}) {
+    auto data = arrays_one_[i]->data()->Copy();
+    std::shared_ptr<Buffer> offsets;
+    ASSERT_OK(data->buffers[1]->Copy(0, data->buffers[1]->size(), &offsets));
+    data->buffers[1] = offsets;
+    auto raw_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    std::swap(raw_offsets[40], raw_offsets[60]);
+    arrays_one_[i] = MakeArray(data);
+  }
+  Construct();
+  for (bool use_threads : {false, true}) {
+    Status st = one_->ValidateFull(use_threads);
+    ASSERT_RAISES(Invalid, st);
+    ASSERT_NE(st.message().find("In chunk 3"), std::string::npos) << st.ToString();
+  }
+}
+
 TEST_F(TestChunkedArray, View) {
   auto in_ty = int32();
   auto out_ty = fixed_size_binary(4);
@@ -251,6 +330,27 @@ TEST_F(TestTable, Metadata) {
   ASSERT_EQ(schema_->field(0)->type(), col->type());
 }
 
+TEST_F(TestTable, ValidateFullThreaded) {
+  schema_ = ::arrow::schema({field("f0", utf8()), field("f1", utf8())});
+  auto valid = ArrayFromJSON(utf8(), R"(["a", null, "bc"])");
+  std::vector<int32_t> invalid_offsets = {0, 1, 1, 2};
+  auto invalid = std::make_shared<StringArray>(3, Buffer::Wrap(invalid_offsets),
+                                               std::make_shared<Buffer>("a\xff"));
+  columns_ = {std::make_shared<ChunkedArray>(ArrayVector{valid, valid}),
+              std::make_shared<ChunkedArray>(ArrayVector{valid, valid})};
+  table_ = Table::Make(schema_, columns_);
+  ASSERT_OK(table_->ValidateFull(/*use_threads=*/true));
+
+  columns_[1] = std::make_shared<ChunkedArray>(ArrayVector{valid, invalid});
+  table_ = Table::Make(schema_, columns_);
+  for (bool use_threads : {false, true}) {
+    Status st = table_->ValidateFull(use_threads);
+    ASSERT_RAISES(Invalid, st);
+    ASSERT_NE(st.message().find("Column 1: In chunk 1"), std::string::npos)
+        << st.ToString();
+  }
+}
+
 TEST_F(TestTable, InvalidColumns) {
   // Check that columns are all the same length
   const int length = 100;
@@ -298,6 +398,31 @@ TEST_F(TestTable, Equals) {
   ASSERT_FALSE(table_->Equals(*other));
 }
 
+TEST_F(TestTable, EqualsThreaded) {
+  const int length = 200000;
+  MakeExample1(length);
+  const auto opts = EqualOptions().use_threads(true);
+
+  table_ = Table::Make(schema_, columns_);
+  ASSERT_TRUE(table_->Equals(*table_, opts));
+
+  // Differently chunked
+  std::vector<std::shared_ptr<ChunkedArray>> other_columns;
+  for (const auto& array : arrays_) {
+    other_columns.push_back(std::make_shared<ChunkedArray>(
+        ArrayVector{array->Slice(0, 12345), array->Slice(12345)}));
+  }
+  auto other = Table::Make(schema_, other_columns);
+  ASSERT_TRUE(table_->Equals(*other, opts));
+  ASSERT_TRUE(other->Equals(*table_, opts));
+
+  // Differing values in the last column
+  other_columns.back() =
+      std::make_shared<ChunkedArray>(MakeRandomArray<Int16Array>(length));
+  other = Table::Make(schema_, other_columns);
+  ASSERT_FALSE(table_->Equals(*other, opts));
+}
+
 TEST_F(TestTable, FromRecordBatches) {
   const int64_t length = 10;
   MakeExample1(length);
@@ -320,6 +445,16 @@ TEST_F(TestTable, FromRecordBatches) {
   expected = Table::Make(schema_, other_columns);
   ASSERT_TRUE(result->Equals(*expected));
 
+  // Equal schemas in different instances
+  auto batch1_copy = RecordBatch::Make(
+      ::arrow::schema(schema_->fields(), schema_->metadata()), length, arrays_);
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK(Table::FromRecordBatches(schema_, {batch1, batch1_copy}, use_threads,
+                                       &result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_TRUE(result->Equals(*expected));
+  }
+
   // Error states
   std::vector<std::shared_ptr<RecordBatch>> empty_batches;
   ASSERT_RAISES(Invalid, Table::FromRecordBatches(empty_batches, &result));
@@ -329,6 +464,8 @@ TEST_F(TestTable, FromRecordBatches) {
   std::vector<std::shared_ptr<Array>> other_arrays = {arrays_[0], arrays_[1]};
   auto batch2 = RecordBatch::Make(other_schema, length, other_arrays);
   ASSERT_RAISES(Invalid, Table::FromRecordBatches({batch1, batch2}, &result));
+  ASSERT_RAISES(Invalid,
+                Table::FromRecordBatches({batch1, batch1_copy, batch2}, &result));
 }
 
 TEST_F(TestTable, FromRecordBatchesZeroLength) {
@@ -368,15 +505,88 @@ TEST_F(TestTable, CombineChunks) {
     ASSERT_EQ(2, table->column(i)->num_chunks());
   }
 
-  std::shared_ptr<Table> compacted;
-  ASSERT_OK(table->CombineChunks(default_memory_pool(), &compacted));
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Table> compacted;
+    ASSERT_OK(table->CombineChunks(default_memory_pool(), use_threads, &compacted));
 
-  EXPECT_TRUE(compacted->Equals(*table));
-  for (int i = 0; i < compacted->num_columns(); ++i) {
-    EXPECT_EQ(1, compacted->column(i)->num_chunks());
+    EXPECT_TRUE(compacted->Equals(*table));
+    for (int i = 0; i < compacted->num_columns(); ++i) {
+      EXPECT_EQ(1, compacted->column(i)->num_chunks());
+    }
   }
 }
 
+TEST_F(TestTable, Flatten) {
+  auto type_s = struct_({field("a", int32()), field("b", utf8())});
+  auto type_t = struct_({field("c", float64())});
+  auto schema =
+      ::arrow::schema({field("s", type_s), field("x", int64()), field("t", type_t)},
+                      key_value_metadata({"k"}, {"v"}));
+  auto table = Table::Make(
+      schema,
+      {ChunkedArrayFromJSON(type_s, {R"([{"a": 1, "b": "x"}, null])",
+                                     R"([{"a": null, "b": "y"}])"}),
+       ChunkedArrayFromJSON(int64(), {"[1, 2]", "[3]"}),
+       ChunkedArrayFromJSON(type_t, {R"([{"c": 1.5}, {"c": null}])", R"([null])"})});
+
+  auto expected_schema = ::arrow::schema(
+      {field("s.a", int32()), field("s.b", utf8()), field("x", int64()),
+       field("t.c", float64())},
+      key_value_metadata({"k"}, {"v"}));
+  auto expected = Table::Make(
+      expected_schema, {ChunkedArrayFromJSON(int32(), {"[1, null]", "[null]"}),
+                        ChunkedArrayFromJSON(utf8(), {R"(["x", null])", R"(["y"])"}),
+                        ChunkedArrayFromJSON(int64(), {"[1, 2]", "[3]"}),
+                        ChunkedArrayFromJSON(float64(), {"[1.5, null]", "[null]"})});
+
+  std::shared_ptr<Table> flattened;
+  ASSERT_OK(table->Flatten(default_memory_pool(), &flattened));
+  ASSERT_OK(flattened->ValidateFull());
+  AssertTablesEqual(*expected, *flattened);
+  ASSERT_TRUE(flattened->schema()->Equals(*expected_schema, /*check_metadata=*/true));
+
+  ASSERT_OK(table->Flatten(default_memory_pool(), /*use_threads=*/true, &flattened));
+  ASSERT_OK(flattened->ValidateFull());
+  AssertTablesEqual(*expected, *flattened);
+}
+
+TEST_F(TestTable, CoalesceChunks) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int length : {10, 10, 10, 100, 0, 5, 5}) {
+    MakeExample1(length);
+    batches.push_back(RecordBatch::Make(schema_, length, arrays_));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+
+  std::shared_ptr<Table> coalesced;
+  ASSERT_OK(table->CoalesceChunks(CoalesceOptions(/*target_rows=*/25, 0),
+                                  default_memory_pool(), &coalesced));
+  ASSERT_OK(coalesced->ValidateFull());
+  EXPECT_TRUE(coalesced->Equals(*table));
+  for (int i = 0; i < coalesced->num_columns(); ++i) {
+    const auto& column = *coalesced->column(i);
+    ASSERT_EQ(4, column.num_chunks());
+    EXPECT_EQ(20, column.chunk(0)->length());
+    EXPECT_EQ(10, column.chunk(1)->length());
+    EXPECT_EQ(100, column.chunk(2)->length());
+    EXPECT_EQ(10, column.chunk(3)->length());
+    // The large chunk is kept without copy
+    EXPECT_EQ(batches[3]->column_data(i), column.chunk(2)->data());
+  }
+
+  // A byte target of one row of each column
+  const int64_t row_bytes = sizeof(int32_t) + sizeof(uint8_t) + sizeof(int16_t);
+  ASSERT_OK(table->CoalesceChunks(CoalesceOptions(0, /*target_bytes=*/1),
+                                  default_memory_pool(), &coalesced));
+  EXPECT_TRUE(coalesced->Equals(*table));
+  ASSERT_EQ(6, coalesced->column(0)->num_chunks());
+  ASSERT_OK(table->CoalesceChunks(CoalesceOptions(0, 1000 * row_bytes),
+                                  default_memory_pool(), &coalesced));
+  EXPECT_TRUE(coalesced->Equals(*table));
+  ASSERT_EQ(1, coalesced->column(0)->num_chunks());
+}
+
 TEST_F(TestTable, ConcatenateTables) {
   const int64_t length = 10;
 
@@ -27,11 +27,18 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -274,4 +281,176 @@ Status Tensor::CountNonZero(int64_t* result) const {
   return VisitTypeInline(*type(), &counter);
 }
 
+// ----------------------------------------------------------------------
+// Conversion of record batches and tables to tensors
+
+namespace {
+
+// Tensors with fewer elements than this are filled on the calling thread.
+constexpr int64_t kParallelFillThreshold = 1 << 16;
+
+class ColumnsToTensorConverter {
+ public:
+  ColumnsToTensorConverter(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                           int64_t num_rows, const TensorConversionOptions& options,
+                           MemoryPool* pool)
+      : columns_(columns), num_rows_(num_rows), options_(options), pool_(pool) {}
+
+  Result<std::shared_ptr<Tensor>> Convert() {
+    if (columns_.empty()) {
+      return Status::Invalid("Cannot convert zero columns to a Tensor");
+    }
+    type_ = columns_[0]->type();
+    bool has_nulls = false;
+    for (const auto& column : columns_) {
+      if (!column->type()->Equals(*type_)) {
+        return Status::TypeError("Cannot convert columns of different types ",
+                                 type_->ToString(), " and ", column->type()->ToString(),
+                                 " to a Tensor");
+      }
+      has_nulls |= column->null_count() > 0;
+    }
+    if (!is_tensor_supported(type_->id())) {
+      return Status::TypeError("Cannot convert columns of type ", type_->ToString(),
+                               " to a Tensor");
+    }
+    if (has_nulls && !options_.fill_nulls) {
+      return Status::Invalid("Cannot convert columns with nulls to a Tensor ",
+                             "unless fill_nulls is set");
+    }
+    if (has_nulls && type_->id() == Type::HALF_FLOAT) {
+      return Status::NotImplemented("Filling nulls of half_float columns");
+    }
+
+    const int64_t num_columns = static_cast<int64_t>(columns_.size());
+    const int64_t elsize = checked_cast<const FixedWidthType&>(*type_).bit_width() / 8;
+    const std::vector<int64_t> shape = {num_rows_, num_columns};
+    std::vector<int64_t> strides;
+    if (options_.row_major) {
+      strides = {elsize * num_columns, elsize};
+    } else {
+      strides = {elsize, elsize * num_rows_};
+    }
+
+    // The values buffer of a single column is already laid out as the tensor
+    if (num_columns == 1 && !has_nulls && columns_[0]->num_chunks() == 1) {
+      const ArrayData& data = *columns_[0]->chunk(0)->data();
+      auto buffer =
+          SliceBuffer(data.buffers[1], data.offset * elsize, num_rows_ * elsize);
+      return std::make_shared<Tensor>(type_, std::move(buffer), shape, strides);
+    }
+
+    RETURN_NOT_OK(AllocateBuffer(pool_, num_rows_ * num_columns * elsize, &buffer_));
+    RETURN_NOT_OK(VisitTypeInline(*type_, this));
+    return std::make_shared<Tensor>(type_, buffer_, shape, strides);
+  }
+
+  template <typename TYPE>
+  enable_if_number<TYPE, Status> Visit(const TYPE&) {
+    using c_type = typename TYPE::c_type;
+    const auto fill_value = static_cast<c_type>(options_.null_fill_value);
+    auto* out = reinterpret_cast<c_type*>(buffer_->mutable_data());
+    const int num_columns = static_cast<int>(columns_.size());
+    const bool large = num_rows_ * num_columns >= kParallelFillThreshold;
+
+    if (!options_.row_major) {
+      // Each column is a contiguous part of the output
+      return ::arrow::internal::OptionalParallelFor(
+          options_.use_threads && large, num_columns, [&](int j) {
+            CopyRows(*columns_[j], 0, num_rows_, fill_value, out + j * num_rows_, 1);
+            return Status::OK();
+          });
+    }
+
+    // Each range of rows is a contiguous part of the output
+    int num_tasks = 1;
+    if (options_.use_threads && large) {
+      num_tasks = static_cast<int>(
+          std::min<int64_t>(num_rows_, GetCpuThreadPoolCapacity()));
+    }
+    return ::arrow::internal::OptionalParallelFor(
+        num_tasks > 1, num_tasks, [&](int task) {
+          const int64_t begin = num_rows_ * task / num_tasks;
+          const int64_t end = num_rows_ * (task + 1) / num_tasks;
+          for (int j = 0; j < num_columns; ++j) {
+            CopyRows(*columns_[j], begin, end, fill_value, out + begin * num_columns + j,
+                     num_columns);
+          }
+          return Status::OK();
+        });
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Tensor of ", type.ToString(), " is not implemented");
+  }
+
+ private:
+  // Copy the rows [begin, end) of a column to `out`, spacing them by `out_stride`
+  // elements
+  template <typename c_type>
+  static void CopyRows(const ChunkedArray& column, int64_t begin, int64_t end,
+                       c_type fill_value, c_type* out, int64_t out_stride) {
+    int64_t chunk_start = 0;
+    for (const auto& chunk : column.chunks()) {
+      const int64_t chunk_end = chunk_start + chunk->length();
+      const int64_t start = std::max(begin, chunk_start);
+      const int64_t stop = std::min(end, chunk_end);
+      if (start < stop) {
+        const ArrayData& data = *chunk->data();
+        const int64_t offset = data.offset + start - chunk_start;
+        const c_type* values = data.GetValues<c_type>(1, 0) + offset;
+        const int64_t length = stop - start;
+        if (out_stride == 1) {
+          std::copy(values, values + length, out);
+        } else {
+          for (int64_t i = 0; i < length; ++i) {
+            out[i * out_stride] = values[i];
+          }
+        }
+        if (data.GetNullCount() > 0) {
+          const uint8_t* null_bitmap = data.buffers[0]->data();
+          for (int64_t i = 0; i < length; ++i) {
+            if (!BitUtil::GetBit(null_bitmap, offset + i)) {
+              out[i * out_stride] = fill_value;
+            }
+          }
+        }
+        out += length * out_stride;
+      }
+      chunk_start = chunk_end;
+      if (chunk_start >= end) {
+        break;
+      }
+    }
+  }
+
+  const std::vector<std::shared_ptr<ChunkedArray>>& columns_;
+  const int64_t num_rows_;
+  const TensorConversionOptions& options_;
+  MemoryPool* pool_;
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> RecordBatchToTensor(
+    const RecordBatch& batch, const TensorConversionOptions& options, MemoryPool* pool) {
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back(std::make_shared<ChunkedArray>(ArrayVector{batch.column(i)}));
+  }
+  return ColumnsToTensorConverter(columns, batch.num_rows(), options, pool).Convert();
+}
+
+Result<std::shared_ptr<Tensor>> TableToTensor(const Table& table,
+                                              const TensorConversionOptions& options,
+                                              MemoryPool* pool) {
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < table.num_columns(); ++i) {
+    columns.push_back(table.column(i));
+  }
+  return ColumnsToTensorConverter(columns, table.num_rows(), options, pool).Convert();
+}
+
 }  // namespace arrow
@@ -24,6 +24,8 @@
 #include <vector>
 
 #include "arrow/compare.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
@@ -227,6 +229,48 @@ class NumericTensor : public Tensor {
   }
 };
 
+/// \brief Options for converting the columns of a RecordBatch or a Table to a Tensor
+struct ARROW_EXPORT TensorConversionOptions {
+  /// Whether the elements of a row, rather than of a column, are contiguous
+  bool row_major = true;
+  /// Whether null values are replaced with null_fill_value. Otherwise
+  /// converting a column with nulls is an error.
+  bool fill_nulls = false;
+  /// The value replacing nulls, converted to the type of the columns
+  double null_fill_value = 0;
+  /// Whether the tensor may be filled on the CPU thread pool
+  bool use_threads = true;
+
+  static TensorConversionOptions Defaults() { return TensorConversionOptions(); }
+};
+
+/// \brief Convert a record batch to a two-dimensional Tensor of shape
+/// {num_rows, num_columns}
+///
+/// All the columns must have the same numeric type. A single column without
+/// nulls is converted without copy. Otherwise the columns are copied to a new
+/// buffer, in parallel if options.use_threads is true.
+///
+/// \param[in] batch The record batch to convert
+/// \param[in] options The layout of the tensor and the handling of nulls
+/// \param[in] pool The pool for the tensor buffer
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> RecordBatchToTensor(
+    const RecordBatch& batch,
+    const TensorConversionOptions& options = TensorConversionOptions::Defaults(),
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief Convert a table to a two-dimensional Tensor of shape
+/// {num_rows, num_columns}
+///
+/// Like RecordBatchToTensor, a single column in a single chunk without nulls is
+/// converted without copy.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> TableToTensor(
+    const Table& table,
+    const TensorConversionOptions& options = TensorConversionOptions::Defaults(),
+    MemoryPool* pool = default_memory_pool());
+
 }  // namespace arrow
 
 #endif  // ARROW_TENSOR_H
@@ -20,12 +20,16 @@
 #include <cmath>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -611,4 +615,92 @@ TEST(TestNumericTensor, ElementAccessWithNonContiguousStrides) {
   ASSERT_EQ(11.1f, t_f32.Value({2, 2}));
 }
 
+TEST(TestRecordBatchToTensor, SingleColumnZeroCopy) {
+  std::shared_ptr<Array> column;
+  ArrayFromVector<DoubleType>({1.5, 2.5, 3.5, 4.5}, &column);
+  column = column->Slice(1);
+  auto batch = RecordBatch::Make(schema({field("a", float64())}), 3, {column});
+
+  for (bool row_major : {true, false}) {
+    TensorConversionOptions options;
+    options.row_major = row_major;
+    ASSERT_OK_AND_ASSIGN(auto tensor, RecordBatchToTensor(*batch, options));
+    ASSERT_EQ(std::vector<int64_t>({3, 1}), tensor->shape());
+    ASSERT_EQ(row_major, tensor->is_row_major());
+    ASSERT_EQ(!row_major, tensor->is_column_major());
+    ASSERT_EQ(column->data()->buffers[1]->data() + sizeof(double), tensor->raw_data());
+    ASSERT_EQ(2.5, tensor->Value<DoubleType>({0, 0}));
+    ASSERT_EQ(4.5, tensor->Value<DoubleType>({2, 0}));
+  }
+}
+
+TEST(TestRecordBatchToTensor, ManyColumns) {
+  std::shared_ptr<Array> a, b, c;
+  ArrayFromVector<Int32Type>({1, 2, 3}, &a);
+  ArrayFromVector<Int32Type>({true, false, true}, {4, 5, 6}, &b);
+  ArrayFromVector<Int32Type>({7, 8, 9}, &c);
+  auto batch = RecordBatch::Make(
+      schema({field("a", int32()), field("b", int32()), field("c", int32())}), 3,
+      {a, b, c});
+
+  // Nulls must be filled
+  ASSERT_RAISES(Invalid, RecordBatchToTensor(*batch));
+
+  TensorConversionOptions options;
+  options.fill_nulls = true;
+  options.null_fill_value = -1;
+  ASSERT_OK_AND_ASSIGN(auto tensor, RecordBatchToTensor(*batch, options));
+  std::vector<int32_t> row_major = {1, 4, 7, 2, -1, 8, 3, 6, 9};
+  NumericTensor<Int32Type> expected_row_major(Buffer::Wrap(row_major), {3, 3});
+  ASSERT_TRUE(tensor->is_row_major());
+  ASSERT_TRUE(tensor->Equals(expected_row_major));
+
+  options.row_major = false;
+  ASSERT_OK_AND_ASSIGN(tensor, RecordBatchToTensor(*batch, options));
+  std::vector<int32_t> column_major = {1, 2, 3, 4, -1, 6, 7, 8, 9};
+  NumericTensor<Int32Type> expected_column_major(Buffer::Wrap(column_major), {3, 3},
+                                                 {4, 12});
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_TRUE(tensor->Equals(expected_column_major));
+
+  // Columns must have the same numeric type
+  std::shared_ptr<Array> d;
+  ArrayFromVector<Int64Type>({1, 2, 3}, &d);
+  ASSERT_OK(batch->AddColumn(3, field("d", int64()), d, &batch));
+  ASSERT_RAISES(TypeError, RecordBatchToTensor(*batch));
+}
+
+TEST(TestTableToTensor, ChunkedColumns) {
+  // Large enough to be filled in parallel, with chunks of different sizes
+  const int64_t num_rows = 50000;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int j = 0; j < 3; ++j) {
+    ArrayVector chunks;
+    int64_t start = 0;
+    for (int64_t chunk_length : {1000 * (j + 1), 20000, 30000 - 1000 * (j + 1)}) {
+      std::vector<int64_t> values(chunk_length);
+      std::iota(values.begin(), values.end(), start + j * num_rows);
+      std::shared_ptr<Array> chunk;
+      ArrayFromVector<Int64Type>(values, &chunk);
+      chunks.push_back(chunk);
+      start += chunk_length;
+    }
+    columns.push_back(std::make_shared<ChunkedArray>(chunks));
+  }
+  auto table = Table::Make(
+      schema({field("a", int64()), field("b", int64()), field("c", int64())}), columns);
+
+  for (bool row_major : {true, false}) {
+    TensorConversionOptions options;
+    options.row_major = row_major;
+    ASSERT_OK_AND_ASSIGN(auto tensor, TableToTensor(*table, options));
+    ASSERT_EQ(std::vector<int64_t>({num_rows, 3}), tensor->shape());
+    for (int64_t i : {0, 999, 1000, 1999, 2000, 25000, 49999}) {
+      for (int64_t j = 0; j < 3; ++j) {
+        ASSERT_EQ(i + j * num_rows, tensor->Value<Int64Type>({i, j}));
+      }
+    }
+  }
+}
+
 }  // namespace arrow
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/testing/extension_type.h"
+
+#include <memory>
+#include <string>
+
+#include "arrow/array.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+SmallintType::SmallintType() : ExtensionType(int16()) {}
+
+bool SmallintType::ExtensionEquals(const ExtensionType& other) const {
+  return other.extension_name() == extension_name();
+}
+
+std::shared_ptr<Array> SmallintType::MakeArray(std::shared_ptr<ArrayData> data) const {
+  return std::make_shared<ExtensionArray>(data);
+}
+
+Status SmallintType::Deserialize(std::shared_ptr<DataType> storage_type,
+                                 const std::string& serialized,
+                                 std::shared_ptr<DataType>* out) const {
+  if (serialized != "smallint") {
+    return Status::Invalid("Type identifier did not match");
+  }
+  if (!storage_type->Equals(*int16())) {
+    return Status::Invalid("Invalid storage type for SmallintType: ",
+                           storage_type->ToString());
+  }
+  *out = std::make_shared<SmallintType>();
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> smallint() { return std::make_shared<SmallintType>(); }
+
+std::shared_ptr<Array> WrapExtensionArray(const std::shared_ptr<DataType>& type,
+                                          const std::shared_ptr<Array>& storage) {
+  auto data = storage->data()->Copy();
+  data->type = type;
+  return MakeArray(data);
+}
+
+std::shared_ptr<Array> ExtensionArrayFromJSON(const std::shared_ptr<DataType>& type,
+                                              const std::string& json) {
+  const auto& ext_type = checked_cast<const ExtensionType&>(*type);
+  return WrapExtensionArray(type, ArrayFromJSON(ext_type.storage_type(), json));
+}
+
+}  // namespace arrow
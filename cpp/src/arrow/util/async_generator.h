@@ -0,0 +1,400 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+/// \brief An asynchronous sequence of values
+///
+/// Each call returns a future of the next value, IterationTraits<T>::End()
+/// after the last one.  A generator must not be called again before the
+/// future it returned finished, unless it is documented as reentrant, and it
+/// keeps returning the end (or the error) after the end (or an error).
+///
+/// Unlike the pull-based Iterator<T>, no thread waits for the values: the
+/// stages of a pipeline of generators run as callbacks where the values are
+/// produced.
+template <typename T>
+using AsyncGenerator = std::function<Future<T>()>;
+
+template <typename T>
+bool IsIterationEnd(const T& value) {
+  return value == IterationTraits<T>::End();
+}
+
+/// \brief A generator of no value
+template <typename T>
+AsyncGenerator<T> MakeEmptyGenerator() {
+  return []() { return Future<T>::MakeFinished(IterationTraits<T>::End()); };
+}
+
+/// \brief A generator of the values of a vector, which is reentrant
+template <typename T>
+AsyncGenerator<T> MakeVectorGenerator(std::vector<T> values) {
+  struct State {
+    std::mutex mutex;
+    std::vector<T> values;
+    size_t index = 0;
+  };
+  auto state = std::make_shared<State>();
+  state->values = std::move(values);
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->index == state->values.size()) {
+      return Future<T>::MakeFinished(IterationTraits<T>::End());
+    }
+    return Future<T>::MakeFinished(std::move(state->values[state->index++]));
+  };
+}
+
+/// \brief A generator of the values of another, transformed by a function
+///
+/// `map(const T&)` may return a value, a Result or a Future of the mapped
+/// type.  It runs where the values of `source` are produced, and isn't called
+/// on the end, which is mapped to the end.  The generator is reentrant if
+/// `source` is.
+template <typename T, typename MapFn,
+          typename Mapped = typename detail::EnsureFuture<
+              typename std::result_of<MapFn && (const T&)>::type>::type::ValueType>
+AsyncGenerator<Mapped> MakeMappedGenerator(AsyncGenerator<T> source, MapFn map) {
+  auto shared_map = std::make_shared<MapFn>(std::move(map));
+  return [source, shared_map]() {
+    return source().Then([shared_map](const T& value) -> Future<Mapped> {
+      if (IsIterationEnd(value)) {
+        return Future<Mapped>::MakeFinished(IterationTraits<Mapped>::End());
+      }
+      // Wrap the mapped value, whatever its kind, in a future
+      return Future<T>::MakeFinished(value).Then(*shared_map);
+    });
+  };
+}
+
+/// \brief A generator which requests up to `max_readahead` values of
+/// another ahead of its consumer
+///
+/// `source` must be reentrant: the values are requested concurrently.  They
+/// are returned in the order of `source`.
+template <typename T>
+AsyncGenerator<T> MakeReadaheadGenerator(AsyncGenerator<T> source, int max_readahead) {
+  struct State : std::enable_shared_from_this<State> {
+    AsyncGenerator<T> source;
+    int max_readahead;
+    std::deque<Future<T>> queue;
+    // Set once the source returned the end or an error, after which no more
+    // values are requested
+    std::atomic<bool> finished{false};
+
+    void Request() {
+      auto future = source();
+      std::weak_ptr<State> weak_self = this->shared_from_this();
+      future.AddCallback([weak_self](const Result<T>& result) {
+        auto self = weak_self.lock();
+        if (self && (!result.ok() || IsIterationEnd(*result))) {
+          self->finished = true;
+        }
+      });
+      queue.push_back(std::move(future));
+    }
+  };
+  auto state = std::make_shared<State>();
+  state->source = std::move(source);
+  state->max_readahead = std::max(max_readahead, 1);
+  return [state]() {
+    if (state->queue.empty()) {
+      if (state->finished) {
+        return Future<T>::MakeFinished(IterationTraits<T>::End());
+      }
+      for (int i = 0; i < state->max_readahead && !state->finished; ++i) {
+        state->Request();
+      }
+    } else if (!state->finished) {
+      state->Request();
+    }
+    auto next = std::move(state->queue.front());
+    state->queue.pop_front();
+    return next;
+  };
+}
+
+/// \brief A generator of the values of an iterator, read by tasks on an
+/// executor
+///
+/// A task reads values while calls wait for them, and ends when none does,
+/// so no thread of the executor is dedicated to the iterator.  The generator
+/// is reentrant: the values are read in the order of the calls.
+template <typename T>
+AsyncGenerator<T> MakeBackgroundGenerator(Iterator<T> iterator,
+                                          internal::ThreadPool* executor) {
+  struct State {
+    std::mutex mutex;
+    Iterator<T> iterator;
+    // The futures of the calls, in order, whose values aren't read yet
+    std::deque<Future<T>> pending;
+    // Whether a task is reading the values of the pending futures
+    bool reading = false;
+
+    void Read() {
+      while (true) {
+        Future<T> next;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (pending.empty()) {
+            reading = false;
+            return;
+          }
+          next = std::move(pending.front());
+          pending.pop_front();
+        }
+        // Only this task reads, so the values are in the order of the calls
+        next.MarkFinished(iterator.Next());
+      }
+    }
+  };
+  auto state = std::make_shared<State>();
+  state->iterator = std::move(iterator);
+  return [state, executor]() {
+    auto future = Future<T>::Make();
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->pending.push_back(future);
+      if (state->reading) {
+        return future;
+      }
+      state->reading = true;
+    }
+    Status st = executor->Spawn([state]() { state->Read(); });
+    if (!st.ok()) {
+      // No task reads the futures of this call and of the calls since
+      std::deque<Future<T>> failed;
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        failed.swap(state->pending);
+        state->reading = false;
+      }
+      for (auto& failed_future : failed) {
+        failed_future.MarkFinished(st);
+      }
+    }
+    return future;
+  };
+}
+
+/// \brief A generator whose futures finish on an executor
+///
+/// The callbacks of the values of `source`, and so the following stages of
+/// a pipeline, then run on the executor instead of where the values are
+/// produced, e.g. so that CPU-bound stages don't run on I/O threads.  Buffer
+/// the transfer with MakeReadaheadGenerator.  The generator is reentrant if
+/// `source` is.
+template <typename T>
+AsyncGenerator<T> MakeTransferredGenerator(AsyncGenerator<T> source,
+                                           internal::ThreadPool* executor) {
+  return [source, executor]() {
+    auto transferred = Future<T>::Make();
+    source().AddCallback([transferred, executor](const Result<T>& result) mutable {
+      Status st = executor->Spawn(
+          [transferred, result]() mutable { transferred.MarkFinished(result); });
+      if (!st.ok()) {
+        transferred.MarkFinished(std::move(st));
+      }
+    });
+    return transferred;
+  };
+}
+
+/// \brief A generator of the values of several generators, in the order in
+/// which they are produced
+///
+/// Each source has at most one value requested ahead of the consumer.  An
+/// error of a source is returned as a value, after which that source isn't
+/// called anymore.  The end is returned once all sources ended.
+template <typename T>
+AsyncGenerator<T> MakeMergedGenerator(std::vector<AsyncGenerator<T>> sources) {
+  struct State : std::enable_shared_from_this<State> {
+    std::mutex mutex;
+    std::vector<AsyncGenerator<T>> sources;
+    size_t num_active;
+    // The produced values not yet consumed, with the index of their source
+    std::deque<std::pair<Result<T>, size_t>> ready;
+    // The futures returned to the consumer which wait for a value
+    std::deque<Future<T>> waiting;
+    bool started = false;
+
+    void Request(size_t index) {
+      auto self = this->shared_from_this();
+      sources[index]().AddCallback(
+          [self, index](const Result<T>& result) { self->OnValue(result, index); });
+    }
+
+    void OnValue(const Result<T>& result, size_t index) {
+      const bool source_ended = !result.ok() || IsIterationEnd(*result);
+      std::vector<Future<T>> ended;
+      Future<T> consumer;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (source_ended) {
+          --num_active;
+        }
+        if (result.ok() && IsIterationEnd(*result)) {
+          // Nothing to deliver
+        } else if (!waiting.empty()) {
+          consumer = std::move(waiting.front());
+          waiting.pop_front();
+        } else {
+          ready.emplace_back(result, index);
+        }
+        if (num_active == 0 && ready.empty()) {
+          ended.assign(waiting.begin(), waiting.end());
+          waiting.clear();
+        }
+      }
+      if (consumer.is_valid()) {
+        consumer.MarkFinished(result);
+        if (!source_ended) {
+          Request(index);
+        }
+      }
+      for (auto& future : ended) {
+        future.MarkFinished(IterationTraits<T>::End());
+      }
+    }
+
+    Future<T> Next() {
+      if (!started) {
+        started = true;
+        for (size_t i = 0; i < sources.size(); ++i) {
+          Request(i);
+        }
+      }
+      std::unique_lock<std::mutex> lock(mutex);
+      if (!ready.empty()) {
+        auto value = std::move(ready.front());
+        ready.pop_front();
+        lock.unlock();
+        if (value.first.ok()) {
+          Request(value.second);
+        }
+        return Future<T>::MakeFinished(std::move(value.first));
+      }
+      if (num_active == 0) {
+        return Future<T>::MakeFinished(IterationTraits<T>::End());
+      }
+      auto future = Future<T>::Make();
+      waiting.push_back(future);
+      return future;
+    }
+  };
+  auto state = std::make_shared<State>();
+  state->sources = std::move(sources);
+  state->num_active = state->sources.size();
+  return [state]() { return state->Next(); };
+}
+
+/// \brief Call a visitor on each value of a generator, returning a future
+/// which finishes after the last one
+///
+/// Values produced synchronously are visited in a loop rather than by
+/// nested callbacks, so that long synchronous sequences don't overflow the
+/// stack.
+template <typename T>
+Future<> VisitAsyncGenerator(AsyncGenerator<T> generator,
+                             std::function<Status(T)> visitor) {
+  struct State : std::enable_shared_from_this<State> {
+    AsyncGenerator<T> generator;
+    std::function<Status(T)> visitor;
+    Future<> done = Future<>::Make();
+
+    // Visit a value, returning whether to continue
+    bool Visit(const Result<T>& result) {
+      if (!result.ok()) {
+        done.MarkFinished(result.status());
+        return false;
+      }
+      if (IsIterationEnd(*result)) {
+        done.MarkFinished();
+        return false;
+      }
+      Status st = visitor(*result);
+      if (!st.ok()) {
+        done.MarkFinished(std::move(st));
+        return false;
+      }
+      return true;
+    }
+
+    void Loop() {
+      while (true) {
+        auto next = generator();
+        if (!next.is_finished()) {
+          auto self = this->shared_from_this();
+          next.AddCallback([self](const Result<T>& result) {
+            if (self->Visit(result)) {
+              self->Loop();
+            }
+          });
+          return;
+        }
+        if (!Visit(next.result())) {
+          return;
+        }
+      }
+    }
+  };
+  auto state = std::make_shared<State>();
+  state->generator = std::move(generator);
+  state->visitor = std::move(visitor);
+  state->Loop();
+  return state->done;
+}
+
+/// \brief Collect the values of a generator into a vector
+template <typename T>
+Future<std::vector<T>> CollectAsyncGenerator(AsyncGenerator<T> generator) {
+  auto values = std::make_shared<std::vector<T>>();
+  auto done = VisitAsyncGenerator<T>(std::move(generator), [values](T value) {
+    values->push_back(std::move(value));
+    return Status::OK();
+  });
+  return done.Then([values](const Empty&) { return std::move(*values); });
+}
+
+/// \brief An iterator over the values of a generator, which waits for each
+/// of them
+template <typename T>
+Iterator<T> MakeGeneratorIterator(AsyncGenerator<T> generator) {
+  return MakeFunctionIterator(
+      [generator]() -> Result<T> { return generator().result(); });
+}
+
+}  // namespace arrow
@@ -232,7 +232,28 @@ BasicDecimal128& BasicDecimal128::operator>>=(uint32_t bits) {
   return *this;
 }
 
+#ifdef __SIZEOF_INT128__
+// Where the compiler has a 128-bit integer type, multiplications and divisions
+// are done with it rather than in 32-bit words
+using uint128_t = unsigned __int128;
+
+static inline uint128_t ToUInt128(const BasicDecimal128& value) {
+  return static_cast<uint128_t>(static_cast<uint64_t>(value.high_bits())) << 64 |
+         value.low_bits();
+}
+
+static inline BasicDecimal128 FromUInt128(uint128_t value) {
+  return BasicDecimal128(static_cast<int64_t>(static_cast<uint64_t>(value >> 64)),
+                         static_cast<uint64_t>(value));
+}
+#endif
+
 BasicDecimal128& BasicDecimal128::operator*=(const BasicDecimal128& right) {
+#ifdef __SIZEOF_INT128__
+  // Unsigned, the product truncated to 128 bits is the same
+  *this = FromUInt128(ToUInt128(*this) * ToUInt128(right));
+  return *this;
+#else
   // Break the left and right numbers into 32 bit chunks
   // so that we can multiply them without overflow.
   const uint64_t L0 = static_cast<uint64_t>(high_bits_) >> 32;
@@ -267,6 +288,7 @@ BasicDecimal128& BasicDecimal128::operator*=(const BasicDecimal128& right) {
   high_bits_ += L1 * R3 + L2 * R2 + L3 * R1;
   high_bits_ += (L0 * R3 + L1 * R2 + L2 * R1 + L3 * R0) << 32;
   return *this;
+#endif
 }
 
 /// Expands the given value into an array of ints so that we can work on
@@ -423,9 +445,46 @@ static DecimalStatus SingleDivide(const uint32_t* dividend, int64_t dividend_len
   return DecimalStatus::kSuccess;
 }
 
+#ifdef __SIZEOF_INT128__
+/// \brief Divide the absolute values, which can't overflow (unlike the signed
+/// division of the minimum value by -1), then fix the signs.
+static DecimalStatus DivideUInt128(const BasicDecimal128& dividend,
+                                   const BasicDecimal128& divisor,
+                                   BasicDecimal128* result, BasicDecimal128* remainder) {
+  const bool dividend_was_negative = dividend.high_bits() < 0;
+  const bool divisor_was_negative = divisor.high_bits() < 0;
+  uint128_t dividend_abs = ToUInt128(dividend);
+  uint128_t divisor_abs = ToUInt128(divisor);
+  if (dividend_was_negative) {
+    dividend_abs = ~dividend_abs + 1;
+  }
+  if (divisor_was_negative) {
+    divisor_abs = ~divisor_abs + 1;
+  }
+  if (divisor_abs == 0) {
+    return DecimalStatus::kDivideByZero;
+  }
+  if ((dividend_abs >> 64) == 0 && (divisor_abs >> 64) == 0) {
+    // Single 64-bit division
+    const auto dividend64 = static_cast<uint64_t>(dividend_abs);
+    const auto divisor64 = static_cast<uint64_t>(divisor_abs);
+    *result = FromUInt128(dividend64 / divisor64);
+    *remainder = FromUInt128(dividend64 % divisor64);
+  } else {
+    *result = FromUInt128(dividend_abs / divisor_abs);
+    *remainder = FromUInt128(dividend_abs % divisor_abs);
+  }
+  FixDivisionSigns(result, remainder, dividend_was_negative, divisor_was_negative);
+  return DecimalStatus::kSuccess;
+}
+#endif
+
 DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
                                       BasicDecimal128* result,
                                       BasicDecimal128* remainder) const {
+#ifdef __SIZEOF_INT128__
+  return DivideUInt128(*this, divisor, result, remainder);
+#endif
   // Split the dividend and divisor into integer pieces so that we can
   // work on them.
   uint32_t dividend_array[5];
@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The number of bits and of set bits in a block of a bitmap
+struct BitBlockCount {
+  int16_t length;
+  int16_t popcount;
+
+  bool NoneSet() const { return popcount == 0; }
+  bool AllSet() const { return popcount == length; }
+};
+
+/// \brief Scan a bitmap at an arbitrary offset 64 bits at a time, counting
+/// the set bits of each block
+///
+/// Kernels use this to process validity bitmaps by block: all-valid blocks
+/// can run a tight loop without per-element checks, which the compiler is
+/// able to vectorize, and all-null blocks can be skipped.
+class BitBlockCounter {
+ public:
+  static constexpr int16_t kWordBits = 64;
+
+  BitBlockCounter(const uint8_t* bitmap, int64_t start_offset, int64_t length)
+      : bitmap_(bitmap), offset_(start_offset), bits_remaining_(length) {}
+
+  /// \brief Return the next block of up to 64 bits, of zero length once the
+  /// bitmap is exhausted
+  BitBlockCount NextWord() {
+    const auto length =
+        static_cast<int16_t>(std::min<int64_t>(bits_remaining_, kWordBits));
+    if (length == 0) {
+      return {0, 0};
+    }
+    const uint64_t word = LoadBitmapWord(bitmap_, offset_, length);
+    offset_ += length;
+    bits_remaining_ -= length;
+    return {length, static_cast<int16_t>(std::bitset<kWordBits>(word).count())};
+  }
+
+ private:
+  const uint8_t* bitmap_;
+  int64_t offset_;
+  int64_t bits_remaining_;
+};
+
+/// \brief Like BitBlockCounter, for an optional validity bitmap
+///
+/// A null bitmap is all set and is returned in the longest possible blocks.
+class OptionalBitBlockCounter {
+ public:
+  OptionalBitBlockCounter(const uint8_t* validity_bitmap, int64_t offset,
+                          int64_t length)
+      : has_bitmap_(validity_bitmap != NULLPTR),
+        bits_remaining_(length),
+        counter_(validity_bitmap, offset, length) {}
+
+  /// \brief Return the next block, of zero length once the bitmap is
+  /// exhausted
+  BitBlockCount NextBlock() {
+    if (has_bitmap_) {
+      const BitBlockCount block = counter_.NextWord();
+      bits_remaining_ -= block.length;
+      return block;
+    }
+    const auto length = static_cast<int16_t>(
+        std::min<int64_t>(bits_remaining_, std::numeric_limits<int16_t>::max()));
+    bits_remaining_ -= length;
+    return {length, length};
+  }
+
+ private:
+  const bool has_bitmap_;
+  int64_t bits_remaining_;
+  BitBlockCounter counter_;
+};
+
+/// \brief Call visit_valid(position, length) for each run of all-valid
+/// slots and visit_mixed(position, length) for the other slots of a
+/// validity bitmap, skipping all-null blocks
+///
+/// Runs of valid slots are up to INT16_MAX long when the bitmap is null, and
+/// 64 long otherwise; mixed runs are at most 64 long. Positions are relative
+/// to offset.
+template <typename VisitValid, typename VisitMixed>
+void VisitValidityBlocks(const uint8_t* validity_bitmap, int64_t offset, int64_t length,
+                         VisitValid&& visit_valid, VisitMixed&& visit_mixed) {
+  OptionalBitBlockCounter counter(validity_bitmap, offset, length);
+  int64_t position = 0;
+  while (position < length) {
+    const BitBlockCount block = counter.NextBlock();
+    if (block.AllSet()) {
+      visit_valid(position, static_cast<int64_t>(block.length));
+    } else if (!block.NoneSet()) {
+      visit_mixed(position, static_cast<int64_t>(block.length));
+    }
+    position += block.length;
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/util.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(BitBlockCounter, Blocks) {
+  const int64_t kBufferSize = 64;
+  std::vector<uint8_t> bitmap(kBufferSize);
+  random_bytes(kBufferSize, 0, bitmap.data());
+  // An all-set and an all-unset stretch
+  BitUtil::SetBitsTo(bitmap.data(), 64, 130, true);
+  BitUtil::SetBitsTo(bitmap.data(), 256, 100, false);
+
+  for (const int64_t offset : {0, 1, 7, 8, 63, 64, 65}) {
+    const int64_t length = kBufferSize * 8 - offset - 3;
+    BitBlockCounter counter(bitmap.data(), offset, length);
+    int64_t position = 0;
+    while (true) {
+      const BitBlockCount block = counter.NextWord();
+      if (block.length == 0) {
+        break;
+      }
+      ASSERT_EQ(std::min<int64_t>(64, length - position), block.length);
+      ASSERT_EQ(CountSetBits(bitmap.data(), offset + position, block.length),
+                block.popcount);
+      position += block.length;
+    }
+    ASSERT_EQ(length, position);
+  }
+
+  BitBlockCounter counter(bitmap.data(), 64, 128);
+  ASSERT_TRUE(counter.NextWord().AllSet());
+  ASSERT_TRUE(counter.NextWord().AllSet());
+  BitBlockCounter unset_counter(bitmap.data(), 260, 64);
+  ASSERT_TRUE(unset_counter.NextWord().NoneSet());
+  ASSERT_EQ(0, unset_counter.NextWord().length);
+}
+
+TEST(OptionalBitBlockCounter, NullBitmap) {
+  const int64_t length = std::numeric_limits<int16_t>::max() + 10;
+  OptionalBitBlockCounter counter(NULLPTR, 5, length);
+  BitBlockCount block = counter.NextBlock();
+  ASSERT_EQ(std::numeric_limits<int16_t>::max(), block.length);
+  ASSERT_TRUE(block.AllSet());
+  block = counter.NextBlock();
+  ASSERT_EQ(10, block.length);
+  ASSERT_TRUE(block.AllSet());
+  ASSERT_EQ(0, counter.NextBlock().length);
+
+  const uint8_t bitmap[] = {0xFF, 0x0F};
+  OptionalBitBlockCounter with_bitmap(bitmap, 4, 8);
+  block = with_bitmap.NextBlock();
+  ASSERT_EQ(8, block.length);
+  ASSERT_TRUE(block.AllSet());
+}
+
+TEST(OptionalBitBlockCounter, VisitValidityBlocks) {
+  const int64_t kBufferSize = 32;
+  std::vector<uint8_t> bitmap(kBufferSize);
+  random_bytes(kBufferSize, 0, bitmap.data());
+  BitUtil::SetBitsTo(bitmap.data(), 0, 70, true);
+  BitUtil::SetBitsTo(bitmap.data(), 130, 70, false);
+
+  // All-valid blocks are visited as valid runs, all-null ones not at all
+  const int64_t offset = 3;
+  const int64_t length = kBufferSize * 8 - offset;
+  std::vector<int> visits(length, 0);
+  VisitValidityBlocks(
+      bitmap.data(), offset, length,
+      [&](int64_t position, int64_t run_length) {
+        for (int64_t i = position; i < position + run_length; ++i) {
+          visits[i] += 1;
+        }
+      },
+      [&](int64_t position, int64_t run_length) {
+        for (int64_t i = position; i < position + run_length; ++i) {
+          visits[i] += 2;
+        }
+      });
+  for (int64_t block_start = 0; block_start < length; block_start += 64) {
+    const int64_t block_length = std::min<int64_t>(64, length - block_start);
+    const int64_t popcount = CountSetBits(bitmap.data(), offset + block_start,
+                                          block_length);
+    const int expected = popcount == block_length ? 1 : popcount == 0 ? 0 : 2;
+    for (int64_t i = block_start; i < block_start + block_length; ++i) {
+      ASSERT_EQ(expected, visits[i]) << "at " << i;
+    }
+  }
+  ASSERT_EQ(1, visits[0]);
+  ASSERT_EQ(0, visits[128]);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -76,6 +76,9 @@ class BitWriter {
   // Writes an int zigzag encoded.
   bool PutZigZagVlqInt(int32_t v);
 
+  /// Writes a 64-bit int zigzag encoded, in up to MAX_VLQ_INT64_BYTE_LEN bytes
+  bool PutZigZagVlqInt(int64_t v);
+
   /// Get a pointer to the next aligned byte and advance the underlying buffer
   /// by num_bytes.
   /// Returns NULL if there was not enough space.
@@ -151,6 +154,12 @@ class BitReader {
   // Reads a zigzag encoded int `into` v.
   bool GetZigZagVlqInt(int32_t* v);
 
+  /// Reads a vlq encoded 64-bit int from the stream, see GetVlqInt(int32_t*)
+  bool GetVlqInt(int64_t* v);
+
+  // Reads a zigzag encoded 64-bit int `into` v.
+  bool GetZigZagVlqInt(int64_t* v);
+
   /// Returns the number of bytes left in the stream, not including the current
   /// byte (i.e., there may be an additional fraction of a byte).
   int bytes_left() {
@@ -161,6 +170,9 @@ class BitReader {
   /// Maximum byte length of a vlq encoded int
   static const int MAX_VLQ_BYTE_LEN = 5;
 
+  /// Maximum byte length of a vlq encoded 64-bit int
+  static const int MAX_VLQ_INT64_BYTE_LEN = 10;
+
  private:
   const uint8_t* buffer_;
   int max_bytes_;
@@ -410,6 +422,39 @@ inline bool BitReader::GetZigZagVlqInt(int32_t* v) {
   return true;
 }
 
+inline bool BitWriter::PutZigZagVlqInt(int64_t v) {
+  uint64_t u = (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+  bool result = true;
+  while ((u & ~static_cast<uint64_t>(0x7F)) != 0) {
+    result &= PutAligned<uint8_t>(static_cast<uint8_t>((u & 0x7F) | 0x80), 1);
+    u >>= 7;
+  }
+  result &= PutAligned<uint8_t>(static_cast<uint8_t>(u & 0x7F), 1);
+  return result;
+}
+
+inline bool BitReader::GetVlqInt(int64_t* v) {
+  uint64_t u = 0;
+  int shift = 0;
+  uint8_t byte = 0;
+  do {
+    if (ARROW_PREDICT_FALSE(shift >= 7 * MAX_VLQ_INT64_BYTE_LEN)) return false;
+    if (!GetAligned<uint8_t>(1, &byte)) return false;
+    u |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while ((byte & 0x80) != 0);
+  *v = static_cast<int64_t>(u);
+  return true;
+}
+
+inline bool BitReader::GetZigZagVlqInt(int64_t* v) {
+  int64_t u_signed;
+  if (!GetVlqInt(&u_signed)) return false;
+  uint64_t u = static_cast<uint64_t>(u_signed);
+  *v = static_cast<int64_t>((u >> 1) ^ (~(u & 1) + 1));
+  return true;
+}
+
 }  // namespace BitUtil
 }  // namespace arrow
 
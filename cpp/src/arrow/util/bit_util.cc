@@ -39,6 +39,7 @@
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
 
 namespace arrow {
 
@@ -73,16 +74,191 @@ Result<std::shared_ptr<Buffer>> BytesToBits(const std::vector<uint8_t>& bytes,
 
 namespace internal {
 
+namespace {
+
+#if defined(ARROW_HAVE_AVX2)
+// The four 64-bit words of a reader from its i-th one
+__m256i ShiftedWords(const ShiftedBitmapReader& reader, int64_t i) {
+  const uint8_t* bytes = reader.bytes() + 8 * i;
+  const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+  const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 1));
+  return _mm256_or_si256(_mm256_srl_epi64(low, _mm_cvtsi32_si128(reader.shift())),
+                         _mm256_sll_epi64(high, _mm_cvtsi32_si128(8 - reader.shift())));
+}
+#endif
+
+struct CopyOp {
+  template <typename T>
+  T operator()(T value) const {
+    return value;
+  }
+};
+
+struct InvertOp {
+  template <typename T>
+  T operator()(T value) const {
+    return static_cast<T>(~value);
+  }
+#if defined(ARROW_HAVE_AVX2)
+  __m256i operator()(__m256i value) const {
+    return _mm256_xor_si256(value, _mm256_set1_epi8(-1));
+  }
+#endif
+};
+
+struct AndOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left & right);
+  }
+#if defined(ARROW_HAVE_AVX2)
+  __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_and_si256(left, right);
+  }
+#endif
+};
+
+struct OrOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left | right);
+  }
+#if defined(ARROW_HAVE_AVX2)
+  __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_or_si256(left, right);
+  }
+#endif
+};
+
+struct XorOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left ^ right);
+  }
+#if defined(ARROW_HAVE_AVX2)
+  __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_xor_si256(left, right);
+  }
+#endif
+};
+
+template <typename Op>
+struct UnaryWordSource {
+  UnaryWordSource Seek(int64_t position) const {
+    return UnaryWordSource{input.Seek(position), op};
+  }
+  uint64_t Word(int64_t i) const { return op(input.Word(i)); }
+#if defined(ARROW_HAVE_AVX2)
+  __m256i Words(int64_t i) const { return op(ShiftedWords(input, i)); }
+#endif
+  uint64_t PartialWord(int64_t position, int64_t num_bits) const {
+    return op(input.PartialWord(position, num_bits));
+  }
+
+  ShiftedBitmapReader input;
+  Op op;
+};
+
+template <typename Op>
+struct BinaryWordSource {
+  BinaryWordSource Seek(int64_t position) const {
+    return BinaryWordSource{left.Seek(position), right.Seek(position), op};
+  }
+  uint64_t Word(int64_t i) const { return op(left.Word(i), right.Word(i)); }
+#if defined(ARROW_HAVE_AVX2)
+  __m256i Words(int64_t i) const {
+    return op(ShiftedWords(left, i), ShiftedWords(right, i));
+  }
+#endif
+  uint64_t PartialWord(int64_t position, int64_t num_bits) const {
+    return op(left.PartialWord(position, num_bits),
+              right.PartialWord(position, num_bits));
+  }
+
+  ShiftedBitmapReader left, right;
+  Op op;
+};
+
+// Write `length` bits produced by a word source at out_offset, preserving the
+// output bits outside that range. The inputs may have any bit offsets: once
+// the output is byte-aligned, words are shifted into place 64 (or, with AVX2,
+// 256) bits at a time instead of being transferred bit by bit.
+template <typename WordSource>
+void WriteShiftedWords(const WordSource& source, int64_t length, uint8_t* out,
+                       int64_t out_offset) {
+  const int64_t leading =
+      std::min(length, BitUtil::RoundUpToMultipleOf8(out_offset) - out_offset);
+  if (leading > 0) {
+    const int shift = static_cast<int>(out_offset % 8);
+    const auto mask = static_cast<uint8_t>(((1U << leading) - 1) << shift);
+    uint8_t* byte = out + out_offset / 8;
+    const auto bits = static_cast<uint8_t>(source.PartialWord(0, leading) << shift);
+    *byte = static_cast<uint8_t>((*byte & ~mask) | (bits & mask));
+  }
+  uint8_t* out_bytes = out + BitUtil::CeilDiv(out_offset, 8);
+  int64_t position = leading;
+  // The readers load one byte past each word, which stays within the inputs
+  // as long as more bits follow
+  const int64_t num_words = position < length ? (length - position - 1) / 64 : 0;
+  const WordSource words = source.Seek(position);
+  int64_t i = 0;
+#if defined(ARROW_HAVE_AVX2)
+  for (; i + 4 <= num_words; i += 4) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_bytes + 8 * i), words.Words(i));
+  }
+#endif
+  for (; i < num_words; ++i) {
+    const uint64_t word = BitUtil::ToLittleEndian(words.Word(i));
+    std::memcpy(out_bytes + 8 * i, &word, sizeof(word));
+  }
+  position += 64 * num_words;
+  out_bytes += 8 * num_words;
+  if (position < length) {
+    const int64_t num_bits = length - position;
+    const auto num_bytes = static_cast<size_t>(BitUtil::BytesForBits(num_bits));
+    const uint64_t mask = BitUtil::TrailingBits(~uint64_t(0), static_cast<int>(num_bits));
+    uint64_t existing = 0;
+    std::memcpy(&existing, out_bytes, num_bytes);
+    existing = BitUtil::FromLittleEndian(existing);
+    const uint64_t word = BitUtil::ToLittleEndian(
+        (existing & ~mask) | (source.PartialWord(position, num_bits) & mask));
+    std::memcpy(out_bytes, &word, num_bytes);
+  }
+}
+
+#if defined(ARROW_HAVE_AVX2)
+// Count the set bits of 32-byte blocks with nibble lookups (Mula et al.)
+int64_t CountSetBitsAvx2(const uint8_t* data, int64_t num_blocks) {
+  const __m256i lookup =
+      _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2,
+                       2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0f);
+  __m256i total = _mm256_setzero_si256();
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 32));
+    const __m256i low = _mm256_and_si256(block, low_mask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(block, 4), low_mask);
+    const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                           _mm256_shuffle_epi8(lookup, high));
+    total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+  }
+  return _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+         _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+}
+#endif
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
   int64_t count = 0;
 
   const auto p = BitmapWordAlign<pop_len / 8>(data, bit_offset, length);
-  for (int64_t i = bit_offset; i < bit_offset + p.leading_bits; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
+  // Less than a word each on either side of the aligned words
+  if (p.leading_bits > 0) {
+    count += __builtin_popcountll(LoadBitmapWord(data, bit_offset, p.leading_bits));
   }
 
   if (p.aligned_words > 0) {
@@ -90,18 +266,20 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
     const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(p.aligned_start);
     DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
     const uint64_t* end = u64_data + p.aligned_words;
-
-    for (auto iter = u64_data; iter < end; ++iter) {
+    auto iter = u64_data;
+#if defined(ARROW_HAVE_AVX2)
+    const int64_t num_blocks = p.aligned_words / 4;
+    count += CountSetBitsAvx2(p.aligned_start, num_blocks);
+    iter += num_blocks * 4;
+#endif
+    for (; iter < end; ++iter) {
       count += __builtin_popcountll(*iter);
     }
   }
 
-  // Account for left over bits (in theory we could fall back to smaller
-  // versions of popcount but the code complexity is likely not worth it)
-  for (int64_t i = p.trailing_bit_offset; i < bit_offset + length; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
+  if (p.trailing_bits > 0) {
+    count += __builtin_popcountll(
+        LoadBitmapWord(data, p.trailing_bit_offset, p.trailing_bits));
   }
 
   return count;
@@ -110,74 +288,40 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 template <bool invert_bits, bool restore_trailing_bits>
 void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
                     int64_t dest_offset, uint8_t* dest) {
+  if (offset % 8 != 0 || dest_offset % 8 != 0) {
+    // Shifted words never clobber the bits outside the destination range
+    using Op = typename std::conditional<invert_bits, InvertOp, CopyOp>::type;
+    WriteShiftedWords(UnaryWordSource<Op>{ShiftedBitmapReader(data, offset), Op()},
+                      length, dest, dest_offset);
+    return;
+  }
+
   int64_t byte_offset = offset / 8;
-  int64_t bit_offset = offset % 8;
-  int64_t dest_byte_offset = dest_offset / 8;
-  int64_t dest_bit_offset = dest_offset % 8;
   int64_t num_bytes = BitUtil::BytesForBits(length);
   // Shift dest by its byte offset
-  dest += dest_byte_offset;
+  dest += dest_offset / 8;
 
-  if (dest_bit_offset > 0) {
-    internal::BitmapReader valid_reader(data, offset, length);
-    internal::BitmapWriter valid_writer(dest, dest_bit_offset, length);
+  // Take care of the trailing bits in the last byte
+  int64_t trailing_bits = num_bytes * 8 - length;
+  uint8_t trail = 0;
+  if (trailing_bits && restore_trailing_bits) {
+    trail = dest[num_bytes - 1];
+  }
 
-    for (int64_t i = 0; i < length; i++) {
-      if (invert_bits ^ valid_reader.IsSet()) {
-        valid_writer.Set();
-      } else {
-        valid_writer.Clear();
-      }
-      valid_reader.Next();
-      valid_writer.Next();
+  if (invert_bits) {
+    for (int64_t i = 0; i < num_bytes; i++) {
+      dest[i] = static_cast<uint8_t>(~(data[byte_offset + i]));
     }
-    valid_writer.Finish();
   } else {
-    // Take care of the trailing bits in the last byte
-    int64_t trailing_bits = num_bytes * 8 - length;
-    uint8_t trail = 0;
-    if (trailing_bits && restore_trailing_bits) {
-      trail = dest[num_bytes - 1];
-    }
-
-    if (bit_offset > 0) {
-      uint8_t carry_mask = BitUtil::kPrecedingBitmask[bit_offset];
-      uint8_t carry_shift = static_cast<uint8_t>(8U - static_cast<uint8_t>(bit_offset));
-
-      uint8_t carry = 0U;
-      if (BitUtil::BytesForBits(length + bit_offset) > num_bytes) {
-        carry = static_cast<uint8_t>((data[byte_offset + num_bytes] & carry_mask)
-                                     << carry_shift);
-      }
+    std::memcpy(dest, data + byte_offset, static_cast<size_t>(num_bytes));
+  }
 
-      int64_t i = num_bytes - 1;
-      while (i + 1 > 0) {
-        uint8_t cur_byte = data[byte_offset + i];
-        if (invert_bits) {
-          dest[i] = static_cast<uint8_t>(~((cur_byte >> bit_offset) | carry));
-        } else {
-          dest[i] = static_cast<uint8_t>((cur_byte >> bit_offset) | carry);
-        }
-        carry = static_cast<uint8_t>((cur_byte & carry_mask) << carry_shift);
-        --i;
-      }
-    } else {
-      if (invert_bits) {
-        for (int64_t i = 0; i < num_bytes; i++) {
-          dest[i] = static_cast<uint8_t>(~(data[byte_offset + i]));
-        }
+  if (restore_trailing_bits) {
+    for (int i = 0; i < trailing_bits; i++) {
+      if (BitUtil::GetBit(&trail, i + 8 - trailing_bits)) {
+        BitUtil::SetBit(dest, length + i);
       } else {
-        std::memcpy(dest, data + byte_offset, static_cast<size_t>(num_bytes));
-      }
-    }
-
-    if (restore_trailing_bits) {
-      for (int i = 0; i < trailing_bits; i++) {
-        if (BitUtil::GetBit(&trail, i + 8 - trailing_bits)) {
-          BitUtil::SetBit(dest, length + i);
-        } else {
-          BitUtil::ClearBit(dest, length + i);
-        }
+        BitUtil::ClearBit(dest, length + i);
       }
     }
   }
@@ -230,6 +374,7 @@ Result<std::shared_ptr<Buffer>> InvertBitmap(MemoryPool* pool, const uint8_t* da
 
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t bit_length) {
+  int64_t position = 0;
   if (left_offset % 8 == 0 && right_offset % 8 == 0) {
     // byte aligned, can use memcmp
     bool bytes_equal = std::memcmp(left + left_offset / 8, right + right_offset / 8,
@@ -237,19 +382,14 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
     if (!bytes_equal) {
       return false;
     }
-    for (int64_t i = (bit_length / 8) * 8; i < bit_length; ++i) {
-      if (BitUtil::GetBit(left, left_offset + i) !=
-          BitUtil::GetBit(right, right_offset + i)) {
-        return false;
-      }
-    }
-    return true;
+    position = (bit_length / 8) * 8;
   }
 
-  // Unaligned slow case
-  for (int64_t i = 0; i < bit_length; ++i) {
-    if (BitUtil::GetBit(left, left_offset + i) !=
-        BitUtil::GetBit(right, right_offset + i)) {
+  // Unaligned case, or the trailing bits: compare 64 bits at a time
+  for (; position < bit_length; position += 64) {
+    const int64_t num_bits = std::min<int64_t>(64, bit_length - position);
+    if (LoadBitmapWord(left, left_offset + position, num_bits) !=
+        LoadBitmapWord(right, right_offset + position, num_bits)) {
       return false;
     }
   }
@@ -276,41 +416,21 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
 }
 
 template <typename Op>
-void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
-                       int64_t right_offset, uint8_t* out, int64_t out_offset,
-                       int64_t length) {
-  Op op;
-  auto left_reader = internal::BitmapReader(left, left_offset, length);
-  auto right_reader = internal::BitmapReader(right, right_offset, length);
-  auto writer = internal::BitmapWriter(out, out_offset, length);
-  for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
-      writer.Set();
-    } else {
-      writer.Clear();
-    }
-    left_reader.Next();
-    right_reader.Next();
-    writer.Next();
-  }
-  writer.Finish();
-}
-
-template <typename BitOp, typename LogicalOp>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
-    AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                           length);
+    AlignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset, length);
   } else {
-    // Unaligned
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset, dest, out_offset,
-                                 length);
+    // Unaligned: shift the inputs into place a word at a time
+    WriteShiftedWords(BinaryWordSource<Op>{ShiftedBitmapReader(left, left_offset),
+                                           ShiftedBitmapReader(right, right_offset),
+                                           Op()},
+                      length, dest, out_offset);
   }
 }
 
-template <typename BitOp, typename LogicalOp>
+template <typename Op>
 Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
@@ -318,8 +438,8 @@ Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
   std::shared_ptr<Buffer> out_buffer;
   const int64_t phys_bits = length + out_offset;
   RETURN_NOT_OK(AllocateEmptyBitmap(pool, phys_bits, &out_buffer));
-  BitmapOp<BitOp, LogicalOp>(left, left_offset, right, right_offset, length, out_offset,
-                             out_buffer->mutable_data());
+  BitmapOp<Op>(left, left_offset, right, right_offset, length, out_offset,
+               out_buffer->mutable_data());
   return out_buffer;
 }
 
@@ -360,13 +480,13 @@ Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
+  return BitmapOp<AndOp>(
       pool, left, left_offset, right, right_offset, length, out_offset);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
+  BitmapOp<AndOp>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
@@ -374,13 +494,13 @@ Result<std::shared_ptr<Buffer>> BitmapOr(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
+  return BitmapOp<OrOp>(
       pool, left, left_offset, right, right_offset, length, out_offset);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
+  BitmapOp<OrOp>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
@@ -388,13 +508,13 @@ Result<std::shared_ptr<Buffer>> BitmapXor(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
+  return BitmapOp<XorOp>(
       pool, left, left_offset, right, right_offset, length, out_offset);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
+  BitmapOp<XorOp>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
@@ -716,6 +716,41 @@ void GenerateBitsUnrolled(uint8_t* bitmap, int64_t start_offset, int64_t length,
   }
 }
 
+// Pack 8 bytes, loaded in little endian order, into a byte whose k-th bit is set
+// where the k-th byte is nonzero
+static inline uint8_t PackBytes(uint64_t bytes) {
+  // Set the high bit of the nonzero bytes, then gather the high bits
+  const uint64_t high_bits =
+      (((bytes & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) | bytes) &
+      0x8080808080808080ULL;
+  return static_cast<uint8_t>(((high_bits >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+// Write a bitmap from a range of bytes, a bit being set where its byte is
+// nonzero, like GenerateBitsUnrolled() but packing 8 bytes at a time. Returns
+// the number of zero bytes.
+static inline int64_t PackBytesToBitmap(const uint8_t* bytes, int64_t length,
+                                        uint8_t* bitmap, int64_t start_offset) {
+  int64_t false_count = 0;
+  int64_t i = 0;
+  for (; i < length && (start_offset + i) % 8 != 0; ++i) {
+    BitUtil::SetBitTo(bitmap, start_offset + i, bytes[i] != 0);
+    false_count += bytes[i] == 0;
+  }
+  uint8_t* cur = bitmap + (start_offset + i) / 8;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(word));
+    *cur = PackBytes(BitUtil::FromLittleEndian(word));
+    false_count += 8 - BitUtil::kBytePopcount[*cur++];
+  }
+  for (; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, start_offset + i, bytes[i] != 0);
+    false_count += bytes[i] == 0;
+  }
+  return false_count;
+}
+
 // A function that visits each bit in a bitmap and calls a visitor function with a
 // boolean representation of that bit. This is intended to be analogous to
 // GenerateBits.
@@ -775,6 +810,102 @@ void VisitBitsUnrolled(const uint8_t* bitmap, int64_t start_offset, int64_t leng
                      visit);
 }
 
+// Load up to 64 bits of a bitmap starting at an arbitrary bit offset, reading
+// only the bytes they span. Bit i of the result is bit (bit_offset + i) of the
+// bitmap; the bits past num_bits are zero.
+static inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset,
+                                      int64_t num_bits) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  const int64_t num_bytes = BitUtil::BytesForBits(shift + num_bits);
+  uint64_t word = 0;
+  std::memcpy(&word, bytes, static_cast<size_t>(std::min<int64_t>(num_bytes, 8)));
+  word = BitUtil::FromLittleEndian(word) >> shift;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  return BitUtil::TrailingBits(word, static_cast<int>(num_bits));
+}
+
+// Reads the bits of a bitmap from an arbitrary bit offset, 64 at a time.
+// Word() reads one byte past the bits it returns, which must be within the
+// bitmap. Words are indexed from the start of the reader, so that loops over
+// them keep the shift and the base address invariant.
+class ShiftedBitmapReader {
+ public:
+  ShiftedBitmapReader(const uint8_t* bitmap, int64_t offset)
+      : bytes_(bitmap + offset / 8), shift_(static_cast<int>(offset % 8)) {}
+
+  // \brief A reader of the bits from position on
+  ShiftedBitmapReader Seek(int64_t position) const {
+    return ShiftedBitmapReader(bytes_, shift_ + position);
+  }
+
+  // \brief The i-th 64-bit word
+  uint64_t Word(int64_t i) const {
+    const uint8_t* bytes = bytes_ + 8 * i;
+    // The low bits of the second load repeat bits of the first one
+    uint64_t low, high;
+    std::memcpy(&low, bytes, sizeof(low));
+    std::memcpy(&high, bytes + 1, sizeof(high));
+    return (BitUtil::FromLittleEndian(low) >> shift_) |
+           (BitUtil::FromLittleEndian(high) << (8 - shift_));
+  }
+
+  // \brief The num_bits bits from position on, reading only the bytes they span
+  uint64_t PartialWord(int64_t position, int64_t num_bits) const {
+    return LoadBitmapWord(bytes_, shift_ + position, num_bits);
+  }
+
+  const uint8_t* bytes() const { return bytes_; }
+  int shift() const { return shift_; }
+
+ private:
+  const uint8_t* bytes_;
+  int shift_;
+};
+
+// A function that calls visit(position, run_length) for each run of set bits
+// in a bitmap, positions being relative to start_offset. A null bitmap is
+// considered all set. The bitmap is scanned 64 bits at a time, skipping whole
+// words inside runs of set or unset bits, making this much faster than
+// VisitBits() on validity bitmaps.
+template <class Visitor>
+void VisitSetBitRuns(const uint8_t* bitmap, int64_t start_offset, int64_t length,
+                     Visitor&& visit) {
+  if (bitmap == NULLPTR) {
+    if (length > 0) {
+      visit(int64_t(0), length);
+    }
+    return;
+  }
+  // The start of the current run of set bits, or -1 outside of one
+  int64_t run_start = -1;
+  for (int64_t position = 0; position < length; position += 64) {
+    const int num_bits = static_cast<int>(std::min<int64_t>(length - position, 64));
+    const uint64_t word = LoadBitmapWord(bitmap, start_offset + position, num_bits);
+    const uint64_t inverted = BitUtil::TrailingBits(~word, num_bits);
+    int bit = 0;
+    while (bit < num_bits) {
+      // Look for the end of the current run or the start of the next one
+      const uint64_t remaining = (run_start < 0 ? word : inverted) >> bit;
+      if (remaining == 0) {
+        break;
+      }
+      bit += BitUtil::CountTrailingZeros(remaining);
+      if (run_start < 0) {
+        run_start = position + bit;
+      } else {
+        visit(run_start, position + bit - run_start);
+        run_start = -1;
+      }
+    }
+  }
+  if (run_start >= 0) {
+    visit(run_start, length - run_start);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Bitmap utilities
 
@@ -356,6 +356,36 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
   CopyBitmap<4>(state);
 }
 
+// Trigger the unaligned paths of bit counting and run visiting
+static void CountSetBitsWithOffset(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+  for (auto _ : state) {
+    auto count = internal::CountSetBits(buffer->data(), 3, buffer_size * 8 - 9);
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+static void VisitSetBitRuns(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  // Mostly set, as validity bitmaps usually are
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+  std::shared_ptr<Buffer> other = CreateRandomBuffer(buffer_size);
+  internal::BitmapOr(buffer->data(), 0, other->data(), 0, buffer_size * 8, 0,
+                     buffer->mutable_data());
+  BitUtil::SetBitsTo(buffer->mutable_data(), 0, buffer_size * 4, true);
+
+  for (auto _ : state) {
+    int64_t total = 0;
+    internal::VisitSetBitRuns(buffer->data(), 3, buffer_size * 8 - 9,
+                              [&](int64_t position, int64_t length) { total += length; });
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapReader(benchmark::State& state) {
   BenchmarkBitmapReader<NaiveBitmapReader>(state, state.range(0));
@@ -383,6 +413,8 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
+BENCHMARK(CountSetBitsWithOffset)->Arg(kBufferSize);
+BENCHMARK(VisitSetBitRuns)->Arg(kBufferSize);
 
 #define AND_BENCHMARK_RANGES                      \
   {                                               \
@@ -378,6 +378,49 @@ TYPED_TEST(TestGenerateBits, NormalOperation) {
   }
 }
 
+TEST(BitUtilTests, TestPackBytesToBitmap) {
+  const int kSourceSize = 256;
+  uint8_t source[kSourceSize];
+  random_bytes(kSourceSize, 0, source);
+  // Make about half of the bytes zero
+  for (int i = 0; i < kSourceSize; ++i) {
+    if (source[i] < 128) {
+      source[i] = 0;
+    }
+  }
+
+  const int64_t start_offsets[] = {0, 1, 3, 7, 8, 9, 21, 32};
+  const int64_t lengths[] = {0, 1, 7, 8, 9, 16, 17, 31, 64, 100, 201, 207};
+  const uint8_t fill_bytes[] = {0x00, 0xff};
+
+  for (const int64_t start_offset : start_offsets) {
+    for (const int64_t length : lengths) {
+      for (const uint8_t fill_byte : fill_bytes) {
+        uint8_t bitmap[kSourceSize / 8 + 8];
+        memset(bitmap, fill_byte, sizeof(bitmap));
+        int64_t false_count =
+            internal::PackBytesToBitmap(source, length, bitmap, start_offset);
+
+        int64_t expected_false_count = 0;
+        for (int64_t i = 0; i < length; ++i) {
+          ASSERT_EQ(source[i] != 0, BitUtil::GetBit(bitmap, start_offset + i))
+              << "mismatch at bit #" << i;
+          expected_false_count += source[i] == 0;
+        }
+        ASSERT_EQ(expected_false_count, false_count);
+        // Check the bits around the packed ones weren't clobbered
+        for (int64_t i = 0; i < start_offset; ++i) {
+          ASSERT_EQ(fill_byte == 0xff, BitUtil::GetBit(bitmap, i));
+        }
+        const int64_t bitmap_length = static_cast<int64_t>(sizeof(bitmap)) * 8;
+        for (int64_t i = start_offset + length; i < bitmap_length; ++i) {
+          ASSERT_EQ(fill_byte == 0xff, BitUtil::GetBit(bitmap, i));
+        }
+      }
+    }
+  }
+}
+
 // Tests for VisitBits and VisitBitsUnrolled. Based on the tests for GenerateBits and
 // GenerateBitsUnrolled.
 struct VisitBitsFunctor {
@@ -647,6 +690,52 @@ TEST_F(BitmapOp, XorAligned) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, RandomUnaligned) {
+  // Long enough for whole shifted words, the output bits around the result
+  // being preserved by the non-allocating versions
+  const int64_t kBufferSize = 200;
+  std::shared_ptr<Buffer> left, right, original, out;
+  ASSERT_OK(AllocateBuffer(kBufferSize, &left));
+  ASSERT_OK(AllocateBuffer(kBufferSize, &right));
+  ASSERT_OK(AllocateBuffer(kBufferSize, &original));
+  ASSERT_OK(AllocateBuffer(kBufferSize, &out));
+  random_bytes(kBufferSize, 0, left->mutable_data());
+  random_bytes(kBufferSize, 1, right->mutable_data());
+  random_bytes(kBufferSize, 2, original->mutable_data());
+
+  using OpFunction = void (*)(const uint8_t*, int64_t, const uint8_t*, int64_t, int64_t,
+                              int64_t, uint8_t*);
+  const std::vector<std::pair<OpFunction, std::function<bool(bool, bool)>>> ops = {
+      {BitmapAnd, std::logical_and<bool>()},
+      {BitmapOr, std::logical_or<bool>()},
+      {BitmapXor, std::not_equal_to<bool>()}};
+  for (const auto& op : ops) {
+    for (int64_t left_offset : {0, 3, 8, 61}) {
+      for (int64_t right_offset : {0, 5, 64}) {
+        for (int64_t out_offset : {1, 7, 12}) {
+          for (int64_t length : {0, 6, 64, 65, 300, 700, 1024, 1450}) {
+            std::memcpy(out->mutable_data(), original->data(), kBufferSize);
+            op.first(left->data(), left_offset, right->data(), right_offset, length,
+                     out_offset, out->mutable_data());
+            for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+              bool expected = BitUtil::GetBit(original->data(), i);
+              if (i >= out_offset && i < out_offset + length) {
+                expected = op.second(BitUtil::GetBit(left->data(), left_offset + i -
+                                                     out_offset),
+                                     BitUtil::GetBit(right->data(), right_offset + i -
+                                                     out_offset));
+              }
+              ASSERT_EQ(expected, BitUtil::GetBit(out->data(), i))
+                  << "at " << i << " for length " << length << " and offsets "
+                  << left_offset << ", " << right_offset << ", " << out_offset;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -830,6 +919,70 @@ TEST(BitUtilTests, TestCopyAndInvertBitmapPreAllocated) {
   }
 }
 
+TEST(BitUtilTests, LoadBitmapWord) {
+  const uint8_t bitmap[] = {0xF0, 0x0F, 0xAA, 0x55, 0x01, 0x02, 0x04, 0x08, 0x81};
+  ASSERT_EQ(0x0, internal::LoadBitmapWord(bitmap, 0, 4));
+  ASSERT_EQ(0xFF, internal::LoadBitmapWord(bitmap, 4, 8));
+  ASSERT_EQ(0x5AA0FF, internal::LoadBitmapWord(bitmap, 4, 24));
+  ASSERT_EQ(0x0804020155AA0FF0ULL, internal::LoadBitmapWord(bitmap, 0, 64));
+  // Nine bytes spanned
+  ASSERT_EQ(0x10804020155AA0FFULL, internal::LoadBitmapWord(bitmap, 4, 64));
+  ASSERT_EQ(0x81, internal::LoadBitmapWord(bitmap, 64, 8));
+  ASSERT_EQ(0x0, internal::LoadBitmapWord(bitmap, 3, 0));
+}
+
+// Runs of set bits computed a bit at a time
+static std::vector<std::pair<int64_t, int64_t>> SlowSetBitRuns(const uint8_t* bitmap,
+                                                              int64_t offset,
+                                                              int64_t length) {
+  std::vector<std::pair<int64_t, int64_t>> runs;
+  for (int64_t i = 0; i < length; ++i) {
+    if (!BitUtil::GetBit(bitmap, offset + i)) {
+      continue;
+    }
+    if (!runs.empty() && runs.back().first + runs.back().second == i) {
+      ++runs.back().second;
+    } else {
+      runs.emplace_back(i, 1);
+    }
+  }
+  return runs;
+}
+
+TEST(BitUtilTests, VisitSetBitRuns) {
+  const int64_t kBufferSize = 128;
+  std::vector<std::pair<int64_t, int64_t>> runs;
+  auto visit = [&](int64_t position, int64_t length) {
+    runs.emplace_back(position, length);
+  };
+
+  internal::VisitSetBitRuns(NULLPTR, 3, 100, visit);
+  ASSERT_EQ(decltype(runs)({{0, 100}}), runs);
+  runs.clear();
+  internal::VisitSetBitRuns(NULLPTR, 3, 0, visit);
+  ASSERT_TRUE(runs.empty());
+
+  std::vector<uint8_t> bitmap(kBufferSize);
+  for (const double set_probability : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+    // Sparse or dense bits followed by random ones
+    random_bytes(kBufferSize, 0, bitmap.data());
+    for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+      const bool bit = i < kBufferSize * 4
+                           ? (i * 7919 % 1000) < set_probability * 1000
+                           : BitUtil::GetBit(bitmap.data(), i);
+      BitUtil::SetBitTo(bitmap.data(), i, bit);
+    }
+    for (const int64_t offset : {0, 1, 7, 8, 63, 64, 100}) {
+      for (const int64_t length : {0, 1, 60, 64, 129, 500, 900}) {
+        runs.clear();
+        internal::VisitSetBitRuns(bitmap.data(), offset, length, visit);
+        ASSERT_EQ(SlowSetBitRuns(bitmap.data(), offset, length), runs)
+            << "for offset " << offset << " and length " << length;
+      }
+    }
+  }
+}
+
 TEST(BitUtil, CeilDiv) {
   EXPECT_EQ(BitUtil::CeilDiv(0, 1), 0);
   EXPECT_EQ(BitUtil::CeilDiv(1, 1), 1);
@@ -1041,6 +1194,27 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::MAX_VLQ_INT64_BYTE_LEN] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int32_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -28,6 +28,7 @@
 #define ARROW_UTIL_BPACKING_H
 
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/ubsan.h"
 
 namespace arrow {
@@ -3720,10 +3721,64 @@ inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
+#if defined(ARROW_HAVE_AVX2)
+
+// Unpack blocks of 32 values of 1 to 31 bits, 8 values at a time. A group of
+// 8 values starts on a byte boundary and spans at most 31 bytes, so each value
+// is shifted out of the (at most) two 32-bit words it covers in the 32 bytes
+// loaded from the start of its group. Blocks are only unpacked while these
+// loads stay within the num_blocks blocks of input; returns the number of
+// blocks unpacked.
+inline int unpack32_avx2(const uint32_t* in, uint32_t* out, int num_blocks,
+                         int num_bits) {
+  const __m256i bit_offsets = _mm256_mullo_epi32(
+      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(num_bits));
+  const __m256i low_words = _mm256_srli_epi32(bit_offsets, 5);
+  const __m256i high_words = _mm256_add_epi32(low_words, _mm256_set1_epi32(1));
+  const __m256i low_shifts = _mm256_and_si256(bit_offsets, _mm256_set1_epi32(31));
+  // A shift by 32 zeroes the high word of values that do not straddle words
+  const __m256i high_shifts = _mm256_sub_epi32(_mm256_set1_epi32(32), low_shifts);
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>((1U << num_bits) - 1));
+
+  const auto bytes = reinterpret_cast<const uint8_t*>(in);
+  // Each block of 32 values is num_bits 32-bit words long
+  const int64_t block_bytes = 4 * num_bits;
+  const int64_t in_bytes = num_blocks * block_bytes;
+  int block = 0;
+  for (; block < num_blocks; ++block) {
+    const int64_t block_offset = block * block_bytes;
+    if (block_offset + 3 * num_bits + 32 > in_bytes) {
+      break;
+    }
+    for (int group = 0; group < 4; ++group) {
+      const __m256i words = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(bytes + block_offset + group * num_bits));
+      const __m256i low = _mm256_permutevar8x32_epi32(words, low_words);
+      const __m256i high = _mm256_permutevar8x32_epi32(words, high_words);
+      const __m256i values = _mm256_or_si256(_mm256_srlv_epi32(low, low_shifts),
+                                             _mm256_sllv_epi32(high, high_shifts));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + block * 32 + group * 8),
+                          _mm256_and_si256(values, mask));
+    }
+  }
+  return block;
+}
+
+#endif  // ARROW_HAVE_AVX2
+
 inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
+#if defined(ARROW_HAVE_AVX2)
+  if (num_bits > 0 && num_bits < 32) {
+    const int num_unpacked = unpack32_avx2(in, out, num_loops, num_bits);
+    in += num_unpacked * num_bits;
+    out += num_unpacked * 32;
+    num_loops -= num_unpacked;
+  }
+#endif
+
   switch (num_bits) {
     case 0:
       for (int i = 0; i < num_loops; ++i) in = nullunpacker32(in, out + i * 32);
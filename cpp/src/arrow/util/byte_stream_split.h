@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+// Byte stream splitting scatters the K bytes of each of N fixed-width values
+// into K streams of N bytes: byte k of value i is at k * N + i. Streams of
+// high-order bytes of floating point data are highly repetitive, which makes
+// them compress much better than the values themselves.
+
+#if defined(ARROW_HAVE_SSE2)
+
+// Interleave the bytes of registers i and i + kNumRegisters / 2 into
+// registers 2i and 2i + 1. Seen as a bit permutation of byte positions in the
+// registers, this rotates the position bits left by one, so that repeated
+// application transposes blocks of 16 values between value-major and
+// stream-major order.
+template <int kNumRegisters>
+void InterleaveRegisterBytes(__m128i* registers) {
+  __m128i result[kNumRegisters];
+  for (int i = 0; i < kNumRegisters / 2; ++i) {
+    result[2 * i] = _mm_unpacklo_epi8(registers[i], registers[i + kNumRegisters / 2]);
+    result[2 * i + 1] = _mm_unpackhi_epi8(registers[i], registers[i + kNumRegisters / 2]);
+  }
+  for (int i = 0; i < kNumRegisters; ++i) {
+    registers[i] = result[i];
+  }
+}
+
+constexpr int Log2Streams(int num_streams) { return num_streams == 4 ? 2 : 3; }
+
+#endif  // ARROW_HAVE_SSE2
+
+/// \brief Split num_values values of type T into sizeof(T) byte streams
+template <typename T>
+void ByteStreamSplitEncode(const T* values, int64_t num_values, uint8_t* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  const auto bytes = reinterpret_cast<const uint8_t*>(values);
+  int64_t i = 0;
+#if defined(ARROW_HAVE_SSE2)
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "Only 4- and 8-byte values");
+  // Blocks of 16 values fill one register per stream. Four rotations of the
+  // position bits move the byte index above the value index.
+  for (; i + 16 <= num_values; i += 16) {
+    __m128i registers[kNumStreams];
+    for (int r = 0; r < kNumStreams; ++r) {
+      registers[r] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(bytes + i * kNumStreams + r * 16));
+    }
+    for (int stage = 0; stage < 4; ++stage) {
+      InterleaveRegisterBytes<kNumStreams>(registers);
+    }
+    for (int k = 0; k < kNumStreams; ++k) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k * num_values + i),
+                       registers[k]);
+    }
+  }
+#endif
+  for (; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out[k * num_values + i] = bytes[i * kNumStreams + k];
+    }
+  }
+}
+
+/// \brief Reassemble num_values values of type T from byte streams of
+/// stride bytes each, starting at data
+///
+/// Decoding part of the streams starts from an offset into the first stream
+/// while keeping the stride of the whole buffer.
+template <typename T>
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  auto out_bytes = reinterpret_cast<uint8_t*>(out);
+  int64_t i = 0;
+#if defined(ARROW_HAVE_SSE2)
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "Only 4- and 8-byte values");
+  // The inverse of encoding: the remaining rotations of the position bits
+  for (; i + 16 <= num_values; i += 16) {
+    __m128i registers[kNumStreams];
+    for (int k = 0; k < kNumStreams; ++k) {
+      registers[k] =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + k * stride + i));
+    }
+    for (int stage = 0; stage < Log2Streams(kNumStreams); ++stage) {
+      InterleaveRegisterBytes<kNumStreams>(registers);
+    }
+    for (int r = 0; r < kNumStreams; ++r) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out_bytes + i * kNumStreams + r * 16),
+                       registers[r]);
+    }
+  }
+#endif
+  for (; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out_bytes[i * kNumStreams + k] = data[k * stride + i];
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
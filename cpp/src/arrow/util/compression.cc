@@ -62,6 +62,28 @@ int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
 
+Status Codec::SetDictionary(std::shared_ptr<Buffer> dictionary) {
+  if (dictionary == nullptr) {
+    return Status::OK();
+  }
+  return Status::NotImplemented("Codec '", name(),
+                                "' does not support compression dictionaries");
+}
+
+Result<std::shared_ptr<Buffer>> Codec::TrainDictionary(
+    Compression::type codec, const std::vector<std::shared_ptr<Buffer>>& samples,
+    int64_t max_dictionary_size) {
+  if (codec != Compression::ZSTD) {
+    return Status::NotImplemented("Compression dictionaries not supported for ",
+                                  GetCodecAsString(codec));
+  }
+#ifdef ARROW_WITH_ZSTD
+  return ZSTDCodec::TrainDictionary(samples, max_dictionary_size);
+#else
+  return Status::NotImplemented("ZSTD codec support not built");
+#endif
+}
+
 std::string Codec::GetCodecAsString(Compression::type t) {
   switch (t) {
     case Compression::UNCOMPRESSED:
@@ -85,6 +107,28 @@ std::string Codec::GetCodecAsString(Compression::type t) {
   }
 }
 
+Result<Compression::type> Codec::GetCompressionType(const std::string& name) {
+  if (name == "UNCOMPRESSED") {
+    return Compression::UNCOMPRESSED;
+  } else if (name == "GZIP") {
+    return Compression::GZIP;
+  } else if (name == "SNAPPY") {
+    return Compression::SNAPPY;
+  } else if (name == "LZO") {
+    return Compression::LZO;
+  } else if (name == "BROTLI") {
+    return Compression::BROTLI;
+  } else if (name == "LZ4") {
+    return Compression::LZ4;
+  } else if (name == "ZSTD") {
+    return Compression::ZSTD;
+  } else if (name == "BZ2") {
+    return Compression::BZ2;
+  } else {
+    return Status::Invalid("Unrecognized compression type: ", name);
+  }
+}
+
 Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
                                              int compression_level) {
   std::unique_ptr<Codec> codec;
@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -37,6 +38,9 @@ namespace util {
 
 constexpr int kUseDefaultCompressionLevel = std::numeric_limits<int>::min();
 
+/// \brief Default maximum size of dictionaries built by Codec::TrainDictionary
+constexpr int64_t kDefaultCompressionDictionarySize = 110 * 1024;
+
 /// \brief Streaming compressor interface
 ///
 class ARROW_EXPORT Compressor {
@@ -124,6 +128,9 @@ class ARROW_EXPORT Codec {
   /// \brief Return a string name for compression type
   static std::string GetCodecAsString(Compression::type t);
 
+  /// \brief Return compression type for name (all upper case)
+  static Result<Compression::type> GetCompressionType(const std::string& name);
+
   /// \brief Create a codec for the given compression algorithm
   static Result<std::unique_ptr<Codec>> Create(
       Compression::type codec, int compression_level = kUseDefaultCompressionLevel);
@@ -164,6 +171,32 @@ class ARROW_EXPORT Codec {
 
   virtual const char* name() const = 0;
 
+  /// \brief Return true if the codec supports compression dictionaries
+  virtual bool SupportsDictionary() const { return false; }
+
+  /// \brief Use a dictionary for subsequent compression and decompression
+  ///
+  /// The dictionary applies to one-shot and streaming functions alike, and
+  /// greatly improves compression of small buffers resembling the data the
+  /// dictionary was trained on.  Data compressed with a dictionary can only
+  /// be decompressed with the same one: the dictionary is not embedded in
+  /// the compressed data, so it must be stored or transmitted alongside it.
+  /// Pass null to stop using a dictionary.
+  virtual Status SetDictionary(std::shared_ptr<Buffer> dictionary);
+
+  /// \brief Return the dictionary set with SetDictionary(), or null
+  virtual std::shared_ptr<Buffer> dictionary() const { return NULLPTR; }
+
+  /// \brief Train a compression dictionary from samples of the data to compress
+  ///
+  /// Only ZSTD is supported.  The samples should be representative of the
+  /// buffers compressed later; a few hundred samples of a few KB each are
+  /// typical.  The returned dictionary is a self-contained buffer which can be
+  /// saved as-is and passed to SetDictionary().
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      Compression::type codec, const std::vector<std::shared_ptr<Buffer>>& samples,
+      int64_t max_dictionary_size = kDefaultCompressionDictionarySize);
+
   // Deprecated APIs
 
   /// \brief Create a codec for the given compression algorithm
@@ -173,24 +173,86 @@ static void ReferenceStreamingDecompression(
   StreamingDecompression(COMPRESSION, data, state);
 }
 
+// One-shot compression of data cut in buffers of state.range(0) bytes, as
+// Parquet does with its pages, where per-call setup costs matter
+template <Compression::type COMPRESSION>
+static void ReferenceOneShotCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
+  const int64_t page_size = state.range(0);
+  auto codec = *Codec::Create(COMPRESSION);
+
+  std::vector<uint8_t> output_buffer(codec->MaxCompressedLen(page_size, data.data()));
+  while (state.KeepRunning()) {
+    int64_t compressed_size = 0;
+    for (int64_t offset = 0; offset < static_cast<int64_t>(data.size());
+         offset += page_size) {
+      compressed_size += *codec->Compress(page_size, data.data() + offset,
+                                          output_buffer.size(), output_buffer.data());
+    }
+    state.counters["ratio"] =
+        static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceOneShotDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
+  const int64_t page_size = state.range(0);
+  auto codec = *Codec::Create(COMPRESSION);
+
+  // Compress all pages first
+  std::vector<std::vector<uint8_t>> pages;
+  for (int64_t offset = 0; offset < static_cast<int64_t>(data.size());
+       offset += page_size) {
+    std::vector<uint8_t> page(codec->MaxCompressedLen(page_size, data.data()));
+    page.resize(*codec->Compress(page_size, data.data() + offset, page.size(),
+                                 page.data()));
+    pages.push_back(std::move(page));
+  }
+
+  std::vector<uint8_t> output_buffer(page_size);
+  while (state.KeepRunning()) {
+    for (const auto& page : pages) {
+      ARROW_CHECK(*codec->Decompress(page.size(), page.data(), output_buffer.size(),
+                                     output_buffer.data()) == page_size);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+#define ONE_SHOT_BENCHMARKS(COMPRESSION)                                          \
+  BENCHMARK_TEMPLATE(ReferenceOneShotCompression, COMPRESSION)                    \
+      ->RangeMultiplier(2)                                                        \
+      ->Range(8 * 1024, 64 * 1024);                                               \
+  BENCHMARK_TEMPLATE(ReferenceOneShotDecompression, COMPRESSION)                  \
+      ->RangeMultiplier(2)                                                        \
+      ->Range(8 * 1024, 64 * 1024)
+
 #ifdef ARROW_WITH_ZLIB
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::GZIP);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::GZIP);
+ONE_SHOT_BENCHMARKS(Compression::GZIP);
 #endif
 
 #ifdef ARROW_WITH_BROTLI
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::BROTLI);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::BROTLI);
+ONE_SHOT_BENCHMARKS(Compression::BROTLI);
 #endif
 
 #ifdef ARROW_WITH_ZSTD
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::ZSTD);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::ZSTD);
+ONE_SHOT_BENCHMARKS(Compression::ZSTD);
 #endif
 
 #ifdef ARROW_WITH_LZ4
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::LZ4);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::LZ4);
+ONE_SHOT_BENCHMARKS(Compression::LZ4);
 #endif
 
 #endif
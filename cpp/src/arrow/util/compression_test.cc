@@ -22,10 +22,12 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -53,6 +55,22 @@ std::vector<uint8_t> MakeCompressibleData(int data_size) {
   return data;
 }
 
+// Small records sharing most of their contents, as found in IPC or Parquet
+// buffers of similar data
+std::vector<std::shared_ptr<Buffer>> MakeSimilarSamples(int num_samples) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> dist(0, 100000);
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < num_samples; ++i) {
+    std::string sample = "{\"id\": " + std::to_string(dist(gen)) +
+                         ", \"name\": \"Apache Arrow\", \"value\": " +
+                         std::to_string(dist(gen)) + ", \"tags\": [\"columnar\", " +
+                         "\"in-memory\", \"analytics\"]}";
+    samples.push_back(Buffer::FromString(std::move(sample)));
+  }
+  return samples;
+}
+
 // Check roundtrip of one-shot compression and decompression functions.
 void CheckCodecRoundtrip(std::unique_ptr<Codec>& c1, std::unique_ptr<Codec>& c2,
                          const std::vector<uint8_t>& data) {
@@ -326,6 +344,18 @@ TEST(TestCodecMisc, GetCodecAsString) {
   ASSERT_EQ("ZSTD", Codec::GetCodecAsString(Compression::ZSTD));
 }
 
+TEST(TestCodecMisc, GetCompressionType) {
+  ASSERT_OK_AND_EQ(Compression::UNCOMPRESSED, Codec::GetCompressionType("UNCOMPRESSED"));
+  ASSERT_OK_AND_EQ(Compression::SNAPPY, Codec::GetCompressionType("SNAPPY"));
+  ASSERT_OK_AND_EQ(Compression::GZIP, Codec::GetCompressionType("GZIP"));
+  ASSERT_OK_AND_EQ(Compression::LZO, Codec::GetCompressionType("LZO"));
+  ASSERT_OK_AND_EQ(Compression::BROTLI, Codec::GetCompressionType("BROTLI"));
+  ASSERT_OK_AND_EQ(Compression::LZ4, Codec::GetCompressionType("LZ4"));
+  ASSERT_OK_AND_EQ(Compression::ZSTD, Codec::GetCompressionType("ZSTD"));
+  ASSERT_OK_AND_EQ(Compression::BZ2, Codec::GetCompressionType("BZ2"));
+  ASSERT_RAISES(Invalid, Codec::GetCompressionType("unknown"));
+}
+
 TEST_P(CodecTest, CodecRoundtrip) {
   const auto compression = GetCompression();
   if (compression == Compression::BZ2) {
@@ -500,6 +530,109 @@ TEST_P(CodecTest, StreamingDecompressorReuse) {
   CheckStreamingRoundtrip(compressor, decompressor, data);
 }
 
+TEST_P(CodecTest, OneShotReuse) {
+  if (GetCompression() == Compression::BZ2) {
+    // SKIP: BZ2 doesn't support one-shot compression
+    return;
+  }
+  // Alternate compression and decompression of several buffers with the
+  // same codec instance, which reuses its internal contexts
+  auto codec = MakeCodec();
+  auto check_roundtrips = [&](Codec* codec, int seed) {
+    for (int i = 0; i < 10; ++i) {
+      auto data = MakeRandomData(8 * 1024 * (1 + (i + seed) % 8));
+      if (i % 2 == 0) {
+        data = MakeCompressibleData(static_cast<int>(data.size()));
+      }
+      int64_t max_compressed_len = codec->MaxCompressedLen(data.size(), data.data());
+      std::vector<uint8_t> compressed(max_compressed_len);
+      ASSERT_OK_AND_ASSIGN(int64_t compressed_len,
+                           codec->Compress(data.size(), data.data(), max_compressed_len,
+                                           compressed.data()));
+      std::vector<uint8_t> decompressed(data.size());
+      ASSERT_OK_AND_ASSIGN(int64_t decompressed_len,
+                           codec->Decompress(compressed_len, compressed.data(),
+                                             decompressed.size(), decompressed.data()));
+      ASSERT_EQ(decompressed_len, static_cast<int64_t>(data.size()));
+      ASSERT_EQ(decompressed, data);
+    }
+  };
+  check_roundtrips(codec.get(), 0);
+
+  if (GetCompression() == Compression::GZIP) {
+    // SKIP: the gzip codec isn't thread-safe
+    return;
+  }
+  // Other codecs can be shared among threads
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&, i]() { check_roundtrips(codec.get(), i); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST_P(CodecTest, Dictionary) {
+  auto codec = MakeCodec();
+  auto samples = MakeSimilarSamples(1000);
+  if (!codec->SupportsDictionary()) {
+    ASSERT_RAISES(NotImplemented, Codec::TrainDictionary(GetCompression(), samples));
+    ASSERT_RAISES(NotImplemented, codec->SetDictionary(samples[0]));
+    ASSERT_OK(codec->SetDictionary(nullptr));
+    return;
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       Codec::TrainDictionary(GetCompression(), samples, 4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  auto plain_codec = MakeCodec();
+  ASSERT_OK(codec->SetDictionary(dictionary));
+  ASSERT_TRUE(codec->dictionary()->Equals(*dictionary));
+
+  const auto& sample = *samples[0];
+  std::vector<uint8_t> data(sample.data(), sample.data() + sample.size());
+  int64_t max_compressed_len = codec->MaxCompressedLen(data.size(), data.data());
+  std::vector<uint8_t> compressed(max_compressed_len);
+  std::vector<uint8_t> plain_compressed(max_compressed_len);
+  ASSERT_OK_AND_ASSIGN(int64_t compressed_len,
+                       codec->Compress(data.size(), data.data(), max_compressed_len,
+                                       compressed.data()));
+  ASSERT_OK_AND_ASSIGN(
+      int64_t plain_compressed_len,
+      plain_codec->Compress(data.size(), data.data(), max_compressed_len,
+                            plain_compressed.data()));
+  // The dictionary makes small buffers much more compressible
+  ASSERT_LT(compressed_len, plain_compressed_len / 2);
+
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_OK_AND_ASSIGN(int64_t decompressed_len,
+                       codec->Decompress(compressed_len, compressed.data(),
+                                         decompressed.size(), decompressed.data()));
+  ASSERT_EQ(decompressed_len, static_cast<int64_t>(data.size()));
+  ASSERT_EQ(decompressed, data);
+  // Decompressing requires the dictionary
+  ASSERT_RAISES(IOError, plain_codec->Decompress(compressed_len, compressed.data(),
+                                                 decompressed.size(),
+                                                 decompressed.data()));
+
+  // Streaming functions use the dictionary too
+  CheckStreamingRoundtrip(codec.get(), data);
+  CheckStreamingRoundtrip(codec.get(), MakeCompressibleData(100000));
+
+  // A dictionary can be attached to another codec instance
+  ASSERT_OK(plain_codec->SetDictionary(codec->dictionary()));
+  ASSERT_OK_AND_ASSIGN(decompressed_len,
+                       plain_codec->Decompress(compressed_len, compressed.data(),
+                                               decompressed.size(), decompressed.data()));
+  ASSERT_EQ(decompressed, data);
+
+  ASSERT_OK(codec->SetDictionary(nullptr));
+  ASSERT_EQ(codec->dictionary(), nullptr);
+  ASSERT_RAISES(Invalid, Codec::TrainDictionary(GetCompression(), samples, 0));
+}
+
 #ifdef ARROW_WITH_ZLIB
 INSTANTIATE_TEST_CASE_P(TestGZip, CodecTest, ::testing::Values(Compression::GZIP));
 #endif
@@ -320,15 +320,16 @@ class GZipCodec::GZipCodecImpl {
   }
 
   Status InitCompressor() {
-    EndDecompressor();
-    memset(&stream_, 0, sizeof(stream_));
+    EndCompressor();
+    memset(&deflate_stream_, 0, sizeof(deflate_stream_));
 
     int ret;
     // Initialize to run specified format
     int window_bits = CompressionWindowBitsForFormat(format_);
-    if ((ret = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits,
-                            compression_level_, Z_DEFAULT_STRATEGY)) != Z_OK) {
-      return ZlibErrorPrefix("zlib deflateInit failed: ", stream_.msg);
+    if ((ret = deflateInit2(&deflate_stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                            window_bits, compression_level_, Z_DEFAULT_STRATEGY)) !=
+        Z_OK) {
+      return ZlibErrorPrefix("zlib deflateInit failed: ", deflate_stream_.msg);
     }
     compressor_initialized_ = true;
     return Status::OK();
@@ -336,20 +337,20 @@ class GZipCodec::GZipCodecImpl {
 
   void EndCompressor() {
     if (compressor_initialized_) {
-      (void)deflateEnd(&stream_);
+      (void)deflateEnd(&deflate_stream_);
     }
     compressor_initialized_ = false;
   }
 
   Status InitDecompressor() {
-    EndCompressor();
-    memset(&stream_, 0, sizeof(stream_));
+    EndDecompressor();
+    memset(&inflate_stream_, 0, sizeof(inflate_stream_));
     int ret;
 
     // Initialize to run either deflate or zlib/gzip format
     int window_bits = DecompressionWindowBitsForFormat(format_);
-    if ((ret = inflateInit2(&stream_, window_bits)) != Z_OK) {
-      return ZlibErrorPrefix("zlib inflateInit failed: ", stream_.msg);
+    if ((ret = inflateInit2(&inflate_stream_, window_bits)) != Z_OK) {
+      return ZlibErrorPrefix("zlib inflateInit failed: ", inflate_stream_.msg);
     }
     decompressor_initialized_ = true;
     return Status::OK();
@@ -357,7 +358,7 @@ class GZipCodec::GZipCodecImpl {
 
   void EndDecompressor() {
     if (decompressor_initialized_) {
-      (void)inflateEnd(&stream_);
+      (void)inflateEnd(&inflate_stream_);
     }
     decompressor_initialized_ = false;
   }
@@ -376,8 +377,8 @@ class GZipCodec::GZipCodecImpl {
     }
 
     // Reset the stream for this block
-    if (inflateReset(&stream_) != Z_OK) {
-      return ZlibErrorPrefix("zlib inflateReset failed: ", stream_.msg);
+    if (inflateReset(&inflate_stream_) != Z_OK) {
+      return ZlibErrorPrefix("zlib inflateReset failed: ", inflate_stream_.msg);
     }
 
     int ret = 0;
@@ -388,14 +389,14 @@ class GZipCodec::GZipCodecImpl {
     // we just make a bigger buffer and try the non-streaming mode
     // from the beginning again.
     while (ret != Z_STREAM_END) {
-      stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
-      stream_.avail_in = static_cast<uInt>(input_length);
-      stream_.next_out = reinterpret_cast<Bytef*>(output);
-      stream_.avail_out = static_cast<uInt>(output_buffer_length);
+      inflate_stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+      inflate_stream_.avail_in = static_cast<uInt>(input_length);
+      inflate_stream_.next_out = reinterpret_cast<Bytef*>(output);
+      inflate_stream_.avail_out = static_cast<uInt>(output_buffer_length);
 
       // We know the output size.  In this case, we can use Z_FINISH
       // which is more efficient.
-      ret = inflate(&stream_, Z_FINISH);
+      ret = inflate(&inflate_stream_, Z_FINISH);
       if (ret == Z_STREAM_END || ret != Z_OK) break;
 
       // Failure, buffer was too small
@@ -405,10 +406,10 @@ class GZipCodec::GZipCodecImpl {
 
     // Failure for some other reason
     if (ret != Z_STREAM_END) {
-      return ZlibErrorPrefix("GZipCodec failed: ", stream_.msg);
+      return ZlibErrorPrefix("GZipCodec failed: ", inflate_stream_.msg);
     }
 
-    return stream_.total_out;
+    return inflate_stream_.total_out;
   }
 
   int64_t MaxCompressedLen(int64_t input_length, const uint8_t* ARROW_ARG_UNUSED(input)) {
@@ -417,7 +418,7 @@ class GZipCodec::GZipCodecImpl {
       Status s = InitCompressor();
       ARROW_CHECK_OK(s);
     }
-    int64_t max_len = deflateBound(&stream_, static_cast<uLong>(input_length));
+    int64_t max_len = deflateBound(&deflate_stream_, static_cast<uLong>(input_length));
     // ARROW-3514: return a more pessimistic estimate to account for bugs
     // in old zlib versions.
     return max_len + 12;
@@ -428,46 +429,44 @@ class GZipCodec::GZipCodecImpl {
     if (!compressor_initialized_) {
       RETURN_NOT_OK(InitCompressor());
     }
-    stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
-    stream_.avail_in = static_cast<uInt>(input_length);
-    stream_.next_out = reinterpret_cast<Bytef*>(output);
-    stream_.avail_out = static_cast<uInt>(output_buffer_len);
+    deflate_stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    deflate_stream_.avail_in = static_cast<uInt>(input_length);
+    deflate_stream_.next_out = reinterpret_cast<Bytef*>(output);
+    deflate_stream_.avail_out = static_cast<uInt>(output_buffer_len);
 
     int64_t ret = 0;
-    if ((ret = deflate(&stream_, Z_FINISH)) != Z_STREAM_END) {
-      if (ret == Z_OK) {
-        // Will return Z_OK (and stream.msg NOT set) if stream.avail_out is too
-        // small
-        return Status::IOError("zlib deflate failed, output buffer too small");
-      }
-
-      return ZlibErrorPrefix("zlib deflate failed: ", stream_.msg);
+    if ((ret = deflate(&deflate_stream_, Z_FINISH)) != Z_STREAM_END) {
+      // Make the stream usable for the next call
+      auto st = ret == Z_OK
+                    // Will return Z_OK (and stream.msg NOT set) if
+                    // stream.avail_out is too small
+                    ? Status::IOError("zlib deflate failed, output buffer too small")
+                    : ZlibErrorPrefix("zlib deflate failed: ", deflate_stream_.msg);
+      (void)deflateReset(&deflate_stream_);
+      return st;
     }
 
-    if (deflateReset(&stream_) != Z_OK) {
-      return ZlibErrorPrefix("zlib deflateReset failed: ", stream_.msg);
+    if (deflateReset(&deflate_stream_) != Z_OK) {
+      return ZlibErrorPrefix("zlib deflateReset failed: ", deflate_stream_.msg);
     }
 
     // Actual output length
-    return output_buffer_len - stream_.avail_out;
+    return output_buffer_len - deflate_stream_.avail_out;
   }
 
  private:
-  // zlib is stateful and the z_stream state variable must be initialized
-  // before
-  z_stream stream_;
+  // zlib is stateful and the z_stream state variables must be initialized
+  // before use.  They are kept and reset between calls, since initializing
+  // them allocates sizable state (several hundred KB for deflate).
+  z_stream deflate_stream_;
+  z_stream inflate_stream_;
 
   // Realistically, this will always be GZIP, but we leave the option open to
   // configure
   GZipCodec::Format format_;
 
-  // These variables are mutually exclusive. When the codec is in "compressor"
-  // state, compressor_initialized_ is true while decompressor_initialized_ is
-  // false. When it's decompressing, the opposite is true.
-  //
-  // Indeed, this is slightly hacky, but the alternative is having separate
-  // Compressor and Decompressor classes. If this ever becomes an issue, we can
-  // perform the refactoring then
+  // Separate streams are kept for compression and decompression, so that
+  // alternating between them doesn't reinitialize them every time
   bool compressor_initialized_;
   bool decompressor_initialized_;
   int compression_level_;
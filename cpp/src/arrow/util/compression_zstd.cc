@@ -19,9 +19,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -38,20 +43,95 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// One-shot compression and decompression need a context, whose setup
+// dominates the cost of compressing small buffers (a compression context
+// allocates several hundred KB of tables).  Contexts don't depend on the
+// compression parameters, so each thread keeps one of each for reuse.
+struct ThreadLocalContexts {
+  ~ThreadLocalContexts() {
+    ZSTD_freeCCtx(cctx);
+    ZSTD_freeDCtx(dctx);
+  }
+
+  ZSTD_CCtx* cctx = nullptr;
+  ZSTD_DCtx* dctx = nullptr;
+};
+
+ThreadLocalContexts* GetThreadLocalContexts() {
+  static thread_local ThreadLocalContexts contexts;
+  return &contexts;
+}
+
+Result<ZSTD_CCtx*> GetCompressionContext() {
+  auto contexts = GetThreadLocalContexts();
+  if (contexts->cctx == nullptr) {
+    contexts->cctx = ZSTD_createCCtx();
+    if (contexts->cctx == nullptr) {
+      return Status::OutOfMemory("Failed to create ZSTD compression context");
+    }
+  }
+  return contexts->cctx;
+}
+
+Result<ZSTD_DCtx*> GetDecompressionContext() {
+  auto contexts = GetThreadLocalContexts();
+  if (contexts->dctx == nullptr) {
+    contexts->dctx = ZSTD_createDCtx();
+    if (contexts->dctx == nullptr) {
+      return Status::OutOfMemory("Failed to create ZSTD decompression context");
+    }
+  }
+  return contexts->dctx;
+}
+
 }  // namespace
 
+// ----------------------------------------------------------------------
+// ZSTD dictionary
+
+struct ZSTDCodec::Dictionary {
+  Dictionary(std::shared_ptr<Buffer> buffer, ZSTD_CDict* cdict, ZSTD_DDict* ddict)
+      : buffer(std::move(buffer)), cdict(cdict), ddict(ddict) {}
+
+  ~Dictionary() {
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeDDict(ddict);
+  }
+
+  static Result<std::shared_ptr<Dictionary>> Make(std::shared_ptr<Buffer> buffer,
+                                                  int compression_level) {
+    ZSTD_CDict* cdict = ZSTD_createCDict(
+        buffer->data(), static_cast<size_t>(buffer->size()), compression_level);
+    ZSTD_DDict* ddict =
+        ZSTD_createDDict(buffer->data(), static_cast<size_t>(buffer->size()));
+    auto dict = std::make_shared<Dictionary>(std::move(buffer), cdict, ddict);
+    if (cdict == nullptr || ddict == nullptr) {
+      return Status::Invalid("Invalid ZSTD dictionary");
+    }
+    return dict;
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  ZSTD_CDict* cdict;
+  ZSTD_DDict* ddict;
+};
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(std::shared_ptr<ZSTDCodec::Dictionary> dictionary)
+      : stream_(ZSTD_createDStream()), dictionary_(std::move(dictionary)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
   Status Init() {
     finished_ = false;
     size_t ret = ZSTD_initDStream(stream_);
+    if (!ZSTD_isError(ret) && dictionary_) {
+      ret = ZSTD_DCtx_refDDict(stream_, dictionary_->ddict);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -88,6 +168,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  std::shared_ptr<ZSTDCodec::Dictionary> dictionary_;
   bool finished_;
 };
 
@@ -96,13 +177,19 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  ZSTDCompressor(int compression_level,
+                 std::shared_ptr<ZSTDCodec::Dictionary> dictionary)
+      : stream_(ZSTD_createCStream()),
+        compression_level_(compression_level),
+        dictionary_(std::move(dictionary)) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
   Status Init() {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
+    if (!ZSTD_isError(ret) && dictionary_) {
+      ret = ZSTD_CCtx_refCDict(stream_, dictionary_->cdict);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -166,6 +253,7 @@ class ZSTDCompressor : public Compressor {
 
  private:
   int compression_level_;
+  std::shared_ptr<ZSTDCodec::Dictionary> dictionary_;
 };
 
 // ----------------------------------------------------------------------
@@ -178,13 +266,13 @@ ZSTDCodec::ZSTDCodec(int compression_level) {
 }
 
 Result<std::shared_ptr<Compressor>> ZSTDCodec::MakeCompressor() {
-  auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+  auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, dictionary_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
 
 Result<std::shared_ptr<Decompressor>> ZSTDCodec::MakeDecompressor() {
-  auto ptr = std::make_shared<ZSTDDecompressor>();
+  auto ptr = std::make_shared<ZSTDDecompressor>(dictionary_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -199,8 +287,16 @@ Result<int64_t> ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
     output_buffer = empty_buffer;
   }
 
-  size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len));
+  ARROW_ASSIGN_OR_RAISE(ZSTD_DCtx * ctx, GetDecompressionContext());
+  size_t ret;
+  if (dictionary_) {
+    ret = ZSTD_decompress_usingDDict(ctx, output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), dictionary_->ddict);
+  } else {
+    ret = ZSTD_decompressDCtx(ctx, output_buffer, static_cast<size_t>(output_buffer_len),
+                              input, static_cast<size_t>(input_len));
+  }
   if (ZSTD_isError(ret)) {
     return ZSTDError(ret, "ZSTD decompression failed: ");
   }
@@ -218,13 +314,67 @@ int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
 
 Result<int64_t> ZSTDCodec::Compress(int64_t input_len, const uint8_t* input,
                                     int64_t output_buffer_len, uint8_t* output_buffer) {
-  size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
-                             static_cast<size_t>(input_len), compression_level_);
+  ARROW_ASSIGN_OR_RAISE(ZSTD_CCtx * ctx, GetCompressionContext());
+  size_t ret;
+  if (dictionary_) {
+    ret = ZSTD_compress_usingCDict(ctx, output_buffer,
+                                   static_cast<size_t>(output_buffer_len), input,
+                                   static_cast<size_t>(input_len), dictionary_->cdict);
+  } else {
+    ret = ZSTD_compressCCtx(ctx, output_buffer, static_cast<size_t>(output_buffer_len),
+                            input, static_cast<size_t>(input_len), compression_level_);
+  }
   if (ZSTD_isError(ret)) {
     return ZSTDError(ret, "ZSTD compression failed: ");
   }
   return static_cast<int64_t>(ret);
 }
 
+Status ZSTDCodec::SetDictionary(std::shared_ptr<Buffer> dictionary) {
+  if (dictionary == nullptr) {
+    dictionary_.reset();
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(dictionary_,
+                        Dictionary::Make(std::move(dictionary), compression_level_));
+  return Status::OK();
+}
+
+std::shared_ptr<Buffer> ZSTDCodec::dictionary() const {
+  return dictionary_ ? dictionary_->buffer : nullptr;
+}
+
+Result<std::shared_ptr<Buffer>> ZSTDCodec::TrainDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+  if (max_dictionary_size <= 0) {
+    return Status::Invalid("Dictionary size must be strictly positive");
+  }
+  // ZDICT wants the samples concatenated
+  std::vector<size_t> sample_sizes;
+  int64_t total_size = 0;
+  for (const auto& sample : samples) {
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+    total_size += sample->size();
+  }
+  std::shared_ptr<Buffer> concatenated;
+  RETURN_NOT_OK(AllocateBuffer(total_size, &concatenated));
+  uint8_t* out = concatenated->mutable_data();
+  for (const auto& sample : samples) {
+    std::memcpy(out, sample->data(), static_cast<size_t>(sample->size()));
+    out += sample->size();
+  }
+
+  std::shared_ptr<ResizableBuffer> dictionary;
+  RETURN_NOT_OK(AllocateResizableBuffer(max_dictionary_size, &dictionary));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size),
+      concatenated->data(), sample_sizes.data(), static_cast<unsigned>(samples.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return dictionary;
+}
+
 }  // namespace util
 }  // namespace arrow
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
@@ -50,8 +51,22 @@ class ARROW_EXPORT ZSTDCodec : public Codec {
 
   const char* name() const override { return "zstd"; }
 
+  bool SupportsDictionary() const override { return true; }
+
+  Status SetDictionary(std::shared_ptr<Buffer> dictionary) override;
+
+  std::shared_ptr<Buffer> dictionary() const override;
+
+  /// \brief Train a ZSTD dictionary, see Codec::TrainDictionary
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size);
+
+  // Digested dictionary, shared with the compressors and decompressors
+  struct Dictionary;
+
  private:
   int compression_level_;
+  std::shared_ptr<Dictionary> dictionary_;
 };
 
 }  // namespace util
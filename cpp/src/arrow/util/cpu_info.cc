@@ -43,8 +43,12 @@
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
@@ -70,6 +74,15 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx", CpuInfo::AVX},
+    {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512F},
+    {"avx512cd", CpuInfo::AVX512CD},
+    {"avx512vl", CpuInfo::AVX512VL},
+    {"avx512dq", CpuInfo::AVX512DQ},
+    {"avx512bw", CpuInfo::AVX512BW},
+    {"bmi1", CpuInfo::BMI1},
+    {"bmi2", CpuInfo::BMI2},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -78,13 +91,18 @@ namespace {
 
 // Helper function to parse for hardware flags.
 // values contains a list of space-separated flags.  check to see if the flags we
-// care about are present.
+// care about are present, matching whole words since some names are prefixes
+// of others (e.g. avx of avx2).
 // Returns a bitmap of flags.
 int64_t ParseCPUFlags(const std::string& values) {
   int64_t flags = 0;
-  for (int i = 0; i < num_flags; ++i) {
-    if (values.find(flag_mappings[i].name) != std::string::npos) {
-      flags |= flag_mappings[i].flag;
+  std::istringstream stream(values);
+  std::string value;
+  while (stream >> value) {
+    for (int i = 0; i < num_flags; ++i) {
+      if (value == flag_mappings[i].name) {
+        flags |= flag_mappings[i].flag;
+      }
     }
   }
   return flags;
@@ -139,6 +157,17 @@ bool RetrieveCacheSize(int64_t* cache_sizes) {
   return true;
 }
 
+// The extended states which the OS saves on context switches
+uint64_t ReadXCR0() {
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
 bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (!hardware_flags || !model_name) {
     return false;
@@ -176,6 +205,27 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // The AVX registers can only be used if the OS saves them, as told by XCR0
+  const bool os_saves_ymm =
+      features_ECX[27] && (ReadXCR0() & 0x06) == 0x06;  // XMM and YMM state
+  const bool os_saves_zmm = os_saves_ymm && (ReadXCR0() & 0xe0) == 0xe0;
+  if (features_ECX[28] && os_saves_ymm) *hardware_flags |= CpuInfo::AVX;
+
+  if (highest_valid_id >= 7) {
+    __cpuidex(cpu_info.data(), 7, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[3]) *hardware_flags |= CpuInfo::BMI1;
+    if (features_EBX[8]) *hardware_flags |= CpuInfo::BMI2;
+    if (features_EBX[5] && os_saves_ymm) *hardware_flags |= CpuInfo::AVX2;
+    if (os_saves_zmm) {
+      if (features_EBX[16]) *hardware_flags |= CpuInfo::AVX512F;
+      if (features_EBX[17]) *hardware_flags |= CpuInfo::AVX512DQ;
+      if (features_EBX[28]) *hardware_flags |= CpuInfo::AVX512CD;
+      if (features_EBX[30]) *hardware_flags |= CpuInfo::AVX512BW;
+      if (features_EBX[31]) *hardware_flags |= CpuInfo::AVX512VL;
+    }
+  }
   return true;
 }
 #endif
@@ -241,6 +291,26 @@ void CpuInfo::Init() {
 #endif
 
 #ifdef __APPLE__
+  // On Mac OS X, /proc/cpuinfo doesn't exist: sysctl() tells the features
+  const struct {
+    const char* name;
+    int64_t flag;
+  } sysctl_flags[] = {
+      {"hw.optional.supplementalsse3", SSSE3}, {"hw.optional.sse4_1", SSE4_1},
+      {"hw.optional.sse4_2", SSE4_2},          {"hw.optional.avx1_0", AVX},
+      {"hw.optional.avx2_0", AVX2},            {"hw.optional.bmi1", BMI1},
+      {"hw.optional.bmi2", BMI2},              {"hw.optional.avx512f", AVX512F},
+      {"hw.optional.avx512cd", AVX512CD},      {"hw.optional.avx512vl", AVX512VL},
+      {"hw.optional.avx512dq", AVX512DQ},      {"hw.optional.avx512bw", AVX512BW},
+  };
+  for (const auto& feature : sysctl_flags) {
+    int enabled = 0;
+    size_t enabled_len = sizeof(enabled);
+    if (sysctlbyname(feature.name, &enabled, &enabled_len, NULL, 0) == 0 && enabled) {
+      hardware_flags_ |= feature.flag;
+    }
+  }
+
   // On Mac OS X use sysctl() to get the cache sizes
   size_t len = 0;
   sysctlbyname("hw.cachesize", NULL, &len, NULL, 0);
@@ -268,6 +338,7 @@ void CpuInfo::Init() {
     cycles_per_ms_ = 1000000;
   }
   original_hardware_flags_ = hardware_flags_;
+  ApplyUserSimdLevel();
 
   if (num_cores > 0) {
     num_cores_ = num_cores;
@@ -276,6 +347,30 @@ void CpuInfo::Init() {
   }
 }
 
+void CpuInfo::ApplyUserSimdLevel() {
+  auto maybe_level = GetEnvVar("ARROW_USER_SIMD_LEVEL");
+  if (!maybe_level.ok()) {
+    return;
+  }
+  const std::string level = *maybe_level;
+  // The features of each level and above, which are disabled below it
+  const int64_t avx512 = CpuInfo::AVX512;
+  const int64_t avx2 = CpuInfo::AVX2 | CpuInfo::BMI1 | CpuInfo::BMI2 | avx512;
+  const int64_t avx = CpuInfo::AVX | avx2;
+  const int64_t sse4_2 = CpuInfo::SSE4_2 | avx;
+  if (level == "NONE") {
+    hardware_flags_ &= ~sse4_2;
+  } else if (level == "SSE4_2") {
+    hardware_flags_ &= ~avx;
+  } else if (level == "AVX") {
+    hardware_flags_ &= ~avx2;
+  } else if (level == "AVX2") {
+    hardware_flags_ &= ~avx512;
+  } else if (level != "AVX512" && !level.empty()) {
+    ARROW_LOG(WARNING) << "Invalid value for ARROW_USER_SIMD_LEVEL: " << level;
+  }
+}
+
 void CpuInfo::VerifyCpuRequirements() {
   if (!IsSupported(CpuInfo::SSSE3)) {
     DCHECK(false) << "CPU does not support the Supplemental SSE3 instruction set";
@@ -39,6 +39,18 @@ class ARROW_EXPORT CpuInfo {
   static constexpr int64_t SSE4_1 = (1 << 2);
   static constexpr int64_t SSE4_2 = (1 << 3);
   static constexpr int64_t POPCNT = (1 << 4);
+  static constexpr int64_t AVX = (1 << 5);
+  static constexpr int64_t AVX2 = (1 << 6);
+  static constexpr int64_t AVX512F = (1 << 7);
+  static constexpr int64_t AVX512CD = (1 << 8);
+  static constexpr int64_t AVX512VL = (1 << 9);
+  static constexpr int64_t AVX512DQ = (1 << 10);
+  static constexpr int64_t AVX512BW = (1 << 11);
+  static constexpr int64_t BMI1 = (1 << 12);
+  static constexpr int64_t BMI2 = (1 << 13);
+
+  /// The AVX-512 subsets that kernels built for AVX-512 may use
+  static constexpr int64_t AVX512 = AVX512F | AVX512CD | AVX512VL | AVX512DQ | AVX512BW;
 
   /// Cache enums for L1 (data), L2 and L3
   enum CacheLevel {
@@ -59,6 +71,9 @@ class ARROW_EXPORT CpuInfo {
   /// Returns whether of not the cpu supports this flag
   bool IsSupported(int64_t flag) const { return (hardware_flags_ & flag) != 0; }
 
+  /// Returns whether the cpu supports all of these flags
+  bool IsSupportedAll(int64_t flags) const { return (hardware_flags_ & flags) == flags; }
+
   /// \brief The processor supports SSE4.2 and the Arrow libraries are built
   /// with support for it
   bool CanUseSSE4_2() const;
@@ -87,6 +102,10 @@ class ARROW_EXPORT CpuInfo {
   /// Inits CPU cache size variables with default values
   void SetDefaultCacheSize();
 
+  /// Disables the features above the level set by the ARROW_USER_SIMD_LEVEL
+  /// environment variable, if any
+  void ApplyUserSimdLevel();
+
   int64_t hardware_flags_;
   int64_t original_hardware_flags_;
   int64_t cache_sizes_[L3_CACHE + 1];
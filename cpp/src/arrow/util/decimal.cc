@@ -21,15 +21,14 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
-#include <iomanip>
 #include <limits>
 #include <ostream>
-#include <sstream>
 #include <string>
 
 #include "arrow/status.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -44,46 +43,65 @@ Decimal128::Decimal128(const std::string& str) : Decimal128() {
   *this = Decimal128::FromString(str).ValueOrDie();
 }
 
-static const Decimal128 kTenTo36(static_cast<int64_t>(0xC097CE7BC90715),
-                                 0xB34B9F1000000000);
 static const Decimal128 kTenTo18(0xDE0B6B3A7640000);
 
-std::string Decimal128::ToIntegerString() const {
-  Decimal128 remainder;
-  std::stringstream buf;
-  bool need_fill = false;
-
-  // get anything above 10 ** 36 and print it
-  Decimal128 top;
-  std::tie(top, remainder) = Divide(kTenTo36).ValueOrDie();
-
-  if (top != 0) {
-    buf << static_cast<int64_t>(top);
-    remainder.Abs();
-    need_fill = true;
+// Write the base 10 digits of a value, at least `min_digits` of them, to the
+// chars before `end`, and return the first one
+static char* FormatDigitsBackward(uint64_t value, int min_digits, char* end) {
+  char* ptr = end;
+  while (value >= 100) {
+    const char* digit_pair = internal::detail::FormatTwoDigits(value % 100);
+    *--ptr = digit_pair[1];
+    *--ptr = digit_pair[0];
+    value /= 100;
   }
+  if (value >= 10) {
+    const char* digit_pair = internal::detail::FormatTwoDigits(value);
+    *--ptr = digit_pair[1];
+    *--ptr = digit_pair[0];
+  } else {
+    *--ptr = internal::detail::FormatDigit(value);
+  }
+  while (end - ptr < min_digits) {
+    *--ptr = '0';
+  }
+  return ptr;
+}
 
-  // now get anything above 10 ** 18 and print it
-  Decimal128 tail;
-  std::tie(top, tail) = remainder.Divide(kTenTo18).ValueOrDie();
-
-  if (need_fill || top != 0) {
-    if (need_fill) {
-      buf << std::setw(18) << std::setfill('0');
-    } else {
-      need_fill = true;
-      tail.Abs();
+int32_t Decimal128::ToIntegerChars(char* out) const {
+  // The value is split in chunks of 18 digits, of which there are at most 3,
+  // formatted from the least significant one.  The remainders take the sign
+  // of the value, which keeps the minimum value from overflowing.
+  char buffer[kMaxStringLength];
+  char* const end = buffer + kMaxStringLength;
+  char* ptr = end;
+  const bool is_negative = high_bits() < 0;
+  Decimal128 value = *this;
+  while (true) {
+    Decimal128 quotient, remainder;
+    auto dstatus = value.BasicDecimal128::Divide(kTenTo18, &quotient, &remainder);
+    DCHECK_EQ(dstatus, DecimalStatus::kSuccess);
+    ARROW_UNUSED(dstatus);
+    const auto chunk = static_cast<int64_t>(remainder.low_bits());
+    const auto abs_chunk = static_cast<uint64_t>(chunk < 0 ? -chunk : chunk);
+    value = quotient;
+    if (value == 0) {
+      ptr = FormatDigitsBackward(abs_chunk, 1, ptr);
+      break;
     }
-
-    buf << static_cast<int64_t>(top);
+    ptr = FormatDigitsBackward(abs_chunk, 18, ptr);
   }
-
-  // finally print the tail, which is less than 10**18
-  if (need_fill) {
-    buf << std::setw(18) << std::setfill('0');
+  if (is_negative) {
+    *--ptr = '-';
   }
-  buf << static_cast<int64_t>(tail);
-  return buf.str();
+  const auto length = static_cast<int32_t>(end - ptr);
+  memcpy(out, ptr, length);
+  return length;
+}
+
+std::string Decimal128::ToIntegerString() const {
+  char buffer[kMaxStringLength];
+  return std::string(buffer, ToIntegerChars(buffer));
 }
 
 Decimal128::operator int64_t() const {
@@ -94,64 +112,67 @@ Decimal128::operator int64_t() const {
   return static_cast<int64_t>(low_bits());
 }
 
-static std::string ToStringNegativeScale(const std::string& str,
-                                         int32_t adjusted_exponent, bool is_negative) {
-  std::stringstream buf;
-
-  size_t offset = 0;
-  buf << str[offset++];
-
-  if (is_negative) {
-    buf << str[offset++];
-  }
-
-  buf << '.' << str.substr(offset, std::string::npos) << 'E' << std::showpos
-      << adjusted_exponent;
-  return buf.str();
-}
-
-std::string Decimal128::ToString(int32_t scale) const {
-  const std::string str(ToIntegerString());
-
+int32_t Decimal128::ToChars(int32_t scale, char* out) const {
   if (scale == 0) {
-    return str;
+    return ToIntegerChars(out);
   }
 
+  char str[kMaxStringLength];
+  const int32_t len = ToIntegerChars(str);
   const bool is_negative = *this < 0;
-
-  const auto len = static_cast<int32_t>(str.size());
   const auto is_negative_offset = static_cast<int32_t>(is_negative);
   const int32_t adjusted_exponent = -scale + (len - 1 - is_negative_offset);
+  char* ptr = out;
 
   /// Note that the -6 is taken from the Java BigDecimal documentation.
   if (scale < 0 || adjusted_exponent < -6) {
-    return ToStringNegativeScale(str, adjusted_exponent, is_negative);
+    // The sign and first digit, then the other digits after a dot and the
+    // (always signed) exponent
+    const int32_t offset = 1 + is_negative_offset;
+    memcpy(ptr, str, offset);
+    ptr += offset;
+    *ptr++ = '.';
+    memcpy(ptr, str + offset, len - offset);
+    ptr += len - offset;
+    *ptr++ = 'E';
+    *ptr++ = adjusted_exponent < 0 ? '-' : '+';
+    const auto abs_exponent = static_cast<uint64_t>(std::abs(
+        static_cast<int64_t>(adjusted_exponent)));
+    char exponent[kMaxStringLength];
+    char* const exponent_end = exponent + kMaxStringLength;
+    const char* exponent_start = FormatDigitsBackward(abs_exponent, 1, exponent_end);
+    memcpy(ptr, exponent_start, exponent_end - exponent_start);
+    ptr += exponent_end - exponent_start;
+    return static_cast<int32_t>(ptr - out);
   }
 
   if (is_negative) {
-    if (len - 1 > scale) {
-      const auto n = static_cast<size_t>(len - scale);
-      return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
-    }
-
-    if (len - 1 == scale) {
-      return "-0." + str.substr(1, std::string::npos);
-    }
-
-    std::string result("-0." + std::string(static_cast<size_t>(scale - len + 1), '0'));
-    return result + str.substr(1, std::string::npos);
-  }
-
-  if (len > scale) {
-    const auto n = static_cast<size_t>(len - scale);
-    return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
+    *ptr++ = '-';
   }
-
-  if (len == scale) {
-    return "0." + str;
+  const char* digits = str + is_negative_offset;
+  const int32_t num_digits = len - is_negative_offset;
+  if (num_digits > scale) {
+    // Whole digits, a dot and fractional digits
+    memcpy(ptr, digits, num_digits - scale);
+    ptr += num_digits - scale;
+    *ptr++ = '.';
+    memcpy(ptr, digits + num_digits - scale, scale);
+    ptr += scale;
+  } else {
+    // "0.", leading zeros and the digits
+    *ptr++ = '0';
+    *ptr++ = '.';
+    memset(ptr, '0', scale - num_digits);
+    ptr += scale - num_digits;
+    memcpy(ptr, digits, num_digits);
+    ptr += num_digits;
   }
+  return static_cast<int32_t>(ptr - out);
+}
 
-  return "0." + std::string(static_cast<size_t>(scale - len), '0') + str;
+std::string Decimal128::ToString(int32_t scale) const {
+  char buffer[kMaxStringLength];
+  return std::string(buffer, ToChars(scale, buffer));
 }
 
 static constexpr auto kInt64DecimalDigits =
@@ -178,14 +199,16 @@ static constexpr int64_t kPowersOfTen[kInt64DecimalDigits + 1] = {1LL,
 
 // Iterates over data and for each group of kInt64DecimalDigits multiple out by
 // the appropriate power of 10 necessary to add source parsed as uint64 and
-// then adds the parsed value of source.
+// then adds the parsed value of source.  The data was checked to only have
+// digits.
 static inline void ShiftAndAdd(const char* data, size_t length, Decimal128* out) {
-  internal::StringConverter<Int64Type> converter;
   for (size_t posn = 0; posn < length;) {
     const size_t group_size = std::min(kInt64DecimalDigits, length - posn);
     const int64_t multiple = kPowersOfTen[group_size];
     int64_t chunk = 0;
-    ARROW_CHECK(converter(data + posn, group_size, &chunk));
+    for (const char* p = data + posn; p < data + posn + group_size; ++p) {
+      chunk = chunk * 10 + (*p - '0');
+    }
 
     *out *= multiple;
     *out += chunk;
@@ -107,6 +107,20 @@ class ARROW_EXPORT Decimal128 : public BasicDecimal128 {
   /// \brief Convert the value to an integer string
   std::string ToIntegerString() const;
 
+  /// \brief The maximum length of the strings written by ToChars and
+  /// ToIntegerChars
+  static constexpr int32_t kMaxStringLength = 64;
+
+  /// \brief Write the base 10 decimal string with the given scale (as returned
+  /// by ToString) to a buffer of at least kMaxStringLength chars
+  /// \return the length of the string
+  int32_t ToChars(int32_t scale, char* out) const;
+
+  /// \brief Write the integer string (as returned by ToIntegerString) to a
+  /// buffer of at least kMaxStringLength chars
+  /// \return the length of the string
+  int32_t ToIntegerChars(char* out) const;
+
   /// \brief Cast this value to an int64_t.
   explicit operator int64_t() const;
 
@@ -44,6 +44,58 @@ static void FromString(benchmark::State& state) {  // NOLINT non-const reference
   state.SetItemsProcessed(state.iterations() * values.size());
 }
 
+static void ToString(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<std::pair<Decimal128, int32_t>> values = {
+      {Decimal128(0), 0},
+      {Decimal128(123), 2},
+      {Decimal128(12345), -3},
+      {Decimal128("-12345"), 9},
+      {Decimal128("123456789123456789"), 9},
+      {Decimal128("1231234567890451234567890"), 12}};
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(value.first.ToString(value.second));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void ToChars(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<std::pair<Decimal128, int32_t>> values = {
+      {Decimal128(0), 0},
+      {Decimal128(123), 2},
+      {Decimal128(12345), -3},
+      {Decimal128("-12345"), 9},
+      {Decimal128("123456789123456789"), 9},
+      {Decimal128("1231234567890451234567890"), 12}};
+  char buffer[Decimal128::kMaxStringLength];
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(value.first.ToChars(value.second, buffer));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void Rescale(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<std::pair<Decimal128, int32_t>> values = {
+      {Decimal128(0), 0},
+      {Decimal128(123), 2},
+      {Decimal128("-12345"), 5},
+      {Decimal128("123456789123456789"), 9}};
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      // Up to the scale of a CSV column, and back
+      auto rescaled = value.first.Rescale(value.second, 18).ValueOrDie();
+      benchmark::DoNotOptimize(rescaled.Rescale(18, value.second));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size() * 2);
+}
+
 constexpr int32_t kValueSize = 10;
 
 static void BinaryCompareOp(benchmark::State& state) {  // NOLINT non-const reference
@@ -117,6 +169,41 @@ static void BinaryMathOp(benchmark::State& state) {  // NOLINT non-const referen
   state.SetItemsProcessed(state.iterations() * kValueSize);
 }
 
+static void BinaryMultiply(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(100 + x, 100 + x);
+    v2.emplace_back(-x, 200 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; x++) {
+      benchmark::DoNotOptimize(v1[x] * v2[x]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void BinaryDivide(benchmark::State& state) {  // NOLINT non-const reference
+  // Divisors of one, two and three 32-bit words, and 64-bit values
+  std::vector<BasicDecimal128> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(100 + x, 100 + x);
+    v2.emplace_back(0, 3 + x);
+    v1.emplace_back(0, 1000000000000LL + x);
+    v2.emplace_back(0, 1000000007LL * (x + 1));
+    v1.emplace_back(-(100 + x), 100 + x);
+    v2.emplace_back(x, 1000000007);
+  }
+
+  for (auto _ : state) {
+    for (size_t x = 0; x < v1.size(); x++) {
+      benchmark::DoNotOptimize(v1[x] / v2[x]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * v1.size());
+}
+
 static void UnaryOp(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal128> v;
   for (int x = 0; x < kValueSize; x++) {
@@ -158,7 +245,12 @@ static void BinaryBitOp(benchmark::State& state) {  // NOLINT non-const referenc
 }
 
 BENCHMARK(FromString);
+BENCHMARK(ToString);
+BENCHMARK(ToChars);
+BENCHMARK(Rescale);
 BENCHMARK(BinaryMathOp);
+BENCHMARK(BinaryMultiply);
+BENCHMARK(BinaryDivide);
 BENCHMARK(BinaryMathOpAggregate);
 BENCHMARK(BinaryCompareOp);
 BENCHMARK(BinaryCompareOpConstant);
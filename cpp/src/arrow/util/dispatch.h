@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief An instruction set for which a kernel may be built
+///
+/// The code of the levels above NONE lives in translation units compiled
+/// with the flags of the instruction set, which are only built if
+/// ARROW_HAVE_RUNTIME_<LEVEL> is defined (see ARROW_RUNTIME_SIMD_LEVEL).
+/// The inline functions and templates those units instantiate must depend
+/// on the level (e.g. take it as a template parameter): the linker keeps a
+/// single copy of an inline function, which mustn't be one built for an
+/// instruction set the CPU lacks.
+enum class DispatchLevel : int {
+  NONE = 0,
+  SSE4_2,
+  AVX2,
+  AVX512,
+};
+
+/// \brief Whether the CPU supports a level, and the user didn't disable it
+/// with the ARROW_USER_SIMD_LEVEL environment variable
+inline bool IsDispatchLevelSupported(DispatchLevel level) {
+  auto cpu_info = CpuInfo::GetInstance();
+  switch (level) {
+    case DispatchLevel::NONE:
+      return true;
+    case DispatchLevel::SSE4_2:
+      return cpu_info->IsSupported(CpuInfo::SSE4_2);
+    case DispatchLevel::AVX2:
+      return cpu_info->IsSupported(CpuInfo::AVX2);
+    case DispatchLevel::AVX512:
+      // BMI2 comes with all AVX-512 CPUs, and is enabled with it
+      return cpu_info->IsSupportedAll(CpuInfo::AVX512 | CpuInfo::BMI2);
+  }
+  return false;
+}
+
+/// \brief The implementation of a function for the best level supported at
+/// runtime
+///
+/// DynamicFunction declares the FunctionType of the implementations, and a
+/// static implementations() returning them with their level.  It must
+/// include a NONE implementation.  Resolve the function once, e.g. in a
+/// function-local static, as checking the levels isn't free:
+///
+/// \code
+/// struct SumDispatch {
+///   using FunctionType = int64_t (*)(const int32_t*, int64_t);
+///   static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+///     return {{DispatchLevel::NONE, SumScalar},
+/// #ifdef ARROW_HAVE_RUNTIME_AVX2
+///             {DispatchLevel::AVX2, SumAvx2},
+/// #endif
+///     };
+///   }
+/// };
+///
+/// static DynamicDispatch<SumDispatch> dispatch;
+/// return dispatch.func(values, length);
+/// \endcode
+template <typename DynamicFunction>
+class DynamicDispatch {
+ public:
+  using FunctionType = typename DynamicFunction::FunctionType;
+  using Implementation = std::pair<DispatchLevel, FunctionType>;
+
+  DynamicDispatch() { Resolve(DynamicFunction::implementations()); }
+
+  /// The level of the resolved implementation
+  DispatchLevel level = DispatchLevel::NONE;
+
+  FunctionType func = {};
+
+ private:
+  void Resolve(const std::vector<Implementation>& implementations) {
+    bool resolved = false;
+    for (const auto& implementation : implementations) {
+      if ((!resolved || implementation.first > level) &&
+          IsDispatchLevelSupported(implementation.first)) {
+        level = implementation.first;
+        func = implementation.second;
+        resolved = true;
+      }
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/dispatch.h"
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace internal {
+
+int ImplementationNone() { return 0; }
+int ImplementationSse4_2() { return 1; }
+int ImplementationAvx2() { return 2; }
+int ImplementationAvx512() { return 3; }
+
+struct TestDispatch {
+  using FunctionType = int (*)();
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    // Not in order, to check that the best level wins regardless
+    return {{DispatchLevel::AVX2, ImplementationAvx2},
+            {DispatchLevel::NONE, ImplementationNone},
+            {DispatchLevel::AVX512, ImplementationAvx512},
+            {DispatchLevel::SSE4_2, ImplementationSse4_2}};
+  }
+};
+
+struct TestDispatchNoneOnly {
+  using FunctionType = int (*)();
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, ImplementationNone}};
+  }
+};
+
+TEST(DynamicDispatch, BestSupportedLevel) {
+  DispatchLevel expected = DispatchLevel::NONE;
+  for (auto level :
+       {DispatchLevel::SSE4_2, DispatchLevel::AVX2, DispatchLevel::AVX512}) {
+    if (IsDispatchLevelSupported(level)) {
+      expected = level;
+    }
+  }
+
+  DynamicDispatch<TestDispatch> dispatch;
+  ASSERT_EQ(dispatch.level, expected);
+  ASSERT_EQ(dispatch.func(), static_cast<int>(expected));
+}
+
+TEST(DynamicDispatch, NoneOnly) {
+  DynamicDispatch<TestDispatchNoneOnly> dispatch;
+  ASSERT_EQ(dispatch.level, DispatchLevel::NONE);
+  ASSERT_EQ(dispatch.func(), 0);
+}
+
+TEST(DynamicDispatch, SupportedLevels) {
+  auto cpu_info = CpuInfo::GetInstance();
+  ASSERT_TRUE(IsDispatchLevelSupported(DispatchLevel::NONE));
+  ASSERT_EQ(IsDispatchLevelSupported(DispatchLevel::AVX2),
+            cpu_info->IsSupported(CpuInfo::AVX2));
+  // AVX-512 requires all its subsets, and BMI2
+  ASSERT_EQ(IsDispatchLevelSupported(DispatchLevel::AVX512),
+            cpu_info->IsSupportedAll(CpuInfo::AVX512 | CpuInfo::BMI2));
+  if (IsDispatchLevelSupported(DispatchLevel::AVX512)) {
+    ASSERT_TRUE(cpu_info->IsSupported(CpuInfo::AVX2));
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
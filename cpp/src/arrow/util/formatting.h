@@ -18,6 +18,7 @@
 // This is a private header for number-to-string formatting utilities
 
 #include <cassert>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -27,6 +28,8 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/visibility.h"
 
@@ -46,6 +49,20 @@ class StringFormatter<BooleanType> {
 
   using value_type = bool;
 
+  static constexpr int buffer_size = 5;
+
+  // Format a value into `out`, which must have room for `buffer_size`
+  // characters, returning the number of characters written
+  static int FormatValue(bool value, char* out) {
+    if (value) {
+      std::memcpy(out, "true", 4);
+      return 4;
+    } else {
+      std::memcpy(out, "false", 5);
+      return 5;
+    }
+  }
+
   template <typename Appender>
   Status operator()(bool value, Appender&& append) {
     if (value) {
@@ -78,6 +95,40 @@ inline const char* FormatTwoDigits(Int value) {
   return digit_pairs + (value * 2);
 }
 
+// The number of decimal digits of an unsigned value
+template <typename UInt>
+inline int CountDigits(UInt value) {
+  int digits = 1;
+  while (true) {
+    if (value < 10) return digits;
+    if (value < 100) return digits + 1;
+    if (value < 1000) return digits + 2;
+    if (value < 10000) return digits + 3;
+    value = static_cast<UInt>(value / 10000);
+    digits += 4;
+  }
+}
+
+// Write the decimal digits of an unsigned value backward, ending at `*cursor`
+template <typename UInt>
+inline void FormatAllDigits(UInt value, char** cursor) {
+  // Algorithm based on fmtlib's format_int class
+  while (value >= 100) {
+    UInt next_value = static_cast<UInt>(value / 100);
+    const char* digit_pair = FormatTwoDigits(value % 100);
+    *--*cursor = digit_pair[1];
+    *--*cursor = digit_pair[0];
+    value = next_value;
+  }
+  if (value < 10) {
+    *--*cursor = FormatDigit(value);
+  } else {
+    const char* digit_pair = FormatTwoDigits(value);
+    *--*cursor = digit_pair[1];
+    *--*cursor = digit_pair[0];
+  }
+}
+
 }  // namespace detail
 
 template <typename ARROW_TYPE>
@@ -92,48 +143,33 @@ class IntToStringFormatterMixin {
   static constexpr int buffer_size =
       (is_signed ? 2 : 1) + std::numeric_limits<value_type>::digits10;
 
-  template <typename Appender>
-  Status operator()(value_type value, Appender&& append) {
-    char buffer[buffer_size];
-    char* ptr = buffer + buffer_size;
-    int32_t size = 0;
-    bool sign = is_signed && (value < 0);
+  // Format a value into `out`, which must have room for `buffer_size`
+  // characters, returning the number of characters written
+  static int FormatValue(value_type value, char* out) {
+    const bool sign = is_signed && (value < 0);
     unsigned_type v;
 
     if (sign) {
       // Avoid warnings (unsigned negation) and undefined behaviour (signed negation
       // overflow)
-      v = ~static_cast<unsigned_type>(value) + 1;
+      v = static_cast<unsigned_type>(~static_cast<unsigned_type>(value) + 1);
+      *out++ = '-';
     } else {
       v = static_cast<unsigned_type>(value);
     }
 
-    // Algorithm based on fmtlib's format_int class
-    while (v >= 100) {
-      unsigned_type next_value = v / 100;
-      const char* digit_pair = detail::FormatTwoDigits(v % 100);
-      *--ptr = digit_pair[1];
-      *--ptr = digit_pair[0];
-      size += 2;
-      v = next_value;
-    }
-    if (v < 10) {
-      *--ptr = detail::FormatDigit(v);
-      ++size;
-    } else {
-      const char* digit_pair = detail::FormatTwoDigits(v);
-      *--ptr = digit_pair[1];
-      *--ptr = digit_pair[0];
-      size += 2;
-    }
-
-    if (sign) {
-      *--ptr = '-';
-      ++size;
-    }
+    // Write the digits backward from their end, which is known up front
+    const int num_digits = detail::CountDigits(v);
+    char* ptr = out + num_digits;
+    detail::FormatAllDigits(v, &ptr);
+    assert(ptr == out);
+    return num_digits + (sign ? 1 : 0);
+  }
 
-    assert(ptr >= buffer);
-    return append(util::string_view(ptr, size));
+  template <typename Appender>
+  Status operator()(value_type value, Appender&& append) {
+    char buffer[buffer_size];
+    return append(util::string_view(buffer, FormatValue(value, buffer)));
   }
 };
 
@@ -203,6 +239,12 @@ class FloatToStringFormatterMixin : public FloatToStringFormatter {
 
   explicit FloatToStringFormatterMixin(const std::shared_ptr<DataType>& = NULLPTR) {}
 
+  // Format a value into `out`, which must have room for `buffer_size`
+  // characters, returning the number of characters written
+  int FormatValue(value_type value, char* out) {
+    return FormatFloat(value, out, buffer_size);
+  }
+
   template <typename Appender>
   Status operator()(value_type value, Appender&& append) {
     char buffer[buffer_size];
@@ -223,5 +265,32 @@ class StringFormatter<DoubleType> : public FloatToStringFormatterMixin<DoubleTyp
   using FloatToStringFormatterMixin::FloatToStringFormatterMixin;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Decimal formatting
+
+template <>
+class StringFormatter<Decimal128Type> {
+ public:
+  explicit StringFormatter(const std::shared_ptr<DataType>& type)
+      : scale_(checked_cast<const Decimal128Type&>(*type).scale()) {}
+
+  using value_type = Decimal128;
+
+  static constexpr int buffer_size = Decimal128::kMaxStringLength;
+
+  int FormatValue(const Decimal128& value, char* out) {
+    return value.ToChars(scale_, out);
+  }
+
+  template <typename Appender>
+  Status operator()(const Decimal128& value, Appender&& append) {
+    char buffer[Decimal128::kMaxStringLength];
+    return append(util::string_view(buffer, value.ToChars(scale_, buffer)));
+  }
+
+ private:
+  int32_t scale_;
+};
+
 }  // namespace internal
 }  // namespace arrow
@@ -25,6 +25,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/formatting.h"
 
 namespace arrow {
@@ -279,4 +280,33 @@ TEST(Formatting, Double) {
   AssertFormatting(formatter, -HUGE_VAL, "-inf");
 }
 
+TEST(Formatting, Decimal128) {
+  {
+    StringFormatter<Decimal128Type> formatter(decimal(38, 0));
+
+    AssertFormatting(formatter, Decimal128(0), "0");
+    AssertFormatting(formatter, Decimal128(-123), "-123");
+    AssertFormatting(formatter, Decimal128("99999999999999999999999999999999999999"),
+                     "99999999999999999999999999999999999999");
+    AssertFormatting(formatter, Decimal128("-1000000000000000000"),
+                     "-1000000000000000000");
+  }
+  {
+    StringFormatter<Decimal128Type> formatter(decimal(20, 4));
+
+    AssertFormatting(formatter, Decimal128(0), "0.0000");
+    AssertFormatting(formatter, Decimal128(12345), "1.2345");
+    AssertFormatting(formatter, Decimal128(-123), "-0.0123");
+    AssertFormatting(formatter, Decimal128("-1234567890123456789012"),
+                     "-123456789012345678.9012");
+  }
+  {
+    // Exponent notation, as with Decimal128::ToString
+    StringFormatter<Decimal128Type> formatter(decimal(10, 12));
+
+    AssertFormatting(formatter, Decimal128(12), "1.2E-11");
+    AssertFormatting(formatter, Decimal128(-12345), "-1.2345E-8");
+  }
+}
+
 }  // namespace arrow
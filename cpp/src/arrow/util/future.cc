@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/future.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace detail {
+
+struct FutureImpl::Impl {
+  mutable std::mutex mutex;
+  mutable std::condition_variable cv;
+  bool finished = false;
+  std::vector<std::function<void()>> callbacks;
+};
+
+FutureImpl::FutureImpl() : impl_(new Impl()) {}
+
+FutureImpl::~FutureImpl() {}
+
+bool FutureImpl::is_finished() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->finished;
+}
+
+void FutureImpl::Wait() const {
+  std::unique_lock<std::mutex> lock(impl_->mutex);
+  impl_->cv.wait(lock, [this] { return impl_->finished; });
+}
+
+bool FutureImpl::Wait(double seconds) const {
+  std::unique_lock<std::mutex> lock(impl_->mutex);
+  return impl_->cv.wait_for(lock, std::chrono::duration<double>(seconds),
+                            [this] { return impl_->finished; });
+}
+
+void FutureImpl::MarkFinished() {
+  std::vector<std::function<void()>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    DCHECK(!impl_->finished) << "Future marked finished twice";
+    impl_->finished = true;
+    callbacks.swap(impl_->callbacks);
+  }
+  impl_->cv.notify_all();
+  // The callbacks may add callbacks to this future, so they run unlocked
+  for (auto& callback : callbacks) {
+    callback();
+  }
+}
+
+void FutureImpl::AddCallback(std::function<void()> callback) {
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    if (!impl_->finished) {
+      impl_->callbacks.push_back(std::move(callback));
+      return;
+    }
+  }
+  callback();
+}
+
+}  // namespace detail
+}  // namespace arrow
@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \brief The value of a Future<> which only signals completion
+struct Empty {};
+
+template <typename T = Empty>
+class Future;
+
+namespace detail {
+
+// The untyped state of a future: completion, waiting and callbacks.
+// Callbacks run on the thread which marks the future finished, or on the
+// thread adding them if the future is already finished.
+class ARROW_EXPORT FutureImpl {
+ public:
+  FutureImpl();
+  ~FutureImpl();
+
+  bool is_finished() const;
+  void Wait() const;
+  bool Wait(double seconds) const;
+  // Run the callbacks, once the typed state holds the result
+  void MarkFinished();
+  void AddCallback(std::function<void()> callback);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+template <typename T>
+struct FutureState {
+  FutureImpl impl;
+  util::optional<Result<T>> result;
+};
+
+// The future type of the result of a callback, flattening futures and
+// results
+template <typename R>
+struct EnsureFuture {
+  using type = Future<R>;
+};
+
+template <typename U>
+struct EnsureFuture<Result<U>> {
+  using type = Future<U>;
+};
+
+template <>
+struct EnsureFuture<Status> {
+  using type = Future<>;
+};
+
+template <>
+struct EnsureFuture<void> {
+  using type = Future<>;
+};
+
+template <typename U>
+struct EnsureFuture<Future<U>> {
+  using type = Future<U>;
+};
+
+}  // namespace detail
+
+/// \brief A value, or an error, which is available once some asynchronous
+/// work completes
+///
+/// A Future is a shared handle: copies refer to the same state.  The
+/// producer marks it finished once; consumers wait for it, or chain
+/// callbacks which run when it finishes without blocking a thread.
+template <typename T>
+class Future {
+ public:
+  using ValueType = T;
+
+  /// \brief Create an invalid future, which can only be assigned to
+  Future() = default;
+
+  /// \brief Create a pending future
+  static Future Make() {
+    Future future;
+    future.state_ = std::make_shared<detail::FutureState<T>>();
+    return future;
+  }
+
+  /// \brief Create a future which is already finished
+  static Future MakeFinished(Result<T> result) {
+    Future future = Make();
+    future.MarkFinished(std::move(result));
+    return future;
+  }
+
+  bool is_valid() const { return state_ != NULLPTR; }
+
+  bool is_finished() const { return state_->impl.is_finished(); }
+
+  /// \brief Wait for the future to finish and return its result
+  const Result<T>& result() const {
+    Wait();
+    return *state_->result;
+  }
+
+  /// \brief Wait for the future to finish and return its status
+  Status status() const { return result().status(); }
+
+  void Wait() const { state_->impl.Wait(); }
+
+  /// \brief Wait at most some seconds, returning whether the future finished
+  bool Wait(double seconds) const { return state_->impl.Wait(seconds); }
+
+  /// \brief Store the result and run the callbacks
+  ///
+  /// A future must be marked finished exactly once.
+  void MarkFinished(Result<T> result) {
+    state_->result = std::move(result);
+    state_->impl.MarkFinished();
+  }
+
+  /// \brief Mark a Future<> finished with a status
+  template <typename E = T>
+  typename std::enable_if<std::is_same<E, Empty>::value>::type MarkFinished(
+      Status status = Status::OK()) {
+    if (status.ok()) {
+      MarkFinished(Result<T>(Empty()));
+    } else {
+      MarkFinished(Result<T>(std::move(status)));
+    }
+  }
+
+  /// \brief Call `on_complete(const Result<T>&)` once the future is finished
+  template <typename OnComplete>
+  void AddCallback(OnComplete on_complete) const {
+    auto state = state_;
+    state_->impl.AddCallback(
+        [state, on_complete]() mutable { on_complete(*state->result); });
+  }
+
+  /// \brief Chain a callback on the value of the future
+  ///
+  /// `on_success(const T&)` may return a value, a Result, a Status, nothing
+  /// or another Future, whose value (or error) finishes the returned future.
+  /// Errors of this future are propagated without calling `on_success`.
+  template <typename OnSuccess,
+            typename R = typename std::result_of<OnSuccess && (const T&)>::type,
+            typename NextFuture = typename detail::EnsureFuture<R>::type>
+  NextFuture Then(OnSuccess on_success) const {
+    NextFuture next = NextFuture::Make();
+    AddCallback([next, on_success](const Result<T>& result) mutable {
+      if (!result.ok()) {
+        next.MarkFinished(result.status());
+        return;
+      }
+      ThenImpl<R>::Call(&on_success, *result, next);
+    });
+    return next;
+  }
+
+ private:
+  template <typename R, typename Enable = void>
+  struct ThenImpl {
+    template <typename OnSuccess, typename NextFuture>
+    static void Call(OnSuccess* on_success, const T& value, NextFuture next) {
+      next.MarkFinished((*on_success)(value));
+    }
+  };
+
+  template <typename Dummy>
+  struct ThenImpl<void, Dummy> {
+    template <typename OnSuccess, typename NextFuture>
+    static void Call(OnSuccess* on_success, const T& value, NextFuture next) {
+      (*on_success)(value);
+      next.MarkFinished();
+    }
+  };
+
+  template <typename U, typename Dummy>
+  struct ThenImpl<Future<U>, Dummy> {
+    template <typename OnSuccess, typename NextFuture>
+    static void Call(OnSuccess* on_success, const T& value, NextFuture next) {
+      (*on_success)(value).AddCallback(
+          [next](const Result<U>& result) mutable { next.MarkFinished(result); });
+    }
+  };
+
+  std::shared_ptr<detail::FutureState<T>> state_;
+};
+
+}  // namespace arrow
@@ -0,0 +1,207 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/future.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+// Generators of optional values, whose end is nullopt
+using OptionalInt = util::optional<int>;
+
+std::vector<OptionalInt> Range(int begin, int end) {
+  std::vector<OptionalInt> values;
+  for (int i = begin; i < end; ++i) {
+    values.emplace_back(i);
+  }
+  return values;
+}
+
+std::vector<OptionalInt> Collect(AsyncGenerator<OptionalInt> generator) {
+  auto future = CollectAsyncGenerator(std::move(generator));
+  EXPECT_OK_AND_ASSIGN(auto values, future.result());
+  return values;
+}
+
+// A generator whose values are produced by a thread after a delay
+AsyncGenerator<OptionalInt> MakeSlowGenerator(std::vector<OptionalInt> values) {
+  auto source = MakeVectorGenerator(std::move(values));
+  return [source]() {
+    auto future = Future<OptionalInt>::Make();
+    auto value = source();
+    std::thread([future, value]() mutable {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      future.MarkFinished(value.result());
+    }).detach();
+    return future;
+  };
+}
+
+TEST(Future, MarkFinished) {
+  auto future = Future<int>::Make();
+  ASSERT_TRUE(future.is_valid());
+  ASSERT_FALSE(future.is_finished());
+  ASSERT_FALSE(future.Wait(0.001));
+
+  std::thread thread([future]() mutable { future.MarkFinished(42); });
+  ASSERT_OK_AND_EQ(42, future.result());
+  ASSERT_TRUE(future.is_finished());
+  thread.join();
+
+  ASSERT_RAISES(Invalid,
+                Future<int>::MakeFinished(Status::Invalid("XYZ")).result().status());
+  ASSERT_OK(Future<>::MakeFinished(Empty()).status());
+}
+
+TEST(Future, Callbacks) {
+  auto future = Future<int>::Make();
+  std::vector<int> seen;
+  future.AddCallback([&seen](const Result<int>& result) { seen.push_back(*result); });
+  ASSERT_TRUE(seen.empty());
+  future.MarkFinished(1);
+  ASSERT_EQ(seen, std::vector<int>{1});
+  // A callback added after the future finished runs at once
+  future.AddCallback(
+      [&seen](const Result<int>& result) { seen.push_back(*result + 1); });
+  ASSERT_EQ(seen, std::vector<int>({1, 2}));
+}
+
+TEST(Future, Then) {
+  auto future = Future<int>::Make();
+  auto value = future.Then([](const int& x) { return x * 2; });
+  auto result = future.Then([](const int& x) -> Result<std::string> {
+    return std::to_string(x);
+  });
+  auto status = future.Then([](const int& x) { return Status::Invalid(x); });
+  auto chained =
+      future.Then([](const int& x) { return Future<int>::MakeFinished(x + 1); });
+  ASSERT_FALSE(value.is_finished());
+  future.MarkFinished(21);
+
+  ASSERT_OK_AND_EQ(42, value.result());
+  ASSERT_OK_AND_EQ("21", result.result());
+  ASSERT_RAISES(Invalid, status.status());
+  ASSERT_OK_AND_EQ(22, chained.result());
+
+  // Errors are propagated without calling the callback
+  bool called = false;
+  auto failed = Future<int>::MakeFinished(Status::IOError("")).Then(
+      [&called](const int& x) {
+        called = true;
+        return x;
+      });
+  ASSERT_RAISES(IOError, failed.status());
+  ASSERT_FALSE(called);
+}
+
+TEST(AsyncGenerator, Vector) {
+  ASSERT_EQ(Collect(MakeVectorGenerator(Range(0, 5))), Range(0, 5));
+  ASSERT_EQ(Collect(MakeEmptyGenerator<OptionalInt>()), Range(0, 0));
+}
+
+TEST(AsyncGenerator, Mapped) {
+  auto doubled =
+      MakeMappedGenerator(MakeVectorGenerator(Range(0, 5)),
+                          [](const OptionalInt& x) { return OptionalInt(*x * 2); });
+  ASSERT_EQ(Collect(doubled), std::vector<OptionalInt>({0, 2, 4, 6, 8}));
+
+  auto failed = MakeMappedGenerator(
+      MakeSlowGenerator(Range(0, 5)), [](const OptionalInt& x) -> Result<OptionalInt> {
+        if (*x == 3) {
+          return Status::Invalid("three");
+        }
+        return x;
+      });
+  ASSERT_RAISES(Invalid, CollectAsyncGenerator(failed).status());
+}
+
+TEST(AsyncGenerator, Readahead) {
+  ASSERT_EQ(Collect(MakeReadaheadGenerator(MakeSlowGenerator(Range(0, 50)), 8)),
+            Range(0, 50));
+  ASSERT_EQ(Collect(MakeReadaheadGenerator(MakeVectorGenerator(Range(0, 3)), 8)),
+            Range(0, 3));
+}
+
+TEST(AsyncGenerator, Background) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(4));
+  auto generator = MakeBackgroundGenerator(MakeVectorIterator(Range(0, 100)), pool.get());
+  // Many values are requested at once, and still read in order
+  ASSERT_EQ(Collect(MakeReadaheadGenerator(generator, 16)), Range(0, 100));
+}
+
+TEST(AsyncGenerator, Transferred) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(2));
+  auto main_thread = std::this_thread::get_id();
+  auto transferred =
+      MakeTransferredGenerator(MakeVectorGenerator(Range(0, 10)), pool.get());
+  auto checked = MakeMappedGenerator(
+      transferred, [main_thread](const OptionalInt& x) -> Result<OptionalInt> {
+        if (std::this_thread::get_id() == main_thread) {
+          return Status::Invalid("Not transferred");
+        }
+        return x;
+      });
+  ASSERT_EQ(Collect(checked), Range(0, 10));
+}
+
+TEST(AsyncGenerator, Merged) {
+  std::vector<AsyncGenerator<OptionalInt>> sources = {
+      MakeSlowGenerator(Range(0, 10)), MakeVectorGenerator(Range(10, 20)),
+      MakeEmptyGenerator<OptionalInt>(), MakeSlowGenerator(Range(20, 25))};
+  auto values = Collect(MakeMergedGenerator(std::move(sources)));
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ(values, Range(0, 25));
+
+  ASSERT_EQ(Collect(MakeMergedGenerator(std::vector<AsyncGenerator<OptionalInt>>{})),
+            Range(0, 0));
+}
+
+TEST(AsyncGenerator, Iterator) {
+  auto iterator = MakeGeneratorIterator(MakeSlowGenerator(Range(0, 5)));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_EQ(OptionalInt(i), iterator.Next());
+  }
+  ASSERT_OK_AND_EQ(OptionalInt(), iterator.Next());
+}
+
+TEST(AsyncGenerator, VisitLongSynchronous) {
+  // Synchronously produced values are visited without nesting callbacks
+  int count = 0;
+  auto done = VisitAsyncGenerator<OptionalInt>(MakeVectorGenerator(Range(0, 1000000)),
+                                               [&count](OptionalInt) {
+                                                 ++count;
+                                                 return Status::OK();
+                                               });
+  ASSERT_OK(done.status());
+  ASSERT_EQ(count, 1000000);
+}
+
+}  // namespace arrow
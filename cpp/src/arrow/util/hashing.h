@@ -40,7 +40,9 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
 
 #define XXH_INLINE_ALL
 #define XXH_PRIVATE_API
@@ -189,6 +191,101 @@ hash_t ComputeStringHash(const void* data, int64_t length) {
                                 XXH3_SECRET_SIZE_MIN);
 }
 
+// ----------------------------------------------------------------------
+// Batch hashing
+
+// Hash `length` values to `out`, as ScalarHelper<Scalar, AlgNum> does one by
+// one.  The loop makes no calls, so that the compiler unrolls it (and
+// vectorizes it, for integers, where the target allows).
+template <uint64_t AlgNum = 0, typename Scalar>
+void ComputeHashes(const Scalar* values, int64_t length, hash_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = ScalarHelper<Scalar, AlgNum>::ComputeHash(values[i]);
+  }
+}
+
+// Hash `length` strings to `out`, the i-th spanning [offsets[i], offsets[i + 1])
+// of `data`, as ComputeStringHash does one by one
+template <uint64_t AlgNum = 0, typename Offset>
+void ComputeStringHashes(const uint8_t* data, const Offset* offsets, int64_t length,
+                         hash_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = ComputeStringHash<AlgNum>(data + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+}
+
+// Hash `length` strings of `byte_width` bytes laid out contiguously in `data`
+template <uint64_t AlgNum = 0>
+void ComputeFixedSizeStringHashes(const uint8_t* data, int32_t byte_width,
+                                  int64_t length, hash_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = ComputeStringHash<AlgNum>(data + i * byte_width, byte_width);
+  }
+}
+
+template <uint64_t AlgNum>
+struct ArrayHasher {
+  const ArrayData& data;
+  int64_t start;
+  int64_t length;
+  hash_t* out;
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hashing arrays of type ", type.ToString());
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* bits = data.buffers[1]->data();
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = ScalarHelper<bool, AlgNum>::ComputeHash(
+          BitUtil::GetBit(bits, data.offset + start + i));
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_has_c_type<T, Status> Visit(const T&) {
+    ComputeHashes<AlgNum>(data.GetValues<typename T::c_type>(1) + start, length, out);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    ComputeStringHashes<AlgNum>(data.GetValues<uint8_t>(2, 0),
+                                data.GetValues<typename T::offset_type>(1) + start,
+                                length, out);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    const int32_t byte_width = type.byte_width();
+    ComputeFixedSizeStringHashes<AlgNum>(
+        data.GetValues<uint8_t>(1, (data.offset + start) * byte_width), byte_width,
+        length, out);
+    return Status::OK();
+  }
+};
+
+// Hash the values of slots [start, start + length) of an array to `out`, as
+// the memo tables of HashTraits hash them one by one.  The hashes of null
+// slots are unspecified.  Boolean, primitive, temporal, binary, string and
+// fixed size binary arrays are supported.
+template <uint64_t AlgNum = 0>
+Status ComputeArrayHashes(const ArrayData& data, int64_t start, int64_t length,
+                          hash_t* out) {
+  DCHECK_LE(start + length, data.length);
+  if (length == 0) {
+    return Status::OK();
+  }
+  ArrayHasher<AlgNum> hasher{data, start, length, out};
+  return VisitTypeInline(*data.type, &hasher);
+}
+
+template <uint64_t AlgNum = 0>
+Status ComputeArrayHashes(const ArrayData& data, hash_t* out) {
+  return ComputeArrayHashes<AlgNum>(data, 0, data.length, out);
+}
+
 // XXX add a HashEq<ArrowType> struct with both hash and compare functions?
 
 // ----------------------------------------------------------------------
@@ -251,6 +348,11 @@ class HashTable {
 
   uint64_t size() const { return size_; }
 
+  // Prefetch the first slot probed by a lookup of `h`
+  void Prefetch(hash_t h) const {
+    ARROW_PREFETCH(entries_ + (FixHash(h) & capacity_mask_));
+  }
+
   // Visit all non-empty entries in the table
   // The visit_func should have signature void(const Entry*)
   template <typename VisitFunc>
@@ -363,10 +465,345 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An open-addressing hash table probing groups of slots at once
+
+// A drop-in replacement of HashTable in the style of SwissTable (Abseil) and
+// F14 (Folly).  Besides the entries, the table keeps one control byte per
+// slot: either kEmpty, or 7 bits of the hash of the entry.  A lookup
+// compares the control bytes of a whole group of slots (16 with SSE2, else 8
+// in a word) with the hash bits at once, and only compares the payloads of
+// the few matching slots.  Most probes thus read a single cache
+// line of control bytes, even at high load factors: the table is only grown
+// when it is 7/8 full, while HashTable keeps a load factor of at most 1/2.
+//
+// As with HashTable, entries can't be erased, so there are no tombstones and
+// a probe stops at the first group with an empty slot.
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+
+    // An entry is valid if the hash is different from the sentinel value
+    operator bool() const { return h != kSentinel; }
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), control_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements, and room for the requested ones below the
+    // maximum load factor
+    capacity = std::max<uint64_t>(capacity + capacity / 7, 32UL);
+    capacity_ = BitUtil::NextPower2(capacity);
+    capacity_mask_ = capacity_ - 1;
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffer(capacity_));
+  }
+
+  // Lookup, probing a group of slots at a time
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, control_, capacity_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, control_, capacity_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  void Insert(Entry* entry, hash_t h, const Payload& payload) {
+    // Ensure entry is empty before inserting
+    assert(!*entry);
+    h = FixHash(h);
+    entry->h = h;
+    entry->payload = payload;
+    SetControl(control_, capacity_, static_cast<uint64_t>(entry - entries_), h);
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      DCHECK_OK(Upsize(capacity_ * 2));
+    }
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Prefetch the first group probed by a lookup of `h`
+  void Prefetch(hash_t h) const {
+    const uint64_t index = FixHash(h) >> kControlBits & capacity_mask_;
+    ARROW_PREFETCH(control_ + index);
+    ARROW_PREFETCH(entries_ + index);
+  }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (control_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // The control byte of an empty slot, whose high bit is set while the
+  // control bytes of full slots are their 7 hash bits
+  static constexpr uint8_t kEmpty = 0x80;
+  static constexpr int kControlBits = 7;
+
+  // A group of control bytes, loaded from any (unaligned) slot index.  Its
+  // Match methods return bitmasks of (1 << kMaskShift) bits per slot.
+  struct Group {
+#ifdef ARROW_HAVE_SSE2
+    static constexpr int64_t kSize = 16;
+    static constexpr int kMaskShift = 0;
+
+    explicit Group(const uint8_t* control)
+        : control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+    // The slots of the group whose control byte is `c`
+    uint64_t Match(uint8_t c) const {
+      const __m128i match = _mm_cmpeq_epi8(control, _mm_set1_epi8(static_cast<char>(c)));
+      return static_cast<uint32_t>(_mm_movemask_epi8(match));
+    }
+
+    uint64_t MatchEmpty() const {
+      return static_cast<uint32_t>(_mm_movemask_epi8(control));
+    }
+
+    __m128i control;
+#else
+    // Portable version testing the 8 bytes of a word at once, the high bit
+    // of each byte of the masks being set for matching slots
+    static constexpr int64_t kSize = 8;
+    static constexpr int kMaskShift = 3;
+    static constexpr uint64_t kLowBits = 0x0101010101010101ULL;
+    static constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+    explicit Group(const uint8_t* control) {
+      memcpy(&this->control, control, sizeof(this->control));
+      this->control = BitUtil::FromLittleEndian(this->control);
+    }
+
+    // The slots of the group whose control byte is `c`, with rare false
+    // positives (above an actual match) that the hash comparison rules out
+    uint64_t Match(uint8_t c) const {
+      const uint64_t x = control ^ (kLowBits * c);
+      return (x - kLowBits) & ~x & kHighBits;
+    }
+
+    uint64_t MatchEmpty() const { return control & kHighBits; }
+
+    uint64_t control;
+#endif
+  };
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const Entry* entries, const uint8_t* control,
+                                   uint64_t size_mask, CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const auto h2 = static_cast<uint8_t>(h & (kEmpty - 1));
+    uint64_t index = (h >> kControlBits) & size_mask;
+    uint64_t stride = 0;
+
+    // Most values sit in their home slot: check it first, as HashTable does,
+    // which doesn't wait for the control bytes
+    const Entry* home = &entries[index];
+    if (CompareEntry<CKind, CmpFunc>(h, home, std::forward<CmpFunc>(cmp_func))) {
+      return {index, true};
+    }
+    if (home->h == kSentinel) {
+      // Values of this home slot are only ever inserted there first
+      return {index, false};
+    }
+
+    while (true) {
+      const Group group(control + index);
+      if (CKind == DoCompare) {
+        for (uint64_t match = group.Match(h2); match != 0; match &= match - 1) {
+          const uint64_t slot =
+              (index + (BitUtil::CountTrailingZeros(match) >> Group::kMaskShift)) &
+              size_mask;
+          if (CompareEntry<CKind, CmpFunc>(h, &entries[slot],
+                                           std::forward<CmpFunc>(cmp_func))) {
+            // Found
+            return {slot, true};
+          }
+        }
+      }
+      const uint64_t empty = group.MatchEmpty();
+      if (empty != 0) {
+        // Empty slot
+        return {(index + (BitUtil::CountTrailingZeros(empty) >> Group::kMaskShift)) &
+                    size_mask,
+                false};
+      }
+
+      // Triangular probing visits every group of a power-of-two table
+      stride += Group::kSize;
+      index = (index + stride) & size_mask;
+    }
+  }
+
+  template <CompareKind CKind, typename CmpFunc>
+  bool CompareEntry(hash_t h, const Entry* entry, CmpFunc&& cmp_func) const {
+    if (CKind == NoCompare) {
+      return false;
+    } else {
+      return entry->h == h && cmp_func(&entry->payload);
+    }
+  }
+
+  // Set the control byte of a slot.  The control bytes of the first group
+  // are mirrored after the last slot, so that groups can be loaded from any
+  // slot index without wrapping around.
+  static void SetControl(uint8_t* control, uint64_t capacity, uint64_t slot, hash_t h) {
+    const auto c = static_cast<uint8_t>(h & (kEmpty - 1));
+    control[slot] = c;
+    if (slot < static_cast<uint64_t>(Group::kSize)) {
+      control[capacity + slot] = c;
+    }
+  }
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 >= capacity_ * 7;
+  }
+
+  Status UpsizeBuffer(uint64_t capacity) {
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    memset(static_cast<void*>(entries_), 0, capacity * sizeof(Entry));
+
+    RETURN_NOT_OK(control_builder_.Resize(capacity + Group::kSize));
+    control_ = control_builder_.mutable_data();
+    memset(control_, kEmpty, capacity + Group::kSize);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    uint64_t new_mask = new_capacity - 1;
+    assert((new_capacity & new_mask) == 0);  // it's a power of two
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_control = control_;
+    std::shared_ptr<Buffer> previous_entries, previous_control;
+    RETURN_NOT_OK(entries_builder_.Finish(&previous_entries));
+    RETURN_NOT_OK(control_builder_.Finish(&previous_control));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffer(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_control[i] != kEmpty) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, entries_, control_, new_mask,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        entries_[p.first] = entry;
+        SetControl(control_, new_capacity, p.first, entry.h);
+      }
+    }
+    capacity_ = new_capacity;
+    capacity_mask_ = new_mask;
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  uint64_t capacity_mask_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  // The control bytes of the slots, followed by a copy of the first group's
+  uint8_t* control_;
+  TypedBufferBuilder<uint8_t> control_builder_;
+};
+
+// ----------------------------------------------------------------------
+// Radix partitioning of hashed values
+
+// With many distinct values, a single hash table outgrows the CPU caches and
+// almost every insertion misses cache.  Scattering the values into partitions
+// by hash first, then building a separate (disjoint) table for each
+// partition, keeps each table cache-resident.
+//
+// The partition is taken from the top bits of the mixed hash, while
+// HashTable picks slots from its low bits: the values of a partition remain
+// spread over the whole table of that partition.
+
+class RadixPartitioner {
+ public:
+  // Beyond this fan-out, scattering itself starts missing cache
+  static constexpr int kMaxNumBits = 10;
+
+  explicit RadixPartitioner(int num_bits) : num_bits_(num_bits) {
+    DCHECK(num_bits >= 0 && num_bits <= kMaxNumBits);
+  }
+
+  int num_bits() const { return num_bits_; }
+
+  int32_t num_partitions() const { return 1 << num_bits_; }
+
+  int32_t Partition(hash_t h) const {
+    if (num_bits_ == 0) {
+      return 0;
+    }
+    // Fibonacci hashing: the top bits of the product depend on all bits of h
+    return static_cast<int32_t>((h * 11400714819323198485ULL) >> (64 - num_bits_));
+  }
+
+  // Return the number of bits needed for tables of num_entries entries to
+  // take at most partition_size bytes each, assuming all entries are distinct.
+  // entry_size should account for the load factor of the tables.
+  static int ChooseNumBits(int64_t num_entries, int64_t entry_size,
+                           int64_t partition_size) {
+    const int64_t total_size = num_entries * entry_size;
+    int num_bits = 0;
+    while (num_bits < kMaxNumBits && (total_size >> num_bits) > partition_size) {
+      ++num_bits;
+    }
+    return num_bits;
+  }
+
+ private:
+  int num_bits_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
 
+// The number of values hashed ahead of their lookups by
+// BinaryMemoTable::GetOrInsertMany().
+// Large enough to overlap the cache misses of the lookups, small enough for
+// the prefetched slots to stay in cache until they are probed.
+constexpr int64_t kMemoBatchSize = 64;
+
 // ----------------------------------------------------------------------
 // A base class for memoization table.
 
@@ -389,11 +826,16 @@ class ScalarMemoTable : public MemoTable {
   explicit ScalarMemoTable(MemoryPool* pool, int64_t entries = 0)
       : hash_table_(pool, static_cast<uint64_t>(entries)) {}
 
-  int32_t Get(const Scalar& value) const {
+  // Whether the Hashed methods use the hash they are given
+  static constexpr bool kUsesHashes = true;
+
+  int32_t Get(const Scalar& value) const { return GetHashed(value, ComputeHash(value)); }
+
+  // Get(), given the hash of the value as computed by ComputeHashes<0>
+  int32_t GetHashed(const Scalar& value, hash_t h) const {
     auto cmp_func = [value](const Payload* payload) -> bool {
       return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
     };
-    hash_t h = ComputeHash(value);
     auto p = hash_table_.Lookup(h, cmp_func);
     if (p.second) {
       return p.first->payload.memo_index;
@@ -404,10 +846,21 @@ class ScalarMemoTable : public MemoTable {
 
   template <typename Func1, typename Func2>
   int32_t GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found) {
+    return GetOrInsertHashed(value, ComputeHash(value), std::forward<Func1>(on_found),
+                             std::forward<Func2>(on_not_found));
+  }
+
+  int32_t GetOrInsert(const Scalar& value) {
+    return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {});
+  }
+
+  // GetOrInsert(), given the hash of the value as computed by ComputeHashes<0>
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsertHashed(const Scalar& value, hash_t h, Func1&& on_found,
+                            Func2&& on_not_found) {
     auto cmp_func = [value](const Payload* payload) -> bool {
       return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
     };
-    hash_t h = ComputeHash(value);
     auto p = hash_table_.Lookup(h, cmp_func);
     int32_t memo_index;
     if (p.second) {
@@ -421,8 +874,29 @@ class ScalarMemoTable : public MemoTable {
     return memo_index;
   }
 
-  int32_t GetOrInsert(const Scalar& value) {
-    return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {});
+  int32_t GetOrInsertHashed(const Scalar& value, hash_t h) {
+    return GetOrInsertHashed(value, h, [](int32_t i) {}, [](int32_t i) {});
+  }
+
+  // Prefetch the slot of a value of hash `h`
+  void Prefetch(hash_t h) const { hash_table_.Prefetch(h); }
+
+  // Bulk version of GetOrInsert, writing the memo index of each value to
+  // `out_memo_indices`.  The values of a batch are hashed in one loop first.
+  // The lookups are independent, so the CPU already overlaps their cache
+  // misses: prefetching, as BinaryMemoTable does, was measured not to help.
+  void GetOrInsertMany(const Scalar* values, int64_t length, int32_t* out_memo_indices) {
+    hash_t hashes[kMemoBatchSize];
+    while (length > 0) {
+      const int64_t batch_size = std::min(length, kMemoBatchSize);
+      ComputeHashes<0>(values, batch_size, hashes);
+      for (int64_t i = 0; i < batch_size; ++i) {
+        out_memo_indices[i] = GetOrInsertHashed(values[i], hashes[i]);
+      }
+      values += batch_size;
+      out_memo_indices += batch_size;
+      length -= batch_size;
+    }
   }
 
   int32_t GetNull() const { return null_index_; }
@@ -507,11 +981,16 @@ class SmallScalarMemoTable : public MemoTable {
     index_to_value_.reserve(cardinality);
   }
 
+  // Whether the Hashed methods use the hash they are given
+  static constexpr bool kUsesHashes = false;
+
   int32_t Get(const Scalar value) const {
     auto value_index = AsIndex(value);
     return value_to_index_[value_index];
   }
 
+  int32_t GetHashed(const Scalar value, hash_t) const { return Get(value); }
+
   template <typename Func1, typename Func2>
   int32_t GetOrInsert(const Scalar value, Func1&& on_found, Func2&& on_not_found) {
     auto value_index = AsIndex(value);
@@ -532,6 +1011,25 @@ class SmallScalarMemoTable : public MemoTable {
     return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {});
   }
 
+  // The Hashed methods ignore the hash: the table is indexed by value
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsertHashed(const Scalar value, hash_t, Func1&& on_found,
+                            Func2&& on_not_found) {
+    return GetOrInsert(value, std::forward<Func1>(on_found),
+                       std::forward<Func2>(on_not_found));
+  }
+
+  int32_t GetOrInsertHashed(const Scalar value, hash_t) { return GetOrInsert(value); }
+
+  void Prefetch(hash_t) const {}
+
+  // Bulk version of GetOrInsert (direct indexing needs no hashing ahead)
+  void GetOrInsertMany(const Scalar* values, int64_t length, int32_t* out_memo_indices) {
+    for (int64_t i = 0; i < length; ++i) {
+      out_memo_indices[i] = GetOrInsert(values[i]);
+    }
+  }
+
   int32_t GetNull() const { return value_to_index_[cardinality]; }
 
   template <typename Func1, typename Func2>
@@ -593,8 +1091,15 @@ class BinaryMemoTable : public MemoTable {
     DCHECK_OK(binary_builder_.ReserveData(data_size));
   }
 
+  // Whether the Hashed methods use the hash they are given
+  static constexpr bool kUsesHashes = true;
+
   int32_t Get(const void* data, int32_t length) const {
-    hash_t h = ComputeStringHash<0>(data, length);
+    return GetHashed(data, length, ComputeStringHash<0>(data, length));
+  }
+
+  // Get(), given the hash of the value as computed by ComputeStringHash<0>
+  int32_t GetHashed(const void* data, int32_t length, hash_t h) const {
     auto p = Lookup(h, data, length);
     if (p.second) {
       return p.first->payload.memo_index;
@@ -603,6 +1108,10 @@ class BinaryMemoTable : public MemoTable {
     }
   }
 
+  int32_t GetHashed(const util::string_view& value, hash_t h) const {
+    return GetHashed(value.data(), static_cast<int32_t>(value.length()), h);
+  }
+
   int32_t Get(const std::string& value) const {
     return Get(value.data(), static_cast<int32_t>(value.length()));
   }
@@ -614,7 +1123,34 @@ class BinaryMemoTable : public MemoTable {
   template <typename Func1, typename Func2>
   int32_t GetOrInsert(const void* data, int32_t length, Func1&& on_found,
                       Func2&& on_not_found) {
-    hash_t h = ComputeStringHash<0>(data, length);
+    return GetOrInsertHashed(data, length, ComputeStringHash<0>(data, length),
+                             std::forward<Func1>(on_found),
+                             std::forward<Func2>(on_not_found));
+  }
+
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsert(const util::string_view& value, Func1&& on_found,
+                      Func2&& on_not_found) {
+    return GetOrInsert(value.data(), static_cast<int32_t>(value.length()),
+                       std::forward<Func1>(on_found), std::forward<Func2>(on_not_found));
+  }
+
+  int32_t GetOrInsert(const void* data, int32_t length) {
+    return GetOrInsert(data, length, [](int32_t i) {}, [](int32_t i) {});
+  }
+
+  int32_t GetOrInsert(const util::string_view& value) {
+    return GetOrInsert(value.data(), static_cast<int32_t>(value.length()));
+  }
+
+  int32_t GetOrInsert(const std::string& value) {
+    return GetOrInsert(value.data(), static_cast<int32_t>(value.length()));
+  }
+
+  // GetOrInsert(), given the hash of the value as computed by ComputeStringHash<0>
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsertHashed(const void* data, int32_t length, hash_t h, Func1&& on_found,
+                            Func2&& on_not_found) {
     auto p = Lookup(h, data, length);
     int32_t memo_index;
     if (p.second) {
@@ -632,23 +1168,48 @@ class BinaryMemoTable : public MemoTable {
     return memo_index;
   }
 
-  template <typename Func1, typename Func2>
-  int32_t GetOrInsert(const util::string_view& value, Func1&& on_found,
-                      Func2&& on_not_found) {
-    return GetOrInsert(value.data(), static_cast<int32_t>(value.length()),
-                       std::forward<Func1>(on_found), std::forward<Func2>(on_not_found));
+  int32_t GetOrInsertHashed(const void* data, int32_t length, hash_t h) {
+    return GetOrInsertHashed(data, length, h, [](int32_t i) {}, [](int32_t i) {});
   }
 
-  int32_t GetOrInsert(const void* data, int32_t length) {
-    return GetOrInsert(data, length, [](int32_t i) {}, [](int32_t i) {});
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsertHashed(const util::string_view& value, hash_t h, Func1&& on_found,
+                            Func2&& on_not_found) {
+    return GetOrInsertHashed(value.data(), static_cast<int32_t>(value.length()), h,
+                             std::forward<Func1>(on_found),
+                             std::forward<Func2>(on_not_found));
   }
 
-  int32_t GetOrInsert(const util::string_view& value) {
-    return GetOrInsert(value.data(), static_cast<int32_t>(value.length()));
+  int32_t GetOrInsertHashed(const util::string_view& value, hash_t h) {
+    return GetOrInsertHashed(value.data(), static_cast<int32_t>(value.length()), h);
   }
 
-  int32_t GetOrInsert(const std::string& value) {
-    return GetOrInsert(value.data(), static_cast<int32_t>(value.length()));
+  // Prefetch the slot of a value of hash `h`
+  void Prefetch(hash_t h) const { hash_table_.Prefetch(h); }
+
+  // Bulk version of GetOrInsert, writing the memo index of each value to
+  // `out_memo_indices`.  The values of a batch are all hashed first and
+  // their slots prefetched, so that the lookups don't wait on each cache
+  // miss in turn.
+  void GetOrInsertMany(const util::string_view* values, int64_t length,
+                       int32_t* out_memo_indices) {
+    hash_t hashes[kMemoBatchSize];
+    while (length > 0) {
+      const int64_t batch_size = std::min(length, kMemoBatchSize);
+      for (int64_t i = 0; i < batch_size; ++i) {
+        hashes[i] = ComputeStringHash<0>(values[i].data(),
+                                         static_cast<int64_t>(values[i].length()));
+        hash_table_.Prefetch(hashes[i]);
+      }
+      for (int64_t i = 0; i < batch_size; ++i) {
+        out_memo_indices[i] = GetOrInsertHashed(
+            values[i].data(), static_cast<int32_t>(values[i].length()), hashes[i],
+            [](int32_t) {}, [](int32_t) {});
+      }
+      values += batch_size;
+      out_memo_indices += batch_size;
+      length -= batch_size;
+    }
   }
 
   int32_t GetNull() const { return null_index_; }
@@ -834,6 +1395,57 @@ struct HashTraits<T, enable_if_has_string_view<T>> {
   using MemoTableType = BinaryMemoTable;
 };
 
+// The distance, in values, at which VisitHashedValues() prefetches the
+// memo table slots of the values ahead
+constexpr int64_t kMemoPrefetchDistance = 16;
+
+template <typename MemoTableType, typename Visitor>
+struct HashedValueVisitor {
+  Status VisitNull() {
+    ++i;
+    return visitor->VisitNull();
+  }
+
+  template <typename Value>
+  Status VisitValue(const Value& value) {
+    if (MemoTableType::kUsesHashes && i + kMemoPrefetchDistance < length) {
+      memo_table.Prefetch(hashes[i + kMemoPrefetchDistance]);
+    }
+    return visitor->VisitValue(value, hashes[i++]);
+  }
+
+  const MemoTableType& memo_table;
+  Visitor* visitor;
+  const hash_t* hashes;
+  int64_t length;
+  int64_t i;
+};
+
+// Visit the values of an array of type Type with their hashes, as the memo
+// tables of HashTraits<Type> hash them, to pass to their Hashed methods.
+// The visitor has the methods `Status VisitNull()` and
+// `Status VisitValue(<scalar> value, hash_t h)`.
+//
+// The hashes are computed for the whole array at once, by
+// ComputeArrayHashes, and the slots of the values ahead are prefetched.
+template <typename Type, typename Visitor>
+Status VisitHashedValues(const ArrayData& data,
+                         const typename HashTraits<Type>::MemoTableType& memo_table,
+                         Visitor* visitor) {
+  using MemoTableType = typename HashTraits<Type>::MemoTableType;
+
+  std::vector<hash_t> hashes;
+  if (MemoTableType::kUsesHashes) {
+    hashes.resize(data.length);
+    RETURN_NOT_OK(ComputeArrayHashes<0>(data, hashes.data()));
+  } else {
+    hashes.assign(data.length, 0);
+  }
+  HashedValueVisitor<MemoTableType, Visitor> hashed_visitor{
+      memo_table, visitor, hashes.data(), data.length, 0};
+  return ArrayDataVisitor<Type>::Visit(data, &hashed_visitor);
+}
+
 template <typename MemoTableType>
 static inline Status ComputeNullBitmap(MemoryPool* pool, const MemoTableType& memo_table,
                                        int64_t start_offset, int64_t* null_count,
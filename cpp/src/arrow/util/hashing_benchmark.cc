@@ -24,8 +24,10 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
 
 namespace arrow {
 namespace internal {
@@ -111,6 +113,211 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+static void HashIntegersBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(10000);
+  const auto length = static_cast<int64_t>(values.size());
+  std::vector<hash_t> hashes(values.size());
+
+  while (state.KeepRunning()) {
+    ComputeHashes<0>(values.data(), length, hashes.data());
+    ComputeHashes<1>(values.data(), length, hashes.data());
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(2 * state.iterations() * values.size() * sizeof(int64_t));
+  state.SetItemsProcessed(2 * state.iterations() * values.size());
+}
+
+static void BenchmarkStringHashingBatch(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<std::string>& values) {
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (const std::string& v : values) {
+    data += v;
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  const auto length = static_cast<int64_t>(values.size());
+  const auto bytes = reinterpret_cast<const uint8_t*>(data.data());
+  std::vector<hash_t> hashes(values.size());
+
+  while (state.KeepRunning()) {
+    ComputeStringHashes<0>(bytes, offsets.data(), length, hashes.data());
+    ComputeStringHashes<1>(bytes, offsets.data(), length, hashes.data());
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(2 * state.iterations() * data.size());
+  state.SetItemsProcessed(2 * state.iterations() * values.size());
+}
+
+static void HashSmallStringsBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkStringHashingBatch(state, MakeStrings(10000, 2, 20));
+}
+
+static void HashMediumStringsBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkStringHashingBatch(state, MakeStrings(10000, 20, 120));
+}
+
+// ----------------------------------------------------------------------
+// Memo table insertion with many distinct values
+
+// Approximate L2 cache size
+static constexpr int64_t kPartitionSize = 256 * 1024;
+
+template <typename MemoTable, typename Value>
+static void BenchmarkMemoTableInsert(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<Value>& values) {
+  while (state.KeepRunning()) {
+    MemoTable table(default_memory_pool(), 0);
+    for (const Value& v : values) {
+      benchmark::DoNotOptimize(table.GetOrInsert(v));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename MemoTable, typename Value>
+static void BenchmarkMemoTableInsertMany(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<Value>& values) {
+  std::vector<int32_t> memo_indices(values.size());
+  while (state.KeepRunning()) {
+    MemoTable table(default_memory_pool(), 0);
+    table.GetOrInsertMany(values.data(), static_cast<int64_t>(values.size()),
+                          memo_indices.data());
+    benchmark::DoNotOptimize(memo_indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename MemoTable, typename Value>
+static void BenchmarkPartitionedMemoTableInsert(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<Value>& values) {
+  const int64_t entry_size = 2 * (sizeof(hash_t) + sizeof(int32_t)) + sizeof(Value);
+  const RadixPartitioner partitioner(
+      RadixPartitioner::ChooseNumBits(values.size(), entry_size, kPartitionSize));
+  const int32_t num_partitions = partitioner.num_partitions();
+
+  while (state.KeepRunning()) {
+    // Scatter the values by partition...
+    std::vector<int32_t> partitions(values.size());
+    std::vector<int64_t> offsets(num_partitions + 1, 0);
+    for (size_t i = 0; i < values.size(); ++i) {
+      const hash_t h = ScalarHelper<Value, 1>::ComputeHash(values[i]);
+      partitions[i] = partitioner.Partition(h);
+      ++offsets[partitions[i] + 1];
+    }
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      offsets[p + 1] += offsets[p];
+    }
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    std::vector<Value> scattered(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      scattered[positions[partitions[i]]++] = values[i];
+    }
+    // ...then fill a cache-resident table per partition
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      MemoTable table(default_memory_pool(), 0);
+      for (int64_t i = offsets[p]; i < offsets[p + 1]; ++i) {
+        benchmark::DoNotOptimize(table.GetOrInsert(scattered[i]));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+  state.counters["partitions"] = num_partitions;
+}
+
+// Look up values in a table of half of them
+template <typename MemoTable, typename Value>
+static void BenchmarkMemoTableLookup(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::vector<Value>& values) {
+  MemoTable table(default_memory_pool(), 0);
+  for (size_t i = 0; i < values.size(); i += 2) {
+    table.GetOrInsert(values[i]);
+  }
+  while (state.KeepRunning()) {
+    for (const Value& v : values) {
+      benchmark::DoNotOptimize(table.Get(v));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static std::vector<util::string_view> MakeStringViews(
+    const std::vector<std::string>& strings) {
+  return std::vector<util::string_view>(strings.begin(), strings.end());
+}
+
+static void MemoTableInsertHighCardinalityIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 22);
+  BenchmarkMemoTableInsert<ScalarMemoTable<int64_t>>(state, values);
+}
+
+static void PartitionedMemoTableInsertHighCardinalityIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 22);
+  BenchmarkPartitionedMemoTableInsert<ScalarMemoTable<int64_t>>(state, values);
+}
+
+static void SwissMemoTableInsertHighCardinalityIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 22);
+  BenchmarkMemoTableInsert<ScalarMemoTable<int64_t, SwissHashTable>>(state, values);
+}
+
+// The argument is the log2 of the number of slots.  The tables are filled up
+// to just below HashTable's maximum load factor of 1/2, then SwissHashTable's
+// of 7/8.
+static void MemoTableLookupHighLoadIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t num_values = (int64_t(1) << (state.range(0) - 1)) - 16;
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(2 * num_values);
+  BenchmarkMemoTableLookup<ScalarMemoTable<int64_t>>(state, values);
+}
+
+static void SwissMemoTableLookupHighLoadIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t num_values = (int64_t(1) << (state.range(0) - 1)) - 16;
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(2 * num_values);
+  BenchmarkMemoTableLookup<ScalarMemoTable<int64_t, SwissHashTable>>(state, values);
+}
+
+static void SwissMemoTableLookupMaxLoadIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t num_values = (int64_t(7) << (state.range(0) - 3)) - 16;
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(2 * num_values);
+  BenchmarkMemoTableLookup<ScalarMemoTable<int64_t, SwissHashTable>>(state, values);
+}
+
+static void MemoTableInsertManyHighCardinalityIntegers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(1 << 22);
+  BenchmarkMemoTableInsertMany<ScalarMemoTable<int64_t>>(state, values);
+}
+
+static void MemoTableInsertHighCardinalityStrings(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> strings = MakeStrings(1 << 20, 8, 24);
+  BenchmarkMemoTableInsert<BinaryMemoTable>(state, MakeStringViews(strings));
+}
+
+static void MemoTableInsertManyHighCardinalityStrings(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> strings = MakeStrings(1 << 20, 8, 24);
+  BenchmarkMemoTableInsertMany<BinaryMemoTable>(state, MakeStringViews(strings));
+}
+
+static void PartitionedMemoTableInsertHighCardinalityStrings(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> strings = MakeStrings(1 << 20, 8, 24);
+  BenchmarkPartitionedMemoTableInsert<BinaryMemoTable>(state, MakeStringViews(strings));
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -118,6 +325,19 @@ BENCHMARK(HashIntegers);
 BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
+BENCHMARK(HashIntegersBatch);
+BENCHMARK(HashSmallStringsBatch);
+BENCHMARK(HashMediumStringsBatch);
+BENCHMARK(MemoTableInsertHighCardinalityIntegers);
+BENCHMARK(SwissMemoTableInsertHighCardinalityIntegers);
+BENCHMARK(MemoTableLookupHighLoadIntegers)->Arg(12)->Arg(16)->Arg(20);
+BENCHMARK(SwissMemoTableLookupHighLoadIntegers)->Arg(12)->Arg(16)->Arg(20);
+BENCHMARK(SwissMemoTableLookupMaxLoadIntegers)->Arg(12)->Arg(16)->Arg(20);
+BENCHMARK(MemoTableInsertManyHighCardinalityIntegers);
+BENCHMARK(PartitionedMemoTableInsertHighCardinalityIntegers);
+BENCHMARK(MemoTableInsertHighCardinalityStrings);
+BENCHMARK(MemoTableInsertManyHighCardinalityStrings);
+BENCHMARK(PartitionedMemoTableInsertHighCardinalityStrings);
 
 }  // namespace internal
 }  // namespace arrow
@@ -195,6 +195,123 @@ TEST(ScalarMemoTable, Int64) {
   }
 }
 
+TEST(ScalarMemoTable, GetOrInsertMany) {
+  // More values than a batch, with many repeats across batches, and enough
+  // distinct values to make the table grow in the middle of a batch
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 1000; ++i) {
+    values.push_back((i * 7919) % 300 - 150);
+  }
+
+  ScalarMemoTable<int64_t> table(default_memory_pool(), 0);
+  ScalarMemoTable<int64_t> expected_table(default_memory_pool(), 0);
+  ASSERT_EQ(table.GetOrInsert(values[500]), 0);
+  ASSERT_EQ(expected_table.GetOrInsert(values[500]), 0);
+
+  std::vector<int32_t> memo_indices(values.size());
+  table.GetOrInsertMany(values.data(), static_cast<int64_t>(values.size()),
+                        memo_indices.data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(memo_indices[i], expected_table.GetOrInsert(values[i]));
+  }
+  ASSERT_EQ(table.size(), 300);
+}
+
+template <uint64_t AlgNum, typename ArrayType>
+void CheckArrayHashes(const ArrayType& array) {
+  std::vector<hash_t> hashes(array.length());
+  ASSERT_OK(ComputeArrayHashes<AlgNum>(*array.data(), hashes.data()));
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (array.IsValid(i)) {
+      const auto value = array.GetView(i);
+      using Helper = ScalarHelper<typename std::decay<decltype(value)>::type, AlgNum>;
+      ASSERT_EQ(hashes[i], Helper::ComputeHash(value));
+    }
+  }
+}
+
+template <typename ArrayType>
+void CheckArrayHashes(const std::shared_ptr<Array>& array) {
+  for (const auto& slice : {array, array->Slice(1), array->Slice(2, 3)}) {
+    CheckArrayHashes<0>(checked_cast<const ArrayType&>(*slice));
+    CheckArrayHashes<1>(checked_cast<const ArrayType&>(*slice));
+  }
+}
+
+TEST(ComputeArrayHashes, Basics) {
+  CheckArrayHashes<BooleanArray>(
+      ArrayFromJSON(boolean(), "[true, false, null, false, true, true]"));
+  CheckArrayHashes<Int16Array>(ArrayFromJSON(int16(), "[1, -2, null, 4, 5, 32767]"));
+  CheckArrayHashes<Int64Array>(
+      ArrayFromJSON(int64(), "[1, -2, null, 4, 5, 9223372036854775807]"));
+  CheckArrayHashes<Date32Array>(ArrayFromJSON(date32(), "[1, 0, null, 4, 5, 6]"));
+  CheckArrayHashes<DoubleArray>(
+      ArrayFromJSON(float64(), "[1.5, -0.0, null, 0.0, NaN, 6e300]"));
+  CheckArrayHashes<StringArray>(ArrayFromJSON(
+      utf8(), R"(["", "a", null, "bcd", "a somewhat longer string", "efghijklmn"])"));
+  CheckArrayHashes<LargeBinaryArray>(ArrayFromJSON(
+      large_binary(), R"(["", "a", null, "bcd", "a somewhat longer string", "e"])"));
+  CheckArrayHashes<FixedSizeBinaryArray>(ArrayFromJSON(
+      fixed_size_binary(3), R"(["abc", "def", null, "ghi", "abd", "xyz"])"));
+  CheckArrayHashes<Decimal128Array>(ArrayFromJSON(
+      decimal(10, 2), R"(["1.23", "-4.56", null, "0.00", "12345678.90", "0.01"])"));
+
+  std::vector<hash_t> hashes(2);
+  ASSERT_RAISES(NotImplemented,
+                ComputeArrayHashes<0>(*ArrayFromJSON(list(int8()), "[[], [1]]")->data(),
+                                      hashes.data()));
+}
+
+// Records the memo index of each value as given by the Hashed methods
+template <typename MemoTableType>
+struct HashedMemoizer {
+  Status VisitNull() {
+    out->push_back(memo_table->GetOrInsertNull());
+    return Status::OK();
+  }
+
+  template <typename Value>
+  Status VisitValue(const Value& value, hash_t h) {
+    EXPECT_EQ(memo_table->GetHashed(value, h), memo_table->Get(value));
+    out->push_back(memo_table->GetOrInsertHashed(value, h));
+    EXPECT_EQ(memo_table->GetHashed(value, h), out->back());
+    return Status::OK();
+  }
+
+  MemoTableType* memo_table;
+  std::vector<int32_t>* out;
+};
+
+template <typename Type>
+void CheckVisitHashedValues(const std::shared_ptr<Array>& array,
+                            const std::vector<int32_t>& expected) {
+  using MemoTableType = typename HashTraits<Type>::MemoTableType;
+  MemoTableType memo_table(default_memory_pool(), 0);
+  std::vector<int32_t> memo_indices;
+  HashedMemoizer<MemoTableType> memoizer{&memo_table, &memo_indices};
+  ASSERT_OK(VisitHashedValues<Type>(*array->data(), memo_table, &memoizer));
+  ASSERT_EQ(memo_indices, expected);
+}
+
+TEST(VisitHashedValues, Basics) {
+  CheckVisitHashedValues<Int64Type>(ArrayFromJSON(int64(), "[5, 3, null, 5, 7, 3, null]"),
+                                    {0, 1, 2, 0, 3, 1, 2});
+  CheckVisitHashedValues<Int8Type>(ArrayFromJSON(int8(), "[5, 3, null, 5, 7, 3, null]"),
+                                   {0, 1, 2, 0, 3, 1, 2});
+  CheckVisitHashedValues<StringType>(
+      ArrayFromJSON(utf8(), R"(["x", "", null, "x", "yz", "", null])"),
+      {0, 1, 2, 0, 3, 1, 2});
+
+  // More values than the prefetch distance
+  std::vector<int32_t> expected;
+  std::string json = "[";
+  for (int32_t i = 0; i < 100; ++i) {
+    json += (i > 0 ? ", " : "") + std::to_string(i % 30);
+    expected.push_back(i % 30);
+  }
+  CheckVisitHashedValues<UInt32Type>(ArrayFromJSON(uint32(), json + "]"), expected);
+}
+
 TEST(ScalarMemoTable, UInt16) {
   const uint16_t A = 1236, B = 0, C = 65535, D = 32767, E = 1;
 
@@ -353,6 +470,47 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, SwissHashTable) {
+  // Enough distinct values to make the table grow several times, with
+  // repeats and values whose hashes share control bytes
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-5000, 5000);
+  const int32_t n_repeats = 50000;
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  std::unordered_map<int64_t, int32_t> map;
+
+  for (int32_t i = 0; i < n_repeats; ++i) {
+    const int64_t value = value_dist(gen);
+    int32_t expected;
+    auto it = map.find(value);
+    if (it == map.end()) {
+      ASSERT_EQ(table.Get(value), kKeyNotFound);
+      expected = static_cast<int32_t>(map.size());
+      map[value] = expected;
+    } else {
+      expected = it->second;
+    }
+    ASSERT_EQ(table.GetOrInsert(value), expected);
+    ASSERT_EQ(table.Get(value), expected);
+  }
+  ASSERT_EQ(table.size(), map.size());
+  ASSERT_EQ(table.GetOrInsertNull(), static_cast<int32_t>(map.size()));
+
+  std::vector<int64_t> values(map.size());
+  table.CopyValues(values.data());
+  for (const auto& pair : map) {
+    ASSERT_EQ(values[pair.second], pair.first);
+  }
+
+  ScalarMemoTable<double, SwissHashTable> float_table(default_memory_pool(), 0);
+  ASSERT_EQ(float_table.GetOrInsert(1.5), 0);
+  ASSERT_EQ(float_table.GetOrInsert(std::nan("")), 1);
+  ASSERT_EQ(float_table.GetOrInsert(-0.0), 2);
+  ASSERT_EQ(float_table.Get(std::nan("")), 1);
+  ASSERT_EQ(float_table.Get(2.5), kKeyNotFound);
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -422,6 +580,31 @@ TEST(BinaryMemoTable, Basics) {
   }
 }
 
+TEST(BinaryMemoTable, GetOrInsertMany) {
+  std::vector<std::string> strings;
+  std::vector<util::string_view> values;
+  for (int32_t i = 0; i < 1000; ++i) {
+    strings.push_back(std::to_string((i * 7919) % 300));
+  }
+  strings.push_back("");
+  for (const auto& s : strings) {
+    values.push_back(s);
+  }
+
+  BinaryMemoTable table(default_memory_pool(), 0);
+  BinaryMemoTable expected_table(default_memory_pool(), 0);
+  ASSERT_EQ(table.GetOrInsertNull(), 0);
+  ASSERT_EQ(expected_table.GetOrInsertNull(), 0);
+
+  std::vector<int32_t> memo_indices(values.size());
+  table.GetOrInsertMany(values.data(), static_cast<int64_t>(values.size()),
+                        memo_indices.data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(memo_indices[i], expected_table.GetOrInsert(values[i]));
+  }
+  ASSERT_EQ(table.size(), 302);
+}
+
 TEST(BinaryMemoTable, Stress) {
 #ifdef ARROW_VALGRIND
   const int32_t n_values = 20;
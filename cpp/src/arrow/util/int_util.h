@@ -19,6 +19,7 @@
 #define ARROW_UTIL_INT_UTIL_H
 
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 
 #include "arrow/util/visibility.h"
@@ -83,6 +84,62 @@ SignedInt SafeLeftShift(SignedInt u, Shift shift) {
   return static_cast<SignedInt>(static_cast<UnsignedInt>(u) << shift);
 }
 
+/// Integer arithmetic storing the result wrapped around into *out (as unsigned)
+/// and returning true on overflow
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+
+template <typename Int>
+bool AddWithOverflow(Int u, Int v, Int* out) {
+  return __builtin_add_overflow(u, v, out);
+}
+
+template <typename Int>
+bool SubtractWithOverflow(Int u, Int v, Int* out) {
+  return __builtin_sub_overflow(u, v, out);
+}
+
+template <typename Int>
+bool MultiplyWithOverflow(Int u, Int v, Int* out) {
+  return __builtin_mul_overflow(u, v, out);
+}
+
+#else
+
+template <typename Int>
+bool AddWithOverflow(Int u, Int v, Int* out) {
+  using UnsignedInt = typename std::make_unsigned<Int>::type;
+  *out = static_cast<Int>(static_cast<UnsignedInt>(u) + static_cast<UnsignedInt>(v));
+  return std::is_signed<Int>::value ? (v > 0 && *out < u) || (v < 0 && *out > u)
+                                    : *out < u;
+}
+
+template <typename Int>
+bool SubtractWithOverflow(Int u, Int v, Int* out) {
+  using UnsignedInt = typename std::make_unsigned<Int>::type;
+  *out = static_cast<Int>(static_cast<UnsignedInt>(u) - static_cast<UnsignedInt>(v));
+  return std::is_signed<Int>::value ? (v > 0 && *out > u) || (v < 0 && *out < u)
+                                    : u < v;
+}
+
+template <typename Int>
+bool MultiplyWithOverflow(Int u, Int v, Int* out) {
+  using UnsignedInt = typename std::make_unsigned<Int>::type;
+  // Unsigned types narrower than int would be promoted to (signed) int
+  using Wide = typename std::conditional<sizeof(Int) < sizeof(unsigned), unsigned,
+                                         UnsignedInt>::type;
+  *out = static_cast<Int>(static_cast<Wide>(static_cast<UnsignedInt>(u)) *
+                          static_cast<Wide>(static_cast<UnsignedInt>(v)));
+  if (u == 0) {
+    return false;
+  }
+  if (std::is_signed<Int>::value && u == static_cast<Int>(-1)) {
+    return v == std::numeric_limits<Int>::min();
+  }
+  return *out / u != v;
+}
+
+#endif
+
 /// Upcast an integer to the largest possible width (currently 64 bits)
 
 template <typename Integer>
@@ -65,7 +65,9 @@
 #undef Realloc
 #undef Free
 #else  // POSIX-like platforms
+#include <limits.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -835,16 +837,37 @@ static inline Result<int> CheckFileOpResult(int fd_ret, int errno_actual,
   return fd_ret;
 }
 
-Result<int> FileOpenReadable(const PlatformFilename& file_name) {
+Result<int> FileOpenReadable(const PlatformFilename& file_name, bool direct_io) {
   int fd, errno_actual;
 #if defined(_WIN32)
+  if (direct_io) {
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+  }
   SetLastError(0);
   errno_actual = _wsopen_s(&fd, file_name.ToNative().c_str(),
                            _O_RDONLY | _O_BINARY | _O_NOINHERIT, _SH_DENYNO, _S_IREAD);
 #else
-  fd = open(file_name.ToNative().c_str(), O_RDONLY);
+  int oflag = O_RDONLY;
+#if defined(O_DIRECT)
+  if (direct_io) {
+    oflag |= O_DIRECT;
+  }
+#elif !defined(F_NOCACHE)
+  if (direct_io) {
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+  }
+#endif
+  fd = open(file_name.ToNative().c_str(), oflag);
   errno_actual = errno;
 
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+  if (fd >= 0 && direct_io && fcntl(fd, F_NOCACHE, 1) == -1) {
+    errno_actual = errno;
+    ARROW_UNUSED(FileClose(fd));
+    fd = -1;
+  }
+#endif
+
   if (fd >= 0) {
     // open(O_RDONLY) succeeds on directories, check for it
     struct stat st;
@@ -1022,6 +1045,74 @@ Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
 #endif
 }
 
+//
+// Access pattern hints
+//
+
+Status MemoryAdvise(void* addr, size_t size, MemoryAdvice advice) {
+#if defined(_WIN32)
+  // No madvise() equivalent for the hints that matter to us
+  return Status::OK();
+#else
+  int flag;
+  switch (advice) {
+    case MemoryAdvice::Normal:
+      flag = MADV_NORMAL;
+      break;
+    case MemoryAdvice::Sequential:
+      flag = MADV_SEQUENTIAL;
+      break;
+    case MemoryAdvice::Random:
+      flag = MADV_RANDOM;
+      break;
+    case MemoryAdvice::WillNeed:
+      flag = MADV_WILLNEED;
+      break;
+    case MemoryAdvice::HugePage:
+#ifdef MADV_HUGEPAGE
+      flag = MADV_HUGEPAGE;
+      break;
+#else
+      return Status::OK();
+#endif
+    default:
+      return Status::Invalid("Invalid memory advice");
+  }
+  if (size == 0) {
+    return Status::OK();
+  }
+  // madvise() requires a page-aligned address
+  static const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = reinterpret_cast<uintptr_t>(addr);
+  const auto aligned_begin = begin & ~(page_size - 1);
+  if (madvise(reinterpret_cast<void*>(aligned_begin), size + (begin - aligned_begin),
+              flag) != 0) {
+    // EINVAL is returned if the kernel doesn't support the hint (e.g. huge pages
+    // for the underlying filesystem), ignore it
+    if (errno == EINVAL) {
+      return Status::OK();
+    }
+    return IOErrorFromErrno(errno, "madvise failed");
+  }
+  return Status::OK();
+#endif
+}
+
+Status FileAdviseWillNeed(int fd, int64_t offset, int64_t length) {
+#if defined(POSIX_FADV_WILLNEED)
+  if (length <= 0) {
+    return Status::OK();
+  }
+  const int ret = posix_fadvise(fd, static_cast<off_t>(offset),
+                                static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+  if (ret != 0) {
+    // posix_fadvise() returns the error number rather than setting errno
+    return IOErrorFromErrno(ret, "posix_fadvise failed");
+  }
+#endif
+  return Status::OK();
+}
+
 //
 // Closing files
 //
@@ -1185,6 +1276,58 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+Status FileWriteVectored(int fd, const std::vector<std::shared_ptr<Buffer>>& buffers) {
+#if defined(_WIN32)
+  for (const auto& buffer : buffers) {
+    RETURN_NOT_OK(FileWrite(fd, buffer->data(), buffer->size()));
+  }
+  return Status::OK();
+#else
+  std::vector<struct iovec> iov;
+  iov.reserve(buffers.size());
+  for (const auto& buffer : buffers) {
+    if (buffer->size() > 0) {
+      iov.push_back({const_cast<uint8_t*>(buffer->data()),
+                     static_cast<size_t>(buffer->size())});
+    }
+  }
+
+  size_t i = 0;
+  while (i < iov.size()) {
+    // A buffer too large for a single write is written on its own
+    if (iov[i].iov_len > ARROW_MAX_IO_CHUNKSIZE) {
+      RETURN_NOT_OK(FileWrite(fd, static_cast<const uint8_t*>(iov[i].iov_base),
+                              static_cast<int64_t>(iov[i].iov_len)));
+      ++i;
+      continue;
+    }
+    // Gather at most IOV_MAX buffers, and ARROW_MAX_IO_CHUNKSIZE bytes
+    int count = 0;
+    size_t nbytes = 0;
+    while (i + count < iov.size() && count < IOV_MAX &&
+           nbytes + iov[i + count].iov_len <= ARROW_MAX_IO_CHUNKSIZE) {
+      nbytes += iov[i + count].iov_len;
+      ++count;
+    }
+    ssize_t ret = writev(fd, iov.data() + i, count);
+    if (ret == -1) {
+      return IOErrorFromErrno(errno, "Error writing bytes to file");
+    }
+    // Skip the buffers written in full, then the written part of the next one
+    auto written = static_cast<size_t>(ret);
+    while (i < iov.size() && written >= iov[i].iov_len) {
+      written -= iov[i].iov_len;
+      ++i;
+    }
+    if (written > 0) {
+      iov[i].iov_base = static_cast<uint8_t*>(iov[i].iov_base) + written;
+      iov[i].iov_len -= written;
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
@@ -192,8 +192,12 @@ ARROW_EXPORT
 Result<bool> FileExists(const PlatformFilename& path);
 
 /// Open a file for reading and return a file descriptor.
+///
+/// If `direct_io` is true, reads bypass the OS page cache (O_DIRECT on Linux,
+/// F_NOCACHE on macOS).  On Linux, they must then be aligned on the logical
+/// block size of the device.
 ARROW_EXPORT
-Result<int> FileOpenReadable(const PlatformFilename& file_name);
+Result<int> FileOpenReadable(const PlatformFilename& file_name, bool direct_io = false);
 
 /// Open a file for writing and return a file descriptor.
 ARROW_EXPORT
@@ -209,6 +213,10 @@ Result<int64_t> FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nb
 
 ARROW_EXPORT
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
+/// Write the buffers in order at the current file position, with as few
+/// system calls as possible.
+ARROW_EXPORT
+Status FileWriteVectored(int fd, const std::vector<std::shared_ptr<Buffer>>& buffers);
 ARROW_EXPORT
 Status FileTruncate(int fd, const int64_t size);
 
@@ -236,6 +244,21 @@ ARROW_EXPORT
 Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
                       void** new_addr);
 
+enum class MemoryAdvice : int8_t { Normal, Sequential, Random, WillNeed, HugePage };
+
+/// \brief Hint the kernel about how a memory-mapped region will be accessed
+///
+/// The region is extended down to a page boundary.  Hints that the platform
+/// doesn't support are ignored.
+ARROW_EXPORT
+Status MemoryAdvise(void* addr, size_t size, MemoryAdvice advice);
+
+/// \brief Hint the kernel that a region of a file will be read soon
+///
+/// This is a no-op on platforms without posix_fadvise().
+ARROW_EXPORT
+Status FileAdviseWillNeed(int fd, int64_t offset, int64_t length);
+
 ARROW_EXPORT
 Result<std::string> GetEnvVar(const char* name);
 ARROW_EXPORT
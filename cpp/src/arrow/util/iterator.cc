@@ -21,35 +21,96 @@
 #include <cstdint>
 #include <deque>
 #include <mutex>
-#include <thread>
+#include <vector>
 
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
+
+class ReadaheadBudget::Impl {
+ public:
+  explicit Impl(int64_t max_bytes) : max_bytes_(max_bytes) {}
+
+  int64_t max_bytes() const { return max_bytes_; }
+
+  int64_t bytes_used() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_used_;
+  }
+
+  bool Exhausted() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_used_ >= max_bytes_;
+  }
+
+  void Acquire(int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_used_ += nbytes;
+  }
+
+  // If the budget is exhausted, arrange for `on_release` to be called on
+  // the next release of bytes and return true.
+  bool WaitIfExhausted(std::function<void()> on_release) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (bytes_used_ < max_bytes_) {
+      return false;
+    }
+    waiters_.push_back(std::move(on_release));
+    return true;
+  }
+
+  void Release(int64_t nbytes) {
+    if (nbytes == 0) {
+      return;
+    }
+    std::vector<std::function<void()>> waiters;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_used_ -= nbytes;
+      DCHECK_GE(bytes_used_, 0);
+      waiters.swap(waiters_);
+    }
+    // Call outside of the lock, as waiters may re-subscribe
+    for (auto& waiter : waiters) {
+      waiter();
+    }
+  }
+
+ private:
+  const int64_t max_bytes_;
+  int64_t bytes_used_ = 0;
+  std::vector<std::function<void()>> waiters_;
+  std::mutex mutex_;
+};
+
+ReadaheadBudget::ReadaheadBudget(int64_t max_bytes) : impl_(new Impl(max_bytes)) {}
+
+ReadaheadBudget::~ReadaheadBudget() {}
+
+int64_t ReadaheadBudget::max_bytes() const { return impl_->max_bytes(); }
+
+int64_t ReadaheadBudget::bytes_used() const { return impl_->bytes_used(); }
+
 namespace detail {
 
 ReadaheadPromise::~ReadaheadPromise() {}
 
+// The queue doesn't own a thread: whenever there is work to do, a task is
+// spawned on the I/O thread pool that drains the todo list (calling the
+// promises in order), then exits.  At most one such task runs at a time.
 class ReadaheadQueue::Impl : public std::enable_shared_from_this<ReadaheadQueue::Impl> {
  public:
-  explicit Impl(int64_t readahead_queue_size) : max_readahead_(readahead_queue_size) {}
+  Impl(int64_t readahead_queue_size, std::shared_ptr<ReadaheadBudget::Impl> budget)
+      : max_readahead_(readahead_queue_size), budget_(std::move(budget)) {}
 
   ~Impl() { EnsureShutdownOrDie(false); }
 
-  void Start() {
-    // Cannot do this in constructor as shared_from_this() would throw
-    DCHECK(!thread_.joinable());
-    auto self = shared_from_this();
-    thread_ = std::thread([self]() { self->DoWork(); });
-    DCHECK(thread_.joinable());
-  }
-
   void EnsureShutdownOrDie(bool wait = true) {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!please_shutdown_) {
       ARROW_CHECK_OK(ShutdownUnlocked(std::move(lock), wait));
     }
-    DCHECK(!thread_.joinable());
   }
 
   Status Append(std::unique_ptr<ReadaheadPromise> promise) {
@@ -58,12 +119,7 @@ class ReadaheadQueue::Impl : public std::enable_shared_from_this<ReadaheadQueue:
       return Status::Invalid("Shutdown requested");
     }
     todo_.push_back(std::move(promise));
-    if (static_cast<int64_t>(todo_.size()) == 1) {
-      // Signal there's more work to do
-      lock.unlock();
-      worker_wakeup_.notify_one();
-    }
-    return Status::OK();
+    return ScheduleWorkUnlocked();
   }
 
   Status PopDone(std::unique_ptr<ReadaheadPromise>* out) {
@@ -74,10 +130,16 @@ class ReadaheadQueue::Impl : public std::enable_shared_from_this<ReadaheadQueue:
     work_done_.wait(lock, [this]() { return done_.size() > 0; });
     *out = std::move(done_.front());
     done_.pop_front();
-    if (static_cast<int64_t>(done_.size()) < max_readahead_) {
-      // Signal there's more work to do
-      lock.unlock();
-      worker_wakeup_.notify_one();
+    int64_t nbytes = 0;
+    if (!please_shutdown_) {
+      nbytes = (*out)->nbytes();
+      bytes_acquired_ -= nbytes;
+    }
+    RETURN_NOT_OK(ScheduleWorkUnlocked());
+    lock.unlock();
+    if (budget_) {
+      // May wake up other queues sharing the budget
+      budget_->Release(nbytes);
     }
     return Status::OK();
   }
@@ -90,10 +152,7 @@ class ReadaheadQueue::Impl : public std::enable_shared_from_this<ReadaheadQueue:
     while (static_cast<int64_t>(done_.size() + todo_.size()) < max_readahead_) {
       todo_.push_back(factory());
     }
-    // Signal there's more work to do
-    lock.unlock();
-    worker_wakeup_.notify_one();
-    return Status::OK();
+    return ScheduleWorkUnlocked();
   }
 
   Status Shutdown(bool wait = true) {
@@ -104,54 +163,105 @@ class ReadaheadQueue::Impl : public std::enable_shared_from_this<ReadaheadQueue:
     if (please_shutdown_) {
       return Status::Invalid("Shutdown already requested");
     }
-    DCHECK(thread_.joinable());
     please_shutdown_ = true;
-    lock.unlock();
-    worker_wakeup_.notify_one();
     if (wait) {
-      thread_.join();
-    } else {
-      thread_.detach();
+      // Wait for the promise currently being called, if any
+      worker_done_.wait(lock, [this]() { return !worker_running_; });
+    }
+    // Values that were read ahead won't be consumed anymore
+    const int64_t nbytes = bytes_acquired_;
+    bytes_acquired_ = 0;
+    lock.unlock();
+    if (budget_) {
+      budget_->Release(nbytes);
     }
     return Status::OK();
   }
 
+  bool HasWorkUnlocked() const {
+    return !please_shutdown_ && todo_.size() > 0 &&
+           static_cast<int64_t>(done_.size()) < max_readahead_ && !OverBudgetUnlocked();
+  }
+
+  // We may always read ahead one value, so that the consumer can make progress
+  bool OverBudgetUnlocked() const {
+    return budget_ && !done_.empty() && budget_->Exhausted();
+  }
+
+  // Spawn a worker task if there is work to do and none is running already
+  Status ScheduleWorkUnlocked() {
+    if (worker_running_ || waiting_for_budget_ || !HasWorkUnlocked()) {
+      if (!worker_running_ && !waiting_for_budget_ && OverBudgetUnlocked()) {
+        WaitForBudgetUnlocked();
+      }
+      return Status::OK();
+    }
+    auto self = shared_from_this();
+    worker_running_ = true;
+    Status st = internal::GetIOThreadPool()->Spawn([self]() { self->DoWork(); });
+    if (!st.ok()) {
+      worker_running_ = false;
+    }
+    return st;
+  }
+
+  // Try again to schedule work when another queue gives back some budget
+  void WaitForBudgetUnlocked() {
+    std::weak_ptr<Impl> weak_self = shared_from_this();
+    waiting_for_budget_ = budget_->WaitIfExhausted([weak_self]() {
+      auto self = weak_self.lock();
+      if (self) {
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        self->waiting_for_budget_ = false;
+        ARROW_UNUSED(self->ScheduleWorkUnlocked());
+      }
+    });
+    if (!waiting_for_budget_) {
+      // Budget was released in the meantime
+      ARROW_UNUSED(ScheduleWorkUnlocked());
+    }
+  }
+
   void DoWork() {
     std::unique_lock<std::mutex> lock(mutex_);
-    while (!please_shutdown_) {
-      while (static_cast<int64_t>(done_.size()) < max_readahead_ && todo_.size() > 0) {
-        auto promise = std::move(todo_.front());
-        todo_.pop_front();
-        lock.unlock();
-        promise->Call();
-        lock.lock();
-        done_.push_back(std::move(promise));
-        work_done_.notify_one();
-        // Exit eagerly
-        if (please_shutdown_) {
-          return;
-        }
+    while (HasWorkUnlocked()) {
+      auto promise = std::move(todo_.front());
+      todo_.pop_front();
+      lock.unlock();
+      promise->Call();
+      lock.lock();
+      if (budget_ && !please_shutdown_) {
+        const int64_t nbytes = promise->nbytes();
+        budget_->Acquire(nbytes);
+        bytes_acquired_ += nbytes;
       }
-      // Wait for more work to do
-      worker_wakeup_.wait(lock);
+      done_.push_back(std::move(promise));
+      work_done_.notify_one();
     }
+    worker_running_ = false;
+    // We may have stopped because of the budget
+    ARROW_UNUSED(ScheduleWorkUnlocked());
+    worker_done_.notify_all();
   }
 
   std::deque<std::unique_ptr<ReadaheadPromise>> todo_;
   std::deque<std::unique_ptr<ReadaheadPromise>> done_;
   int64_t max_readahead_;
+  std::shared_ptr<ReadaheadBudget::Impl> budget_;
+  // Bytes acquired from the budget for the values in done_
+  int64_t bytes_acquired_ = 0;
   bool please_shutdown_ = false;
+  bool worker_running_ = false;
+  bool waiting_for_budget_ = false;
 
-  std::thread thread_;
   std::mutex mutex_;
-  std::condition_variable worker_wakeup_;
   std::condition_variable work_done_;
+  std::condition_variable worker_done_;
 };
 
-ReadaheadQueue::ReadaheadQueue(int readahead_queue_size)
-    : impl_(new Impl(readahead_queue_size)) {
-  impl_->Start();
-}
+ReadaheadQueue::ReadaheadQueue(int readahead_queue_size,
+                               std::shared_ptr<ReadaheadBudget> budget)
+    : impl_(new Impl(readahead_queue_size, budget ? budget->impl_ : nullptr)) {}
 
 ReadaheadQueue::~ReadaheadQueue() {}
 
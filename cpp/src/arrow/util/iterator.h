@@ -401,19 +401,51 @@ Iterator<T> MakeFlattenIterator(Iterator<Iterator<T>> it) {
   return Iterator<T>(FlattenIterator<T>(std::move(it)));
 }
 
+namespace detail {
+class ReadaheadQueue;
+}  // namespace detail
+
+/// \brief A memory budget shared by several readahead iterators
+///
+/// Readahead iterators attached to a budget stop reading ahead while the
+/// total size of the values they have buffered (and not yet handed out)
+/// exceeds the budget.  Each iterator may always buffer at least one value,
+/// so that consumers make progress regardless of the other iterators.
+class ARROW_EXPORT ReadaheadBudget {
+ public:
+  explicit ReadaheadBudget(int64_t max_bytes);
+  ~ReadaheadBudget();
+
+  int64_t max_bytes() const;
+
+  /// \brief The number of bytes currently buffered by attached iterators
+  int64_t bytes_used() const;
+
+ protected:
+  friend class detail::ReadaheadQueue;
+
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
 namespace detail {
 
 // A type-erased promise object for ReadaheadQueue.
 struct ARROW_EXPORT ReadaheadPromise {
   virtual ~ReadaheadPromise();
   virtual void Call() = 0;
+  // The number of bytes held by the result, for ReadaheadBudget accounting
+  virtual int64_t nbytes() const { return 0; }
 };
 
 template <typename T>
 struct ReadaheadIteratorPromise : ReadaheadPromise {
+  using SizeFunction = std::function<int64_t(const T&)>;
+
   ~ReadaheadIteratorPromise() override {}
 
-  explicit ReadaheadIteratorPromise(Iterator<T>* it) : it_(it) {}
+  explicit ReadaheadIteratorPromise(Iterator<T>* it, const SizeFunction* size_of = NULLPTR)
+      : it_(it), size_of_(size_of) {}
 
   void Call() override {
     assert(!called_);
@@ -421,14 +453,23 @@ struct ReadaheadIteratorPromise : ReadaheadPromise {
     called_ = true;
   }
 
+  int64_t nbytes() const override {
+    if (size_of_ == NULLPTR || !out_.ok() || *out_ == IterationTraits<T>::End()) {
+      return 0;
+    }
+    return (*size_of_)(*out_);
+  }
+
   Iterator<T>* it_;
+  const SizeFunction* size_of_;
   Result<T> out_ = IterationTraits<T>::End();
   bool called_ = false;
 };
 
 class ARROW_EXPORT ReadaheadQueue {
  public:
-  explicit ReadaheadQueue(int readahead_queue_size);
+  explicit ReadaheadQueue(int readahead_queue_size,
+                          std::shared_ptr<ReadaheadBudget> budget = NULLPTR);
   ~ReadaheadQueue();
 
   Status Append(std::unique_ptr<ReadaheadPromise>);
@@ -445,10 +486,11 @@ class ARROW_EXPORT ReadaheadQueue {
 }  // namespace detail
 
 /// \brief Readahead iterator that iterates on the underlying iterator in a
-/// separate thread, getting up to N values in advance.
+/// background task on the I/O thread pool, getting up to N values in advance.
 template <typename T>
 class ReadaheadIterator {
   using PromiseType = typename detail::ReadaheadIteratorPromise<T>;
+  using SizeFunction = typename PromiseType::SizeFunction;
 
  public:
   // Public default constructor creates an empty iterator
@@ -483,28 +525,36 @@ class ReadaheadIterator {
     return out;
   }
 
-  static Result<Iterator<T>> Make(Iterator<T> it, int readahead_queue_size) {
-    ReadaheadIterator rh(std::move(it), readahead_queue_size);
+  static Result<Iterator<T>> Make(Iterator<T> it, int readahead_queue_size,
+                                  std::shared_ptr<ReadaheadBudget> budget = NULLPTR,
+                                  SizeFunction size_of = NULLPTR) {
+    ReadaheadIterator rh(std::move(it), readahead_queue_size, std::move(budget),
+                         std::move(size_of));
     ARROW_RETURN_NOT_OK(rh.Pump());
     return Iterator<T>(std::move(rh));
   }
 
  private:
-  explicit ReadaheadIterator(Iterator<T> it, int readahead_queue_size)
+  explicit ReadaheadIterator(Iterator<T> it, int readahead_queue_size,
+                             std::shared_ptr<ReadaheadBudget> budget,
+                             SizeFunction size_of)
       : it_(new Iterator<T>(std::move(it))),
-        queue_(new detail::ReadaheadQueue(readahead_queue_size)) {}
+        size_of_(size_of ? new SizeFunction(std::move(size_of)) : NULLPTR),
+        queue_(new detail::ReadaheadQueue(readahead_queue_size, std::move(budget))) {}
 
   Status Pump() {
     return queue_->Pump([this]() { return MakePromise(); });
   }
 
   std::unique_ptr<detail::ReadaheadPromise> MakePromise() {
-    return std::unique_ptr<detail::ReadaheadPromise>(new PromiseType{it_.get()});
+    return std::unique_ptr<detail::ReadaheadPromise>(
+        new PromiseType{it_.get(), size_of_.get()});
   }
 
-  // The underlying iterator is referenced by pointer in ReadaheadPromise,
-  // so make sure it doesn't move.
+  // The underlying iterator and size function are referenced by pointer in
+  // ReadaheadPromise, so make sure they don't move.
   std::unique_ptr<Iterator<T>> it_;
+  std::unique_ptr<SizeFunction> size_of_;
   std::unique_ptr<detail::ReadaheadQueue> queue_;
   bool done_ = false;
 };
@@ -514,4 +564,16 @@ Result<Iterator<T>> MakeReadaheadIterator(Iterator<T> it, int readahead_queue_si
   return ReadaheadIterator<T>::Make(std::move(it), readahead_queue_size);
 }
 
+/// \brief Like MakeReadaheadIterator, but also stop reading ahead while the
+/// values buffered by all iterators sharing `budget` exceed it.
+///
+/// `size_of` returns the number of bytes held by a value.
+template <typename T>
+Result<Iterator<T>> MakeReadaheadIterator(
+    Iterator<T> it, int readahead_queue_size, std::shared_ptr<ReadaheadBudget> budget,
+    typename detail::ReadaheadIteratorPromise<T>::SizeFunction size_of) {
+  return ReadaheadIterator<T>::Make(std::move(it), readahead_queue_size,
+                                    std::move(budget), std::move(size_of));
+}
+
 }  // namespace arrow
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -375,10 +376,11 @@ TEST(ReadaheadIterator, Trace) {
     ASSERT_EQ(values[i], TestInt());
   }
 
-  // Values were all emitted from the same thread, and it's not this thread
+  // Values were all emitted from the I/O thread pool, not from this thread
   const auto& thread_ids = tracing->thread_ids();
-  ASSERT_EQ(thread_ids.size(), 1);
-  ASSERT_NE(*thread_ids.begin(), std::this_thread::get_id());
+  ASSERT_GE(thread_ids.size(), 1);
+  ASSERT_LE(thread_ids.size(), static_cast<size_t>(GetIOThreadPoolCapacity()));
+  ASSERT_EQ(thread_ids.count(std::this_thread::get_id()), 0);
 }
 
 TEST(ReadaheadIterator, NextError) {
@@ -402,4 +404,94 @@ TEST(ReadaheadIterator, NextError) {
   AssertIteratorExhausted(it);
 }
 
+int64_t TestIntSize(const TestInt& v) { return v.value > 0 ? v.value : 0; }
+
+TEST(ReadaheadIterator, Budget) {
+  TracingIterator<TestInt> tracing_it(VectorIt({1, 2, 3, 4, 5, 6}));
+  auto tracing = tracing_it.state();
+  auto budget = std::make_shared<ReadaheadBudget>(5);
+
+  ASSERT_OK_AND_ASSIGN(auto it,
+                       MakeReadaheadIterator(Iterator<TestInt>(std::move(tracing_it)), 10,
+                                             budget, TestIntSize));
+  // Reading ahead stops once the budget is exceeded
+  tracing->WaitForValues(3);
+  SleepABit();
+  tracing->AssertValuesEqual({1, 2, 3});
+  ASSERT_EQ(budget->bytes_used(), 6);
+
+  AssertIteratorNext({1}, it);
+  SleepABit();
+  tracing->AssertValuesEqual({1, 2, 3});
+  ASSERT_EQ(budget->bytes_used(), 5);
+
+  AssertIteratorNext({2}, it);
+  tracing->WaitForValues(4);
+  SleepABit();
+  tracing->AssertValuesEqual({1, 2, 3, 4});
+  ASSERT_EQ(budget->bytes_used(), 7);
+
+  // A single value larger than the budget is still read ahead
+  AssertIteratorNext({3}, it);
+  AssertIteratorNext({4}, it);
+  tracing->WaitForValues(5);
+  SleepABit();
+  tracing->AssertValuesEqual({1, 2, 3, 4, 5});
+
+  AssertIteratorNext({5}, it);
+  AssertIteratorNext({6}, it);
+  AssertIteratorExhausted(it);
+  ASSERT_EQ(budget->bytes_used(), 0);
+}
+
+TEST(ReadaheadIterator, SharedBudget) {
+  TracingIterator<TestInt> tracing_it1(VectorIt({4, 4}));
+  TracingIterator<TestInt> tracing_it2(VectorIt({1, 1, 1}));
+  auto tracing1 = tracing_it1.state();
+  auto tracing2 = tracing_it2.state();
+  auto budget = std::make_shared<ReadaheadBudget>(5);
+
+  ASSERT_OK_AND_ASSIGN(auto it1,
+                       MakeReadaheadIterator(Iterator<TestInt>(std::move(tracing_it1)),
+                                             10, budget, TestIntSize));
+  tracing1->WaitForValues(2);
+  SleepABit();
+  tracing1->AssertValuesEqual({4, 4});
+  ASSERT_EQ(budget->bytes_used(), 8);
+
+  // The second iterator may only read ahead one value
+  ASSERT_OK_AND_ASSIGN(auto it2,
+                       MakeReadaheadIterator(Iterator<TestInt>(std::move(tracing_it2)),
+                                             10, budget, TestIntSize));
+  tracing2->WaitForValues(1);
+  SleepABit();
+  tracing2->AssertValuesEqual({1});
+
+  // Consuming from the first iterator wakes up the second
+  AssertIteratorNext({4}, it1);
+  AssertIteratorNext({4}, it1);
+  tracing2->WaitForValues(4);
+  tracing2->AssertValuesStartwith({1, 1, 1, {}});
+  AssertIteratorExhausted(it1);
+
+  AssertIteratorNext({1}, it2);
+  AssertIteratorNext({1}, it2);
+  AssertIteratorNext({1}, it2);
+  AssertIteratorExhausted(it2);
+}
+
+TEST(ReadaheadIterator, BudgetReleasedOnDestruction) {
+  auto budget = std::make_shared<ReadaheadBudget>(100);
+  {
+    TracingIterator<TestInt> tracing_it(VectorIt({1, 2, 3}));
+    auto tracing = tracing_it.state();
+    ASSERT_OK_AND_ASSIGN(
+        auto it, MakeReadaheadIterator(Iterator<TestInt>(std::move(tracing_it)), 10,
+                                       budget, TestIntSize));
+    tracing->WaitForValues(3);
+    AssertIteratorNext({1}, it);
+  }
+  ASSERT_EQ(budget->bytes_used(), 0);
+}
+
 }  // namespace arrow
@@ -49,6 +49,24 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers of at least eight digits, parsed by chunks
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {
+      "12345678", "99999999", "100000000", "314159265",
+      std::to_string(c_int_limits::max()), std::to_string(c_int_limits::max() / 7)};
+  if (c_int_limits::is_signed) {
+    base_strings.push_back("-87654321");
+    base_strings.push_back(std::to_string(c_int_limits::min()));
+  }
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"0.0",         "5",        "-12.3",
                                            "98765430000", "3456.789", "0.0012345",
@@ -71,6 +89,19 @@ static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   return strings;
 }
 
+// The ISO-8601 variants accepted by the parser
+static std::vector<std::string> MakeISO8601Strings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"2018-11-13", "2018-11-13T17",
+                                           "2018-11-13T17:11Z", "2018-11-13T17:11:10",
+                                           "2016-02-29T11:22:33Z"};
+
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 template <typename c_int, typename c_int_limits = std::numeric_limits<c_int>>
 static typename std::enable_if<c_int_limits::is_signed, std::vector<c_int>>::type
 MakeInts(int32_t num_items) {
@@ -98,8 +129,8 @@ static std::vector<c_float> MakeFloats(int32_t num_items) {
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeIntStrings<C_TYPE>(1000);
+static void ParseIntegers(benchmark::State& state,  // NOLINT non-const reference
+                          const std::vector<std::string>& strings) {
   StringConverter<ARROW_TYPE> converter;
 
   while (state.KeepRunning()) {
@@ -117,6 +148,16 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  ParseIntegers<ARROW_TYPE>(state, MakeIntStrings<C_TYPE>(1000));
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LongIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  ParseIntegers<ARROW_TYPE>(state, MakeLongIntStrings<C_TYPE>(1000));
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeFloatStrings(1000);
@@ -137,12 +178,12 @@ static void FloatParsing(benchmark::State& state) {  // NOLINT non-const referen
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
-template <TimeUnit::type UNIT>
-static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
+static void ParseTimestamps(benchmark::State& state,  // NOLINT non-const reference
+                            TimeUnit::type unit,
+                            const std::vector<std::string>& strings) {
   using c_type = TimestampType::c_type;
 
-  auto strings = MakeTimestampStrings(1000);
-  auto type = timestamp(UNIT);
+  auto type = timestamp(unit);
   StringConverter<TimestampType> converter(type);
 
   while (state.KeepRunning()) {
@@ -160,6 +201,16 @@ static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const ref
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <TimeUnit::type UNIT>
+static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
+  ParseTimestamps(state, UNIT, MakeTimestampStrings(1000));
+}
+
+template <TimeUnit::type UNIT>
+static void TimestampParsingISO8601(benchmark::State& state) {  // NOLINT
+  ParseTimestamps(state, UNIT, MakeISO8601Strings(1000));
+}
+
 struct DummyAppender {
   Status operator()(util::string_view v) {
     if (pos_ >= static_cast<int32_t>(v.size())) {
@@ -212,6 +263,11 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(FloatParsing, DoubleType);
 
@@ -220,6 +276,9 @@ BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MILLI);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::NANO);
 
+BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::SECOND);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::NANO);
+
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int16Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int32Type);
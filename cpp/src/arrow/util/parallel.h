@@ -21,6 +21,7 @@
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "arrow/status.h"
@@ -47,6 +48,20 @@ Status ParallelFor(int num_tasks, FUNCTION&& func) {
   return st;
 }
 
+// A variant of ParallelFor() which runs the tasks serially on the calling
+// thread if `use_threads` is false.
+
+template <class FUNCTION>
+Status OptionalParallelFor(bool use_threads, int num_tasks, FUNCTION&& func) {
+  if (use_threads) {
+    return ParallelFor(num_tasks, std::forward<FUNCTION>(func));
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
 // A variant of ParallelFor() with an explicit number of dedicated threads.
 // In most cases it's more appropriate to use the 2-argument ParallelFor (above),
 // or directly the global CPU thread pool (arrow/util/thread-pool.h).
@@ -29,8 +29,10 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -131,6 +133,61 @@ namespace detail {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// The helpers below process eight characters at once as a 64-bit word whose
+// lowest byte is the first character.
+
+inline uint64_t LoadEightChars(const char* s) {
+  return BitUtil::FromLittleEndian(
+      util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s)));
+}
+
+// Whether all eight characters are decimal digits: the high nibble of each
+// byte must be 3, and adding 6 must not carry into it
+inline bool AreEightDigits(uint64_t chars) {
+  return ((chars & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((chars + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// The value of eight decimal digits, combining adjacent digits, then pairs of
+// digits, then groups of four
+inline uint32_t ParseEightDigits(uint64_t chars) {
+  chars = ((chars & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+  chars = ((chars & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+  return static_cast<uint32_t>(((chars & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >>
+                               32);
+}
+
+// For eight decimal digits, the value of the two-digit number starting at
+// each byte (only meaningful for the first seven bytes)
+inline uint64_t ParseDigitPairs(uint64_t chars) {
+  const uint64_t digits = chars - 0x3030303030303030ULL;
+  // No byte can carry over as values never exceed 99
+  return digits * 10 + (digits >> 8);
+}
+
+// Parse a number whose digit count guarantees it fits in uint64_t, eight
+// digits at a time
+inline bool ParseUnsignedByChunks(const char* s, size_t length, uint64_t* out) {
+  uint64_t result = 0;
+  for (; length >= 8; s += 8, length -= 8) {
+    const uint64_t chars = LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE(!AreEightDigits(chars))) {
+      return false;
+    }
+    result = result * 100000000U + ParseEightDigits(chars);
+  }
+  for (; length > 0; ++s, --length) {
+    const uint8_t digit = ParseDecimalDigit(*s);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  *out = result;
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -190,6 +247,15 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8 && length <= 9) {
+    // Long numbers are parsed faster by chunks, nine digits can't overflow
+    uint64_t value;
+    if (ARROW_PREDICT_FALSE(!ParseUnsignedByChunks(s, length, &value))) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(value);
+    return true;
+  }
   uint32_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -209,6 +275,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8 && length <= 19) {
+    // See above, nineteen digits can't overflow
+    return ParseUnsignedByChunks(s, length, out);
+  }
   uint64_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -449,20 +519,24 @@ class StringConverter<TimestampType> {
   }
 
   bool ParseYYYY_MM_DD(const char* s, arrow_vendored::date::year_month_day* out) {
-    uint16_t year;
-    uint8_t month, day;
-    if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
+    // "YYYY-MM-" is validated and parsed as a single word
+    static constexpr uint64_t kSeparatorMask = 0xFF0000FF00000000ULL;
+    static constexpr uint64_t kSeparators = 0x2D00002D00000000ULL;  // '-'
+    uint64_t chars = detail::LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE((chars & kSeparatorMask) != kSeparators)) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 4, &year))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 5, 2, &month))) {
+    chars = (chars & ~kSeparatorMask) | (0x3030303030303030ULL & kSeparatorMask);
+    if (ARROW_PREDICT_FALSE(!detail::AreEightDigits(chars))) {
       return false;
     }
+    uint8_t day;
     if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 8, 2, &day))) {
       return false;
     }
+    const uint64_t pairs = detail::ParseDigitPairs(chars);
+    const auto year = static_cast<int>((pairs & 0xFF) * 100 + ((pairs >> 16) & 0xFF));
+    const auto month = static_cast<unsigned>((pairs >> 40) & 0xFF);
     *out = {arrow_vendored::date::year{year}, arrow_vendored::date::month{month},
             arrow_vendored::date::day{day}};
     return out->ok();
@@ -502,19 +576,21 @@ class StringConverter<TimestampType> {
   }
 
   bool ParseHH_MM_SS(const char* s, std::chrono::duration<value_type>* out) {
-    uint8_t hours, minutes, seconds;
-    if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 2, &hours))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 3, 2, &minutes))) {
+    // "hh:mm:ss" is validated and parsed as a single word
+    static constexpr uint64_t kSeparatorMask = 0x0000FF0000FF0000ULL;
+    static constexpr uint64_t kSeparators = 0x00003A00003A0000ULL;  // ':'
+    uint64_t chars = detail::LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE((chars & kSeparatorMask) != kSeparators)) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 6, 2, &seconds))) {
+    chars = (chars & ~kSeparatorMask) | (0x3030303030303030ULL & kSeparatorMask);
+    if (ARROW_PREDICT_FALSE(!detail::AreEightDigits(chars))) {
       return false;
     }
+    const uint64_t pairs = detail::ParseDigitPairs(chars);
+    const auto hours = static_cast<uint32_t>(pairs & 0xFF);
+    const auto minutes = static_cast<uint32_t>((pairs >> 24) & 0xFF);
+    const auto seconds = static_cast<uint32_t>((pairs >> 48) & 0xFF);
     if (ARROW_PREDICT_FALSE(hours >= 24)) {
       return false;
     }
@@ -205,6 +205,16 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
 
+  // Long numbers are parsed eight digits at a time
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "99999999", 99999999UL);
+  AssertConversion(converter, "0000000012345678", 12345678UL);
+  AssertConversion(converter, "100000000", 100000000UL);
+  AssertConversionFails(converter, "1234567a");
+  AssertConversionFails(converter, "1234567/");
+  AssertConversionFails(converter, "123:5678");
+  AssertConversionFails(converter, "12345678a");
+
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
@@ -241,9 +251,17 @@ TEST(StringConversion, ToUInt64) {
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
 
+  // Long numbers are parsed eight digits at a time
+  AssertConversion(converter, "1234567890123456", 1234567890123456ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
+  AssertConversion(converter, "10000000000000000000", 10000000000000000000ULL);
+  AssertConversionFails(converter, "123456789012345 7");
+  AssertConversionFails(converter, "1234567890123456789\xff");
+
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "99999999999999999999");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -332,6 +350,12 @@ TEST(StringConversion, ToTimestampDateTime) {
     AssertConversionFails(converter, "1970-01-01 00:00:60");
     AssertConversionFails(converter, "1970-01-01 00:00,00");
     AssertConversionFails(converter, "1970-01-01 00,00:00");
+    AssertConversionFails(converter, "1970-01-01 0a:00:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:0:");
+    AssertConversionFails(converter, "1970-01-01 00::0:00");
+    AssertConversionFails(converter, "197a-01-01 00:00:00");
+    AssertConversionFails(converter, "1970-0--01 00:00:00");
+    AssertConversionFails(converter, "1970-01-0a 00:00:00");
   }
   {
     StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
@@ -17,6 +17,7 @@
 
 // From Apache Impala (incubating) as of 2016-01-29
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <random>
@@ -137,6 +138,46 @@ TEST(BitArray, TestValues) {
   }
 }
 
+// Writes 'num_vals' values with width 'bit_width' and reads them back in
+// batches, which unpack as many values as possible 32 at a time.
+template <typename T>
+void TestBitArrayBatchValues(int bit_width, int num_vals) {
+  int len = static_cast<int>(BitUtil::BytesForBits(bit_width * num_vals));
+  const uint64_t mask = bit_width == 64 ? ~0ULL : (1ULL << bit_width) - 1;
+
+  std::vector<uint8_t> buffer(len);
+  std::vector<T> expected(num_vals);
+  BitUtil::BitWriter writer(buffer.data(), len);
+  for (int i = 0; i < num_vals; ++i) {
+    // Spread the set bits over the whole width
+    expected[i] = static_cast<T>((i * 2654435761ULL) & mask);
+    EXPECT_TRUE(writer.PutValue(static_cast<uint64_t>(expected[i]), bit_width));
+  }
+  writer.Flush();
+
+  // A first batch of 3 values leaves the reader unaligned
+  BitUtil::BitReader reader(buffer.data(), len);
+  std::vector<T> values(num_vals);
+  const int first_batch = std::min(num_vals, 3);
+  ASSERT_EQ(first_batch, reader.GetBatch(bit_width, values.data(), first_batch));
+  ASSERT_EQ(num_vals - first_batch,
+            reader.GetBatch(bit_width, values.data() + first_batch,
+                            num_vals - first_batch));
+  ASSERT_EQ(expected, values);
+}
+
+TEST(BitArray, TestBatchValues) {
+  for (int width = 1; width <= MAX_WIDTH; ++width) {
+    for (int num_vals : {1, 31, 32, 100, 1024, 1030}) {
+      TestBitArrayBatchValues<uint32_t>(width, num_vals);
+      TestBitArrayBatchValues<uint64_t>(width, num_vals);
+      if (width < 16) {
+        TestBitArrayBatchValues<int16_t>(width, num_vals);
+      }
+    }
+  }
+}
+
 // Test some mixed values
 TEST(BitArray, TestMixed) {
   const int len = 1024;
@@ -44,6 +44,11 @@
 #include <nmmintrin.h>
 #endif
 
+#if defined(__AVX2__)
+#define ARROW_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
 #endif  // ARROW_USE_SIMD
 
 // MSVC x86-64
@@ -18,6 +18,7 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -28,12 +29,27 @@
 
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace internal {
 
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  State()
+      : desired_capacity_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        work_stealing_(false),
+        worker_queues_(std::make_shared<WorkerQueues>()),
+        num_queued_tasks_(0),
+        num_sleeping_(0) {}
+
+  // A worker-local task queue, for work-stealing mode
+  struct WorkerQueue {
+    std::mutex mutex_;
+    std::deque<std::function<void()>> tasks_;
+  };
+  using WorkerQueues = std::vector<std::shared_ptr<WorkerQueue>>;
 
   // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
   // such as https://github.com/cameron314/concurrentqueue
@@ -50,10 +66,53 @@ struct ThreadPool::State {
   // Desired number of threads
   int desired_capacity_;
   // Are we shutting down?
-  bool please_shutdown_;
+  // (atomic as it is read without the mutex by work-stealing workers)
+  std::atomic<bool> please_shutdown_;
   bool quick_shutdown_;
+
+  // Work-stealing mode: each worker pushes the tasks it spawns to its own
+  // queue and runs them in LIFO order; idle workers take tasks from the
+  // shared `pending_tasks_` queue first, then steal from the front of other
+  // workers' queues.
+  bool work_stealing_;
+  // Immutable snapshot of the worker queues, replaced under `mutex_` when a
+  // worker starts or exits, and read with std::atomic_load() when stealing.
+  std::shared_ptr<const WorkerQueues> worker_queues_;
+  // Number of tasks in `pending_tasks_` and all worker queues
+  std::atomic<int64_t> num_queued_tasks_;
+  // Number of workers waiting on `cv_`
+  std::atomic<int> num_sleeping_;
+
+  void AddWorkerQueueUnlocked(std::shared_ptr<WorkerQueue> queue) {
+    auto queues = std::make_shared<WorkerQueues>(*std::atomic_load(&worker_queues_));
+    queues->push_back(std::move(queue));
+    std::atomic_store(&worker_queues_, std::shared_ptr<const WorkerQueues>(queues));
+  }
+
+  void RemoveWorkerQueueUnlocked(const WorkerQueue* queue) {
+    auto queues = std::make_shared<WorkerQueues>(*std::atomic_load(&worker_queues_));
+    queues->erase(std::remove_if(queues->begin(), queues->end(),
+                                 [&](const std::shared_ptr<WorkerQueue>& q) {
+                                   return q.get() == queue;
+                                 }),
+                  queues->end());
+    std::atomic_store(&worker_queues_, std::shared_ptr<const WorkerQueues>(queues));
+  }
+
+  // Wake up a sleeping worker after a task was pushed to a worker queue
+  void NotifyIfSleeping() {
+    if (num_sleeping_.load() > 0) {
+      // Taking the mutex ensures the sleeper is actually waiting on `cv_`
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_one();
+    }
+  }
 };
 
+// The queue of the work-stealing worker running on the current thread, if any
+static thread_local ThreadPool::State* current_worker_state = nullptr;
+static thread_local ThreadPool::State::WorkerQueue* current_worker_queue = nullptr;
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -84,7 +143,9 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
       {
         std::function<void()> task = std::move(state->pending_tasks_.front());
         state->pending_tasks_.pop_front();
+        --state->num_queued_tasks_;
         lock.unlock();
+        ARROW_TRACE_SPAN("thread_pool", "Task");
         task();
       }
       lock.lock();
@@ -113,6 +174,129 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   }
 }
 
+static bool PopLocalTask(ThreadPool::State::WorkerQueue* queue,
+                         std::function<void()>* task) {
+  std::lock_guard<std::mutex> lock(queue->mutex_);
+  if (queue->tasks_.empty()) {
+    return false;
+  }
+  // LIFO: the most recently spawned task is the most likely to be cache-hot
+  *task = std::move(queue->tasks_.back());
+  queue->tasks_.pop_back();
+  return true;
+}
+
+static bool PopSharedTask(ThreadPool::State* state, std::function<void()>* task) {
+  std::lock_guard<std::mutex> lock(state->mutex_);
+  if (state->pending_tasks_.empty()) {
+    return false;
+  }
+  *task = std::move(state->pending_tasks_.front());
+  state->pending_tasks_.pop_front();
+  return true;
+}
+
+static bool StealTask(ThreadPool::State* state, ThreadPool::State::WorkerQueue* self,
+                      std::function<void()>* task) {
+  // Start at a different victim on each thread to spread contention
+  static thread_local size_t next_victim = 0;
+  auto queues = std::atomic_load(&state->worker_queues_);
+  const size_t nqueues = queues->size();
+  for (size_t i = 0; i < nqueues; ++i) {
+    auto victim = (*queues)[(next_victim + i) % nqueues].get();
+    if (victim == self) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(victim->mutex_);
+    if (!victim->tasks_.empty()) {
+      // FIFO: steal the oldest task, which tends to be the largest
+      *task = std::move(victim->tasks_.front());
+      victim->tasks_.pop_front();
+      next_victim = (next_victim + i + 1) % nqueues;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Worker loop for work-stealing mode
+static void WorkStealingWorkerLoop(std::shared_ptr<ThreadPool::State> state,
+                                   std::list<std::thread>::iterator it) {
+  auto queue = std::make_shared<ThreadPool::State::WorkerQueue>();
+  current_worker_state = state.get();
+  current_worker_queue = queue.get();
+
+  std::unique_lock<std::mutex> lock(state->mutex_);
+
+  // Since we hold the lock, `it` now points to the correct thread object
+  // (LaunchWorkersUnlocked has exited)
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->AddWorkerQueueUnlocked(queue);
+
+  // If too many threads, we should secede from the pool
+  const auto should_secede = [&]() -> bool {
+    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+  };
+
+  while (!state->quick_shutdown_ && !should_secede()) {
+    lock.unlock();
+    {
+      std::function<void()> task;
+      if (PopLocalTask(queue.get(), &task) || PopSharedTask(state.get(), &task) ||
+          StealTask(state.get(), queue.get(), &task)) {
+        --state->num_queued_tasks_;
+        {
+          ARROW_TRACE_SPAN("thread_pool", "Task");
+          task();
+        }
+        lock.lock();
+        continue;
+      }
+    }
+    lock.lock();
+    // A task may have been pushed while we were looking
+    if (state->num_queued_tasks_.load() > 0) {
+      continue;
+    }
+    if (state->please_shutdown_) {
+      break;
+    }
+    // Wait for next wakeup.  Producers check `num_sleeping_` after updating
+    // `num_queued_tasks_`, so one of us is bound to see the other's update.
+    ++state->num_sleeping_;
+    if (state->num_queued_tasks_.load() == 0) {
+      state->cv_.wait(lock);
+    }
+    --state->num_sleeping_;
+  }
+
+  // Hand over any remaining local tasks before leaving
+  state->RemoveWorkerQueueUnlocked(queue.get());
+  current_worker_state = nullptr;
+  current_worker_queue = nullptr;
+  {
+    std::lock_guard<std::mutex> queue_lock(queue->mutex_);
+    if (state->quick_shutdown_) {
+      state->num_queued_tasks_ -= static_cast<int64_t>(queue->tasks_.size());
+    } else if (!queue->tasks_.empty()) {
+      for (auto& task : queue->tasks_) {
+        state->pending_tasks_.push_back(std::move(task));
+      }
+      state->cv_.notify_all();
+    }
+    queue->tasks_.clear();
+  }
+
+  // See WorkerLoop() below
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->finished_workers_.push_back(std::move(*it));
+  state->workers_.erase(it);
+  if (state->please_shutdown_) {
+    // Notify the function waiting in Shutdown().
+    state->cv_shutdown_.notify_one();
+  }
+}
+
 ThreadPool::ThreadPool()
     : sp_state_(std::make_shared<ThreadPool::State>()),
       state_(sp_state_.get()),
@@ -139,8 +323,9 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
     new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->work_stealing_ = state_->work_stealing_;
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -202,6 +387,7 @@ Status ThreadPool::Shutdown(bool wait) {
   if (!state_->quick_shutdown_) {
     DCHECK_EQ(state_->pending_tasks_.size(), 0);
   } else {
+    state_->num_queued_tasks_ -= static_cast<int64_t>(state_->pending_tasks_.size());
     state_->pending_tasks_.clear();
   }
   CollectFinishedWorkersUnlocked();
@@ -222,11 +408,28 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    if (state_->work_stealing_) {
+      *it = std::thread([state, it] { WorkStealingWorkerLoop(state, it); });
+    } else {
+      *it = std::thread([state, it] { WorkerLoop(state, it); });
+    }
   }
 }
 
 Status ThreadPool::SpawnReal(std::function<void()> task) {
+  if (current_worker_state == state_) {
+    // Spawning from one of our work-stealing workers: push to its own queue
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    {
+      std::lock_guard<std::mutex> lock(current_worker_queue->mutex_);
+      current_worker_queue->tasks_.push_back(std::move(task));
+    }
+    ++state_->num_queued_tasks_;
+    state_->NotifyIfSleeping();
+    return Status::OK();
+  }
   {
     ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
@@ -235,6 +438,7 @@ Status ThreadPool::SpawnReal(std::function<void()> task) {
     }
     CollectFinishedWorkersUnlocked();
     state_->pending_tasks_.push_back(std::move(task));
+    ++state_->num_queued_tasks_;
   }
   state_->cv_.notify_one();
   return Status::OK();
@@ -246,6 +450,13 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeWorkStealing(int threads) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->work_stealing_ = true;
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -286,9 +497,21 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
+// Default number of I/O threads, unless overridden with ARROW_IO_THREADS.
+// I/O-bound tasks mostly wait, so this is independent of the number of cores.
+static constexpr int kDefaultIOThreads = 8;
+
+int ThreadPool::DefaultIOCapacity() {
+  int capacity = ParseOMPEnvVar("ARROW_IO_THREADS");
+  if (capacity == 0) {
+    capacity = kDefaultIOThreads;
+  }
+  return capacity;
+}
+
 // Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
-  std::shared_ptr<ThreadPool> pool = *ThreadPool::Make(ThreadPool::DefaultCapacity());
+std::shared_ptr<ThreadPool> ThreadPool::MakeEternal(int threads) {
+  std::shared_ptr<ThreadPool> pool = *ThreadPool::Make(threads);
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -300,7 +523,14 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
 }
 
 ThreadPool* GetCpuThreadPool() {
-  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> singleton =
+      ThreadPool::MakeEternal(ThreadPool::DefaultCapacity());
+  return singleton.get();
+}
+
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton =
+      ThreadPool::MakeEternal(ThreadPool::DefaultIOCapacity());
   return singleton.get();
 }
 
@@ -312,4 +542,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
@@ -54,6 +54,23 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.  This is an ideal number,
+/// not necessarily the exact number of threads at a given point in time.
+///
+/// You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -78,6 +95,12 @@ class ARROW_EXPORT ThreadPool {
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Construct a work-stealing thread pool with the given number of worker threads.
+  // Tasks spawned from a worker go to that worker's own queue and are run in
+  // LIFO order; idle workers steal from other workers' queues.  This reduces
+  // contention when running many fine-grained, recursively spawned tasks.
+  static Result<std::shared_ptr<ThreadPool>> MakeWorkStealing(int threads);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -95,6 +118,10 @@ class ARROW_EXPORT ThreadPool {
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Default capacity of the thread pool for I/O-bound tasks.
+  // This is exposed as a static method to help with testing.
+  static int DefaultIOCapacity();
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -132,6 +159,7 @@ class ARROW_EXPORT ThreadPool {
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   ThreadPool();
 
@@ -147,7 +175,8 @@ class ARROW_EXPORT ThreadPool {
   // Reinitialize the thread pool if the pid changed
   void ProtectAgainstFork();
 
-  static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  // Make a thread pool meant to live until the end of the process
+  static std::shared_ptr<ThreadPool> MakeEternal(int threads);
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -160,6 +189,11 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for I/O-bound tasks.
+// Blocking reads and writes should be run here rather than on the CPU
+// thread pool, so that they don't starve CPU-bound tasks.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -18,13 +18,16 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -73,10 +76,16 @@ struct Task {
   Workload workload_;
 };
 
+static std::shared_ptr<ThreadPool> MakePool(int nthreads, bool work_stealing) {
+  return work_stealing ? *ThreadPool::MakeWorkStealing(nthreads)
+                       : *ThreadPool::Make(nthreads);
+}
+
 // Benchmark ThreadPool::Spawn
 static void ThreadPoolSpawn(benchmark::State& state) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const bool work_stealing = state.range(2) != 0;
 
   Workload workload(workload_size);
 
@@ -85,8 +94,7 @@ static void ThreadPoolSpawn(benchmark::State& state) {
 
   for (auto _ : state) {
     state.PauseTiming();
-    std::shared_ptr<ThreadPool> pool;
-    pool = *ThreadPool::Make(nthreads);
+    std::shared_ptr<ThreadPool> pool = MakePool(nthreads, work_stealing);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -103,6 +111,50 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn with tasks spawned from within the pool,
+// as in recursive divide-and-conquer algorithms
+static void ThreadPoolNestedSpawn(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+  const bool work_stealing = state.range(2) != 0;
+
+  Workload workload(workload_size);
+
+  // Each top-level task spawns `kFanout` leaf tasks
+  constexpr int32_t kFanout = 64;
+  const int32_t nspawns = 200000000 / workload_size / kFanout + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool = MakePool(nthreads, work_stealing);
+    ThreadPool* raw_pool = pool.get();
+    state.ResumeTiming();
+
+    // Leaf tasks can't be spawned anymore once Shutdown() is called, so wait
+    // for all top-level tasks to have run first
+    std::atomic<int32_t> nremaining(nspawns);
+    std::promise<void> all_spawned;
+    for (int32_t i = 0; i < nspawns; ++i) {
+      ABORT_NOT_OK(raw_pool->Spawn([&]() {
+        for (int32_t j = 0; j < kFanout; ++j) {
+          ABORT_NOT_OK(raw_pool->Spawn(std::ref(workload)));
+        }
+        if (--nremaining == 0) {
+          all_spawned.set_value();
+        }
+      }));
+    }
+    all_spawned.get_future().wait();
+
+    // Wait for all tasks to finish
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns * kFanout);
+}
+
 // Benchmark serial TaskGroup
 static void SerialTaskGroup(benchmark::State& state) {
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -126,9 +178,9 @@ static void SerialTaskGroup(benchmark::State& state) {
 static void ThreadedTaskGroup(benchmark::State& state) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const bool work_stealing = state.range(2) != 0;
 
-  std::shared_ptr<ThreadPool> pool;
-  pool = *ThreadPool::Make(nthreads);
+  std::shared_ptr<ThreadPool> pool = MakePool(nthreads, work_stealing);
 
   Task task(workload_size);
 
@@ -157,13 +209,26 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
   b->UseRealTime();
 }
 
+// Thread counts from 1 up to the number of hardware threads
+static std::vector<int> ThreadCounts() {
+  const int max_threads =
+      std::max(8, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> counts;
+  for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    counts.push_back(nthreads);
+  }
+  return counts;
+}
+
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
-    for (const int nthreads : {1, 2, 4, 8}) {
-      b->Args({nthreads, w});
+    for (const int nthreads : ThreadCounts()) {
+      for (const int work_stealing : {0, 1}) {
+        b->Args({nthreads, w, work_stealing});
+      }
     }
   }
-  b->ArgNames({"threads", "task_cost"});
+  b->ArgNames({"threads", "task_cost", "work_stealing"});
   b->UseRealTime();
 }
 
@@ -189,6 +254,7 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolNestedSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -295,6 +296,108 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+// Work-stealing mode
+
+class TestWorkStealingThreadPool : public TestThreadPool {
+ public:
+  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
+    return *ThreadPool::MakeWorkStealing(threads);
+  }
+
+  // Recursively spawn `fanout` tasks per level from within the pool
+  static void SpawnNested(ThreadPool* pool, int depth, int fanout,
+                          std::atomic<int>* count) {
+    ++*count;
+    if (depth > 0) {
+      for (int i = 0; i < fanout; ++i) {
+        ASSERT_OK(pool->Spawn([=] { SpawnNested(pool, depth - 1, fanout, count); }));
+      }
+    }
+  }
+};
+
+TEST_F(TestWorkStealingThreadPool, Spawn) {
+  auto pool = this->MakeThreadPool(3);
+  SpawnAdds(pool.get(), 7, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnThreaded) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnSlow) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAdds(pool.get(), 1000, [](int x, int y, int* out) {
+    return task_slow_add(0.002 /* seconds */, x, y, out);
+  });
+}
+
+TEST_F(TestWorkStealingThreadPool, NestedSpawn) {
+  // 1 + 4 + 16 + ... + 4**6 tasks
+  const int expected = 5461;
+  for (int threads : {1, 2, 8}) {
+    auto pool = this->MakeThreadPool(threads);
+    std::atomic<int> count(0);
+    ASSERT_OK(pool->Spawn([&] { SpawnNested(pool.get(), 6, 4, &count); }));
+    busy_wait(5.0, [&] { return count.load() == expected; });
+    ASSERT_OK(pool->Shutdown());
+    ASSERT_EQ(count.load(), expected);
+  }
+}
+
+TEST_F(TestWorkStealingThreadPool, NestedSubmit) {
+  // A task waiting on a task it submitted: the child lands in the parent's
+  // queue and must be stolen by another worker.
+  auto pool = this->MakeThreadPool(2);
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&]() -> int {
+    auto child = pool->Submit(add<int>, 4, 5);
+    if (!child.ok()) {
+      return -1;
+    }
+    return std::move(child).ValueOrDie().get();
+  }));
+  ASSERT_EQ(fut.get(), 9);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    auto pool = this->MakeThreadPool(3);
+    add_tester.SpawnTasks(pool.get(), [](int x, int y, int* out) {
+      return task_slow_add(0.02 /* seconds */, x, y, out);
+    });
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST_F(TestWorkStealingThreadPool, SetCapacity) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_OK(pool->SetCapacity(5));
+  ASSERT_EQ(pool->GetCapacity(), 5);
+
+  // Downsize while nested tasks are pending in worker queues
+  std::atomic<int> count(0);
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(pool->Spawn([&] {
+        sleep_for(0.01 /* seconds */);
+        ++count;
+      }));
+    }
+  }));
+  ASSERT_OK(pool->SetCapacity(2));
+  ASSERT_EQ(pool->GetCapacity(), 2);
+  busy_wait(0.5, [&] { return count.load() == 10; });
+
+  // Ensure nothing got stuck or lost
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count.load(), 10);
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -400,5 +503,28 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, IOCapacity) {
+  // Sanity check
+  auto pool = GetIOThreadPool();
+  ASSERT_NE(pool, GetCpuThreadPool());
+  int capacity = pool->GetCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 3));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 3);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  // Exercise default capacity heuristic
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "17"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 17);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "zzz"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+}
+
 }  // namespace internal
 }  // namespace arrow
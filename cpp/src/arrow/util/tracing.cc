@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace arrow {
+namespace util {
+
+namespace {
+
+struct TraceEvent {
+  const char* category;
+  const char* name;
+  int64_t start_ns;
+  int64_t end_ns;
+  std::string detail;
+};
+
+// The events of a thread. The mutex is only contended while a trace is
+// started or stopped.
+struct ThreadEvents {
+  explicit ThreadEvents(int64_t thread_id) : thread_id(thread_id) {}
+
+  std::mutex mutex;
+  const int64_t thread_id;
+  std::vector<TraceEvent> events;
+};
+
+class Tracer {
+ public:
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  Status Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (enabled()) {
+      return Status::Invalid("Tracing is already started");
+    }
+    for (const auto& thread_events : threads_) {
+      std::lock_guard<std::mutex> thread_lock(thread_events->mutex);
+      thread_events->events.clear();
+    }
+    start_ns_ = TraceSpanClock();
+    enabled_.store(true);
+    return Status::OK();
+  }
+
+  Result<std::string> Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled()) {
+      return Status::Invalid("Tracing isn't started");
+    }
+    enabled_.store(false);
+
+    std::stringstream ss;
+    ss << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& thread_events : threads_) {
+      std::lock_guard<std::mutex> thread_lock(thread_events->mutex);
+      for (const auto& event : thread_events->events) {
+        if (event.start_ns < start_ns_) {
+          continue;
+        }
+        ss << (first ? "\n" : ",\n");
+        first = false;
+        WriteEvent(thread_events->thread_id, event, &ss);
+      }
+      thread_events->events.clear();
+    }
+    ss << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    return ss.str();
+  }
+
+  void Add(TraceEvent event) {
+    ThreadEvents* thread_events = CurrentThreadEvents();
+    std::lock_guard<std::mutex> lock(thread_events->mutex);
+    if (static_cast<int64_t>(thread_events->events.size()) < kMaxTraceEventsPerThread) {
+      thread_events->events.push_back(std::move(event));
+    }
+  }
+
+  static int64_t TraceSpanClock() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+ private:
+  ThreadEvents* CurrentThreadEvents() {
+    // Owned by the tracer, so that the events of finished threads are kept
+    static thread_local ThreadEvents* current = nullptr;
+    if (current == nullptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      threads_.emplace_back(new ThreadEvents(static_cast<int64_t>(threads_.size())));
+      current = threads_.back().get();
+    }
+    return current;
+  }
+
+  void WriteEvent(int64_t thread_id, const TraceEvent& event, std::ostream* os) const {
+    // Complete events, with times in microseconds
+    char times[64];
+    snprintf(times, sizeof(times), "\"ts\":%.3f,\"dur\":%.3f",
+             static_cast<double>(event.start_ns - start_ns_) / 1000,
+             static_cast<double>(event.end_ns - event.start_ns) / 1000);
+    *os << "{\"name\":";
+    WriteString(event.name, os);
+    *os << ",\"cat\":";
+    WriteString(event.category, os);
+    *os << ",\"ph\":\"X\"," << times << ",\"pid\":1,\"tid\":" << thread_id;
+    if (!event.detail.empty()) {
+      *os << ",\"args\":{\"detail\":";
+      WriteString(event.detail, os);
+      *os << "}";
+    }
+    *os << "}";
+  }
+
+  static void WriteString(const std::string& s, std::ostream* os) {
+    *os << '"';
+    for (const char c : s) {
+      if (c == '"' || c == '\\') {
+        *os << '\\' << c;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        char escaped[8];
+        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        *os << escaped;
+      } else {
+        *os << c;
+      }
+    }
+    *os << '"';
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::mutex mutex_;
+  int64_t start_ns_ = 0;
+  std::vector<std::unique_ptr<ThreadEvents>> threads_;
+};
+
+Tracer* GetTracer() {
+  // Never destroyed, as spans may end on threads outliving static destructors
+  static Tracer* tracer = new Tracer;
+  return tracer;
+}
+
+}  // namespace
+
+Status StartTracing() { return GetTracer()->Start(); }
+
+Result<std::string> StopTracing() { return GetTracer()->Stop(); }
+
+bool IsTracing() { return GetTracer()->enabled(); }
+
+int64_t TraceSpan::Now() { return Tracer::TraceSpanClock(); }
+
+void TraceSpan::End() {
+  GetTracer()->Add({category_, name_, start_ns_, Now(), std::move(detail_)});
+}
+
+}  // namespace util
+}  // namespace arrow
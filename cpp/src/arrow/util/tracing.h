@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Lightweight tracing of spans of work, exported in the Chrome trace event
+// format (viewable in chrome://tracing or https://ui.perfetto.dev).
+//
+// The library records spans through the ARROW_TRACE_SPAN macros, which only
+// expand to code when Arrow is built with ARROW_WITH_TRACING=ON. Even then,
+// spans are only recorded between StartTracing() and StopTracing(); at other
+// times a span costs a relaxed atomic load.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \brief Start recording spans, discarding those of any previous trace
+///
+/// Returns Invalid if tracing is already started.
+ARROW_EXPORT Status StartTracing();
+
+/// \brief Stop recording spans and return those recorded since
+/// StartTracing() as a Chrome trace event JSON document
+///
+/// Spans are only returned once they have ended. At most
+/// kMaxTraceEventsPerThread spans are kept per thread, later ones are
+/// dropped. Returns Invalid if tracing isn't started.
+ARROW_EXPORT Result<std::string> StopTracing();
+
+/// \brief Whether spans are currently being recorded
+ARROW_EXPORT bool IsTracing();
+
+constexpr int64_t kMaxTraceEventsPerThread = 1 << 20;
+
+/// \brief A span of work on the current thread, from its construction to
+/// its destruction
+///
+/// category and name must be string literals, or otherwise outlive the
+/// trace. Spans which begin while tracing is stopped aren't recorded.
+class ARROW_EXPORT TraceSpan {
+ public:
+  TraceSpan(const char* category, const char* name)
+      : category_(category), name_(name), start_ns_(IsTracing() ? Now() : -1) {}
+
+  ~TraceSpan() {
+    if (ARROW_PREDICT_FALSE(active())) {
+      End();
+    }
+  }
+
+  /// Whether the span is being recorded, so that details are worth computing
+  bool active() const { return start_ns_ >= 0; }
+
+  /// Attach a free-form detail (e.g. a path or a size) to the span
+  void set_detail(std::string detail) { detail_ = std::move(detail); }
+
+ private:
+  static int64_t Now();
+  void End();
+
+  const char* category_;
+  const char* name_;
+  int64_t start_ns_;
+  std::string detail_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TraceSpan);
+};
+
+}  // namespace util
+}  // namespace arrow
+
+#define ARROW_TRACE_SPAN_NAME(line) ARROW_CONCAT(arrow_trace_span_, line)
+#define ARROW_TRACE_SPAN_NAME_EXPANDED(line) ARROW_TRACE_SPAN_NAME(line)
+
+#ifdef ARROW_WITH_TRACING
+
+/// Trace the rest of the enclosing scope as a span
+#define ARROW_TRACE_SPAN(category, name)                                            \
+  ::arrow::util::TraceSpan ARROW_TRACE_SPAN_NAME_EXPANDED(__LINE__)(category, name)
+
+/// Trace the rest of the enclosing scope as a span with a detail, which is
+/// only evaluated when the span is recorded
+#define ARROW_TRACE_SPAN_DETAIL(category, name, detail)                              \
+  ::arrow::util::TraceSpan ARROW_TRACE_SPAN_NAME_EXPANDED(__LINE__)(category, name); \
+  if (ARROW_TRACE_SPAN_NAME_EXPANDED(__LINE__).active())                             \
+  ARROW_TRACE_SPAN_NAME_EXPANDED(__LINE__).set_detail(detail)
+
+#else
+
+#define ARROW_TRACE_SPAN(category, name) static_cast<void>(0)
+#define ARROW_TRACE_SPAN_DETAIL(category, name, detail) static_cast<void>(0)
+
+#endif
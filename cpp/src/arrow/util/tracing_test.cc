@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace util {
+
+TEST(Tracing, StartStop) {
+  ASSERT_FALSE(IsTracing());
+  ASSERT_RAISES(Invalid, StopTracing());
+
+  ASSERT_OK(StartTracing());
+  ASSERT_TRUE(IsTracing());
+  ASSERT_RAISES(Invalid, StartTracing());
+  ASSERT_OK_AND_ASSIGN(auto trace, StopTracing());
+  ASSERT_FALSE(IsTracing());
+  ASSERT_EQ(trace, "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n");
+}
+
+TEST(Tracing, Spans) {
+  {
+    TraceSpan span("test", "before");
+    ASSERT_FALSE(span.active());
+  }
+
+  ASSERT_OK(StartTracing());
+  {
+    TraceSpan outer("test", "outer");
+    ASSERT_TRUE(outer.active());
+    outer.set_detail("a \"quoted\"\npath");
+    std::thread thread([] { TraceSpan span("test", "other thread"); });
+    thread.join();
+  }
+  TraceSpan unfinished("test", "unfinished");
+  ASSERT_OK_AND_ASSIGN(auto trace, StopTracing());
+
+  ASSERT_EQ(std::string::npos, trace.find("\"before\""));
+  ASSERT_EQ(std::string::npos, trace.find("\"unfinished\""));
+  ASSERT_NE(std::string::npos,
+            trace.find("{\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\","));
+  ASSERT_NE(std::string::npos,
+            trace.find("\"args\":{\"detail\":\"a \\\"quoted\\\"\\u000apath\"}"));
+  ASSERT_NE(std::string::npos, trace.find("{\"name\":\"other thread\""));
+
+  // The spans of a trace aren't returned by the next one
+  ASSERT_OK(StartTracing());
+  ASSERT_OK_AND_ASSIGN(trace, StopTracing());
+  ASSERT_EQ(std::string::npos, trace.find("\"name\""));
+}
+
+TEST(Tracing, Macros) {
+  // Expand to nothing unless built with ARROW_WITH_TRACING
+  ASSERT_OK(StartTracing());
+  {
+    ARROW_TRACE_SPAN("test", "macro");
+    ARROW_TRACE_SPAN_DETAIL("test", "macro with detail", std::to_string(42));
+  }
+  ASSERT_OK_AND_ASSIGN(auto trace, StopTracing());
+#ifdef ARROW_WITH_TRACING
+  ASSERT_NE(std::string::npos, trace.find("\"macro\""));
+  ASSERT_NE(std::string::npos, trace.find("\"args\":{\"detail\":\"42\"}"));
+#else
+  ASSERT_EQ(std::string::npos, trace.find("\"macro\""));
+#endif
+}
+
+}  // namespace util
+}  // namespace arrow
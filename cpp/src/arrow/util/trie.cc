@@ -148,6 +148,10 @@ Status TrieBuilder::SplitNode(fast_index_type node_index, fast_index_type split_
 }
 
 Status TrieBuilder::Append(util::string_view s, bool allow_duplicate) {
+  if (s.length() > 0) {
+    trie_.first_byte_lengths_[static_cast<uint8_t>(s[0])] |= Trie::LengthBit(s.length());
+  }
+
   // Find or create node for string
   fast_index_type node_index = 0;
   fast_index_type pos = 0;
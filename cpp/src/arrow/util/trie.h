@@ -18,6 +18,8 @@
 #ifndef ARROW_UTIL_TRIE_H
 #define ARROW_UTIL_TRIE_H
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
@@ -120,7 +122,7 @@ class ARROW_EXPORT Trie {
   using fast_index_type = int_fast16_t;
 
  public:
-  Trie() : size_(0) {}
+  Trie() : size_(0), first_byte_lengths_() {}
   Trie(Trie&&) = default;
   Trie& operator=(Trie&&) = default;
 
@@ -129,6 +131,12 @@ class ARROW_EXPORT Trie {
     fast_index_type pos = 0;
     fast_index_type remaining = static_cast<fast_index_type>(s.length());
 
+    if (remaining > 0 &&
+        (first_byte_lengths_[static_cast<uint8_t>(s[0])] & LengthBit(s.length())) == 0) {
+      // No entry starts with this byte and has this length
+      return -1;
+    }
+
     while (remaining > 0) {
       auto substring_length = node->substring_length();
       if (substring_length > 0) {
@@ -202,6 +210,10 @@ class ARROW_EXPORT Trie {
 
   void Dump(const Node* node, const std::string& indent) const;
 
+  static uint64_t LengthBit(size_t length) {
+    return uint64_t(1) << std::min<size_t>(length, 63);
+  }
+
   // Node table: entry 0 is the root node
   std::vector<Node> nodes_;
 
@@ -211,6 +223,12 @@ class ARROW_EXPORT Trie {
   // Number of entries
   index_type size_;
 
+  // For each first byte, bitmap of the lengths of the non-empty entries
+  // starting with it (lengths >= 63 share the top bit).  Checked before
+  // walking the trie so that most non-matching strings, e.g. non-null CSV
+  // cells, are rejected with a single table lookup.
+  std::array<uint64_t, 256> first_byte_lengths_;
+
   friend class TrieBuilder;
 };
 
@@ -81,8 +81,20 @@ static void TrieLookupNotFound(benchmark::State& state) {  // NOLINT non-const r
   BenchmarkTrieLookups(state, {"None", "1.0", "", "abc"});
 }
 
+static void TrieLookupNumbers(benchmark::State& state) {  // NOLINT non-const reference
+  // Typical non-null cells of a numeric CSV column
+  BenchmarkTrieLookups(state, {"12", "-1.5", "1", "2020", "0.25", "-7", "1e10", "NaN"});
+}
+
+static void TrieLookupStrings(benchmark::State& state) {  // NOLINT non-const reference
+  // Typical non-null cells of a string CSV column
+  BenchmarkTrieLookups(state, {"Nancy", "nanometer", "New York", "-", "#1", "NULL"});
+}
+
 BENCHMARK(TrieLookupFound);
 BENCHMARK(TrieLookupNotFound);
+BENCHMARK(TrieLookupNumbers);
+BENCHMARK(TrieLookupStrings);
 
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 
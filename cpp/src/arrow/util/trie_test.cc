@@ -195,6 +195,21 @@ TEST(Trie, LongStrings) {
   TestTrieContents({"abcdefghijklmnopqr", "abcdefghijklmnoprq", "abcde"});
 }
 
+TEST(Trie, VeryLongStrings) {
+  // Lengths of 63 bytes and more aren't told apart before walking the trie
+  const std::string a(63, 'a'), b(64, 'a'), c(100, 'a'), d(100, 'b');
+  TestTrieContents({a, b, c, d});
+  TestTrieContents({c, "a", d});
+
+  TrieBuilder builder;
+  ASSERT_OK(builder.Append(c));
+  const Trie trie = builder.Finish();
+  ASSERT_EQ(0, trie.Find(c));
+  ASSERT_EQ(-1, trie.Find(a));
+  ASSERT_EQ(-1, trie.Find(b));
+  ASSERT_EQ(-1, trie.Find(std::string(99, 'a')));
+}
+
 TEST(Trie, NullChars) {
   const std::string empty;
   const std::string nul(1, '\x00');
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <mutex>
 #include <stdexcept>
@@ -23,9 +24,15 @@
 
 #include "arrow/result.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/neon_util.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/utf8.h"
 #include "arrow/vendored/utf8cpp/checked.h"
 
+#if defined(ARROW_HAVE_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace arrow {
 namespace util {
 namespace internal {
@@ -75,6 +82,251 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+#if defined(ARROW_HAVE_AVX2) || defined(ARROW_HAVE_NEON)
+
+namespace {
+
+// The lookup algorithm of simdjson: the errors of a byte are found from the
+// nibbles of itself and of the previous byte, through three table lookups
+// whose results are ANDed, each bit of the result being an error.  Errors
+// spanning more than two bytes are found by checking that the bytes following
+// three and four byte leads are continuations.
+
+// 11______ 0_______, 11______ 11______
+constexpr uint8_t kTooShort = 1 << 0;
+// 0_______ 10______
+constexpr uint8_t kTooLong = 1 << 1;
+// 11100000 100_____
+constexpr uint8_t kOverlong3 = 1 << 2;
+// 11110100 1001____, 11110100 101_____, 11110101 1001____, 11110101 101_____,
+// 1111011_ 1001____, 1111011_ 101_____, 11111___ 1001____, 11111___ 101_____
+constexpr uint8_t kTooLarge = 1 << 3;
+// 11101101 101_____
+constexpr uint8_t kSurrogate = 1 << 4;
+// 1100000_ 10______
+constexpr uint8_t kOverlong2 = 1 << 5;
+// 11110101 1000____, 1111011_ 1000____, 11111___ 1000____
+constexpr uint8_t kTooLarge1000 = 1 << 6;
+// 11110000 1000____
+constexpr uint8_t kOverlong4 = 1 << 6;
+// 10______ 10______
+constexpr uint8_t kTwoConts = 1 << 7;
+// The errors found from the high nibble of the first byte alone
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// Indexed by the high nibble of the first byte
+alignas(16) const uint8_t kByte1High[16] = {
+    // 0_______ ________ <ASCII in byte 1>
+    kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+    // 10______ ________ <continuation in byte 1>
+    kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+    // 1100____ ________ <two byte lead in byte 1>
+    kTooShort | kOverlong2,
+    // 1101____ ________ <two byte lead in byte 1>
+    kTooShort,
+    // 1110____ ________ <three byte lead in byte 1>
+    kTooShort | kOverlong3 | kSurrogate,
+    // 1111____ ________ <four+ byte lead in byte 1>
+    kTooShort | kTooLarge | kTooLarge1000 | kOverlong4};
+
+// Indexed by the low nibble of the first byte
+alignas(16) const uint8_t kByte1Low[16] = {
+    // ____0000 ________
+    kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+    // ____0001 ________
+    kCarry | kOverlong2,
+    // ____001_ ________
+    kCarry, kCarry,
+    // ____0100 ________
+    kCarry | kTooLarge,
+    // ____0101 ________
+    kCarry | kTooLarge | kTooLarge1000,
+    // ____011_ ________
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    // ____1___ ________
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    // ____1101 ________
+    kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000};
+
+// Indexed by the high nibble of the second byte
+alignas(16) const uint8_t kByte2High[16] = {
+    // ________ 0_______ <ASCII in byte 2>
+    kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+    kTooShort,
+    // ________ 1000____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+    // ________ 1001____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+    // ________ 101_____
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    // ________ 11______
+    kTooShort, kTooShort, kTooShort, kTooShort};
+
+// A vector ending with a byte above these maxima ends with an incomplete
+// character
+alignas(32) const uint8_t kIncompleteMax[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1};
+
+#if defined(ARROW_HAVE_AVX2)
+
+struct SimdOps {
+  using Vec = __m256i;
+  static constexpr int kSize = 32;
+
+  static Vec Load(const uint8_t* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+  static Vec Table(const uint8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+  }
+  static Vec Set(uint8_t value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+  static Vec Zero() { return _mm256_setzero_si256(); }
+  static Vec Lookup(Vec table, Vec nibbles) {
+    return _mm256_shuffle_epi8(table, nibbles);
+  }
+  static Vec HighNibbles(Vec v) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), Set(0x0f));
+  }
+  static Vec LowNibbles(Vec v) { return _mm256_and_si256(v, Set(0x0f)); }
+  static Vec And(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+  static Vec Xor(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+  static Vec SubSaturated(Vec a, Vec b) { return _mm256_subs_epu8(a, b); }
+  // The bytes of v shifted by N, the last N bytes of prev shifted in
+  template <int N>
+  static Vec Prev(Vec v, Vec prev) {
+    return _mm256_alignr_epi8(v, _mm256_permute2x128_si256(prev, v, 0x21), 16 - N);
+  }
+  static bool IsAscii(Vec v) { return _mm256_movemask_epi8(v) == 0; }
+  static bool IsZero(Vec v) { return _mm256_testz_si256(v, v) != 0; }
+};
+
+#elif defined(ARROW_HAVE_NEON)
+
+struct SimdOps {
+  using Vec = uint8x16_t;
+  static constexpr int kSize = 16;
+
+  static Vec Load(const uint8_t* data) { return vld1q_u8(data); }
+  static Vec Table(const uint8_t* table) { return vld1q_u8(table); }
+  static Vec Set(uint8_t value) { return vdupq_n_u8(value); }
+  static Vec Zero() { return vdupq_n_u8(0); }
+  static Vec Lookup(Vec table, Vec nibbles) { return vqtbl1q_u8(table, nibbles); }
+  static Vec HighNibbles(Vec v) { return vshrq_n_u8(v, 4); }
+  static Vec LowNibbles(Vec v) { return vandq_u8(v, Set(0x0f)); }
+  static Vec And(Vec a, Vec b) { return vandq_u8(a, b); }
+  static Vec Or(Vec a, Vec b) { return vorrq_u8(a, b); }
+  static Vec Xor(Vec a, Vec b) { return veorq_u8(a, b); }
+  static Vec SubSaturated(Vec a, Vec b) { return vqsubq_u8(a, b); }
+  // The bytes of v shifted by N, the last N bytes of prev shifted in
+  template <int N>
+  static Vec Prev(Vec v, Vec prev) {
+    return vextq_u8(prev, v, 16 - N);
+  }
+  static bool IsAscii(Vec v) { return vmaxvq_u8(v) < 0x80; }
+  static bool IsZero(Vec v) { return vmaxvq_u8(v) == 0; }
+};
+
+#endif
+
+class UTF8Validator {
+ public:
+  using Vec = SimdOps::Vec;
+  static constexpr int64_t kBlockSize = 64;
+  static constexpr int kVectorsPerBlock = kBlockSize / SimdOps::kSize;
+
+  UTF8Validator()
+      : byte_1_high_(SimdOps::Table(kByte1High)),
+        byte_1_low_(SimdOps::Table(kByte1Low)),
+        byte_2_high_(SimdOps::Table(kByte2High)),
+        incomplete_max_(SimdOps::Load(kIncompleteMax + 32 - SimdOps::kSize)),
+        error_(SimdOps::Zero()),
+        prev_input_(SimdOps::Zero()),
+        prev_incomplete_(SimdOps::Zero()) {}
+
+  void ValidateBlock(const uint8_t* data) {
+    Vec input[kVectorsPerBlock];
+    Vec any = SimdOps::Zero();
+    for (int i = 0; i < kVectorsPerBlock; ++i) {
+      input[i] = SimdOps::Load(data + i * SimdOps::kSize);
+      any = SimdOps::Or(any, input[i]);
+    }
+    if (ARROW_PREDICT_TRUE(SimdOps::IsAscii(any))) {
+      // ASCII can't follow an incomplete character
+      error_ = SimdOps::Or(error_, prev_incomplete_);
+    } else {
+      for (int i = 0; i < kVectorsPerBlock; ++i) {
+        CheckVector(input[i]);
+        prev_input_ = input[i];
+      }
+      prev_incomplete_ = SimdOps::SubSaturated(input[kVectorsPerBlock - 1],
+                                               incomplete_max_);
+    }
+    prev_input_ = input[kVectorsPerBlock - 1];
+  }
+
+  bool ok() const { return SimdOps::IsZero(SimdOps::Or(error_, prev_incomplete_)); }
+
+ private:
+  void CheckVector(Vec input) {
+    const Vec prev1 = SimdOps::Prev<1>(input, prev_input_);
+    const Vec special_cases = SimdOps::And(
+        SimdOps::And(SimdOps::Lookup(byte_1_high_, SimdOps::HighNibbles(prev1)),
+                     SimdOps::Lookup(byte_1_low_, SimdOps::LowNibbles(prev1))),
+        SimdOps::Lookup(byte_2_high_, SimdOps::HighNibbles(input)));
+    // The high bit is set for the second and third bytes after a three or
+    // four byte lead, which must be continuations
+    const Vec prev2 = SimdOps::Prev<2>(input, prev_input_);
+    const Vec prev3 = SimdOps::Prev<3>(input, prev_input_);
+    const Vec must_be_continuation =
+        SimdOps::And(SimdOps::Or(SimdOps::SubSaturated(prev2, SimdOps::Set(0xe0 - 0x80)),
+                                 SimdOps::SubSaturated(prev3, SimdOps::Set(0xf0 - 0x80))),
+                     SimdOps::Set(0x80));
+    // Two continuations in a row are only valid there
+    error_ = SimdOps::Or(error_, SimdOps::Xor(must_be_continuation, special_cases));
+  }
+
+  const Vec byte_1_high_;
+  const Vec byte_1_low_;
+  const Vec byte_2_high_;
+  const Vec incomplete_max_;
+  Vec error_;
+  Vec prev_input_;
+  Vec prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Vectorized(const uint8_t* data, int64_t size) {
+  UTF8Validator validator;
+  while (size >= UTF8Validator::kBlockSize) {
+    validator.ValidateBlock(data);
+    data += UTF8Validator::kBlockSize;
+    size -= UTF8Validator::kBlockSize;
+  }
+  // Pad the tail with ASCII, which also checks that the last character is
+  // complete
+  uint8_t tail[UTF8Validator::kBlockSize] = {};
+  memcpy(tail, data, static_cast<size_t>(size));
+  validator.ValidateBlock(tail);
+  return validator.ok();
+}
+
+#else
+
+bool ValidateUTF8Vectorized(const uint8_t* data, int64_t size) {
+  return ValidateUTF8Inline(data, size);
+}
+
+#endif
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
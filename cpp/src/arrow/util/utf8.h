@@ -85,15 +85,14 @@ ARROW_EXPORT void CheckUTF8Initialized();
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+namespace internal {
+
+// Validate with the DFA, skipping ASCII 8 bytes at a time
+inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   // For some reason, defining this variable outside the loop helps clang
   uint64_t mask;
 
-#ifndef NDEBUG
-  internal::CheckUTF8Initialized();
-#endif
-
   while (size >= 8) {
     // XXX This is doing an unaligned access.  Contemporary architectures
     // (x86-64, AArch64, PPC64) support it natively and often have good
@@ -112,45 +111,45 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
     // (once in reject state, we always remain in reject state).
     // It is guaranteed that size >= 8 when arriving here, which allows
     // us to avoid size checks.
-    uint16_t state = internal::kUTF8ValidateAccept;
+    uint16_t state = kUTF8ValidateAccept;
     // Byte 0
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 1
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 2
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 3
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 4
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // Byte 5
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // Byte 6
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // Byte 7
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // kUTF8ValidateAccept not reached along 4 transitions has to mean a rejection
-    assert(state == internal::kUTF8ValidateReject);
+    assert(state == kUTF8ValidateReject);
     return false;
   }
 
@@ -158,11 +157,31 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   // Note the state table is designed so that, once in the reject state,
   // we remain in that state until the end.  So we needn't check for
   // rejection at each char (we don't gain much by short-circuiting here).
-  uint16_t state = internal::kUTF8ValidateAccept;
+  uint16_t state = kUTF8ValidateAccept;
   while (size-- > 0) {
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
+  }
+  return ARROW_PREDICT_TRUE(state == kUTF8ValidateAccept);
+}
+
+// Strings of at least this size are validated by ValidateUTF8Vectorized
+static constexpr int64_t kUTF8VectorizedMinSize = 64;
+
+// Validate with AVX2 or NEON instructions, 64 bytes at a time, after
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser, Lemire).
+// Falls back on ValidateUTF8Inline if neither is available.
+ARROW_EXPORT bool ValidateUTF8Vectorized(const uint8_t* data, int64_t size);
+
+}  // namespace internal
+
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+#ifndef NDEBUG
+  internal::CheckUTF8Initialized();
+#endif
+  if (size >= internal::kUTF8VectorizedMinSize) {
+    return internal::ValidateUTF8Vectorized(data, size);
   }
-  return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
+  return internal::ValidateUTF8Inline(data, size);
 }
 
 inline bool ValidateUTF8(const util::string_view& str) {
@@ -172,6 +191,23 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Validate the values of a binary array at once, the i-th value spanning
+// [offsets[i], offsets[i + 1]) of data.  They are validated as a single string
+// whose characters mustn't straddle values, which is faster than validating
+// them one by one.  As the bytes of null slots are validated too, a false result
+// only means that some value is invalid if the null slots are empty.
+template <typename OffsetType>
+bool ValidateUTF8Values(const uint8_t* data, const OffsetType* offsets,
+                        int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    // A non-empty value mustn't start with a continuation byte
+    if (offsets[i] < offsets[i + 1] && (data[offsets[i]] & 0xc0) == 0x80) {
+      return false;
+    }
+  }
+  return ValidateUTF8(data + offsets[0], offsets[length] - offsets[0]);
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
@@ -109,6 +109,62 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+// The values of a string column, validated one by one or all at once
+static void BenchmarkUTF8ValuesValidation(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::string& base, bool at_once) {
+  const int64_t num_values = 10000;
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (int64_t i = 0; i < num_values; ++i) {
+    // Values of 0 to base.size() bytes, cut at character boundaries
+    size_t size = static_cast<size_t>(i * 7) % (base.size() + 1);
+    while (size < base.size() && (base[size] & 0xc0) == 0x80) {
+      ++size;
+    }
+    data += base.substr(0, size);
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  auto values = reinterpret_cast<const uint8_t*>(data.data());
+
+  InitializeUTF8();
+  while (state.KeepRunning()) {
+    bool b = true;
+    if (at_once) {
+      b = ValidateUTF8Values(values, offsets.data(), num_values);
+    } else {
+      for (int64_t i = 0; i < num_values; ++i) {
+        b &= ValidateUTF8(values + offsets[i], offsets[i + 1] - offsets[i]);
+      }
+    }
+    if (!b) {
+      std::cerr << "Unexpected validation result" << std::endl;
+      std::abort();
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void ValidateValuesAlmostAscii(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8ValuesValidation(state, valid_almost_ascii, false);
+}
+
+static void ValidateValuesAtOnceAlmostAscii(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8ValuesValidation(state, valid_almost_ascii, true);
+}
+
+static void ValidateValuesNonAscii(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8ValuesValidation(state, valid_non_ascii, false);
+}
+
+static void ValidateValuesAtOnceNonAscii(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8ValuesValidation(state, valid_non_ascii, true);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
@@ -117,6 +173,10 @@ BENCHMARK(ValidateSmallNonAscii);
 BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
+BENCHMARK(ValidateValuesAlmostAscii);
+BENCHMARK(ValidateValuesAtOnceAlmostAscii);
+BENCHMARK(ValidateValuesNonAscii);
+BENCHMARK(ValidateValuesAtOnceNonAscii);
 
 }  // namespace util
 }  // namespace arrow
@@ -251,6 +251,55 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, LongStrings) {
+  // Long strings are validated 64 bytes at a time, so put errors everywhere
+  // around the block boundaries
+  const std::string ascii(200, 'x');
+  std::string non_ascii;
+  while (non_ascii.size() < 200) {
+    non_ascii += "\xc3\xa9\xe8\x9d\xa5\xf0\x9f\xbf\xbfx";
+  }
+  for (const auto& base : {ascii, non_ascii}) {
+    AssertValidUTF8(base);
+    for (size_t pos = 0; pos < 140; ++pos) {
+      // Insert at a character boundary
+      while ((base[pos] & 0xc0) == 0x80) {
+        ++pos;
+      }
+      for (const auto& s : all_valid_sequences) {
+        AssertValidUTF8(base.substr(0, pos) + s + base.substr(pos));
+        if (s.size() > 1) {
+          AssertInvalidUTF8(base.substr(0, pos) + s.substr(0, s.size() - 1) +
+                            base.substr(pos));
+          // Truncated at the end of the string
+          AssertInvalidUTF8(base.substr(0, pos) + s.substr(0, s.size() - 1));
+        }
+      }
+      for (const auto& s : all_invalid_sequences) {
+        AssertInvalidUTF8(base.substr(0, pos) + s + base.substr(pos));
+      }
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, Values) {
+  auto validate = [](const std::string& data, const std::vector<int32_t>& offsets) {
+    return ValidateUTF8Values(reinterpret_cast<const uint8_t*>(data.data()),
+                              offsets.data(), static_cast<int64_t>(offsets.size()) - 1);
+  };
+  const std::string data = "ab\xc3\xa9\xe8\x9d\xa5x";
+  ASSERT_TRUE(validate(data, {0}));
+  ASSERT_TRUE(validate(data, {0, 2, 2, 4, 7, 8}));
+  ASSERT_TRUE(validate(data, {2, 4, 7}));
+  ASSERT_TRUE(validate(data, {0, 8}));
+  // Characters straddling values
+  ASSERT_FALSE(validate(data, {0, 3, 8}));
+  ASSERT_FALSE(validate(data, {0, 5, 8}));
+  ASSERT_FALSE(validate(data, {0, 2, 6}));
+  ASSERT_FALSE(validate(data, {3, 7}));
+  ASSERT_FALSE(validate("ab\xff", {0, 1, 3}));
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
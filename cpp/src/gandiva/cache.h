@@ -20,6 +20,7 @@
 
 #include <mutex>
 
+#include "gandiva/execution_stats.h"
 #include "gandiva/lru_cache.h"
 
 namespace gandiva {
@@ -32,6 +33,7 @@ class Cache {
     boost::optional<ValueType> result;
     mtx_.lock();
     result = cache_.get(cache_key);
+    ++(result != boost::none ? stats_.hits : stats_.misses);
     mtx_.unlock();
     return result != boost::none ? *result : nullptr;
   }
@@ -42,10 +44,16 @@ class Cache {
     mtx_.unlock();
   }
 
+  CacheStats GetStats() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return stats_;
+  }
+
  private:
   LruCache<KeyType, ValueType> cache_;
   static const int CACHE_SIZE = 250;
   std::mutex mtx_;
+  CacheStats stats_;
 };
 }  // namespace gandiva
 #endif  // GANDIVA_MODULE_CACHE_H
@@ -29,6 +29,12 @@ using EvalFunc = int (*)(uint8_t** buffers, int64_t* offsets, uint8_t** local_bi
                          const uint8_t* selection_buffer, int64_t execution_ctx_ptr,
                          int64_t record_count);
 
+/// Evaluates a condition and the expressions for the matching records, returns the
+/// number of these records.
+using FilterProjectFunc = int64_t (*)(uint8_t** buffers, int64_t* offsets,
+                                      uint8_t** local_bitmaps, uint8_t* selection_buffer,
+                                      int64_t execution_ctx_ptr, int64_t record_count);
+
 /// \brief Tracks the compiled state for one expression.
 class CompiledExpr {
  public:
@@ -63,10 +69,10 @@ class CompiledExpr {
   FieldDescriptorPtr output_;
 
   // IR functions for various modes in the generated code
-  std::array<llvm::Function*, SelectionVector::kNumModes> ir_functions_;
+  std::array<llvm::Function*, SelectionVector::kNumModes> ir_functions_{};
 
   // JIT functions in the generated code (set after the module is optimised and finalized)
-  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_;
+  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_{};
 };
 
 }  // namespace gandiva
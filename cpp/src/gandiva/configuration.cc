@@ -19,21 +19,36 @@
 
 #include "boost/functional/hash.hpp"
 
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
+
 namespace gandiva {
 
 const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration_ =
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  return 0;  // dummy for now, no configuration properties yet
+  static constexpr size_t kHashSeed = 0;
+  size_t result = kHashSeed;
+  boost::hash_combine(result, object_cache_directory_);
+  boost::hash_combine(result, background_compilation_);
+  boost::hash_combine(result, optimization_level_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return true;  // always true, no configuration properties yet
+  return object_cache_directory_ == other.object_cache_directory_ &&
+         background_compilation_ == other.background_compilation_ &&
+         optimization_level_ == other.optimization_level_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
   return !(*this == other);
 }
 
+std::string ConfigurationBuilder::DefaultObjectCacheDirectory() {
+  auto directory = arrow::internal::GetEnvVar("GANDIVA_OBJECT_CACHE_DIR");
+  return directory.ok() ? *directory : "";
+}
+
 }  // namespace gandiva
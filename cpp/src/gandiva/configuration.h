@@ -38,6 +38,21 @@ class GANDIVA_EXPORT Configuration {
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
   bool operator!=(const Configuration& other) const;
+
+  /// Directory of the persistent object code cache, empty if there is none.
+  const std::string& object_cache_directory() const { return object_cache_directory_; }
+
+  /// Whether projectors are compiled in the background, see
+  /// ConfigurationBuilder::set_background_compilation().
+  bool background_compilation() const { return background_compilation_; }
+
+  /// Optimisation level of the generated code, from 0 to 3.
+  int optimization_level() const { return optimization_level_; }
+
+ private:
+  std::string object_cache_directory_;
+  bool background_compilation_ = false;
+  int optimization_level_ = 3;
 };
 
 /// \brief configuration builder for gandiva
@@ -46,11 +61,42 @@ class GANDIVA_EXPORT Configuration {
 /// to override specific values and build a custom instance
 class GANDIVA_EXPORT ConfigurationBuilder {
  public:
+  ConfigurationBuilder() : object_cache_directory_(DefaultObjectCacheDirectory()) {}
+
   std::shared_ptr<Configuration> build() {
     std::shared_ptr<Configuration> configuration(new Configuration());
+    configuration->object_cache_directory_ = object_cache_directory_;
+    configuration->background_compilation_ = background_compilation_;
+    configuration->optimization_level_ = optimization_level_;
     return configuration;
   }
 
+  /// Keep the object code of compiled projectors and filters in the given
+  /// directory, so that other processes building the same expressions can skip
+  /// LLVM compilation. The default is the value of the GANDIVA_OBJECT_CACHE_DIR
+  /// environment variable. An empty directory disables the cache.
+  ConfigurationBuilder& set_object_cache_directory(const std::string& directory) {
+    object_cache_directory_ = directory;
+    return *this;
+  }
+
+  /// Return projectors before their LLVM code is compiled. The compilation
+  /// runs on the CPU thread pool, and until it finishes the projector evaluates
+  /// batches with the Arrow compute kernels. Expressions the kernels can't
+  /// evaluate are still compiled before Make() returns.
+  ConfigurationBuilder& set_background_compilation(bool background_compilation) {
+    background_compilation_ = background_compilation;
+    return *this;
+  }
+
+  /// Optimise the generated code at the given level, from 0 to 3 like the -O
+  /// flags of a compiler. Lower levels compile faster but run slower; the
+  /// default is 3.
+  ConfigurationBuilder& set_optimization_level(int optimization_level) {
+    optimization_level_ = optimization_level;
+    return *this;
+  }
+
   static std::shared_ptr<Configuration> DefaultConfiguration() {
     return default_configuration_;
   }
@@ -58,9 +104,16 @@ class GANDIVA_EXPORT ConfigurationBuilder {
  private:
   static std::shared_ptr<Configuration> InitDefaultConfig() {
     std::shared_ptr<Configuration> configuration(new Configuration());
+    configuration->object_cache_directory_ = DefaultObjectCacheDirectory();
     return configuration;
   }
 
+  static std::string DefaultObjectCacheDirectory();
+
+  std::string object_cache_directory_;
+  bool background_compilation_ = false;
+  int optimization_level_ = 3;
+
   static const std::shared_ptr<Configuration> default_configuration_;
 };
 
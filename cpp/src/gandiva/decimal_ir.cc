@@ -40,6 +40,9 @@ namespace gandiva {
 // and the i128 needs to be dis-assembled for those.
 static const char* kAddFunction = "add_decimal128_decimal128";
 static const char* kSubtractFunction = "subtract_decimal128_decimal128";
+static const char* kMultiplyFunction = "multiply_decimal128_decimal128";
+static const char* kDivideFunction = "divide_decimal128_decimal128";
+static const char* kModFunction = "mod_decimal128_decimal128";
 static const char* kEQFunction = "equal_decimal128_decimal128";
 static const char* kNEFunction = "not_equal_decimal128_decimal128";
 static const char* kLTFunction = "less_than_decimal128_decimal128";
@@ -48,8 +51,14 @@ static const char* kGTFunction = "greater_than_decimal128_decimal128";
 static const char* kGEFunction = "greater_than_or_equal_to_decimal128_decimal128";
 
 static const std::unordered_set<std::string> kDecimalIRBuilderFunctions{
-    kAddFunction, kSubtractFunction, kEQFunction, kNEFunction,
-    kLTFunction,  kLEFunction,       kGTFunction, kGEFunction};
+    kAddFunction, kSubtractFunction, kMultiplyFunction, kDivideFunction,
+    kModFunction, kEQFunction,       kNEFunction,       kLTFunction,
+    kLEFunction,  kGTFunction,       kGEFunction};
+
+// Pre-compiled functions that handle the cases the IR functions don't.
+static const char* kMultiplyInternalFunction = "multiply_internal_decimal128_decimal128";
+static const char* kDivideInternalFunction = "divide_internal_decimal128_decimal128";
+static const char* kModInternalFunction = "mod_internal_decimal128_decimal128";
 
 const char* DecimalIR::kScaleMultipliersName = "gandivaScaleMultipliers";
 
@@ -368,6 +377,217 @@ Status DecimalIR::BuildSubtract() {
   return Status::OK();
 }
 
+// CPP: return value < 0 ? -value : value
+llvm::Value* DecimalIR::Abs(llvm::Value* value) {
+  auto lt_zero = ir_builder()->CreateICmpSLT(value, types()->i128_constant(0));
+  return ir_builder()->CreateSelect(lt_zero, ir_builder()->CreateNeg(value), value);
+}
+
+std::vector<llvm::Value*> DecimalIR::GetArgs(llvm::Function* function) {
+  std::vector<llvm::Value*> args;
+  for (auto& arg : function->args()) {
+    args.push_back(&arg);
+  }
+  return args;
+}
+
+/// The precisions and scales are constants at the call sites, so once this function is
+/// inlined, the choice between the fast path and the pre-compiled function is made
+/// at compile time.
+Status DecimalIR::BuildMultiply() {
+  // Create fn prototype :
+  // int128_t
+  // multiply_decimal128_decimal128(int128_t x_value, int32_t x_precision,
+  //                                int32_t x_scale, int128_t y_value,
+  //                                int32_t y_precision, int32_t y_scale,
+  //                                int32_t out_precision, int32_t out_scale)
+  auto i32 = types()->i32_type();
+  auto i128 = types()->i128_type();
+  auto function = BuildFunction(kMultiplyFunction, i128,
+                                {
+                                    {"x_value", i128},
+                                    {"x_precision", i32},
+                                    {"x_scale", i32},
+                                    {"y_value", i128},
+                                    {"y_precision", i32},
+                                    {"y_scale", i32},
+                                    {"out_precision", i32},
+                                    {"out_scale", i32},
+                                });
+
+  auto arg_iter = function->arg_begin();
+  ValueFull x(&arg_iter[0], &arg_iter[1], &arg_iter[2]);
+  ValueFull y(&arg_iter[3], &arg_iter[4], &arg_iter[5]);
+  ValueFull out(nullptr, &arg_iter[6], &arg_iter[7]);
+
+  auto entry = llvm::BasicBlock::Create(*context(), "entry", function);
+  ir_builder()->SetInsertPoint(entry);
+
+  // CPP :
+  // if (x_precision + y_precision <= 38 && x_scale + y_scale == out_scale) {
+  //   // the product has at most 38 digits, and needs no rounding.
+  //   return x_value * y_value
+  // } else {
+  //   return multiply_internal(x, y, out)
+  // }
+  auto sum_precision = ir_builder()->CreateAdd(x.precision(), y.precision());
+  auto fits = ir_builder()->CreateICmpSLE(
+      sum_precision, types()->i32_constant(DecimalTypeUtil::kMaxPrecision));
+  auto sum_scale = ir_builder()->CreateAdd(x.scale(), y.scale());
+  auto same_scale = ir_builder()->CreateICmpEQ(sum_scale, out.scale());
+  auto fast_path = ir_builder()->CreateAnd(fits, same_scale);
+
+  auto then_lambda = [&] { return ir_builder()->CreateMul(x.value(), y.value()); };
+  auto else_lambda = [&] {
+    return CallDecimalFunction(kMultiplyInternalFunction, i128, GetArgs(function));
+  };
+  auto value = BuildIfElse(fast_path, i128, then_lambda, else_lambda);
+
+  ir_builder()->CreateRet(value);
+  return Status::OK();
+}
+
+Status DecimalIR::BuildDivide() {
+  // Create fn prototype :
+  // int128_t
+  // divide_decimal128_decimal128(int64_t context, int128_t x_value,
+  //                              int32_t x_precision, int32_t x_scale,
+  //                              int128_t y_value, int32_t y_precision,
+  //                              int32_t y_scale, int32_t out_precision,
+  //                              int32_t out_scale)
+  auto i32 = types()->i32_type();
+  auto i128 = types()->i128_type();
+  auto function = BuildFunction(kDivideFunction, i128,
+                                {
+                                    {"context", types()->i64_type()},
+                                    {"x_value", i128},
+                                    {"x_precision", i32},
+                                    {"x_scale", i32},
+                                    {"y_value", i128},
+                                    {"y_precision", i32},
+                                    {"y_scale", i32},
+                                    {"out_precision", i32},
+                                    {"out_scale", i32},
+                                });
+
+  auto arg_iter = function->arg_begin();
+  ValueFull x(&arg_iter[1], &arg_iter[2], &arg_iter[3]);
+  ValueFull y(&arg_iter[4], &arg_iter[5], &arg_iter[6]);
+  ValueFull out(nullptr, &arg_iter[7], &arg_iter[8]);
+
+  auto entry = llvm::BasicBlock::Create(*context(), "entry", function);
+  ir_builder()->SetInsertPoint(entry);
+
+  // CPP :
+  // delta_scale = out_scale + y_scale - x_scale
+  // if (x_precision + delta_scale <= 38 && y_value != 0) {
+  //   // the scaled dividend has at most 38 digits.
+  //   x_scaled = x_value * 10^delta_scale
+  //   result = x_scaled / y_value, remainder = x_scaled % y_value
+  //   round away from zero if |remainder| >= |y_value| - |remainder|
+  // } else {
+  //   return divide_internal(context, x, y, out)
+  // }
+  auto delta_scale =
+      ir_builder()->CreateSub(ir_builder()->CreateAdd(out.scale(), y.scale()), x.scale());
+  auto scaled_precision = ir_builder()->CreateAdd(x.precision(), delta_scale);
+  auto fits = ir_builder()->CreateICmpSLE(
+      scaled_precision, types()->i32_constant(DecimalTypeUtil::kMaxPrecision));
+  auto non_zero = ir_builder()->CreateICmpNE(y.value(), types()->i128_constant(0));
+  auto fast_path = ir_builder()->CreateAnd(fits, non_zero);
+
+  auto then_lambda = [&] {
+    auto x_scaled = IncreaseScale(x.value(), delta_scale);
+    auto result = ir_builder()->CreateSDiv(x_scaled, y.value());
+    auto remainder = ir_builder()->CreateSRem(x_scaled, y.value());
+    ADD_TRACE_128("Divide : result", result);
+
+    auto remainder_abs = Abs(remainder);
+    auto round = ir_builder()->CreateICmpSGE(
+        remainder_abs, ir_builder()->CreateSub(Abs(y.value()), remainder_abs));
+    auto zero = types()->i128_constant(0);
+    auto same_sign = ir_builder()->CreateICmpEQ(
+        ir_builder()->CreateICmpSLT(x.value(), zero),
+        ir_builder()->CreateICmpSLT(y.value(), zero));
+    auto adjust = ir_builder()->CreateSelect(same_sign, types()->i128_constant(1),
+                                             types()->i128_constant(-1));
+    return ir_builder()->CreateSelect(round, ir_builder()->CreateAdd(result, adjust),
+                                      result);
+  };
+  auto else_lambda = [&] {
+    return CallDecimalFunction(kDivideInternalFunction, i128, GetArgs(function));
+  };
+  auto value = BuildIfElse(fast_path, i128, then_lambda, else_lambda);
+
+  ir_builder()->CreateRet(value);
+  return Status::OK();
+}
+
+Status DecimalIR::BuildMod() {
+  // Create fn prototype :
+  // int128_t
+  // mod_decimal128_decimal128(int64_t context, int128_t x_value, int32_t x_precision,
+  //                           int32_t x_scale, int128_t y_value, int32_t y_precision,
+  //                           int32_t y_scale, int32_t out_precision,
+  //                           int32_t out_scale)
+  auto i32 = types()->i32_type();
+  auto i128 = types()->i128_type();
+  auto function = BuildFunction(kModFunction, i128,
+                                {
+                                    {"context", types()->i64_type()},
+                                    {"x_value", i128},
+                                    {"x_precision", i32},
+                                    {"x_scale", i32},
+                                    {"y_value", i128},
+                                    {"y_precision", i32},
+                                    {"y_scale", i32},
+                                    {"out_precision", i32},
+                                    {"out_scale", i32},
+                                });
+
+  auto arg_iter = function->arg_begin();
+  ValueFull x(&arg_iter[1], &arg_iter[2], &arg_iter[3]);
+  ValueFull y(&arg_iter[4], &arg_iter[5], &arg_iter[6]);
+
+  auto entry = llvm::BasicBlock::Create(*context(), "entry", function);
+  ir_builder()->SetInsertPoint(entry);
+
+  // CPP :
+  // higher_scale = max(x_scale, y_scale)
+  // if (x_precision + higher_scale - x_scale <= 38 &&
+  //     y_precision + higher_scale - y_scale <= 38 && y_value != 0) {
+  //   // x and y have at most 38 digits once adjusted to the same scale.
+  //   return IncreaseScale(x_value, higher_scale - x_scale) %
+  //          IncreaseScale(y_value, higher_scale - y_scale)
+  // } else {
+  //   return mod_internal(context, x, y, out)
+  // }
+  auto higher_scale = GetHigherScale(x.scale(), y.scale());
+  auto x_delta = ir_builder()->CreateSub(higher_scale, x.scale());
+  auto y_delta = ir_builder()->CreateSub(higher_scale, y.scale());
+  auto max_precision = types()->i32_constant(DecimalTypeUtil::kMaxPrecision);
+  auto x_fits = ir_builder()->CreateICmpSLE(
+      ir_builder()->CreateAdd(x.precision(), x_delta), max_precision);
+  auto y_fits = ir_builder()->CreateICmpSLE(
+      ir_builder()->CreateAdd(y.precision(), y_delta), max_precision);
+  auto non_zero = ir_builder()->CreateICmpNE(y.value(), types()->i128_constant(0));
+  auto fast_path =
+      ir_builder()->CreateAnd(ir_builder()->CreateAnd(x_fits, y_fits), non_zero);
+
+  auto then_lambda = [&] {
+    auto x_scaled = IncreaseScale(x.value(), x_delta);
+    auto y_scaled = IncreaseScale(y.value(), y_delta);
+    return ir_builder()->CreateSRem(x_scaled, y_scaled);
+  };
+  auto else_lambda = [&] {
+    return CallDecimalFunction(kModInternalFunction, i128, GetArgs(function));
+  };
+  auto value = BuildIfElse(fast_path, i128, then_lambda, else_lambda);
+
+  ir_builder()->CreateRet(value);
+  return Status::OK();
+}
+
 Status DecimalIR::BuildCompare(const std::string& function_name,
                                llvm::ICmpInst::Predicate cmp_instruction) {
   // Create fn prototype :
@@ -469,6 +689,9 @@ Status DecimalIR::AddFunctions(Engine* engine) {
 
   ARROW_RETURN_NOT_OK(decimal_ir->BuildAdd());
   ARROW_RETURN_NOT_OK(decimal_ir->BuildSubtract());
+  ARROW_RETURN_NOT_OK(decimal_ir->BuildMultiply());
+  ARROW_RETURN_NOT_OK(decimal_ir->BuildDivide());
+  ARROW_RETURN_NOT_OK(decimal_ir->BuildMod());
   ARROW_RETURN_NOT_OK(decimal_ir->BuildCompare(kEQFunction, llvm::ICmpInst::ICMP_EQ));
   ARROW_RETURN_NOT_OK(decimal_ir->BuildCompare(kNEFunction, llvm::ICmpInst::ICMP_NE));
   ARROW_RETURN_NOT_OK(decimal_ir->BuildCompare(kLTFunction, llvm::ICmpInst::ICMP_SLT));
@@ -153,9 +153,17 @@ class DecimalIR : public FunctionIRBuilder {
   // Build the function for decimal multiplication.
   Status BuildMultiply();
 
-  // Build the function for decimal division/mod.
-  Status BuildDivideOrMod(const std::string& function_name,
-                          const std::string& internal_name);
+  // Build the function for decimal division.
+  Status BuildDivide();
+
+  // Build the function for decimal mod.
+  Status BuildMod();
+
+  // Get the absolute value of an i128.
+  llvm::Value* Abs(llvm::Value* value);
+
+  // Get the arguments of 'function', to pass them on to another function.
+  std::vector<llvm::Value*> GetArgs(llvm::Function* function);
 
   Status BuildCompare(const std::string& function_name,
                       llvm::ICmpInst::Predicate cmp_instruction);
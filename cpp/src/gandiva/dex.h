@@ -112,11 +112,13 @@ class GANDIVA_EXPORT LocalBitMapValidityDex : public Dex {
 class GANDIVA_EXPORT FuncDex : public Dex {
  public:
   FuncDex(FuncDescriptorPtr func_descriptor, const NativeFunction* native_function,
-          FunctionHolderPtr function_holder, const ValueValidityPairVector& args)
+          FunctionHolderPtr function_holder, const ValueValidityPairVector& args,
+          bool is_constant = false)
       : func_descriptor_(func_descriptor),
         native_function_(native_function),
         function_holder_(function_holder),
-        args_(args) {}
+        args_(args),
+        is_constant_(is_constant) {}
 
   FuncDescriptorPtr func_descriptor() const { return func_descriptor_; }
 
@@ -126,11 +128,16 @@ class GANDIVA_EXPORT FuncDex : public Dex {
 
   const ValueValidityPairVector& args() const { return args_; }
 
+  /// The function only depends on literals, and has no side effects : its value is
+  /// the same for all the records.
+  bool is_constant() const { return is_constant_; }
+
  private:
   FuncDescriptorPtr func_descriptor_;
   const NativeFunction* native_function_;
   FunctionHolderPtr function_holder_;
   ValueValidityPairVector args_;
+  bool is_constant_;
 };
 
 /// A function expression that only deals with non-null inputs, and generates non-null
@@ -140,8 +147,8 @@ class GANDIVA_EXPORT NonNullableFuncDex : public FuncDex {
   NonNullableFuncDex(FuncDescriptorPtr func_descriptor,
                      const NativeFunction* native_function,
                      FunctionHolderPtr function_holder,
-                     const ValueValidityPairVector& args)
-      : FuncDex(func_descriptor, native_function, function_holder, args) {}
+                     const ValueValidityPairVector& args, bool is_constant = false)
+      : FuncDex(func_descriptor, native_function, function_holder, args, is_constant) {}
 
   void Accept(DexVisitor& visitor) override { visitor.Visit(*this); }
 };
@@ -153,8 +160,8 @@ class GANDIVA_EXPORT NullableNeverFuncDex : public FuncDex {
   NullableNeverFuncDex(FuncDescriptorPtr func_descriptor,
                        const NativeFunction* native_function,
                        FunctionHolderPtr function_holder,
-                       const ValueValidityPairVector& args)
-      : FuncDex(func_descriptor, native_function, function_holder, args) {}
+                       const ValueValidityPairVector& args, bool is_constant = false)
+      : FuncDex(func_descriptor, native_function, function_holder, args, is_constant) {}
 
   void Accept(DexVisitor& visitor) override { visitor.Visit(*this); }
 };
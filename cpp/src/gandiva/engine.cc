@@ -24,10 +24,12 @@
 #include "gandiva/engine.h"
 
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -41,12 +43,15 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Linker/Linker.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/IPO.h>
@@ -55,12 +60,16 @@
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/Scalar/GVN.h>
 #include <llvm/Transforms/Utils.h>
+#include <llvm/Transforms/Utils/Cloning.h>
 #include <llvm/Transforms/Vectorize.h>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
 
+#include "arrow/util/config.h"
+#include "arrow/util/hashing.h"
+
 #include "gandiva/decimal_ir.h"
 #include "gandiva/exported_funcs_registry.h"
 
@@ -71,6 +80,150 @@ extern const size_t kPrecompiledBitcodeSize;
 
 std::once_flag init_once_flag;
 
+namespace {
+
+Status LLVMErrorToStatus(llvm::Error error) {
+  // NOTE: llvm::handleAllErrors() fails linking with RTTI-disabled LLVM builds
+  // (ARROW-5148)
+  std::string str;
+  llvm::raw_string_ostream stream(str);
+  stream << error;
+  return Status::CodeGenError(stream.str());
+}
+
+/// \brief The precompiled IR, parsed once per process.
+///
+/// Each engine has an LLVMContext of its own, and modules can't be shared across
+/// contexts. So the precompiled bitcode is parsed once into a separate context,
+/// and engines get small bitcode modules cut from it: one with the declarations
+/// of the precompiled functions, to generate code against, and one with the
+/// definitions of just the functions a module calls, to compile it.
+class PrecompiledModule {
+ public:
+  static Status Get(PrecompiledModule** precompiled) {
+    // Never destroyed, engines may still use it during exit.
+    static PrecompiledModule* instance = new PrecompiledModule();
+    static Status status = instance->Init();
+    ARROW_RETURN_NOT_OK(status);
+    *precompiled = instance;
+    return Status::OK();
+  }
+
+  const std::string& declarations_bitcode() const { return declarations_bitcode_; }
+
+  /// Get the bitcode of the definitions of the named functions, and of the
+  /// functions and globals they use in turn.
+  void GetDefinitions(const std::vector<std::string>& names, std::string* bitcode) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::unordered_set<const llvm::GlobalValue*> needed;
+    std::vector<const llvm::GlobalValue*> pending;
+    auto add = [&needed, &pending](const llvm::GlobalValue* global) {
+      if (global != nullptr && !global->isDeclaration() && needed.insert(global).second) {
+        pending.push_back(global);
+      }
+    };
+    for (auto& name : names) {
+      add(module_->getNamedValue(name));
+    }
+    std::unordered_set<const llvm::Value*> visited;
+    while (!pending.empty()) {
+      const llvm::GlobalValue* global = pending.back();
+      pending.pop_back();
+
+      std::vector<const llvm::Value*> values;
+      if (auto function = llvm::dyn_cast<llvm::Function>(global)) {
+        for (auto& block : *function) {
+          for (auto& instruction : block) {
+            values.insert(values.end(), instruction.op_begin(), instruction.op_end());
+          }
+        }
+      } else if (auto variable = llvm::dyn_cast<llvm::GlobalVariable>(global)) {
+        values.push_back(variable->getInitializer());
+      } else if (auto alias = llvm::dyn_cast<llvm::GlobalAlias>(global)) {
+        values.push_back(alias->getAliasee());
+      }
+      // Globals can also be used inside constant expressions and initializers.
+      while (!values.empty()) {
+        const llvm::Value* value = values.back();
+        values.pop_back();
+        if (auto used = llvm::dyn_cast<llvm::GlobalValue>(value)) {
+          add(used);
+        } else if (llvm::isa<llvm::Constant>(value) && visited.insert(value).second) {
+          auto constant = llvm::cast<llvm::Constant>(value);
+          values.insert(values.end(), constant->op_begin(), constant->op_end());
+        }
+      }
+    }
+
+    llvm::ValueToValueMapTy value_map;
+    auto definitions = llvm::CloneModule(
+        *module_, value_map,
+        [&needed](const llvm::GlobalValue* global) { return needed.count(global) > 0; });
+    EraseUnusedDeclarations(definitions.get());
+
+    llvm::raw_string_ostream stream(*bitcode);
+    llvm::WriteBitcodeToFile(*definitions, stream);
+    stream.flush();
+  }
+
+ private:
+  Status Init() {
+    auto bitcode = llvm::StringRef(reinterpret_cast<const char*>(kPrecompiledBitcode),
+                                   kPrecompiledBitcodeSize);
+    llvm::Expected<std::unique_ptr<llvm::Module>> module_or_error =
+        llvm::parseBitcodeFile(llvm::MemoryBufferRef(bitcode, "precompiled"), context_);
+    if (!module_or_error) {
+      return LLVMErrorToStatus(module_or_error.takeError());
+    }
+    module_ = std::move(module_or_error.get());
+    ARROW_RETURN_IF(llvm::verifyModule(*module_, &llvm::errs()),
+                    Status::CodeGenError("verify of IR Module failed"));
+
+    // Declare everything generated code may call. Local globals can't be
+    // referred to from another module, and the llvm.* variables only mean
+    // something with their definitions. Nothing uses a declaration yet, so
+    // these can simply be erased.
+    llvm::ValueToValueMapTy value_map;
+    auto declarations = llvm::CloneModule(
+        *module_, value_map, [](const llvm::GlobalValue*) { return false; });
+    std::vector<llvm::GlobalValue*> unusable;
+    for (auto& global : module_->global_values()) {
+      if (global.hasLocalLinkage() || (llvm::isa<llvm::GlobalVariable>(global) &&
+                                       global.getName().startswith("llvm."))) {
+        unusable.push_back(llvm::cast<llvm::GlobalValue>(value_map[&global]));
+      }
+    }
+    for (auto global : unusable) {
+      global->eraseFromParent();
+    }
+
+    llvm::raw_string_ostream stream(declarations_bitcode_);
+    llvm::WriteBitcodeToFile(*declarations, stream);
+    stream.flush();
+    return Status::OK();
+  }
+
+  static void EraseUnusedDeclarations(llvm::Module* module) {
+    std::vector<llvm::GlobalValue*> unused;
+    for (auto& global : module->global_values()) {
+      if (global.isDeclaration() && global.use_empty()) {
+        unused.push_back(&global);
+      }
+    }
+    for (auto global : unused) {
+      global->eraseFromParent();
+    }
+  }
+
+  std::mutex mutex_;
+  llvm::LLVMContext context_;
+  std::unique_ptr<llvm::Module> module_;
+  std::string declarations_bitcode_;
+};
+
+}  // namespace
+
 bool Engine::init_once_done_ = false;
 std::set<std::string> Engine::loaded_libs_ = {};
 std::mutex Engine::mtx_;
@@ -93,12 +246,18 @@ void Engine::InitOnce() {
 Status Engine::Make(std::shared_ptr<Configuration> config,
                     std::unique_ptr<Engine>* engine) {
   static auto host_cpu_name = llvm::sys::getHostCPUName();
+  ARROW_RETURN_IF(
+      config->optimization_level() < 0 || config->optimization_level() > 3,
+      Status::Invalid("Optimization level must be between 0 and 3, got ",
+                      config->optimization_level()));
   std::unique_ptr<Engine> engine_obj(new Engine());
 
   std::call_once(init_once_flag, [&engine_obj] { engine_obj->InitOnce(); });
   engine_obj->context_.reset(new llvm::LLVMContext());
   engine_obj->ir_builder_.reset(new llvm::IRBuilder<>(*(engine_obj->context())));
   engine_obj->types_.reset(new LLVMTypes(*(engine_obj->context())));
+  engine_obj->object_cache_directory_ = config->object_cache_directory();
+  engine_obj->optimization_level_ = config->optimization_level();
 
   // Create the execution engine
   std::unique_ptr<llvm::Module> cg_module(
@@ -108,7 +267,8 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
   llvm::EngineBuilder engineBuilder(std::move(cg_module));
   engineBuilder.setMCPU(host_cpu_name);
   engineBuilder.setEngineKind(llvm::EngineKind::JIT);
-  engineBuilder.setOptLevel(llvm::CodeGenOpt::Aggressive);
+  engineBuilder.setOptLevel(
+      static_cast<llvm::CodeGenOpt::Level>(engine_obj->optimization_level_));
   engineBuilder.setErrorStr(&(engine_obj->llvm_error_));
   engine_obj->execution_engine_.reset(engineBuilder.create());
   if (engine_obj->execution_engine_ == NULL) {
@@ -132,37 +292,53 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
 
 // Handling for pre-compiled IR libraries.
 Status Engine::LoadPreCompiledIR() {
-  auto bitcode = llvm::StringRef(reinterpret_cast<const char*>(kPrecompiledBitcode),
-                                 kPrecompiledBitcodeSize);
-
-  /// Read from file into memory buffer.
-  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_or_error =
-      llvm::MemoryBuffer::getMemBuffer(bitcode, "precompiled", false);
+  PrecompiledModule* precompiled;
+  ARROW_RETURN_NOT_OK(PrecompiledModule::Get(&precompiled));
+  std::unique_ptr<llvm::Module> declarations;
+  ARROW_RETURN_NOT_OK(ParseBitcode(precompiled->declarations_bitcode(), &declarations));
+
+  // The linker skips declarations nothing refers to, so copy them over.
+  for (auto& function : *declarations) {
+    module_->getOrInsertFunction(function.getName(), function.getFunctionType(),
+                                 function.getAttributes());
+  }
+  for (auto& variable : declarations->globals()) {
+    module_->getOrInsertGlobal(variable.getName(), variable.getValueType());
+  }
+  return Status::OK();
+}
 
-  ARROW_RETURN_IF(!buffer_or_error,
-                  Status::CodeGenError("Could not load module from IR: ",
-                                       buffer_or_error.getError().message()));
+// Link in the bodies of the precompiled functions and globals the module uses.
+Status Engine::LinkPreCompiledDefinitions() {
+  std::vector<std::string> names;
+  for (auto& global : module_->global_values()) {
+    if (global.isDeclaration() && !global.use_empty()) {
+      names.push_back(global.getName().str());
+    }
+  }
+  if (names.empty()) {
+    return Status::OK();
+  }
 
-  std::unique_ptr<llvm::MemoryBuffer> buffer = move(buffer_or_error.get());
+  PrecompiledModule* precompiled;
+  ARROW_RETURN_NOT_OK(PrecompiledModule::Get(&precompiled));
+  std::string bitcode;
+  precompiled->GetDefinitions(names, &bitcode);
+  std::unique_ptr<llvm::Module> definitions;
+  ARROW_RETURN_NOT_OK(ParseBitcode(bitcode, &definitions));
+  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, std::move(definitions)),
+                  Status::CodeGenError("failed to link IR Modules"));
+  return Status::OK();
+}
 
-  /// Parse the IR module.
+Status Engine::ParseBitcode(const std::string& bitcode,
+                            std::unique_ptr<llvm::Module>* module) {
   llvm::Expected<std::unique_ptr<llvm::Module>> module_or_error =
-      llvm::getOwningLazyBitcodeModule(move(buffer), *context());
+      llvm::parseBitcodeFile(llvm::MemoryBufferRef(bitcode, "precompiled"), *context());
   if (!module_or_error) {
-    // NOTE: llvm::handleAllErrors() fails linking with RTTI-disabled LLVM builds
-    // (ARROW-5148)
-    std::string str;
-    llvm::raw_string_ostream stream(str);
-    stream << module_or_error.takeError();
-    return Status::CodeGenError(stream.str());
+    return LLVMErrorToStatus(module_or_error.takeError());
   }
-  std::unique_ptr<llvm::Module> ir_module = move(module_or_error.get());
-
-  ARROW_RETURN_IF(llvm::verifyModule(*ir_module, &llvm::errs()),
-                  Status::CodeGenError("verify of IR Module failed"));
-  ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(ir_module)),
-                  Status::CodeGenError("failed to link IR Modules"));
-
+  *module = std::move(module_or_error.get());
   return Status::OK();
 }
 
@@ -190,10 +366,66 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+void Engine::SetObjectCacheKey(const std::string& key) {
+  DCHECK(!module_finalized_);
+  if (object_cache_directory_.empty()) {
+    return;
+  }
+  // The object code also depends on the compiler, the target and the
+  // precompiled functions it was linked with.
+  static const uint64_t precompiled_hash = arrow::internal::ComputeStringHash<0>(
+      kPrecompiledBitcode, static_cast<int64_t>(kPrecompiledBitcodeSize));
+  std::stringstream ss;
+  ss << key << "\nLLVM " << LLVM_VERSION_STRING << ", CPU "
+     << llvm::sys::getHostCPUName().str() << ", Arrow " << ARROW_VERSION
+     << ", precompiled " << precompiled_hash << ", O" << optimization_level_;
+  object_cache_.reset(new ObjectCodeCache(object_cache_directory_, ss.str()));
+  execution_engine_->setObjectCache(object_cache_.get());
+}
+
+llvm::Value* Engine::ProcessAddress(const void* address) {
+  auto value = reinterpret_cast<int64_t>(address);
+  if (object_cache_ == nullptr) {
+    return types_->i64_constant(value);
+  }
+  auto table_type = llvm::ArrayType::get(types_->i64_type(), 0);
+  if (process_addresses_global_ == nullptr) {
+    process_addresses_global_ = new llvm::GlobalVariable(
+        *module_, table_type, true /*isConstant*/, llvm::GlobalValue::ExternalLinkage,
+        nullptr, "gdv_process_addresses");
+  }
+  process_addresses_.push_back(value);
+  llvm::Value* slot = ir_builder_->CreateConstGEP2_64(
+      table_type, process_addresses_global_, 0, process_addresses_.size() - 1);
+  return ir_builder_->CreateLoad(types_->i64_type(), slot);
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir, std::string* final_ir) {
-  auto status = RemoveUnusedFunctions();
-  ARROW_RETURN_NOT_OK(status);
+  if (process_addresses_global_ != nullptr) {
+    execution_engine_->addGlobalMapping(process_addresses_global_,
+                                        process_addresses_.data());
+  }
+  if (object_cache_ != nullptr) {
+    if (!optimise_ir) {
+      // Keep unoptimised code out of the cache.
+      execution_engine_->setObjectCache(nullptr);
+    } else if (!dump_ir && final_ir == nullptr && object_cache_->Load()) {
+      // Skip optimisation and code generation, the module is only needed to
+      // look up the compiled functions by name.
+      execution_engine_->finalizeObject();
+      module_finalized_ = true;
+      loaded_from_object_cache_ = true;
+      return Status::OK();
+    }
+  }
+
+  // The precompiled functions are only declared so far. Dropping the unused
+  // functions first leaves just the calls the module really makes, then the
+  // bodies linked in for those are dropped again once inlined or if unused.
+  ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
+  ARROW_RETURN_NOT_OK(LinkPreCompiledDefinitions());
+  ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
   if (dump_ir) {
     DumpIR("Before optimise");
@@ -219,7 +451,7 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir, std::string* final
 
     // run the optimiser
     llvm::PassManagerBuilder pass_builder;
-    pass_builder.OptLevel = 3;
+    pass_builder.OptLevel = optimization_level_;
     pass_builder.populateModulePassManager(*pass_manager);
     pass_manager->run(*module_);
 
@@ -30,6 +30,7 @@
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/logging.h"
+#include "gandiva/object_code_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -58,9 +59,25 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// Look up the object code of the module in the persistent cache of the
+  /// configuration, and store it there once compiled. Does nothing if the
+  /// configuration has no object cache directory. Must be called before any
+  /// code is generated.
+  ///
+  /// \param[in] key describes the expressions the module is built for
+  void SetObjectCacheKey(const std::string& key);
+
+  /// Get an i64 value holding an address in this process, to be used by the
+  /// generated code. With an object cache, the address is loaded from a table
+  /// that is filled in for each process, so that the object code can be reused.
+  llvm::Value* ProcessAddress(const void* address);
+
+  /// Optimise and compile the module, or load it from the object cache.
   Status FinalizeModule(bool optimise_ir, bool dump_ir, std::string* final_ir = NULLPTR);
 
+  /// Whether FinalizeModule() found the module in the object cache.
+  bool loaded_from_object_cache() const { return loaded_from_object_cache_; }
+
   /// Get the compiled function corresponding to the irfunction.
   void* CompiledFunction(llvm::Function* irFunction);
 
@@ -71,7 +88,11 @@ class GANDIVA_EXPORT Engine {
  private:
   /// private constructor to ensure engine is created
   /// only through the factory.
-  Engine() : module_finalized_(false) {}
+  Engine()
+      : module_finalized_(false),
+        optimization_level_(3),
+        loaded_from_object_cache_(false),
+        process_addresses_global_(NULLPTR) {}
 
   /// do one time inits.
   static void InitOnce();
@@ -79,10 +100,16 @@ class GANDIVA_EXPORT Engine {
 
   llvm::ExecutionEngine& execution_engine() { return *execution_engine_.get(); }
 
-  /// load pre-compiled IR modules from precompiled_bitcode.cc and merge them into
+  /// declare the functions of the pre-compiled IR from precompiled_bitcode.cc in
   /// the main module.
   Status LoadPreCompiledIR();
 
+  /// link in the definitions of the pre-compiled functions the main module uses.
+  Status LinkPreCompiledDefinitions();
+
+  /// parse a bitcode module into the context of the engine.
+  Status ParseBitcode(const std::string& bitcode, std::unique_ptr<llvm::Module>* module);
+
   // Create and add mappings for cpp functions that can be accessed from LLVM.
   void AddGlobalMappings();
 
@@ -103,6 +130,15 @@ class GANDIVA_EXPORT Engine {
 
   bool module_finalized_;
   std::string llvm_error_;
+  int optimization_level_;
+
+  std::string object_cache_directory_;
+  std::unique_ptr<ObjectCodeCache> object_cache_;
+  bool loaded_from_object_cache_;
+  // Addresses returned by ProcessAddress() when there is an object cache, and
+  // the global the generated code reads them from.
+  std::vector<int64_t> process_addresses_;
+  llvm::GlobalVariable* process_addresses_global_;
 
   static std::set<std::string> loaded_libs_;
   static std::mutex mtx_;
@@ -130,4 +130,42 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestPrecompiledFunctions) {
+  std::unique_ptr<Engine> engine;
+  auto status = Engine::Make(TestConfiguration(), &engine);
+  EXPECT_TRUE(status.ok()) << status.message();
+  LLVMTypes types(*engine->context());
+
+  // int64_t cast_int(int32_t value) { return castBIGINT_int32(value); }
+  llvm::Function* cast_fn = engine->module()->getFunction("castBIGINT_int32");
+  ASSERT_NE(cast_fn, nullptr);
+  EXPECT_TRUE(cast_fn->isDeclaration());
+  llvm::FunctionType* prototype =
+      llvm::FunctionType::get(types.i64_type(), {types.i32_type()}, false /*isVarArg*/);
+  engine->AddFunctionToCompile("cast_int");
+  llvm::Function* ir_func = llvm::Function::Create(
+      prototype, llvm::GlobalValue::ExternalLinkage, "cast_int", engine->module());
+  llvm::IRBuilder<>* builder = engine->ir_builder();
+  builder->SetInsertPoint(llvm::BasicBlock::Create(*engine->context(), "entry", ir_func));
+  builder->CreateRet(builder->CreateCall(cast_fn, {&*ir_func->arg_begin()}));
+
+  status = engine->FinalizeModule(false, false);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Only the bodies of the precompiled functions in use are linked in.
+  llvm::Function* unused_fn = engine->module()->getFunction("castINT_int64");
+  EXPECT_TRUE(unused_fn == nullptr || unused_fn->isDeclaration());
+
+  auto cast_int =
+      reinterpret_cast<int64_t (*)(int32_t)>(engine->CompiledFunction(ir_func));
+  EXPECT_EQ(cast_int(-7), -7);
+}
+
+TEST_F(TestEngine, TestInvalidOptimizationLevel) {
+  std::unique_ptr<Engine> engine;
+  auto configuration = ConfigurationBuilder().set_optimization_level(4).build();
+  auto status = Engine::Make(configuration, &engine);
+  EXPECT_TRUE(status.IsInvalid()) << status.message();
+}
+
 }  // namespace gandiva
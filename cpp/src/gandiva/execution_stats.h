@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace gandiva {
+
+/// \brief Compilation and evaluation statistics of a projector or a filter.
+struct ExecutionStats {
+  /// Time spent building the LLVM code, in nanoseconds. 0 while a background
+  /// compilation is running.
+  int64_t compile_time_ns = 0;
+
+  /// Whether the object code was loaded from the persistent object code cache.
+  bool object_code_cache_hit = false;
+
+  /// Number of batches and rows evaluated, and the time spent evaluating them.
+  int64_t num_batches = 0;
+  int64_t num_rows = 0;
+  int64_t eval_time_ns = 0;
+};
+
+/// \brief Lookups in the cache of projectors or filters built by Make().
+struct CacheStats {
+  int64_t hits = 0;
+  int64_t misses = 0;
+};
+
+/// \brief Counts the evaluations of a projector or a filter. Thread-safe.
+class EvaluationCounters {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Record the evaluation of a batch of 'num_rows' rows, which started at 'start'.
+  void Add(int64_t num_rows, Clock::time_point start) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                        start);
+    num_batches_.fetch_add(1);
+    num_rows_.fetch_add(num_rows);
+    eval_time_ns_.fetch_add(elapsed.count());
+  }
+
+  /// Copy the counters to 'stats'.
+  void CopyTo(ExecutionStats* stats) const {
+    stats->num_batches = num_batches_.load();
+    stats->num_rows = num_rows_.load();
+    stats->eval_time_ns = eval_time_ns_.load();
+  }
+
+ private:
+  std::atomic<int64_t> num_batches_{0};
+  std::atomic<int64_t> num_rows_{0};
+  std::atomic<int64_t> eval_time_ns_{0};
+};
+
+}  // namespace gandiva
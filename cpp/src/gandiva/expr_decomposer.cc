@@ -45,6 +45,8 @@ Status ExprDecomposer::Visit(const FieldNode& node) {
     value_dex = std::make_shared<VectorReadFixedLenValueDex>(desc);
   }
   result_ = std::make_shared<ValueValidityPair>(validity_dex, value_dex);
+  result_shareable_ = true;
+  result_constant_ = false;
   return Status::OK();
 }
 
@@ -62,12 +64,35 @@ const FunctionNode ExprDecomposer::TryOptimize(const FunctionNode& node) {
 // Decompose a field node - wherever possible, merge the validity vectors of the
 // child nodes.
 Status ExprDecomposer::Visit(const FunctionNode& in_node) {
+  // Reuse the decomposition of an identical sub-tree, if any.
+  std::string key;
+  if (shared_sub_exprs_ != nullptr) {
+    key = in_node.ToString();
+    auto shared = shared_sub_exprs_->find(key);
+    if (shared != shared_sub_exprs_->end()) {
+      ++num_shared_sub_exprs_;
+      result_ = shared->second;
+      result_shareable_ = true;
+      result_constant_ =
+          std::static_pointer_cast<FuncDex>(result_->value_expr())->is_constant();
+      return Status::OK();
+    }
+  }
+
   auto node = TryOptimize(in_node);
   auto desc = node.descriptor();
   FunctionSignature signature(desc->name(), desc->params(), desc->return_type());
   const NativeFunction* native_function = registry_.LookupSignature(signature);
   DCHECK(native_function) << "Missing Signature " << signature.ToString();
 
+  // A function can be shared if it doesn't track the validity in a local bitmap or
+  // keep state in a holder. It's constant if its value also doesn't depend on the
+  // records, or on the execution context (errors or allocations).
+  bool shareable = native_function->result_nullable_type() != kResultNullInternal &&
+                   !native_function->NeedsFunctionHolder();
+  bool constant = shareable && !native_function->NeedsContext() &&
+                  !native_function->CanReturnErrors();
+
   // decompose the children.
   std::vector<ValueValidityPairPtr> args;
   for (auto& child : node.children()) {
@@ -75,7 +100,10 @@ Status ExprDecomposer::Visit(const FunctionNode& in_node) {
     ARROW_RETURN_NOT_OK(status);
 
     args.push_back(result());
+    shareable = shareable && result_shareable_;
+    constant = constant && result_constant_;
   }
+  constant = constant && shareable;
 
   // Make a function holder, if required.
   std::shared_ptr<FunctionHolder> holder;
@@ -95,13 +123,13 @@ Status ExprDecomposer::Visit(const FunctionNode& in_node) {
                              decomposed->validity_exprs().end());
     }
 
-    auto value_dex =
-        std::make_shared<NonNullableFuncDex>(desc, native_function, holder, args);
+    auto value_dex = std::make_shared<NonNullableFuncDex>(desc, native_function, holder,
+                                                          args, constant);
     result_ = std::make_shared<ValueValidityPair>(merged_validity, value_dex);
   } else if (native_function->result_nullable_type() == kResultNullNever) {
     // These functions always output valid results. So, no validity dex.
-    auto value_dex =
-        std::make_shared<NullableNeverFuncDex>(desc, native_function, holder, args);
+    auto value_dex = std::make_shared<NullableNeverFuncDex>(desc, native_function,
+                                                            holder, args, constant);
     result_ = std::make_shared<ValueValidityPair>(value_dex);
   } else {
     DCHECK(native_function->result_nullable_type() == kResultNullInternal);
@@ -114,6 +142,12 @@ Status ExprDecomposer::Visit(const FunctionNode& in_node) {
         desc, native_function, holder, args, local_bitmap_idx);
     result_ = std::make_shared<ValueValidityPair>(validity_dex, value_dex);
   }
+
+  if (shareable && shared_sub_exprs_ != nullptr) {
+    (*shared_sub_exprs_)[key] = result_;
+  }
+  result_shareable_ = shareable;
+  result_constant_ = constant;
   return Status::OK();
 }
 
@@ -144,6 +178,8 @@ Status ExprDecomposer::Visit(const IfNode& node) {
                               local_bitmap_idx, is_terminal_else);
 
   result_ = std::make_shared<ValueValidityPair>(validity_dex, value_dex);
+  result_shareable_ = false;
+  result_constant_ = false;
   return Status::OK();
 }
 
@@ -172,6 +208,8 @@ Status ExprDecomposer::Visit(const BooleanNode& node) {
       break;
   }
   result_ = std::make_shared<ValueValidityPair>(validity_dex, value_dex);
+  result_shareable_ = false;
+  result_constant_ = false;
   return Status::OK();
 }
 
@@ -185,6 +223,8 @@ Status ExprDecomposer::Visit(const BooleanNode& node) {
     /* In always outputs valid results, so no validity dex */                 \
     auto value_dex = std::make_shared<InExprDex<ctype>>(args, node.values()); \
     result_ = std::make_shared<ValueValidityPair>(value_dex);                 \
+    result_shareable_ = false;                                                \
+    result_constant_ = false;                                                 \
     return Status::OK();                                                      \
   }
 
@@ -201,6 +241,8 @@ Status ExprDecomposer::Visit(const LiteralNode& node) {
     validity_dex = std::make_shared<TrueDex>();
   }
   result_ = std::make_shared<ValueValidityPair>(validity_dex, value_dex);
+  result_shareable_ = true;
+  result_constant_ = true;
   return Status::OK();
 }
 
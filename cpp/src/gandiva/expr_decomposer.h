@@ -21,6 +21,7 @@
 #include <memory>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "gandiva/arrow.h"
@@ -38,8 +39,22 @@ class Annotator;
 /// value expressions.
 class GANDIVA_EXPORT ExprDecomposer : public NodeVisitor {
  public:
-  explicit ExprDecomposer(const FunctionRegistry& registry, Annotator& annotator)
-      : registry_(registry), annotator_(annotator) {}
+  /// Decomposed sub-trees, by their string representation.
+  using SharedSubExprs = std::unordered_map<std::string, ValueValidityPairPtr>;
+
+  /// \param[in] registry registry of the functions.
+  /// \param[in] annotator annotator for the fields of the expression.
+  /// \param[in,out] shared_sub_exprs if not null, the function sub-trees that have no
+  ///                side effects share their decomposition with the identical sub-trees
+  ///                in this map, and are added to it.
+  explicit ExprDecomposer(const FunctionRegistry& registry, Annotator& annotator,
+                          SharedSubExprs* shared_sub_exprs = NULLPTR)
+      : registry_(registry),
+        annotator_(annotator),
+        shared_sub_exprs_(shared_sub_exprs),
+        num_shared_sub_exprs_(0),
+        result_shareable_(false),
+        result_constant_(false) {}
 
   Status Decompose(const Node& root, ValueValidityPairPtr* out) {
     auto status = root.Accept(*this);
@@ -49,6 +64,9 @@ class GANDIVA_EXPORT ExprDecomposer : public NodeVisitor {
     return status;
   }
 
+  /// The number of sub-trees that reused the decomposition of an identical one.
+  int num_shared_sub_exprs() const { return num_shared_sub_exprs_; }
+
  private:
   ARROW_DISALLOW_COPY_AND_ASSIGN(ExprDecomposer);
 
@@ -57,6 +75,7 @@ class GANDIVA_EXPORT ExprDecomposer : public NodeVisitor {
   FRIEND_TEST(TestExprDecomposer, TestInternalIf);
   FRIEND_TEST(TestExprDecomposer, TestParallelIf);
   FRIEND_TEST(TestExprDecomposer, TestIfInCondition);
+  FRIEND_TEST(TestExprDecomposer, TestSharedSubExprs);
 
   Status Visit(const FieldNode& node) override;
   Status Visit(const FunctionNode& node) override;
@@ -115,8 +134,15 @@ class GANDIVA_EXPORT ExprDecomposer : public NodeVisitor {
 
   const FunctionRegistry& registry_;
   Annotator& annotator_;
+  SharedSubExprs* shared_sub_exprs_;
+  int num_shared_sub_exprs_;
   std::stack<std::unique_ptr<IfStackEntry>> if_entries_stack_;
   ValueValidityPairPtr result_;
+  // The result has no side effects (local bitmaps, function holders), so that it can
+  // be computed once for all the identical sub-trees.
+  bool result_shareable_;
+  // The result only depends on literals.
+  bool result_constant_;
 };
 
 }  // namespace gandiva
@@ -243,4 +243,51 @@ TEST_F(TestExprDecomposer, TestIfInCondition) {
   EXPECT_EQ(decomposer.if_entries_stack_.empty(), true);
 }
 
+TEST_F(TestExprDecomposer, TestSharedSubExprs) {
+  Annotator annotator;
+  ExprDecomposer::SharedSubExprs shared_sub_exprs;
+
+  auto field_a = arrow::field("a", int32());
+  auto field_b = arrow::field("b", int32());
+  auto node_a = TreeExprBuilder::MakeField(field_a);
+  auto node_b = TreeExprBuilder::MakeField(field_b);
+  auto literal_1 = TreeExprBuilder::MakeLiteral(1);
+  auto literal_2 = TreeExprBuilder::MakeLiteral(2);
+
+  // (a + b) * (a + b)
+  auto sum = TreeExprBuilder::MakeFunction("add", {node_a, node_b}, int32());
+  auto same_sum = TreeExprBuilder::MakeFunction("add", {node_a, node_b}, int32());
+  auto product = TreeExprBuilder::MakeFunction("multiply", {sum, same_sum}, int32());
+
+  ExprDecomposer decomposer(registry_, annotator, &shared_sub_exprs);
+  ValueValidityPairPtr value_validity;
+  ASSERT_TRUE(decomposer.Decompose(*product, &value_validity).ok());
+  EXPECT_EQ(decomposer.num_shared_sub_exprs(), 1);
+  auto product_dex = std::dynamic_pointer_cast<FuncDex>(value_validity->value_expr());
+  ASSERT_NE(product_dex, nullptr);
+  EXPECT_EQ(product_dex->args()[0], product_dex->args()[1]);
+  EXPECT_FALSE(product_dex->is_constant());
+
+  // a - (1 + 2), decomposed with the decomposition of the previous expression.
+  auto constant = TreeExprBuilder::MakeFunction("add", {literal_1, literal_2}, int32());
+  auto difference =
+      TreeExprBuilder::MakeFunction("subtract", {node_a, constant}, int32());
+  ExprDecomposer other_decomposer(registry_, annotator, &shared_sub_exprs);
+  ASSERT_TRUE(other_decomposer.Decompose(*difference, &value_validity).ok());
+  EXPECT_EQ(other_decomposer.num_shared_sub_exprs(), 0);
+  auto difference_dex = std::dynamic_pointer_cast<FuncDex>(value_validity->value_expr());
+  ASSERT_NE(difference_dex, nullptr);
+  EXPECT_FALSE(difference_dex->is_constant());
+  auto constant_dex =
+      std::dynamic_pointer_cast<FuncDex>(difference_dex->args()[1]->value_expr());
+  ASSERT_NE(constant_dex, nullptr);
+  EXPECT_TRUE(constant_dex->is_constant());
+
+  // a + b, from the first expression.
+  ASSERT_TRUE(other_decomposer.Decompose(*same_sum, &value_validity).ok());
+  EXPECT_EQ(other_decomposer.num_shared_sub_exprs(), 1);
+  EXPECT_EQ(value_validity, product_dex->args()[0]);
+  EXPECT_EQ(shared_sub_exprs.size(), 4U);
+}
+
 }  // namespace gandiva
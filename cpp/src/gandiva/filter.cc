@@ -31,6 +31,11 @@
 
 namespace gandiva {
 
+static Cache<FilterCacheKey, std::shared_ptr<Filter>>& GetFilterCache() {
+  auto& cache = GetFilterCache();
+  return cache;
+}
+
 Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
@@ -58,6 +63,7 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   // Build LLVM generator, and generate code for the specified expression
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+  llvm_gen->SetObjectCacheKey(cache_key.ToString());
 
   // Run the validation on the expression.
   // Return if the expression is invalid since we will not be able to process further.
@@ -74,6 +80,7 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
+  auto start = EvaluationCounters::Clock::now();
   const auto num_rows = batch.num_rows();
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("RecordBatch schema must expected filter schema"));
@@ -100,7 +107,20 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   BitMapAccumulator::IntersectBitMaps(
       result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap((1))}, {0, 0}, num_rows);
 
-  return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
+  ARROW_RETURN_NOT_OK(
+      out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1));
+  evaluation_counters_.Add(num_rows, start);
+  return Status::OK();
+}
+
+ExecutionStats Filter::GetExecutionStats() const {
+  ExecutionStats stats;
+  stats.compile_time_ns = llvm_generator_->build_time_ns();
+  stats.object_code_cache_hit = llvm_generator_->loaded_from_object_cache();
+  evaluation_counters_.CopyTo(&stats);
+  return stats;
 }
 
+CacheStats Filter::GetCacheStats() { return GetFilterCache().GetStats(); }
+
 }  // namespace gandiva
@@ -27,6 +27,7 @@
 #include "gandiva/arrow.h"
 #include "gandiva/condition.h"
 #include "gandiva/configuration.h"
+#include "gandiva/execution_stats.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
@@ -76,10 +77,19 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Get the compilation and evaluation statistics of this filter. Make() may
+  /// return a cached filter, which then shares its statistics.
+  ExecutionStats GetExecutionStats() const;
+
+  /// Get the hits and misses of the cache of filters used by Make().
+  static CacheStats GetCacheStats();
+
  private:
   const std::unique_ptr<LLVMGenerator> llvm_generator_;
   const SchemaPtr schema_;
   const std::shared_ptr<Configuration> configuration_;
+
+  EvaluationCounters evaluation_counters_;
 };
 
 }  // namespace gandiva
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief filter records based on a condition, and project the matching records
+/// using expressions.
+///
+/// This is equivalent to a Filter followed by a Projector built for the selection
+/// vector, but the condition and the expressions are evaluated together in a single
+/// pass over the record batch, by one generated function.
+class GANDIVA_EXPORT FilterProjector {
+ public:
+  FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+                  const FieldVector& output_fields,
+                  std::shared_ptr<Configuration> configuration);
+
+  // Inline dtor will attempt to resolve the destructor for
+  // LLVMGenerator on MSVC, so we compile the dtor in the object code
+  ~FilterProjector();
+
+  /// Build a filter projector for the given schema, condition and expressions, with
+  /// the default configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions evaluated for the matching records.
+  /// \param[in] selection_vector_mode mode of the selection vector, can't be
+  ///            MODE_NONE.
+  /// \param[out] filter_projector the returned filter projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<FilterProjector>* filter_projector) {
+    return Make(schema, condition, exprs, selection_vector_mode,
+                ConfigurationBuilder::DefaultConfiguration(), filter_projector);
+  }
+
+  /// \brief Build a filter projector for the given schema, condition and expressions.
+  /// Customize the filter projector with runtime configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of expressions evaluated for the matching records.
+  /// \param[in] selection_vector_mode mode of the selection vector, can't be
+  ///            MODE_NONE.
+  /// \param[in] config run time configuration.
+  /// \param[out] filter_projector the returned filter projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<Configuration> config,
+                     std::shared_ptr<FilterProjector>* filter_projector);
+
+  /// Evaluate the specified record batch, populate the output selection vector and
+  /// the output arrays, which have one value per matching record.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in,out] out_selection the selection array with indices of rows that match
+  ///                the condition, with the mode specified in 'Make'.
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  std::shared_ptr<SelectionVector> out_selection,
+                  arrow::MemoryPool* pool, arrow::ArrayVector* output);
+
+ private:
+  const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  const SchemaPtr schema_;
+  const FieldVector output_fields_;
+  const std::shared_ptr<Configuration> configuration_;
+};
+
+}  // namespace gandiva
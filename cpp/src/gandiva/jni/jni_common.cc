@@ -659,14 +659,20 @@ err_out:
 ///
 /// \brief Resizable buffer which resizes by doing a callback into java.
 ///
+/// When out_addr and out_capacity are given, they are updated with the expanded
+/// buffer, so that reused output buffers keep their grown capacity.
+///
 class JavaResizableBuffer : public arrow::ResizableBuffer {
  public:
   JavaResizableBuffer(JNIEnv* env, jobject jexpander, int32_t vector_idx, uint8_t* buffer,
-                      int32_t len)
+                      int32_t len, jlong* out_addr = nullptr,
+                      jlong* out_capacity = nullptr)
       : ResizableBuffer(buffer, len),
         env_(env),
         jexpander_(jexpander),
-        vector_idx_(vector_idx) {
+        vector_idx_(vector_idx),
+        out_addr_(out_addr),
+        out_capacity_(out_capacity) {
     size_ = 0;
   }
 
@@ -680,6 +686,8 @@ class JavaResizableBuffer : public arrow::ResizableBuffer {
   JNIEnv* env_;
   jobject jexpander_;
   int32_t vector_idx_;
+  jlong* out_addr_;
+  jlong* out_capacity_;
 };
 
 Status JavaResizableBuffer::Resize(const int64_t new_size, bool shrink_to_fit) {
@@ -710,10 +718,15 @@ Status JavaResizableBuffer::Resize(const int64_t new_size, bool shrink_to_fit) {
   jlong ret_address = env_->GetLongField(ret, vector_expander_ret_address_);
   jint ret_capacity = env_->GetIntField(ret, vector_expander_ret_capacity_);
   DCHECK_GE(ret_capacity, updated_capacity);
+  env_->DeleteLocalRef(ret);
 
   data_ = mutable_data_ = reinterpret_cast<uint8_t*>(ret_address);
   size_ = new_size;
   capacity_ = ret_capacity;
+  if (out_addr_ != nullptr) {
+    *out_addr_ = ret_address;
+    *out_capacity_ = ret_capacity;
+  }
   return Status::OK();
 }
 
@@ -723,40 +736,17 @@ Status JavaResizableBuffer::Resize(const int64_t new_size, bool shrink_to_fit) {
     break;                                                                     \
   }
 
-JNIEXPORT void JNICALL
-Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
-    JNIEnv* env, jobject object, jobject jexpander, jlong module_id, jint num_rows,
-    jlongArray buf_addrs, jlongArray buf_sizes, jint sel_vec_type, jint sel_vec_rows,
-    jlong sel_vec_addr, jlong sel_vec_size, jlongArray out_buf_addrs,
-    jlongArray out_buf_sizes) {
+/// Evaluate the projector of holder into the output buffers out_bufs, which
+/// hold the validity, offsets (variable width only) and data buffers of each
+/// output column. If update_out_bufs is true, the entries of expanded
+/// variable width data buffers are updated in out_bufs and out_sizes.
+static Status EvaluateProjector(JNIEnv* env, jobject jexpander, ProjectorHolder* holder,
+                                jint num_rows, jlong* in_buf_addrs, jlong* in_buf_sizes,
+                                int in_bufs_len, jint sel_vec_type, jint sel_vec_rows,
+                                jlong sel_vec_addr, jlong sel_vec_size, jlong* out_bufs,
+                                jlong* out_sizes, int out_bufs_len,
+                                bool update_out_bufs) {
   Status status;
-  std::shared_ptr<ProjectorHolder> holder = projector_modules_.Lookup(module_id);
-  if (holder == nullptr) {
-    std::stringstream ss;
-    ss << "Unknown module id " << module_id;
-    env->ThrowNew(gandiva_exception_, ss.str().c_str());
-    return;
-  }
-
-  int in_bufs_len = env->GetArrayLength(buf_addrs);
-  if (in_bufs_len != env->GetArrayLength(buf_sizes)) {
-    env->ThrowNew(gandiva_exception_, "mismatch in arraylen of buf_addrs and buf_sizes");
-    return;
-  }
-
-  int out_bufs_len = env->GetArrayLength(out_buf_addrs);
-  if (out_bufs_len != env->GetArrayLength(out_buf_sizes)) {
-    env->ThrowNew(gandiva_exception_,
-                  "mismatch in arraylen of out_buf_addrs and out_buf_sizes");
-    return;
-  }
-
-  jlong* in_buf_addrs = env->GetLongArrayElements(buf_addrs, 0);
-  jlong* in_buf_sizes = env->GetLongArrayElements(buf_sizes, 0);
-
-  jlong* out_bufs = env->GetLongArrayElements(out_buf_addrs, 0);
-  jlong* out_sizes = env->GetLongArrayElements(out_buf_sizes, 0);
-
   do {
     std::shared_ptr<arrow::RecordBatch> in_batch;
     status = make_record_batch_with_buf_addrs(holder->schema(), num_rows, in_buf_addrs,
@@ -813,8 +803,10 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
       }
 
       CHECK_OUT_BUFFER_IDX_AND_BREAK(buf_idx, out_bufs_len);
-      uint8_t* value_buf = reinterpret_cast<uint8_t*>(out_bufs[buf_idx++]);
-      jlong data_sz = out_sizes[sz_idx++];
+      jlong* value_buf_addr = &out_bufs[buf_idx++];
+      jlong* value_buf_size = &out_sizes[sz_idx++];
+      uint8_t* value_buf = reinterpret_cast<uint8_t*>(*value_buf_addr);
+      jlong data_sz = *value_buf_size;
       if (arrow::is_binary_like(field->type()->id())) {
         if (jexpander == nullptr) {
           status = Status::Invalid(
@@ -823,7 +815,9 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
           break;
         }
         buffers.push_back(std::make_shared<JavaResizableBuffer>(
-            env, jexpander, output_vector_idx, value_buf, data_sz));
+            env, jexpander, output_vector_idx, value_buf, data_sz,
+            update_out_bufs ? value_buf_addr : nullptr,
+            update_out_bufs ? value_buf_size : nullptr));
       } else {
         buffers.push_back(std::make_shared<arrow::MutableBuffer>(value_buf, data_sz));
       }
@@ -837,6 +831,46 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
     }
     status = holder->projector()->Evaluate(*in_batch, selection_vector.get(), output);
   } while (0);
+  return status;
+}
+
+JNIEXPORT void JNICALL
+Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
+    JNIEnv* env, jobject object, jobject jexpander, jlong module_id, jint num_rows,
+    jlongArray buf_addrs, jlongArray buf_sizes, jint sel_vec_type, jint sel_vec_rows,
+    jlong sel_vec_addr, jlong sel_vec_size, jlongArray out_buf_addrs,
+    jlongArray out_buf_sizes) {
+  std::shared_ptr<ProjectorHolder> holder = projector_modules_.Lookup(module_id);
+  if (holder == nullptr) {
+    std::stringstream ss;
+    ss << "Unknown module id " << module_id;
+    env->ThrowNew(gandiva_exception_, ss.str().c_str());
+    return;
+  }
+
+  int in_bufs_len = env->GetArrayLength(buf_addrs);
+  if (in_bufs_len != env->GetArrayLength(buf_sizes)) {
+    env->ThrowNew(gandiva_exception_, "mismatch in arraylen of buf_addrs and buf_sizes");
+    return;
+  }
+
+  int out_bufs_len = env->GetArrayLength(out_buf_addrs);
+  if (out_bufs_len != env->GetArrayLength(out_buf_sizes)) {
+    env->ThrowNew(gandiva_exception_,
+                  "mismatch in arraylen of out_buf_addrs and out_buf_sizes");
+    return;
+  }
+
+  jlong* in_buf_addrs = env->GetLongArrayElements(buf_addrs, 0);
+  jlong* in_buf_sizes = env->GetLongArrayElements(buf_sizes, 0);
+
+  jlong* out_bufs = env->GetLongArrayElements(out_buf_addrs, 0);
+  jlong* out_sizes = env->GetLongArrayElements(out_buf_sizes, 0);
+
+  Status status = EvaluateProjector(
+      env, jexpander, holder.get(), num_rows, in_buf_addrs, in_buf_sizes, in_bufs_len,
+      sel_vec_type, sel_vec_rows, sel_vec_addr, sel_vec_size, out_bufs, out_sizes,
+      out_bufs_len, false /* update_out_bufs */);
 
   env->ReleaseLongArrayElements(buf_addrs, in_buf_addrs, JNI_ABORT);
   env->ReleaseLongArrayElements(buf_sizes, in_buf_sizes, JNI_ABORT);
@@ -851,6 +885,82 @@ Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjector(
   }
 }
 
+JNIEXPORT void JNICALL
+Java_org_apache_arrow_gandiva_evaluator_JniWrapper_setProjectorOutputBuffers(
+    JNIEnv* env, jobject object, jlong module_id, jlongArray out_buf_addrs,
+    jlongArray out_buf_sizes) {
+  std::shared_ptr<ProjectorHolder> holder = projector_modules_.Lookup(module_id);
+  if (holder == nullptr) {
+    std::stringstream ss;
+    ss << "Unknown module id " << module_id;
+    env->ThrowNew(gandiva_exception_, ss.str().c_str());
+    return;
+  }
+
+  int out_bufs_len = env->GetArrayLength(out_buf_addrs);
+  if (out_bufs_len != env->GetArrayLength(out_buf_sizes)) {
+    env->ThrowNew(gandiva_exception_,
+                  "mismatch in arraylen of out_buf_addrs and out_buf_sizes");
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(holder->output_buffers_mutex());
+  auto& addrs = holder->output_buffer_addrs();
+  auto& sizes = holder->output_buffer_sizes();
+  addrs.resize(out_bufs_len);
+  sizes.resize(out_bufs_len);
+  env->GetLongArrayRegion(out_buf_addrs, 0, out_bufs_len, addrs.data());
+  env->GetLongArrayRegion(out_buf_sizes, 0, out_bufs_len, sizes.data());
+}
+
+JNIEXPORT void JNICALL
+Java_org_apache_arrow_gandiva_evaluator_JniWrapper_evaluateProjectorWithOutputBuffers(
+    JNIEnv* env, jobject object, jobject jexpander, jlong module_id, jint num_rows,
+    jlongArray buf_addrs, jlongArray buf_sizes, jint sel_vec_type, jint sel_vec_rows,
+    jlong sel_vec_addr, jlong sel_vec_size) {
+  std::shared_ptr<ProjectorHolder> holder = projector_modules_.Lookup(module_id);
+  if (holder == nullptr) {
+    std::stringstream ss;
+    ss << "Unknown module id " << module_id;
+    env->ThrowNew(gandiva_exception_, ss.str().c_str());
+    return;
+  }
+
+  int in_bufs_len = env->GetArrayLength(buf_addrs);
+  if (in_bufs_len != env->GetArrayLength(buf_sizes)) {
+    env->ThrowNew(gandiva_exception_, "mismatch in arraylen of buf_addrs and buf_sizes");
+    return;
+  }
+
+  Status status;
+  {
+    std::lock_guard<std::mutex> lock(holder->output_buffers_mutex());
+    auto& out_bufs = holder->output_buffer_addrs();
+    auto& out_sizes = holder->output_buffer_sizes();
+    if (out_bufs.empty()) {
+      env->ThrowNew(gandiva_exception_, "no output buffers set for the projector");
+      return;
+    }
+
+    jlong* in_buf_addrs = env->GetLongArrayElements(buf_addrs, 0);
+    jlong* in_buf_sizes = env->GetLongArrayElements(buf_sizes, 0);
+
+    status = EvaluateProjector(env, jexpander, holder.get(), num_rows, in_buf_addrs,
+                               in_buf_sizes, in_bufs_len, sel_vec_type, sel_vec_rows,
+                               sel_vec_addr, sel_vec_size, out_bufs.data(),
+                               out_sizes.data(), static_cast<int>(out_bufs.size()),
+                               true /* update_out_bufs */);
+
+    env->ReleaseLongArrayElements(buf_addrs, in_buf_addrs, JNI_ABORT);
+    env->ReleaseLongArrayElements(buf_sizes, in_buf_sizes, JNI_ABORT);
+  }
+
+  if (!status.ok()) {
+    env->ThrowNew(gandiva_exception_, status.message().c_str());
+    return;
+  }
+}
+
 JNIEXPORT void JNICALL Java_org_apache_arrow_gandiva_evaluator_JniWrapper_closeProjector(
     JNIEnv* env, jobject cls, jlong module_id) {
   projector_modules_.Erase(module_id);
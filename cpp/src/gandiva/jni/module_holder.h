@@ -18,8 +18,12 @@
 #ifndef JNI_MODULE_HOLDER_H
 #define JNI_MODULE_HOLDER_H
 
+#include <jni.h>
+
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "gandiva/arrow.h"
 
@@ -38,10 +42,21 @@ class ProjectorHolder {
   FieldVector rettypes() { return ret_types_; }
   std::shared_ptr<Projector> projector() { return projector_; }
 
+  /// Output buffers handed over once from Java and reused by every evaluation,
+  /// laid out as the out_buf_addrs/out_buf_sizes of evaluateProjector. Guarded
+  /// by output_buffers_mutex().
+  std::vector<jlong>& output_buffer_addrs() { return output_buffer_addrs_; }
+  std::vector<jlong>& output_buffer_sizes() { return output_buffer_sizes_; }
+  std::mutex& output_buffers_mutex() { return output_buffers_mutex_; }
+
  private:
   SchemaPtr schema_;
   FieldVector ret_types_;
   std::shared_ptr<Projector> projector_;
+
+  std::mutex output_buffers_mutex_;
+  std::vector<jlong> output_buffer_addrs_;
+  std::vector<jlong> output_buffer_sizes_;
 };
 
 class FilterHolder {
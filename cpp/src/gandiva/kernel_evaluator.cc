@@ -0,0 +1,326 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/kernel_evaluator.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/visitor_inline.h"
+
+#include "gandiva/node.h"
+#include "gandiva/node_visitor.h"
+
+namespace gandiva {
+
+namespace {
+
+using arrow::compute::ArithmeticOptions;
+using arrow::compute::CompareOperator;
+using arrow::compute::Datum;
+using arrow::compute::FunctionContext;
+
+using ArithmeticFunction = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                      ArithmeticOptions, Datum*);
+
+// Gandiva's arithmetic functions wrap around on overflow, like the unchecked
+// kernels. divide isn't mapped since the kernels follow IEEE-754 for floating
+// point division by zero, where gandiva reports an error.
+const std::unordered_map<std::string, ArithmeticFunction>& ArithmeticFunctions() {
+  static const std::unordered_map<std::string, ArithmeticFunction> functions = {
+      {"add", arrow::compute::Add},
+      {"subtract", arrow::compute::Subtract},
+      {"multiply", arrow::compute::Multiply},
+  };
+  return functions;
+}
+
+const std::unordered_map<std::string, CompareOperator>& CompareFunctions() {
+  static const std::unordered_map<std::string, CompareOperator> functions = {
+      {"equal", CompareOperator::EQUAL},
+      {"not_equal", CompareOperator::NOT_EQUAL},
+      {"less_than", CompareOperator::LESS},
+      {"less_than_or_equal_to", CompareOperator::LESS_EQUAL},
+      {"greater_than", CompareOperator::GREATER},
+      {"greater_than_or_equal_to", CompareOperator::GREATER_EQUAL},
+  };
+  return functions;
+}
+
+bool IsSupportedType(const arrow::DataType& type) {
+  return arrow::is_integer(type.id()) || type.id() == arrow::Type::FLOAT ||
+         type.id() == arrow::Type::DOUBLE || type.id() == arrow::Type::BOOL;
+}
+
+/// \brief Checks that the kernels can evaluate an expression tree.
+///
+/// Each node must depend on at least one field, since the kernels don't
+/// operate on scalars alone.
+class SupportChecker : public NodeVisitor {
+ public:
+  Status Check(const Node& node) {
+    ARROW_RETURN_NOT_OK(node.Accept(*this));
+    ARROW_RETURN_IF(is_constant_,
+                    Status::NotImplemented("Constant expression ", node.ToString()));
+    return Status::OK();
+  }
+
+ private:
+  Status Visit(const FieldNode& node) override {
+    ARROW_RETURN_NOT_OK(CheckType(node));
+    is_constant_ = false;
+    return Status::OK();
+  }
+
+  Status Visit(const LiteralNode& node) override {
+    ARROW_RETURN_NOT_OK(CheckType(node));
+    is_constant_ = true;
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    const auto& name = node.descriptor()->name();
+    if (name == "not") {
+      ARROW_RETURN_IF(node.children().size() != 1, Unsupported(node));
+      return Check(*node.children()[0]);
+    }
+
+    ARROW_RETURN_IF(ArithmeticFunctions().count(name) == 0 &&
+                        CompareFunctions().count(name) == 0,
+                    Unsupported(node));
+    ARROW_RETURN_IF(node.children().size() != 2, Unsupported(node));
+    const auto& left = *node.children()[0];
+    const auto& right = *node.children()[1];
+    ARROW_RETURN_IF(!left.return_type()->Equals(*right.return_type()),
+                    Unsupported(node));
+
+    ARROW_RETURN_NOT_OK(left.Accept(*this));
+    bool left_is_constant = is_constant_;
+    ARROW_RETURN_NOT_OK(right.Accept(*this));
+    is_constant_ = left_is_constant && is_constant_;
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanNode& node) override {
+    for (auto& child : node.children()) {
+      ARROW_RETURN_NOT_OK(Check(*child));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override { return Unsupported(node); }
+
+  Status Visit(const InExpressionNode<int32_t>& node) override {
+    return Unsupported(node);
+  }
+
+  Status Visit(const InExpressionNode<int64_t>& node) override {
+    return Unsupported(node);
+  }
+
+  Status Visit(const InExpressionNode<std::string>& node) override {
+    return Unsupported(node);
+  }
+
+  Status CheckType(const Node& node) {
+    ARROW_RETURN_IF(!IsSupportedType(*node.return_type()), Unsupported(node));
+    return Status::OK();
+  }
+
+  Status Unsupported(const Node& node) {
+    return Status::NotImplemented("No kernel for ", node.ToString());
+  }
+
+  // Whether the value of the last visited node is the same for all rows.
+  bool is_constant_ = false;
+};
+
+struct LiteralToScalar {
+  template <typename Value>
+  Status operator()(const Value& value) {
+    return arrow::MakeScalar(type, value).Value(out);
+  }
+
+  const DataTypePtr& type;
+  std::shared_ptr<arrow::Scalar>* out;
+};
+
+/// \brief Evaluates an expression tree checked by SupportChecker.
+class KernelVisitor : public NodeVisitor {
+ public:
+  KernelVisitor(const arrow::RecordBatch& batch, FunctionContext* ctx)
+      : batch_(batch), ctx_(ctx) {}
+
+  Status Evaluate(const Node& node, Datum* out) {
+    ARROW_RETURN_NOT_OK(node.Accept(*this));
+    *out = std::move(result_);
+    return Status::OK();
+  }
+
+ private:
+  Status Visit(const FieldNode& node) override {
+    int index = batch_.schema()->GetFieldIndex(node.field()->name());
+    ARROW_RETURN_IF(index < 0, Status::Invalid("Field ", node.field()->name(),
+                                               " not in the record batch"));
+    result_ = batch_.column_data(index);
+    return Status::OK();
+  }
+
+  Status Visit(const LiteralNode& node) override {
+    if (node.is_null()) {
+      result_ = arrow::MakeNullScalar(node.return_type());
+      return Status::OK();
+    }
+    std::shared_ptr<arrow::Scalar> scalar;
+    LiteralToScalar visitor{node.return_type(), &scalar};
+    ARROW_RETURN_NOT_OK(arrow::util::visit(visitor, node.holder()));
+    result_ = scalar;
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    const auto& name = node.descriptor()->name();
+    if (name == "not") {
+      Datum value;
+      ARROW_RETURN_NOT_OK(Evaluate(*node.children()[0], &value));
+      return arrow::compute::Invert(ctx_, value, &result_);
+    }
+
+    Datum left, right;
+    ARROW_RETURN_NOT_OK(Evaluate(*node.children()[0], &left));
+    ARROW_RETURN_NOT_OK(Evaluate(*node.children()[1], &right));
+    auto arithmetic = ArithmeticFunctions().find(name);
+    if (arithmetic != ArithmeticFunctions().end()) {
+      return arithmetic->second(ctx_, left, right, ArithmeticOptions(), &result_);
+    }
+    arrow::compute::CompareOptions options(CompareFunctions().at(name));
+    return arrow::compute::Compare(ctx_, left, right, options, &result_);
+  }
+
+  Status Visit(const BooleanNode& node) override {
+    Datum result;
+    ARROW_RETURN_NOT_OK(Evaluate(*node.children()[0], &result));
+    for (size_t i = 1; i < node.children().size(); ++i) {
+      Datum child, combined;
+      ARROW_RETURN_NOT_OK(Evaluate(*node.children()[i], &child));
+      // gandiva's and/or follow the Kleene truth table, like these kernels.
+      if (node.expr_type() == BooleanNode::AND) {
+        ARROW_RETURN_NOT_OK(arrow::compute::KleeneAnd(ctx_, result, child, &combined));
+      } else {
+        ARROW_RETURN_NOT_OK(arrow::compute::KleeneOr(ctx_, result, child, &combined));
+      }
+      result = std::move(combined);
+    }
+    result_ = std::move(result);
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override { return Unreachable(node); }
+
+  Status Visit(const InExpressionNode<int32_t>& node) override {
+    return Unreachable(node);
+  }
+
+  Status Visit(const InExpressionNode<int64_t>& node) override {
+    return Unreachable(node);
+  }
+
+  Status Visit(const InExpressionNode<std::string>& node) override {
+    return Unreachable(node);
+  }
+
+  Status Unreachable(const Node& node) {
+    return Status::NotImplemented("No kernel for ", node.ToString());
+  }
+
+  const arrow::RecordBatch& batch_;
+  FunctionContext* ctx_;
+  Datum result_;
+};
+
+// Copy the validity and values of 'result' into the buffers of 'output'.
+void CopyResult(const arrow::ArrayData& result, arrow::ArrayData* output) {
+  int64_t length = result.length;
+  uint8_t* validity = output->buffers[0]->mutable_data();
+  if (result.buffers[0] == nullptr) {
+    arrow::BitUtil::SetBitsTo(validity, 0, length, true);
+  } else {
+    arrow::internal::CopyBitmap(result.buffers[0]->data(), result.offset, length,
+                                validity, 0);
+  }
+
+  uint8_t* values = output->buffers[1]->mutable_data();
+  if (result.type->id() == arrow::Type::BOOL) {
+    arrow::internal::CopyBitmap(result.buffers[1]->data(), result.offset, length,
+                                values, 0);
+  } else {
+    const auto& fw_type = static_cast<const arrow::FixedWidthType&>(*result.type);
+    int64_t byte_width = fw_type.bit_width() / 8;
+    memcpy(values, result.buffers[1]->data() + result.offset * byte_width,
+           length * byte_width);
+  }
+}
+
+}  // namespace
+
+Status KernelEvaluator::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                             std::unique_ptr<KernelEvaluator>* evaluator) {
+  SupportChecker checker;
+  for (auto& expr : exprs) {
+    ARROW_RETURN_IF(!IsSupportedType(*expr->result()->type()),
+                    Status::NotImplemented("No kernel for output type ",
+                                           expr->result()->type()->ToString()));
+    ARROW_RETURN_NOT_OK(checker.Check(*expr->root()));
+  }
+  evaluator->reset(new KernelEvaluator(schema, exprs));
+  return Status::OK();
+}
+
+Status KernelEvaluator::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                                 arrow::ArrayVector* output) const {
+  FunctionContext ctx(pool);
+  KernelVisitor visitor(batch, &ctx);
+  arrow::ArrayVector arrays;
+  for (auto& expr : exprs_) {
+    Datum result;
+    ARROW_RETURN_NOT_OK(visitor.Evaluate(*expr->root(), &result));
+    arrays.push_back(result.make_array());
+  }
+  *output = std::move(arrays);
+  return Status::OK();
+}
+
+Status KernelEvaluator::Evaluate(const arrow::RecordBatch& batch,
+                                 const ArrayDataVector& output) const {
+  FunctionContext ctx(arrow::default_memory_pool());
+  KernelVisitor visitor(batch, &ctx);
+  for (size_t i = 0; i < exprs_.size(); ++i) {
+    Datum result;
+    ARROW_RETURN_NOT_OK(visitor.Evaluate(*exprs_[i]->root(), &result));
+    CopyResult(*result.array(), output[i].get());
+  }
+  return Status::OK();
+}
+
+}  // namespace gandiva
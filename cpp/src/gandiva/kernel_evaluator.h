@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_KERNEL_EVALUATOR_H
+#define GANDIVA_KERNEL_EVALUATOR_H
+
+#include <memory>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/expression.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Evaluates expressions with the Arrow compute kernels.
+///
+/// A projector built with background compilation uses this until the LLVM code
+/// for its expressions is ready, so the first batches don't wait for the
+/// compilation. Only a subset of the expressions is supported: numeric and
+/// boolean fields and literals, the add, subtract and multiply functions, the
+/// comparison functions, not, and the and/or boolean nodes. For these the
+/// results are the same as those of the generated code.
+class GANDIVA_EXPORT KernelEvaluator {
+ public:
+  /// Build an evaluator for the expressions. Returns NotImplemented if any of
+  /// them can't be evaluated with the kernels.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of validated expressions.
+  /// \param[out] evaluator the returned evaluator
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     std::unique_ptr<KernelEvaluator>* evaluator);
+
+  /// Evaluate the expressions on the batch, allocating the output arrays from
+  /// 'pool'.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output) const;
+
+  /// Evaluate the expressions on the batch, and copy the results into arrays
+  /// allocated by the caller.
+  Status Evaluate(const arrow::RecordBatch& batch, const ArrayDataVector& output) const;
+
+ private:
+  KernelEvaluator(SchemaPtr schema, const ExpressionVector& exprs)
+      : schema_(schema), exprs_(exprs) {}
+
+  const SchemaPtr schema_;
+  const ExpressionVector exprs_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_KERNEL_EVALUATOR_H
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/kernel_evaluator.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+
+class TestKernelEvaluator : public ::testing::Test {
+ public:
+  void SetUp() { pool_ = arrow::default_memory_pool(); }
+
+ protected:
+  arrow::MemoryPool* pool_;
+};
+
+TEST_F(TestKernelEvaluator, TestUnsupported) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto node1 = TreeExprBuilder::MakeField(field1);
+  std::unique_ptr<KernelEvaluator> evaluator;
+
+  // if-else
+  auto less_than = TreeExprBuilder::MakeFunction("less_than", {node0, node1}, boolean());
+  auto if_node = TreeExprBuilder::MakeIf(less_than, node0, node1, int32());
+  auto if_expr = TreeExprBuilder::MakeExpression(if_node, field("if", int32()));
+  auto status = KernelEvaluator::Make(schema, {if_expr}, &evaluator);
+  EXPECT_TRUE(status.IsNotImplemented()) << status.ToString();
+
+  // divide reports division by zero differently
+  auto divide_expr =
+      TreeExprBuilder::MakeExpression("divide", {field0, field1}, field("div", int32()));
+  status = KernelEvaluator::Make(schema, {divide_expr}, &evaluator);
+  EXPECT_TRUE(status.IsNotImplemented()) << status.ToString();
+
+  // constants
+  auto literal = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(1));
+  auto sum = TreeExprBuilder::MakeFunction("add", {literal, literal}, int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression(sum, field("sum", int32()));
+  status = KernelEvaluator::Make(schema, {sum_expr}, &evaluator);
+  EXPECT_TRUE(status.IsNotImplemented()) << status.ToString();
+}
+
+TEST_F(TestKernelEvaluator, TestEvaluate) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto node1 = TreeExprBuilder::MakeField(field1);
+
+  // f0 * 2 - f1
+  auto literal = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(2));
+  auto product = TreeExprBuilder::MakeFunction("multiply", {node0, literal}, int32());
+  auto difference = TreeExprBuilder::MakeFunction("subtract", {product, node1}, int32());
+  auto difference_expr =
+      TreeExprBuilder::MakeExpression(difference, field("difference", int32()));
+
+  // f0 > 2 or not (f1 == 11)
+  auto greater =
+      TreeExprBuilder::MakeFunction("greater_than", {node0, literal}, boolean());
+  auto equal = TreeExprBuilder::MakeFunction(
+      "equal", {node1, TreeExprBuilder::MakeLiteral(static_cast<int32_t>(11))},
+      boolean());
+  auto not_equal = TreeExprBuilder::MakeFunction("not", {equal}, boolean());
+  auto or_node = TreeExprBuilder::MakeOr({greater, not_equal});
+  auto or_expr = TreeExprBuilder::MakeExpression(or_node, field("or", boolean()));
+
+  std::unique_ptr<KernelEvaluator> evaluator;
+  ASSERT_OK(KernelEvaluator::Make(schema, {difference_expr, or_expr}, &evaluator));
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 11, 11}, {true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  auto exp_difference = MakeArrowArrayInt32({-9, -9, 0, 0}, {true, true, false, false});
+  // or follows the Kleene logic: true or null is true, false or null is null.
+  auto exp_or =
+      MakeArrowArrayBool({false, true, true, false}, {true, true, true, false});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(evaluator->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_difference, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_or, outputs.at(1));
+
+  // evaluate into preallocated arrays
+  ArrayDataVector output_data;
+  for (auto& output : outputs) {
+    std::shared_ptr<arrow::Buffer> validity, values;
+    ASSERT_OK(arrow::AllocateBuffer(pool_, 8, &validity));
+    ASSERT_OK(arrow::AllocateBuffer(pool_, 16, &values));
+    output_data.push_back(
+        arrow::ArrayData::Make(output->type(), num_records, {validity, values}));
+  }
+  ASSERT_OK(evaluator->Evaluate(*in_batch, output_data));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_difference, arrow::MakeArray(output_data.at(0)));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_or, arrow::MakeArray(output_data.at(1)));
+}
+
+}  // namespace gandiva
@@ -17,6 +17,7 @@
 
 #include "gandiva/like_holder.h"
 
+#include <cstring>
 #include <regex>
 #include "gandiva/node.h"
 #include "gandiva/regex_util.h"
@@ -81,7 +82,10 @@ Status LikeHolder::Make(const std::string& sql_pattern,
   std::string pcre_pattern;
   ARROW_RETURN_NOT_OK(RegexUtil::SqlLikePatternToPcre(sql_pattern, pcre_pattern));
 
-  auto lholder = std::shared_ptr<LikeHolder>(new LikeHolder(pcre_pattern));
+  std::string literal;
+  auto match_kind = GetMatchKind(sql_pattern, &literal);
+  auto lholder = std::shared_ptr<LikeHolder>(
+      new LikeHolder(pcre_pattern, match_kind, std::move(literal)));
   ARROW_RETURN_IF(!lholder->regex_.ok(),
                   Status::Invalid("Building RE2 pattern '", pcre_pattern, "' failed"));
 
@@ -89,4 +93,64 @@ Status LikeHolder::Make(const std::string& sql_pattern,
   return Status::OK();
 }
 
+LikeHolder::MatchKind LikeHolder::GetMatchKind(const std::string& sql_pattern,
+                                               std::string* literal) {
+  auto begin = sql_pattern.find_first_not_of('%');
+  if (begin == std::string::npos) {
+    // only '%', matches everything.
+    literal->clear();
+    return MatchKind::kContains;
+  }
+  auto end = sql_pattern.find_last_not_of('%') + 1;
+  *literal = sql_pattern.substr(begin, end - begin);
+  if (literal->find_first_of("%_") != std::string::npos) {
+    return MatchKind::kRegex;
+  }
+
+  bool any_prefix = begin > 0;
+  bool any_suffix = end < sql_pattern.size();
+  if (any_prefix && any_suffix) {
+    return MatchKind::kContains;
+  } else if (any_prefix) {
+    return MatchKind::kEndsWith;
+  } else if (any_suffix) {
+    return MatchKind::kStartsWith;
+  }
+  return MatchKind::kEquals;
+}
+
+bool LikeHolder::operator()(const char* data, int64_t data_len) {
+  auto literal = literal_.data();
+  auto literal_len = static_cast<int64_t>(literal_.size());
+  switch (match_kind_) {
+    case MatchKind::kEquals:
+      return data_len == literal_len && memcmp(data, literal, literal_len) == 0;
+    case MatchKind::kStartsWith:
+      return data_len >= literal_len && memcmp(data, literal, literal_len) == 0;
+    case MatchKind::kEndsWith:
+      return data_len >= literal_len &&
+             memcmp(data + data_len - literal_len, literal, literal_len) == 0;
+    case MatchKind::kContains: {
+      if (literal_len == 0) {
+        return true;
+      }
+      // look for the first byte with memchr, and compare the rest at each candidate.
+      const char* last = data + data_len - literal_len;
+      for (const char* pos = data; pos <= last; ++pos) {
+        pos = static_cast<const char*>(memchr(pos, literal[0], last - pos + 1));
+        if (pos == nullptr) {
+          return false;
+        }
+        if (memcmp(pos + 1, literal + 1, literal_len - 1) == 0) {
+          return true;
+        }
+      }
+      return false;
+    }
+    case MatchKind::kRegex:
+      break;
+  }
+  return RE2::FullMatch(re2::StringPiece(data, data_len), regex_);
+}
+
 }  // namespace gandiva
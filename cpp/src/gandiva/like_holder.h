@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <re2/re2.h>
 
@@ -44,13 +45,31 @@ class GANDIVA_EXPORT LikeHolder : public FunctionHolder {
   static const FunctionNode TryOptimize(const FunctionNode& node);
 
   /// Return true if the data matches the pattern.
-  bool operator()(const std::string& data) { return RE2::FullMatch(data, regex_); }
+  bool operator()(const std::string& data) {
+    return (*this)(data.data(), static_cast<int64_t>(data.size()));
+  }
+
+  /// Return true if the data matches the pattern.
+  bool operator()(const char* data, int64_t data_len);
 
  private:
-  explicit LikeHolder(const std::string& pattern) : pattern_(pattern), regex_(pattern) {}
+  /// How a pattern is matched. Patterns without '_', and with '%' only at their ends,
+  /// are compared with memcmp instead of the regex.
+  enum class MatchKind { kRegex, kEquals, kStartsWith, kEndsWith, kContains };
+
+  LikeHolder(const std::string& pattern, MatchKind match_kind, std::string literal)
+      : pattern_(pattern),
+        regex_(pattern),
+        match_kind_(match_kind),
+        literal_(std::move(literal)) {}
+
+  /// Find how the sql pattern can be matched, and its literal part.
+  static MatchKind GetMatchKind(const std::string& sql_pattern, std::string* literal);
 
   std::string pattern_;  // posix pattern string, to help debugging
   RE2 regex_;            // compiled regex for the pattern
+  MatchKind match_kind_;
+  std::string literal_;  // the pattern without its leading and trailing '%'
 
   static RE2 starts_with_regex_;  // pre-compiled pattern for matching starts_with
   static RE2 ends_with_regex_;    // pre-compiled pattern for matching ends_with
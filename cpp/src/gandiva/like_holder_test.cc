@@ -94,6 +94,43 @@ TEST_F(TestLikeHolder, TestDot) {
   EXPECT_FALSE(like("abcd"));
 }
 
+TEST_F(TestLikeHolder, TestLiteralPatterns) {
+  std::shared_ptr<LikeHolder> like_holder;
+
+  // patterns with '%' only at the ends are matched without the regex.
+  ASSERT_TRUE(LikeHolder::Make("a.b", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("a.b"));
+  EXPECT_FALSE((*like_holder)("axb"));
+  EXPECT_FALSE((*like_holder)("a.bc"));
+
+  ASSERT_TRUE(LikeHolder::Make("a-b%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("a-b"));
+  EXPECT_TRUE((*like_holder)("a-bcd"));
+  EXPECT_FALSE((*like_holder)("a-"));
+  EXPECT_FALSE((*like_holder)("ca-b"));
+
+  ASSERT_TRUE(LikeHolder::Make("%%a-b", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("cda-b"));
+  EXPECT_FALSE((*like_holder)("a-bc"));
+
+  ASSERT_TRUE(LikeHolder::Make("%aab%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("aab"));
+  EXPECT_TRUE((*like_holder)("abaaab"));
+  EXPECT_TRUE((*like_holder)("xyz\naabc"));
+  EXPECT_FALSE((*like_holder)("ababa"));
+  EXPECT_FALSE((*like_holder)("aa"));
+  EXPECT_FALSE((*like_holder)(""));
+
+  ASSERT_TRUE(LikeHolder::Make("%", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)(""));
+  EXPECT_TRUE((*like_holder)("abc"));
+
+  // '%' inside the pattern still uses the regex.
+  ASSERT_TRUE(LikeHolder::Make("a%b", &like_holder).ok());
+  EXPECT_TRUE((*like_holder)("axyzb"));
+  EXPECT_FALSE((*like_holder)("axyz"));
+}
+
 TEST_F(TestLikeHolder, TestOptimise) {
   // optimise for 'starts_with'
   auto fnode = LikeHolder::TryOptimize(BuildLike("xy 123z%"));
@@ -17,6 +17,7 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -25,6 +26,7 @@
 #include <vector>
 
 #include "gandiva/bitmap_accumulator.h"
+#include "gandiva/condition.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
@@ -53,40 +55,101 @@ Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
 }
 
 Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
-  int idx = static_cast<int>(compiled_exprs_.size());
-  // decompose the expression to separate out value and validities.
-  ExprDecomposer decomposer(function_registry_, annotator_);
+  // decompose the expression to separate out value and validities. The identical
+  // sub-trees of the expressions share their decomposition.
+  ExprDecomposer decomposer(function_registry_, annotator_, &shared_sub_exprs_);
   ValueValidityPairPtr value_validity;
   ARROW_RETURN_NOT_OK(decomposer.Decompose(*expr->root(), &value_validity));
-  // Generate the IR function for the decomposed expression.
-  std::unique_ptr<CompiledExpr> compiled_expr(new CompiledExpr(value_validity, output));
-  llvm::Function* ir_function = nullptr;
-  ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
-                                       annotator_.buffer_count(), output, idx,
-                                       &ir_function, selection_vector_mode_));
-  compiled_expr->SetIRFunction(selection_vector_mode_, ir_function);
+  has_shared_sub_exprs_ = has_shared_sub_exprs_ || decomposer.num_shared_sub_exprs() > 0;
 
-  compiled_exprs_.push_back(std::move(compiled_expr));
+  compiled_exprs_.emplace_back(new CompiledExpr(value_validity, output));
   return Status::OK();
 }
 
 /// Build and optimise module for projection expression.
+static int64_t NanosSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
 Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode mode) {
+  auto start = std::chrono::steady_clock::now();
   selection_vector_mode_ = mode;
   for (auto& expr : exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
     ARROW_RETURN_NOT_OK(Add(expr, output));
   }
+
+  // Generate the IR functions for the decomposed expressions.
+  if (has_shared_sub_exprs_ && compiled_exprs_.size() > 1) {
+    // Evaluate all the expressions in one loop, so that the shared sub-expressions are
+    // computed once per record. The function is attached to the first expression.
+    DexVector value_exprs;
+    std::vector<FieldDescriptorPtr> outputs;
+    for (auto& compiled_expr : compiled_exprs_) {
+      value_exprs.push_back(compiled_expr->value_validity()->value_expr());
+      outputs.push_back(compiled_expr->output());
+    }
+    llvm::Function* ir_function = nullptr;
+    ARROW_RETURN_NOT_OK(CodeGenExprValues(value_exprs, annotator_.buffer_count(),
+                                          outputs, "exprs", &ir_function, mode));
+    compiled_exprs_.front()->SetIRFunction(mode, ir_function);
+  } else {
+    for (size_t idx = 0; idx < compiled_exprs_.size(); ++idx) {
+      auto& compiled_expr = compiled_exprs_[idx];
+      llvm::Function* ir_function = nullptr;
+      ARROW_RETURN_NOT_OK(CodeGenExprValue(
+          compiled_expr->value_validity()->value_expr(), annotator_.buffer_count(),
+          compiled_expr->output(), static_cast<int>(idx), &ir_function, mode));
+      compiled_expr->SetIRFunction(mode, ir_function);
+    }
+  }
+
   // optimise, compile and finalize the module
   ARROW_RETURN_NOT_OK(engine_->FinalizeModule(optimise_ir_, dump_ir_));
 
   // setup the jit functions for each expression.
   for (auto& compiled_expr : compiled_exprs_) {
     auto ir_function = compiled_expr->GetIRFunction(mode);
+    if (ir_function == nullptr) {
+      continue;
+    }
     auto jit_function =
         reinterpret_cast<EvalFunc>(engine_->CompiledFunction(ir_function));
     compiled_expr->SetJITFunction(selection_vector_mode_, jit_function);
   }
+  build_time_ns_ = NanosSince(start);
+  return Status::OK();
+}
+
+/// Build and optimise module for the fused filter and projection.
+Status LLVMGenerator::BuildFilterProject(const ConditionPtr& condition,
+                                         const ExpressionVector& exprs,
+                                         SelectionVector::Mode mode) {
+  auto start = std::chrono::steady_clock::now();
+  selection_vector_mode_ = mode;
+  // All the trees share the annotator, so that each input column is read through the
+  // same buffers, and the decomposition of their identical sub-trees.
+  ExprDecomposer condition_decomposer(function_registry_, annotator_,
+                                      &shared_sub_exprs_);
+  ValueValidityPairPtr condition_value_validity;
+  ARROW_RETURN_NOT_OK(
+      condition_decomposer.Decompose(*condition->root(), &condition_value_validity));
+  for (auto& expr : exprs) {
+    auto output = annotator_.AddOutputFieldDescriptor(expr->result());
+    ARROW_RETURN_NOT_OK(Add(expr, output));
+  }
+
+  llvm::Function* ir_function = nullptr;
+  ARROW_RETURN_NOT_OK(CodeGenFilterProject(*condition_value_validity,
+                                           annotator_.buffer_count(), &ir_function));
+
+  // optimise, compile and finalize the module
+  ARROW_RETURN_NOT_OK(engine_->FinalizeModule(optimise_ir_, dump_ir_));
+  filter_project_function_ =
+      reinterpret_cast<FilterProjectFunc>(engine_->CompiledFunction(ir_function));
+  build_time_ns_ = NanosSince(start);
   return Status::OK();
 }
 
@@ -124,15 +187,18 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
       num_output_rows = selection_vector->GetNumSlots();
     }
 
+    // The expressions evaluated in a single loop share one function.
     EvalFunc jit_function = compiled_expr->GetJITFunction(mode);
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
-                 eval_batch->GetLocalBitMapArray(), selection_buffer,
-                 (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
-
-    // check for execution errors
-    ARROW_RETURN_IF(
-        eval_batch->GetExecutionContext()->has_error(),
-        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+    if (jit_function != nullptr) {
+      jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
+                   eval_batch->GetLocalBitMapArray(), selection_buffer,
+                   (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
+
+      // check for execution errors
+      ARROW_RETURN_IF(
+          eval_batch->GetExecutionContext()->has_error(),
+          Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+    }
 
     // generate validity vectors.
     ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
@@ -141,6 +207,39 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
   return Status::OK();
 }
 
+/// Execute the fused filter and projection against the provided vectors.
+Status LLVMGenerator::ExecuteFilterProject(const arrow::RecordBatch& record_batch,
+                                           SelectionVector* selection_vector,
+                                           const ArrayDataVector& output_vector) {
+  DCHECK_GT(record_batch.num_rows(), 0);
+  DCHECK_NE(filter_project_function_, nullptr);
+  if (selection_vector->GetMode() != selection_vector_mode_) {
+    return Status::Invalid("llvm expression built for selection vector mode ",
+                           selection_vector_mode_, " received vector with mode ",
+                           selection_vector->GetMode());
+  }
+
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
+  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
+
+  int64_t num_selected = filter_project_function_(
+      eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
+      eval_batch->GetLocalBitMapArray(), selection_vector->GetBuffer().mutable_data(),
+      (int64_t)eval_batch->GetExecutionContext(), record_batch.num_rows());
+
+  // check for execution errors
+  ARROW_RETURN_IF(
+      eval_batch->GetExecutionContext()->has_error(),
+      Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+  selection_vector->SetNumSlots(num_selected);
+
+  // generate validity vectors.
+  for (auto& compiled_expr : compiled_exprs_) {
+    ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
+  }
+  return Status::OK();
+}
+
 llvm::Value* LLVMGenerator::LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
                                               const std::string& name) {
   llvm::IRBuilder<>* builder = ir_builder();
@@ -249,6 +348,16 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
                                        FieldDescriptorPtr output, int suffix_idx,
                                        llvm::Function** fn,
                                        SelectionVector::Mode selection_vector_mode) {
+  return CodeGenExprValues({value_expr}, buffer_count, {output},
+                           "expr_" + std::to_string(suffix_idx), fn,
+                           selection_vector_mode);
+}
+
+Status LLVMGenerator::CodeGenExprValues(const DexVector& value_exprs, int buffer_count,
+                                        const std::vector<FieldDescriptorPtr>& outputs,
+                                        const std::string& func_name_prefix,
+                                        llvm::Function** fn,
+                                        SelectionVector::Mode selection_vector_mode) {
   llvm::IRBuilder<>* builder = ir_builder();
   // Create fn prototype :
   //   int expr_1 (long **addrs, long *offsets, long **bitmaps,
@@ -274,8 +383,8 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
       llvm::FunctionType::get(types()->i32_type(), arguments, false /*isVarArg*/);
 
   // Create fn
-  std::string func_name = "expr_" + std::to_string(suffix_idx) + "_" +
-                          std::to_string(static_cast<int>(selection_vector_mode));
+  std::string func_name =
+      func_name_prefix + "_" + std::to_string(static_cast<int>(selection_vector_mode));
   engine_->AddFunctionToCompile(func_name);
   *fn = llvm::Function::Create(prototype, llvm::GlobalValue::ExternalLinkage, func_name,
                                module());
@@ -305,14 +414,12 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   llvm::BasicBlock* loop_body = llvm::BasicBlock::Create(*context(), "loop", *fn);
   llvm::BasicBlock* loop_exit = llvm::BasicBlock::Create(*context(), "exit", *fn);
 
-  // Add reference to output vector (in entry block)
+  // Add references to the output vectors (in entry block)
   builder->SetInsertPoint(loop_entry);
-  llvm::Value* output_ref =
-      GetDataReference(arg_addrs, output->data_idx(), output->field());
-  llvm::Value* output_buffer_ptr_ref = GetDataBufferPtrReference(
-      arg_addrs, output->data_buffer_ptr_idx(), output->field());
-  llvm::Value* output_offset_ref =
-      GetOffsetsReference(arg_addrs, output->offsets_idx(), output->field());
+  std::vector<OutputReferences> output_refs;
+  for (auto& output : outputs) {
+    output_refs.push_back(GetOutputReferences(arg_addrs, output));
+  }
 
   std::vector<llvm::Value*> slice_offsets;
   for (int idx = 0; idx < buffer_count; idx++) {
@@ -335,11 +442,19 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
         types()->i64_type(), true, "position_var");
   }
 
-  // The visitor can add code to both the entry/loop blocks.
+  // The visitor can add code to both the entry/loop blocks. A single visitor is used
+  // for all the expressions, so that they reuse the values of their shared
+  // sub-expressions.
   Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, slice_offsets,
                   arg_context_ptr, position_var);
-  value_expr->Accept(visitor);
-  LValuePtr output_value = visitor.result();
+  for (size_t i = 0; i < value_exprs.size(); ++i) {
+    value_exprs[i]->Accept(visitor);
+    LValuePtr output_value = visitor.result();
+
+    // save the value in the output vector.
+    ARROW_RETURN_NOT_OK(CodeGenStoreOutput(outputs[i], output_refs[i], arg_context_ptr,
+                                           loop_var, output_value));
+  }
 
   // The "current" block may have changed due to code generation in the visitor.
   llvm::BasicBlock* loop_body_tail = builder->GetInsertBlock();
@@ -347,33 +462,11 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   // add jump to "loop block" at the end of the "setup block".
   builder->SetInsertPoint(loop_entry);
   builder->CreateBr(loop_body);
-
-  // save the value in the output vector.
   builder->SetInsertPoint(loop_body_tail);
 
-  auto output_type_id = output->Type()->id();
-  if (output_type_id == arrow::Type::BOOL) {
-    SetPackedBitValue(output_ref, loop_var, output_value->data());
-  } else if (arrow::is_primitive(output_type_id) ||
-             output_type_id == arrow::Type::DECIMAL) {
-    llvm::Value* slot_offset = builder->CreateGEP(output_ref, loop_var);
-    builder->CreateStore(output_value->data(), slot_offset);
-  } else if (arrow::is_binary_like(output_type_id)) {
-    // Var-len output. Make a function call to populate the data.
-    // if there is an error, the fn sets it in the context. And, will be returned at the
-    // end of this row batch.
-    AddFunctionCall("gdv_fn_populate_varlen_vector", types()->i32_type(),
-                    {arg_context_ptr, output_buffer_ptr_ref, output_offset_ref, loop_var,
-                     output_value->data(), output_value->length()});
-  } else {
-    return Status::NotImplemented("output type ", output->Type()->ToString(),
-                                  " not supported");
-  }
-  ADD_TRACE("saving result " + output->Name() + " value %T", output_value->data());
-
   if (visitor.has_arena_allocs()) {
-    // Reset allocations to avoid excessive memory usage. Once the result is copied to
-    // the output vector (store instruction above), any memory allocations in this
+    // Reset allocations to avoid excessive memory usage. Once the results are copied to
+    // the output vectors (store instructions above), any memory allocations in this
     // iteration of the loop are no longer needed.
     std::vector<llvm::Value*> reset_args;
     reset_args.push_back(arg_context_ptr);
@@ -396,6 +489,229 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   return Status::OK();
 }
 
+/// \brief Generate code for the fused filter and projection.
+
+// The C-code equivalent for the condition "c0 > 0" and the expression "c0 + c1" is :
+// ------------------------------
+// int64_t filter_project_1(int64_t *addrs, int64_t *offsets, int64_t *local_bitmaps,
+//                          uint16_t *selection_vector, int64_t execution_context_ptr,
+//                          int64_t nrecords) {
+//   int *outVec = (int *) addrs[5];
+//   int *c0Vec = (int *) addrs[1];
+//   int *c1Vec = (int *) addrs[3];
+//   int64_t num_selected = 0;
+//   for (int loop_var = 0; loop_var < nrecords; ++loop_var) {
+//     int c0 = c0Vec[loop_var];
+//     if (c0 > 0) {
+//       selection_vector[num_selected] = loop_var;
+//       int c1 = c1Vec[loop_var];
+//       outVec[num_selected] = c0 + c1;
+//       ++num_selected;
+//     }
+//   }
+//   return num_selected;
+// }
+//
+// Since the condition and the expressions are in the same loop, a column or a
+// sub-expression used by several of them is only loaded or computed once per record.
+Status LLVMGenerator::CodeGenFilterProject(const ValueValidityPair& condition,
+                                           int buffer_count, llvm::Function** fn) {
+  llvm::IRBuilder<>* builder = ir_builder();
+  llvm::Type* selection_type = nullptr;
+  switch (selection_vector_mode_) {
+    case SelectionVector::MODE_UINT16:
+      selection_type = types()->i16_type();
+      break;
+    case SelectionVector::MODE_UINT32:
+      selection_type = types()->i32_type();
+      break;
+    case SelectionVector::MODE_UINT64:
+      selection_type = types()->i64_type();
+      break;
+    default:
+      return Status::Invalid("Filter and project requires a selection vector, mode ",
+                             static_cast<int>(selection_vector_mode_),
+                             " is not supported");
+  }
+
+  // Create fn prototype :
+  //   long filter_project_1 (long **addrs, long *offsets, long **bitmaps,
+  //                          short *selection_vector, long *context_ptr, long nrec)
+  std::vector<llvm::Type*> arguments;
+  arguments.push_back(types()->i64_ptr_type());            // addrs
+  arguments.push_back(types()->i64_ptr_type());            // offsets
+  arguments.push_back(types()->i64_ptr_type());            // bitmaps
+  arguments.push_back(types()->ptr_type(selection_type));  // selection_vector
+  arguments.push_back(types()->i64_type());                // ctxt_ptr
+  arguments.push_back(types()->i64_type());                // nrec
+  llvm::FunctionType* prototype =
+      llvm::FunctionType::get(types()->i64_type(), arguments, false /*isVarArg*/);
+
+  // Create fn
+  std::string func_name =
+      "filter_project_" + std::to_string(static_cast<int>(selection_vector_mode_));
+  engine_->AddFunctionToCompile(func_name);
+  *fn = llvm::Function::Create(prototype, llvm::GlobalValue::ExternalLinkage, func_name,
+                               module());
+  ARROW_RETURN_IF((*fn == nullptr), Status::CodeGenError("Error creating function."));
+
+  // Name the arguments
+  llvm::Function::arg_iterator args = (*fn)->arg_begin();
+  llvm::Value* arg_addrs = &*args;
+  arg_addrs->setName("args");
+  ++args;
+  llvm::Value* arg_addr_offsets = &*args;
+  arg_addr_offsets->setName("arg_addr_offsets");
+  ++args;
+  llvm::Value* arg_local_bitmaps = &*args;
+  arg_local_bitmaps->setName("local_bitmaps");
+  ++args;
+  llvm::Value* arg_selection_vector = &*args;
+  arg_selection_vector->setName("selection_vector");
+  ++args;
+  llvm::Value* arg_context_ptr = &*args;
+  arg_context_ptr->setName("context_ptr");
+  ++args;
+  llvm::Value* arg_nrecords = &*args;
+  arg_nrecords->setName("nrecords");
+
+  llvm::BasicBlock* loop_entry = llvm::BasicBlock::Create(*context(), "entry", *fn);
+  llvm::BasicBlock* loop_body = llvm::BasicBlock::Create(*context(), "loop", *fn);
+  llvm::BasicBlock* loop_selected = llvm::BasicBlock::Create(*context(), "selected", *fn);
+  llvm::BasicBlock* loop_next = llvm::BasicBlock::Create(*context(), "next", *fn);
+  llvm::BasicBlock* loop_exit = llvm::BasicBlock::Create(*context(), "exit", *fn);
+
+  // Add references to the output vectors (in entry block)
+  builder->SetInsertPoint(loop_entry);
+  std::vector<OutputReferences> output_refs;
+  for (auto& compiled_expr : compiled_exprs_) {
+    output_refs.push_back(GetOutputReferences(arg_addrs, compiled_expr->output()));
+  }
+
+  std::vector<llvm::Value*> slice_offsets;
+  for (int idx = 0; idx < buffer_count; idx++) {
+    auto offsetAddr = builder->CreateGEP(arg_addr_offsets, types()->i32_constant(idx));
+    auto offset = builder->CreateLoad(offsetAddr);
+    slice_offsets.push_back(offset);
+  }
+
+  // Loop body
+  builder->SetInsertPoint(loop_body);
+
+  // define loop_var : start with 0, +1 after each iter
+  llvm::PHINode* loop_var = builder->CreatePHI(types()->i64_type(), 2, "loop_var");
+  // define num_selected : start with 0, +1 after each matching record
+  llvm::PHINode* num_selected =
+      builder->CreatePHI(types()->i64_type(), 2, "num_selected");
+
+  // The record matches if the condition is both valid and true. The visitor can add
+  // code to both the entry/loop blocks.
+  Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, slice_offsets,
+                  arg_context_ptr, loop_var);
+  condition.value_expr()->Accept(visitor);
+  llvm::Value* is_selected = visitor.result()->data();
+  for (auto& validity_expr : condition.validity_exprs()) {
+    validity_expr->Accept(visitor);
+    is_selected =
+        builder->CreateAnd(is_selected, visitor.result()->data(), "is_selected");
+  }
+  llvm::BasicBlock* condition_tail = builder->GetInsertBlock();
+  builder->CreateCondBr(is_selected, loop_selected, loop_next);
+
+  // For a matching record, save its index in the selection vector and the values of
+  // the expressions in the next slot of the output vectors.
+  builder->SetInsertPoint(loop_selected);
+  llvm::Value* selection_slot = builder->CreateGEP(arg_selection_vector, num_selected);
+  builder->CreateStore(builder->CreateIntCast(loop_var, selection_type, false),
+                       selection_slot);
+  for (size_t i = 0; i < compiled_exprs_.size(); ++i) {
+    auto& compiled_expr = compiled_exprs_[i];
+    compiled_expr->value_validity()->value_expr()->Accept(visitor);
+    ARROW_RETURN_NOT_OK(CodeGenStoreOutput(compiled_expr->output(), output_refs[i],
+                                           arg_context_ptr, num_selected,
+                                           visitor.result()));
+  }
+  llvm::Value* num_selected_update =
+      builder->CreateAdd(num_selected, types()->i64_constant(1), "num_selected+1");
+  llvm::BasicBlock* selected_tail = builder->GetInsertBlock();
+  builder->CreateBr(loop_next);
+
+  builder->SetInsertPoint(loop_next);
+  llvm::PHINode* num_selected_next =
+      builder->CreatePHI(types()->i64_type(), 2, "num_selected_next");
+  num_selected_next->addIncoming(num_selected, condition_tail);
+  num_selected_next->addIncoming(num_selected_update, selected_tail);
+
+  if (visitor.has_arena_allocs()) {
+    // Reset allocations to avoid excessive memory usage, the results of this iteration
+    // have been copied to the output vectors.
+    std::vector<llvm::Value*> reset_args;
+    reset_args.push_back(arg_context_ptr);
+    AddFunctionCall("gdv_fn_context_arena_reset", types()->void_type(), reset_args);
+  }
+
+  // add jump to "loop block" at the end of the "setup block".
+  builder->SetInsertPoint(loop_entry);
+  builder->CreateBr(loop_body);
+
+  // check loop_var
+  builder->SetInsertPoint(loop_next);
+  loop_var->addIncoming(types()->i64_constant(0), loop_entry);
+  num_selected->addIncoming(types()->i64_constant(0), loop_entry);
+  llvm::Value* loop_update =
+      builder->CreateAdd(loop_var, types()->i64_constant(1), "loop_var+1");
+  loop_var->addIncoming(loop_update, loop_next);
+  num_selected->addIncoming(num_selected_next, loop_next);
+
+  llvm::Value* loop_var_check =
+      builder->CreateICmpSLT(loop_update, arg_nrecords, "loop_var < nrec");
+  builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+
+  // Loop exit
+  builder->SetInsertPoint(loop_exit);
+  builder->CreateRet(num_selected_next);
+  return Status::OK();
+}
+
+/// Get references to the data, data buffer and offsets of the output vector.
+LLVMGenerator::OutputReferences LLVMGenerator::GetOutputReferences(
+    llvm::Value* arg_addrs, FieldDescriptorPtr output) {
+  OutputReferences refs;
+  refs.data = GetDataReference(arg_addrs, output->data_idx(), output->field());
+  refs.data_buffer_ptr = GetDataBufferPtrReference(
+      arg_addrs, output->data_buffer_ptr_idx(), output->field());
+  refs.offsets = GetOffsetsReference(arg_addrs, output->offsets_idx(), output->field());
+  return refs;
+}
+
+/// Save the value in the output vector.
+Status LLVMGenerator::CodeGenStoreOutput(FieldDescriptorPtr output,
+                                         const OutputReferences& refs,
+                                         llvm::Value* arg_context_ptr, llvm::Value* index,
+                                         LValuePtr value) {
+  llvm::IRBuilder<>* builder = ir_builder();
+  auto output_type_id = output->Type()->id();
+  if (output_type_id == arrow::Type::BOOL) {
+    SetPackedBitValue(refs.data, index, value->data());
+  } else if (arrow::is_primitive(output_type_id) ||
+             output_type_id == arrow::Type::DECIMAL) {
+    llvm::Value* slot_offset = builder->CreateGEP(refs.data, index);
+    builder->CreateStore(value->data(), slot_offset);
+  } else if (arrow::is_binary_like(output_type_id)) {
+    // Var-len output. Make a function call to populate the data.
+    // if there is an error, the fn sets it in the context. And, will be returned at the
+    // end of this row batch.
+    AddFunctionCall("gdv_fn_populate_varlen_vector", types()->i32_type(),
+                    {arg_context_ptr, refs.data_buffer_ptr, refs.offsets, index,
+                     value->data(), value->length()});
+  } else {
+    return Status::NotImplemented("output type ", output->Type()->ToString(),
+                                  " not supported");
+  }
+  ADD_TRACE("saving result " + output->Name() + " value %T", value->data());
+  return Status::OK();
+}
+
 /// Return value of a bit in bitMap.
 llvm::Value* LLVMGenerator::GetPackedBitValue(llvm::Value* bitmap,
                                               llvm::Value* position) {
@@ -534,7 +850,8 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
       slice_offsets_(slice_offsets),
       arg_context_ptr_(arg_context_ptr),
       loop_var_(loop_var),
-      has_arena_allocs_(false) {
+      has_arena_allocs_(false),
+      branch_depth_(0) {
   ADD_VISITOR_TRACE("Iteration %T", loop_var);
 }
 
@@ -687,8 +1004,8 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
-      value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
+      llvm::Value* str_int_cast = generator_->engine_->ProcessAddress(str.c_str());
+      value = ir_builder()->CreateIntToPtr(str_int_cast, types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
     }
@@ -732,6 +1049,10 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
 }
 
 void LLVMGenerator::Visitor::Visit(const NonNullableFuncDex& dex) {
+  VisitFunction(dex, [&] { BuildNonNullableFunction(dex); });
+}
+
+void LLVMGenerator::Visitor::BuildNonNullableFunction(const NonNullableFuncDex& dex) {
   const std::string& function_name = dex.func_descriptor()->name();
   ADD_VISITOR_TRACE("visit NonNullableFunc base function " + function_name);
 
@@ -785,15 +1106,45 @@ void LLVMGenerator::Visitor::Visit(const NonNullableFuncDex& dex) {
 }
 
 void LLVMGenerator::Visitor::Visit(const NullableNeverFuncDex& dex) {
-  ADD_VISITOR_TRACE("visit NullableNever base function " + dex.func_descriptor()->name());
-  const NativeFunction* native_function = dex.native_function();
+  VisitFunction(dex, [&] {
+    ADD_VISITOR_TRACE("visit NullableNever base function " +
+                      dex.func_descriptor()->name());
+    const NativeFunction* native_function = dex.native_function();
 
-  // build function params along with validity.
-  auto params = BuildParams(dex.function_holder().get(), dex.args(), true,
-                            native_function->NeedsContext());
+    // build function params along with validity.
+    auto params = BuildParams(dex.function_holder().get(), dex.args(), true,
+                              native_function->NeedsContext());
 
-  auto arrow_return_type = dex.func_descriptor()->return_type();
-  result_ = BuildFunctionCall(native_function, arrow_return_type, &params);
+    auto arrow_return_type = dex.func_descriptor()->return_type();
+    result_ = BuildFunctionCall(native_function, arrow_return_type, &params);
+  });
+}
+
+void LLVMGenerator::Visitor::VisitFunction(const FuncDex& dex,
+                                           const std::function<void()>& build) {
+  auto function_result = function_results_.find(&dex);
+  if (function_result != function_results_.end()) {
+    ADD_VISITOR_TRACE("reuse result of function " + dex.func_descriptor()->name());
+    result_ = function_result->second;
+    return;
+  }
+
+  if (dex.is_constant()) {
+    // Only literals are involved, so the value can be computed before the loop.
+    llvm::IRBuilder<>* builder = ir_builder();
+    llvm::BasicBlock* saved_block = builder->GetInsertBlock();
+    builder->SetInsertPoint(entry_block_);
+    build();
+    DCHECK_EQ(builder->GetInsertBlock(), entry_block_);
+    builder->SetInsertPoint(saved_block);
+    function_results_[&dex] = result_;
+  } else {
+    build();
+    // The result of a branch doesn't dominate the rest of the loop body.
+    if (branch_depth_ == 0) {
+      function_results_[&dex] = result_;
+    }
+  }
 }
 
 void LLVMGenerator::Visitor::Visit(const NullableInternalFuncDex& dex) {
@@ -916,8 +1267,10 @@ void LLVMGenerator::Visitor::Visit(const BooleanAndDex& dex) {
     // remember if any nulls were encountered.
     all_exprs_valid =
         builder->CreateAnd(all_exprs_valid, current->validity(), "validityBitAnd");
-    // continue to evaluate the next pair in list.
+    // continue to evaluate the next pair in list, which is conditional.
+    ++branch_depth_;
   }
+  branch_depth_ -= static_cast<int>(dex.args().size());
   builder->CreateBr(non_short_circuit_bb);
 
   // Short-circuit case (atleast one of the expressions is valid and false).
@@ -982,8 +1335,10 @@ void LLVMGenerator::Visitor::Visit(const BooleanOrDex& dex) {
     // remember if any nulls were encountered.
     all_exprs_valid =
         builder->CreateAnd(all_exprs_valid, current->validity(), "validityBitAnd");
-    // continue to evaluate the next pair in list.
+    // continue to evaluate the next pair in list, which is conditional.
+    ++branch_depth_;
   }
+  branch_depth_ -= static_cast<int>(dex.args().size());
   builder->CreateBr(non_short_circuit_bb);
 
   // Short-circuit case (atleast one of the expressions is valid and true).
@@ -1028,8 +1383,8 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
-  llvm::Constant* ptr_int_cast =
-      types->i64_constant((int64_t)(dex_instance.in_holder().get()));
+  llvm::Value* ptr_int_cast =
+      generator_->engine_->ProcessAddress(dex_instance.in_holder().get());
   params.push_back(ptr_int_cast);
 
   /* eval expr result */
@@ -1070,6 +1425,7 @@ LValuePtr LLVMGenerator::Visitor::BuildIfElse(llvm::Value* condition,
   llvm::BasicBlock* merge_bb = llvm::BasicBlock::Create(*context, "merge", function_);
 
   builder->CreateCondBr(condition, then_bb, else_bb);
+  ++branch_depth_;
 
   // Emit the then block.
   builder->SetInsertPoint(then_bb);
@@ -1086,6 +1442,7 @@ LValuePtr LLVMGenerator::Visitor::BuildIfElse(llvm::Value* condition,
 
   // refresh else_bb for phi (could have changed due to code generation of else_vv).
   else_bb = builder->GetInsertBlock();
+  --branch_depth_;
 
   // Emit the merge block.
   builder->SetInsertPoint(merge_bb);
@@ -1185,7 +1542,6 @@ LValuePtr LLVMGenerator::Visitor::BuildFunctionCall(const NativeFunction* func,
 std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
     FunctionHolder* holder, const ValueValidityPairVector& args, bool with_validity,
     bool with_context) {
-  LLVMTypes* types = generator_->types();
   std::vector<llvm::Value*> params;
 
   // add context if required.
@@ -1195,7 +1551,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
-    auto ptr = types->i64_constant((int64_t)holder);
+    auto ptr = generator_->engine_->ProcessAddress(holder);
     params.push_back(ptr);
   }
 
@@ -1341,9 +1697,9 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
 
   // cast this to an llvm pointer.
   const char* str = trace_strings_.back().c_str();
-  llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
-  llvm::Constant* str_ptr_cast =
-      llvm::ConstantExpr::getIntToPtr(str_int_cast, types()->i8_ptr_type());
+  llvm::Value* str_int_cast = engine_->ProcessAddress(str);
+  llvm::Value* str_ptr_cast =
+      ir_builder()->CreateIntToPtr(str_int_cast, types()->i8_ptr_type());
 
   std::vector<llvm::Value*> args;
   args.push_back(str_ptr_cast);
@@ -20,7 +20,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/util/macros.h"
@@ -31,6 +33,7 @@
 #include "gandiva/dex_visitor.h"
 #include "gandiva/engine.h"
 #include "gandiva/execution_context.h"
+#include "gandiva/expr_decomposer.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/gandiva_aliases.h"
 #include "gandiva/llvm_types.h"
@@ -41,6 +44,7 @@
 
 namespace gandiva {
 
+class FuncDex;
 class FunctionHolder;
 
 /// Builds an LLVM module and generates code for the specified set of expressions.
@@ -50,16 +54,39 @@ class GANDIVA_EXPORT LLVMGenerator {
   static Status Make(std::shared_ptr<Configuration> config,
                      std::unique_ptr<LLVMGenerator>* llvm_generator);
 
+  /// \brief Reuse the object code for the given key from the persistent cache
+  /// of the configuration, if any. Must be called before Build().
+  void SetObjectCacheKey(const std::string& key) { engine_->SetObjectCacheKey(key); }
+
   /// \brief Build the code for the expression trees for default mode. Each
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
 
+  /// \brief Time spent in Build() or BuildFilterProject(), in nanoseconds.
+  int64_t build_time_ns() const { return build_time_ns_; }
+
+  /// \brief Whether the object code was found in the persistent cache.
+  bool loaded_from_object_cache() const { return engine_->loaded_from_object_cache(); }
+
   /// \brief Build the code for the expression trees for default mode. Each
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs) {
     return Build(exprs, SelectionVector::Mode::MODE_NONE);
   }
 
+  /// \brief Build a single function that evaluates the condition, and the expression
+  /// trees for the records that match it. The indices of these records are saved in a
+  /// selection vector of type 'mode', which can't be MODE_NONE.
+  Status BuildFilterProject(const ConditionPtr& condition, const ExpressionVector& exprs,
+                            SelectionVector::Mode mode);
+
+  /// \brief Execute the function built by BuildFilterProject(). Populates
+  /// 'selection_vector' and the first GetNumSlots() records of the output vectors,
+  /// which must have capacity for all the records in the batch.
+  Status ExecuteFilterProject(const arrow::RecordBatch& record_batch,
+                              SelectionVector* selection_vector,
+                              const ArrayDataVector& output_vector);
+
   /// \brief Execute the built expression against the provided arguments for
   /// default mode.
   Status Execute(const arrow::RecordBatch& record_batch,
@@ -81,6 +108,7 @@ class GANDIVA_EXPORT LLVMGenerator {
   FRIEND_TEST(TestLLVMGenerator, VerifyPCFunctions);
   FRIEND_TEST(TestLLVMGenerator, TestAdd);
   FRIEND_TEST(TestLLVMGenerator, TestNullInternal);
+  FRIEND_TEST(TestLLVMGenerator, TestObjectCodeCache);
 
   llvm::LLVMContext* context() { return engine_->context(); }
   llvm::IRBuilder<>* ir_builder() { return engine_->ir_builder(); }
@@ -155,6 +183,14 @@ class GANDIVA_EXPORT LLVMGenerator {
     // Clear the bit in the local bitmap, if is_valid is 'false'
     void ClearLocalBitMapIfNotValid(int local_bitmap_idx, llvm::Value* is_valid);
 
+    // Generate the code for a function that only deals with non-null inputs.
+    void BuildNonNullableFunction(const NonNullableFuncDex& dex);
+
+    // Generate the code for a function through 'build', unless the result of the
+    // (shared) dex is already available. A constant function is generated in the
+    // entry block, so that it's evaluated once per batch.
+    void VisitFunction(const FuncDex& dex, const std::function<void()>& build);
+
     LLVMGenerator* generator_;
     LValuePtr result_;
     llvm::Function* function_;
@@ -165,10 +201,13 @@ class GANDIVA_EXPORT LLVMGenerator {
     llvm::Value* arg_context_ptr_;
     llvm::Value* loop_var_;
     bool has_arena_allocs_;
+    // Number of enclosing branches (if-else, short-circuit) of the current block.
+    int branch_depth_;
+    // Results of the functions that can be used in the rest of the loop body.
+    std::unordered_map<const Dex*, LValuePtr> function_results_;
   };
 
-  // Generate the code for one expression for default mode, with the output of
-  // the expression going to 'output'.
+  // Decompose one expression, with the output of the expression going to 'output'.
   Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output);
 
   /// Generate code to load the vector at specified index in the 'arg_addrs' array.
@@ -187,11 +226,38 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// Generate code to load the vector at specified index and cast it as buffer pointer.
   llvm::Value* GetDataBufferPtrReference(llvm::Value* arg_addrs, int idx, FieldPtr field);
 
+  /// References to the buffers of an output vector.
+  struct OutputReferences {
+    llvm::Value* data;
+    llvm::Value* data_buffer_ptr;
+    llvm::Value* offsets;
+  };
+
+  /// Generate code to load the references to the buffers of the output vector.
+  OutputReferences GetOutputReferences(llvm::Value* arg_addrs,
+                                       FieldDescriptorPtr output);
+
+  /// Generate code to save 'value' in slot 'index' of the output vector.
+  Status CodeGenStoreOutput(FieldDescriptorPtr output, const OutputReferences& refs,
+                            llvm::Value* arg_context_ptr, llvm::Value* index,
+                            LValuePtr value);
+
   /// Generate code for the value array of one expression.
   Status CodeGenExprValue(DexPtr value_expr, int num_buffers, FieldDescriptorPtr output,
                           int suffix_idx, llvm::Function** fn,
                           SelectionVector::Mode selection_vector_mode);
 
+  /// Generate code for the value arrays of several expressions, in a single loop.
+  Status CodeGenExprValues(const DexVector& value_exprs, int num_buffers,
+                           const std::vector<FieldDescriptorPtr>& outputs,
+                           const std::string& func_name_prefix, llvm::Function** fn,
+                           SelectionVector::Mode selection_vector_mode);
+
+  /// Generate code for the loop that evaluates the condition and, for the matching
+  /// records, the value arrays of all the compiled expressions.
+  Status CodeGenFilterProject(const ValueValidityPair& condition, int num_buffers,
+                              llvm::Function** fn);
+
   /// Generate code to load the local bitmap specified index and cast it as bitmap.
   llvm::Value* GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx);
 
@@ -241,6 +307,11 @@ class GANDIVA_EXPORT LLVMGenerator {
   FunctionRegistry function_registry_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
+  // Decomposition of the sub-trees shared by the expressions.
+  ExprDecomposer::SharedSubExprs shared_sub_exprs_;
+  bool has_shared_sub_exprs_ = false;
+  FilterProjectFunc filter_project_function_ = NULLPTR;
+  int64_t build_time_ns_ = 0;
 
   // used for debug
   bool dump_ir_;
@@ -21,12 +21,14 @@
 #include <vector>
 
 #include <gtest/gtest.h>
+#include "arrow/util/io_util.h"
 #include "gandiva/configuration.h"
 #include "gandiva/dex.h"
 #include "gandiva/expression.h"
 #include "gandiva/func_descriptor.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
 
 namespace gandiva {
 
@@ -121,4 +123,57 @@ TEST_F(TestLLVMGenerator, TestAdd) {
   }
 }
 
+TEST_F(TestLLVMGenerator, TestObjectCodeCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("gandiva-object-cache-"));
+  auto config = ConfigurationBuilder()
+                    .set_object_cache_directory(temp_dir->path().ToString())
+                    .build();
+
+  auto field0 = arrow::field("f0", arrow::int32());
+  auto field1 = arrow::field("f1", arrow::int32());
+  auto field2 = arrow::field("f2", arrow::utf8());
+  auto schema = arrow::schema({field0, field1, field2});
+  // The string literal lives at a different address in every generator.
+  auto sum = TreeExprBuilder::MakeExpression("add", {field0, field1},
+                                             arrow::field("sum", arrow::int32()));
+  auto equal = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("equal",
+                                    {TreeExprBuilder::MakeField(field2),
+                                     TreeExprBuilder::MakeStringLiteral("bc")},
+                                    arrow::boolean()),
+      arrow::field("equal", arrow::boolean()));
+
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, true});
+  auto array1 = MakeArrowArrayInt32({5, 6, 7, 8}, {true, true, true, true});
+  auto array2 = MakeArrowArrayUtf8({"a", "bc", "bc", "d"}, {true, true, true, true});
+  auto batch = arrow::RecordBatch::Make(schema, 4, {array0, array1, array2});
+
+  for (bool cached : {false, true}) {
+    std::unique_ptr<LLVMGenerator> generator;
+    ASSERT_OK(LLVMGenerator::Make(config, &generator));
+    generator->SetObjectCacheKey("sum and equal");
+    ASSERT_OK(generator->Build({sum, equal}));
+    EXPECT_EQ(generator->engine_->loaded_from_object_cache(), cached);
+
+    ArrayDataVector outputs;
+    for (auto& type : {arrow::int32(), arrow::boolean()}) {
+      std::shared_ptr<arrow::Buffer> validity, data;
+      ASSERT_OK(arrow::AllocateBuffer(8, &validity));
+      ASSERT_OK(arrow::AllocateBuffer(16, &data));
+      outputs.push_back(arrow::ArrayData::Make(type, 4, {validity, data}));
+    }
+    ASSERT_OK(generator->Execute(*batch, outputs));
+    EXPECT_ARROW_ARRAY_EQUALS(
+        MakeArrowArrayInt32({6, 8, 10, 12}, {true, true, true, true}),
+        arrow::MakeArray(outputs[0]));
+    EXPECT_ARROW_ARRAY_EQUALS(
+        MakeArrowArrayBool({false, true, true, false}, {true, true, true, true}),
+        arrow::MakeArray(outputs[1]));
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto files, arrow::internal::ListDir(temp_dir->path()));
+  ASSERT_EQ(files.size(), 1U);
+}
+
 }  // namespace gandiva
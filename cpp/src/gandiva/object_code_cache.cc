@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "gandiva/object_code_cache.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <utility>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "arrow/util/hashing.h"
+
+namespace gandiva {
+
+// Start of every cache file, followed by the length of the key, a newline, the
+// key and the object code. Change the version when the layout changes.
+static const char kObjectCodeCacheMagic[] = "gandiva-object-code-1\n";
+
+ObjectCodeCache::ObjectCodeCache(const std::string& directory, std::string key)
+    : key_(std::move(key)) {
+  uint64_t hash = arrow::internal::ComputeStringHash<0>(
+      key_.data(), static_cast<int64_t>(key_.size()));
+  char file_name[32];
+  snprintf(file_name, sizeof(file_name), "%016" PRIx64 ".o", hash);
+  llvm::SmallString<256> path(directory);
+  llvm::sys::path::append(path, file_name);
+  path_ = path.str().str();
+}
+
+bool ObjectCodeCache::Load() {
+  auto buffer_or_error = llvm::MemoryBuffer::getFile(path_, -1, false);
+  if (!buffer_or_error) {
+    return false;
+  }
+  llvm::StringRef contents = buffer_or_error.get()->getBuffer();
+  std::string header =
+      kObjectCodeCacheMagic + std::to_string(key_.size()) + "\n" + key_;
+  if (!contents.startswith(header)) {
+    return false;
+  }
+  // Copy the object code, the loader needs an aligned buffer.
+  object_ = llvm::MemoryBuffer::getMemBufferCopy(contents.drop_front(header.size()),
+                                                 path_);
+  return true;
+}
+
+void ObjectCodeCache::notifyObjectCompiled(const llvm::Module* module,
+                                           llvm::MemoryBufferRef object) {
+  llvm::sys::fs::create_directories(llvm::sys::path::parent_path(path_));
+  int fd;
+  llvm::SmallString<256> temp_path;
+  if (llvm::sys::fs::createUniqueFile(path_ + "-%%%%%%%%.tmp", fd, temp_path)) {
+    return;
+  }
+  llvm::raw_fd_ostream stream(fd, true /*shouldClose*/);
+  stream << kObjectCodeCacheMagic << key_.size() << "\n" << key_;
+  stream.write(object.getBufferStart(), object.getBufferSize());
+  stream.close();
+  if (stream.has_error()) {
+    stream.clear_error();
+    llvm::sys::fs::remove(temp_path);
+    return;
+  }
+  // Concurrent readers and writers only ever see complete files.
+  if (llvm::sys::fs::rename(temp_path, path_)) {
+    llvm::sys::fs::remove(temp_path);
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCodeCache::getObject(
+    const llvm::Module* module) {
+  return std::move(object_);
+}
+
+}  // namespace gandiva
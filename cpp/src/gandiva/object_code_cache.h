@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef GANDIVA_OBJECT_CODE_CACHE_H
+#define GANDIVA_OBJECT_CODE_CACHE_H
+
+#include <memory>
+#include <string>
+
+#include "gandiva/llvm_includes.h"
+#include "gandiva/visibility.h"
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+
+namespace gandiva {
+
+/// \brief Persistent cache for the object code of one module.
+///
+/// The object code that LLVM generates for a module is written to a file in the
+/// cache directory, named after a hash of the key. Another process building a
+/// module with the same key can then load that file instead of optimising and
+/// compiling the module again. The key is stored in the file too, so a hash
+/// collision is detected and treated as a miss.
+///
+/// The key must describe everything the object code depends on: the
+/// expressions, the LLVM version, the target CPU and the precompiled functions.
+/// Failures to read or write the cache are not errors, the module is then
+/// simply compiled.
+class GANDIVA_EXPORT ObjectCodeCache : public llvm::ObjectCache {
+ public:
+  ObjectCodeCache(const std::string& directory, std::string key);
+
+  /// Load the object code for the key, return true if it was found.
+  bool Load();
+
+  /// Called by LLVM with the object code of a newly compiled module.
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  /// Called by LLVM before compiling a module. Returns the object code found by
+  /// Load(), if any.
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string key_;
+  std::string path_;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_OBJECT_CODE_CACHE_H
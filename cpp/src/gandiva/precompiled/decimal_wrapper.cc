@@ -35,11 +35,12 @@ void add_large_decimal128_decimal128(int64_t x_high, uint64_t x_low, int32_t x_p
 }
 
 FORCE_INLINE
-void multiply_decimal128_decimal128(int64_t x_high, uint64_t x_low, int32_t x_precision,
-                                    int32_t x_scale, int64_t y_high, uint64_t y_low,
-                                    int32_t y_precision, int32_t y_scale,
-                                    int32_t out_precision, int32_t out_scale,
-                                    int64_t* out_high, uint64_t* out_low) {
+void multiply_internal_decimal128_decimal128(int64_t x_high, uint64_t x_low,
+                                             int32_t x_precision, int32_t x_scale,
+                                             int64_t y_high, uint64_t y_low,
+                                             int32_t y_precision, int32_t y_scale,
+                                             int32_t out_precision, int32_t out_scale,
+                                             int64_t* out_high, uint64_t* out_low) {
   gandiva::BasicDecimalScalar128 x(x_high, x_low, x_precision, x_scale);
   gandiva::BasicDecimalScalar128 y(y_high, y_low, y_precision, y_scale);
   bool overflow;
@@ -52,11 +53,13 @@ void multiply_decimal128_decimal128(int64_t x_high, uint64_t x_low, int32_t x_pr
 }
 
 FORCE_INLINE
-void divide_decimal128_decimal128(int64_t context, int64_t x_high, uint64_t x_low,
-                                  int32_t x_precision, int32_t x_scale, int64_t y_high,
-                                  uint64_t y_low, int32_t y_precision, int32_t y_scale,
-                                  int32_t out_precision, int32_t out_scale,
-                                  int64_t* out_high, uint64_t* out_low) {
+void divide_internal_decimal128_decimal128(int64_t context, int64_t x_high,
+                                           uint64_t x_low, int32_t x_precision,
+                                           int32_t x_scale, int64_t y_high,
+                                           uint64_t y_low, int32_t y_precision,
+                                           int32_t y_scale, int32_t out_precision,
+                                           int32_t out_scale, int64_t* out_high,
+                                           uint64_t* out_low) {
   gandiva::BasicDecimalScalar128 x(x_high, x_low, x_precision, x_scale);
   gandiva::BasicDecimalScalar128 y(y_high, y_low, y_precision, y_scale);
   bool overflow;
@@ -69,11 +72,12 @@ void divide_decimal128_decimal128(int64_t context, int64_t x_high, uint64_t x_lo
 }
 
 FORCE_INLINE
-void mod_decimal128_decimal128(int64_t context, int64_t x_high, uint64_t x_low,
-                               int32_t x_precision, int32_t x_scale, int64_t y_high,
-                               uint64_t y_low, int32_t y_precision, int32_t y_scale,
-                               int32_t out_precision, int32_t out_scale,
-                               int64_t* out_high, uint64_t* out_low) {
+void mod_internal_decimal128_decimal128(int64_t context, int64_t x_high, uint64_t x_low,
+                                        int32_t x_precision, int32_t x_scale,
+                                        int64_t y_high, uint64_t y_low,
+                                        int32_t y_precision, int32_t y_scale,
+                                        int32_t out_precision, int32_t out_scale,
+                                        int64_t* out_high, uint64_t* out_low) {
   gandiva::BasicDecimalScalar128 x(x_high, x_low, x_precision, x_scale);
   gandiva::BasicDecimalScalar128 y(y_high, y_low, y_precision, y_scale);
   bool overflow;
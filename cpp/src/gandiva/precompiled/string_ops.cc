@@ -172,6 +172,41 @@ UTF8_LENGTH(char_length, utf8)
 UTF8_LENGTH(length, utf8)
 UTF8_LENGTH(lengthUtf8, binary)
 
+// Flip the case of the ascii letters between 'first' and 'last' in the 8 bytes of
+// 'word'. Bytes outside the ascii range are left unchanged.
+FORCE_INLINE
+uint64_t ascii_flip_case_word(uint64_t word, char first, char last) {
+  const uint64_t ones = 0x0101010101010101ULL;
+  const uint64_t high_bits = 0x8080808080808080ULL;
+  uint64_t heptets = word & ~high_bits;
+  // the high bit of each byte is set if the byte is >= first, and > last.
+  uint64_t ge_first = heptets + ones * (0x80 - first);
+  uint64_t gt_last = heptets + ones * (0x80 - last - 1);
+  uint64_t in_range = ge_first & ~gt_last & ~word & high_bits;
+  // 0x80 >> 2 is the 0x20 that separates the cases.
+  return word ^ (in_range >> 2);
+}
+
+// Flip the case of the ascii letters between 'first' and 'last', a word at a time.
+FORCE_INLINE
+void ascii_flip_case(const char* data, int32 data_len, char first, char last,
+                     char* out) {
+  int32 i = 0;
+  for (; i + 8 <= data_len; i += 8) {
+    uint64_t word;
+    memcpy(&word, data + i, 8);
+    word = ascii_flip_case_word(word, first, last);
+    memcpy(out + i, &word, 8);
+  }
+  for (; i < data_len; ++i) {
+    char cur = data[i];
+    if (cur >= first && cur <= last) {
+      cur = static_cast<char>(cur ^ 0x20);
+    }
+    out[i] = cur;
+  }
+}
+
 // Convert a utf8 sequence to upper case.
 // TODO : This handles only ascii characters.
 FORCE_INLINE
@@ -188,16 +223,8 @@ const char* upper_utf8(int64 context, const char* data, int32 data_len,
     *out_len = 0;
     return "";
   }
-  for (int32 i = 0; i < data_len; ++i) {
-    char cur = data[i];
-
-    // 'A- - 'Z' : 0x41 - 0x5a
-    // 'a' - 'z' : 0x61 - 0x7a
-    if (cur >= 0x61 && cur <= 0x7a) {
-      cur = static_cast<char>(cur - 0x20);
-    }
-    ret[i] = cur;
-  }
+  // 'a' - 'z' : 0x61 - 0x7a
+  ascii_flip_case(data, data_len, 'a', 'z', ret);
   *out_len = data_len;
   return ret;
 }
@@ -218,16 +245,8 @@ const char* lower_utf8(int64 context, const char* data, int32 data_len,
     *out_len = 0;
     return "";
   }
-  for (int32 i = 0; i < data_len; ++i) {
-    char cur = data[i];
-
-    // 'A' - 'Z' : 0x41 - 0x5a
-    // 'a' - 'z' : 0x61 - 0x7a
-    if (cur >= 0x41 && cur <= 0x5a) {
-      cur = static_cast<char>(cur + 0x20);
-    }
-    ret[i] = cur;
-  }
+  // 'A' - 'Z' : 0x41 - 0x5a
+  ascii_flip_case(data, data_len, 'A', 'Z', ret);
   *out_len = data_len;
   return ret;
 }
@@ -434,6 +453,27 @@ const char* convert_fromUTF8_binary(int64 context, const char* bin_in, int32 len
   return ret;
 }
 
+// Get the byte position of the first occurrence of 'needle' in 'haystack', or -1.
+// Candidates are found with memchr on the first byte of 'needle'.
+FORCE_INLINE
+int32 mem_find(const char* haystack, int32 haystack_len, const char* needle,
+               int32 needle_len) {
+  if (needle_len == 0) {
+    return 0;
+  }
+  const char* last = haystack + haystack_len - needle_len;
+  for (const char* pos = haystack; pos <= last; ++pos) {
+    pos = static_cast<const char*>(memchr(pos, needle[0], last - pos + 1));
+    if (pos == nullptr) {
+      return -1;
+    }
+    if (memcmp(pos + 1, needle + 1, needle_len - 1) == 0) {
+      return static_cast<int32>(pos - haystack);
+    }
+  }
+  return -1;
+}
+
 // Search for a string within another string
 FORCE_INLINE
 int32 locate_utf8_utf8(int64 context, const char* sub_str, int32 sub_str_len,
@@ -458,12 +498,11 @@ int32 locate_utf8_utf8_int32(int64 context, const char* sub_str, int32 sub_str_l
   if (byte_pos < 0) {
     return 0;
   }
-  for (int32 i = byte_pos; i <= str_len - sub_str_len; ++i) {
-    if (memcmp(str + i, sub_str, sub_str_len) == 0) {
-      return utf8_length(context, str, i) + 1;
-    }
+  int32 i = mem_find(str + byte_pos, str_len - byte_pos, sub_str, sub_str_len);
+  if (i < 0) {
+    return 0;
   }
-  return 0;
+  return utf8_length(context, str, byte_pos + i) + 1;
 }
 
 FORCE_INLINE
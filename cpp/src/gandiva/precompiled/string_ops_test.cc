@@ -280,6 +280,32 @@ TEST(TestStringOps, TestLower) {
   out_str = lower_utf8(ctx_ptr, "", 0, &out_len);
   EXPECT_EQ(std::string(out_str, out_len), "");
   EXPECT_FALSE(ctx.has_error());
+
+  // longer than a word, with non-ascii bytes and the letter boundaries.
+  std::string in("@AZ[`az{Ç††ABCdefGHIJ");
+  out_str = lower_utf8(ctx_ptr, in.data(), static_cast<int32>(in.length()), &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "@az[`az{Ç††abcdefghij");
+  EXPECT_FALSE(ctx.has_error());
+}
+
+TEST(TestStringOps, TestUpper) {
+  gandiva::ExecutionContext ctx;
+  uint64_t ctx_ptr = reinterpret_cast<int64>(&ctx);
+  int32 out_len = 0;
+
+  const char* out_str = upper_utf8(ctx_ptr, "AsDfJ", 5, &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "ASDFJ");
+  EXPECT_FALSE(ctx.has_error());
+
+  out_str = upper_utf8(ctx_ptr, "", 0, &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "");
+  EXPECT_FALSE(ctx.has_error());
+
+  // longer than a word, with non-ascii bytes and the letter boundaries.
+  std::string in("@AZ[`az{Ç††ABCdefGHIJ");
+  out_str = upper_utf8(ctx_ptr, in.data(), static_cast<int32>(in.length()), &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "@AZ[`AZ{Ç††ABCDEFGHIJ");
+  EXPECT_FALSE(ctx.has_error());
 }
 
 TEST(TestStringOps, TestReverse) {
@@ -343,6 +369,14 @@ TEST(TestStringOps, TestLocate) {
   EXPECT_EQ(pos, 0);
   EXPECT_FALSE(ctx.has_error());
 
+  pos = locate_utf8_utf8(ctx_ptr, "abd", 3, "ababcabdab", 10);
+  EXPECT_EQ(pos, 6);
+  EXPECT_FALSE(ctx.has_error());
+
+  pos = locate_utf8_utf8(ctx_ptr, "abd", 3, "ababcabab", 9);
+  EXPECT_EQ(pos, 0);
+  EXPECT_FALSE(ctx.has_error());
+
   pos = locate_utf8_utf8_int32(ctx_ptr, "bar", 3, "barbar", 6, 0);
   EXPECT_EQ(pos, 0);
   EXPECT_THAT(ctx.get_error(),
@@ -17,21 +17,118 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
+#include "gandiva/kernel_evaluator.h"
 #include "gandiva/llvm_generator.h"
+#include "gandiva/llvm_types.h"
 #include "gandiva/projector_cache_key.h"
 
 namespace gandiva {
 
+namespace {
+
+/// Make an array covering rows [offset, offset + length) of the fixed-width output
+/// 'array_data'. The generated code ignores the offsets of output arrays, so the
+/// buffers are sliced instead. 'offset' must be a multiple of 8.
+ArrayDataPtr SliceFixedWidthOutput(const arrow::ArrayData& array_data, int64_t offset,
+                                   int64_t length) {
+  const auto& fw_type =
+      arrow::internal::checked_cast<const arrow::FixedWidthType&>(*array_data.type);
+  int bit_width = fw_type.bit_width();
+  auto bitmap = arrow::SliceMutableBuffer(array_data.buffers[0], offset / 8,
+                                          arrow::BitUtil::BytesForBits(length));
+  auto data = arrow::SliceMutableBuffer(array_data.buffers[1], offset * bit_width / 8,
+                                        arrow::BitUtil::BytesForBits(length * bit_width));
+  return arrow::ArrayData::Make(array_data.type, length, {bitmap, data});
+}
+
+/// Copy the scratch arrays of the variable-width output 'idx', one per morsel of
+/// 'morsel_size' rows, into 'output'.
+Status MergeVarWidthOutput(const std::vector<ArrayDataVector>& scratch, size_t idx,
+                           int64_t morsel_size, arrow::ArrayData* output) {
+  int num_morsels = static_cast<int>(scratch.size());
+
+  // First pass: the data of each morsel follows the data of the previous morsels.
+  std::vector<int64_t> data_offsets(num_morsels + 1, 0);
+  for (int morsel = 0; morsel < num_morsels; ++morsel) {
+    const auto& array_data = *scratch[morsel][idx];
+    auto offsets = reinterpret_cast<const int32_t*>(array_data.buffers[1]->data());
+    data_offsets[morsel + 1] = data_offsets[morsel] + offsets[array_data.length];
+  }
+  ARROW_RETURN_IF(data_offsets.back() > std::numeric_limits<int32_t>::max(),
+                  Status::CapacityError("Output of ", data_offsets.back(),
+                                        " bytes does not fit in a binary array"));
+
+  auto data_buffer =
+      std::dynamic_pointer_cast<arrow::ResizableBuffer>(output->buffers[2]);
+  ARROW_RETURN_IF(data_buffer == nullptr,
+                  Status::Invalid("Data buffer of a variable-width output must be "
+                                  "resizable"));
+  ARROW_RETURN_NOT_OK(data_buffer->Resize(data_offsets.back()));
+
+  // Second pass: copy each morsel into its slice of the output.
+  auto bitmap = output->buffers[0]->mutable_data();
+  auto offsets = reinterpret_cast<int32_t*>(output->buffers[1]->mutable_data());
+  auto data = data_buffer->mutable_data();
+  auto copy_morsel = [&](int morsel) {
+    const auto& array_data = *scratch[morsel][idx];
+    int64_t offset = morsel * morsel_size;
+    int64_t length = array_data.length;
+    auto src_offsets = reinterpret_cast<const int32_t*>(array_data.buffers[1]->data());
+
+    std::memcpy(bitmap + offset / 8, array_data.buffers[0]->data(),
+                arrow::BitUtil::BytesForBits(length));
+    // The end offset of a morsel is the start offset of the next one.
+    int64_t num_offsets = morsel == num_morsels - 1 ? length + 1 : length;
+    for (int64_t i = 0; i < num_offsets; ++i) {
+      offsets[offset + i] = static_cast<int32_t>(data_offsets[morsel] + src_offsets[i]);
+    }
+    if (src_offsets[length] > 0) {
+      std::memcpy(data + data_offsets[morsel], array_data.buffers[2]->data(),
+                  src_offsets[length]);
+    }
+    return Status::OK();
+  };
+  return arrow::internal::ParallelFor(num_morsels, copy_morsel);
+}
+
+Cache<ProjectorCacheKey, std::shared_ptr<Projector>>& GetProjectorCache() {
+  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  return cache;
+}
+
+}  // namespace
+
 Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
+      compiled_(true),
+      schema_(schema),
+      output_fields_(output_fields),
+      configuration_(configuration) {}
+
+Projector::Projector(std::unique_ptr<KernelEvaluator> kernel_evaluator,
+                     std::future<LLVMGeneratorResult> compilation, SchemaPtr schema,
+                     const FieldVector& output_fields,
+                     std::shared_ptr<Configuration> configuration)
+    : kernel_evaluator_(std::move(kernel_evaluator)),
+      compiled_(false),
+      compilation_(std::move(compilation)),
       schema_(schema),
       output_fields_(output_fields),
       configuration_(configuration) {}
@@ -61,7 +158,7 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                   Status::Invalid("Configuration cannot be null"));
 
   // see if equivalent projector was already built
-  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  auto& cache = GetProjectorCache();
   ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
   std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
   if (cached_projector != nullptr) {
@@ -69,9 +166,53 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     return Status::OK();
   }
 
+  // save the output field types. Used for validation at Evaluate() time.
+  std::vector<FieldPtr> output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  // With background compilation, expressions that the compute kernels support
+  // are evaluated by them until the LLVM code is ready.
+  std::unique_ptr<KernelEvaluator> kernel_evaluator;
+  if (configuration->background_compilation()) {
+    auto status = KernelEvaluator::Make(schema, exprs, &kernel_evaluator);
+    ARROW_RETURN_IF(!status.ok() && !status.IsNotImplemented(), status);
+  }
+
+  if (kernel_evaluator != nullptr) {
+    // The validation only needs the types, so it doesn't wait for an engine.
+    llvm::LLVMContext context;
+    LLVMTypes types(context);
+    ExprValidator expr_validator(&types, schema);
+    for (auto& expr : exprs) {
+      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    }
+
+    auto object_cache_key = cache_key.ToString();
+    auto compile = [configuration, exprs, selection_vector_mode,
+                    object_cache_key]() -> LLVMGeneratorResult {
+      std::unique_ptr<LLVMGenerator> llvm_gen;
+      ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+      llvm_gen->SetObjectCacheKey(object_cache_key);
+      ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+      return std::move(llvm_gen);
+    };
+    ARROW_ASSIGN_OR_RAISE(auto compilation,
+                          arrow::internal::GetCpuThreadPool()->Submit(compile));
+
+    *projector = std::shared_ptr<Projector>(
+        new Projector(std::move(kernel_evaluator), std::move(compilation), schema,
+                      output_fields, configuration));
+    cache.PutModule(cache_key, *projector);
+    return Status::OK();
+  }
+
   // Build LLVM generator, and generate code for the specified expressions
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+  llvm_gen->SetObjectCacheKey(cache_key.ToString());
 
   // Run the validation on the expressions.
   // Return if any of the expression is invalid since
@@ -83,13 +224,6 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
 
-  // save the output field types. Used for validation at Evaluate() time.
-  std::vector<FieldPtr> output_fields;
-  output_fields.reserve(exprs.size());
-  for (auto& expr : exprs) {
-    output_fields.push_back(expr->result());
-  }
-
   // Instantiate the projector with the completely built llvm generator
   *projector = std::shared_ptr<Projector>(
       new Projector(std::move(llvm_gen), schema, output_fields, configuration));
@@ -106,31 +240,23 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
                            const SelectionVector* selection_vector,
                            const ArrayDataVector& output_data_vecs) {
+  auto start = EvaluationCounters::Clock::now();
   ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
 
-  if (output_data_vecs.size() != output_fields_.size()) {
-    std::stringstream ss;
-    ss << "number of buffers for output_data_vecs is " << output_data_vecs.size()
-       << ", expected " << output_fields_.size();
-    return Status::Invalid(ss.str());
-  }
-
-  int idx = 0;
-  for (auto& array_data : output_data_vecs) {
-    if (array_data == nullptr) {
-      std::stringstream ss;
-      ss << "array for output field " << output_fields_[idx]->name() << "is null.";
-      return Status::Invalid(ss.str());
-    }
-
-    auto num_rows =
-        selection_vector == nullptr ? batch.num_rows() : selection_vector->GetNumSlots();
+  auto num_rows =
+      selection_vector == nullptr ? batch.num_rows() : selection_vector->GetNumSlots();
+  ARROW_RETURN_NOT_OK(ValidateOutputArrays(output_data_vecs, num_rows));
 
+  LLVMGenerator* llvm_generator;
+  ARROW_RETURN_NOT_OK(GetLLVMGenerator(selection_vector != nullptr, &llvm_generator));
+  if (llvm_generator == nullptr) {
+    ARROW_RETURN_NOT_OK(kernel_evaluator_->Evaluate(batch, output_data_vecs));
+  } else {
     ARROW_RETURN_NOT_OK(
-        ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
-    ++idx;
+        llvm_generator->Execute(batch, selection_vector, output_data_vecs));
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  evaluation_counters_.Add(batch.num_rows(), start);
+  return Status::OK();
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -141,10 +267,19 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* p
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
                            const SelectionVector* selection_vector,
                            arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  auto start = EvaluationCounters::Clock::now();
   ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
   ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
   ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
 
+  LLVMGenerator* llvm_generator;
+  ARROW_RETURN_NOT_OK(GetLLVMGenerator(selection_vector != nullptr, &llvm_generator));
+  if (llvm_generator == nullptr) {
+    ARROW_RETURN_NOT_OK(kernel_evaluator_->Evaluate(batch, pool, output));
+    evaluation_counters_.Add(batch.num_rows(), start);
+    return Status::OK();
+  }
+
   auto num_rows =
       selection_vector == nullptr ? batch.num_rows() : selection_vector->GetNumSlots();
   // Allocate the output data vecs.
@@ -158,13 +293,139 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
   // Execute the expression(s).
   ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+      llvm_generator->Execute(batch, selection_vector, output_data_vecs));
 
   // Create and return array arrays.
   output->clear();
   for (auto& array_data : output_data_vecs) {
     output->push_back(arrow::MakeArray(array_data));
   }
+  evaluation_counters_.Add(batch.num_rows(), start);
+  return Status::OK();
+}
+
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch, int64_t morsel_size,
+                                   arrow::MemoryPool* pool,
+                                   const ArrayDataVector& output_data_vecs) {
+  auto start = EvaluationCounters::Clock::now();
+  ARROW_RETURN_NOT_OK(EvaluateMorsels(batch, morsel_size, pool, output_data_vecs));
+  evaluation_counters_.Add(batch.num_rows(), start);
+  return Status::OK();
+}
+
+Status Projector::EvaluateMorsels(const arrow::RecordBatch& batch, int64_t morsel_size,
+                                  arrow::MemoryPool* pool,
+                                  const ArrayDataVector& output_data_vecs) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  ARROW_RETURN_IF(morsel_size <= 0, Status::Invalid("Morsel size must be positive."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+  ARROW_RETURN_NOT_OK(ValidateOutputArrays(output_data_vecs, batch.num_rows()));
+
+  LLVMGenerator* llvm_generator;
+  ARROW_RETURN_NOT_OK(GetLLVMGenerator(false, &llvm_generator));
+  if (llvm_generator == nullptr) {
+    return kernel_evaluator_->Evaluate(batch, output_data_vecs);
+  }
+
+  // Morsels start at multiples of 64 rows, so that no two morsels write to the same
+  // word of an output bitmap.
+  morsel_size = arrow::BitUtil::RoundUp(morsel_size, 64);
+  int64_t num_rows = batch.num_rows();
+  if (num_rows <= morsel_size) {
+    return llvm_generator->Execute(batch, output_data_vecs);
+  }
+  auto num_morsels = static_cast<int>(arrow::BitUtil::CeilDiv(num_rows, morsel_size));
+
+  // The size of a variable-width output is only known once it is evaluated, so each
+  // morsel writes these outputs to scratch arrays.
+  std::vector<ArrayDataVector> scratch(num_morsels,
+                                       ArrayDataVector(output_fields_.size()));
+  auto evaluate_morsel = [&](int morsel) {
+    int64_t offset = morsel * morsel_size;
+    int64_t length = std::min(morsel_size, num_rows - offset);
+    ArrayDataVector morsel_data_vecs;
+    for (size_t idx = 0; idx < output_fields_.size(); ++idx) {
+      const auto& type = output_fields_[idx]->type();
+      if (arrow::is_binary_like(type->id())) {
+        ARROW_RETURN_NOT_OK(AllocArrayData(type, length, pool, &scratch[morsel][idx]));
+        morsel_data_vecs.push_back(scratch[morsel][idx]);
+      } else {
+        morsel_data_vecs.push_back(
+            SliceFixedWidthOutput(*output_data_vecs[idx], offset, length));
+      }
+    }
+    return llvm_generator->Execute(*batch.Slice(offset, length), morsel_data_vecs);
+  };
+  ARROW_RETURN_NOT_OK(arrow::internal::ParallelFor(num_morsels, evaluate_morsel));
+
+  for (size_t idx = 0; idx < output_fields_.size(); ++idx) {
+    if (arrow::is_binary_like(output_fields_[idx]->type()->id())) {
+      ARROW_RETURN_NOT_OK(
+          MergeVarWidthOutput(scratch, idx, morsel_size, output_data_vecs[idx].get()));
+    }
+  }
+  return Status::OK();
+}
+
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch, int64_t morsel_size,
+                                   arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  // Allocate the output data vecs.
+  ArrayDataVector output_data_vecs;
+  for (auto& field : output_fields_) {
+    ArrayDataPtr output_data;
+    ARROW_RETURN_NOT_OK(
+        AllocArrayData(field->type(), batch.num_rows(), pool, &output_data));
+    output_data_vecs.push_back(output_data);
+  }
+
+  ARROW_RETURN_NOT_OK(EvaluateParallel(batch, morsel_size, pool, output_data_vecs));
+
+  output->clear();
+  for (auto& array_data : output_data_vecs) {
+    output->push_back(arrow::MakeArray(array_data));
+  }
+  return Status::OK();
+}
+
+ExecutionStats Projector::GetExecutionStats() const {
+  ExecutionStats stats;
+  if (compiled_.load()) {
+    stats.compile_time_ns = llvm_generator_->build_time_ns();
+    stats.object_code_cache_hit = llvm_generator_->loaded_from_object_cache();
+  }
+  evaluation_counters_.CopyTo(&stats);
+  return stats;
+}
+
+CacheStats Projector::GetCacheStats() { return GetProjectorCache().GetStats(); }
+
+Status Projector::WaitForCompilation() {
+  LLVMGenerator* llvm_generator;
+  return GetLLVMGenerator(true, &llvm_generator);
+}
+
+Status Projector::GetLLVMGenerator(bool wait, LLVMGenerator** llvm_generator) {
+  if (!compiled_.load()) {
+    std::lock_guard<std::mutex> lock(compilation_mutex_);
+    ARROW_RETURN_NOT_OK(compilation_status_);
+    if (!compiled_.load()) {
+      if (!wait && compilation_.wait_for(std::chrono::seconds(0)) !=
+                       std::future_status::ready) {
+        *llvm_generator = nullptr;
+        return Status::OK();
+      }
+      auto result = compilation_.get();
+      compilation_status_ = result.status();
+      ARROW_RETURN_NOT_OK(compilation_status_);
+      llvm_generator_ = std::move(result).ValueOrDie();
+      compiled_.store(true);
+    }
+  }
+  *llvm_generator = llvm_generator_.get();
   return Status::OK();
 }
 
@@ -224,6 +485,30 @@ Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch) {
   return Status::OK();
 }
 
+Status Projector::ValidateOutputArrays(const ArrayDataVector& output_data_vecs,
+                                       int64_t num_records) {
+  if (output_data_vecs.size() != output_fields_.size()) {
+    std::stringstream ss;
+    ss << "number of buffers for output_data_vecs is " << output_data_vecs.size()
+       << ", expected " << output_fields_.size();
+    return Status::Invalid(ss.str());
+  }
+
+  int idx = 0;
+  for (auto& array_data : output_data_vecs) {
+    if (array_data == nullptr) {
+      std::stringstream ss;
+      ss << "array for output field " << output_fields_[idx]->name() << "is null.";
+      return Status::Invalid(ss.str());
+    }
+
+    ARROW_RETURN_NOT_OK(
+        ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_records));
+    ++idx;
+  }
+  return Status::OK();
+}
+
 Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
                                             const arrow::Field& field,
                                             int64_t num_records) {
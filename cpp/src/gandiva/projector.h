@@ -17,21 +17,27 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
+#include "gandiva/execution_stats.h"
 #include "gandiva/expression.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
 
+class KernelEvaluator;
 class LLVMGenerator;
 
 /// \brief projection using expressions.
@@ -117,13 +123,66 @@ class GANDIVA_EXPORT Projector {
   Status Evaluate(const arrow::RecordBatch& batch,
                   const SelectionVector* selection_vector, const ArrayDataVector& output);
 
+  /// Evaluate the specified record batch on the CPU thread pool, and populate the
+  /// output arrays. The batch is split into morsels of 'morsel_size' rows (rounded up
+  /// to a multiple of 64), which are evaluated in parallel into disjoint slices of the
+  /// output arrays. Variable-width outputs are first evaluated into a scratch array
+  /// per morsel, and then copied into the output once their sizes are known.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] morsel_size number of rows evaluated by each task.
+  /// \param[in] pool memory pool used to allocate the scratch arrays.
+  /// \param[in,out] output vector of arrays, the arrays are allocated by the caller and
+  ///                populated by EvaluateParallel.
+  Status EvaluateParallel(const arrow::RecordBatch& batch, int64_t morsel_size,
+                          arrow::MemoryPool* pool, const ArrayDataVector& output);
+
+  /// Evaluate the specified record batch on the CPU thread pool, and return the
+  /// allocated and populated output arrays. See the overload above.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] morsel_size number of rows evaluated by each task.
+  /// \param[in] pool memory pool used to allocate output and scratch arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status EvaluateParallel(const arrow::RecordBatch& batch, int64_t morsel_size,
+                          arrow::MemoryPool* pool, arrow::ArrayVector* output);
+
+  /// Wait until the LLVM code of a projector built with background compilation
+  /// is ready, and return the status of the compilation. Returns immediately for
+  /// other projectors.
+  Status WaitForCompilation();
+
+  /// Get the compilation and evaluation statistics of this projector. Make() may
+  /// return a cached projector, which then shares its statistics.
+  ExecutionStats GetExecutionStats() const;
+
+  /// Get the hits and misses of the cache of projectors used by Make().
+  static CacheStats GetCacheStats();
+
+  /// Whether batches are evaluated with the LLVM code, rather than the Arrow
+  /// compute kernels used until the background compilation finishes.
+  bool is_compiled() const { return compiled_.load(); }
+
  private:
+  using LLVMGeneratorResult = arrow::Result<std::unique_ptr<LLVMGenerator>>;
+
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
+  /// Build a projector that uses 'kernel_evaluator' until 'compilation' is ready.
+  Projector(std::unique_ptr<KernelEvaluator> kernel_evaluator,
+            std::future<LLVMGeneratorResult> compilation, SchemaPtr schema,
+            const FieldVector& output_fields, std::shared_ptr<Configuration>);
+
+  /// Get the generator if the compilation has finished, or if 'wait' is true.
+  /// Otherwise sets 'llvm_generator' to null.
+  Status GetLLVMGenerator(bool wait, LLVMGenerator** llvm_generator);
+
+  friend class FilterProjector;
+
   /// Allocate an ArrowData of length 'length'.
-  Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                        arrow::MemoryPool* pool, ArrayDataPtr* array_data);
+  static Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
+                               arrow::MemoryPool* pool, ArrayDataPtr* array_data);
 
   /// Validate that the ArrayData has sufficient capacity to accomodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
@@ -132,10 +191,27 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  /// Evaluate the batch for EvaluateParallel().
+  Status EvaluateMorsels(const arrow::RecordBatch& batch, int64_t morsel_size,
+                         arrow::MemoryPool* pool, const ArrayDataVector& output);
+
+  /// Validate the number and capacity of caller-allocated output arrays.
+  Status ValidateOutputArrays(const ArrayDataVector& output, int64_t num_records);
+
+  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  const std::unique_ptr<KernelEvaluator> kernel_evaluator_;
+
+  // Set once llvm_generator_ can be used, compilation_ is then no longer valid.
+  std::atomic<bool> compiled_;
+  std::mutex compilation_mutex_;
+  std::future<LLVMGeneratorResult> compilation_;
+  Status compilation_status_;
+
   const SchemaPtr schema_;
   const FieldVector output_fields_;
   const std::shared_ptr<Configuration> configuration_;
+
+  EvaluationCounters evaluation_counters_;
 };
 
 }  // namespace gandiva
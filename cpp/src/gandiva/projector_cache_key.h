@@ -96,6 +96,7 @@ class ProjectorCacheKey {
       ss << expr;
     }
     ss << "]";
+    ss << " Mode: " << static_cast<int>(mode_);
     return ss.str();
   }
 
@@ -128,6 +128,72 @@ TEST_F(TestDecimal, TestSimple) {
   EXPECT_ARROW_ARRAY_EQUALS(expected, outputs[0]);
 }
 
+TEST_F(TestDecimal, TestArithmeticFastPaths) {
+  // The precisions are small enough for multiply, divide and mod to be evaluated
+  // without falling back to the pre-compiled functions.
+  auto type_a = std::make_shared<arrow::Decimal128Type>(10, 2);
+  auto type_b = std::make_shared<arrow::Decimal128Type>(8, 3);
+  auto field_a = field("a", type_a);
+  auto field_b = field("b", type_b);
+  auto schema = arrow::schema({field_a, field_b});
+
+  Decimal128TypePtr multiply_type;
+  Decimal128TypePtr divide_type;
+  Decimal128TypePtr mod_type;
+  ASSERT_OK(DecimalTypeUtil::GetResultType(DecimalTypeUtil::kOpMultiply,
+                                           {type_a, type_b}, &multiply_type));
+  ASSERT_OK(DecimalTypeUtil::GetResultType(DecimalTypeUtil::kOpDivide, {type_a, type_b},
+                                           &divide_type));
+  ASSERT_OK(DecimalTypeUtil::GetResultType(DecimalTypeUtil::kOpMod, {type_a, type_b},
+                                           &mod_type));
+
+  auto node_a = TreeExprBuilder::MakeField(field_a);
+  auto node_b = TreeExprBuilder::MakeField(field_b);
+  auto multiply = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("multiply", {node_a, node_b}, multiply_type),
+      field("multiply", multiply_type));
+  auto divide = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("divide", {node_a, node_b}, divide_type),
+      field("divide", divide_type));
+  auto mod = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("mod", {node_a, node_b}, mod_type),
+      field("mod", mod_type));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(
+      Projector::Make(schema, {multiply, divide, mod}, TestConfiguration(), &projector));
+
+  int num_records = 4;
+  auto array_a = MakeArrowArrayDecimal(
+      type_a, MakeDecimalVector({"12.34", "-7.50", "100.00", "-0.05"}, 2),
+      {true, true, true, true});
+  auto array_b = MakeArrowArrayDecimal(
+      type_b, MakeDecimalVector({"1.500", "2.000", "-3.000", "0.030"}, 3),
+      {true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array_a, array_b});
+
+  auto expected_multiply = MakeArrowArrayDecimal(
+      multiply_type,
+      MakeDecimalVector({"18.51", "-15.00", "-300.00", "-0.0015"},
+                        multiply_type->scale()),
+      {true, true, true, true});
+  // The quotients are rounded half away from zero.
+  auto expected_divide = MakeArrowArrayDecimal(
+      divide_type,
+      MakeDecimalVector({"8.22666666667", "-3.75", "-33.33333333333", "-1.66666666667"},
+                        divide_type->scale()),
+      {true, true, true, true});
+  auto expected_mod = MakeArrowArrayDecimal(
+      mod_type, MakeDecimalVector({"0.34", "-1.5", "1", "-0.02"}, mod_type->scale()),
+      {true, true, true, true});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(expected_multiply, outputs[0]);
+  EXPECT_ARROW_ARRAY_EQUALS(expected_divide, outputs[1]);
+  EXPECT_ARROW_ARRAY_EQUALS(expected_mod, outputs[2]);
+}
+
 TEST_F(TestDecimal, TestLiteral) {
   // schema for input fields
   constexpr int32_t precision = 36;
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
 #include "gandiva/filter.h"
+#include "gandiva/filter_projector.h"
 #include "gandiva/projector.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/tests/test_util.h"
@@ -273,4 +274,85 @@ TEST_F(TestFilterProject, TestSimpleIf) {
   // Validate results
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
+
+TEST_F(TestFilterProject, TestFused) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", int32());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // output fields
+  auto field_sum = field("sum", int32());
+  auto field_min = field("min", int32());
+
+  // Build condition f0 < f1, and the expressions f1 + f2 and if (f1 < f2) f1 else f2
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto node_f2 = TreeExprBuilder::MakeField(field2);
+  auto less_than_function =
+      TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1}, boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_function);
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field1, field2}, field_sum);
+  auto project_condition =
+      TreeExprBuilder::MakeFunction("less_than", {node_f1, node_f2}, boolean());
+  auto if_node = TreeExprBuilder::MakeIf(project_condition, node_f1, node_f2, int32());
+  auto min_expr = TreeExprBuilder::MakeExpression(if_node, field_min);
+
+  std::shared_ptr<FilterProjector> filter_projector;
+  auto status =
+      FilterProjector::Make(schema, condition, {sum_expr, min_expr},
+                            SelectionVector::MODE_UINT16, TestConfiguration(),
+                            &filter_projector);
+  ASSERT_OK(status);
+
+  // Create a row-batch with some sample data
+  int num_records = 6;
+  auto array0 = MakeArrowArrayInt32({1, 2, 6, 40, 3, 7},
+                                    {true, true, true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({5, 9, 3, 17, 6, 8},
+                                    {true, true, true, true, true, true});
+  auto array2 = MakeArrowArrayInt32({1, 12, 6, 40, 3, 1},
+                                    {true, true, true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({6, 21, 0}, {true, true, false});
+  auto exp_min = MakeArrowArrayInt32({1, 9, 0}, {true, true, false});
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  ASSERT_OK(status);
+
+  // Evaluate the condition and expressions
+  arrow::ArrayVector outputs;
+  status = filter_projector->Evaluate(*in_batch, selection_vector, pool_, &outputs);
+  ASSERT_OK(status);
+
+  // Validate results
+  ASSERT_EQ(selection_vector->GetNumSlots(), 3);
+  EXPECT_EQ(selection_vector->GetIndex(0), 0);
+  EXPECT_EQ(selection_vector->GetIndex(1), 1);
+  EXPECT_EQ(selection_vector->GetIndex(2), 4);
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_min, outputs.at(1));
+}
+
+TEST_F(TestFilterProject, TestFusedRequiresSelectionVector) {
+  auto field0 = field("f0", int32());
+  auto schema = arrow::schema({field0});
+
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_0 = TreeExprBuilder::MakeLiteral(0);
+  auto greater_than_function =
+      TreeExprBuilder::MakeFunction("greater_than", {node_f0, literal_0}, boolean());
+  auto condition = TreeExprBuilder::MakeCondition(greater_than_function);
+  auto expr = TreeExprBuilder::MakeExpression(node_f0, field("out", int32()));
+
+  std::shared_ptr<FilterProjector> filter_projector;
+  auto status =
+      FilterProjector::Make(schema, condition, {expr}, SelectionVector::MODE_NONE,
+                            TestConfiguration(), &filter_projector);
+  EXPECT_TRUE(status.IsInvalid());
+}
 }  // namespace gandiva
@@ -123,6 +123,54 @@ TEST_F(TestFilter, TestSimple) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestExecutionStats) {
+  // schema for input fields
+  auto field0 = field("stats_f0", int32());
+  auto schema = arrow::schema({field0});
+
+  // Build condition stats_f0 < 10
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_10 = TreeExprBuilder::MakeLiteral((int32_t)10);
+  auto less_than_10 = TreeExprBuilder::MakeFunction("less_than", {node_f0, literal_10},
+                                                    arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_10);
+
+  auto cache_stats = Filter::GetCacheStats();
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(Filter::GetCacheStats().misses, cache_stats.misses + 1);
+
+  auto stats = filter->GetExecutionStats();
+  EXPECT_GT(stats.compile_time_ns, 0);
+  EXPECT_EQ(stats.num_batches, 0);
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 20, 3, 40, 6}, {true, true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  EXPECT_TRUE(status.ok());
+
+  // Evaluate expression twice
+  EXPECT_TRUE(filter->Evaluate(*in_batch, selection_vector).ok());
+  EXPECT_TRUE(filter->Evaluate(*in_batch, selection_vector).ok());
+
+  stats = filter->GetExecutionStats();
+  EXPECT_EQ(stats.num_batches, 2);
+  EXPECT_EQ(stats.num_rows, 2 * num_records);
+  EXPECT_GT(stats.eval_time_ns, 0);
+
+  // The second filter comes from the cache, and shares the statistics.
+  std::shared_ptr<Filter> cached_filter;
+  status = Filter::Make(schema, condition, TestConfiguration(), &cached_filter);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(Filter::GetCacheStats().hits, cache_stats.hits + 1);
+  EXPECT_EQ(cached_filter->GetExecutionStats().num_batches, 2);
+}
+
 TEST_F(TestFilter, TestSimpleCustomConfig) {
   // schema for input fields
   auto field0 = field("f0", int32());
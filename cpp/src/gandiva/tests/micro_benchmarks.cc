@@ -390,6 +390,36 @@ static void DecimalAdd3Large(benchmark::State& state) {
   DoDecimalAdd3(state, DecimalTypeUtil::kMaxPrecision, 18, true);
 }
 
+static void TimedTestBuildProjector(benchmark::State& state) {
+  // schema for input fields
+  auto field0 = field("f0", int64());
+  auto field1 = field("f1", int64());
+  auto schema = arrow::schema({field0, field1});
+
+  // output field
+  auto field_sum = field("add", int64());
+
+  // Measure code generation and compilation only: no object code cache, and a
+  // different literal in each iteration so the projector cache always misses.
+  auto configuration = ConfigurationBuilder()
+                           .set_object_cache_directory("")
+                           .set_optimization_level(static_cast<int>(state.range(0)))
+                           .build();
+  int64_t literal = 0;
+  for (auto _ : state) {
+    auto part_sum = TreeExprBuilder::MakeFunction(
+        "add",
+        {TreeExprBuilder::MakeField(field1), TreeExprBuilder::MakeLiteral(literal++)},
+        int64());
+    auto sum = TreeExprBuilder::MakeFunction(
+        "add", {TreeExprBuilder::MakeField(field0), part_sum}, int64());
+    auto sum_expr = TreeExprBuilder::MakeExpression(sum, field_sum);
+
+    std::shared_ptr<Projector> projector;
+    ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+  }
+}
+
 BENCHMARK(TimedTestAdd3)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestBigNested)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestExtractYear)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
@@ -406,5 +436,10 @@ BENCHMARK(DecimalAdd3Fast)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd3LeadingZeroes)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd3LeadingZeroesWithDiv)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(DecimalAdd3Large)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestBuildProjector)
+    ->Arg(0)
+    ->Arg(3)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMillisecond);
 
 }  // namespace gandiva
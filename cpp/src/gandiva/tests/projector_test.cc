@@ -16,6 +16,8 @@
 // under the License.
 
 #include <cmath>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -248,6 +250,228 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestSharedSubExprs) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_mul = field("multiply", int32());
+  auto field_sub = field("subtract", int32());
+  auto field_sum = field("add", int32());
+
+  // Build expressions that share (f0 + f1), and one with a literal-only subtree
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto node1 = TreeExprBuilder::MakeField(field1);
+  auto shared_sum = TreeExprBuilder::MakeFunction("add", {node0, node1}, int32());
+  auto mul_node =
+      TreeExprBuilder::MakeFunction("multiply", {shared_sum, node0}, int32());
+  auto sub_node =
+      TreeExprBuilder::MakeFunction("subtract", {shared_sum, node1}, int32());
+  auto constant = TreeExprBuilder::MakeFunction(
+      "multiply", {TreeExprBuilder::MakeLiteral(2), TreeExprBuilder::MakeLiteral(3)},
+      int32());
+  auto sum_node = TreeExprBuilder::MakeFunction("add", {node0, constant}, int32());
+
+  auto mul_expr = TreeExprBuilder::MakeExpression(mul_node, field_mul);
+  auto sub_expr = TreeExprBuilder::MakeExpression(sub_node, field_sub);
+  auto sum_expr = TreeExprBuilder::MakeExpression(sum_node, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {mul_expr, sub_expr, sum_expr},
+                                TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_mul = MakeArrowArrayInt32({12, 30, 0, 0}, {true, true, false, false});
+  auto exp_sub = MakeArrowArrayInt32({1, 2, 0, 0}, {true, true, false, false});
+  auto exp_sum = MakeArrowArrayInt32({7, 8, 9, 0}, {true, true, true, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_TRUE(status.ok());
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp_mul, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(2));
+}
+
+TEST_F(TestProjector, TestEvaluateParallel) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", arrow::utf8());
+  auto field3 = field("f3", arrow::utf8());
+  auto schema = arrow::schema({field0, field1, field2, field3});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_concat = field("concat", arrow::utf8());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto concat_expr =
+      TreeExprBuilder::MakeExpression("concatOperator", {field2, field3}, field_concat);
+
+  std::shared_ptr<Projector> projector;
+  auto status =
+      Projector::Make(schema, {sum_expr, concat_expr}, TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch with some sample data, spanning several morsels
+  int num_records = 1000;
+  std::vector<int32_t> values0, values1, sums;
+  std::vector<std::string> values2, values3, concats;
+  std::vector<bool> validity0, validity1, exp_validity;
+  for (int i = 0; i < num_records; ++i) {
+    values0.push_back(i);
+    values1.push_back(2 * i);
+    sums.push_back(3 * i);
+    values2.push_back(std::string(i % 7, 'a'));
+    values3.push_back(std::to_string(i));
+    concats.push_back(values2.back() + values3.back());
+    validity0.push_back(i % 5 != 0);
+    validity1.push_back(i % 3 != 0);
+    exp_validity.push_back(validity0.back() && validity1.back());
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1, validity1);
+  auto array2 = MakeArrowArrayUtf8(values2, validity0);
+  auto array3 = MakeArrowArrayUtf8(values3, validity1);
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32(sums, exp_validity);
+  auto exp_concat = MakeArrowArrayUtf8(concats, exp_validity);
+
+  // prepare input record batch
+  auto in_batch =
+      arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2, array3});
+
+  // Evaluate expression, the morsel size is rounded up to 128 rows
+  arrow::ArrayVector outputs;
+  status = projector->EvaluateParallel(*in_batch, 100, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_concat, outputs.at(1));
+
+  status = projector->EvaluateParallel(*in_batch, 0, pool_, &outputs);
+  EXPECT_TRUE(status.IsInvalid());
+}
+
+TEST_F(TestProjector, TestExecutionStats) {
+  // schema for input fields
+  auto field0 = field("stats_f0", int32());
+  auto field1 = field("stats_f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto cache_stats = Projector::GetCacheStats();
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(Projector::GetCacheStats().misses, cache_stats.misses + 1);
+
+  auto stats = projector->GetExecutionStats();
+  EXPECT_GT(stats.compile_time_ns, 0);
+  EXPECT_EQ(stats.num_batches, 0);
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression twice
+  arrow::ArrayVector outputs;
+  EXPECT_TRUE(projector->Evaluate(*in_batch, pool_, &outputs).ok());
+  EXPECT_TRUE(projector->Evaluate(*in_batch, pool_, &outputs).ok());
+
+  stats = projector->GetExecutionStats();
+  EXPECT_EQ(stats.num_batches, 2);
+  EXPECT_EQ(stats.num_rows, 2 * num_records);
+  EXPECT_GT(stats.eval_time_ns, 0);
+
+  // The second projector comes from the cache, and shares the statistics.
+  std::shared_ptr<Projector> cached_projector;
+  status = Projector::Make(schema, {sum_expr}, TestConfiguration(), &cached_projector);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(Projector::GetCacheStats().hits, cache_stats.hits + 1);
+  EXPECT_EQ(cached_projector->GetExecutionStats().num_batches, 2);
+}
+
+TEST_F(TestProjector, TestBackgroundCompilation) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_less = field("less_than", boolean());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto less_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field0, field1}, field_less);
+
+  auto configuration = ConfigurationBuilder().set_background_compilation(true).build();
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr, less_expr}, configuration, &projector);
+  ASSERT_OK(status);
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 20, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({12, 33, 0, 0}, {true, true, false, false});
+  auto exp_less =
+      MakeArrowArrayBool({true, false, false, false}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // The results are the same before and after the compilation finishes.
+  for (int i = 0; i < 2; i++) {
+    arrow::ArrayVector outputs;
+    status = projector->Evaluate(*in_batch, pool_, &outputs);
+    ASSERT_OK(status);
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_less, outputs.at(1));
+
+    ASSERT_OK(projector->WaitForCompilation());
+    EXPECT_TRUE(projector->is_compiled());
+  }
+
+  // Expressions without a kernel are compiled in Make().
+  auto literal = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(0));
+  auto less_than_node = TreeExprBuilder::MakeFunction(
+      "less_than", {TreeExprBuilder::MakeField(field0), literal}, boolean());
+  auto if_node = TreeExprBuilder::MakeIf(less_than_node, literal,
+                                         TreeExprBuilder::MakeField(field0), int32());
+  auto if_expr = TreeExprBuilder::MakeExpression(if_node, field("if", int32()));
+  std::shared_ptr<Projector> if_projector;
+  status = Projector::Make(schema, {if_expr}, configuration, &if_projector);
+  ASSERT_OK(status);
+  EXPECT_TRUE(if_projector->is_compiled());
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
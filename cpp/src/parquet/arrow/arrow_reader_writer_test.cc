@@ -1876,6 +1876,67 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto arrow_writer_properties =
+      ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, num_rows / 3, &result,
+                                      ::parquet::default_writer_properties(),
+                                      arrow_writer_properties));
+
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatchesByMemoryBudget) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+  const int64_t kMaxRowGroupBytes = 100000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 10, &table));
+
+  auto sink = CreateOutputStream();
+  auto write_props =
+      WriterProperties::Builder().disable_dictionary()->write_batch_size(100)->build();
+  auto arrow_writer_properties =
+      ArrowWriterProperties::Builder().max_row_group_bytes(kMaxRowGroupBytes)->build();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                      sink, write_props, arrow_writer_properties,
+                                      &writer));
+
+  ::arrow::TableBatchReader batch_reader(*table);
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  ASSERT_OK(batch_reader.ReadNext(&batch));
+  while (batch != nullptr) {
+    ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+    // The budget is checked after each slice of write_batch_size rows, which
+    // holds at most 10 bytes of values and levels per row and column
+    ASSERT_LT(writer->buffered_bytes(), kMaxRowGroupBytes + 2 * 100 * num_columns * 10);
+    ASSERT_OK(batch_reader.ReadNext(&batch));
+  }
+  ASSERT_GT(writer->buffered_bytes(), 0);
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  // About 80 kB of values, levels and page headers for every 2000 rows
+  ASSERT_GT(reader->num_row_groups(), 3);
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1911,6 +1972,207 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   ASSERT_TRUE(table->Equals(*concatenated));
 }
 
+TEST(TestArrowReadWrite, ReadSelectedRecords) {
+  const int64_t num_rows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  // Null, empty and lists of up to 3 items
+  std::string lists_json = "[";
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (i % 7 == 0) {
+      lists_json += "null,";
+      continue;
+    }
+    lists_json += "[";
+    for (int64_t j = 0; j < i % 4; ++j) {
+      lists_json += std::to_string(i + j) + (j + 1 < i % 4 ? "," : "");
+    }
+    lists_json += "],";
+  }
+  lists_json.back() = ']';
+  auto list_type = ::arrow::list(::arrow::int32());
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("i64", ::arrow::int64()),
+                       ::arrow::field("str", ::arrow::utf8()),
+                       ::arrow::field("i32", ::arrow::int32(), /*nullable=*/false),
+                       ::arrow::field("list", list_type)}),
+      {rag.Int64(num_rows, 0, 100, 0.1), rag.String(num_rows, 0, 20, 0.2),
+       rag.Int32(num_rows, 0, 100, 0), ArrayFromJSON(list_type, lists_json)});
+
+  // Small pages, so that runs of selected records start and end within pages
+  // as well as cover whole pages
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .disable_dictionary()
+                         ->data_pagesize(256)
+                         ->write_batch_size(50)
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(1, reader->num_row_groups());
+
+  for (double probability : {0.0, 0.05, 0.5, 0.95, 1.0}) {
+    auto selection = std::static_pointer_cast<::arrow::BooleanArray>(
+        rag.Boolean(num_rows, probability, 0.1));
+    // Nulls do not select records
+    std::shared_ptr<Array> filter;
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      ASSERT_OK(builder.Append(selection->IsValid(i) && selection->Value(i)));
+    }
+    ASSERT_OK(builder.Finish(&filter));
+    ::arrow::compute::FunctionContext ctx;
+    std::shared_ptr<Table> expected;
+    ASSERT_OK(::arrow::compute::Filter(&ctx, *table, *filter, &expected));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadRowGroup(0, {0, 1, 2, 3}, *selection, &result));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false));
+  }
+
+  auto short_selection =
+      std::static_pointer_cast<::arrow::BooleanArray>(rag.Boolean(10, 0.5, 0));
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, reader->ReadRowGroup(0, {0}, *short_selection, &result));
+}
+
+TEST(TestArrowReadWrite, ReadWithPreBuffer) {
+  const int num_columns = 10;
+  const int num_rows = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ::arrow::io::CacheOptions no_coalescing = ::arrow::io::CacheOptions::Defaults();
+  no_coalescing.hole_size_limit = 0;
+  no_coalescing.range_size_limit = 1;
+
+  for (const auto& cache_options :
+       {::arrow::io::CacheOptions::Defaults(), no_coalescing}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(true);
+    properties.set_cache_options(cache_options);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    ASSERT_EQ(2, reader->num_row_groups());
+
+    // Read everything
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({0, 1}, &actual));
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+    // Read a subset of columns from the second row group
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({1}, {2, 5, 7}, &actual));
+    std::shared_ptr<Table> second_rowgroup = table->Slice(num_rows / 2);
+    std::vector<std::shared_ptr<::arrow::Field>> expected_fields;
+    std::vector<std::shared_ptr<ChunkedArray>> expected_columns;
+    for (int i : {2, 5, 7}) {
+      expected_fields.push_back(second_rowgroup->schema()->field(i));
+      expected_columns.push_back(second_rowgroup->column(i));
+    }
+    auto expected = Table::Make(::arrow::schema(expected_fields), expected_columns);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // Read through a RecordBatchReader
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&actual));
+    AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(TestArrowReadWrite, ReadZeroCopyValues) {
+  const int num_rows = 10000;
+
+  std::vector<int64_t> int_values(num_rows);
+  std::vector<double> double_values(num_rows);
+  std::vector<bool> is_valid(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    int_values[i] = i * 3;
+    double_values[i] = i / 7.0;
+    is_valid[i] = i % 5 != 0;
+  }
+  std::shared_ptr<Array> a0, a1, a2;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(int_values, &a0);
+  ::arrow::ArrayFromVector<::arrow::DoubleType, double>(double_values, &a1);
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(is_valid, int_values, &a2);
+  auto schema =
+      ::arrow::schema({::arrow::field("required_int", ::arrow::int64(), false),
+                       ::arrow::field("required_double", ::arrow::float64(), false),
+                       ::arrow::field("optional_int", ::arrow::int64())});
+  auto table = Table::Make(schema, {a0, a1, a2});
+
+  std::vector<Compression::type> codecs = {Compression::UNCOMPRESSED};
+#ifdef ARROW_WITH_SNAPPY
+  codecs.push_back(Compression::SNAPPY);
+#endif
+  for (const auto codec : codecs) {
+    auto writer_properties = WriterProperties::Builder()
+                                 .disable_dictionary()
+                                 ->compression(codec)
+                                 ->data_pagesize(4096)
+                                 ->write_batch_size(100)
+                                 ->build();
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  num_rows / 2, writer_properties,
+                                  default_arrow_writer_properties()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    for (const bool prefetch : {false, true}) {
+      ReaderProperties reader_properties = default_reader_properties();
+      if (prefetch) {
+        reader_properties.enable_page_prefetch();
+      }
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_zero_copy_values(true);
+
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer), reader_properties));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+      std::shared_ptr<Table> actual;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+      AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+      // The optional column is decoded as usual
+      ASSERT_EQ(1, actual->column(2)->num_chunks());
+      if (codec != Compression::UNCOMPRESSED) {
+        // With prefetching, each page is decompressed into a new, aligned
+        // buffer which becomes a chunk of its own. Otherwise the buffer is
+        // reused and the values are copied.
+        ASSERT_EQ(prefetch, actual->column(0)->num_chunks() > 1);
+        ASSERT_EQ(prefetch, actual->column(1)->num_chunks() > 1);
+      } else {
+        // Pages read from the file buffer are sliced where their values are
+        // aligned, so any chunks beyond the first point into the file
+        const uint8_t* file_start = buffer->data();
+        const uint8_t* file_end = file_start + buffer->size();
+        bool any_sliced = false;
+        for (const auto& chunk : actual->column(0)->chunks()) {
+          const uint8_t* values = chunk->data()->buffers[1]->data();
+          any_sliced |= values >= file_start && values < file_end;
+        }
+        ASSERT_EQ(any_sliced, actual->column(0)->num_chunks() > 1);
+      }
+    }
+  }
+}
+
 TEST(TestArrowReadWrite, GetRecordBatchReader) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -1963,6 +2225,80 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderChunkedColumns) {
+  // A batch spanning two row groups of a string column read as dictionary
+  // comes out in one chunk per dictionary
+  const int num_rows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto values = rag.StringWithRepeats(num_rows, 20, 2, 10, /*null_probability=*/0.1);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(MakeSimpleTable(values, /*nullable=*/true),
+                                             num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  properties.set_batch_size(num_rows);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&expected));
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+  ASSERT_OK(rb_reader->ReadAll(&actual));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderBoundedMemory) {
+  const int num_rows = 100000;
+  const int batch_size = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(/*num_columns=*/2, num_rows, 1, &table));
+  auto writer_properties = WriterProperties::Builder()
+                               .disable_dictionary()
+                               ->data_pagesize(4096)
+                               ->write_batch_size(100)
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                writer_properties, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Pages are read through a small buffer and decoded a batch at a time, so
+  // that much less than the row group is held in memory at once
+  ::arrow::ProxyMemoryPool pool(::arrow::default_memory_pool());
+  ReaderProperties reader_properties(&pool);
+  reader_properties.enable_buffered_stream();
+  reader_properties.set_buffer_size(4096);
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(batch_size);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer), reader_properties));
+  ASSERT_OK(builder.memory_pool(&pool)->properties(properties)->Build(&reader));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0}, &rb_reader));
+  ::arrow::TableBatchReader table_reader(*table);
+  table_reader.set_chunksize(batch_size);
+  std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+  for (int i = 0; i < num_rows / batch_size; ++i) {
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_OK(table_reader.ReadNext(&expected_batch));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+  }
+  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+  ASSERT_EQ(nullptr, actual_batch);
+
+  const int64_t row_group_bytes = 2 * num_rows * static_cast<int64_t>(sizeof(double));
+  ASSERT_LT(pool.max_memory(), row_group_bytes / 10);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2861,6 +3197,50 @@ INSTANTIATE_TEST_CASE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionaryTypes, FixedWidthTypes) {
+  // Both row groups repeat the same values in the same order, so they have
+  // identical dictionary pages and are read into a single chunk
+  struct Case {
+    std::shared_ptr<DataType> type;
+    std::string json_dense;
+    std::string json_dictionary;
+  };
+  const std::vector<Case> cases = {
+      {::arrow::int32(), "[3, 1, null, 2, 3, 1, null, 2]", "[3, 1, 2]"},
+      {::arrow::int64(), "[3, 1, null, 2, 3, 1, null, 2]", "[3, 1, 2]"},
+      {::arrow::float32(), "[3.5, 1, null, 2, 3.5, 1, null, 2]", "[3.5, 1, 2]"},
+      {::arrow::float64(), "[3.5, 1, null, 2, 3.5, 1, null, 2]", "[3.5, 1, 2]"},
+      {::arrow::fixed_size_binary(3),
+       R"(["ccc", "aaa", null, "bbb", "ccc", "aaa", null, "bbb"])",
+       R"(["ccc", "aaa", "bbb"])"}};
+
+  for (const auto& test_case : cases) {
+    const auto& type = test_case.type;
+    auto dense = ::arrow::ArrayFromJSON(type, test_case.json_dense);
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(
+        WriteTableToBuffer(MakeSimpleTable(dense, /*nullable=*/true),
+                           dense->length() / 2, default_arrow_writer_properties(), &buffer));
+
+    auto properties = default_arrow_reader_properties();
+    properties.set_read_dictionary(0, true);
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(::arrow::DictionaryArray::FromArrays(
+        ::arrow::dictionary(::arrow::int32(), type),
+        ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, null, 2, 0, 1, null, 2]"),
+        ::arrow::ArrayFromJSON(type, test_case.json_dictionary), &expected));
+    ASSERT_EQ(1, actual->column(0)->num_chunks()) << type->ToString();
+    ::arrow::AssertArraysEqual(*expected, *actual->column(0)->chunk(0));
+  }
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -20,16 +20,21 @@
 #include <algorithm>
 #include <cstring>
 #include <future>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/filter.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
@@ -73,10 +78,46 @@ using parquet::internal::RecordReader;
 namespace parquet {
 namespace arrow {
 
+// A run of consecutive records selected for reading
+struct SelectedRun {
+  int64_t offset;
+  int64_t length;
+};
+
+static bool IsSelected(const BooleanArray& selection, int64_t i) {
+  return selection.IsValid(i) && selection.Value(i);
+}
+
+static std::vector<SelectedRun> GetSelectedRuns(const BooleanArray& selection) {
+  std::vector<SelectedRun> runs;
+  int64_t i = 0;
+  while (i < selection.length()) {
+    while (i < selection.length() && !IsSelected(selection, i)) {
+      ++i;
+    }
+    const int64_t offset = i;
+    while (i < selection.length() && IsSelected(selection, i)) {
+      ++i;
+    }
+    if (i > offset) {
+      runs.push_back({offset, i - offset});
+    }
+  }
+  return runs;
+}
+
 class ColumnReaderImpl : public ColumnReader {
  public:
   enum ReaderType { PRIMITIVE, LIST, STRUCT };
 
+  // Read the next num_records records, materializing only the records of the
+  // given runs, which are relative to the current position
+  virtual Status NextSelectedBatch(const std::vector<SelectedRun>& runs,
+                                   int64_t num_records,
+                                   std::shared_ptr<ChunkedArray>* out) {
+    return Status::NotImplemented("Skipping records of ", field()->ToString());
+  }
+
   virtual Status GetDefLevels(const int16_t** data, int64_t* length) = 0;
   virtual Status GetRepLevels(const int16_t** data, int64_t* length) = 0;
   virtual const std::shared_ptr<Field> field() = 0;
@@ -152,13 +193,15 @@ class FileReaderImpl : public FileReader {
 
   Status GetFieldReader(int i, const std::vector<int>& indices,
                         const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+                        std::unique_ptr<ColumnReaderImpl>* out,
+                        bool zero_copy_values = false) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
     ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
     ctx->filter_leaves = true;
     ctx->included_leaves.insert(indices.begin(), indices.end());
+    ctx->zero_copy_values = zero_copy_values;
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -171,7 +214,8 @@ class FileReaderImpl : public FileReader {
                          std::shared_ptr<ChunkedArray>* out) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     std::unique_ptr<ColumnReaderImpl> reader;
-    RETURN_NOT_OK(GetFieldReader(i, indices, row_groups, &reader));
+    RETURN_NOT_OK(GetFieldReader(i, indices, row_groups, &reader,
+                                 reader_properties_.zero_copy_values()));
 
     *out_field = reader->field();
 
@@ -244,6 +288,10 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                      const BooleanArray& selection,
+                      std::shared_ptr<Table>* out) override;
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -314,26 +362,39 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
     // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
     // does not currently honor the use_threads option.
+    if (pending_batches_ != nullptr) {
+      RETURN_NOT_OK(pending_batches_->ReadNext(out));
+      if (*out != nullptr) {
+        return Status::OK();
+      }
+      pending_batches_.reset();
+      pending_table_.reset();
+    }
+
+    // Each column reader decodes the next batch_size_ records only, so that
+    // no more than a batch is held in memory besides the pages being decoded
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
     for (size_t i = 0; i < field_readers_.size(); ++i) {
       RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
-        return Status::NotImplemented("This class cannot yet iterate chunked arrays");
-      }
     }
 
-    // Create an intermediate table and use TableBatchReader as an adaptor to a
-    // RecordBatch
-    std::shared_ptr<Table> table = Table::Make(schema_, columns);
-    RETURN_NOT_OK(table->Validate());
-    ::arrow::TableBatchReader table_batch_reader(*table);
-    return table_batch_reader.ReadNext(out);
+    // Columns may come out in several chunks (e.g. when the dictionary of a
+    // dictionary-encoded column changes), not necessarily at the same offsets:
+    // use TableBatchReader to hand out the batch in as many record batches as
+    // needed
+    pending_table_ = Table::Make(schema_, columns);
+    RETURN_NOT_OK(pending_table_->Validate());
+    pending_batches_.reset(new ::arrow::TableBatchReader(*pending_table_));
+    return pending_batches_->ReadNext(out);
   }
 
  private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  // The last batch read, while it is being handed out
+  std::shared_ptr<Table> pending_table_;
+  std::unique_ptr<::arrow::TableBatchReader> pending_batches_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -385,7 +446,8 @@ class LeafReader : public ColumnReaderImpl {
         input_(std::move(input)),
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
-        descr_, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+        descr_, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY,
+        ctx_->zero_copy_values && IsZeroCopyValueType(*field_->type()));
     NextRowGroup();
   }
 
@@ -424,6 +486,36 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status NextSelectedBatch(const std::vector<SelectedRun>& runs, int64_t num_records,
+                           std::shared_ptr<ChunkedArray>* out) override {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    int64_t num_selected = 0;
+    for (const auto& run : runs) {
+      num_selected += run.length;
+    }
+    record_reader_->Reserve(num_selected);
+
+    record_reader_->Reset();
+    int64_t position = 0;
+    for (const auto& run : runs) {
+      RETURN_NOT_OK(SkipRecords(run.offset - position));
+      int64_t records_to_read = run.length;
+      while (records_to_read > 0) {
+        int64_t records_read = record_reader_->ReadRecords(records_to_read);
+        if (records_read == 0) {
+          return Status::IOError("Column chunk ended before the selected records");
+        }
+        records_to_read -= records_read;
+      }
+      position = run.offset + run.length;
+    }
+    RETURN_NOT_OK(SkipRecords(num_records - position));
+    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                     ctx_->pool, out));
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
   const ColumnDescriptor* descr() const override { return descr_; }
 
@@ -435,6 +527,13 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  Status SkipRecords(int64_t num_records) {
+    if (num_records > 0 && record_reader_->SkipRecords(num_records) < num_records) {
+      return Status::IOError("Column chunk ended before the selected records");
+    }
+    return Status::OK();
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
@@ -462,11 +561,31 @@ class NestedListReader : public ColumnReaderImpl {
   }
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override {
+    return ReadLists(
+        [&]() { return item_reader_->NextBatch(records_to_read, out); }, out);
+  }
+
+  Status NextSelectedBatch(const std::vector<SelectedRun>& runs, int64_t num_records,
+                           std::shared_ptr<ChunkedArray>* out) override {
+    return ReadLists(
+        [&]() { return item_reader_->NextSelectedBatch(runs, num_records, out); }, out);
+  }
+
+  const std::shared_ptr<Field> field() override { return field_; }
+
+  const ColumnDescriptor* descr() const override { return nullptr; }
+
+  ReaderType type() const override { return LIST; }
+
+ private:
+  // Assemble the lists of the items and levels read by read_items
+  template <typename ReadItems>
+  Status ReadLists(ReadItems&& read_items, std::shared_ptr<ChunkedArray>* out) {
     if (item_reader_->type() == ColumnReaderImpl::STRUCT) {
       return Status::Invalid("Mix of struct and list types not yet supported");
     }
 
-    RETURN_NOT_OK(item_reader_->NextBatch(records_to_read, out));
+    RETURN_NOT_OK(read_items());
 
     // ARROW-3762(wesm): If item reader yields a chunked array, we reject as
     // this is not yet implemented
@@ -488,13 +607,6 @@ class NestedListReader : public ColumnReaderImpl {
     return Status::OK();
   }
 
-  const std::shared_ptr<Field> field() override { return field_; }
-
-  const ColumnDescriptor* descr() const override { return nullptr; }
-
-  ReaderType type() const override { return LIST; }
-
- private:
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   int16_t max_definition_level_;
@@ -515,6 +627,8 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
         children_(std::move(children)) {}
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
+  Status NextSelectedBatch(const std::vector<SelectedRun>& runs, int64_t num_records,
+                           std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
   Status GetRepLevels(const int16_t** data, int64_t* length) override;
   const std::shared_ptr<Field> field() override { return filtered_field_; }
@@ -529,6 +643,8 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
   std::vector<std::unique_ptr<ColumnReaderImpl>> children_;
   std::shared_ptr<ResizableBuffer> def_levels_buffer_;
   Status DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap, int64_t* null_count);
+  template <typename ReadChild>
+  Status ReadStructs(ReadChild&& read_child, std::shared_ptr<ChunkedArray>* out);
 };
 
 Status StructReader::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
@@ -641,6 +757,27 @@ Status StructReader::GetRepLevels(const int16_t** data, int64_t* length) {
 
 Status StructReader::NextBatch(int64_t records_to_read,
                                std::shared_ptr<ChunkedArray>* out) {
+  return ReadStructs(
+      [&](ColumnReaderImpl* child, std::shared_ptr<ChunkedArray>* field) {
+        return child->NextBatch(records_to_read, field);
+      },
+      out);
+}
+
+Status StructReader::NextSelectedBatch(const std::vector<SelectedRun>& runs,
+                                       int64_t num_records,
+                                       std::shared_ptr<ChunkedArray>* out) {
+  return ReadStructs(
+      [&](ColumnReaderImpl* child, std::shared_ptr<ChunkedArray>* field) {
+        return child->NextSelectedBatch(runs, num_records, field);
+      },
+      out);
+}
+
+// Assemble the structs of the children read by read_child
+template <typename ReadChild>
+Status StructReader::ReadStructs(ReadChild&& read_child,
+                                 std::shared_ptr<ChunkedArray>* out) {
   std::vector<std::shared_ptr<Array>> children_arrays;
   std::shared_ptr<Buffer> null_bitmap;
   int64_t null_count;
@@ -652,7 +789,7 @@ Status StructReader::NextBatch(int64_t records_to_read,
     }
 
     std::shared_ptr<ChunkedArray> field;
-    RETURN_NOT_OK(child->NextBatch(records_to_read, &field));
+    RETURN_NOT_OK(read_child(child.get(), &field));
 
     if (field->num_chunks() > 1) {
       return Status::Invalid("Chunked field reads not yet supported with StructArray");
@@ -711,6 +848,12 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
                                     child->max_repetition_level,
                                     std::move(child_reader)));
   } else if (type_id == ::arrow::Type::STRUCT) {
+    // Struct children must come out in one chunk
+    auto child_ctx = ctx;
+    if (ctx->zero_copy_values) {
+      child_ctx = std::make_shared<ReaderContext>(*ctx);
+      child_ctx->zero_copy_values = false;
+    }
     std::vector<std::shared_ptr<Field>> child_fields;
     std::vector<std::unique_ptr<ColumnReaderImpl>> child_readers;
     for (const auto& child : field.children) {
@@ -719,7 +862,7 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
         continue;
       }
       std::unique_ptr<ColumnReaderImpl> child_reader;
-      RETURN_NOT_OK(GetReader(child, ctx, &child_reader));
+      RETURN_NOT_OK(GetReader(child, child_ctx, &child_reader));
       if (!child_reader) {
         // If all children were pruned, then we do not try to read this field
         continue;
@@ -747,6 +890,13 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
   for (auto row_group_index : row_group_indices) {
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
+  if (reader_properties_.pre_buffer()) {
+    // Issue coalesced reads for the requested column chunks up front, if enabled
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->PreBuffer(row_group_indices, column_indices,
+                       reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
                                          reader_properties_.batch_size(), out);
 }
@@ -759,6 +909,7 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->pool = pool_;
   ctx->iterator_factory = AllRowGroupsFactory();
   ctx->filter_leaves = false;
+  ctx->zero_copy_values = reader_properties_.zero_copy_values();
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
   out->reset(result.release());
@@ -768,6 +919,8 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
 Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
                                      const std::vector<int>& indices,
                                      std::shared_ptr<Table>* out) {
+  ARROW_TRACE_SPAN_DETAIL("parquet", "ReadRowGroups",
+                          std::to_string(row_groups.size()) + " row groups");
   BEGIN_PARQUET_CATCH_EXCEPTIONS
 
   // We only need to read schema fields which have columns indicated
@@ -777,6 +930,14 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  // Issue coalesced reads for the requested column chunks up front, if enabled
+  if (reader_properties_.pre_buffer()) {
+    for (auto row_group_index : row_groups) {
+      RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+    }
+    reader_->PreBuffer(row_groups, indices, reader_properties_.cache_options());
+  }
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
@@ -812,6 +973,73 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+Status FileReaderImpl::ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                    const BooleanArray& selection,
+                                    std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheckRowGroup(i));
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  const int64_t num_records = reader_->metadata()->RowGroup(i)->num_rows();
+  if (selection.length() != num_records) {
+    return Status::Invalid("Selection of length ", selection.length(),
+                           " does not match the ", num_records,
+                           " records of row group ", i);
+  }
+
+  std::vector<int> field_indices;
+  if (!manifest_.GetFieldIndices(column_indices, &field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    reader_->PreBuffer({i}, column_indices, reader_properties_.cache_options());
+  }
+
+  const std::vector<SelectedRun> runs = GetSelectedRuns(selection);
+
+  // Readers which cannot skip records filter the whole row group, with nulls
+  // of the selection treated as unselected
+  std::shared_ptr<Array> filter;
+  auto FilterColumn = [&](ColumnReaderImpl* reader, std::shared_ptr<ChunkedArray>* out) {
+    std::shared_ptr<ChunkedArray> column;
+    RETURN_NOT_OK(reader->NextBatch(num_records, &column));
+    if (filter == nullptr) {
+      if (selection.null_count() == 0) {
+        filter = std::make_shared<BooleanArray>(selection.data());
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            auto filter_bits,
+            ::arrow::internal::BitmapAnd(pool_, selection.values()->data(),
+                                         selection.offset(), selection.null_bitmap_data(),
+                                         selection.offset(), num_records, 0));
+        filter = std::make_shared<BooleanArray>(num_records, filter_bits);
+      }
+    }
+    ::arrow::compute::FunctionContext ctx(pool_);
+    return ::arrow::compute::Filter(&ctx, *column, *filter, out);
+  };
+
+  int num_fields = static_cast<int>(field_indices.size());
+  std::vector<std::shared_ptr<Field>> fields(num_fields);
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
+  for (int j = 0; j < num_fields; ++j) {
+    std::unique_ptr<ColumnReaderImpl> reader;
+    RETURN_NOT_OK(GetFieldReader(field_indices[j], column_indices, {i}, &reader,
+                                 reader_properties_.zero_copy_values()));
+    fields[j] = reader->field();
+    Status st = reader->NextSelectedBatch(runs, num_records, &columns[j]);
+    if (st.IsNotImplemented()) {
+      // Nothing has been consumed from this reader yet
+      st = FilterColumn(reader.get(), &columns[j]);
+    }
+    RETURN_NOT_OK(st);
+  }
+
+  auto result_schema = ::arrow::schema(fields, manifest_.schema_metadata);
+  *out = Table::Make(result_schema, columns);
+  return (*out)->Validate();
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
@@ -28,6 +28,7 @@
 
 namespace arrow {
 
+class BooleanArray;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -152,6 +153,11 @@ class PARQUET_EXPORT FileReader {
 
   /// \brief Return a RecordBatchReader of row groups selected from row_group_indices, the
   ///    ordering in row_group_indices matters.
+  ///
+  /// Batches of ArrowReaderProperties::batch_size() rows are decoded as they
+  /// are read. Unless buffered streams are enabled in the ReaderProperties,
+  /// the column chunks of the current row group are still read into memory
+  /// in full.
   /// \returns error Status if row_group_indices contains invalid index
   virtual ::arrow::Status GetRecordBatchReader(
       const std::vector<int>& row_group_indices,
@@ -201,6 +207,17 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the records of row group i which are selected by the
+  /// selection, which has a slot for every record of the row group. Null
+  /// slots do not select their record.
+  ///
+  /// The records between the selected runs are skipped without being
+  /// materialized, so that the columns a filter does not depend on can be
+  /// read after evaluating the filter on the others.
+  virtual ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                       const ::arrow::BooleanArray& selection,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
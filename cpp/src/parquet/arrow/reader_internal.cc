@@ -44,6 +44,7 @@
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/reader.h"
 #include "parquet/column_reader.h"
@@ -334,8 +335,20 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Supported for the types read from a physical type without conversion, and
+  // for strings, which are a view of binary values
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+      return true;
+    default:
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -721,6 +734,22 @@ Status MakeMinMaxIntegralScalar(const Statistics& statistics,
   return Status::OK();
 }
 
+// Make scalars of the Arrow type the column is read as, e.g. timestamp
+template <typename StatisticsType>
+Status MakeMinMaxTypedScalar(const Statistics& statistics,
+                             std::shared_ptr<::arrow::Scalar>* min,
+                             std::shared_ptr<::arrow::Scalar>* max) {
+  const auto& node =
+      checked_cast<const schema::PrimitiveNode&>(*statistics.descr()->schema_node());
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(GetPrimitiveType(node, &type));
+
+  const auto& typed_statistics = checked_cast<const StatisticsType&>(statistics);
+  ARROW_ASSIGN_OR_RAISE(*min, ::arrow::MakeScalar(type, typed_statistics.min()));
+  ARROW_ASSIGN_OR_RAISE(*max, ::arrow::MakeScalar(type, typed_statistics.max()));
+  return Status::OK();
+}
+
 template <typename StatisticsType>
 Status TypedIntegralStatisticsAsScalars(const Statistics& statistics,
                                         std::shared_ptr<::arrow::Scalar>* min,
@@ -731,6 +760,10 @@ Status TypedIntegralStatisticsAsScalars(const Statistics& statistics,
   switch (logical_type->type()) {
     case LogicalType::Type::INT:
       return MakeMinMaxIntegralScalar<StatisticsType>(statistics, min, max);
+    case LogicalType::Type::DATE:
+    case LogicalType::Type::TIME:
+    case LogicalType::Type::TIMESTAMP:
+      return MakeMinMaxTypedScalar<StatisticsType>(statistics, min, max);
     case LogicalType::Type::NONE:
       // Fallback to the physical type
       using CType = typename StatisticsType::T;
@@ -743,6 +776,35 @@ Status TypedIntegralStatisticsAsScalars(const Statistics& statistics,
   return Status::OK();
 }
 
+Status ByteArrayStatisticsAsScalars(const Statistics& statistics,
+                                    std::shared_ptr<::arrow::Scalar>* min,
+                                    std::shared_ptr<::arrow::Scalar>* max) {
+  auto logical_type = statistics.descr()->logical_type();
+  std::shared_ptr<DataType> type;
+  switch (logical_type->type()) {
+    case LogicalType::Type::STRING:
+      type = ::arrow::utf8();
+      break;
+    case LogicalType::Type::NONE:
+      type = ::arrow::binary();
+      break;
+    default:
+      return Status::NotImplemented("Cannot extract statistics for type ",
+                                    logical_type->ToString());
+  }
+
+  // The statistics don't own the memory of their ByteArray values
+  auto make_scalar = [&](const ByteArray& value) {
+    return ::arrow::MakeScalar(
+        type, ::arrow::Buffer::FromString(std::string(
+                  reinterpret_cast<const char*>(value.ptr), value.len)));
+  };
+  const auto& typed_statistics = checked_cast<const ByteArrayStatistics&>(statistics);
+  ARROW_ASSIGN_OR_RAISE(*min, make_scalar(typed_statistics.min()));
+  ARROW_ASSIGN_OR_RAISE(*max, make_scalar(typed_statistics.max()));
+  return Status::OK();
+}
+
 Status StatisticsAsScalars(const Statistics& statistics,
                            std::shared_ptr<::arrow::Scalar>* min,
                            std::shared_ptr<::arrow::Scalar>* max) {
@@ -768,6 +830,8 @@ Status StatisticsAsScalars(const Statistics& statistics,
       return TypedIntegralStatisticsAsScalars<Int32Statistics>(statistics, min, max);
     case Type::INT64:
       return TypedIntegralStatisticsAsScalars<Int64Statistics>(statistics, min, max);
+    case Type::BYTE_ARRAY:
+      return ByteArrayStatisticsAsScalars(statistics, min, max);
     default:
       return Status::NotImplemented("Extract statistics unsupported for physical_type ",
                                     physical_type, " unsupported.");
@@ -796,8 +860,31 @@ Status TransferInt(RecordReader* reader, MemoryPool* pool,
   return Status::OK();
 }
 
-std::shared_ptr<Array> TransferZeroCopy(RecordReader* reader,
-                                        const std::shared_ptr<DataType>& type) {
+bool IsZeroCopyValueType(const DataType& type) {
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+Datum TransferZeroCopy(RecordReader* reader, const std::shared_ptr<DataType>& type) {
+  auto zero_copy_reader = dynamic_cast<internal::ZeroCopyRecordReader*>(reader);
+  if (zero_copy_reader != nullptr) {
+    // The values are required, so there are no validity bitmaps
+    const int64_t byte_width =
+        checked_cast<const ::arrow::FixedWidthType&>(*type).bit_width() / 8;
+    ::arrow::ArrayVector chunks;
+    for (const auto& values : zero_copy_reader->ReleaseValueChunks()) {
+      chunks.push_back(::arrow::MakeArray(::arrow::ArrayData::Make(
+          type, values->size() / byte_width, {nullptr, values}, /*null_count=*/0)));
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), type);
+  }
   std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
                                                   reader->ReleaseValues()};
   auto data = std::make_shared<::arrow::ArrayData>(type, reader->values_written(),
@@ -868,7 +955,7 @@ Status TransferDate64(RecordReader* reader, MemoryPool* pool,
 }
 
 // ----------------------------------------------------------------------
-// Binary, direct to dictionary-encoded
+// Direct to dictionary-encoded
 
 Status TransferDictionary(RecordReader* reader,
                           const std::shared_ptr<DataType>& logical_value_type,
@@ -99,6 +99,10 @@ class FileColumnIterator {
 using FileColumnIteratorFactory =
     std::function<FileColumnIterator*(int, ParquetFileReader*)>;
 
+/// True if TransferColumnData takes values of this type as they are decoded,
+/// so that they may also be sliced out of data pages (see ZeroCopyRecordReader)
+bool IsZeroCopyValueType(const ::arrow::DataType& type);
+
 Status TransferColumnData(::parquet::internal::RecordReader* reader,
                           std::shared_ptr<::arrow::DataType> value_type,
                           const ColumnDescriptor* descr, ::arrow::MemoryPool* pool,
@@ -117,6 +121,8 @@ struct ReaderContext {
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::unordered_set<int> included_leaves;
+  // Only set where the column readers may return many-chunked results
+  bool zero_copy_values = false;
 
   bool IncludesLeaf(int leaf_index) const {
     return (!this->filter_leaves ||
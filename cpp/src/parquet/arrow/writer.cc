@@ -28,9 +28,11 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/extension_type.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/arrow/schema.h"
@@ -54,6 +56,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -424,6 +427,7 @@ class FileWriterImpl : public FileWriter {
         row_group_writer_(nullptr),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(std::move(arrow_properties)),
+        buffered_rows_(-1),
         closed_(false) {}
 
   Status Init() {
@@ -436,6 +440,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    buffered_rows_ = -1;
     return Status::OK();
   }
 
@@ -491,7 +496,15 @@ class FileWriterImpl : public FileWriter {
       chunk_size = this->properties().max_row_group_length();
     }
 
+    // Each top-level column must map to a single leaf for the columns to be
+    // written in arbitrary order
+    const bool parallel = arrow_properties_->use_threads() &&
+                          writer_->schema()->num_columns() == table.num_columns();
+
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (parallel) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -514,6 +527,83 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  // Encode and compress the columns of the row group into in-memory buffers
+  // in parallel. Closing the row group writes them to the sink in order.
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    buffered_rows_ = -1;
+
+    auto WriteColumn = [&](int i) {
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(i));
+      const SchemaField* schema_field = nullptr;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+      // The scratch buffers of a context cannot be shared between threads
+      ArrowWriteContext ctx(column_write_context_.memory_pool, arrow_properties_.get());
+      ArrowColumnWriter arrow_writer(&ctx, column_writer, schema_field,
+                                     &schema_manifest_);
+      Status status;
+      PARQUET_CATCH_NOT_OK(status = arrow_writer.Write(*table.column(i), offset, size));
+      return status;
+    };
+    return ::arrow::internal::ParallelFor(table.num_columns(), WriteColumn);
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    } else if (writer_->schema()->num_columns() != batch.num_columns()) {
+      return Status::NotImplemented(
+          "Buffered row groups of nested columns cannot be written by record batch");
+    }
+
+    const int64_t max_rows = properties().max_row_group_length();
+    const int64_t max_bytes = arrow_properties_->max_row_group_bytes();
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (int i = 0; i < batch.num_columns(); i++) {
+      columns.push_back(std::make_shared<ChunkedArray>(batch.column(i)));
+    }
+
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (buffered_rows_ < 0) {
+        if (row_group_writer_ != nullptr) {
+          PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        }
+        PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+        buffered_rows_ = 0;
+      }
+      const int64_t size =
+          std::min({batch.num_rows() - offset, properties().write_batch_size(),
+                    max_rows - buffered_rows_});
+      for (int i = 0; i < batch.num_columns(); i++) {
+        ColumnWriter* column_writer;
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(i));
+        const SchemaField* schema_field = nullptr;
+        RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+        ArrowColumnWriter arrow_writer(&column_write_context_, column_writer,
+                                       schema_field, &schema_manifest_);
+        RETURN_NOT_OK(arrow_writer.Write(*columns[i], offset, size));
+      }
+      offset += size;
+      buffered_rows_ += size;
+      if (buffered_rows_ >= max_rows || buffered_bytes() >= max_bytes) {
+        // The next slice starts a new row group
+        buffered_rows_ = -1;
+      }
+    }
+    return Status::OK();
+  }
+
+  int64_t buffered_bytes() const override {
+    return row_group_writer_ != nullptr ? row_group_writer_->total_buffered_bytes() : 0;
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
   ::arrow::MemoryPool* memory_pool() const override {
@@ -535,6 +625,9 @@ class FileWriterImpl : public FileWriter {
   RowGroupWriter* row_group_writer_;
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
+  // Rows appended by WriteRecordBatch to the current buffered row group, or
+  // -1 if the next batch starts a new one
+  int64_t buffered_rows_;
   bool closed_;
 };
 
@@ -79,6 +79,20 @@ class PARQUET_EXPORT FileWriter {
 
   virtual ::arrow::Status WriteColumnChunk(
       const std::shared_ptr<::arrow::ChunkedArray>& data) = 0;
+
+  /// \brief Append a RecordBatch to the current buffered row group
+  ///
+  /// The columns of the batch are encoded into memory. The row group is
+  /// written to the sink, and a new one started, once it holds
+  /// WriterProperties::max_row_group_length rows or its buffered bytes reach
+  /// ArrowWriterProperties::max_row_group_bytes. The budget is checked every
+  /// WriterProperties::write_batch_size rows.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
+  /// \brief Estimated size in bytes of the data of the current row group
+  /// that is held in memory
+  virtual int64_t buffered_bytes() const = 0;
+
   virtual ::arrow::Status Close() = 0;
   virtual ~FileWriter();
 
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <exception>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -32,11 +33,14 @@
 #include "arrow/builder.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
@@ -119,8 +123,11 @@ class SerializedPageReader : public PageReader {
  public:
   SerializedPageReader(std::shared_ptr<ArrowInputStream> stream, int64_t total_num_rows,
                        Compression::type codec, ::arrow::MemoryPool* pool,
-                       const CryptoContext* crypto_ctx)
+                       const CryptoContext* crypto_ctx, bool reuse_buffers = true,
+                       std::shared_ptr<Buffer> compression_dictionary = nullptr)
       : stream_(std::move(stream)),
+        pool_(pool),
+        reuse_buffers_(reuse_buffers),
         decompression_buffer_(AllocateBuffer(pool, 0)),
         page_ordinal_(0),
         seen_num_rows_(0),
@@ -132,6 +139,10 @@ class SerializedPageReader : public PageReader {
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
     decompressor_ = GetCodec(codec);
+    if (decompressor_ != nullptr && decompressor_->SupportsDictionary()) {
+      PARQUET_THROW_NOT_OK(
+          decompressor_->SetDictionary(std::move(compression_dictionary)));
+    }
   }
 
   // Implement the PageReader interface
@@ -139,6 +150,13 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  // Unless they are decrypted or decompressed, pages slice what was read from
+  // the stream
+  bool pages_own_buffers() const override {
+    return !reuse_buffers_ ||
+           (decompressor_ == nullptr && crypto_ctx_.data_decryptor == nullptr);
+  }
+
  private:
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
@@ -146,11 +164,16 @@ class SerializedPageReader : public PageReader {
   void InitDecryption();
 
   std::shared_ptr<ArrowInputStream> stream_;
+  ::arrow::MemoryPool* pool_;
+  // If false, pages are decrypted and decompressed into new buffers, so that
+  // previously returned pages stay valid
+  bool reuse_buffers_;
 
   format::PageHeader current_page_header_;
   std::shared_ptr<Page> current_page_;
 
-  // Compression codec to use.
+  // Compression codec to use.  It lives as long as the column chunk, so that
+  // its decompression contexts are reused for every page.
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
@@ -217,6 +240,7 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  ARROW_TRACE_SPAN("parquet", "ReadPage");
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
 
@@ -272,6 +296,15 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       ParquetException::EofException(ss.str());
     }
 
+    if (!reuse_buffers_) {
+      if (crypto_ctx_.data_decryptor != nullptr) {
+        decryption_buffer_ = AllocateBuffer(pool_, 0);
+      }
+      if (decompressor_ != nullptr) {
+        decompression_buffer_ = AllocateBuffer(pool_, 0);
+      }
+    }
+
     // Decrypt it if we need to
     if (crypto_ctx_.data_decryptor != nullptr) {
       PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
@@ -350,13 +383,64 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
   return std::shared_ptr<Page>(nullptr);
 }
 
-std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
-                                             int64_t total_num_rows,
-                                             Compression::type codec,
-                                             ::arrow::MemoryPool* pool,
-                                             const CryptoContext* ctx) {
-  return std::unique_ptr<PageReader>(
-      new SerializedPageReader(std::move(stream), total_num_rows, codec, pool, ctx));
+// A PageReader which reads, decrypts and decompresses the next page in the
+// background while the caller decodes the current one, so that a single
+// column is processed by two threads.
+//
+// The IO thread pool is used: column readers may themselves run on the CPU
+// thread pool, and waiting there for a task queued behind them could deadlock.
+class PrefetchingPageReader : public PageReader {
+ public:
+  explicit PrefetchingPageReader(std::unique_ptr<PageReader> reader)
+      : reader_(std::move(reader)) {}
+
+  ~PrefetchingPageReader() override {
+    // The pending task uses reader_
+    if (next_page_.valid()) {
+      next_page_.wait();
+    }
+  }
+
+  std::shared_ptr<Page> NextPage() override {
+    std::shared_ptr<Page> page =
+        next_page_.valid() ? next_page_.get() : reader_->NextPage();
+    if (page != nullptr) {
+      PageReader* reader = reader_.get();
+      auto pool = ::arrow::internal::GetIOThreadPool();
+      PARQUET_ASSIGN_OR_THROW(next_page_,
+                              pool->Submit([reader] { return reader->NextPage(); }));
+    }
+    return page;
+  }
+
+  void set_max_page_header_size(uint32_t size) override {
+    // Applies to the pages after the one being prefetched
+    if (next_page_.valid()) {
+      next_page_.wait();
+    }
+    reader_->set_max_page_header_size(size);
+  }
+
+  bool pages_own_buffers() const override { return reader_->pages_own_buffers(); }
+
+ private:
+  std::unique_ptr<PageReader> reader_;
+  std::future<std::shared_ptr<Page>> next_page_;
+};
+
+std::unique_ptr<PageReader> PageReader::Open(
+    std::shared_ptr<ArrowInputStream> stream, int64_t total_num_rows,
+    Compression::type codec, ::arrow::MemoryPool* pool, const CryptoContext* ctx,
+    bool prefetch, std::shared_ptr<Buffer> compression_dictionary) {
+  if (prefetch) {
+    std::unique_ptr<PageReader> reader(new SerializedPageReader(
+        std::move(stream), total_num_rows, codec, pool, ctx,
+        /*reuse_buffers=*/false, std::move(compression_dictionary)));
+    return std::unique_ptr<PageReader>(new PrefetchingPageReader(std::move(reader)));
+  }
+  return std::unique_ptr<PageReader>(new SerializedPageReader(
+      std::move(stream), total_num_rows, codec, pool, ctx,
+      /*reuse_buffers=*/true, std::move(compression_dictionary)));
 }
 
 // ----------------------------------------------------------------------
@@ -571,8 +655,12 @@ class ColumnReaderImplBase {
       current_decoder_ = it->second.get();
     } else {
       switch (encoding) {
-        case Encoding::PLAIN: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
+        case Encoding::PLAIN:
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -580,11 +668,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -801,24 +884,34 @@ int64_t TypedColumnReaderImpl<DType>::Skip(int64_t num_rows_to_skip) {
       this->num_decoded_values_ = this->num_buffered_values_;
     } else {
       // We need to read this Page
-      // Jump to the right offset in the Page
-      int64_t batch_size = 1024;  // ReadBatch with a smaller memory footprint
-      int64_t values_read = 0;
+      // Jump to the right offset in the Page, decoding levels only
+      int64_t batch_size = 1024;  // Levels are read in batches of this size
+      int64_t levels_read = 0;
 
-      // This will be enough scratch space to accommodate 16-bit levels or any
-      // value type
-      std::shared_ptr<ResizableBuffer> scratch = AllocateBuffer(
-          this->pool_, batch_size * type_traits<DType::type_num>::value_byte_size);
+      std::shared_ptr<ResizableBuffer> scratch =
+          AllocateBuffer(this->pool_, batch_size * sizeof(int16_t));
+      int16_t* levels = reinterpret_cast<int16_t*>(scratch->mutable_data());
 
       do {
         batch_size = std::min(batch_size, rows_to_skip);
-        values_read =
-            ReadBatch(static_cast<int>(batch_size),
-                      reinterpret_cast<int16_t*>(scratch->mutable_data()),
-                      reinterpret_cast<int16_t*>(scratch->mutable_data()),
-                      reinterpret_cast<T*>(scratch->mutable_data()), &values_read);
-        rows_to_skip -= values_read;
-      } while (values_read > 0 && rows_to_skip > 0);
+        levels_read = batch_size;
+        int64_t values_to_skip = batch_size;
+        if (this->max_def_level_ > 0) {
+          levels_read = this->ReadDefinitionLevels(batch_size, levels);
+          values_to_skip = std::count(levels, levels + levels_read, this->max_def_level_);
+        }
+        if (this->max_rep_level_ > 0 &&
+            this->ReadRepetitionLevels(levels_read, levels) != levels_read) {
+          throw ParquetException("Number of decoded rep / def levels did not match");
+        }
+        if (values_to_skip > 0 &&
+            this->current_decoder_->Skip(static_cast<int>(values_to_skip)) !=
+                values_to_skip) {
+          ParquetException::EofException();
+        }
+        this->ConsumeBufferedValues(levels_read);
+        rows_to_skip -= levels_read;
+      } while (levels_read > 0 && rows_to_skip > 0);
     }
   }
   return num_rows_to_skip - rows_to_skip;
@@ -903,6 +996,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
   int64_t ReadRecords(int64_t num_records) override {
+    ARROW_TRACE_SPAN("parquet", "DecodeRecords");
     // Delimit records, then read values at the end
     int64_t records_read = 0;
 
@@ -971,6 +1065,28 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      return SkipRepeatedRecords(num_records);
+    }
+    int64_t records_skipped = SkipBufferedLevels(num_records);
+    while (records_skipped < num_records && this->HasNextInternal()) {
+      const int64_t batch_size =
+          std::min(num_records - records_skipped, available_values_current_page());
+      if (batch_size == 0) {
+        break;
+      }
+      if (batch_size == available_values_current_page()) {
+        // The rest of the page is discarded without decoding its levels or values
+        this->ConsumeBufferedValues(batch_size);
+      } else {
+        SkipPageValues(batch_size);
+      }
+      records_skipped += batch_size;
+    }
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1239,10 +1355,243 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
  protected:
+  // Discard levels that were decoded by ReadRecords but not consumed yet,
+  // together with their values
+  int64_t SkipBufferedLevels(int64_t num_records) {
+    const int64_t num_levels = std::min(num_records, levels_written_ - levels_position_);
+    if (num_levels <= 0) {
+      return 0;
+    }
+    const int16_t* def_levels = this->def_levels() + levels_position_;
+    SkipValues(std::count(def_levels, def_levels + num_levels, this->max_def_level_));
+    DiscardBufferedLevels(num_levels);
+    return num_levels;
+  }
+
+  // Remove the next num_levels buffered levels, which have not been consumed
+  void DiscardBufferedLevels(int64_t num_levels) {
+    int16_t* def_levels = this->def_levels() + levels_position_;
+    std::copy(def_levels + num_levels, this->def_levels() + levels_written_, def_levels);
+    if (this->max_rep_level_ > 0) {
+      int16_t* rep_levels = this->rep_levels() + levels_position_;
+      std::copy(rep_levels + num_levels, this->rep_levels() + levels_written_,
+                rep_levels);
+    }
+    levels_written_ -= num_levels;
+    this->ConsumeBufferedValues(num_levels);
+  }
+
+  // Records of repeated columns are delimited by their repetition levels. The
+  // values of the skipped levels are only skipped in the decoder if reading
+  // stops within their page. Pages of DataPageV2 start at record boundaries,
+  // so they are skipped whole when their row count is within the records left.
+  int64_t SkipRepeatedRecords(int64_t num_records) {
+    int64_t records_skipped = 0;
+    int64_t values_to_skip = 0;
+    // Whether levels of the record at hand have been skipped
+    bool in_record = false;
+    while (records_skipped < num_records) {
+      if (levels_position_ == levels_written_) {
+        if (available_values_current_page() == 0) {
+          // The values of the page are not read anymore
+          values_to_skip = 0;
+          if (!this->HasNextInternal()) {
+            if (in_record) {
+              ++records_skipped;
+            }
+            break;
+          }
+        }
+        if (this->num_decoded_values_ == 0 &&
+            this->current_page_->type() == PageType::DATA_PAGE_V2) {
+          if (in_record) {
+            in_record = false;
+            if (++records_skipped == num_records) {
+              break;
+            }
+          }
+          const int64_t page_records =
+              static_cast<const DataPageV2*>(this->current_page_.get())->num_rows();
+          if (page_records <= num_records - records_skipped) {
+            this->ConsumeBufferedValues(available_values_current_page());
+            records_skipped += page_records;
+            continue;
+          }
+        }
+
+        const int64_t batch_size =
+            std::min(kMinLevelBatchSize, available_values_current_page());
+        ReserveLevels(batch_size);
+        int16_t* def_levels = this->def_levels() + levels_written_;
+        int16_t* rep_levels = this->rep_levels() + levels_written_;
+        const int64_t levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+        if (levels_read == 0 ||
+            this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
+          throw ParquetException("Number of decoded rep / def levels did not match");
+        }
+        levels_written_ += levels_read;
+      }
+
+      const int16_t* def_levels = this->def_levels();
+      const int16_t* rep_levels = this->rep_levels();
+      int64_t position = levels_position_;
+      for (; position < levels_written_; ++position) {
+        if (rep_levels[position] == 0 && in_record) {
+          in_record = false;
+          if (++records_skipped == num_records) {
+            break;
+          }
+        }
+        in_record = true;
+        if (def_levels[position] == this->max_def_level_) {
+          ++values_to_skip;
+        }
+      }
+      DiscardBufferedLevels(position - levels_position_);
+    }
+    SkipValues(values_to_skip);
+    at_record_start_ = true;
+    return records_skipped;
+  }
+
+  // Discard the next num_levels levels of the current page and their values
+  virtual void SkipPageValues(int64_t num_levels) {
+    int64_t num_values = num_levels;
+    if (this->max_def_level_ > 0) {
+      num_values = 0;
+      int64_t levels_skipped = 0;
+      while (levels_skipped < num_levels) {
+        const int64_t batch_size =
+            std::min(kMinLevelBatchSize, num_levels - levels_skipped);
+        int16_t* levels = LevelsScratchSpace(batch_size);
+        const int64_t levels_read = this->ReadDefinitionLevels(batch_size, levels);
+        if (levels_read == 0) {
+          ParquetException::EofException();
+        }
+        num_values += std::count(levels, levels + levels_read, this->max_def_level_);
+        levels_skipped += levels_read;
+      }
+    }
+    SkipValues(num_values);
+    this->ConsumeBufferedValues(num_levels);
+  }
+
+  // Advance the decoder of the current page past values
+  void SkipValues(int64_t num_values) {
+    if (num_values > 0 &&
+        this->current_decoder_->Skip(static_cast<int>(num_values)) != num_values) {
+      ParquetException::EofException();
+    }
+  }
+
+  int16_t* LevelsScratchSpace(int64_t length) {
+    if (levels_scratch_ == nullptr) {
+      levels_scratch_ = AllocateBuffer(this->pool_);
+    }
+    const int64_t size = length * static_cast<int64_t>(sizeof(int16_t));
+    if (levels_scratch_->size() < size) {
+      PARQUET_THROW_NOT_OK(levels_scratch_->Resize(size, false));
+    }
+    return reinterpret_cast<int16_t*>(levels_scratch_->mutable_data());
+  }
+
   template <typename T>
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  // Definition levels of skipped records, never exposed
+  std::shared_ptr<ResizableBuffer> levels_scratch_;
+};
+
+// Without levels, each value of a required, non-repeated column is a record of
+// its own. Runs of PLAIN values bypass the decoder and are sliced out of the
+// page buffers, while the values of other pages are decoded into values_,
+// which becomes a chunk of its own before the next slice.
+template <typename DType>
+class TypedZeroCopyRecordReader : public TypedRecordReader<DType>,
+                                  virtual public ZeroCopyRecordReader {
+ public:
+  using T = typename DType::c_type;
+  using BASE = TypedRecordReader<DType>;
+
+  TypedZeroCopyRecordReader(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : BASE(descr, pool) {
+    DCHECK_EQ(this->max_def_level_, 0);
+    DCHECK_EQ(this->max_rep_level_, 0);
+  }
+
+  int64_t ReadRecords(int64_t num_records) override {
+    ARROW_TRACE_SPAN("parquet", "DecodeRecords");
+    int64_t records_read = 0;
+    while (records_read < num_records && this->HasNextInternal()) {
+      const int64_t batch_size =
+          std::min(num_records - records_read, this->available_values_current_page());
+      if (batch_size == 0) {
+        break;
+      }
+      if (CanSlicePageValues()) {
+        SlicePageValues(batch_size);
+      } else {
+        this->ReadRecordData(batch_size);
+      }
+      records_read += batch_size;
+    }
+    return records_read;
+  }
+
+  // Sliced pages have no decoder state to advance
+  void SkipPageValues(int64_t num_levels) override {
+    if (CanSlicePageValues()) {
+      this->ConsumeBufferedValues(num_levels);
+    } else {
+      BASE::SkipPageValues(num_levels);
+    }
+  }
+
+  void Reset() override {
+    BASE::Reset();
+    value_chunks_.clear();
+  }
+
+  std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() override {
+    SealValues();
+    std::vector<std::shared_ptr<Buffer>> result;
+    result.swap(value_chunks_);
+    return result;
+  }
+
+ private:
+  // With no levels in front, the page data is the PLAIN values. Slices must be
+  // as aligned as decoded values would be.
+  bool CanSlicePageValues() const {
+    return this->current_encoding_ == Encoding::PLAIN &&
+           this->pager_->pages_own_buffers() &&
+           reinterpret_cast<uintptr_t>(this->current_page_->data()) % alignof(T) == 0;
+  }
+
+  void SlicePageValues(int64_t num_values) {
+    const int64_t offset = this->num_decoded_values_ * static_cast<int64_t>(sizeof(T));
+    const int64_t length = num_values * static_cast<int64_t>(sizeof(T));
+    if (offset + length > this->current_page_->size()) {
+      ParquetException::EofException();
+    }
+    SealValues();
+    value_chunks_.push_back(SliceBuffer(this->current_page_->buffer(), offset, length));
+    this->ConsumeBufferedValues(num_values);
+  }
+
+  void SealValues() {
+    if (this->values_written_ > 0) {
+      // The values buffer may have more capacity than was written
+      value_chunks_.push_back(SliceBuffer(this->ReleaseValues(), 0,
+                                          this->values_written_ *
+                                              static_cast<int64_t>(sizeof(T))));
+      this->ResetValues();
+    }
+  }
+
+  std::vector<std::shared_ptr<Buffer>> value_chunks_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1338,12 +1687,23 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+/// \brief Reads dictionary-encoded pages directly into a DictionaryArray
+/// whose dictionary has the Arrow equivalent of the physical type
+///
+/// Fallback pages that are not dictionary-encoded are appended through the
+/// builder's memo table. A new dictionary starts a new chunk, except when it
+/// is identical to the current one, as is common when each row group of a
+/// file repeats the same dictionary page.
+template <typename DType>
+class TypedDictionaryRecordReader : public TypedRecordReader<DType>,
+                                    virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+  using DictAccumulator = typename EncodingTraits<DType>::DictAccumulator;
+
+  TypedDictionaryRecordReader(const ColumnDescriptor* descr,
+                              const std::shared_ptr<::arrow::DataType>& value_type,
+                              ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool), builder_(value_type, pool) {
     this->read_dictionary_ = true;
   }
 
@@ -1360,59 +1720,66 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
       // Also clears the dictionary memo table
       builder_.ResetFull();
+      dictionary_.reset();
     }
   }
 
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
       /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      /// insert the new dictionary values. The memo table keeps the values of
+      /// an identical dictionary at the same indices, so it can be reused.
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
+      std::shared_ptr<::arrow::Array> dictionary = decoder->GetDictionary();
+      if (dictionary_ == nullptr || !dictionary_->Equals(*dictionary)) {
+        FlushBuilder();
+        decoder->InsertDictionary(&builder_);
+        dictionary_ = std::move(dictionary);
+      }
       this->new_dictionary_ = false;
     }
   }
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
-
-  ::arrow::BinaryDictionary32Builder builder_;
+  DictAccumulator builder_;
+  // The dictionary currently in the builder's memo table, if any. It references
+  // the memory of a decoder which may already have been released.
+  std::shared_ptr<::arrow::Array> dictionary_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -1430,32 +1797,66 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         arrow::MemoryPool* pool,
                                                         bool read_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
+    return std::make_shared<TypedDictionaryRecordReader<ByteArrayType>>(
+        descr, ::arrow::binary(), pool);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
   }
 }
 
+template <typename DType>
+std::shared_ptr<RecordReader> MakeNumericRecordReader(const ColumnDescriptor* descr,
+                                                      arrow::MemoryPool* pool,
+                                                      bool read_dictionary,
+                                                      bool zero_copy_values) {
+  if (read_dictionary) {
+    using ArrowType = typename EncodingTraits<DType>::ArrowType;
+    return std::make_shared<TypedDictionaryRecordReader<DType>>(
+        descr, ::arrow::TypeTraits<ArrowType>::type_singleton(), pool);
+  } else if (zero_copy_values && descr->max_definition_level() == 0 &&
+             descr->max_repetition_level() == 0) {
+    return std::make_shared<TypedZeroCopyRecordReader<DType>>(descr, pool);
+  } else {
+    return std::make_shared<TypedRecordReader<DType>>(descr, pool);
+  }
+}
+
+std::shared_ptr<RecordReader> MakeFLBARecordReader(const ColumnDescriptor* descr,
+                                                   arrow::MemoryPool* pool,
+                                                   bool read_dictionary) {
+  if (read_dictionary) {
+    return std::make_shared<TypedDictionaryRecordReader<FLBAType>>(
+        descr, ::arrow::fixed_size_binary(descr->type_length()), pool);
+  } else {
+    return std::make_shared<FLBARecordReader>(descr, pool);
+  }
+}
+
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
-                                                 const bool read_dictionary) {
+                                                 const bool read_dictionary,
+                                                 const bool zero_copy_values) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, pool);
+      return MakeNumericRecordReader<Int32Type>(descr, pool, read_dictionary,
+                                             zero_copy_values);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, pool);
+      return MakeNumericRecordReader<Int64Type>(descr, pool, read_dictionary,
+                                             zero_copy_values);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, pool);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, pool);
+      return MakeNumericRecordReader<FloatType>(descr, pool, read_dictionary,
+                                             zero_copy_values);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
+      return MakeNumericRecordReader<DoubleType>(descr, pool, read_dictionary,
+                                             zero_copy_values);
     case Type::BYTE_ARRAY:
       return MakeByteArrayRecordReader(descr, pool, read_dictionary);
     case Type::FIXED_LEN_BYTE_ARRAY:
-      return std::make_shared<FLBARecordReader>(descr, pool);
+      return MakeFLBARecordReader(descr, pool, read_dictionary);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
       std::stringstream ss;
@@ -97,16 +97,26 @@ class PARQUET_EXPORT PageReader {
  public:
   virtual ~PageReader() = default;
 
+  // If prefetch is true, the next page is read, decrypted and decompressed
+  // on the IO thread pool while the current one is decoded. Each page then
+  // gets its own buffers instead of reusing those of the previous page.
+  // If compression_dictionary is given, ZSTD-compressed pages are
+  // decompressed with it.
   static std::unique_ptr<PageReader> Open(
       std::shared_ptr<ArrowInputStream> stream, int64_t total_num_rows,
       Compression::type codec, ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      const CryptoContext* ctx = NULLPTR);
+      const CryptoContext* ctx = NULLPTR, bool prefetch = false,
+      std::shared_ptr<Buffer> compression_dictionary = NULLPTR);
 
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // True if the buffers of returned pages are not reused or modified by
+  // subsequent NextPage calls, so that consumers may hold on to them
+  virtual bool pages_own_buffers() const { return false; }
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -204,10 +214,12 @@ namespace internal {
 /// \since 1.3.0
 class RecordReader {
  public:
+  /// If zero_copy_values is true, the readers of columns that qualify are
+  /// ZeroCopyRecordReader instances
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      const bool read_dictionary = false);
+      const bool read_dictionary = false, const bool zero_copy_values = false);
 
   virtual ~RecordReader() = default;
 
@@ -215,6 +227,12 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Discard the indicated number of records of the column chunk
+  /// without materializing them. Values and levels read so far are left
+  /// untouched
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -304,8 +322,21 @@ class BinaryRecordReader : virtual public RecordReader {
   virtual std::vector<std::shared_ptr<::arrow::Array>> GetBuilderChunks() = 0;
 };
 
+/// \brief Read the values of required, non-repeated INT32, INT64, FLOAT and
+/// DOUBLE columns as slices of PLAIN-encoded data pages whose buffers the
+/// page reader does not reuse, instead of copying them. Values of other pages
+/// are decoded as usual.
+class ZeroCopyRecordReader : virtual public RecordReader {
+ public:
+  /// \brief Transfer the value buffers of the records read so far to the
+  /// caller, in order. A new run of buffers is started in subsequent
+  /// ReadRecords calls
+  virtual std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() = 0;
+};
+
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for INT32, INT64, FLOAT, DOUBLE, BYTE_ARRAY and
+/// FIXED_LEN_BYTE_ARRAY columns
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
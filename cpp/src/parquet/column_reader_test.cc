@@ -382,6 +382,91 @@ TEST_F(TestPrimitiveReader, TestDictionaryEncodedPages) {
   pages_.clear();
 }
 
+TEST(TestRecordReader, SkipRepeatedRecords) {
+  const int16_t max_def_level = 1;
+  const int16_t max_rep_level = 1;
+  NodePtr type = schema::Int32("c", Repetition::REPEATED);
+  const ColumnDescriptor descr(type, max_def_level, max_rep_level);
+
+  // Record i holds the values i * 10 + j for j in [0, i % 3], 10 records per
+  // page
+  const int num_pages = 4;
+  const int records_per_page = 10;
+  std::vector<std::vector<int32_t>> records;
+  for (int i = 0; i < num_pages * records_per_page; ++i) {
+    records.emplace_back();
+    for (int j = 0; j <= i % 3; ++j) {
+      records.back().push_back(i * 10 + j);
+    }
+  }
+
+  for (bool page_v2 : {false, true}) {
+    std::vector<std::shared_ptr<Page>> pages;
+    for (int page = 0; page < num_pages; ++page) {
+      std::vector<int32_t> values;
+      std::vector<int16_t> def_levels, rep_levels;
+      for (int i = page * records_per_page; i < (page + 1) * records_per_page; ++i) {
+        for (size_t j = 0; j < records[i].size(); ++j) {
+          values.push_back(records[i][j]);
+          def_levels.push_back(max_def_level);
+          rep_levels.push_back(j == 0 ? 0 : max_rep_level);
+        }
+      }
+      auto v1_page = MakeDataPage<Int32Type>(
+          &descr, values, static_cast<int>(values.size()), Encoding::PLAIN, nullptr, 0,
+          def_levels, max_def_level, rep_levels, max_rep_level);
+      if (page_v2) {
+        // Only DataPageV2 tells the number of records of a page
+        pages.push_back(std::make_shared<DataPageV2>(
+            v1_page->buffer(), v1_page->num_values(), 0, records_per_page,
+            Encoding::PLAIN, 0, 0));
+      } else {
+        pages.push_back(v1_page);
+      }
+    }
+
+    auto reader = internal::RecordReader::Make(&descr);
+    reader->SetPageReader(
+        std::unique_ptr<PageReader>(new test::MockPageReader(pages)));
+
+    std::vector<int> expected_records;
+    auto ReadRecords = [&](int begin, int end) {
+      ASSERT_EQ(end - begin, reader->ReadRecords(end - begin));
+      for (int i = begin; i < end; ++i) {
+        expected_records.push_back(i);
+      }
+    };
+    ASSERT_NO_FATAL_FAILURE(ReadRecords(0, 3));
+    // Within a page, and from levels buffered by the last read
+    ASSERT_EQ(4, reader->SkipRecords(4));
+    ASSERT_NO_FATAL_FAILURE(ReadRecords(7, 9));
+    // Across pages, V2 pages are skipped whole
+    ASSERT_EQ(21, reader->SkipRecords(21));
+    ASSERT_NO_FATAL_FAILURE(ReadRecords(30, 35));
+    // Up to the end of the column chunk
+    ASSERT_EQ(5, reader->SkipRecords(100));
+    ASSERT_EQ(0, reader->ReadRecords(1));
+
+    // Neither levels nor values of skipped records are exposed
+    std::vector<int32_t> expected_values;
+    std::vector<int16_t> expected_rep_levels;
+    for (int i : expected_records) {
+      for (size_t j = 0; j < records[i].size(); ++j) {
+        expected_values.push_back(records[i][j]);
+        expected_rep_levels.push_back(j == 0 ? 0 : max_rep_level);
+      }
+    }
+    ASSERT_EQ(static_cast<int64_t>(expected_values.size()), reader->levels_position());
+    ASSERT_EQ(static_cast<int64_t>(expected_values.size()), reader->values_written());
+    const auto values = reinterpret_cast<const int32_t*>(reader->values());
+    ASSERT_EQ(expected_values,
+              std::vector<int32_t>(values, values + expected_values.size()));
+    ASSERT_EQ(expected_rep_levels,
+              std::vector<int16_t>(reader->rep_levels(),
+                                   reader->rep_levels() + expected_values.size()));
+  }
+}
+
 TEST(TestColumnReader, DefinitionLevelsToBitmap) {
   // Bugs in this function were exposed in ARROW-3930
   std::vector<int16_t> def_levels = {3, 3, 3, 2, 3, 3, 3, 3, 3};
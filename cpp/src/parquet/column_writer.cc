@@ -22,6 +22,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -31,15 +32,19 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/murmur3.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -144,7 +149,9 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       ColumnChunkPageIndexBuilder* page_index_builder = nullptr,
+                       std::shared_ptr<Buffer> compression_dictionary = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
@@ -153,16 +160,24 @@ class SerializedPageWriter : public PageWriter {
         data_page_offset_(0),
         total_uncompressed_size_(0),
         total_compressed_size_(0),
+        bloom_filter_offset_(-1),
         page_ordinal_(0),
         row_group_ordinal_(row_group_ordinal),
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        page_index_builder_(page_index_builder) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
     compressor_ = GetCodec(codec, compression_level);
+    if (compression_dictionary != nullptr) {
+      if (compressor_ == nullptr) {
+        throw ParquetException("A compression dictionary requires a compression codec");
+      }
+      PARQUET_THROW_NOT_OK(compressor_->SetDictionary(std::move(compression_dictionary)));
+    }
     thrift_serializer_.reset(new ThriftSerializer);
   }
 
@@ -226,10 +241,16 @@ class SerializedPageWriter : public PageWriter {
     if (meta_encryptor_ != nullptr) {
       UpdateEncryption(encryption::kColumnMetaData);
     }
+    if (bloom_filter_offset_ >= 0) {
+      metadata_->SetBloomFilterOffset(bloom_filter_offset_);
+    }
     // index_page_offset = -1 since they are not supported
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
                       fallback, meta_encryptor_);
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->Finish();
+    }
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_.get());
   }
@@ -298,6 +319,13 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    if (page_index_builder_ != nullptr) {
+      PageLocation location = {start_pos,
+                               static_cast<int32_t>(header_size + output_data_len),
+                               page.first_row_index()};
+      page_index_builder_->AddPage(page.statistics(), page.num_values(), location);
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
@@ -307,6 +335,11 @@ class SerializedPageWriter : public PageWriter {
     return current_pos - start_pos;
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    PARQUET_ASSIGN_OR_THROW(bloom_filter_offset_, sink_->Tell());
+    bloom_filter.WriteTo(sink_.get());
+  }
+
   bool has_compressor() override { return (compressor_ != nullptr); }
 
   int64_t num_values() { return num_values_; }
@@ -319,6 +352,8 @@ class SerializedPageWriter : public PageWriter {
 
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
 
+  int64_t bloom_filter_offset() { return bloom_filter_offset_; }
+
  private:
   // To allow UpdateEncryption on Close
   friend class BufferedPageWriter;
@@ -380,13 +415,16 @@ class SerializedPageWriter : public PageWriter {
   int64_t data_page_offset_;
   int64_t total_uncompressed_size_;
   int64_t total_compressed_size_;
+  // -1 if no bloom filter was written
+  int64_t bloom_filter_offset_;
   int16_t page_ordinal_;
   int16_t row_group_ordinal_;
   int16_t column_ordinal_;
 
   std::unique_ptr<ThriftSerializer> thrift_serializer_;
 
-  // Compression codec to use.
+  // Compression codec to use.  It lives as long as the column chunk, so that
+  // its compression contexts are reused for every page.
   std::unique_ptr<arrow::util::Codec> compressor_;
 
   std::string data_page_aad_;
@@ -396,6 +434,9 @@ class SerializedPageWriter : public PageWriter {
   std::shared_ptr<Encryptor> data_encryptor_;
 
   std::shared_ptr<ResizableBuffer> encryption_buffer_;
+
+  // Not owned, nullptr if no page index is written
+  ColumnChunkPageIndexBuilder* page_index_builder_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -406,13 +447,16 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     ColumnChunkPageIndexBuilder* page_index_builder = nullptr,
+                     std::shared_ptr<Buffer> compression_dictionary = nullptr)
       : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), page_index_builder,
+        std::move(compression_dictionary)));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -429,10 +473,17 @@ class BufferedPageWriter : public PageWriter {
     // dictionary page offset should be 0 iff there are no dictionary pages
     auto dictionary_page_offset =
         has_dictionary_pages_ ? pager_->dictionary_page_offset() + final_position : 0;
+    if (pager_->bloom_filter_offset() >= 0) {
+      metadata_->SetBloomFilterOffset(pager_->bloom_filter_offset() + final_position);
+    }
     metadata_->Finish(pager_->num_values(), dictionary_page_offset, -1,
                       pager_->data_page_offset() + final_position,
                       pager_->total_compressed_size(), pager_->total_uncompressed_size(),
                       has_dictionary, fallback, pager_->meta_encryptor_);
+    if (pager_->page_index_builder_ != nullptr) {
+      // Page offsets were recorded relative to the in-memory sink
+      pager_->page_index_builder_->Finish(final_position);
+    }
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
@@ -446,6 +497,10 @@ class BufferedPageWriter : public PageWriter {
     return pager_->WriteDataPage(page);
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    pager_->WriteBloomFilter(bloom_filter);
+  }
+
   void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) override {
     pager_->Compress(src_buffer, dest_buffer);
   }
@@ -465,20 +520,26 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor,
+    ColumnChunkPageIndexBuilder* page_index_builder,
+    std::shared_ptr<Buffer> compression_dictionary) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder, std::move(compression_dictionary)));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder, std::move(compression_dictionary)));
   }
 }
 
+void PageWriter::WriteBloomFilter(const BloomFilter& bloom_filter) {
+  throw ParquetException("This PageWriter does not support writing bloom filters");
+}
+
 // ----------------------------------------------------------------------
 // ColumnWriter
 
@@ -503,6 +564,7 @@ class ColumnWriterImpl {
         num_buffered_values_(0),
         num_buffered_encoded_values_(0),
         rows_written_(0),
+        page_first_row_index_(0),
         total_bytes_written_(0),
         total_compressed_bytes_(0),
         closed_(false),
@@ -531,6 +593,9 @@ class ColumnWriterImpl {
   // Serializes Dictionary Page if enabled
   virtual void WriteDictionaryPage() = 0;
 
+  // Serializes the bloom filter of the column chunk if enabled
+  virtual void WriteBloomFilter() = 0;
+
   // Plain-encoded statistics of the current page
   virtual EncodedStatistics GetPageStatistics() = 0;
 
@@ -598,6 +663,9 @@ class ColumnWriterImpl {
   // Total number of rows written with this ColumnWriter
   int rows_written_;
 
+  // Index of the first row of the buffered data page
+  int64_t page_first_row_index_;
+
   // Records the total number of bytes written by the serializer
   int64_t total_bytes_written_;
 
@@ -690,6 +758,11 @@ void ColumnWriterImpl::AddDataPage() {
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
 
+  // Only accurate for non-repeated columns, whose pages always start on a
+  // record boundary
+  int64_t first_row_index = page_first_row_index_;
+  page_first_row_index_ = rows_written_;
+
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
     pager_->Compress(*(uncompressed_data_.get()), compressed_data_.get());
@@ -706,13 +779,14 @@ void ColumnWriterImpl::AddDataPage() {
                                                &compressed_data_copy));
     CompressedDataPage page(compressed_data_copy,
                             static_cast<int32_t>(num_buffered_values_), encoding_,
-                            Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats);
+                            Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats,
+                            first_row_index);
     total_compressed_bytes_ += page.size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page));
   } else {  // Eagerly write pages
     CompressedDataPage page(compressed_data, static_cast<int32_t>(num_buffered_values_),
                             encoding_, Encoding::RLE, Encoding::RLE, uncompressed_size,
-                            page_stats);
+                            page_stats, first_row_index);
     WriteDataPage(page);
   }
 
@@ -730,6 +804,7 @@ int64_t ColumnWriterImpl::Close() {
     }
 
     FlushBufferedDataPages();
+    WriteBloomFilter();
 
     EncodedStatistics chunk_statistics = GetChunkStatistics();
     chunk_statistics.ApplyStatSizeLimits(
@@ -761,18 +836,6 @@ void ColumnWriterImpl::FlushBufferedDataPages() {
 // ----------------------------------------------------------------------
 // TypedColumnWriter
 
-template <typename Action>
-inline void DoInBatches(int64_t total, int64_t batch_size, Action&& action) {
-  int64_t num_batches = static_cast<int>(total / batch_size);
-  for (int round = 0; round < num_batches; round++) {
-    action(round * batch_size, batch_size);
-  }
-  // Write the remaining values
-  if (total % batch_size > 0) {
-    action(num_batches * batch_size, total % batch_size);
-  }
-}
-
 bool DictionaryDirectWriteSupported(const arrow::Array& array) {
   DCHECK_EQ(array.type_id(), arrow::Type::DICTIONARY);
   const arrow::DictionaryType& dict_type =
@@ -805,6 +868,25 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value the same way BlockSplitBloomFilter::Hash does
+template <typename T>
+inline uint64_t BloomFilterHash(const Hasher& hasher, const T& value, int) {
+  return hasher.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const Int96& value, int) {
+  return hasher.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const ByteArray& value, int) {
+  return hasher.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const Hasher& hasher, const FLBA& value,
+                                int type_length) {
+  return hasher.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -823,6 +905,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+    bloom_filter_enabled_ = properties->bloom_filter_enabled(descr_->path()) &&
+                            DType::type_num != Type::BOOLEAN;
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
@@ -850,7 +934,7 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       // circumvent this check when writing arrow::DictionaryArray directly
       CheckDictionarySizeLimit();
     };
-    DoInBatches(num_values, properties_->write_batch_size(), WriteChunk);
+    DoInPageBatches(num_values, WriteChunk);
   }
 
   void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
@@ -872,7 +956,7 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       // circumvent this check when writing arrow::DictionaryArray directly
       CheckDictionarySizeLimit();
     };
-    DoInBatches(num_values, properties_->write_batch_size(), WriteChunk);
+    DoInPageBatches(num_values, WriteChunk);
   }
 
   Status WriteArrow(const int16_t* def_levels, const int16_t* rep_levels,
@@ -889,6 +973,18 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     return current_encoder_->EstimatedDataEncodedSize();
   }
 
+  int64_t estimated_buffered_bytes() const override {
+    int64_t buffered_bytes = definition_levels_sink_.length() +
+                             repetition_levels_sink_.length() +
+                             current_encoder_->EstimatedDataEncodedSize() +
+                             total_compressed_bytes_;
+    if (has_dictionary_ && !fallback_) {
+      auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+      buffered_bytes += dict_encoder->dict_encoded_size();
+    }
+    return buffered_bytes;
+  }
+
  protected:
   std::shared_ptr<Buffer> GetValuesBuffer() override {
     return current_encoder_->FlushValues();
@@ -919,6 +1015,23 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     total_bytes_written_ += pager_->WriteDictionaryPage(page);
   }
 
+  void WriteBloomFilter() override {
+    if (!bloom_filter_enabled_) {
+      return;
+    }
+    // Size the filter from the number of distinct values of the chunk
+    BlockSplitBloomFilter bloom_filter;
+    bloom_filter.Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                          static_cast<uint32_t>(bloom_filter_hashes_.size()),
+                          properties_->bloom_filter_fpp(descr_->path())) /
+                      8);
+    for (uint64_t hash : bloom_filter_hashes_) {
+      bloom_filter.InsertHash(hash);
+    }
+    bloom_filter_hashes_.clear();
+    pager_->WriteBloomFilter(bloom_filter);
+  }
+
   EncodedStatistics GetPageStatistics() override {
     EncodedStatistics result;
     if (page_statistics_) result = page_statistics_->Encode();
@@ -957,6 +1070,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
 
+  // Hashes of the distinct values of the chunk, inserted into a bloom filter
+  // sized for them on Close
+  bool bloom_filter_enabled_;
+  MurmurHash3 bloom_filter_hasher_;
+  std::unordered_set<uint64_t> bloom_filter_hashes_;
+
+  void UpdateBloomFilter(const T& value) {
+    bloom_filter_hashes_.insert(
+        BloomFilterHash(bloom_filter_hasher_, value, descr_->type_length()));
+  }
+
   // If writing a sequence of arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
   // subsequent array chunks to see either if materialization is required (in
@@ -1050,11 +1174,36 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     num_buffered_values_ += num_levels;
     num_buffered_encoded_values_ += num_values;
 
-    if (current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
+    if (current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize() ||
+        rows_written_ - page_first_row_index_ >= properties_->max_rows_per_page()) {
       AddDataPage();
     }
   }
 
+  // Call action(offset, batch_size) for batches of the total levels. Batches
+  // hold at most write_batch_size levels, and at most as many as rows remain
+  // for the current page, which bounds the rows they start. limit_batch may
+  // shorten a batch further.
+  template <typename LimitBatch, typename Action>
+  void DoInPageBatches(int64_t total, LimitBatch&& limit_batch, Action&& action) {
+    int64_t offset = 0;
+    while (offset < total) {
+      const int64_t page_rows = rows_written_ - page_first_row_index_;
+      int64_t batch_size = std::min(total - offset, properties_->write_batch_size());
+      batch_size = std::min(batch_size, properties_->max_rows_per_page() - page_rows);
+      batch_size = limit_batch(std::max<int64_t>(batch_size, 1));
+      action(offset, batch_size);
+      offset += batch_size;
+    }
+  }
+
+  template <typename Action>
+  void DoInPageBatches(int64_t total, Action&& action) {
+    DoInPageBatches(
+        total, [](int64_t batch_size) { return batch_size; },
+        std::forward<Action>(action));
+  }
+
   void FallbackToPlainEncoding() {
     if (IsDictionaryEncoding(current_encoder_->encoding())) {
       WriteDictionaryPage();
@@ -1095,6 +1244,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_enabled_) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        UpdateBloomFilter(values[i]);
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1112,6 +1266,22 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_enabled_) {
+      if (descr_->schema_node()->is_optional()) {
+        arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                        num_spaced_values);
+        for (int64_t i = 0; i < num_spaced_values; ++i) {
+          if (valid_bits_reader.IsSet()) {
+            UpdateBloomFilter(values[i]);
+          }
+          valid_bits_reader.Next();
+        }
+      } else {
+        for (int64_t i = 0; i < num_values; ++i) {
+          UpdateBloomFilter(values[i]);
+        }
+      }
+    }
   }
 };
 
@@ -1144,13 +1314,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_enabled_) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. The bloom filter needs the
+    // observed values, so it also goes through the dense path
     return WriteDense();
   }
 
@@ -1187,8 +1358,7 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     return WriteDense();
   }
 
-  PARQUET_CATCH_NOT_OK(
-      DoInBatches(num_levels, properties_->write_batch_size(), WriteIndicesChunk));
+  PARQUET_CATCH_NOT_OK(DoInPageBatches(num_levels, WriteIndicesChunk));
   return Status::OK();
 }
 
@@ -1599,13 +1769,59 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_enabled_) {
+      const auto& binary_slice = checked_cast<const arrow::BinaryArray&>(*data_slice);
+      for (int64_t i = 0; i < binary_slice.length(); ++i) {
+        if (binary_slice.IsValid(i)) {
+          UpdateBloomFilter(ByteArray(binary_slice.GetView(i)));
+        }
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
   };
 
-  PARQUET_CATCH_NOT_OK(
-      DoInBatches(num_levels, properties_->write_batch_size(), WriteChunk));
+  // A batch of n levels holds at most the n values from value_offset on, which
+  // bounds their PLAIN-encoded size. Batches are cut short where this would
+  // overshoot the data page size, so that wide values do not make huge pages.
+  const auto& binary_array = checked_cast<const arrow::BinaryArray&>(array);
+  auto LimitBatchBytes = [&](int64_t batch_size) -> int64_t {
+    if (IsDictionaryEncoding(current_encoder_->encoding())) {
+      return batch_size;
+    }
+    const int32_t* offsets = binary_array.raw_value_offsets() + value_offset;
+    const int64_t values_left = array.length() - value_offset;
+    auto EncodedSize = [&](int64_t num_values) -> int64_t {
+      num_values = std::min(num_values, values_left);
+      return offsets[num_values] - offsets[0] +
+             num_values * static_cast<int64_t>(sizeof(uint32_t));
+    };
+    auto PageBytesLeft = [&]() -> int64_t {
+      return properties_->data_pagesize() - current_encoder_->EstimatedDataEncodedSize();
+    };
+    if (EncodedSize(batch_size) <= PageBytesLeft()) {
+      return batch_size;
+    }
+    if (EncodedSize(1) > PageBytesLeft() && num_buffered_values_ > 0) {
+      AddDataPage();
+    }
+    // The largest batch that fits, but at least one level
+    const int64_t bytes_left = PageBytesLeft();
+    int64_t low = 1;
+    int64_t high = batch_size;
+    while (low < high) {
+      const int64_t mid = low + (high - low + 1) / 2;
+      if (EncodedSize(mid) <= bytes_left) {
+        low = mid;
+      } else {
+        high = mid - 1;
+      }
+    }
+    return low;
+  };
+
+  PARQUET_CATCH_NOT_OK(DoInPageBatches(num_levels, LimitBatchBytes, WriteChunk));
   return Status::OK();
 }
 
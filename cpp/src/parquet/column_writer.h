@@ -42,6 +42,8 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
+class ColumnChunkPageIndexBuilder;
 class ColumnDescriptor;
 class CompressedDataPage;
 class DictionaryPage;
@@ -83,6 +85,8 @@ class PARQUET_EXPORT PageWriter {
  public:
   virtual ~PageWriter() {}
 
+  // If compression_dictionary is given, pages are compressed with it, see
+  // ColumnProperties::compression_dictionary
   static std::unique_ptr<PageWriter> Open(
       std::shared_ptr<ArrowOutputStream> sink, Compression::type codec,
       int compression_level, ColumnChunkMetaDataBuilder* metadata,
@@ -90,7 +94,9 @@ class PARQUET_EXPORT PageWriter {
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       bool buffered_row_group = false,
       std::shared_ptr<Encryptor> header_encryptor = NULLPTR,
-      std::shared_ptr<Encryptor> data_encryptor = NULLPTR);
+      std::shared_ptr<Encryptor> data_encryptor = NULLPTR,
+      ColumnChunkPageIndexBuilder* page_index_builder = NULLPTR,
+      std::shared_ptr<Buffer> compression_dictionary = NULLPTR);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
@@ -101,6 +107,10 @@ class PARQUET_EXPORT PageWriter {
 
   virtual int64_t WriteDictionaryPage(const DictionaryPage& page) = 0;
 
+  // Write the bloom filter of the column chunk after its pages and record its
+  // offset in the column chunk metadata. Must be called before Close
+  virtual void WriteBloomFilter(const BloomFilter& bloom_filter);
+
   virtual bool has_compressor() = 0;
 
   virtual void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) = 0;
@@ -136,6 +146,11 @@ class PARQUET_EXPORT ColumnWriter {
   /// dictionary pages to the ColumnChunk so far
   virtual int64_t total_bytes_written() const = 0;
 
+  /// \brief Estimated size in bytes of the data held by the writer itself:
+  /// levels and values not in a page yet, data pages kept until the
+  /// dictionary page is written and the dictionary
+  virtual int64_t estimated_buffered_bytes() const = 0;
+
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
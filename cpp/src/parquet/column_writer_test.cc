@@ -20,6 +20,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/builder.h"
 #include "arrow/io/buffered.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -382,22 +383,76 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+}
+*/
+
+template <typename TestType>
+class TestDeltaBitPackWriter : public TestPrimitiveWriter<TestType> {};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+
+TYPED_TEST_CASE(TestDeltaBitPackWriter, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackWriter, RequiredDeltaBinaryPacked) {
   this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+TYPED_TEST(TestDeltaBitPackWriter, OptionalDeltaBinaryPacked) {
+  this->SetUpSchema(Repetition::OPTIONAL);
+
+  this->GenerateData(SMALL_SIZE);
+  std::vector<int16_t> definition_levels(SMALL_SIZE, 1);
+  definition_levels[1] = 0;
+
+  ColumnProperties column_properties;
+  column_properties.set_encoding(Encoding::DELTA_BINARY_PACKED);
+  auto writer = this->BuildWriter(SMALL_SIZE, column_properties);
+  writer->WriteBatch(this->values_.size(), definition_levels.data(), nullptr,
+                     this->values_ptr_);
+  writer->Close();
+
+  this->ReadColumn();
+  ASSERT_EQ(99, this->values_read_);
+  this->values_out_.resize(99);
+  this->values_.resize(99);
+  ASSERT_EQ(this->values_, this->values_out_);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+template <typename TestType>
+class TestByteStreamSplitWriter : public TestPrimitiveWriter<TestType> {};
+
+typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+
+TYPED_TEST_CASE(TestByteStreamSplitWriter, ByteStreamSplitTypes);
+
+TYPED_TEST(TestByteStreamSplitWriter, RequiredByteStreamSplit) {
+  this->TestRequiredWithEncoding(Encoding::BYTE_STREAM_SPLIT);
+  std::vector<Encoding::type> expected({Encoding::BYTE_STREAM_SPLIT, Encoding::RLE});
+  ASSERT_EQ(expected, this->metadata_encodings());
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+TYPED_TEST(TestByteStreamSplitWriter, OptionalByteStreamSplit) {
+  this->SetUpSchema(Repetition::OPTIONAL);
+
+  this->GenerateData(SMALL_SIZE);
+  std::vector<int16_t> definition_levels(SMALL_SIZE, 1);
+  definition_levels[1] = 0;
+
+  ColumnProperties column_properties;
+  column_properties.set_encoding(Encoding::BYTE_STREAM_SPLIT);
+  auto writer = this->BuildWriter(SMALL_SIZE, column_properties);
+  writer->WriteBatch(this->values_.size(), definition_levels.data(), nullptr,
+                     this->values_ptr_);
+  writer->Close();
+
+  this->ReadColumn();
+  ASSERT_EQ(99, this->values_read_);
+  this->values_out_.resize(99);
+  this->values_.resize(99);
+  ASSERT_EQ(this->values_, this->values_out_);
 }
-*/
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
@@ -681,6 +736,14 @@ TEST_F(TestByteArrayValuesWriter, CheckDefaultStats) {
   ASSERT_TRUE(this->metadata_is_stats_set());
 }
 
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+}
+
 TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   // In ARROW-3930 we discovered a bug when writing from Arrow when we had data
   // that looks like this:
@@ -728,6 +791,85 @@ TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   writer->Close();
 }
 
+// Write a required column with the given properties and return its data pages
+template <typename WriteColumn>
+std::vector<std::shared_ptr<DataPage>> WriteDataPages(
+    const NodePtr& node, const std::shared_ptr<WriterProperties>& props,
+    int64_t num_rows, WriteColumn&& write_column) {
+  SchemaDescriptor schema;
+  schema.Init(GroupNode::Make("schema", Repetition::REQUIRED, {node}));
+
+  auto sink = CreateOutputStream();
+  auto metadata = ColumnChunkMetaDataBuilder::Make(props, schema.Column(0));
+  std::unique_ptr<PageWriter> pager =
+      PageWriter::Open(sink, Compression::UNCOMPRESSED,
+                       Codec::UseDefaultCompressionLevel(), metadata.get());
+  std::shared_ptr<ColumnWriter> writer =
+      ColumnWriter::Make(metadata.get(), std::move(pager), props.get());
+  write_column(writer.get());
+  writer->Close();
+
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_ASSIGN_OR_THROW(buffer, sink->Finish());
+  auto page_reader =
+      PageReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer), num_rows,
+                       Compression::UNCOMPRESSED);
+  std::vector<std::shared_ptr<DataPage>> pages;
+  while (auto page = page_reader->NextPage()) {
+    if (page->type() == PageType::DATA_PAGE) {
+      pages.push_back(std::static_pointer_cast<DataPage>(page));
+    }
+  }
+  return pages;
+}
+
+TEST(TestColumnWriter, MaxRowsPerPage) {
+  const int64_t num_rows = 1000;
+  std::vector<int32_t> values(num_rows, 42);
+  auto props = WriterProperties::Builder()
+                   .disable_dictionary()
+                   ->write_batch_size(64)
+                   ->max_rows_per_page(100)
+                   ->build();
+  auto pages = WriteDataPages(schema::Int32("a", Repetition::REQUIRED), props, num_rows,
+                              [&](ColumnWriter* writer) {
+                                static_cast<Int32Writer*>(writer)->WriteBatch(
+                                    num_rows, nullptr, nullptr, values.data());
+                              });
+  ASSERT_EQ(10, pages.size());
+  for (const auto& page : pages) {
+    ASSERT_EQ(100, page->num_values());
+  }
+}
+
+TEST(TestColumnWriter, ByteArrayPagesFromArrowRespectPageSize) {
+  // A single batch of wide values would make one page of several times the
+  // page size
+  const int64_t num_rows = 20;
+  const int64_t kPageSize = 1024;
+  ::arrow::StringBuilder builder;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ASSERT_OK(builder.Append(std::string(500, static_cast<char>('a' + i))));
+  }
+  std::shared_ptr<::arrow::Array> array;
+  ASSERT_OK(builder.Finish(&array));
+
+  auto props =
+      WriterProperties::Builder().disable_dictionary()->data_pagesize(kPageSize)->build();
+  ArrowWriteContext ctx(::arrow::default_memory_pool(),
+                        default_arrow_writer_properties().get());
+  auto pages = WriteDataPages(
+      schema::ByteArray("a", Repetition::REQUIRED), props, num_rows,
+      [&](ColumnWriter* writer) {
+        ASSERT_OK(writer->WriteArrow(nullptr, nullptr, num_rows, *array, &ctx));
+      });
+  ASSERT_EQ(10, pages.size());
+  for (const auto& page : pages) {
+    ASSERT_EQ(2, page->num_values());
+    ASSERT_LE(page->size(), kPageSize);
+  }
+}
+
 void GenerateLevels(int min_repeat_factor, int max_repeat_factor, int max_level,
                     std::vector<int16_t>& input_levels) {
   // for each repetition count upto max_repeat_factor
@@ -22,6 +22,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "arrow/builder.h"
 #include "arrow/stl.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/byte_stream_split.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -815,6 +817,434 @@ void DictEncoderImpl<ByteArrayType>::PutDictionary(const arrow::Array& values) {
   }
 }
 
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT encoder implementation
+
+// Values are buffered as in PLAIN encoding and split into byte streams when
+// the page is flushed, as every stream spans all the values of the page
+template <typename DType>
+class ByteStreamSplitEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using ArrowType = typename EncodingTraits<DType>::ArrowType;
+
+  explicit ByteStreamSplitEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::BYTE_STREAM_SPLIT, pool), sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override { return sink_.length(); }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer(pool_, sink_.length());
+    ::arrow::util::internal::ByteStreamSplitEncode(
+        reinterpret_cast<const T*>(sink_.data()), sink_.length() / sizeof(T),
+        buffer->mutable_data());
+    sink_.Reset();
+    return buffer;
+  }
+
+  using TypedEncoder<DType>::Put;
+
+  void Put(const T* buffer, int num_values) override {
+    if (num_values > 0) {
+      PARQUET_THROW_NOT_OK(sink_.Append(buffer, num_values * sizeof(T)));
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    DirectPutImpl<typename arrow::TypeTraits<ArrowType>::ArrayType>(values, &sink_);
+  }
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_THROW_NOT_OK(sink_.Reserve(num_values * sizeof(T)));
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        sink_.UnsafeAppend(&src[i], sizeof(T));
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+ protected:
+  arrow::BufferBuilder sink_;
+};
+
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoder implementation
+
+// Put the values of src whose validity bit is set, in batches
+template <typename DType>
+void PutValidValues(TypedEncoder<DType>* encoder, const typename DType::c_type* src,
+                    int num_values, const uint8_t* valid_bits,
+                    int64_t valid_bits_offset) {
+  constexpr int kBatchSize = 256;
+  typename DType::c_type batch[kBatchSize];
+  int batch_size = 0;
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  for (int i = 0; i < num_values; ++i) {
+    if (valid_bits_reader.IsSet()) {
+      batch[batch_size++] = src[i];
+      if (batch_size == kBatchSize) {
+        encoder->Put(batch, batch_size);
+        batch_size = 0;
+      }
+    }
+    valid_bits_reader.Next();
+  }
+  if (batch_size > 0) {
+    encoder->Put(batch, batch_size);
+  }
+}
+
+// Bit pack values of bit_width bits, least significant bit first. The
+// packed bytes are written 8 at a time, so the last word may end up short.
+template <typename UT>
+void PackBits(const UT* values, int num_values, int bit_width, uint8_t* out) {
+  uint64_t buffered_values = 0;
+  int bit_offset = 0;
+  for (int i = 0; i < num_values; ++i) {
+    const uint64_t value = static_cast<uint64_t>(values[i]);
+    buffered_values |= value << bit_offset;
+    bit_offset += bit_width;
+    if (bit_offset >= 64) {
+      memcpy(out, &buffered_values, 8);
+      out += 8;
+      bit_offset -= 64;
+      // Bits of the value that did not fit in the word
+      buffered_values = bit_offset == 0 ? 0 : value >> (bit_width - bit_offset);
+    }
+  }
+  memcpy(out, &buffered_values, BitUtil::BytesForBits(bit_offset));
+}
+
+// The values are written as a header (block size, miniblocks per block, total
+// number of values and first value) followed by blocks of deltas between
+// consecutive values. Each block stores its minimum delta and the bit width
+// of each of its miniblocks, which bit pack the deltas minus the minimum.
+// Deltas wrap around like the unsigned arithmetic of T.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using ArrowType = typename EncodingTraits<DType>::ArrowType;
+
+  static constexpr int kValuesPerBlock = 128;
+  static constexpr int kMiniBlocksPerBlock = 4;
+  static constexpr int kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+  static constexpr int kMaxHeaderSize = 3 * BitUtil::BitReader::MAX_VLQ_BYTE_LEN +
+                                        BitUtil::BitReader::MAX_VLQ_INT64_BYTE_LEN;
+  static constexpr int kMaxBlockSize = BitUtil::BitReader::MAX_VLQ_INT64_BYTE_LEN +
+                                       kMiniBlocksPerBlock +
+                                       kValuesPerBlock * static_cast<int>(sizeof(T));
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderSize + sink_.length() +
+           (values_current_block_ > 0 ? kMaxBlockSize : 0);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  using TypedEncoder<DType>::Put;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PutValidValues<DType>(this, src, num_values, valid_bits, valid_bits_offset);
+  }
+
+ private:
+  void FlushBlock();
+
+  arrow::BufferBuilder sink_;
+  int total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  UT deltas_[kValuesPerBlock];
+  int values_current_block_ = 0;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int i = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    i = 1;
+  }
+  total_value_count_ += num_values;
+  while (i < num_values) {
+    const int batch_size =
+        std::min(num_values - i, kValuesPerBlock - values_current_block_);
+    UT* deltas = deltas_ + values_current_block_;
+    deltas[0] = static_cast<UT>(src[i]) - static_cast<UT>(current_value_);
+    for (int j = 1; j < batch_size; ++j) {
+      deltas[j] = static_cast<UT>(src[i + j]) - static_cast<UT>(src[i + j - 1]);
+    }
+    current_value_ = src[i + batch_size - 1];
+    values_current_block_ += batch_size;
+    i += batch_size;
+    if (values_current_block_ == kValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  const int num_values = values_current_block_;
+  T min_delta = static_cast<T>(deltas_[0]);
+  for (int i = 1; i < num_values; ++i) {
+    min_delta = std::min(min_delta, static_cast<T>(deltas_[i]));
+  }
+  for (int i = 0; i < num_values; ++i) {
+    deltas_[i] -= static_cast<UT>(min_delta);
+  }
+  // Pad the last miniblock in use
+  std::fill(deltas_ + num_values, deltas_ + kValuesPerBlock, 0);
+
+  PARQUET_THROW_NOT_OK(sink_.Reserve(kMaxBlockSize));
+  BitUtil::BitWriter writer(sink_.mutable_data() + sink_.length(), kMaxBlockSize);
+  writer.PutZigZagVlqInt(static_cast<int64_t>(min_delta));
+  uint8_t* bit_widths = writer.GetNextBytePtr(kMiniBlocksPerBlock);
+  for (int i = 0; i < kMiniBlocksPerBlock; ++i) {
+    const UT* deltas = deltas_ + i * kValuesPerMiniBlock;
+    if (i * kValuesPerMiniBlock >= num_values) {
+      // Miniblocks past the last value have no body
+      bit_widths[i] = 0;
+      continue;
+    }
+    UT all_bits = 0;
+    for (int j = 0; j < kValuesPerMiniBlock; ++j) {
+      all_bits |= deltas[j];
+    }
+    const int bit_width = BitUtil::NumRequiredBits(static_cast<uint64_t>(all_bits));
+    bit_widths[i] = static_cast<uint8_t>(bit_width);
+    uint8_t* out = writer.GetNextBytePtr(kValuesPerMiniBlock * bit_width / 8);
+    PackBits(deltas, kValuesPerMiniBlock, bit_width, out);
+  }
+  sink_.UnsafeAdvance(writer.bytes_written());
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  if (values_current_block_ > 0) {
+    FlushBlock();
+  }
+  uint8_t header[kMaxHeaderSize];
+  BitUtil::BitWriter writer(header, kMaxHeaderSize);
+  writer.PutVlqInt(kValuesPerBlock);
+  writer.PutVlqInt(kMiniBlocksPerBlock);
+  writer.PutVlqInt(static_cast<uint32_t>(total_value_count_));
+  writer.PutZigZagVlqInt(static_cast<int64_t>(first_value_));
+  writer.Flush();
+  const int header_size = writer.bytes_written();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(pool_, header_size + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_size);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_size, sink_.data(), sink_.length());
+  }
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return buffer;
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const arrow::Array& values) {
+  using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+  if (values.type_id() != ArrowType::type_id) {
+    throw ParquetException("direct put to " + std::string(ArrowType::type_name()) +
+                           " from " + values.type()->ToString() + " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+              data.null_bitmap_data(), data.offset());
+  }
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY encoder implementation
+
+// Put the valid values of a BinaryArray in batches
+void PutBinaryArray(const arrow::Array& values, ByteArrayEncoder* encoder) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+  constexpr int kBatchSize = 256;
+  ByteArray batch[kBatchSize];
+  int batch_size = 0;
+  for (int64_t i = 0; i < data.length(); ++i) {
+    if (data.IsValid(i)) {
+      batch[batch_size++] = data.GetView(i);
+      if (batch_size == kBatchSize) {
+        encoder->Put(batch, batch_size);
+        batch_size = 0;
+      }
+    }
+  }
+  if (batch_size > 0) {
+    encoder->Put(batch, batch_size);
+  }
+}
+
+// The lengths of all values are DELTA_BINARY_PACKED encoded, followed by the
+// concatenated values
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(pool_, lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+    }
+    sink_.Reset();
+    return buffer;
+  }
+
+  using TypedEncoder<ByteArrayType>::Put;
+
+  void Put(const ByteArray* src, int num_values) override {
+    constexpr int kBatchSize = 256;
+    int32_t lengths[kBatchSize];
+    for (int i = 0; i < num_values; i += kBatchSize) {
+      const int batch_size = std::min(kBatchSize, num_values - i);
+      int64_t total_length = 0;
+      for (int j = 0; j < batch_size; ++j) {
+        lengths[j] = static_cast<int32_t>(src[i + j].len);
+        total_length += src[i + j].len;
+      }
+      length_encoder_.Put(lengths, batch_size);
+      PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+      for (int j = 0; j < batch_size; ++j) {
+        DCHECK(src[i + j].len == 0 || src[i + j].ptr != nullptr)
+            << "Value ptr cannot be NULL";
+        sink_.UnsafeAppend(src[i + j].ptr, src[i + j].len);
+      }
+    }
+  }
+
+  void Put(const arrow::Array& values) override { PutBinaryArray(values, this); }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PutValidValues<ByteArrayType>(this, src, num_values, valid_bits, valid_bits_offset);
+  }
+
+ private:
+  arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+// ----------------------------------------------------------------------
+// DELTA_BYTE_ARRAY encoder implementation
+
+// Each value is split into the length of the prefix it shares with the
+// previous value, DELTA_BINARY_PACKED encoded, and the rest of the value,
+// DELTA_LENGTH_BYTE_ARRAY encoded after all the prefix lengths
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(pool_, prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Prefixes don't span pages
+    last_value_.clear();
+    return buffer;
+  }
+
+  using TypedEncoder<ByteArrayType>::Put;
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) {
+      return;
+    }
+    constexpr int kBatchSize = 256;
+    int32_t prefix_lengths[kBatchSize];
+    ByteArray suffixes[kBatchSize];
+    ByteArray previous(static_cast<uint32_t>(last_value_.size()),
+                       reinterpret_cast<const uint8_t*>(last_value_.data()));
+    for (int i = 0; i < num_values; i += kBatchSize) {
+      const int batch_size = std::min(kBatchSize, num_values - i);
+      for (int j = 0; j < batch_size; ++j) {
+        const ByteArray& value = src[i + j];
+        const uint32_t max_prefix_length = std::min(previous.len, value.len);
+        uint32_t prefix_length = 0;
+        while (prefix_length < max_prefix_length &&
+               previous.ptr[prefix_length] == value.ptr[prefix_length]) {
+          ++prefix_length;
+        }
+        prefix_lengths[j] = static_cast<int32_t>(prefix_length);
+        suffixes[j] = ByteArray(value.len - prefix_length, value.ptr + prefix_length);
+        previous = value;
+      }
+      prefix_length_encoder_.Put(prefix_lengths, batch_size);
+      suffix_encoder_.Put(suffixes, batch_size);
+    }
+    // The values may not outlive this call
+    last_value_.assign(reinterpret_cast<const char*>(previous.ptr), previous.len);
+  }
+
+  void Put(const arrow::Array& values) override { PutBinaryArray(values, this); }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PutValidValues<ByteArrayType>(this, src, num_values, valid_bits, valid_bits_offset);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -863,6 +1293,36 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         DCHECK(false) << "Encoder not implemented";
         break;
     }
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<FloatType>(descr, pool));
+      case Type::DOUBLE:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<DoubleType>(descr, pool));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -903,6 +1363,8 @@ class PlainDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
 
   int Decode(T* buffer, int max_values) override;
 
+  int Skip(int num_values) override;
+
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* builder) override;
@@ -1065,6 +1527,46 @@ int PlainDecoder<DType>::Decode(T* buffer, int max_values) {
   return max_values;
 }
 
+// The number of bytes taken by the next num_values PLAIN values
+template <typename T>
+inline int64_t PlainValuesSize(const uint8_t* data, int64_t data_size, int num_values,
+                               int type_length) {
+  return static_cast<int64_t>(num_values) * static_cast<int64_t>(sizeof(T));
+}
+
+template <>
+inline int64_t PlainValuesSize<ByteArray>(const uint8_t* data, int64_t data_size,
+                                          int num_values, int type_length) {
+  int64_t size = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (data_size - size < static_cast<int64_t>(sizeof(uint32_t))) {
+      ParquetException::EofException();
+    }
+    size += sizeof(uint32_t) + arrow::util::SafeLoadAs<uint32_t>(data + size);
+  }
+  return size;
+}
+
+template <>
+inline int64_t PlainValuesSize<FixedLenByteArray>(const uint8_t* data,
+                                                  int64_t data_size, int num_values,
+                                                  int type_length) {
+  return static_cast<int64_t>(num_values) * type_length;
+}
+
+template <typename DType>
+int PlainDecoder<DType>::Skip(int num_values) {
+  num_values = std::min(num_values, num_values_);
+  const int64_t bytes_skipped = PlainValuesSize<T>(data_, len_, num_values, type_length_);
+  if (bytes_skipped > len_) {
+    ParquetException::EofException();
+  }
+  data_ += bytes_skipped;
+  len_ -= static_cast<int>(bytes_skipped);
+  num_values_ -= num_values;
+  return num_values;
+}
+
 class PlainBooleanDecoder : public DecoderImpl,
                             virtual public TypedDecoder<BooleanType>,
                             virtual public BooleanDecoder {
@@ -1427,6 +1929,28 @@ class PlainFLBADecoder : public PlainDecoder<FLBAType>, virtual public FLBADecod
 // ----------------------------------------------------------------------
 // Dictionary encoding and decoding
 
+// Append dictionary indices to the Arrow dictionary builder for the physical
+// type (a BinaryDictionary32Builder for BYTE_ARRAY)
+template <typename DType>
+void AppendDictIndices(arrow::ArrayBuilder* builder, const int32_t* indices,
+                       int64_t length, const uint8_t* valid_bytes = NULLPTR) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<DType>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+}
+
+template <>
+void AppendDictIndices<BooleanType>(arrow::ArrayBuilder* builder, const int32_t* indices,
+                                    int64_t length, const uint8_t* valid_bytes) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+void AppendDictIndices<Int96Type>(arrow::ArrayBuilder* builder, const int32_t* indices,
+                                  int64_t length, const uint8_t* valid_bytes) {
+  ParquetException::NYI("Dictionary indices to Int96Type");
+}
+
 template <typename Type>
 class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
  public:
@@ -1467,6 +1991,22 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     return num_values;
   }
 
+  // Only the indices are decoded, not looked up in the dictionary
+  int Skip(int num_values) override {
+    num_values = std::min(num_values, num_values_);
+    if (num_values > 0) {
+      PARQUET_THROW_NOT_OK(indices_scratch_space_->TypedResize<int32_t>(
+          num_values, /*shrink_to_fit=*/false));
+    }
+    auto indices_buffer =
+        reinterpret_cast<int32_t*>(indices_scratch_space_->mutable_data());
+    if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
+      ParquetException::EofException();
+    }
+    num_values_ -= num_values;
+    return num_values;
+  }
+
   int DecodeSpaced(T* buffer, int num_values, int null_count, const uint8_t* valid_bits,
                    int64_t valid_bits_offset) override {
     num_values = std::min(num_values, num_values_);
@@ -1487,6 +2027,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
                   int64_t valid_bits_offset,
                   typename EncodingTraits<Type>::DictAccumulator* out) override;
 
+  std::shared_ptr<arrow::Array> GetDictionary() override;
+
   void InsertDictionary(arrow::ArrayBuilder* builder) override;
 
   int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
@@ -1515,9 +2057,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendDictIndices<Type>(builder, indices_buffer, num_values, valid_bytes.data());
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1537,8 +2077,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendDictIndices<Type>(builder, indices_buffer, num_values);
     num_values_ -= num_values;
     return num_values;
   }
@@ -1569,7 +2108,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   std::shared_ptr<ResizableBuffer> byte_array_offsets_;
 
   // Reusable buffer for decoding dictionary indices to be appended to a
-  // BinaryDictionary32Builder
+  // Dictionary32Builder
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   arrow::util::RleDecoder idx_decoder_;
@@ -1791,18 +2330,51 @@ int DictDecoderImpl<Type>::DecodeArrow(
 }
 
 template <typename Type>
-void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+std::shared_ptr<arrow::Array> DictDecoderImpl<Type>::GetDictionary() {
+  using ArrayType =
+      typename arrow::TypeTraits<typename EncodingTraits<Type>::ArrowType>::ArrayType;
+  return std::make_shared<ArrayType>(dictionary_length_, dictionary_);
 }
 
 template <>
-void DictDecoderImpl<ByteArrayType>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
+std::shared_ptr<arrow::Array> DictDecoderImpl<BooleanType>::GetDictionary() {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
 
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<Int96Type>::GetDictionary() {
+  ParquetException::NYI("Dictionary to Int96Type");
+}
+
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<ByteArrayType>::GetDictionary() {
   // Make a BinaryArray referencing the internal dictionary data
-  auto arr = std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
-                                                  byte_array_data_);
-  PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*arr));
+  return std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
+                                              byte_array_data_);
+}
+
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<FLBAType>::GetDictionary() {
+  return std::make_shared<arrow::FixedSizeBinaryArray>(
+      arrow::fixed_size_binary(descr_->type_length()), dictionary_length_,
+      byte_array_data_);
+}
+
+template <typename Type>
+void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(*GetDictionary()));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary to Int96Type");
 }
 
 class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
@@ -2006,6 +2578,88 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
   }
 };
 
+// ----------------------------------------------------------------------
+// Arrow read paths of decoders that decode the non-null values first
+
+// Decode the non-null values of a batch, then append them around the nulls
+template <typename DType, typename BuilderType>
+int DecodeArrowWithNulls(TypedDecoder<DType>* decoder, int num_values, int null_count,
+                         const uint8_t* valid_bits, int64_t valid_bits_offset,
+                         BuilderType* builder) {
+  const int values_to_decode = num_values - null_count;
+  std::vector<typename DType::c_type> values(values_to_decode);
+  if (decoder->Decode(values.data(), values_to_decode) != values_to_decode) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  int value_index = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (bit_reader.IsSet()) {
+      PARQUET_THROW_NOT_OK(builder->Append(values[value_index++]));
+    } else {
+      PARQUET_THROW_NOT_OK(builder->AppendNull());
+    }
+    bit_reader.Next();
+  }
+  return values_to_decode;
+}
+
+int DecodeArrowWithNulls(ByteArrayDecoder* decoder, int num_values, int null_count,
+                         const uint8_t* valid_bits, int64_t valid_bits_offset,
+                         arrow::BinaryDictionary32Builder* builder) {
+  const int values_to_decode = num_values - null_count;
+  std::vector<ByteArray> values(values_to_decode);
+  if (decoder->Decode(values.data(), values_to_decode) != values_to_decode) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  int value_index = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (bit_reader.IsSet()) {
+      const ByteArray& value = values[value_index++];
+      PARQUET_THROW_NOT_OK(builder->Append(value.ptr, static_cast<int32_t>(value.len)));
+    } else {
+      PARQUET_THROW_NOT_OK(builder->AppendNull());
+    }
+    bit_reader.Next();
+  }
+  return values_to_decode;
+}
+
+int DecodeArrowWithNulls(ByteArrayDecoder* decoder, int num_values, int null_count,
+                         const uint8_t* valid_bits, int64_t valid_bits_offset,
+                         typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  const int values_to_decode = num_values - null_count;
+  std::vector<ByteArray> values(values_to_decode);
+  if (decoder->Decode(values.data(), values_to_decode) != values_to_decode) {
+    ParquetException::EofException();
+  }
+
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  int value_index = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (bit_reader.IsSet()) {
+      const ByteArray& value = values[value_index++];
+      if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+        // This element would exceed the capacity of a chunk
+        PARQUET_THROW_NOT_OK(helper.PushChunk());
+        PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values - i));
+      }
+      PARQUET_THROW_NOT_OK(helper.Append(value.ptr, static_cast<int32_t>(value.len)));
+    } else {
+      PARQUET_THROW_NOT_OK(helper.AppendNull());
+    }
+    bit_reader.Next();
+  }
+  return values_to_decode;
+}
+
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
@@ -2013,6 +2667,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2023,10 +2678,10 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   }
 
   void SetData(int num_values, const uint8_t* data, int len) override {
+    // num_values includes the nulls, the header has the count of encoded values
     this->num_values_ = num_values;
-    decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    decoder_.Reset(data, len);
+    InitHeader();
   }
 
   int Decode(T* buffer, int max_values) override {
@@ -2036,97 +2691,143 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    return DecodeArrowWithNulls<DType>(this, num_values, null_count, valid_bits,
+                                       valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    return DecodeArrowWithNulls<DType>(this, num_values, null_count, valid_bits,
+                                       valid_bits_offset, out);
+  }
+
+  /// \brief The number of values in the encoded data
+  int ValidValuesCount() const { return total_value_count_; }
+
+  /// \brief The number of bytes after the encoded values, once all of them
+  /// are decoded
+  int BytesLeft() {
+    DCHECK_EQ(total_values_remaining_, 0);
+    // Skip the padding of the last miniblock
+    return decoder_.bytes_left() -
+           static_cast<int>(values_current_mini_block_ * delta_bit_width_ / 8);
   }
 
  private:
-  void InitBlock() {
+  static constexpr int kMaxDeltaBitWidth = static_cast<int>(sizeof(T) * 8);
+
+  void InitHeader() {
     int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&block_size) || !decoder_.GetVlqInt(&num_mini_blocks_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
-
+    if (block_size <= 0 || num_mini_blocks_ <= 0 || block_size % num_mini_blocks_ != 0 ||
+        (block_size / num_mini_blocks_) % 32 != 0 || total_value_count_ < 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = block_size / num_mini_blocks_;
     delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
+    total_values_remaining_ = total_value_count_;
+    first_value_pending_ = total_value_count_ > 0;
+    last_value_ = static_cast<UT>(first_value);
+    // The first delta starts a new block
+    mini_block_idx_ = num_mini_blocks_ - 1;
+    values_current_mini_block_ = 0;
+    delta_bit_width_ = 0;
+  }
+
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
+
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
     for (int i = 0; i < num_mini_blocks_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+  }
+
+  void InitMiniBlock() {
+    if (++mini_block_idx_ == num_mini_blocks_) {
+      InitBlock();
+    }
+    delta_bit_width_ = delta_bit_widths_->data()[mini_block_idx_];
+    if (ARROW_PREDICT_FALSE(delta_bit_width_ > kMaxDeltaBitWidth)) {
+      throw ParquetException("Delta bit width larger than the integer bit width");
+    }
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
+  // Unpack num_values deltas of the current miniblock
+  void UnpackDeltas(UT* deltas, int num_values) {
+    if (delta_bit_width_ <= 32) {
+      // Whole miniblocks are unpacked 32 values at a time
+      if (decoder_.GetBatch(delta_bit_width_, deltas, num_values) != num_values) {
+        ParquetException::EofException();
+      }
+      return;
+    }
+    for (int i = 0; i < num_values; ++i) {
+      uint64_t low_bits, high_bits;
+      if (!decoder_.GetValue(32, &low_bits) ||
+          !decoder_.GetValue(delta_bit_width_ - 32, &high_bits)) {
+        ParquetException::EofException();
+      }
+      deltas[i] = static_cast<UT>(low_bits | (high_bits << 32));
+    }
+  }
+
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
+    max_values = std::min(max_values, total_values_remaining_);
+    int i = 0;
+    if (ARROW_PREDICT_FALSE(first_value_pending_ && max_values > 0)) {
+      buffer[i++] = static_cast<T>(last_value_);
+      first_value_pending_ = false;
+    }
+    while (i < max_values) {
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
+        InitMiniBlock();
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int batch_size = std::min(max_values - i, values_current_mini_block_);
+      UT* deltas = reinterpret_cast<UT*>(buffer + i);
+      UnpackDeltas(deltas, batch_size);
+      UT value = last_value_;
+      for (int j = 0; j < batch_size; ++j) {
+        value += min_delta_ + deltas[j];
+        deltas[j] = value;
+      }
+      last_value_ = value;
+      values_current_mini_block_ -= batch_size;
+      i += batch_size;
     }
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
-  int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  int32_t num_mini_blocks_ = 0;
+  int values_per_mini_block_ = 0;
+  int32_t total_value_count_ = 0;
+  int total_values_remaining_ = 0;
+  bool first_value_pending_ = false;
+
+  UT min_delta_ = 0;
+  int mini_block_idx_ = 0;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  int delta_bit_width_ = 0;
+  int values_current_mini_block_ = 0;
 
-  int32_t last_value_;
+  UT last_value_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2139,48 +2840,57 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // The values start after the lengths of all of them
+    len_decoder_.SetData(num_values, data, len);
+    const int num_lengths = len_decoder_.ValidValuesCount();
+    lengths_.resize(num_lengths);
+    if (len_decoder_.Decode(lengths_.data(), num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    const int lengths_size = len - len_decoder_.BytesLeft();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
+    length_idx_ = 0;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, static_cast<int>(lengths_.size()) - length_idx_);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
-      buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      const int32_t value_len = lengths_[length_idx_ + i];
+      if (ARROW_PREDICT_FALSE(value_len < 0 || value_len > len_)) {
+        ParquetException::EofException();
+      }
+      buffer[i] = ByteArray(static_cast<uint32_t>(value_len), data_);
+      data_ += value_len;
+      len_ -= value_len;
     }
-    this->num_values_ -= max_values;
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeArrowWithNulls(this, num_values, null_count, valid_bits,
+                                valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeArrowWithNulls(this, num_values, null_count, valid_bits,
+                                valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2194,46 +2904,134 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)),
+        values_(::arrow::stl::allocator<ByteArray>(pool)),
+        values_buffer_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  // Each value shares a prefix with the previous one, so the values of the
+  // whole page are reassembled here
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_prefixes = prefix_len_decoder_.ValidValuesCount();
+    prefix_lengths_.resize(num_prefixes);
+    if (prefix_len_decoder_.Decode(prefix_lengths_.data(), num_prefixes) !=
+        num_prefixes) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = len - prefix_len_decoder_.BytesLeft();
+    suffix_decoder_.SetData(num_values, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    values_.resize(num_prefixes);
+    if (suffix_decoder_.Decode(values_.data(), num_prefixes) != num_prefixes) {
+      ParquetException::EofException();
+    }
+    int64_t total_length = 0;
+    uint32_t previous_len = 0;
+    for (int i = 0; i < num_prefixes; ++i) {
+      const int32_t prefix_len = prefix_lengths_[i];
+      if (ARROW_PREDICT_FALSE(prefix_len < 0 ||
+                              static_cast<uint32_t>(prefix_len) > previous_len)) {
+        throw ParquetException("Invalid DELTA_BYTE_ARRAY prefix length");
+      }
+      previous_len = static_cast<uint32_t>(prefix_len) + values_[i].len;
+      total_length += previous_len;
+    }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    PARQUET_THROW_NOT_OK(values_buffer_->Resize(total_length, /*shrink_to_fit=*/false));
+    uint8_t* out = values_buffer_->mutable_data();
+    const uint8_t* previous = out;
+    for (int i = 0; i < num_prefixes; ++i) {
+      const uint32_t prefix_len = static_cast<uint32_t>(prefix_lengths_[i]);
+      const ByteArray suffix = values_[i];
+      memcpy(out, previous, prefix_len);
+      if (suffix.len > 0) {
+        memcpy(out + prefix_len, suffix.ptr, suffix.len);
+      }
+      values_[i] = ByteArray(prefix_len + suffix.len, out);
+      previous = out;
+      out += values_[i].len;
     }
-    this->num_values_ -= max_values;
+    value_idx_ = 0;
+  }
+
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, static_cast<int>(values_.size()) - value_idx_);
+    std::copy(values_.begin() + value_idx_, values_.begin() + value_idx_ + max_values,
+              buffer);
+    value_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeArrowWithNulls(this, num_values, null_count, valid_bits,
+                                valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeArrowWithNulls(this, num_values, null_count, valid_bits,
+                                valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  ArrowPoolVector<ByteArray> values_;
+  std::shared_ptr<ResizableBuffer> values_buffer_;
+  int value_idx_ = 0;
+};
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT decoder implementation
+
+template <typename DType>
+class ByteStreamSplitDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitDecoder(const ColumnDescriptor* descr)
+      : DecoderImpl(descr, Encoding::BYTE_STREAM_SPLIT) {}
+
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    DecoderImpl::SetData(num_values, data, len);
+    // The streams only hold the non-null values, which num_values includes
+    num_values_in_buffer_ = len / static_cast<int>(sizeof(T));
+    values_decoded_ = 0;
+  }
+
+  int Decode(T* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_in_buffer_ - values_decoded_);
+    ::arrow::util::internal::ByteStreamSplitDecode(data_ + values_decoded_, max_values,
+                                                   num_values_in_buffer_, buffer);
+    values_decoded_ += max_values;
+    num_values_ -= max_values;
+    return max_values;
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<DType>::Accumulator* builder) override {
+    return DecodeArrowWithNulls<DType>(this, num_values, null_count, valid_bits,
+                                       valid_bits_offset, builder);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<DType>::DictAccumulator* builder) override {
+    return DecodeArrowWithNulls<DType>(this, num_values, null_count, valid_bits,
+                                       valid_bits_offset, builder);
+  }
+
+ private:
+  int num_values_in_buffer_ = 0;
+  int values_decoded_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2261,6 +3059,34 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
       default:
         break;
     }
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<FloatType>(descr));
+      case Type::DOUBLE:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<DoubleType>(descr));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
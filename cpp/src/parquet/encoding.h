@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -278,6 +279,29 @@ class TypedDecoder : virtual public Decoder {
   /// at the end of the current data page.
   virtual int Decode(T* buffer, int max_values) = 0;
 
+  /// \brief Advance past values without materializing them
+  ///
+  /// The default decodes the values into scratch space, subclasses skip them
+  /// more cheaply where the encoding allows it.
+  ///
+  /// \param[in] num_values maximum number of values to skip
+  /// \return The number of values skipped. Should be identical to num_values
+  /// except at the end of the current data page.
+  virtual int Skip(int num_values) {
+    constexpr int kBatchSize = 256;
+    T scratch[kBatchSize];
+    int values_skipped = 0;
+    while (values_skipped < num_values) {
+      const int batch_size = std::min(kBatchSize, num_values - values_skipped);
+      const int values_decoded = Decode(scratch, batch_size);
+      values_skipped += values_decoded;
+      if (values_decoded < batch_size) {
+        break;
+      }
+    }
+    return values_skipped;
+  }
+
   /// \brief Decode the values in this data page but leave spaces for null entries.
   ///
   /// \param[in] buffer destination for decoded values
@@ -323,8 +347,9 @@ class TypedDecoder : virtual public Decoder {
   /// \return number of values decoded
   virtual int DecodeArrowNonNull(int num_values,
                                  typename EncodingTraits<DType>::Accumulator* out) {
-    const uint8_t valid_bits = 0;
-    return DecodeArrow(num_values, 0, &valid_bits, 0, out);
+    // Implementations read the bitmap even without nulls, so pass an all-set one
+    const std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_values), 0xFF);
+    return DecodeArrow(num_values, 0, valid_bits.data(), 0, out);
   }
 
   /// \brief Decode into a DictionaryBuilder
@@ -339,8 +364,9 @@ class TypedDecoder : virtual public Decoder {
   /// \return number of values decoded
   virtual int DecodeArrowNonNull(
       int num_values, typename EncodingTraits<DType>::DictAccumulator* builder) {
-    const uint8_t valid_bits = 0;
-    return DecodeArrow(num_values, 0, &valid_bits, 0, builder);
+    // Implementations read the bitmap even without nulls, so pass an all-set one
+    const std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_values), 0xFF);
+    return DecodeArrow(num_values, 0, valid_bits.data(), 0, builder);
   }
 };
 
@@ -349,6 +375,10 @@ class DictDecoder : virtual public TypedDecoder<DType> {
  public:
   virtual void SetDict(TypedDecoder<DType>* dictionary) = 0;
 
+  /// \brief Return the dictionary values as an Arrow array referencing the
+  /// decoder's memory, which is never modified after SetDict
+  virtual std::shared_ptr<::arrow::Array> GetDictionary() = 0;
+
   /// \brief Insert dictionary values into the Arrow dictionary builder's memo,
   /// but do not append any indices
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
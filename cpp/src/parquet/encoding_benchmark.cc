@@ -263,6 +263,55 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// Sorted values with small gaps, like timestamps or generated ids
+template <typename T>
+static std::vector<T> MakeSortedValues(int64_t length) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> step(0, 100);
+  std::vector<T> values(length);
+  T value = 1500000000;
+  for (auto& v : values) {
+    value += static_cast<T>(step(gen));
+    v = value;
+  }
+  return values;
+}
+
+template <typename Type>
+static void BM_DeltaBitPackEncoding(benchmark::State& state) {
+  using T = typename Type::c_type;
+  std::vector<T> values = MakeSortedValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_DeltaBitPackEncoding, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackEncoding, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+
+template <typename Type>
+static void BM_DeltaBitPackDecoding(benchmark::State& state) {
+  using T = typename Type::c_type;
+  std::vector<T> values = MakeSortedValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_DeltaBitPackDecoding, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackDecoding, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 
@@ -420,6 +469,51 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY
+template <Encoding::type kEncoding>
+class BenchmarkArrowBinaryDelta : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(kEncoding);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+using BM_ArrowBinaryDeltaLength =
+    BenchmarkArrowBinaryDelta<Encoding::DELTA_LENGTH_BYTE_ARRAY>;
+using BM_ArrowBinaryDelta = BenchmarkArrowBinaryDelta<Encoding::DELTA_BYTE_ARRAY>;
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, DecodeArrow_Dense)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
@@ -20,6 +20,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <random>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -248,6 +250,221 @@ TYPED_TEST(TestPlainEncoding, BasicRoundTrip) {
   ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
 }
 
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT encoding tests
+
+template <typename Type>
+class TestByteStreamSplitEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::BYTE_STREAM_SPLIT, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::BYTE_STREAM_SPLIT, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+    ASSERT_EQ(num_values_ * static_cast<int64_t>(sizeof(T)), encode_buffer_->size());
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    // The second batch starts in the middle of the streams
+    const int first_batch = num_values_ / 3;
+    ASSERT_EQ(first_batch, decoder->Decode(decode_buf_, first_batch));
+    ASSERT_EQ(num_values_ - first_batch,
+              decoder->Decode(decode_buf_ + first_batch, num_values_));
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+
+TYPED_TEST_CASE(TestByteStreamSplitEncoding, ByteStreamSplitTypes);
+
+TYPED_TEST(TestByteStreamSplitEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(37, 1));
+}
+
+TEST(ByteStreamSplitEncoding, UnsupportedTypes) {
+  auto descr = ExampleDescr<Int32Type>();
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT, false,
+                                           descr.get()),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT, descr.get()),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoding tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    const int first_put = num_values_ / 2;
+    encoder->Put(draws_, first_put);
+    encoder->Put(draws_ + first_put, num_values_ - first_put);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    // Batches don't line up with the miniblocks
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      const int batch_size = decoder->Decode(decode_buf_ + values_decoded, 45);
+      ASSERT_GT(batch_size, 0);
+      values_decoded += batch_size;
+    }
+    ASSERT_EQ(0, decoder->Decode(decode_buf_, 1));
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+  void ExecuteValues(const std::vector<T>& values) {
+    this->InitData(static_cast<int>(values.size()), 1);
+    std::copy(values.begin(), values.end(), draws_);
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(37, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(129, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1, 1));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, SortedValues) {
+  using T = typename TypeParam::c_type;
+  std::default_random_engine gen(0);
+  std::uniform_int_distribution<int> step(0, 1000);
+  std::vector<T> values(10000);
+  T value = std::numeric_limits<T>::min() / 2;
+  for (auto& v : values) {
+    value += static_cast<T>(step(gen));
+    v = value;
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+  // About 10 bits per value
+  ASSERT_LT(this->encode_buffer_->size(),
+            static_cast<int64_t>(values.size() * sizeof(T) / 2));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, WrappingDeltas) {
+  using T = typename TypeParam::c_type;
+  const T extremes[] = {std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), 0,
+                        -1};
+  std::vector<T> values;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(extremes[i % 4]);
+    values.push_back(extremes[(i * 7) % 4]);
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, NoValues) {
+  auto descr = ExampleDescr<TypeParam>();
+  auto encoder =
+      MakeTypedEncoder<TypeParam>(Encoding::DELTA_BINARY_PACKED, false, descr.get());
+  auto decoder = MakeTypedDecoder<TypeParam>(Encoding::DELTA_BINARY_PACKED, descr.get());
+  auto buffer = encoder->FlushValues();
+  // A page of nulls
+  decoder->SetData(10, buffer->data(), static_cast<int>(buffer->size()));
+  typename TypeParam::c_type value;
+  ASSERT_EQ(0, decoder->Decode(&value, 1));
+}
+
+TEST(DeltaBitPackEncoding, UnsupportedTypes) {
+  auto descr = ExampleDescr<FloatType>();
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED, false,
+                                           descr.get()),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FloatType>(Encoding::DELTA_BINARY_PACKED, descr.get()),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encoding tests
+
+class TestDeltaByteArrayEncoding : public TestEncodingBase<ByteArrayType>,
+                                   public ::testing::WithParamInterface<Encoding::type> {
+ public:
+  void CheckRoundtrip() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam(), descr_.get());
+    const int first_put = num_values_ / 2;
+    encoder->Put(draws_, first_put);
+    encoder->Put(draws_ + first_put, num_values_ - first_put);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    const int first_batch = num_values_ / 3;
+    ASSERT_EQ(first_batch, decoder->Decode(decode_buf_, first_batch));
+    ASSERT_EQ(num_values_ - first_batch,
+              decoder->Decode(decode_buf_ + first_batch, num_values_));
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<ByteArray>(decode_buf_, draws_, num_values_));
+  }
+};
+
+TEST_P(TestDeltaByteArrayEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(Execute(37, 4));
+  ASSERT_NO_FATAL_FAILURE(Execute(1, 1));
+}
+
+TEST_P(TestDeltaByteArrayEncoding, SharedPrefixes) {
+  const int num_values = 1000;
+  std::vector<std::string> strings;
+  int64_t total_length = 0;
+  for (int i = 0; i < num_values; ++i) {
+    strings.push_back("https://arrow.apache.org/docs/" + std::to_string(i * 3));
+    total_length += strings.back().size();
+  }
+  InitData(num_values, 1);
+  for (int i = 0; i < num_values; ++i) {
+    draws_[i] = ByteArray(strings[i]);
+  }
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip());
+  if (GetParam() == Encoding::DELTA_BYTE_ARRAY) {
+    // Only the last few digits of each value are stored
+    ASSERT_LT(encode_buffer_->size(), total_length / 4);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(DeltaByteArrayEncodings, TestDeltaByteArrayEncoding,
+                        ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                          Encoding::DELTA_BYTE_ARRAY));
+
+TEST(DeltaByteArrayEncoding, UnsupportedTypes) {
+  auto descr = ExampleDescr<Int32Type>();
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding, false, descr.get()),
+                 ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int32Type>(encoding, descr.get()), ParquetException);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Dictionary encoding tests
 
@@ -586,6 +803,67 @@ class EncodingAdHocTyped : public ::testing::Test {
     arrow::AssertArraysEqual(*values, *result);
   }
 
+  void ByteStreamSplit(int seed) {
+    if (!std::is_same<ParquetType, FloatType>::value &&
+        !std::is_same<ParquetType, DoubleType>::value) {
+      return;
+    }
+
+    auto values = GetValues(seed);
+    auto encoder = MakeTypedEncoder<ParquetType>(
+        Encoding::BYTE_STREAM_SPLIT, /*use_dictionary=*/false, column_descr());
+    auto decoder =
+        MakeTypedDecoder<ParquetType>(Encoding::BYTE_STREAM_SPLIT, column_descr());
+
+    ASSERT_NO_THROW(encoder->Put(*values));
+    auto buf = encoder->FlushValues();
+
+    // Like a data page, the number of values includes the nulls
+    int num_values = static_cast<int>(values->length() - values->null_count());
+    decoder->SetData(static_cast<int>(values->length()), buf->data(),
+                     static_cast<int>(buf->size()));
+
+    BuilderType acc(arrow_type(), arrow::default_memory_pool());
+    ASSERT_EQ(num_values,
+              decoder->DecodeArrow(static_cast<int>(values->length()),
+                                   static_cast<int>(values->null_count()),
+                                   values->null_bitmap_data(), values->offset(), &acc));
+
+    std::shared_ptr<::arrow::Array> result;
+    ASSERT_OK(acc.Finish(&result));
+    arrow::AssertArraysEqual(*values, *result);
+  }
+
+  void DeltaBitPack(int seed) {
+    if (!std::is_same<ParquetType, Int32Type>::value &&
+        !std::is_same<ParquetType, Int64Type>::value) {
+      return;
+    }
+
+    auto values = GetValues(seed);
+    auto encoder = MakeTypedEncoder<ParquetType>(
+        Encoding::DELTA_BINARY_PACKED, /*use_dictionary=*/false, column_descr());
+    auto decoder =
+        MakeTypedDecoder<ParquetType>(Encoding::DELTA_BINARY_PACKED, column_descr());
+
+    ASSERT_NO_THROW(encoder->Put(*values));
+    auto buf = encoder->FlushValues();
+
+    int num_values = static_cast<int>(values->length() - values->null_count());
+    decoder->SetData(static_cast<int>(values->length()), buf->data(),
+                     static_cast<int>(buf->size()));
+
+    BuilderType acc(arrow_type(), arrow::default_memory_pool());
+    ASSERT_EQ(num_values,
+              decoder->DecodeArrow(static_cast<int>(values->length()),
+                                   static_cast<int>(values->null_count()),
+                                   values->null_bitmap_data(), values->offset(), &acc));
+
+    std::shared_ptr<::arrow::Array> result;
+    ASSERT_OK(acc.Finish(&result));
+    arrow::AssertArraysEqual(*values, *result);
+  }
+
   void Dict(int seed) {
     if (std::is_same<ParquetType, BooleanType>::value) {
       return;
@@ -716,6 +994,45 @@ TYPED_TEST(EncodingAdHocTyped, PlainArrowDirectPut) {
   }
 }
 
+TYPED_TEST(EncodingAdHocTyped, ByteStreamSplitArrowDirectPut) {
+  for (auto seed : {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}) {
+    this->ByteStreamSplit(seed);
+  }
+}
+
+TYPED_TEST(EncodingAdHocTyped, DeltaBitPackArrowDirectPut) {
+  for (auto seed : {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}) {
+    this->DeltaBitPack(seed);
+  }
+}
+
+TEST(DeltaByteArrayEncodingAdHoc, ArrowBinaryDirectPut) {
+  arrow::random::RandomArrayGenerator rag(0);
+  auto values = rag.String(500, /*min_length=*/0, /*max_length=*/10,
+                           /*null_probability=*/0.1);
+  int num_values = static_cast<int>(values->length() - values->null_count());
+
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    ASSERT_NO_THROW(encoder->Put(*values));
+    auto buf = encoder->FlushValues();
+    decoder->SetData(static_cast<int>(values->length()), buf->data(),
+                     static_cast<int>(buf->size()));
+
+    typename EncodingTraits<ByteArrayType>::Accumulator acc;
+    acc.builder.reset(new arrow::StringBuilder);
+    ASSERT_EQ(num_values,
+              decoder->DecodeArrow(static_cast<int>(values->length()),
+                                   static_cast<int>(values->null_count()),
+                                   values->null_bitmap_data(), values->offset(), &acc));
+
+    std::shared_ptr<::arrow::Array> result;
+    ASSERT_OK(acc.builder->Finish(&result));
+    arrow::AssertArraysEqual(*values, *result);
+  }
+}
+
 TEST(DictEncodingAdHoc, ArrowBinaryDirectPut) {
   // Implemented as part of ARROW-3246
   const int64_t size = 50;
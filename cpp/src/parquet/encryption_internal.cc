@@ -21,6 +21,7 @@
 #include <openssl/rand.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -49,16 +50,24 @@ constexpr int kBufferSizeLength = 4;
     throw ParquetException("Couldn't init ALG decryption");           \
   }
 
+// Cipher contexts keep the expanded key between modules: a new key is only set
+// when it differs from the current one, otherwise only the nonce or IV is reset
+static bool IsCurrentKey(const std::string& current_key, const uint8_t* key,
+                         int key_len) {
+  return current_key.size() == static_cast<size_t>(key_len) &&
+         std::memcmp(current_key.data(), key, key_len) == 0;
+}
+
+static void WipeOutKey(std::string* key) {
+  std::fill(key->begin(), key->end(), '\0');
+  key->clear();
+}
+
 class AesEncryptor::AesEncryptorImpl {
  public:
   explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
 
-  ~AesEncryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  ~AesEncryptorImpl() { WipeOut(); }
 
   int Encrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* ciphertext);
@@ -71,6 +80,7 @@ class AesEncryptor::AesEncryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    WipeOutKey(&current_key_);
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
@@ -80,6 +90,20 @@ class AesEncryptor::AesEncryptorImpl {
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
+  // The key set in ctx_
+  std::string current_key_;
+
+  void SetKeyAndIv(const uint8_t* key, int key_len, const uint8_t* iv,
+                   const char* error_message) {
+    const bool new_key = !IsCurrentKey(current_key_, key, key_len);
+    if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, new_key ? key : nullptr, iv)) {
+      WipeOutKey(&current_key_);
+      throw ParquetException(error_message);
+    }
+    if (new_key) {
+      current_key_.assign(reinterpret_cast<const char*>(key), key_len);
+    }
+  }
 
   int GcmEncrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* key,
                  int key_len, const uint8_t* nonce, const uint8_t* aad, int aad_len,
@@ -187,9 +211,7 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   memset(tag, 0, kGcmTagLength);
 
   // Setting key and IV (nonce)
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and nonce");
-  }
+  SetKeyAndIv(key, key_len, nonce, "Couldn't set key and nonce");
 
   // Setting additional authenticated data
   if ((nullptr != aad) && (1 != EVP_EncryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
@@ -247,9 +269,7 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, key_len, iv, "Couldn't set key and IV");
 
   // Encryption
   if (1 != EVP_EncryptUpdate(ctx_, ciphertext + kBufferSizeLength + kNonceLength, &len,
@@ -306,12 +326,7 @@ class AesDecryptor::AesDecryptorImpl {
  public:
   explicit AesDecryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
 
-  ~AesDecryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  ~AesDecryptorImpl() { WipeOut(); }
 
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
@@ -321,6 +336,7 @@ class AesDecryptor::AesDecryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    WipeOutKey(&current_key_);
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
@@ -330,6 +346,20 @@ class AesDecryptor::AesDecryptorImpl {
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
+  // The key set in ctx_
+  std::string current_key_;
+
+  void SetKeyAndIv(const uint8_t* key, int key_len, const uint8_t* iv) {
+    const bool new_key = !IsCurrentKey(current_key_, key, key_len);
+    if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, new_key ? key : nullptr, iv)) {
+      WipeOutKey(&current_key_);
+      throw ParquetException("Couldn't set key and IV");
+    }
+    if (new_key) {
+      current_key_.assign(reinterpret_cast<const char*>(key), key_len);
+    }
+  }
+
   int GcmDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
                  int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
@@ -457,9 +487,7 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
             tag);
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, key_len, nonce);
 
   // Setting additional authenticated data
   if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
@@ -519,9 +547,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, key_len, iv);
 
   // Decryption
   if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
@@ -61,11 +61,13 @@ class TestPageSerde : public ::testing::Test {
   }
 
   void InitSerializedPageReader(int64_t num_rows,
-                                Compression::type codec = Compression::UNCOMPRESSED) {
+                                Compression::type codec = Compression::UNCOMPRESSED,
+                                bool prefetch = false) {
     EndStream();
 
     auto stream = std::make_shared<::arrow::io::BufferReader>(out_buffer_);
-    page_reader_ = PageReader::Open(stream, num_rows, codec);
+    page_reader_ = PageReader::Open(stream, num_rows, codec,
+                                    ::arrow::default_memory_pool(), NULLPTR, prefetch);
   }
 
   void WriteDataPageHeader(int max_serialized_len = 1024, int32_t uncompressed_size = 0,
@@ -289,6 +291,61 @@ TEST_F(TestPageSerde, Compression) {
   }
 }  // namespace parquet
 
+TEST_F(TestPageSerde, PrefetchPages) {
+  std::vector<Compression::type> codec_types = {Compression::UNCOMPRESSED};
+#ifdef ARROW_WITH_SNAPPY
+  codec_types.push_back(Compression::SNAPPY);
+#endif
+
+  const int32_t num_rows = 32;  // dummy value
+  data_page_header_.num_values = num_rows;
+  const int num_pages = 10;
+
+  std::vector<std::vector<uint8_t>> faux_data(num_pages);
+  for (int i = 0; i < num_pages; ++i) {
+    test::random_bytes((i + 1) * 64, i, &faux_data[i]);
+  }
+  for (auto codec_type : codec_types) {
+    auto codec = GetCodec(codec_type);
+    std::vector<uint8_t> buffer;
+    for (int i = 0; i < num_pages; ++i) {
+      const uint8_t* data = faux_data[i].data();
+      int data_size = static_cast<int>(faux_data[i].size());
+      int64_t actual_size = data_size;
+      if (codec == nullptr) {
+        buffer = faux_data[i];
+      } else {
+        int64_t max_compressed_size = codec->MaxCompressedLen(data_size, data);
+        buffer.resize(max_compressed_size);
+        ASSERT_OK_AND_ASSIGN(actual_size,
+                             codec->Compress(data_size, data, max_compressed_size,
+                                             buffer.data()));
+      }
+      ASSERT_NO_FATAL_FAILURE(
+          WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
+      ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
+    }
+
+    InitSerializedPageReader(num_rows * num_pages, codec_type, /*prefetch=*/true);
+
+    // Pages stay valid while the following ones are read
+    std::vector<std::shared_ptr<Page>> pages;
+    for (int i = 0; i < num_pages; ++i) {
+      pages.push_back(page_reader_->NextPage());
+      ASSERT_NE(nullptr, pages.back());
+    }
+    ASSERT_EQ(nullptr, page_reader_->NextPage());
+    for (int i = 0; i < num_pages; ++i) {
+      auto data_page = static_cast<const DataPageV1*>(pages[i].get());
+      int data_size = static_cast<int>(faux_data[i].size());
+      ASSERT_EQ(data_size, data_page->size());
+      ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+    }
+
+    ResetStream();
+  }
+}
+
 TEST_F(TestPageSerde, LZONotSupported) {
   // Must await PARQUET-530
   int data_size = 1024;
@@ -23,11 +23,17 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -36,6 +42,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -50,6 +57,37 @@ static constexpr uint32_t kFooterSize = 8;
 // For PARQUET-816
 static constexpr int64_t kMaxDictHeaderSize = 100;
 
+// Compute the byte range of a column chunk, including its dictionary page
+static ::arrow::io::ReadRange ComputeColumnChunkRange(
+    FileMetaData* file_metadata, ArrowInputFile* source, int row_group, int column,
+    InternalFileDecryptor* file_decryptor) {
+  auto row_group_metadata = file_metadata->RowGroup(row_group);
+  auto col = row_group_metadata->ColumnChunk(column, static_cast<int16_t>(row_group),
+                                             file_decryptor);
+
+  int64_t col_start = col->data_page_offset();
+  if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
+      col_start > col->dictionary_page_offset()) {
+    col_start = col->dictionary_page_offset();
+  }
+
+  int64_t col_length = col->total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    PARQUET_ASSIGN_OR_THROW(int64_t size, source->GetSize());
+    int64_t bytes_remaining = size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
 // ----------------------------------------------------------------------
 // RowGroupReader public API
 
@@ -75,19 +113,83 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetBloomFilter(i);
+}
+
+std::shared_ptr<ColumnReader> RowGroupReader::Column(int i,
+                                                     const std::vector<int>& data_pages) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  const ColumnDescriptor* descr = metadata()->schema()->Column(i);
+
+  std::unique_ptr<PageReader> page_reader = contents_->GetColumnPageReader(i, data_pages);
+  return ColumnReader::Make(
+      descr, std::move(page_reader),
+      const_cast<ReaderProperties*>(contents_->properties())->memory_pool());
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<int>& data_pages) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnPageReader(i, data_pages);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetBloomFilter(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetColumnPageReader(
+    int i, const std::vector<int>& data_pages) {
+  throw ParquetException("Reading selected data pages is not supported");
+}
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
-  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source, FileMetaData* file_metadata,
-                     int row_group_number, const ReaderProperties& props,
+  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source,
+                     std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
+                     FileMetaData* file_metadata, int row_group_number,
+                     const ReaderProperties& props,
+                     std::vector<bool> prebuffered_column_chunks,
                      InternalFileDecryptor* file_decryptor = nullptr)
       : source_(std::move(source)),
+        cached_source_(std::move(cached_source)),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
+        prebuffered_column_chunks_(std::move(prebuffered_column_chunks)),
         file_decryptor_(file_decryptor) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
@@ -100,35 +202,31 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      PARQUET_ASSIGN_OR_THROW(int64_t size, source_->GetSize());
-      int64_t bytes_remaining = size - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    ::arrow::io::ReadRange col_range = ComputeColumnChunkRange(
+        file_metadata_, source_.get(), row_group_ordinal_, i, file_decryptor_);
+    std::shared_ptr<ArrowInputStream> stream;
+    if (cached_source_ && prebuffered_column_chunks_[i]) {
+      // If read coalescing is enabled, read from the pre-buffered
+      // segments.
+      PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
+      stream = std::make_shared<::arrow::io::BufferReader>(buffer);
+    } else {
+      // Let the source load the chunk in the background (e.g. a memory map, which
+      // would otherwise fault pages in one at a time while decoding)
+      PARQUET_THROW_NOT_OK(source_->WillNeed({col_range}));
+      stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-
+    auto compression_dictionary =
+        properties_.compression_dictionary(col->path_in_schema()->ToDotString());
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
       return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool());
+                              properties_.memory_pool(), /*ctx=*/nullptr,
+                              properties_.is_page_prefetch_enabled(),
+                              std::move(compression_dictionary));
     }
 
     // The column is encrypted
@@ -136,12 +234,15 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     std::shared_ptr<Decryptor> data_decryptor;
     // The column is encrypted with footer key
     if (crypto_metadata->encrypted_with_footer_key()) {
-      meta_decryptor = file_decryptor_->GetFooterDecryptorForColumnMeta();
-      data_decryptor = file_decryptor_->GetFooterDecryptorForColumnData();
+      const std::string column_path = col->path_in_schema()->ToDotString();
+      meta_decryptor = file_decryptor_->GetFooterDecryptorForColumnMeta(column_path);
+      data_decryptor = file_decryptor_->GetFooterDecryptorForColumnData(column_path);
       CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                         static_cast<int16_t>(i), meta_decryptor, data_decryptor);
       return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool(), &ctx);
+                              properties_.memory_pool(), &ctx,
+                              properties_.is_page_prefetch_enabled(),
+                              std::move(compression_dictionary));
     }
 
     // The column is encrypted with its own key
@@ -156,15 +257,150 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                       static_cast<int16_t>(i), meta_decryptor, data_decryptor);
     return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool(), &ctx);
+                            properties_.memory_pool(), &ctx,
+                            properties_.is_page_prefetch_enabled(),
+                            std::move(compression_dictionary));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndexData(col->column_index_offset(), col->column_index_length());
+    uint32_t len = static_cast<uint32_t>(buffer->size());
+    return ColumnIndex::Make(row_group_metadata_->schema()->Column(i), buffer->data(),
+                             &len);
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndexData(col->offset_index_offset(), col->offset_index_length());
+    uint32_t len = static_cast<uint32_t>(buffer->size());
+    return OffsetIndex::Make(buffer->data(), &len);
+  }
+
+  std::unique_ptr<BloomFilter> GetBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    const int64_t offset = col->bloom_filter_offset();
+    // The serialized filter starts with its bitset length, hash strategy and
+    // algorithm, each a 4-byte integer
+    constexpr int32_t kHeaderLength = 3 * sizeof(uint32_t);
+    std::shared_ptr<Buffer> header = ReadIndexData(offset, kHeaderLength);
+    const uint32_t num_bytes = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (num_bytes > BloomFilter::kMaximumBloomFilterBytes) {
+      throw ParquetInvalidOrCorruptedFileException(
+          "Bloom filter at offset ", offset, " is too large: ", num_bytes, " bytes");
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndexData(offset, kHeaderLength + static_cast<int32_t>(num_bytes));
+    ::arrow::io::BufferReader stream(std::move(buffer));
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<int>& data_pages) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (col->crypto_metadata()) {
+      throw ParquetException(
+          "Reading selected data pages of an encrypted column is not supported");
+    }
+    std::unique_ptr<OffsetIndex> offset_index = GetOffsetIndex(i);
+    if (offset_index == nullptr) {
+      std::stringstream ss;
+      ss << "Column chunk " << i << " of row group " << row_group_ordinal_
+         << " has no OffsetIndex";
+      throw ParquetException(ss.str());
+    }
+    const std::vector<PageLocation>& locations = offset_index->page_locations();
+
+    // Coalesce the byte ranges of adjacent pages
+    std::vector<::arrow::io::ReadRange> ranges;
+    auto add_range = [&ranges](int64_t offset, int64_t length) {
+      if (!ranges.empty() && ranges.back().offset + ranges.back().length == offset) {
+        ranges.back().length += length;
+      } else {
+        ranges.push_back({offset, length});
+      }
+    };
+    // The dictionary page, if any, precedes the first data page
+    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
+        !locations.empty() && col->dictionary_page_offset() < locations[0].offset) {
+      add_range(col->dictionary_page_offset(),
+                locations[0].offset - col->dictionary_page_offset());
+    }
+    int previous_page = -1;
+    for (int page : data_pages) {
+      if (page <= previous_page || page >= offset_index->num_pages()) {
+        std::stringstream ss;
+        ss << "Data page ordinals must be increasing and less than "
+           << offset_index->num_pages();
+        throw ParquetException(ss.str());
+      }
+      previous_page = page;
+      add_range(locations[page].offset, locations[page].compressed_page_size);
+    }
+
+    // Have all the ranges loaded in the background before reading them in turn
+    PARQUET_THROW_NOT_OK(source_->WillNeed(ranges));
+
+    int64_t total_length = 0;
+    for (const auto& range : ranges) {
+      total_length += range.length;
+    }
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(properties_.memory_pool(), total_length);
+    uint8_t* out = buffer->mutable_data();
+    for (const auto& range : ranges) {
+      PARQUET_ASSIGN_OR_THROW(int64_t bytes_read,
+                              source_->ReadAt(range.offset, range.length, out));
+      if (bytes_read != range.length) {
+        throw ParquetInvalidOrCorruptedFileException(
+            "Tried reading ", range.length, " bytes at offset ", range.offset,
+            " but only got ", bytes_read);
+      }
+      out += range.length;
+    }
+
+    auto stream = std::make_shared<::arrow::io::BufferReader>(std::move(buffer));
+    // The stream ends after the last selected page, so the value count is only an
+    // upper bound
+    return PageReader::Open(
+        std::move(stream), col->num_values(), col->compression(),
+        properties_.memory_pool(), /*ctx=*/nullptr, /*prefetch=*/false,
+        properties_.compression_dictionary(col->path_in_schema()->ToDotString()));
   }
 
  private:
+  // Read an index structure (page index or bloom filter) stored outside of the
+  // column chunk
+  std::shared_ptr<Buffer> ReadIndexData(int64_t offset, int32_t length) {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      throw ParquetInvalidOrCorruptedFileException(
+          "Tried reading ", length, " bytes of index data at offset ", offset,
+          " but only got ", buffer->size());
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
+  // Will be nullptr if PreBuffer() is not called.
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
   int16_t row_group_ordinal_;
+  std::vector<bool> prebuffered_column_chunks_;
   InternalFileDecryptor* file_decryptor_;
 };
 
@@ -192,12 +428,38 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, file_metadata_.get(), static_cast<int16_t>(i),
-                               properties_, file_decryptor_.get()));
+    std::vector<bool> prebuffered_column_chunks;
+    auto it = prebuffered_column_chunks_.find(i);
+    if (it != prebuffered_column_chunks_.end()) {
+      prebuffered_column_chunks = it->second;
+    }
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, cached_source_, file_metadata_.get(), static_cast<int16_t>(i),
+        properties_, std::move(prebuffered_column_chunks), file_decryptor_.get()));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options) {
+    cached_source_ =
+        std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, options);
+    prebuffered_column_chunks_.clear();
+    const int num_columns = file_metadata_->num_columns();
+
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row : row_groups) {
+      std::vector<bool>& prebuffered = prebuffered_column_chunks_[row];
+      prebuffered.assign(num_columns, false);
+      for (int col : column_indices) {
+        prebuffered[col] = true;
+        ranges.push_back(ComputeColumnChunkRange(file_metadata_.get(), source_.get(),
+                                                 row, col, file_decryptor_.get()));
+      }
+    }
+    PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(std::shared_ptr<FileMetaData> metadata) {
@@ -258,6 +520,9 @@ class SerializedFile : public ParquetFileReader::Contents {
 
  private:
   std::shared_ptr<ArrowInputFile> source_;
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  // Row group ordinal -> columns that were pre-buffered
+  std::unordered_map<int, std::vector<bool>> prebuffered_column_chunks_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
 
@@ -522,6 +787,15 @@ std::shared_ptr<FileMetaData> ParquetFileReader::metadata() const {
   return contents_->metadata();
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  const ::arrow::io::CacheOptions& options) {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  file->PreBuffer(row_groups, column_indices, options);
+}
+
 std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   DCHECK(i < metadata()->num_row_groups())
       << "The file only has " << metadata()->num_row_groups()
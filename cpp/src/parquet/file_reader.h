@@ -29,8 +29,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -45,6 +48,13 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    // The page index is optional, by default it is not available
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const std::vector<int>& data_pages);
+    // Bloom filters are optional, by default they are not available
+    virtual std::unique_ptr<BloomFilter> GetBloomFilter(int i);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +68,24 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Return the ColumnIndex of a column chunk, or nullptr if it wasn't written
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  // Return the OffsetIndex of a column chunk, or nullptr if it wasn't written
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  // Construct a ColumnReader yielding only the given data pages of a column
+  // chunk, e.g. those selected with FindPagesContaining(). The page ordinals
+  // refer to the chunk's OffsetIndex and must be increasing. Only the bytes of
+  // those pages (and of the dictionary page, if any) are read from the file.
+  std::shared_ptr<ColumnReader> Column(int i, const std::vector<int>& data_pages);
+
+  std::unique_ptr<PageReader> GetColumnPageReader(int i,
+                                                  const std::vector<int>& data_pages);
+
+  // Return the bloom filter of a column chunk, or nullptr if it wasn't written
+  std::unique_ptr<BloomFilter> GetBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -118,6 +146,28 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// Pre-buffer the specified column indices in all row groups.
+  ///
+  /// Readers can optionally call this to cache the necessary slices
+  /// of the file in-memory before deserialization. Arrow readers can
+  /// automatically do this via an option. This is intended to
+  /// increase performance when reading from high-latency filesystems
+  /// (e.g. Amazon S3).
+  ///
+  /// After calling this, creating readers for row groups/column
+  /// indices that were not buffered may fail. Creating multiple
+  /// readers for a subset of the buffered regions is
+  /// acceptable. This may be called again to buffer a different set
+  /// of row groups/columns.
+  ///
+  /// If memory usage is a concern, note that data will remain
+  /// buffered in memory until either \a PreBuffer() is called again,
+  /// or the reader itself is destructed. Reading - and buffering -
+  /// only one row group at a time may be useful.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
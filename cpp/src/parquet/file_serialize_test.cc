@@ -15,12 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <numeric>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
@@ -343,6 +349,216 @@ TEST(TestBufferedRowGroupWriter, DisabledDictionary) {
   ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(0)->has_dictionary_page());
 }
 
+// Write num_rows sorted INT64 values, with roughly 10 values per data page
+std::shared_ptr<Buffer> WriteSortedInt64File(int64_t num_rows, bool buffered_row_group,
+                                             bool write_page_index) {
+  auto sink = CreateOutputStream();
+  WriterProperties::Builder builder;
+  builder.disable_dictionary()->write_batch_size(10)->data_pagesize(10 * sizeof(int64_t));
+  if (write_page_index) {
+    builder.enable_write_page_index();
+  }
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("col", Repetition::REQUIRED, Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = ParquetFileWriter::Open(sink, schema, builder.build());
+  auto rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                      : file_writer->AppendRowGroup();
+  auto col_writer = static_cast<Int64Writer*>(buffered_row_group ? rg_writer->column(0)
+                                                                 : rg_writer->NextColumn());
+  std::vector<int64_t> values(num_rows);
+  std::iota(values.begin(), values.end(), 0);
+  col_writer->WriteBatch(num_rows, nullptr, nullptr, values.data());
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+void CheckPageIndexRoundTrip(bool buffered_row_group) {
+  const int64_t num_rows = 1000;
+  auto buffer = WriteSortedInt64File(num_rows, buffered_row_group, true);
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto rg_reader = file_reader->RowGroup(0);
+  auto col_metadata = rg_reader->metadata()->ColumnChunk(0);
+  ASSERT_TRUE(col_metadata->has_column_index());
+  ASSERT_TRUE(col_metadata->has_offset_index());
+
+  auto offset_index = rg_reader->GetOffsetIndex(0);
+  auto column_index = rg_reader->GetColumnIndex(0);
+  ASSERT_NE(nullptr, offset_index);
+  ASSERT_NE(nullptr, column_index);
+  ASSERT_EQ(num_rows / 10, offset_index->num_pages());
+  ASSERT_EQ(offset_index->num_pages(), column_index->num_pages());
+  ASSERT_TRUE(column_index->has_null_counts());
+
+  const auto& locations = offset_index->page_locations();
+  ASSERT_EQ(col_metadata->data_page_offset(), locations[0].offset);
+  for (int i = 0; i < offset_index->num_pages(); ++i) {
+    ASSERT_EQ(i * 10, locations[i].first_row_index);
+    ASSERT_FALSE(column_index->null_pages()[i]);
+    ASSERT_EQ(0, column_index->null_counts()[i]);
+    auto stats = std::static_pointer_cast<Int64Statistics>(column_index->page_statistics(i));
+    ASSERT_EQ(i * 10, stats->min());
+    ASSERT_EQ(i * 10 + 9, stats->max());
+    if (i > 0) {
+      ASSERT_EQ(locations[i - 1].offset + locations[i - 1].compressed_page_size,
+                locations[i].offset);
+    }
+  }
+  ASSERT_EQ(42, offset_index->FindPage(425, num_rows));
+  ASSERT_EQ(-1, offset_index->FindPage(num_rows, num_rows));
+
+  // Point lookup: only read the page containing the value
+  std::vector<int> pages = FindPagesContaining<Int64Type>(*column_index, 425);
+  ASSERT_EQ(std::vector<int>({42}), pages);
+  auto col_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(0, pages));
+  std::vector<int64_t> values(20);
+  int64_t values_read = 0;
+  int64_t levels_read =
+      col_reader->ReadBatch(20, nullptr, nullptr, values.data(), &values_read);
+  ASSERT_EQ(10, levels_read);
+  ASSERT_EQ(10, values_read);
+  for (int64_t i = 0; i < values_read; ++i) {
+    ASSERT_EQ(420 + i, values[i]);
+  }
+  ASSERT_FALSE(col_reader->HasNext());
+
+  ASSERT_TRUE(FindPagesContaining<Int64Type>(*column_index, num_rows).empty());
+  ASSERT_THROW(rg_reader->Column(0, {3, 2}), ParquetException);
+}
+
+TEST(TestPageIndex, RoundTrip) { CheckPageIndexRoundTrip(false); }
+
+TEST(TestPageIndex, RoundTripBufferedRowGroup) { CheckPageIndexRoundTrip(true); }
+
+TEST(TestPageIndex, DisabledByDefault) {
+  auto buffer = WriteSortedInt64File(100, false, false);
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto rg_reader = file_reader->RowGroup(0);
+  ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(0)->has_column_index());
+  ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(0)->has_offset_index());
+  ASSERT_EQ(nullptr, rg_reader->GetColumnIndex(0));
+  ASSERT_EQ(nullptr, rg_reader->GetOffsetIndex(0));
+  ASSERT_THROW(rg_reader->Column(0, {0}), ParquetException);
+}
+
+// Write an INT64 column holding the even numbers below 2 * num_rows, and an
+// optional BYTE_ARRAY column holding their decimal representation or nulls
+std::shared_ptr<Buffer> WriteBloomFilterFile(int64_t num_rows, bool buffered_row_group,
+                                             bool write_bloom_filter) {
+  auto sink = CreateOutputStream();
+  WriterProperties::Builder builder;
+  builder.write_batch_size(10)->data_pagesize(10 * sizeof(int64_t));
+  if (write_bloom_filter) {
+    builder.enable_bloom_filter();
+  }
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("i", Repetition::REQUIRED, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("s", Repetition::OPTIONAL, Type::BYTE_ARRAY,
+                                       ConvertedType::UTF8));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = ParquetFileWriter::Open(sink, schema, builder.build());
+  auto rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                      : file_writer->AppendRowGroup();
+
+  std::vector<int64_t> values;
+  std::vector<std::string> strings;
+  std::vector<ByteArray> byte_arrays;
+  std::vector<int16_t> def_levels;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    values.push_back(2 * i);
+    def_levels.push_back(i % 3 == 0 ? 0 : 1);
+    if (def_levels.back() == 1) {
+      strings.push_back(std::to_string(2 * i));
+    }
+  }
+  for (const auto& str : strings) {
+    byte_arrays.push_back(ByteArray(str));
+  }
+
+  auto int_writer = static_cast<Int64Writer*>(buffered_row_group ? rg_writer->column(0)
+                                                                 : rg_writer->NextColumn());
+  int_writer->WriteBatch(num_rows, nullptr, nullptr, values.data());
+  auto string_writer = static_cast<ByteArrayWriter*>(
+      buffered_row_group ? rg_writer->column(1) : rg_writer->NextColumn());
+  string_writer->WriteBatch(num_rows, def_levels.data(), nullptr, byte_arrays.data());
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+void CheckBloomFilterRoundTrip(bool buffered_row_group) {
+  const int64_t num_rows = 300;
+  auto buffer = WriteBloomFilterFile(num_rows, buffered_row_group, true);
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto rg_reader = file_reader->RowGroup(0);
+
+  for (int col = 0; col < 2; ++col) {
+    auto col_metadata = rg_reader->metadata()->ColumnChunk(col);
+    ASSERT_TRUE(col_metadata->has_bloom_filter());
+    ASSERT_GT(col_metadata->bloom_filter_offset(), col_metadata->data_page_offset());
+  }
+
+  auto int_filter = rg_reader->GetBloomFilter(0);
+  auto string_filter = rg_reader->GetBloomFilter(1);
+  ASSERT_NE(nullptr, int_filter);
+  ASSERT_NE(nullptr, string_filter);
+
+  int int_false_positives = 0;
+  int string_false_positives = 0;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ASSERT_TRUE(int_filter->FindHash(int_filter->Hash(2 * i)));
+    if (int_filter->FindHash(int_filter->Hash(2 * i + 1))) {
+      ++int_false_positives;
+    }
+
+    std::string even = std::to_string(2 * i);
+    ByteArray even_value(even);
+    if (i % 3 != 0) {
+      ASSERT_TRUE(string_filter->FindHash(string_filter->Hash(&even_value)));
+    }
+    std::string odd = std::to_string(2 * i + 1);
+    ByteArray odd_value(odd);
+    if (string_filter->FindHash(string_filter->Hash(&odd_value))) {
+      ++string_false_positives;
+    }
+  }
+  // The filters are sized for the default 5% false positive probability
+  ASSERT_LT(int_false_positives, num_rows / 10);
+  ASSERT_LT(string_false_positives, num_rows / 10);
+
+  // The bloom filter doesn't interfere with reading the column chunk
+  auto col_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(0));
+  std::vector<int64_t> values(num_rows);
+  int64_t values_read = 0;
+  col_reader->ReadBatch(num_rows, nullptr, nullptr, values.data(), &values_read);
+  ASSERT_EQ(num_rows, values_read);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ASSERT_EQ(2 * i, values[i]);
+  }
+  ASSERT_FALSE(col_reader->HasNext());
+}
+
+TEST(TestBloomFilter, RoundTrip) { CheckBloomFilterRoundTrip(false); }
+
+TEST(TestBloomFilter, RoundTripBufferedRowGroup) { CheckBloomFilterRoundTrip(true); }
+
+TEST(TestBloomFilter, DisabledByDefault) {
+  auto buffer = WriteBloomFilterFile(100, false, false);
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto rg_reader = file_reader->RowGroup(0);
+  ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+  ASSERT_EQ(nullptr, rg_reader->GetBloomFilter(0));
+}
+
 }  // namespace test
 
 }  // namespace parquet
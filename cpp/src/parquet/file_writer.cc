@@ -28,6 +28,7 @@
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -62,6 +63,10 @@ int64_t RowGroupWriter::total_bytes_written() const {
   return contents_->total_bytes_written();
 }
 
+int64_t RowGroupWriter::total_buffered_bytes() const {
+  return contents_->total_buffered_bytes();
+}
+
 int RowGroupWriter::current_column() { return contents_->current_column(); }
 
 int RowGroupWriter::num_columns() const { return contents_->num_columns(); }
@@ -83,7 +88,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +99,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builder_(page_index_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -138,7 +145,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        GetColumnChunkPageIndexBuilder(next_column_index_ - 1),
+        properties_->compression_dictionary(path));
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
     return column_writers_[0].get();
   }
@@ -177,6 +186,20 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_bytes_written;
   }
 
+  int64_t total_buffered_bytes() const override {
+    int64_t total_buffered_bytes = 0;
+    for (size_t i = 0; i < column_writers_.size(); i++) {
+      if (column_writers_[i]) {
+        total_buffered_bytes += column_writers_[i]->estimated_buffered_bytes();
+        // The pages of a buffered row group are serialized to memory
+        if (buffered_row_group_) {
+          total_buffered_bytes += column_writers_[i]->total_bytes_written();
+        }
+      }
+    }
+    return total_buffered_bytes;
+  }
+
   void Close() override {
     if (!closed_) {
       closed_ = true;
@@ -208,6 +231,12 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilder* page_index_builder_;
+
+  ColumnChunkPageIndexBuilder* GetColumnChunkPageIndexBuilder(int column) {
+    return page_index_builder_ ? page_index_builder_->GetColumnChunkBuilder(column)
+                               : nullptr;
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -244,8 +273,11 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
-          static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          static_cast<int16_t>(next_column_index_), properties_->memory_pool(),
+          buffered_row_group_, meta_encryptor, data_encryptor,
+          GetColumnChunkPageIndexBuilder(next_column_index_),
+          properties_->compression_dictionary(path));
+      ++next_column_index_;
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
     }
@@ -288,6 +320,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
       auto file_encryption_properties = properties_->file_encryption_properties();
 
       if (file_encryption_properties == nullptr) {  // Non encrypted file.
+        if (page_index_builder_) {
+          page_index_builder_->WriteTo(sink_.get(), metadata_.get());
+        }
         file_metadata_ = metadata_->Finish();
         WriteFileMetaData(*file_metadata_, sink_.get());
       } else {  // Encrypted file
@@ -312,9 +347,12 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      page_index_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builder_.get()));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -342,6 +380,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
         num_row_groups_(0),
         num_rows_(0),
         metadata_(FileMetaDataBuilder::Make(&schema_, properties_, key_value_metadata_)) {
+    if (properties_->page_index_enabled()) {
+      page_index_builder_ = PageIndexBuilder::Make(&schema_);
+    }
     StartFile();
   }
 
@@ -385,6 +426,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
+  // nullptr if no page index is written
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
+
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
     if (file_encryption_properties == nullptr) {
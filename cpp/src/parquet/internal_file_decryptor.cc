@@ -60,6 +60,7 @@ InternalFileDecryptor::InternalFileDecryptor(FileDecryptionProperties* propertie
 
 void InternalFileDecryptor::WipeOutDecryptionKeys() {
   properties_->WipeOutDecryptionKeys();
+  footer_key_.replace(0, footer_key_.size(), footer_key_.size(), '\0');
   for (auto const& i : all_decryptors_) {
     i->WipeOut();
   }
@@ -90,27 +91,8 @@ std::string InternalFileDecryptor::GetFooterKey() {
 }
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor() {
-  std::string aad = encryption::CreateFooterAad(file_aad_);
-  return GetFooterDecryptor(aad, true);
-}
-
-std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnMeta(
-    const std::string& aad) {
-  return GetFooterDecryptor(aad, true);
-}
-
-std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnData(
-    const std::string& aad) {
-  return GetFooterDecryptor(aad, false);
-}
-
-std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor(
-    const std::string& aad, bool metadata) {
-  if (metadata) {
-    if (footer_metadata_decryptor_ != nullptr) return footer_metadata_decryptor_;
-  } else {
-    if (footer_data_decryptor_ != nullptr) return footer_data_decryptor_;
-  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (footer_metadata_decryptor_ != nullptr) return footer_metadata_decryptor_;
 
   std::string footer_key = properties_->footer_key();
   if (footer_key.empty()) {
@@ -131,19 +113,25 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor(
         "Invalid footer encryption key. "
         "Could not parse footer metadata");
   }
-
-  // Create both data and metadata decryptors to avoid redundant retrieval of key
+  // Keep the key for the columns encrypted with it, to avoid redundant retrieval
   // from the key_retriever.
-  auto aes_metadata_decryptor = GetMetaAesDecryptor(footer_key.size());
-  auto aes_data_decryptor = GetDataAesDecryptor(footer_key.size());
+  footer_key_ = footer_key;
 
+  std::string aad = encryption::CreateFooterAad(file_aad_);
+  auto aes_metadata_decryptor = GetMetaAesDecryptor(footer_key.size());
   footer_metadata_decryptor_ = std::make_shared<Decryptor>(
       aes_metadata_decryptor, footer_key, file_aad_, aad, pool_);
-  footer_data_decryptor_ =
-      std::make_shared<Decryptor>(aes_data_decryptor, footer_key, file_aad_, aad, pool_);
+  return footer_metadata_decryptor_;
+}
+
+std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnMeta(
+    const std::string& column_path, const std::string& aad) {
+  return GetColumnDecryptor(column_path, "", aad, true, true);
+}
 
-  if (metadata) return footer_metadata_decryptor_;
-  return footer_data_decryptor_;
+std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnData(
+    const std::string& column_path, const std::string& aad) {
+  return GetColumnDecryptor(column_path, "", aad, false, true);
 }
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnMetaDecryptor(
@@ -160,8 +148,8 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDataDecryptor(
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
     const std::string& column_path, const std::string& column_key_metadata,
-    const std::string& aad, bool metadata) {
-  std::string column_key;
+    const std::string& aad, bool metadata, bool footer_key) {
+  std::lock_guard<std::mutex> lock(mutex_);
   // first look if we already got the decryptor from before
   if (metadata) {
     if (column_metadata_map_.find(column_path) != column_metadata_map_.end()) {
@@ -177,7 +165,36 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
     }
   }
 
-  column_key = properties_->column_key(column_path);
+  std::string column_key;
+  if (footer_key) {
+    if (footer_key_.empty()) footer_key_ = GetFooterKey();
+    column_key = footer_key_;
+  } else {
+    column_key = GetColumnKey(column_path, column_key_metadata);
+  }
+
+  // Create both data and metadata decryptors to avoid redundant retrieval of key
+  // using the key_retriever.
+  int key_len = static_cast<int>(column_key.size());
+  column_decryptors_.emplace_back(
+      encryption::AesDecryptor::Make(algorithm_, key_len, true, &all_decryptors_));
+  auto aes_metadata_decryptor = column_decryptors_.back().get();
+  column_decryptors_.emplace_back(
+      encryption::AesDecryptor::Make(algorithm_, key_len, false, &all_decryptors_));
+  auto aes_data_decryptor = column_decryptors_.back().get();
+
+  column_metadata_map_[column_path] = std::make_shared<Decryptor>(
+      aes_metadata_decryptor, column_key, file_aad_, aad, pool_);
+  column_data_map_[column_path] =
+      std::make_shared<Decryptor>(aes_data_decryptor, column_key, file_aad_, aad, pool_);
+
+  if (metadata) return column_metadata_map_[column_path];
+  return column_data_map_[column_path];
+}
+
+std::string InternalFileDecryptor::GetColumnKey(const std::string& column_path,
+                                                const std::string& column_key_metadata) {
+  std::string column_key = properties_->column_key(column_path);
   // No explicit column key given via API. Retrieve via key metadata.
   if (column_key.empty() && !column_key_metadata.empty() &&
       properties_->key_retriever() != nullptr) {
@@ -192,19 +209,7 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
   if (column_key.empty()) {
     throw HiddenColumnException("HiddenColumnException, path=" + column_path);
   }
-
-  // Create both data and metadata decryptors to avoid redundant retrieval of key
-  // using the key_retriever.
-  auto aes_metadata_decryptor = GetMetaAesDecryptor(column_key.size());
-  auto aes_data_decryptor = GetDataAesDecryptor(column_key.size());
-
-  column_metadata_map_[column_path] = std::make_shared<Decryptor>(
-      aes_metadata_decryptor, column_key, file_aad_, aad, pool_);
-  column_data_map_[column_path] =
-      std::make_shared<Decryptor>(aes_data_decryptor, column_key, file_aad_, aad, pool_);
-
-  if (metadata) return column_metadata_map_[column_path];
-  return column_data_map_[column_path];
+  return column_key;
 }
 
 int InternalFileDecryptor::MapKeyLenToDecryptorArrayIndex(int key_len) {
@@ -227,14 +232,4 @@ encryption::AesDecryptor* InternalFileDecryptor::GetMetaAesDecryptor(size_t key_
   return meta_decryptor_[index].get();
 }
 
-encryption::AesDecryptor* InternalFileDecryptor::GetDataAesDecryptor(size_t key_size) {
-  int key_len = static_cast<int>(key_size);
-  int index = MapKeyLenToDecryptorArrayIndex(key_len);
-  if (data_decryptor_[index] == nullptr) {
-    data_decryptor_[index].reset(
-        encryption::AesDecryptor::Make(algorithm_, key_len, false, &all_decryptors_));
-  }
-  return data_decryptor_[index].get();
-}
-
 }  // namespace parquet
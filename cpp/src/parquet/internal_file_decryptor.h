@@ -20,6 +20,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -78,8 +79,10 @@ class InternalFileDecryptor {
   ::arrow::MemoryPool* pool() { return pool_; }
 
   std::shared_ptr<Decryptor> GetFooterDecryptor();
-  std::shared_ptr<Decryptor> GetFooterDecryptorForColumnMeta(const std::string& aad = "");
-  std::shared_ptr<Decryptor> GetFooterDecryptorForColumnData(const std::string& aad = "");
+  std::shared_ptr<Decryptor> GetFooterDecryptorForColumnMeta(
+      const std::string& column_path, const std::string& aad = "");
+  std::shared_ptr<Decryptor> GetFooterDecryptorForColumnData(
+      const std::string& column_path, const std::string& aad = "");
   std::shared_ptr<Decryptor> GetColumnMetaDecryptor(
       const std::string& column_path, const std::string& column_key_metadata,
       const std::string& aad = "");
@@ -95,26 +98,34 @@ class InternalFileDecryptor {
   std::map<std::string, std::shared_ptr<Decryptor>> column_metadata_map_;
 
   std::shared_ptr<Decryptor> footer_metadata_decryptor_;
-  std::shared_ptr<Decryptor> footer_data_decryptor_;
+  // The footer key, once retrieved for the footer or a column
+  std::string footer_key_;
   ParquetCipher::type algorithm_;
   std::string footer_key_metadata_;
   std::vector<encryption::AesDecryptor*> all_decryptors_;
 
   /// Key must be 16, 24 or 32 bytes in length. Thus there could be up to three
-  // types of meta_decryptors and data_decryptors.
+  // types of footer meta_decryptors.
   std::unique_ptr<encryption::AesDecryptor> meta_decryptor_[3];
-  std::unique_ptr<encryption::AesDecryptor> data_decryptor_[3];
+
+  // Each column gets cipher contexts of its own, so that columns can be
+  // decrypted concurrently and each context keeps the expanded column key
+  std::vector<std::unique_ptr<encryption::AesDecryptor>> column_decryptors_;
+
+  // Guards the decryptor maps, as columns may be read from several threads
+  std::mutex mutex_;
 
   ::arrow::MemoryPool* pool_;
 
-  std::shared_ptr<Decryptor> GetFooterDecryptor(const std::string& aad, bool metadata);
   std::shared_ptr<Decryptor> GetColumnDecryptor(const std::string& column_path,
                                                 const std::string& column_key_metadata,
                                                 const std::string& aad,
-                                                bool metadata = false);
+                                                bool metadata = false,
+                                                bool footer_key = false);
+  std::string GetColumnKey(const std::string& column_path,
+                           const std::string& column_key_metadata);
 
   encryption::AesDecryptor* GetMetaAesDecryptor(size_t key_size);
-  encryption::AesDecryptor* GetDataAesDecryptor(size_t key_size);
 
   int MapKeyLenToDecryptorArrayIndex(int key_len);
 };
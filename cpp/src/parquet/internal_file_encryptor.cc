@@ -121,12 +121,12 @@ InternalFileEncryptor::InternalFileEncryptor::GetColumnEncryptor(
   }
 
   ParquetCipher::type algorithm = properties_->algorithm().algorithm;
-  auto aes_encryptor = metadata ? GetMetaAesEncryptor(algorithm, key.size())
-                                : GetDataAesEncryptor(algorithm, key.size());
+  column_encryptors_.emplace_back(encryption::AesEncryptor::Make(
+      algorithm, static_cast<int>(key.size()), metadata, &all_encryptors_));
 
   std::string file_aad = properties_->file_aad();
-  std::shared_ptr<Encryptor> encryptor =
-      std::make_shared<Encryptor>(aes_encryptor, key, file_aad, "", pool_);
+  std::shared_ptr<Encryptor> encryptor = std::make_shared<Encryptor>(
+      column_encryptors_.back().get(), key, file_aad, "", pool_);
   if (metadata)
     column_metadata_map_[column_path] = encryptor;
   else
@@ -156,15 +156,4 @@ encryption::AesEncryptor* InternalFileEncryptor::GetMetaAesEncryptor(
   return meta_encryptor_[index].get();
 }
 
-encryption::AesEncryptor* InternalFileEncryptor::GetDataAesEncryptor(
-    ParquetCipher::type algorithm, size_t key_size) {
-  int key_len = static_cast<int>(key_size);
-  int index = MapKeyLenToEncryptorArrayIndex(key_len);
-  if (data_encryptor_[index] == nullptr) {
-    data_encryptor_[index].reset(
-        encryption::AesEncryptor::Make(algorithm, key_len, false, &all_encryptors_));
-  }
-  return data_encryptor_[index].get();
-}
-
 }  // namespace parquet
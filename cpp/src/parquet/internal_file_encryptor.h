@@ -90,9 +90,12 @@ class InternalFileEncryptor {
   std::vector<encryption::AesEncryptor*> all_encryptors_;
 
   // Key must be 16, 24 or 32 bytes in length. Thus there could be up to three
-  // types of meta_encryptors and data_encryptors.
+  // types of footer meta_encryptors.
   std::unique_ptr<encryption::AesEncryptor> meta_encryptor_[3];
-  std::unique_ptr<encryption::AesEncryptor> data_encryptor_[3];
+
+  // Each column gets cipher contexts of its own, so that columns can be
+  // encrypted concurrently and each context keeps the expanded column key
+  std::vector<std::unique_ptr<encryption::AesEncryptor>> column_encryptors_;
 
   ::arrow::MemoryPool* pool_;
 
@@ -101,8 +104,6 @@ class InternalFileEncryptor {
 
   encryption::AesEncryptor* GetMetaAesEncryptor(ParquetCipher::type algorithm,
                                                 size_t key_len);
-  encryption::AesEncryptor* GetDataAesEncryptor(ParquetCipher::type algorithm,
-                                                size_t key_len);
 
   int MapKeyLenToEncryptorArrayIndex(int key_len);
 };
@@ -20,6 +20,7 @@
 #include <inttypes.h>
 
 #include <algorithm>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -281,6 +282,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_metadata_->total_uncompressed_size;
   }
 
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
   inline std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const {
     if (column_->__isset.crypto_metadata) {
       return ColumnCryptoMetaData::Make(
@@ -377,6 +398,32 @@ std::unique_ptr<ColumnCryptoMetaData> ColumnChunkMetaData::crypto_metadata() con
   return impl_->crypto_metadata();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -454,8 +501,26 @@ class FileMetaData::FileMetaDataImpl {
                             const std::shared_ptr<Decryptor>& decryptor = nullptr)
       : metadata_len_(0) {
     metadata_.reset(new format::FileMetaData);
-    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
-                         metadata_.get(), decryptor);
+    auto metadata_bytes = reinterpret_cast<const uint8_t*>(metadata);
+    if (decryptor == nullptr) {
+      // The row groups are decoded on first access, so that opening files with
+      // many columns and row groups does not decode all their column chunks
+      std::vector<std::pair<uint32_t, uint32_t>> row_group_ranges;
+      DeserializeFileMetaDataWithoutRowGroups(metadata_bytes, metadata_len,
+                                              metadata_.get(), &row_group_ranges);
+      if (!row_group_ranges.empty()) {
+        const uint32_t begin = row_group_ranges.front().first;
+        serialized_row_groups_.assign(metadata_bytes + begin,
+                                      metadata_bytes + row_group_ranges.back().second);
+        for (const auto& range : row_group_ranges) {
+          row_group_ranges_.emplace_back(range.first - begin, range.second - begin);
+        }
+        metadata_->row_groups.resize(row_group_ranges.size());
+        row_group_decoded_.resize(row_group_ranges.size(), false);
+      }
+    } else {
+      DeserializeThriftMsg(metadata_bytes, metadata_len, metadata_.get(), decryptor);
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -470,6 +535,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   bool VerifySignature(InternalFileDecryptor* file_decryptor, const void* signature) {
+    DecodeRowGroups();
     // serialize the footer
     uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
@@ -528,6 +594,7 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    DecodeRowGroups();
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
@@ -563,7 +630,7 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
-    return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, &writer_version_);
+    return RowGroupMetaData::Make(&row_group(i), &schema_, &writer_version_);
   }
 
   const SchemaDescriptor* schema() const { return &schema_; }
@@ -573,6 +640,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    DecodeRowGroups();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -580,12 +648,15 @@ class FileMetaData::FileMetaDataImpl {
     }
   }
 
-  format::RowGroup& row_group(int i) {
+  format::RowGroup& row_group(int i) const {
     DCHECK_LT(i, num_row_groups());
+    std::lock_guard<std::mutex> lock(row_groups_mutex_);
+    DecodeRowGroupUnlocked(i);
     return metadata_->row_groups[i];
   }
 
   void AppendRowGroups(const std::unique_ptr<FileMetaDataImpl>& other) {
+    DecodeRowGroups();
     format::RowGroup other_rg;
     for (int i = 0; i < other->num_row_groups(); i++) {
       other_rg = other->row_group(i);
@@ -598,6 +669,36 @@ class FileMetaData::FileMetaDataImpl {
   friend FileMetaDataBuilder;
   uint32_t metadata_len_;
   std::unique_ptr<format::FileMetaData> metadata_;
+
+  // Serialized row groups, with the range of each one, if they are decoded
+  // lazily. Decoding them all releases these.
+  mutable std::vector<uint8_t> serialized_row_groups_;
+  mutable std::vector<std::pair<uint32_t, uint32_t>> row_group_ranges_;
+  mutable std::vector<bool> row_group_decoded_;
+  mutable std::mutex row_groups_mutex_;
+
+  void DecodeRowGroupUnlocked(int i) const {
+    if (i < static_cast<int>(row_group_decoded_.size()) && !row_group_decoded_[i]) {
+      uint32_t len = row_group_ranges_[i].second - row_group_ranges_[i].first;
+      DeserializeThriftUnencryptedMsg(
+          serialized_row_groups_.data() + row_group_ranges_[i].first, &len,
+          &metadata_->row_groups[i]);
+      row_group_decoded_[i] = true;
+    }
+  }
+
+  // Decode the remaining row groups, before the row groups are modified or
+  // the footer is serialized
+  void DecodeRowGroups() const {
+    std::lock_guard<std::mutex> lock(row_groups_mutex_);
+    for (int i = 0; i < static_cast<int>(row_group_decoded_.size()); i++) {
+      DecodeRowGroupUnlocked(i);
+    }
+    serialized_row_groups_.clear();
+    row_group_ranges_.clear();
+    row_group_decoded_.clear();
+  }
+
   void InitSchema() {
     schema::FlatSchemaConverter converter(&metadata_->schema[0],
                                           static_cast<int>(metadata_->schema.size()));
@@ -917,6 +1018,10 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void SetBloomFilterOffset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -1095,6 +1200,10 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::SetBloomFilterOffset(int64_t offset) {
+  impl_->SetBloomFilterOffset(offset);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -1229,6 +1338,20 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    format::ColumnChunk& column_chunk = GetColumnChunk(row_group, column);
+    column_chunk.__set_column_index_offset(offset);
+    column_chunk.__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    format::ColumnChunk& column_chunk = GetColumnChunk(row_group, column);
+    column_chunk.__set_offset_index_offset(offset);
+    column_chunk.__set_offset_index_length(length);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1337,6 +1460,17 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
   std::unique_ptr<RowGroupMetaDataBuilder> current_row_group_builder_;
   const SchemaDescriptor* schema_;
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
+
+  format::ColumnChunk& GetColumnChunk(int row_group, int column) {
+    if (row_group < 0 || row_group >= static_cast<int>(row_groups_.size()) ||
+        column < 0 ||
+        column >= static_cast<int>(row_groups_[row_group].columns.size())) {
+      std::stringstream ss;
+      ss << "Column chunk (" << row_group << ", " << column << ") does not exist";
+      throw ParquetException(ss.str());
+    }
+    return row_groups_[row_group].columns[column];
+  }
 };
 
 std::unique_ptr<FileMetaDataBuilder> FileMetaDataBuilder::Make(
@@ -1358,6 +1492,16 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetColumnIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetOffsetIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(row_group, column, offset, length);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
@@ -154,6 +154,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // page index
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // bloom filter
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(const void* metadata, const ColumnDescriptor* descr,
                                int16_t row_group_ordinal, int16_t column_ordinal,
@@ -297,6 +309,8 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // offset of the bloom filter of the column chunk in the file
+  void SetBloomFilterOffset(int64_t offset);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
@@ -364,6 +378,12 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record where the page index of a column chunk was written
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length);
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
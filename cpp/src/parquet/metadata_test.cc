@@ -204,6 +204,42 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(3, f_accessor->num_schema_elements());
 }
 
+TEST(Metadata, TestLazyRowGroupDecoding) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+
+  int64_t nrows = 1000;
+  auto f_accessor = GenerateTableMetaData(schema, default_writer_properties(), nrows,
+                                          EncodedStatistics(), EncodedStatistics());
+  std::string serialized_metadata = f_accessor->SerializeToString();
+  auto Decode = [&]() {
+    uint32_t decoded_len = static_cast<uint32_t>(serialized_metadata.length());
+    auto decoded = FileMetaData::Make(serialized_metadata.data(), &decoded_len);
+    EXPECT_EQ(serialized_metadata.length(), decoded_len);
+    return decoded;
+  };
+
+  // Row groups are decoded on first access, in any order
+  auto f_accessor_copy = Decode();
+  ASSERT_EQ(2, f_accessor_copy->num_row_groups());
+  ASSERT_EQ(nrows, f_accessor_copy->num_rows());
+  ASSERT_EQ(26, f_accessor_copy->RowGroup(1)->ColumnChunk(1)->data_page_offset());
+  ASSERT_EQ(30, f_accessor_copy->RowGroup(0)->ColumnChunk(1)->data_page_offset());
+  ASSERT_EQ(serialized_metadata, f_accessor_copy->SerializeToString());
+
+  // Row groups that were never accessed are decoded before serializing
+  ASSERT_EQ(serialized_metadata, Decode()->SerializeToString());
+
+  auto f_accessor_appended = Decode();
+  f_accessor_appended->AppendRowGroups(*Decode());
+  ASSERT_EQ(4, f_accessor_appended->num_row_groups());
+  ASSERT_EQ(nrows * 2, f_accessor_appended->num_rows());
+  ASSERT_EQ(16, f_accessor_appended->RowGroup(3)->ColumnChunk(1)->dictionary_page_offset());
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
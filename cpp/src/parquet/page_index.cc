@@ -0,0 +1,322 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+class OffsetIndex::OffsetIndexImpl {
+ public:
+  OffsetIndexImpl(const void* serialized_index, uint32_t* inout_index_len) {
+    format::OffsetIndex index;
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index),
+                         inout_index_len, &index);
+    page_locations_.reserve(index.page_locations.size());
+    for (const auto& location : index.page_locations) {
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+OffsetIndex::OffsetIndex() {}
+
+OffsetIndex::~OffsetIndex() {}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t* inout_index_len) {
+  std::unique_ptr<OffsetIndex> result(new OffsetIndex());
+  result->impl_.reset(new OffsetIndexImpl(serialized_index, inout_index_len));
+  return result;
+}
+
+int OffsetIndex::num_pages() const {
+  return static_cast<int>(impl_->page_locations().size());
+}
+
+const std::vector<PageLocation>& OffsetIndex::page_locations() const {
+  return impl_->page_locations();
+}
+
+int OffsetIndex::FindPage(int64_t row_index, int64_t num_rows) const {
+  const auto& locations = impl_->page_locations();
+  if (locations.empty() || row_index < locations.front().first_row_index ||
+      row_index >= num_rows) {
+    return -1;
+  }
+  // Find the last page starting at or before the row
+  auto it = std::upper_bound(locations.begin(), locations.end(), row_index,
+                             [](int64_t row, const PageLocation& location) {
+                               return row < location.first_row_index;
+                             });
+  return static_cast<int>(it - locations.begin()) - 1;
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+class ColumnIndex::ColumnIndexImpl {
+ public:
+  ColumnIndexImpl(const ColumnDescriptor* descr, const void* serialized_index,
+                  uint32_t* inout_index_len)
+      : descr_(descr) {
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index),
+                         inout_index_len, &index_);
+    const size_t num_pages = index_.null_pages.size();
+    if (index_.min_values.size() != num_pages || index_.max_values.size() != num_pages ||
+        (index_.__isset.null_counts && index_.null_counts.size() != num_pages)) {
+      throw ParquetException("Corrupted ColumnIndex: list lengths do not match");
+    }
+  }
+
+  const ColumnDescriptor* descr() const { return descr_; }
+
+  const format::ColumnIndex& index() const { return index_; }
+
+  std::shared_ptr<Statistics> page_statistics(int i) const {
+    if (index_.null_pages[i]) {
+      return nullptr;
+    }
+    int64_t null_count = index_.__isset.null_counts ? index_.null_counts[i] : 0;
+    return Statistics::Make(descr_, index_.min_values[i], index_.max_values[i],
+                            /*num_values=*/0, null_count, /*distinct_count=*/0,
+                            /*has_min_max=*/true);
+  }
+
+ private:
+  const ColumnDescriptor* descr_;
+  format::ColumnIndex index_;
+};
+
+ColumnIndex::ColumnIndex() {}
+
+ColumnIndex::~ColumnIndex() {}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t* inout_index_len) {
+  std::unique_ptr<ColumnIndex> result(new ColumnIndex());
+  result->impl_.reset(new ColumnIndexImpl(descr, serialized_index, inout_index_len));
+  return result;
+}
+
+const ColumnDescriptor* ColumnIndex::descr() const { return impl_->descr(); }
+
+int ColumnIndex::num_pages() const {
+  return static_cast<int>(impl_->index().null_pages.size());
+}
+
+const std::vector<bool>& ColumnIndex::null_pages() const {
+  return impl_->index().null_pages;
+}
+
+const std::vector<std::string>& ColumnIndex::encoded_min_values() const {
+  return impl_->index().min_values;
+}
+
+const std::vector<std::string>& ColumnIndex::encoded_max_values() const {
+  return impl_->index().max_values;
+}
+
+BoundaryOrder::type ColumnIndex::boundary_order() const {
+  return static_cast<BoundaryOrder::type>(impl_->index().boundary_order);
+}
+
+bool ColumnIndex::has_null_counts() const { return impl_->index().__isset.null_counts; }
+
+const std::vector<int64_t>& ColumnIndex::null_counts() const {
+  return impl_->index().null_counts;
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i) const {
+  DCHECK(i >= 0 && i < num_pages());
+  return impl_->page_statistics(i);
+}
+
+// ----------------------------------------------------------------------
+// ColumnChunkPageIndexBuilder
+
+class ColumnChunkPageIndexBuilder::ColumnChunkPageIndexBuilderImpl {
+ public:
+  ColumnChunkPageIndexBuilderImpl() : has_column_index_(true), has_null_counts_(true) {}
+
+  void AddPage(const EncodedStatistics& stats, int64_t num_values,
+               const PageLocation& location) {
+    format::PageLocation page_location;
+    page_location.__set_offset(location.offset);
+    page_location.__set_compressed_page_size(location.compressed_page_size);
+    page_location.__set_first_row_index(location.first_row_index);
+    offset_index_.page_locations.push_back(page_location);
+
+    const bool null_page = stats.has_null_count && stats.null_count == num_values;
+    column_index_.null_pages.push_back(null_page);
+    if (null_page) {
+      column_index_.min_values.emplace_back();
+      column_index_.max_values.emplace_back();
+    } else if (stats.has_min && stats.has_max) {
+      column_index_.min_values.push_back(stats.min());
+      column_index_.max_values.push_back(stats.max());
+    } else {
+      // Statistics are disabled or were dropped because of their size
+      has_column_index_ = false;
+      column_index_.min_values.emplace_back();
+      column_index_.max_values.emplace_back();
+    }
+    has_null_counts_ = has_null_counts_ && stats.has_null_count;
+    column_index_.null_counts.push_back(stats.null_count);
+  }
+
+  void Finish(int64_t final_position) {
+    for (auto& location : offset_index_.page_locations) {
+      location.offset += final_position;
+    }
+    if (offset_index_.page_locations.empty()) {
+      has_column_index_ = false;
+    }
+    // TODO: detect ascending and descending boundaries to let readers use a
+    // binary search
+    column_index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    if (has_null_counts_) {
+      column_index_.__isset.null_counts = true;
+    } else {
+      column_index_.null_counts.clear();
+    }
+  }
+
+  bool has_column_index() const { return has_column_index_; }
+
+  int64_t WriteColumnIndex(ArrowOutputStream* sink) const {
+    ThriftSerializer serializer;
+    return serializer.Serialize(&column_index_, sink);
+  }
+
+  int64_t WriteOffsetIndex(ArrowOutputStream* sink) const {
+    ThriftSerializer serializer;
+    return serializer.Serialize(&offset_index_, sink);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
+  bool has_column_index_;
+  bool has_null_counts_;
+};
+
+ColumnChunkPageIndexBuilder::ColumnChunkPageIndexBuilder()
+    : impl_(new ColumnChunkPageIndexBuilderImpl()) {}
+
+ColumnChunkPageIndexBuilder::~ColumnChunkPageIndexBuilder() {}
+
+void ColumnChunkPageIndexBuilder::AddPage(const EncodedStatistics& stats,
+                                          int64_t num_values,
+                                          const PageLocation& location) {
+  impl_->AddPage(stats, num_values, location);
+}
+
+void ColumnChunkPageIndexBuilder::Finish(int64_t final_position) {
+  impl_->Finish(final_position);
+}
+
+bool ColumnChunkPageIndexBuilder::has_column_index() const {
+  return impl_->has_column_index();
+}
+
+int64_t ColumnChunkPageIndexBuilder::WriteColumnIndex(ArrowOutputStream* sink) const {
+  return impl_->WriteColumnIndex(sink);
+}
+
+int64_t ColumnChunkPageIndexBuilder::WriteOffsetIndex(ArrowOutputStream* sink) const {
+  return impl_->WriteOffsetIndex(sink);
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+PageIndexBuilder::PageIndexBuilder(const SchemaDescriptor* schema) : schema_(schema) {}
+
+PageIndexBuilder::~PageIndexBuilder() {}
+
+std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(
+    const SchemaDescriptor* schema) {
+  return std::unique_ptr<PageIndexBuilder>(new PageIndexBuilder(schema));
+}
+
+void PageIndexBuilder::AppendRowGroup() {
+  row_groups_.emplace_back();
+  auto& builders = row_groups_.back();
+  for (int i = 0; i < schema_->num_columns(); ++i) {
+    if (schema_->Column(i)->max_repetition_level() > 0) {
+      builders.emplace_back(nullptr);
+    } else {
+      builders.emplace_back(new ColumnChunkPageIndexBuilder());
+    }
+  }
+}
+
+ColumnChunkPageIndexBuilder* PageIndexBuilder::GetColumnChunkBuilder(int column) {
+  if (row_groups_.empty()) {
+    throw ParquetException("No row group was appended to the page index");
+  }
+  return row_groups_.back().at(column).get();
+}
+
+void PageIndexBuilder::WriteTo(ArrowOutputStream* sink,
+                               FileMetaDataBuilder* metadata) const {
+  const int num_row_groups = static_cast<int>(row_groups_.size());
+  // Keep all column indexes together, then all offset indexes, so that readers
+  // can fetch either kind for a whole file with a single read
+  for (int rg = 0; rg < num_row_groups; ++rg) {
+    for (int col = 0; col < schema_->num_columns(); ++col) {
+      const auto& builder = row_groups_[rg][col];
+      if (builder && builder->has_column_index()) {
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        int64_t length = builder->WriteColumnIndex(sink);
+        metadata->SetColumnIndexLocation(rg, col, offset, static_cast<int32_t>(length));
+      }
+    }
+  }
+  for (int rg = 0; rg < num_row_groups; ++rg) {
+    for (int col = 0; col < schema_->num_columns(); ++col) {
+      const auto& builder = row_groups_[rg][col];
+      if (builder) {
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        int64_t length = builder->WriteOffsetIndex(sink);
+        metadata->SetOffsetIndexLocation(rg, col, offset, static_cast<int32_t>(length));
+      }
+    }
+  }
+}
+
+}  // namespace parquet
@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Page index structures (ColumnIndex and OffsetIndex) which describe the
+// individual data pages of a column chunk, see
+// https://github.com/apache/parquet-format/blob/master/PageIndex.md
+
+#ifndef PARQUET_PAGE_INDEX_H
+#define PARQUET_PAGE_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/statistics.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class FileMetaDataBuilder;
+class SchemaDescriptor;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief The location of a data page within a file
+struct PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+/// \brief The locations of the data pages of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex
+  /// \param[in] serialized_index the Thrift-serialized index
+  /// \param[in,out] inout_index_len the length of the serialized index on input,
+  /// the number of bytes actually consumed on output
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t* inout_index_len);
+
+  ~OffsetIndex();
+
+  int num_pages() const;
+
+  const std::vector<PageLocation>& page_locations() const;
+
+  /// \brief Return the ordinal of the page containing the given row, or -1 if
+  /// the row is not in the column chunk
+  int FindPage(int64_t row_index, int64_t num_rows) const;
+
+ private:
+  OffsetIndex();
+  // PIMPL Idiom
+  class OffsetIndexImpl;
+  std::unique_ptr<OffsetIndexImpl> impl_;
+};
+
+/// \brief The min/max statistics of the data pages of a column chunk
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex
+  /// \param[in] descr the schema of the indexed column
+  /// \param[in] serialized_index the Thrift-serialized index
+  /// \param[in,out] inout_index_len the length of the serialized index on input,
+  /// the number of bytes actually consumed on output
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t* inout_index_len);
+
+  ~ColumnIndex();
+
+  const ColumnDescriptor* descr() const;
+
+  int num_pages() const;
+
+  /// Whether each page only contains null values, in which case it has no
+  /// min and max values
+  const std::vector<bool>& null_pages() const;
+
+  /// Plain-encoded minimum value of each page
+  const std::vector<std::string>& encoded_min_values() const;
+
+  /// Plain-encoded maximum value of each page
+  const std::vector<std::string>& encoded_max_values() const;
+
+  BoundaryOrder::type boundary_order() const;
+
+  bool has_null_counts() const;
+
+  const std::vector<int64_t>& null_counts() const;
+
+  /// \brief Return the decoded statistics of a page, or nullptr for a page
+  /// which only contains null values
+  ///
+  /// Only the min, max and null count are populated.
+  std::shared_ptr<Statistics> page_statistics(int i) const;
+
+ private:
+  ColumnIndex();
+  // PIMPL Idiom
+  class ColumnIndexImpl;
+  std::unique_ptr<ColumnIndexImpl> impl_;
+};
+
+/// \brief Return the ordinals of the data pages whose [min, max] range may
+/// contain the given value
+///
+/// Pages which only contain null values are never selected.
+template <typename DType>
+std::vector<int> FindPagesContaining(const ColumnIndex& index,
+                                     const typename DType::c_type& value) {
+  auto comparator = MakeComparator<DType>(index.descr());
+  std::vector<int> pages;
+  for (int i = 0; i < index.num_pages(); ++i) {
+    auto stats =
+        std::static_pointer_cast<TypedStatistics<DType>>(index.page_statistics(i));
+    if (stats == NULLPTR) {
+      continue;
+    }
+    if (!comparator->Compare(value, stats->min()) &&
+        !comparator->Compare(stats->max(), value)) {
+      pages.push_back(i);
+    }
+  }
+  return pages;
+}
+
+/// \brief Collects the locations and statistics of the data pages of a column
+/// chunk while they are written
+class PARQUET_EXPORT ColumnChunkPageIndexBuilder {
+ public:
+  ColumnChunkPageIndexBuilder();
+
+  ~ColumnChunkPageIndexBuilder();
+
+  /// \brief Record a data page
+  /// \param[in] stats the plain-encoded statistics of the page
+  /// \param[in] num_values the number of values (including nulls) in the page
+  /// \param[in] location where the page was written
+  void AddPage(const EncodedStatistics& stats, int64_t num_values,
+               const PageLocation& location);
+
+  /// \brief Complete the index once all pages were written
+  /// \param[in] final_position added to the recorded page offsets, if the pages
+  /// were written relative to an intermediate buffer
+  void Finish(int64_t final_position = 0);
+
+  /// \brief Whether every page has min/max statistics (or only contains nulls)
+  ///
+  /// If not, no ColumnIndex can be written for the column chunk.
+  bool has_column_index() const;
+
+  /// \brief Serialize the ColumnIndex, return the number of bytes written
+  int64_t WriteColumnIndex(ArrowOutputStream* sink) const;
+
+  /// \brief Serialize the OffsetIndex, return the number of bytes written
+  int64_t WriteOffsetIndex(ArrowOutputStream* sink) const;
+
+ private:
+  class ColumnChunkPageIndexBuilderImpl;
+  std::unique_ptr<ColumnChunkPageIndexBuilderImpl> impl_;
+};
+
+/// \brief Collects the page indexes of all column chunks of a file and writes
+/// them before the file footer
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  static std::unique_ptr<PageIndexBuilder> Make(const SchemaDescriptor* schema);
+
+  ~PageIndexBuilder();
+
+  /// \brief Start collecting the page indexes of a new row group
+  void AppendRowGroup();
+
+  /// \brief Return the builder of a column chunk of the current row group, or
+  /// nullptr if the column is not indexed
+  ///
+  /// Repeated columns are not indexed, as their pages are not guaranteed to
+  /// start on a record boundary.
+  ColumnChunkPageIndexBuilder* GetColumnChunkBuilder(int column);
+
+  /// \brief Write all ColumnIndex structures, then all OffsetIndex structures,
+  /// and record their locations in the file metadata
+  void WriteTo(ArrowOutputStream* sink, FileMetaDataBuilder* metadata) const;
+
+ private:
+  explicit PageIndexBuilder(const SchemaDescriptor* schema);
+
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnChunkPageIndexBuilder>>> row_groups_;
+};
+
+}  // namespace parquet
+
+#endif  // PARQUET_PAGE_INDEX_H
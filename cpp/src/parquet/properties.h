@@ -18,12 +18,14 @@
 #ifndef PARQUET_COLUMN_PROPERTIES_H
 #define PARQUET_COLUMN_PROPERTIES_H
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/io/caching.h"
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
 #include "parquet/encryption.h"
@@ -41,6 +43,7 @@ struct ParquetVersion {
 
 static int64_t DEFAULT_BUFFER_SIZE = 1024;
 static bool DEFAULT_USE_BUFFERED_STREAM = false;
+static bool DEFAULT_USE_PAGE_PREFETCH = false;
 
 class PARQUET_EXPORT ReaderProperties {
  public:
@@ -48,6 +51,7 @@ class PARQUET_EXPORT ReaderProperties {
       : pool_(pool) {
     buffered_stream_enabled_ = DEFAULT_USE_BUFFERED_STREAM;
     buffer_size_ = DEFAULT_BUFFER_SIZE;
+    page_prefetch_enabled_ = DEFAULT_USE_PAGE_PREFETCH;
   }
 
   MemoryPool* memory_pool() const { return pool_; }
@@ -55,6 +59,10 @@ class PARQUET_EXPORT ReaderProperties {
   std::shared_ptr<ArrowInputStream> GetStream(std::shared_ptr<ArrowInputFile> source,
                                               int64_t start, int64_t num_bytes);
 
+  /// Read column chunks through a buffer of buffer_size() bytes rather than
+  /// reading each chunk into memory in full. Together with a record batch
+  /// reader, this bounds the memory used to read a file by the batch size
+  /// rather than the row group size.
   bool is_buffered_stream_enabled() const { return buffered_stream_enabled_; }
 
   void enable_buffered_stream() { buffered_stream_enabled_ = true; }
@@ -65,6 +73,14 @@ class PARQUET_EXPORT ReaderProperties {
 
   int64_t buffer_size() const { return buffer_size_; }
 
+  /// Read, decrypt and decompress the next page of each column in the
+  /// background while the current one is decoded, see PageReader::Open
+  bool is_page_prefetch_enabled() const { return page_prefetch_enabled_; }
+
+  void enable_page_prefetch() { page_prefetch_enabled_ = true; }
+
+  void disable_page_prefetch() { page_prefetch_enabled_ = false; }
+
   void file_decryption_properties(std::shared_ptr<FileDecryptionProperties> decryption) {
     file_decryption_properties_ = std::move(decryption);
   }
@@ -73,11 +89,34 @@ class PARQUET_EXPORT ReaderProperties {
     return file_decryption_properties_.get();
   }
 
+  /// Set the dictionary the pages of all columns were compressed with, see
+  /// WriterProperties::Builder::compression_dictionary
+  void set_compression_dictionary(std::shared_ptr<Buffer> dictionary) {
+    default_compression_dictionary_ = std::move(dictionary);
+  }
+
+  /// Set the dictionary the pages of the given column were compressed with
+  void set_compression_dictionary(const std::string& path,
+                                  std::shared_ptr<Buffer> dictionary) {
+    compression_dictionaries_[path] = std::move(dictionary);
+  }
+
+  std::shared_ptr<Buffer> compression_dictionary(const std::string& path) const {
+    auto it = compression_dictionaries_.find(path);
+    if (it != compression_dictionaries_.end()) {
+      return it->second;
+    }
+    return default_compression_dictionary_;
+  }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_;
   bool buffered_stream_enabled_;
+  bool page_prefetch_enabled_;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
+  std::shared_ptr<Buffer> default_compression_dictionary_;
+  std::unordered_map<std::string, std::shared_ptr<Buffer>> compression_dictionaries_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -87,8 +126,12 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROWS_PER_PAGE = std::numeric_limits<int64_t>::max();
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
@@ -107,7 +150,9 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -129,6 +174,16 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_fpp(double fpp) { bloom_filter_fpp_ = fpp; }
+
+  void set_compression_dictionary(std::shared_ptr<Buffer> dictionary) {
+    compression_dictionary_ = std::move(dictionary);
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -141,6 +196,14 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  const std::shared_ptr<Buffer>& compression_dictionary() const {
+    return compression_dictionary_;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -148,6 +211,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  double bloom_filter_fpp_;
+  std::shared_ptr<Buffer> compression_dictionary_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -160,8 +226,10 @@ class PARQUET_EXPORT WriterProperties {
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
           pagesize_(kDefaultDataPageSize),
+          max_rows_per_page_(DEFAULT_MAX_ROWS_PER_PAGE),
           version_(DEFAULT_WRITER_VERSION),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -212,11 +280,24 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Target size in bytes of the encoded values of a data page
+    ///
+    /// Values are written in batches of at most write_batch_size levels and
+    /// a page is completed once a batch reaches the target. For BYTE_ARRAY
+    /// columns written from Arrow, batches are also cut short by the byte
+    /// lengths of the values, so that wide values do not overshoot the target
+    /// by a whole batch.
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
     }
 
+    /// \brief Maximum number of rows in a data page, no limit by default
+    Builder* max_rows_per_page(int64_t max_rows) {
+      max_rows_per_page_ = max_rows;
+      return this;
+    }
+
     Builder* version(ParquetVersion::type version) {
       version_ = version;
       return this;
@@ -227,6 +308,21 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Write a ColumnIndex and an OffsetIndex for each column chunk,
+    /// which let readers skip individual data pages.
+    ///
+    /// The page index is not written for repeated columns, nor for encrypted
+    /// files.
+    Builder* enable_write_page_index() {
+      page_index_enabled_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      page_index_enabled_ = false;
+      return this;
+    }
+
     /**
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
@@ -339,6 +435,33 @@ class PARQUET_EXPORT WriterProperties {
       return this->compression_level(path->ToDotString(), compression_level);
     }
 
+    /// \brief Specify the default dictionary for the ZSTD compressor, see
+    /// ::arrow::util::Codec::TrainDictionary.
+    ///
+    /// A dictionary trained on typical pages greatly improves the compression
+    /// of small pages.  It is not stored in the file: readers must be given
+    /// the same dictionary with ReaderProperties::set_compression_dictionary,
+    /// and other Parquet implementations can't read such columns.
+    Builder* compression_dictionary(std::shared_ptr<Buffer> dictionary) {
+      default_column_properties_.set_compression_dictionary(std::move(dictionary));
+      return this;
+    }
+
+    /// \brief Specify the dictionary for the ZSTD compressor of the column
+    /// described by path.
+    Builder* compression_dictionary(const std::string& path,
+                                    std::shared_ptr<Buffer> dictionary) {
+      compression_dictionaries_[path] = std::move(dictionary);
+      return this;
+    }
+
+    /// \brief Specify the dictionary for the ZSTD compressor of the column
+    /// described by path.
+    Builder* compression_dictionary(const std::shared_ptr<schema::ColumnPath>& path,
+                                    std::shared_ptr<Buffer> dictionary) {
+      return this->compression_dictionary(path->ToDotString(), std::move(dictionary));
+    }
+
     Builder* encryption(
         std::shared_ptr<FileEncryptionProperties> file_encryption_properties) {
       file_encryption_properties_ = std::move(file_encryption_properties);
@@ -373,6 +496,54 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Build a bloom filter for each column chunk and write it after the
+    /// chunk's data pages. Bloom filters are never written for BOOLEAN columns
+    /// nor for encrypted files.
+    Builder* enable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      return this;
+    }
+
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_bloom_filter(path->ToDotString());
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// Target false positive probability of the bloom filters, used to size
+    /// them from the number of distinct values of each column chunk
+    Builder* bloom_filter_fpp(double fpp) {
+      default_column_properties_.set_bloom_filter_fpp(fpp);
+      return this;
+    }
+
+    Builder* bloom_filter_fpp(const std::string& path, double fpp) {
+      bloom_filter_fpp_[path] = fpp;
+      return this;
+    }
+
+    Builder* bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path,
+                              double fpp) {
+      return this->bloom_filter_fpp(path->ToDotString(), fpp);
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -391,11 +562,18 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_fpp_)
+        get(item.first).set_bloom_filter_fpp(item.second);
+      for (const auto& item : compression_dictionaries_)
+        get(item.first).set_compression_dictionary(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties));
+          pagesize_, max_rows_per_page_, version_, created_by_, page_index_enabled_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties));
     }
 
    private:
@@ -404,8 +582,10 @@ class PARQUET_EXPORT WriterProperties {
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
     int64_t pagesize_;
+    int64_t max_rows_per_page_;
     ParquetVersion::type version_;
     std::string created_by_;
+    bool page_index_enabled_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -416,6 +596,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, double> bloom_filter_fpp_;
+    std::unordered_map<std::string, std::shared_ptr<Buffer>> compression_dictionaries_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -428,10 +611,16 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t data_pagesize() const { return pagesize_; }
 
+  inline int64_t max_rows_per_page() const { return max_rows_per_page_; }
+
   inline ParquetVersion::type version() const { return parquet_version_; }
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool page_index_enabled() const {
+    return page_index_enabled_ && file_encryption_properties_ == NULLPTR;
+  }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -467,6 +656,11 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).compression_level();
   }
 
+  std::shared_ptr<Buffer> compression_dictionary(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).compression_dictionary();
+  }
+
   bool dictionary_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
     return column_properties(path).dictionary_enabled();
   }
@@ -479,6 +673,15 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled() &&
+           file_encryption_properties_ == NULLPTR;
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -495,8 +698,9 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
-      const std::string& created_by,
+      int64_t max_row_group_length, int64_t pagesize, int64_t max_rows_per_page,
+      ParquetVersion::type version, const std::string& created_by,
+      bool page_index_enabled,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties)
@@ -505,8 +709,10 @@ class PARQUET_EXPORT WriterProperties {
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
         pagesize_(pagesize),
+        max_rows_per_page_(max_rows_per_page),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        page_index_enabled_(page_index_enabled),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -516,8 +722,10 @@ class PARQUET_EXPORT WriterProperties {
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
   int64_t pagesize_;
+  int64_t max_rows_per_page_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool page_index_enabled_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -541,7 +749,10 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(false),
+        zero_copy_values_(false),
+        cache_options_(::arrow::io::CacheOptions::Defaults()) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -566,10 +777,44 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// Enable read coalescing.
+  ///
+  /// When enabled, the Arrow reader will pre-buffer necessary regions
+  /// of the file in-memory. This is intended to improve performance on
+  /// high-latency filesystems (e.g. Amazon S3).
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// Set options for read coalescing. This can be used to tune the
+  /// implementation for characteristics of different filesystems.
+  void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
+
+  const ::arrow::io::CacheOptions& cache_options() const { return cache_options_; }
+
+  /// Slice the values of required, top-level INT32, INT64, FLOAT and DOUBLE
+  /// columns out of PLAIN-encoded data pages instead of copying them.
+  ///
+  /// This applies to pages whose buffers the page reader does not reuse,
+  /// which are those of uncompressed, unencrypted column chunks or of any
+  /// chunk with page prefetching enabled. Reading an uncompressed column from
+  /// a memory-mapped file then yields arrays pointing into the mapping, for
+  /// pages whose values are suitably aligned. As each sliced page becomes a
+  /// chunk of its own, columns may come out in many chunks. Record batch
+  /// readers do not use this.
+  void set_zero_copy_values(bool zero_copy_values) {
+    zero_copy_values_ = zero_copy_values;
+  }
+
+  bool zero_copy_values() const { return zero_copy_values_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  bool zero_copy_values_;
+  ::arrow::io::CacheOptions cache_options_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -585,7 +830,9 @@ class PARQUET_EXPORT ArrowWriterProperties {
           coerce_timestamps_enabled_(false),
           coerce_timestamps_unit_(::arrow::TimeUnit::SECOND),
           truncated_timestamps_allowed_(false),
-          store_schema_(false) {}
+          store_schema_(false),
+          use_threads_(false),
+          max_row_group_bytes_(std::numeric_limits<int64_t>::max()) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -622,10 +869,32 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of each row group written
+    /// by FileWriter::WriteTable in parallel on the CPU thread pool
+    ///
+    /// The column chunks are buffered in memory and written to the sink in
+    /// order once the row group is complete. Files with encrypted columns are
+    /// still written serially.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
+    /// \brief Memory budget in bytes of the buffered row group that
+    /// FileWriter::WriteRecordBatch appends to, no limit by default
+    ///
+    /// The row group is written to the sink once its buffered data reaches
+    /// the budget, as estimated by RowGroupWriter::total_buffered_bytes.
+    Builder* max_row_group_bytes(int64_t max_bytes) {
+      max_row_group_bytes_ = max_bytes;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_, store_schema_));
+          truncated_timestamps_allowed_, store_schema_, use_threads_,
+          max_row_group_bytes_));
     }
 
    private:
@@ -636,6 +905,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool truncated_timestamps_allowed_;
 
     bool store_schema_;
+    bool use_threads_;
+    int64_t max_row_group_bytes_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -649,22 +920,31 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
   bool store_schema() const { return store_schema_; }
 
+  bool use_threads() const { return use_threads_; }
+
+  int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
-                                 bool truncated_timestamps_allowed, bool store_schema)
+                                 bool truncated_timestamps_allowed, bool store_schema,
+                                 bool use_threads, int64_t max_row_group_bytes)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
-        store_schema_(store_schema) {}
+        store_schema_(store_schema),
+        use_threads_(use_threads),
+        max_row_group_bytes_(max_row_group_bytes) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
   const ::arrow::TimeUnit::type coerce_timestamps_unit_;
   const bool truncated_timestamps_allowed_;
   const bool store_schema_;
+  const bool use_threads_;
+  const int64_t max_row_group_bytes_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
@@ -65,6 +65,28 @@ TEST(TestWriterProperties, AdvancedHandling) {
             props->encoding(ColumnPath::FromDotString("delta-length")));
 }
 
+TEST(TestWriterProperties, CompressionDictionary) {
+  auto default_dictionary = Buffer::FromString("default dictionary");
+  auto column_dictionary = Buffer::FromString("column dictionary");
+  WriterProperties::Builder builder;
+  builder.compression(Compression::ZSTD);
+  builder.compression_dictionary(default_dictionary);
+  builder.compression_dictionary("column", column_dictionary);
+  std::shared_ptr<WriterProperties> props = builder.build();
+
+  ASSERT_EQ(default_dictionary,
+            props->compression_dictionary(ColumnPath::FromDotString("other")));
+  ASSERT_EQ(column_dictionary,
+            props->compression_dictionary(ColumnPath::FromDotString("column")));
+
+  ReaderProperties reader_props;
+  ASSERT_EQ(nullptr, reader_props.compression_dictionary("column"));
+  reader_props.set_compression_dictionary(default_dictionary);
+  reader_props.set_compression_dictionary("column", column_dictionary);
+  ASSERT_EQ(default_dictionary, reader_props.compression_dictionary("other"));
+  ASSERT_EQ(column_dictionary, reader_props.compression_dictionary("column"));
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";
@@ -22,6 +22,7 @@
 
 #include "arrow/array.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -40,6 +41,14 @@ namespace parquet {
 // ----------------------------------------------------------------------
 // Comparator implementations
 
+// Unsigned lexicographic comparison, memcmp comparing bytes as unsigned char
+inline bool CompareUnsignedBytes(const uint8_t* a, uint32_t a_len, const uint8_t* b,
+                                 uint32_t b_len) {
+  const uint32_t common_len = std::min(a_len, b_len);
+  const int res = common_len == 0 ? 0 : std::memcmp(a, b, common_len);
+  return res < 0 || (res == 0 && a_len < b_len);
+}
+
 template <typename DType, bool is_signed>
 struct CompareHelper {
   typedef typename DType::c_type T;
@@ -114,19 +123,14 @@ struct CompareHelper<Int96Type, false> {
 template <>
 struct CompareHelper<ByteArrayType, false> {
   static inline bool Compare(int type_length, const ByteArray& a, const ByteArray& b) {
-    const uint8_t* aptr = reinterpret_cast<const uint8_t*>(a.ptr);
-    const uint8_t* bptr = reinterpret_cast<const uint8_t*>(b.ptr);
-    return std::lexicographical_compare(aptr, aptr + a.len, bptr, bptr + b.len);
+    return CompareUnsignedBytes(a.ptr, a.len, b.ptr, b.len);
   }
 };
 
 template <>
 struct CompareHelper<FLBAType, false> {
   static inline bool Compare(int type_length, const FLBA& a, const FLBA& b) {
-    const uint8_t* aptr = reinterpret_cast<const uint8_t*>(a.ptr);
-    const uint8_t* bptr = reinterpret_cast<const uint8_t*>(b.ptr);
-    return std::lexicographical_compare(aptr, aptr + type_length, bptr,
-                                        bptr + type_length);
+    return CompareUnsignedBytes(a.ptr, type_length, b.ptr, type_length);
   }
 };
 
@@ -149,6 +153,148 @@ double CleanStatistic(double val) {
   return fabs(val) < 1E-13 ? 0.0 : val;
 }
 
+// Running min and max of values, with a branch per value as the extrema
+// rarely change once some values are seen
+template <typename DType, bool is_signed, typename Enable = void>
+class MinMaxAccumulator {
+ public:
+  using T = typename DType::c_type;
+
+  MinMaxAccumulator(int type_length, const T& first)
+      : type_length_(type_length), min_(first), max_(first) {}
+
+  void Update(const T* values, int64_t length) {
+    for (int64_t i = 0; i < length; i++) {
+      if (CompareHelper<DType, is_signed>::Compare(type_length_, values[i], min_)) {
+        min_ = values[i];
+      } else if (CompareHelper<DType, is_signed>::Compare(type_length_, max_,
+                                                          values[i])) {
+        max_ = values[i];
+      }
+    }
+  }
+
+  void UpdateSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                    int64_t valid_bits_offset) {
+    ::arrow::internal::VisitSetBitRuns(
+        valid_bits, valid_bits_offset, length,
+        [&](int64_t position, int64_t run_length) {
+          Update(values + position, run_length);
+        });
+  }
+
+  void Finish(T* out_min, T* out_max) const {
+    *out_min = min_;
+    *out_max = max_;
+  }
+
+ private:
+  int type_length_;
+  T min_;
+  T max_;
+};
+
+// Maps integers to integers of the same type whose signed order is the unsigned
+// order of the former, by flipping the sign bit. The mapping is an involution.
+template <typename T, bool flip_sign_bit>
+struct SignBitFlipper {
+  static T Map(T value) { return value; }
+};
+
+template <typename T>
+struct SignBitFlipper<T, true> {
+  static T Map(T value) {
+    using U = typename std::make_unsigned<T>::type;
+    return static_cast<T>(static_cast<U>(value) ^
+                          (static_cast<U>(1) << (sizeof(T) * 8 - 1)));
+  }
+};
+
+// Running min and max of arithmetic values. Every lane of kLanes consecutive
+// values updates extrema of its own without branches, so that compilers turn
+// the loop into SIMD min and max instructions. NaNs never compare less or
+// greater, so they are skipped as long as the first value isn't one. Null
+// slots are replaced with the first value, which leaves the extrema unchanged.
+//
+// Unsigned orders of integers are computed as signed orders of the values
+// with their sign bit flipped, as SIMD instruction sets often lack unsigned
+// comparisons.
+template <typename DType, bool is_signed>
+class MinMaxAccumulator<
+    DType, is_signed,
+    ::arrow::enable_if_t<std::is_arithmetic<typename DType::c_type>::value>> {
+ public:
+  using T = typename DType::c_type;
+
+  MinMaxAccumulator(int, T first) : first_(Map(first)) {
+    std::fill(mins_, mins_ + kLanes, first_);
+    std::fill(maxs_, maxs_ + kLanes, first_);
+  }
+
+  void Update(const T* values, int64_t length) {
+    int64_t i = 0;
+    for (; i + kLanes <= length; i += kLanes) {
+      for (int j = 0; j < kLanes; j++) {
+        const T value = Map(values[i + j]);
+        mins_[j] = value < mins_[j] ? value : mins_[j];
+        maxs_[j] = maxs_[j] < value ? value : maxs_[j];
+      }
+    }
+    for (int j = 0; i < length; i++, j++) {
+      const T value = Map(values[i]);
+      mins_[j] = value < mins_[j] ? value : mins_[j];
+      maxs_[j] = maxs_[j] < value ? value : maxs_[j];
+    }
+  }
+
+  void UpdateSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                    int64_t valid_bits_offset) {
+    for (int64_t position = 0; position < length; position += 64) {
+      const int64_t num_values = std::min<int64_t>(length - position, 64);
+      const uint64_t word = ::arrow::internal::LoadBitmapWord(
+          valid_bits, valid_bits_offset + position, num_values);
+      if (word == ::arrow::BitUtil::TrailingBits(~uint64_t(0),
+                                                 static_cast<int>(num_values))) {
+        Update(values + position, num_values);
+      } else if (word != 0) {
+        // Values past num_values have their bits unset
+        const T* block = values + position;
+        for (int64_t i = 0; i < num_values; i += kLanes) {
+          const uint8_t valid_lanes = static_cast<uint8_t>(word >> i);
+          for (int j = 0; j < kLanes; j++) {
+            const T value = (valid_lanes >> j) & 1 ? Map(block[i + j]) : first_;
+            mins_[j] = value < mins_[j] ? value : mins_[j];
+            maxs_[j] = maxs_[j] < value ? value : maxs_[j];
+          }
+        }
+      }
+    }
+  }
+
+  void Finish(T* out_min, T* out_max) const {
+    T min = mins_[0];
+    T max = maxs_[0];
+    for (int j = 1; j < kLanes; j++) {
+      min = mins_[j] < min ? mins_[j] : min;
+      max = max < maxs_[j] ? maxs_[j] : max;
+    }
+    *out_min = Map(min);
+    *out_max = Map(max);
+  }
+
+ private:
+  static constexpr int kLanes = 8;
+
+  static T Map(T value) {
+    return SignBitFlipper<T, !is_signed && std::is_integral<T>::value &&
+                                 !std::is_same<T, bool>::value>::Map(value);
+  }
+
+  T first_;
+  T mins_[kLanes];
+  T maxs_[kLanes];
+};
+
 template <bool is_signed, typename DType>
 class TypedComparatorImpl : virtual public TypedComparator<DType> {
  public:
@@ -163,44 +309,28 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
   bool Compare(const T& a, const T& b) override { return CompareInline(a, b); }
 
   void GetMinMax(const T* values, int64_t length, T* out_min, T* out_max) override {
-    T min = values[0];
-    T max = values[0];
-    for (int64_t i = 1; i < length; i++) {
-      if (CompareInline(values[i], min)) {
-        min = values[i];
-      } else if (CompareInline(max, values[i])) {
-        max = values[i];
-      }
-    }
+    MinMaxAccumulator<DType, is_signed> accumulator(type_length_, values[0]);
+    accumulator.Update(values + 1, length - 1);
+    T min, max;
+    accumulator.Finish(&min, &max);
     *out_min = CleanStatistic<T>(min);
     *out_max = CleanStatistic<T>(max);
   }
 
   void GetMinMaxSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
                        int64_t valid_bits_offset, T* out_min, T* out_max) override {
-    ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
-                                                      length);
-
     // Find the first non-null value
     int64_t first_non_null = 0;
-    while (!valid_bits_reader.IsSet()) {
+    while (!::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + first_non_null)) {
       ++first_non_null;
-      valid_bits_reader.Next();
     }
 
-    T min = values[first_non_null];
-    T max = values[first_non_null];
-    valid_bits_reader.Next();
-    for (int64_t i = first_non_null + 1; i < length; i++) {
-      if (valid_bits_reader.IsSet()) {
-        if (CompareInline(values[i], min)) {
-          min = values[i];
-        } else if (CompareInline(max, values[i])) {
-          max = values[i];
-        }
-      }
-      valid_bits_reader.Next();
-    }
+    MinMaxAccumulator<DType, is_signed> accumulator(type_length_,
+                                                    values[first_non_null]);
+    accumulator.UpdateSpaced(values + first_non_null, length - first_non_null,
+                             valid_bits, valid_bits_offset + first_non_null);
+    T min, max;
+    accumulator.Finish(&min, &max);
     *out_min = CleanStatistic<T>(min);
     *out_max = CleanStatistic<T>(max);
   }
@@ -224,41 +354,25 @@ void GetMinMaxBinaryHelper(
     const ::arrow::Array& values, ByteArray* out_min, ByteArray* out_max) {
   const auto& data = checked_cast<const ::arrow::BinaryArray&>(values);
 
+  // The extrema are views into the array: they are only copied by the
+  // statistics when they replace the current ones
   ByteArray min, max;
-  if (data.null_count() > 0) {
-    ::arrow::internal::BitmapReader valid_bits_reader(data.null_bitmap_data(),
-                                                      data.offset(), data.length());
-
-    int64_t first_non_null = 0;
-    while (!valid_bits_reader.IsSet()) {
-      ++first_non_null;
-      valid_bits_reader.Next();
-    }
-    min = data.GetView(first_non_null);
-    max = data.GetView(first_non_null);
-    for (int64_t i = first_non_null; i < data.length(); i++) {
-      ByteArray val = data.GetView(i);
-      if (valid_bits_reader.IsSet()) {
-        if (comparator.CompareInline(val, min)) {
-          min = val;
-        } else if (comparator.CompareInline(max, val)) {
-          max = val;
+  bool has_min_max = false;
+  ::arrow::internal::VisitSetBitRuns(
+      data.null_bitmap_data(), data.offset(), data.length(),
+      [&](int64_t position, int64_t run_length) {
+        for (int64_t i = position; i < position + run_length; i++) {
+          const ByteArray val = data.GetView(i);
+          if (!has_min_max) {
+            min = max = val;
+            has_min_max = true;
+          } else if (comparator.CompareInline(val, min)) {
+            min = val;
+          } else if (comparator.CompareInline(max, val)) {
+            max = val;
+          }
         }
-      }
-      valid_bits_reader.Next();
-    }
-  } else {
-    min = data.GetView(0);
-    max = data.GetView(0);
-    for (int64_t i = 0; i < data.length(); i++) {
-      ByteArray val = data.GetView(i);
-      if (comparator.CompareInline(val, min)) {
-        min = val;
-      } else if (comparator.CompareInline(max, val)) {
-        max = val;
-      }
-    }
-  }
+      });
   *out_min = min;
   *out_max = max;
 }
@@ -22,7 +22,10 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <random>
+#include <string>
 #include <vector>
 
 #include "arrow/testing/gtest_util.h"
@@ -246,6 +249,85 @@ TEST(Comparison, UnknownSortOrder) {
   ASSERT_THROW(Comparator::Make(&descr), ParquetException);
 }
 
+// Check GetMinMax() and GetMinMaxSpaced() against a comparison per value, on
+// lengths and validity bitmaps ending within and at the end of lanes and words
+template <typename DType>
+void CheckMinMax(Type::type physical_type, SortOrder::type sort_order,
+                 const std::vector<typename DType::c_type>& values) {
+  using T = typename DType::c_type;
+  auto comparator = std::static_pointer_cast<TypedComparator<DType>>(
+      Comparator::Make(physical_type, sort_order));
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> is_null(0, 3);
+
+  for (int64_t length : {1, 7, 8, 9, 63, 64, 65, 200}) {
+    ASSERT_LE(length, static_cast<int64_t>(values.size()));
+    T min, max;
+    comparator->GetMinMax(values.data(), length, &min, &max);
+    T expected_min = values[0], expected_max = values[0];
+    for (int64_t i = 0; i < length; i++) {
+      if (comparator->Compare(values[i], expected_min)) expected_min = values[i];
+      if (comparator->Compare(expected_max, values[i])) expected_max = values[i];
+    }
+    ASSERT_EQ(expected_min, min);
+    ASSERT_EQ(expected_max, max);
+
+    const int64_t offset = 5;
+    std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(offset + length), 0);
+    bool has_valid = false;
+    for (int64_t i = 0; i < length; i++) {
+      // Some nulls, and a run of valid values spanning a whole word
+      if (i == 0 || i == length - 1 || (i >= 64 && i < 128) || is_null(gen) != 0) {
+        BitUtil::SetBit(valid_bits.data(), offset + i);
+        if (!has_valid || comparator->Compare(values[i], expected_min)) {
+          expected_min = values[i];
+        }
+        if (!has_valid || comparator->Compare(expected_max, values[i])) {
+          expected_max = values[i];
+        }
+        has_valid = true;
+      }
+    }
+    comparator->GetMinMaxSpaced(values.data(), length, valid_bits.data(), offset, &min,
+                                &max);
+    ASSERT_EQ(expected_min, min);
+    ASSERT_EQ(expected_max, max);
+  }
+}
+
+TEST(Comparison, MinMax) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> dist(std::numeric_limits<int64_t>::min(),
+                                              std::numeric_limits<int64_t>::max());
+  std::vector<int32_t> int32_values(200);
+  std::vector<int64_t> int64_values(200);
+  std::vector<double> double_values(200);
+  for (size_t i = 0; i < 200; i++) {
+    int64_values[i] = dist(gen);
+    int32_values[i] = static_cast<int32_t>(int64_values[i] >> 32);
+    double_values[i] = static_cast<double>(int32_values[i]) / 7;
+  }
+  // The extrema in the middle of lanes, NaNs skipped
+  double_values[1] = std::nan("");
+  double_values[100] = std::nan("");
+
+  CheckMinMax<Int32Type>(Type::INT32, SortOrder::SIGNED, int32_values);
+  CheckMinMax<Int32Type>(Type::INT32, SortOrder::UNSIGNED, int32_values);
+  CheckMinMax<Int64Type>(Type::INT64, SortOrder::SIGNED, int64_values);
+  CheckMinMax<Int64Type>(Type::INT64, SortOrder::UNSIGNED, int64_values);
+  CheckMinMax<DoubleType>(Type::DOUBLE, SortOrder::SIGNED, double_values);
+
+  std::vector<std::string> strings(200);
+  std::vector<ByteArray> byte_array_values(200);
+  for (size_t i = 0; i < 200; i++) {
+    strings[i].resize(static_cast<size_t>(dist(gen) & 7));
+    for (auto& c : strings[i]) c = static_cast<char>(dist(gen));
+    byte_array_values[i] = ByteArrayFromString(strings[i]);
+  }
+  CheckMinMax<ByteArrayType>(Type::BYTE_ARRAY, SortOrder::SIGNED, byte_array_values);
+  CheckMinMax<ByteArrayType>(Type::BYTE_ARRAY, SortOrder::UNSIGNED, byte_array_values);
+}
+
 // ----------------------------------------------------------------------
 
 template <typename TestType>
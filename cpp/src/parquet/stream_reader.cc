@@ -17,6 +17,7 @@
 
 #include "parquet/stream_reader.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace parquet {
@@ -52,6 +53,14 @@ int64_t StreamReader::num_rows() const {
   return 0;
 }
 
+void StreamReader::SetBatchSize(int64_t batch_size) {
+  if (batch_size < 1) {
+    throw ParquetException("Batch size must be positive, not " +
+                           std::to_string(batch_size));
+  }
+  batch_size_ = batch_size;
+}
+
 StreamReader& StreamReader::operator>>(bool& v) {
   CheckColumn(Type::BOOLEAN, ConvertedType::NONE);
   Read<BoolReader>(&v);
@@ -165,30 +174,9 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
   std::memcpy(ptr, flba.ptr, len);
 }
 
-void StreamReader::Read(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int64_t values_read;
-
-  reader->ReadBatch(1, nullptr, nullptr, v, &values_read);
-
-  if (values_read != 1) {
-    throw ParquetException("Failed to read value for column '" + node->name() + "'");
-  }
-}
-
-void StreamReader::Read(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int64_t values_read;
-
-  reader->ReadBatch(1, nullptr, nullptr, v, &values_read);
+void StreamReader::Read(ByteArray* v) { Read<ByteArrayReader>(v); }
 
-  if (values_read != 1) {
-    throw ParquetException("Failed to read value for column '" + node->name() + "'");
-  }
-}
+void StreamReader::Read(FixedLenByteArray* v) { Read<FixedLenByteArrayReader>(v); }
 
 void StreamReader::EndRow() {
   if (!file_reader_) {
@@ -201,7 +189,8 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  const auto& buffer = column_buffers_[0];
+  if (buffer.position == buffer.num_values && !column_readers_[0]->HasNext()) {
     NextRowGroup();
   }
 }
@@ -213,6 +202,8 @@ void StreamReader::NextRowGroup() {
     ++row_group_index_;
 
     column_readers_.resize(file_metadata_->num_columns());
+    column_buffers_.clear();
+    column_buffers_.resize(file_metadata_->num_columns());
 
     for (int i = 0; i < file_metadata_->num_columns(); ++i) {
       column_readers_[i] = row_group_reader_->Column(i);
@@ -233,6 +224,7 @@ void StreamReader::SetEof() {
   file_reader_.reset();
   row_group_reader_.reset();
   column_readers_.clear();
+  column_buffers_.clear();
   nodes_.clear();
 }
 
@@ -248,8 +240,8 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
         num_rows_in_row_group - current_row_ - row_group_row_offset_;
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (int i = 0; i < static_cast<int>(column_readers_.size()); ++i) {
+        SkipRowsInColumn(i, num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -269,14 +261,26 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
+void StreamReader::SkipRowsInColumn(int column_index, int64_t num_rows_to_skip) {
+  // Skip the values read ahead first
+  auto& buffer = column_buffers_[column_index];
+  const int64_t num_buffered_skipped =
+      std::min(buffer.num_values - buffer.position, num_rows_to_skip);
+
+  buffer.position += num_buffered_skipped;
+  num_rows_to_skip -= num_buffered_skipped;
+  if (num_rows_to_skip == 0) {
+    return;
+  }
+
+  ColumnReader* reader = column_readers_[column_index].get();
   int64_t num_skipped = 0;
 
   switch (reader->type()) {
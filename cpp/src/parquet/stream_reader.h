@@ -64,6 +64,13 @@ class PARQUET_EXPORT StreamReader {
 
   int64_t num_rows() const;
 
+  /// \brief Set the maximum number of values read ahead from each
+  /// column.
+  /// Values are read with a call per column and batch of rows rather
+  /// than per value. A batch size of 1 reads each value when it is
+  /// extracted.
+  void SetBatchSize(int64_t batch_size);
+
   // Moving is possible.
   StreamReader(StreamReader&&) = default;
   StreamReader& operator=(StreamReader&&) = default;
@@ -142,16 +149,29 @@ class PARQUET_EXPORT StreamReader {
  protected:
   template <typename ReaderType, typename T>
   void Read(T* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-
-    int64_t values_read;
-
-    reader->ReadBatch(1, NULLPTR, NULLPTR, v, &values_read);
-
-    if (values_read != 1) {
-      throw ParquetException("Failed to read value for column '" + node->name() + "'");
+    auto& buffer = column_buffers_[column_index_];
+
+    if (buffer.position == buffer.num_values) {
+      const auto& node = nodes_[column_index_];
+      auto reader = static_cast<ReaderType*>(column_readers_[column_index_].get());
+      int64_t values_read;
+
+      // Byte array values point into the decoded page, which stays valid
+      // until the next batch is read.
+      buffer.values.resize(batch_size_ * sizeof(T));
+      reader->ReadBatch(batch_size_, NULLPTR, NULLPTR,
+                        reinterpret_cast<T*>(buffer.values.data()), &values_read);
+      buffer.position = 0;
+      buffer.num_values = values_read;
+
+      if (values_read < 1) {
+        throw ParquetException("Failed to read value for column '" + node->name() +
+                               "'");
+      }
     }
+    std::memcpy(v, buffer.values.data() + buffer.position * sizeof(T), sizeof(T));
+    ++buffer.position;
+    ++column_index_;
   }
 
   void ReadFixedLength(char* ptr, int len);
@@ -165,17 +185,25 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int column_index, int64_t num_rows_to_skip);
 
   void SetEof();
 
  private:
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
 
+  // The values of a column read ahead of the current row.
+  struct ColumnBuffer {
+    std::vector<uint8_t> values;
+    int64_t num_values{0};
+    int64_t position{0};
+  };
+
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
+  std::vector<ColumnBuffer> column_buffers_;
   std::vector<node_ptr_type> nodes_;
 
   bool eof_{true};
@@ -183,6 +211,7 @@ class PARQUET_EXPORT StreamReader {
   int column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
+  int64_t batch_size_{1024};
 };
 
 PARQUET_EXPORT
@@ -460,5 +460,54 @@ TEST_F(TestStreamReader, SkipColumns) {
   ASSERT_EQ(0, reader_.SkipColumns(100));
 }
 
+TEST_F(TestStreamReader, SmallBatchSize) {
+  ASSERT_THROW(reader_.SetBatchSize(0), ParquetException);
+  reader_.SetBatchSize(7);
+
+  bool b;
+  std::string s;
+  std::array<char, 4> char_array;
+  char c;
+  int8_t int8;
+  uint16_t uint16;
+  int32_t int32;
+  uint64_t uint64;
+  std::chrono::microseconds ts_us;
+  float f;
+  double d;
+
+  // Values come out of batches of 7, with skipped rows and columns
+  // crossing batch boundaries.
+  for (int i = 0; !reader_.eof(); ++i) {
+    if (i % 10 == 9 && i + 5 <= TestData::num_rows) {
+      ASSERT_EQ(5, reader_.SkipRows(5));
+      i += 4;
+      continue;
+    }
+    ASSERT_EQ(i, reader_.current_row());
+    reader_ >> b;
+    if (i % 3 == 0) {
+      ASSERT_EQ(1, reader_.SkipColumns(1));
+    } else {
+      reader_ >> s;
+      ASSERT_EQ(s, TestData::GetString(i));
+    }
+    reader_ >> c >> char_array >> int8 >> uint16 >> int32 >> uint64 >> ts_us >> f >> d;
+    reader_ >> EndRow;
+
+    ASSERT_EQ(b, TestData::GetBool(i));
+    ASSERT_EQ(c, TestData::GetChar(i));
+    ASSERT_EQ(char_array, TestData::GetCharArray(i));
+    ASSERT_EQ(int8, TestData::GetInt8(i));
+    ASSERT_EQ(uint16, TestData::GetUInt16(i));
+    ASSERT_EQ(int32, TestData::GetInt32(i));
+    ASSERT_EQ(uint64, TestData::GetUInt64(i));
+    ASSERT_EQ(ts_us, TestData::GetChronoMicroseconds(i));
+    ASSERT_FLOAT_EQ(f, TestData::GetFloat(i));
+    ASSERT_DOUBLE_EQ(d, TestData::GetDouble(i));
+  }
+  ASSERT_EQ(TestData::num_rows, reader_.current_row());
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -0,0 +1,199 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/io/memory.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/platform.h"
+#include "parquet/stream_reader.h"
+#include "parquet/stream_writer.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::NodeVector;
+using schema::PrimitiveNode;
+
+namespace benchmark {
+
+// Rows of (int32, double, string), written and read either a row at a time
+// through StreamWriter/StreamReader or a column at a time through the
+// typed column writers and readers.
+
+constexpr int kNumRows = 1 << 16;
+
+struct Rows {
+  explicit Rows(int64_t num_rows) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+      ints.push_back(static_cast<int32_t>(i * 7));
+      doubles.push_back(static_cast<double>(i) / 3);
+      strings.push_back("string-" + std::to_string(i % 1000));
+    }
+    for (const auto& s : strings) {
+      byte_arrays.emplace_back(static_cast<uint32_t>(s.size()),
+                               reinterpret_cast<const uint8_t*>(s.data()));
+    }
+  }
+
+  std::vector<int32_t> ints;
+  std::vector<double> doubles;
+  std::vector<std::string> strings;
+  std::vector<ByteArray> byte_arrays;
+};
+
+std::shared_ptr<GroupNode> RowSchema() {
+  NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("int32", Repetition::REQUIRED, Type::INT32,
+                                       ConvertedType::INT_32));
+  fields.push_back(PrimitiveNode::Make("double", Repetition::REQUIRED, Type::DOUBLE,
+                                       ConvertedType::NONE));
+  fields.push_back(PrimitiveNode::Make("string", Repetition::REQUIRED,
+                                       Type::BYTE_ARRAY, ConvertedType::UTF8));
+  return std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+}
+
+std::unique_ptr<ParquetFileWriter> OpenWriter(
+    const std::shared_ptr<ArrowOutputStream>& sink) {
+  return ParquetFileWriter::Open(sink, RowSchema(),
+                                 WriterProperties::Builder().build());
+}
+
+void StreamWrite(const Rows& rows, int64_t batch_size,
+                 const std::shared_ptr<ArrowOutputStream>& sink) {
+  StreamWriter os{OpenWriter(sink)};
+  os.SetBatchSize(batch_size);
+  for (size_t i = 0; i < rows.ints.size(); ++i) {
+    os << rows.ints[i] << rows.doubles[i] << rows.strings[i] << EndRow;
+  }
+}
+
+void ColumnWrite(const Rows& rows, const std::shared_ptr<ArrowOutputStream>& sink) {
+  auto file_writer = OpenWriter(sink);
+  auto row_group_writer = file_writer->AppendRowGroup();
+  const auto num_rows = static_cast<int64_t>(rows.ints.size());
+  static_cast<Int32Writer*>(row_group_writer->NextColumn())
+      ->WriteBatch(num_rows, nullptr, nullptr, rows.ints.data());
+  static_cast<DoubleWriter*>(row_group_writer->NextColumn())
+      ->WriteBatch(num_rows, nullptr, nullptr, rows.doubles.data());
+  static_cast<ByteArrayWriter*>(row_group_writer->NextColumn())
+      ->WriteBatch(num_rows, nullptr, nullptr, rows.byte_arrays.data());
+  file_writer->Close();
+}
+
+std::shared_ptr<Buffer> WriteFile(const Rows& rows) {
+  auto sink = CreateOutputStream();
+  ColumnWrite(rows, sink);
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+void SetRowsProcessed(::benchmark::State& state, const Rows& rows) {
+  int64_t row_bytes = sizeof(int32_t) + sizeof(double);
+  for (const auto& s : rows.strings) {
+    row_bytes += static_cast<int64_t>(s.size());
+  }
+  state.SetItemsProcessed(state.iterations() * rows.ints.size());
+  state.SetBytesProcessed(state.iterations() * row_bytes);
+}
+
+static void BM_StreamWriter(::benchmark::State& state) {
+  Rows rows(kNumRows);
+  for (auto _ : state) {
+    StreamWrite(rows, state.range(0), CreateOutputStream());
+  }
+  SetRowsProcessed(state, rows);
+}
+
+static void BM_ColumnWriter(::benchmark::State& state) {
+  Rows rows(kNumRows);
+  for (auto _ : state) {
+    ColumnWrite(rows, CreateOutputStream());
+  }
+  SetRowsProcessed(state, rows);
+}
+
+static void BM_StreamReader(::benchmark::State& state) {
+  Rows rows(kNumRows);
+  auto buffer = WriteFile(rows);
+  int32_t int_value;
+  double double_value;
+  std::string string_value;
+  for (auto _ : state) {
+    StreamReader is{ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer))};
+    is.SetBatchSize(state.range(0));
+    while (!is.eof()) {
+      is >> int_value >> double_value >> string_value >> EndRow;
+    }
+    ::benchmark::DoNotOptimize(string_value);
+  }
+  SetRowsProcessed(state, rows);
+}
+
+template <typename ReaderType, typename T>
+void ReadColumn(ColumnReader* reader, int64_t batch_size, std::vector<T>* values) {
+  auto typed_reader = static_cast<ReaderType*>(reader);
+  int64_t values_read = 0;
+  while (typed_reader->HasNext()) {
+    typed_reader->ReadBatch(batch_size, nullptr, nullptr, values->data(), &values_read);
+  }
+  ::benchmark::DoNotOptimize(values_read);
+}
+
+static void BM_ColumnReader(::benchmark::State& state) {
+  Rows rows(kNumRows);
+  auto buffer = WriteFile(rows);
+  const int64_t batch_size = 1024;
+  std::vector<int32_t> ints(batch_size);
+  std::vector<double> doubles(batch_size);
+  std::vector<ByteArray> byte_arrays(batch_size);
+  for (auto _ : state) {
+    auto file_reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    for (int i = 0; i < file_reader->metadata()->num_row_groups(); ++i) {
+      auto row_group_reader = file_reader->RowGroup(i);
+      ReadColumn<Int32Reader>(row_group_reader->Column(0).get(), batch_size, &ints);
+      ReadColumn<DoubleReader>(row_group_reader->Column(1).get(), batch_size,
+                               &doubles);
+      ReadColumn<ByteArrayReader>(row_group_reader->Column(2).get(), batch_size,
+                                  &byte_arrays);
+    }
+  }
+  SetRowsProcessed(state, rows);
+}
+
+// Batch size 1 is how the stream API behaved before it buffered rows
+BENCHMARK(BM_StreamWriter)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_ColumnWriter);
+BENCHMARK(BM_StreamReader)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_ColumnReader);
+
+}  // namespace benchmark
+
+}  // namespace parquet
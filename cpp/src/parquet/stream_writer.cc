@@ -22,6 +22,7 @@
 namespace parquet {
 
 int64_t StreamWriter::default_row_group_size_{512 * 1024 * 1024};  // 512MB
+constexpr int64_t StreamWriter::default_batch_size_;
 
 StreamWriter::FixedStringView::FixedStringView(const char* data_ptr)
     : data{data_ptr}, size{std::strlen(data_ptr)} {}
@@ -36,6 +37,7 @@ StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
   auto group_node = schema->group_node();
 
   nodes_.resize(schema->num_columns());
+  column_buffers_.resize(schema->num_columns());
 
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
@@ -44,6 +46,7 @@ StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
 
 StreamWriter::~StreamWriter() {
   if (row_group_writer_) {
+    FlushBatch();
     row_group_writer_->Close();
   }
 
@@ -52,6 +55,26 @@ StreamWriter::~StreamWriter() {
   }
 }
 
+StreamWriter& StreamWriter::operator=(StreamWriter&& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if (row_group_writer_) {
+    FlushBatch();
+  }
+  row_group_size_ = other.row_group_size_;
+  max_row_group_size_ = other.max_row_group_size_;
+  column_index_ = other.column_index_;
+  batch_size_ = other.batch_size_;
+  num_buffered_rows_ = other.num_buffered_rows_;
+  buffered_bytes_ = other.buffered_bytes_;
+  column_buffers_ = std::move(other.column_buffers_);
+  file_writer_ = std::move(other.file_writer_);
+  row_group_writer_ = std::move(other.row_group_writer_);
+  nodes_ = std::move(other.nodes_);
+  return *this;
+}
+
 void StreamWriter::SetDefaultMaxRowGroupSize(int64_t max_size) {
   default_row_group_size_ = max_size;
 }
@@ -60,69 +83,77 @@ void StreamWriter::SetMaxRowGroupSize(int64_t max_size) {
   max_row_group_size_ = max_size;
 }
 
+void StreamWriter::SetBatchSize(int64_t batch_size) {
+  if (batch_size < 1) {
+    throw ParquetException("Batch size must be positive, not " +
+                           std::to_string(batch_size));
+  }
+  batch_size_ = batch_size;
+}
+
 StreamWriter& StreamWriter::operator<<(bool v) {
   CheckColumn(Type::BOOLEAN, ConvertedType::NONE);
-  return Write<BoolWriter>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(int8_t v) {
   CheckColumn(Type::INT32, ConvertedType::INT_8);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(uint8_t v) {
   CheckColumn(Type::INT32, ConvertedType::UINT_8);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(int16_t v) {
   CheckColumn(Type::INT32, ConvertedType::INT_16);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(uint16_t v) {
   CheckColumn(Type::INT32, ConvertedType::UINT_16);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(int32_t v) {
   CheckColumn(Type::INT32, ConvertedType::INT_32);
-  return Write<Int32Writer>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(uint32_t v) {
   CheckColumn(Type::INT32, ConvertedType::UINT_32);
-  return Write<Int32Writer>(static_cast<int32_t>(v));
+  return Write(static_cast<int32_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(int64_t v) {
   CheckColumn(Type::INT64, ConvertedType::INT_64);
-  return Write<Int64Writer>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(uint64_t v) {
   CheckColumn(Type::INT64, ConvertedType::UINT_64);
-  return Write<Int64Writer>(static_cast<int64_t>(v));
+  return Write(static_cast<int64_t>(v));
 }
 
 StreamWriter& StreamWriter::operator<<(const std::chrono::milliseconds& v) {
   CheckColumn(Type::INT64, ConvertedType::TIMESTAMP_MILLIS);
-  return Write<Int64Writer>(v.count());
+  return Write(v.count());
 }
 
 StreamWriter& StreamWriter::operator<<(const std::chrono::microseconds& v) {
   CheckColumn(Type::INT64, ConvertedType::TIMESTAMP_MICROS);
-  return Write<Int64Writer>(v.count());
+  return Write(v.count());
 }
 
 StreamWriter& StreamWriter::operator<<(float v) {
   CheckColumn(Type::FLOAT, ConvertedType::NONE);
-  return Write<FloatWriter>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(double v) {
   CheckColumn(Type::DOUBLE, ConvertedType::NONE);
-  return Write<DoubleWriter>(v);
+  return Write(v);
 }
 
 StreamWriter& StreamWriter::operator<<(char v) { return WriteFixedLength(&v, 1); }
@@ -143,18 +174,11 @@ StreamWriter& StreamWriter::WriteVariableLength(const char* data_ptr,
                                                 std::size_t data_len) {
   CheckColumn(Type::BYTE_ARRAY, ConvertedType::UTF8);
 
-  auto writer = static_cast<ByteArrayWriter*>(row_group_writer_->column(column_index_++));
+  auto& buffer = column_buffers_[column_index_++];
 
-  ByteArray ba_value;
-
-  ba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-  ba_value.len = static_cast<uint32_t>(data_len);
-
-  writer->WriteBatch(1, nullptr, nullptr, &ba_value);
-
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
-  }
+  buffer.values.insert(buffer.values.end(), data_ptr, data_ptr + data_len);
+  buffer.lengths.push_back(static_cast<uint32_t>(data_len));
+  buffered_bytes_ += sizeof(uint32_t) + data_len;
   return *this;
 }
 
@@ -162,19 +186,100 @@ StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t d
   CheckColumn(Type::FIXED_LEN_BYTE_ARRAY, ConvertedType::NONE,
               static_cast<int>(data_len));
 
-  auto writer =
-      static_cast<FixedLenByteArrayWriter*>(row_group_writer_->column(column_index_++));
+  auto& buffer = column_buffers_[column_index_++];
 
-  FixedLenByteArray flba_value;
+  buffer.values.insert(buffer.values.end(), data_ptr, data_ptr + data_len);
+  buffered_bytes_ += data_len;
+  return *this;
+}
 
-  flba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
+namespace {
 
-  writer->WriteBatch(1, nullptr, nullptr, &flba_value);
+template <typename WriterType>
+void WriteBuffer(ColumnWriter* column_writer, const std::vector<uint8_t>& values) {
+  using T = typename WriterType::T;
+  const auto num_values = static_cast<int64_t>(values.size() / sizeof(T));
+
+  if (num_values > 0) {
+    static_cast<WriterType*>(column_writer)
+        ->WriteBatch(num_values, nullptr, nullptr,
+                     reinterpret_cast<const T*>(values.data()));
+  }
+}
+
+}  // namespace
+
+void StreamWriter::FlushBatch() {
+  for (std::size_t i = 0; i < column_buffers_.size(); ++i) {
+    auto& buffer = column_buffers_[i];
+    auto column_writer = row_group_writer_->column(static_cast<int>(i));
+
+    switch (nodes_[i]->physical_type()) {
+      case Type::BOOLEAN:
+        WriteBuffer<BoolWriter>(column_writer, buffer.values);
+        break;
+      case Type::INT32:
+        WriteBuffer<Int32Writer>(column_writer, buffer.values);
+        break;
+      case Type::INT64:
+        WriteBuffer<Int64Writer>(column_writer, buffer.values);
+        break;
+      case Type::FLOAT:
+        WriteBuffer<FloatWriter>(column_writer, buffer.values);
+        break;
+      case Type::DOUBLE:
+        WriteBuffer<DoubleWriter>(column_writer, buffer.values);
+        break;
+      case Type::BYTE_ARRAY: {
+        std::vector<ByteArray> values(buffer.lengths.size());
+        const uint8_t* data = buffer.values.data();
+
+        for (std::size_t j = 0; j < values.size(); ++j) {
+          values[j] = ByteArray(buffer.lengths[j], data);
+          data += buffer.lengths[j];
+        }
+        if (!values.empty()) {
+          static_cast<ByteArrayWriter*>(column_writer)
+              ->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                           values.data());
+        }
+        break;
+      }
+      case Type::FIXED_LEN_BYTE_ARRAY: {
+        const auto length = static_cast<std::size_t>(nodes_[i]->type_length());
+        std::vector<FixedLenByteArray> values(length > 0 ? buffer.values.size() / length
+                                                         : 0);
+
+        for (std::size_t j = 0; j < values.size(); ++j) {
+          values[j] = FixedLenByteArray(buffer.values.data() + j * length);
+        }
+        if (!values.empty()) {
+          static_cast<FixedLenByteArrayWriter*>(column_writer)
+              ->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                           values.data());
+        }
+        break;
+      }
+      default:
+        throw ParquetException("Unexpected type: " +
+                               TypeToString(nodes_[i]->physical_type()));
+    }
+    buffer.values.clear();
+    buffer.lengths.clear();
+  }
+  num_buffered_rows_ = 0;
+  buffered_bytes_ = 0;
 
   if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
+    // Size already written (compressed + uncompressed) and buffered by
+    // the column writers.
+    //
+    row_group_size_ = row_group_writer_->total_bytes_written() +
+                      row_group_writer_->total_compressed_bytes();
+    for (int i = 0; i < row_group_writer_->num_columns(); ++i) {
+      row_group_size_ += row_group_writer_->column(i)->estimated_buffered_bytes();
+    }
   }
-  return *this;
 }
 
 void StreamWriter::CheckColumn(Type::type physical_type,
@@ -217,16 +322,13 @@ void StreamWriter::EndRow() {
                            " of " + std::to_string(nodes_.size()) + " columns written");
   }
   column_index_ = 0;
+  ++num_buffered_rows_;
 
-  if (max_row_group_size_ > 0) {
-    if (row_group_size_ > max_row_group_size_) {
-      EndRowGroup();
-    }
-    // Initialize for each row with size already written
-    // (compressed + uncompressed).
-    //
-    row_group_size_ = row_group_writer_->total_bytes_written() +
-                      row_group_writer_->total_compressed_bytes();
+  if (max_row_group_size_ > 0 &&
+      row_group_size_ + buffered_bytes_ > max_row_group_size_) {
+    EndRowGroup();
+  } else if (num_buffered_rows_ >= batch_size_) {
+    FlushBatch();
   }
 }
 
@@ -234,10 +336,13 @@ void StreamWriter::EndRowGroup() {
   if (!file_writer_) {
     throw ParquetException("StreamWriter not initialized");
   }
+  FlushBatch();
+
   // Avoid creating empty row groups.
   if (row_group_writer_->num_rows() > 0) {
     row_group_writer_->Close();
     row_group_writer_.reset(file_writer_->AppendBufferedRowGroup());
+    row_group_size_ = 0;
   }
 }
 
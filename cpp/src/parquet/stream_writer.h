@@ -62,9 +62,17 @@ class PARQUET_EXPORT StreamWriter {
 
   void SetMaxRowGroupSize(int64_t max_size);
 
-  // Moving is possible.
+  /// \brief Set the number of rows buffered before they are written to the
+  /// column writers.
+  /// Values are written with a call per column and batch of rows
+  /// rather than per value. A batch size of 1 writes each row as
+  /// soon as it ends.
+  void SetBatchSize(int64_t batch_size);
+
+  // Moving is possible.  Assigning to a writer flushes its buffered
+  // rows first.
   StreamWriter(StreamWriter&&) = default;
-  StreamWriter& operator=(StreamWriter&&) = default;
+  StreamWriter& operator=(StreamWriter&&);
 
   // Copying is not allowed.
   StreamWriter(const StreamWriter&) = delete;
@@ -134,15 +142,13 @@ class PARQUET_EXPORT StreamWriter {
   void EndRowGroup();
 
  protected:
-  template <typename WriterType, typename T>
+  template <typename T>
   StreamWriter& Write(const T v) {
-    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_++));
+    auto& buffer = column_buffers_[column_index_++];
+    const auto bytes = reinterpret_cast<const uint8_t*>(&v);
 
-    writer->WriteBatch(1, NULLPTR, NULLPTR, &v);
-
-    if (max_row_group_size_ > 0) {
-      row_group_size_ += writer->EstimatedBufferedValueBytes();
-    }
+    buffer.values.insert(buffer.values.end(), bytes, bytes + sizeof(T));
+    buffered_bytes_ += sizeof(T);
     return *this;
   }
 
@@ -153,6 +159,9 @@ class PARQUET_EXPORT StreamWriter {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = -1);
 
+  // Write the buffered values to the column writers.
+  void FlushBatch();
+
  private:
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
 
@@ -160,14 +169,27 @@ class PARQUET_EXPORT StreamWriter {
     void operator()(void*) {}
   };
 
+  // The values of a column not written to its column writer yet.
+  // Fixed width values are stored as is, variable length strings as
+  // their concatenated bytes and lengths.
+  struct ColumnBuffer {
+    std::vector<uint8_t> values;
+    std::vector<uint32_t> lengths;
+  };
+
   int64_t row_group_size_{0};
   int64_t max_row_group_size_{default_row_group_size_};
   int32_t column_index_{0};
+  int64_t batch_size_{default_batch_size_};
+  int64_t num_buffered_rows_{0};
+  int64_t buffered_bytes_{0};
+  std::vector<ColumnBuffer> column_buffers_;
   std::unique_ptr<ParquetFileWriter> file_writer_;
   std::unique_ptr<RowGroupWriter, null_deleter> row_group_writer_;
   std::vector<node_ptr_type> nodes_;
 
   static int64_t default_row_group_size_;
+  static constexpr int64_t default_batch_size_ = 1024;
 };
 
 struct PARQUET_EXPORT EndRowType {};
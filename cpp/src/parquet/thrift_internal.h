@@ -27,7 +27,9 @@
 #else
 #include <memory>
 #endif
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 // TCompactProtocol requires some #defines to work right.
@@ -254,6 +256,77 @@ inline void DeserializeThriftUnencryptedMsg(const uint8_t* buf, uint32_t* len,
   *len = *len - bytes_left;
 }
 
+// Deserialize a FileMetaData footer from buf/len except for its row groups,
+// which are left default-constructed. The offsets in buf of the begin and end
+// of each serialized row group are appended to row_group_ranges, so that they
+// can be deserialized on demand as format::RowGroup messages. On return, len
+// will be set to the actual length of the footer.
+inline void DeserializeFileMetaDataWithoutRowGroups(
+    const uint8_t* buf, uint32_t* len, format::FileMetaData* metadata,
+    std::vector<std::pair<uint32_t, uint32_t>>* row_group_ranges) {
+  using apache::thrift::protocol::TType;
+  // The field id of FileMetaData.row_groups in parquet.thrift
+  constexpr int16_t kRowGroupsFieldId = 4;
+
+  shared_ptr<ThriftBuffer> tmem_transport(
+      new ThriftBuffer(const_cast<uint8_t*>(buf), *len));
+  apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
+  shared_ptr<apache::thrift::protocol::TProtocol> tproto =  //
+      tproto_factory.getProtocol(tmem_transport);
+  auto Position = [&]() { return *len - tmem_transport->available_read(); };
+
+  // Skip over the row groups, remembering where each one is
+  uint32_t list_begin = 0;
+  uint32_t list_end = 0;
+  try {
+    std::string name;
+    TType field_type;
+    int16_t field_id;
+    tproto->readStructBegin(name);
+    while (true) {
+      tproto->readFieldBegin(name, field_type, field_id);
+      if (field_type == apache::thrift::protocol::T_STOP) {
+        break;
+      }
+      if (field_id == kRowGroupsFieldId && field_type == apache::thrift::protocol::T_LIST) {
+        list_begin = Position();
+        TType element_type;
+        uint32_t num_row_groups;
+        tproto->readListBegin(element_type, num_row_groups);
+        for (uint32_t i = 0; i < num_row_groups; ++i) {
+          const uint32_t row_group_begin = Position();
+          tproto->skip(apache::thrift::protocol::T_STRUCT);
+          row_group_ranges->emplace_back(row_group_begin, Position());
+        }
+        tproto->readListEnd();
+        list_end = Position();
+      } else {
+        tproto->skip(field_type);
+      }
+      tproto->readFieldEnd();
+    }
+    tproto->readStructEnd();
+  } catch (std::exception& e) {
+    std::stringstream ss;
+    ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+    throw ParquetException(ss.str());
+  }
+  *len = Position();
+
+  // Deserialize everything else from a copy of the footer where the list of
+  // row groups is replaced by an empty list of structs, whose compact
+  // protocol header is a single byte: size 0 in the high and the element
+  // type in the low nibble
+  std::vector<uint8_t> stripped(buf, buf + list_begin);
+  if (list_end > list_begin) {
+    static constexpr uint8_t kEmptyStructListHeader = 0x0C;
+    stripped.push_back(kEmptyStructListHeader);
+  }
+  stripped.insert(stripped.end(), buf + std::max(list_begin, list_end), buf + *len);
+  uint32_t stripped_len = static_cast<uint32_t>(stripped.size());
+  DeserializeThriftUnencryptedMsg(stripped.data(), &stripped_len, metadata);
+}
+
 // Deserialize a thrift message from buf/len.  buf/len must at least contain
 // all the bytes needed to store the thrift message.  On return, len will be
 // set to the actual length of the header.
@@ -31,6 +31,9 @@
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #include <sys/types.h>
 #include <sys/un.h>
 #include <time.h>
@@ -38,6 +41,8 @@
 
 #include <algorithm>
 #include <deque>
+#include <iterator>
+#include <list>
 #include <mutex>
 #include <tuple>
 #include <unordered_map>
@@ -224,6 +229,10 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  Status SetReleaseCacheCapacity(int64_t num_bytes);
+
+  Status SetNumaNode(int numa_node);
+
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
 
@@ -250,12 +259,16 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Seal(const ObjectID& object_id);
 
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
 
   Status Refresh(const std::vector<ObjectID>& object_ids);
 
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status Hash(const ObjectID& object_id, uint8_t* digest);
 
   Status Subscribe(int* fd);
@@ -290,6 +303,20 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Send release requests for the least recently released objects in the
+  /// release cache until the cache holds at most num_bytes.
+  ///
+  /// \param num_bytes The number of bytes the cache may still hold.
+  /// \return The return status.
+  Status ShrinkReleaseCache(int64_t num_bytes);
+
+  /// Remove an object from the release cache and send its release request to
+  /// the store. This is a no-op if the object is not cached.
+  ///
+  /// \param object_id The ID of the object to drop.
+  /// \return The return status.
+  Status DropFromReleaseCache(const ObjectID& object_id);
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -325,6 +352,21 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// information to make sure that it does not delay in releasing so much
   /// memory that the store is unable to evict enough objects to free up space.
   int64_t store_capacity_;
+  /// Sealed objects that this client has released but still holds a store
+  /// reference to, so that a later Get can be answered without an IPC.
+  struct ReleaseCacheEntry {
+    PlasmaObject object;
+    std::list<ObjectID>::iterator lru_position;
+  };
+  std::unordered_map<ObjectID, ReleaseCacheEntry> release_cache_;
+  /// Object IDs in the release cache, least recently released first.
+  std::list<ObjectID> release_cache_lru_;
+  /// Total size of the objects in the release cache.
+  int64_t release_cache_bytes_;
+  /// Maximum total size of the objects in the release cache.
+  int64_t release_cache_capacity_;
+  /// NUMA node to create objects on, -1 or kLocalNumaNode.
+  int numa_node_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
   /// A queue of notification
@@ -340,7 +382,23 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {
+// Return the NUMA node of the CPU the calling thread runs on, or -1 if unknown.
+static int GetCurrentNumaNode() {
+#ifdef __linux__
+  unsigned cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+PlasmaClient::Impl::Impl()
+    : store_conn_(0),
+      store_capacity_(0),
+      release_cache_bytes_(0),
+      release_cache_capacity_(0),
+      numa_node_(-1) {
 #ifdef PLASMA_CUDA
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
@@ -420,16 +478,24 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
 
   ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
-  RETURN_NOT_OK(
-      SendCreateRequest(store_conn_, object_id, data_size, metadata_size, device_num));
+  int numa_node = numa_node_ == kLocalNumaNode ? GetCurrentNumaNode() : numa_node_;
+  RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, data_size, metadata_size,
+                                  device_num, numa_node));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateReply, &buffer));
   ObjectID id;
   PlasmaObject object;
   int store_fd;
   int64_t mmap_size;
-  RETURN_NOT_OK(
-      ReadCreateReply(buffer.data(), buffer.size(), &id, &object, &store_fd, &mmap_size));
+  Status s =
+      ReadCreateReply(buffer.data(), buffer.size(), &id, &object, &store_fd, &mmap_size);
+  if (IsPlasmaStoreFull(s) && !release_cache_.empty()) {
+    // The objects held by the release cache cannot be evicted by the store.
+    // Give them back and try once more.
+    RETURN_NOT_OK(ShrinkReleaseCache(0));
+    return Create(object_id, data_size, metadata, metadata_size, data, device_num);
+  }
+  RETURN_NOT_OK(s);
   // If the CreateReply included an error, then the store will not send a file
   // descriptor.
   if (device_num == 0) {
@@ -542,14 +608,30 @@ Status PlasmaClient::Impl::GetBuffers(
     const std::function<std::shared_ptr<Buffer>(
         const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
     ObjectBuffer* object_buffers) {
-  // Fill out the info for the objects that are already in use locally.
-  bool all_present = true;
+  // Fill out the info for the objects that are already in use locally or kept
+  // in the release cache, and collect the ones we need to ask the store for.
+  std::vector<ObjectID> missing_ids;
+  std::vector<int64_t> missing_indices;
   for (int64_t i = 0; i < num_objects; ++i) {
     auto object_entry = objects_in_use_.find(object_ids[i]);
+    PlasmaObject* object;
+    PlasmaObject released_object;
     if (object_entry == objects_in_use_.end()) {
-      // This object is not currently in use by this client, so we need to send
-      // a request to the store.
-      all_present = false;
+      auto cache_entry = release_cache_.find(object_ids[i]);
+      if (cache_entry == release_cache_.end()) {
+        // This object is not currently in use by this client, so we need to
+        // send a request to the store.
+        missing_ids.push_back(object_ids[i]);
+        missing_indices.push_back(i);
+        continue;
+      }
+      // This client still holds the store's reference to the object, so it
+      // can be handed out again without contacting the store.
+      released_object = cache_entry->second.object;
+      object = &released_object;
+      release_cache_bytes_ -= object->data_size + object->metadata_size;
+      release_cache_lru_.erase(cache_entry->second.lru_position);
+      release_cache_.erase(cache_entry);
     } else if (!object_entry->second->is_sealed) {
       // This client created the object but hasn't sealed it. If we call Get
       // with no timeout, we will deadlock, because this client won't be able to
@@ -558,53 +640,56 @@ Status PlasmaClient::Impl::GetBuffers(
           << "Plasma client called get on an unsealed object that it created";
       ARROW_LOG(WARNING)
           << "Attempting to get an object that this client created but hasn't sealed.";
-      all_present = false;
+      missing_ids.push_back(object_ids[i]);
+      missing_indices.push_back(i);
+      continue;
     } else {
-      PlasmaObject* object = &object_entry->second->object;
-      std::shared_ptr<Buffer> physical_buf;
+      object = &object_entry->second->object;
+    }
 
-      if (object->device_num == 0) {
-        uint8_t* data = LookupMmappedFile(object->store_fd);
-        physical_buf = std::make_shared<Buffer>(
-            data + object->data_offset, object->data_size + object->metadata_size);
-      } else {
+    std::shared_ptr<Buffer> physical_buf;
+    if (object->device_num == 0) {
+      uint8_t* data = LookupMmappedFile(object->store_fd);
+      physical_buf = std::make_shared<Buffer>(data + object->data_offset,
+                                              object->data_size + object->metadata_size);
+    } else {
 #ifdef PLASMA_CUDA
-        std::lock_guard<std::mutex> lock(gpu_mutex);
-        auto iter = gpu_object_map.find(object_ids[i]);
-        ARROW_CHECK(iter != gpu_object_map.end());
-        iter->second->client_count++;
-        physical_buf = MakeBufferFromGpuProcessHandle(iter->second);
+      std::lock_guard<std::mutex> lock(gpu_mutex);
+      auto iter = gpu_object_map.find(object_ids[i]);
+      ARROW_CHECK(iter != gpu_object_map.end());
+      iter->second->client_count++;
+      physical_buf = MakeBufferFromGpuProcessHandle(iter->second);
 #else
-        ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
+      ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
-      }
-      physical_buf = wrap_buffer(object_ids[i], physical_buf);
-      object_buffers[i].data = SliceBuffer(physical_buf, 0, object->data_size);
-      object_buffers[i].metadata =
-          SliceBuffer(physical_buf, object->data_size, object->metadata_size);
-      object_buffers[i].device_num = object->device_num;
-      // Increment the count of the number of instances of this object that this
-      // client is using. Cache the reference to the object.
-      IncrementObjectCount(object_ids[i], object, true);
     }
+    physical_buf = wrap_buffer(object_ids[i], physical_buf);
+    object_buffers[i].data = SliceBuffer(physical_buf, 0, object->data_size);
+    object_buffers[i].metadata =
+        SliceBuffer(physical_buf, object->data_size, object->metadata_size);
+    object_buffers[i].device_num = object->device_num;
+    // Increment the count of the number of instances of this object that this
+    // client is using. Cache the reference to the object.
+    IncrementObjectCount(object_ids[i], object, true);
   }
 
-  if (all_present) {
+  if (missing_ids.empty()) {
     return Status::OK();
   }
 
-  // If we get here, then the objects aren't all currently in use by this
-  // client, so we need to send a request to the plasma store.
-  RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
+  // If we get here, then some of the objects aren't currently held by this
+  // client, so we need to ask the plasma store for those.
+  const int64_t num_missing = static_cast<int64_t>(missing_ids.size());
+  RETURN_NOT_OK(SendGetRequest(store_conn_, missing_ids.data(), num_missing, timeout_ms));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
-  std::vector<ObjectID> received_object_ids(num_objects);
-  std::vector<PlasmaObject> object_data(num_objects);
+  std::vector<ObjectID> received_object_ids(num_missing);
+  std::vector<PlasmaObject> object_data(num_missing);
   PlasmaObject* object;
   std::vector<int> store_fds;
   std::vector<int64_t> mmap_sizes;
   RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
-                             object_data.data(), num_objects, store_fds, mmap_sizes));
+                             object_data.data(), num_missing, store_fds, mmap_sizes));
 
   // We mmap all of the file descriptors here so that we can avoid look them up
   // in the subsequent loop based on just the store file descriptor and without
@@ -614,19 +699,12 @@ Status PlasmaClient::Impl::GetBuffers(
     LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
   }
 
-  for (int64_t i = 0; i < num_objects; ++i) {
-    DCHECK(received_object_ids[i] == object_ids[i]);
-    object = &object_data[i];
-    if (object_buffers[i].data) {
-      // If the object was already in use by the client, then the store should
-      // have returned it.
-      DCHECK_NE(object->data_size, -1);
-      // We've already filled out the information for this object, so we can
-      // just continue.
-      continue;
-    }
-    // If we are here, the object was not currently in use, so we need to
-    // process the reply from the object store.
+  for (int64_t j = 0; j < num_missing; ++j) {
+    const int64_t i = missing_indices[j];
+    DCHECK(received_object_ids[j] == object_ids[i]);
+    object = &object_data[j];
+    // The object was not currently in use, so we need to process the reply
+    // from the object store.
     if (object->data_size != -1) {
       std::shared_ptr<Buffer> physical_buf;
       if (object->device_num == 0) {
@@ -661,7 +739,7 @@ Status PlasmaClient::Impl::GetBuffers(
       object_buffers[i].device_num = object->device_num;
       // Increment the count of the number of instances of this object that this
       // client is using. Cache the reference to the object.
-      IncrementObjectCount(received_object_ids[i], object, true);
+      IncrementObjectCount(received_object_ids[j], object, true);
     } else {
       // The object was not retrieved.  The caller can detect this condition
       // by checking the boolean value of the metadata/data buffers.
@@ -704,6 +782,25 @@ Status PlasmaClient::Impl::MarkObjectUnused(const ObjectID& object_id) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::ShrinkReleaseCache(int64_t num_bytes) {
+  while (release_cache_bytes_ > num_bytes) {
+    RETURN_NOT_OK(DropFromReleaseCache(release_cache_lru_.front()));
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::DropFromReleaseCache(const ObjectID& object_id) {
+  auto cache_entry = release_cache_.find(object_id);
+  if (cache_entry == release_cache_.end()) {
+    return Status::OK();
+  }
+  const PlasmaObject& object = cache_entry->second.object;
+  release_cache_bytes_ -= object.data_size + object.metadata_size;
+  release_cache_lru_.erase(cache_entry->second.lru_position);
+  release_cache_.erase(cache_entry);
+  return SendReleaseRequest(store_conn_, object_id);
+}
+
 Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
@@ -730,8 +827,22 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   ARROW_CHECK(object_entry->second->count >= 0);
   // Check if the client is no longer using this object.
   if (object_entry->second->count == 0) {
-    // Tell the store that the client no longer needs the object.
+    const PlasmaObject object = object_entry->second->object;
+    const int64_t object_size = object.data_size + object.metadata_size;
+    const bool keep_cached = object_entry->second->is_sealed &&
+                             object.device_num == 0 &&
+                             object_size <= release_cache_capacity_ &&
+                             deletion_cache_.count(object_id) == 0;
     RETURN_NOT_OK(MarkObjectUnused(object_id));
+    if (keep_cached) {
+      // Hold on to the store's reference so that a later Get of this object
+      // does not need to go through the store.
+      release_cache_lru_.push_back(object_id);
+      release_cache_[object_id] = {object, std::prev(release_cache_lru_.end())};
+      release_cache_bytes_ += object_size;
+      return ShrinkReleaseCache(release_cache_capacity_);
+    }
+    // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
     auto iter = deletion_cache_.find(object_id);
     if (iter != deletion_cache_.end()) {
@@ -872,6 +983,39 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::Seal(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // Validate all of the objects before sealing any of them.
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNonexistent,
+                             "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "Seal() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  digests.reserve(object_ids.size());
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    std::vector<uint8_t> digest(kDigestSize);
+    RETURN_NOT_OK(Hash(object_id, &digest[0]));
+    digests.emplace_back(digest.begin(), digest.end());
+  }
+  RETURN_NOT_OK(SendSealBatchRequest(store_conn_, object_ids, digests));
+  // Drop the references that were taken by Create to keep the objects alive
+  // until they are sealed, see Seal above.
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(Release(object_id));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_entry = objects_in_use_.find(object_id);
@@ -916,6 +1060,9 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 
   std::vector<ObjectID> not_in_use_ids;
   for (auto& object_id : object_ids) {
+    // The store will not delete an object while we still hold a cached
+    // reference to it.
+    RETURN_NOT_OK(DropFromReleaseCache(object_id));
     // If the object is in used, skip it.
     if (objects_in_use_.count(object_id) == 0) {
       not_in_use_ids.push_back(object_id);
@@ -939,6 +1086,9 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  // Give back the references held by the release cache so that those objects
+  // can be evicted as well.
+  RETURN_NOT_OK(ShrinkReleaseCache(0));
   // Send a request to the store to evict objects.
   RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
   // Wait for a response with the number of bytes actually evicted.
@@ -958,6 +1108,12 @@ Status PlasmaClient::Impl::Refresh(const std::vector<ObjectID>& object_ids) {
   return ReadRefreshLRUReply(buffer.data(), buffer.size());
 }
 
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  return SendPrefetchRequest(store_conn_, object_ids);
+}
+
 Status PlasmaClient::Impl::Hash(const ObjectID& object_id, uint8_t* digest) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
@@ -1080,6 +1236,26 @@ Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
   return ReadSetOptionsReply(buffer.data(), buffer.size());
 }
 
+Status PlasmaClient::Impl::SetReleaseCacheCapacity(int64_t num_bytes) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  if (num_bytes < 0) {
+    return Status::Invalid("Release cache capacity must be non-negative");
+  }
+  // Cached objects are pinned in the store, so make sure the store can always
+  // evict enough other objects to make progress.
+  release_cache_capacity_ = std::min(num_bytes, store_capacity_ / 2);
+  return ShrinkReleaseCache(release_cache_capacity_);
+}
+
+Status PlasmaClient::Impl::SetNumaNode(int numa_node) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  if (numa_node < kLocalNumaNode) {
+    return Status::Invalid("Invalid NUMA node ", numa_node);
+  }
+  numa_node_ = numa_node;
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Disconnect() {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
@@ -1091,6 +1267,9 @@ Status PlasmaClient::Impl::Disconnect() {
   // that were in use by us when handling the SIGPIPE.
   close(store_conn_);
   store_conn_ = -1;
+  release_cache_.clear();
+  release_cache_lru_.clear();
+  release_cache_bytes_ = 0;
   return Status::OK();
 }
 
@@ -1129,6 +1308,12 @@ Status PlasmaClient::SetClientOptions(const std::string& client_name,
   return impl_->SetClientOptions(client_name, output_memory_quota);
 }
 
+Status PlasmaClient::SetReleaseCacheCapacity(int64_t num_bytes) {
+  return impl_->SetReleaseCacheCapacity(num_bytes);
+}
+
+Status PlasmaClient::SetNumaNode(int numa_node) { return impl_->SetNumaNode(numa_node); }
+
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
                             const uint8_t* metadata, int64_t metadata_size,
                             std::shared_ptr<Buffer>* data, int device_num) {
@@ -1170,6 +1355,10 @@ Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(obje
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::Seal(const std::vector<ObjectID>& object_ids) {
+  return impl_->Seal(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -1186,6 +1375,10 @@ Status PlasmaClient::Refresh(const std::vector<ObjectID>& object_ids) {
   return impl_->Refresh(object_ids);
 }
 
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::Hash(const ObjectID& object_id, uint8_t* digest) {
   return impl_->Hash(object_id, digest);
 }
@@ -34,6 +34,10 @@ using arrow::Status;
 
 namespace plasma {
 
+/// Passed to PlasmaClient::SetNumaNode() to place objects on the NUMA node of
+/// the CPU that creates them.
+constexpr int kLocalNumaNode = -2;
+
 /// Object buffer data structure.
 struct ObjectBuffer {
   /// The data buffer.
@@ -72,6 +76,29 @@ class ARROW_EXPORT PlasmaClient {
   ///        this client.
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  /// Keep recently released sealed objects mapped and referenced by this
+  /// client, so that a later Get() of the same objects is answered locally
+  /// without a round trip to the store. Cached objects cannot be evicted by
+  /// the store until they are dropped from the cache, either because the
+  /// cache is full, the object is deleted, or Evict() is called.
+  ///
+  /// \param num_bytes The maximum total size of cached objects (data plus
+  ///        metadata). It is capped at half of the store capacity. Zero,
+  ///        the default, disables the cache.
+  /// \return The return status.
+  Status SetReleaseCacheCapacity(int64_t num_bytes);
+
+  /// Choose the NUMA node the store should preferably allocate the objects
+  /// created by this client on. This only has an effect if the store was
+  /// started with -n on a machine with several NUMA nodes. If the memory of
+  /// that node is used up, objects are placed on another node.
+  ///
+  /// \param numa_node The node to allocate on, kLocalNumaNode for the node of
+  ///        the CPU the thread calling Create() runs on, or -1, the default,
+  ///        for no preference.
+  /// \return The return status.
+  Status SetNumaNode(int numa_node);
+
   /// Create an object in the Plasma Store. Any metadata for this object must be
   /// be passed in when the object is created.
   ///
@@ -203,6 +230,14 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal a list of objects in the object store with a single message to the
+  /// store. This is an optimization of Seal to eliminate the cost of IPC per
+  /// object.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -238,6 +273,15 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Refresh(const std::vector<ObjectID>& object_ids);
 
+  /// Ask the store to start restoring objects that were evicted to the
+  /// external store, so that a later Get() does not have to wait for them.
+  /// This does not wait for the objects to be restored. Objects that are
+  /// resident or do not exist in the store are ignored.
+  ///
+  /// \param object_ids The IDs of the objects to prefetch.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// Compute the hash of an object in the object store.
   ///
   /// \param object_id The ID of the object we want to hash.
@@ -45,6 +45,8 @@ int fake_munmap(void*, int64_t);
 #define HAVE_MORECORE 0
 #define DEFAULT_MMAP_THRESHOLD MAX_SIZE_T
 #define DEFAULT_GRANULARITY ((size_t)128U * 1024U)
+// The per-NUMA-node arenas of PlasmaAllocator are mspaces.
+#define MSPACES 1
 
 #include "plasma/thirdparty/dlmalloc.c"  // NOLINT
 
@@ -55,6 +57,7 @@ int fake_munmap(void*, int64_t);
 #undef USE_DL_PREFIX
 #undef HAVE_MORECORE
 #undef DEFAULT_GRANULARITY
+#undef MSPACES
 
 // dlmalloc.c defined DEBUG which will conflict with ARROW_LOG(DEBUG).
 #ifdef DEBUG
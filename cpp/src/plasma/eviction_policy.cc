@@ -23,6 +23,36 @@
 
 namespace plasma {
 
+void ObjectCache::AdjustCapacity(int64_t delta) {
+  ARROW_LOG(INFO) << "adjusting " << name_ << " capacity from " << Capacity() << " to "
+                  << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
+  capacity_ += delta;
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+}
+
+int64_t ObjectCache::Capacity() const { return capacity_; }
+
+int64_t ObjectCache::OriginalCapacity() const { return original_capacity_; }
+
+int64_t ObjectCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
+
+void ObjectCache::RecordEviction(int64_t size) {
+  bytes_evicted_total_ += size;
+  num_evictions_total_ += 1;
+}
+
+std::string ObjectCache::DebugString() const {
+  std::stringstream result;
+  result << "\n(" << name_ << ") capacity: " << Capacity();
+  result << "\n(" << name_
+         << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
+         << "%";
+  result << "\n(" << name_ << ") num objects: " << NumObjects();
+  result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
+  result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
+  return result.str();
+}
+
 void LRUCache::Add(const ObjectID& key, int64_t size) {
   auto it = item_map_.find(key);
   ARROW_CHECK(it == item_map_.end());
@@ -45,37 +75,12 @@ int64_t LRUCache::Remove(const ObjectID& key) {
   return size;
 }
 
-void LRUCache::AdjustCapacity(int64_t delta) {
-  ARROW_LOG(INFO) << "adjusting global lru capacity from " << Capacity() << " to "
-                  << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
-  capacity_ += delta;
-  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
-}
-
-int64_t LRUCache::Capacity() const { return capacity_; }
-
-int64_t LRUCache::OriginalCapacity() const { return original_capacity_; }
-
-int64_t LRUCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
-
 void LRUCache::Foreach(std::function<void(const ObjectID&)> f) {
   for (auto& pair : item_list_) {
     f(pair.first);
   }
 }
 
-std::string LRUCache::DebugString() const {
-  std::stringstream result;
-  result << "\n(" << name_ << ") capacity: " << Capacity();
-  result << "\n(" << name_
-         << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
-         << "%";
-  result << "\n(" << name_ << ") num objects: " << item_map_.size();
-  result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
-  result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
-  return result.str();
-}
-
 int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
                                        std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted = 0;
@@ -84,29 +89,180 @@ int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
     it--;
     objects_to_evict->push_back(it->first);
     bytes_evicted += it->second;
-    bytes_evicted_total_ += it->second;
-    num_evictions_total_ += 1;
+    RecordEviction(it->second);
+  }
+  return bytes_evicted;
+}
+
+void GDSFCache::Add(const ObjectID& key, int64_t size) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it == item_map_.end());
+  int64_t frequency = ++frequency_[key];
+  double priority = inflation_ + static_cast<double>(frequency) /
+                                     static_cast<double>(std::max<int64_t>(size, 1));
+  item_map_.emplace(key, item_queue_.emplace(priority, std::make_pair(key, size)));
+  used_capacity_ += size;
+}
+
+int64_t GDSFCache::Remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  if (it == item_map_.end()) {
+    return -1;
+  }
+  int64_t size = it->second->second.second;
+  used_capacity_ -= size;
+  item_queue_.erase(it->second);
+  item_map_.erase(it);
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+  return size;
+}
+
+void GDSFCache::Erase(const ObjectID& key) {
+  Remove(key);
+  frequency_.erase(key);
+}
+
+int64_t GDSFCache::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                        std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  for (auto it = item_queue_.begin();
+       bytes_evicted < num_bytes_required && it != item_queue_.end(); ++it) {
+    objects_to_evict->push_back(it->second.first);
+    bytes_evicted += it->second.second;
+    RecordEviction(it->second.second);
+    // Age the remaining objects by raising the priority of new additions.
+    inflation_ = it->first;
+  }
+  return bytes_evicted;
+}
+
+void GDSFCache::Foreach(std::function<void(const ObjectID&)> f) {
+  for (auto& item : item_queue_) {
+    f(item.second.first);
+  }
+}
+
+void TwoQueueCache::Add(const ObjectID& key, int64_t size) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it == item_map_.end());
+  // Objects that have been in the cache before were used in between, so they
+  // go to the protected queue.
+  bool in_probation = seen_.insert(key).second;
+  ItemList& queue = in_probation ? probation_ : protected_;
+  queue.emplace_front(key, size);
+  item_map_.emplace(key, Item{queue.begin(), in_probation});
+  if (in_probation) {
+    probation_bytes_ += size;
+  }
+  used_capacity_ += size;
+}
+
+int64_t TwoQueueCache::Remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  if (it == item_map_.end()) {
+    return -1;
+  }
+  int64_t size = it->second.position->second;
+  if (it->second.in_probation) {
+    probation_bytes_ -= size;
+    probation_.erase(it->second.position);
+  } else {
+    protected_.erase(it->second.position);
+  }
+  used_capacity_ -= size;
+  item_map_.erase(it);
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+  return size;
+}
+
+void TwoQueueCache::Erase(const ObjectID& key) {
+  Remove(key);
+  seen_.erase(key);
+}
+
+int64_t TwoQueueCache::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                            std::vector<ObjectID>* objects_to_evict) {
+  const int64_t probation_target = Capacity() / 4;
+  int64_t probation_bytes = probation_bytes_;
+  int64_t bytes_evicted = 0;
+  auto probation_it = probation_.end();
+  auto protected_it = protected_.end();
+  while (bytes_evicted < num_bytes_required) {
+    bool probation_left = probation_it != probation_.begin();
+    bool protected_left = protected_it != protected_.begin();
+    if (!probation_left && !protected_left) {
+      break;
+    }
+    ItemList::iterator victim;
+    if (probation_left && (probation_bytes > probation_target || !protected_left)) {
+      victim = --probation_it;
+      probation_bytes -= victim->second;
+    } else {
+      victim = --protected_it;
+    }
+    objects_to_evict->push_back(victim->first);
+    bytes_evicted += victim->second;
+    RecordEviction(victim->second);
   }
   return bytes_evicted;
 }
 
-EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size)
-    : pinned_memory_bytes_(0), store_info_(store_info), cache_("global lru", max_size) {}
+void TwoQueueCache::Foreach(std::function<void(const ObjectID&)> f) {
+  for (auto& pair : probation_) {
+    f(pair.first);
+  }
+  for (auto& pair : protected_) {
+    f(pair.first);
+  }
+}
+
+std::string TwoQueueCache::DebugString() const {
+  std::stringstream result;
+  result << ObjectCache::DebugString();
+  result << "\n(" << name_ << ") probation objects: " << probation_.size();
+  result << "\n(" << name_ << ") probation bytes: " << probation_bytes_;
+  result << "\n(" << name_ << ") protected objects: " << protected_.size();
+  return result.str();
+}
+
+std::unique_ptr<ObjectCache> MakeObjectCache(const std::string& policy,
+                                             const std::string& name, int64_t size) {
+  if (policy == "lru") {
+    return std::unique_ptr<ObjectCache>(new LRUCache(name, size));
+  } else if (policy == "gdsf") {
+    return std::unique_ptr<ObjectCache>(new GDSFCache(name, size));
+  } else if (policy == "2q") {
+    return std::unique_ptr<ObjectCache>(new TwoQueueCache(name, size));
+  }
+  return nullptr;
+}
+
+EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                               std::unique_ptr<ObjectCache> cache)
+    : pinned_memory_bytes_(0),
+      num_hits_(0),
+      num_misses_(0),
+      store_info_(store_info),
+      cache_(std::move(cache)) {
+  if (!cache_) {
+    cache_.reset(new LRUCache("global lru", max_size));
+  }
+}
 
 int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
                                              std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted =
-      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
-  // Update the LRU cache.
+      cache_->ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
+  // Update the cache.
   for (auto& object_id : *objects_to_evict) {
-    cache_.Remove(object_id);
+    cache_->Erase(object_id);
   }
   return bytes_evicted;
 }
 
 void EvictionPolicy::ObjectCreated(const ObjectID& object_id, Client* client,
                                    bool is_create) {
-  cache_.Add(object_id, GetObjectSize(object_id));
+  cache_->Add(object_id, GetObjectSize(object_id));
 }
 
 bool EvictionPolicy::SetClientQuota(Client* client, int64_t output_memory_quota) {
@@ -139,28 +295,28 @@ bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_t
 }
 
 void EvictionPolicy::BeginObjectAccess(const ObjectID& object_id) {
-  // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  // If the object is in the cache, remove it.
+  cache_->Remove(object_id);
   pinned_memory_bytes_ += GetObjectSize(object_id);
 }
 
 void EvictionPolicy::EndObjectAccess(const ObjectID& object_id) {
   auto size = GetObjectSize(object_id);
-  // Add the object to the LRU cache.
-  cache_.Add(object_id, size);
+  // Add the object to the cache.
+  cache_->Add(object_id, size);
   pinned_memory_bytes_ -= size;
 }
 
 void EvictionPolicy::RemoveObject(const ObjectID& object_id) {
-  // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  // If the object is in the cache, remove it.
+  cache_->Erase(object_id);
 }
 
 void EvictionPolicy::RefreshObjects(const std::vector<ObjectID>& object_ids) {
   for (const auto& object_id : object_ids) {
-    int64_t size = cache_.Remove(object_id);
+    int64_t size = cache_->Remove(object_id);
     if (size != -1) {
-      cache_.Add(object_id, size);
+      cache_->Add(object_id, size);
     }
   }
 }
@@ -170,6 +326,23 @@ int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
   return entry->data_size + entry->metadata_size;
 }
 
-std::string EvictionPolicy::DebugString() const { return cache_.DebugString(); }
+void EvictionPolicy::RecordLookup(bool hit) {
+  if (hit) {
+    num_hits_ += 1;
+  } else {
+    num_misses_ += 1;
+  }
+}
+
+std::string EvictionPolicy::LookupDebugString() const {
+  std::stringstream result;
+  result << "\nnum hits: " << num_hits_;
+  result << "\nnum misses: " << num_misses_;
+  return result.str();
+}
+
+std::string EvictionPolicy::DebugString() const {
+  return LookupDebugString() + cache_->DebugString();
+}
 
 }  // namespace plasma
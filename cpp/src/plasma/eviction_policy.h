@@ -20,8 +20,11 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -38,9 +41,13 @@ namespace plasma {
 //
 // It does not implement memory quotas; see quota_aware_policy for that.
 
-class LRUCache {
+/// The replacement order used by an eviction policy. An ObjectCache holds the
+/// objects that are not in use by any client, and hence may be evicted,
+/// together with their sizes, and decides which of them to evict first.
+/// Capacity and eviction accounting is shared by all implementations.
+class ObjectCache {
  public:
-  LRUCache(const std::string& name, int64_t size)
+  ObjectCache(const std::string& name, int64_t size)
       : name_(name),
         original_capacity_(size),
         capacity_(size),
@@ -48,12 +55,32 @@ class LRUCache {
         num_evictions_total_(0),
         bytes_evicted_total_(0) {}
 
-  void Add(const ObjectID& key, int64_t size);
+  virtual ~ObjectCache() = default;
 
-  int64_t Remove(const ObjectID& key);
+  /// Add an object that is no longer in use to the cache.
+  virtual void Add(const ObjectID& key, int64_t size) = 0;
 
-  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
-                               std::vector<ObjectID>* objects_to_evict);
+  /// Remove an object from the cache because it is in use again. Any access
+  /// history kept for the object is retained.
+  ///
+  /// \return The size of the object, or -1 if it was not in the cache.
+  virtual int64_t Remove(const ObjectID& key) = 0;
+
+  /// Remove an object from the cache because it is leaving the store, and
+  /// forget its access history.
+  virtual void Erase(const ObjectID& key) { Remove(key); }
+
+  /// Choose objects to evict until at least num_bytes_required bytes would be
+  /// freed. The chosen objects are not removed from the cache.
+  ///
+  /// \return The total size of the chosen objects.
+  virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) = 0;
+
+  virtual void Foreach(std::function<void(const ObjectID&)>) = 0;
+
+  /// The number of objects in the cache.
+  virtual size_t NumObjects() const = 0;
 
   int64_t OriginalCapacity() const;
 
@@ -63,18 +90,17 @@ class LRUCache {
 
   void AdjustCapacity(int64_t delta);
 
-  void Foreach(std::function<void(const ObjectID&)>);
+  /// The number of objects chosen for eviction from this cache.
+  int64_t num_evictions() const { return num_evictions_total_; }
 
-  std::string DebugString() const;
+  /// The number of bytes chosen for eviction from this cache.
+  int64_t bytes_evicted() const { return bytes_evicted_total_; }
 
- private:
-  /// A doubly-linked list containing the items in the cache and
-  /// their sizes in LRU order.
-  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
-  ItemList item_list_;
-  /// A hash table mapping the object ID of an object in the cache to its
-  /// location in the doubly linked list item_list_.
-  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+  virtual std::string DebugString() const;
+
+ protected:
+  /// Account for an object of the given size being chosen for eviction.
+  void RecordEviction(int64_t size);
 
   /// The name of this cache, used for debugging purposes only.
   const std::string name_;
@@ -90,6 +116,118 @@ class LRUCache {
   int64_t bytes_evicted_total_;
 };
 
+/// Evict the least recently used object first.
+class LRUCache : public ObjectCache {
+ public:
+  LRUCache(const std::string& name, int64_t size) : ObjectCache(name, size) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  size_t NumObjects() const override { return item_map_.size(); }
+
+ private:
+  /// A doubly-linked list containing the items in the cache and
+  /// their sizes in LRU order.
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  ItemList item_list_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in the doubly linked list item_list_.
+  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+};
+
+/// Greedy-Dual-Size-Frequency: evict the object with the lowest priority
+/// L + frequency / size, where frequency counts how often the object was
+/// added back after being used and L is the priority of the last evicted
+/// object. Small, frequently used objects are kept in favor of large objects
+/// that are only used once, and L ages out objects that stopped being used.
+class GDSFCache : public ObjectCache {
+ public:
+  GDSFCache(const std::string& name, int64_t size)
+      : ObjectCache(name, size), inflation_(0) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  void Erase(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  size_t NumObjects() const override { return item_map_.size(); }
+
+ private:
+  /// The items in the cache ordered by priority, lowest first. Items with
+  /// the same priority are kept in insertion order.
+  typedef std::multimap<double, std::pair<ObjectID, int64_t>> ItemQueue;
+  ItemQueue item_queue_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in item_queue_.
+  std::unordered_map<ObjectID, ItemQueue::iterator> item_map_;
+  /// The number of times each object in the store was added to the cache.
+  std::unordered_map<ObjectID, int64_t> frequency_;
+  /// The priority of the most recently evicted object.
+  double inflation_;
+};
+
+/// A simplified 2Q: objects enter a FIFO probation queue and move to an LRU
+/// queue once they are used again. Objects are evicted from the probation
+/// queue first while it holds more than a quarter of the capacity, so a
+/// stream of large objects that are used only once cannot flush out the
+/// objects that are used repeatedly.
+class TwoQueueCache : public ObjectCache {
+ public:
+  TwoQueueCache(const std::string& name, int64_t size)
+      : ObjectCache(name, size), probation_bytes_(0) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  void Erase(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  size_t NumObjects() const override { return item_map_.size(); }
+
+  std::string DebugString() const override;
+
+ private:
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  struct Item {
+    ItemList::iterator position;
+    bool in_probation;
+  };
+  /// Objects that were not used since they were first added, newest first.
+  ItemList probation_;
+  /// Objects that were used again after being added, most recent first.
+  ItemList protected_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in one of the two queues.
+  std::unordered_map<ObjectID, Item> item_map_;
+  /// Objects in the store that have already been added to the cache once.
+  std::unordered_set<ObjectID> seen_;
+  /// The number of bytes in the probation queue.
+  int64_t probation_bytes_;
+};
+
+/// Create the object cache for the named replacement policy, which is one of
+/// "lru", "gdsf" or "2q". Returns nullptr for an unknown name.
+std::unique_ptr<ObjectCache> MakeObjectCache(const std::string& policy,
+                                             const std::string& name, int64_t size);
+
 /// The eviction policy.
 class EvictionPolicy {
  public:
@@ -98,7 +236,10 @@ class EvictionPolicy {
   /// @param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// @param max_size Max size in bytes total of objects to store.
-  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// @param cache The replacement order for objects that are not in use. If
+  ///        this is null, objects are evicted in LRU order.
+  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                          std::unique_ptr<ObjectCache> cache = nullptr);
 
   /// Destroy an eviction policy.
   virtual ~EvictionPolicy() {}
@@ -191,6 +332,24 @@ class EvictionPolicy {
 
   virtual void RefreshObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Record the outcome of a client looking up an object. A lookup is a hit
+  /// if the object was resident in memory and a miss otherwise.
+  ///
+  /// @param hit Whether the object was resident.
+  void RecordLookup(bool hit);
+
+  /// The number of lookups of resident objects.
+  int64_t num_hits() const { return num_hits_; }
+
+  /// The number of lookups of objects that were not resident.
+  int64_t num_misses() const { return num_misses_; }
+
+  /// The number of objects chosen for eviction.
+  int64_t num_evictions() const { return cache_->num_evictions(); }
+
+  /// The number of bytes chosen for eviction.
+  int64_t bytes_evicted() const { return cache_->bytes_evicted(); }
+
   /// Returns debugging information for this eviction policy.
   virtual std::string DebugString() const;
 
@@ -198,13 +357,20 @@ class EvictionPolicy {
   /// Returns the size of the object
   int64_t GetObjectSize(const ObjectID& object_id) const;
 
+  /// Returns the hit and miss counters formatted for DebugString.
+  std::string LookupDebugString() const;
+
   /// The number of bytes pinned by applications.
   int64_t pinned_memory_bytes_;
+  /// The number of lookups of resident objects.
+  int64_t num_hits_;
+  /// The number of lookups of objects that were not resident.
+  int64_t num_misses_;
 
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
-  /// Datastructure for the LRU cache.
-  LRUCache cache_;
+  /// The replacement order for objects that are not in use.
+  std::unique_ptr<ObjectCache> cache_;
 };
 
 }  // namespace plasma
@@ -32,6 +32,10 @@ namespace plasma {
 // This file contains declaration for all functions that need to be implemented
 // for an external storage service so that objects evicted from Plasma store
 // can be written to it.
+//
+// The Plasma store calls Put and Get from a pool of worker threads, with
+// disjoint sets of object IDs per call, so implementations must be safe to
+// call concurrently.
 
 class ExternalStore {
  public:
@@ -28,6 +28,7 @@ Status HashTableStore::Connect(const std::string& endpoint) { return Status::OK(
 
 Status HashTableStore::Put(const std::vector<ObjectID>& ids,
                            const std::vector<std::shared_ptr<Buffer>>& data) {
+  std::lock_guard<std::mutex> lock(mutex_);
   for (size_t i = 0; i < ids.size(); ++i) {
     table_[ids[i]] = data[i]->ToString();
   }
@@ -37,6 +38,7 @@ Status HashTableStore::Put(const std::vector<ObjectID>& ids,
 Status HashTableStore::Get(const std::vector<ObjectID>& ids,
                            std::vector<std::shared_ptr<Buffer>> buffers) {
   ARROW_CHECK(ids.size() == buffers.size());
+  std::lock_guard<std::mutex> lock(mutex_);
   for (size_t i = 0; i < ids.size(); ++i) {
     bool valid;
     HashTable::iterator result;
@@ -19,6 +19,7 @@
 #define HASH_TABLE_STORE_H
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -45,6 +46,8 @@ class HashTableStore : public ExternalStore {
  private:
   typedef std::unordered_map<ObjectID, std::string> HashTable;
 
+  /// Protects table_.
+  std::mutex mutex_;
   HashTable table_;
 };
 
@@ -17,7 +17,24 @@
 
 #include <arrow/util/logging.h>
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/statvfs.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "plasma/malloc.h"
+#include "plasma/plasma.h"
 #include "plasma/plasma_allocator.h"
 
 namespace plasma {
@@ -25,23 +42,123 @@ namespace plasma {
 extern "C" {
 void* dlmemalign(size_t alignment, size_t bytes);
 void dlfree(void* mem);
+void* create_mspace_with_base(void* base, size_t capacity, int locked);
+void* mspace_memalign(void* msp, size_t alignment, size_t bytes);
+void mspace_free(void* msp, void* mem);
+}
+
+// Not declared extern "C" by dlmalloc.c, so it has C++ linkage in this namespace.
+size_t mspace_set_footprint_limit(void* msp, size_t bytes);
+
+namespace {
+
+/// A dlmalloc mspace whose pages are bound to one NUMA node.
+struct NumaArena {
+  int node;
+  uint8_t* begin;
+  uint8_t* end;
+  void* mspace;
+  int64_t allocated;
+};
+
+std::vector<NumaArena> numa_arenas;
+
+NumaArena* FindNumaArena(void* mem) {
+  for (auto& arena : numa_arenas) {
+    if (mem >= arena.begin && mem < arena.end) {
+      return &arena;
+    }
+  }
+  return nullptr;
+}
+
+#ifdef __linux__
+// Parse a node list like "0-1,3" as found in /sys/devices/system/node/online.
+arrow::Status GetOnlineNumaNodes(std::vector<int>* nodes) {
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string list;
+  if (!std::getline(file, list)) {
+    return arrow::Status::IOError("could not read the online NUMA nodes");
+  }
+  std::stringstream ranges(list);
+  std::string range;
+  while (std::getline(ranges, range, ',')) {
+    int first, last;
+    if (sscanf(range.c_str(), "%d-%d", &first, &last) != 2) {
+      if (sscanf(range.c_str(), "%d", &first) != 1) {
+        return arrow::Status::IOError("malformed NUMA node list \"", list, "\"");
+      }
+      last = first;
+    }
+    for (int node = first; node <= last; ++node) {
+      nodes->push_back(node);
+    }
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status BindToNumaNode(uint8_t* begin, uint8_t* end, int node) {
+  const size_t bits = 8 * sizeof(unsigned long);  // NOLINT
+  std::vector<unsigned long> mask(node / bits + 1, 0);  // NOLINT
+  mask[node / bits] |= 1UL << (node % bits);
+  // The kernel ignores the last bit of maxnode. MPOL_MF_MOVE migrates the few
+  // pages dlmalloc already touched while setting up the region.
+  if (syscall(SYS_mbind, begin, end - begin, MPOL_BIND, mask.data(),
+              mask.size() * bits + 1, MPOL_MF_MOVE) != 0) {
+    return arrow::Status::IOError("mbind to NUMA node ", node,
+                                  " failed: ", std::strerror(errno));
+  }
+  return arrow::Status::OK();
 }
+#endif
+
+}  // namespace
 
 int64_t PlasmaAllocator::footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
 
-void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
+void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes, int numa_node) {
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
-  void* mem = dlmemalign(alignment, bytes);
-  ARROW_CHECK(mem);
-  allocated_ += bytes;
-  return mem;
+  if (numa_arenas.empty()) {
+    void* mem = dlmemalign(alignment, bytes);
+    ARROW_CHECK(mem);
+    allocated_ += bytes;
+    return mem;
+  }
+  // Try the requested node first and then the others, emptiest first.
+  std::vector<NumaArena*> arenas;
+  for (auto& arena : numa_arenas) {
+    arenas.push_back(&arena);
+  }
+  std::stable_sort(arenas.begin(), arenas.end(),
+                   [numa_node](const NumaArena* a, const NumaArena* b) {
+                     if ((a->node == numa_node) != (b->node == numa_node)) {
+                       return a->node == numa_node;
+                     }
+                     return a->allocated < b->allocated;
+                   });
+  for (NumaArena* arena : arenas) {
+    void* mem = mspace_memalign(arena->mspace, alignment, bytes);
+    if (mem) {
+      arena->allocated += bytes;
+      allocated_ += bytes;
+      return mem;
+    }
+  }
+  // All arenas are too full or too fragmented, the caller has to evict objects.
+  return nullptr;
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
-  dlfree(mem);
+  NumaArena* arena = FindNumaArena(mem);
+  if (arena) {
+    mspace_free(arena->mspace, mem);
+    arena->allocated -= bytes;
+  } else {
+    dlfree(mem);
+  }
   allocated_ -= bytes;
 }
 
@@ -53,4 +170,78 @@ int64_t PlasmaAllocator::GetFootprintLimit() { return footprint_limit_; }
 
 int64_t PlasmaAllocator::Allocated() { return allocated_; }
 
+arrow::Status PlasmaAllocator::CreateNumaArenas() {
+#ifdef __linux__
+  DCHECK(numa_arenas.empty());
+  std::vector<int> nodes;
+  RETURN_NOT_OK(GetOnlineNumaNodes(&nodes));
+  if (nodes.size() < 2) {
+    return arrow::Status::Invalid("this machine has a single NUMA node");
+  }
+  // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
+  // bookkeeping of the region the arenas are carved from.
+  size_t size = footprint_limit_ - 256 * sizeof(size_t);
+  uint8_t* region = reinterpret_cast<uint8_t*>(dlmemalign(kBlockSize, size));
+  if (!region) {
+    return arrow::Status::OutOfMemory("could not allocate ", size, " bytes");
+  }
+  // Split at multiples of the page size of the backing file system, which is
+  // the huge page size on hugetlbfs, since mbind only works on whole pages.
+  int fd;
+  int64_t map_size;
+  ptrdiff_t offset;
+  GetMallocMapinfo(region, &fd, &map_size, &offset);
+  struct statvfs stats;
+  uintptr_t page_size = 4096;
+  if (fd != -1 && fstatvfs(fd, &stats) == 0 && stats.f_bsize > 0) {
+    page_size = stats.f_bsize;
+  }
+  auto align_up = [page_size](uint8_t* p) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(p) + page_size - 1;
+    return reinterpret_cast<uint8_t*>(address / page_size * page_size);
+  };
+  auto align_down = [page_size](uint8_t* p) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(p);
+    return reinterpret_cast<uint8_t*>(address / page_size * page_size);
+  };
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    NumaArena arena;
+    arena.node = nodes[i];
+    arena.begin = i == 0 ? region : align_up(region + i * size / nodes.size());
+    arena.end = i + 1 == nodes.size()
+                    ? region + size
+                    : align_up(region + (i + 1) * size / nodes.size());
+    arena.allocated = 0;
+    uint8_t* bind_begin = align_up(arena.begin);
+    uint8_t* bind_end = align_down(arena.end);
+    if (bind_end > bind_begin) {
+      arrow::Status s = BindToNumaNode(bind_begin, bind_end, arena.node);
+      if (!s.ok()) {
+        numa_arenas.clear();
+        dlfree(region);
+        return s;
+      }
+    }
+    arena.mspace = create_mspace_with_base(arena.begin, arena.end - arena.begin, 0);
+    if (!arena.mspace) {
+      numa_arenas.clear();
+      dlfree(region);
+      return arrow::Status::OutOfMemory("NUMA arena for node ", arena.node,
+                                        " is too small");
+    }
+    // The arenas must never grow beyond their share of the region: a limit
+    // below the current footprint makes dlmalloc refuse to map more memory.
+    mspace_set_footprint_limit(arena.mspace, 1);
+    numa_arenas.push_back(arena);
+  }
+  ARROW_LOG(INFO) << "Created " << numa_arenas.size() << " NUMA arenas of about "
+                  << size / numa_arenas.size() << " bytes each";
+  return arrow::Status::OK();
+#else
+  return arrow::Status::NotImplemented("NUMA arenas are only supported on Linux");
+#endif
+}
+
+int PlasmaAllocator::NumNumaArenas() { return static_cast<int>(numa_arenas.size()); }
+
 }  // namespace plasma
@@ -21,6 +21,8 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "arrow/status.h"
+
 namespace plasma {
 
 class PlasmaAllocator {
@@ -30,8 +32,12 @@ class PlasmaAllocator {
   ///
   /// \param alignment Memory alignment.
   /// \param bytes Number of bytes.
+  /// \param numa_node NUMA node the memory should preferably be placed on, or -1
+  ///        for no preference. This only has an effect once CreateNumaArenas()
+  ///        was called. If the arena of that node is full, the memory comes from
+  ///        another node.
   /// \return Pointer to allocated memory.
-  static void* Memalign(size_t alignment, size_t bytes);
+  static void* Memalign(size_t alignment, size_t bytes, int numa_node = -1);
 
   /// Frees the memory space pointed to by mem, which must have been returned by
   /// a previous call to Memalign()
@@ -54,6 +60,20 @@ class PlasmaAllocator {
   /// \return Number of bytes allocated by Plasma so far.
   static int64_t Allocated();
 
+  /// Split the whole Plasma memory into one arena per online NUMA node and bind
+  /// the pages of each arena to its node. The memory is allocated up front, so
+  /// this must be called once after SetFootprintLimit() and before any other
+  /// allocation. Only supported on Linux machines with more than one node.
+  ///
+  /// \return Status.
+  static arrow::Status CreateNumaArenas();
+
+  /// Get the number of NUMA arenas, which is zero unless CreateNumaArenas()
+  /// succeeded.
+  ///
+  /// \return The number of NUMA arenas.
+  static int NumNumaArenas();
+
  private:
   static int64_t allocated_;
   static int64_t footprint_limit_;
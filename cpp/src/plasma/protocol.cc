@@ -184,15 +184,17 @@ Status ReadGetDebugStringReply(uint8_t* data, size_t size, std::string* debug_st
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
-                         int64_t metadata_size, int device_num) {
+                         int64_t metadata_size, int device_num, int numa_node) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()),
-                                               data_size, metadata_size, device_num);
+  auto message =
+      fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()), data_size,
+                                    metadata_size, device_num, numa_node);
   return PlasmaSend(sock, MessageType::PlasmaCreateRequest, &fbb, message);
 }
 
 Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
-                         int64_t* data_size, int64_t* metadata_size, int* device_num) {
+                         int64_t* data_size, int64_t* metadata_size, int* device_num,
+                         int* numa_node) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
@@ -200,6 +202,7 @@ Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
   *metadata_size = message->metadata_size();
   *object_id = ObjectID::from_binary(message->object_id()->str());
   *device_num = message->device_num();
+  *numa_node = message->numa_node();
   return Status::OK();
 }
 
@@ -402,6 +405,32 @@ Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
   return Status::OK();
 }
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      ToFlatbuffer(&fbb, digests));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchRequest, &fbb, message);
+}
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  ConvertToVector(message->digest(), digests,
+                  [](const flatbuffers::String& element) {
+                    ARROW_CHECK_EQ(element.size(), kDigestSize);
+                    return element.str();
+                  });
+  return Status::OK();
+}
+
 Status SendSealReply(int sock, ObjectID object_id, PlasmaError error) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message =
@@ -816,4 +845,25 @@ Status ReadRefreshLRUReply(uint8_t* data, size_t size) {
   return Status::OK();
 }
 
+// Prefetch messages.
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaPrefetchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaPrefetchRequest, &fbb, message);
+}
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPrefetchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
 }  // namespace plasma
@@ -78,10 +78,11 @@ Status ReadGetDebugStringReply(uint8_t* data, size_t size, std::string* debug_st
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
-                         int64_t metadata_size, int device_num);
+                         int64_t metadata_size, int device_num, int numa_node);
 
 Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
-                         int64_t* data_size, int64_t* metadata_size, int* device_num);
+                         int64_t* data_size, int64_t* metadata_size, int* device_num,
+                         int* numa_node);
 
 Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
                        PlasmaError error, int64_t mmap_size);
@@ -131,6 +132,12 @@ Status SendSealRequest(int sock, ObjectID object_id, const std::string& digest);
 Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
                        std::string* digest);
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests);
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests);
+
 Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
@@ -243,6 +250,13 @@ Status SendRefreshLRUReply(int sock);
 
 Status ReadRefreshLRUReply(uint8_t* data, size_t size);
 
+/* Plasma prefetch functions. */
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids);
+
 }  // namespace plasma
 
 #endif /* PLASMA_PROTOCOL */
@@ -22,11 +22,13 @@
 #include <algorithm>
 #include <memory>
 #include <sstream>
+#include <utility>
 
 namespace plasma {
 
-QuotaAwarePolicy::QuotaAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size)
-    : EvictionPolicy(store_info, max_size) {}
+QuotaAwarePolicy::QuotaAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                                   std::unique_ptr<ObjectCache> cache)
+    : EvictionPolicy(store_info, max_size, std::move(cache)) {}
 
 bool QuotaAwarePolicy::HasQuota(Client* client, bool is_create) {
   if (!is_create) {
@@ -51,14 +53,14 @@ bool QuotaAwarePolicy::SetClientQuota(Client* client, int64_t output_memory_quot
     return false;
   }
 
-  if (cache_.Capacity() - output_memory_quota <
-      cache_.OriginalCapacity() * kGlobalLruReserveFraction) {
+  if (cache_->Capacity() - output_memory_quota <
+      cache_->OriginalCapacity() * kGlobalLruReserveFraction) {
     ARROW_LOG(WARNING) << "Not enough memory to set client quota: " << DebugString();
     return false;
   }
 
   // those objects will be lazily evicted on the next call
-  cache_.AdjustCapacity(-output_memory_quota);
+  cache_->AdjustCapacity(-output_memory_quota);
   per_client_cache_[client] =
       std::unique_ptr<LRUCache>(new LRUCache(client->name, output_memory_quota));
   return true;
@@ -145,13 +147,13 @@ void QuotaAwarePolicy::ClientDisconnected(Client* client) {
     return;
   }
   // return capacity back to global LRU
-  cache_.AdjustCapacity(per_client_cache_[client]->Capacity());
+  cache_->AdjustCapacity(per_client_cache_[client]->Capacity());
   // clean up any entries used to track this client's quota usage
   per_client_cache_[client]->Foreach([this](const ObjectID& obj) {
     if (!shared_for_read_.count(obj)) {
       // only add it to the global LRU if we have it in pinned mode
       // otherwise, EndObjectAccess will add it later
-      cache_.Add(obj, GetObjectSize(obj));
+      cache_->Add(obj, GetObjectSize(obj));
     }
     owned_by_client_.erase(obj);
     shared_for_read_.erase(obj);
@@ -167,7 +169,8 @@ std::string QuotaAwarePolicy::DebugString() const {
   result << "\nallocated bytes: " << PlasmaAllocator::Allocated();
   result << "\nallocation limit: " << PlasmaAllocator::GetFootprintLimit();
   result << "\npinned bytes: " << pinned_memory_bytes_;
-  result << cache_.DebugString();
+  result << LookupDebugString();
+  result << cache_->DebugString();
   for (const auto& pair : per_client_cache_) {
     result << pair.second->DebugString();
   }
@@ -29,6 +29,7 @@
 #include "plasma/store.h"
 
 #include <assert.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <getopt.h>
 #include <limits.h>
@@ -43,8 +44,10 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <ctime>
 #include <deque>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -112,19 +115,42 @@ Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
+                         std::shared_ptr<ExternalStore> external_store,
+                         const std::string& eviction_policy)
     : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
-      external_store_(external_store) {
+      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit(),
+                       MakeObjectCache(eviction_policy, "global " + eviction_policy,
+                                       PlasmaAllocator::GetFootprintLimit())),
+      external_store_(external_store),
+      restore_notify_fds_{-1, -1} {
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
 #ifdef PLASMA_CUDA
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
+  if (external_store_) {
+    using arrow::internal::ThreadPool;
+    auto maybe_pool = ThreadPool::Make(ThreadPool::DefaultIOCapacity());
+    ARROW_CHECK_OK(maybe_pool.status());
+    external_store_pool_ = *std::move(maybe_pool);
+    ARROW_CHECK(pipe(restore_notify_fds_) == 0) << "pipe failed: " << strerror(errno);
+    // A full pipe already guarantees a wakeup, so workers never need to block.
+    int flags = fcntl(restore_notify_fds_[1], F_GETFL, 0);
+    ARROW_CHECK(fcntl(restore_notify_fds_[1], F_SETFL, flags | O_NONBLOCK) == 0);
+    loop_->AddFileEvent(restore_notify_fds_[0], kEventLoopRead,
+                        [this](int events) { ProcessRestoredObjects(); });
+  }
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  if (external_store_pool_) {
+    // Restores in flight write into the store's memory and to the pipe.
+    ARROW_UNUSED(external_store_pool_->Shutdown());
+    close(restore_notify_fds_[0]);
+    close(restore_notify_fds_[1]);
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
@@ -151,7 +177,8 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
 
 // Allocate memory
 uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
-                                     ptrdiff_t* offset, Client* client, bool is_create) {
+                                     ptrdiff_t* offset, Client* client, bool is_create,
+                                     int numa_node) {
   // First free up space from the client's LRU queue if quota enforcement is on.
   std::vector<ObjectID> client_objects_to_evict;
   bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
@@ -171,7 +198,8 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
     // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
     // it is not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
-    pointer = reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(kBlockSize, size));
+    pointer = reinterpret_cast<uint8_t*>(
+        PlasmaAllocator::Memalign(kBlockSize, size, numa_node));
     if (pointer) {
       break;
     }
@@ -215,7 +243,8 @@ Status PlasmaStore::FreeCudaMemory(int device_num, int64_t size, uint8_t* pointe
 // Create a new object buffer in the hash table.
 PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_size,
                                       int64_t metadata_size, int device_num,
-                                      Client* client, PlasmaObject* result) {
+                                      Client* client, PlasmaObject* result,
+                                      int numa_node) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
 
   auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -232,7 +261,8 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
   auto total_size = data_size + metadata_size;
 
   if (device_num == 0) {
-    pointer = AllocateMemory(total_size, &fd, &map_size, &offset, client, true);
+    pointer =
+        AllocateMemory(total_size, &fd, &map_size, &offset, client, true, numa_node);
     if (!pointer) {
       ARROW_LOG(ERROR) << "Not enough memory to create the object " << object_id.hex()
                        << ", data_size=" << data_size
@@ -439,11 +469,11 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   // Create a get request for this object.
   auto get_req = new GetRequest(client, object_ids);
   std::vector<ObjectID> evicted_ids;
-  std::vector<ObjectTableEntry*> evicted_entries;
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
     auto entry = GetObjectTableEntry(&store_info_, object_id);
+    eviction_policy_.RecordLookup(entry && entry->state == ObjectState::PLASMA_SEALED);
     if (entry && entry->state == ObjectState::PLASMA_SEALED) {
       // Update the get request to take into account the present object.
       PlasmaObject_init(&get_req->objects[object_id], entry);
@@ -452,24 +482,11 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       // where entry == NULL, this will be called from SealObject.
       AddToClientObjectIds(object_id, entry, client);
     } else if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
-      // Make sure the object pointer is not already allocated
-      ARROW_CHECK(!entry->pointer);
-
-      entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size, &entry->fd,
-                                      &entry->map_size, &entry->offset, client, false);
-      if (entry->pointer) {
-        entry->state = ObjectState::PLASMA_CREATED;
-        entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id, client, false);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
-        evicted_ids.push_back(object_id);
-        evicted_entries.push_back(entry);
-      } else {
-        // We are out of memory and cannot allocate memory for this object.
-        // Change the state of the object back to PLASMA_EVICTED so some
-        // other request can try again.
-        entry->state = ObjectState::PLASMA_EVICTED;
-      }
+      // Restore the object from the external store in the background. The
+      // request waits for it like for an object that is not sealed yet.
+      evicted_ids.push_back(object_id);
+      get_req->objects[object_id].data_size = -1;
+      object_get_requests_[object_id].push_back(get_req);
     } else {
       // Add a placeholder plasma object to the get request to indicate that the
       // object is not present. This will be parsed by the client. We set the
@@ -481,30 +498,7 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   }
 
   if (!evicted_ids.empty()) {
-    unsigned char digest[kDigestSize];
-    std::vector<std::shared_ptr<Buffer>> buffers;
-    for (size_t i = 0; i < evicted_ids.size(); ++i) {
-      ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
-    }
-    if (external_store_->Get(evicted_ids, buffers).ok()) {
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_SEALED;
-        std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
-        evicted_entries[i]->construct_duration =
-            std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
-        get_req->num_satisfied += 1;
-      }
-    } else {
-      // We tried to get the objects from the external store, but could not get them.
-      // Set the state of these objects back to PLASMA_EVICTED so some other request
-      // can try again.
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_EVICTED;
-      }
-    }
+    RestoreObjects(evicted_ids, client);
   }
 
   // If all of the objects are present already or if the timeout is 0, return to
@@ -670,6 +664,7 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
 
   std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
   std::vector<ObjectTableEntry*> evicted_entries;
+  std::vector<fb::ObjectInfoT> deletions;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
     auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -693,16 +688,21 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
       // If there is no backing external store, just erase the object entry
       // and send a deletion notification.
       EraseFromObjectTable(object_id);
-      // Inform all subscribers that the object has been deleted.
       fb::ObjectInfoT notification;
       notification.object_id = object_id.binary();
       notification.is_deletion = true;
-      PushNotification(&notification);
+      deletions.push_back(std::move(notification));
     }
   }
 
+  // Inform all subscribers that the objects have been deleted, in a single
+  // message.
+  if (!deletions.empty()) {
+    PushNotifications(deletions);
+  }
+
   if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
+    ARROW_CHECK_OK(SpillObjects(object_ids, evicted_object_data));
     for (auto entry : evicted_entries) {
       PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
       entry->pointer = nullptr;
@@ -711,6 +711,136 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
   }
 }
 
+Status PlasmaStore::SpillObjects(const std::vector<ObjectID>& object_ids,
+                                 const std::vector<std::shared_ptr<Buffer>>& data) {
+  const size_t num_tasks = std::min<size_t>(
+      object_ids.size(), static_cast<size_t>(external_store_pool_->GetCapacity()));
+  std::vector<std::future<Status>> futures;
+  for (size_t task = 0; task < num_tasks; ++task) {
+    // Give each task a contiguous slice of the batch.
+    size_t begin = task * object_ids.size() / num_tasks;
+    size_t end = (task + 1) * object_ids.size() / num_tasks;
+    std::vector<ObjectID> ids(object_ids.begin() + begin, object_ids.begin() + end);
+    std::vector<std::shared_ptr<Buffer>> buffers(data.begin() + begin,
+                                                 data.begin() + end);
+    auto store = external_store_;
+    ARROW_ASSIGN_OR_RAISE(auto future, external_store_pool_->Submit([=]() {
+      return store->Put(ids, buffers);
+    }));
+    futures.push_back(std::move(future));
+  }
+  Status status;
+  for (auto& future : futures) {
+    status &= future.get();
+  }
+  return status;
+}
+
+void PlasmaStore::RestoreObjects(const std::vector<ObjectID>& object_ids,
+                                 Client* client) {
+  std::vector<ObjectID> restore_ids;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (!entry || entry->state != ObjectState::PLASMA_EVICTED) {
+      continue;
+    }
+    // Make sure the object pointer is not already allocated
+    ARROW_CHECK(!entry->pointer);
+    int64_t size = entry->data_size + entry->metadata_size;
+    entry->pointer = AllocateMemory(size, &entry->fd, &entry->map_size, &entry->offset,
+                                    client, false);
+    if (!entry->pointer) {
+      // We are out of memory and cannot allocate memory for this object. Leave
+      // it evicted so some other request can try again.
+      ARROW_LOG(WARNING) << "Not enough memory to restore object " << object_id.hex();
+      continue;
+    }
+    entry->state = ObjectState::PLASMA_CREATED;
+    entry->create_time = std::time(nullptr);
+    eviction_policy_.ObjectCreated(object_id, client, false);
+    // Pin the object while it is being restored. The reference is dropped in
+    // ProcessRestoredObjects.
+    if (entry->ref_count == 0) {
+      eviction_policy_.BeginObjectAccess(object_id);
+    }
+    entry->ref_count++;
+    restore_ids.push_back(object_id);
+    buffers.push_back(std::make_shared<arrow::MutableBuffer>(entry->pointer, size));
+  }
+
+  const size_t num_tasks = std::min<size_t>(
+      restore_ids.size(), static_cast<size_t>(external_store_pool_->GetCapacity()));
+  for (size_t task = 0; task < num_tasks; ++task) {
+    size_t begin = task * restore_ids.size() / num_tasks;
+    size_t end = (task + 1) * restore_ids.size() / num_tasks;
+    std::vector<ObjectID> ids(restore_ids.begin() + begin, restore_ids.begin() + end);
+    std::vector<std::shared_ptr<Buffer>> task_buffers(buffers.begin() + begin,
+                                                      buffers.begin() + end);
+    auto restore = [this, ids, task_buffers]() {
+      Status status = external_store_->Get(ids, task_buffers);
+      {
+        std::lock_guard<std::mutex> lock(completed_restores_mutex_);
+        completed_restores_.push_back({ids, status});
+      }
+      char wakeup = 0;
+      ARROW_UNUSED(write(restore_notify_fds_[1], &wakeup, 1));
+    };
+    Status status = external_store_pool_->Spawn(restore);
+    if (!status.ok()) {
+      std::lock_guard<std::mutex> lock(completed_restores_mutex_);
+      completed_restores_.push_back({ids, status});
+    }
+  }
+}
+
+void PlasmaStore::ProcessRestoredObjects() {
+  char wakeups[64];
+  ARROW_UNUSED(read(restore_notify_fds_[0], wakeups, sizeof(wakeups)));
+  std::vector<RestoreResult> results;
+  {
+    std::lock_guard<std::mutex> lock(completed_restores_mutex_);
+    results.swap(completed_restores_);
+  }
+  for (const auto& result : results) {
+    if (!result.status.ok()) {
+      ARROW_LOG(WARNING) << "Failed to restore objects from the external store: "
+                         << result.status.ToString();
+    }
+    for (const auto& object_id : result.object_ids) {
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_CREATED);
+      if (!result.status.ok()) {
+        // Put the object back into the evicted state so that some other
+        // request can try again.
+        entry->ref_count--;
+        ARROW_CHECK(entry->ref_count == 0);
+        eviction_policy_.EndObjectAccess(object_id);
+        eviction_policy_.RemoveObject(object_id);
+        PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+        entry->pointer = nullptr;
+        entry->state = ObjectState::PLASMA_EVICTED;
+        continue;
+      }
+      // The digest of the object was kept when it was evicted.
+      entry->state = ObjectState::PLASMA_SEALED;
+      entry->construct_duration = std::time(nullptr) - entry->create_time;
+      // Hand the object to the clients that are waiting for it, then drop the
+      // reference that kept it pinned during the restore.
+      UpdateObjectGetRequests(object_id);
+      entry->ref_count--;
+      if (entry->ref_count == 0) {
+        if (deletion_cache_.count(object_id) == 0) {
+          eviction_policy_.EndObjectAccess(object_id);
+        } else {
+          deletion_cache_.erase(object_id);
+          EvictObjects({object_id});
+        }
+      }
+    }
+  }
+}
+
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
@@ -846,33 +976,36 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+// Serialize a notification once, to be queued for any number of subscribers.
+static std::shared_ptr<uint8_t> MakeNotification(
+    std::vector<fb::ObjectInfoT>& object_info) {
+  return std::shared_ptr<uint8_t>(CreatePlasmaNotificationBuffer(object_info).release(),
+                                  std::default_delete<uint8_t[]>());
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
-    std::vector<fb::ObjectInfoT> info;
-    info.push_back(*object_info);
-    auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
-  }
+  std::vector<fb::ObjectInfoT> info;
+  info.push_back(*object_info);
+  PushNotifications(info);
 }
 
 void PlasmaStore::PushNotifications(std::vector<fb::ObjectInfoT>& object_info) {
+  if (pending_notifications_.empty()) {
+    return;
+  }
+  auto notification = MakeNotification(object_info);
   auto it = pending_notifications_.begin();
   while (it != pending_notifications_.end()) {
-    auto notifications = CreatePlasmaNotificationBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notifications));
+    it->second.object_notifications.push_back(notification);
     it = SendNotifications(it);
   }
 }
 
-void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
+void PlasmaStore::PushNotifications(std::vector<fb::ObjectInfoT>& object_info,
+                                    int client_fd) {
   auto it = pending_notifications_.find(client_fd);
   if (it != pending_notifications_.end()) {
-    std::vector<fb::ObjectInfoT> info;
-    info.push_back(*object_info);
-    auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
+    it->second.object_notifications.push_back(MakeNotification(object_info));
     SendNotifications(it);
   }
 }
@@ -899,7 +1032,9 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
   pending_notifications_[fd];
   client->notification_fd = fd;
 
-  // Push notifications to the new subscriber about existing sealed objects.
+  // Push notifications to the new subscriber about existing sealed objects,
+  // all in a single message.
+  std::vector<ObjectInfoT> infos;
   for (const auto& entry : store_info_.objects) {
     if (entry.second->state == ObjectState::PLASMA_SEALED) {
       ObjectInfoT info;
@@ -908,9 +1043,12 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
       info.metadata_size = entry.second->metadata_size;
       info.digest =
           std::string(reinterpret_cast<char*>(&entry.second->digest[0]), kDigestSize);
-      PushNotification(&info, fd);
+      infos.push_back(std::move(info));
     }
   }
+  if (!infos.empty()) {
+    PushNotifications(infos, fd);
+  }
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
@@ -929,10 +1067,11 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int64_t data_size;
       int64_t metadata_size;
       int device_num;
+      int numa_node;
       RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &data_size,
-                                      &metadata_size, &device_num));
-      PlasmaError error_code =
-          CreateObject(object_id, data_size, metadata_size, device_num, client, &object);
+                                      &metadata_size, &device_num, &numa_node));
+      PlasmaError error_code = CreateObject(object_id, data_size, metadata_size,
+                                            device_num, client, &object, numa_node);
       int64_t mmap_size = 0;
       if (error_code == PlasmaError::OK && device_num == 0) {
         mmap_size = GetMmapSize(object.store_fd);
@@ -1073,6 +1212,12 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest));
       SealObjects({object_id}, {digest});
     } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      SealObjects(object_ids, digests);
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
@@ -1083,6 +1228,13 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       EvictObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
+    case fb::MessageType::PlasmaPrefetchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPrefetchRequest(input, input_size, &object_ids));
+      if (external_store_) {
+        RestoreObjects(object_ids, client);
+      }
+    } break;
     case fb::MessageType::PlasmaRefreshLRURequest: {
       std::vector<ObjectID> object_ids;
       RETURN_NOT_OK(ReadRefreshLRURequest(input, input_size, &object_ids));
@@ -1127,24 +1279,34 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
+             std::shared_ptr<ExternalStore> external_store,
+             const std::string& eviction_policy, bool numa_arenas) {
     // Create the event loop.
     loop_.reset(new EventLoop);
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+                                 external_store, eviction_policy));
     plasma_config = store_->GetPlasmaStoreInfo();
 
-    // We are using a single memory-mapped file by mallocing and freeing a single
-    // large amount of space up front. According to the documentation,
-    // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
-    // bookkeeping.
-    void* pointer = plasma::PlasmaAllocator::Memalign(
-        kBlockSize, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
-    ARROW_CHECK(pointer != nullptr);
-    // This will unmap the file, but the next one created will be as large
-    // as this one (this is an implementation detail of dlmalloc).
-    plasma::PlasmaAllocator::Free(
-        pointer, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+    if (numa_arenas) {
+      // The arenas are carved out of a single memory-mapped file as well.
+      Status s = PlasmaAllocator::CreateNumaArenas();
+      if (!s.ok()) {
+        ARROW_LOG(WARNING) << "Not using NUMA arenas: " << s.ToString();
+      }
+    }
+    if (PlasmaAllocator::NumNumaArenas() == 0) {
+      // We are using a single memory-mapped file by mallocing and freeing a single
+      // large amount of space up front. According to the documentation,
+      // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
+      // bookkeeping.
+      void* pointer = plasma::PlasmaAllocator::Memalign(
+          kBlockSize, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+      ARROW_CHECK(pointer != nullptr);
+      // This will unmap the file, but the next one created will be as large
+      // as this one (this is an implementation detail of dlmalloc).
+      plasma::PlasmaAllocator::Free(
+          pointer, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+    }
 
     int socket = BindIpcSock(socket_name, true);
     // TODO(pcm): Check return value.
@@ -1181,14 +1343,16 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store,
+                 const std::string& eviction_policy, bool numa_arenas) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  eviction_policy, numa_arenas);
 }
 
 }  // namespace plasma
@@ -1200,10 +1364,14 @@ int main(int argc, char* argv[]) {
   // Directory where plasma memory mapped files are stored.
   std::string plasma_directory;
   std::string external_store_endpoint;
+  // Replacement policy for objects that are not in use.
+  std::string eviction_policy = "lru";
   bool hugepages_enabled = false;
+  // Whether to split the memory into one arena per NUMA node.
+  bool numa_arenas = false;
   int64_t system_memory = -1;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:e:h")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:e:p:hn")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
@@ -1214,6 +1382,12 @@ int main(int argc, char* argv[]) {
       case 'h':
         hugepages_enabled = true;
         break;
+      case 'n':
+        numa_arenas = true;
+        break;
+      case 'p':
+        eviction_policy = std::string(optarg);
+        break;
       case 's':
         socket_name = optarg;
         break;
@@ -1239,6 +1413,10 @@ int main(int argc, char* argv[]) {
   if (system_memory == -1) {
     ARROW_LOG(FATAL) << "please specify the amount of system memory with -m switch";
   }
+  if (!plasma::MakeObjectCache(eviction_policy, eviction_policy, 0)) {
+    ARROW_LOG(FATAL) << "unknown eviction policy \"" << eviction_policy
+                     << "\", please specify one of lru, gdsf or 2q with -p";
+  }
   if (hugepages_enabled && plasma_directory.empty()) {
     ARROW_LOG(FATAL) << "if you want to use hugepages, please specify path to huge pages "
                         "filesystem with -d";
@@ -1295,7 +1473,8 @@ int main(int argc, char* argv[]) {
     ARROW_CHECK_OK(external_store->Connect(external_store_endpoint));
   }
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      eviction_policy, numa_arenas);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
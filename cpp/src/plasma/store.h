@@ -20,11 +20,14 @@
 
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "arrow/util/thread_pool.h"
+
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/external_store.h"
@@ -50,8 +53,9 @@ struct GetRequest;
 
 struct NotificationQueue {
   /// The object notifications for clients. We notify the client about the
-  /// objects in the order that the objects were sealed or deleted.
-  std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// objects in the order that the objects were sealed or deleted. A
+  /// notification is serialized once and shared by all subscribers.
+  std::deque<std::shared_ptr<uint8_t>> object_notifications;
 };
 
 class PlasmaStore {
@@ -61,7 +65,8 @@ class PlasmaStore {
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              const std::string& eviction_policy = "lru");
 
   ~PlasmaStore();
 
@@ -81,6 +86,7 @@ class PlasmaStore {
   ///        device_num = 2 corresponds to GPU1, etc.
   /// @param client The client that created the object.
   /// @param result The object that has been created.
+  /// @param numa_node NUMA node to preferably allocate the object on, -1 if any.
   /// @return One of the following error codes:
   ///  - PlasmaError::OK, if the object was created successfully.
   ///  - PlasmaError::ObjectExists, if an object with this ID is already
@@ -91,7 +97,7 @@ class PlasmaStore {
   ///    plasma_release.
   PlasmaError CreateObject(const ObjectID& object_id, int64_t data_size,
                            int64_t metadata_size, int device_num, Client* client,
-                           PlasmaObject* result);
+                           PlasmaObject* result, int numa_node = -1);
 
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
@@ -116,6 +122,17 @@ class PlasmaStore {
   /// @param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Start restoring objects that were evicted to the external store. The
+  /// reads run on the external store worker pool; until they complete, the
+  /// objects are pinned and stay in the PLASMA_CREATED state, so get requests
+  /// for them wait as for any other object that is not sealed yet. Objects
+  /// that are not evicted, or for which no memory can be allocated, are
+  /// skipped.
+  ///
+  /// @param object_ids Object IDs of the objects to restore.
+  /// @param client The client on whose behalf memory is allocated.
+  void RestoreObjects(const std::vector<ObjectID>& object_ids, Client* client);
+
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
@@ -176,7 +193,7 @@ class PlasmaStore {
 
   void PushNotifications(std::vector<ObjectInfoT>& object_notifications);
 
-  void PushNotification(ObjectInfoT* object_notification, int client_fd);
+  void PushNotifications(std::vector<ObjectInfoT>& object_notifications, int client_fd);
 
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
@@ -195,13 +212,23 @@ class PlasmaStore {
 
   void UpdateObjectGetRequests(const ObjectID& object_id);
 
+  /// Write a batch of evicted objects to the external store. The batch is
+  /// split across the external store worker pool, and this waits for all of
+  /// it because the memory of the objects is reused as soon as it returns.
+  Status SpillObjects(const std::vector<ObjectID>& object_ids,
+                      const std::vector<std::shared_ptr<Buffer>>& data);
+
+  /// Seal the objects whose restores from the external store have completed.
+  /// This runs on the event loop when the worker pool signals completion.
+  void ProcessRestoredObjects();
+
   int RemoveFromClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                                 Client* client);
 
   void EraseFromObjectTable(const ObjectID& object_id);
 
   uint8_t* AllocateMemory(size_t size, int* fd, int64_t* map_size, ptrdiff_t* offset,
-                          Client* client, bool is_create);
+                          Client* client, bool is_create, int numa_node = -1);
 #ifdef PLASMA_CUDA
   Status AllocateCudaMemory(int device_num, int64_t size, uint8_t** out_pointer,
                             std::shared_ptr<CudaIpcMemHandle>* out_ipc_handle);
@@ -236,6 +263,20 @@ class PlasmaStore {
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
   std::shared_ptr<ExternalStore> external_store_;
+  /// Worker pool running the external store requests.
+  std::shared_ptr<arrow::internal::ThreadPool> external_store_pool_;
+  /// Restores that completed on the worker pool and still need to be
+  /// processed on the event loop.
+  struct RestoreResult {
+    std::vector<ObjectID> object_ids;
+    Status status;
+  };
+  std::vector<RestoreResult> completed_restores_;
+  /// Protects completed_restores_.
+  std::mutex completed_restores_mutex_;
+  /// A pipe the worker pool writes to in order to wake up the event loop
+  /// when a restore completes.
+  int restore_notify_fds_[2];
 #ifdef PLASMA_CUDA
   arrow::cuda::CudaDeviceManager* manager_;
 #endif
@@ -699,6 +699,90 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, BatchSealTest) {
+  std::vector<ObjectID> object_ids = {random_object_id(), random_object_id()};
+  std::vector<std::string> data = {"hello", "world"};
+  std::vector<std::shared_ptr<Buffer>> buffers(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    ARROW_CHECK_OK(
+        client_.Create(object_ids[i], data[i].size(), nullptr, 0, &buffers[i]));
+    memcpy(buffers[i]->mutable_data(), data[i].data(), data[i].size());
+  }
+  ARROW_CHECK_OK(client_.Seal(object_ids));
+  for (const auto& object_id : object_ids) {
+    ARROW_CHECK_OK(client_.Release(object_id));
+  }
+
+  // Sealing again fails without touching any of the objects.
+  ASSERT_TRUE(IsPlasmaObjectNonexistent(client_.Seal(object_ids)));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    std::string out(reinterpret_cast<const char*>(object_buffers[i].data->data()),
+                    object_buffers[i].data->size());
+    ASSERT_EQ(data[i], out);
+  }
+}
+
+TEST_F(TestPlasmaStore, ReleaseCacheTest) {
+  ObjectID object_id = random_object_id();
+  ARROW_CHECK_OK(client_.SetReleaseCacheCapacity(1024 * 1024));
+  std::vector<uint8_t> data(100, 7);
+  CreateObject(client_, object_id, {42}, data);
+
+  // The object is no longer in use, but the client still holds the store's
+  // reference to it.
+  ASSERT_FALSE(client_.IsInUse(object_id));
+  ObjectTable objects;
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_id]->ref_count, 1);
+
+  // Other clients cannot delete it while it is cached.
+  ARROW_CHECK_OK(client2_.Delete(object_id));
+  bool has_object = false;
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+
+  // A repeated Get is served from the cache.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id}, 0, &object_buffers));
+  ASSERT_TRUE(object_buffers[0].data);
+  ASSERT_EQ(object_buffers[0].data->size(), 100);
+  ASSERT_EQ(object_buffers[0].data->data()[0], 7);
+  ASSERT_EQ(object_buffers[0].metadata->data()[0], 42);
+  ASSERT_TRUE(client_.IsInUse(object_id));
+  object_buffers.clear();
+
+  // Deleting from the caching client drops the cached reference first.
+  ARROW_CHECK_OK(client_.Delete(object_id));
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+
+  // Shrinking the cache gives the references back to the store.
+  ObjectID object_id2 = random_object_id();
+  CreateObject(client_, object_id2, {42}, data);
+  ARROW_CHECK_OK(client_.SetReleaseCacheCapacity(0));
+  objects.clear();
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_id2]->ref_count, 0);
+}
+
+TEST_F(TestPlasmaStore, NumaNodeTest) {
+  ASSERT_TRUE(client_.SetNumaNode(-3).IsInvalid());
+  // Placement is only a preference, so objects can be created whether or not
+  // the store has NUMA arenas and the node exists.
+  std::vector<uint8_t> data(100, 7);
+  for (int numa_node : {kLocalNumaNode, 0, 1000, -1}) {
+    ARROW_CHECK_OK(client_.SetNumaNode(numa_node));
+    ObjectID object_id = random_object_id();
+    CreateObject(client_, object_id, {42}, data);
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client2_.Get({object_id}, 0, &object_buffers));
+    ASSERT_EQ(object_buffers[0].data->data()[0], 7);
+  }
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
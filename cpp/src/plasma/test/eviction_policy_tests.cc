@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+std::vector<ObjectID> Evict(ObjectCache* cache, int64_t num_bytes) {
+  std::vector<ObjectID> objects_to_evict;
+  cache->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+  for (const auto& object_id : objects_to_evict) {
+    cache->Erase(object_id);
+  }
+  return objects_to_evict;
+}
+
+TEST(EvictionPolicyTest, MakeObjectCache) {
+  ASSERT_NE(MakeObjectCache("lru", "test", 1000), nullptr);
+  ASSERT_NE(MakeObjectCache("gdsf", "test", 1000), nullptr);
+  ASSERT_NE(MakeObjectCache("2q", "test", 1000), nullptr);
+  ASSERT_EQ(MakeObjectCache("fifo", "test", 1000), nullptr);
+}
+
+TEST(EvictionPolicyTest, LRUEvictsLeastRecentlyUsed) {
+  LRUCache cache("test", 1000);
+  ObjectID id1 = random_object_id();
+  ObjectID id2 = random_object_id();
+  cache.Add(id1, 100);
+  cache.Add(id2, 100);
+  // Using id1 again makes id2 the least recently used object.
+  ASSERT_EQ(cache.Remove(id1), 100);
+  cache.Add(id1, 100);
+  ASSERT_EQ(Evict(&cache, 1), std::vector<ObjectID>{id2});
+  ASSERT_EQ(cache.num_evictions(), 1);
+  ASSERT_EQ(cache.bytes_evicted(), 100);
+  ASSERT_EQ(cache.RemainingCapacity(), 900);
+}
+
+TEST(EvictionPolicyTest, GDSFPrefersSmallFrequentObjects) {
+  GDSFCache cache("test", 10000);
+  ObjectID small = random_object_id();
+  ObjectID large = random_object_id();
+  cache.Add(small, 10);
+  cache.Add(large, 1000);
+  // The large object is evicted first even though it was added last.
+  ASSERT_EQ(Evict(&cache, 1), std::vector<ObjectID>{large});
+
+  ObjectID hot = random_object_id();
+  ObjectID cold = random_object_id();
+  cache.Add(hot, 10);
+  cache.Add(cold, 10);
+  ASSERT_EQ(cache.Remove(hot), 10);
+  cache.Add(hot, 10);
+  std::vector<ObjectID> evicted = Evict(&cache, 20);
+  ASSERT_EQ(evicted, (std::vector<ObjectID>{small, cold}));
+  ASSERT_EQ(cache.NumObjects(), 1U);
+}
+
+TEST(EvictionPolicyTest, TwoQueueProtectsReusedObjects) {
+  TwoQueueCache cache("test", 1000);
+  ObjectID hot = random_object_id();
+  cache.Add(hot, 100);
+  ASSERT_EQ(cache.Remove(hot), 100);
+  cache.Add(hot, 100);
+
+  // A stream of objects used once goes through the probation queue.
+  std::vector<ObjectID> once;
+  for (int i = 0; i < 3; ++i) {
+    once.push_back(random_object_id());
+    cache.Add(once.back(), 100);
+  }
+  ASSERT_EQ(Evict(&cache, 100), std::vector<ObjectID>{once[0]});
+  // Once the probation queue is below its share, the protected queue is used.
+  ASSERT_EQ(Evict(&cache, 100), std::vector<ObjectID>{hot});
+  ASSERT_EQ(Evict(&cache, 200), (std::vector<ObjectID>{once[1], once[2]}));
+  ASSERT_EQ(cache.NumObjects(), 0U);
+
+  // Erasing an object forgets that it was used before.
+  cache.Add(hot, 100);
+  cache.Erase(hot);
+  cache.Add(hot, 100);
+  ObjectID other = random_object_id();
+  cache.Add(other, 100);
+  ASSERT_EQ(Evict(&cache, 100), std::vector<ObjectID>{hot});
+}
+
+}  // namespace plasma
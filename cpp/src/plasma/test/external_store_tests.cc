@@ -134,6 +134,35 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'y');
+  std::string metadata = "meta";
+  for (int i = 0; i < 20; i++) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids.back(), data, metadata));
+  }
+
+  // The first objects have been evicted to the external store by now. Start
+  // restoring them before asking for them.
+  std::vector<ObjectID> prefetch_ids(object_ids.begin(), object_ids.begin() + 4);
+  ARROW_CHECK_OK(client_.Prefetch(prefetch_ids));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(prefetch_ids, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), prefetch_ids.size());
+  for (const auto& object_buffer : object_buffers) {
+    ASSERT_TRUE(object_buffer.data);
+    AssertObjectBufferEqual(object_buffer, metadata, data);
+  }
+
+  // Prefetching objects that are resident or unknown is a no-op.
+  ARROW_CHECK_OK(client_.Prefetch({object_ids.back(), random_object_id()}));
+  bool has_object = false;
+  ARROW_CHECK_OK(client_.Contains(object_ids.back(), &has_object));
+  ASSERT_TRUE(has_object);
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
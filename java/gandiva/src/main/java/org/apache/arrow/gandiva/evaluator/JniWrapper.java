@@ -68,6 +68,42 @@ public class JniWrapper {
                                 long selectionVectorBufferAddr, long selectionVectorBufferSize,
                                 long[] outAddrs, long[] outSizes) throws GandivaException;
 
+  /**
+   * Hands over the output buffers of the projector referenced by moduleId, to be reused by
+   * every call to evaluateProjectorWithOutputBuffers() until they are set again.
+   *
+   * @param moduleId moduleId representing expressions. Created using a call to
+   *                 buildNativeCode
+   * @param outAddrs An array of output buffers, including the validity and data
+   *                 addresses.
+   * @param outSizes The allocated size of the output buffers.
+   */
+  native void setProjectorOutputBuffers(long moduleId, long[] outAddrs,
+                                        long[] outSizes) throws GandivaException;
+
+  /**
+   * Evaluate the expressions represented by the moduleId on a record batch, like
+   * evaluateProjector(), storing the output in the buffers set with
+   * setProjectorOutputBuffers(). Variable width data buffers expanded through the
+   * expander stay set for the next evaluations.
+   *
+   * @param expander VectorExpander object. Used for callbacks from cpp.
+   * @param moduleId moduleId representing expressions. Created using a call to
+   *                 buildNativeCode
+   * @param numRows Number of rows in the record batch
+   * @param bufAddrs An array of memory addresses. Each memory address points to
+   *                 a validity vector or a data vector.
+   * @param bufSizes An array of buffer sizes. For each memory address in bufAddrs,
+   *                 the size of the buffer is present in bufSizes
+   */
+  native void evaluateProjectorWithOutputBuffers(Object expander, long moduleId, int numRows,
+                                                 long[] bufAddrs, long[] bufSizes,
+                                                 int selectionVectorType,
+                                                 int selectionVectorSize,
+                                                 long selectionVectorBufferAddr,
+                                                 long selectionVectorBufferSize)
+      throws GandivaException;
+
   /**
    * Closes the projector referenced by moduleId.
    *
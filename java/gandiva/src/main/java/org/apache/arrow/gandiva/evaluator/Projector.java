@@ -18,6 +18,7 @@
 package org.apache.arrow.gandiva.evaluator;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 import org.apache.arrow.gandiva.exceptions.EvaluatorClosedException;
@@ -55,6 +56,10 @@ public class Projector {
   private final int numExprs;
   private boolean closed;
 
+  // Output buffers last handed over to the native projector, by evaluateReusingOutput()
+  private long[] reusedOutAddrs;
+  private long[] reusedOutSizes;
+
   private Projector(JniWrapper wrapper, long moduleId, Schema schema, int numExprs) {
     this.wrapper = wrapper;
     this.moduleId = moduleId;
@@ -139,7 +144,7 @@ public class Projector {
     evaluate(recordBatch.getLength(), recordBatch.getBuffers(),
              recordBatch.getBuffersLayout(),
              SelectionVectorType.SV_NONE.getNumber(), recordBatch.getLength(),
-             0, 0, outColumns);
+             0, 0, outColumns, false);
   }
 
   /**
@@ -161,7 +166,7 @@ public class Projector {
     }
     evaluate(numRows, buffers, buffersLayout,
              SelectionVectorType.SV_NONE.getNumber(),
-             numRows, 0, 0, outColumns);
+             numRows, 0, 0, outColumns, false);
   }
 
   /**
@@ -180,7 +185,7 @@ public class Projector {
         selectionVector.getRecordCount(),
         selectionVector.getBuffer().memoryAddress(),
         selectionVector.getBuffer().capacity(),
-        outColumns);
+        outColumns, false);
   }
 
   /**
@@ -208,13 +213,53 @@ public class Projector {
         selectionVector.getRecordCount(),
         selectionVector.getBuffer().memoryAddress(),
         selectionVector.getBuffer().capacity(),
-        outColumns);
+        outColumns, false);
+  }
+
+  /**
+   * Invoke this function to evaluate a set of expressions against a recordBatch, when the
+   * same output vectors are used for every batch. Their buffers are handed over to the
+   * native code only when they differ from the previous call, e.g. after a larger
+   * allocateNew() (reset() keeps them). Variable width data buffers expanded during an
+   * evaluation are kept for the next ones, so that they are rarely expanded again.
+   *
+   * @param recordBatch Record batch including the data
+   * @param outColumns Result of applying the project on the data
+   */
+  public void evaluateReusingOutput(ArrowRecordBatch recordBatch, List<ValueVector> outColumns)
+          throws GandivaException {
+    evaluate(recordBatch.getLength(), recordBatch.getBuffers(),
+             recordBatch.getBuffersLayout(),
+             SelectionVectorType.SV_NONE.getNumber(), recordBatch.getLength(),
+             0, 0, outColumns, true);
+  }
+
+  /**
+   * Invoke this function to evaluate a set of expressions against a {@link ArrowRecordBatch}
+   * on the selected positions, reusing the output vectors like
+   * {@link #evaluateReusingOutput(ArrowRecordBatch, List)}.
+   *
+   * @param recordBatch The data to evaluate against.
+   * @param selectionVector Selection vector which stores the selected rows.
+   * @param outColumns Result of applying the project on the data
+   */
+  public void evaluateReusingOutput(ArrowRecordBatch recordBatch,
+                                    SelectionVector selectionVector,
+                                    List<ValueVector> outColumns) throws GandivaException {
+    evaluate(recordBatch.getLength(), recordBatch.getBuffers(),
+        recordBatch.getBuffersLayout(),
+        selectionVector.getType().getNumber(),
+        selectionVector.getRecordCount(),
+        selectionVector.getBuffer().memoryAddress(),
+        selectionVector.getBuffer().capacity(),
+        outColumns, true);
   }
 
   private void evaluate(int numRows, List<ArrowBuf> buffers, List<ArrowBuffer> buffersLayout,
                        int selectionVectorType, int selectionVectorRecordCount,
                        long selectionVectorAddr, long selectionVectorSize,
-                       List<ValueVector> outColumns) throws GandivaException {
+                       List<ValueVector> outColumns, boolean reuseOutput)
+          throws GandivaException {
     if (this.closed) {
       throw new EvaluatorClosedException();
     }
@@ -268,12 +313,36 @@ public class Projector {
       outColumnIdx++;
     }
 
-    wrapper.evaluateProjector(
-        hasVariableWidthColumns ? new VectorExpander(resizableVectors) : null,
+    VectorExpander expander =
+        hasVariableWidthColumns ? new VectorExpander(resizableVectors) : null;
+    if (!reuseOutput) {
+      wrapper.evaluateProjector(expander,
+          this.moduleId, numRows, bufAddrs, bufSizes,
+          selectionVectorType, selectionVectorRecordCount,
+          selectionVectorAddr, selectionVectorSize,
+          outAddrs, outSizes);
+      return;
+    }
+
+    if (!Arrays.equals(outAddrs, reusedOutAddrs) || !Arrays.equals(outSizes, reusedOutSizes)) {
+      wrapper.setProjectorOutputBuffers(this.moduleId, outAddrs, outSizes);
+      reusedOutAddrs = outAddrs;
+      reusedOutSizes = outSizes;
+    }
+    wrapper.evaluateProjectorWithOutputBuffers(expander,
         this.moduleId, numRows, bufAddrs, bufSizes,
         selectionVectorType, selectionVectorRecordCount,
-        selectionVectorAddr, selectionVectorSize,
-        outAddrs, outSizes);
+        selectionVectorAddr, selectionVectorSize);
+
+    if (hasVariableWidthColumns) {
+      // The native side keeps the expanded data buffers, so must we
+      idx = 0;
+      for (ValueVector valueVector : outColumns) {
+        idx += (valueVector instanceof VariableWidthVector) ? 2 : 1;
+        reusedOutAddrs[idx] = valueVector.getDataBuffer().memoryAddress();
+        reusedOutSizes[idx++] = valueVector.getDataBuffer().capacity();
+      }
+    }
   }
 
   /**
@@ -285,6 +354,8 @@ public class Projector {
     }
 
     wrapper.closeProjector(this.moduleId);
+    this.reusedOutAddrs = null;
+    this.reusedOutSizes = null;
     this.closed = true;
   }
 }
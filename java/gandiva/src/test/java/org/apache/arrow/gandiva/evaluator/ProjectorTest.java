@@ -590,6 +590,82 @@ public class ProjectorTest extends BaseEvaluatorTest {
     }
   }
 
+  @Test
+  public void testEvaluateReusingOutput() throws GandivaException {
+    /*
+     * if (x >= 0) "hi" else "bye", x + 1
+     */
+
+    Field x = Field.nullable("x", new ArrowType.Int(32, true));
+
+    ArrowType retType = new ArrowType.Utf8();
+
+    TreeNode ifHiBye = TreeBuilder.makeIf(
+        TreeBuilder.makeFunction(
+            "greater_than_or_equal_to",
+            Lists.newArrayList(
+                TreeBuilder.makeField(x),
+                TreeBuilder.makeLiteral(0)
+            ),
+            boolType),
+        TreeBuilder.makeStringLiteral("hi"),
+        TreeBuilder.makeStringLiteral("bye"),
+        retType);
+    TreeNode addOne = TreeBuilder.makeFunction(
+        "add",
+        Lists.newArrayList(TreeBuilder.makeField(x), TreeBuilder.makeLiteral(1)),
+        int32);
+
+    ExpressionTree strExpr = TreeBuilder.makeExpression(ifHiBye,
+        Field.nullable("res", retType));
+    ExpressionTree intExpr = TreeBuilder.makeExpression(addOne,
+        Field.nullable("res2", int32));
+    Schema schema = new Schema(Lists.newArrayList(x));
+    Projector eval = Projector.make(schema, Lists.newArrayList(strExpr, intExpr));
+
+    int numRows = 4;
+    byte[] validity = new byte[]{(byte) 255, 0};
+    int[][] xValues = new int[][]{{10, -10, 20, -20}, {-1, -2, -3, 4}};
+    String[][] expected = new String[][]{{"hi", "bye", "hi", "bye"},
+                                         {"bye", "bye", "bye", "hi"}};
+
+    // the data buffer of the string output is too small, it gets expanded by the
+    // first evaluation and reused by the second one
+    VarCharVector strVector = new VarCharVector(EMPTY_SCHEMA_PATH, allocator);
+    strVector.allocateNew(4, numRows);
+    IntVector intVector = new IntVector(EMPTY_SCHEMA_PATH, allocator);
+    intVector.allocateNew(numRows);
+    List<ValueVector> output = new ArrayList<>();
+    output.add(strVector);
+    output.add(intVector);
+
+    try {
+      for (int batchIdx = 0; batchIdx < xValues.length; batchIdx++) {
+        ArrowBuf validityX = buf(validity);
+        ArrowBuf dataX = intBuf(xValues[batchIdx]);
+        ArrowRecordBatch batch =
+            new ArrowRecordBatch(
+                numRows,
+                Lists.newArrayList(new ArrowFieldNode(numRows, 0)),
+                Lists.newArrayList(validityX, dataX));
+
+        strVector.reset();
+        intVector.reset();
+        eval.evaluateReusingOutput(batch, output);
+        releaseRecordBatch(batch);
+
+        for (int i = 0; i < numRows; i++) {
+          assertFalse(strVector.isNull(i));
+          assertEquals(expected[batchIdx][i], new String(strVector.get(i)));
+          assertEquals(xValues[batchIdx][i] + 1, intVector.get(i));
+        }
+      }
+    } finally {
+      releaseValueVectors(output);
+      eval.close();
+    }
+  }
+
   @Test
   public void testRegex() throws GandivaException {
     /*
@@ -1458,6 +1458,7 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         int64_t size
         CMemoryPool* pool
         c_bool from_pandas
+        int64_t inference_sample_size
 
     # TODO Some functions below are not actually "nogil"
 
@@ -54,6 +54,7 @@ cdef class SerializationContext:
         object custom_deserializers
         object pickle_serializer
         object pickle_deserializer
+        object pickle_out_of_band
 
     def __init__(self):
         # Types with special serialization handlers
@@ -64,8 +65,11 @@ cdef class SerializationContext:
         self.custom_deserializers = dict()
         self.pickle_serializer = pickle.dumps
         self.pickle_deserializer = pickle.loads
+        # Pickle protocol 5 passes large buffers out-of-band, they are then
+        # serialized as pyarrow buffers without being copied into the pickle
+        self.pickle_out_of_band = pickle.HIGHEST_PROTOCOL >= 5
 
-    def set_pickle(self, serializer, deserializer):
+    def set_pickle(self, serializer, deserializer, out_of_band=False):
         """
         Set the serializer and deserializer to use for objects that are to be
         pickled.
@@ -76,9 +80,15 @@ cdef class SerializationContext:
             The serializer to use (e.g., pickle.dumps or cloudpickle.dumps).
         deserializer : callable
             The deserializer to use (e.g., pickle.dumps or cloudpickle.dumps).
+        out_of_band : bool, default False
+            Whether the serializer supports pickle protocol 5 out-of-band
+            buffers, i.e. accepts the protocol and buffer_callback arguments
+            and the deserializer accepts the buffers argument. The buffers are
+            then serialized without copies.
         """
         self.pickle_serializer = serializer
         self.pickle_deserializer = deserializer
+        self.pickle_out_of_band = out_of_band
 
     def clone(self):
         """
@@ -96,6 +106,7 @@ cdef class SerializationContext:
         result.custom_deserializers = self.custom_deserializers.copy()
         result.pickle_serializer = self.pickle_serializer
         result.pickle_deserializer = self.pickle_deserializer
+        result.pickle_out_of_band = self.pickle_out_of_band
 
         return result
 
@@ -147,8 +158,15 @@ cdef class SerializationContext:
         # use the closest match to type(obj)
         type_id = self.type_to_type_id[type_]
         if type_id in self.types_to_pickle:
-            serialized_obj = {"data": self.pickle_serializer(obj),
-                              "pickle": True}
+            if self.pickle_out_of_band:
+                buffers = []
+                data = self.pickle_serializer(obj, protocol=5,
+                                              buffer_callback=buffers.append)
+                serialized_obj = {"data": data, "pickle": True,
+                                  "buffers": buffers}
+            else:
+                serialized_obj = {"data": self.pickle_serializer(obj),
+                                  "pickle": True}
         elif type_id in self.custom_serializers:
             serialized_obj = {"data": self.custom_serializers[type_id](obj)}
         else:
@@ -171,7 +189,12 @@ cdef class SerializationContext:
 
         if "pickle" in serialized_obj:
             # The object was pickled, so unpickle it.
-            obj = self.pickle_deserializer(serialized_obj["data"])
+            if "buffers" in serialized_obj:
+                obj = self.pickle_deserializer(
+                    serialized_obj["data"],
+                    buffers=serialized_obj["buffers"])
+            else:
+                obj = self.pickle_deserializer(serialized_obj["data"])
         else:
             assert type_id not in self.types_to_pickle
             if type_id not in self.whitelisted_types:
@@ -1616,6 +1616,29 @@ def test_array_from_masked():
         pa.array(ma, mask=np.array([True, False, False, False]))
 
 
+def test_array_from_numpy_with_mask():
+    # Masks are packed eight values at a time, then value by value
+    for length in [0, 5, 8, 21]:
+        values = np.arange(length, dtype='int64')
+        mask = values % 3 == 0
+        result = pa.array(values, mask=mask)
+        expected = pa.array([None if m else v for v, m in zip(values, mask)],
+                            type='int64')
+        assert result.equals(expected)
+
+        # Strided masks
+        result = pa.array(values[::2], mask=mask[::2])
+        assert result.equals(expected.take(pa.array(range(0, length, 2))))
+
+
+def test_array_from_large_strided():
+    # Large strided arrays are copied in parallel
+    values = np.arange(3 * 2**20, dtype='int64')
+    for arr in [values[::3], values[::-2], values.view('int32')[::3]]:
+        result = pa.array(arr)
+        assert result.to_numpy().tolist() == arr.tolist()
+
+
 def test_array_from_invalid_dim_raises():
     msg = "only handle 1-dimensional arrays"
     arr2d = np.array([[1, 2, 3], [4, 5, 6]])
@@ -454,6 +454,35 @@ def test_garbage_collection():
     assert pa.total_allocated_bytes() == bytes_before
 
 
+@pytest.mark.parametrize(('data', 'expected_type'), [
+    ([None, 1, 2, None, 3], pa.int64()),
+    ([None, 1.5, None, 2.5], pa.float64()),
+    ([None, 'a', 'bc', None, '\u00e9'], pa.utf8()),
+    ([None, b'a', b'bc', None], pa.binary()),
+])
+def test_sequence_homogeneous(data, expected_type):
+    # Lists of values of a single builtin type are converted without the GIL
+    arr = pa.array(data)
+    assert arr.type == expected_type
+    assert arr.to_pylist() == data
+
+    arr = pa.array(data, type=expected_type)
+    assert arr.to_pylist() == data
+
+
+def test_sequence_homogeneous_fallback():
+    # Values which the fast path doesn't handle are converted as before
+    assert pa.array([1, True]).type == pa.int64()
+    assert pa.array([1, 2.5]).type == pa.float64()
+    assert pa.array(['a', b'b']).type == pa.binary()
+    assert pa.array([1.5, 2.5], type=pa.float32()).type == pa.float32()
+    with pytest.raises((OverflowError, pa.ArrowInvalid)):
+        pa.array([1, 2**64])
+
+    arr = pa.array([1.5, np.nan], from_pandas=True)
+    assert arr.null_count == 1
+
+
 def test_sequence_double():
     data = [1.5, 1., None, 2.5, None, None]
     arr = pa.array(data)
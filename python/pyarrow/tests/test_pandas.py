@@ -2626,6 +2626,18 @@ def test_to_pandas_deduplicate_strings_array_types():
         _assert_nunique(arr.to_pandas(deduplicate_objects=False), len(arr))
 
 
+def test_to_pandas_deduplicate_strings_with_nulls():
+    nunique = 100
+    repeats = 10
+    values = _generate_dedup_example(nunique, repeats) + [None] * repeats
+
+    arr = pa.chunked_array([values, values])
+    result = arr.to_pandas()
+    # None is one more unique object
+    _assert_nunique(result, nunique + 1)
+    assert result.tolist() == values + values
+
+
 def test_to_pandas_deduplicate_strings_table_types():
     nunique = 100
     repeats = 10
@@ -1011,6 +1011,37 @@ def test_set_pickle():
     assert deserialized == b'custom serialization 2'
 
 
+@pytest.mark.skipif(pickle.HIGHEST_PROTOCOL < 5,
+                    reason="need pickle protocol 5")
+def test_pickle_out_of_band_buffers():
+    class Foo(object):
+        def __init__(self, arr):
+            self.arr = arr
+
+    context = pa.SerializationContext()
+    context.register_type(Foo, 'Foo', pickle=True)
+
+    arr = np.arange(1 << 16, dtype=np.int64)
+    serialized = pa.serialize(Foo(arr), context=context)
+    # The array is not copied into the pickle but passed as a buffer
+    assert serialized.to_components()['num_buffers'] == 1
+    buf = serialized.to_buffer()
+    assert buf.size < arr.nbytes + 4096
+
+    result = pa.deserialize(buf, context=context)
+    np.testing.assert_array_equal(result.arr, arr)
+    # The deserialized array is a view of the serialized buffer
+    address = result.arr.ctypes.data
+    assert buf.address <= address < buf.address + buf.size
+
+    # Serializers which don't support out-of-band buffers pickle in-band
+    context.set_pickle(pickle.dumps, pickle.loads)
+    serialized = pa.serialize(Foo(arr), context=context)
+    assert serialized.to_components()['num_buffers'] == 0
+    result = pa.deserialize(serialized.to_buffer(), context=context)
+    np.testing.assert_array_equal(result.arr, arr)
+
+
 @pytest.mark.skipif(sys.version_info < (3, 6), reason="need Python 3.6")
 def test_path_objects(tmpdir):
     # Test compatibility with PEP 519 path-like objects